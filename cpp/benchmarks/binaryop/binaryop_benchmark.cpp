@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+class BinaryOp : public cudf::benchmark {};
+
+/**
+ * @brief Applies `op` between two columns of `T`
+ *
+ * `ADD` and `LESS` run the compiled kernels, the bitwise operators are JIT
+ * compiled. A JIT operation is compiled when it is first used in the process,
+ * unless the kernel cache on disk already has it, and is taken from the
+ * in-process cache afterwards: the `jit_first_call` benchmark times one
+ * iteration of an operation that no other benchmark uses, with nothing run
+ * before it, the others time the cached kernels.
+ */
+template <typename T, cudf::experimental::binary_operator op>
+void BM_binaryop(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.1;
+  profile.integer_lower  = 1;
+  auto const type        = cudf::experimental::type_to_id<T>();
+  auto const operands    = create_random_table({type, type}, num_rows, profile);
+  auto const output_type = cudf::data_type{
+    op == cudf::experimental::binary_operator::LESS ? cudf::BOOL8 : type};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::experimental::binary_operation(
+      operands->get_column(0), operands->get_column(1), op, output_type);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * 2 * sizeof(T));
+}
+
+using cudf::experimental::binary_operator;
+
+// Registered first so that no JIT kernel of the process is compiled before it
+BENCHMARK_DEFINE_F(BinaryOp, jit_first_call)(::benchmark::State& state) {
+  BM_binaryop<int16_t, binary_operator::BITWISE_OR>(state);
+}
+BENCHMARK_REGISTER_F(BinaryOp, jit_first_call)
+  ->Arg(1 << 20)
+  ->Iterations(1)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
+
+#define BINARYOP_BENCHMARK_DEFINE(name, type, op)                  \
+  BENCHMARK_DEFINE_F(BinaryOp, name)(::benchmark::State & state) { \
+    BM_binaryop<type, op>(state);                                  \
+  }                                                                \
+  BENCHMARK_REGISTER_F(BinaryOp, name)                             \
+    ->RangeMultiplier(32)                                          \
+    ->Range(1 << 10, 1 << 25)                                      \
+    ->UseManualTime()                                              \
+    ->Unit(benchmark::kMillisecond);
+
+BINARYOP_BENCHMARK_DEFINE(compiled_add_int32, int32_t, binary_operator::ADD)
+BINARYOP_BENCHMARK_DEFINE(compiled_add_float64, double, binary_operator::ADD)
+BINARYOP_BENCHMARK_DEFINE(compiled_less_int64, int64_t, binary_operator::LESS)
+BINARYOP_BENCHMARK_DEFINE(jit_bitwise_and_int32, int32_t, binary_operator::BITWISE_AND)
+BINARYOP_BENCHMARK_DEFINE(jit_bitwise_xor_int64, int64_t, binary_operator::BITWISE_XOR)
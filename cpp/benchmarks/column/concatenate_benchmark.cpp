@@ -140,6 +140,15 @@ static void BM_concatenate_tables(benchmark::State& state) {
 CONCAT_TABLES_BENCHMARK_DEFINE(concat_tables_int64_non_null, int64_t, false)
 CONCAT_TABLES_BENCHMARK_DEFINE(concat_tables_int64_nullable, int64_t, true)
 
+// Many small tables, as the partitions received by a shuffle
+BENCHMARK_TEMPLATE_DEFINE_F(Concatenate, concat_many_tables_int64_nullable, int64_t, true)
+(::benchmark::State& state) { BM_concatenate_tables<int64_t, true>(state); }
+BENCHMARK_REGISTER_F(Concatenate, concat_many_tables_int64_nullable)
+  ->RangeMultiplier(8)
+  ->Ranges({{1 << 6, 1 << 9}, {4, 4}, {512, 4096}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
 template <bool Nullable>
 class ConcatenateStrings : public cudf::benchmark {};
 
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "generate_benchmark_input.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/random.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace {
+
+constexpr int64_t zipf_default_ranks = 1 << 20;  ///< Ranks of ZIPF values of unlimited cardinality
+
+/**
+ * @brief Mixes the bits of `x`, to seed an engine per element
+ */
+__host__ __device__ inline uint64_t mix(uint64_t x) {
+  x += 0x9e3779b97f4a7c15;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Draws numbers in `[0, 1)` of a distribution, optionally quantized to
+ * `cardinality` distinct numbers
+ */
+struct unit_sampler {
+  distribution_id distribution;
+  double zipf_exponent;
+  int64_t cardinality;
+  uint64_t seed;
+
+  __device__ double zipf_rank(double u, int64_t ranks) const {
+    // Inverse of the CDF of the density `x^-s` over [1, ranks + 1)
+    double const n = static_cast<double>(ranks) + 1;
+    double const x = (zipf_exponent == 1.0)
+                       ? exp(u * log(n))
+                       : pow(u * (pow(n, 1 - zipf_exponent) - 1) + 1, 1 / (1 - zipf_exponent));
+    return min(floor(x) - 1, static_cast<double>(ranks - 1));
+  }
+
+  __device__ double operator()(uint64_t i) const {
+    thrust::default_random_engine engine(static_cast<uint32_t>(mix(seed ^ mix(i))));
+    thrust::uniform_real_distribution<double> uniform(0, 1);
+    double u = uniform(engine);
+    if (distribution == distribution_id::NORMAL) {
+      thrust::random::normal_distribution<double> normal(0.5, 1.0 / 6);
+      u = min(max(normal(engine), 0.0), 1 - std::numeric_limits<double>::epsilon());
+    } else if (distribution == distribution_id::ZIPF) {
+      auto const ranks = cardinality > 0 ? cardinality : zipf_default_ranks;
+      u                = (zipf_rank(u, ranks) + uniform(engine)) / ranks;
+    }
+    if (cardinality > 0) {
+      auto const k = min(static_cast<int64_t>(u * cardinality), cardinality - 1);
+      u            = (k + 0.5) / cardinality;
+    }
+    return u;
+  }
+};
+
+/**
+ * @brief Whether an element is valid, with probability `1 - null_frequency`
+ */
+struct validity_sampler {
+  double null_frequency;
+  uint64_t seed;
+
+  __device__ bool operator()(cudf::size_type i) const {
+    thrust::default_random_engine engine(static_cast<uint32_t>(mix(~seed ^ mix(i))));
+    thrust::uniform_real_distribution<double> uniform(0, 1);
+    return uniform(engine) >= null_frequency;
+  }
+};
+
+template <typename T, typename Enable = void>
+struct value_of;
+
+template <typename T>
+struct value_of<T, std::enable_if_t<std::is_integral<T>::value>> {
+  __device__ T operator()(double u, int64_t lower, int64_t upper, double, double) const {
+    auto const span = upper - lower;
+    return static_cast<T>(lower + min(static_cast<int64_t>(u * (span + 1.0)), span));
+  }
+};
+
+template <typename T>
+struct value_of<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  __device__ T operator()(double u, int64_t, int64_t, double lower, double upper) const {
+    return static_cast<T>(lower + u * (upper - lower));
+  }
+};
+
+template <typename T>
+struct value_of<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  __device__ T operator()(double u, int64_t lower, int64_t upper, double, double) const {
+    using rep = typename T::rep;
+    return T{typename T::duration{value_of<rep>{}(u, lower, upper, 0, 0)}};
+  }
+};
+
+template <typename T>
+struct fixed_width_generator {
+  unit_sampler sampler;
+  int64_t integer_lower;
+  int64_t integer_upper;
+  double float_lower;
+  double float_upper;
+
+  __device__ T operator()(cudf::size_type i) const {
+    return value_of<T>{}(sampler(i), integer_lower, integer_upper, float_lower, float_upper);
+  }
+};
+
+/**
+ * @brief The type whose range bounds the integral values of `T`: `T` itself,
+ * the representation of a timestamp, or int64_t for floating-point types
+ */
+template <typename T, typename Enable = void>
+struct integer_of {
+  using type = int64_t;
+};
+
+template <typename T>
+struct integer_of<T, std::enable_if_t<std::is_integral<T>::value>> {
+  using type = T;
+};
+
+template <typename T>
+struct integer_of<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  using type = typename T::rep;
+};
+
+struct create_fixed_width_column {
+  template <typename T>
+  static std::pair<int64_t, int64_t> integer_range(data_profile const& profile) {
+    using limits     = std::numeric_limits<typename integer_of<T>::type>;
+    auto const lower = std::max<int64_t>(profile.integer_lower, limits::lowest());
+    auto const upper = std::min<int64_t>(profile.integer_upper, limits::max());
+    return {lower, std::max(lower, upper)};
+  }
+
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() or cudf::is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::size_type num_rows,
+                                           data_profile const& profile,
+                                           uint64_t seed) {
+    auto column = cudf::make_fixed_width_column(
+      cudf::data_type{cudf::experimental::type_to_id<T>()}, num_rows);
+    auto const range = integer_range<T>(profile);
+    unit_sampler const sampler{
+      profile.distribution, profile.zipf_exponent, profile.cardinality, seed};
+    thrust::transform(
+      rmm::exec_policy()->on(0),
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      thrust::make_counting_iterator<cudf::size_type>(num_rows),
+      column->mutable_view().begin<T>(),
+      fixed_width_generator<T>{
+        sampler, range.first, range.second, profile.float_lower, profile.float_upper});
+    return column;
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_timestamp<T>())>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::size_type, data_profile const&, uint64_t) {
+    CUDF_FAIL("Unsupported type of a random column");
+  }
+};
+
+/**
+ * @brief Draws the length of the string of a key
+ */
+struct string_length {
+  unit_sampler sampler;
+  cudf::size_type min_length;
+  cudf::size_type max_length;
+  __device__ cudf::size_type operator()(uint64_t key) const {
+    return value_of<cudf::size_type>{}(sampler(key), min_length, max_length, 0, 0);
+  }
+};
+
+struct string_key {
+  unit_sampler sampler;
+  __device__ uint64_t operator()(cudf::size_type i) const {
+    return static_cast<uint64_t>(sampler(i) * (uint64_t{1} << 53));
+  }
+};
+
+struct string_offset {
+  uint64_t const* keys;
+  bool const* valid;
+  string_length length;
+  __device__ cudf::size_type operator()(cudf::size_type i) const {
+    return valid[i] ? length(keys[i]) : 0;
+  }
+};
+
+struct write_string {
+  uint64_t const* keys;
+  cudf::size_type const* offsets;
+  char* chars;
+  __device__ void operator()(cudf::size_type i) const {
+    for (auto c = offsets[i]; c < offsets[i + 1]; ++c) {
+      chars[c] = 'a' + mix(keys[i] * 31 + (c - offsets[i])) % 26;
+    }
+  }
+};
+
+struct identity {
+  __device__ bool operator()(bool valid) const { return valid; }
+};
+
+std::unique_ptr<cudf::column> create_string_column(cudf::size_type num_rows,
+                                                   data_profile const& profile,
+                                                   uint64_t seed) {
+  auto exec = rmm::exec_policy()->on(0);
+  auto rows = thrust::make_counting_iterator<cudf::size_type>(0);
+  rmm::device_vector<uint64_t> keys(num_rows);
+  thrust::transform(
+    exec,
+    rows,
+    rows + num_rows,
+    keys.begin(),
+    string_key{{profile.distribution, profile.zipf_exponent, profile.cardinality, seed}});
+  rmm::device_vector<bool> valid(num_rows);
+  thrust::transform(
+    exec, rows, rows + num_rows, valid.begin(), validity_sampler{profile.null_frequency, seed});
+
+  // The lengths of the strings of the same key are the same
+  string_length const length{
+    {profile.length_distribution, 1.0, 0, mix(seed)}, profile.min_length, profile.max_length};
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::INT32}, num_rows + 1);
+  auto d_offsets = offsets->mutable_view().data<cudf::size_type>();
+  thrust::transform(exec,
+                    rows,
+                    rows + num_rows,
+                    d_offsets,
+                    string_offset{keys.data().get(), valid.data().get(), length});
+  CUDA_TRY(cudaMemset(d_offsets + num_rows, 0, sizeof(cudf::size_type)));
+  thrust::exclusive_scan(exec, d_offsets, d_offsets + num_rows + 1, d_offsets);
+
+  cudf::size_type num_chars{};
+  CUDA_TRY(cudaMemcpy(
+    &num_chars, d_offsets + num_rows, sizeof(cudf::size_type), cudaMemcpyDeviceToHost));
+  auto chars = cudf::make_numeric_column(cudf::data_type{cudf::INT8}, num_chars);
+  thrust::for_each(
+    exec,
+    rows,
+    rows + num_rows,
+    write_string{keys.data().get(), d_offsets, chars->mutable_view().data<char>()});
+
+  auto mask =
+    cudf::experimental::detail::valid_if(valid.begin(), valid.end(), identity{});
+  return cudf::make_strings_column(
+    num_rows, std::move(offsets), std::move(chars), mask.second, std::move(mask.first));
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::experimental::table> create_random_table(
+  std::vector<cudf::type_id> const& types,
+  cudf::size_type num_rows,
+  data_profile const& profile,
+  uint64_t seed) {
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (size_t i = 0; i < types.size(); ++i) {
+    auto const column_seed = mix(seed + i);
+    std::unique_ptr<cudf::column> column;
+    if (types[i] == cudf::STRING) {
+      column = create_string_column(num_rows, profile, column_seed);
+    } else {
+      column = cudf::experimental::type_dispatcher(cudf::data_type{types[i]},
+                                                   create_fixed_width_column{},
+                                                   num_rows,
+                                                   profile,
+                                                   column_seed);
+      if (profile.null_frequency > 0) {
+        auto mask = cudf::experimental::detail::valid_if(
+          thrust::make_counting_iterator<cudf::size_type>(0),
+          thrust::make_counting_iterator<cudf::size_type>(num_rows),
+          validity_sampler{profile.null_frequency, column_seed});
+        column->set_null_mask(std::move(mask.first), mask.second);
+      }
+    }
+    if (profile.sorted) {
+      auto sorted = cudf::experimental::sort(cudf::table_view{{column->view()}});
+      column      = std::move(sorted->release().front());
+    }
+    columns.push_back(std::move(column));
+  }
+  return std::make_unique<cudf::experimental::table>(std::move(columns));
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief The distribution of the generated values over their range
+ */
+enum class distribution_id : int8_t {
+  UNIFORM,  ///< All the values of the range are equally likely
+  NORMAL,   ///< Values around the middle of the range are the most likely; 99.7% of the
+            ///< normal distribution is in the range, the rest is clamped to its bounds
+  ZIPF      ///< The value of rank `k` from the lower bound has a probability proportional
+            ///< to `1 / k^s`, as the sizes of the keys of skewed production data
+};
+
+/**
+ * @brief The properties of the columns generated by `create_random_table`
+ */
+struct data_profile {
+  /// Distribution of the values
+  distribution_id distribution = distribution_id::UNIFORM;
+  /// Exponent `s` of the ZIPF distribution
+  double zipf_exponent = 1.0;
+  /// Number of distinct values of a column; 0 is unlimited
+  int64_t cardinality = 0;
+  /// Probability of an element to be null
+  double null_frequency = 0.0;
+  /// Range of integral values, and of the ticks of timestamps; clamped to the
+  /// range of each type
+  int64_t integer_lower = 0;
+  int64_t integer_upper = 1000000;
+  /// Range of floating-point values
+  double float_lower = 0.0;
+  double float_upper = 1.0;
+  /// Distribution and range of the lengths of strings
+  distribution_id length_distribution = distribution_id::UNIFORM;
+  cudf::size_type min_length          = 0;
+  cudf::size_type max_length          = 32;
+  /// Whether each column is sorted in ascending order, nulls first
+  bool sorted = false;
+};
+
+/**
+ * @brief Generates a table of random columns on the device
+ *
+ * The values of each column are drawn from `profile.distribution` over the
+ * range of the profile, quantized to `profile.cardinality` distinct values if
+ * it is not 0. A string is derived from a key drawn the same way: its length
+ * is drawn from `profile.length_distribution`, and its characters are
+ * lowercase letters. The same `seed` generates the same table.
+ *
+ * @throw cudf::logic_error if a type is not numeric, timestamp or STRING
+ *
+ * @param types The type of each column
+ * @param num_rows The number of rows of the table
+ * @param profile The properties of the columns
+ * @param seed The seed of the random values
+ * @return The generated table
+ */
+std::unique_ptr<cudf::experimental::table> create_random_table(
+  std::vector<cudf::type_id> const& types,
+  cudf::size_type num_rows,
+  data_profile const& profile = data_profile{},
+  uint64_t seed               = 0);
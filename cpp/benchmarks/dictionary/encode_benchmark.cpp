@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/dictionary/encode.hpp>
+
+class DictionaryEncode : public cudf::benchmark {};
+
+/**
+ * @brief Encodes a column of `state.range(1)` distinct values of type `type`
+ */
+template <cudf::type_id type>
+void BM_encode(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.01;
+  profile.cardinality    = state.range(1);
+  auto const input       = create_random_table({type}, num_rows, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::dictionary::encode(input->get_column(0));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_rows);
+}
+
+#define ENCODE_BENCHMARK_DEFINE(name, type)                                \
+  BENCHMARK_DEFINE_F(DictionaryEncode, name)(::benchmark::State & state) { \
+    BM_encode<type>(state);                                                \
+  }                                                                        \
+  BENCHMARK_REGISTER_F(DictionaryEncode, name)                             \
+    ->RangeMultiplier(32)                                                  \
+    ->Ranges({{1 << 10, 1 << 24}, {1 << 4, 1 << 14}})                      \
+    ->UseManualTime()                                                      \
+    ->Unit(benchmark::kMillisecond);
+
+ENCODE_BENCHMARK_DEFINE(encode_int64, cudf::INT64)
+ENCODE_BENCHMARK_DEFINE(encode_string, cudf::STRING)
@@ -15,9 +15,14 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <rmm/mr/device/default_memory_resource.hpp>
 #include <rmm/rmm_api.h>
 #include <rmm/thrust_rmm_allocator.h>
 
+#include "memory_tracking_resource.hpp"
+
+#include <memory>
+
 namespace cudf {
 
 /**
@@ -31,6 +36,12 @@ namespace cudf {
  * The SetUp and TearDown methods of this fixture initialize RMM into pool mode
  * and finalize it, respectively. These methods are called automatically by 
  * Google Benchmark
+ *
+ * The pool is wrapped in a `memory_tracking_resource` made the default
+ * resource, so that `cuda_event_timer` reports the peak device memory of the
+ * timed region in the `peak_memory_usage` counter. The counters are in the
+ * JSON output of `--benchmark_out=<file> --benchmark_out_format=json`, which
+ * `scripts/compare_benchmarks.py` compares between two runs.
  * 
  * Example: 
  * 
@@ -56,15 +67,24 @@ class benchmark : public ::benchmark::Fixture {
   virtual void SetUp(const ::benchmark::State& state) {
     rmmOptions_t options{PoolAllocation, 0, false};
     rmmInitialize(&options);
+    tracker = std::make_unique<memory_tracking_resource>(rmm::mr::get_default_resource());
+    rmm::mr::set_default_resource(tracker.get());
   }
 
-  virtual void TearDown(const ::benchmark::State& state) { rmmFinalize(); }
+  virtual void TearDown(const ::benchmark::State& state) {
+    rmm::mr::set_default_resource(tracker->upstream());
+    tracker.reset();
+    rmmFinalize();
+  }
 
   // eliminate partial override warnings (see benchmark/benchmark.h)
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st) {
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
+
+ private:
+  std::unique_ptr<memory_tracking_resource> tracker;
 };
 
 };  // namespace cudf
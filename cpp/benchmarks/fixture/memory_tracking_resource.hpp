@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+
+/**
+ * @brief Resource that forwards to an upstream resource and tracks the
+ * current, peak and total number of bytes allocated through it
+ *
+ * `cudf::benchmark` makes it the default resource, and `cuda_event_timer`
+ * reports the peak of the timed region in the `peak_memory_usage` counter.
+ */
+class memory_tracking_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit memory_tracking_resource(rmm::mr::device_memory_resource* upstream)
+    : _upstream{upstream} {}
+
+  rmm::mr::device_memory_resource* upstream() const noexcept { return _upstream; }
+
+  size_t current_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _current;
+  }
+
+  size_t peak_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _peak;
+  }
+
+  size_t total_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _total;
+  }
+
+  /**
+   * @brief Restarts the peak and the total from the memory currently allocated
+   */
+  void reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _peak  = _current;
+    _total = 0;
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override {
+    auto p = _upstream->allocate(bytes, stream);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _current += bytes;
+    _total += bytes;
+    _peak = std::max(_peak, _current);
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override {
+    _upstream->deallocate(p, bytes, stream);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _current -= bytes;
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+  mutable std::mutex _mutex;
+  size_t _current = 0;
+  size_t _peak    = 0;
+  size_t _total   = 0;
+};
+
+}  // namespace cudf
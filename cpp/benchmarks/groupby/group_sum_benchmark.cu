@@ -19,36 +19,28 @@
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
+#include <common/generate_benchmark_input.hpp>
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
-#include <tests/utilities/column_wrapper.hpp>
 
 #include <memory>
-#include <random>
 
 class Groupby : public cudf::benchmark {};
 
-// TODO: put it in a struct so `uniform` can be remade with different min, max
-template <typename T>
-T random_int(T min, T max) {
-  static unsigned seed = 13377331;
-  static std::mt19937 engine{seed};
-  static std::uniform_int_distribution<T> uniform{min, max};
-
-  return uniform(engine);
+// Keys and values in [0, 100]
+std::unique_ptr<cudf::experimental::table> create_keys_and_values(cudf::size_type num_rows) {
+  data_profile profile;
+  profile.integer_upper = 100;
+  return create_random_table({cudf::INT64, cudf::INT64}, num_rows, profile, 13377331);
 }
 
 void BM_basic_sum(benchmark::State& state) {
-  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
-
   // const cudf::size_type num_columns{(cudf::size_type)state.range(0)};
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  auto data_it = cudf::test::make_counting_transform_iterator(
-    0, [=](cudf::size_type row) { return random_int(0, 100); });
-
-  wrapper keys(data_it, data_it + column_size);
-  wrapper vals(data_it, data_it + column_size);
+  auto input = create_keys_and_values(column_size);
+  auto keys  = input->get_column(0).view();
+  auto vals  = input->get_column(1).view();
 
   cudf::experimental::groupby::groupby gb_obj(cudf::table_view({keys}));
 
@@ -73,15 +65,11 @@ BENCHMARK_REGISTER_F(Groupby, Basic)
   ->Arg(10000000);
 
 void BM_pre_sorted_sum(benchmark::State& state) {
-  using wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
-
   const cudf::size_type column_size{(cudf::size_type)state.range(0)};
 
-  auto data_it = cudf::test::make_counting_transform_iterator(
-    0, [=](cudf::size_type row) { return random_int(0, 100); });
-
-  wrapper keys(data_it, data_it + column_size);
-  wrapper vals(data_it, data_it + column_size);
+  auto input = create_keys_and_values(column_size);
+  auto keys  = input->get_column(0).view();
+  auto vals  = input->get_column(1).view();
 
   auto keys_table  = cudf::table_view({keys});
   auto sort_order  = cudf::experimental::sorted_order(keys_table);
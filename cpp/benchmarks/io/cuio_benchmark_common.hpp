@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::experimental::io;
+
+/**
+ * @brief The types of the columns of a benchmark table
+ */
+enum class data_group : int32_t { INTEGRAL, FLOAT, TIMESTAMP, STRING };
+
+/**
+ * @brief Where the reader of a benchmark reads the encoded table from
+ */
+enum class io_source : int32_t {
+  HOST_BUFFER,  ///< A buffer in host memory
+  FILEPATH      ///< A file, which the reader memory-maps
+};
+
+constexpr int num_benchmark_columns = 8;
+constexpr int string_length         = 16;
+
+/**
+ * @brief The generated values of a column, and their text in CSV and JSON
+ * files
+ */
+struct host_column {
+  cudf::type_id type;
+  std::vector<int64_t> integers;
+  std::vector<double> floats;
+  std::vector<std::string> strings;
+  std::vector<bool> validity;
+
+  std::string text(size_t row, bool quote_strings) const {
+    switch (type) {
+      case cudf::INT32:
+      case cudf::INT64: return std::to_string(integers[row]);
+      case cudf::FLOAT32:
+      case cudf::FLOAT64: {
+        std::ostringstream out;
+        out.precision(std::numeric_limits<double>::max_digits10);
+        out << floats[row];
+        return out.str();
+      }
+      case cudf::TIMESTAMP_MILLISECONDS: {
+        std::time_t const seconds = integers[row] / 1000;
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&seconds));
+        char millis[8];
+        std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(integers[row] % 1000));
+        return quote_strings ? '"' + std::string(date) + millis + '"' : date + std::string(millis);
+      }
+      default: return quote_strings ? '"' + strings[row] + '"' : strings[row];
+    }
+  }
+};
+
+inline std::vector<cudf::type_id> group_types(data_group group) {
+  switch (group) {
+    case data_group::INTEGRAL: return {cudf::INT32, cudf::INT64};
+    case data_group::FLOAT: return {cudf::FLOAT32, cudf::FLOAT64};
+    case data_group::TIMESTAMP: return {cudf::TIMESTAMP_MILLISECONDS};
+    default: return {cudf::STRING};
+  }
+}
+
+inline std::string dtype_name(cudf::type_id type) {
+  switch (type) {
+    case cudf::INT32: return "int32";
+    case cudf::INT64: return "int64";
+    case cudf::FLOAT32: return "float32";
+    case cudf::FLOAT64: return "float64";
+    case cudf::TIMESTAMP_MILLISECONDS: return "timestamp[ms]";
+    default: return "str";
+  }
+}
+
+inline size_t row_width(cudf::type_id type) {
+  switch (type) {
+    case cudf::INT32:
+    case cudf::FLOAT32: return 4;
+    case cudf::INT64:
+    case cudf::FLOAT64:
+    case cudf::TIMESTAMP_MILLISECONDS: return 8;
+    default: return string_length;
+  }
+}
+
+/**
+ * @brief Generates the values of a column
+ *
+ * The values are drawn from `cardinality` distinct values, or are all random
+ * if `cardinality` is 0; each value is null with probability `null_percent`%.
+ */
+inline host_column generate_column(cudf::type_id type,
+                                   size_t num_rows,
+                                   int64_t cardinality,
+                                   int null_percent,
+                                   std::mt19937_64& engine) {
+  host_column column{type};
+  std::uniform_int_distribution<int64_t> keys(0, cardinality > 0 ? cardinality - 1 : INT32_MAX);
+  std::uniform_int_distribution<int> percent(0, 99);
+  for (size_t row = 0; row < num_rows; ++row) {
+    // Distinct keys map to distinct values spread over the range of the type
+    auto const key   = keys(engine);
+    auto const value = static_cast<int64_t>((key * 2654435761) % (int64_t{1} << 31));
+    switch (type) {
+      case cudf::INT32:
+      case cudf::INT64: column.integers.push_back(value - (int64_t{1} << 30)); break;
+      case cudf::FLOAT32:
+      case cudf::FLOAT64: column.floats.push_back(static_cast<float>(value) / 1024); break;
+      case cudf::TIMESTAMP_MILLISECONDS:
+        // Between 1970 and 2038
+        column.integers.push_back(value * 1000 + value % 1000);
+        break;
+      default: {
+        auto text = std::to_string(value);
+        text.resize(string_length, 'a' + key % 26);
+        column.strings.push_back(std::move(text));
+      }
+    }
+    column.validity.push_back(percent(engine) >= null_percent);
+  }
+  return column;
+}
+
+/**
+ * @brief Generates the columns of a table of about `table_bytes` bytes, of the
+ * types of `group`
+ */
+inline std::vector<host_column> generate_columns(
+  data_group group, size_t table_bytes, int64_t cardinality, int null_percent) {
+  std::mt19937_64 engine{31337};
+  auto const types = group_types(group);
+  size_t bytes_per_row{0};
+  for (int i = 0; i < num_benchmark_columns; ++i) {
+    bytes_per_row += row_width(types[i % types.size()]);
+  }
+  auto const num_rows = table_bytes / bytes_per_row;
+
+  std::vector<host_column> columns;
+  for (int i = 0; i < num_benchmark_columns; ++i) {
+    columns.push_back(
+      generate_column(types[i % types.size()], num_rows, cardinality, null_percent, engine));
+  }
+  return columns;
+}
+
+template <typename T, typename Values>
+std::unique_ptr<cudf::column> make_fixed_width_column(Values const& values,
+                                                      std::vector<bool> const& validity) {
+  return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end(), validity.begin())
+    .release();
+}
+
+/**
+ * @brief Creates the device table of generated columns
+ */
+inline std::unique_ptr<cudf::experimental::table> create_table(
+  std::vector<host_column> const& columns) {
+  std::vector<std::unique_ptr<cudf::column>> output;
+  for (auto const& col : columns) {
+    switch (col.type) {
+      case cudf::INT32:
+        output.push_back(make_fixed_width_column<int32_t>(col.integers, col.validity));
+        break;
+      case cudf::INT64:
+        output.push_back(make_fixed_width_column<int64_t>(col.integers, col.validity));
+        break;
+      case cudf::FLOAT32:
+        output.push_back(make_fixed_width_column<float>(col.floats, col.validity));
+        break;
+      case cudf::FLOAT64:
+        output.push_back(make_fixed_width_column<double>(col.floats, col.validity));
+        break;
+      case cudf::TIMESTAMP_MILLISECONDS:
+        output.push_back(make_fixed_width_column<cudf::timestamp_ms>(col.integers, col.validity));
+        break;
+      default:
+        output.push_back(cudf::test::strings_column_wrapper(
+                           col.strings.begin(), col.strings.end(), col.validity.begin())
+                           .release());
+    }
+  }
+  return std::make_unique<cudf::experimental::table>(std::move(output));
+}
+
+/**
+ * @brief Holds the encoded table that a benchmark reads, in a host buffer or
+ * in a temporary file
+ */
+class benchmark_source {
+ public:
+  benchmark_source(io_source type, std::vector<char>&& encoded)
+    : _type{type}, _buffer{std::move(encoded)} {
+    if (_type == io_source::FILEPATH) {
+      char path[]   = "/tmp/cudf_io_benchmark_XXXXXX";
+      auto const fd = mkstemp(path);
+      CUDF_EXPECTS(fd != -1, "Cannot create a temporary file");
+      close(fd);
+      _filepath = path;
+      std::ofstream file(_filepath, std::ios::binary);
+      file.write(_buffer.data(), _buffer.size());
+    }
+  }
+
+  ~benchmark_source() {
+    if (not _filepath.empty()) { std::remove(_filepath.c_str()); }
+  }
+
+  cudf_io::source_info info() const {
+    return _type == io_source::FILEPATH ? cudf_io::source_info(_filepath)
+                                        : cudf_io::source_info(_buffer.data(), _buffer.size());
+  }
+
+  size_t size() const { return _buffer.size(); }
+
+ private:
+  io_source _type;
+  std::vector<char> _buffer;
+  std::string _filepath;
+};
+
+/**
+ * @brief Encodes generated columns as JSON lines, strings and timestamps quoted
+ */
+inline std::vector<char> encode_json_lines(std::vector<host_column> const& columns) {
+  std::string text;
+  for (size_t row = 0; row < columns.front().validity.size(); ++row) {
+    text += '{';
+    bool first = true;
+    for (size_t col = 0; col < columns.size(); ++col) {
+      if (not columns[col].validity[row]) { continue; }
+      if (not first) { text += ','; }
+      text += "\"c" + std::to_string(col) + "\":" + columns[col].text(row, true);
+      first = false;
+    }
+    text += "}\n";
+  }
+  return std::vector<char>(text.begin(), text.end());
+}
+
+/**
+ * @brief Encodes generated columns as CSV, nulls as empty fields
+ */
+inline std::vector<char> encode_csv(std::vector<host_column> const& columns) {
+  std::string text;
+  for (size_t row = 0; row < columns.front().validity.size(); ++row) {
+    for (size_t col = 0; col < columns.size(); ++col) {
+      if (col != 0) { text += ','; }
+      if (columns[col].validity[row]) { text += columns[col].text(row, false); }
+    }
+    text += '\n';
+  }
+  return std::vector<char>(text.begin(), text.end());
+}
+
+inline std::vector<std::string> column_dtypes(std::vector<host_column> const& columns) {
+  std::vector<std::string> dtypes;
+  for (size_t col = 0; col < columns.size(); ++col) {
+    dtypes.push_back("c" + std::to_string(col) + ":" + dtype_name(columns[col].type));
+  }
+  return dtypes;
+}
+
+/**
+ * @brief Adds the arguments of a reader benchmark: every combination of data
+ * group, cardinality, null percentage, compression and source
+ */
+inline void add_reader_args(::benchmark::internal::Benchmark* bench,
+                            std::vector<cudf_io::compression_type> const& compressions) {
+  for (auto group : {data_group::INTEGRAL, data_group::FLOAT, data_group::TIMESTAMP,
+                     data_group::STRING}) {
+    for (int64_t cardinality : {0, 1000}) {
+      for (int64_t null_percent : {0, 50}) {
+        for (auto compression : compressions) {
+          for (auto source : {io_source::HOST_BUFFER, io_source::FILEPATH}) {
+            bench->Args({static_cast<int64_t>(group),
+                         cardinality,
+                         null_percent,
+                         static_cast<int64_t>(compression),
+                         static_cast<int64_t>(source)});
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 256 << 20;
+
+class JsonRead : public cudf::benchmark {};
+
+void JSON_read(benchmark::State& state) {
+  auto const columns = generate_columns(static_cast<data_group>(state.range(0)),
+                                        data_size,
+                                        state.range(1),
+                                        static_cast<int>(state.range(2)));
+  benchmark_source const source(static_cast<io_source>(state.range(4)), encode_json_lines(columns));
+
+  cudf_io::read_json_args read_args{source.info()};
+  read_args.compression = cudf_io::compression_type::NONE;
+  read_args.lines       = true;
+  read_args.dtype       = column_dtypes(columns);
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_json(read_args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * data_size);
+  state.counters["encoded_bytes"] = source.size();
+}
+
+void JSON_read_args(::benchmark::internal::Benchmark* bench) {
+  add_reader_args(bench, {cudf_io::compression_type::NONE});
+}
+
+BENCHMARK_DEFINE_F(JsonRead, read)(::benchmark::State& state) { JSON_read(state); }
+BENCHMARK_REGISTER_F(JsonRead, read)
+  ->Apply(JSON_read_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime()
+  ->Iterations(4);
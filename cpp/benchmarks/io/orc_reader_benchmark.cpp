@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 256 << 20;
+
+class OrcRead : public cudf::benchmark {};
+
+void ORC_read(benchmark::State& state) {
+  auto const columns = generate_columns(static_cast<data_group>(state.range(0)),
+                                        data_size,
+                                        state.range(1),
+                                        static_cast<int>(state.range(2)));
+
+  auto const compression = static_cast<cudf_io::compression_type>(state.range(3));
+  auto const table       = create_table(columns);
+
+  std::vector<char> encoded;
+  cudf_io::write_orc_args write_args{
+    cudf_io::sink_info(&encoded), table->view(), nullptr, compression};
+  cudf_io::write_orc(write_args);
+  benchmark_source const source(static_cast<io_source>(state.range(4)), std::move(encoded));
+
+  cudf_io::read_orc_args read_args{source.info()};
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_orc(read_args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * data_size);
+  state.counters["encoded_bytes"] = source.size();
+}
+
+void ORC_read_args(::benchmark::internal::Benchmark* bench) {
+  add_reader_args(bench, {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY});
+}
+
+BENCHMARK_DEFINE_F(OrcRead, read)(::benchmark::State& state) { ORC_read(state); }
+BENCHMARK_REGISTER_F(OrcRead, read)
+  ->Apply(ORC_read_args)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime()
+  ->Iterations(4);
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/partitioning.hpp>
+
+class HashPartition : public cudf::benchmark {};
+
+/**
+ * @brief Partitions `state.range(1)` INT64 columns into `state.range(2)`
+ * partitions, hashing the first column
+ */
+void BM_hash_partition(benchmark::State& state) {
+  auto const num_rows       = static_cast<cudf::size_type>(state.range(0));
+  auto const num_cols       = static_cast<int>(state.range(1));
+  auto const num_partitions = static_cast<int>(state.range(2));
+  auto const input =
+    create_random_table(std::vector<cudf::type_id>(num_cols, cudf::INT64), num_rows);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::experimental::hash_partition(input->view(), {0}, num_partitions);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * num_cols *
+                          sizeof(int64_t));
+}
+
+BENCHMARK_DEFINE_F(HashPartition, hash_partition)(::benchmark::State& state) {
+  BM_hash_partition(state);
+}
+BENCHMARK_REGISTER_F(HashPartition, hash_partition)
+  ->RangeMultiplier(8)
+  ->Ranges({{1 << 12, 1 << 24}, {1, 16}, {64, 4096}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+// Queries shaped after TPC-H Q1 and Q3 on generated tables, each a chain of
+// scan, filter, projection, join, groupby, sort and write. Unlike the
+// benchmarks of the single operators, the operators run back to back on the
+// results of each other, so the cost of their allocations, of the
+// fragmentation they leave and of their synchronizations shows in the time of
+// the whole query. The time of each operator is reported in a counter.
+
+namespace cudf_io = cudf::experimental::io;
+
+namespace {
+
+// Rows of the tables at scale factor 1, as in TPC-H
+constexpr cudf::size_type lineitem_rows_per_scale = 6000000;
+constexpr cudf::size_type orders_rows_per_scale   = 1500000;
+// Dates are days since the first order
+constexpr int32_t last_date = 2555;
+
+/**
+ * @brief Times the operators of a query with events on the default stream
+ *
+ * Recording the events does not synchronize, so the time of the query is not
+ * changed by timing its operators.
+ */
+class operator_timer {
+ public:
+  operator_timer()                      = default;
+  operator_timer(operator_timer const&) = delete;
+  operator_timer& operator=(operator_timer const&) = delete;
+
+  ~operator_timer() {
+    for (auto event : _events) { cudaEventDestroy(event); }
+  }
+
+  /**
+   * @brief Runs `f`, adding its time to the counter of `name`
+   */
+  template <typename F>
+  auto time(std::string const& name, F&& f) {
+    _names.push_back(name);
+    CUDA_TRY(cudaEventRecord(next_event(), 0));
+    auto result = f();
+    CUDA_TRY(cudaEventRecord(next_event(), 0));
+    return result;
+  }
+
+  /**
+   * @brief Adds the times of the operators run since the last call to their
+   * counters, once the stream has completed them
+   */
+  void accumulate() {
+    for (size_t i = 0; i < _names.size(); ++i) {
+      CUDA_TRY(cudaEventSynchronize(_events[2 * i + 1]));
+      float milliseconds = 0;
+      CUDA_TRY(cudaEventElapsedTime(&milliseconds, _events[2 * i], _events[2 * i + 1]));
+      _milliseconds[_names[i]] += milliseconds;
+    }
+    _names.clear();
+    _used = 0;
+  }
+
+  /**
+   * @brief Sets a counter of the average time per iteration of each operator
+   */
+  void report(benchmark::State& state) const {
+    for (auto const& op : _milliseconds) {
+      state.counters[op.first + "_ms"] =
+        benchmark::Counter(op.second, benchmark::Counter::kAvgIterations);
+    }
+  }
+
+ private:
+  cudaEvent_t next_event() {
+    if (_used == _events.size()) {
+      cudaEvent_t event;
+      CUDA_TRY(cudaEventCreate(&event));
+      _events.push_back(event);
+    }
+    return _events[_used++];
+  }
+
+  std::vector<cudaEvent_t> _events;
+  size_t _used{0};
+  std::vector<std::string> _names;
+  std::map<std::string, double> _milliseconds;
+};
+
+std::unique_ptr<cudf::column> random_column(cudf::type_id type,
+                                            cudf::size_type num_rows,
+                                            data_profile const& profile,
+                                            uint64_t seed) {
+  return std::move(create_random_table({type}, num_rows, profile, seed)->release().front());
+}
+
+data_profile integer_profile(int64_t lower, int64_t upper) {
+  data_profile profile;
+  profile.integer_lower = lower;
+  profile.integer_upper = upper;
+  return profile;
+}
+
+data_profile float_profile(double lower, double upper) {
+  data_profile profile;
+  profile.float_lower = lower;
+  profile.float_upper = upper;
+  return profile;
+}
+
+std::vector<char> encode_parquet(cudf::experimental::table const& table,
+                                 std::vector<std::string> const& names) {
+  cudf_io::table_metadata metadata;
+  metadata.column_names = names;
+  std::vector<char> encoded;
+  cudf_io::write_parquet_args args{
+    cudf_io::sink_info(&encoded), table.view(), &metadata, cudf_io::compression_type::SNAPPY};
+  cudf_io::write_parquet(args);
+  return encoded;
+}
+
+/**
+ * @brief The generated tables of the queries, encoded as Parquet in host memory
+ */
+struct query_tables {
+  std::vector<char> lineitem;
+  std::vector<char> orders;
+};
+
+query_tables generate_tables(int64_t scale_factor) {
+  auto const lineitem_rows = static_cast<cudf::size_type>(scale_factor * lineitem_rows_per_scale);
+  auto const orders_rows   = static_cast<cudf::size_type>(scale_factor * orders_rows_per_scale);
+
+  std::vector<std::unique_ptr<cudf::column>> lineitem;
+  lineitem.push_back(
+    random_column(cudf::INT32, lineitem_rows, integer_profile(0, orders_rows - 1), 1));
+  lineitem.push_back(random_column(cudf::INT32, lineitem_rows, integer_profile(0, 2), 2));
+  lineitem.push_back(random_column(cudf::FLOAT64, lineitem_rows, float_profile(1, 50), 3));
+  lineitem.push_back(random_column(cudf::FLOAT64, lineitem_rows, float_profile(900, 105000), 4));
+  lineitem.push_back(random_column(cudf::FLOAT64, lineitem_rows, float_profile(0, 0.1), 5));
+  lineitem.push_back(random_column(cudf::INT32, lineitem_rows, integer_profile(0, last_date), 6));
+
+  std::vector<std::unique_ptr<cudf::column>> orders;
+  orders.push_back(cudf::experimental::sequence(orders_rows, cudf::numeric_scalar<int32_t>(0)));
+  orders.push_back(random_column(cudf::INT32, orders_rows, integer_profile(0, last_date), 7));
+  orders.push_back(random_column(cudf::INT32, orders_rows, integer_profile(0, 4), 8));
+
+  return {encode_parquet(cudf::experimental::table(std::move(lineitem)),
+                         {"l_orderkey",
+                          "l_returnflag",
+                          "l_quantity",
+                          "l_extendedprice",
+                          "l_discount",
+                          "l_shipdate"}),
+          encode_parquet(cudf::experimental::table(std::move(orders)),
+                         {"o_orderkey", "o_orderdate", "o_shippriority"})};
+}
+
+std::unique_ptr<cudf::experimental::table> scan_parquet(std::vector<char> const& encoded,
+                                                        std::vector<std::string> const& columns) {
+  cudf_io::read_parquet_args args{cudf_io::source_info(encoded.data(), encoded.size())};
+  args.columns = columns;
+  return cudf_io::read_parquet(args).tbl;
+}
+
+/**
+ * @brief Appends `price * (1 - discount)` to the columns of `table`
+ */
+std::unique_ptr<cudf::experimental::table> append_revenue(
+  std::unique_ptr<cudf::experimental::table>&& table,
+  cudf::size_type price,
+  cudf::size_type discount) {
+  using cudf::experimental::expression;
+  cudf::numeric_scalar<double> const one(1);
+  auto const f64     = cudf::data_type(cudf::FLOAT64);
+  auto const revenue = expression::operation(
+    cudf::experimental::binary_operator::MUL,
+    expression::column_reference(price),
+    expression::operation(cudf::experimental::binary_operator::SUB,
+                          expression::literal(one),
+                          expression::column_reference(discount),
+                          f64),
+    f64);
+  auto column  = cudf::experimental::compute_column(table->view(), revenue);
+  auto columns = table->release();
+  columns.push_back(std::move(column));
+  return std::make_unique<cudf::experimental::table>(std::move(columns));
+}
+
+/**
+ * @brief Returns the group keys followed by the results of single-aggregation
+ * requests
+ */
+std::unique_ptr<cudf::experimental::table> aggregate(
+  cudf::table_view const& keys,
+  std::vector<std::pair<cudf::column_view, std::unique_ptr<cudf::experimental::aggregation>>>&&
+    aggregations) {
+  std::vector<cudf::experimental::groupby::aggregation_request> requests;
+  for (auto& aggregation : aggregations) {
+    requests.emplace_back();
+    requests.back().values = aggregation.first;
+    requests.back().aggregations.push_back(std::move(aggregation.second));
+  }
+  cudf::experimental::groupby::groupby groupby(keys);
+  auto result  = groupby.aggregate(requests);
+  auto columns = result.first->release();
+  for (auto& request_result : result.second) {
+    columns.push_back(std::move(request_result.results.front()));
+  }
+  return std::make_unique<cudf::experimental::table>(std::move(columns));
+}
+
+std::vector<char> write_parquet_buffer(cudf::table_view const& table) {
+  std::vector<char> encoded;
+  cudf_io::write_parquet_args args{cudf_io::sink_info(&encoded), table};
+  cudf_io::write_parquet(args);
+  return encoded;
+}
+
+/**
+ * @brief Pricing summary: the sums of the shipped items and their count, by
+ * return flag, as in TPC-H Q1
+ */
+void pricing_summary_query(query_tables const& tables, operator_timer& timer) {
+  using namespace cudf::experimental;
+
+  auto lineitem = timer.time("scan", [&] {
+    return scan_parquet(
+      tables.lineitem,
+      {"l_returnflag", "l_quantity", "l_extendedprice", "l_discount", "l_shipdate"});
+  });
+
+  cudf::numeric_scalar<int32_t> const last_shipdate(last_date - 90);
+  auto const shipped = expression::operation(binary_operator::LESS_EQUAL,
+                                             expression::column_reference(4),
+                                             expression::literal(last_shipdate),
+                                             cudf::data_type(cudf::BOOL8));
+  auto filtered = timer.time(
+    "filter", [&] { return filter_and_select(lineitem->view(), shipped, {0, 1, 2, 3}); });
+  lineitem.reset();
+
+  filtered = timer.time("project", [&] { return append_revenue(std::move(filtered), 2, 3); });
+
+  auto const items = filtered->view();
+  auto summary     = timer.time("groupby", [&] {
+    std::vector<std::pair<cudf::column_view, std::unique_ptr<aggregation>>> aggregations;
+    aggregations.emplace_back(items.column(1), make_sum_aggregation());
+    aggregations.emplace_back(items.column(2), make_sum_aggregation());
+    aggregations.emplace_back(items.column(4), make_sum_aggregation());
+    aggregations.emplace_back(items.column(1), make_count_aggregation());
+    return aggregate(items.select({0}), std::move(aggregations));
+  });
+  filtered.reset();
+
+  auto sorted =
+    timer.time("sort", [&] { return sort_by_key(summary->view(), summary->view().select({0})); });
+  timer.time("write", [&] { return write_parquet_buffer(sorted->view()); });
+}
+
+/**
+ * @brief Shipping priority: the revenue of the orders placed before a date
+ * and shipped after it, largest first, as in TPC-H Q3
+ */
+void shipping_priority_query(query_tables const& tables, operator_timer& timer) {
+  using namespace cudf::experimental;
+
+  cudf::numeric_scalar<int32_t> const date(last_date / 2);
+
+  auto lineitem = timer.time("scan", [&] {
+    return scan_parquet(tables.lineitem,
+                        {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"});
+  });
+  auto const shipped_after = expression::operation(binary_operator::GREATER,
+                                                   expression::column_reference(3),
+                                                   expression::literal(date),
+                                                   cudf::data_type(cudf::BOOL8));
+  auto items = timer.time(
+    "filter", [&] { return filter_and_select(lineitem->view(), shipped_after, {0, 1, 2}); });
+  lineitem.reset();
+  items = timer.time("project", [&] { return append_revenue(std::move(items), 1, 2); });
+
+  auto orders = timer.time("scan", [&] {
+    return scan_parquet(tables.orders, {"o_orderkey", "o_orderdate", "o_shippriority"});
+  });
+  auto const placed_before = expression::operation(binary_operator::LESS,
+                                                   expression::column_reference(1),
+                                                   expression::literal(date),
+                                                   cudf::data_type(cudf::BOOL8));
+  auto placed = timer.time(
+    "filter", [&] { return filter_and_select(orders->view(), placed_before, {0, 1, 2}); });
+  orders.reset();
+
+  // orderkey, price, discount, revenue, orderdate, shippriority
+  auto joined = timer.time(
+    "join", [&] { return inner_join(items->view(), placed->view(), {0}, {0}, {{0, 0}}); });
+  items.reset();
+  placed.reset();
+
+  auto const rows = joined->view();
+  auto revenue    = timer.time("groupby", [&] {
+    std::vector<std::pair<cudf::column_view, std::unique_ptr<aggregation>>> aggregations;
+    aggregations.emplace_back(rows.column(3), make_sum_aggregation());
+    return aggregate(rows.select({0, 4, 5}), std::move(aggregations));
+  });
+  joined.reset();
+
+  auto sorted = timer.time("sort", [&] {
+    return sort_by_key(revenue->view(),
+                       revenue->view().select({3, 1}),
+                       {order::DESCENDING, order::ASCENDING});
+  });
+  timer.time("write", [&] { return write_parquet_buffer(sorted->view()); });
+}
+
+}  // namespace
+
+class Query : public cudf::benchmark {};
+
+template <typename QueryFn>
+void BM_query(benchmark::State& state, QueryFn query) {
+  auto const tables = generate_tables(state.range(0));
+
+  operator_timer timer;
+  for (auto _ : state) {
+    {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+      query(tables, timer);
+    }
+    timer.accumulate();
+  }
+
+  timer.report(state);
+  state.counters["lineitem_bytes"] = tables.lineitem.size();
+}
+
+BENCHMARK_DEFINE_F(Query, pricing_summary)
+(::benchmark::State& state) { BM_query(state, pricing_summary_query); }
+
+BENCHMARK_DEFINE_F(Query, shipping_priority)
+(::benchmark::State& state) { BM_query(state, shipping_priority_query); }
+
+// The argument is the scale factor
+BENCHMARK_REGISTER_F(Query, pricing_summary)
+  ->Arg(1)
+  ->Arg(2)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime()
+  ->Iterations(4);
+
+BENCHMARK_REGISTER_F(Query, shipping_priority)
+  ->Arg(1)
+  ->Arg(2)
+  ->Arg(4)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime()
+  ->Iterations(4);
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+class Reduction : public cudf::benchmark {};
+
+enum class reduction_type { SUM, MIN, MEAN, INCLUSIVE_SCAN, EXCLUSIVE_SCAN };
+
+template <typename T, reduction_type type>
+void BM_reduction(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.1;
+  auto const input =
+    create_random_table({cudf::experimental::type_to_id<T>()}, num_rows, profile);
+  auto const column = input->get_column(0).view();
+  using cudf::experimental::scan_type;
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case reduction_type::SUM:
+        cudf::experimental::reduce(
+          column, cudf::experimental::make_sum_aggregation(), column.type());
+        break;
+      case reduction_type::MIN:
+        cudf::experimental::reduce(
+          column, cudf::experimental::make_min_aggregation(), column.type());
+        break;
+      case reduction_type::MEAN:
+        cudf::experimental::reduce(
+          column, cudf::experimental::make_mean_aggregation(), cudf::data_type{cudf::FLOAT64});
+        break;
+      case reduction_type::INCLUSIVE_SCAN:
+        cudf::experimental::scan(
+          column, cudf::experimental::make_sum_aggregation(), scan_type::INCLUSIVE);
+        break;
+      case reduction_type::EXCLUSIVE_SCAN:
+        cudf::experimental::scan(
+          column, cudf::experimental::make_sum_aggregation(), scan_type::EXCLUSIVE);
+        break;
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * sizeof(T));
+}
+
+#define REDUCTION_BENCHMARK_DEFINE(name, type, reduction)           \
+  BENCHMARK_DEFINE_F(Reduction, name)(::benchmark::State & state) { \
+    BM_reduction<type, reduction>(state);                           \
+  }                                                                 \
+  BENCHMARK_REGISTER_F(Reduction, name)                             \
+    ->RangeMultiplier(32)                                           \
+    ->Range(1 << 10, 1 << 25)                                       \
+    ->UseManualTime()                                               \
+    ->Unit(benchmark::kMillisecond);
+
+REDUCTION_BENCHMARK_DEFINE(sum_int32, int32_t, reduction_type::SUM)
+REDUCTION_BENCHMARK_DEFINE(sum_float64, double, reduction_type::SUM)
+REDUCTION_BENCHMARK_DEFINE(min_int64, int64_t, reduction_type::MIN)
+REDUCTION_BENCHMARK_DEFINE(mean_float32, float, reduction_type::MEAN)
+REDUCTION_BENCHMARK_DEFINE(inclusive_scan_int64, int64_t, reduction_type::INCLUSIVE_SCAN)
+REDUCTION_BENCHMARK_DEFINE(exclusive_scan_float64, double, reduction_type::EXCLUSIVE_SCAN)
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/rolling.hpp>
+
+class Rolling : public cudf::benchmark {};
+
+enum class rolling_type { FIXED, GROUPED };
+
+/**
+ * @brief Sums INT64 values over windows of `state.range(1)` preceding rows,
+ * in 1000 groups of sorted keys for `GROUPED`
+ */
+template <rolling_type type>
+void BM_rolling_sum(benchmark::State& state) {
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(0));
+  auto const window_size = static_cast<cudf::size_type>(state.range(1));
+  data_profile profile;
+  profile.null_frequency = 0.1;
+  auto const values      = create_random_table({cudf::INT64}, num_rows, profile);
+  profile.null_frequency = 0.0;
+  profile.cardinality    = 1000;
+  profile.sorted         = true;
+  auto const keys        = create_random_table({cudf::INT32}, num_rows, profile);
+  auto const sum         = cudf::experimental::make_sum_aggregation();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case rolling_type::FIXED:
+        cudf::experimental::rolling_window(values->get_column(0), window_size, 0, 1, sum);
+        break;
+      case rolling_type::GROUPED:
+        cudf::experimental::grouped_rolling_window(
+          keys->view(), values->get_column(0), window_size, 0, 1, sum);
+        break;
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * sizeof(int64_t));
+}
+
+#define ROLLING_BENCHMARK_DEFINE(name, type)                                                     \
+  BENCHMARK_DEFINE_F(Rolling, name)(::benchmark::State & state) { BM_rolling_sum<type>(state); } \
+  BENCHMARK_REGISTER_F(Rolling, name)                                                            \
+    ->RangeMultiplier(16)                                                                        \
+    ->Ranges({{1 << 12, 1 << 24}, {2, 512}})                                                     \
+    ->UseManualTime()                                                                            \
+    ->Unit(benchmark::kMillisecond);
+
+ROLLING_BENCHMARK_DEFINE(rolling_window_sum, rolling_type::FIXED)
+ROLLING_BENCHMARK_DEFINE(grouped_rolling_window_sum, rolling_type::GROUPED)
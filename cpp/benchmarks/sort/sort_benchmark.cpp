@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/sorting.hpp>
+
+class Sort : public cudf::benchmark {};
+
+enum class sort_type { SORT, SORTED_ORDER, STABLE_SORTED_ORDER };
+
+/**
+ * @brief Sorts a table of `state.range(1)` INT64 columns, nullable if
+ * `state.range(2)` is not 0
+ */
+template <sort_type type>
+void BM_sort(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const num_cols = static_cast<int>(state.range(1));
+  data_profile profile;
+  profile.null_frequency = state.range(2) ? 0.1 : 0.0;
+  auto const input =
+    create_random_table(std::vector<cudf::type_id>(num_cols, cudf::INT64), num_rows, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case sort_type::SORT: cudf::experimental::sort(input->view()); break;
+      case sort_type::SORTED_ORDER: cudf::experimental::sorted_order(input->view()); break;
+      case sort_type::STABLE_SORTED_ORDER:
+        cudf::experimental::stable_sorted_order(input->view());
+        break;
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * num_cols *
+                          sizeof(int64_t));
+}
+
+#define SORT_BENCHMARK_DEFINE(name, type)                                              \
+  BENCHMARK_DEFINE_F(Sort, name)(::benchmark::State & state) { BM_sort<type>(state); } \
+  BENCHMARK_REGISTER_F(Sort, name)                                                     \
+    ->RangeMultiplier(8)                                                               \
+    ->Ranges({{1 << 10, 1 << 24}, {1, 8}, {0, 1}})                                     \
+    ->UseManualTime()                                                                  \
+    ->Unit(benchmark::kMillisecond);
+
+SORT_BENCHMARK_DEFINE(sort, sort_type::SORT)
+SORT_BENCHMARK_DEFINE(sorted_order, sort_type::SORTED_ORDER)
+SORT_BENCHMARK_DEFINE(stable_sorted_order, sort_type::STABLE_SORTED_ORDER)
+
+template <cudf::rank_method method>
+void BM_rank(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.1;
+  // Many ties, so that the ranks of the methods differ
+  profile.cardinality = num_rows / 16 + 1;
+  auto const input    = create_random_table({cudf::INT64}, num_rows, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::experimental::rank(input->get_column(0).view(),
+                             method,
+                             cudf::order::ASCENDING,
+                             cudf::include_nulls::YES,
+                             cudf::null_order::AFTER,
+                             false);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * sizeof(int64_t));
+}
+
+#define RANK_BENCHMARK_DEFINE(name, method)                                              \
+  BENCHMARK_DEFINE_F(Sort, name)(::benchmark::State & state) { BM_rank<method>(state); } \
+  BENCHMARK_REGISTER_F(Sort, name)                                                       \
+    ->RangeMultiplier(8)                                                                 \
+    ->Range(1 << 10, 1 << 24)                                                            \
+    ->UseManualTime()                                                                    \
+    ->Unit(benchmark::kMillisecond);
+
+RANK_BENCHMARK_DEFINE(rank_first, cudf::rank_method::FIRST)
+RANK_BENCHMARK_DEFINE(rank_average, cudf::rank_method::AVERAGE)
+RANK_BENCHMARK_DEFINE(rank_dense, cudf::rank_method::DENSE)
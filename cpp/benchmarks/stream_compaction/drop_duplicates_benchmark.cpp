@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/stream_compaction.hpp>
+
+class DropDuplicates : public cudf::benchmark {};
+
+/**
+ * @brief Drops the duplicates of a key column of `state.range(1)` distinct
+ * values from a table of the key and an INT64 value column
+ */
+template <cudf::experimental::duplicate_keep_option keep>
+void BM_drop_duplicates(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.01;
+  profile.cardinality    = state.range(1);
+  auto const input       = create_random_table({cudf::INT64, cudf::INT64}, num_rows, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::experimental::drop_duplicates(input->view(), {0}, keep);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * 2 *
+                          sizeof(int64_t));
+}
+
+#define DROP_DUPLICATES_BENCHMARK_DEFINE(name, keep)                     \
+  BENCHMARK_DEFINE_F(DropDuplicates, name)(::benchmark::State & state) { \
+    BM_drop_duplicates<keep>(state);                                     \
+  }                                                                      \
+  BENCHMARK_REGISTER_F(DropDuplicates, name)                             \
+    ->RangeMultiplier(32)                                                \
+    ->Ranges({{1 << 10, 1 << 25}, {1 << 5, 1 << 20}})                    \
+    ->UseManualTime()                                                    \
+    ->Unit(benchmark::kMillisecond);
+
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_first, cudf::experimental::duplicate_keep_option::KEEP_FIRST)
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_none, cudf::experimental::duplicate_keep_option::KEEP_NONE)
+DROP_DUPLICATES_BENCHMARK_DEFINE(keep_any, cudf::experimental::duplicate_keep_option::KEEP_ANY)
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/case.hpp>
+
+class StringCase : public cudf::benchmark {};
+
+enum class case_type { LOWER, UPPER, SWAPCASE };
+
+template <case_type type>
+void BM_case(benchmark::State& state) {
+  auto const input = create_text_column(state.range(0), state.range(1));
+  cudf::strings_column_view const strings(input->view());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case case_type::LOWER: cudf::strings::to_lower(strings); break;
+      case case_type::UPPER: cudf::strings::to_upper(strings); break;
+      case case_type::SWAPCASE: cudf::strings::swapcase(strings); break;
+    }
+  }
+
+  set_text_bytes_processed(state, input->view());
+}
+
+#define CASE_BENCHMARK_DEFINE(name, type)                                                    \
+  BENCHMARK_DEFINE_F(StringCase, name)(::benchmark::State & state) { BM_case<type>(state); } \
+  BENCHMARK_REGISTER_F(StringCase, name)                                                     \
+    ->Apply(add_text_args)                                                                   \
+    ->UseManualTime()                                                                        \
+    ->Unit(benchmark::kMillisecond);
+
+CASE_BENCHMARK_DEFINE(to_lower, case_type::LOWER)
+CASE_BENCHMARK_DEFINE(to_upper, case_type::UPPER)
+CASE_BENCHMARK_DEFINE(swapcase, case_type::SWAPCASE)
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/combine.hpp>
+
+class StringCombine : public cudf::benchmark {};
+
+static void BM_concatenate(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  // Two columns of half the length of the output rows
+  auto const lhs = create_text_column(num_rows, state.range(1) / 2);
+  auto const rhs = create_text_column(num_rows, state.range(1) / 2);
+  cudf::table_view const input{{lhs->view(), rhs->view()}};
+  cudf::string_scalar const separator(":");
+  cudf::string_scalar const narep("null");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf::strings::concatenate(input, separator, narep);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          (cudf::strings_column_view(lhs->view()).chars_size() +
+                           cudf::strings_column_view(rhs->view()).chars_size()));
+}
+
+BENCHMARK_DEFINE_F(StringCombine, concatenate)(::benchmark::State& state) { BM_concatenate(state); }
+BENCHMARK_REGISTER_F(StringCombine, concatenate)
+  ->Apply(add_text_args)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
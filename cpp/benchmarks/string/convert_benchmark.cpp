@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+
+#include <limits>
+
+class StringConvert : public cudf::benchmark {};
+
+enum class convert_type { TO_INTEGERS, FROM_INTEGERS, TO_FLOATS, FROM_FLOATS };
+
+template <convert_type type>
+void BM_convert(benchmark::State& state) {
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  data_profile profile;
+  profile.null_frequency = 0.01;
+  profile.integer_lower  = std::numeric_limits<int64_t>::lowest();
+  profile.integer_upper  = std::numeric_limits<int64_t>::max();
+  profile.float_lower    = -1e10;
+  profile.float_upper    = 1e10;
+  auto const numbers  = create_random_table({cudf::INT64, cudf::FLOAT64}, num_rows, profile);
+  auto const integers = numbers->get_column(0).view();
+  auto const floats   = numbers->get_column(1).view();
+
+  auto const integer_strings = cudf::strings::from_integers(integers);
+  auto const float_strings   = cudf::strings::from_floats(floats);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case convert_type::TO_INTEGERS:
+        cudf::strings::to_integers(integer_strings->view(), integers.type());
+        break;
+      case convert_type::FROM_INTEGERS: cudf::strings::from_integers(integers); break;
+      case convert_type::TO_FLOATS:
+        cudf::strings::to_floats(float_strings->view(), floats.type());
+        break;
+      case convert_type::FROM_FLOATS: cudf::strings::from_floats(floats); break;
+    }
+  }
+
+  auto const& strings = (type == convert_type::TO_INTEGERS or type == convert_type::FROM_INTEGERS)
+                          ? integer_strings
+                          : float_strings;
+  set_text_bytes_processed(state, strings->view());
+}
+
+#define CONVERT_BENCHMARK_DEFINE(name, type)                            \
+  BENCHMARK_DEFINE_F(StringConvert, name)(::benchmark::State & state) { \
+    BM_convert<type>(state);                                            \
+  }                                                                     \
+  BENCHMARK_REGISTER_F(StringConvert, name)                             \
+    ->RangeMultiplier(16)                                               \
+    ->Range(1 << 12, 1 << 24)                                           \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+CONVERT_BENCHMARK_DEFINE(to_integers, convert_type::TO_INTEGERS)
+CONVERT_BENCHMARK_DEFINE(from_integers, convert_type::FROM_INTEGERS)
+CONVERT_BENCHMARK_DEFINE(to_floats, convert_type::TO_FLOATS)
+CONVERT_BENCHMARK_DEFINE(from_floats, convert_type::FROM_FLOATS)
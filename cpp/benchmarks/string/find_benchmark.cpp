@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/find.hpp>
+
+class StringFind : public cudf::benchmark {};
+
+enum class find_type { FIND, RFIND, CONTAINS, STARTS_WITH };
+
+template <find_type type>
+void BM_find(benchmark::State& state) {
+  auto const input = create_text_column(state.range(0), state.range(1));
+  cudf::strings_column_view const strings(input->view());
+  cudf::string_scalar const target("ab");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case find_type::FIND: cudf::strings::find(strings, target); break;
+      case find_type::RFIND: cudf::strings::rfind(strings, target); break;
+      case find_type::CONTAINS: cudf::strings::contains(strings, target); break;
+      case find_type::STARTS_WITH: cudf::strings::starts_with(strings, target); break;
+    }
+  }
+
+  set_text_bytes_processed(state, input->view());
+}
+
+#define FIND_BENCHMARK_DEFINE(name, type)                                                    \
+  BENCHMARK_DEFINE_F(StringFind, name)(::benchmark::State & state) { BM_find<type>(state); } \
+  BENCHMARK_REGISTER_F(StringFind, name)                                                     \
+    ->Apply(add_text_args)                                                                   \
+    ->UseManualTime()                                                                        \
+    ->Unit(benchmark::kMillisecond);
+
+FIND_BENCHMARK_DEFINE(find, find_type::FIND)
+FIND_BENCHMARK_DEFINE(rfind, find_type::RFIND)
+FIND_BENCHMARK_DEFINE(contains, find_type::CONTAINS)
+FIND_BENCHMARK_DEFINE(starts_with, find_type::STARTS_WITH)
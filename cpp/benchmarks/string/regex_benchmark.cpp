@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/extract.hpp>
+#include <cudf/strings/replace_re.hpp>
+
+class StringRegex : public cudf::benchmark {};
+
+enum class regex_type { CONTAINS, REPLACE, EXTRACT };
+
+template <regex_type type>
+void BM_regex(benchmark::State& state) {
+  auto const input = create_text_column(state.range(0), state.range(1));
+  cudf::strings_column_view const strings(input->view());
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case regex_type::CONTAINS: cudf::strings::contains_re(strings, "[a-e]+ \\d+$"); break;
+      case regex_type::REPLACE:
+        cudf::strings::replace_re(strings, "\\d+", cudf::string_scalar("#"));
+        break;
+      case regex_type::EXTRACT: cudf::strings::extract(strings, "([a-z]+) (\\d+)$"); break;
+    }
+  }
+
+  set_text_bytes_processed(state, input->view());
+}
+
+#define REGEX_BENCHMARK_DEFINE(name, type)                                                     \
+  BENCHMARK_DEFINE_F(StringRegex, name)(::benchmark::State & state) { BM_regex<type>(state); } \
+  BENCHMARK_REGISTER_F(StringRegex, name)                                                      \
+    ->Apply(add_text_args)                                                                     \
+    ->UseManualTime()                                                                          \
+    ->Unit(benchmark::kMillisecond);
+
+REGEX_BENCHMARK_DEFINE(contains_re, regex_type::CONTAINS)
+REGEX_BENCHMARK_DEFINE(replace_re, regex_type::REPLACE)
+REGEX_BENCHMARK_DEFINE(extract, regex_type::EXTRACT)
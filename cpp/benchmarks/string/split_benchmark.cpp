@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/split/split.hpp>
+
+class StringSplit : public cudf::benchmark {};
+
+enum class split_type { SPLIT, RSPLIT, SPLIT_RECORD };
+
+template <split_type type>
+void BM_split(benchmark::State& state) {
+  auto const input = create_text_column(state.range(0), state.range(1));
+  cudf::strings_column_view const strings(input->view());
+  cudf::string_scalar const delimiter(" ");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case split_type::SPLIT: cudf::strings::split(strings, delimiter); break;
+      case split_type::RSPLIT: cudf::strings::rsplit(strings, delimiter, 2); break;
+      case split_type::SPLIT_RECORD:
+        cudf::strings::contiguous_split_record(strings, delimiter);
+        break;
+    }
+  }
+
+  set_text_bytes_processed(state, input->view());
+}
+
+#define SPLIT_BENCHMARK_DEFINE(name, type)                                                     \
+  BENCHMARK_DEFINE_F(StringSplit, name)(::benchmark::State & state) { BM_split<type>(state); } \
+  BENCHMARK_REGISTER_F(StringSplit, name)                                                      \
+    ->Apply(add_text_args)                                                                     \
+    ->UseManualTime()                                                                          \
+    ->Unit(benchmark::kMillisecond);
+
+SPLIT_BENCHMARK_DEFINE(split, split_type::SPLIT)
+SPLIT_BENCHMARK_DEFINE(rsplit, split_type::RSPLIT)
+SPLIT_BENCHMARK_DEFINE(contiguous_split_record, split_type::SPLIT_RECORD)
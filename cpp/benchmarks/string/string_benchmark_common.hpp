@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+constexpr int num_words = 4;  ///< Words of letters before the number of a text row
+
+/**
+ * @brief Creates a column of text rows of up to about `max_length` characters
+ *
+ * Each row is `num_words` words of lowercase letters followed by a number, all
+ * separated by single spaces, so that regex, split, find and tokenize
+ * benchmarks have matches to process. A row is null if any of its parts is,
+ * each with probability 1%.
+ */
+inline std::unique_ptr<cudf::column> create_text_column(cudf::size_type num_rows,
+                                                        cudf::size_type max_length) {
+  data_profile profile;
+  profile.null_frequency = 0.01;
+  profile.min_length     = 1;
+  profile.max_length     = std::max(1, (max_length - 11) / num_words - 1);
+  std::vector<cudf::type_id> types(num_words, cudf::STRING);
+  types.push_back(cudf::INT32);
+  auto parts = create_random_table(types, num_rows, profile)->release();
+  parts.back() = cudf::strings::from_integers(parts.back()->view());
+
+  std::vector<cudf::column_view> views;
+  for (auto const& part : parts) { views.push_back(part->view()); }
+  return cudf::strings::concatenate(cudf::table_view{views}, cudf::string_scalar(" "));
+}
+
+/**
+ * @brief Records the throughput of a benchmark over the characters of `input`
+ */
+inline void set_text_bytes_processed(::benchmark::State& state, cudf::column_view const& input) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          cudf::strings_column_view(input).chars_size());
+}
+
+/**
+ * @brief Adds the arguments of a strings benchmark: the number of rows, and
+ * the maximum length of the rows
+ */
+inline void add_text_args(::benchmark::internal::Benchmark* bench) {
+  for (int64_t num_rows : {1 << 12, 1 << 20}) {
+    for (int64_t max_length : {16, 64, 256}) { bench->Args({num_rows, max_length}); }
+  }
+}
@@ -16,7 +16,12 @@
 
 #include "synchronization.hpp"
 
+#include <benchmarks/fixture/memory_tracking_resource.hpp>
+
 #include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <algorithm>
 
 cuda_event_timer::cuda_event_timer(benchmark::State& state,
                                    bool flush_l2_cache,
@@ -37,6 +42,13 @@ cuda_event_timer::cuda_event_timer(benchmark::State& state,
     }
   }
 
+  tracker     = dynamic_cast<cudf::memory_tracking_resource*>(rmm::mr::get_default_resource());
+  start_bytes = 0;
+  if (tracker != nullptr) {
+    tracker->reset();
+    start_bytes = tracker->current_bytes();
+  }
+
   CUDA_TRY(cudaEventCreate(&start));
   CUDA_TRY(cudaEventCreate(&stop));
   CUDA_TRY(cudaEventRecord(start, stream));
@@ -51,4 +63,14 @@ cuda_event_timer::~cuda_event_timer() {
   p_state->SetIterationTime(milliseconds / (1000.0f));
   CUDA_TRY(cudaEventDestroy(start));
   CUDA_TRY(cudaEventDestroy(stop));
+
+  if (tracker != nullptr) {
+    // The largest peak of the iterations, and the average bytes allocated
+    auto& peak = p_state->counters["peak_memory_usage"];
+    peak       = std::max<double>(peak, tracker->peak_bytes() - start_bytes);
+
+    auto& allocated = p_state->counters["allocated_bytes"];
+    allocated       = benchmark::Counter(allocated.value + tracker->total_bytes(),
+                                         benchmark::Counter::kAvgIterations);
+  }
 }
@@ -41,6 +41,10 @@
         // It also clears the L2 cache by cudaMemset'ing a device buffer that is of
         // the size of the L2 cache (if flush_l2_cache is set to true and there is 
         // an L2 cache on the current device).
+        // If the default resource is a `cudf::memory_tracking_resource`, it
+        // also sets the `peak_memory_usage` counter to the largest peak of
+        // device memory allocated by an iteration, and `allocated_bytes` to
+        // the bytes allocated per iteration.
         cuda_event_timer raii(state, true, stream); // flush_l2_cache = true
         
         // Now perform the operations that is to be benchmarked
@@ -64,6 +68,12 @@
 
 #include <tests/utilities/legacy/cudf_test_utils.cuh>
 
+#include <cstddef>
+
+namespace cudf {
+class memory_tracking_resource;
+}
+
 class cuda_event_timer {
  public:
   /**---------------------------------------------------------------------------*
@@ -92,6 +102,8 @@ class cuda_event_timer {
   cudaEvent_t stop;
   cudaStream_t stream;
   benchmark::State* p_state;
+  cudf::memory_tracking_resource* tracker;
+  size_t start_bytes;
 };
 
 #endif
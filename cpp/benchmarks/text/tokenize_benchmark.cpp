@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/string/string_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <nvtext/generate_ngrams.hpp>
+#include <nvtext/ngrams_tokenize.hpp>
+#include <nvtext/tokenize.hpp>
+
+class TextTokenize : public cudf::benchmark {};
+
+enum class tokenize_type { TOKENIZE, COUNT, NGRAMS, NGRAMS_TOKENIZE };
+
+template <tokenize_type type>
+void BM_tokenize(benchmark::State& state) {
+  auto const input = create_text_column(state.range(0), state.range(1));
+  cudf::strings_column_view const strings(input->view());
+
+  // The tokens of the rows, for generating ngrams from
+  auto const tokens = nvtext::tokenize(strings);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    switch (type) {
+      case tokenize_type::TOKENIZE: nvtext::tokenize(strings); break;
+      case tokenize_type::COUNT: nvtext::count_tokens(strings); break;
+      case tokenize_type::NGRAMS: nvtext::generate_ngrams(tokens->view()); break;
+      case tokenize_type::NGRAMS_TOKENIZE: nvtext::ngrams_tokenize(strings); break;
+    }
+  }
+
+  set_text_bytes_processed(state, input->view());
+}
+
+#define TOKENIZE_BENCHMARK_DEFINE(name, type)                          \
+  BENCHMARK_DEFINE_F(TextTokenize, name)(::benchmark::State & state) { \
+    BM_tokenize<type>(state);                                          \
+  }                                                                    \
+  BENCHMARK_REGISTER_F(TextTokenize, name)                             \
+    ->Apply(add_text_args)                                             \
+    ->UseManualTime()                                                  \
+    ->Unit(benchmark::kMillisecond);
+
+TOKENIZE_BENCHMARK_DEFINE(tokenize, tokenize_type::TOKENIZE)
+TOKENIZE_BENCHMARK_DEFINE(count_tokens, tokenize_type::COUNT)
+TOKENIZE_BENCHMARK_DEFINE(generate_ngrams, tokenize_type::NGRAMS)
+TOKENIZE_BENCHMARK_DEFINE(ngrams_tokenize, tokenize_type::NGRAMS_TOKENIZE)
@@ -65,6 +65,13 @@ class aggregation {
     ARGMIN,          ///< Index of min element
     NUNIQUE,         ///< count number of unique elements
     NTH_ELEMENT,     ///< get the nth element
+    TDIGEST,         ///< build a t-digest of the values
+    MERGE_TDIGEST,   ///< merge t-digests
+    APPROX_QUANTILE, ///< compute approximate quantile(s) with a t-digest
+    ROW_NUMBER,      ///< number of the row in its group
+    LEAD,            ///< value of a following row of the group
+    LAG,             ///< value of a preceding row of the group
+    COLLECT,         ///< list of the values of each group
     PTX,             ///< PTX UDF based reduction
     CUDA             ///< CUDA UDf based reduction
   };
@@ -178,6 +185,76 @@ std::unique_ptr<aggregation> make_nunique_aggregation(
 std::unique_ptr<aggregation> make_nth_element_aggregation(
   size_type n, include_nulls _include_nulls = include_nulls::YES);
 
+/**
+ * @brief Factory to create a COLLECT aggregation
+ *
+ * `collect` returns a LIST column holding, for each group, the list of its
+ * values, nulls included. The values of a list are in the order of their rows
+ * when the groupby is hash-based or the keys are pre-sorted.
+ */
+std::unique_ptr<aggregation> make_collect_aggregation();
+
+/**
+ * @brief Factory to create a TDIGEST aggregation
+ *
+ * `tdigest` builds the t-digest of the values of each group, as
+ * `make_tdigest` does for a column.
+ *
+ * @param max_centroids The maximum number of centroids of each digest
+ */
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids = 1000);
+
+/**
+ * @brief Factory to create a MERGE_TDIGEST aggregation
+ *
+ * `merge_tdigest` merges the t-digests of each group of a column of
+ * t-digests, e.g., the TDIGEST results of several partitions of a dataset.
+ *
+ * @param max_centroids The maximum number of centroids of each merged digest
+ */
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids = 1000);
+
+/**
+ * @brief Factory to create an APPROX_QUANTILE aggregation
+ *
+ * `approx_quantile` computes the quantiles of a t-digest of the values
+ * instead of sorting them, as `approx_quantiles` does. Its results are laid
+ * out as the ones of QUANTILE.
+ *
+ * @param q The desired quantiles
+ * @param max_centroids The maximum number of centroids of the digests
+ */
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              int max_centroids = 1000);
+
+/**
+ * @brief Factory to create a ROW_NUMBER aggregation
+ *
+ * `row_number` is the number of each row in its group, from 1, as computed by
+ * `grouped_rolling_window()`.
+ */
+std::unique_ptr<aggregation> make_row_number_aggregation();
+
+/**
+ * @brief Factory to create a LEAD aggregation
+ *
+ * `lead` is the value of the row `offset` rows after each row in its group, as
+ * computed by `grouped_rolling_window()`, or its default if there is no such row.
+ *
+ * @param offset The number of rows after each row
+ */
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a LAG aggregation
+ *
+ * `lag` is the value of the row `offset` rows before each row in its group, as
+ * computed by `grouped_rolling_window()`, or its default if there is no such row.
+ *
+ * @param offset The number of rows before each row
+ */
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset);
+
 /**
  * @brief Factory to create a aggregation base on UDF for PTX or CUDA
  *
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// The structures of the Arrow C Data Interface, as specified in
+// https://arrow.apache.org/docs/format/CDataInterface.html
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace cudf {
+
+/**
+ * @brief Exports a table through the Arrow C Data Interface without copying
+ * its device memory
+ *
+ * The table is exported as a struct array of its columns, whose buffers are the
+ * device buffers of the columns: the validity, offsets and data buffers of the
+ * arrays point to device memory. The release callbacks of `array` and of each
+ * of its children share the ownership of `input`, which is destroyed when all
+ * of them have been called; `schema` does not reference `input`.
+ *
+ * Supported types are the integer, floating-point and timestamp types, and the
+ * STRING, LIST and STRUCT types of supported types. TIMESTAMP_DAYS is exported
+ * as an Arrow date32.
+ *
+ * @throw cudf::logic_error if a column type is not supported, e.g., BOOL8,
+ * whose bytes cannot be shared with a bit-packed Arrow boolean array
+ *
+ * @param input The table to export
+ * @param schema The schema to fill; its release callback must be called once
+ * it is no longer used
+ * @param array The array to fill; its release callback must be called once
+ * it is no longer used
+ */
+void to_arrow_device(std::unique_ptr<experimental::table> input,
+                     ArrowSchema* schema,
+                     ArrowArray* array);
+
+/**
+ * @brief Imports a struct array of device buffers from the Arrow C Data
+ * Interface as a table without copying them
+ *
+ * Each child of the struct array is a column of the table. The buffers of the
+ * array must be in device memory accessible from the current device, and the
+ * validity buffers padded to a multiple of 4 bytes, as Arrow allocates them.
+ * The array is moved into the returned `shared_ptr`, whose deleter calls its
+ * release callback; the table view is valid as long as the `shared_ptr` is
+ * alive. `schema` is not released.
+ *
+ * @throw cudf::logic_error if `schema` is not a struct, or if the struct has
+ * nulls
+ * @throw cudf::logic_error if a child is of a type with no equivalent cudf
+ * type, e.g., an Arrow boolean
+ * @throw cudf::logic_error if an array is larger than the column size limit
+ *
+ * @param schema The schema of `array`
+ * @param array The array to import; it is marked released on return
+ * @return The table viewing the buffers of `array`, and the owner of `array`
+ */
+std::pair<table_view, std::shared_ptr<ArrowArray>> from_arrow_device(ArrowSchema const* schema,
+                                                                     ArrowArray* array);
+
+}  // namespace cudf
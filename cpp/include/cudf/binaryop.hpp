@@ -18,6 +18,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <memory>
 
@@ -123,6 +124,12 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * Fixed-point operands support `ADD`, `SUB`, `MUL` and `DIV` into a fixed-point
+ * @p output_type, whose scale is the scale of the result (e.g. the smaller scale
+ * of the operands for `ADD` and the sum of their scales for `MUL`), and the
+ * comparison operators into a `BOOL8` @p output_type. The same operations are
+ * supported between a fixed-point column and a `fixed_point_scalar`.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -131,6 +138,7 @@ std::unique_ptr<column> binary_operation(
  * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
  * @throw cudf::logic_error if @p lhs and @p rhs dtypes aren't fixed-width
  * @throw cudf::logic_error if @p output_type dtype isn't numeric
+ * @throw cudf::logic_error if the operation isn't supported for fixed-point operands
  */
 std::unique_ptr<column> binary_operation(
   column_view const& lhs,
@@ -168,5 +176,95 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief A node of a tree of binary operations evaluated by `compute_column()`
+ *
+ * The leaves of the tree are references to the columns of a table, and
+ * literals. Each operation node applies a `binary_operator` to the values of
+ * its two children, as `binary_operation()` does, and has an explicit output
+ * type.
+ *
+ * An expression refers to its literals, which must outlive its evaluation.
+ */
+class expression {
+ public:
+  /**
+   * @brief The kinds of the nodes of an expression
+   */
+  enum class kind : int32_t {
+    COLUMN_REFERENCE,  ///< The values of a column of the evaluated table
+    LITERAL,           ///< The value of a fixed-width scalar
+    OPERATION          ///< A binary operation on the values of two expressions
+  };
+
+  /**
+   * @brief Returns an expression of the values of column `column_index` of
+   * the evaluated table
+   */
+  static expression column_reference(size_type column_index);
+
+  /**
+   * @brief Returns an expression of the value of `value` in every row
+   *
+   * @throw cudf::logic_error if the type of `value` isn't fixed-width
+   */
+  static expression literal(scalar const& value);
+
+  /**
+   * @brief Returns an expression of the result of `op` on the values of `lhs`
+   * and `rhs`, converted to `output_type`
+   *
+   * @throw cudf::logic_error if @p output_type isn't fixed-width
+   * @throw cudf::logic_error if @p op is `COALESCE` or `GENERIC_BINARY`
+   */
+  static expression operation(binary_operator op,
+                              expression const& lhs,
+                              expression const& rhs,
+                              data_type output_type);
+
+  kind get_kind() const { return _kind; }
+  size_type column_index() const { return _column_index; }
+  scalar const& literal_value() const { return *_literal; }
+  binary_operator op() const { return _op; }
+  data_type output_type() const { return _output_type; }
+  expression const& lhs() const { return *_lhs; }
+  expression const& rhs() const { return *_rhs; }
+
+ private:
+  explicit expression(kind k) : _kind{k} {}
+
+  kind _kind;
+  size_type _column_index{-1};
+  scalar const* _literal{nullptr};
+  binary_operator _op{binary_operator::INVALID_BINARY};
+  data_type _output_type{};
+  std::shared_ptr<expression const> _lhs;
+  std::shared_ptr<expression const> _rhs;
+};
+
+/**
+ * @brief Computes a column by evaluating an expression tree on every row of a
+ * table
+ *
+ * The whole tree is evaluated by a single kernel, compiled once for each
+ * shape and types of tree, so no intermediate column is materialized for the
+ * inner operations.
+ *
+ * As for `binary_operation()`, the validity of an output value is the logical
+ * AND of the validity of all the columns and literals of the expression.
+ *
+ * @param table       The table whose columns are referenced by `expr`
+ * @param expr        The expression to evaluate
+ * @param mr          Memory resource for allocating output column
+ * @return std::unique_ptr<column> Output column of `table.num_rows()` rows
+ * @throw cudf::logic_error if `expr` refers to a column out of the range of `table`
+ * @throw cudf::logic_error if a column referenced by `expr` isn't fixed-width
+ * @throw cudf::logic_error if the root of `expr` isn't an operation
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
@@ -45,6 +45,35 @@ class column {
    *---------------------------------------------------------------------------**/
   column(column const& other);
 
+  /**---------------------------------------------------------------------------*
+   * @brief Construct a new column sharing the device memory of `owner`, without
+   * any allocation or copy.
+   *
+   * The memory of `owner`, and of its children, is kept alive for as long as
+   * the new column or any of its children exists. `owner` can't be mutated
+   * through a `column const`, and the new column can't be mutated either:
+   * `mutable_view()` and `set_null_mask()` throw. As the column owns no
+   * memory, `release()` returns deep copies of the shared memory, as do copies
+   * of the new column.
+   *
+   * `owner` must not be mutated through any other reference while its memory
+   * is shared.
+   *
+   * Example:
+   * ```
+   * std::shared_ptr<column const> owner = cudf::experimental::cast(input, type);
+   * std::vector<std::unique_ptr<column>> columns;
+   * columns.push_back(column::share(owner));
+   * columns.push_back(column::share(owner));  // same memory, now owned by both
+   * ```
+   *
+   * @throws cudf::logic_error if `owner` is null
+   *
+   * @param owner The column whose memory is shared
+   * @return A read-only column sharing the memory of `owner`
+   *---------------------------------------------------------------------------**/
+  static std::unique_ptr<column> share(std::shared_ptr<column const> owner);
+
   /**---------------------------------------------------------------------------*
    * @brief Construct a new column object by deep copying the contents of
    *`other`.
@@ -138,7 +167,8 @@ class column {
    * @brief Sets the column's null value indicator bitmask to `new_null_mask`.
    *
    * @throws cudf::logic_error if new_null_count is larger than 0 and the size
-   * of `new_null_mask` does not match the size of this column.
+   * of `new_null_mask` does not match the size of this column, or if the
+   * column shares the memory of another column.
    *
    * @param new_null_mask New null value indicator bitmask (rvalue overload &
    * moved) to set the column's null value indicator mask. May be empty if
@@ -154,7 +184,8 @@ class column {
    * @brief Sets the column's null value indicator bitmask to `new_null_mask`.
    *
    * @throws cudf::logic_error if new_null_count is larger than 0 and the size
-   * of `new_null_mask` does not match the size of this column.
+   * of `new_null_mask` does not match the size of this column, or if the
+   * column shares the memory of another column.
    *
    * @param new_null_mask New null value indicator bitmask (lvalue overload &
    * copied) to set the column's null value indicator mask. May be empty if
@@ -191,7 +222,13 @@ class column {
    * @return true The column can hold null values
    * @return false The column cannot hold null values
    *---------------------------------------------------------------------------**/
-  bool nullable() const noexcept { return (_null_mask.size() > 0); }
+  bool nullable() const noexcept { return (null_mask_buffer().size() > 0); }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Indicates whether the column shares the memory of another column,
+   * i.e., it was created by `share()` or is a child of such a column.
+   *---------------------------------------------------------------------------**/
+  bool is_shared() const noexcept { return _shared != nullptr; }
 
   /**---------------------------------------------------------------------------*
    * @brief Indicates whether the column contains null elements.
@@ -245,10 +282,14 @@ class column {
    * - `null_count() == 0`
    * - `num_children() == 0`
    *
+   * A column sharing the memory of another column owns no memory, so its
+   * contents are deep copied, and its reference to the shared memory is
+   * dropped.
+   *
    * @return A `contents` struct containing the data, null mask, and children of
    * the column.
    *---------------------------------------------------------------------------**/
-  contents release() noexcept;
+  contents release();
 
   /**---------------------------------------------------------------------------*
    * @brief Creates an immutable, non-owning view of the column's data and
@@ -278,6 +319,8 @@ class column {
    * if not, the null count will be recomputed on the next invocation of
    *`null_count()`.
    *
+   * @throws cudf::logic_error if the column shares the memory of another column
+   *
    * @return mutable_column_view The mutable, non-owning view
    *---------------------------------------------------------------------------**/
   mutable_column_view mutable_view();
@@ -299,6 +342,18 @@ class column {
   operator mutable_column_view() { return this->mutable_view(); };
 
  private:
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the buffer of the elements, which is the buffer of the owner
+   * of the memory if the column is shared
+   *---------------------------------------------------------------------------**/
+  rmm::device_buffer const& data_buffer() const noexcept;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the null mask buffer, which is the buffer of the owner of the
+   * memory if the column is shared
+   *---------------------------------------------------------------------------**/
+  rmm::device_buffer const& null_mask_buffer() const noexcept;
+
   data_type _type{EMPTY};           ///< Logical type of elements in the column
   cudf::size_type _size{};          ///< The number of elements in the column
   rmm::device_buffer _data{};       ///< Dense, contiguous, type erased device memory
@@ -308,6 +363,7 @@ class column {
   mutable size_type _null_count{UNKNOWN_NULL_COUNT};  ///< The number of null elements
   std::vector<std::unique_ptr<column>> _children{};   ///< Depending on element type, child
                                                       ///< columns may contain additional data
+  std::shared_ptr<column const> _shared{};  ///< Owner of the memory if the column shares it
 };
 
 }  // namespace cudf
@@ -387,6 +387,63 @@ std::unique_ptr<column> make_strings_column(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Constructs a LIST type column given offsets column, child column,
+ * and null mask and null count. The columns and mask are moved into the
+ * resulting lists column.
+ *
+ * Row `i` of the lists column holds the elements `[offsets[i], offsets[i + 1])`
+ * of `child_column`, which may be of any type, including another lists column.
+ *
+ * @param num_rows The number of lists the column represents.
+ * @param offsets_column The INT32 column of `num_rows + 1` offsets into the
+ *                       child column.
+ * @param child_column The column of the elements of all the lists.
+ * @param null_count The number of null list entries.
+ * @param null_mask The bits specifying the null lists in device memory.
+ *                  Arrow format for nulls is used for interpeting this bitmask.
+ * @param stream Optional stream for use with all memory allocation
+ *               and device kernels
+ * @param mr Optional resource to use for device memory
+ *           allocation of the column's `null_mask` and children.
+ */
+std::unique_ptr<column> make_lists_column(
+  size_type num_rows,
+  std::unique_ptr<column> offsets_column,
+  std::unique_ptr<column> child_column,
+  size_type null_count,
+  rmm::device_buffer&& null_mask,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Constructs a STRUCT type column given the child columns of its
+ * fields and null mask and null count. The columns and mask are moved into
+ * the resulting structs column.
+ *
+ * Row `i` of the structs column holds row `i` of every child column, which
+ * may be of any type, including another structs column.
+ *
+ * @throw cudf::logic_error if any child column does not have `num_rows` rows.
+ *
+ * @param num_rows The number of structs the column represents.
+ * @param child_columns The columns of the fields of the structs.
+ * @param null_count The number of null struct entries.
+ * @param null_mask The bits specifying the null structs in device memory.
+ *                  Arrow format for nulls is used for interpeting this bitmask.
+ * @param stream Optional stream for use with all memory allocation
+ *               and device kernels
+ * @param mr Optional resource to use for device memory
+ *           allocation of the column's `null_mask` and children.
+ */
+std::unique_ptr<column> make_structs_column(
+  size_type num_rows,
+  std::vector<std::unique_ptr<column>>&& child_columns,
+  size_type null_count,
+  rmm::device_buffer&& null_mask,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Return a column with size elements that are all equal to the
  * given scalar.
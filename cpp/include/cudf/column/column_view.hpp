@@ -16,10 +16,14 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <memory>
 #include <vector>
 
 namespace cudf {
 namespace detail {
+class lazy_null_counts;
+
 /**---------------------------------------------------------------------------*
  * @brief A non-owning, immutable view of device data as a column of elements,
  * some of which may be null as indicated by a bitmask.
@@ -132,6 +136,10 @@ class column_view_base {
    * point `set_null_count(UNKNOWN_NULL_COUNT)` was invoked, then the
    * first invocation of `null_count()` will compute and store the count of null
    * elements indicated by the `null_mask` (if it exists).
+   *
+   * @note The null counts of the views returned by `slice` and `split` are
+   * counted for all of them together, by the first invocation of `null_count()`
+   * on any of them.
    *---------------------------------------------------------------------------**/
   size_type null_count() const;
 
@@ -198,6 +206,11 @@ class column_view_base {
   mutable size_type _null_count{};   ///< The number of null elements
   size_type _offset{};               ///< Index position of the first element.
                                      ///< Enables zero-copy slicing
+  std::shared_ptr<lazy_null_counts> _lazy_null_counts{};  ///< Counts the null counts of
+                                                          ///< sibling slices together
+  size_type _lazy_null_count_index{};  ///< Index of the view in `_lazy_null_counts`
+
+  friend class lazy_null_counts;
 
   column_view_base()                        = default;
   ~column_view_base()                       = default;
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file compressed_column.hpp
+ * @brief Columns compressed in device memory, to cache tables on the device
+ * at a smaller footprint and decompress them on access.
+ */
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief The encoding of the values of a `compressed_column`
+ */
+enum class column_encoding {
+  NONE,        ///< The values are stored uncompressed
+  CASCADED,    ///< Optional run-length encoding, then delta or frame-of-reference bitpacking
+  DICTIONARY,  ///< Dictionary of the distinct strings, and cascaded indices into it
+};
+
+/**
+ * @brief A column compressed in device memory
+ *
+ * Integer, Boolean, timestamp and fixed-point values are `CASCADED`:
+ * - If the column has long runs of equal values, it is run-length encoded into
+ *   the values and the lengths of its runs.
+ * - Each resulting sequence is split into blocks of 1024 values, and each
+ *   block is bitpacked into the fewest bits that hold either the differences
+ *   of its values from their minimum, or the differences of its consecutive
+ *   values from their minimum. Blocks of equal values, or of arithmetic
+ *   progressions, take no bits at all.
+ *
+ * Strings are `DICTIONARY` encoded into their distinct strings and cascaded
+ * indices. Floating-point values are stored uncompressed.
+ *
+ * The null mask is stored as is.
+ */
+class compressed_column {
+ public:
+  struct impl;
+
+  explicit compressed_column(std::unique_ptr<impl> impl);
+  compressed_column(compressed_column const&) = delete;
+  compressed_column& operator=(compressed_column const&) = delete;
+  ~compressed_column();
+
+  /**
+   * @brief Returns the type of the decompressed column
+   */
+  data_type type() const noexcept;
+
+  /**
+   * @brief Returns the number of elements
+   */
+  size_type size() const noexcept;
+
+  /**
+   * @brief Returns the number of null elements
+   */
+  size_type null_count() const noexcept;
+
+  /**
+   * @brief Returns the encoding of the values
+   */
+  column_encoding encoding() const noexcept;
+
+  /**
+   * @brief Returns the number of bytes of device memory held by the column
+   */
+  std::size_t compressed_size() const noexcept;
+
+  /**
+   * @brief Returns the implementation, for use by `decompress`
+   */
+  impl const& get_impl() const noexcept { return *_impl; }
+
+ private:
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief A table of compressed columns
+ */
+class compressed_table {
+ public:
+  explicit compressed_table(std::vector<std::unique_ptr<compressed_column>>&& columns);
+
+  /**
+   * @brief Returns the number of columns
+   */
+  size_type num_columns() const noexcept { return _columns.size(); }
+
+  /**
+   * @brief Returns the number of rows
+   */
+  size_type num_rows() const noexcept { return _num_rows; }
+
+  /**
+   * @brief Returns the compressed column at `column_index`
+   *
+   * @throws std::out_of_range if `column_index` is out of the range [0, num_columns)
+   */
+  compressed_column const& column(size_type column_index) const {
+    return *_columns.at(column_index);
+  }
+
+  /**
+   * @brief Returns the number of bytes of device memory held by the columns
+   */
+  std::size_t compressed_size() const noexcept;
+
+ private:
+  std::vector<std::unique_ptr<compressed_column>> _columns;
+  size_type _num_rows{};
+};
+
+/**
+ * @brief Compresses a column in device memory
+ *
+ * @throws cudf::logic_error if the column is of a nested or dictionary type
+ *
+ * @param input The column to compress
+ * @param mr Optional resource to use for the device memory of the compressed
+ * column
+ * @return The compressed column
+ */
+std::unique_ptr<compressed_column> compress(
+  column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compresses the columns of a table in device memory
+ *
+ * @throws cudf::logic_error if any column is of a nested or dictionary type
+ *
+ * @param input The table to compress
+ * @param mr Optional resource to use for the device memory of the compressed
+ * table
+ * @return The compressed table
+ */
+std::unique_ptr<compressed_table> compress(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses a compressed column
+ *
+ * @param input The compressed column
+ * @param mr Optional resource to use for device memory allocation of the
+ * returned column
+ * @return The column that was compressed
+ */
+std::unique_ptr<column> decompress(
+  compressed_column const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decompresses columns of a compressed table
+ *
+ * @throws std::out_of_range if any index of `column_indices` is invalid
+ *
+ * @param input The compressed table
+ * @param column_indices Indices of the columns to decompress, in order; all
+ * columns if empty
+ * @param mr Optional resource to use for device memory allocation of the
+ * returned table
+ * @return The table of the decompressed columns
+ */
+std::unique_ptr<table> decompress(
+  compressed_table const& input,
+  std::vector<size_type> const& column_indices = {},
+  rmm::mr::device_memory_resource* mr          = rmm::mr::get_default_resource());
+
+}  // namespace experimental
+}  // namespace cudf
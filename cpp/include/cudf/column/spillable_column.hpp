@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/utilities/memory_budget.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @file spillable_column.hpp
+ * @brief Columns that are moved out of device memory under memory pressure and
+ * moved back on access.
+ */
+
+namespace cudf {
+
+/**
+ * @brief Where the contents of a `spillable_column` are stored
+ */
+enum class spill_location {
+  DEVICE,  ///< In device memory
+  HOST,    ///< In host memory
+  DISK,    ///< In a file of the spill directory
+};
+
+class spill_manager;
+
+/**
+ * @brief A column whose device memory is managed by a `spill_manager`
+ *
+ * The column is spilled to host memory, or to disk, when the manager needs to
+ * free device memory, and copied back to device memory by `get()`.
+ *
+ * A `spillable_column` must be destroyed before its manager.
+ */
+class spillable_column {
+ public:
+  spillable_column(spillable_column const&) = delete;
+  spillable_column& operator=(spillable_column const&) = delete;
+  ~spillable_column();
+
+  /**
+   * @brief Returns the column in device memory, copying it back to device
+   * memory if it was spilled
+   *
+   * The column is not spilled while the returned pointer, or any copy of it,
+   * is alive. Columns that are not in use may be spilled to make room for it.
+   * Once the last copy of the pointer is released, the column is only spilled
+   * after the work queued on `stream` up to the release completes, so the
+   * pointer must be released before the manager is destroyed.
+   *
+   * @param stream The stream on which the column is used
+   * @return The column
+   */
+  std::shared_ptr<column const> get(cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns where the contents of the column are stored
+   */
+  spill_location location() const;
+
+  /**
+   * @brief Returns the number of bytes of device memory used by the column
+   * when it is on the device
+   */
+  std::size_t size_bytes() const;
+
+ private:
+  friend class spill_manager;
+  spillable_column(spill_manager* manager, std::size_t id) : _manager{manager}, _id{id} {}
+
+  spill_manager* _manager;
+  std::size_t _id;
+};
+
+/**
+ * @brief Keeps the device memory used by a set of columns under a limit by
+ * spilling the least recently used ones to host memory, and from host memory
+ * to disk
+ *
+ * Columns are copied to and from device memory on a stream dedicated to the
+ * manager, through a small pinned host staging buffer, so that spilling does
+ * not pin the memory of the spilled columns. The copies are ordered after the
+ * work on the streams passed to `make_spillable()` and `spillable_column::get()`
+ * through an event, so they do not rely on the legacy default stream
+ * synchronizing with other streams.
+ *
+ * Columns in use, i.e., whose pointer returned by `spillable_column::get()` is
+ * alive, are never spilled, so the device memory used may exceed the limit
+ * while they are in use.
+ *
+ * The manager is a `memory_budget`: once installed with `set_memory_budget()`,
+ * the algorithms that need more device memory than remains under the limit
+ * spill columns before they allocate it.
+ *
+ * All the member functions are thread-safe.
+ */
+class spill_manager : public memory_budget {
+ public:
+  /**
+   * @brief Construct a manager
+   *
+   * @param device_limit Number of bytes of device memory the columns may use
+   * @param host_limit Number of bytes of host memory the spilled columns may
+   * use before they are spilled to disk; ignored if `spill_directory` is empty
+   * @param spill_directory Directory of the files of the columns spilled to
+   * disk; columns are not spilled to disk if empty
+   */
+  explicit spill_manager(std::size_t device_limit,
+                         std::size_t host_limit      = std::numeric_limits<std::size_t>::max(),
+                         std::string spill_directory = {});
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+  ~spill_manager() override;
+
+  /**
+   * @brief Puts a column under the management of this manager
+   *
+   * Other columns may be spilled to make room for it. The column is only
+   * spilled after the work queued on `stream` so far completes.
+   *
+   * @param col The column
+   * @param stream The stream on which the column was produced
+   * @return The spillable column
+   */
+  std::unique_ptr<spillable_column> make_spillable(std::unique_ptr<column> col,
+                                                   cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the number of bytes of device memory left under the limit
+   */
+  std::size_t available_bytes() override;
+
+  /**
+   * @brief Spills the least recently used columns that are not in use until at
+   * least `bytes` bytes of device memory are freed, or no column can be spilled
+   *
+   * Also meant to be called when an allocation fails, before retrying it.
+   *
+   * @param bytes Number of bytes of device memory to free
+   * @return true if any device memory was freed
+   */
+  bool spill(std::size_t bytes) override;
+
+  /**
+   * @brief Returns the number of bytes of device memory used by the columns
+   */
+  std::size_t device_bytes() const;
+
+  /**
+   * @brief Returns the number of bytes of host memory used by the spilled
+   * columns
+   */
+  std::size_t host_bytes() const;
+
+  /**
+   * @brief Returns the number of bytes of the columns spilled to disk
+   */
+  std::size_t disk_bytes() const;
+
+ private:
+  friend class spillable_column;
+  struct entry;
+  struct host_column;
+
+  std::shared_ptr<column const> get(std::size_t id, cudaStream_t stream);
+  spill_location location(std::size_t id) const;
+  std::size_t size_bytes(std::size_t id) const;
+  void erase(std::size_t id);
+
+  // The functions below are called with `_mutex` locked
+  void wait_for(cudaStream_t stream);
+  std::size_t spill_device(std::size_t bytes, std::size_t keep_id);
+  void spill_host(std::size_t keep_id);
+  void to_host(entry& e);
+  void to_device(std::size_t id, entry& e);
+  void to_disk(std::size_t id, entry& e);
+  host_column copy_to_host(column_view const& col);
+  std::unique_ptr<column> copy_to_device(host_column const& col);
+  void stage_to_host(void const* source, std::size_t size, std::uint8_t* destination);
+  void stage_to_device(std::uint8_t const* source, std::size_t size, void* destination);
+  std::string file_name(std::size_t id) const;
+
+  static constexpr std::size_t staging_size = 4 * 1024 * 1024;  ///< Per staging buffer
+
+  std::size_t const _device_limit;
+  std::size_t const _host_limit;
+  std::string const _spill_directory;
+
+  mutable std::mutex _mutex;
+  std::unordered_map<std::size_t, std::unique_ptr<entry>> _entries;
+  std::size_t _next_id{};
+  std::uint64_t _clock{};  ///< Incremented at each access, to find the least recently used
+  std::size_t _device_bytes{};
+  std::size_t _host_bytes{};
+  std::size_t _disk_bytes{};
+
+  cudaStream_t _stream{};
+  cudaEvent_t _ready{};      ///< Recorded on the streams the copies wait for
+  void* _staging[2]{};       ///< Pinned host buffers, used alternately
+  cudaEvent_t _staged[2]{};  ///< Recorded after the last copy of each staging buffer
+};
+
+}  // namespace cudf
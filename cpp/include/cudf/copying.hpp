@@ -50,13 +50,15 @@ namespace experimental {
  * @param[in] check_bounds Optionally perform bounds checking on the values
  * of `gather_map` and throw an error if any of its values are out of bounds.
  * @param[in] mr The resource to use for all allocations
+ * @param[in] stream CUDA stream on which to execute kernels and memory copies
  * @return std::unique_ptr<table> Result of the gather
  */
 std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
@@ -450,6 +452,68 @@ std::vector<contiguous_split_result> contiguous_split(
   std::vector<size_type> const& splits,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief A partition of a `contiguous_split` into a caller-provided buffer
+ *
+ * The partition's data is the `size` bytes at `offset` from the start of the buffer. The
+ * `metadata` describes the partition's columns relative to the start of its data, so the
+ * partition can be sent or copied elsewhere and viewed again with `unpack()`.
+ */
+struct packed_table {
+  std::vector<uint8_t> metadata;
+  size_t offset;
+  size_t size;
+};
+
+/**
+ * @brief Returns the number of bytes of each partition of a `contiguous_split` of `input`
+ *
+ * A buffer passed to `contiguous_split(input, splits, buffer, buffer_size)` must hold the sum
+ * of the sizes.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @return The size of each of the `splits.size() + 1` partitions
+ */
+std::vector<size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits);
+
+/**
+ * @brief Performs a deep-copy split of a `table_view` into a caller-provided buffer
+ *
+ * The partitions are the same as those of `contiguous_split(input, splits, mr)`, and are
+ * written one after the other into `buffer`, e.g., a pinned host buffer or a buffer registered
+ * for network transfers, without allocating memory for the output data.
+ *
+ * @throws `cudf::logic_error` if `buffer` is not aligned to 64 bytes.
+ * @throws `cudf::logic_error` if `buffer_size` is less than the sum of the
+ * `contiguous_split_sizes()` of the partitions.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param buffer The device accessible memory receiving the partitions
+ * @param buffer_size The number of bytes of `buffer`
+ * @return The location and the metadata of each partition in `buffer`
+ */
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           void* buffer,
+                                           size_t buffer_size);
+
+/**
+ * @brief Returns the view of a partition of a `contiguous_split` into a caller-provided buffer
+ *
+ * No data is copied: the returned views point into `data`, which must hold the `size` bytes of
+ * the partition, wherever they were copied to.
+ *
+ * @throws `cudf::logic_error` if `metadata` is not the metadata of a `packed_table`.
+ *
+ * @param metadata The `metadata` of the `packed_table`
+ * @param data The device memory holding the data of the partition
+ * @return The view of the partition's table
+ */
+table_view unpack(std::vector<uint8_t> const& metadata, void const* data);
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or 
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -19,12 +19,16 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 //! `datetime` APIs
 namespace datetime {
-namespace detail {
 
+/**
+ * @brief Components of a date time that can be extracted, see `extract_components`
+ */
 enum class datetime_component {
   INVALID = 0,
   YEAR,
@@ -36,6 +40,20 @@ enum class datetime_component {
   SECOND,
 };
 
+/**
+ * @brief Units to which date times are rounded by `floor_datetimes` and
+ * `ceil_datetimes`
+ */
+enum class rounding_frequency {
+  MONTH,
+  DAY,
+  HOUR,
+  MINUTE,
+  SECOND,
+};
+
+namespace detail {
+
 /**
  * @brief  Extracts the supplied datetime component from any date time type
  * and returns an int16_t cudf::column.
@@ -50,6 +68,51 @@ std::unique_ptr<column> extract_component(
   column_view const& column,
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::datetime::extract_components
+ *
+ * @param stream Stream on which to execute kernels
+ */
+std::unique_ptr<experimental::table> extract_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::datetime::floor_datetimes
+ *
+ * @param stream Stream on which to execute kernels
+ */
+std::unique_ptr<column> floor_datetimes(
+  column_view const& column,
+  rounding_frequency frequency,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::datetime::ceil_datetimes
+ *
+ * @param stream Stream on which to execute kernels
+ */
+std::unique_ptr<column> ceil_datetimes(
+  column_view const& column,
+  rounding_frequency frequency,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::datetime::convert_timezone
+ *
+ * @param stream Stream on which to execute kernels
+ */
+std::unique_ptr<column> convert_timezone(
+  column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 }  // namespace detail
 
 /**
@@ -143,6 +206,87 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts several components from any date time type in one pass and
+ * returns a table of one int16_t cudf::column per component.
+ *
+ * The civil date of each value is only computed once, however many of the
+ * date components are requested. Column `i` of the result is
+ * `components[i]`, as extracted by `extract_year`, `extract_month`, etc.
+ *
+ * Example:
+ * ```
+ * column = [2020-07-04 12:30:45, 1969-12-31 23:00:00]
+ * t = extract_components(column, {YEAR, MONTH, HOUR})
+ * t is {[2020, 1969], [7, 12], [12, 23]}
+ * ```
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] components The components to extract
+ *
+ * @returns table of the extracted int16_t datetime components
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a component is `INVALID`
+ */
+std::unique_ptr<experimental::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Rounds any date time type down to the start of its month, day,
+ * hour, minute or second and returns a cudf::column of the same type.
+ *
+ * Values are rounded towards negative infinity, so that the values of one
+ * month, day, etc. have the same result, before the epoch as well as after.
+ * This is the truncation of SQL `date_trunc`. Rounding to a unit finer than
+ * the resolution of the type returns the values unchanged.
+ *
+ * Example:
+ * ```
+ * column = [2020-07-04 12:30:45, 1969-12-31 23:00:00]
+ * r = floor_datetimes(column, HOUR)
+ * r is [2020-07-04 12:00:00, 1969-12-31 23:00:00]
+ * r = floor_datetimes(column, MONTH)
+ * r is [2020-07-01 00:00:00, 1969-12-01 00:00:00]
+ * ```
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] frequency The unit to round to
+ *
+ * @returns cudf::column of the rounded datetime values
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::column> floor_datetimes(
+  cudf::column_view const& column,
+  rounding_frequency frequency,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Rounds any date time type up to the start of its next month, day,
+ * hour, minute or second, unless it is already at such a start, and returns
+ * a cudf::column of the same type.
+ *
+ * Example:
+ * ```
+ * column = [2020-07-04 12:30:45, 2020-07-01 00:00:00]
+ * r = ceil_datetimes(column, DAY)
+ * r is [2020-07-05 00:00:00, 2020-07-01 00:00:00]
+ * r = ceil_datetimes(column, MONTH)
+ * r is [2020-08-01 00:00:00, 2020-07-01 00:00:00]
+ * ```
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] frequency The unit to round to
+ *
+ * @returns cudf::column of the rounded datetime values
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::column> ceil_datetimes(
+  cudf::column_view const& column,
+  rounding_frequency frequency,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Computes the last day of the month in date time type and returns a TIMESTAMP_DAYS
  * cudf::column.
@@ -157,5 +301,158 @@ std::unique_ptr<cudf::column> last_day_of_month(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts year from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t years
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_year(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts month from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t months
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_month(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts day from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t days
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_day(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts weekday from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t weekdays
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_weekday(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts hour from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t hours
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_hour(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts minute from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t minutes
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_minute(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Extracts second from the local time in `timezone` of any UTC date time
+ * type and returns an int16_t cudf::column.
+ *
+ * @param[in] cudf::column_view of the input UTC datetime values
+ * @param[in] timezone Name of the time zone in the zone database, e.g.
+ * "America/New_York"
+ *
+ * @returns cudf::column of the extracted int16_t seconds
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> extract_second(
+  cudf::column_view const& column,
+  std::string const& timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Converts the local times in one time zone of any date time type to
+ * the local times in another time zone and returns a cudf::column of the
+ * same type.
+ *
+ * The offsets from UTC of each time zone, including the daylight saving
+ * transitions, are read from the zone database in `/usr/share/zoneinfo` on
+ * first use of the zone, and kept on the device for later calls. "UTC" and the
+ * empty name are UTC. A local time skipped by a forward transition of
+ * `from_timezone` is moved forward by the length of the gap; a local time
+ * repeated by a backward transition is converted as the earlier of the two
+ * instants. TIMESTAMP_DAYS values are only changed by offsets of whole days.
+ *
+ * Example:
+ * ```
+ * timestamps = [2020-03-08 06:30:00, 2020-07-04 12:00:00]
+ * r = convert_timezone(timestamps, "UTC", "America/New_York")
+ * r is [2020-03-08 01:30:00, 2020-07-04 08:00:00]
+ * ```
+ *
+ * @param[in] timestamps cudf::column_view of the input datetime values
+ * @param[in] from_timezone Time zone of the input values
+ * @param[in] to_timezone Time zone of the output values
+ *
+ * @returns cudf::column of the converted datetime values
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if a time zone is not in the zone database
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace datetime
 }  // namespace cudf
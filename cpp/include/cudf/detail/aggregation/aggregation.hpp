@@ -81,6 +81,47 @@ struct nth_element_aggregation : aggregation {
   }
 };
 
+/**
+ * @brief Derived class for specifying a tdigest or merge_tdigest aggregation
+ */
+struct tdigest_aggregation : aggregation {
+  tdigest_aggregation(aggregation::Kind k, int max_centroids)
+    : aggregation{k}, _max_centroids{max_centroids} {}
+  int _max_centroids;  ///< Maximum number of centroids of a digest
+
+  bool operator==(tdigest_aggregation const& other) const {
+    return aggregation::operator==(other) and _max_centroids == other._max_centroids;
+  }
+};
+
+/**
+ * @brief Derived class for specifying an approximate quantile aggregation
+ */
+struct approx_quantile_aggregation : aggregation {
+  approx_quantile_aggregation(std::vector<double> const& q, int max_centroids)
+    : aggregation{APPROX_QUANTILE}, _quantiles{q}, _max_centroids{max_centroids} {}
+  std::vector<double> _quantiles;  ///< Desired quantile(s)
+  int _max_centroids;              ///< Maximum number of centroids of a digest
+
+  bool operator==(approx_quantile_aggregation const& other) const {
+    return aggregation::operator==(other) and _max_centroids == other._max_centroids and
+           _quantiles == other._quantiles;
+  }
+};
+
+/**
+ * @brief Derived class for specifying a lead or lag aggregation
+ */
+struct lead_lag_aggregation : aggregation {
+  lead_lag_aggregation(aggregation::Kind k, size_type offset)
+    : aggregation{k}, row_offset{offset} {}
+  size_type row_offset;  ///< Number of rows after (LEAD) or before (LAG) each row
+
+  bool operator==(lead_lag_aggregation const& other) const {
+    return aggregation::operator==(other) and row_offset == other.row_offset;
+  }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -258,6 +299,34 @@ struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
   using type = Source;
 };
 
+// COLLECT gives a list of the values of each group
+template <typename Source>
+struct target_type_impl<Source, aggregation::COLLECT> {
+  using type = list_view;
+};
+
+// A TDIGEST of arithmetic values is a struct of centroids and bounds
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::TDIGEST,
+                        std::enable_if_t<std::is_arithmetic<Source>::value>> {
+  using type = struct_view;
+};
+
+// Merging digests gives a digest
+template <>
+struct target_type_impl<struct_view, aggregation::MERGE_TDIGEST> {
+  using type = struct_view;
+};
+
+// Always use `double` for APPROX_QUANTILE of arithmetic values
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::APPROX_QUANTILE,
+                        std::enable_if_t<std::is_arithmetic<Source>::value>> {
+  using type = double;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -287,6 +356,11 @@ using kind_to_type = typename kind_to_type_impl<k>::type;
 AGG_KIND_MAPPING(aggregation::QUANTILE, quantile_aggregation);
 AGG_KIND_MAPPING(aggregation::STD, std_var_aggregation);
 AGG_KIND_MAPPING(aggregation::VARIANCE, std_var_aggregation);
+AGG_KIND_MAPPING(aggregation::TDIGEST, tdigest_aggregation);
+AGG_KIND_MAPPING(aggregation::MERGE_TDIGEST, tdigest_aggregation);
+AGG_KIND_MAPPING(aggregation::APPROX_QUANTILE, approx_quantile_aggregation);
+AGG_KIND_MAPPING(aggregation::LEAD, lead_lag_aggregation);
+AGG_KIND_MAPPING(aggregation::LAG, lead_lag_aggregation);
 
 /**
  * @brief Dispatches `k` as a non-type template parameter to a callable,  `f`.
@@ -340,6 +414,14 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::NUNIQUE>(std::forward<Ts>(args)...);
     case aggregation::NTH_ELEMENT:
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
+    case aggregation::COLLECT:
+      return f.template operator()<aggregation::COLLECT>(std::forward<Ts>(args)...);
+    case aggregation::TDIGEST:
+      return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_TDIGEST:
+      return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_QUANTILE:
+      return f.template operator()<aggregation::APPROX_QUANTILE>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -126,6 +126,17 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::experimental::compute_column
+ *
+ * @param stream      CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> compute_column(
+  table_view const& table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cudf
@@ -73,6 +73,15 @@ std::vector<column_view> slice(column_view const& input,
                                std::vector<size_type> const& indices,
                                cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::slice(table_view const&,std::vector<size_type> const&)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::vector<table_view> slice(table_view const& input,
+                              std::vector<size_type> const& indices,
+                              cudaStream_t stream = 0);
+
 /**
  * @copydoc cudf::experimental::contiguous_split
  *
@@ -84,6 +93,26 @@ std::vector<contiguous_split_result> contiguous_split(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::experimental::contiguous_split_sizes
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+std::vector<size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::contiguous_split(cudf::table_view const&,std::vector<size_type> const&,void*,size_t)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           cudaStream_t stream = 0);
+
 /**
  * @brief Creates an uninitialized new column of the specified size and same type as the `input`.
  * Supports only fixed-width types.
@@ -333,12 +333,12 @@ std::unique_ptr<experimental::table> copy_if(
                                   grid.num_blocks,
                                   stream);
 
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_STREAM_SYNC(stream);
     // As it is InclusiveSum, last value in block_offsets will be output_size
     output_size = block_offsets.back();
   } else {
     // With num_blocks <= 1, block_offsets will always be `0`
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_STREAM_SYNC(stream);
     output_size = block_counts.back();
   }
 
@@ -66,5 +66,65 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                            cudaStream_t stream                 = 0);
 
+/**
+ * @brief View a DLPack DLTensor as a cudf table without copying
+ *
+ * The `device_type` of the DLTensor must be `kDLGPU` and `device_id` must
+ * match the current device. Each column of the tensor must be dense: if
+ * `strides` is set, `strides[0]` must be 1. The data pointer plus
+ * `byte_offset` must be aligned to the element size.
+ *
+ * @note The returned view points into the tensor's memory. The caller must
+ * keep the managed tensor alive, and not call its deleter, while the view is
+ * in use.
+ *
+ * @throw cudf::logic_error if any of the DLTensor fields are unsupported
+ * or if the layout cannot be viewed without a copy
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return Non-nullable view of each tensor column
+ */
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor);
+
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor without copying
+ *
+ * The tensor takes ownership of the column's data buffer, which is freed by
+ * the tensor's `deleter`. The column type must be numeric. The column may
+ * have nulls: the values of null elements are unspecified. Use
+ * `mask_to_dlpack` before this call to export which elements are valid. If
+ * the column has zero rows, the result will be nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory of the tensor.
+ *
+ * @throw cudf::logic_error if the data type is not numeric
+ *
+ * @param input Column to convert to DLPack
+ *
+ * @return 1D DLPack tensor over the column data, or nullptr
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input);
+
+/**
+ * @brief Convert the null mask of a cudf column into a 1D DLPack DLTensor
+ *
+ * The tensor has an 8-bit unsigned element per row of `input` which is 1 if the
+ * element is valid and 0 if it is null. A column without a null mask gives a
+ * tensor of all 1s. If the column has zero rows, the result will be nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory allocated for the tensor.
+ *
+ * @param input Column whose validity to convert to DLPack
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return 1D DLPack tensor of the column validity, or nullptr
+ */
+DLManagedTensor* mask_to_dlpack(
+  column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -17,12 +17,19 @@
 
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/element_copy.cuh>
+#include <cudf/detail/utilities/managed_memory.hpp>
 #include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/lists/list_view.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/gather.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/structs/struct_view.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -39,6 +46,7 @@
 #include <thrust/host_vector.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/binary_search.h>
 
 #include <cub/cub.cuh>
 
@@ -250,6 +258,68 @@ struct column_gatherer_impl<dictionary32, MapItType> {
   }
 };
 
+/**
+ * @brief Column gather specialization for list column type.
+ *
+ * The operator is defined after the table `gather` which it calls to gather
+ * the child column of the lists.
+ */
+template <typename MapItType>
+struct column_gatherer_impl<list_view, MapItType> {
+  /**
+   * @brief Type-dispatched function to gather from one column to another based
+   * on a `gather_map`.
+   *
+   * The child column is gathered recursively, so the lists may hold elements
+   * of any type, including further lists.
+   *
+   * @param source_column View into the column to gather from
+   * @param gather_map_begin Beginning of iterator range of integral values representing the gather map
+   * @param gather_map_end End of iterator range of integral values representing the gather map
+   * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
+   * @param mr Memory resource to use for all allocations
+   * @param stream CUDA stream on which to execute kernels
+   * @return New lists column with gathered rows.
+   */
+  std::unique_ptr<column> operator()(column_view const& source_column,
+                                     MapItType gather_map_begin,
+                                     MapItType gather_map_end,
+                                     bool nullify_out_of_bounds,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream);
+};
+
+/**
+ * @brief Column gather specialization for struct column type.
+ *
+ * The operator is defined after the table `gather` which it calls to gather
+ * the child columns of the structs.
+ */
+template <typename MapItType>
+struct column_gatherer_impl<struct_view, MapItType> {
+  /**
+   * @brief Type-dispatched function to gather from one column to another based
+   * on a `gather_map`.
+   *
+   * The child columns are gathered recursively, so the fields may be of any
+   * type, including further structs.
+   *
+   * @param source_column View into the column to gather from
+   * @param gather_map_begin Beginning of iterator range of integral values representing the gather map
+   * @param gather_map_end End of iterator range of integral values representing the gather map
+   * @param nullify_out_of_bounds Nullify values in `gather_map` that are out of bounds
+   * @param mr Memory resource to use for all allocations
+   * @param stream CUDA stream on which to execute kernels
+   * @return New structs column with gathered rows.
+   */
+  std::unique_ptr<column> operator()(column_view const& source_column,
+                                     MapItType gather_map_begin,
+                                     MapItType gather_map_end,
+                                     bool nullify_out_of_bounds,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream);
+};
+
 /**---------------------------------------------------------------------------*
  * @brief Function object for gathering a type-erased
  * column. To be used with the cudf::type_dispatcher.
@@ -393,6 +463,100 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief A fixed-width column copied by `fused_gather_kernel` or `fused_scatter_kernel`
+ */
+struct fused_copy_column {
+  void const* source;  ///< First element of the source column
+  void* destination;
+  size_type element_size;
+};
+
+// Columns are fused in batches whose descriptions fit in shared memory
+constexpr size_type max_fused_copy_columns = 1024;
+
+/**
+ * @brief Gathers the rows of many fixed-width columns, reading each index of
+ * the gather map once for all the columns
+ *
+ * @param columns The columns to gather
+ * @param num_columns The number of `columns`
+ * @param gather_map The source row of each destination row
+ * @param num_rows The number of destination rows
+ * @param source_rows The number of source rows, out of bounds indices are skipped
+ * if `NullifyOutOfBounds`
+ */
+template <typename MapIterator, bool NullifyOutOfBounds>
+__global__ void fused_gather_kernel(fused_copy_column const* columns,
+                                    size_type num_columns,
+                                    MapIterator gather_map,
+                                    size_type num_rows,
+                                    size_type source_rows) {
+  extern __shared__ char shared_memory[];
+  auto shared_columns = reinterpret_cast<fused_copy_column*>(shared_memory);
+  for (size_type column = threadIdx.x; column < num_columns; column += blockDim.x) {
+    shared_columns[column] = columns[column];
+  }
+  __syncthreads();
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const index = gather_map[row];
+    if (NullifyOutOfBounds and (index < 0 or index >= source_rows)) { continue; }
+    for (size_type column = 0; column < num_columns; ++column) {
+      auto const& col = shared_columns[column];
+      copy_element(col.source, index, col.destination, row, col.element_size);
+    }
+  }
+}
+
+/**
+ * @brief Gathers the fixed-width columns `indices` of `source_table` into
+ * `destination_columns` with a kernel launch for every
+ * `max_fused_copy_columns` columns
+ *
+ * The null masks are left to `gather_bitmask`.
+ */
+template <typename MapIterator>
+void fused_gather(table_view const& source_table,
+                  std::vector<size_type> const& indices,
+                  MapIterator gather_map_begin,
+                  size_type num_destination_rows,
+                  bool nullify_out_of_bounds,
+                  std::vector<std::unique_ptr<column>>& destination_columns,
+                  rmm::mr::device_memory_resource* mr,
+                  cudaStream_t stream) {
+  thrust::host_vector<fused_copy_column> columns;
+  columns.reserve(indices.size());
+  for (auto index : indices) {
+    auto const& source = source_table.column(index);
+    destination_columns[index] =
+      allocate_like(source, num_destination_rows, mask_allocation_policy::NEVER, mr, stream);
+    auto const element_size = static_cast<size_type>(size_of(source.type()));
+    columns.push_back(fused_copy_column{
+      static_cast<char const*>(source.head()) + source.offset() * element_size,
+      destination_columns[index]->mutable_view().head(),
+      element_size});
+  }
+  if (num_destination_rows == 0) { return; }
+  rmm::device_vector<fused_copy_column> d_columns(columns);
+
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d grid{num_destination_rows, block_size};
+  auto const kernel = nullify_out_of_bounds ? fused_gather_kernel<MapIterator, true>
+                                            : fused_gather_kernel<MapIterator, false>;
+  auto const num_columns = static_cast<size_type>(columns.size());
+  for (size_type first = 0; first < num_columns; first += max_fused_copy_columns) {
+    auto const count = std::min(max_fused_copy_columns, num_columns - first);
+    kernel<<<grid.num_blocks, block_size, count * sizeof(fused_copy_column), stream>>>(
+      d_columns.data().get() + first,
+      count,
+      gather_map_begin,
+      num_destination_rows,
+      source_table.num_rows());
+  }
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -433,20 +597,36 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               cudaStream_t stream                 = 0) {
   auto num_destination_rows = std::distance(gather_map_begin, gather_map_end);
 
-  std::vector<std::unique_ptr<column>> destination_columns;
+  cudf::detail::prefetch_to_device(source_table, stream);
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
 
-  // TODO: Could be beneficial to use streams internally here
+  // Fixed-width columns are gathered together, reading the gather map once
+  std::vector<size_type> fixed_width_columns;
+  for (size_type index = 0; index < source_table.num_columns(); ++index) {
+    if (is_fixed_width(source_table.column(index).type())) { fixed_width_columns.push_back(index); }
+  }
+  if (fixed_width_columns.size() > 1) {
+    fused_gather(source_table,
+                 fixed_width_columns,
+                 gather_map_begin,
+                 num_destination_rows,
+                 nullify_out_of_bounds,
+                 destination_columns,
+                 mr,
+                 stream);
+  }
 
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(cudf::experimental::type_dispatcher(source_column.type(),
-                                                                      column_gatherer{},
-                                                                      source_column,
-                                                                      gather_map_begin,
-                                                                      gather_map_end,
-                                                                      nullify_out_of_bounds,
-                                                                      mr,
-                                                                      stream));
+  for (size_type index = 0; index < source_table.num_columns(); ++index) {
+    if (destination_columns[index] != nullptr) { continue; }
+    auto const& source_column  = source_table.column(index);
+    destination_columns[index] = cudf::experimental::type_dispatcher(source_column.type(),
+                                                                     column_gatherer{},
+                                                                     source_column,
+                                                                     gather_map_begin,
+                                                                     gather_map_end,
+                                                                     nullify_out_of_bounds,
+                                                                     mr,
+                                                                     stream);
   }
 
   auto const op =
@@ -456,6 +636,89 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return std::make_unique<table>(std::move(destination_columns));
 }
 
+template <typename MapItType>
+std::unique_ptr<column> column_gatherer_impl<list_view, MapItType>::operator()(
+  column_view const& source_column,
+  MapItType gather_map_begin,
+  MapItType gather_map_end,
+  bool nullify_out_of_bounds,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  lists_column_view lists(source_column);
+  auto const output_count = static_cast<size_type>(std::distance(gather_map_begin, gather_map_end));
+  if (output_count == 0) return make_empty_column(data_type{LIST});
+  auto execpol = rmm::exec_policy(stream);
+
+  // the size of each gathered list; out-of-bounds rows are empty
+  auto const d_offsets  = lists.offsets().data<size_type>() + lists.offset();
+  auto const rows_count = lists.size();
+  auto sizes_itr        = thrust::make_transform_iterator(
+    gather_map_begin, [d_offsets, rows_count] __device__(size_type row) {
+      return ((row < 0) || (row >= rows_count)) ? 0 : d_offsets[row + 1] - d_offsets[row];
+    });
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    sizes_itr, sizes_itr + output_count, mr, stream);
+  auto const d_out_offsets = offsets_column->view().data<size_type>();
+  size_type elements_count = 0;
+  CUDA_TRY(cudaMemcpyAsync(&elements_count,
+                           d_out_offsets + output_count,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+
+  // map each element of the output lists to its element in the source child
+  rmm::device_vector<size_type> child_map(elements_count);
+  thrust::transform(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(elements_count),
+    child_map.begin(),
+    [d_offsets, d_out_offsets, output_count, gather_map_begin] __device__(size_type idx) {
+      auto const row = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, d_out_offsets, d_out_offsets + output_count + 1, idx) -
+        d_out_offsets - 1);
+      return d_offsets[gather_map_begin[row]] + (idx - d_out_offsets[row]);
+    });
+  // the table gather keeps the child's null mask
+  auto child_table = gather(
+    table_view{{lists.child()}}, child_map.begin(), child_map.end(), false, mr, stream);
+  auto child_columns = child_table->release();
+
+  // the parent null mask is gathered by the caller
+  return make_lists_column(output_count,
+                           std::move(offsets_column),
+                           std::move(child_columns.front()),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+template <typename MapItType>
+std::unique_ptr<column> column_gatherer_impl<struct_view, MapItType>::operator()(
+  column_view const& source_column,
+  MapItType gather_map_begin,
+  MapItType gather_map_end,
+  bool nullify_out_of_bounds,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  structs_column_view structs(source_column);
+  auto const output_count = static_cast<size_type>(std::distance(gather_map_begin, gather_map_end));
+
+  // the table gather keeps the null masks of the children
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < structs.num_children(); ++idx) {
+    children.push_back(structs.sliced_child(idx));
+  }
+  auto child_table = gather(
+    table_view{children}, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
+
+  // the parent null mask is gathered by the caller
+  return make_structs_column(
+    output_count, child_table->release(), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cudf
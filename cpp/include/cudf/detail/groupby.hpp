@@ -37,11 +37,24 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests);
 
+/**
+ * @brief The choices of a hash-based groupby that depend on the keys, made by
+ * the planner of `groupby::aggregate`
+ */
+struct hash_groupby_plan {
+  /// Estimated number of distinct keys, or -1 if they were not estimated
+  size_type estimated_num_groups = -1;
+  /// Whether rows are pre-aggregated in shared memory when all the single-pass
+  /// aggregations allow it
+  bool use_shared_memory = true;
+};
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   include_nulls include_null_keys,
+  hash_groupby_plan const& plan,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
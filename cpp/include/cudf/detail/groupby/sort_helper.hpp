@@ -127,6 +127,16 @@ struct sort_groupby_helper {
   std::unique_ptr<table> sorted_keys(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(), cudaStream_t stream = 0);
 
+  /**
+   * @brief Whether the keys are used in their given order
+   *
+   * True when the keys were declared pre-sorted and no row has to be
+   * discarded for containing nulls. The sort order of the keys is then the
+   * identity, so the keys and values are already grouped and need not be
+   * sorted or gathered.
+   */
+  bool is_presorted() const { return _keys_pre_sorted == sorted::YES; }
+
   /**
    * @brief Get the number of groups in `keys`
    */
@@ -61,5 +61,16 @@ std::unique_ptr<column> hash(table_view const& input,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::hash(table_view const&,hash_id,uint64_t,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional stream to use for allocations and copies
+ */
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             uint64_t seed                       = 0,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
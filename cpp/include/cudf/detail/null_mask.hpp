@@ -15,8 +15,11 @@
  */
 #pragma once
 
+#include <cudf/column/column_view.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace cudf {
@@ -41,6 +44,110 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const* bitmask,
                                                   std::vector<size_type> const& indices,
                                                   cudaStream_t stream = 0);
 
+/**
+ * @brief Given a set of bitmasks, counts the number of set (1) bits of each
+ * bitmask in every range `[indices[2*i], indices[(2*i)+1])` (where
+ * 0 <= i < indices.size() / 2).
+ *
+ * All the counts are computed with a single kernel, e.g., the null counts of
+ * every column of a table sliced into many tables. A `nullptr` bitmask has all
+ * its bits set.
+ *
+ * @throws cudf::logic_error if indices.size() % 2 != 0
+ * @throws cudf::logic_error if indices[2*i] < 0 or
+ * indices[2*i] > indices[(2*i)+1]
+ *
+ * @param[in] bitmasks Bitmasks residing in device memory whose bits will be
+ * counted
+ * @param[in] indices A vector of indices used to specify ranges to count the
+ * number of set bits
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ * @return For each bitmask, the number of non-zero bits in the specified ranges
+ */
+std::vector<std::vector<size_type>> segmented_count_set_bits(
+  std::vector<bitmask_type const*> const& bitmasks,
+  std::vector<size_type> const& indices,
+  cudaStream_t stream = 0);
+
+/**
+ * @brief Given a set of bitmasks, counts the number of unset (0) bits of each
+ * bitmask in every range `[indices[2*i], indices[(2*i)+1])` (where
+ * 0 <= i < indices.size() / 2).
+ *
+ * A `nullptr` bitmask has no unset bits.
+ *
+ * @throws cudf::logic_error if indices.size() % 2 != 0
+ * @throws cudf::logic_error if indices[2*i] < 0 or
+ * indices[2*i] > indices[(2*i)+1]
+ *
+ * @param[in] bitmasks Bitmasks residing in device memory whose bits will be
+ * counted
+ * @param[in] indices A vector of indices used to specify ranges to count the
+ * number of unset bits
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ * @return For each bitmask, the number of zero bits in the specified ranges
+ */
+std::vector<std::vector<size_type>> segmented_count_unset_bits(
+  std::vector<bitmask_type const*> const& bitmasks,
+  std::vector<size_type> const& indices,
+  cudaStream_t stream = 0);
+
+/**
+ * @brief The null counts of the slices of a set of columns, counted together
+ * when the first of them is needed
+ *
+ * Slicing a table into many views used to count the null counts of all of
+ * them on the spot, even if none were used. Instead, the views share this
+ * object: the first `null_count()` on any of them counts the null counts of
+ * all the slices of all the columns with one kernel per distinct column
+ * offset, and the others find their count cached here.
+ *
+ * The null masks must stay valid as long as the views do.
+ */
+class lazy_null_counts {
+ public:
+  /**
+   * @brief Constructs the null counts of the slices of columns
+   *
+   * @param null_masks The null mask of each column; nullptr if it has none
+   * @param offsets The offset of each column
+   * @param indices The ranges `[indices[2*i], indices[(2*i)+1])` of the slices,
+   * relative to the offset of the columns
+   */
+  lazy_null_counts(std::vector<bitmask_type const*> null_masks,
+                   std::vector<size_type> offsets,
+                   std::vector<size_type> indices);
+
+  /**
+   * @brief Returns the null count of the view at `index`, the slice
+   * `index % num_slices` of the column `index / num_slices`
+   */
+  size_type null_count(size_type index);
+
+  /**
+   * @brief Makes `view` count its null count with its siblings
+   *
+   * @param view The slice `slice_index` of the column `column_index`
+   * @param counts The null counts shared by the siblings
+   * @param column_index Index of the column of `view`
+   * @param slice_index Index of the slice of `view`
+   */
+  static void attach(column_view_base& view,
+                     std::shared_ptr<lazy_null_counts> const& counts,
+                     size_type column_index,
+                     size_type slice_index);
+
+ private:
+  void count();
+
+  std::vector<bitmask_type const*> _null_masks;
+  std::vector<size_type> _offsets;
+  std::vector<size_type> _indices;
+  std::mutex _mutex;
+  bool _counted = false;
+  std::vector<size_type> _null_counts;  ///< Of each slice, column by column
+};
+
 }  // namespace detail
 
 }  // namespace cudf
@@ -18,6 +18,8 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/detail/utilities/operation_observer.hpp>
+
 namespace cudf {
 
 /**
@@ -41,7 +43,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The call is also measured for the installed
+ * `cudf::operation_observer`, if any.
  *
  * Example:
  * ```
@@ -52,4 +55,28 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * ```
  *
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  ::cudf::detail::operation_scope const cudf_operation_scope__{__func__}
+
+/**
+ * @brief Macro for generating an NVTX range in the `libcudf` domain, and an
+ * `operation_record` of kind `PHASE` for the installed
+ * `cudf::operation_observer`, from the lifetime of the enclosing scope.
+ *
+ * Marks the phases of an algorithm whose memory and time are worth reporting
+ * apart from those of the function, at most one per scope.
+ *
+ * Example:
+ * ```
+ * {
+ *    CUDF_PHASE_RANGE("hash_join_build");
+ *    ...
+ * }
+ * ```
+ *
+ * @param name String literal naming the phase
+ */
+#define CUDF_PHASE_RANGE(name)                                           \
+  ::cudf::thread_range const cudf_phase_range__{::nvtx3::message{name}}; \
+  ::cudf::detail::operation_scope const cudf_phase_scope__{name, ::cudf::operation_kind::PHASE}
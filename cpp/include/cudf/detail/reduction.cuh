@@ -142,6 +142,30 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
   CUDF_FAIL("dictionary type not supported");
 }
 
+template <typename Op,
+          typename InputIterator,
+          typename OutputType = typename thrust::iterator_value<InputIterator>::type,
+          typename std::enable_if_t<std::is_same<OutputType, list_view>::value>* = nullptr>
+std::unique_ptr<scalar> reduce(InputIterator d_in,
+                               cudf::size_type num_items,
+                               op::simple_op<Op> sop,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream) {
+  CUDF_FAIL("list type not supported");
+}
+
+template <typename Op,
+          typename InputIterator,
+          typename OutputType = typename thrust::iterator_value<InputIterator>::type,
+          typename std::enable_if_t<std::is_same<OutputType, struct_view>::value>* = nullptr>
+std::unique_ptr<scalar> reduce(InputIterator d_in,
+                               cudf::size_type num_items,
+                               op::simple_op<Op> sop,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream) {
+  CUDF_FAIL("struct type not supported");
+}
+
 /** --------------------------------------------------------------------------*
  * @brief compute reduction by the compound operator (reduce and transform)
  *
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/reduction.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @copydoc cudf::experimental::reduce(column_view const&,std::unique_ptr<aggregation> const&,data_type,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<scalar> reduce(
+  column_view const& col,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::reduce(chunked_column_view const&,std::unique_ptr<aggregation> const&,data_type,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const& col,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::reduce(column_view const&,std::vector<std::unique_ptr<aggregation>> const&,std::vector<data_type> const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::reduce(std::vector<reduction_request> const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  std::vector<reduction_request> const& requests,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::describe(table_view const&,size_type,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::vector<column_description> describe(
+  table_view const& input,
+  size_type chunk_size                = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::segmented_reduce(column_view const&,column_view const&,std::unique_ptr<aggregation> const&,data_type,rmm::mr::device_memory_resource*)
+ *
+ * @param kind The kind of the aggregation applied to each segment
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& col,
+  column_view const& offsets,
+  aggregation::Kind kind,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::scan(const column_view&,std::unique_ptr<aggregation> const&,scan_type,include_nulls,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> scan(const column_view& input,
+                             std::unique_ptr<aggregation> const& agg,
+                             scan_type inclusive,
+                             include_nulls include_nulls_flag    = include_nulls::NO,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::segmented_scan(const column_view&,const column_view&,std::unique_ptr<aggregation> const&,scan_type,include_nulls,rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> segmented_scan(
+  const column_view& input,
+  const column_view& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  include_nulls include_nulls_flag    = include_nulls::NO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/row_conversion.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @copydoc cudf::experimental::convert_to_rows
+ *
+ * @param stream CUDA stream on which to execute kernels
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::convert_from_rows
+ *
+ * @param stream CUDA stream on which to execute kernels
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -17,14 +17,19 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/utilities/traits.hpp>
 
 namespace cudf {
@@ -145,6 +150,41 @@ struct column_scatterer_impl<dictionary32, MapIterator> {
   }
 };
 
+/**
+ * @brief Column scatter specialization for list column type.
+ *
+ * The output is gathered from the scattered source rows followed by the
+ * target rows: the offsets are built from the sizes of the scattered rows and
+ * the child column is gathered recursively. The parent null mask is a copy of
+ * the target's, which the caller updates for the scattered rows.
+ */
+template <typename MapIterator>
+struct column_scatterer_impl<list_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const;
+};
+
+/**
+ * @brief Column scatter specialization for struct column type.
+ *
+ * Each child column is scattered recursively through the table `scatter`,
+ * which is defined after this. The parent null mask is a copy of the
+ * target's, which the caller updates for the scattered rows.
+ */
+template <typename MapIterator>
+struct column_scatterer_impl<struct_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const;
+};
+
 template <typename MapIterator>
 struct column_scatterer {
   template <typename Element>
@@ -159,6 +199,79 @@ struct column_scatterer {
   }
 };
 
+/**
+ * @brief Scatters the rows of many fixed-width columns, reading each index of
+ * the scatter map once for all the columns
+ *
+ * @param columns The columns to scatter, whose destinations are copies of the
+ * target columns
+ * @param num_columns The number of `columns`
+ * @param scatter_map The destination row of each source row
+ * @param num_rows The number of source rows to scatter
+ */
+template <typename MapIterator>
+__global__ void fused_scatter_kernel(fused_copy_column const* columns,
+                                     size_type num_columns,
+                                     MapIterator scatter_map,
+                                     size_type num_rows) {
+  extern __shared__ char shared_memory[];
+  auto shared_columns = reinterpret_cast<fused_copy_column*>(shared_memory);
+  for (size_type column = threadIdx.x; column < num_columns; column += blockDim.x) {
+    shared_columns[column] = columns[column];
+  }
+  __syncthreads();
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const index = scatter_map[row];
+    for (size_type column = 0; column < num_columns; ++column) {
+      auto const& col = shared_columns[column];
+      copy_element(col.source, row, col.destination, index, col.element_size);
+    }
+  }
+}
+
+/**
+ * @brief Scatters the fixed-width columns `indices` of `source` into copies of
+ * the columns of `target` in `result`, with a kernel launch for every
+ * `max_fused_copy_columns` columns
+ *
+ * The null masks are left to `gather_bitmask`.
+ */
+template <typename MapIterator>
+void fused_scatter(table_view const& source,
+                   std::vector<size_type> const& indices,
+                   MapIterator scatter_map_begin,
+                   size_type num_scatter_rows,
+                   table_view const& target,
+                   std::vector<std::unique_ptr<column>>& result,
+                   rmm::mr::device_memory_resource* mr,
+                   cudaStream_t stream) {
+  thrust::host_vector<fused_copy_column> columns;
+  columns.reserve(indices.size());
+  for (auto index : indices) {
+    auto const& source_column = source.column(index);
+    result[index]             = std::make_unique<column>(target.column(index), stream, mr);
+    auto const element_size   = static_cast<size_type>(size_of(source_column.type()));
+    columns.push_back(fused_copy_column{
+      static_cast<char const*>(source_column.head()) + source_column.offset() * element_size,
+      result[index]->mutable_view().head(),
+      element_size});
+  }
+  if (num_scatter_rows == 0) { return; }
+  rmm::device_vector<fused_copy_column> d_columns(columns);
+
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d grid{num_scatter_rows, block_size};
+  auto const num_columns = static_cast<size_type>(columns.size());
+  for (size_type first = 0; first < num_columns; first += max_fused_copy_columns) {
+    auto const count = std::min(max_fused_copy_columns, num_columns - first);
+    auto const shared_size = count * sizeof(fused_copy_column);
+    fused_scatter_kernel<<<grid.num_blocks, block_size, shared_size, stream>>>(
+      d_columns.data().get() + first, count, scatter_map_begin, num_scatter_rows);
+  }
+}
+
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
  * according to a scatter map.
@@ -228,22 +341,35 @@ std::unique_ptr<table> scatter(
 
   auto result = std::vector<std::unique_ptr<column>>(target.num_columns());
 
+  // Fixed-width columns are scattered together, reading the scatter map once
+  std::vector<size_type> fixed_width_columns;
+  for (size_type index = 0; index < target.num_columns(); ++index) {
+    if (is_fixed_width(target.column(index).type())) { fixed_width_columns.push_back(index); }
+  }
+  if (fixed_width_columns.size() > 1) {
+    fused_scatter(source,
+                  fixed_width_columns,
+                  updated_scatter_map_begin,
+                  std::distance(scatter_map_begin, scatter_map_end),
+                  target,
+                  result,
+                  mr,
+                  stream);
+  }
+
   auto scatter_functor = column_scatterer<decltype(updated_scatter_map_begin)>{};
 
-  std::transform(source.begin(),
-                 source.end(),
-                 target.begin(),
-                 result.begin(),
-                 [=](auto const& source_col, auto const& target_col) {
-                   return type_dispatcher(source_col.type(),
-                                          scatter_functor,
-                                          source_col,
-                                          updated_scatter_map_begin,
-                                          updated_scatter_map_end,
-                                          target_col,
-                                          mr,
-                                          stream);
-                 });
+  for (size_type index = 0; index < target.num_columns(); ++index) {
+    if (result[index] != nullptr) { continue; }
+    result[index] = type_dispatcher(source.column(index).type(),
+                                    scatter_functor,
+                                    source.column(index),
+                                    updated_scatter_map_begin,
+                                    updated_scatter_map_end,
+                                    target.column(index),
+                                    mr,
+                                    stream);
+  }
 
   auto gather_map = scatter_to_gather(
     updated_scatter_map_begin, updated_scatter_map_end, target.num_rows(), stream);
@@ -252,6 +378,79 @@ std::unique_ptr<table> scatter(
 
   return std::make_unique<table>(std::move(result));
 }
+
+template <typename MapIterator>
+std::unique_ptr<column> column_scatterer_impl<list_view, MapIterator>::operator()(
+  column_view const& source,
+  MapIterator scatter_map_begin,
+  MapIterator scatter_map_end,
+  column_view const& target,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const {
+  if (target.size() == 0) return make_empty_column(data_type{LIST});
+  auto const scatter_rows =
+    static_cast<size_type>(std::distance(scatter_map_begin, scatter_map_end));
+
+  // the scattered source rows come first, followed by the rows of the target
+  auto const combined = lists::detail::concatenate(
+    {detail::slice(source, 0, scatter_rows), target}, rmm::mr::get_default_resource(), stream);
+
+  // rows that are not scattered to are gathered from the target
+  auto gather_map = scatter_to_gather(scatter_map_begin, scatter_map_end, target.size(), stream);
+  using MapValueType = typename decltype(gather_map)::value_type;
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    gather_map.begin(),
+                    gather_map.end(),
+                    thrust::make_counting_iterator<MapValueType>(0),
+                    gather_map.begin(),
+                    [scatter_rows] __device__(MapValueType source_row, MapValueType row) {
+                      return source_row < 0 ? scatter_rows + row : source_row;
+                    });
+
+  column_gatherer_impl<list_view, decltype(gather_map.begin())> gatherer{};
+  auto result = gatherer(combined->view(), gather_map.begin(), gather_map.end(), false, mr, stream);
+  if (target.nullable()) {
+    result->set_null_mask(copy_bitmask(target, stream, mr), target.null_count());
+  }
+  return result;
+}
+
+template <typename MapIterator>
+std::unique_ptr<column> column_scatterer_impl<struct_view, MapIterator>::operator()(
+  column_view const& source,
+  MapIterator scatter_map_begin,
+  MapIterator scatter_map_end,
+  column_view const& target,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const {
+  structs_column_view const source_structs(source);
+  structs_column_view const target_structs(target);
+  CUDF_EXPECTS(source_structs.num_children() == target_structs.num_children(),
+               "scatter struct columns must have the same number of children");
+
+  // the table scatter keeps the null masks of the children
+  std::vector<column_view> source_children;
+  std::vector<column_view> target_children;
+  for (size_type idx = 0; idx < target_structs.num_children(); ++idx) {
+    source_children.push_back(source_structs.sliced_child(idx));
+    target_children.push_back(target_structs.sliced_child(idx));
+  }
+  auto child_table = detail::scatter(table_view{source_children},
+                                     scatter_map_begin,
+                                     scatter_map_end,
+                                     table_view{target_children},
+                                     false,
+                                     mr,
+                                     stream);
+
+  return make_structs_column(target.size(),
+                             child_table->release(),
+                             target.null_count(),
+                             copy_bitmask(target, stream, mr),
+                             stream,
+                             mr);
+}
+
 }  //namespace detail
 }  //namespace experimental
 }  // namespace cudf
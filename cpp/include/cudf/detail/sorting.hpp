@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/sorting.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -48,6 +49,41 @@ std::unique_ptr<column> sorted_order(
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
   cudaStream_t stream                            = 0);
 
+/**
+ * @copydoc cudf::experimental::is_sorted
+ *
+ * The rows are compared in blocks of increasing size, and the comparison stops
+ * after the first block with rows out of order.
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+bool is_sorted(table_view const& table,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream = 0);
+
+/**
+ * @brief Checks whether every row of `table` is greater than or equal to the
+ * next one, in the order of `column_order` and `null_precedence`
+ *
+ * @copydetails cudf::experimental::detail::is_sorted
+ */
+bool is_reverse_sorted(table_view const& table,
+                       std::vector<order> const& column_order,
+                       std::vector<null_order> const& null_precedence,
+                       cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::experimental::probe_sortedness
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+sortedness probe_sortedness(table_view const& table,
+                            std::vector<order> const& column_order         = {},
+                            std::vector<null_order> const& null_precedence = {},
+                            double max_unsorted_fraction                   = 0.01,
+                            cudaStream_t stream                            = 0);
+
 /**
  * @brief Computes the row indices that would produce `input` in a stable
  * lexicographical sorted order.
@@ -62,6 +98,19 @@ std::unique_ptr<column> stable_sorted_order(
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
   cudaStream_t stream                            = 0);
 
+/**
+ * @copydoc cudf::experimental::top_k_order
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> top_k_order(
+  table_view input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
 /**
  * @copydoc cudf::experimental::sort_by_key
  *
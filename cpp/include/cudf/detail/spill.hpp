@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Table copied to pinned host memory, to free device memory until it
+ * is needed again
+ */
+struct spilled_table {
+  std::unique_ptr<uint8_t, cudaError_t (*)(void*)> data{nullptr, cudaFreeHost};
+  size_t size{0};
+  table_view view;  ///< Columns pointing into `data`
+};
+
+/**
+ * @brief Copies a table to pinned host memory
+ *
+ * @param t The table to copy
+ * @param stream CUDA stream on which to execute the copy
+ * @return The host copy of `t`
+ */
+spilled_table spill_to_host(table_view const& t, cudaStream_t stream = 0);
+
+/**
+ * @brief Copies a spilled table back to device memory
+ *
+ * @param spilled The table to copy
+ * @param stream CUDA stream on which to execute the copy
+ * @return The device buffer holding the data and the view of the table
+ */
+std::pair<rmm::device_buffer, table_view> restore_to_device(spilled_table const& spilled,
+                                                            cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
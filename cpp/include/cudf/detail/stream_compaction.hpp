@@ -95,6 +95,18 @@ std::unique_ptr<experimental::table> apply_boolean_mask(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::experimental::filter_and_select
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+std::unique_ptr<experimental::table> filter_and_select(
+  table_view const& input,
+  expression const& predicate,
+  std::vector<size_type> const& column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @brief Create a new table without duplicate rows
  *
@@ -102,13 +114,16 @@ std::unique_ptr<experimental::table> apply_boolean_mask(
  * row of `keys` columns is unique, where the definition of unique depends on the value of @p keep:
  * - KEEP_FIRST: only the first of a sequence of duplicate rows is copied
  * - KEEP_LAST: only the last of a sequence of duplicate rows is copied
- * - KEEP_NONE: only unique rows are kept
+ * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: one arbitrary row of each set of duplicate rows is copied.
+ *   The rows are found with a hash map rather than by sorting, so the order
+ *   of the output rows is unspecified.
  *
  * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
  *
  * @param[in] input           input table_view to copy only unique rows
  * @param[in] keys            vector of indices representing key columns from `input`
- * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
+ * @param[in] keep            keep first entry, last entry, any entry, or no entries if duplicates found
  * @param[in] nulls_are_equal flag to denote nulls are equal if true,
  * nulls are not equal if false
  * @param[in] mr Optional, The resource to use for all allocations
@@ -148,6 +163,15 @@ cudf::size_type unique_count(column_view const& input,
                              bool const& nan_as_null,
                              cudaStream_t stream = 0);
 
+/**
+ * @copydoc cudf::experimental::approx_distinct_count
+ *
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ */
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int precision       = 12,
+                                      cudaStream_t stream = 0);
+
 /**---------------------------------------------------------------------------*
  * @brief A structure to be used for checking `NAN` at an index in a 
  * `column_device_view`
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/quantiles.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Builds the t-digest of each segment `[offsets[i], offsets[i + 1])`
+ * of `values`
+ *
+ * The values of a segment are digested without sorting the segment: tiles of
+ * the segment are sorted and compressed in shared memory, and only the
+ * centroids of the tiles are merged.
+ *
+ * @throws cudf::logic_error if `values` is not arithmetic
+ * @throws cudf::logic_error if `offsets` is not INT32 or has nulls
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param values The values to digest
+ * @param offsets The `num_segments + 1` non-decreasing offsets of the segments
+ * @param max_centroids The maximum number of centroids of each digest
+ * @param mr Memory resource to allocate the digests with
+ * @param stream CUDA stream on which to execute kernels
+ * @return The column of the `num_segments` digests
+ */
+std::unique_ptr<column> make_tdigest(
+  column_view const& values,
+  column_view const& offsets,
+  int max_centroids,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Merges the t-digests of each segment `[offsets[i], offsets[i + 1])`
+ * of `digests` into one digest
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ * @throws cudf::logic_error if `offsets` is not INT32 or has nulls
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param digests The digests to merge
+ * @param offsets The `num_segments + 1` non-decreasing offsets of the segments
+ * @param max_centroids The maximum number of centroids of each merged digest
+ * @param mr Memory resource to allocate the digests with
+ * @param stream CUDA stream on which to execute kernels
+ * @return The column of the `num_segments` merged digests
+ */
+std::unique_ptr<column> merge_tdigests(
+  column_view const& digests,
+  column_view const& offsets,
+  int max_centroids,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::experimental::approx_quantiles(column_view const&,std::vector<double> const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream on which to execute kernels
+ */
+std::unique_ptr<column> approx_quantiles(
+  column_view const& digests,
+  std::vector<double> const& q,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
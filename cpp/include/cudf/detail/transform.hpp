@@ -49,6 +49,20 @@ std::unique_ptr<column> transform(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::experimental::transform(table_view const&, std::string const&,
+ * std::vector<data_type> const&, bool, rmm::mr::device_memory_resource*)
+ *
+ * @param stream        CUDA stream on which to execute kernels
+ **/
+std::unique_ptr<table> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::experimental::nans_to_nulls
  *
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A pair of pinned host and device memory blocks of the same size
+ *
+ * The descriptors of a device view are written to `host` and copied
+ * asynchronously to `device`.
+ */
+struct descriptor_block {
+  void* host;            ///< Pinned host memory
+  void* device;          ///< Device memory
+  std::size_t size;      ///< Size of both blocks in bytes
+  cudaEvent_t released;  ///< Recorded on the stream of the last use of the block
+};
+
+/**
+ * @brief Process-wide cache of the blocks holding the descriptors of device views
+ *
+ * Creating a device view of a table copies the descriptors of its columns to
+ * device memory. For the narrow tables of small operations, allocating that
+ * memory and waiting for the copy cost more than the kernels that use it. The
+ * pool keeps the blocks for reuse, and stages the copy in pinned memory so that
+ * it does not need to synchronize.
+ *
+ * Requests are rounded up to a power-of-two size class, from `min_block_size`
+ * to `max_block_size`; `acquire()` returns nullptr for larger requests, which
+ * are left to the caller. A released block is handed out again once the work
+ * that was queued on its stream before it was released has completed, so that
+ * kernels still reading the descriptors are not affected.
+ *
+ * All the member functions are thread-safe.
+ */
+class descriptor_pool {
+ public:
+  static constexpr std::size_t min_block_size  = 1024;
+  static constexpr std::size_t max_block_size  = 64 * 1024;
+  static constexpr std::size_t max_free_blocks = 64;  ///< Kept for each size class
+
+  /**
+   * @brief Returns the pool shared by all the device views
+   */
+  static descriptor_pool& instance();
+
+  descriptor_pool()                       = default;
+  descriptor_pool(descriptor_pool const&) = delete;
+  descriptor_pool& operator=(descriptor_pool const&) = delete;
+  ~descriptor_pool();
+
+  /**
+   * @brief Returns a block of at least `size` bytes
+   *
+   * @param size Number of bytes
+   *
+   * @return The block; nullptr if `size` is zero or exceeds `max_block_size`
+   */
+  descriptor_block* acquire(std::size_t size);
+
+  /**
+   * @brief Returns a block to the pool
+   *
+   * @param block Block returned by `acquire()`
+   * @param stream Stream of the last use of the block
+   */
+  void release(descriptor_block* block, cudaStream_t stream);
+
+ private:
+  static constexpr int min_size_class = 10;  // log2(min_block_size)
+  static constexpr int max_size_class = 16;  // log2(max_block_size)
+
+  void free_block(descriptor_block* block);
+
+  std::mutex _mutex;
+  std::vector<descriptor_block*> _free_blocks[max_size_class - min_size_class + 1];
+};
+
+}  // namespace detail
+}  // namespace cudf
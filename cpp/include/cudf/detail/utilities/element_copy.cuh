@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Copies an element of a fixed-width column whose type is only known by
+ * its size
+ *
+ * Kernels processing many columns of different types at once use it instead of
+ * dispatching on the type of each column.
+ *
+ * @param input The elements of the input column
+ * @param input_index The index of the element in `input`
+ * @param output The elements of the output column
+ * @param output_index The index of the element in `output`
+ * @param size The size in bytes of an element
+ */
+__device__ inline void copy_element(
+  void const* input, size_type input_index, void* output, size_type output_index, size_type size) {
+  switch (size) {
+    case 1:
+      static_cast<int8_t*>(output)[output_index] = static_cast<int8_t const*>(input)[input_index];
+      break;
+    case 2:
+      static_cast<int16_t*>(output)[output_index] = static_cast<int16_t const*>(input)[input_index];
+      break;
+    case 4:
+      static_cast<int32_t*>(output)[output_index] = static_cast<int32_t const*>(input)[input_index];
+      break;
+    case 8:
+      static_cast<int64_t*>(output)[output_index] = static_cast<int64_t const*>(input)[input_index];
+      break;
+    default:
+      for (size_type byte = 0; byte < size; ++byte) {
+        static_cast<char*>(output)[output_index * size + byte] =
+          static_cast<char const*>(input)[input_index * size + byte];
+      }
+  }
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
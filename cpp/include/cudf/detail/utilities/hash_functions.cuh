@@ -36,6 +36,8 @@ struct MurmurHash3_32 {
 
   CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32() : m_seed(0) {}
 
+  CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
   CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const {
     return (x << r) | (x >> (32 - r));
   }
@@ -72,6 +74,55 @@ struct MurmurHash3_32 {
 
   result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
 
+  /**
+   * @brief Mixes the block `k1` into the hash value `h1`
+   */
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_block(uint32_t h1, uint32_t k1) const {
+    constexpr uint32_t c1 = 0xcc9e2d51;
+    constexpr uint32_t c2 = 0x1b873593;
+    k1 *= c1;
+    k1 = rotl32(k1, 15);
+    k1 *= c2;
+    h1 ^= k1;
+    h1 = rotl32(h1, 13);
+    return h1 * 5 + 0xe6546b64;
+  }
+
+  /**
+   * @brief Mixes the last `len & 3` bytes of `data` into `h1` and finalizes
+   * the hash value of the `len` bytes
+   */
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_tail(uint32_t h1, uint8_t const* data, int len) const {
+    constexpr uint32_t c1 = 0xcc9e2d51;
+    constexpr uint32_t c2 = 0x1b873593;
+    const uint8_t* tail   = data + (len & ~3);
+    uint32_t k1           = 0;
+    switch (len & 3) {
+      case 3: k1 ^= tail[2] << 16;
+      case 2: k1 ^= tail[1] << 8;
+      case 1:
+        k1 ^= tail[0];
+        k1 *= c1;
+        k1 = rotl32(k1, 15);
+        k1 *= c2;
+        h1 ^= k1;
+    };
+    h1 ^= len;
+    return fmix32(h1);
+  }
+
+  /**
+   * @brief Returns the `i`-th 4-byte block of the bytes starting `shift` bits
+   * into the aligned words `words`
+   *
+   * Reads aligned words only: an unaligned block is shifted out of the two
+   * words it straddles. The second word is only read when `shift` is not 0,
+   * in which case it holds a byte of the block.
+   */
+  __device__ static uint32_t load_block(uint32_t const* words, int i, uint32_t shift) {
+    return shift == 0 ? words[i] : __funnelshift_r(words[i], words[i + 1], shift);
+  }
+
   // compute wrapper for floating point types
   template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
   hash_value_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const {
@@ -91,40 +142,14 @@ struct MurmurHash3_32 {
     const uint8_t* const data = (const uint8_t*)&key;
     constexpr int nblocks     = len / 4;
 
-    uint32_t h1           = m_seed;
-    constexpr uint32_t c1 = 0xcc9e2d51;
-    constexpr uint32_t c2 = 0x1b873593;
+    uint32_t h1 = m_seed;
     //----------
     // body
-    const uint32_t* const blocks = (const uint32_t*)(data + nblocks * 4);
-    for (int i = -nblocks; i; i++) {
-      uint32_t k1 = blocks[i];  //getblock32(blocks,i);
-      k1 *= c1;
-      k1 = rotl32(k1, 15);
-      k1 *= c2;
-      h1 ^= k1;
-      h1 = rotl32(h1, 13);
-      h1 = h1 * 5 + 0xe6546b64;
-    }
+    const uint32_t* const blocks = (const uint32_t*)data;
+    for (int i = 0; i < nblocks; i++) { h1 = mix_block(h1, blocks[i]); }
     //----------
-    // tail
-    const uint8_t* tail = (const uint8_t*)(data + nblocks * 4);
-    uint32_t k1         = 0;
-    switch (len & 3) {
-      case 3: k1 ^= tail[2] << 16;
-      case 2: k1 ^= tail[1] << 8;
-      case 1:
-        k1 ^= tail[0];
-        k1 *= c1;
-        k1 = rotl32(k1, 15);
-        k1 *= c2;
-        h1 ^= k1;
-    };
-    //----------
-    // finalization
-    h1 ^= len;
-    h1 = fmix32(h1);
-    return h1;
+    // tail and finalization
+    return mix_tail(h1, data, len);
   }
 
  private:
@@ -144,57 +169,87 @@ hash_value_type CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32<bool>::operator()(bool
 
 /**
  * @brief Specialization of MurmurHash3_32 operator for strings.
+ *
+ * The blocks are read as aligned 4-byte words, shifted into place when the
+ * string does not start on a word boundary; only the tail is read bytewise.
  */
 template <>
 hash_value_type CUDA_HOST_DEVICE_CALLABLE
 MurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) const {
-  const int len         = (int)key.size_bytes();
-  const uint8_t* data   = (const uint8_t*)key.data();
-  const int nblocks     = len / 4;
-  result_type h1        = m_seed;
-  constexpr uint32_t c1 = 0xcc9e2d51;
-  constexpr uint32_t c2 = 0x1b873593;
-  auto getblock32       = [] __host__ __device__(const uint32_t* p, int i) -> uint32_t {
-  // Individual byte reads for unaligned accesses (very likely)
 #ifndef __CUDA_ARCH__
-    CUDF_FAIL("Hashing a string in host code is not supported.");
+  CUDF_FAIL("Hashing a string in host code is not supported.");
 #else
-    auto q = (const uint8_t*)(p + i);
-    return q[0] | (q[1] << 8) | (q[2] << 16) | (q[3] << 24);
-#endif
-  };
-
+  const int len       = (int)key.size_bytes();
+  const uint8_t* data = (const uint8_t*)key.data();
+  const int nblocks   = len / 4;
+  result_type h1      = m_seed;
+
+  auto const misalignment = reinterpret_cast<uintptr_t>(data) & 3;
+  auto const words        = reinterpret_cast<const uint32_t*>(data - misalignment);
+  auto const shift        = static_cast<uint32_t>(misalignment * 8);
   //----------
   // body
-  const uint32_t* const blocks = (const uint32_t*)(data + nblocks * 4);
-  for (int i = -nblocks; i; i++) {
-    uint32_t k1 = getblock32(blocks, i);
-    k1 *= c1;
-    k1 = rotl32(k1, 15);
-    k1 *= c2;
-    h1 ^= k1;
-    h1 = rotl32(h1, 13);
-    h1 = h1 * 5 + 0xe6546b64;
+  if (shift == 0) {
+    for (int i = 0; i < nblocks; i++) { h1 = mix_block(h1, words[i]); }
+  } else {
+    // Carry the upper word of a block into the next one: one load per block
+    uint32_t lower = nblocks > 0 ? words[0] : 0;
+    for (int i = 0; i < nblocks; i++) {
+      uint32_t const upper = words[i + 1];
+      h1                   = mix_block(h1, __funnelshift_r(lower, upper, shift));
+      lower                = upper;
+    }
   }
   //----------
-  // tail
-  const uint8_t* tail = (const uint8_t*)(data + nblocks * 4);
-  uint32_t k1         = 0;
-  switch (len & 3) {
-    case 3: k1 ^= tail[2] << 16;
-    case 2: k1 ^= tail[1] << 8;
-    case 1:
-      k1 ^= tail[0];
+  // tail and finalization
+  return mix_tail(h1, data, len);
+#endif
+}
+
+/**
+ * @brief Computes `MurmurHash3_32<cudf::string_view>{seed}(key)` with the 32
+ * threads of a warp
+ *
+ * All the lanes of the warp must call this function with the same `key` and
+ * `seed`, and all of them return the hash value. Each lane loads and mixes one
+ * of every 32 consecutive blocks, so that the warp reads a long string in
+ * coalesced 128-byte segments instead of one thread waiting on every load; the
+ * blocks are then folded into the hash value in their order.
+ */
+__device__ inline hash_value_type murmur_hash3_32_warp(cudf::string_view const& key,
+                                                       uint32_t seed) {
+  constexpr int warp_size = 32;
+  constexpr uint32_t c1   = 0xcc9e2d51;
+  constexpr uint32_t c2   = 0x1b873593;
+  MurmurHash3_32<cudf::string_view> const hasher{seed};
+  auto const lane     = static_cast<int>(threadIdx.x % warp_size);
+  const int len       = (int)key.size_bytes();
+  const uint8_t* data = (const uint8_t*)key.data();
+  const int nblocks   = len / 4;
+
+  auto const misalignment = reinterpret_cast<uintptr_t>(data) & 3;
+  auto const words        = reinterpret_cast<const uint32_t*>(data - misalignment);
+  auto const shift        = static_cast<uint32_t>(misalignment * 8);
+
+  uint32_t h1 = seed;
+  for (int first = 0; first < nblocks; first += warp_size) {
+    // The multiplications and rotation of a block do not depend on the hash
+    // value, so every lane premixes its own block
+    uint32_t k1 = 0;
+    if (first + lane < nblocks) {
+      k1 = MurmurHash3_32<cudf::string_view>::load_block(words, first + lane, shift);
       k1 *= c1;
-      k1 = rotl32(k1, 15);
+      k1 = hasher.rotl32(k1, 15);
       k1 *= c2;
-      h1 ^= k1;
-  };
-  //----------
-  // finalization
-  h1 ^= len;
-  h1 = fmix32(h1);
-  return h1;
+    }
+    int const count = min(warp_size, nblocks - first);
+    for (int j = 0; j < count; j++) {
+      h1 ^= __shfl_sync(0xffffffff, k1, j);
+      h1 = hasher.rotl32(h1, 13);
+      h1 = h1 * 5 + 0xe6546b64;
+    }
+  }
+  return hasher.mix_tail(h1, data, len);
 }
 
 template <>
@@ -209,6 +264,260 @@ MurmurHash3_32<double>::operator()(double const& key) const {
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief MurmurHash3_32 as computed by Spark's `hash` expression and by the
+ * hash partitioning and bucketing of Spark
+ *
+ * Booleans and 8 and 16-bit integers are hashed as 32-bit integers. NaNs hash
+ * as the canonical NaN, but `-0.0` and `0.0` hash differently. Each byte of the
+ * tail of a string is mixed as a sign-extended block of its own.
+ */
+template <typename Key>
+struct SparkMurmurHash3_32 {
+  using argument_type = Key;
+  using result_type   = hash_value_type;
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE SparkMurmurHash3_32(uint32_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const {
+    return (x << r) | (x >> (32 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t fmix32(uint32_t h) const {
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_k1(uint32_t k1) const {
+    k1 *= 0xcc9e2d51;
+    k1 = rotl32(k1, 15);
+    return k1 * 0x1b873593;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t mix_h1(uint32_t h1, uint32_t k1) const {
+    h1 ^= k1;
+    h1 = rotl32(h1, 13);
+    return h1 * 5 + 0xe6546b64;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const {
+    if (isnan(key)) { return compute(std::numeric_limits<T>::quiet_NaN()); }
+    return compute(key);
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  /**
+   * @brief Hashes `len` bytes, read one at a time so that `data` need not be
+   * aligned
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, int len) const {
+    uint32_t h1       = m_seed;
+    int const nblocks = len / 4;
+    for (int i = 0; i < nblocks; i++) {
+      uint8_t const* q = data + i * 4;
+      uint32_t const k1 =
+        q[0] | (q[1] << 8) | (q[2] << 16) | (static_cast<uint32_t>(q[3]) << 24);
+      h1 = mix_h1(h1, mix_k1(k1));
+    }
+    for (int i = nblocks * 4; i < len; i++) {
+      h1 = mix_h1(h1, mix_k1(static_cast<int32_t>(static_cast<int8_t>(data[i]))));
+    }
+    return fmix32(h1 ^ len);
+  }
+
+ private:
+  uint32_t m_seed;
+};
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<bool>::operator()(bool const& key) const {
+  return this->compute(int32_t{key ? 1 : 0});
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<int8_t>::operator()(int8_t const& key) const {
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<int16_t>::operator()(int16_t const& key) const {
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<float>::operator()(float const& key) const {
+  return this->compute_floating_point(key);
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<double>::operator()(double const& key) const {
+  return this->compute_floating_point(key);
+}
+
+template <>
+hash_value_type CUDA_HOST_DEVICE_CALLABLE
+SparkMurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) const {
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+/**
+ * @brief xxHash64 implementation from https://github.com/Cyan4973/xxHash
+ *
+ * Hashes the values as Spark's `xxhash64` expression does: booleans and 8 and
+ * 16-bit integers are hashed as 32-bit integers, and NaNs hash as the
+ * canonical NaN. Faster than `MurmurHash3_32` on long strings, which it
+ * consumes 32 bytes at a time.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87ull;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9ull;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ull;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ull;
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64() : m_seed(0) {}
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int r) const {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t load64(uint8_t const* p) const {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) { v = (v << 8) | p[i]; }
+    return v;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t load32(uint8_t const* p) const {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint64_t>(p[3]) << 24);
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t xxh_round(uint64_t acc, uint64_t input) const {
+    return rotl64(acc + input * prime2, 31) * prime1;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t xxh_merge_round(uint64_t acc, uint64_t val) const {
+    return (acc ^ xxh_round(0, val)) * prime1 + prime4;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const {
+    if (isnan(key)) { return compute(std::numeric_limits<T>::quiet_NaN()); }
+    return compute(key);
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  /**
+   * @brief Hashes `len` bytes, read one at a time so that `data` need not be
+   * aligned
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, size_t len) const {
+    uint8_t const* p   = data;
+    uint8_t const* end = data + len;
+    uint64_t h;
+
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; p + 32 <= end; p += 32) {
+        v1 = xxh_round(v1, load64(p));
+        v2 = xxh_round(v2, load64(p + 8));
+        v3 = xxh_round(v3, load64(p + 16));
+        v4 = xxh_round(v4, load64(p + 24));
+      }
+      h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h = xxh_merge_round(h, v1);
+      h = xxh_merge_round(h, v2);
+      h = xxh_merge_round(h, v3);
+      h = xxh_merge_round(h, v4);
+    } else {
+      h = m_seed + prime5;
+    }
+    h += len;
+
+    for (; p + 8 <= end; p += 8) {
+      h = rotl64(h ^ xxh_round(0, load64(p)), 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+      h = rotl64(h ^ (load32(p) * prime1), 23) * prime2 + prime3;
+      p += 4;
+    }
+    for (; p < end; p++) { h = rotl64(h ^ (*p * prime5), 11) * prime1; }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+ private:
+  uint64_t m_seed;
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const {
+  return this->compute(int32_t{key ? 1 : 0});
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<int8_t>::operator()(int8_t const& key) const {
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<int16_t>::operator()(int16_t const& key) const {
+  return this->compute(static_cast<int32_t>(key));
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const {
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const {
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const {
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
 /* --------------------------------------------------------------------------*/
 /** 
  * @brief  This hash function simply returns the value that is asked to be hash
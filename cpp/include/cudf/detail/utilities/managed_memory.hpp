@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/managed_memory.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Prefetches memory to the current device if it is managed memory and
+ * prefetching is enabled
+ *
+ * Prefetching is a hint: failures are ignored.
+ *
+ * @param ptr The memory to prefetch; may be any pointer, or nullptr
+ * @param size The number of bytes to prefetch
+ * @param stream The stream of the kernels that will access the memory
+ */
+void prefetch_to_device(void const* ptr, std::size_t size, cudaStream_t stream);
+
+/**
+ * @brief Prefetches the data and null masks of a column and of its children
+ * to the current device, as `prefetch_to_device(ptr, size, stream)`
+ *
+ * Only the elements in the view are prefetched from fixed-width columns.
+ */
+void prefetch_to_device(column_view const& col, cudaStream_t stream);
+
+/**
+ * @copydoc prefetch_to_device(column_view const&, cudaStream_t)
+ */
+void prefetch_to_device(table_view const& table, cudaStream_t stream);
+
+/**
+ * @copydoc prefetch_to_device(column_view const&, cudaStream_t)
+ */
+void prefetch_to_device(std::vector<column_view> const& columns, cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/memory_budget.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns the number of bytes of device memory the algorithms may
+ * allocate: the installed budget's `available_bytes()`, or the free device
+ * memory if there is no budget
+ */
+std::size_t available_device_memory();
+
+/**
+ * @brief Checks whether `bytes` fit in the memory budget, asking the budget to
+ * spill until they do
+ *
+ * Without an installed budget, every request fits.
+ *
+ * @param bytes The number of bytes about to be allocated
+ * @return true if the allocation fits in the budget
+ */
+bool fits_memory_budget(std::size_t bytes);
+
+}  // namespace detail
+}  // namespace cudf
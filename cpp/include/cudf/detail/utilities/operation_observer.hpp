@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/operation_observer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Measures a call for the installed `operation_observer`, from the
+ * construction of the scope to its destruction
+ *
+ * Does nothing but query the observer when none is installed. Constructed by
+ * `CUDF_FUNC_RANGE()` and `CUDF_PHASE_RANGE()`.
+ */
+class operation_scope {
+ public:
+  explicit operation_scope(char const* name, operation_kind kind = operation_kind::FUNCTION)
+    : _observer{get_operation_observer()} {
+    if (_observer != nullptr) { begin(name, kind); }
+  }
+  operation_scope(operation_scope const&) = delete;
+  operation_scope& operator=(operation_scope const&) = delete;
+  ~operation_scope() {
+    if (_observer != nullptr) { end(); }
+  }
+
+ private:
+  void begin(char const* name, operation_kind kind);
+  void end() noexcept;
+
+  operation_observer* const _observer;
+  char const* _name;
+  operation_kind _kind;
+  int _depth;
+  std::chrono::steady_clock::time_point _start_time;
+  cudaEvent_t _start_event = nullptr;
+  std::size_t _start_bytes;
+  std::size_t _start_allocations;
+  int64_t _start_current;  ///< Bytes allocated by the thread and not freed at the start
+  int64_t _outer_peak;     ///< Peak of the enclosing scope before this one
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Bump allocator for the temporaries of detail algorithms
+ *
+ * Memory is handed out from large blocks allocated from the upstream
+ * resource. Deallocating is a no-op: the memory is reclaimed all at once when
+ * the `scratch_scope` that allocated it exits, and the blocks are kept for
+ * the scopes nested in the same outermost scope, so a sequence of small calls
+ * does not allocate and free device memory for each of its temporaries. The
+ * blocks are returned to the upstream resource when the arena is destroyed.
+ *
+ * Each host thread has its own arena while a `scratch_scope` is active.
+ */
+class scratch_arena final : public rmm::mr::device_memory_resource {
+ public:
+  static constexpr size_t alignment          = 256;
+  static constexpr size_t min_block_size     = 1024 * 1024;
+  static constexpr size_t max_retained_bytes = 64 * 1024 * 1024;
+
+  /**
+   * @brief Position of the next allocation, to release the allocations made
+   * after it
+   */
+  struct marker {
+    size_t block;
+    size_t offset;
+  };
+
+  explicit scratch_arena(rmm::mr::device_memory_resource* upstream) : _upstream{upstream} {}
+  scratch_arena(scratch_arena const&) = delete;
+  scratch_arena& operator=(scratch_arena const&) = delete;
+  ~scratch_arena() override;
+
+  rmm::mr::device_memory_resource* upstream() const noexcept { return _upstream; }
+
+  marker mark() const noexcept { return {_current, _offset}; }
+
+  /**
+   * @brief Makes the memory allocated after `position` available again
+   *
+   * When everything is released, the blocks are merged into one on the next
+   * allocation, or freed if they hold more than `max_retained_bytes`.
+   *
+   * @param position Value of `mark()` before the allocations to release
+   * @param stream Stream on which the released memory was last used
+   */
+  void release(marker position, cudaStream_t stream);
+
+  bool supports_streams() const noexcept override { return true; }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override {}
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override {
+    return std::make_pair(0, 0);
+  }
+
+  void free_blocks(cudaStream_t stream);
+
+  rmm::mr::device_memory_resource* const _upstream;
+  std::vector<std::pair<void*, size_t>> _blocks;  ///< Pointer and size of each block
+  size_t _current     = 0;                        ///< Index of the block in use
+  size_t _offset      = 0;                        ///< Bytes used in the current block
+  size_t _merged_size = 0;                        ///< Size of the block merging the freed ones
+  cudaStream_t _stream = 0;                       ///< Stream the memory was last used on
+};
+
+/**
+ * @brief Scope of the temporaries of a detail algorithm
+ *
+ * `resource()` allocates from the calling thread's `scratch_arena`, and all
+ * those allocations are released when the scope exits. Only memory that does
+ * not outlive the scope may be allocated from it; the outputs must still be
+ * allocated from the caller's `mr`.
+ *
+ * Scopes may be nested. A scope on a different stream than the enclosing one
+ * synchronizes its stream at exit, so that the enclosing scope may reuse the
+ * memory. The outermost scope allocates its arena from the current default
+ * resource and frees it at exit, so the memory is never cached across a
+ * change of the default resource.
+ *
+ * Example:
+ * ```
+ * scratch_scope scratch(stream);
+ * auto order = sorted_order(keys, {}, {}, scratch.resource(), stream);
+ * return gather(values, order->view(), false, false, false, mr, stream);
+ * ```
+ */
+class scratch_scope {
+ public:
+  explicit scratch_scope(cudaStream_t stream = 0);
+  scratch_scope(scratch_scope const&) = delete;
+  scratch_scope& operator=(scratch_scope const&) = delete;
+  ~scratch_scope();
+
+  rmm::mr::device_memory_resource* resource() const noexcept { return _arena; }
+
+ private:
+  scratch_arena* _arena;
+  scratch_arena::marker _position;
+  cudaStream_t _stream;
+  cudaStream_t _previous_stream;
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Returns the first 8 bytes of the strings of `col`, zero padded, as
+ * big-endian keys whose unsigned order agrees with the order of
+ * `row_lexicographic_comparator` on `col`
+ *
+ * Strings with the same first 8 bytes get equal keys, as may strings that
+ * differ by trailing zero bytes and nulls, which then need to be compared in
+ * full.
+ */
+struct string_prefix_key_fn {
+  column_device_view col;
+  bool descending;
+  bool nulls_before;
+
+  __device__ uint64_t operator()(size_type row) const {
+    uint64_t key{0};
+    if (col.is_null(row)) {
+      key = nulls_before ? uint64_t{0} : ~uint64_t{0};
+    } else {
+      auto const str   = col.element<string_view>(row);
+      auto const bytes = reinterpret_cast<unsigned char const*>(str.data());
+      auto const size  = min(str.size_bytes(), size_type{8});
+      for (size_type i = 0; i < size; ++i) { key |= uint64_t{bytes[i]} << (56 - 8 * i); }
+    }
+    return descending ? ~key : key;
+  }
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
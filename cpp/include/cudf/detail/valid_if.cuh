@@ -41,7 +41,8 @@ namespace detail {
  * @param[in] begin The begining of the sequence of elements
  * @param[in] size The number of elements
  * @param[in] p The predicate to apply to each element
- * @param[out] valid_count The count of set bits in the output bitmask
+ * @param[out] valid_count The count of set bits in the output bitmask, or
+ * `nullptr` if the count is not needed
  */
 template <size_type block_size, typename InputIterator, typename Predicate>
 __global__ void valid_if_kernel(
@@ -62,10 +63,23 @@ __global__ void valid_if_kernel(
     active_mask = __ballot_sync(active_mask, i < size);
   }
 
+  if (valid_count == nullptr) { return; }
   size_type block_count = single_lane_block_sum_reduce<block_size, leader_lane>(warp_valid_count);
   if (threadIdx.x == 0) { atomicAdd(valid_count, block_count); }
 }  // namespace detail
 
+/**
+ * @brief Whether `valid_if` counts the nulls of the new bitmask.
+ *
+ * Counting the nulls makes the host wait for the device. With `DEFER`, the
+ * null count is `UNKNOWN_NULL_COUNT` and is only computed if a column or view
+ * of the bitmask is asked for its `null_count()`.
+ */
+enum class null_count_policy : bool {
+  COMPUTE,  ///< Count the nulls before returning
+  DEFER     ///< Return `UNKNOWN_NULL_COUNT`
+};
+
 /**
  * @brief Generate a bitmask where every bit is set for which a predicate is
  * `true` over the elements in `[begin,end)`.
@@ -81,6 +95,8 @@ __global__ void valid_if_kernel(
  * @param p The predicate
  * @param stream Stream on which to execute all GPU activity and device memory
  * allocations.
+ * @param mr Memory resource used to allocate the bitmask
+ * @param policy Whether to count the nulls or return `UNKNOWN_NULL_COUNT`
  * @return A pair containing a `device_buffer` with the new bitmask and it's
  * null count
  */
@@ -90,7 +106,8 @@ std::pair<rmm::device_buffer, size_type> valid_if(
   InputIterator end,
   Predicate p,
   cudaStream_t stream                 = 0,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) {
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  null_count_policy policy            = null_count_policy::COMPUTE) {
   CUDF_EXPECTS(begin <= end, "Invalid range.");
 
   size_type size = thrust::distance(begin, end);
@@ -99,14 +116,21 @@ std::pair<rmm::device_buffer, size_type> valid_if(
 
   size_type null_count{0};
   if (size > 0) {
-    rmm::device_scalar<size_type> valid_count{0, stream, mr};
-
     constexpr size_type block_size{256};
     grid_1d grid{size, block_size};
 
+    if (policy == null_count_policy::DEFER) {
+      valid_if_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+        static_cast<bitmask_type*>(null_mask.data()), begin, size, p, nullptr);
+      return std::make_pair(std::move(null_mask), UNKNOWN_NULL_COUNT);
+    }
+
+    rmm::device_scalar<size_type> valid_count{0, stream, mr};
+
     valid_if_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
       static_cast<bitmask_type*>(null_mask.data()), begin, size, p, valid_count.data());
 
+    CUDF_SYNC_POINT();
     null_count = size - valid_count.value(stream);
   }
   return std::make_pair(std::move(null_mask), null_count);
@@ -80,6 +80,37 @@ std::unique_ptr<column> set_keys(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns an INT32 column of ordinals that compare like the values of
+ * `dictionary_column` compared with the values of a dictionary with `keys`.
+ *
+ * Row `i` is `2*p+1` if its value is `keys[p]`, or `2*p` if its value is not in
+ * `keys` and `p` keys are less than it. So the ordinals of two dictionaries
+ * computed with the same `keys` are equal exactly when their values are equal,
+ * and order like their values, even if the dictionaries have different keys.
+ * Null rows are null.
+ *
+ * ```
+ * d1 = {["a", "c"], [1, 0, null]}
+ * r1 = keys_ordinals(d1, ["a", "c"]) is [3, 1, null]
+ * d2 = {["b", "c"], [0, 1]}
+ * r2 = keys_ordinals(d2, ["a", "c"]) is [2, 3]
+ * ```
+ *
+ * @throw cudf_logic_error if the keys types do not match.
+ *
+ * @param dictionary_column Existing dictionary column.
+ * @param keys Sorted keys without nulls to compare the values with.
+ * @param mr Resource for allocating memory for the output.
+ * @param stream CUDA Stream on which to execute kernels
+ * @return New INT32 column of ordinals
+ */
+std::unique_ptr<column> keys_ordinals(
+  dictionary_column_view const& dictionary_column,
+  column_view const& keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -154,13 +155,15 @@ class groupby {
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
    * @param mr Memory resource used to allocate the returned table and columns
+   * @param stream CUDA stream on which to execute kernels and memory copies
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
    * specified in `requests`.
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     std::vector<aggregation_request> const& requests,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
 
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
@@ -190,6 +193,22 @@ class groupby {
   groups get_groups(cudf::table_view values             = {},
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Get the sort helper object
+   *
+   * The object is constructed on first invocation and subsequent invocations
+   * of this function return the memoized object. It computes the sort order,
+   * group offsets and group labels of the keys once and keeps them for the
+   * lifetime of this `groupby`.
+   *
+   * Once the helper exists, every `aggregate` call uses the sort-based
+   * implementation on the memoized grouping instead of hashing the keys
+   * again, whatever the values of the call. The `grouped_rolling_window`
+   * overloads that take a `groupby` use it as well, so window aggregations
+   * over the same keys do not sort them again.
+   */
+  detail::sort::sort_groupby_helper& helper();
+
  private:
   table_view _keys;                                     ///< Keys that determine grouping
   include_nulls _include_null_keys{include_nulls::NO};  ///< Include rows in keys
@@ -203,14 +222,6 @@ class groupby {
   std::unique_ptr<detail::sort::sort_groupby_helper> _helper;  ///< Helper object
     ///< used by sort based implementation
 
-  /**
-   * @brief Get the sort helper object
-   * 
-   * The object is constructed on first invocation and subsequent invocations
-   * of this function return the memoized object.
-   */
-  detail::sort::sort_groupby_helper& helper();
-
   /**
    * @brief Dispatches to the appropriate implementation to satisfy the
    * aggregation requests.
@@ -226,6 +237,141 @@ class groupby {
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Groups values by keys and computes aggregations over a sequence of
+ * table chunks.
+ *
+ * Each call to `aggregate` groups a chunk of keys and values and combines
+ * the chunk's partial aggregation results with those of the previous chunks.
+ * Only the partial results, i.e., one row per unique key, are kept in device
+ * memory, so data larger than device memory can be aggregated chunk by chunk.
+ * Partial results computed by separate `streaming_groupby` objects, e.g., on
+ * different devices, can be combined with `merge`. `finalize` computes the
+ * requested aggregations from the partial results.
+ *
+ * The supported aggregations are SUM, COUNT_VALID, COUNT_ALL, MIN and MAX,
+ * and MEAN, VARIANCE and STD of numeric values. Variances are merged from the
+ * count, mean and sum of squared deviations (M2) of each group, which is
+ * numerically stable.
+ *
+ * Example:
+ * ```
+ * streaming_groupby gb(std::move(aggregations));
+ * for (auto const& chunk : chunks) {
+ *   gb.aggregate(chunk.select(key_indices), chunk.select(value_indices));
+ * }
+ * auto result = gb.finalize();
+ * ```
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby() = delete;
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&) = delete;
+  streaming_groupby(streaming_groupby&&)      = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&) = delete;
+
+  /**
+   * @brief Construct a streaming groupby computing `aggregations`
+   *
+   * @throws cudf::logic_error if any aggregation is not supported
+   *
+   * @param aggregations For each column of the values of the chunks, the
+   * aggregations to compute on it
+   * @param include_null_keys Indicates whether rows in the keys that contain
+   * NULL values should be included
+   */
+  explicit streaming_groupby(std::vector<std::vector<std::unique_ptr<aggregation>>>&& aggregations,
+                             include_nulls include_null_keys = include_nulls::NO);
+
+  /**
+   * @brief Aggregates a chunk of rows into the partial results
+   *
+   * @throws cudf::logic_error if `keys.num_rows() != values.num_rows()`
+   * @throws cudf::logic_error if `values` does not have one column per vector
+   * of aggregations given to the constructor
+   * @throws cudf::logic_error if MEAN, VARIANCE or STD is requested on
+   * non-numeric values
+   * @throws cudf::logic_error if the column types differ from those of
+   * previous chunks
+   *
+   * @param keys Table whose rows act as the groupby keys of the chunk
+   * @param values The columns of values to aggregate
+   * @param mr Memory resource used to allocate the partial results
+   */
+  void aggregate(table_view const& keys,
+                 table_view const& values,
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Combines the partial results of `other` into this object's
+   *
+   * @throws cudf::logic_error if `other` computes different aggregations or
+   * aggregated columns of different types
+   *
+   * @param other The streaming groupby whose partial results are merged
+   * @param mr Memory resource used to allocate the partial results
+   */
+  void merge(streaming_groupby const& other,
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Combines partial results obtained from `partial_results()` of a
+   * streaming groupby computing the same aggregations, e.g., one on another
+   * device, into this object's
+   *
+   * @throws cudf::logic_error if the columns of `partial_results` do not
+   * match this object's partial results
+   *
+   * @param partial_results The partial results to merge
+   * @param num_key_columns The number of key columns in `partial_results`
+   * @param mr Memory resource used to allocate the partial results
+   */
+  void merge(table_view const& partial_results,
+             size_type num_key_columns,
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns a view of the partial results
+   *
+   * The first columns are the unique keys, followed by the columns of partial
+   * results of each column of values. The view is empty until a chunk is
+   * aggregated or partial results are merged.
+   */
+  table_view partial_results() const;
+
+  /**
+   * @brief Computes the aggregations from the partial results
+   *
+   * The results have the same layout as those of `groupby::aggregate`, with
+   * one `aggregation_result` per column of values holding the results of its
+   * aggregations in the order they were given to the constructor. COUNT_VALID
+   * and COUNT_ALL results are INT64, as groups may count more rows than fit a
+   * `size_type` across chunks.
+   *
+   * The partial results are left unchanged, so more chunks may be aggregated
+   * afterwards.
+   *
+   * @throws cudf::logic_error if no chunk was aggregated or merged
+   *
+   * @param mr Memory resource used to allocate the returned table and columns
+   * @return Pair containing the table with each group's unique key and a
+   * vector of aggregation_results for each column of values
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  std::vector<std::vector<std::unique_ptr<aggregation>>> _aggregations;  ///< Aggregations of
+                                                                         ///< each value column
+  include_nulls _include_null_keys{include_nulls::NO};  ///< Include rows in keys
+                                                        ///< with NULLs
+  size_type _num_key_columns{0};                        ///< Number of key columns
+  std::unique_ptr<table> _partial_results;              ///< Unique keys followed by
+                                                        ///< the partial results
+};
 }  // namespace groupby
 }  // namespace experimental
 }  // namespace cudf
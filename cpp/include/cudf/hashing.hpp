@@ -34,4 +34,31 @@ std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the hash value of each row in the input set of columns with
+ * the given hash function.
+ *
+ * `HASH_MURMUR3` hashes each element with `seed` and combines the hash values
+ * of a row as `hash(input)` does; with a `seed` of 0 the two are identical.
+ * `HASH_SPARK_MURMUR3` and `HASH_XXHASH64` hash the first column of a row with
+ * `seed` and each next column with the hash value of the columns before it,
+ * skipping null elements, and return the values of Spark's `hash` and
+ * `xxhash64` expressions over the same columns when `seed` is 42.
+ *
+ * @throw cudf::logic_error if `seed` does not fit in 32 bits and
+ * `hash_function` is not `HASH_XXHASH64`
+ *
+ * @param input The table of columns to hash
+ * @param hash_function The hash function to use
+ * @param seed Seed of the hash function
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns A column where each row is the hash of a row from the input: INT64
+ * for `HASH_XXHASH64`, INT32 otherwise
+ */
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             uint64_t seed                       = 0,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace cudf
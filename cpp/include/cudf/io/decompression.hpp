@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file decompression.hpp
+ * @brief cuDF-IO batched GPU decompression API
+ */
+
+#pragma once
+
+#include "types.hpp"
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+//! cuDF interfaces
+namespace cudf {
+//! In-development features
+namespace experimental {
+//! IO interfaces
+namespace io {
+
+/**
+ * @brief Compressed input buffer and its decompression destination, both in
+ * device memory
+ */
+struct device_decompress_input {
+  const void* src;    ///< Compressed data
+  uint64_t src_size;  ///< Size in bytes of the compressed data
+  void* dst;          ///< Destination of the decompressed data
+  uint64_t dst_size;  ///< Size in bytes of the destination buffer
+};
+
+/**
+ * @brief Result of decompressing a single input buffer
+ */
+struct device_decompress_status {
+  uint64_t bytes_written;  ///< Number of bytes written to the destination buffer
+  uint32_t status;         ///< Zero on success, non-zero if the input could not be decompressed
+  uint32_t reserved;
+};
+
+/**
+ * @brief Returns the size of the temporary device memory required by
+ * `batched_decompress()`
+ *
+ * @param type Compression format of the inputs
+ * @param num_inputs Maximum number of inputs decompressed in one batch
+ *
+ * @return The size in bytes of required temporary memory; may be zero
+ */
+size_t batched_decompress_scratch_size(compression_type type, size_type num_inputs);
+
+/**
+ * @brief Decompresses a batch of independent device buffers on the GPU
+ *
+ * All inputs are decompressed with a single kernel launch. The `inputs` and
+ * `statuses` arrays must be in device memory, so that batches can be built
+ * and inspected on the device without extra copies. Supported formats are
+ * `GZIP`, `SNAPPY`, `BROTLI`, `ZSTD` and `LZ4` (raw or Hadoop-framed blocks).
+ *
+ * @code
+ *  auto scratch_size = batched_decompress_scratch_size(compression_type::SNAPPY, count);
+ *  rmm::device_buffer scratch(scratch_size, stream);
+ *  batched_decompress(compression_type::SNAPPY, d_inputs, d_statuses, count,
+ *                     scratch.data(), scratch.size(), stream);
+ * @endcode
+ *
+ * @param type Compression format of the inputs
+ * @param inputs Device array of `num_inputs` input descriptors
+ * @param statuses Device array of `num_inputs` output statuses
+ * @param num_inputs Number of inputs to decompress
+ * @param scratch Temporary device memory, of at least
+ * `batched_decompress_scratch_size(type, num_inputs)` bytes
+ * @param scratch_size Size in bytes of the temporary memory
+ * @param stream Optional stream to use for the decompression kernels
+ *
+ * @throw cudf::logic_error if the compression format is not supported
+ */
+void batched_decompress(compression_type type,
+                        device_decompress_input const* inputs,
+                        device_decompress_status* statuses,
+                        size_type num_inputs,
+                        void* scratch,
+                        size_t scratch_size,
+                        cudaStream_t stream = 0);
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
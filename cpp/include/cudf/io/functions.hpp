@@ -26,6 +26,8 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -104,6 +106,9 @@ struct read_json_args {
 
   ///< Data types of the column; empty to infer dtypes
   std::vector<std::string> dtype;
+  /// Rows to infer the dtypes from; 0 is all rows. Half are the first rows and
+  /// the rest are runs of rows at random positions over the data
+  size_type infer_sample_rows = 0;
   /// Specify the compression format of the source or infer from file extension
   compression_type compression = compression_type::AUTO;
 
@@ -118,6 +123,11 @@ struct read_json_args {
   /// Whether to parse dates as DD/MM versus MM/DD
   bool dayfirst = false;
 
+  /// Names of the columns to read, in output order; empty is all. The fields
+  /// of other columns are skipped without being converted, and `dtype`
+  /// applies to the selected columns only
+  std::vector<std::string> columns;
+
   read_json_args() = default;
 
   explicit read_json_args(const source_info& src) : source(src) {}
@@ -199,6 +209,10 @@ struct read_csv_args {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Rows to infer the types of the other columns from; 0 is all rows. Half
+  /// are the first rows and the rest are runs of rows at random positions
+  /// over the data
+  size_type infer_sample_rows = 0;
   /// Additional values to recognize as boolean true values
   std::vector<std::string> true_values;
   /// Additional values to recognize as boolean false values
@@ -238,6 +252,153 @@ struct read_csv_args {
 table_with_metadata read_csv(read_csv_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads a CSV dataset into a set of columns on a thread of the library's
+ * I/O thread pool
+ *
+ * The host I/O and the stream synchronizations of `read_csv()` happen on the
+ * pool thread, so a single control thread can, e.g., compute on the table of
+ * one file while the next one is read. The read uses the device that is
+ * current on the calling thread. Reads submitted together run concurrently, up
+ * to the number of threads of the pool.
+ *
+ * `args` is copied; a host buffer source must remain valid until the read has
+ * completed.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The future of the set of columns along with metadata; `get()`
+ * rethrows the exceptions of the read
+ */
+std::future<table_with_metadata> read_csv_async(
+  read_csv_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+namespace detail {
+namespace csv {
+class reader;
+};
+};  // namespace detail
+
+/**
+ * @brief Reads a CSV dataset in consecutive byte windows
+ *
+ * Each chunk holds the rows that begin within a window of `chunk_size` bytes;
+ * a row straddling the end of a window is returned with the chunk in which it
+ * begins. The column names and types are determined from the first chunk and
+ * reused for the following ones, so `dtype` should be specified if the first
+ * window is not representative of the whole dataset. The next window is read
+ * into pinned host memory while the current one is being parsed.
+ *
+ * The following code snippet demonstrates how to read a dataset in pieces:
+ * @code
+ *  ...
+ *  cudf::experimental::io::read_csv_args args{cudf::source_info(filepath)};
+ *  cudf::experimental::io::chunked_csv_reader reader(args, 256 << 20);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Constructs the reader.
+   *
+   * The byte range and row selections of `args` are ignored; the source must
+   * not be compressed.
+   *
+   * @param args Settings for controlling reading behavior
+   * @param chunk_size Size of the byte window of each chunk
+   * @param mr Optional resource to use for device memory allocation
+   */
+  chunked_csv_reader(read_csv_args const& args,
+                     size_t chunk_size,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the rows beginning within the next byte window
+   *
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with metadata
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   */
+  table_with_metadata read_chunk(cudaStream_t stream = 0);
+
+ private:
+  std::unique_ptr<detail::csv::reader> _reader;
+  size_t _chunk_size;
+};
+
+/**
+ * @brief Settings to use for `write_csv()`
+ */
+struct write_csv_args {
+  /// Specify the sink to use for writer output
+  sink_info sink;
+  /// Set of columns to output
+  table_view table;
+  /// Optional associated metadata; the column names are used for the header row
+  const table_metadata* metadata = nullptr;
+  /// String to use for null entries
+  std::string na_rep = "";
+  /// Whether to write a header row with the column names
+  bool include_header = true;
+  /// Maximum number of rows to format on the GPU at a time
+  size_type rows_per_chunk = 1 << 20;
+  /// String to use to terminate each row
+  std::string line_terminator = "\n";
+  /// Character to use to separate the columns of a row
+  char delimiter = ',';
+  /// String to use for true values of boolean columns
+  std::string true_value = "true";
+  /// String to use for false values of boolean columns
+  std::string false_value = "false";
+
+  write_csv_args() = default;
+
+  explicit write_csv_args(sink_info const& snk,
+                          table_view const& table_,
+                          const table_metadata* metadata_ = nullptr)
+    : sink(snk), table(table_), metadata(metadata_) {}
+};
+
+/**
+ * @brief Writes a set of columns to CSV format
+ *
+ * Numeric, boolean, timestamp and string columns are supported. The rows are
+ * formatted on the GPU `rows_per_chunk` at a time.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  std::string filepath = "dataset.csv";
+ *  cudf::experimental::io::write_csv_args args{cudf::sink_info(filepath), table->view()};
+ *  ...
+ *  cudf::experimental::io::write_csv(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Optional resource to use for device memory allocation
+ */
+void write_csv(write_csv_args const& args,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_orc()`
  */
@@ -266,12 +427,19 @@ struct read_orc_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
 
-  /// Whether to convert decimals to float64
+  /// Whether to convert decimals to float64; otherwise they are DECIMAL64 columns
   bool decimals_as_float = true;
-  /// For decimals as int, optional forced decimal scale;
+  /// For decimals as DECIMAL64, optional forced decimal scale;
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
 
+  /// Predicates that all rows must satisfy; used to skip stripes based on statistics.
+  /// `skip_rows` and `num_rows` then apply to the rows of the stripes that are not skipped
+  std::vector<column_predicate> filters;
+
+  /// Whether to return string columns as DICTIONARY32, without expanding dictionary-encoded data
+  bool strings_to_dictionary = false;
+
   read_orc_args() = default;
 
   explicit read_orc_args(source_info const& src) : source(src) {}
@@ -298,6 +466,22 @@ struct read_orc_args {
 table_with_metadata read_orc(read_orc_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads an ORC dataset into a set of columns on a thread of the library's
+ * I/O thread pool
+ *
+ * The read runs as `read_orc()`, with the threading of `read_csv_async()`.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The future of the set of columns; `get()` rethrows the exceptions of
+ * the read
+ */
+std::future<table_with_metadata> read_orc_async(
+  read_orc_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `write_orc()`
  */
@@ -308,6 +492,14 @@ struct write_orc_args {
   compression_type compression;
   /// Enable writing column statistics
   bool enable_statistics;
+  /// Maximum uncompressed size of a stripe, in bytes
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; 0 selects a limit based on the column types
+  size_type stripe_size_rows = 0;
+  /// Number of rows between row index entries; must be a multiple of 8
+  size_type row_index_stride = 10000;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
   /// Set of columns to output
   table_view table;
   /// Optional associated metadata
@@ -356,6 +548,14 @@ struct write_orc_chunked_args {
   compression_type compression;
   /// Enable writing column statistics
   bool enable_statistics;
+  /// Maximum uncompressed size of a stripe, in bytes
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; 0 selects a limit based on the column types
+  size_type stripe_size_rows = 0;
+  /// Number of rows between row index entries; must be a multiple of 8
+  size_type row_index_stride = 10000;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
 
@@ -433,7 +633,11 @@ void write_orc_chunked_end(std::shared_ptr<detail::orc::orc_chunked_state>& stat
 struct read_parquet_args {
   source_info source;
 
-  /// Names of column to read; empty is all
+  /// Sources to read, in order, as a single dataset; used instead of `source` if not empty
+  std::vector<source_info> sources;
+
+  /// Names of column to read, or dotted paths of leaves of groups to read as flat columns;
+  /// empty is all
   std::vector<std::string> columns;
 
   /// Row group to read; -1 is all
@@ -449,14 +653,28 @@ struct read_parquet_args {
 
   /// Whether to store string data as categorical type
   bool strings_to_categorical = false;
+  /// Whether to return string columns as DICTIONARY32, without expanding dictionary-encoded data
+  bool strings_to_dictionary = false;
   /// Whether to use PANDAS metadata to load columns
   bool use_pandas_metadata = true;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
+  /// Whether to convert INT32 and INT64 decimals to float64; otherwise they are DECIMAL32 and
+  /// DECIMAL64 columns
+  bool decimals_as_float = true;
+
+  /// Predicates that all rows must satisfy; used to skip row groups based on statistics.
+  /// `skip_rows` and `num_rows` then apply to the rows of the row groups that are not skipped
+  std::vector<column_predicate> filters;
+  /// Whether to drop the rows that don't satisfy the filters. The filter columns are decoded
+  /// first, and the pages of the other columns without any matching row are not decoded
+  bool filter_rows = false;
 
   explicit read_parquet_args() = default;
 
   explicit read_parquet_args(source_info const& src) : source(src) {}
+
+  explicit read_parquet_args(std::vector<source_info> const& srcs) : sources(srcs) {}
 };
 
 /**
@@ -481,6 +699,94 @@ table_with_metadata read_parquet(
   read_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads a Parquet dataset into a set of columns on a thread of the
+ * library's I/O thread pool
+ *
+ * The read runs as `read_parquet()`, with the threading of `read_csv_async()`.
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The future of the set of columns along with metadata; `get()`
+ * rethrows the exceptions of the read
+ */
+std::future<table_with_metadata> read_parquet_async(
+  read_parquet_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Forward declaration of the detail parquet reader class.
+ */
+namespace detail {
+namespace parquet {
+class reader;
+};
+};  // namespace detail
+
+/**
+ * @brief Reads a Parquet dataset in pieces of bounded output size
+ *
+ * Files whose decoded size exceeds the available device memory can be read as
+ * a sequence of tables, each of which holds a consecutive range of rows and an
+ * estimated output size of at most `chunk_read_limit` bytes. Chunks may
+ * split a row group, in which case only the pages overlapping the range are
+ * read if the file has a page index.
+ *
+ * The following code snippet demonstrates how to read a dataset in pieces:
+ * @code
+ *  ...
+ *  cudf::experimental::io::read_parquet_args args{cudf::source_info(filepath)};
+ *  cudf::experimental::io::chunked_parquet_reader reader(args, 1 << 30);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Constructs the reader and plans the row ranges of each chunk.
+   *
+   * The row group and row range selections of `args` are ignored; all the
+   * rows of the dataset that pass the filters are returned.
+   *
+   * @param args Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the decoded output size of each chunk, in bytes
+   * @param mr Optional resource to use for device memory allocation
+   */
+  chunked_parquet_reader(read_parquet_args const& args,
+                         size_t chunk_read_limit,
+                         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const { return _next_chunk < _row_chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk of rows
+   *
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with metadata
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   */
+  table_with_metadata read_chunk(cudaStream_t stream = 0);
+
+ private:
+  std::unique_ptr<detail::parquet::reader> _reader;
+  std::vector<row_group_chunk> _row_chunks;
+  size_t _next_chunk = 0;
+};
+
 /**
  * @brief Settings to use for `write_parquet()`
  */
@@ -499,6 +805,19 @@ struct write_parquet_args {
   bool return_filemetadata = false;
   /// Column chunks file path to be set in the raw output metadata
   std::string metadata_out_file_path;
+  /// Use DELTA encodings for integer and string columns that are not dictionary-encoded
+  bool enable_delta_encoding = false;
+  /// Names of the columns to write Bloom filters for (INT32, INT64, FLOAT, DOUBLE or STRING),
+  /// with leaves of LIST and STRUCT columns named by their dotted path
+  std::vector<std::string> bloom_filter_columns;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
+  /// Maximum uncompressed size of a row group in bytes, 0 for the default of 128MB
+  size_t row_group_size_bytes = 0;
+  /// Maximum number of rows of a row group, 0 for the default of 1M rows
+  size_t row_group_size_rows = 0;
+  /// Target uncompressed size of a data page in bytes, 0 for the default of 512KB
+  size_t max_page_size_bytes = 0;
 
   write_parquet_args() = default;
 
@@ -517,6 +836,9 @@ struct write_parquet_args {
 /**
  * @brief Writes a set of columns to parquet format
  *
+ * LIST and STRUCT columns are written as nested groups, lists following the
+ * standard 3-level layout. Only a single level of lists is supported.
+ *
  * The following code snippet demonstrates how to write columns to a file:
  * @code
  *  #include <cudf.h>
@@ -559,6 +881,19 @@ struct write_parquet_chunked_args {
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
+  /// Use DELTA encodings for integer and string columns that are not dictionary-encoded
+  bool enable_delta_encoding = false;
+  /// Names of the columns to write Bloom filters for (INT32, INT64, FLOAT, DOUBLE or STRING),
+  /// with leaves of LIST and STRUCT columns named by their dotted path
+  std::vector<std::string> bloom_filter_columns;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
+  /// Maximum uncompressed size of a row group in bytes, 0 for the default of 128MB
+  size_t row_group_size_bytes = 0;
+  /// Maximum number of rows of a row group, 0 for the default of 1M rows
+  size_t row_group_size_rows = 0;
+  /// Target uncompressed size of a data page in bytes, 0 for the default of 512KB
+  size_t max_page_size_bytes = 0;
 
   write_parquet_chunked_args() = default;
 
@@ -631,6 +966,205 @@ void write_parquet_chunked(table_view const& table,
  */
 void write_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_state>& state);
 
+/**
+ * @brief Settings to use for `partitioned_parquet_writer`
+ */
+struct write_partitioned_parquet_args {
+  /// Root directory of the dataset
+  std::string base_path;
+  /// Indices of the columns whose values determine the partition of each row
+  std::vector<size_type> partition_columns;
+  /// Specify the compression format to use
+  compression_type compression = compression_type::AUTO;
+  /// Specify the level of statistics in the output files
+  statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Optional metadata of the input tables; the column names also name the partition directories
+  const table_metadata_with_nullability* metadata = nullptr;
+  /// Maximum number of partition files that are open at the same time
+  size_t max_open_files = 64;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
+  /// Optional factory of the sink of each file, given its path relative to `base_path`; files
+  /// are created under `base_path` if not set
+  std::function<std::unique_ptr<cudf::io::data_sink>(std::string const&)> sink_factory;
+
+  write_partitioned_parquet_args() = default;
+
+  explicit write_partitioned_parquet_args(
+    std::string const& base_path_,
+    std::vector<size_type> const& partition_columns_,
+    const table_metadata_with_nullability* metadata_ = nullptr,
+    compression_type compression_                    = compression_type::AUTO,
+    statistics_freq stats_lvl_                       = statistics_freq::STATISTICS_ROWGROUP)
+    : base_path(base_path_),
+      partition_columns(partition_columns_),
+      compression(compression_),
+      stats_level(stats_lvl_),
+      metadata(metadata_) {}
+};
+
+/**
+ * @brief Writes tables to a Hive-style partitioned Parquet dataset
+ *
+ * The rows of each table are grouped by the values of the partition columns
+ * with a single sort, and each group is appended to a file of its partition
+ * directory, `<base_path>/<name0>=<value0>/<name1>=<value1>/part-<n>.parquet`.
+ * The partition columns are not written to the files, and null values go to
+ * the `__HIVE_DEFAULT_PARTITION__` directory as in Hive.
+ *
+ * The file of a partition is kept open across tables by a chunked writer. At
+ * most `max_open_files` files are open at a time; when the limit is reached,
+ * the least recently written file is finished and the next rows of its
+ * partition are written to a new file, numbered `n + 1`.
+ *
+ * The following code snippet demonstrates how to write a dataset partitioned by
+ * its first column:
+ * @code
+ *  ...
+ *  cudf::experimental::io::write_partitioned_parquet_args args{"/data/dataset", {0}};
+ *  cudf::experimental::io::partitioned_parquet_writer writer(args);
+ *  writer.write(table0);
+ *  writer.write(table1);
+ *  ...
+ *  auto files = writer.close();
+ * @endcode
+ */
+class partitioned_parquet_writer {
+ public:
+  /**
+   * @brief Constructs the writer
+   *
+   * @param args Settings for controlling writing behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  partitioned_parquet_writer(
+    write_partitioned_parquet_args const& args,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor, which finishes the open files
+   */
+  ~partitioned_parquet_writer();
+
+  /**
+   * @brief Appends the rows of a table to the files of their partitions
+   *
+   * All the tables must have the same columns.
+   *
+   * @param table The table data to be written
+   *
+   * @throw cudf::logic_error if the table has no columns besides the partition columns
+   * @throw cudf::logic_error if a partition column is not of a boolean, integer,
+   * floating-point, TIMESTAMP_DAYS or STRING type
+   */
+  void write(table_view const& table);
+
+  /**
+   * @brief Finishes the open files
+   *
+   * @return The paths relative to `base_path` of all the files written, in order of creation
+   */
+  std::vector<std::string> close();
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Settings to use for `read_arrow_ipc()`
+ */
+struct read_arrow_ipc_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  read_arrow_ipc_args() = default;
+
+  explicit read_arrow_ipc_args(source_info const& src) : source(src) {}
+};
+
+/**
+ * @brief Reads an Arrow IPC stream or file into a set of columns
+ *
+ * The format is detected from the magic bytes of the file format. The buffers
+ * of each record batch are copied to the device as they are wherever the Arrow
+ * and cudf layouts match, and the record batches are concatenated into the
+ * output columns.
+ *
+ * Supported Arrow types are the integer, floating-point, boolean, date32,
+ * timestamp and utf8 types.
+ *
+ * The following code snippet demonstrates how to read a stream from a buffer:
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  cudf::read_arrow_ipc_args args{cudf::source_info(buffer.data(), buffer.size())};
+ *  ...
+ *  auto result = cudf::read_arrow_ipc(args);
+ * @endcode
+ *
+ * @throw cudf::logic_error if the data is not a valid Arrow IPC stream or file
+ * @throw cudf::logic_error if a selected column is of an unsupported type
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The set of columns along with table metadata
+ */
+table_with_metadata read_arrow_ipc(
+  read_arrow_ipc_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Settings to use for `write_arrow_ipc()`
+ */
+struct write_arrow_ipc_args {
+  /// Specify the sink to use for writer output
+  sink_info sink;
+  /// Set of columns to output
+  table_view table;
+  /// Optional associated metadata
+  const table_metadata* metadata = nullptr;
+  /// Maximum number of rows of each record batch
+  size_type batch_size_rows = 1 << 20;
+  /// Whether to write the random access file format instead of the stream format
+  bool file_format = false;
+
+  write_arrow_ipc_args() = default;
+
+  explicit write_arrow_ipc_args(sink_info const& snk,
+                                table_view const& table_,
+                                const table_metadata* metadata_ = nullptr)
+    : sink(snk), table(table_), metadata(metadata_) {}
+};
+
+/**
+ * @brief Writes a set of columns to the Arrow IPC stream or file format
+ *
+ * Integer, floating-point, BOOL8, timestamp and string columns are supported;
+ * TIMESTAMP_DAYS is written as an Arrow date32. Each record batch holds up to
+ * `batch_size_rows` rows.
+ *
+ * The following code snippet demonstrates how to write columns to a buffer:
+ * @code
+ *  #include <cudf.h>
+ *  ...
+ *  std::vector<char> buffer;
+ *  cudf::experimental::io::write_arrow_ipc_args args{cudf::sink_info(&buffer), table->view()};
+ *  ...
+ *  cudf::experimental::io::write_arrow_ipc(args);
+ * @endcode
+ *
+ * @throw cudf::logic_error if a column is of an unsupported type
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Optional resource to use for device memory allocation
+ */
+void write_arrow_ipc(write_arrow_ipc_args const& args,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace io
 }  // namespace experimental
 }  // namespace cudf
@@ -151,7 +151,11 @@ struct reader_options {
   compression_type compression = compression_type::AUTO;
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Rows to infer the types from; 0 is all rows
+  size_type infer_sample_rows = 0;
   bool dayfirst = false;
+  /// Names of the columns to read; empty is all
+  std::vector<std::string> columns;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -162,12 +166,19 @@ struct reader_options {
      * @param[in] lines Restrict to `JSON Lines` format rather than full JSON
      * @param[in] compression Compression type: "none", "infer", "gzip", "zip"
      * @param[in] dtype Ordered list of data types; deduced from dataset if empty
+     * @param[in] dayfirst Whether to parse dates as DD/MM versus MM/DD
+     * @param[in] columns Names of the columns to read; empty is all
      *---------------------------------------------------------------------------**/
   reader_options(bool lines,
                  compression_type compression,
                  std::vector<std::string> dtype,
-                 bool dayfirst)
-    : lines(lines), compression(compression), dtype(std::move(dtype)), dayfirst(dayfirst) {}
+                 bool dayfirst,
+                 std::vector<std::string> columns = {})
+    : lines(lines),
+      compression(compression),
+      dtype(std::move(dtype)),
+      dayfirst(dayfirst),
+      columns(std::move(columns)) {}
 };
 
 /**
@@ -305,6 +316,8 @@ struct reader_options {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Rows to infer the types of the other columns from; 0 is all rows
+  size_type infer_sample_rows = 0;
   /// User-extensible list of values to recognize as boolean true values
   std::vector<std::string> true_values{"True", "TRUE", "true"};
   /// User-extensible list of values to recognize as boolean false values
@@ -420,6 +433,26 @@ class reader {
                                 size_type skip_rows_end,
                                 size_type num_rows,
                                 cudaStream_t stream = 0);
+
+  /**
+   * @brief Reads the rows beginning within the next byte window.
+   *
+   * Windows of `chunk_size` bytes are read in order from the start of the
+   * dataset. The column names and types of the first window are reused for the
+   * following ones, and the next window is prefetched into pinned host memory
+   * while the current one is parsed.
+   *
+   * @param chunk_size Size of the byte window
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(size_t chunk_size, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns whether there are byte windows left to read with `read_chunk()`.
+   */
+  bool has_next_chunk() const;
 };
 
 }  // namespace csv
@@ -437,6 +470,8 @@ struct reader_options {
   data_type timestamp_type{EMPTY};
   bool decimals_as_float    = true;
   int forced_decimals_scale = -1;
+  std::vector<column_predicate> filters;
+  bool strings_to_dictionary = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -448,19 +483,25 @@ struct reader_options {
    * @param use_index_lookup Whether to use row index for faster scanning
    * @param np_compat Whether to use numpy-compatible dtypes
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip stripes based on their statistics
+   * @param strings_to_dictionary Whether to return strings as DICTIONARY32
    */
   reader_options(std::vector<std::string> columns,
                  bool use_index_lookup,
                  bool np_compat,
                  data_type timestamp_type,
-                 bool decimals_as_float_    = true,
-                 int forced_decimals_scale_ = -1)
+                 bool decimals_as_float_               = true,
+                 int forced_decimals_scale_            = -1,
+                 std::vector<column_predicate> filters = {},
+                 bool strings_to_dictionary            = false)
     : columns(std::move(columns)),
       use_index(use_index_lookup),
       use_np_dtypes(np_compat),
       timestamp_type(timestamp_type),
       decimals_as_float(decimals_as_float_),
-      forced_decimals_scale(forced_decimals_scale_) {}
+      forced_decimals_scale(forced_decimals_scale_),
+      filters(std::move(filters)),
+      strings_to_dictionary(strings_to_dictionary) {}
 };
 
 /**
@@ -574,6 +615,10 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{EMPTY};
+  std::vector<column_predicate> filters;
+  bool filter_rows           = false;
+  bool strings_to_dictionary = false;
+  bool decimals_as_float     = true;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -581,19 +626,33 @@ struct reader_options {
   /**
    * @brief Constructor to populate reader options.
    *
-   * @param columns Set of columns to read; empty for all columns
+   * @param columns Set of columns to read; empty for all columns. Groups are read as
+   * LIST and STRUCT columns, and their leaves can be read as flat columns by dotted path
    * @param strings_to_categorical Whether to return strings as category
    * @param use_pandas_metadata Whether to always load PANDAS index columns
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filters Predicates used to skip row groups based on their statistics
+   * @param filter_rows Whether to only return the rows that satisfy the filters
+   * @param strings_to_dictionary Whether to return strings as DICTIONARY32
+   * @param decimals_as_float Whether to return INT32/INT64 decimals as FLOAT64, or else as
+   * DECIMAL32/DECIMAL64
    */
   reader_options(std::vector<std::string> columns,
                  bool strings_to_categorical,
                  bool use_pandas_metadata,
-                 data_type timestamp_type)
+                 data_type timestamp_type,
+                 std::vector<column_predicate> filters = {},
+                 bool filter_rows                      = false,
+                 bool strings_to_dictionary            = false,
+                 bool decimals_as_float                = true)
     : columns(std::move(columns)),
       strings_to_categorical(strings_to_categorical),
       use_pandas_metadata(use_pandas_metadata),
-      timestamp_type(timestamp_type) {}
+      timestamp_type(timestamp_type),
+      filters(std::move(filters)),
+      filter_rows(filter_rows),
+      strings_to_dictionary(strings_to_dictionary),
+      decimals_as_float(decimals_as_float) {}
 };
 
 /**
@@ -640,6 +699,20 @@ class reader {
                   reader_options const &options,
                   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Constructor for a list of sources read as a single dataset.
+   *
+   * The row groups of all sources are read, in order, as if they were stored
+   * in a single file. All sources must have the same schema.
+   *
+   * @param sources Sources of the dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit reader(std::vector<source_info> const &sources,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
   /**
    * @brief Destructor explicitly-declared to avoid inlined in header
    */
@@ -682,6 +755,34 @@ class reader {
   table_with_metadata read_row_groups(const std::vector<size_type> &row_group_list,
                                       cudaStream_t stream = 0);
 
+  /**
+   * @brief Splits the row groups that pass the filters into chunks that can
+   * each be read with a bounded amount of output device memory.
+   *
+   * The sizes are estimated from the file metadata, so the decoded output of a
+   * chunk may somewhat exceed the limit. A single row is never split.
+   *
+   * @param chunk_read_limit Limit on the decoded output size of each chunk, in bytes
+   *
+   * @return List of chunks to pass to `read_row_group_chunk()`
+   */
+  std::vector<row_group_chunk> get_row_chunks(size_t chunk_read_limit);
+
+  /**
+   * @brief Reads the rows of a chunk of row groups.
+   *
+   * The row groups are not filtered again, but the rows are if `filter_rows`
+   * is set.
+   *
+   * @param chunk Row groups and range of their rows to read
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if a row group of the chunk is out of range
+   */
+  table_with_metadata read_row_group_chunk(row_group_chunk const &chunk, cudaStream_t stream = 0);
+
   /**
    * @brief Reads a range of rows.
    *
@@ -696,6 +797,87 @@ class reader {
 
 }  // namespace parquet
 
+//! Arrow IPC format
+namespace arrow_ipc {
+
+/**
+ * @brief Options for the Arrow IPC reader.
+ */
+struct reader_options {
+  std::vector<std::string> columns;
+
+  reader_options()                       = default;
+  reader_options(reader_options const &) = default;
+
+  /**
+   * @brief Constructor to populate reader options.
+   *
+   * @param columns Set of columns to read; empty for all columns
+   */
+  reader_options(std::vector<std::string> columns) : columns(std::move(columns)) {}
+};
+
+/**
+ * @brief Class to read Arrow IPC stream or file data into columns.
+ */
+class reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for a filepath to dataset.
+   *
+   * @param filepath Path to whole dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit reader(std::string filepath,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Constructor for a memory buffer to dataset.
+   *
+   * @param buffer Pointer to whole dataset
+   * @param length Host buffer size in bytes
+   * @param options Settings for controlling reading behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit reader(const char *buffer,
+                  size_t length,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Constructor for an Arrow file to dataset.
+   *
+   * @param file Arrow file object of dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~reader();
+
+  /**
+   * @brief Reads the entire dataset.
+   *
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_all(cudaStream_t stream = 0);
+};
+
+}  // namespace arrow_ipc
+
 }  // namespace detail
 }  // namespace io
 }  // namespace experimental
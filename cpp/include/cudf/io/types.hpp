@@ -25,6 +25,8 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // Forward declarations
@@ -59,7 +61,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< ZSTD format, using LZ77 + Huffman + finite state entropy coding
+  LZ4      ///< LZ4 format, using byte-oriented LZ77
 };
 
 /**
@@ -92,6 +96,69 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Comparison operators usable in reader filter predicates
+ */
+enum class predicate_op {
+  EQUAL,          ///< column == value
+  LESS,           ///< column < value
+  LESS_EQUAL,     ///< column <= value
+  GREATER,        ///< column > value
+  GREATER_EQUAL,  ///< column >= value
+};
+
+/**
+ * @brief Single `column <op> value` comparison used by readers to skip data
+ *
+ * Readers evaluate a list of predicates as a conjunction against the min/max
+ * statistics stored in the file, and skip any row group (stripe, etc.) that
+ * cannot contain a matching row. Rows are not filtered individually, so the
+ * returned table may still contain rows that don't satisfy the predicates.
+ *
+ * Values are compared against the physical storage representation of the
+ * column (for example, the integer count of timestamps in the file's unit).
+ */
+struct column_predicate {
+  /**
+   * @brief Type of the literal value to compare against
+   */
+  enum class value_kind { INTEGER, FLOAT, STRING };
+
+  std::string column;                     ///< Name of the column
+  predicate_op op = predicate_op::EQUAL;  ///< Comparison operator
+  value_kind kind = value_kind::INTEGER;  ///< Which of the value fields is set
+  int64_t int_value  = 0;                 ///< Value for integer (and boolean) comparisons
+  double float_value = 0;                 ///< Value for floating-point comparisons
+  std::string string_value;               ///< Value for string comparisons
+
+  column_predicate() = default;
+
+  template <typename T, typename std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  column_predicate(std::string const& name, predicate_op op_, T value)
+    : column(name), op(op_), kind(value_kind::INTEGER), int_value(static_cast<int64_t>(value)) {}
+
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  column_predicate(std::string const& name, predicate_op op_, T value)
+    : column(name), op(op_), kind(value_kind::FLOAT), float_value(static_cast<double>(value)) {}
+
+  column_predicate(std::string const& name, predicate_op op_, std::string const& value)
+    : column(name), op(op_), kind(value_kind::STRING), string_value(value) {}
+};
+
+/**
+ * @brief A range of consecutive rows of a list of row groups of a dataset
+ *
+ * Chunked readers plan their reads as row group chunks. Each chunk holds its
+ * row groups explicitly, rather than a row range from which they are derived,
+ * so it reads the same rows whichever row groups were skipped by filters.
+ */
+struct row_group_chunk {
+  /// Index of the source, and of the row group within the source, of each row group in order
+  std::vector<std::pair<size_type, size_type>> row_groups;
+  size_type skip_rows = 0;  ///< Rows to skip from the start of the first row group
+  size_type num_rows  = 0;  ///< Number of rows to read
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -29,7 +29,9 @@
 #include <cudf/io/data_sink.hpp>
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 //! cuDF interfaces
 namespace cudf {
@@ -51,6 +53,14 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Enables writing column statistics in the ORC file
   bool enable_statistics = true;
+  /// Maximum uncompressed size of a stripe, in bytes
+  size_t stripe_size_bytes = 64 * 1024 * 1024;
+  /// Maximum number of rows in a stripe; 0 selects a limit based on the column types
+  size_type stripe_size_rows = 0;
+  /// Number of rows between row index entries; must be a multiple of 8
+  size_type row_index_stride = 10000;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -59,9 +69,24 @@ struct writer_options {
    * @brief Constructor to populate writer options.
    *
    * @param format Compression format to use
+   * @param stats_en Whether to write column statistics
+   * @param stripe_bytes Maximum uncompressed stripe size in bytes
+   * @param stripe_rows Maximum number of rows per stripe, or 0 for the default
+   * @param index_stride Number of rows between row index entries
+   * @param comp_level Compression level
    */
-  explicit writer_options(compression_type format, bool stats_en)
-    : compression(format), enable_statistics(stats_en) {}
+  explicit writer_options(compression_type format,
+                          bool stats_en,
+                          size_t stripe_bytes    = 64 * 1024 * 1024,
+                          size_type stripe_rows  = 0,
+                          size_type index_stride = 10000,
+                          int comp_level         = 0)
+    : compression(format),
+      enable_statistics(stats_en),
+      stripe_size_bytes(stripe_bytes),
+      stripe_size_rows(stripe_rows),
+      row_index_stride(index_stride),
+      compression_level(comp_level) {}
 };
 
 /**
@@ -136,6 +161,18 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Use DELTA encodings instead of PLAIN for integer and string columns without a dictionary
+  bool enable_delta_encoding = false;
+  /// Names of the columns to write a split block Bloom filter for in each column chunk
+  std::vector<std::string> bloom_filter_columns;
+  /// Compression level (0-2) of SNAPPY; higher levels trade encoding speed for smaller output
+  int compression_level = 0;
+  /// Maximum uncompressed size of a row group in bytes, 0 for the default of 128MB
+  size_t row_group_size_bytes = 0;
+  /// Maximum number of rows of a row group, 0 for the default of 1M rows
+  size_t row_group_size_rows = 0;
+  /// Target uncompressed size of a data page in bytes, 0 for the default of 512KB
+  size_t max_page_size_bytes = 0;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -144,9 +181,30 @@ struct writer_options {
    * @brief Constructor to populate writer options.
    *
    * @param format Compression format to use
+   * @param stats_lvl Statistics level to generate
+   * @param delta_en Whether to use DELTA encodings for non-dictionary columns
+   * @param bloom_columns Names of the columns to write Bloom filters for
+   * @param comp_level Compression level
+   * @param rowgroup_bytes Maximum size of a row group in bytes, 0 for the default
+   * @param rowgroup_rows Maximum number of rows of a row group, 0 for the default
+   * @param page_bytes Target size of a data page in bytes, 0 for the default
    */
-  explicit writer_options(compression_type format, statistics_freq stats_lvl)
-    : compression(format), stats_granularity(stats_lvl) {}
+  explicit writer_options(compression_type format,
+                          statistics_freq stats_lvl,
+                          bool delta_en                                 = false,
+                          std::vector<std::string> const& bloom_columns = {},
+                          int comp_level                                = 0,
+                          size_t rowgroup_bytes                         = 0,
+                          size_t rowgroup_rows                          = 0,
+                          size_t page_bytes                             = 0)
+    : compression(format),
+      stats_granularity(stats_lvl),
+      enable_delta_encoding(delta_en),
+      bloom_filter_columns(bloom_columns),
+      compression_level(comp_level),
+      row_group_size_bytes(rowgroup_bytes),
+      row_group_size_rows(rowgroup_rows),
+      max_page_size_bytes(page_bytes) {}
 };
 
 /**
@@ -223,6 +281,161 @@ class writer {
 
 }  // namespace parquet
 
+//! CSV format
+namespace csv {
+
+/**
+ * @brief Options for the CSV writer.
+ */
+struct writer_options {
+  /// String to use for null entries
+  std::string na_rep = "";
+  /// Whether to write a header row with the column names
+  bool include_header = true;
+  /// Maximum number of rows to format on the GPU at a time
+  size_type rows_per_chunk = 1 << 20;
+  /// String to use to terminate each row
+  std::string line_terminator = "\n";
+  /// Character to use to separate the columns of a row
+  char inter_column_delimiter = ',';
+  /// String to use for true values of boolean columns
+  std::string true_value = "true";
+  /// String to use for false values of boolean columns
+  std::string false_value = "false";
+
+  writer_options()                      = default;
+  writer_options(writer_options const&) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param na String to use for null entries
+   * @param header Whether to write a header row
+   * @param rows Maximum number of rows to format at a time
+   * @param terminator String to use to terminate each row
+   * @param delim Character to use to separate the columns
+   * @param true_v String to use for true values
+   * @param false_v String to use for false values
+   */
+  explicit writer_options(std::string const& na,
+                          bool header,
+                          size_type rows,
+                          std::string const& terminator,
+                          char delim,
+                          std::string const& true_v,
+                          std::string const& false_v)
+    : na_rep(na),
+      include_header(header),
+      rows_per_chunk(rows),
+      line_terminator(terminator),
+      inter_column_delimiter(delim),
+      true_value(true_v),
+      false_value(false_v) {}
+};
+
+/**
+ * @brief Class to write CSV dataset data from columns.
+ */
+class writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a file.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit writer(std::unique_ptr<cudf::io::data_sink> sink,
+                  writer_options const& options,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void write_all(table_view const& table,
+                 const table_metadata* metadata = nullptr,
+                 cudaStream_t stream            = 0);
+};
+
+}  // namespace csv
+
+//! Arrow IPC format
+namespace arrow_ipc {
+
+/**
+ * @brief Options for the Arrow IPC writer.
+ */
+struct writer_options {
+  /// Maximum number of rows of each record batch
+  size_type batch_size_rows = 1 << 20;
+  /// Whether to write the random access file format instead of the stream format
+  bool file_format = false;
+
+  writer_options()                      = default;
+  writer_options(writer_options const&) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param batch_rows Maximum number of rows of each record batch
+   * @param file Whether to write the file format
+   */
+  explicit writer_options(size_type batch_rows, bool file)
+    : batch_size_rows(batch_rows), file_format(file) {}
+};
+
+/**
+ * @brief Class to write Arrow IPC stream or file data from columns.
+ */
+class writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a file.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit writer(std::unique_ptr<cudf::io::data_sink> sink,
+                  writer_options const& options,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void write_all(table_view const& table,
+                 const table_metadata* metadata = nullptr,
+                 cudaStream_t stream            = 0);
+};
+
+}  // namespace arrow_ipc
+
 }  // namespace detail
 }  // namespace io
 }  // namespace experimental
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <string>
+
+/**
+ * @file jit_cache.hpp
+ * @brief Warm-up of the cache of the kernels JIT compiled by binary operations,
+ * transforms and rolling windows
+ *
+ * Compiling a kernel takes seconds, so a process can avoid compiling when it
+ * first runs an operation in two ways:
+ * - a bundle written by a process that ran the same operations is loaded, with
+ *   `load_kernel_cache_bundle()` or by naming it in the environment variable
+ *   `LIBCUDF_KERNEL_CACHE_BUNDLE`. Bundles are read-only, and can be shared by
+ *   processes on different machines running the same cudf version.
+ * - the kernels of a manifest, written by a process that ran the same
+ *   operations, are compiled at startup with `warm_up_kernel_cache()`.
+ */
+
+namespace cudf {
+namespace jit {
+
+/**
+ * @brief Loads the compiled programs and kernels of a bundle into the kernel cache
+ *
+ * @throws cudf::logic_error if the file is not a bundle of this cudf version
+ *
+ * @param bundle_path Path of a bundle written by `write_kernel_cache_bundle()`
+ */
+void load_kernel_cache_bundle(std::string const& bundle_path);
+
+/**
+ * @brief Writes all the programs and kernels compiled or loaded by this process
+ * to a bundle
+ *
+ * @param bundle_path Path of the bundle file to write
+ */
+void write_kernel_cache_bundle(std::string const& bundle_path);
+
+/**
+ * @brief Writes the program, kernel name and template arguments of every
+ * kernel used by this process to a manifest
+ *
+ * @param manifest_path Path of the manifest file to write
+ */
+void write_kernel_cache_manifest(std::string const& manifest_path);
+
+/**
+ * @brief Compiles the kernels of a manifest that are not cached yet
+ *
+ * The programs of the kernels must already be cached, e.g. from a bundle or a
+ * previous run sharing the file cache of `LIBCUDF_KERNEL_CACHE_PATH`.
+ *
+ * @throws cudf::logic_error if a program of the manifest is not cached
+ *
+ * @param manifest_path Path of a manifest written by `write_kernel_cache_manifest()`
+ */
+void warm_up_kernel_cache(std::string const& manifest_path);
+
+}  // namespace jit
+}  // namespace cudf
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/binaryop.hpp>
+
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -26,6 +28,33 @@ namespace cudf {
 namespace experimental {
 // joins
 
+/**
+ * @brief  Algorithm used to find the matching rows of two tables in a join
+ *
+ * When a `cudf::memory_budget` is installed, a `HASH` join that does not fit
+ * in the budget is run as a `PARTITIONED_HASH` join. The output is counted
+ * before it is allocated; if it does not fit, inner and left joins are
+ * computed for parts of the left rows and full joins are partitioned again.
+ * Only when a part can not be split further is `cudf::logic_error` thrown.
+ */
+enum class join_algorithm {
+  HASH,             ///< Probes a hash table built on one of the tables
+  SORT_MERGE,       ///< Searches the left rows in the right table sorted on the join
+                    ///< columns; the right table is only sorted if it is not already
+  PARTITIONED_HASH  ///< Hash partitions both tables into pinned host memory, then joins
+                    ///< the partition pairs one at a time (grace hash join); the number
+                    ///< of partitions is set from the free device memory or the budget
+};
+
+/**
+ * @brief  How a hash join sizes its output before writing it
+ */
+enum class join_size_mode {
+  EXACT,    ///< Counts the matches of every probe row, then writes the output in one pass
+  ESTIMATE  ///< Counts the matches of a sample of the probe rows, probing again if it
+            ///< underestimates the output size
+};
+
 /**
  * @brief  Performs an inner join on the specified columns of two
  * tables (left, right)
@@ -74,6 +103,7 @@ namespace experimental {
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Memory resource used to allocate the returned table and columns
+ * @param stream CUDA stream on which to execute kernels and memory copies
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -85,7 +115,35 @@ std::unique_ptr<cudf::experimental::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief  Performs an inner join on the specified columns of two tables (left,
+ * right) with the given algorithm
+ *
+ * `join_algorithm::SORT_MERGE` uses memory linear in the sizes of the tables
+ * and accesses them in order, which suits inputs already sorted on the join
+ * columns and right tables too large for a hash table in device memory.
+ * `join_algorithm::PARTITIONED_HASH` keeps the partitions of the tables in
+ * host memory, for joins whose working set exceeds the device memory.
+ *
+ * @copydetails inner_join(cudf::table_view const&, cudf::table_view const&,
+ * std::vector<cudf::size_type> const&, std::vector<cudf::size_type> const&,
+ * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+ * rmm::mr::device_memory_resource*, cudaStream_t)
+ *
+ * @param[in] algorithm Algorithm used to find the matching rows
+ */
+std::unique_ptr<cudf::experimental::table> inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief  Performs a left join (also known as left outer join) on the
@@ -137,6 +195,7 @@ std::unique_ptr<cudf::experimental::table> inner_join(
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Memory resource used to allocate the returned table and columns
+ * @param stream CUDA stream on which to execute kernels and memory copies
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -148,7 +207,35 @@ std::unique_ptr<cudf::experimental::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief  Performs a left join on the specified columns of two tables (left,
+ * right) with the given algorithm
+ *
+ * `join_algorithm::SORT_MERGE` uses memory linear in the sizes of the tables
+ * and accesses them in order, which suits inputs already sorted on the join
+ * columns and right tables too large for a hash table in device memory.
+ * `join_algorithm::PARTITIONED_HASH` keeps the partitions of the tables in
+ * host memory, for joins whose working set exceeds the device memory.
+ *
+ * @copydetails left_join(cudf::table_view const&, cudf::table_view const&,
+ * std::vector<cudf::size_type> const&, std::vector<cudf::size_type> const&,
+ * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+ * rmm::mr::device_memory_resource*, cudaStream_t)
+ *
+ * @param[in] algorithm Algorithm used to find the matching rows
+ */
+std::unique_ptr<cudf::experimental::table> left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief  Performs a full join (also known as full outer join) on the
@@ -200,6 +287,7 @@ std::unique_ptr<cudf::experimental::table> left_join(
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
  * @param mr Memory resource used to allocate the returned table and columns
+ * @param stream CUDA stream on which to execute kernels and memory copies
  *
  * @returns Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -211,7 +299,118 @@ std::unique_ptr<cudf::experimental::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief  Performs a full join on the specified columns of two tables (left,
+ * right) with the given algorithm
+ *
+ * `join_algorithm::SORT_MERGE` uses memory linear in the sizes of the tables
+ * and accesses them in order, which suits inputs already sorted on the join
+ * columns and right tables too large for a hash table in device memory.
+ * `join_algorithm::PARTITIONED_HASH` keeps the partitions of the tables in
+ * host memory, for joins whose working set exceeds the device memory.
+ *
+ * @copydetails full_join(cudf::table_view const&, cudf::table_view const&,
+ * std::vector<cudf::size_type> const&, std::vector<cudf::size_type> const&,
+ * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+ * rmm::mr::device_memory_resource*, cudaStream_t)
+ *
+ * @param[in] algorithm Algorithm used to find the matching rows
+ */
+std::unique_ptr<cudf::experimental::table> full_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief  Computes the row indices of an inner join of two tables (left, right)
+ *
+ * Returns the gather maps of the join instead of its materialized output, for
+ * callers that only need a few of the columns or aggregate the result: row `i`
+ * of the join consists of row `left_indices[i]` of `left` and row
+ * `right_indices[i]` of `right`.
+ *
+ * @example Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}, a: {1, 2, 5}
+ *          left_on: {0}
+ *          right_on: {1}
+ * Result: { left_indices: {1, 2}, right_indices: {0, 1} }
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of INT32 columns of the `left` and `right` row indices of the
+ * join, in no particular order
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the row indices of a left join of two tables (left, right)
+ *
+ * Rows of `left` without a match in `right` have a null right index.
+ *
+ * @example Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}, a: {1, 2, 5}
+ *          left_on: {0}
+ *          right_on: {1}
+ * Result: { left_indices: {0, 1, 2}, right_indices: {NULL, 0, 1} }
+ *
+ * @copydetails inner_join_indices
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the row indices of a full join of two tables (left, right)
+ *
+ * Rows of either table without a match in the other one have a null index
+ * for the other table.
+ *
+ * @example Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}, a: {1, 2, 5}
+ *          left_on: {0}
+ *          right_on: {1}
+ * Result: { left_indices: {NULL, 0, 1, 2}, right_indices: {2, NULL, 0, 1} }
+ *
+ * @copydetails inner_join_indices
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** 
  * @brief  Performs a left semi join on the specified columns of two 
  * tables (left, right)
@@ -313,6 +512,357 @@ std::unique_ptr<cudf::experimental::table> left_anti_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the row indices of a left semi join of two tables (left, right)
+ *
+ * Returns the gather map of `left_semi_join` instead of its materialized
+ * output, e.g. for EXISTS subqueries that only filter the left table or
+ * gather a few of its columns later.
+ *
+ * @example TableA a: {0, 1, 2}
+ *          TableB b: {1, 2, 3}, a: {1, 2, 5}
+ *          left_on: {0}
+ *          right_on: {1}
+ * Result: { 1, 2 }
+ *
+ * @throws cudf::logic_error if number of columns in either `left` or `right` table is 0
+ * @throws cudf::logic_error if number of elements in `right_on` and `left_on` are not equal
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] left_on          The column indices from `left` to join on.
+ *                             The column from `left` indicated by `left_on[i]`
+ *                             will be compared against the column from `right`
+ *                             indicated by `right_on[i]`.
+ * @param[in] right_on         The column indices from `right` to join on.
+ *                             The column from `right` indicated by `right_on[i]`
+ *                             will be compared against the column from `left`
+ *                             indicated by `left_on[i]`.
+ * @param[in] mr               Device memory resource used to allocate the returned column
+ *
+ * @returns                    INT32 column of the indices of the rows of `left` that match
+ *                             in `right`, in ascending order
+ */
+std::unique_ptr<cudf::column> left_semi_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Computes the row indices of a left anti join of two tables (left, right)
+ *
+ * @example TableA a: {0, 1, 2}
+ *          TableB b: {1, 2, 3}, a: {1, 2, 5}
+ *          left_on: {0}
+ *          right_on: {1}
+ * Result: { 0 }
+ *
+ * @copydetails left_semi_join_indices
+ *
+ * @returns                    INT32 column of the indices of the rows of `left` that do not
+ *                             match in `right`, in ascending order
+ */
+std::unique_ptr<cudf::column> left_anti_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Comparison between a column of the left table and a column of the
+ * right table of a conditional join
+ */
+struct join_condition {
+  cudf::size_type left_column;   ///< Index of the column of the left table
+  binary_operator op;            ///< EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL or GREATER_EQUAL
+  cudf::size_type right_column;  ///< Index of the column of the right table
+};
+
+/**
+ * @brief  Performs an inner join of two tables (left, right) on a conjunction
+ * of comparisons between their columns
+ *
+ * A pair of rows matches when all the `conditions` hold, comparing the left
+ * element as the first operand; comparisons involving nulls do not hold.
+ * The conditions are evaluated on every pair of rows, so the work is
+ * quadratic, but the memory used besides the output is linear in the number
+ * of left rows. Range joins are expressed with two conditions.
+ *
+ * @example Left ts: {1, 5, 9}
+ *          Right start: {0, 4}, end: {6, 8}
+ *          conditions: { {0, GREATER_EQUAL, 0}, {0, LESS_EQUAL, 1} }
+ * Result: { ts: {1, 5, 5}, start: {0, 0, 4}, end: {6, 6, 8} }
+ *
+ * @throws cudf::logic_error if `conditions` is empty, refers to columns that
+ * do not exist, compares columns of different types or uses another operator
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] conditions Comparisons that must all hold for a pair of rows to match
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns The matching pairs of rows, with the columns of `left` followed by
+ * those of `right`
+ */
+std::unique_ptr<cudf::experimental::table> conditional_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a left join of two tables (left, right) on a conjunction
+ * of comparisons between their columns
+ *
+ * Left rows without a matching right row are output once, with nulls in the
+ * right columns.
+ *
+ * @copydetails conditional_inner_join
+ */
+std::unique_ptr<cudf::experimental::table> conditional_left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a cross join of two tables (left, right)
+ *
+ * Every row of `left` is paired with every row of `right`. Row `i` of the
+ * result holds left row `i / right.num_rows()` and right row
+ * `i % right.num_rows()`; the columns are gathered directly from the inputs
+ * without materializing repeated or tiled copies of them.
+ *
+ * @example Left a: {0, 1}
+ *          Right b: {3, 4, 5}
+ * Result: { a: {0, 0, 0, 1, 1, 1}, b: {3, 4, 5, 3, 4, 5} }
+ *
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0, or if the number of output rows overflows `size_type`
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns The cross product, with the columns of `left` followed by those of
+ * `right`
+ */
+std::unique_ptr<cudf::experimental::table> cross_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Performs a cross join of two tables (left, right), returning the
+ * output in chunks of at most `max_chunk_rows` rows
+ *
+ * The concatenation of the chunks equals the result of `cross_join`. Each
+ * chunk is gathered independently, so the output can be built and consumed
+ * in bounded-size pieces even when the whole product would not fit.
+ *
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0, or if `max_chunk_rows` is not positive
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] max_chunk_rows Maximum number of rows of each chunk
+ * @param mr Memory resource used to allocate the returned tables and columns
+ *
+ * @returns The chunks of the cross product in order; empty if either table
+ * has no rows
+ */
+std::vector<std::unique_ptr<cudf::experimental::table>> cross_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  cudf::size_type max_chunk_rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Hash join that builds the hash table of the right (build) table once
+ * and probes it with any number of left (probe) tables
+ *
+ * Joining a stream of tables against the same table with `inner_join`,
+ * `left_join` or `full_join` rebuilds the hash table on every call; this
+ * object only pays the build cost in its constructor.
+ *
+ * The results are the same as those of the free functions called with the
+ * probe table as `left` and the build table as `right`.
+ *
+ * The build table is not copied; it must outlive the `hash_join` object.
+ */
+class hash_join {
+ public:
+  hash_join() = delete;
+  ~hash_join();
+  hash_join(hash_join const&) = delete;
+  hash_join(hash_join&&)      = delete;
+  hash_join& operator=(hash_join const&) = delete;
+  hash_join& operator=(hash_join&&) = delete;
+
+  /**
+   * @brief  Builds the hash table of the rows of `build` on the columns
+   * `build_on`
+   *
+   * @throws cudf::logic_error if number of columns in `build` is 0 or its
+   * number of rows exceeds MAX_JOIN_SIZE
+   * @throws std::out_of_range if an element of `build_on` exceeds the number
+   * of columns in `build`
+   *
+   * @param[in] build The build (right) table
+   * @param[in] build_on The column indices from `build` to join on
+   * @param[in] size_mode How the output of the joins is sized
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<cudf::size_type> const& build_on,
+            join_size_mode size_mode = join_size_mode::EXACT);
+
+  /**
+   * @brief  Builds the hash table of the rows of `build` on the columns
+   * `build_on`, using hash values computed beforehand
+   *
+   * `build_hashes` must hold the hash values of the `build_on` columns of
+   * every row, as returned by `hash_partition_with_hashes` when partitioning
+   * on the same columns in the same order; the rows are not hashed again.
+   *
+   * @throws cudf::logic_error if `build_hashes` is not a non-nullable INT32
+   * column with a value for every row of `build`
+   *
+   * @copydetails hash_join(cudf::table_view const&, std::vector<cudf::size_type> const&,
+   * join_size_mode)
+   *
+   * @param[in] build_hashes The hash values of the rows of `build`
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<cudf::size_type> const& build_on,
+            cudf::column_view const& build_hashes,
+            join_size_mode size_mode = join_size_mode::EXACT);
+
+  /**
+   * @brief  Performs an inner join of `probe` with the build table
+   *
+   * @throws cudf::logic_error if number of elements in `probe_on` and the
+   * build columns mismatch, or if their data types differ
+   *
+   * @param[in] probe The probe (left) table
+   * @param[in] probe_on The column indices from `probe` to join on. The column
+   * indicated by `probe_on[i]` will be compared against the build column
+   * indicated by `build_on[i]`.
+   * @param[in] columns_in_common is a vector of pairs of column indices into
+   * `probe` and the build table, respectively, that are "in common", as in
+   * `inner_join`
+   * @param mr Memory resource used to allocate the returned table and columns
+   *
+   * @returns Result of the join, with the columns of
+   * `probe(including common columns)+build(excluding common columns)`
+   */
+  std::unique_ptr<cudf::experimental::table> inner_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief  Performs an inner join of `probe` with the build table, using hash
+   * values of the probe rows computed beforehand
+   *
+   * `probe_hashes` must hold the hash values of the `probe_on` columns of
+   * every row of `probe`, computed as for the build table.
+   *
+   * @throws cudf::logic_error if `probe_hashes` is not a non-nullable INT32
+   * column with a value for every row of `probe`
+   *
+   * @copydetails hash_join::inner_join(cudf::table_view const&,
+   * std::vector<cudf::size_type> const&,
+   * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+   * rmm::mr::device_memory_resource*) const
+   *
+   * @param[in] probe_hashes The hash values of the rows of `probe`
+   */
+  std::unique_ptr<cudf::experimental::table> inner_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief  Performs a left join of `probe` with the build table
+   *
+   * @copydetails hash_join::inner_join
+   */
+  std::unique_ptr<cudf::experimental::table> left_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief  Performs a left join of `probe` with the build table, using hash
+   * values of the probe rows computed beforehand
+   *
+   * `probe_hashes` must hold the hash values of the `probe_on` columns of
+   * every row of `probe`, computed as for the build table.
+   *
+   * @throws cudf::logic_error if `probe_hashes` is not a non-nullable INT32
+   * column with a value for every row of `probe`
+   *
+   * @copydetails hash_join::left_join(cudf::table_view const&,
+   * std::vector<cudf::size_type> const&,
+   * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+   * rmm::mr::device_memory_resource*) const
+   *
+   * @param[in] probe_hashes The hash values of the rows of `probe`
+   */
+  std::unique_ptr<cudf::experimental::table> left_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief  Performs a full join of `probe` with the build table
+   *
+   * @copydetails hash_join::inner_join
+   */
+  std::unique_ptr<cudf::experimental::table> full_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief  Performs a full join of `probe` with the build table, using hash
+   * values of the probe rows computed beforehand
+   *
+   * `probe_hashes` must hold the hash values of the `probe_on` columns of
+   * every row of `probe`, computed as for the build table.
+   *
+   * @throws cudf::logic_error if `probe_hashes` is not a non-nullable INT32
+   * column with a value for every row of `probe`
+   *
+   * @copydetails hash_join::full_join(cudf::table_view const&,
+   * std::vector<cudf::size_type> const&,
+   * std::vector<std::pair<cudf::size_type, cudf::size_type>> const&,
+   * rmm::mr::device_memory_resource*) const
+   *
+   * @param[in] probe_hashes The hash values of the rows of `probe`
+   */
+  std::unique_ptr<cudf::experimental::table> full_join(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  class impl;
+  std::unique_ptr<const impl> _impl;
+};
 }  //namespace experimental
 
 }  //namespace cudf
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+
+/**
+ * @brief Returns a single column by vertically concatenating the given vector of
+ * lists columns.
+ *
+ * The child columns of the lists are concatenated recursively.
+ *
+ * ```
+ * l1 = [[1, 2], [3]]
+ * l2 = [[], [4, 5, 6]]
+ * r = concatenate([l1, l2])
+ * r is now [[1, 2], [3], [], [4, 5, 6]]
+ * ```
+ *
+ * @param columns List of lists columns to concatenate.
+ * @param mr Resource for allocating device memory.
+ * @param stream CUDA stream to use for any kernels in this function.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate(
+  std::vector<column_view> const& columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
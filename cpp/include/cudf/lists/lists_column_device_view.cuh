@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+
+/**
+ * @file lists_column_device_view.cuh
+ * @brief Device views of a lists column and of its rows.
+ */
+
+namespace cudf {
+
+class lists_column_device_view;
+
+/**
+ * @brief A non-owning view of the elements of one row of a lists column
+ * that is usable in device code.
+ *
+ * The elements are `[begin(), end())` of the child column of the lists
+ * column; they are read through `child()` with the element accessors of
+ * the child's type.
+ */
+class list_device_view {
+ public:
+  __device__ list_device_view(column_device_view const& child,
+                              size_type begin,
+                              size_type end)
+    : _child{child}, _begin{begin}, _end{end} {}
+
+  /**
+   * @brief Returns the number of elements in this list.
+   */
+  __device__ size_type size() const noexcept { return _end - _begin; }
+
+  /**
+   * @brief Returns the index in the child column of the first element of this list.
+   */
+  __device__ size_type begin() const noexcept { return _begin; }
+
+  /**
+   * @brief Returns the index in the child column past the last element of this list.
+   */
+  __device__ size_type end() const noexcept { return _end; }
+
+  /**
+   * @brief Returns the child column holding the elements of this list.
+   */
+  __device__ column_device_view const& child() const noexcept { return _child; }
+
+  /**
+   * @brief Returns the element at position `idx` of this list.
+   *
+   * @tparam T The type of the child column
+   */
+  template <typename T>
+  __device__ T const element(size_type idx) const noexcept {
+    return _child.element<T>(_begin + idx);
+  }
+
+  /**
+   * @brief Returns true if the element at position `idx` of this list is null.
+   */
+  __device__ bool is_null(size_type idx) const noexcept { return _child.is_null(_begin + idx); }
+
+ private:
+  column_device_view const _child;
+  size_type const _begin;
+  size_type const _end;
+};
+
+/**
+ * @brief Given a device view of a LIST column, an instance of this class
+ * provides the rows of the column as `list_device_view`s.
+ *
+ * ```
+ * auto d_column = column_device_view::create(lists.parent(), stream);
+ * lists_column_device_view d_lists{*d_column};
+ * // in device code
+ * auto row = d_lists[idx];
+ * for (size_type i = 0; i < row.size(); ++i) sum += row.element<int32_t>(i);
+ * ```
+ */
+class lists_column_device_view {
+ public:
+  lists_column_device_view(column_device_view const& lists) : _lists{lists} {}
+
+  /**
+   * @brief Returns the number of rows in the lists column.
+   */
+  __device__ size_type size() const noexcept { return _lists.size(); }
+
+  /**
+   * @brief Returns true if the row at `idx` is null.
+   */
+  __device__ bool is_null(size_type idx) const noexcept { return _lists.is_null(idx); }
+
+  /**
+   * @brief Returns the offsets of the rows of the column.
+   *
+   * This accounts for the offset of the lists column.
+   */
+  __device__ size_type const* offsets() const noexcept {
+    return _lists.child(lists_column_view::offsets_column_index).data<size_type>() +
+           _lists.offset();
+  }
+
+  /**
+   * @brief Returns the child column of the list elements.
+   */
+  __device__ column_device_view child() const noexcept {
+    return _lists.child(lists_column_view::child_column_index);
+  }
+
+  /**
+   * @brief Returns the list of the row at `idx`.
+   *
+   * If the row is null, any use of the result is undefined behavior.
+   */
+  __device__ list_device_view operator[](size_type idx) const noexcept {
+    auto const d_offsets = offsets();
+    return list_device_view{child(), d_offsets[idx], d_offsets[idx + 1]};
+  }
+
+ private:
+  column_device_view const _lists;
+};
+
+}  // namespace cudf
@@ -94,5 +94,51 @@ std::unique_ptr<cudf::experimental::table> merge(
   std::vector<cudf::null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr                  = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the order of the rows of merged sorted tables, without
+ * gathering them.
+ *
+ * Returns the source of each row of `merge(keys_to_merge, ...)` with all the
+ * columns as keys: the index in `keys_to_merge` of its table and its row index
+ * within that table. Equivalent rows are in the order of their tables, then of
+ * their rows, as in `merge`.
+ *
+ * Only the key columns are compared, so other columns of the tables can be
+ * gathered later, and only when needed, e.g., by gathering the concatenated
+ * tables at `offset[table] + row`.
+ *
+ * If the first key column is a strings column, rows are first compared by the
+ * first 8 bytes of its strings, packed in 64-bit integers, and only rows whose
+ * prefixes are equal are compared in full.
+ *
+ * Example:
+ * input:
+ * table 0 => col 0 {0, 2, 4}
+ * table 1 => col 0 {1, 2}
+ * output:
+ * table index => {0, 1, 0, 1, 0}
+ * row index   => {0, 0, 1, 1, 2}
+ *
+ * @throws cudf::logic_error if tables in `keys_to_merge` have no columns
+ * @throws cudf::logic_error if tables in `keys_to_merge` have columns with
+ * mismatched types
+ * @throws cudf::logic_error if `column_order` size differs from the number of
+ * columns of the tables
+ *
+ * @Param[in] keys_to_merge List of sorted tables of key columns
+ * @Param[in] column_order Sort order types of the key columns
+ * @Param[in] null_precedence Array indicating the order of nulls with respect
+ * to non-nulls for the key columns
+ * @Param[in] mr Memory resource used to allocate the returned columns
+ *
+ * @Returns A table of two INT32 columns, the table index and the row index of
+ * each merged row
+ */
+std::unique_ptr<cudf::experimental::table> merge_indices(
+  std::vector<table_view> const& keys_to_merge,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr                  = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
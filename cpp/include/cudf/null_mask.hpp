@@ -232,4 +232,20 @@ rmm::device_buffer bitmask_and(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns a bitwise OR of the bitmasks of columns of a table
+ *
+ * If any of the columns isn't nullable, all the rows are valid and an empty
+ * bitmask is returned.
+ *
+ * @param view The table of columns
+ * @param stream CUDA stream on which to execute kernels
+ * @param mr Memory resource for allocating output bitmask
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_or(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace cudf
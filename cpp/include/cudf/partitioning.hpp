@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/types.hpp>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 namespace cudf {
@@ -71,21 +74,154 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * With `HASH_SPARK_MURMUR3` and a `seed` of 42, rows are partitioned as
+ * Spark's hash partitioning and bucketing of the same columns partition them:
+ * into the non-negative remainder of their hash value, as returned by
+ * `cudf::hash`, divided by `num_partitions`. `HASH_XXHASH64` partitions on the
+ * remainder of the 64-bit hash value the same way.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
  * @param input The table to partition
  * @param columns_to_hash Indices of input columns to hash
  * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash function to use
+ * @param seed Optional seed of the hash function
  * @param mr Optional resource to use for device memory allocation
  *
  * @returns An output table and a vector of row offsets to each partition
  */
 std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions the rows of a chunked table as `hash_partition` partitions
+ * the concatenation of its chunks, without concatenating them.
+ *
+ * Each chunk is partitioned on its own, and the rows of each of its partitions
+ * are copied into the output table after the rows of the same partition of
+ * the preceding chunks. Fixed-width columns are copied into preallocated
+ * output columns, so that the peak memory use is that of the input, the
+ * output, and the partitioning of one chunk. Other columns keep the
+ * partitioned chunks until they are concatenated into the output.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if the chunks have more rows than a column
+ *
+ * @param input The chunked table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash function to use
+ * @param seed Optional seed of the hash function
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition(
+  chunked_table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions rows from the input table into multiple output tables,
+ * also returning the hash value of every output row.
+ *
+ * Partitions as `hash_partition`. The returned INT32 column holds, for each
+ * row of the output table, the hash value that was computed over the
+ * `columns_to_hash` of that row to select its partition. These are the hash
+ * values the hash joins compute over the same columns, so a later join on
+ * them can use the column instead of hashing the rows again.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns An output table, a vector of row offsets to each partition, and a
+ * column of the hash values of the output rows
+ */
+std::tuple<std::unique_ptr<experimental::table>, std::vector<size_type>, std::unique_ptr<column>>
+hash_partition_with_hashes(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Partitions rows from the input table into a contiguous buffer for
+ * each partition.
+ *
+ * Partitions rows of `input` into `num_partitions` bins based on the hash
+ * value of the columns specified by `columns_to_hash`, as `hash_partition`,
+ * and returns each partition as `contiguous_split` would return it. When all
+ * the columns of `input` are fixed-width, the rows are moved directly into the
+ * buffers of their partitions, without materializing the partitioned table.
+ *
+ * Returns no partitions if `num_partitions <= 0`.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns The `num_partitions` partitions, each viewing its own buffer
+ */
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions rows from the input table into ranges of the sorted order
+ * of their keys.
+ *
+ * Splits the rows of `input` into `num_partitions` bins at splitters selected
+ * from a random sample of the `sort_keys` columns, such that every row of a
+ * partition compares less than or equivalent to every row of the next
+ * partition in the order given by `column_order` and `null_precedence`. Rows
+ * with equivalent keys are in the same partition. Rows partitioned into the
+ * same bin are grouped consecutively, in an undefined order, in the output
+ * table. Returns a vector of row offsets to the start of each partition in the
+ * output table.
+ *
+ * The partitions are of roughly equal sizes when `input` has few duplicated
+ * keys; sorting each partition sorts the whole table.
+ *
+ * @throw std::out_of_range if index in `sort_keys` is invalid
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty
+ * and its size is not `sort_keys.size()`
+ *
+ * @param input The table to partition
+ * @param sort_keys Indices of input columns to order the rows by
+ * @param num_partitions The number of partitions to use
+ * @param column_order The order of each key column, all ascending if empty
+ * @param null_precedence The order of the nulls of each key column, all
+ * `null_order::BEFORE` if empty
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  int num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
 /**
  * @brief Round-robin partition.
  *
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/binaryop.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <cuda_runtime.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @file pipeline.hpp
+ * @brief Push-based execution of scan-filter-project-aggregate and
+ * scan-filter-project-probe pipelines over the chunks of a dataset.
+ */
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief A sequence of tables read by a pipeline, e.g., the chunks of a
+ * chunked reader
+ *
+ * `next()` is called from a thread of the pipeline rather than from the thread
+ * that runs the pipeline, one call at a time.
+ */
+class pipeline_source {
+ public:
+  virtual ~pipeline_source() = default;
+
+  /**
+   * @brief Returns whether there are tables left to read
+   */
+  virtual bool has_next() = 0;
+
+  /**
+   * @brief Reads the next table
+   *
+   * @param stream CUDA stream on which to read the table; the pipeline waits
+   * for it before passing the table on
+   */
+  virtual std::unique_ptr<table> next(cudaStream_t stream) = 0;
+};
+
+/**
+ * @brief Creates a source of the chunks of a `chunked_parquet_reader`
+ *
+ * @param args Settings for controlling reading behavior
+ * @param chunk_read_limit Limit on the decoded output size of each chunk, in bytes
+ * @param mr Resource to use for the device memory of the chunks
+ */
+std::unique_ptr<pipeline_source> make_parquet_source(
+  io::read_parquet_args const& args,
+  size_t chunk_read_limit,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Creates a source of the chunks of a `chunked_csv_reader`
+ *
+ * @param args Settings for controlling reading behavior
+ * @param chunk_size Size of the byte window of each chunk
+ * @param mr Resource to use for the device memory of the chunks
+ */
+std::unique_ptr<pipeline_source> make_csv_source(
+  io::read_csv_args const& args,
+  size_t chunk_size,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief The last operator of a pipeline, which consumes the filtered and
+ * projected chunks
+ *
+ * `consume()` is called from the thread that runs the pipeline, one chunk at
+ * a time and in the order of the source.
+ */
+class pipeline_sink {
+ public:
+  virtual ~pipeline_sink() = default;
+
+  /**
+   * @brief Consumes a chunk; the view is only valid during the call
+   */
+  virtual void consume(table_view const& chunk) = 0;
+};
+
+/**
+ * @brief A sink aggregating the chunks into the partial results of a
+ * `streaming_groupby`
+ *
+ * The groupby must outlive the sink; call `finalize()` on it once the
+ * pipeline has run.
+ */
+class groupby_sink : public pipeline_sink {
+ public:
+  /**
+   * @brief Constructs a sink aggregating the `value_indices` columns of each
+   * chunk grouped by its `key_indices` columns
+   *
+   * @param groupby The streaming groupby whose partial results are updated
+   * @param key_indices The columns of the chunks acting as the groupby keys
+   * @param value_indices The columns of the chunks to aggregate
+   * @param mr Memory resource used to allocate the partial results
+   */
+  groupby_sink(groupby::streaming_groupby& groupby,
+               std::vector<size_type> key_indices,
+               std::vector<size_type> value_indices,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : _groupby(groupby),
+      _key_indices(std::move(key_indices)),
+      _value_indices(std::move(value_indices)),
+      _mr(mr) {}
+
+  void consume(table_view const& chunk) override;
+
+ private:
+  groupby::streaming_groupby& _groupby;
+  std::vector<size_type> _key_indices;
+  std::vector<size_type> _value_indices;
+  rmm::mr::device_memory_resource* _mr;
+};
+
+/**
+ * @brief A sink probing a `hash_join` with the chunks and collecting the
+ * inner join results
+ *
+ * The hash join must outlive the sink.
+ */
+class join_probe_sink : public pipeline_sink {
+ public:
+  /**
+   * @brief Constructs a sink joining each chunk with the build table of `join`
+   *
+   * @param join The hash join to probe
+   * @param probe_on The columns of the chunks to join on
+   * @param columns_in_common The pairs of columns of the chunks and of the
+   * build table that are in common, as in `hash_join::inner_join`
+   * @param mr Memory resource used to allocate the results
+   */
+  join_probe_sink(hash_join const& join,
+                  std::vector<size_type> probe_on,
+                  std::vector<std::pair<size_type, size_type>> columns_in_common = {},
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : _join(join),
+      _probe_on(std::move(probe_on)),
+      _columns_in_common(std::move(columns_in_common)),
+      _mr(mr) {}
+
+  void consume(table_view const& chunk) override;
+
+  /**
+   * @brief Returns the join result of each chunk consumed so far, in order,
+   * and clears them from the sink
+   */
+  std::vector<std::unique_ptr<table>> release() { return std::move(_results); }
+
+ private:
+  hash_join const& _join;
+  std::vector<size_type> _probe_on;
+  std::vector<std::pair<size_type, size_type>> _columns_in_common;
+  rmm::mr::device_memory_resource* _mr;
+  std::vector<std::unique_ptr<table>> _results;
+};
+
+/**
+ * @brief The operators applied to each chunk between the source and the sink
+ */
+struct pipeline_options {
+  /// BOOL8 predicate on the columns of the chunks selecting the rows to keep,
+  /// as in `filter_and_select`; nullptr keeps all the rows
+  expression const* filter = nullptr;
+  /// The columns of the chunks to keep; empty keeps all the columns
+  std::vector<size_type> columns{};
+  /// Expressions on the kept columns, each appended as a column after them
+  std::vector<expression const*> projections{};
+  /// Maximum number of chunks read ahead of the chunk being consumed
+  size_type max_chunks_in_flight = 2;
+};
+
+/**
+ * @brief Streams the tables of `source` through the filter and projections of
+ * `options` and into `sink`
+ *
+ * The source is read from a separate thread, on its own non-blocking stream,
+ * while the calling thread filters and projects the previous chunks and passes
+ * them to the sink, so host I/O, decoding and compute overlap without the
+ * calling thread waiting for the reads. The filter and projections of a chunk
+ * are each evaluated by a single kernel, and the unselected columns are never
+ * copied.
+ *
+ * At most `options.max_chunks_in_flight` chunks are read ahead, so the device
+ * memory used is bounded by that many chunks of the source, plus the chunk
+ * being consumed and its filtered and projected columns, plus the memory of the
+ * sink. The source is stopped as soon as the sink throws.
+ *
+ * @throws cudf::logic_error if `options.max_chunks_in_flight` is not positive
+ * @throws cudf::logic_error if the filter or a projection is not valid for a
+ * chunk, as in `filter_and_select` and `compute_column`
+ * @throws Any exception thrown by the source or the sink
+ *
+ * @param source The tables to read
+ * @param sink The operator consuming the filtered and projected tables
+ * @param options The filter and projections to apply
+ * @param mr Resource to use for the device memory of the filtered and
+ * projected columns
+ */
+void run_pipeline(pipeline_source& source,
+                  pipeline_sink& sink,
+                  pipeline_options const& options     = {},
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace experimental
+}  // namespace cudf
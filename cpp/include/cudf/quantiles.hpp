@@ -90,5 +90,71 @@ std::unique_ptr<table> quantiles(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
+/**
+ * @brief Builds the t-digest of the values of a column.
+ *
+ * A t-digest summarizes the distribution of values with at most
+ * `max_centroids` centroids, i.e., weighted means of neighbouring values, kept
+ * smaller near the extreme quantiles. It is built without sorting the column,
+ * digests of parts of a dataset can be merged with `merge_tdigests`, e.g., on
+ * the nodes of a distributed query, and `approx_quantiles` computes any
+ * quantile from it.
+ *
+ * A column of t-digests is a STRUCT column with, for each digest, a LIST of
+ * its centroids, STRUCTs of their FLOAT64 mean and weight sorted by mean,
+ * and the FLOAT64 smallest and largest value. Nulls and non-finite values
+ * are not digested. A digest without values has no centroid and bounds of 0.
+ *
+ * @throws cudf::logic_error if `values` is not arithmetic
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param values The values to digest
+ * @param max_centroids The maximum number of centroids of the digest. More
+ * centroids make the quantiles more accurate.
+ * @param mr Memory resource to allocate the digest with
+ * @returns A column of one t-digest
+ */
+std::unique_ptr<column> make_tdigest(
+  column_view const& values,
+  int max_centroids                   = 1000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Merges a column of t-digests into one t-digest.
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param digests The t-digests to merge, as built by `make_tdigest`
+ * @param max_centroids The maximum number of centroids of the merged digest
+ * @param mr Memory resource to allocate the digest with
+ * @returns A column of one t-digest of all the values of `digests`
+ */
+std::unique_ptr<column> merge_tdigests(
+  column_view const& digests,
+  int max_centroids                   = 1000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes approximate quantiles from t-digests.
+ *
+ * The quantiles are interpolated linearly between the centroids, as `quantile`
+ * interpolates between the sorted values with `interpolation::LINEAR`, so
+ * they are exact when the digest holds one centroid per value.
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ * @throws cudf::logic_error if a quantile is not in [0, 1]
+ *
+ * @param digests The t-digests to compute the quantiles of
+ * @param q The desired quantiles in range [0, 1]
+ * @param mr Memory resource to allocate the result with
+ * @returns FLOAT64 column whose row `i * q.size() + j` is the quantile `q[j]`
+ * of digest `i`, null if the digest has no value
+ */
+std::unique_ptr<column> approx_quantiles(
+  column_view const& digests,
+  std::vector<double> const& q,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
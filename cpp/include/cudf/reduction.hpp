@@ -18,7 +18,13 @@
 
 #include <cudf/cudf.h>
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -44,6 +50,11 @@ enum class scan_type : bool { INCLUSIVE, EXCLUSIVE };
  * type. For `mean`, `var` and `std` ops, a floating point output type must be 
  * specified. If the input column has non-arithmetic type
  *   eg.(timestamp, string...), the same type must be specified.
+ * Fixed-point columns support `sum`, `min` and `max` into a fixed-point
+ * output_dtype of the same scale, e.g. DECIMAL64 to sum a DECIMAL32 column.
+ *
+ * @throws `cudf::logic_error` if a fixed-point reduction has another operator,
+ * or an output type that is not fixed-point of the same scale.
  *
  * @param[in] col Input column view
  * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
@@ -59,6 +70,167 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the reduction of the values in all rows of a chunked column.
+ *
+ * The result is the reduction of the concatenation of the chunks, computed
+ * without concatenating them: each chunk is reduced on its own and the partial
+ * results are combined. `sum`, `product`, `min`, `max`, `any`, `all` and
+ * `sum_of_squares` combine the partial results of the chunks into
+ * `output_dtype`; `mean`, `var` and `std` combine the count, mean and sum of
+ * squared deviations of each chunk in double precision.
+ *
+ * @throws `cudf::logic_error` for any other operator.
+ * @throws `cudf::logic_error` if `mean`, `var` or `std` have an output type
+ * other than FLOAT32 or FLOAT64.
+ *
+ * @param[in] col Input chunked column view
+ * @param[in] agg unique_ptr of the aggregation operator applied by the reduction
+ * @param[in] output_dtype  The computation and output precision.
+ * @params[in] mr The resource to use for all allocations
+ * @returns  cudf::scalar the result value, which is not valid if there are no
+ * valid elements in any chunk
+ */
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief A set of reductions of a column
+ *
+ * `output_dtypes[i]` is the output type of `aggregations[i]`.
+ */
+struct reduction_request {
+  column_view values;                                      ///< The elements to reduce
+  std::vector<std::unique_ptr<aggregation>> aggregations;  ///< Desired reductions
+  std::vector<data_type> output_dtypes;                    ///< Output type of each reduction
+};
+
+/**
+ * @brief Computes several reductions of the values in all rows of a column.
+ *
+ * Each reduction returns the same scalar as
+ * `reduce(col, aggs[i], output_dtypes[i])`. The `sum`, `product`,
+ * `sum_of_squares`, `min`, `max`, `any`, `all`, `mean`, `var` and `std`
+ * reductions of an arithmetic column with the same output type are computed
+ * together in a single pass over the column.
+ *
+ * @throws `cudf::logic_error` if `aggs.size() != output_dtypes.size()`
+ * @throws `cudf::logic_error` in the cases where `reduce` throws
+ *
+ * @param[in] col Input column view
+ * @param[in] aggs The aggregation operators applied by the reductions
+ * @param[in] output_dtypes The computation and output precision of each
+ * reduction
+ * @params[in] mr The resource to use for all allocations
+ * @returns  One scalar for each reduction in `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const &col,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  std::vector<data_type> const &output_dtypes,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the reductions of many columns, e.g., of all the columns of
+ * a table
+ *
+ * The results are those of `reduce(request.values, request.aggregations,
+ * request.output_dtypes)` for every request. All the fused passes are
+ * launched before the results are copied back together, so the host waits
+ * once for all the columns.
+ *
+ * @throws `cudf::logic_error` if the `aggregations` and `output_dtypes` of a
+ * request are not the same size
+ * @throws `cudf::logic_error` in the cases where `reduce` throws
+ *
+ * @param[in] requests The columns to reduce and their reductions
+ * @params[in] mr The resource to use for all allocations
+ * @returns  For each request, one scalar for each of its reductions
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  std::vector<reduction_request> const &requests,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief The statistics of the chunks of a column computed by `describe`
+ *
+ * Each column has `num_chunks + 1` rows: row `i < num_chunks` describes the
+ * rows `[i * chunk_size, (i + 1) * chunk_size)` of the input column, and the
+ * last row describes the whole column.
+ *
+ * The `min`, `max` and `sum` are INT64 for boolean, integer and timestamp
+ * columns, the timestamps in units of their own type, and FLOAT64 for float
+ * columns. For string columns, `min` and `max` are STRING and `sum` is the
+ * INT64 total length of the strings in bytes. They are null in the rows of the
+ * chunks that only have nulls.
+ */
+struct column_description {
+  std::unique_ptr<column> null_count;  ///< INT32 number of nulls
+  std::unique_ptr<column> min;         ///< Minimum of the non-null values
+  std::unique_ptr<column> max;         ///< Maximum of the non-null values
+  std::unique_ptr<column> sum;         ///< Sum of the non-null values
+};
+
+/**
+ * @brief Computes the null count, minimum, maximum and sum of the chunks of
+ * rows of every column of a table
+ *
+ * The statistics of all the chunks of all the columns are gathered by a single
+ * kernel launch, with one block for each chunk of a column, and those of the
+ * whole columns are merged from them by a second launch; the host waits once
+ * for the table. This is how the ORC writer computes its row group, stripe and
+ * file statistics.
+ *
+ * @throws `cudf::logic_error` if `chunk_size` is negative
+ * @throws `cudf::logic_error` if a column is not of a boolean, integer, float,
+ * timestamp or string type
+ *
+ * @param[in] input The columns to describe
+ * @param[in] chunk_size The number of rows of each chunk but the last; 0 for a
+ * single chunk with all the rows
+ * @params[in] mr The resource to use for all allocations
+ * @returns  The statistics of each column of `input`
+ */
+std::vector<column_description> describe(
+  table_view const &input,
+  size_type chunk_size                = 0,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the reduction of the values in each segment of a column.
+ *
+ * Segment `i` is the rows `[offsets[i], offsets[i + 1])` of `col`, e.g., a
+ * group of a sorted column or the rows of a list, and row `i` of the result is
+ * its reduction, as computed by `reduce`. The null values are skipped, and the
+ * result row of a segment that is empty or only has nulls is null. The result
+ * has a null mask if `col` has nulls or some segment is empty.
+ *
+ * Only the `sum`, `product`, `sum_of_squares`, `min`, `max`, `any` and `all`
+ * aggregations are supported, with the types supported by `reduce`.
+ *
+ * @throws `cudf::logic_error` if `offsets` is not INT32 or has nulls
+ * @throws `cudf::logic_error` if the aggregation is not supported
+ * @throws `cudf::logic_error` if input column data type is not convertible to
+ * output data type.
+ *
+ * @param[in] col Input column view
+ * @param[in] offsets The `num_segments + 1` offsets of the segments of `col`.
+ * They must be non-decreasing and within `[0, col.size()]`.
+ * @param[in] agg unique_ptr of the aggregation operator applied to each segment
+ * @param[in] output_dtype  The computation and output precision.
+ * @params[in] mr The resource to use for all allocations
+ * @returns The `num_segments` reductions
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &col,
+  column_view const &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /** --------------------------------------------------------------------------*
  * @brief  Computes the scan of a column.
  * The null values are skipped for the operation, and if an input element
@@ -82,5 +254,40 @@ std::unique_ptr<column> scan(const column_view &input,
                              include_nulls include_nulls_flag    = include_nulls::NO,
                              rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the scan of each segment of a column.
+ *
+ * Segment `i` is the rows `[offsets[i], offsets[i + 1])` of `input`, e.g., a
+ * group of a sorted column, and the scan restarts at the first row of each
+ * segment: row `j` of the result is the scan, as computed by `scan`, of the
+ * rows of its segment up to row `j`. With `include_nulls::YES`, a result row
+ * is null if a row of its segment up to it (before it for an exclusive scan)
+ * is null. This computes, e.g., the cumulative sum of each group in one pass.
+ *
+ * Only arithmetic columns and the `sum`, `product`, `min` and `max`
+ * aggregations are supported.
+ *
+ * @throws `cudf::logic_error` if `offsets` is not INT32 or has nulls
+ * @throws `cudf::logic_error` if column datatype is not arithmetic
+ *
+ * @param[in] input The input column view for the scan
+ * @param[in] offsets The `num_segments + 1` offsets of the segments of
+ * `input`. They must be non-decreasing, start at `0` and end at `input.size()`.
+ * @param[in] agg unique_ptr to aggregation operator applied by the scan
+ * @param[in] inclusive The flag for applying an inclusive scan if
+ *            scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param[in] include_nulls_flag Exclude null values when computing the result if
+ * include_nulls::NO. Include nulls if include_nulls::YES.
+ * @params[in] mr The resource to use for all allocations
+ * @returns The column of the scans of the segments, of the size of `input`
+ */
+std::unique_ptr<column> segmented_scan(
+  const column_view &input,
+  const column_view &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  scan_type inclusive,
+  include_nulls include_nulls_flag    = include_nulls::NO,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <memory>
+#include <vector>
 #include "cudf/types.hpp"
 
 namespace cudf {
@@ -44,6 +46,50 @@ namespace experimental {
 std::unique_ptr<column> interleave_columns(
   table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Order of the elements of a dense matrix.
+ */
+enum class matrix_order : bool {
+  ROW_MAJOR,    ///< The elements of each row are consecutive
+  COLUMN_MAJOR  ///< The elements of each column are consecutive
+};
+
+/**
+ * @brief Converts the numeric columns of a table into one dense matrix of
+ * `type` elements.
+ *
+ * The matrix has `input.num_rows()` rows and `input.num_columns()` columns,
+ * without padding between them, in the given `order`. Each element is cast to
+ * `type`, and null elements are replaced by `null_fill`. The conversion is done
+ * in a single pass: the row-major order is written through shared memory tiles
+ * so both the reads of the columns and the writes of the rows are coalesced.
+ *
+ * Example:
+ * ```
+ * input     = [[1, 2, null], [4.5, 5.5, 6.5]]
+ * type      = FLOAT32
+ * null_fill = 0
+ * return    = [1, 4.5, 2, 5.5, 0, 6.5]
+ * ```
+ *
+ * @throws cudf::logic_error if `type` or the type of a column of `input` is not numeric
+ * @throws cudf::logic_error if `null_fill` is not of type `type`
+ * @throws cudf::logic_error if `input` has nulls and `null_fill` is not valid
+ *
+ * @param[in] input Table whose columns are converted.
+ * @param[in] type Type of the matrix elements.
+ * @param[in] null_fill Value of the null elements.
+ * @param[in] order Order of the matrix elements.
+ *
+ * @return The device memory of the matrix
+ */
+std::unique_ptr<rmm::device_buffer> to_dense_matrix(
+  table_view const& input,
+  data_type type,
+  scalar const& null_fill,
+  matrix_order order                  = matrix_order::ROW_MAJOR,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /*
  * @brief Repeats the rows from `input` table `count` times to form a new table.
  * 
@@ -63,5 +109,102 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replicates each row of `input` once per element of its list in the
+ * LIST column `explode_column_idx`, which is replaced by the elements.
+ *
+ * The other columns of each row are repeated for each element of its list, and
+ * the rows of null and empty lists are dropped. The output is computed with a
+ * single gather of the other columns and a copy of the elements.
+ *
+ * Example:
+ * ```
+ * input  = [[1, 2, 3], [[a, b], [], [c]]]
+ * explode_column_idx = 1
+ * return = [[1, 1, 3], [a, b, c]]
+ * ```
+ *
+ * @throws cudf::logic_error if `explode_column_idx` is not a column of `input`
+ * @throws cudf::logic_error if the column `explode_column_idx` is not a LIST column
+ *
+ * @param[in] input Table whose rows are exploded.
+ * @param[in] explode_column_idx Index of the LIST column to explode.
+ *
+ * @return The table of the exploded rows
+ */
+std::unique_ptr<table> explode(
+  table_view const& input,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Unpivots the columns `value_columns` of `input` into rows.
+ *
+ * Each value column gives `input.num_rows()` consecutive output rows, in the
+ * order of `value_columns`. The output columns are the `id_columns` of the
+ * rows, an `INT32` column of the index in `value_columns` of the column of each
+ * value, and the column of the values.
+ *
+ * Example:
+ * ```
+ * input         = [[1, 2], [A1, A2], [B1, B2]]
+ * id_columns    = {0}
+ * value_columns = {1, 2}
+ * return        = [[1, 2, 1, 2], [0, 0, 1, 1], [A1, A2, B1, B2]]
+ * ```
+ *
+ * @throws cudf::logic_error if `value_columns` is empty
+ * @throws cudf::logic_error if the value columns are not of the same type
+ *
+ * @param[in] input Table whose columns are unpivoted.
+ * @param[in] id_columns Indices of the columns repeated for each value.
+ * @param[in] value_columns Indices of the columns of the values.
+ *
+ * @return The table of the id columns, the value column indices and the values
+ */
+std::unique_ptr<table> melt(
+  table_view const& input,
+  std::vector<size_type> const& id_columns,
+  std::vector<size_type> const& value_columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Pivots `values` into a table of `num_columns` columns of `num_rows`
+ * rows, the inverse of `melt`.
+ *
+ * Value `i` is element `row_indices[i]` of output column `column_indices[i]`.
+ * The elements without a value, and the values whose indices are out of
+ * bounds, are null. Each pair of indices must be given at most once. The value
+ * of every element is found with a single scatter of the indices.
+ *
+ * Example:
+ * ```
+ * values         = [A1, B2, A2]
+ * row_indices    = [0, 1, 1]
+ * column_indices = [0, 1, 0]
+ * num_rows = 2, num_columns = 2
+ * return         = [[A1, A2], [null, B2]]
+ * ```
+ *
+ * @throws cudf::logic_error if the indices are not `INT32` columns without nulls of the size of
+ * `values`
+ * @throws cudf::logic_error if `num_rows` or `num_columns` is negative
+ *
+ * @param[in] values The values to pivot.
+ * @param[in] row_indices Output row of each value.
+ * @param[in] column_indices Output column of each value.
+ * @param[in] num_rows Number of rows of the output.
+ * @param[in] num_columns Number of columns of the output.
+ *
+ * @return The table of the pivoted values
+ */
+std::unique_ptr<table> pivot(
+  column_view const& values,
+  column_view const& row_indices,
+  column_view const& column_indices,
+  size_type num_rows,
+  size_type num_columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
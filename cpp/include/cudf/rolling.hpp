@@ -18,10 +18,22 @@
 
 #include <cudf/types.hpp>
 
+#include <limits>
 #include <memory>
 
 namespace cudf {
 namespace experimental {
+namespace groupby {
+
+class groupby;
+
+}  // namespace groupby
+
+/**
+ * @brief Window size of `grouped_rolling_window()` spanning all the rows of the group before
+ * (including the current row) or after the current row
+ */
+constexpr size_type UNBOUNDED_WINDOW = std::numeric_limits<size_type>::max();
 
 /**
  * @brief  Applies a fixed-size rolling window function to the values in a column.
@@ -115,6 +127,16 @@ std::unique_ptr<column> rolling_window(
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
  *
+ * With `preceding_window == UNBOUNDED_WINDOW` and `following_window == 0`, the `SUM`, `PRODUCT`,
+ * `MIN` and `MAX` of numeric columns and the `COUNT` of any column are the running aggregates of
+ * each group, which are computed by a single segmented scan instead of window by window.
+ *
+ * The SQL window functions that do not aggregate a window are also supported, and ignore the window
+ * sizes and `min_periods`:
+ * - `ROW_NUMBER` returns the `INT32` number of each row in its group, from 1.
+ * - `LEAD` and `LAG` return the value of the row `offset` rows after or before each row in its
+ *   group, and null if there is no such row; see the overload with default outputs.
+ *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] input The input column (to be aggregated)
  * @param[in] preceding_window The static rolling window size in the backward direction.
@@ -134,6 +156,102 @@ std::unique_ptr<column> grouped_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column,
+ * with the groups of a `groupby` object.
+ *
+ * Same as `grouped_rolling_window()` on the keys of `grouping`, except the group offsets and labels
+ * are those memoized by `grouping`. They are computed on first use, and shared with the
+ * `aggregate` and `get_groups` calls and the rolling windows on the same `grouping`, so the keys
+ * are grouped only once.
+ *
+ * The rows of `input` must be in the order of the grouped keys, e.g. the values returned by
+ * `grouping.get_groups()`, or in their original order when `grouping` was constructed with
+ * `sorted::YES`.
+ *
+ * @throws cudf::logic_error if the number of grouped keys of `grouping` is not `input.size()`
+ *
+ * @param[in] grouping The groupby whose keys group `input`
+ * @param[in] input The input column (to be aggregated), in the order of the grouped keys
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(
+  groupby::groupby& grouping,
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column,
+ * with the outputs of the `LEAD` and `LAG` functions of the rows without a following or preceding
+ * row in their group.
+ *
+ * Same as `grouped_rolling_window()`, except that a row that has no row `offset` rows after (for
+ * `LEAD`) or before (for `LAG`) it in its group returns `default_outputs[i]` instead of null.
+ *
+ * @throws cudf::logic_error if `default_outputs` is not of the type and size of `input`
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] input The input column (to be aggregated)
+ * @param[in] default_outputs The outputs of the rows without a following or preceding row
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (LEAD, LAG, SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(
+  table_view const& group_keys,
+  column_view const& input,
+  column_view const& default_outputs,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column,
+ * with the groups of a `groupby` object and the outputs of the `LEAD` and `LAG` functions of the
+ * rows without a following or preceding row in their group.
+ *
+ * Same as the `grouped_rolling_window()` with default outputs, on the groups of `grouping`.
+ *
+ * @throws cudf::logic_error if the number of grouped keys of `grouping` is not `input.size()`
+ * @throws cudf::logic_error if `default_outputs` is not of the type and size of `input`
+ *
+ * @param[in] grouping The groupby whose keys group `input`
+ * @param[in] input The input column (to be aggregated), in the order of the grouped keys
+ * @param[in] default_outputs The outputs of the rows without a following or preceding row
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (LEAD, LAG, SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_rolling_window(
+  groupby::groupby& grouping,
+  column_view const& input,
+  column_view const& default_outputs,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a column.
  *
@@ -219,6 +337,40 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a
+ * column, with the groups of a `groupby` object.
+ *
+ * Same as `grouped_time_range_rolling_window()` on the keys of `grouping`, except the group offsets
+ * and labels are those memoized by `grouping`, as for the `grouped_rolling_window()` that takes a
+ * `groupby`.
+ *
+ * The rows of `timestamp_column` and `input` must be in the order of the grouped keys, and the
+ * timestamps sorted within each group.
+ *
+ * @throws cudf::logic_error if the number of grouped keys of `grouping` is not `input.size()`
+ *
+ * @param[in] grouping The groupby whose keys group `input`
+ * @param[in] timestamp_column The (pre-sorted) timestamps for each row
+ * @param[in] input The input column (to be aggregated), in the order of the grouped keys
+ * @param[in] preceding_window_in_days The rolling window time-interval in the backward direction.
+ * @param[in] following_window_in_days The rolling window time-interval in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+ *
+ * @returns   A nullable output column containing the rolling window results
+ **/
+std::unique_ptr<column> grouped_time_range_rolling_window(
+  groupby::groupby& grouping,
+  column_view const& timestamp_column,
+  column_view const& input,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -237,6 +389,10 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
  * The returned column for count aggregation always has INT32 type. All other operators return a 
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ *
+ * Numeric columns also support `VARIANCE` and `STD`, which return `FLOAT64` columns and are null
+ * for windows with at most `ddof` valid elements. `NTH_ELEMENT` selects the `n`th element of each
+ * window of a numeric or timestamp column, and is null if the window has no such element.
  * 
  * @throws cudf::logic_error if window column type is not INT32
  *
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief Converts a table of fixed-width columns to packed row-major records.
+ *
+ * Each row is a record of the elements of its columns, in column order, each
+ * aligned to its size, followed by one validity byte for every 8 columns: bit
+ * `i % 8` of validity byte `i / 8` is set if the element of column `i` is
+ * valid. Records are padded to a multiple of 8 bytes. This is the row format
+ * of the JCUDF (Spark) row conversion.
+ *
+ * The records are returned as LIST columns of INT8, each row of a list being
+ * one record. The rows are split in as many list columns as needed to keep
+ * the bytes of each one under the column size limit.
+ *
+ * @throw cudf::logic_error if `input` has no columns
+ * @throw cudf::logic_error if a column is not fixed-width
+ * @throw cudf::logic_error if a record is larger than 48KB
+ *
+ * @param input The table to convert
+ * @param mr Memory resource to allocate the records with
+ * @return The LIST columns of the records of consecutive row ranges
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts packed row-major records back to a table.
+ *
+ * This is the inverse of `convert_to_rows` for one of its list columns. All
+ * the columns of the output are nullable.
+ *
+ * @throw cudf::logic_error if `input` is not a LIST of INT8 without nulls
+ * @throw cudf::logic_error if the records of `input` do not have the size of
+ * the records of `schema`
+ * @throw cudf::logic_error if `schema` is empty
+ * @throw cudf::logic_error if a type of `schema` is not fixed-width
+ *
+ * @param input The LIST column of records
+ * @param schema The types of the columns of the records
+ * @param mr Memory resource to allocate the table with
+ * @return The table of the records
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace experimental
+}  // namespace cudf
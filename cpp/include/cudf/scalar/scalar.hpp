@@ -233,6 +233,50 @@ class numeric_scalar : public detail::fixed_width_scalar<T> {
         std::forward<rmm::device_scalar<T>>(data), is_valid, stream, mr) {}
 };
 
+/**
+ * @brief An owning class to represent a fixed-point decimal value in device memory
+ *
+ * The value is `rep * 10^scale` where `rep` is the stored integer.
+ *
+ * @tparam T the representation type, int32_t for DECIMAL32 or int64_t for DECIMAL64
+ */
+template <typename T>
+class fixed_point_scalar : public detail::fixed_width_scalar<T> {
+  static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value,
+                "Unexpected fixed-point representation type.");
+
+ public:
+  fixed_point_scalar()                                = delete;
+  ~fixed_point_scalar()                               = default;
+  fixed_point_scalar(fixed_point_scalar&& other)      = default;
+  fixed_point_scalar(fixed_point_scalar const& other) = default;
+  fixed_point_scalar& operator=(fixed_point_scalar const& other) = delete;
+  fixed_point_scalar& operator=(fixed_point_scalar&& other) = delete;
+
+  /**
+   * @brief Construct a new fixed-point scalar object
+   *
+   * @param rep The initial integer representation of the scalar
+   * @param scale The base 10 exponent of the value
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream The CUDA stream to do the allocation in
+   * @param mr The memory resource to use for allocation
+   */
+  fixed_point_scalar(T rep,
+                     int32_t scale,
+                     bool is_valid                       = true,
+                     cudaStream_t stream                 = 0,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : detail::fixed_width_scalar<T>(rep, is_valid, stream, mr) {
+    this->_type = data_type{std::is_same<T, int32_t>::value ? DECIMAL32 : DECIMAL64, scale};
+  }
+
+  /**
+   * @brief Returns the base 10 exponent of the value
+   */
+  int32_t scale() const noexcept { return this->_type.scale(); }
+};
+
 /**
  * @brief An owning class to represent a string in device memory
  */
@@ -55,6 +55,25 @@ std::unique_ptr<scalar> make_timestamp_scalar(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Construct scalar with uninitialized storage to hold a value of the
+ * specified fixed-point `data_type` and a validity bool.
+ *
+ * The scalar has the scale of `type`.
+ *
+ * @throws std::bad_alloc if device memory allocation fails
+ * @throws cudf::logic_error if `type` is not a fixed-point type
+ *
+ * @param type The desired fixed-point element type
+ * @param stream Optional stream on which to issue all memory allocations
+ * @param mr Optional resource to use for device memory
+ *           allocation of the scalar's `data` and `is_valid` bool.
+ */
+std::unique_ptr<scalar> make_fixed_point_scalar(
+  data_type type,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Construct STRING type scalar given a `std::string`.
  * The size of the `std::string` must not exceed the maximum size of size_type.
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Reads the validities and values of a batch of scalars back to the host
+ * without synchronizing the stream
+ *
+ * `scalar::is_valid()` and `value()` each copy from device memory and wait for
+ * the stream, so reading the results of hundreds of reductions waits hundreds of
+ * times. A `scalar_readback` gathers the validities and values of all its scalars
+ * with a single kernel, copies them into pinned host memory with a single copy
+ * and records an event, all asynchronously on `stream`. The accessors wait for
+ * that event only, once, and then read host memory.
+ *
+ * Fixed-width and string scalars are supported. The scalars must not be modified
+ * or destroyed before the copy has completed, i.e., before `ready()` returns true
+ * or one of the accessors returns.
+ *
+ * Example:
+ * ```
+ * std::vector<std::unique_ptr<scalar>> sums = ...;  // from experimental::reduce
+ * scalar_readback readback(sums, stream);
+ * // ... queue more work ...
+ * for (size_type i = 0; i < readback.size(); ++i) {
+ *   if (readback.is_valid(i)) { total += readback.value<int64_t>(i); }
+ * }
+ * ```
+ */
+class scalar_readback {
+ public:
+  scalar_readback()                       = delete;
+  scalar_readback(scalar_readback const&) = delete;
+  scalar_readback& operator=(scalar_readback const&) = delete;
+  ~scalar_readback();
+
+  /**
+   * @brief Starts copying the validities and values of `scalars` to the host
+   *
+   * @throws cudf::logic_error if a scalar is null or neither fixed-width nor a
+   * string
+   *
+   * @param scalars The scalars to read
+   * @param stream CUDA stream on which to gather and copy the scalars
+   */
+  scalar_readback(std::vector<scalar const*> const& scalars, cudaStream_t stream = 0);
+
+  /**
+   * @copydoc scalar_readback(std::vector<scalar const*> const&, cudaStream_t)
+   */
+  scalar_readback(std::vector<std::unique_ptr<scalar>> const& scalars, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the number of scalars read
+   */
+  size_type size() const { return static_cast<size_type>(_types.size()); }
+
+  /**
+   * @brief Returns whether the copy to the host has completed, without waiting
+   */
+  bool ready() const;
+
+  /**
+   * @brief Waits for the copy to the host to complete
+   */
+  void wait() const;
+
+  /**
+   * @brief Returns the validity of scalar `i`, waiting for the copy if needed
+   *
+   * @throws cudf::logic_error if `i` is out of bounds
+   */
+  bool is_valid(size_type i) const;
+
+  /**
+   * @brief Returns the value of scalar `i`, waiting for the copy if needed
+   *
+   * Using the value of a scalar that is not valid is undefined behaviour.
+   *
+   * @throws cudf::logic_error if `i` is out of bounds or `T` is not the type the
+   * scalar is dispatched to, e.g., `int32_t` for a `DECIMAL32` scalar
+   *
+   * @tparam T The type of the value
+   */
+  template <typename T>
+  T value(size_type i) const {
+    T result;
+    std::memcpy(&result, value_data(i, experimental::type_to_id<T>()), sizeof(T));
+    return result;
+  }
+
+  /**
+   * @brief Returns the value of string scalar `i`, waiting for the copy if needed
+   *
+   * @throws cudf::logic_error if `i` is out of bounds or scalar `i` is not a
+   * string
+   */
+  std::string to_string(size_type i) const;
+
+ private:
+  void const* value_data(size_type i, type_id id) const;
+
+  std::vector<data_type> _types;      ///< Type of each scalar
+  std::vector<std::size_t> _offsets;  ///< Offset of each value in the host copy
+  std::vector<size_type> _sizes;      ///< Size in bytes of each value
+  char* _host{};                      ///< Pinned host copy of the validities and values
+  rmm::device_buffer _device;         ///< Gathered validities and values, and their descriptors
+  cudaEvent_t _copied{};              ///< Recorded after the copy to `_host`
+};
+
+}  // namespace cudf
@@ -162,5 +162,73 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  How a `value_set` looks up the elements of a column
+ */
+enum class membership_method {
+  HASH,          ///< Probe a hash table of the values
+  BINARY_SEARCH  ///< Binary search the sorted values
+};
+
+/**
+ * @brief  Set of the values of a column, built once and tested against any
+ * number of columns
+ *
+ * Filtering a stream of columns with `contains(haystack, needles)` against
+ * the same, possibly large, list of `needles` (e.g., an IN-list of IDs)
+ * builds the hash table of `needles` on every call; this object only pays the
+ * build cost in its constructor.
+ *
+ * `contains(haystack)` returns the same column as
+ * `contains(haystack, needles)` with the `needles` of the constructor. The
+ * values are copied, so `needles` need not outlive the set.
+ */
+class value_set {
+ public:
+  value_set() = delete;
+  ~value_set();
+  value_set(value_set const&) = delete;
+  value_set(value_set&&)      = delete;
+  value_set& operator=(value_set const&) = delete;
+  value_set& operator=(value_set&&) = delete;
+
+  /**
+   * @brief  Builds the set of the non-null values of `needles`
+   *
+   * With `membership_method::BINARY_SEARCH`, the values are sorted instead of
+   * hashed: the set takes as much memory as `needles`, at the cost of a
+   * logarithmic number of comparisons per lookup.
+   *
+   * @throws cudf::logic_error if `needles` is a dictionary, list or struct
+   * column
+   *
+   * @param needles    The values of the set
+   * @param method     How the elements are looked up
+   */
+  explicit value_set(column_view const& needles,
+                     membership_method method = membership_method::HASH);
+
+  /**
+   * @brief  Returns a new column of type bool identifying for each element of
+   * @p haystack whether it is in the set
+   *
+   * @throws cudf::logic_error
+   * If `haystack.type()` is not the type of the values of the set
+   *
+   * @param haystack  A column object
+   * @param mr        Device memory resource to use for device memory allocation
+   *
+   * @return std::unique_ptr<column> A column of bool elements with the null
+   * mask of `haystack`, true where the entry of `haystack` is in the set
+   */
+  std::unique_ptr<column> contains(
+    column_view const& haystack,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+ private:
+  class impl;
+  std::unique_ptr<const impl> _impl;
+};
+
 }  // namespace experimental
 }  // namespace cudf
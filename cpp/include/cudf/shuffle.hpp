@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @file shuffle.hpp
+ * @brief Exchange of the partitions of tables between GPUs.
+ */
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief A partition received by `communicator::all_to_all()`
+ */
+struct received_partition {
+  std::vector<uint8_t> metadata;  ///< The `metadata` of the `packed_table` that was sent
+  rmm::device_buffer data;        ///< The data of the partition, on the device of the receiver
+};
+
+/**
+ * @brief A group of ranks, each using one GPU, that exchange partitions of
+ * tables
+ *
+ * Every rank calls the collective functions with its own communicator, from a
+ * thread whose current device is the device of the rank. Implementations may
+ * transfer the data with CUDA peer-to-peer copies, NCCL, or a network library.
+ */
+class communicator {
+ public:
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the number of ranks
+   */
+  virtual int size() const = 0;
+
+  /**
+   * @brief Returns the rank of this communicator, in [0, size())
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Sends the partition `sends[i]` to rank `i`, and receives the
+   * partition each rank sends to this one
+   *
+   * The partitions are `packed_table`s in `buffer`, e.g., as written by
+   * `contiguous_split(input, splits, buffer, buffer_size)`. The function
+   * returns once `buffer` is no longer needed.
+   *
+   * @throws cudf::logic_error if `sends.size() != size()`
+   *
+   * @param buffer The device memory holding the partitions to send
+   * @param sends The partition to send to each rank
+   * @param mr Resource to use for the device memory of the received partitions
+   * @param stream CUDA stream on which the partitions were written, and on
+   * which the received partitions are accessed
+   * @return The partition received from each rank, in rank order
+   */
+  virtual std::vector<received_partition> all_to_all(void const* buffer,
+                                                     std::vector<packed_table> const& sends,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream) = 0;
+};
+
+/**
+ * @brief Creates the communicators of ranks that are threads of this process
+ *
+ * Rank `i` uses `devices[i]`. Partitions are copied directly from the memory of
+ * the sender to the memory of the receiver, over NVLink or PCIe, with peer
+ * access enabled between the devices that support it, and the copies from the
+ * different senders run concurrently.
+ *
+ * While a collective function is running, a rank waits for the other ranks to
+ * call it: all the ranks must call the same collective functions in the same
+ * order.
+ *
+ * @param devices The device of each rank; a device may be used by several ranks
+ * @return The communicator of each rank
+ */
+std::vector<std::unique_ptr<communicator>> make_peer_communicators(std::vector<int> const& devices);
+
+/**
+ * @brief Redistributes the rows of tables across the ranks of a communicator,
+ * so that the rows with equal keys end up at the same rank
+ *
+ * Each rank calls `shuffle` with its own table. The rows are hash partitioned
+ * into one partition per rank, as `hash_partition` partitions them, and rank
+ * `i` returns the concatenation of the partitions `i` of the tables of all the
+ * ranks, in rank order.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table of this rank
+ * @param columns_to_hash Indices of the key columns
+ * @param comm The communicator of this rank
+ * @param hash_function Optional hash function to use
+ * @param seed Optional seed of the hash function
+ * @param mr Optional resource to use for device memory allocation of the
+ * returned table
+ * @return The rows of all the tables that belong to this rank
+ */
+std::unique_ptr<table> shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  communicator& comm,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace experimental
+}  // namespace cudf
@@ -48,6 +48,8 @@ namespace experimental {
  * @param null_precedence The desired order of null compared to other elements
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned column
+ * @param stream CUDA stream on which to execute kernels and memory copies
  * @return std::unique_ptr<column> A non-nullable column of `size_type` elements
  * containing the permuted row indices of `input` if it were sorted
  *---------------------------------------------------------------------------**/
@@ -55,7 +57,8 @@ std::unique_ptr<column> sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Computes the row indices that would produce `input` in a stable
@@ -68,6 +71,73 @@ std::unique_ptr<column> stable_sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Computes the indices of the first `k` rows of `input` in a stable
+ * lexicographical sorted order.
+ *
+ * The result is the first `min(k, input.num_rows())` elements of
+ * `stable_sorted_order(input, column_order, null_precedence)`, computed
+ * without sorting all of `input`: a sample of the rows selects a pivot row
+ * that at least `k` rows do not exceed, and only those rows are sorted.
+ *
+ * Example:
+ * ```
+ * input:  {5, 1, 4, 1, 3}
+ * k:      3
+ * result: {1, 3, 4}
+ * ```
+ *
+ * @throws cudf::logic_error if `k < 0`
+ *
+ * @param input The table whose first rows in sorted order are selected
+ * @param k The number of row indices to return
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `input.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned column
+ * @return A non-nullable column of `size_type` elements containing the indices
+ * of the first `k` rows of `input` in sorted order
+ */
+std::unique_ptr<column> top_k_order(
+  table_view input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the first `k` rows of `input` in a stable lexicographical
+ * sorted order.
+ *
+ * Equivalent to, and much faster than for `k` small relative to
+ * `input.num_rows()`, the first `k` rows of `sort(input, column_order,
+ * null_precedence)` when equivalent rows are kept in their input order.
+ *
+ * @throws cudf::logic_error if `k < 0`
+ *
+ * @param input The table whose first rows in sorted order are selected
+ * @param k The number of rows to return
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `input.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr The device memory resource used to allocate the returned table
+ * @return New table containing the first `min(k, input.num_rows())` rows of
+ * `input` in sorted order
+ */
+std::unique_ptr<table> top_k(
+  table_view input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
 /**---------------------------------------------------------------------------*
@@ -90,6 +160,46 @@ bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
                std::vector<null_order> const& null_precedence);
 
+/**
+ * @brief The order of the rows of a table, as found by `probe_sortedness()`
+ */
+enum class sortedness : int32_t {
+  SORTED,          ///< Every row is less than or equal to the next one
+  REVERSE_SORTED,  ///< Every row is greater than or equal to the next one
+  NEARLY_SORTED,   ///< Few rows are less than the row before them
+  UNSORTED         ///< None of the above
+};
+
+/**
+ * @brief Classifies the order of the rows of a table in a single pass
+ *
+ * Every row is compared with the next one as `is_sorted()` compares them. The
+ * rows are `NEARLY_SORTED` if at most `max_unsorted_fraction` of these
+ * comparisons find a row less than the row before it, i.e., the table is a
+ * small number of sorted runs. A table of equal rows is `SORTED`.
+ *
+ * To decide whether to sort, `is_sorted()` is cheaper on unsorted data, as it
+ * stops at the first rows out of order.
+ *
+ * @throws cudf::logic_error if `column_order` or `null_precedence` is neither
+ * empty nor of size `table.num_columns()`
+ *
+ * @param table The table whose rows are compared
+ * @param column_order The expected sort order for each column. Size must be
+ * equal to `table.num_columns()` or empty. If empty, all columns are expected
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `table.num_columns()` or empty. If
+ * empty, `null_order::BEFORE` is assumed for all columns.
+ * @param max_unsorted_fraction The largest fraction of the pairs of adjacent
+ * rows that may be out of order in `NEARLY_SORTED` rows
+ * @return The order of the rows
+ */
+sortedness probe_sortedness(table_view const& table,
+                            std::vector<order> const& column_order         = {},
+                            std::vector<null_order> const& null_precedence = {},
+                            double max_unsorted_fraction                   = 0.01);
+
 /**
  * @brief Performs a lexicographic sort of the rows of a table
  *
@@ -102,12 +212,14 @@ bool is_sorted(cudf::table_view const& table,
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr The device memory resource used to allocate the returned table
+ * @param stream CUDA stream on which to execute kernels and memory copies
  * @return New table containing the desired sorted order of `input`
  */
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order         = {},
                             std::vector<null_order> const& null_precedence = {},
-                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                            cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a key-value sort.
@@ -127,6 +239,7 @@ std::unique_ptr<table> sort(table_view input,
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr The device memory resource used to allocate the returned table
+ * @param stream CUDA stream on which to execute kernels and memory copies
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
  */
@@ -135,7 +248,92 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Sorts tables larger than device memory
+ *
+ * The rows are pushed as runs that each fit in device memory. Every run is
+ * sorted on the device by the key columns, split into blocks of
+ * `block_rows` rows and spilled to pinned host memory. `next()` then merges
+ * the runs back into the sorted rows, returned in chunks: one block of every
+ * run, at most, is in device memory at a time, besides the returned chunk
+ * of at most `block_rows` rows per run.
+ *
+ * Example:
+ * ```
+ * external_sorter sorter({0}, {order::ASCENDING});
+ * for (auto const& run : runs) { sorter.push(run); }
+ * while (sorter.has_next()) { write(sorter.next()->view()); }
+ * ```
+ */
+class external_sorter {
+ public:
+  static constexpr size_type default_block_rows = 1 << 20;
+
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter(external_sorter&&)      = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter&&) = delete;
+
+  /**
+   * @brief Constructs a sorter ordering rows by the columns `key_cols`
+   *
+   * @throws cudf::logic_error if `key_cols` is empty
+   * @throws cudf::logic_error if `column_order` and `key_cols` differ in size
+   * @throws cudf::logic_error if `null_precedence` is neither empty nor the
+   * size of `key_cols`
+   * @throws cudf::logic_error if `block_rows` is not positive
+   *
+   * @param key_cols Indices of the key columns of the runs
+   * @param column_order The desired order of each key column
+   * @param null_precedence The desired order of a null element compared to
+   * other elements for each key column. If empty, `null_order::BEFORE` is
+   * assumed for all columns.
+   * @param block_rows The number of rows of the blocks spilled to host memory
+   */
+  external_sorter(std::vector<size_type> const& key_cols,
+                  std::vector<order> const& column_order,
+                  std::vector<null_order> const& null_precedence = {},
+                  size_type block_rows                           = default_block_rows);
+
+  /**
+   * @brief Sorts a run of rows and spills it to host memory
+   *
+   * @throws cudf::logic_error if `next()` was already called
+   * @throws cudf::logic_error if the columns of `run` differ in number or
+   * type from those of previous runs, or there are fewer than needed by the
+   * key columns
+   *
+   * @param run The rows to sort
+   */
+  void push(table_view const& run);
+
+  /**
+   * @brief Returns whether `next()` has rows left to return
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Returns the next chunk of sorted rows
+   *
+   * No more runs may be pushed once this is called.
+   *
+   * @throws cudf::logic_error if `has_next()` is false
+   *
+   * @param mr Device memory resource used to allocate the returned table
+   * @return The rows following those previously returned, in sorted order
+   */
+  std::unique_ptr<table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
 
 /**---------------------------------------------------------------------------*
  * @brief Computes the ranks of input column in sorted order.
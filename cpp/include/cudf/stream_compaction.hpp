@@ -21,6 +21,8 @@
 namespace cudf {
 namespace experimental {
 
+class expression;
+
 /**
  * @brief Filters a table to remove null elements.
  *
@@ -114,13 +116,51 @@ std::unique_ptr<experimental::table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Filters the rows of `input` with a predicate expression, and selects
+ * the columns `column_indices` of the rows passing the filter.
+ *
+ * Row `i` of the selected columns is copied to the output if the predicate,
+ * evaluated on row `i` of `input`, is non-null and `true`. This is the result
+ * of `apply_boolean_mask(input.select(column_indices), compute_column(input,
+ * predicate))`, computed in a single pass without materializing the mask and
+ * reading only the columns referenced by the predicate or selected.
+ * This operation is stable: the input order is preserved.
+ *
+ * The predicate is interpreted rather than JIT compiled, with integral values
+ * computed in 64-bit integers and floating point values in double precision.
+ * It may use the comparison operators, `LOGICAL_AND`, `LOGICAL_OR`, `ADD`,
+ * `SUB`, `MUL`, `DIV` and `TRUE_DIV` between numeric columns and literals.
+ * As for `compute_column()`, the predicate is null for a row if any column it
+ * refers to is null for that row, or if any of its literals is invalid.
+ *
+ * @throws cudf::logic_error if the predicate is not an operation with a `BOOL8` output
+ * @throws cudf::logic_error if the predicate uses an unsupported operator or a
+ * non-numeric column or literal
+ * @throws cudf::logic_error if the predicate or `column_indices` refer to a
+ * column out of range
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicate The expression evaluated on the rows of `input`
+ * @param[in] column_indices Indices of the columns of `input` to return
+ * @param[in] mr Optional, The resource to use for all allocations
+ * @return unique_ptr<table> Table of the selected columns of the rows of @p input
+ * passing the filter defined by @p predicate.
+ */
+std::unique_ptr<experimental::table> filter_and_select(
+  table_view const& input,
+  expression const& predicate,
+  std::vector<size_type> const& column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
 enum class duplicate_keep_option {
   KEEP_FIRST = 0,  ///< Keeps first duplicate row and unique rows
   KEEP_LAST,       ///< Keeps last  duplicate row and unique rows
-  KEEP_NONE        ///< Keeps only unique rows are kept
+  KEEP_NONE,       ///< Keeps only unique rows are kept
+  KEEP_ANY         ///< Keeps one arbitrary row of each set of duplicates, in unspecified order
 };
 
 /**
@@ -131,12 +171,15 @@ enum class duplicate_keep_option {
  * - KEEP_FIRST: only the first of a sequence of duplicate rows is copied
  * - KEEP_LAST: only the last of a sequence of duplicate rows is copied
  * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: one arbitrary row of each set of duplicate rows is copied.
+ *   The rows are found with a hash map rather than by sorting, so the order
+ *   of the output rows is unspecified.
  *
  * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
  *
  * @param[in] input           input table_view to copy only unique rows
  * @param[in] keys            vector of indices representing key columns from `input`
- * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
+ * @param[in] keep            keep first entry, last entry, any entry, or no entries if duplicates found
  * @param[in] nulls_are_equal flag to denote nulls are equal if true,
  * nulls are not equal if false
  * @param[in] mr Optional, The resource to use for all allocations
@@ -172,5 +215,27 @@ cudf::size_type unique_count(column_view const& input,
                              bool const& nan_as_null,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Estimates the number of distinct rows of `input` with a HyperLogLog
+ * sketch
+ *
+ * The rows are hashed in a single pass without sorting or building a hash map,
+ * into a sketch of `2^precision` registers. The relative standard error of the
+ * estimate is about `1.04 / sqrt(2^precision)`, e.g. 1.6% for the default
+ * precision of 12. All null rows are counted as one value.
+ *
+ * @throws cudf::logic_error if `precision` is not in `[4, 18]`
+ *
+ * @param[in] input      The table_view whose distinct rows are counted
+ * @param[in] precision  The base-2 logarithm of the number of registers of the sketch
+ * @param[in] mr Optional, The resource to use for all allocations
+ *
+ * @return estimated number of distinct rows
+ */
+cudf::size_type approx_distinct_count(
+  table_view const& input,
+  int precision                       = 12,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace experimental
 }  // namespace cudf
@@ -17,6 +17,10 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace strings {
@@ -87,5 +91,78 @@ std::unique_ptr<column> count_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a table of boolean columns identifying rows which
+ * match each of the given regex patterns.
+ *
+ * Each string is evaluated once for all the patterns, which is faster than
+ * calling contains_re() for each pattern.
+ *
+ * ```
+ * s = ["abc","123","def456"]
+ * r = contains(s,["\\d+","a"])
+ * r is now [[false, true, true], [true, false, false]]
+ * ```
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match to each string.
+ * @param mr Resource for allocating device memory.
+ * @return New table with a column of boolean results for each pattern.
+ */
+std::unique_ptr<experimental::table> contains_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a table of boolean columns identifying rows which
+ * match each of the given regex patterns but only at the beginning the string.
+ *
+ * Each string is evaluated once for all the patterns.
+ *
+ * ```
+ * s = ["abc","123","def456"]
+ * r = matches(s,["\\d+","a"])
+ * r is now [[false, true, false], [true, false, false]]
+ * ```
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match to each string.
+ * @param mr Resource for allocating device memory.
+ * @return New table with a column of boolean results for each pattern.
+ */
+std::unique_ptr<experimental::table> matches_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the number of times each of the given regex patterns
+ * matches in each string.
+ *
+ * Each string is evaluated once for all the patterns.
+ *
+ * ```
+ * s = ["abc","123","def45"]
+ * r = count(s,["\\d","[a-c]"])
+ * r is now [[0, 3, 2], [3, 0, 0]]
+ * ```
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match within each string.
+ * @param mr Resource for allocating device memory.
+ * @return New table with an INT32 column of counts for each pattern.
+ */
+std::unique_ptr<experimental::table> count_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace strings
 }  // namespace cudf
@@ -61,7 +61,6 @@ std::unique_ptr<cudf::column> gather(
   auto strings_count = strings.size();
   if (output_count == 0) return make_empty_strings_column(mr, stream);
 
-  auto execpol        = rmm::exec_policy(stream);
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
 
@@ -82,17 +81,11 @@ std::unique_ptr<cudf::column> gather(
   auto chars_column = create_chars_child_column(output_count, 0, bytes, mr, stream);
   auto chars_view   = chars_column->mutable_view();
   auto d_chars      = chars_view.template data<char>();
-  // fill in chars
-  auto gather_chars =
-    [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
-      auto index = begin[idx];
-      if (NullifyOutOfBounds && ((index < 0) || (index >= strings_count))) return;
-      if (d_strings.is_null(index)) return;
-      string_view d_str = d_strings.element<string_view>(index);
-      memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
-    };
-  thrust::for_each_n(
-    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), output_count, gather_chars);
+  // fill in chars; only the valid, in-bounds strings are not empty
+  auto gathered_chars = [d_strings, begin] __device__(size_type idx) {
+    return d_strings.element<string_view>(begin[idx]).data();
+  };
+  copy_chars(gathered_chars, d_offsets, output_count, d_chars, bytes, stream);
 
   return make_strings_column(output_count,
                              std::move(offsets_column),
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief A 16-byte view of a string of a strings column.
+ *
+ * Strings of up to 12 bytes are stored inline. Longer strings store their
+ * first 4 bytes and the offset of their bytes in the chars child column.
+ * So most comparisons of two strings are decided without touching the
+ * offsets or the chars of the column.
+ */
+class alignas(16) inline_string_view {
+ public:
+  static constexpr size_type inline_bytes = 12;  ///< Largest inline string
+  static constexpr size_type prefix_bytes = 4;   ///< Bytes stored inline for longer strings
+
+  inline_string_view() = default;
+
+  /**
+   * @brief Creates the view of a string.
+   *
+   * @param d_str The string.
+   * @param offset Byte offset of the string in the chars child column.
+   */
+  __device__ inline_string_view(string_view const& d_str, size_type offset)
+    : _bytes{d_str.size_bytes()} {
+    if (is_inline()) {
+      memcpy(_data, d_str.data(), _bytes);
+    } else {
+      memcpy(_data, d_str.data(), prefix_bytes);
+      memcpy(_data + prefix_bytes, &offset, sizeof(offset));
+    }
+  }
+
+  /**
+   * @brief Returns true if this is the view of a null string.
+   */
+  __device__ bool is_null() const { return _bytes < 0; }
+
+  /**
+   * @brief Returns true if the bytes of the string are stored in this view.
+   */
+  __device__ bool is_inline() const { return _bytes <= inline_bytes; }
+
+  /**
+   * @brief Returns the number of bytes of the string.
+   */
+  __device__ size_type size_bytes() const { return is_null() ? 0 : _bytes; }
+
+  /**
+   * @brief Returns the bytes of the string.
+   *
+   * @param d_chars The chars child column of the strings column.
+   */
+  __device__ const char* data(const char* d_chars) const {
+    if (is_inline()) return _data;
+    size_type offset;
+    memcpy(&offset, _data + prefix_bytes, sizeof(offset));
+    return d_chars + offset;
+  }
+
+  /**
+   * @brief Returns a string_view of the string.
+   *
+   * The string_view refers to this object for inline strings.
+   *
+   * @param d_chars The chars child column of the strings column.
+   */
+  __device__ string_view to_string_view(const char* d_chars) const {
+    return string_view(data(d_chars), size_bytes());
+  }
+
+  /**
+   * @brief Compares the bytes of two strings, like string_view::compare().
+   *
+   * The chars are only read when the strings have the same prefix and one of
+   * them is not inline.
+   *
+   * @param rhs The other string.
+   * @param d_chars The chars child column of the strings column.
+   * @return Negative, zero or positive if this string sorts before, the same as
+   *         or after `rhs`.
+   */
+  __device__ int compare(inline_string_view const& rhs, const char* d_chars) const {
+    auto const lhs_bytes = size_bytes();
+    auto const rhs_bytes = rhs.size_bytes();
+    auto const common    = min(min(lhs_bytes, rhs_bytes), prefix_bytes);
+    for (size_type idx = 0; idx < common; ++idx) {
+      auto const lhs_char = static_cast<unsigned char>(_data[idx]);
+      auto const rhs_char = static_cast<unsigned char>(rhs._data[idx]);
+      if (lhs_char != rhs_char) return static_cast<int>(lhs_char) - static_cast<int>(rhs_char);
+    }
+    if (lhs_bytes <= prefix_bytes || rhs_bytes <= prefix_bytes)
+      return lhs_bytes == rhs_bytes ? 0 : (lhs_bytes < rhs_bytes ? -1 : 1);
+    return to_string_view(d_chars).compare(rhs.to_string_view(d_chars));
+  }
+
+  /**
+   * @brief Returns true if two strings have the same bytes.
+   *
+   * @param rhs The other string.
+   * @param d_chars The chars child column of the strings column.
+   */
+  __device__ bool equals(inline_string_view const& rhs, const char* d_chars) const {
+    if (_bytes != rhs._bytes) return false;
+    for (size_type idx = 0; idx < min(size_bytes(), prefix_bytes); ++idx)
+      if (_data[idx] != rhs._data[idx]) return false;
+    return size_bytes() <= prefix_bytes || compare(rhs, d_chars) == 0;
+  }
+
+ private:
+  size_type _bytes{-1};        ///< Bytes of the string; negative for a null string
+  char _data[inline_bytes]{};  ///< The string, or its prefix followed by its offset
+};
+
+static_assert(sizeof(inline_string_view) == 16, "inline_string_view must be 16 bytes");
+
+/**
+ * @brief Creates the inline views of the strings of a strings column.
+ *
+ * @param strings Strings column to view.
+ * @param stream Stream to use for any kernel calls.
+ * @return The view of each string; null strings have null views.
+ */
+rmm::device_vector<inline_string_view> create_inline_string_views(
+  strings_column_view const& strings, cudaStream_t stream = 0);
+
+/**
+ * @brief Creates a strings column from inline views.
+ *
+ * @param views The views of the strings; null views make null strings.
+ * @param strings The strings column the views were created from, for the
+ *        strings that are not inline.
+ * @param stream Stream to use for any kernel calls.
+ * @param mr Resource for allocating device memory.
+ * @return New strings column.
+ */
+std::unique_ptr<column> make_strings_column(
+  rmm::device_vector<inline_string_view> const& views,
+  strings_column_view const& strings,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
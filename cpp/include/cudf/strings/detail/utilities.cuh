@@ -18,10 +18,15 @@
 #include <cuda_runtime.h>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/scan.h>
 
+#include <cstdint>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -60,6 +65,105 @@ std::unique_ptr<column> make_offsets_child_column(
   return offsets_column;
 }
 
+// Each thread of `copy_chars_kernel` writes one aligned chunk of output characters
+constexpr size_type COPY_CHARS_CHUNK_BYTES = sizeof(uint4);
+constexpr size_type COPY_CHARS_BLOCK_SIZE  = 256;
+
+/**
+ * @brief Copies the characters of the strings into the chunk of
+ * `COPY_CHARS_CHUNK_BYTES` bytes of `d_chars` of each thread.
+ *
+ * The consecutive chunks of the threads of a warp take the same time however
+ * long the strings are, and each chunk is written with one aligned store.
+ *
+ * @param source Returns the characters of output string `i`, only called for
+ * strings that are not empty
+ * @param d_offsets Offsets of the `strings_count` output strings
+ * @param d_chars Output characters, whose address must be aligned for a `uint4`
+ * @param bytes Number of output characters
+ */
+template <typename SourceFn>
+__global__ void copy_chars_kernel(SourceFn source,
+                                  int32_t const* d_offsets,
+                                  size_type strings_count,
+                                  char* d_chars,
+                                  size_type bytes) {
+  auto const first =
+    (static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x) * COPY_CHARS_CHUNK_BYTES;
+  if (first >= bytes) { return; }
+  auto const last = thrust::min<int64_t>(first + COPY_CHARS_CHUNK_BYTES, bytes);
+
+  // The string of the first byte of the chunk, after any empty strings
+  size_type idx = thrust::distance(
+                    d_offsets,
+                    thrust::upper_bound(thrust::seq, d_offsets, d_offsets + strings_count, first)) -
+                  1;
+  char const* d_str = source(idx);
+
+  union {
+    uint4 vector;
+    char bytes[COPY_CHARS_CHUNK_BYTES];
+  } chunk;
+  for (auto pos = first; pos < last; ++pos) {
+    if (pos >= d_offsets[idx + 1]) {
+      do {
+        ++idx;
+      } while (pos >= d_offsets[idx + 1]);
+      d_str = source(idx);
+    }
+    chunk.bytes[pos - first] = d_str[pos - d_offsets[idx]];
+  }
+
+  if (last - first == COPY_CHARS_CHUNK_BYTES) {
+    *reinterpret_cast<uint4*>(d_chars + first) = chunk.vector;
+  } else {
+    for (auto pos = first; pos < last; ++pos) { d_chars[pos] = chunk.bytes[pos - first]; }
+  }
+}
+
+/**
+ * @brief Copies the characters of `strings_count` strings into `d_chars` at
+ * the offsets `d_offsets`.
+ *
+ * Strings of at least `COPY_CHARS_CHUNK_BYTES` bytes on average are copied by
+ * `copy_chars_kernel`, so that neither long strings nor strings of very
+ * different lengths leave threads idle. Shorter strings are copied by one
+ * thread each.
+ *
+ * @tparam SourceFn Device callable returning the `char const*` characters of
+ * output string `i`; only called for strings that are not empty
+ *
+ * @param source Returns the characters of each output string
+ * @param d_offsets The `strings_count + 1` offsets of the output strings
+ * @param strings_count Number of output strings
+ * @param d_chars Output characters
+ * @param bytes Number of output characters, `d_offsets[strings_count]`
+ * @param stream Stream to use for any kernel calls.
+ */
+template <typename SourceFn>
+void copy_chars(SourceFn source,
+                int32_t const* d_offsets,
+                size_type strings_count,
+                char* d_chars,
+                size_type bytes,
+                cudaStream_t stream = 0) {
+  if (bytes == 0) { return; }
+  bool const is_aligned = reinterpret_cast<uintptr_t>(d_chars) % sizeof(uint4) == 0;
+  if (is_aligned and bytes / strings_count >= COPY_CHARS_CHUNK_BYTES) {
+    cudf::experimental::detail::grid_1d grid{bytes, COPY_CHARS_BLOCK_SIZE, COPY_CHARS_CHUNK_BYTES};
+    copy_chars_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      source, d_offsets, strings_count, d_chars, bytes);
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       [source, d_offsets, d_chars] __device__(size_type idx) {
+                         auto const size = d_offsets[idx + 1] - d_offsets[idx];
+                         if (size > 0) { memcpy(d_chars + d_offsets[idx], source(idx), size); }
+                       });
+  }
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
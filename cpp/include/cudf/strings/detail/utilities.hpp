@@ -92,6 +92,19 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns true if all the characters of the strings are ASCII.
+ *
+ * Only the bytes of the strings in the column view are checked, so a sliced
+ * column is checked over its own strings. Each ASCII character is one byte,
+ * so the character positions in these strings are their byte positions.
+ *
+ * @param strings Strings column instance.
+ * @param stream Stream to execute any device code against.
+ * @return true if no string has a multi-byte character
+ */
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -48,5 +48,59 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a boolean column identifying the strings in which any of
+ * the target strings are found.
+ *
+ * The targets are searched for in a single pass over each string, using an
+ * automaton built from all the targets. Any null string entries return
+ * corresponding null output column entries.
+ *
+ * ```
+ * s = ["abc","def","ghi"]
+ * t = ["b","ef","x"]
+ * r = contains_any(s,t)
+ * r is now [true,true,false]
+ * ```
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Resource for allocating device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> contains_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns a column with the character position of the first
+ * occurrence of any of the target strings in each string.
+ *
+ * The targets are searched for in a single pass over each string, using an
+ * automaton built from all the targets. The position is -1 if no target is
+ * found. Any null string entries return corresponding null output column entries.
+ *
+ * ```
+ * s = ["abcdef","xyz"]
+ * t = ["de","bc","cdef"]
+ * r = find_any(s,t)
+ * r is now [1,-1]
+ * ```
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column with character position values.
+ */
+std::unique_ptr<column> find_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace strings
 }  // namespace cudf
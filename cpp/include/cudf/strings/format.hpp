@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <string>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @brief Row-wise formats the values of the given columns into strings
+ * following a pattern, and returns a single strings column result.
+ *
+ * Each `{}` in `pattern` is replaced by the value of the next column, as
+ * counted from the first `{}`, and each `{N}` by the value of column `N`, so a
+ * column may be written more than once or not at all. `{{` and `}}` are
+ * written as `{` and `}`.
+ *
+ * Strings are copied, integers are written in base 10, fixed-point values
+ * in base 10 with as many decimals as their negative scale, floats as by
+ * `from_floats` and booleans as `true` or `false`.
+ *
+ * Any row with a null entry in a column of the pattern will result in the
+ * corresponding output row to be null entry unless a narep string is
+ * specified to be used in its place.
+ *
+ * The output strings are sized and then written by a single pass each over
+ * the rows, without any intermediate column, instead of converting each
+ * column with `from_integers` or `from_floats` and combining them with
+ * `concatenate`.
+ *
+ * ```
+ * c0 = ['a', 'bb', null]
+ * c1 = [1, 22, 3]
+ * c2 = [0.5, 1.0, 2.5]
+ * r1 = format([c0,c1,c2], '{}-{}:{}')
+ * r1 is ['a-1:0.5', 'bb-22:1.0', null]
+ * r2 = format([c0,c1], '{1},{0},{{{1}}}', '_')
+ * r2 is ['1,a,{1}', '22,bb,{22}', '3,_,{3}']
+ * ```
+ *
+ * @throw cudf::logic_error if `pattern` has an unmatched `{` or `}`, a
+ * placeholder that is neither `{}` nor `{N}`, or both `{}` and `{N}`
+ * placeholders.
+ * @throw cudf::logic_error if a placeholder refers to a column out of the
+ * range of `columns`.
+ * @throw cudf::logic_error if a column of the pattern is not a strings,
+ * integer, fixed-point, floating-point or boolean column.
+ *
+ * @param columns Columns whose values are formatted.
+ * @param pattern The text of each output string, with placeholders for the
+ *        values of the columns.
+ * @param narep String that should be used in place of any null values
+ *        found in any column of the pattern. Default of invalid-scalar means
+ *        any null entry produces a null result for that row.
+ * @param mr Resource for allocating device memory.
+ * @return New strings column with `columns.num_rows()` formatted strings.
+ */
+std::unique_ptr<column> format(
+  table_view const& columns,
+  std::string const& pattern,
+  string_scalar const& narep          = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace strings
+}  // namespace cudf
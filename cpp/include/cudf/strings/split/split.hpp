@@ -160,5 +160,50 @@ contiguous_split_record_result contiguous_rsplit_record(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief The result of a `split_offsets`
+ *
+ * The tokens of string `i` are the tokens `[row_offsets[i], row_offsets[i+1])`.
+ * Token `j` is the bytes `[token_begins[j], token_ends[j])` of the chars child
+ * column of the split strings column, so no bytes are copied.
+ */
+struct split_offsets_result {
+  std::unique_ptr<column> row_offsets;   ///< INT32 offsets of the tokens of each string
+  std::unique_ptr<column> token_begins;  ///< INT32 byte position of each token in the chars
+  std::unique_ptr<column> token_ends;    ///< INT32 byte position past the end of each token
+};
+
+/**
+ * @brief Splits each string using the specified delimiter, returning the
+ * positions of the tokens in the chars of the strings column instead of
+ * new strings columns.
+ *
+ * The tokens are the same as the tokens of `contiguous_split_record`.
+ * Null strings have no tokens.
+ *
+ * ```
+ * s = ["a_bc", null, "", "d"]
+ * r = split_offsets(s, "_")
+ * r.row_offsets is  [0, 2, 2, 3, 4]
+ * r.token_begins is [0, 2, 4, 4]
+ * r.token_ends is   [1, 4, 4, 5]
+ * ```
+ *
+ * @throws cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings Strings instance for this operation.
+ * @param delimiter UTF-8 encoded string indentifying the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Resource for allocating device memory.
+ * @return The offsets of the tokens of each string and the positions of the tokens.
+ */
+split_offsets_result split_offsets(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace strings
 }  // namespace cudf
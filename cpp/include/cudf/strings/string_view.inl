@@ -15,6 +15,7 @@
  */
 
 
+#include <cstdint>
 #include <cstdlib>
 
 namespace
@@ -61,6 +62,96 @@ __device__ inline cudf::size_type string_bytes( const char* str )
     return bytes;
 }
 
+/**
+ * @brief Returns true if the provided byte begins a character.
+ *
+ * Only the intermediate bytes `10xxxxxx` do not begin a character.
+ */
+__device__ inline bool is_begin_utf8_byte(BYTE byte)
+{
+    return (byte & 0xC0) != 0x80;
+}
+
+/**
+ * @brief Returns the number of characters beginning in the 4 bytes of a word.
+ *
+ * A byte is intermediate when its high bit is set and the next bit is not.
+ * The flags of the intermediate bytes are summed by the multiply into the high byte.
+ */
+__device__ inline cudf::size_type characters_in_word(uint32_t word)
+{
+    uint32_t const intermediate = (word & ~(word << 1) & 0x80808080u) >> 7;
+    return 4 - static_cast<cudf::size_type>((intermediate * 0x01010101u) >> 24);
+}
+
+/**
+ * @brief Returns the number of bytes before the first 4-byte aligned byte of str.
+ */
+__device__ inline cudf::size_type unaligned_prefix_bytes(const char* str, cudf::size_type bytes)
+{
+    cudf::size_type const prefix = (4 - reinterpret_cast<uintptr_t>(str) % 4) % 4;
+    return prefix < bytes ? prefix : bytes;
+}
+
+/**
+ * @brief Returns the number of UTF-8 characters in the provided char array.
+ *
+ * The aligned words of the array are counted 4 bytes at a time.
+ *
+ * @param str String with encoded char bytes.
+ * @param bytes Number of bytes in str.
+ * @return The number of characters in the array.
+ */
+__device__ inline cudf::size_type characters_in_bytes(const char* str, cudf::size_type bytes)
+{
+    auto const sptr        = reinterpret_cast<const BYTE*>(str);
+    auto const prefix      = unaligned_prefix_bytes(str, bytes);
+    cudf::size_type nchars = 0;
+    cudf::size_type idx    = 0;
+    for( ; idx < prefix; ++idx )
+        nchars += is_begin_utf8_byte(sptr[idx]);
+    for( ; idx + 4 <= bytes; idx += 4 )
+        nchars += characters_in_word(*reinterpret_cast<const uint32_t*>(sptr + idx));
+    for( ; idx < bytes; ++idx )
+        nchars += is_begin_utf8_byte(sptr[idx]);
+    return nchars;
+}
+
+/**
+ * @brief Returns the byte position of the character at position pos of the
+ * provided char array, or bytes if it has no more than pos characters.
+ *
+ * The aligned words before the character are skipped 4 bytes at a time, so
+ * converting a position of a long string reads a quarter of its bytes.
+ *
+ * @param str String with encoded char bytes.
+ * @param bytes Number of bytes in str.
+ * @param pos Character position.
+ * @return The byte position of the character.
+ */
+__device__ inline cudf::size_type utf8_byte_offset(const char* str, cudf::size_type bytes, cudf::size_type pos)
+{
+    if( pos <= 0 )
+        return 0;
+    auto const sptr        = reinterpret_cast<const BYTE*>(str);
+    auto const prefix      = unaligned_prefix_bytes(str, bytes);
+    cudf::size_type offset = 0;
+    for( ; offset < prefix; ++offset )
+        if( is_begin_utf8_byte(sptr[offset]) && (pos-- == 0) )
+            return offset;
+    for( ; offset + 4 <= bytes; offset += 4 )
+    {
+        auto const count = characters_in_word(*reinterpret_cast<const uint32_t*>(sptr + offset));
+        if( count > pos )
+            break; // the character begins in this word
+        pos -= count;
+    }
+    for( ; offset < bytes; ++offset )
+        if( is_begin_utf8_byte(sptr[offset]) && (pos-- == 0) )
+            return offset;
+    return bytes;
+}
+
 } // namespace
 
 namespace cudf
@@ -83,7 +174,7 @@ __host__ __device__ inline size_type string_view::size_bytes() const
 __device__ inline size_type string_view::length() const
 {
     if( _length <= UNKNOWN_STRING_LENGTH )
-        _length = strings::detail::characters_in_string(_data,_bytes);
+        _length = characters_in_bytes(_data,_bytes);
     return _length;
 }
 
@@ -121,17 +212,21 @@ __device__ inline string_view::const_iterator string_view::const_iterator::opera
 __device__ inline string_view::const_iterator string_view::const_iterator::operator+(string_view::const_iterator::difference_type offset)
 {
     const_iterator tmp(*this);
-    size_type adjust = abs(offset);
-    while( adjust-- > 0 )
-        offset > 0 ? ++tmp : --tmp;
+    tmp += offset;
     return tmp;
 }
 
 __device__ inline string_view::const_iterator& string_view::const_iterator::operator+=(string_view::const_iterator::difference_type offset)
 {
+    if( offset > 0 )
+    {   // skip the characters forward without iterating over each of them
+        byte_pos += utf8_byte_offset(p + byte_pos, bytes - byte_pos, offset);
+        char_pos += offset;
+        return *this;
+    }
     size_type adjust = abs(offset);
     while(adjust-- > 0)
-        offset > 0 ? operator++() : operator--();
+        operator--();
     return *this;
 }
 
@@ -236,17 +331,7 @@ __device__ inline char_utf8 string_view::operator[](size_type pos) const
 
 __device__ inline size_type string_view::byte_offset(size_type pos) const
 {
-    size_type offset = 0;
-    const char* sptr = _data;
-    const char* eptr = sptr + _bytes;
-    while( (pos > 0) && (sptr < eptr) )
-    {
-        size_type charbytes = bytes_in_utf8_byte((BYTE)*sptr++);
-        if( charbytes )
-            --pos;
-        offset += charbytes;
-    }
-    return offset;
+    return utf8_byte_offset(_data, _bytes, pos);
 }
 
 __device__ inline int string_view::compare(const string_view& in) const
@@ -405,7 +490,7 @@ __device__ inline string_view string_view::substr(size_type pos, size_type lengt
 
 __device__ inline size_type string_view::character_offset(size_type bytepos) const
 {
-    return strings::detail::characters_in_string(data(), bytepos);
+    return characters_in_bytes(data(), bytepos);
 }
 
 namespace strings
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+
+/**
+ * @brief Returns a single column by vertically concatenating the given vector of
+ * structs columns.
+ *
+ * The child columns of the structs are concatenated recursively, so the
+ * columns must have the same number and types of fields.
+ *
+ * ```
+ * s1 = [{1, "a"}, {2, "b"}]
+ * s2 = [{3, "c"}]
+ * r = concatenate([s1, s2])
+ * r is now [{1, "a"}, {2, "b"}, {3, "c"}]
+ * ```
+ *
+ * @throw cudf::logic_error if the columns have different numbers of fields.
+ *
+ * @param columns List of structs columns to concatenate.
+ * @param mr Resource for allocating device memory.
+ * @param stream CUDA stream to use for any kernels in this function.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate(
+  std::vector<column_view> const& columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
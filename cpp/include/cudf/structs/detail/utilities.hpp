@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+
+/**
+ * @brief The columns of a table with its struct columns replaced by their
+ * fields, and the null masks and orders that go with them.
+ */
+struct flattened_table {
+  table_view flattened_columns;                ///< The non-struct columns and struct validities
+  std::vector<order> orders;                   ///< The order of each flattened column, if any
+  std::vector<null_order> null_orders;         ///< The null order of each flattened column, if any
+  std::vector<rmm::device_buffer> null_masks;  ///< Owns the masks of the nulled fields
+};
+
+/**
+ * @brief Returns true if any column of `input` is a struct column with
+ * children, i.e., if `flatten_nested_columns` would change `input`.
+ */
+bool has_nested_columns(table_view const& input);
+
+/**
+ * @brief Replaces every struct column of `input`, recursively, by the
+ * columns of its fields.
+ *
+ * The rows of the flattened table compare, order and hash as the rows of
+ * `input` with the row operators of `row_operators.cuh`:
+ * - a nullable struct column is preceded by a struct column without children
+ *   holding its validity, which orders the null structs before or after the
+ *   valid ones,
+ * - the fields of a nullable struct column are also null in its null rows,
+ *   so that they compare equal to each other, and
+ * - each field column takes the order and null order of its struct column.
+ *
+ * Columns that are not struct columns are returned as they are.
+ *
+ * @param input The table to flatten
+ * @param column_order The order of each column of `input`, may be empty
+ * @param null_precedence The null order of each column of `input`, may be empty
+ * @param stream CUDA stream to use for any kernels in this function
+ * @return The flattened columns, which are only valid as long as `input`
+ * and the returned object are
+ */
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order         = {},
+                                       std::vector<null_order> const& null_precedence = {},
+                                       cudaStream_t stream                            = 0);
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+/**
+ * @file structs_column_view.hpp
+ * @brief Class definition for cudf::structs_column_view
+ */
+
+namespace cudf {
+
+/**
+ * @brief Given a column-view of structs type, an instance of this class
+ * provides a wrapper on this compound column for struct operations.
+ *
+ * A structs column has one child column per field and row `i` of the
+ * structs column holds row `i` of every child. The children are not
+ * sliced: the `offset()` of the structs column applies to them as well.
+ */
+class structs_column_view : private column_view {
+ public:
+  structs_column_view(column_view structs_column);
+  structs_column_view(structs_column_view&& structs_view)      = default;
+  structs_column_view(const structs_column_view& structs_view) = default;
+  ~structs_column_view()                                       = default;
+  structs_column_view& operator=(structs_column_view const&) = default;
+  structs_column_view& operator=(structs_column_view&&) = default;
+
+  using column_view::child;
+  using column_view::has_nulls;
+  using column_view::null_count;
+  using column_view::null_mask;
+  using column_view::num_children;
+  using column_view::offset;
+  using column_view::size;
+
+  /**
+   * @brief Returns the parent column.
+   */
+  column_view parent() const;
+
+  /**
+   * @brief Returns the child column of field `index` sliced to the rows of
+   * the parent column.
+   *
+   * The null mask of the returned view is the child's own: the rows of a
+   * null struct are not null in it unless the child row is null as well.
+   *
+   * @throw cudf::logic_error if `index` is not a valid child index
+   *
+   * @param index The index of the field
+   */
+  column_view sliced_child(size_type index) const;
+};
+
+}  // namespace cudf
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+/**
+ * @file chunked_table_view.hpp
+ * @brief A `chunked_column_view` is a sequence of `column_view`s of the same
+ * type, a `chunked_table_view` a sequence of `table_view`s of the same schema.
+ *
+ * The chunks are the pieces a streaming reader or a shuffle produces. The
+ * operations that accept chunked views process the chunks in order, as they
+ * would process the concatenation of the chunks, without materializing it.
+ *
+ * Chunked views are non-owning: the chunks must outlive them.
+ */
+
+namespace cudf {
+
+/**
+ * @brief A sequence of `column_view`s of the same type
+ */
+class chunked_column_view {
+ public:
+  using const_iterator = std::vector<column_view>::const_iterator;
+
+  /**
+   * @brief Construct a chunked column from the views of its chunks
+   *
+   * @throws cudf::logic_error if `chunks` is empty
+   * @throws cudf::logic_error if the chunks do not all have the same type
+   *
+   * @param chunks The chunks of the column, in order
+   */
+  explicit chunked_column_view(std::vector<column_view> const& chunks);
+
+  /**
+   * @brief Returns the type of the elements of the column
+   */
+  data_type type() const noexcept { return _chunks.front().type(); }
+
+  /**
+   * @brief Returns the number of elements of all chunks
+   */
+  std::size_t size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of null elements of all chunks
+   *
+   * @note The null count of each chunk is computed if it is not known
+   */
+  std::size_t null_count() const;
+
+  /**
+   * @brief Returns true if any chunk has a null mask allocated
+   */
+  bool nullable() const;
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return _chunks.size(); }
+
+  /**
+   * @brief Returns the view of the chunk at `chunk_index`
+   *
+   * @throws std::out_of_range if `chunk_index` is out of the range [0, num_chunks)
+   */
+  column_view const& chunk(size_type chunk_index) const { return _chunks.at(chunk_index); }
+
+  /**
+   * @brief Returns the views of all chunks
+   */
+  std::vector<column_view> const& chunks() const noexcept { return _chunks; }
+
+  const_iterator begin() const noexcept { return _chunks.begin(); }
+  const_iterator end() const noexcept { return _chunks.end(); }
+
+ private:
+  std::vector<column_view> _chunks{};  ///< The chunks of the column, in order
+  std::size_t _size{};                 ///< The number of elements of all chunks
+};
+
+/**
+ * @brief A sequence of `table_view`s with the same number and types of columns
+ */
+class chunked_table_view {
+ public:
+  using const_iterator = std::vector<table_view>::const_iterator;
+
+  /**
+   * @brief Construct a chunked table from the views of its chunks
+   *
+   * @throws cudf::logic_error if `chunks` is empty
+   * @throws cudf::logic_error if the chunks do not all have the same number of
+   * columns, and the same column types
+   *
+   * @param chunks The chunks of the table, in order
+   */
+  explicit chunked_table_view(std::vector<table_view> const& chunks);
+
+  /**
+   * @brief Returns the number of columns
+   */
+  size_type num_columns() const noexcept { return _chunks.front().num_columns(); }
+
+  /**
+   * @brief Returns the number of rows of all chunks
+   */
+  std::size_t num_rows() const noexcept { return _num_rows; }
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return _chunks.size(); }
+
+  /**
+   * @brief Returns the view of the chunk at `chunk_index`
+   *
+   * @throws std::out_of_range if `chunk_index` is out of the range [0, num_chunks)
+   */
+  table_view const& chunk(size_type chunk_index) const { return _chunks.at(chunk_index); }
+
+  /**
+   * @brief Returns the views of all chunks
+   */
+  std::vector<table_view> const& chunks() const noexcept { return _chunks; }
+
+  /**
+   * @brief Returns the chunked column of the column at `column_index`
+   *
+   * @throws std::out_of_range if `column_index` is out of the range [0, num_columns)
+   */
+  chunked_column_view column(size_type column_index) const;
+
+  /**
+   * @brief Returns a chunked table of the columns at `column_indices`, in the
+   * order of the indices
+   *
+   * @throws std::out_of_range if any index is out of the range [0, num_columns)
+   */
+  chunked_table_view select(std::vector<size_type> const& column_indices) const;
+
+  const_iterator begin() const noexcept { return _chunks.begin(); }
+  const_iterator end() const noexcept { return _chunks.end(); }
+
+ private:
+  std::vector<table_view> _chunks{};  ///< The chunks of the table, in order
+  std::size_t _num_rows{};            ///< The number of rows of all chunks
+};
+
+}  // namespace cudf
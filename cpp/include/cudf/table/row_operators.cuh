@@ -161,7 +161,7 @@ class element_equality_comparator {
    * @param lhs_element_index The index of the first element
    * @param rhs_element_index The index of the second element
    *---------------------------------------------------------------------------**/
-  template <typename Element>
+  template <typename Element, std::enable_if_t<not cudf::is_nested<Element>()>* = nullptr>
   __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
     noexcept {
     if (has_nulls) {
@@ -178,6 +178,34 @@ class element_equality_comparator {
                             rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Compares the validity of the specified struct elements.
+   *
+   * The fields of a struct column are compared as separate columns after
+   * `structs::detail::flatten_nested_columns`, which leaves a struct column
+   * without children that only holds the validity of the structs.
+   */
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, cudf::struct_view>::value>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+    noexcept {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.nullable() and lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.nullable() and rhs.is_null(rhs_element_index)};
+      if (lhs_is_null and rhs_is_null) { return nulls_are_equal; }
+      return lhs_is_null == rhs_is_null;
+    }
+    return true;
+  }
+
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, cudf::list_view>::value>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+    noexcept {
+    release_assert(false && "Attempted to compare elements of a lists column.");
+    return false;
+  }
+
  private:
   column_device_view lhs;
   column_device_view rhs;
@@ -267,8 +295,37 @@ class element_relational_comparator {
                               rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Orders the specified struct elements by their validity only.
+   *
+   * The fields of a struct column are ordered as separate columns after
+   * `structs::detail::flatten_nested_columns`, so a valid struct is
+   * EQUIVALENT to any other valid struct here.
+   */
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, cudf::struct_view>::value>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_element_index,
+                                      size_type rhs_element_index) const noexcept {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.nullable() and lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.nullable() and rhs.is_null(rhs_element_index)};
+
+      if (lhs_is_null and rhs_is_null) {  // null <? null
+        return weak_ordering::EQUIVALENT;
+      } else if (lhs_is_null) {  // null <? x
+        return (null_precedence == null_order::BEFORE) ? weak_ordering::LESS
+                                                       : weak_ordering::GREATER;
+      } else if (rhs_is_null) {  // x <? null
+        return (null_precedence == null_order::AFTER) ? weak_ordering::LESS
+                                                      : weak_ordering::GREATER;
+      }
+    }
+    return weak_ordering::EQUIVALENT;
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>() and
+                             not std::is_same<Element, cudf::struct_view>::value>* = nullptr>
   __device__ weak_ordering operator()(size_type lhs_element_index, size_type rhs_element_index) {
     release_assert(false && "Attempted to compare elements of uncomparable types.");
   }
@@ -368,12 +425,34 @@ class row_lexicographic_comparator {
 template <template <typename> class hash_function, bool has_nulls = true>
 class element_hasher {
  public:
-  template <typename T>
+  element_hasher() = default;
+  __device__ element_hasher(hash_value_type seed) : _seed{seed} {}
+
+  template <typename T, std::enable_if_t<not cudf::is_nested<T>()>* = nullptr>
   __device__ inline hash_value_type operator()(column_device_view col, size_type row_index) {
     if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
 
-    return hash_function<T>{}(col.element<T>(row_index));
+    return hash_function<T>{_seed}(col.element<T>(row_index));
   }
+
+  /**
+   * @brief Hashes the validity of a struct element; its fields are hashed
+   * as separate columns after `structs::detail::flatten_nested_columns`.
+   */
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index) {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    return hash_value_type{0};
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::list_view>::value>* = nullptr>
+  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index) {
+    release_assert(false && "Attempted to hash elements of a lists column.");
+    return hash_value_type{0};
+  }
+
+ private:
+  hash_value_type _seed{0};
 };
 
 /**---------------------------------------------------------------------------*
@@ -386,7 +465,11 @@ template <template <typename> class hash_function, bool has_nulls = true>
 class row_hasher {
  public:
   row_hasher() = delete;
-  row_hasher(table_device_view t) : _table{t} {}
+  /**
+   * @param t The table to hash
+   * @param seed Seed of the hash function of every element
+   */
+  row_hasher(table_device_view t, hash_value_type seed = 0) : _table{t}, _seed{seed} {}
 
   __device__ auto operator()(size_type row_index) const {
     auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
@@ -396,7 +479,7 @@ class row_hasher {
     // Hashes an element in a column
     auto hasher = [=](size_type column_index) {
       return cudf::experimental::type_dispatcher(_table.column(column_index).type(),
-                                                 element_hasher<hash_function, has_nulls>{},
+                                                 element_hasher<hash_function, has_nulls>{_seed},
                                                  _table.column(column_index),
                                                  row_index);
     };
@@ -412,6 +495,7 @@ class row_hasher {
 
  private:
   table_device_view _table;
+  hash_value_type _seed;
 };
 
 /**---------------------------------------------------------------------------*
@@ -458,5 +542,83 @@ class row_hasher_initial_values {
   hash_value_type* _initial_hash;
 };
 
+/**
+ * @brief Computes the hash value of an element in the given column, using a
+ * hash value as the seed of the hash function.
+ *
+ * Null elements hash to the seed.
+ *
+ * @tparam hash_function Hash functor to use for hashing elements.
+ * @tparam has_nulls Indicates the potential for null values in the column.
+ */
+template <template <typename> class hash_function, bool has_nulls = true>
+class seeded_element_hasher {
+ public:
+  using result_type = typename hash_function<int32_t>::result_type;
+
+  template <typename T, std::enable_if_t<not cudf::is_nested<T>()>* = nullptr>
+  __device__ inline result_type operator()(column_device_view col,
+                                           size_type row_index,
+                                           result_type seed) {
+    if (has_nulls && col.is_null(row_index)) { return seed; }
+    return hash_function<T>{seed}(col.element<T>(row_index));
+  }
+
+  /**
+   * @brief A struct element leaves the seed unchanged; its fields are hashed
+   * as separate columns after `structs::detail::flatten_nested_columns`.
+   */
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+  __device__ inline result_type operator()(column_device_view col,
+                                           size_type row_index,
+                                           result_type seed) {
+    return seed;
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::list_view>::value>* = nullptr>
+  __device__ inline result_type operator()(column_device_view col,
+                                           size_type row_index,
+                                           result_type seed) {
+    release_assert(false && "Attempted to hash elements of a lists column.");
+    return seed;
+  }
+};
+
+/**
+ * @brief Computes the hash value of a row in the given table by hashing each
+ * column with the hash value of the previous columns as the seed, as Spark's
+ * `hash` and `xxhash64` expressions do.
+ *
+ * The first column is hashed with the given seed. A null element leaves the
+ * hash value unchanged, so a row of nulls hashes to the seed.
+ *
+ * @tparam hash_function Hash functor to use for hashing elements.
+ * @tparam has_nulls Indicates the potential for null values in the table.
+ */
+template <template <typename> class hash_function, bool has_nulls = true>
+class seeded_row_hasher {
+ public:
+  using result_type = typename hash_function<int32_t>::result_type;
+
+  seeded_row_hasher() = delete;
+  seeded_row_hasher(table_device_view t, result_type seed) : _table{t}, _seed{seed} {}
+
+  __device__ result_type operator()(size_type row_index) const {
+    result_type hash = _seed;
+    for (size_type i = 0; i < _table.num_columns(); ++i) {
+      hash = cudf::experimental::type_dispatcher(_table.column(i).type(),
+                                                 seeded_element_hasher<hash_function, has_nulls>{},
+                                                 _table.column(i),
+                                                 row_index,
+                                                 hash);
+    }
+    return hash;
+  }
+
+ private:
+  table_device_view _table;
+  result_type _seed;
+};
+
 }  // namespace experimental
 }  // namespace cudf
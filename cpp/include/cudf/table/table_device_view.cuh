@@ -25,6 +25,8 @@
 namespace cudf {
 namespace detail {
 
+struct descriptor_block;
+
 template <typename ColumnDeviceView, typename HostTableView>
 class table_device_view_base {
  public:
@@ -55,6 +57,13 @@ class table_device_view_base {
 
   __host__ __device__ size_type num_rows() const noexcept { return _num_rows; }
 
+  /**
+   * @brief Releases the device memory of the view and deletes it
+   *
+   * The descriptors of the columns of narrow tables are held in a block of
+   * the `descriptor_pool`, which returns to the pool for reuse once the work
+   * queued on the stream of the view has completed.
+   */
   void destroy();
 
  private:
@@ -67,16 +76,24 @@ class table_device_view_base {
   table_device_view_base(HostTableView source_view, cudaStream_t stream);
 
   rmm::device_buffer* _descendant_storage{};
+  descriptor_block* _descriptor_block{};  ///< Pooled storage used instead of the buffer
 };
 }  // namespace detail
 
 class table_device_view : public detail::table_device_view_base<column_device_view, table_view> {
  public:
+  /**
+   * @brief Creates a device view of a table
+   *
+   * The descriptors of narrow tables are copied to the device asynchronously,
+   * so the view must only be used by work queued on `stream`, or ordered after
+   * it; its memory is reused once the work queued on `stream` completes.
+   *
+   * @param source_view The table to view
+   * @param stream CUDA stream the view is used on
+   */
   static auto create(table_view source_view, cudaStream_t stream = 0) {
-    auto deleter = [](table_device_view* t) {
-      t->destroy();
-      delete t->_descendant_storage;
-    };
+    auto deleter = [](table_device_view* t) { t->destroy(); };
     return std::unique_ptr<table_device_view, decltype(deleter)>{
       new table_device_view(source_view, stream), deleter};
   }
@@ -89,6 +106,9 @@ class table_device_view : public detail::table_device_view_base<column_device_vi
 class mutable_table_device_view
   : public detail::table_device_view_base<mutable_column_device_view, mutable_table_view> {
  public:
+  /**
+   * @copydoc table_device_view::create
+   */
   static auto create(mutable_table_view source_view, cudaStream_t stream = 0) {
     auto deleter = [](mutable_table_device_view* t) { t->destroy(); };
     return std::unique_ptr<mutable_table_device_view, decltype(deleter)>{
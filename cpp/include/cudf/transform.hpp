@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -48,6 +49,45 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates new columns by applying a function against the elements of
+ * every row of a table, in a single kernel.
+ *
+ * Computes:
+ * `F(&out_0[i], ..., &out_m[i], in_0[i], ..., in_n[i])`
+ *
+ * where `in_k` is the column `k` of `inputs` and `out_k` has type
+ * `output_types[k]`. The outputs are written through the leading pointer
+ * parameters of the UDF, e.g. for two outputs of two columns:
+ * ```
+ * __device__ void sum_and_product(double* sum, double* product, double a, double b)
+ * {
+ *   *sum     = a + b;
+ *   *product = a * b;
+ * }
+ * ```
+ *
+ * The null mask of every output is the bitwise AND of the null masks of
+ * `inputs`, so if any `in_k[i]` is null then every `out_k[i]` is also null.
+ *
+ * @throws cudf::logic_error if `inputs` has no columns or a non-numeric column
+ * @throws cudf::logic_error if `output_types` is empty or has a non-numeric type
+ * @throws cudf::logic_error if `is_ptx` and there is more than one output
+ *
+ * @param inputs        An immutable view of the columns to transform
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_types  The output types, compatible with the pointer parameters of the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            The memory resource to use for for all device allocations
+ * @return The table of the output columns, in the order of `output_types`
+ **/
+std::unique_ptr<table> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  std::vector<data_type> const& output_types,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
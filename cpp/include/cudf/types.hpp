@@ -60,6 +60,8 @@ class column;
 class column_view;
 class mutable_column_view;
 class string_view;
+class list_view;
+class struct_view;
 
 class scalar;
 template <typename T>
@@ -137,6 +139,15 @@ enum class mask_state : int32_t {
   ALL_NULL        ///< Null mask allocated, initialized to all elements NULL
 };
 
+/**
+ * @brief Identifies the hash function used to hash the rows of a table
+ */
+enum class hash_id : int32_t {
+  HASH_MURMUR3,        ///< MurmurHash3_32 of each element, combined across columns
+  HASH_SPARK_MURMUR3,  ///< Spark's MurmurHash3_32, seeded with the hash of the previous columns
+  HASH_XXHASH64        ///< xxHash64 as Spark's, seeded with the hash of the previous columns
+};
+
 namespace experimental {
 
 /**
@@ -173,6 +184,10 @@ enum type_id {
   TIMESTAMP_NANOSECONDS,   ///< duration of nanoseconds since Unix Epoch in int64
   DICTIONARY32,            ///< Dictionary type using int32 indices
   STRING,                  ///< String elements
+  DECIMAL32,               ///< Fixed-point decimal using int32 representation and a scale
+  DECIMAL64,               ///< Fixed-point decimal using int64 representation and a scale
+  LIST,                    ///< List elements using an offsets child and a values child
+  STRUCT,                  ///< Struct elements using one child column per field
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
 };
@@ -199,30 +214,45 @@ class data_type {
    *---------------------------------------------------------------------------**/
   explicit constexpr data_type(type_id id) : _id{id} {}
 
+  /**---------------------------------------------------------------------------*
+   * @brief Construct a new fixed-point `data_type` object
+   *
+   * An element of the type is `rep * 10^scale`, e.g. a scale of -2 stores cents.
+   *
+   * @param id The type's identifier, `DECIMAL32` or `DECIMAL64`
+   * @param scale The base 10 exponent of the elements
+   *---------------------------------------------------------------------------**/
+  explicit constexpr data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale} {}
+
   /**---------------------------------------------------------------------------*
    * @brief Returns the type identifier
    *---------------------------------------------------------------------------**/
   CUDA_HOST_DEVICE_CALLABLE type_id id() const noexcept { return _id; }
 
+  /**---------------------------------------------------------------------------*
+   * @brief Returns the scale of a fixed-point type, 0 for the other types
+   *---------------------------------------------------------------------------**/
+  CUDA_HOST_DEVICE_CALLABLE int32_t scale() const noexcept { return _fixed_point_scale; }
+
  private:
   type_id _id{EMPTY};
-  // Store additional type specific metadata, timezone, decimal precision and
-  // scale, etc.
+  int32_t _fixed_point_scale{0};  ///< Base 10 exponent of fixed-point types
+  // Store additional type specific metadata, timezone, decimal precision, etc.
 };
 
 /**---------------------------------------------------------------------------*
  * @brief Compares two `data_type` objects for equality.
  *
- * // TODO Define exactly what it means for two `data_type`s to be equal. e.g.,
- * are two timestamps with different resolutions equal? How about decimals with
- * different scale/precision?
+ * Fixed-point types are equal only if their scales are equal.
  *
  * @param lhs The first `data_type` to compare
  * @param rhs The second `data_type` to compare
  * @return true `lhs` is equal to `rhs`
  * @return false `lhs` is not equal to `rhs`
  *---------------------------------------------------------------------------**/
-inline bool operator==(data_type const& lhs, data_type const& rhs) { return lhs.id() == rhs.id(); }
+inline bool operator==(data_type const& lhs, data_type const& rhs) {
+  return lhs.id() == rhs.id() && lhs.scale() == rhs.scale();
+}
 
 /**
  * @brief Returns the size in bytes of elements of the specified `data_type`
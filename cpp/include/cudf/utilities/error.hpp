@@ -5,6 +5,10 @@
 #include <stdexcept>
 #include <string>
 
+#ifdef CUDF_SYNC_AUDIT
+#include <iostream>
+#endif
+
 #include <rmm/rmm.h>
 
 #define RMM_TRY(call)                                                                         \
@@ -137,3 +141,38 @@ inline void throw_cuda_error(cudaError_t error, const char* file, unsigned int l
 #else
 #define CHECK_CUDA(stream) CUDA_TRY(cudaPeekAtLastError());
 #endif
+
+/**---------------------------------------------------------------------------*
+ * @brief Marks a point where the host waits for the device, e.g., to read a
+ * device value such as a null count.
+ *
+ * When libcudf is built with `CUDF_SYNC_AUDIT` (the `SYNC_AUDIT` CMake
+ * option), every synchronization point reports its file and line to `stderr`
+ * so the synchronizations on a code path can be found and removed. Otherwise,
+ * this macro does nothing.
+ *---------------------------------------------------------------------------**/
+#ifdef CUDF_SYNC_AUDIT
+namespace cudf {
+namespace detail {
+inline void report_sync_point(const char* file, unsigned int line) {
+  std::cerr << "cuDF synchronization at: " << file << ":" << line << std::endl;
+}
+}  // namespace detail
+}  // namespace cudf
+
+#define CUDF_SYNC_POINT() cudf::detail::report_sync_point(__FILE__, __LINE__)
+#else
+#define CUDF_SYNC_POINT() static_cast<void>(0)
+#endif
+
+/**---------------------------------------------------------------------------*
+ * @brief Synchronizes the specified stream, reporting the synchronization in
+ * a `CUDF_SYNC_AUDIT` build.
+ *
+ * Should be used instead of calling `cudaStreamSynchronize` directly.
+ *---------------------------------------------------------------------------**/
+#define CUDF_STREAM_SYNC(stream)             \
+  do {                                       \
+    CUDF_SYNC_POINT();                       \
+    CUDA_TRY(cudaStreamSynchronize(stream)); \
+  } while (0);
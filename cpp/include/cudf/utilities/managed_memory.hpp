@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace cudf {
+
+/**
+ * @brief Enables or disables the prefetching of managed memory
+ *
+ * When the columns are allocated in managed memory, e.g., with
+ * `rmm::mr::managed_memory_resource` to oversubscribe the device memory, their
+ * pages migrate to the device when a kernel first faults on them, one group of
+ * pages at a time. With prefetching enabled, the streaming operators, i.e., the
+ * readers, `gather`, `sort` and `concatenate`, prefetch their inputs and
+ * outputs to the device with `cudaMemPrefetchAsync` before their kernels run,
+ * so the pages migrate in bulk and ahead of the kernels.
+ *
+ * Prefetching only applies to managed memory, on devices that support
+ * concurrent managed access. Checking whether each buffer is managed adds host
+ * overhead to every call, so prefetching is disabled by default, unless the
+ * environment variable `LIBCUDF_MANAGED_PREFETCH` is set to a value other than
+ * `0`.
+ *
+ * @param enable Whether to prefetch managed memory
+ * @return Whether prefetching was enabled before the call
+ */
+bool set_managed_memory_prefetch(bool enable) noexcept;
+
+/**
+ * @brief Returns whether managed memory is prefetched
+ */
+bool is_managed_memory_prefetch_enabled() noexcept;
+
+}  // namespace cudf
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+
+/**
+ * @brief Device memory budget that libcudf queries before its large
+ * allocations
+ *
+ * Applications that share the device with other work, or that can release
+ * device memory on request, implement this interface and install it with
+ * `set_memory_budget()`. Before allocating a hash table, a sort buffer or the
+ * output of a join, algorithms compare the bytes they need with
+ * `available_bytes()`. When the budget is too small they first ask for memory
+ * to be freed with `spill()`, then choose a strategy that uses less memory
+ * where there is one, e.g., a join keeps its partitions in host memory
+ * instead of building a hash table of the whole right table.
+ *
+ * The budget is advisory: allocations are still made from the memory
+ * resource, whatever the budget says.
+ *
+ * The member functions may be called from any thread that calls libcudf.
+ */
+class memory_budget {
+ public:
+  virtual ~memory_budget() = default;
+
+  /**
+   * @brief Returns the number of bytes of device memory libcudf may still
+   * allocate
+   */
+  virtual std::size_t available_bytes() = 0;
+
+  /**
+   * @brief Asks the application to free device memory, e.g., by spilling its
+   * buffers to host memory
+   *
+   * @param bytes The number of bytes missing from the budget
+   * @return true if memory was freed and the budget should be queried again
+   */
+  virtual bool spill(std::size_t bytes) { return false; }
+};
+
+/**
+ * @brief Returns the installed memory budget, or `nullptr` if there is none
+ */
+memory_budget* get_memory_budget() noexcept;
+
+/**
+ * @brief Installs the memory budget queried by all the threads calling
+ * libcudf
+ *
+ * The budget is not owned by libcudf and must outlive the calls that may query
+ * it. Passing `nullptr` removes the budget, and the algorithms only consider
+ * the free device memory.
+ *
+ * @param budget The new budget, or `nullptr`
+ * @return The previously installed budget
+ */
+memory_budget* set_memory_budget(memory_budget* budget) noexcept;
+
+}  // namespace cudf
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+
+/**
+ * @brief What an `operation_record` measures
+ */
+enum class operation_kind : int8_t {
+  FUNCTION,  ///< A call of a public function
+  PHASE      ///< A named phase of an algorithm, e.g., the build of a join hash table
+};
+
+/**
+ * @brief Measurements of a call of a libcudf public function, or of a phase
+ * of its algorithm
+ */
+struct operation_record {
+  char const* name;             ///< Name of the function or of the phase
+  operation_kind kind;          ///< Whether `name` is a function or a phase
+  int depth;                    ///< Number of enclosing recorded calls and phases on the thread
+  double wall_time_ms;          ///< Host time from the call to its return
+  double gpu_time_ms;           ///< Time between events recorded on the default stream
+                                ///< at the call and at the return
+  std::size_t allocated_bytes;  ///< Bytes allocated by the thread during the call
+  std::size_t allocations;      ///< Number of those allocations
+  std::size_t peak_bytes;       ///< Largest number of bytes allocated by the thread
+                                ///< during the call and not freed yet
+};
+
+/**
+ * @brief Receives the measurements of the calls of libcudf public functions
+ *
+ * Applications that attribute costs to their own operators implement this
+ * interface and install it with `set_operation_observer()`. Every public
+ * function instrumented with `CUDF_FUNC_RANGE()` then measures its call and
+ * passes it to `record()` before returning; calls made by libcudf functions
+ * are recorded too, with a larger `depth`, before the call enclosing them.
+ * The phases of the algorithms that allocate the most, marked with
+ * `CUDF_PHASE_RANGE()`, are recorded the same way. Calls that throw are not
+ * recorded.
+ *
+ * Measuring synchronizes the default stream at the return of each call, so an
+ * observer should only be installed while its measurements are needed.
+ * Allocations are counted through the default memory resource, which
+ * `set_operation_observer()` wraps while an observer is installed: memory
+ * allocated from a resource passed explicitly as the `mr` of a call is not
+ * counted. A thread's `peak_bytes` omit the memory it frees that another
+ * thread allocated.
+ *
+ * `record()` may be called concurrently from any thread that calls libcudf.
+ */
+class operation_observer {
+ public:
+  virtual ~operation_observer() = default;
+
+  /**
+   * @brief Receives the measurements of a call
+   *
+   * Must not throw: it is called while the instrumented function returns.
+   *
+   * @param op The measurements; `op.name` outlives the program
+   */
+  virtual void record(operation_record const& op) = 0;
+};
+
+/**
+ * @brief Returns the installed operation observer, or `nullptr` if there is
+ * none
+ */
+operation_observer* get_operation_observer() noexcept;
+
+/**
+ * @brief Installs the observer of the calls of all the threads calling
+ * libcudf
+ *
+ * The observer is not owned by libcudf and must outlive the calls that may
+ * record to it. Installing an observer makes a counting adaptor of the current
+ * default memory resource the default resource; passing `nullptr` removes the
+ * observer, and restores the adapted resource if the adaptor is still the
+ * default resource.
+ *
+ * @param observer The new observer, or `nullptr`
+ * @return The previously installed observer
+ */
+operation_observer* set_operation_observer(operation_observer* observer);
+
+/**
+ * @brief Observer accumulating the records of each function and phase name
+ *
+ * Example:
+ * ```
+ * cudf::operation_summary summary;
+ * cudf::set_operation_observer(&summary);
+ * auto result = gb.aggregate(requests);
+ * cudf::set_operation_observer(nullptr);
+ * auto peak = summary.statistics()["hash_groupby_aggregate"].peak_bytes;
+ * ```
+ */
+class operation_summary : public operation_observer {
+ public:
+  /**
+   * @brief Accumulated records of a name
+   */
+  struct entry {
+    std::size_t calls       = 0;  ///< Number of records
+    double wall_time_ms     = 0;  ///< Sum of the wall times
+    double gpu_time_ms      = 0;  ///< Sum of the GPU times
+    std::size_t total_bytes = 0;  ///< Sum of the allocated bytes
+    std::size_t peak_bytes  = 0;  ///< Largest peak bytes
+  };
+
+  void record(operation_record const& op) override;
+
+  /**
+   * @brief Returns the accumulated records of each name
+   */
+  std::map<std::string, entry> statistics() const;
+
+  /**
+   * @brief Forgets the accumulated records
+   */
+  void clear();
+
+ private:
+  mutable std::mutex _mutex;
+  std::map<std::string, entry> _entries;
+};
+
+}  // namespace cudf
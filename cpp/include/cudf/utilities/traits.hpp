@@ -163,6 +163,20 @@ constexpr inline bool is_timestamp(data_type type) {
   return cudf::experimental::type_dispatcher(type, is_timestamp_impl{});
 }
 
+/**---------------------------------------------------------------------------*
+ * @brief Indicates whether `type` is a fixed-point decimal `data_type`.
+ *
+ * Fixed-point types are dispatched to their int32_t or int64_t representation,
+ * so they are also numeric; their scale is stored in the `data_type`.
+ *
+ * @param type The `data_type` to verify
+ * @return true `type` is `DECIMAL32` or `DECIMAL64`
+ * @return false `type` is not a fixed-point type
+ *---------------------------------------------------------------------------**/
+constexpr inline bool is_fixed_point(data_type type) {
+  return type.id() == type_id::DECIMAL32 || type.id() == type_id::DECIMAL64;
+}
+
 /**---------------------------------------------------------------------------*
  * @brief Indicates whether elements of type `T` are fixed-width.
  *
@@ -213,7 +227,9 @@ constexpr inline bool is_fixed_width(data_type type) {
  */
 template <typename T>
 constexpr inline bool is_compound() {
-  return std::is_same<T, cudf::string_view>::value or std::is_same<T, cudf::dictionary32>::value;
+  return std::is_same<T, cudf::string_view>::value or
+         std::is_same<T, cudf::dictionary32>::value or std::is_same<T, cudf::list_view>::value or
+         std::is_same<T, cudf::struct_view>::value;
 }
 
 struct is_compound_impl {
@@ -239,6 +255,21 @@ constexpr inline bool is_compound(data_type type) {
   return cudf::experimental::type_dispatcher(type, is_compound_impl{});
 }
 
+/**
+ * @brief Indicates whether the type `T` is a nested type.
+ *
+ * The rows of a nested type are made of the rows of its child columns, e.g.,
+ * `LIST` and `STRUCT`.
+ *
+ * @tparam T The type to verify
+ * @return true `T` corresponds to a nested type
+ * @return false `T` corresponds to a non-nested type
+ */
+template <typename T>
+constexpr inline bool is_nested() {
+  return std::is_same<T, cudf::list_view>::value or std::is_same<T, cudf::struct_view>::value;
+}
+
 /**---------------------------------------------------------------------------*
  * @brief Indicates whether the type `T` is a simple type.
  *
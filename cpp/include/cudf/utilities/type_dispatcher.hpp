@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/lists/list_view.cuh>
+#include <cudf/structs/struct_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/wrappers/dictionary.hpp>
@@ -113,6 +115,23 @@ CUDF_TYPE_MAPPING(cudf::timestamp_ms, type_id::TIMESTAMP_MILLISECONDS);
 CUDF_TYPE_MAPPING(cudf::timestamp_us, type_id::TIMESTAMP_MICROSECONDS);
 CUDF_TYPE_MAPPING(cudf::timestamp_ns, type_id::TIMESTAMP_NANOSECONDS);
 CUDF_TYPE_MAPPING(dictionary32, type_id::DICTIONARY32);
+CUDF_TYPE_MAPPING(cudf::list_view, type_id::LIST);
+CUDF_TYPE_MAPPING(cudf::struct_view, type_id::STRUCT);
+
+/**---------------------------------------------------------------------------*
+ * @brief Fixed-point types are dispatched to their integer representation.
+ *
+ * The scale is only stored in the `data_type`, so functors that need the
+ * value of an element must also check `cudf::is_fixed_point(dtype)`.
+ *---------------------------------------------------------------------------**/
+template <>
+struct id_to_type_impl<type_id::DECIMAL32> {
+  using type = int32_t;
+};
+template <>
+struct id_to_type_impl<type_id::DECIMAL64> {
+  using type = int64_t;
+};
 
 template <typename T>
 struct type_to_scalar_type_impl {
@@ -180,6 +199,41 @@ using scalar_type_t = typename type_to_scalar_type_impl<T>::ScalarType;
 template <typename T>
 using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceType;
 
+/**---------------------------------------------------------------------------*
+ * @brief Indicates whether `type_dispatcher` instantiates its functors for the
+ * type of `id` in this build.
+ *
+ * The floating-point, timestamp and dictionary types may be left out of the
+ * build with the `DISPATCH_FLOATING_POINT_TYPES`, `DISPATCH_TIMESTAMP_TYPES`
+ * and `DISPATCH_DICTIONARY_TYPES` CMake options, to reduce the size of the
+ * library and of the device code loaded when it is first used. Dispatching a
+ * type that is left out throws `cudf::logic_error`.
+ *
+ * @param id The `cudf::type_id` to check
+ * @return true if columns of type `id` can be dispatched
+ *---------------------------------------------------------------------------**/
+CUDA_HOST_DEVICE_CALLABLE constexpr bool is_dispatched(cudf::type_id id) {
+  switch (id) {
+#ifdef CUDF_EXCLUDE_FLOATING_POINT_DISPATCH
+    case FLOAT32:
+    case FLOAT64: return false;
+#endif
+#ifdef CUDF_EXCLUDE_TIMESTAMP_DISPATCH
+    case TIMESTAMP_DAYS:
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS: return false;
+#endif
+#ifdef CUDF_EXCLUDE_DICTIONARY_DISPATCH
+    case DICTIONARY32: return false;
+#endif
+    case EMPTY:
+    case NUM_TYPE_IDS: return false;
+    default: return true;
+  }
+}
+
 /**---------------------------------------------------------------------------*
  * @brief Invokes an `operator()` template with the type instantiation based on
  * the specified `cudf::data_type`'s `id()`.
@@ -292,12 +346,15 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
       return f.template operator()<typename IdTypeMap<INT32>::type>(std::forward<Ts>(args)...);
     case INT64:
       return f.template operator()<typename IdTypeMap<INT64>::type>(std::forward<Ts>(args)...);
+#ifndef CUDF_EXCLUDE_FLOATING_POINT_DISPATCH
     case FLOAT32:
       return f.template operator()<typename IdTypeMap<FLOAT32>::type>(std::forward<Ts>(args)...);
     case FLOAT64:
       return f.template operator()<typename IdTypeMap<FLOAT64>::type>(std::forward<Ts>(args)...);
+#endif
     case STRING:
       return f.template operator()<typename IdTypeMap<STRING>::type>(std::forward<Ts>(args)...);
+#ifndef CUDF_EXCLUDE_TIMESTAMP_DISPATCH
     case TIMESTAMP_DAYS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_DAYS>::type>(
         std::forward<Ts>(args)...);
@@ -313,9 +370,22 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case TIMESTAMP_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<TIMESTAMP_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_EXCLUDE_DICTIONARY_DISPATCH
     case DICTIONARY32:
       return f.template operator()<typename IdTypeMap<DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
+#endif
+    case DECIMAL32:
+      return f.template operator()<typename IdTypeMap<DECIMAL32>::type>(
+        std::forward<Ts>(args)...);
+    case DECIMAL64:
+      return f.template operator()<typename IdTypeMap<DECIMAL64>::type>(
+        std::forward<Ts>(args)...);
+    case LIST:
+      return f.template operator()<typename IdTypeMap<LIST>::type>(std::forward<Ts>(args)...);
+    case STRUCT:
+      return f.template operator()<typename IdTypeMap<STRUCT>::type>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+
+/**
+ * @brief Computes the Levenshtein edit distance between each string and a target string.
+ *
+ * The distance is the number of characters inserted, deleted or substituted
+ * to turn one string into the other. If `targets` has a single string, every
+ * string is compared to it; otherwise string `i` is compared to target `i`.
+ * Null strings are compared as empty strings.
+ *
+ * ```
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance(s, t)
+ * d is now [1, 7, 0]
+ * ```
+ *
+ * @throw cudf::logic_error if `targets` is not one string or the size of `strings`.
+ *
+ * @param strings Strings column to compare.
+ * @param targets The strings to compare to.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of edit distances.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the Levenshtein edit distance between every two strings of a column.
+ *
+ * Returns a column of `strings.size() * strings.size()` rows where row
+ * `i * strings.size() + j` is the distance between strings `i` and `j`.
+ * Null strings are compared as empty strings.
+ *
+ * ```
+ * s = ["hello", "hallo", "hell"]
+ * d = edit_distance_matrix(s)
+ * d is now [0, 1, 1,
+ *           1, 0, 2,
+ *           1, 2, 0]
+ * ```
+ *
+ * @throw cudf::logic_error if the number of distances overflows the column size limit.
+ *
+ * @param strings Strings column to compare.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of edit distances.
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(
+  cudf::strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace nvtext
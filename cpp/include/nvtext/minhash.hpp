@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+
+/**
+ * @brief Computes the MinHash signature of each string.
+ *
+ * The character ngrams of a string are its substrings of `width` consecutive
+ * characters; a string with fewer characters is its only ngram. For each seed,
+ * the signature of a string has the minimum MurmurHash3_32 (with that seed)
+ * of its ngrams. The fraction of equal values in the signatures of two
+ * strings estimates the Jaccard similarity of their sets of ngrams.
+ *
+ * Returns a column of `strings.size() * seeds.size()` rows where row
+ * `i * seeds.size() + j` is the hash of string `i` for seed `j`. The 32 bits
+ * of the unsigned hashes are stored in INT32 values. The rows of null strings
+ * are null.
+ *
+ * ```
+ * s = ["the quick", null]
+ * h = minhash(s, [0, 1], 4)
+ * h is now [h0, h1, null, null]
+ * where h0 is the minimum hash of "the ", "he q", "e qu", " qui" and "quic"
+ * and "uick" with seed 0, and h1 with seed 1
+ * ```
+ *
+ * @throw cudf::logic_error if `seeds` is not an INT32 column without nulls.
+ * @throw cudf::logic_error if `width` is less than 1.
+ *
+ * @param strings Strings column to compute the signatures of.
+ * @param seeds The seeds of the hash functions.
+ * @param width The number of characters of each ngram.
+ * @param mr Resource for allocating device memory.
+ * @return New INT32 column of the signatures.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace nvtext
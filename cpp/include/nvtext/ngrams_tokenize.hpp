@@ -77,4 +77,67 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
   cudf::string_scalar const& separator = cudf::string_scalar{"_"},
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
 
+/**
+ * @brief The kinds of ngrams of `hash_ngrams_tokenize`
+ */
+enum class ngram_type {
+  TOKENS,     ///< Consecutive tokens of a string
+  CHARACTERS  ///< Consecutive characters of a token
+};
+
+/**
+ * @brief The result of a `hash_ngrams_tokenize`
+ *
+ * The hashes of the ngrams of string `i` are the rows
+ * `[row_offsets[i], row_offsets[i+1])` of `hashes`.
+ */
+struct hashed_ngrams {
+  std::unique_ptr<cudf::column> row_offsets;  ///< INT32 offsets of the hashes of each string
+  std::unique_ptr<cudf::column> hashes;       ///< INT32 MurmurHash3_32 values of the ngrams
+};
+
+/**
+ * @brief Tokenizes each string and returns the hashes of its token or
+ * character ngrams, for feature hashing.
+ *
+ * The strings are tokenized as `tokenize` does, so runs of delimiters are
+ * ignored like `normalize_spaces` ignores runs of whitespace. The hash of a
+ * token ngram is the MurmurHash3_32 of its tokens joined with `separator`,
+ * the same as hashing the strings returned by `ngrams_tokenize`, but without
+ * building any intermediate strings column. The character ngrams are the
+ * consecutive characters of each token; a token with fewer characters than
+ * `ngrams` has none.
+ *
+ * ```
+ * s = ["a  bb ccc", "d"]
+ * r = hash_ngrams_tokenize(s, 2)
+ * r.row_offsets is [0, 2, 2]
+ * r.hashes is [hash("a bb"), hash("bb ccc")]
+ * r = hash_ngrams_tokenize(s, 2, ngram_type::CHARACTERS)
+ * r.row_offsets is [0, 3, 3]
+ * r.hashes is [hash("bb"), hash("cc"), hash("cc")]
+ * ```
+ *
+ * Null strings have no ngrams.
+ *
+ * @throw cudf::logic_error if `ngrams` is less than 1.
+ * @throw cudf::logic_error if `delimiter` or `separator` is invalid.
+ *
+ * @param strings Strings column to tokenize and produce ngrams from.
+ * @param ngrams The number of tokens or characters of each ngram.
+ * @param type Whether the ngrams are of tokens or of the characters of each token.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param separator The string hashed between the tokens of a token ngram.
+ * @param mr Resource for allocating device memory.
+ * @return The offsets of the hashes of each string and the hashes.
+ */
+hashed_ngrams hash_ngrams_tokenize(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 2,
+  ngram_type type                      = ngram_type::TOKENS,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::string_scalar const& separator = cudf::string_scalar{" "},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
 }  // namespace nvtext
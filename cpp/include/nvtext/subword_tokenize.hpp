@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <string>
+
+namespace nvtext {
+
+/**
+ * @brief A WordPiece vocabulary and the device hash table used to look up its tokens.
+ *
+ * The id of a token is its row in the vocabulary. Tokens starting with "##"
+ * continue a word, and are only matched after the start of a word.
+ * The hash table is built once, and is reused by every `subword_tokenize` call.
+ */
+class wordpiece_vocabulary {
+ public:
+  /**
+   * @brief Builds the hash table of a vocabulary.
+   *
+   * @throw cudf::logic_error if `vocabulary` is empty or contains nulls.
+   * @throw cudf::logic_error if `unknown_token` is not in `vocabulary`.
+   *
+   * @param vocabulary The tokens of the vocabulary, one per row.
+   * @param unknown_token The token used for the words that cannot be tokenized.
+   * @param mr Resource for allocating device memory.
+   */
+  wordpiece_vocabulary(cudf::strings_column_view const& vocabulary,
+                       std::string const& unknown_token    = "[UNK]",
+                       rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Returns the tokens of the vocabulary.
+   */
+  cudf::strings_column_view vocabulary() const { return cudf::strings_column_view{*_vocabulary}; }
+
+  /**
+   * @brief Returns the INT32 hash table of the vocabulary.
+   *
+   * The first half holds the rows of the tokens starting a word, and the
+   * second half the rows of the tokens continuing a word, keyed without "##".
+   * Empty slots are -1.
+   */
+  cudf::column_view hash_table() const { return _table->view(); }
+
+  /**
+   * @brief Returns the id of the token used for the words that cannot be tokenized.
+   */
+  int32_t unknown_token_id() const { return _unknown_token_id; }
+
+ private:
+  std::unique_ptr<cudf::column> _vocabulary;
+  std::unique_ptr<cudf::column> _table;
+  int32_t _unknown_token_id;
+};
+
+/**
+ * @brief Loads a vocabulary file with one token per line, like the `vocab.txt`
+ * files of BERT models.
+ *
+ * @throw cudf::logic_error if the file cannot be read.
+ *
+ * @param filename Path of the vocabulary file.
+ * @param unknown_token The token used for the words that cannot be tokenized.
+ * @param mr Resource for allocating device memory.
+ * @return The vocabulary and its hash table.
+ */
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(
+  std::string const& filename,
+  std::string const& unknown_token    = "[UNK]",
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief The result of a `subword_tokenize`
+ *
+ * The token ids of string `i` are the rows `[row_offsets[i], row_offsets[i+1])`
+ * of `token_ids` and `attention_mask`.
+ */
+struct subword_tokenize_result {
+  std::unique_ptr<cudf::column> row_offsets;     ///< INT32 offsets of the rows of each string
+  std::unique_ptr<cudf::column> token_ids;       ///< INT32 token ids
+  std::unique_ptr<cudf::column> attention_mask;  ///< INT32 1 for tokens and 0 for padding
+};
+
+/**
+ * @brief Tokenizes each string into the ids of the WordPiece tokens of a vocabulary.
+ *
+ * Words are separated by whitespace (character code-point <= ' '), and each
+ * ASCII punctuation character is a word. Each word is split into the longest
+ * tokens of the vocabulary from left to right. A word that cannot be split,
+ * or has more than `max_word_length` characters, is the unknown token.
+ * The strings should be normalized (e.g. lower-cased) as the vocabulary expects.
+ *
+ * If `max_sequence_length` is 0, the layout is ragged: all the token ids of a
+ * string are returned and the attention mask is all 1s. Otherwise each string
+ * has `max_sequence_length` rows: its tokens are truncated to that length, and
+ * padded with `padding_id`, whose attention mask is 0.
+ *
+ * ```
+ * v = ["[UNK]", "the", "play", "##ing", "!"]
+ * s = ["the playing!", "xyz"]
+ * r = subword_tokenize(s, wordpiece_vocabulary(v), 4)
+ * r.row_offsets is    [0, 4, 8]
+ * r.token_ids is      [1, 2, 3, 4, 0, 0, 0, 0]
+ * r.attention_mask is [1, 1, 1, 1, 1, 0, 0, 0]
+ * ```
+ *
+ * Null strings have no tokens.
+ *
+ * @throw cudf::logic_error if `max_sequence_length` or `max_word_length` is negative.
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary The vocabulary of the tokens.
+ * @param max_sequence_length The number of rows of each string, or 0 for a ragged layout.
+ * @param padding_id The id of the padding rows.
+ * @param max_word_length The words with more characters are the unknown token.
+ * @param mr Resource for allocating device memory.
+ * @return The offsets of the rows of each string, and the token ids and attention mask.
+ */
+subword_tokenize_result subword_tokenize(
+  cudf::strings_column_view const& strings,
+  wordpiece_vocabulary const& vocabulary,
+  cudf::size_type max_sequence_length = 0,
+  int32_t padding_id                  = 0,
+  cudf::size_type max_word_length     = 100,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+}  // namespace nvtext
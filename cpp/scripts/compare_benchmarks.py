@@ -0,0 +1,130 @@
+# Copyright (c) 2020, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Compares the JSON results of two runs of the libcudf benchmarks.
+
+Each run is produced with
+    <BENCH> --benchmark_out=<file> --benchmark_out_format=json \\
+            --benchmark_repetitions=<n>
+
+Times and the `peak_memory_usage` counter of `cuda_event_timer` are compared
+for every benchmark of both runs. A benchmark regresses when its mean is
+worse than the baseline by more than `--threshold` percent *and* by more than
+`--noise` standard deviations of the two runs, so that a noisy benchmark must
+move further before it is flagged. The script exits with status 1 if any
+benchmark regresses.
+"""
+
+from __future__ import print_function
+import argparse
+import json
+import math
+import sys
+from collections import OrderedDict
+
+
+METRICS = [("real_time", "time"),
+           ("peak_memory_usage", "peak memory")]
+
+
+def parse_args():
+    argparser = argparse.ArgumentParser(
+        "Compares the JSON results of two benchmark runs")
+    argparser.add_argument("baseline", help="JSON results of the baseline run")
+    argparser.add_argument("contender", help="JSON results of the new run")
+    argparser.add_argument("-threshold", type=float, default=5.0,
+                           help="Smallest change reported, in percent")
+    argparser.add_argument("-noise", type=float, default=2.0,
+                           help="Smallest change reported, in standard "
+                           "deviations of the repetitions")
+    argparser.add_argument("-all", action="store_true",
+                           help="Print every benchmark, not only the changes")
+    return argparser.parse_args()
+
+
+def load_samples(filename):
+    """Returns the samples of each metric of each benchmark of a run, in the
+    time unit of the run, skipping the aggregates of the repetitions"""
+    with open(filename) as f:
+        results = json.load(f)
+    samples = OrderedDict()
+    for bench in results["benchmarks"]:
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        name = bench.get("run_name", bench["name"])
+        metrics = samples.setdefault(name, {})
+        for key, _ in METRICS:
+            if key in bench:
+                metrics.setdefault(key, []).append(float(bench[key]))
+    return samples
+
+
+def mean_and_stddev(values):
+    mean = sum(values) / len(values)
+    if len(values) < 2:
+        return mean, 0.0
+    variance = sum((v - mean) ** 2 for v in values) / (len(values) - 1)
+    return mean, math.sqrt(variance)
+
+
+def compare(baseline, contender, threshold, noise):
+    """Returns the relative change of the mean of `contender` and whether it
+    is a significant regression or improvement (1 or -1) or not (0)"""
+    old_mean, old_stddev = mean_and_stddev(baseline)
+    new_mean, new_stddev = mean_and_stddev(contender)
+    if old_mean == 0:
+        return 0.0, 0
+    change = (new_mean - old_mean) / old_mean
+    # Standard deviation of the difference of the means
+    stddev = math.sqrt(old_stddev ** 2 / len(baseline) +
+                       new_stddev ** 2 / len(contender))
+    significant = (abs(change) * 100 > threshold and
+                   abs(new_mean - old_mean) > noise * stddev)
+    if not significant:
+        return change, 0
+    return change, 1 if change > 0 else -1
+
+
+def main():
+    args = parse_args()
+    baseline = load_samples(args.baseline)
+    contender = load_samples(args.contender)
+
+    regressions = 0
+    for name, metrics in contender.items():
+        if name not in baseline:
+            print("NEW        {}".format(name))
+            continue
+        for key, label in METRICS:
+            if key not in metrics or key not in baseline[name]:
+                continue
+            change, status = compare(baseline[name][key], metrics[key],
+                                     args.threshold, args.noise)
+            if status == 0 and not args.all:
+                continue
+            tag = {1: "REGRESSION", -1: "IMPROVED", 0: "SAME"}[status]
+            print("{:<10} {} {}: {:+.1f}%".format(tag, name, label,
+                                                   change * 100))
+            regressions += status == 1
+    for name in baseline:
+        if name not in contender:
+            print("MISSING    {}".format(name))
+
+    print("{} regression(s)".format(regressions))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -16,6 +16,8 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -97,6 +99,35 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(size_type n,
   return std::make_unique<detail::nth_element_aggregation>(
     aggregation::NTH_ELEMENT, n, _include_nulls);
 }
+/// Factory to create a COLLECT aggregation
+std::unique_ptr<aggregation> make_collect_aggregation() {
+  return std::make_unique<aggregation>(aggregation::COLLECT);
+}
+/// Factory to create a TDIGEST aggregation
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids) {
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::TDIGEST, max_centroids);
+}
+/// Factory to create a MERGE_TDIGEST aggregation
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids) {
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::MERGE_TDIGEST, max_centroids);
+}
+/// Factory to create an APPROX_QUANTILE aggregation
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              int max_centroids) {
+  return std::make_unique<detail::approx_quantile_aggregation>(q, max_centroids);
+}
+/// Factory to create a ROW_NUMBER aggregation
+std::unique_ptr<aggregation> make_row_number_aggregation() {
+  return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
+}
+/// Factory to create a LEAD aggregation
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset) {
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LEAD, offset);
+}
+/// Factory to create a LAG aggregation
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset) {
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LAG, offset);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
@@ -123,15 +154,45 @@ struct is_valid_aggregation_impl {
     return is_valid_aggregation<Source, k>();
   }
 };
+
+// The aggregations of fixed-point values that are computed on their representations
+bool is_valid_fixed_point_aggregation(aggregation::Kind k) {
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::ARGMAX:
+    case aggregation::ARGMIN:
+    case aggregation::NUNIQUE:
+    case aggregation::NTH_ELEMENT:
+    case aggregation::COLLECT: return true;
+    default: return false;
+  }
+}
 }  // namespace
 
 // Return target data_type for the given source_type and aggregation
 data_type target_type(data_type source, aggregation::Kind k) {
+  if (is_fixed_point(source)) {
+    CUDF_EXPECTS(is_valid_fixed_point_aggregation(k),
+                 "Unsupported aggregation for fixed-point values");
+    // a sum or selection of representations keeps the scale of the values
+    switch (k) {
+      case aggregation::SUM: return data_type{DECIMAL64, source.scale()};
+      case aggregation::MIN:
+      case aggregation::MAX:
+      case aggregation::NTH_ELEMENT: return source;
+      default: break;
+    }
+  }
   return dispatch_type_and_aggregation(source, k, target_type_functor{});
 }
 
 // Verifies the aggregation `k` is valid on the type `source`
 bool is_valid_aggregation(data_type source, aggregation::Kind k) {
+  if (is_fixed_point(source) and not is_valid_fixed_point_aggregation(k)) { return false; }
   return dispatch_type_and_aggregation(source, k, is_valid_aggregation_impl{});
 }
 }  // namespace detail
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/arrow_device.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace cudf {
+
+namespace {
+
+std::vector<column_view> children_of(column_view const& col) {
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children(); ++i) { children.push_back(col.child(i)); }
+  return children;
+}
+
+/**
+ * @brief The data of an exported array: the buffer and child pointers it
+ * exposes, and a reference to the table owning the buffers
+ */
+struct exported_array {
+  std::shared_ptr<experimental::table> owner;
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> child_pointers;
+};
+
+void release_array(ArrowArray* array) {
+  auto data = static_cast<exported_array*>(array->private_data);
+  // Children moved out by the consumer are already marked released
+  for (auto child : data->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete data;
+  array->release = nullptr;
+}
+
+/**
+ * @brief The data of an exported schema: its format and children
+ */
+struct exported_schema {
+  std::string format;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+void release_schema(ArrowSchema* schema) {
+  auto data = static_cast<exported_schema*>(schema->private_data);
+  for (auto child : data->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+std::string arrow_format(data_type type) {
+  switch (type.id()) {
+    case INT8: return "c";
+    case INT16: return "s";
+    case INT32: return "i";
+    case INT64: return "l";
+    case FLOAT32: return "f";
+    case FLOAT64: return "g";
+    case TIMESTAMP_DAYS: return "tdD";
+    case TIMESTAMP_SECONDS: return "tss:";
+    case TIMESTAMP_MILLISECONDS: return "tsm:";
+    case TIMESTAMP_MICROSECONDS: return "tsu:";
+    case TIMESTAMP_NANOSECONDS: return "tsn:";
+    case STRING: return "u";
+    case LIST: return "+l";
+    case STRUCT: return "+s";
+    default: CUDF_FAIL("Unsupported type for the Arrow C Data Interface");
+  }
+}
+
+data_type cudf_type(std::string const& format) {
+  if (format == "c") { return data_type{INT8}; }
+  if (format == "s") { return data_type{INT16}; }
+  if (format == "i") { return data_type{INT32}; }
+  if (format == "l") { return data_type{INT64}; }
+  if (format == "f") { return data_type{FLOAT32}; }
+  if (format == "g") { return data_type{FLOAT64}; }
+  if (format == "tdD") { return data_type{TIMESTAMP_DAYS}; }
+  // Time zones are not part of cudf timestamps
+  if (format.compare(0, 4, "tss:") == 0) { return data_type{TIMESTAMP_SECONDS}; }
+  if (format.compare(0, 4, "tsm:") == 0) { return data_type{TIMESTAMP_MILLISECONDS}; }
+  if (format.compare(0, 4, "tsu:") == 0) { return data_type{TIMESTAMP_MICROSECONDS}; }
+  if (format.compare(0, 4, "tsn:") == 0) { return data_type{TIMESTAMP_NANOSECONDS}; }
+  if (format == "u") { return data_type{STRING}; }
+  if (format == "+l") { return data_type{LIST}; }
+  if (format == "+s") { return data_type{STRUCT}; }
+  CUDF_FAIL("Unsupported Arrow format: " + format);
+}
+
+/**
+ * @brief Checks that `col` and its children can be exported, before anything
+ * is exported
+ */
+void expect_exportable(column_view const& col) {
+  arrow_format(col.type());
+  for (auto const& child : children_of(col)) { expect_exportable(child); }
+}
+
+void export_schema(std::string format,
+                   std::vector<column_view> const& children,
+                   int64_t flags,
+                   ArrowSchema* out);
+
+/**
+ * @brief Exports the schema of `col`, whose children are the ones of its
+ * LIST or STRUCT elements
+ */
+void export_column_schema(column_view const& col, ArrowSchema* out) {
+  std::vector<column_view> children;
+  if (col.type().id() == LIST) {
+    children.push_back(col.child(1));
+  } else if (col.type().id() == STRUCT) {
+    children = children_of(col);
+  }
+  export_schema(
+    arrow_format(col.type()), children, col.nullable() ? ARROW_FLAG_NULLABLE : 0, out);
+}
+
+void export_schema(std::string format,
+                   std::vector<column_view> const& children,
+                   int64_t flags,
+                   ArrowSchema* out) {
+  auto data    = std::make_unique<exported_schema>();
+  data->format = std::move(format);
+  data->children.resize(children.size());
+  for (size_t i = 0; i < children.size(); ++i) {
+    export_column_schema(children[i], &data->children[i]);
+    data->child_pointers.push_back(&data->children[i]);
+  }
+
+  out->format       = data->format.c_str();
+  out->name         = nullptr;
+  out->metadata     = nullptr;
+  out->flags        = flags;
+  out->n_children   = data->child_pointers.size();
+  out->children     = data->child_pointers.data();
+  out->dictionary   = nullptr;
+  out->release      = release_schema;
+  out->private_data = data.release();
+}
+
+void export_children(std::vector<column_view> const& children,
+                     std::shared_ptr<experimental::table> const& owner,
+                     exported_array& data);
+
+/**
+ * @brief Exports the buffers of `col`, which stay owned by `owner`
+ */
+void export_column(column_view const& col,
+                   std::shared_ptr<experimental::table> const& owner,
+                   ArrowArray* out) {
+  auto data   = std::make_unique<exported_array>();
+  data->owner = owner;
+  // The Arrow offset applies to the validity as to the elements
+  data->buffers.push_back(col.nullable() ? col.null_mask() : nullptr);
+  switch (col.type().id()) {
+    case STRING:
+      // An empty strings column may have no offsets and chars children
+      data->buffers.push_back(col.num_children() > 0 ? col.child(0).head<void>() : nullptr);
+      data->buffers.push_back(col.num_children() > 1 ? col.child(1).head<void>() : nullptr);
+      break;
+    case LIST:
+      data->buffers.push_back(col.child(0).head<void>());
+      export_children({col.child(1)}, owner, *data);
+      break;
+    case STRUCT:
+      export_children(children_of(col), owner, *data);
+      break;
+    default: data->buffers.push_back(col.head<void>());
+  }
+
+  out->length       = col.size();
+  out->null_count   = col.null_count();
+  out->offset       = col.offset();
+  out->n_buffers    = data->buffers.size();
+  out->n_children   = data->child_pointers.size();
+  out->buffers      = data->buffers.data();
+  out->children     = data->child_pointers.data();
+  out->dictionary   = nullptr;
+  out->release      = release_array;
+  out->private_data = data.release();
+}
+
+void export_children(std::vector<column_view> const& children,
+                     std::shared_ptr<experimental::table> const& owner,
+                     exported_array& data) {
+  data.children.resize(children.size());
+  for (size_t i = 0; i < children.size(); ++i) {
+    export_column(children[i], owner, &data.children[i]);
+    data.child_pointers.push_back(&data.children[i]);
+  }
+}
+
+size_type checked_size(int64_t size) {
+  CUDF_EXPECTS(size <= std::numeric_limits<size_type>::max(),
+               "Arrow array exceeds the column size limit");
+  return static_cast<size_type>(size);
+}
+
+/**
+ * @brief Views the buffers of `array` as a column of the type of `schema`
+ */
+column_view import_column(ArrowSchema const* schema, ArrowArray const* array) {
+  auto const type   = cudf_type(schema->format);
+  auto const size   = checked_size(array->length);
+  auto const offset = checked_size(array->offset);
+  auto const mask   = static_cast<bitmask_type const*>(array->buffers[0]);
+  // Arrow arrays may omit the validity of arrays without nulls
+  auto const null_count = mask == nullptr ? 0
+                                          : array->null_count < 0
+                                              ? UNKNOWN_NULL_COUNT
+                                              : checked_size(array->null_count);
+  auto const num_offsets = checked_size(array->offset + array->length + 1);
+
+  switch (type.id()) {
+    case STRING: {
+      if (array->buffers[1] == nullptr) {
+        CUDF_EXPECTS(size == 0, "Arrow string array has no offsets");
+        return column_view(type, 0, nullptr);
+      }
+      // The number of chars is the last offset of the array
+      size_type num_chars{0};
+      auto const last_offset = static_cast<size_type const*>(array->buffers[1]) + num_offsets - 1;
+      CUDA_TRY(cudaMemcpy(&num_chars, last_offset, sizeof(size_type), cudaMemcpyDeviceToHost));
+      auto offsets = column_view(data_type{INT32}, num_offsets, array->buffers[1]);
+      auto chars   = column_view(data_type{INT8}, num_chars, array->buffers[2]);
+      return column_view(type, size, nullptr, mask, null_count, offset, {offsets, chars});
+    }
+    case LIST: {
+      CUDF_EXPECTS(array->n_children == 1 && schema->n_children == 1,
+                   "Arrow list array must have one child");
+      auto offsets = column_view(data_type{INT32}, num_offsets, array->buffers[1]);
+      auto child   = import_column(schema->children[0], array->children[0]);
+      return column_view(type, size, nullptr, mask, null_count, offset, {offsets, child});
+    }
+    case STRUCT: {
+      CUDF_EXPECTS(array->n_children == schema->n_children,
+                   "Arrow struct array and schema have different children");
+      std::vector<column_view> children;
+      for (int64_t i = 0; i < array->n_children; ++i) {
+        children.push_back(import_column(schema->children[i], array->children[i]));
+      }
+      return column_view(type, size, nullptr, mask, null_count, offset, children);
+    }
+    default: return column_view(type, size, array->buffers[1], mask, null_count, offset);
+  }
+}
+
+}  // namespace
+
+void to_arrow_device(std::unique_ptr<experimental::table> input,
+                     ArrowSchema* schema,
+                     ArrowArray* array) {
+  CUDF_FUNC_RANGE();
+  std::shared_ptr<experimental::table> owner{std::move(input)};
+  auto const view = owner->view();
+  std::vector<column_view> columns(view.begin(), view.end());
+  std::for_each(columns.begin(), columns.end(), expect_exportable);
+
+  // The table is a struct array without nulls of its columns
+  export_schema("+s", columns, 0, schema);
+  auto data   = std::make_unique<exported_array>();
+  data->owner = owner;
+  data->buffers.push_back(nullptr);
+  export_children(columns, owner, *data);
+
+  array->length       = view.num_rows();
+  array->null_count   = 0;
+  array->offset       = 0;
+  array->n_buffers    = data->buffers.size();
+  array->n_children   = data->child_pointers.size();
+  array->buffers      = data->buffers.data();
+  array->children     = data->child_pointers.data();
+  array->dictionary   = nullptr;
+  array->release      = release_array;
+  array->private_data = data.release();
+}
+
+std::pair<table_view, std::shared_ptr<ArrowArray>> from_arrow_device(ArrowSchema const* schema,
+                                                                     ArrowArray* array) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(array->release != nullptr, "Arrow array is released");
+  CUDF_EXPECTS(std::string(schema->format) == "+s", "Arrow array must be a struct array");
+  CUDF_EXPECTS(array->null_count == 0, "Arrow struct array of a table must not have nulls");
+  CUDF_EXPECTS(array->n_children == schema->n_children,
+               "Arrow struct array and schema have different children");
+
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    auto column = import_column(schema->children[i], array->children[i]);
+    // The offset and length of the struct apply to its children
+    if (array->offset != 0 || array->length != column.size()) {
+      auto const begin = checked_size(array->offset);
+      column = experimental::slice(column, {begin, begin + checked_size(array->length)})[0];
+    }
+    columns.push_back(column);
+  }
+
+  // Move the array, as the C Data Interface specifies, into its owner
+  auto owner = std::shared_ptr<ArrowArray>(new ArrowArray(*array), [](ArrowArray* imported) {
+    if (imported->release != nullptr) { imported->release(imported); }
+    delete imported;
+  });
+  array->release = nullptr;
+
+  return std::make_pair(table_view(columns), std::move(owner));
+}
+
+}  // namespace cudf
@@ -51,7 +51,12 @@
 #include <libcudacxx/simt/ratio.jit>
 #include <libcudacxx/simt/type_traits.jit>
 #include <libcudacxx/simt/version.jit>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <algorithm>
 #include <string>
+#include <vector>
+
 #include <timestamps.hpp.jit>
 #include <types.hpp.jit>
 
@@ -224,10 +229,92 @@ void binary_operation(mutable_column_view& out,
             cudf::jit::get_data_ptr(rhs));
 }
 
+/**
+ * @brief Appends the code of the value of `expr` in row `i` to `code`, and
+ * returns the type of the value
+ *
+ * The data of each leaf of `expr` is appended to `inputs`, whose elements the
+ * code refers to by their index. The types, not the data, of the leaves
+ * appear in the code, so expressions of the same shape share their kernel.
+ */
+data_type generate_expression(expression const& expr,
+                              table_view const& table,
+                              std::vector<void const*>& inputs,
+                              std::string& code) {
+  switch (expr.get_kind()) {
+    case expression::kind::COLUMN_REFERENCE: {
+      CUDF_EXPECTS(expr.column_index() >= 0 && expr.column_index() < table.num_columns(),
+                   "Expression refers to a column out of range");
+      auto const& col = table.column(expr.column_index());
+      CUDF_EXPECTS(is_fixed_width(col.type()), "Invalid/Unsupported column datatype");
+      code += "static_cast<" + cudf::jit::get_type_name(col.type()) + " const*>(inputs[" +
+              std::to_string(inputs.size()) + "])[i]";
+      inputs.push_back(cudf::jit::get_data_ptr(col));
+      return col.type();
+    }
+    case expression::kind::LITERAL: {
+      auto const& value = expr.literal_value();
+      code += "static_cast<" + cudf::jit::get_type_name(value.type()) + " const*>(inputs[" +
+              std::to_string(inputs.size()) + "])[0]";
+      inputs.push_back(cudf::jit::get_data_ptr(value));
+      return value.type();
+    }
+    default: {
+      std::string lhs_code, rhs_code;
+      auto const lhs_type = generate_expression(expr.lhs(), table, inputs, lhs_code);
+      auto const rhs_type = generate_expression(expr.rhs(), table, inputs, rhs_code);
+      code += get_operator_name(expr.op(), OperatorType::Direct) + "::operate<" +
+              cudf::jit::get_type_name(expr.output_type()) + ", " +
+              cudf::jit::get_type_name(lhs_type) + ", " + cudf::jit::get_type_name(rhs_type) +
+              ">(" + lhs_code + ", " + rhs_code + ")";
+      return expr.output_type();
+    }
+  }
+}
+
+void compute_column(mutable_column_view& out,
+                    table_view const& table,
+                    expression const& expr,
+                    cudaStream_t stream) {
+  std::vector<void const*> inputs;
+  std::string code;
+  auto const type = generate_expression(expr, table, inputs, code);
+
+  std::string const cuda_source = std::string{code::expression_headers} + "__device__ " +
+                                  cudf::jit::get_type_name(type) +
+                                  " evaluate_expression(cudf::size_type i, "
+                                  "void const* const* inputs) {\n  return " +
+                                  code + ";\n}\n" + code::expression_kernel;
+  std::string const expression_hash =
+    hash + ".expression." + std::to_string(std::hash<std::string>{}(cuda_source));
+
+  rmm::device_vector<void const*> d_inputs(inputs);
+  cudf::jit::launcher(
+    expression_hash, cuda_source, header_names, compiler_flags, headers_code, stream)
+    .set_kernel_inst("kernel_expression",  // name of the kernel we are launching
+                     {cudf::jit::get_type_name(out.type())})  // list of template arguments
+    .launch(out.size(), cudf::jit::get_data_ptr(out), d_inputs.data().get());
+}
+
 }  // namespace jit
 }  // namespace binops
 
 namespace detail {
+namespace {
+
+// Fixed-point operations are only compiled: the JIT operations would use the representations
+bool has_fixed_point(data_type lhs, data_type rhs, data_type out) {
+  return is_fixed_point(lhs) or is_fixed_point(rhs) or is_fixed_point(out);
+}
+
+// The null count of an operation between `col` and a scalar, which is only
+// counted from the mask when both have valid rows
+size_type scalar_null_count(column_view const& col, bool scalar_is_valid) {
+  if (not scalar_is_valid) { return col.size(); }
+  return col.nullable() ? cudf::UNKNOWN_NULL_COUNT : 0;
+}
+
+}  // namespace
 
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
@@ -245,14 +332,27 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   CUDF_EXPECTS(is_fixed_width(lhs.type()), "Invalid/Unsupported lhs datatype");
   CUDF_EXPECTS(is_fixed_width(rhs.type()), "Invalid/Unsupported rhs datatype");
 
-  auto new_mask = binops::detail::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
-  auto out      = make_fixed_width_column(
-    output_type, rhs.size(), new_mask, cudf::UNKNOWN_NULL_COUNT, stream, mr);
+  auto const scalar_is_valid = lhs.is_valid(stream);
+  auto new_mask              = binops::detail::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
+  auto out                   = make_fixed_width_column(
+    output_type, rhs.size(), new_mask, scalar_null_count(rhs, scalar_is_valid), stream, mr);
 
   if (rhs.size() == 0) { return out; }
 
+  bool const is_compiled =
+    binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op);
+  CUDF_EXPECTS(is_compiled or not has_fixed_point(lhs.type(), rhs.type(), output_type),
+               "Unsupported operator for fixed-point binary operation");
+
+  // Every row of an invalid scalar is null, whatever its data
+  if (not scalar_is_valid) { return out; }
+
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (is_compiled) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -272,14 +372,27 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   CUDF_EXPECTS(is_fixed_width(lhs.type()), "Invalid/Unsupported lhs datatype");
   CUDF_EXPECTS(is_fixed_width(rhs.type()), "Invalid/Unsupported rhs datatype");
 
-  auto new_mask = binops::detail::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
-  auto out      = make_fixed_width_column(
-    output_type, lhs.size(), new_mask, cudf::UNKNOWN_NULL_COUNT, stream, mr);
+  auto const scalar_is_valid = rhs.is_valid(stream);
+  auto new_mask              = binops::detail::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
+  auto out                   = make_fixed_width_column(
+    output_type, lhs.size(), new_mask, scalar_null_count(lhs, scalar_is_valid), stream, mr);
 
   if (lhs.size() == 0) { return out; }
 
+  bool const is_compiled =
+    binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op);
+  CUDF_EXPECTS(is_compiled or not has_fixed_point(lhs.type(), rhs.type(), output_type),
+               "Unsupported operator for fixed-point binary operation");
+
+  // Every row of an invalid scalar is null, whatever its data
+  if (not scalar_is_valid) { return out; }
+
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (is_compiled) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -309,7 +422,13 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  if (binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op)) {
+    binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
+  } else {
+    CUDF_EXPECTS(not has_fixed_point(lhs.type(), rhs.type(), output_type),
+                 "Unsupported operator for fixed-point binary operation");
+    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  }
   return out;
 }
 
@@ -342,8 +461,103 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return out;
 }
 
+namespace {
+
+// Collects the columns and literals referenced by `expr`
+void collect_leaves(expression const& expr,
+                    table_view const& table,
+                    std::vector<column_view>& columns,
+                    std::vector<scalar const*>& literals) {
+  switch (expr.get_kind()) {
+    case expression::kind::COLUMN_REFERENCE:
+      CUDF_EXPECTS(expr.column_index() >= 0 && expr.column_index() < table.num_columns(),
+                   "Expression refers to a column out of range");
+      columns.push_back(table.column(expr.column_index()));
+      break;
+    case expression::kind::LITERAL: literals.push_back(&expr.literal_value()); break;
+    default:
+      collect_leaves(expr.lhs(), table, columns, literals);
+      collect_leaves(expr.rhs(), table, columns, literals);
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream) {
+  CUDF_EXPECTS(expr.get_kind() == expression::kind::OPERATION,
+               "The root of the expression must be an operation");
+
+  std::vector<column_view> columns;
+  std::vector<scalar const*> literals;
+  collect_leaves(expr, table, columns, literals);
+  CUDF_EXPECTS(std::none_of(columns.begin(),
+                            columns.end(),
+                            [](auto const& col) { return is_fixed_point(col.type()); }) and
+                 std::none_of(literals.begin(),
+                              literals.end(),
+                              [](auto literal) { return is_fixed_point(literal->type()); }),
+               "Expressions of fixed-point operands are not supported");
+
+  auto const size = table.num_rows();
+  rmm::device_buffer new_mask{};
+  if (std::any_of(literals.begin(), literals.end(), [stream](auto literal) {
+        return not literal->is_valid(stream);
+      })) {
+    new_mask = create_null_mask(size, mask_state::ALL_NULL, stream, mr);
+  } else if (not columns.empty()) {
+    new_mask = bitmask_and(table_view(columns), mr, stream);
+  }
+  auto out = make_fixed_width_column(
+    expr.output_type(), size, std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+
+  if (size == 0) { return out; }
+
+  auto out_view = out->mutable_view();
+  binops::jit::compute_column(out_view, table, expr, stream);
+  return out;
+}
+
 }  // namespace detail
 
+expression expression::column_reference(size_type column_index) {
+  expression expr{kind::COLUMN_REFERENCE};
+  expr._column_index = column_index;
+  return expr;
+}
+
+expression expression::literal(scalar const& value) {
+  CUDF_EXPECTS(is_fixed_width(value.type()), "Invalid/Unsupported literal datatype");
+  expression expr{kind::LITERAL};
+  expr._literal = &value;
+  return expr;
+}
+
+expression expression::operation(binary_operator op,
+                                 expression const& lhs,
+                                 expression const& rhs,
+                                 data_type output_type) {
+  CUDF_EXPECTS(is_fixed_width(output_type), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(op != binary_operator::COALESCE && op != binary_operator::GENERIC_BINARY &&
+                 op != binary_operator::INVALID_BINARY,
+               "Unsupported operator in an expression");
+  expression expr{kind::OPERATION};
+  expr._op          = op;
+  expr._output_type = output_type;
+  expr._lhs         = std::make_shared<expression const>(lhs);
+  expr._rhs         = std::make_shared<expression const>(rhs);
+  return expr;
+}
+
+std::unique_ptr<column> compute_column(table_view const& table,
+                                       expression const& expr,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mr);
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -17,10 +17,17 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+
 #include "binary_ops.hpp"
 
 namespace cudf {
@@ -219,6 +226,501 @@ struct binary_op {
   }
 };
 
+
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_integral<Out>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE Out mod(Lhs x, Rhs y) {
+  return static_cast<Out>(x) % static_cast<Out>(y);
+}
+
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_same<Out, float>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE Out mod(Lhs x, Rhs y) {
+  return fmodf(static_cast<Out>(x), static_cast<Out>(y));
+}
+
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_same<Out, double>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE Out mod(Lhs x, Rhs y) {
+  return fmod(static_cast<Out>(x), static_cast<Out>(y));
+}
+
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_integral<Out>::value and std::is_integral<Lhs>::value and
+                           std::is_integral<Rhs>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE Out python_mod(Lhs x, Rhs y) {
+  return ((x % y) + y) % y;
+}
+
+// `is_supported_operation()` keeps integral PYMOD of floating point operands on
+// the JIT path, which rejects it
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_integral<Out>::value and
+                           not(std::is_integral<Lhs>::value and
+                               std::is_integral<Rhs>::value)>* = nullptr>
+CUDA_DEVICE_CALLABLE Out python_mod(Lhs, Rhs) {
+  return Out{};
+}
+
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<std::is_floating_point<Out>::value>* = nullptr>
+CUDA_DEVICE_CALLABLE Out python_mod(Lhs x, Rhs y) {
+  double x1 = static_cast<double>(x);
+  double y1 = static_cast<double>(y);
+  return fmod(fmod(x1, y1) + y1, y1);
+}
+
+/**
+ * @brief Returns whether the compiled fixed-width path is instantiated for
+ * operands of types `Lhs` and `Rhs`
+ */
+template <typename Lhs, typename Rhs>
+constexpr bool is_fixed_width_pair() {
+  return (is_numeric<Lhs>() and is_numeric<Rhs>()) or
+         (is_timestamp<Lhs>() and std::is_same<Lhs, Rhs>::value);
+}
+
+/**
+ * @brief Computes the arithmetic and logical operators exactly as the JIT
+ * operators of `binaryop/jit/code/operation.cpp` do
+ */
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<is_numeric<Lhs>() and is_numeric<Rhs>()>* = nullptr>
+CUDA_DEVICE_CALLABLE Out arithmetic_binop(binary_operator op, Lhs x, Rhs y) {
+  switch (op) {
+    case binary_operator::ADD: return static_cast<Out>(x) + static_cast<Out>(y);
+    case binary_operator::SUB: return static_cast<Out>(x) - static_cast<Out>(y);
+    case binary_operator::MUL: return static_cast<Out>(x) * static_cast<Out>(y);
+    case binary_operator::DIV: return static_cast<Out>(x) / static_cast<Out>(y);
+    case binary_operator::TRUE_DIV: return static_cast<double>(x) / static_cast<double>(y);
+    case binary_operator::FLOOR_DIV: return floor(static_cast<double>(x) / static_cast<double>(y));
+    case binary_operator::MOD: return mod<Out>(x, y);
+    case binary_operator::PYMOD: return python_mod<Out>(x, y);
+    case binary_operator::POW: return pow(static_cast<double>(x), static_cast<double>(y));
+    case binary_operator::LOGICAL_AND: return x && y;
+    case binary_operator::LOGICAL_OR: return x || y;
+    default: return Out{};
+  }
+}
+
+// Timestamps are only compared
+template <typename Out,
+          typename Lhs,
+          typename Rhs,
+          std::enable_if_t<not(is_numeric<Lhs>() and is_numeric<Rhs>())>* = nullptr>
+CUDA_DEVICE_CALLABLE Out arithmetic_binop(binary_operator, Lhs, Rhs) {
+  return Out{};
+}
+
+/**
+ * @brief Stores `op(x, y)` in row `i` of `out`, dispatched on the type of `out`
+ */
+template <typename Lhs, typename Rhs>
+struct store_binop_result {
+  template <typename Out, std::enable_if_t<is_numeric<Out>()>* = nullptr>
+  CUDA_DEVICE_CALLABLE void operator()(
+    mutable_column_device_view out, size_type i, binary_operator op, Lhs x, Rhs y) {
+    Out result{};
+    switch (op) {
+      case binary_operator::EQUAL: result = x == y; break;
+      case binary_operator::NOT_EQUAL: result = x != y; break;
+      case binary_operator::LESS: result = x < y; break;
+      case binary_operator::GREATER: result = x > y; break;
+      case binary_operator::LESS_EQUAL: result = x <= y; break;
+      case binary_operator::GREATER_EQUAL: result = x >= y; break;
+      default: result = arithmetic_binop<Out>(op, x, y);
+    }
+    out.element<Out>(i) = result;
+  }
+
+  template <typename Out, std::enable_if_t<not is_numeric<Out>()>* = nullptr>
+  CUDA_DEVICE_CALLABLE void operator()(
+    mutable_column_device_view, size_type, binary_operator, Lhs, Rhs) {
+    release_assert(false && "Unsupported output type of compiled binary operation");
+  }
+};
+
+template <typename T>
+struct column_operand {
+  column_device_view col;
+  CUDA_DEVICE_CALLABLE T operator()(size_type i) const { return col.element<T>(i); }
+};
+
+template <typename T>
+struct scalar_operand {
+  scalar_device_type_t<T> scalar;
+  CUDA_DEVICE_CALLABLE T operator()(size_type) const { return scalar.value(); }
+};
+
+/**
+ * @brief Computes row `i` of a fixed-width binary operation.
+ *
+ * Only the operand types are template arguments: dispatching the output type in
+ * the kernel compiles one kernel per pair of operand types rather than one per
+ * triple, at the cost of a branch that is uniform across the grid.
+ */
+template <typename Lhs, typename Rhs, typename LhsOperand, typename RhsOperand>
+struct fixed_width_binop_fn {
+  mutable_column_device_view out;
+  LhsOperand lhs;
+  RhsOperand rhs;
+  binary_operator op;
+  CUDA_DEVICE_CALLABLE void operator()(size_type i) {
+    type_dispatcher(out.type(), store_binop_result<Lhs, Rhs>{}, out, i, op, lhs(i), rhs(i));
+  }
+};
+
+template <typename Lhs, typename Rhs, typename LhsOperand, typename RhsOperand>
+void launch_fixed_width_binop(mutable_column_view& out,
+                              LhsOperand lhs,
+                              RhsOperand rhs,
+                              binary_operator op,
+                              cudaStream_t stream) {
+  auto out_view = mutable_column_device_view::create(out, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     out.size(),
+                     fixed_width_binop_fn<Lhs, Rhs, LhsOperand, RhsOperand>{
+                       *out_view, lhs, rhs, op});
+  CHECK_CUDA(stream);
+}
+
+// Each thread compares 4 consecutive elements and stores their 4 results at once
+constexpr size_type SCALAR_COMPARE_ELEMENTS_PER_THREAD = 4;
+constexpr size_type SCALAR_COMPARE_BLOCK_SIZE          = 256;
+
+/**
+ * @brief Compares each element of `input` with `value` into `output`, whose
+ * address must be aligned for a `uint32_t`
+ */
+template <typename T, typename Compare>
+__global__ void compare_with_scalar_kernel(T const* __restrict__ input,
+                                           T const value,
+                                           size_type size,
+                                           bool* __restrict__ output) {
+  constexpr size_type N = SCALAR_COMPARE_ELEMENTS_PER_THREAD;
+  Compare compare{};
+  auto const first = (static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x) * N;
+  if (first + N <= size) {
+    T elements[N];
+#pragma unroll
+    for (size_type k = 0; k < N; ++k) { elements[k] = input[first + k]; }
+    uint32_t results = 0;
+#pragma unroll
+    for (size_type k = 0; k < N; ++k) {
+      results |= static_cast<uint32_t>(compare(elements[k], value)) << (8 * k);
+    }
+    *reinterpret_cast<uint32_t*>(output + first) = results;
+  } else {
+    for (auto i = first; i < size; ++i) { output[i] = compare(input[i], value); }
+  }
+}
+
+template <typename T, typename Compare>
+void launch_compare_with_scalar(mutable_column_view& out,
+                                column_view const& col,
+                                T const value,
+                                cudaStream_t stream) {
+  experimental::detail::grid_1d grid{
+    col.size(), SCALAR_COMPARE_BLOCK_SIZE, SCALAR_COMPARE_ELEMENTS_PER_THREAD};
+  compare_with_scalar_kernel<T, Compare>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      col.data<T>(), value, col.size(), out.data<bool>());
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Compares a column with a scalar of the same type into a `BOOL8`
+ * column, with the operator and the type as template arguments
+ *
+ * The generic kernel reads the scalar through its device view and dispatches
+ * the operator and the output type on every row; the comparison of a column
+ * with a literal is frequent enough to deserve its own kernels.
+ */
+struct dispatch_compare_with_scalar {
+  template <typename T, std::enable_if_t<is_numeric<T>() or is_timestamp<T>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  column_view const& col,
+                  scalar const& s,
+                  binary_operator op,
+                  cudaStream_t stream) {
+    auto const value = static_cast<scalar_type_t<T> const&>(s).value(stream);
+    switch (op) {
+      case binary_operator::EQUAL:
+        launch_compare_with_scalar<T, thrust::equal_to<T>>(out, col, value, stream);
+        break;
+      case binary_operator::NOT_EQUAL:
+        launch_compare_with_scalar<T, thrust::not_equal_to<T>>(out, col, value, stream);
+        break;
+      case binary_operator::LESS:
+        launch_compare_with_scalar<T, thrust::less<T>>(out, col, value, stream);
+        break;
+      case binary_operator::GREATER:
+        launch_compare_with_scalar<T, thrust::greater<T>>(out, col, value, stream);
+        break;
+      case binary_operator::LESS_EQUAL:
+        launch_compare_with_scalar<T, thrust::less_equal<T>>(out, col, value, stream);
+        break;
+      case binary_operator::GREATER_EQUAL:
+        launch_compare_with_scalar<T, thrust::greater_equal<T>>(out, col, value, stream);
+        break;
+      default: CUDF_FAIL("Unsupported operator for comparison with a scalar");
+    }
+  }
+
+  template <typename T,
+            typename... Args,
+            std::enable_if_t<not(is_numeric<T>() or is_timestamp<T>())>* = nullptr>
+  void operator()(Args&&...) {
+    CUDF_FAIL("Unsupported operand types of comparison with a scalar");
+  }
+};
+
+bool is_comparison(binary_operator op) {
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns whether `op(col[i], s)` is computed by `dispatch_compare_with_scalar`
+ */
+bool is_compare_with_scalar(mutable_column_view const& out,
+                            column_view const& col,
+                            scalar const& s,
+                            binary_operator op) {
+  return out.type().id() == BOOL8 and is_comparison(op) and col.type() == s.type() and
+         (is_numeric(col.type()) or is_timestamp(col.type())) and
+         reinterpret_cast<uintptr_t>(out.data<bool>()) % sizeof(uint32_t) == 0;
+}
+
+/**
+ * @brief Returns the operator of `op(y, x)` that has the results of `op(x, y)`
+ */
+binary_operator mirror_comparison(binary_operator op) {
+  switch (op) {
+    case binary_operator::LESS: return binary_operator::GREATER;
+    case binary_operator::GREATER: return binary_operator::LESS;
+    case binary_operator::LESS_EQUAL: return binary_operator::GREATER_EQUAL;
+    case binary_operator::GREATER_EQUAL: return binary_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+template <typename T>
+scalar_operand<T> make_scalar_operand(scalar const& s) {
+  // `get_scalar_device_view` takes a mutable scalar, but the view is only read
+  auto& typed_scalar = static_cast<scalar_type_t<T>&>(const_cast<scalar&>(s));
+  return scalar_operand<T>{get_scalar_device_view(typed_scalar)};
+}
+
+template <typename Lhs>
+struct dispatch_fixed_width_rhs {
+  template <typename Rhs, std::enable_if_t<is_fixed_width_pair<Lhs, Rhs>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  scalar const& lhs,
+                  column_view const& rhs,
+                  binary_operator op,
+                  cudaStream_t stream) {
+    auto rhs_view = column_device_view::create(rhs, stream);
+    launch_fixed_width_binop<Lhs, Rhs>(
+      out, make_scalar_operand<Lhs>(lhs), column_operand<Rhs>{*rhs_view}, op, stream);
+  }
+
+  template <typename Rhs, std::enable_if_t<is_fixed_width_pair<Lhs, Rhs>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  column_view const& lhs,
+                  scalar const& rhs,
+                  binary_operator op,
+                  cudaStream_t stream) {
+    auto lhs_view = column_device_view::create(lhs, stream);
+    launch_fixed_width_binop<Lhs, Rhs>(
+      out, column_operand<Lhs>{*lhs_view}, make_scalar_operand<Rhs>(rhs), op, stream);
+  }
+
+  template <typename Rhs, std::enable_if_t<is_fixed_width_pair<Lhs, Rhs>()>* = nullptr>
+  void operator()(mutable_column_view& out,
+                  column_view const& lhs,
+                  column_view const& rhs,
+                  binary_operator op,
+                  cudaStream_t stream) {
+    auto lhs_view = column_device_view::create(lhs, stream);
+    auto rhs_view = column_device_view::create(rhs, stream);
+    launch_fixed_width_binop<Lhs, Rhs>(
+      out, column_operand<Lhs>{*lhs_view}, column_operand<Rhs>{*rhs_view}, op, stream);
+  }
+
+  template <typename Rhs,
+            typename... Args,
+            std::enable_if_t<not is_fixed_width_pair<Lhs, Rhs>()>* = nullptr>
+  void operator()(Args&&...) {
+    CUDF_FAIL("Unsupported operand types of compiled binary operation");
+  }
+};
+
+struct dispatch_fixed_width_lhs {
+  template <typename Lhs,
+            typename... Args,
+            std::enable_if_t<is_numeric<Lhs>() or is_timestamp<Lhs>()>* = nullptr>
+  void operator()(data_type rhs_type, Args&&... args) {
+    type_dispatcher(rhs_type, dispatch_fixed_width_rhs<Lhs>{}, std::forward<Args>(args)...);
+  }
+
+  template <typename Lhs,
+            typename... Args,
+            std::enable_if_t<not(is_numeric<Lhs>() or is_timestamp<Lhs>())>* = nullptr>
+  void operator()(data_type, Args&&...) {
+    CUDF_FAIL("Unsupported operand types of compiled binary operation");
+  }
+};
+
+bool is_integral(data_type type) {
+  return is_numeric(type) and type.id() != FLOAT32 and type.id() != FLOAT64;
+}
+
+struct fixed_point_column_operand {
+  column_device_view col;
+  CUDA_DEVICE_CALLABLE int64_t operator()(size_type i) const {
+    return col.type().id() == DECIMAL32 ? col.element<int32_t>(i) : col.element<int64_t>(i);
+  }
+};
+
+struct fixed_point_scalar_operand {
+  int64_t rep;
+  CUDA_DEVICE_CALLABLE int64_t operator()(size_type) const { return rep; }
+};
+
+fixed_point_scalar_operand make_fixed_point_operand(scalar const& s, cudaStream_t stream) {
+  if (s.type().id() == DECIMAL32) {
+    return {static_cast<fixed_point_scalar<int32_t> const&>(s).value(stream)};
+  }
+  return {static_cast<fixed_point_scalar<int64_t> const&>(s).value(stream)};
+}
+
+/**
+ * @brief Computes row `i` of a fixed-point binary operation.
+ *
+ * The representations are widened to int64_t. Additions and subtractions
+ * align both operands to the scale of the output, multiplications and
+ * divisions compute on the representations and truncate the result to the
+ * scale of the output, and comparisons align both operands to the smaller of
+ * their scales. A division by zero is 0.
+ */
+template <typename LhsOperand, typename RhsOperand>
+struct fixed_point_binop_fn {
+  mutable_column_device_view out;
+  LhsOperand lhs;
+  RhsOperand rhs;
+  int32_t lhs_scale;
+  int32_t rhs_scale;
+  binary_operator op;
+
+  CUDA_DEVICE_CALLABLE static int64_t rescale(int64_t rep, int32_t from, int32_t to) {
+    return numeric::detail::shift<int64_t, numeric::Radix::BASE_10>(rep,
+                                                                    numeric::scale_type{to - from});
+  }
+
+  CUDA_DEVICE_CALLABLE int64_t arithmetic(int64_t x, int64_t y, int32_t out_scale) const {
+    switch (op) {
+      case binary_operator::ADD:
+        return rescale(x, lhs_scale, out_scale) + rescale(y, rhs_scale, out_scale);
+      case binary_operator::SUB:
+        return rescale(x, lhs_scale, out_scale) - rescale(y, rhs_scale, out_scale);
+      case binary_operator::MUL: return rescale(x * y, lhs_scale + rhs_scale, out_scale);
+      default: {
+        if (y == 0) { return 0; }
+        // x / y has the scale `lhs_scale - rhs_scale`: shift the dividend up or the
+        // divisor down so that the integer division truncates at the output scale
+        auto const exponent = lhs_scale - rhs_scale - out_scale;
+        return exponent >= 0 ? rescale(x, exponent, 0) / y : x / rescale(y, -exponent, 0);
+      }
+    }
+  }
+
+  CUDA_DEVICE_CALLABLE bool compare(int64_t x, int64_t y) const {
+    auto const scale = min(lhs_scale, rhs_scale);
+    x                = rescale(x, lhs_scale, scale);
+    y                = rescale(y, rhs_scale, scale);
+    switch (op) {
+      case binary_operator::EQUAL: return x == y;
+      case binary_operator::NOT_EQUAL: return x != y;
+      case binary_operator::LESS: return x < y;
+      case binary_operator::GREATER: return x > y;
+      case binary_operator::LESS_EQUAL: return x <= y;
+      default: return x >= y;
+    }
+  }
+
+  CUDA_DEVICE_CALLABLE void operator()(size_type i) {
+    auto const x = lhs(i);
+    auto const y = rhs(i);
+    switch (out.type().id()) {
+      case BOOL8: out.element<bool>(i) = compare(x, y); break;
+      case DECIMAL32:
+        out.element<int32_t>(i) = static_cast<int32_t>(arithmetic(x, y, out.type().scale()));
+        break;
+      default: out.element<int64_t>(i) = arithmetic(x, y, out.type().scale());
+    }
+  }
+};
+
+template <typename LhsOperand, typename RhsOperand>
+void launch_fixed_point_binop(mutable_column_view& out,
+                              LhsOperand lhs,
+                              RhsOperand rhs,
+                              int32_t lhs_scale,
+                              int32_t rhs_scale,
+                              binary_operator op,
+                              cudaStream_t stream) {
+  auto out_view = mutable_column_device_view::create(out, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     out.size(),
+                     fixed_point_binop_fn<LhsOperand, RhsOperand>{
+                       *out_view, lhs, rhs, lhs_scale, rhs_scale, op});
+  CHECK_CUDA(stream);
+}
+
+bool is_supported_fixed_point_operation(data_type out,
+                                        data_type lhs,
+                                        data_type rhs,
+                                        binary_operator op) {
+  if (not is_fixed_point(lhs) or not is_fixed_point(rhs)) { return false; }
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL: return out.id() == BOOL8;
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV: return is_fixed_point(out);
+    default: return false;
+  }
+}
+
 }  // namespace
 
 std::unique_ptr<column> binary_operation(scalar const& lhs,
@@ -263,6 +765,112 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
     lhs, rhs, op, output_type, mr, stream);
 }
 
+bool is_supported_operation(data_type out,
+                            data_type lhs,
+                            data_type rhs,
+                            binary_operator op) {
+  if (is_fixed_point(out) or is_fixed_point(lhs) or is_fixed_point(rhs)) {
+    return is_supported_fixed_point_operation(out, lhs, rhs, op);
+  }
+  if (not is_numeric(out)) { return false; }
+  bool const numeric_operands = is_numeric(lhs) and is_numeric(rhs);
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL:
+      return numeric_operands or (is_timestamp(lhs) and lhs == rhs);
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV:
+    case binary_operator::TRUE_DIV:
+    case binary_operator::FLOOR_DIV:
+    case binary_operator::MOD:
+    case binary_operator::POW:
+    case binary_operator::LOGICAL_AND:
+    case binary_operator::LOGICAL_OR: return numeric_operands;
+    case binary_operator::PYMOD:
+      return numeric_operands and (not is_integral(out) or (is_integral(lhs) and is_integral(rhs)));
+    default: return false;
+  }
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream) {
+  CUDF_EXPECTS(is_supported_operation(out.type(), lhs.type(), rhs.type(), op),
+               "Unsupported operator for compiled binary operation");
+  if (is_fixed_point(lhs.type())) {
+    auto rhs_view = column_device_view::create(rhs, stream);
+    launch_fixed_point_binop(out,
+                             make_fixed_point_operand(lhs, stream),
+                             fixed_point_column_operand{*rhs_view},
+                             lhs.type().scale(),
+                             rhs.type().scale(),
+                             op,
+                             stream);
+    return;
+  }
+  if (is_compare_with_scalar(out, rhs, lhs, op)) {
+    type_dispatcher(
+      rhs.type(), dispatch_compare_with_scalar{}, out, rhs, lhs, mirror_comparison(op), stream);
+    return;
+  }
+  type_dispatcher(lhs.type(), dispatch_fixed_width_lhs{}, rhs.type(), out, lhs, rhs, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream) {
+  CUDF_EXPECTS(is_supported_operation(out.type(), lhs.type(), rhs.type(), op),
+               "Unsupported operator for compiled binary operation");
+  if (is_fixed_point(lhs.type())) {
+    auto lhs_view = column_device_view::create(lhs, stream);
+    launch_fixed_point_binop(out,
+                             fixed_point_column_operand{*lhs_view},
+                             make_fixed_point_operand(rhs, stream),
+                             lhs.type().scale(),
+                             rhs.type().scale(),
+                             op,
+                             stream);
+    return;
+  }
+  if (is_compare_with_scalar(out, lhs, rhs, op)) {
+    type_dispatcher(lhs.type(), dispatch_compare_with_scalar{}, out, lhs, rhs, op, stream);
+    return;
+  }
+  type_dispatcher(lhs.type(), dispatch_fixed_width_lhs{}, rhs.type(), out, lhs, rhs, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream) {
+  CUDF_EXPECTS(is_supported_operation(out.type(), lhs.type(), rhs.type(), op),
+               "Unsupported operator for compiled binary operation");
+  if (is_fixed_point(lhs.type())) {
+    auto lhs_view = column_device_view::create(lhs, stream);
+    auto rhs_view = column_device_view::create(rhs, stream);
+    launch_fixed_point_binop(out,
+                             fixed_point_column_operand{*lhs_view},
+                             fixed_point_column_operand{*rhs_view},
+                             lhs.type().scale(),
+                             rhs.type().scale(),
+                             op,
+                             stream);
+    return;
+  }
+  type_dispatcher(lhs.type(), dispatch_fixed_width_lhs{}, rhs.type(), out, lhs, rhs, op, stream);
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace experimental
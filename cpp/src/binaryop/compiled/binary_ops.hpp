@@ -112,6 +112,92 @@ std::unique_ptr<column> binary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns whether the compiled (non-JIT) path supports the binary
+ * operation `op` between operands of types `lhs` and `rhs` into `out`
+ *
+ * The compiled path supports numeric outputs of
+ * - the arithmetic operators `ADD`, `SUB`, `MUL`, `DIV`, `TRUE_DIV`,
+ *   `FLOOR_DIV`, `MOD`, `PYMOD` and `POW`, and the logical operators
+ *   `LOGICAL_AND` and `LOGICAL_OR`, between numeric operands
+ * - the comparison operators between numeric operands, or between timestamp
+ *   operands of the same type
+ * - the arithmetic operators `ADD`, `SUB`, `MUL` and `DIV` between fixed-point
+ *   operands into a fixed-point output, and the comparison operators between
+ *   fixed-point operands into a `BOOL8` output
+ *
+ * Other operations are JIT compiled.
+ *
+ * @param out Data type of the output column
+ * @param lhs Data type of the left operand
+ * @param rhs Data type of the right operand
+ * @param op  The binary operator
+ */
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_operator op);
+
+/**
+ * @brief Performs a fixed-width binary operation between a scalar and a column,
+ * with the same results as the JIT compiled operation.
+ *
+ * The output contains the result of op(lhs, rhs[i]) for all 0 <= i < rhs.size().
+ * Only the data of `out` is written: its validity must be computed by the caller.
+ *
+ * @throws cudf::logic_error if `is_supported_operation()` is false for the operands
+ *
+ * @param out    Output column of the size of `rhs`
+ * @param lhs    The left operand scalar
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param stream CUDA stream on which to execute kernels
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
+/**
+ * @brief Performs a fixed-width binary operation between a column and a scalar,
+ * with the same results as the JIT compiled operation.
+ *
+ * The output contains the result of op(lhs[i], rhs) for all 0 <= i < lhs.size().
+ * Only the data of `out` is written: its validity must be computed by the caller.
+ *
+ * @throws cudf::logic_error if `is_supported_operation()` is false for the operands
+ *
+ * @param out    Output column of the size of `lhs`
+ * @param lhs    The left operand column
+ * @param rhs    The right operand scalar
+ * @param op     The binary operator
+ * @param stream CUDA stream on which to execute kernels
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
+/**
+ * @brief Performs a fixed-width binary operation between two columns, with the
+ * same results as the JIT compiled operation.
+ *
+ * The output contains the result of op(lhs[i], rhs[i]) for all 0 <= i < lhs.size().
+ * Only the data of `out` is written: its validity must be computed by the caller.
+ *
+ * @throws cudf::logic_error if `is_supported_operation()` is false for the operands
+ *
+ * @param out    Output column of the size of `lhs` and `rhs`
+ * @param lhs    The left operand column
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param stream CUDA stream on which to execute kernels
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      cudaStream_t stream);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace experimental
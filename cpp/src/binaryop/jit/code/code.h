@@ -26,6 +26,8 @@ namespace jit {
 namespace code {
 
 extern const char* kernel;
+extern const char* expression_headers;
+extern const char* expression_kernel;
 extern const char* traits;
 extern const char* operation;
 
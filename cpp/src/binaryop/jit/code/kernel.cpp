@@ -66,6 +66,35 @@ const char* kernel =
         }
     }
 )***";
+
+const char* expression_headers =
+  R"***(
+    #include <cudf/types.hpp>
+    #include <simt/limits>
+    #include <cudf/wrappers/timestamps.hpp>
+    #include "operation.h"
+)***";
+
+// Follows the code of `evaluate_expression`, generated for each expression
+const char* expression_kernel =
+  R"***(
+    template <typename TypeOut>
+    __global__
+    void kernel_expression(cudf::size_type size,
+                           TypeOut* out_data, void const* const* inputs) {
+        int tid = threadIdx.x;
+        int blkid = blockIdx.x;
+        int blksz = blockDim.x;
+        int gridsz = gridDim.x;
+
+        int start = tid + blkid * blksz;
+        int step = blksz * gridsz;
+
+        for (cudf::size_type i=start; i<size; i+=step) {
+            out_data[i] = static_cast<TypeOut>(evaluate_expression(i, inputs));
+        }
+    }
+)***";
 // clang-format on
 
 }  // namespace code
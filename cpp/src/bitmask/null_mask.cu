@@ -34,6 +34,8 @@
 #include <rmm/device_scalar.hpp>
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 
@@ -192,25 +194,54 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
 }
 
 /**
- * @brief Convenience function to get offset word from a bitmask
- * 
+ * @brief The number of destination words each thread of the word-level
+ * bitmask kernels computes, written with one 128-bit store
+ *
+ * The destination masks are allocated with `bitmask_allocation_size_bytes`,
+ * whose padding is a multiple of this many words.
+ */
+constexpr size_type words_per_thread{sizeof(uint4) / sizeof(bitmask_type)};
+
+/**
+ * @brief Reads the `words_per_thread` words of a bitmask shifted to begin at
+ * bit `source_begin_bit`, starting at shifted word `destination_word_index`
+ *
+ * Each source word is read once and the words are realigned with funnel
+ * shifts. Words past the last bit `source_end_bit - 1` are not read.
+ *
  * @see copy_offset_bitmask
- * @see offset_bitmask_and
+ * @see offset_bitmask_binop
  */
-__device__ bitmask_type get_mask_offset_word(bitmask_type const *__restrict__ source,
-                                             size_type destination_word_index,
-                                             size_type source_begin_bit,
-                                             size_type source_end_bit) {
-  size_type source_word_index = destination_word_index + word_index(source_begin_bit);
-  bitmask_type curr_word      = source[source_word_index];
-  bitmask_type next_word      = 0;
-  if ((word_index(source_begin_bit) != 0) &&
-      (word_index(source_end_bit) >
-       word_index(source_begin_bit +
-                  destination_word_index * detail::size_in_bits<bitmask_type>()))) {
-    next_word = source[source_word_index + 1];
+__device__ void get_mask_offset_words(bitmask_type const *__restrict__ source,
+                                      size_type destination_word_index,
+                                      size_type source_begin_bit,
+                                      size_type source_end_bit,
+                                      bitmask_type (&words)[words_per_thread]) {
+  auto const first_source_word = word_index(source_begin_bit) + destination_word_index;
+  auto const last_source_word  = word_index(source_end_bit - 1);
+  auto const shift             = intra_word_index(source_begin_bit);
+
+  bitmask_type source_words[words_per_thread + 1];
+#pragma unroll
+  for (size_type i = 0; i <= words_per_thread; ++i) {
+    auto const index = first_source_word + i;
+    source_words[i]  = (index <= last_source_word) ? source[index] : 0;
+  }
+#pragma unroll
+  for (size_type i = 0; i < words_per_thread; ++i) {
+    words[i] = __funnelshift_r(source_words[i], source_words[i + 1], shift);
   }
-  return __funnelshift_r(curr_word, next_word, source_begin_bit);
+}
+
+/**
+ * @brief Writes `words_per_thread` words at `destination_word_index`, a
+ * multiple of `words_per_thread`, with one 128-bit store
+ */
+__device__ void set_mask_words(bitmask_type *__restrict__ destination,
+                               size_type destination_word_index,
+                               bitmask_type const (&words)[words_per_thread]) {
+  *reinterpret_cast<uint4 *>(destination + destination_word_index) =
+    uint4{words[0], words[1], words[2], words[3]};
 }
 
 /**
@@ -281,6 +312,7 @@ __global__ void subtract_set_bits_range_boundaries_kerenel(bitmask_type const *b
  * bitmask into the destination bitmask.
  *
  * Bit `i` in `destination` will be equal to bit `i + offset` from `source`.
+ * Each thread copies `words_per_thread` words.
  *
  * @param destination The mask to copy into
  * @param source The mask to copy from
@@ -288,78 +320,115 @@ __global__ void subtract_set_bits_range_boundaries_kerenel(bitmask_type const *b
  * @param source_end_bit   The offset into `source` till which copying is done
  * @param number_of_mask_words The number of `cudf::bitmask_type` words to copy
  *---------------------------------------------------------------------------**/
-// TODO: Also make binops test that uses offset in column_view
 __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
                                     bitmask_type const *__restrict__ source,
                                     size_type source_begin_bit,
                                     size_type source_end_bit,
                                     size_type number_of_mask_words) {
-  for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
+  for (size_type destination_word_index =
+         (threadIdx.x + blockIdx.x * blockDim.x) * words_per_thread;
        destination_word_index < number_of_mask_words;
-       destination_word_index += blockDim.x * gridDim.x) {
-    destination[destination_word_index] =
-      get_mask_offset_word(source, destination_word_index, source_begin_bit, source_end_bit);
+       destination_word_index += blockDim.x * gridDim.x * words_per_thread) {
+    bitmask_type words[words_per_thread];
+    get_mask_offset_words(source, destination_word_index, source_begin_bit, source_end_bit, words);
+    set_mask_words(destination, destination_word_index, words);
   }
 }
 
 /**
- * @brief Computes the bitwise AND of an array of bitmasks
- * 
+ * @brief A bitmask and the offset of its first bit
+ */
+struct offset_mask {
+  bitmask_type const *mask;
+  size_type begin_bit;
+};
+
+/**
+ * @brief Computes the bitwise combination of an array of bitmasks, e.g., their
+ * AND or OR
+ *
+ * Each thread computes `words_per_thread` words.
+ *
+ * @param op Binary operator combining two words of the masks
  * @param destination The bitmask to write result into
- * @param source Array of source mask pointers. All masks must be of same size
- * @param begin_bit Array of offsets into corresponding @p source masks. 
- *                  Must be same size as source array
+ * @param source Array of source masks and their offsets. All masks must be of
+ * same size
  * @param num_sources Number of masks in @p source array
  * @param source_size Number of bits in each mask in @p source
  * @param number_of_mask_words The number of words of type bitmask_type to copy
  */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const *const *__restrict__ source,
-                                   size_type const *__restrict__ begin_bit,
-                                   size_type num_sources,
-                                   size_type source_size,
-                                   size_type number_of_mask_words) {
-  for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
+template <typename Binop>
+__global__ void offset_bitmask_binop(Binop op,
+                                     bitmask_type *__restrict__ destination,
+                                     offset_mask const *__restrict__ source,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words) {
+  for (size_type destination_word_index =
+         (threadIdx.x + blockIdx.x * blockDim.x) * words_per_thread;
        destination_word_index < number_of_mask_words;
-       destination_word_index += blockDim.x * gridDim.x) {
-    bitmask_type destination_word = ~bitmask_type{0};  // All bits 1
-    for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
-        source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
+       destination_word_index += blockDim.x * gridDim.x * words_per_thread) {
+    bitmask_type destination_words[words_per_thread];
+    get_mask_offset_words(source[0].mask,
+                          destination_word_index,
+                          source[0].begin_bit,
+                          source[0].begin_bit + source_size,
+                          destination_words);
+    for (size_type i = 1; i < num_sources; i++) {
+      bitmask_type words[words_per_thread];
+      get_mask_offset_words(source[i].mask,
+                            destination_word_index,
+                            source[i].begin_bit,
+                            source[i].begin_bit + source_size,
+                            words);
+#pragma unroll
+      for (size_type w = 0; w < words_per_thread; ++w) {
+        destination_words[w] = op(destination_words[w], words[w]);
+      }
     }
-
-    destination[destination_word_index] = destination_word;
+    set_mask_words(destination, destination_word_index, destination_words);
   }
 }
 
-// Bitwise AND of the masks
-rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
-                               std::vector<size_type> const &begin_bits,
-                               size_type mask_size,
-                               cudaStream_t stream,
-                               rmm::mr::device_memory_resource *mr) {
+// Bitwise combination of the masks
+template <typename Binop>
+rmm::device_buffer bitmask_binop(Binop op,
+                                 std::vector<bitmask_type const *> const &masks,
+                                 std::vector<size_type> const &begin_bits,
+                                 size_type mask_size,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource *mr) {
   CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
                "Invalid range.");
   CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
   CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
                "Mask pointer cannot be null");
 
-  rmm::device_buffer dest_mask{};
-  auto num_bytes = bitmask_allocation_size_bytes(mask_size);
+  if (masks.size() == 1) {
+    auto const begin_bit = begin_bits.front();
+    return copy_bitmask(masks.front(), begin_bit, begin_bit + mask_size, stream, mr);
+  }
 
+  auto num_bytes            = bitmask_allocation_size_bytes(mask_size);
   auto number_of_mask_words = num_bitmask_words(mask_size);
 
-  dest_mask = rmm::device_buffer{num_bytes, stream, mr};
+  rmm::device_buffer dest_mask{num_bytes, stream, mr};
 
-  rmm::device_vector<bitmask_type const *> d_masks(masks);
-  rmm::device_vector<size_type> d_begin_bits(begin_bits);
+  std::vector<offset_mask> h_masks(masks.size());
+  std::transform(masks.begin(),
+                 masks.end(),
+                 begin_bits.begin(),
+                 h_masks.begin(),
+                 [](auto mask, auto begin_bit) { return offset_mask{mask, begin_bit}; });
+  rmm::device_buffer d_masks{h_masks.data(), h_masks.size() * sizeof(offset_mask), stream};
 
-  cudf::experimental::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+  cudf::experimental::detail::grid_1d config(
+    cudf::util::div_rounding_up_safe(number_of_mask_words, words_per_thread), 256);
+  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+    op,
     static_cast<bitmask_type *>(dest_mask.data()),
-    d_masks.data().get(),
-    d_begin_bits.data().get(),
-    d_masks.size(),
+    static_cast<offset_mask const *>(d_masks.data()),
+    h_masks.size(),
     mask_size,
     number_of_mask_words);
 
@@ -368,6 +437,68 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
   return dest_mask;
 }
 
+/**
+ * @brief Counts the set bits of every range in every bitmask, with a warp per
+ * count
+ *
+ * Count `i` is the number of bits set in range `i % num_ranges`, i.e.,
+ * `[first_bit_indices[i % num_ranges], last_bit_indices[i % num_ranges])`, of
+ * bitmask `i / num_ranges`. A `nullptr` bitmask has all its bits set.
+ *
+ * @param[in] bitmasks The bitmasks whose set bits will be counted
+ * @param[in] num_bitmasks The number of bitmasks
+ * @param[in] first_bit_indices The indices (inclusive) of the first bit in each
+ * range
+ * @param[in] last_bit_indices The indices (exclusive) of the last bit in each
+ * range
+ * @param[in] num_ranges The number of ranges
+ * @param[out] counts The `num_bitmasks * num_ranges` counts
+ */
+__global__ void count_set_bits_in_ranges_kernel(bitmask_type const *const *bitmasks,
+                                                size_type num_bitmasks,
+                                                size_type const *first_bit_indices,
+                                                size_type const *last_bit_indices,
+                                                size_type num_ranges,
+                                                size_type *counts) {
+  using cudf::experimental::detail::warp_size;
+  constexpr size_type const word_size_in_bits{detail::size_in_bits<bitmask_type>()};
+
+  auto const lane       = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const num_counts = static_cast<std::size_t>(num_bitmasks) * num_ranges;
+  auto const num_warps  = static_cast<std::size_t>(blockDim.x / warp_size) * gridDim.x;
+
+  for (auto i = static_cast<std::size_t>((threadIdx.x + blockIdx.x * blockDim.x) / warp_size);
+       i < num_counts;
+       i += num_warps) {
+    auto const bitmask         = bitmasks[i / num_ranges];
+    auto const first_bit_index = first_bit_indices[i % num_ranges];
+    auto const last_bit_index  = last_bit_indices[i % num_ranges];
+    if (bitmask == nullptr or first_bit_index == last_bit_index) {
+      if (lane == 0) { counts[i] = last_bit_index - first_bit_index; }
+      continue;
+    }
+
+    auto const first_word = word_index(first_bit_index);
+    auto const last_word  = word_index(last_bit_index - 1);
+    size_type count{0};
+    for (auto w = first_word + lane; w <= last_word; w += warp_size) {
+      auto word = bitmask[w];
+      if (w == first_word) {
+        word &= ~set_least_significant_bits(intra_word_index(first_bit_index));
+      }
+      if (w == last_word) {
+        auto const num_slack_bits = word_size_in_bits - 1 - intra_word_index(last_bit_index - 1);
+        if (num_slack_bits > 0) { word &= ~set_most_significant_bits(num_slack_bits); }
+      }
+      count += __popc(word);
+    }
+    for (size_type delta = warp_size / 2; delta > 0; delta /= 2) {
+      count += __shfl_down_sync(0xffffffff, count, delta);
+    }
+    if (lane == 0) { counts[i] = count; }
+  }
+}
+
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -417,7 +548,8 @@ cudf::size_type count_set_bits(bitmask_type const *bitmask,
   count_set_bits_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
     bitmask, start, stop - 1, non_zero_count.data());
 
-  return non_zero_count.value();
+  CUDF_SYNC_POINT();
+  return non_zero_count.value(stream);
 }
 
 cudf::size_type count_unset_bits(bitmask_type const *bitmask,
@@ -528,7 +660,7 @@ std::vector<size_type> segmented_count_set_bits(bitmask_type const *bitmask,
                            cudaMemcpyDeviceToHost,
                            stream));
 
-  CUDA_TRY(cudaStreamSynchronize(stream));  // now ret is valid.
+  CUDF_STREAM_SYNC(stream);  // now ret is valid.
 
   return ret;
 }
@@ -552,6 +684,142 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const *bitmask,
   return ret;
 }
 
+std::vector<std::vector<size_type>> segmented_count_set_bits(
+  std::vector<bitmask_type const *> const &bitmasks,
+  std::vector<size_type> const &indices,
+  cudaStream_t stream) {
+  CUDF_EXPECTS(indices.size() % 2 == 0,
+               "Array of indices needs to have an even number of elements.");
+  size_type const num_ranges = indices.size() / 2;
+  std::vector<size_type> h_bit_indices(indices.size());
+  for (size_type i = 0; i < num_ranges; i++) {
+    auto begin = indices[i * 2];
+    auto end   = indices[i * 2 + 1];
+    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+    h_bit_indices[i]              = begin;
+    h_bit_indices[num_ranges + i] = end;
+  }
+
+  std::vector<std::vector<size_type>> ret(bitmasks.size());
+  auto const all_valid = std::all_of(bitmasks.begin(), bitmasks.end(), [](auto b) {
+    return b == nullptr;
+  });
+  if (num_ranges == 0 or all_valid) {
+    for (size_t b = 0; b < bitmasks.size(); b++) {
+      ret[b] = segmented_count_set_bits(nullptr, indices, stream);
+    }
+    return ret;
+  }
+
+  rmm::device_buffer d_bitmasks{
+    bitmasks.data(), bitmasks.size() * sizeof(bitmask_type const *), stream};
+  rmm::device_buffer d_bit_indices{
+    h_bit_indices.data(), h_bit_indices.size() * sizeof(size_type), stream};
+  auto const num_counts = bitmasks.size() * num_ranges;
+  rmm::device_buffer d_counts{num_counts * sizeof(size_type), stream};
+
+  constexpr size_type block_size{256};
+  auto const num_blocks = std::min<std::size_t>(
+    cudf::util::div_rounding_up_safe<std::size_t>(
+      num_counts, block_size / cudf::experimental::detail::warp_size),
+    std::numeric_limits<int>::max());
+  auto const d_indices = static_cast<size_type const *>(d_bit_indices.data());
+  count_set_bits_in_ranges_kernel<<<num_blocks, block_size, 0, stream>>>(
+    static_cast<bitmask_type const *const *>(d_bitmasks.data()),
+    bitmasks.size(),
+    d_indices,
+    d_indices + num_ranges,
+    num_ranges,
+    static_cast<size_type *>(d_counts.data()));
+
+  CHECK_CUDA(stream);
+
+  std::vector<size_type> h_counts(num_counts);
+  CUDA_TRY(cudaMemcpyAsync(h_counts.data(),
+                           d_counts.data(),
+                           num_counts * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+
+  CUDF_STREAM_SYNC(stream);  // now h_counts is valid.
+
+  for (size_t b = 0; b < bitmasks.size(); b++) {
+    ret[b].assign(h_counts.begin() + b * num_ranges, h_counts.begin() + (b + 1) * num_ranges);
+  }
+  return ret;
+}
+
+std::vector<std::vector<size_type>> segmented_count_unset_bits(
+  std::vector<bitmask_type const *> const &bitmasks,
+  std::vector<size_type> const &indices,
+  cudaStream_t stream) {
+  auto ret = segmented_count_set_bits(bitmasks, indices, stream);
+  for (auto &counts : ret) {
+    for (size_t i = 0; i < counts.size(); i++) {
+      auto begin = indices[i * 2];
+      auto end   = indices[i * 2 + 1];
+      counts[i]  = (end - begin) - counts[i];
+    }
+  }
+  return ret;
+}
+
+lazy_null_counts::lazy_null_counts(std::vector<bitmask_type const *> null_masks,
+                                   std::vector<size_type> offsets,
+                                   std::vector<size_type> indices)
+  : _null_masks(std::move(null_masks)), _offsets(std::move(offsets)), _indices(std::move(indices)) {
+  CUDF_EXPECTS(_null_masks.size() == _offsets.size(), "Mismatch of null masks and offsets");
+}
+
+size_type lazy_null_counts::null_count(size_type index) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (not _counted) {
+    count();
+    _counted = true;
+  }
+  return _null_counts[index];
+}
+
+void lazy_null_counts::count() {
+  size_type const num_slices = _indices.size() / 2;
+  _null_counts.assign(_null_masks.size() * num_slices, 0);
+
+  // The columns of the same offset are counted together
+  std::vector<size_type> columns(_null_masks.size());
+  std::iota(columns.begin(), columns.end(), 0);
+  auto const last = std::remove_if(
+    columns.begin(), columns.end(), [this](size_type c) { return _null_masks[c] == nullptr; });
+  columns.erase(last, columns.end());
+  std::stable_sort(columns.begin(), columns.end(), [this](size_type lhs, size_type rhs) {
+    return _offsets[lhs] < _offsets[rhs];
+  });
+  for (auto first = columns.begin(); first != columns.end();) {
+    auto const offset = _offsets[*first];
+    auto const end    = std::find_if(
+      first, columns.end(), [this, offset](size_type c) { return _offsets[c] != offset; });
+    std::vector<bitmask_type const *> null_masks;
+    std::transform(first, end, std::back_inserter(null_masks), [this](size_type c) {
+      return _null_masks[c];
+    });
+    std::vector<size_type> indices(_indices);
+    for (auto &index : indices) { index += offset; }
+    auto const counts = segmented_count_unset_bits(null_masks, indices);
+    for (size_t i = 0; i < counts.size(); ++i) {
+      std::copy(counts[i].begin(), counts[i].end(), _null_counts.begin() + first[i] * num_slices);
+    }
+    first = end;
+  }
+}
+
+void lazy_null_counts::attach(column_view_base &view,
+                              std::shared_ptr<lazy_null_counts> const &counts,
+                              size_type column_index,
+                              size_type slice_index) {
+  view._lazy_null_counts      = counts;
+  view._lazy_null_count_index = column_index * (counts->_indices.size() / 2) + slice_index;
+}
+
 }  // namespace detail
 
 // Count non-zero bits in the specified range
@@ -597,7 +865,8 @@ rmm::device_buffer copy_bitmask(bitmask_type const *mask,
   } else {
     auto number_of_mask_words = num_bitmask_words(end_bit - begin_bit);
     dest_mask                 = rmm::device_buffer{num_bytes, stream, mr};
-    cudf::experimental::detail::grid_1d config(number_of_mask_words, 256);
+    cudf::experimental::detail::grid_1d config(
+      cudf::util::div_rounding_up_safe(number_of_mask_words, words_per_thread), 256);
     copy_offset_bitmask<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
       static_cast<bitmask_type *>(dest_mask.data()),
       mask,
@@ -638,9 +907,43 @@ rmm::device_buffer bitmask_and(table_view const &view,
     }
   }
 
-  if (masks.size() > 0) { return bitmask_and(masks, offsets, view.num_rows(), stream, mr); }
+  if (masks.size() > 0) {
+    return bitmask_binop(
+      [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
+      masks,
+      offsets,
+      view.num_rows(),
+      stream,
+      mr);
+  }
 
   return null_mask;
 }
 
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const &view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  rmm::device_buffer null_mask{};
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    // A column without a null mask makes every row valid
+    if (not col.nullable()) { return null_mask; }
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+
+  return bitmask_binop(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    masks,
+    offsets,
+    view.num_rows(),
+    stream,
+    mr);
+}
+
 }  // namespace cudf
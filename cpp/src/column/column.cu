@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
@@ -37,8 +38,8 @@ namespace cudf {
 column::column(column const &other)
   : _type{other._type},
     _size{other._size},
-    _data{other._data},
-    _null_mask{other._null_mask},
+    _data{other.data_buffer()},
+    _null_mask{other.null_mask_buffer()},
     _null_count{other._null_count} {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) { _children.emplace_back(std::make_unique<column>(*c)); }
@@ -48,8 +49,8 @@ column::column(column const &other)
 column::column(column const &other, cudaStream_t stream, rmm::mr::device_memory_resource *mr)
   : _type{other._type},
     _size{other._size},
-    _data{other._data, stream, mr},
-    _null_mask{other._null_mask, stream, mr},
+    _data{other.data_buffer(), stream, mr},
+    _null_mask{other.null_mask_buffer(), stream, mr},
     _null_count{other._null_count} {
   _children.reserve(other.num_children());
   for (auto const &c : other._children) {
@@ -64,14 +65,25 @@ column::column(column &&other) noexcept
     _data{std::move(other._data)},
     _null_mask{std::move(other._null_mask)},
     _null_count{other._null_count},
-    _children{std::move(other._children)} {
+    _children{std::move(other._children)},
+    _shared{std::move(other._shared)} {
   other._size       = 0;
   other._null_count = 0;
   other._type       = data_type{EMPTY};
 }
 
 // Release contents
-column::contents column::release() noexcept {
+column::contents column::release() {
+  if (_shared != nullptr) {
+    // The shared memory is not owned, so a copy of it is released instead
+    column copy{*this};
+    _size       = 0;
+    _null_count = 0;
+    _type       = data_type{EMPTY};
+    _children.clear();
+    _shared.reset();
+    return copy.release();
+  }
   _size       = 0;
   _null_count = 0;
   _type       = data_type{EMPTY};
@@ -89,8 +101,8 @@ column_view column::view() const {
 
   return column_view{type(),
                      size(),
-                     _data.data(),
-                     static_cast<bitmask_type const *>(_null_mask.data()),
+                     data_buffer().data(),
+                     static_cast<bitmask_type const *>(null_mask_buffer().data()),
                      null_count(),
                      0,
                      child_views};
@@ -98,6 +110,8 @@ column_view column::view() const {
 
 // Create mutable view
 mutable_column_view column::mutable_view() {
+  CUDF_EXPECTS(_shared == nullptr, "Cannot mutate a column sharing the memory of another column");
+
   // create views of children
   std::vector<mutable_column_view> child_views;
   child_views.reserve(_children.size());
@@ -125,17 +139,43 @@ mutable_column_view column::mutable_view() {
                              child_views};
 }
 
+// Share the memory of `owner`
+std::unique_ptr<column> column::share(std::shared_ptr<column const> owner) {
+  CUDF_EXPECTS(owner != nullptr, "Cannot share the memory of a null column");
+  auto shared         = std::make_unique<column>();
+  shared->_type       = owner->_type;
+  shared->_size       = owner->_size;
+  shared->_null_count = owner->_null_count;
+  shared->_children.reserve(owner->num_children());
+  for (auto const &c : owner->_children) {
+    // Each child keeps the whole of `owner` alive
+    shared->_children.emplace_back(share(std::shared_ptr<column const>(owner, c.get())));
+  }
+  shared->_shared = std::move(owner);
+  return shared;
+}
+
+rmm::device_buffer const &column::data_buffer() const noexcept {
+  return (_shared != nullptr) ? _shared->data_buffer() : _data;
+}
+
+rmm::device_buffer const &column::null_mask_buffer() const noexcept {
+  return (_shared != nullptr) ? _shared->null_mask_buffer() : _null_mask;
+}
+
 // If the null count is known, return it. Else, compute and return it
 size_type column::null_count() const {
   CUDF_FUNC_RANGE();
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
-    _null_count =
-      cudf::count_unset_bits(static_cast<bitmask_type const *>(_null_mask.data()), 0, size());
+    _null_count = cudf::count_unset_bits(
+      static_cast<bitmask_type const *>(null_mask_buffer().data()), 0, size());
   }
   return _null_count;
 }
 
 void column::set_null_mask(rmm::device_buffer &&new_null_mask, size_type new_null_count) {
+  CUDF_EXPECTS(_shared == nullptr,
+               "Cannot set the null mask of a column sharing the memory of another column");
   if (new_null_count > 0) {
     CUDF_EXPECTS(new_null_mask.size() >= cudf::bitmask_allocation_size_bytes(this->size()),
                  "Column with null values must be nullable and the null mask \
@@ -146,6 +186,8 @@ void column::set_null_mask(rmm::device_buffer &&new_null_mask, size_type new_nul
 }
 
 void column::set_null_mask(rmm::device_buffer const &new_null_mask, size_type new_null_count) {
+  CUDF_EXPECTS(_shared == nullptr,
+               "Cannot set the null mask of a column sharing the memory of another column");
   if (new_null_count > 0) {
     CUDF_EXPECTS(new_null_mask.size() >= cudf::bitmask_allocation_size_bytes(this->size()),
                  "Column with null values must be nullable and the null mask \
@@ -187,6 +229,15 @@ struct create_column_from_view {
                                     std::move(children));
   }
 
+  template <typename ColumnType, std::enable_if_t<cudf::is_nested<ColumnType>()> * = nullptr>
+  std::unique_ptr<column> operator()() {
+    // gathering every row copies only the rows of the children, rebasing any list offsets
+    auto const rows = thrust::make_counting_iterator<size_type>(0);
+    auto result =
+      experimental::detail::gather(table_view{{view}}, rows, rows + view.size(), false, mr, stream);
+    return std::move(result->release().front());
+  }
+
   template <typename ColumnType, std::enable_if_t<cudf::is_fixed_width<ColumnType>()> * = nullptr>
   std::unique_ptr<column> operator()() {
     std::vector<std::unique_ptr<column>> children;
@@ -132,7 +132,7 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream) {
                            cudaMemcpyDefault,
                            stream));
 
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   return result;
 }
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -60,7 +61,9 @@ column_view_base::column_view_base(data_type type,
 // If null count is known, returns it. Else, compute and return it
 size_type column_view_base::null_count() const {
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
-    _null_count = cudf::count_unset_bits(null_mask(), offset(), offset() + size());
+    _null_count = (_lazy_null_counts != nullptr)
+                    ? _lazy_null_counts->null_count(_lazy_null_count_index)
+                    : cudf::count_unset_bits(null_mask(), offset(), offset() + size());
   }
   return _null_count;
 }
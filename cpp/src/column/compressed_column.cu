@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/compressed_column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <cub/cub.cuh>
+
+#include <limits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+constexpr int block_threads   = 256;
+constexpr int rows_per_thread = 4;
+constexpr int rows_per_block  = block_threads * rows_per_thread;
+
+/**
+ * @brief A column is run-length encoded if its runs average at least this length
+ */
+constexpr size_type min_average_run_length = 8;
+
+enum class block_mode : int32_t { FRAME_OF_REFERENCE, DELTA };
+
+/**
+ * @brief The bitpacking of a block of `rows_per_block` values
+ *
+ * Each value `v` is stored in `width` bits as `v - reference` in
+ * `FRAME_OF_REFERENCE` mode, and as the difference from the previous value
+ * minus `reference` in `DELTA` mode, where `first` is the first value of the
+ * block. All arithmetic is modulo 2^64.
+ */
+struct block_header {
+  int64_t reference;
+  int64_t first;
+  int32_t width;
+  block_mode mode;
+};
+
+/**
+ * @brief A sequence of 64-bit values bitpacked block by block
+ */
+struct packed_values {
+  size_type size{};
+  rmm::device_buffer headers{};       ///< `block_header` of each block
+  rmm::device_buffer word_offsets{};  ///< Index of the first word of each block
+  rmm::device_buffer words{};         ///< The packed bits of all the blocks
+
+  std::size_t device_size() const { return headers.size() + word_offsets.size() + words.size(); }
+};
+
+namespace {
+
+__device__ int32_t bit_width(uint64_t range) { return range == 0 ? 0 : 64 - __clzll(range); }
+
+__device__ uint64_t delta_at(int64_t const* values, size_type row, size_type first_row) {
+  return row == first_row ? 0
+                          : static_cast<uint64_t>(values[row]) -
+                              static_cast<uint64_t>(values[row - 1]);
+}
+
+/**
+ * @brief Chooses the mode and width with the fewest bits for each block
+ */
+__global__ void analyze_blocks(int64_t const* values,
+                               size_type size,
+                               block_header* headers,
+                               size_type* num_words) {
+  using block_reduce = cub::BlockReduce<int64_t, block_threads>;
+  __shared__ typename block_reduce::TempStorage temp_storage;
+
+  size_type const first_row = blockIdx.x * rows_per_block;
+  int64_t value_min         = std::numeric_limits<int64_t>::max();
+  int64_t value_max         = std::numeric_limits<int64_t>::min();
+  int64_t delta_min         = std::numeric_limits<int64_t>::max();
+  int64_t delta_max         = std::numeric_limits<int64_t>::min();
+  for (int k = 0; k < rows_per_thread; ++k) {
+    size_type const row = first_row + threadIdx.x + k * block_threads;
+    if (row < size) {
+      auto const delta = static_cast<int64_t>(delta_at(values, row, first_row));
+      value_min        = min(value_min, values[row]);
+      value_max        = max(value_max, values[row]);
+      delta_min        = min(delta_min, delta);
+      delta_max        = max(delta_max, delta);
+    }
+  }
+  value_min = block_reduce(temp_storage).Reduce(value_min, cub::Min());
+  __syncthreads();
+  value_max = block_reduce(temp_storage).Reduce(value_max, cub::Max());
+  __syncthreads();
+  delta_min = block_reduce(temp_storage).Reduce(delta_min, cub::Min());
+  __syncthreads();
+  delta_max = block_reduce(temp_storage).Reduce(delta_max, cub::Max());
+
+  if (threadIdx.x == 0) {
+    auto const value_width =
+      bit_width(static_cast<uint64_t>(value_max) - static_cast<uint64_t>(value_min));
+    auto const delta_width =
+      bit_width(static_cast<uint64_t>(delta_max) - static_cast<uint64_t>(delta_min));
+    bool const use_delta     = delta_width < value_width;
+    auto const width         = use_delta ? delta_width : value_width;
+    auto const mode          = use_delta ? block_mode::DELTA : block_mode::FRAME_OF_REFERENCE;
+    auto const rows_in_block = min(rows_per_block, size - first_row);
+    headers[blockIdx.x] =
+      block_header{use_delta ? delta_min : value_min, values[first_row], width, mode};
+    num_words[blockIdx.x] =
+      static_cast<size_type>((static_cast<int64_t>(rows_in_block) * width + 63) / 64);
+  }
+}
+
+/**
+ * @brief Packs the values of each block into the words of the block
+ *
+ * `words` must be zeroed.
+ */
+__global__ void pack_blocks(int64_t const* values,
+                            size_type size,
+                            block_header const* headers,
+                            size_type const* word_offsets,
+                            uint64_t* words) {
+  size_type const first_row = blockIdx.x * rows_per_block;
+  auto const header         = headers[blockIdx.x];
+  if (header.width == 0) { return; }
+  auto const block_words = reinterpret_cast<unsigned long long*>(words + word_offsets[blockIdx.x]);
+  for (int k = 0; k < rows_per_thread; ++k) {
+    size_type const row = first_row + threadIdx.x + k * block_threads;
+    if (row >= size) { break; }
+    auto const value = header.mode == block_mode::DELTA
+                         ? delta_at(values, row, first_row)
+                         : static_cast<uint64_t>(values[row]);
+    auto const packed = value - static_cast<uint64_t>(header.reference);
+    auto const bit    = static_cast<uint32_t>(row - first_row) * header.width;
+    auto const shift  = bit % 64;
+    atomicOr(block_words + bit / 64, static_cast<unsigned long long>(packed << shift));
+    if (shift + header.width > 64) {
+      atomicOr(block_words + bit / 64 + 1, static_cast<unsigned long long>(packed >> (64 - shift)));
+    }
+  }
+}
+
+/**
+ * @brief Unpacks the values of each block
+ */
+__global__ void unpack_blocks(block_header const* headers,
+                              size_type const* word_offsets,
+                              uint64_t const* words,
+                              size_type size,
+                              int64_t* values) {
+  using block_scan = cub::BlockScan<uint64_t, block_threads>;
+  __shared__ typename block_scan::TempStorage temp_storage;
+
+  size_type const first_row = blockIdx.x * rows_per_block;
+  auto const header         = headers[blockIdx.x];
+  auto const block_words    = words + word_offsets[blockIdx.x];
+  auto const mask =
+    header.width == 64 ? ~uint64_t{0} : (uint64_t{1} << header.width) - uint64_t{1};
+
+  // Each thread unpacks consecutive values, as the block scan expects
+  uint64_t items[rows_per_thread];
+  for (int k = 0; k < rows_per_thread; ++k) {
+    auto const local = threadIdx.x * rows_per_thread + k;
+    uint64_t packed  = 0;
+    if (header.width > 0 && first_row + static_cast<size_type>(local) < size) {
+      auto const bit   = static_cast<uint32_t>(local) * header.width;
+      auto const shift = bit % 64;
+      packed           = block_words[bit / 64] >> shift;
+      if (shift + header.width > 64) { packed |= block_words[bit / 64 + 1] << (64 - shift); }
+      packed &= mask;
+    }
+    items[k] = packed + static_cast<uint64_t>(header.reference);
+  }
+  if (header.mode == block_mode::DELTA) {
+    block_scan(temp_storage).InclusiveSum(items, items);
+    for (int k = 0; k < rows_per_thread; ++k) {
+      items[k] += static_cast<uint64_t>(header.first);
+    }
+  }
+  for (int k = 0; k < rows_per_thread; ++k) {
+    size_type const row = first_row + threadIdx.x * rows_per_thread + k;
+    if (row < size) { values[row] = static_cast<int64_t>(items[k]); }
+  }
+}
+
+packed_values pack(int64_t const* values,
+                   size_type size,
+                   rmm::mr::device_memory_resource* mr,
+                   cudaStream_t stream) {
+  packed_values packed;
+  packed.size = size;
+  if (size == 0) { return packed; }
+
+  auto const num_blocks = (size + rows_per_block - 1) / rows_per_block;
+  packed.headers        = rmm::device_buffer(num_blocks * sizeof(block_header), stream, mr);
+  packed.word_offsets   = rmm::device_buffer(num_blocks * sizeof(size_type), stream, mr);
+  auto const headers    = static_cast<block_header*>(packed.headers.data());
+  auto const offsets    = static_cast<size_type*>(packed.word_offsets.data());
+  rmm::device_vector<size_type> num_words(num_blocks);
+  analyze_blocks<<<num_blocks, block_threads, 0, stream>>>(
+    values, size, headers, num_words.data().get());
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), num_words.begin(), num_words.end(), offsets);
+
+  size_type h_last[2];
+  CUDA_TRY(cudaMemcpyAsync(&h_last[0],
+                           offsets + num_blocks - 1,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaMemcpyAsync(&h_last[1],
+                           num_words.data().get() + num_blocks - 1,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  auto const total_words = h_last[0] + h_last[1];
+
+  packed.words = rmm::device_buffer(total_words * sizeof(uint64_t), stream, mr);
+  if (total_words > 0) {
+    CUDA_TRY(cudaMemsetAsync(packed.words.data(), 0, packed.words.size(), stream));
+    pack_blocks<<<num_blocks, block_threads, 0, stream>>>(
+      values, size, headers, offsets, static_cast<uint64_t*>(packed.words.data()));
+  }
+  CHECK_CUDA(stream);
+  return packed;
+}
+
+void unpack(packed_values const& packed, int64_t* values, cudaStream_t stream) {
+  if (packed.size == 0) { return; }
+  auto const num_blocks = (packed.size + rows_per_block - 1) / rows_per_block;
+  unpack_blocks<<<num_blocks, block_threads, 0, stream>>>(
+    static_cast<block_header const*>(packed.headers.data()),
+    static_cast<size_type const*>(packed.word_offsets.data()),
+    static_cast<uint64_t const*>(packed.words.data()),
+    packed.size,
+    values);
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Reads a value of a column as a 64-bit integer, replacing a null by
+ * the last valid value before it so that nulls do not break the runs
+ */
+template <typename Rep>
+struct read_value {
+  Rep const* data;
+  size_type const* last_valid;
+  __device__ int64_t operator()(size_type row) const {
+    auto const source = last_valid == nullptr ? row : max(last_valid[row], 0);
+    return static_cast<int64_t>(data[source]);
+  }
+};
+
+struct valid_row {
+  bitmask_type const* mask;
+  size_type offset;
+  __device__ size_type operator()(size_type row) const {
+    return bit_is_set(mask, offset + row) ? row : -1;
+  }
+};
+
+template <typename Rep>
+struct write_value {
+  __device__ Rep operator()(int64_t value) const { return static_cast<Rep>(value); }
+};
+
+struct different_from_previous {
+  int64_t const* values;
+  __device__ bool operator()(size_type row) const { return values[row] != values[row - 1]; }
+};
+
+struct run_of_row {
+  int64_t const* run_ends;
+  size_type num_runs;
+  __device__ size_type operator()(size_type row) const {
+    return static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, run_ends, run_ends + num_runs, int64_t{row}) - run_ends);
+  }
+};
+
+/**
+ * @brief Returns the representation of the values of `type` as integers of
+ * the same size, or 0 if they are not compressed as integers
+ */
+std::size_t integer_width(data_type type) {
+  switch (type.id()) {
+    case INT8:
+    case INT16:
+    case INT32:
+    case INT64:
+    case BOOL8:
+    case TIMESTAMP_DAYS:
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS:
+    case DECIMAL32:
+    case DECIMAL64: return size_of(type);
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Calls `f.template operator()<Rep>()` with the signed integer `Rep` of
+ * `width` bytes
+ */
+template <typename Functor>
+auto dispatch_width(std::size_t width, Functor f) {
+  switch (width) {
+    case 1: return f.template operator()<int8_t>();
+    case 2: return f.template operator()<int16_t>();
+    case 4: return f.template operator()<int32_t>();
+    case 8: return f.template operator()<int64_t>();
+    default: CUDF_FAIL("Unsupported integer width");
+  }
+}
+
+/**
+ * @brief Returns the number of bytes of device memory of a column
+ */
+std::size_t device_size(column_view const& col) {
+  std::size_t size = col.nullable() ? bitmask_allocation_size_bytes(col.size()) : 0;
+  if (is_fixed_width(col.type())) { size += col.size() * size_of(col.type()); }
+  for (size_type i = 0; i < col.num_children(); ++i) { size += device_size(col.child(i)); }
+  return size;
+}
+
+}  // namespace
+}  // namespace detail
+
+struct compressed_column::impl {
+  data_type type{EMPTY};
+  size_type size{};
+  size_type null_count{};
+  rmm::device_buffer null_mask{};
+  column_encoding encoding{column_encoding::NONE};
+  bool run_length_encoded{false};
+  detail::packed_values values{};       ///< The values, or the values of the runs
+  detail::packed_values run_lengths{};  ///< The lengths of the runs
+  std::unique_ptr<column> keys{};       ///< The dictionary of DICTIONARY columns
+  std::unique_ptr<column> plain{};      ///< The column if it is not compressed
+};
+
+namespace detail {
+namespace {
+
+/**
+ * @brief Run-length encodes, then bitpacks, integer values into `result`
+ */
+struct compress_integers {
+  column_view const& input;
+  compressed_column::impl& result;
+  rmm::mr::device_memory_resource* mr;
+  cudaStream_t stream;
+
+  template <typename Rep>
+  void operator()() {
+    auto const size = input.size();
+    auto exec       = rmm::exec_policy(stream);
+
+    rmm::device_vector<size_type> last_valid;
+    if (input.nullable()) {
+      last_valid.resize(size);
+      auto const valid_rows = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0), valid_row{input.null_mask(), input.offset()});
+      thrust::inclusive_scan(exec->on(stream),
+                             valid_rows,
+                             valid_rows + size,
+                             last_valid.begin(),
+                             thrust::maximum<size_type>());
+    }
+    rmm::device_vector<int64_t> values(size);
+    thrust::transform(exec->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(size),
+                      values.begin(),
+                      read_value<Rep>{input.data<Rep>(),
+                                      input.nullable() ? last_valid.data().get() : nullptr});
+    last_valid = rmm::device_vector<size_type>{};
+
+    auto const num_runs = 1 + static_cast<size_type>(
+                                thrust::count_if(exec->on(stream),
+                                                 thrust::make_counting_iterator<size_type>(1),
+                                                 thrust::make_counting_iterator<size_type>(size),
+                                                 different_from_previous{values.data().get()}));
+    if (num_runs > size / min_average_run_length) {
+      result.values = pack(values.data().get(), size, mr, stream);
+      return;
+    }
+
+    rmm::device_vector<int64_t> run_values(num_runs);
+    rmm::device_vector<int64_t> run_lengths(num_runs);
+    thrust::reduce_by_key(exec->on(stream),
+                          values.begin(),
+                          values.end(),
+                          thrust::make_constant_iterator<int64_t>(1),
+                          run_values.begin(),
+                          run_lengths.begin());
+    result.run_length_encoded = true;
+    result.values             = pack(run_values.data().get(), num_runs, mr, stream);
+    result.run_lengths        = pack(run_lengths.data().get(), num_runs, mr, stream);
+  }
+};
+
+/**
+ * @brief Unpacks the integer values of `input` into `output`
+ */
+struct decompress_integers {
+  compressed_column::impl const& input;
+  mutable_column_view output;
+  cudaStream_t stream;
+
+  template <typename Rep>
+  void operator()() {
+    auto exec = rmm::exec_policy(stream);
+    rmm::device_vector<int64_t> values(input.size);
+    if (input.run_length_encoded) {
+      auto const num_runs = input.values.size;
+      rmm::device_vector<int64_t> run_values(num_runs);
+      rmm::device_vector<int64_t> run_ends(num_runs);
+      unpack(input.values, run_values.data().get(), stream);
+      unpack(input.run_lengths, run_ends.data().get(), stream);
+      thrust::inclusive_scan(exec->on(stream), run_ends.begin(), run_ends.end(), run_ends.begin());
+      auto const runs = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0), run_of_row{run_ends.data().get(), num_runs});
+      thrust::gather(
+        exec->on(stream), runs, runs + input.size, run_values.begin(), values.begin());
+    } else {
+      unpack(input.values, values.data().get(), stream);
+    }
+    thrust::transform(exec->on(stream),
+                      values.begin(),
+                      values.end(),
+                      output.data<Rep>(),
+                      write_value<Rep>{});
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream = 0) {
+  CUDF_EXPECTS(input.type().id() != DICTIONARY32 && input.type().id() != LIST &&
+                 input.type().id() != STRUCT,
+               "Unsupported column type for compression");
+  auto result        = std::make_unique<compressed_column::impl>();
+  result->type       = input.type();
+  result->size       = input.size();
+  result->null_count = input.null_count();
+  if (input.size() == 0) {
+    result->plain = std::make_unique<column>(input, stream, mr);
+    return std::make_unique<compressed_column>(std::move(result));
+  }
+
+  if (input.type().id() == STRING) {
+    auto const dictionary = dictionary::detail::encode(
+      input, data_type{INT32}, rmm::mr::get_default_resource(), stream);
+    dictionary_column_view const view(dictionary->view());
+    result->encoding = column_encoding::DICTIONARY;
+    result->keys     = std::make_unique<column>(view.keys(), stream, mr);
+    compress_integers{view.get_indices_annotated(), *result, mr, stream}.operator()<int32_t>();
+  } else if (integer_width(input.type()) > 0) {
+    result->encoding = column_encoding::CASCADED;
+    dispatch_width(integer_width(input.type()), compress_integers{input, *result, mr, stream});
+  } else {
+    result->plain = std::make_unique<column>(input, stream, mr);
+  }
+  if (result->plain == nullptr && input.nullable()) {
+    result->null_mask = copy_bitmask(input, stream, mr);
+  }
+  return std::make_unique<compressed_column>(std::move(result));
+}
+
+std::unique_ptr<column> decompress(compressed_column const& input,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream = 0) {
+  auto const& impl = input.get_impl();
+  if (impl.encoding == column_encoding::NONE) {
+    return std::make_unique<column>(impl.plain->view(), stream, mr);
+  }
+  auto const copy_null_mask = [&impl, stream](rmm::mr::device_memory_resource* mr) {
+    return rmm::device_buffer(impl.null_mask, stream, mr);
+  };
+
+  if (impl.encoding == column_encoding::DICTIONARY) {
+    if (impl.keys->size() == 0) {
+      // Only nulls
+      return make_column_from_scalar(string_scalar("", false), impl.size, mr, stream);
+    }
+    auto indices = make_numeric_column(data_type{INT32},
+                                       impl.size,
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       rmm::mr::get_default_resource());
+    decompress_integers{impl, indices->mutable_view(), stream}.operator()<int32_t>();
+    indices->set_null_mask(copy_null_mask(rmm::mr::get_default_resource()), impl.null_count);
+    auto const dictionary = make_dictionary_column(
+      impl.keys->view(), indices->view(), rmm::mr::get_default_resource(), stream);
+    return dictionary::detail::decode(dictionary_column_view(dictionary->view()), mr, stream);
+  }
+
+  auto output = make_fixed_width_column(impl.type, impl.size, mask_state::UNALLOCATED, stream, mr);
+  dispatch_width(size_of(impl.type), decompress_integers{impl, output->mutable_view(), stream});
+  output->set_null_mask(copy_null_mask(mr), impl.null_count);
+  return output;
+}
+
+}  // namespace detail
+
+compressed_column::compressed_column(std::unique_ptr<impl> impl) : _impl(std::move(impl)) {}
+
+compressed_column::~compressed_column() = default;
+
+data_type compressed_column::type() const noexcept { return _impl->type; }
+
+size_type compressed_column::size() const noexcept { return _impl->size; }
+
+size_type compressed_column::null_count() const noexcept { return _impl->null_count; }
+
+column_encoding compressed_column::encoding() const noexcept { return _impl->encoding; }
+
+std::size_t compressed_column::compressed_size() const noexcept {
+  std::size_t size = _impl->null_mask.size() + _impl->values.device_size() +
+                     _impl->run_lengths.device_size();
+  if (_impl->keys != nullptr) { size += detail::device_size(_impl->keys->view()); }
+  if (_impl->plain != nullptr) { size += detail::device_size(_impl->plain->view()); }
+  return size;
+}
+
+compressed_table::compressed_table(std::vector<std::unique_ptr<compressed_column>>&& columns)
+  : _columns(std::move(columns)) {
+  if (not _columns.empty()) { _num_rows = _columns.front()->size(); }
+  for (auto const& c : _columns) {
+    CUDF_EXPECTS(c->size() == _num_rows, "Column size mismatch.");
+  }
+}
+
+std::size_t compressed_table::compressed_size() const noexcept {
+  std::size_t size = 0;
+  for (auto const& c : _columns) { size += c->compressed_size(); }
+  return size;
+}
+
+std::unique_ptr<compressed_column> compress(column_view const& input,
+                                            rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::compress(input, mr);
+}
+
+std::unique_ptr<compressed_table> compress(table_view const& input,
+                                           rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  std::vector<std::unique_ptr<compressed_column>> columns;
+  for (auto const& c : input) { columns.push_back(detail::compress(c, mr)); }
+  return std::make_unique<compressed_table>(std::move(columns));
+}
+
+std::unique_ptr<column> decompress(compressed_column const& input,
+                                   rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::decompress(input, mr);
+}
+
+std::unique_ptr<table> decompress(compressed_table const& input,
+                                  std::vector<size_type> const& column_indices,
+                                  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  std::vector<std::unique_ptr<column>> columns;
+  if (column_indices.empty()) {
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      columns.push_back(detail::decompress(input.column(i), mr));
+    }
+  } else {
+    for (auto i : column_indices) { columns.push_back(detail::decompress(input.column(i), mr)); }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/spillable_column.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+constexpr std::size_t no_id = std::numeric_limits<std::size_t>::max();
+
+std::size_t data_size(column_view const& col) {
+  return is_fixed_width(col.type()) ? col.size() * size_of(col.type()) : 0;
+}
+
+std::size_t null_mask_size(column_view const& col) {
+  return col.nullable() ? bitmask_allocation_size_bytes(col.size()) : 0;
+}
+
+/**
+ * @brief Returns the number of bytes of the data and null masks of a column
+ * and its descendants
+ */
+std::size_t device_size(column_view const& col) {
+  std::size_t size = data_size(col) + null_mask_size(col);
+  for (size_type i = 0; i < col.num_children(); ++i) { size += device_size(col.child(i)); }
+  return size;
+}
+
+}  // namespace
+
+/**
+ * @brief The contents of a column spilled to host memory
+ *
+ * The buffers are emptied when the column is spilled to disk, and their sizes
+ * kept to read them back.
+ */
+struct spill_manager::host_column {
+  data_type type{EMPTY};
+  size_type size{};
+  size_type null_count{};
+  std::size_t data_size{};
+  std::size_t null_mask_size{};
+  std::vector<std::uint8_t> data{};
+  std::vector<std::uint8_t> null_mask{};
+  std::vector<host_column> children{};
+
+  void write(std::ofstream& file) const {
+    file.write(reinterpret_cast<char const*>(data.data()), data.size());
+    file.write(reinterpret_cast<char const*>(null_mask.data()), null_mask.size());
+    for (auto const& c : children) { c.write(file); }
+  }
+
+  void read(std::ifstream& file) {
+    data.resize(data_size);
+    null_mask.resize(null_mask_size);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    file.read(reinterpret_cast<char*>(null_mask.data()), null_mask.size());
+    for (auto& c : children) { c.read(file); }
+  }
+
+  void release() {
+    std::vector<std::uint8_t>().swap(data);
+    std::vector<std::uint8_t>().swap(null_mask);
+    for (auto& c : children) { c.release(); }
+  }
+};
+
+struct spill_manager::entry {
+  std::shared_ptr<column> device{};  ///< The column, if it is on the device
+  host_column host{};                ///< The contents of the column, if it is spilled
+  spill_location location{spill_location::DEVICE};
+  std::size_t size{};  ///< Number of bytes of the buffers of the column
+  std::uint64_t last_use{};
+};
+
+spillable_column::~spillable_column() { _manager->erase(_id); }
+
+std::shared_ptr<column const> spillable_column::get(cudaStream_t stream) {
+  return _manager->get(_id, stream);
+}
+
+spill_location spillable_column::location() const { return _manager->location(_id); }
+
+std::size_t spillable_column::size_bytes() const { return _manager->size_bytes(_id); }
+
+spill_manager::spill_manager(std::size_t device_limit,
+                             std::size_t host_limit,
+                             std::string spill_directory)
+  : _device_limit{device_limit},
+    _host_limit{host_limit},
+    _spill_directory{std::move(spill_directory)} {
+  // The copies are ordered after the work on the columns through `_ready`
+  CUDA_TRY(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking));
+  CUDA_TRY(cudaEventCreateWithFlags(&_ready, cudaEventDisableTiming));
+  for (int i = 0; i < 2; ++i) {
+    CUDA_TRY(cudaMallocHost(&_staging[i], staging_size));
+    CUDA_TRY(cudaEventCreateWithFlags(&_staged[i], cudaEventDisableTiming));
+  }
+}
+
+spill_manager::~spill_manager() {
+  for (auto const& e : _entries) {
+    if (e.second->location == spill_location::DISK) { std::remove(file_name(e.first).c_str()); }
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (_staged[i] != nullptr) { cudaEventDestroy(_staged[i]); }
+    if (_staging[i] != nullptr) { cudaFreeHost(_staging[i]); }
+  }
+  if (_ready != nullptr) { cudaEventDestroy(_ready); }
+  if (_stream != nullptr) { cudaStreamDestroy(_stream); }
+}
+
+std::unique_ptr<spillable_column> spill_manager::make_spillable(std::unique_ptr<column> col,
+                                                                cudaStream_t stream) {
+  CUDF_EXPECTS(col != nullptr, "Null column");
+  std::lock_guard<std::mutex> lock(_mutex);
+  wait_for(stream);
+  auto const id = _next_id++;
+  auto e        = std::make_unique<entry>();
+  e->size       = device_size(col->view());
+  e->device     = std::move(col);
+  e->last_use   = ++_clock;
+  _device_bytes += e->size;
+  _entries.emplace(id, std::move(e));
+  if (_device_bytes > _device_limit) { spill_device(_device_bytes - _device_limit, id); }
+  return std::unique_ptr<spillable_column>(new spillable_column(this, id));
+}
+
+std::size_t spill_manager::available_bytes() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _device_bytes < _device_limit ? _device_limit - _device_bytes : 0;
+}
+
+bool spill_manager::spill(std::size_t bytes) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return spill_device(bytes, no_id) > 0;
+}
+
+std::size_t spill_manager::device_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _device_bytes;
+}
+
+std::size_t spill_manager::host_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _host_bytes;
+}
+
+std::size_t spill_manager::disk_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _disk_bytes;
+}
+
+std::shared_ptr<column const> spill_manager::get(std::size_t id, cudaStream_t stream) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& e    = *_entries.at(id);
+  e.last_use = ++_clock;
+  if (e.location != spill_location::DEVICE) {
+    auto const needed = _device_bytes + e.size;
+    if (needed > _device_limit) { spill_device(needed - _device_limit, id); }
+    to_device(id, e);
+  }
+  // The copy held by the deleter keeps the column in use until the copies
+  // wait for `stream`
+  auto device = e.device;
+  return std::shared_ptr<column const>(
+    device.get(), [this, device, stream](column const*) mutable {
+      std::lock_guard<std::mutex> lock(_mutex);
+      // Errors are left to the following CUDA calls, as a deleter cannot throw
+      cudaEventRecord(_ready, stream);
+      cudaStreamWaitEvent(_stream, _ready, 0);
+      device.reset();
+    });
+}
+
+spill_location spill_manager::location(std::size_t id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.at(id)->location;
+}
+
+std::size_t spill_manager::size_bytes(std::size_t id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.at(id)->size;
+}
+
+void spill_manager::erase(std::size_t id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _entries.find(id);
+  if (it == _entries.end()) { return; }
+  auto const& e = *it->second;
+  switch (e.location) {
+    case spill_location::DEVICE: _device_bytes -= e.size; break;
+    case spill_location::HOST: _host_bytes -= e.size; break;
+    case spill_location::DISK:
+      std::remove(file_name(id).c_str());
+      _disk_bytes -= e.size;
+      break;
+    default: break;
+  }
+  _entries.erase(it);
+}
+
+void spill_manager::wait_for(cudaStream_t stream) {
+  CUDA_TRY(cudaEventRecord(_ready, stream));
+  CUDA_TRY(cudaStreamWaitEvent(_stream, _ready, 0));
+}
+
+std::size_t spill_manager::spill_device(std::size_t bytes, std::size_t keep_id) {
+  std::size_t freed = 0;
+  while (freed < bytes) {
+    // The least recently used column on the device that is not in use
+    entry* victim = nullptr;
+    for (auto const& e : _entries) {
+      auto& candidate = *e.second;
+      if (e.first == keep_id || candidate.location != spill_location::DEVICE ||
+          candidate.device.use_count() > 1) {
+        continue;
+      }
+      if (victim == nullptr || candidate.last_use < victim->last_use) { victim = &candidate; }
+    }
+    if (victim == nullptr) { break; }
+    to_host(*victim);
+    freed += victim->size;
+  }
+  spill_host(keep_id);
+  return freed;
+}
+
+void spill_manager::spill_host(std::size_t keep_id) {
+  if (_spill_directory.empty()) { return; }
+  while (_host_bytes > _host_limit) {
+    std::size_t victim_id = no_id;
+    entry* victim         = nullptr;
+    for (auto const& e : _entries) {
+      auto& candidate = *e.second;
+      if (e.first == keep_id || candidate.location != spill_location::HOST) { continue; }
+      if (victim == nullptr || candidate.last_use < victim->last_use) {
+        victim_id = e.first;
+        victim    = &candidate;
+      }
+    }
+    if (victim == nullptr) { break; }
+    to_disk(victim_id, *victim);
+  }
+}
+
+void spill_manager::to_host(entry& e) {
+  e.host = copy_to_host(e.device->view());
+  e.device.reset();
+  e.location = spill_location::HOST;
+  _device_bytes -= e.size;
+  _host_bytes += e.size;
+}
+
+void spill_manager::to_device(std::size_t id, entry& e) {
+  if (e.location == spill_location::DISK) {
+    std::ifstream file(file_name(id), std::ios::binary);
+    e.host.read(file);
+    CUDF_EXPECTS(file.good(), "Cannot read a spilled column");
+    file.close();
+    std::remove(file_name(id).c_str());
+    e.location = spill_location::HOST;
+    _disk_bytes -= e.size;
+    _host_bytes += e.size;
+  }
+  auto col = copy_to_device(e.host);
+  CUDF_STREAM_SYNC(_stream);
+  e.device   = std::move(col);
+  e.host     = host_column{};
+  e.location = spill_location::DEVICE;
+  _host_bytes -= e.size;
+  _device_bytes += e.size;
+}
+
+void spill_manager::to_disk(std::size_t id, entry& e) {
+  std::ofstream file(file_name(id), std::ios::binary | std::ios::trunc);
+  e.host.write(file);
+  file.close();
+  if (not file.good()) {
+    std::remove(file_name(id).c_str());
+    CUDF_FAIL("Cannot write a spilled column");
+  }
+  e.host.release();
+  e.location = spill_location::DISK;
+  _host_bytes -= e.size;
+  _disk_bytes += e.size;
+}
+
+spill_manager::host_column spill_manager::copy_to_host(column_view const& col) {
+  host_column result;
+  result.type           = col.type();
+  result.size           = col.size();
+  result.null_count     = col.null_count();
+  result.data_size      = data_size(col);
+  result.null_mask_size = null_mask_size(col);
+  result.data.resize(result.data_size);
+  result.null_mask.resize(result.null_mask_size);
+  stage_to_host(col.head(), result.data_size, result.data.data());
+  stage_to_host(col.null_mask(), result.null_mask_size, result.null_mask.data());
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    result.children.push_back(copy_to_host(col.child(i)));
+  }
+  return result;
+}
+
+std::unique_ptr<column> spill_manager::copy_to_device(host_column const& col) {
+  rmm::device_buffer data(col.data.size(), _stream);
+  rmm::device_buffer null_mask(col.null_mask.size(), _stream);
+  stage_to_device(col.data.data(), col.data.size(), data.data());
+  stage_to_device(col.null_mask.data(), col.null_mask.size(), null_mask.data());
+  std::vector<std::unique_ptr<column>> children;
+  for (auto const& c : col.children) { children.push_back(copy_to_device(c)); }
+  return std::make_unique<column>(
+    col.type, col.size, std::move(data), std::move(null_mask), col.null_count, std::move(children));
+}
+
+void spill_manager::stage_to_host(void const* source, std::size_t size, std::uint8_t* destination) {
+  // Chunk k is copied to the staging buffer k % 2 while chunk k - 1 is copied
+  // out of the other one
+  auto const num_chunks = (size + staging_size - 1) / staging_size;
+  auto const chunk_size = [size](std::size_t chunk) {
+    return std::min(staging_size, size - chunk * staging_size);
+  };
+  for (std::size_t chunk = 0; chunk <= num_chunks; ++chunk) {
+    if (chunk < num_chunks) {
+      CUDA_TRY(cudaMemcpyAsync(_staging[chunk % 2],
+                               static_cast<std::uint8_t const*>(source) + chunk * staging_size,
+                               chunk_size(chunk),
+                               cudaMemcpyDeviceToHost,
+                               _stream));
+      CUDA_TRY(cudaEventRecord(_staged[chunk % 2], _stream));
+    }
+    if (chunk > 0) {
+      auto const previous = chunk - 1;
+      CUDA_TRY(cudaEventSynchronize(_staged[previous % 2]));
+      std::memcpy(
+        destination + previous * staging_size, _staging[previous % 2], chunk_size(previous));
+    }
+  }
+}
+
+void spill_manager::stage_to_device(std::uint8_t const* source,
+                                    std::size_t size,
+                                    void* destination) {
+  // Chunk k is copied to the staging buffer k % 2 once chunk k - 2 has been
+  // copied out of it
+  auto const num_chunks = (size + staging_size - 1) / staging_size;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto const offset = chunk * staging_size;
+    auto const bytes  = std::min(staging_size, size - offset);
+    CUDA_TRY(cudaEventSynchronize(_staged[chunk % 2]));
+    std::memcpy(_staging[chunk % 2], source + offset, bytes);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<std::uint8_t*>(destination) + offset,
+                             _staging[chunk % 2],
+                             bytes,
+                             cudaMemcpyHostToDevice,
+                             _stream));
+    CUDA_TRY(cudaEventRecord(_staged[chunk % 2], _stream));
+  }
+}
+
+std::string spill_manager::file_name(std::size_t id) const {
+  auto const manager = std::to_string(reinterpret_cast<std::uintptr_t>(this));
+  return _spill_directory + "/cudf_spill_" + manager + "_" + std::to_string(id);
+}
+
+}  // namespace cudf
@@ -17,14 +17,23 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/managed_memory.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/element_copy.cuh>
+#include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/detail/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
 #include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
 #include <algorithm>
@@ -304,6 +313,16 @@ struct concatenate_dispatch {
   std::unique_ptr<column> operator()() {
     return cudf::strings::detail::concatenate(views, mr, stream);
   }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::list_view>::value>* = nullptr>
+  std::unique_ptr<column> operator()() {
+    return cudf::lists::detail::concatenate(views, mr, stream);
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+  std::unique_ptr<column> operator()() {
+    return cudf::structs::detail::concatenate(views, mr, stream);
+  }
 };
 
 // Concatenates the elements from a vector of column_views
@@ -324,9 +343,365 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns_to_c
     return experimental::empty_like(columns_to_concat.front());
   }
 
+  cudf::detail::prefetch_to_device(columns_to_concat, stream);
   return experimental::type_dispatcher(type, concatenate_dispatch{columns_to_concat, mr, stream});
 }
 
+// From the launch overhead of the per column kernels, the batched kernels
+// appear to perform better when many small tables are concatenated
+constexpr bool use_batched_kernel_heuristic(size_t const num_tables, size_t const num_rows) {
+  return num_tables > 8 && num_rows < num_tables * 65536;
+}
+
+/**
+ * @brief A column of one of the tables concatenated by the batched kernels
+ */
+struct batched_input {
+  void const* data;               ///< First element, or first offset of a strings column
+  char const* chars;              ///< Characters of a strings column
+  bitmask_type const* null_mask;  ///< Null mask, or `nullptr`
+  size_type offset;               ///< Index of the first element in `null_mask`
+};
+
+/**
+ * @brief A column of the table concatenated by the batched kernels
+ */
+struct batched_output {
+  void* data;               ///< Elements, or offsets of a strings column
+  char* chars;              ///< Characters of a strings column
+  bitmask_type* null_mask;  ///< Null mask, or `nullptr` if the column has no nulls
+  size_type element_size;
+  bool is_string;
+};
+
+/**---------------------------------------------------------------------------*
+ * @brief Concatenates the elements, or the offsets of strings, and the null
+ * masks of a batch of columns of all the tables
+ *
+ * Each `blockIdx.y` concatenates a column of the batch.
+ *
+ * @param inputs The column of each table, `inputs[column * num_tables + table]`
+ * @param outputs The output columns
+ * @param row_offsets Prefix sum of the number of rows of the tables
+ * @param chars_offsets Prefix sum of the number of characters of the columns
+ * of the tables, `chars_offsets[column * (num_tables + 1) + table]`
+ * @param num_tables The number of tables
+ * @param first_column The first column of the batch
+ * @param valid_counts The number of valid elements of each output column
+ *---------------------------------------------------------------------------**/
+template <size_type block_size>
+__global__ void batched_concatenate_kernel(batched_input const* inputs,
+                                           batched_output const* outputs,
+                                           size_type const* row_offsets,
+                                           size_type const* chars_offsets,
+                                           size_type num_tables,
+                                           size_type first_column,
+                                           size_type* valid_counts) {
+  size_type const column     = first_column + blockIdx.y;
+  auto const& output         = outputs[column];
+  auto const* column_inputs  = inputs + column * num_tables;
+  auto const* column_offsets = chars_offsets + column * (num_tables + 1);
+  auto const num_rows        = row_offsets[num_tables];
+  bool const nullable        = output.null_mask != nullptr;
+
+  size_type output_index     = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type warp_valid_count = 0;
+
+  unsigned active_mask = __ballot_sync(0xFFFF'FFFF, output_index < num_rows);
+  while (output_index < num_rows) {
+    // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
+    size_type const table =
+      thrust::upper_bound(thrust::seq, row_offsets, row_offsets + num_tables, output_index) -
+      row_offsets - 1;
+    auto const& input       = column_inputs[table];
+    auto const offset_index = output_index - row_offsets[table];
+
+    if (output.is_string) {
+      auto const* input_offsets = static_cast<int32_t const*>(input.data);
+      static_cast<int32_t*>(output.data)[output_index] =
+        input_offsets[offset_index] - input_offsets[0] + column_offsets[table];
+    } else {
+      experimental::detail::copy_element(
+        input.data, offset_index, output.data, output_index, output.element_size);
+    }
+
+    if (nullable) {
+      bool const is_valid =
+        input.null_mask == nullptr or bit_is_set(input.null_mask, input.offset + offset_index);
+      bitmask_type const new_word = __ballot_sync(active_mask, is_valid);
+
+      // First thread writes bitmask word
+      if (threadIdx.x % experimental::detail::warp_size == 0) {
+        output.null_mask[word_index(output_index)] = new_word;
+      }
+
+      warp_valid_count += __popc(new_word);
+    }
+
+    output_index += blockDim.x * gridDim.x;
+    active_mask = __ballot_sync(active_mask, output_index < num_rows);
+  }
+
+  // Fill final offsets index with total size of char data
+  if (output.is_string and output_index == num_rows) {
+    static_cast<int32_t*>(output.data)[num_rows] = column_offsets[num_tables];
+  }
+
+  // `nullable` is the same for all the threads of the block
+  if (nullable) {
+    using experimental::detail::single_lane_block_sum_reduce;
+    auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+    if (threadIdx.x == 0) { atomicAdd(&valid_counts[column], block_valid_count); }
+  }
+}
+
+/**---------------------------------------------------------------------------*
+ * @brief Concatenates the characters of a batch of strings columns of all the
+ * tables
+ *
+ * Each `blockIdx.y` concatenates the column `string_columns[first_column + blockIdx.y]`.
+ *
+ * @param inputs The column of each table, `inputs[column * num_tables + table]`
+ * @param outputs The output columns
+ * @param chars_offsets Prefix sum of the number of characters of the columns
+ * of the tables, `chars_offsets[column * (num_tables + 1) + table]`
+ * @param string_columns The indices of the strings columns in `outputs`
+ * @param num_tables The number of tables
+ * @param first_column The first strings column of the batch
+ *---------------------------------------------------------------------------**/
+__global__ void batched_concatenate_chars_kernel(batched_input const* inputs,
+                                                 batched_output const* outputs,
+                                                 size_type const* chars_offsets,
+                                                 size_type const* string_columns,
+                                                 size_type num_tables,
+                                                 size_type first_column) {
+  size_type const column     = string_columns[first_column + blockIdx.y];
+  auto* output_chars         = outputs[column].chars;
+  auto const* column_inputs  = inputs + column * num_tables;
+  auto const* column_offsets = chars_offsets + column * (num_tables + 1);
+  auto const num_chars       = column_offsets[num_tables];
+
+  for (size_type output_index = threadIdx.x + blockIdx.x * blockDim.x; output_index < num_chars;
+       output_index += blockDim.x * gridDim.x) {
+    size_type const table =
+      thrust::upper_bound(thrust::seq, column_offsets, column_offsets + num_tables, output_index) -
+      column_offsets - 1;
+    auto const& input          = column_inputs[table];
+    auto const first_char      = static_cast<int32_t const*>(input.data)[0];
+    output_chars[output_index] = input.chars[first_char + output_index - column_offsets[table]];
+  }
+}
+
+/**
+ * @brief Launches `kernel` over the columns `[0, num_columns)` in batches of
+ * at most the maximum number of blocks in the y dimension of a grid
+ */
+template <typename Launch>
+void for_each_column_batch(size_type num_columns, Launch launch) {
+  constexpr size_type max_grid_y{65535};
+  for (size_type first_column = 0; first_column < num_columns; first_column += max_grid_y) {
+    launch(first_column, std::min(max_grid_y, num_columns - first_column));
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width and strings columns of `tables` with a
+ * few kernel launches for all the columns, and the other columns one at a time
+ */
+std::unique_ptr<experimental::table> batched_concatenate(std::vector<table_view> const& tables,
+                                                          rmm::mr::device_memory_resource* mr,
+                                                          cudaStream_t stream) {
+  using mask_policy       = cudf::experimental::mask_allocation_policy;
+  auto const& first_table = tables.front();
+  auto const num_tables   = static_cast<size_type>(tables.size());
+  auto const num_columns  = first_table.num_columns();
+  constexpr size_type block_size{256};
+
+  // Compute the partition offsets
+  std::vector<size_type> row_offsets(num_tables + 1, 0);
+  size_t num_rows = 0;
+  for (size_type table = 0; table < num_tables; ++table) {
+    num_rows += tables[table].num_rows();
+    CUDF_EXPECTS(num_rows < std::numeric_limits<size_type>::max(),
+                 "Total number of concatenated rows exceeds size_type range");
+    row_offsets[table + 1] = num_rows;
+  }
+
+  // Columns of other types are concatenated one at a time
+  std::vector<std::unique_ptr<column>> columns(num_columns);
+  std::vector<size_type> batch;
+  for (size_type index = 0; index < num_columns; ++index) {
+    auto const type = first_table.column(index).type();
+    if (is_fixed_width(type) or type.id() == STRING) {
+      batch.push_back(index);
+    } else {
+      std::vector<column_view> views;
+      for (auto const& t : tables) { views.push_back(t.column(index)); }
+      columns[index] = concatenate(views, mr, stream);
+    }
+  }
+  if (batch.empty()) { return std::make_unique<experimental::table>(std::move(columns)); }
+  auto const batch_size = static_cast<size_type>(batch.size());
+
+  // Describe the inputs
+  thrust::host_vector<batched_input> inputs(batch_size * num_tables);
+  std::vector<bool> has_nulls(batch_size, false);
+  std::vector<size_type> string_columns;
+  for (size_type column = 0; column < batch_size; ++column) {
+    bool const is_string = first_table.column(batch[column]).type().id() == STRING;
+    if (is_string) { string_columns.push_back(column); }
+    for (size_type table = 0; table < num_tables; ++table) {
+      auto const& view  = tables[table].column(batch[column]);
+      has_nulls[column] = has_nulls[column] or view.has_nulls();
+      auto& input       = inputs[column * num_tables + table];
+      input.null_mask   = view.nullable() ? view.null_mask() : nullptr;
+      input.offset      = view.offset();
+      input.data        = nullptr;
+      input.chars       = nullptr;
+      if (view.is_empty()) { continue; }  // empty strings columns may not have children
+      if (is_string) {
+        input.data  = view.child(strings_column_view::offsets_column_index).data<int32_t>() +
+                      view.offset();
+        input.chars = view.child(strings_column_view::chars_column_index).data<char>();
+      } else {
+        input.data = static_cast<char const*>(view.head()) + view.offset() * size_of(view.type());
+      }
+    }
+  }
+  rmm::device_vector<batched_input> d_inputs(inputs);
+  rmm::device_vector<size_type> d_row_offsets(row_offsets);
+
+  // Compute the characters of each strings column of each table
+  std::vector<size_type> chars_offsets(batch_size * (num_tables + 1), 0);
+  if (not string_columns.empty()) {
+    rmm::device_vector<size_type> d_string_columns(string_columns);
+    rmm::device_vector<size_type> d_chars_sizes(string_columns.size() * num_tables);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(d_chars_sizes.size()),
+      d_chars_sizes.begin(),
+      [batch_inputs         = d_inputs.data().get(),
+       batch_string_columns = d_string_columns.data().get(),
+       batch_row_offsets    = d_row_offsets.data().get(),
+       num_tables] __device__(size_type index) {
+        auto const table = index % num_tables;
+        auto const size  = batch_row_offsets[table + 1] - batch_row_offsets[table];
+        if (size == 0) { return 0; }
+        auto const column   = batch_string_columns[index / num_tables];
+        auto const& input   = batch_inputs[column * num_tables + table];
+        auto const* offsets = static_cast<int32_t const*>(input.data);
+        return offsets[size] - offsets[0];
+      });
+    CUDF_SYNC_POINT();
+    thrust::host_vector<size_type> chars_sizes(d_chars_sizes);
+    for (size_t index = 0; index < string_columns.size(); ++index) {
+      auto* column_offsets = chars_offsets.data() + string_columns[index] * (num_tables + 1);
+      size_t num_chars     = 0;
+      for (size_type table = 0; table < num_tables; ++table) {
+        num_chars += chars_sizes[index * num_tables + table];
+        CUDF_EXPECTS(num_chars <= std::numeric_limits<size_type>::max(),
+                     "total size of strings is too large for cudf column");
+        column_offsets[table + 1] = num_chars;
+      }
+    }
+  }
+
+  // Allocate the outputs
+  thrust::host_vector<batched_output> outputs(batch_size);
+  std::vector<std::unique_ptr<column>> offsets_columns(batch_size);
+  std::vector<std::unique_ptr<column>> chars_columns(batch_size);
+  std::vector<rmm::device_buffer> null_masks(batch_size);
+  for (size_type column = 0; column < batch_size; ++column) {
+    auto const& view = first_table.column(batch[column]);
+    auto& output     = outputs[column];
+    output.is_string = view.type().id() == STRING;
+    output.chars     = nullptr;
+    output.null_mask = nullptr;
+    if (output.is_string) {
+      auto const num_chars = chars_offsets[column * (num_tables + 1) + num_tables];
+      chars_columns[column] =
+        make_numeric_column(data_type{INT8}, num_chars, mask_state::UNALLOCATED, stream, mr);
+      chars_columns[column]->set_null_count(0);
+      offsets_columns[column] =
+        make_numeric_column(data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+      offsets_columns[column]->set_null_count(0);
+      output.data         = offsets_columns[column]->mutable_view().data<int32_t>();
+      output.chars        = chars_columns[column]->mutable_view().data<char>();
+      output.element_size = sizeof(int32_t);
+      if (has_nulls[column]) {
+        null_masks[column] = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr);
+        output.null_mask   = static_cast<bitmask_type*>(null_masks[column].data());
+      }
+    } else {
+      auto const policy = has_nulls[column] ? mask_policy::ALWAYS : mask_policy::NEVER;
+      auto& out_col     = columns[batch[column]];
+      out_col = experimental::detail::allocate_like(view, num_rows, policy, mr, stream);
+      out_col->set_null_count(0);  // prevent null count from being materialized
+      auto out_view       = out_col->mutable_view();
+      output.data         = out_view.head();
+      output.element_size = size_of(view.type());
+      if (has_nulls[column]) { output.null_mask = out_view.null_mask(); }
+    }
+  }
+  rmm::device_vector<batched_output> d_outputs(outputs);
+  rmm::device_vector<size_type> d_chars_offsets(chars_offsets);
+  rmm::device_vector<size_type> d_valid_counts(batch_size, 0);
+
+  // Copy the elements, the offsets and the null masks with a single kernel launch
+  cudf::experimental::detail::grid_1d config(num_rows + 1, block_size);
+  for_each_column_batch(batch_size, [&](size_type first_column, size_type columns_in_batch) {
+    dim3 const grid(config.num_blocks, columns_in_batch);
+    batched_concatenate_kernel<block_size>
+      <<<grid, config.num_threads_per_block, 0, stream>>>(d_inputs.data().get(),
+                                                          d_outputs.data().get(),
+                                                          d_row_offsets.data().get(),
+                                                          d_chars_offsets.data().get(),
+                                                          num_tables,
+                                                          first_column,
+                                                          d_valid_counts.data().get());
+  });
+
+  // Copy the characters with a single kernel launch
+  size_type max_chars = 0;
+  for (auto column : string_columns) {
+    max_chars = std::max(max_chars, chars_offsets[column * (num_tables + 1) + num_tables]);
+  }
+  if (max_chars > 0) {
+    rmm::device_vector<size_type> d_string_columns(string_columns);
+    cudf::experimental::detail::grid_1d chars_config(max_chars, block_size);
+    auto const num_string_columns = static_cast<size_type>(string_columns.size());
+    for_each_column_batch(num_string_columns, [&](size_type first_column, size_type count) {
+      dim3 const grid(chars_config.num_blocks, count);
+      batched_concatenate_chars_kernel<<<grid, chars_config.num_threads_per_block, 0, stream>>>(
+        d_inputs.data().get(),
+        d_outputs.data().get(),
+        d_chars_offsets.data().get(),
+        d_string_columns.data().get(),
+        num_tables,
+        first_column);
+    });
+  }
+
+  CUDF_SYNC_POINT();
+  thrust::host_vector<size_type> valid_counts(d_valid_counts);
+  for (size_type column = 0; column < batch_size; ++column) {
+    auto const null_count = has_nulls[column] ? num_rows - valid_counts[column] : 0;
+    if (outputs[column].is_string) {
+      columns[batch[column]] = make_strings_column(num_rows,
+                                                   std::move(offsets_columns[column]),
+                                                   std::move(chars_columns[column]),
+                                                   null_count,
+                                                   std::move(null_masks[column]),
+                                                   stream,
+                                                   mr);
+    } else {
+      columns[batch[column]]->set_null_count(null_count);
+    }
+  }
+  return std::make_unique<experimental::table>(std::move(columns));
+}
+
 }  // namespace detail
 
 rmm::device_buffer concatenate_masks(std::vector<column_view> const& views,
@@ -358,9 +733,11 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns_to_c
 }
 
 namespace experimental {
+namespace detail {
 
 std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_concat,
-                                   rmm::mr::device_memory_resource* mr) {
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream) {
   if (tables_to_concat.size() == 0) { return std::make_unique<table>(); }
 
   table_view const first_table = tables_to_concat.front();
@@ -372,15 +749,34 @@ std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_conc
                            }),
                "Mismatch in table columns to concatenate.");
 
+  // Use a heuristic to guess when the batched kernels will be faster
+  size_t const num_rows =
+    std::accumulate(tables_to_concat.begin(),
+                    tables_to_concat.end(),
+                    size_t{0},
+                    [](size_t accumulator, auto const& t) { return accumulator + t.num_rows(); });
+  if (num_rows > 0 and first_table.num_columns() > 0 and
+      cudf::detail::use_batched_kernel_heuristic(tables_to_concat.size(), num_rows)) {
+    return cudf::detail::batched_concatenate(tables_to_concat, mr, stream);
+  }
+
   std::vector<std::unique_ptr<column>> concat_columns;
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
     std::vector<column_view> cols;
     for (auto& t : tables_to_concat) { cols.emplace_back(t.column(i)); }
-    concat_columns.emplace_back(cudf::concatenate(cols, mr));
+    concat_columns.emplace_back(cudf::detail::concatenate(cols, mr, stream));
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
 
+}  // namespace detail
+
+std::unique_ptr<table> concatenate(std::vector<table_view> const& tables_to_concat,
+                                   rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(tables_to_concat, mr, 0);
+}
+
 }  // namespace experimental
 
 }  // namespace cudf
@@ -21,9 +21,16 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
 
+#include <thrust/transform.h>
+
+#include <cstring>
 #include <numeric>
 
 namespace cudf {
@@ -185,6 +192,125 @@ struct column_split_info {
   size_type chars_offset;   // (strings only) offset from head of chars data
 };
 
+/**
+ * @brief Returns the range of child elements of the rows of a lists or strings column.
+ *
+ * Unlike strings, lists columns are not preprocessed as a batch since their
+ * children have to be visited recursively anyway.
+ */
+std::pair<size_type, size_type> child_range(column_view const& c, cudaStream_t stream) {
+  auto const d_offsets = c.child(lists_column_view::offsets_column_index).data<size_type>();
+  size_type first = 0, last = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first, d_offsets + c.offset(), sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(&last,
+                           d_offsets + c.offset() + c.size(),
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  return {first, last};
+}
+
+/**
+ * @brief Returns the size of the buffer needed for a contiguous copy of a
+ * column of nested lists or structs, including the buffers of all its descendants.
+ *
+ * The children may be lists, structs, strings or fixed-width columns.
+ */
+size_t nested_buffer_size(column_view const& c, cudaStream_t stream) {
+  if (c.size() == 0) return 0;
+  size_t size = c.has_nulls() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0;
+  if (c.type().id() == LIST || c.type().id() == STRING) {
+    size += cudf::util::round_up_safe((c.size() + 1) * sizeof(size_type), split_align);
+    auto const range = child_range(c, stream);
+    if (c.type().id() == STRING) {
+      return size + cudf::util::round_up_safe(static_cast<size_t>(range.second - range.first),
+                                              split_align);
+    }
+    auto const child = cudf::experimental::slice(c.child(lists_column_view::child_column_index),
+                                                 {range.first, range.second});
+    return size + nested_buffer_size(child.front(), stream);
+  }
+  if (c.type().id() == STRUCT) {
+    structs_column_view structs(c);
+    for (size_type idx = 0; idx < structs.num_children(); ++idx) {
+      size += nested_buffer_size(structs.sliced_child(idx), stream);
+    }
+    return size;
+  }
+  CUDF_EXPECTS(is_fixed_width(c.type()), "Unsupported child type in nested column");
+  return size + cudf::util::round_up_safe(c.size() * size_of(c.type()), split_align);
+}
+
+/**
+ * @brief Copies a column of nested lists or structs into the buffer at `dst` and returns
+ * the view of the copy.
+ *
+ * The offsets of the lists and strings are shifted down to the beginning of
+ * their copied children and `dst` is advanced by `nested_buffer_size(c)`.
+ */
+column_view copy_nested(column_view const& c, char*& dst, cudaStream_t stream) {
+  if (c.size() == 0) return column_view{c.type(), 0, nullptr};
+
+  bitmask_type* validity = nullptr;
+  if (c.has_nulls()) {
+    validity        = reinterpret_cast<bitmask_type*>(dst);
+    auto const mask = cudf::copy_bitmask(c, stream);
+    CUDA_TRY(
+      cudaMemcpyAsync(validity, mask.data(), mask.size(), cudaMemcpyDeviceToDevice, stream));
+    dst += cudf::bitmask_allocation_size_bytes(c.size(), split_align);
+  }
+
+  if (c.type().id() == LIST || c.type().id() == STRING) {
+    auto const range       = child_range(c, stream);
+    auto const shift       = range.first;
+    auto const d_offsets   = c.child(lists_column_view::offsets_column_index).data<size_type>();
+    auto const offsets_buf = reinterpret_cast<size_type*>(dst);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      d_offsets + c.offset(),
+                      d_offsets + c.offset() + c.size() + 1,
+                      offsets_buf,
+                      [shift] __device__(size_type offset) { return offset - shift; });
+    dst += cudf::util::round_up_safe((c.size() + 1) * sizeof(size_type), split_align);
+    column_view out_offsets{data_type{INT32}, c.size() + 1, offsets_buf};
+
+    auto const in_child = c.child(lists_column_view::child_column_index);
+    column_view out_child;
+    if (c.type().id() == STRING) {
+      auto const num_chars = range.second - range.first;
+      CUDA_TRY(cudaMemcpyAsync(
+        dst, in_child.head<char>() + range.first, num_chars, cudaMemcpyDeviceToDevice, stream));
+      out_child = column_view{in_child.type(), num_chars, dst};
+      dst += cudf::util::round_up_safe(static_cast<size_t>(num_chars), split_align);
+    } else {
+      auto const child = cudf::experimental::slice(in_child, {range.first, range.second});
+      out_child        = copy_nested(child.front(), dst, stream);
+    }
+    return column_view(
+      c.type(), c.size(), nullptr, validity, c.null_count(), 0, {out_offsets, out_child});
+  }
+
+  if (c.type().id() == STRUCT) {
+    structs_column_view structs(c);
+    std::vector<column_view> out_children;
+    for (size_type idx = 0; idx < structs.num_children(); ++idx) {
+      out_children.push_back(copy_nested(structs.sliced_child(idx), dst, stream));
+    }
+    return column_view(c.type(), c.size(), nullptr, validity, c.null_count(), 0, out_children);
+  }
+
+  auto const element_size = size_of(c.type());
+  CUDA_TRY(cudaMemcpyAsync(dst,
+                           c.head<char>() + c.offset() * element_size,
+                           c.size() * element_size,
+                           cudaMemcpyDeviceToDevice,
+                           stream));
+  column_view out_column{c.type(), c.size(), dst, validity, c.null_count()};
+  dst += cudf::util::round_up_safe(c.size() * element_size, split_align);
+  return out_column;
+}
+
 /**
  * @brief Functor called by the `type_dispatcher` to incrementally compute total
  * memory buffer size needed to allocate a contiguous copy of all columns within
@@ -206,6 +332,24 @@ size_t column_buffer_size_functor::operator()<string_view>(column_view const& c,
   return split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size;
 }
 
+template <>
+size_t column_buffer_size_functor::operator()<list_view>(column_view const& c,
+                                                         column_split_info& split_info) {
+  // the buffers of all the descendants are accounted as the data of the lists
+  split_info.data_buf_size     = nested_buffer_size(c, 0);
+  split_info.validity_buf_size = 0;
+  return split_info.data_buf_size;
+}
+
+template <>
+size_t column_buffer_size_functor::operator()<struct_view>(column_view const& c,
+                                                           column_split_info& split_info) {
+  // the buffers of all the descendants are accounted as the data of the structs
+  split_info.data_buf_size     = nested_buffer_size(c, 0);
+  split_info.validity_buf_size = 0;
+  return split_info.data_buf_size;
+}
+
 /**
  * @brief Functor called by the `type_dispatcher` to copy a column into a contiguous
  * buffer of output memory. 
@@ -320,6 +464,22 @@ void column_copy_functor::operator()<string_view>(column_view const& in,
     in.type(), in.size(), nullptr, validity_buf, in.null_count(), 0, {out_offsets, out_chars}));
 }
 
+template <>
+void column_copy_functor::operator()<list_view>(column_view const& in,
+                                                column_split_info const& split_info,
+                                                char*& dst,
+                                                std::vector<column_view>& out_cols) {
+  out_cols.push_back(copy_nested(in, dst, 0));
+}
+
+template <>
+void column_copy_functor::operator()<struct_view>(column_view const& in,
+                                                  column_split_info const& split_info,
+                                                  char*& dst,
+                                                  std::vector<column_view>& out_cols) {
+  out_cols.push_back(copy_nested(in, dst, 0));
+}
+
 /**
  * @brief Information about a string column in a table view.
  * 
@@ -399,20 +559,15 @@ thrust::host_vector<column_split_info> preprocess_string_column_info(
 }
 
 /**
- * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
- * table_view into a single contiguous block of memory. 
- * 
- * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
- * call with the input table.  The memory referenced by the table_view and its internal column_views
- * is entirely contained in single block of memory.
+ * @brief Computes the split information of all the columns of `t` and returns the size of
+ * the contiguous copy of `t`.
  */
-contiguous_split_result alloc_and_copy(cudf::table_view const& t,
-                                       rmm::device_vector<column_split_info>& device_split_info,
-                                       rmm::mr::device_memory_resource* mr,
-                                       cudaStream_t stream) {
+size_t compute_split_info(cudf::table_view const& t,
+                          rmm::device_vector<column_split_info>& device_split_info,
+                          thrust::host_vector<column_split_info>& split_info,
+                          cudaStream_t stream) {
   // preprocess column split information for string columns.
-  thrust::host_vector<column_split_info> split_info =
-    preprocess_string_column_info(t, device_split_info, stream);
+  split_info = preprocess_string_column_info(t, device_split_info, stream);
 
   // compute the rest of the column sizes (non-string columns, and total buffer size)
   size_t total_size      = 0;
@@ -423,28 +578,168 @@ contiguous_split_result alloc_and_copy(cudf::table_view const& t,
         c.type(), column_buffer_size_functor{}, c, split_info[column_index]);
       column_index++;
     });
+  return total_size;
+}
 
-  // allocate
-  auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
-  char* buf       = static_cast<char*>(device_buf->data());
-
+/**
+ * @brief Copies the columns of `t` into the buffer at `buf`, which must hold the size returned
+ * by `compute_split_info()`, and returns the view of the copy.
+ */
+cudf::table_view copy_to_buffer(cudf::table_view const& t,
+                                thrust::host_vector<column_split_info> const& split_info,
+                                char* buf) {
   // copy (this would be cleaner with a std::transform, but there's an nvcc compiler issue in the way)
   std::vector<column_view> out_cols;
   out_cols.reserve(t.num_columns());
 
-  column_index = 0;
+  size_type column_index = 0;
   std::for_each(
     t.begin(), t.end(), [&out_cols, &buf, &column_index, &split_info](cudf::column_view const& c) {
       cudf::experimental::type_dispatcher(
         c.type(), column_copy_functor{}, c, split_info[column_index], buf, out_cols);
       column_index++;
     });
+  return cudf::table_view{out_cols};
+}
+
+/**
+ * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
+ * table_view into a single contiguous block of memory. 
+ * 
+ * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
+ * call with the input table.  The memory referenced by the table_view and its internal column_views
+ * is entirely contained in single block of memory.
+ */
+contiguous_split_result alloc_and_copy(cudf::table_view const& t,
+                                       rmm::device_vector<column_split_info>& device_split_info,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream) {
+  thrust::host_vector<column_split_info> split_info;
+  auto const total_size = compute_split_info(t, device_split_info, split_info, stream);
+
+  // allocate
+  auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
+  auto const view = copy_to_buffer(t, split_info, static_cast<char*>(device_buf->data()));
+
+  return contiguous_split_result{view, std::move(device_buf)};
+}
+
+/**
+ * @brief Layout of a column in the metadata of a `packed_table`, followed by the layouts of
+ * its children.
+ *
+ * The offsets of the buffers are from the start of the partition's data, or -1 for no buffer.
+ */
+struct packed_column {
+  int32_t type_id;
+  int32_t scale;
+  size_type size;
+  size_type null_count;
+  int64_t data_offset;
+  int64_t null_mask_offset;
+  size_type num_children;
+};
+
+void pack_column(column_view const& c, char const* base, std::vector<uint8_t>& metadata) {
+  auto offset_of = [base](void const* ptr) -> int64_t {
+    return ptr == nullptr ? -1 : static_cast<char const*>(ptr) - base;
+  };
+  packed_column const packed{static_cast<int32_t>(c.type().id()),
+                             c.type().scale(),
+                             c.size(),
+                             c.null_count(),
+                             offset_of(c.head()),
+                             offset_of(c.null_mask()),
+                             c.num_children()};
+  auto const bytes = reinterpret_cast<uint8_t const*>(&packed);
+  metadata.insert(metadata.end(), bytes, bytes + sizeof(packed));
+  for (size_type idx = 0; idx < c.num_children(); ++idx) {
+    pack_column(c.child(idx), base, metadata);
+  }
+}
+
+/**
+ * @brief Returns the metadata describing the columns of `t`, whose buffers are all within the
+ * partition's data starting at `base`.
+ */
+std::vector<uint8_t> pack_metadata(cudf::table_view const& t, char const* base) {
+  std::vector<uint8_t> metadata;
+  int32_t const num_columns = t.num_columns();
+  auto const bytes          = reinterpret_cast<uint8_t const*>(&num_columns);
+  metadata.insert(metadata.end(), bytes, bytes + sizeof(num_columns));
+  for (auto const& c : t) { pack_column(c, base, metadata); }
+  return metadata;
+}
 
-  return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
+column_view unpack_column(uint8_t const*& ptr, uint8_t const* end, char const* base) {
+  CUDF_EXPECTS(ptr + sizeof(packed_column) <= end, "Truncated packed table metadata");
+  packed_column packed;
+  std::memcpy(&packed, ptr, sizeof(packed));
+  ptr += sizeof(packed);
+  CUDF_EXPECTS(packed.type_id >= 0 && packed.type_id < NUM_TYPE_IDS,
+               "Invalid type in packed table metadata");
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < packed.num_children; ++idx) {
+    children.push_back(unpack_column(ptr, end, base));
+  }
+  auto pointer_at = [base](int64_t offset) -> void const* {
+    return offset < 0 ? nullptr : base + offset;
+  };
+  return column_view(data_type{static_cast<type_id>(packed.type_id), packed.scale},
+                     packed.size,
+                     pointer_at(packed.data_offset),
+                     static_cast<bitmask_type const*>(pointer_at(packed.null_mask_offset)),
+                     packed.null_count,
+                     0,
+                     children);
 }
 
 };  // anonymous namespace
 
+std::vector<size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           cudaStream_t stream) {
+  auto subtables = cudf::experimental::split(input, splits);
+  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+  thrust::host_vector<column_split_info> split_info;
+
+  std::vector<size_t> sizes;
+  for (auto const& t : subtables) {
+    sizes.push_back(compute_split_info(t, device_split_info, split_info, stream));
+  }
+  return sizes;
+}
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           void* buffer,
+                                           size_t buffer_size,
+                                           cudaStream_t stream) {
+  CUDF_EXPECTS(reinterpret_cast<uintptr_t>(buffer) % split_align == 0,
+               "The buffer is not aligned to 64 bytes");
+  auto subtables = cudf::experimental::split(input, splits);
+  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+
+  std::vector<thrust::host_vector<column_split_info>> split_infos(subtables.size());
+  std::vector<size_t> sizes;
+  for (size_t idx = 0; idx < subtables.size(); ++idx) {
+    sizes.push_back(
+      compute_split_info(subtables[idx], device_split_info, split_infos[idx], stream));
+  }
+  CUDF_EXPECTS(std::accumulate(sizes.begin(), sizes.end(), size_t{0}) <= buffer_size,
+               "The buffer is too small for the partitions");
+
+  std::vector<packed_table> result;
+  size_t offset = 0;
+  for (size_t idx = 0; idx < subtables.size(); ++idx) {
+    char* base      = static_cast<char*>(buffer) + offset;
+    auto const view = copy_to_buffer(subtables[idx], split_infos[idx], base);
+    result.push_back(packed_table{pack_metadata(view, base), offset, sizes[idx]});
+    offset += sizes[idx];
+  }
+  return result;
+}
+
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
                                                       std::vector<size_type> const& splits,
                                                       rmm::mr::device_memory_resource* mr,
@@ -480,6 +775,38 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
   return cudf::experimental::detail::contiguous_split(input, splits, mr, (cudaStream_t)0);
 }
 
+std::vector<size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits) {
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::contiguous_split_sizes(input, splits, (cudaStream_t)0);
+}
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           void* buffer,
+                                           size_t buffer_size) {
+  CUDF_FUNC_RANGE();
+  return cudf::experimental::detail::contiguous_split(
+    input, splits, buffer, buffer_size, (cudaStream_t)0);
+}
+
+table_view unpack(std::vector<uint8_t> const& metadata, void const* data) {
+  CUDF_FUNC_RANGE();
+  uint8_t const* ptr       = metadata.data();
+  uint8_t const* const end = ptr + metadata.size();
+  int32_t num_columns      = 0;
+  CUDF_EXPECTS(metadata.size() >= sizeof(num_columns), "Truncated packed table metadata");
+  std::memcpy(&num_columns, ptr, sizeof(num_columns));
+  ptr += sizeof(num_columns);
+
+  std::vector<column_view> columns;
+  for (int32_t idx = 0; idx < num_columns; ++idx) {
+    columns.push_back(
+      cudf::experimental::detail::unpack_column(ptr, end, static_cast<char const*>(data)));
+  }
+  return table_view{columns};
+}
+
 };  // namespace experimental
 
 };  // namespace cudf
@@ -110,9 +110,10 @@ std::unique_ptr<table> gather(table_view const& source_table,
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
                               bool check_bounds,
-                              rmm::mr::device_memory_resource* mr) {
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::gather(source_table, gather_map, check_bounds, false, true, mr);
+  return detail::gather(source_table, gather_map, check_bounds, false, true, mr, stream);
 }
 
 }  // namespace experimental
@@ -174,6 +174,30 @@ struct column_scalar_scatterer_impl<dictionary32, MapIterator> {
   }
 };
 
+template <typename MapIterator>
+struct column_scalar_scatterer_impl<list_view, MapIterator> {
+  std::unique_ptr<column> operator()(std::unique_ptr<scalar> const& source,
+                                     MapIterator scatter_iter,
+                                     size_type scatter_rows,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const {
+    CUDF_FAIL("scatter scalar to list not implemented");
+  }
+};
+
+template <typename MapIterator>
+struct column_scalar_scatterer_impl<struct_view, MapIterator> {
+  std::unique_ptr<column> operator()(std::unique_ptr<scalar> const& source,
+                                     MapIterator scatter_iter,
+                                     size_type scatter_rows,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const {
+    CUDF_FAIL("scatter scalar to struct not implemented");
+  }
+};
+
 template <typename MapIterator>
 struct column_scalar_scatterer {
   template <typename Element>
@@ -358,17 +382,18 @@ std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
     "Type mismatch in input column and target column");
 
   if (target.num_rows() != 0) {
-    std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
-    std::transform(
-      input.begin(),
-      input.end(),
-      target.begin(),
-      out_columns.begin(),
-      [&boolean_mask, mr, stream](auto const& input_column, auto const& target_column) {
-        return boolean_mask_scatter(input_column, target_column, boolean_mask, mr, stream);
-      });
-
-    return std::make_unique<experimental::table>(std::move(out_columns));
+    // The scatter map is computed once and all the columns are scattered together
+    auto indices = cudf::make_numeric_column(
+      data_type{INT32}, target.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto mutable_indices = indices->mutable_view();
+    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                     mutable_indices.begin<size_type>(),
+                     mutable_indices.end<size_type>(),
+                     0);
+    auto scatter_map =
+      detail::apply_boolean_mask(table_view{{indices->view()}}, boolean_mask, mr, stream);
+
+    return detail::scatter(input, scatter_map->get_column(0).view(), target, false, mr, stream);
   } else {
     return experimental::empty_like(target);
   }
@@ -23,26 +23,29 @@
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
+#include <memory>
 
 namespace cudf {
 namespace experimental {
 
 namespace detail {
+namespace {
 
+/**
+ * @brief Slices `input` into the ranges of `indices`
+ *
+ * The null counts of the slices of a nullable column are counted by
+ * `null_counts` when the first of them is needed, as the column `column_index`
+ * of its columns.
+ */
 std::vector<column_view> slice(column_view const& input,
                                std::vector<size_type> const& indices,
-                               cudaStream_t stream) {
-  CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even");
-
-  std::vector<column_view> result{};
-
-  if (indices.size() == 0 or input.size() == 0) { return result; }
-
-  auto null_counts = cudf::detail::segmented_count_unset_bits(input.null_mask(), indices, stream);
-
+                               std::shared_ptr<cudf::detail::lazy_null_counts> const& null_counts,
+                               size_type column_index) {
   std::vector<column_view> children{};
   for (size_type i = 0; i < input.num_children(); i++) { children.push_back(input.child(i)); }
 
+  std::vector<column_view> result{};
   for (size_t i = 0; i < indices.size() / 2; i++) {
     auto begin = indices[2 * i];
     auto end   = indices[2 * i + 1];
@@ -53,52 +56,93 @@ std::vector<column_view> slice(column_view const& input,
                         end - begin,
                         input.head(),
                         input.null_mask(),
-                        null_counts[i],
+                        input.nullable() ? UNKNOWN_NULL_COUNT : 0,
                         input.offset() + begin,
                         children);
+    if (input.nullable()) {
+      cudf::detail::lazy_null_counts::attach(result.back(), null_counts, column_index, i);
+    }
   }
 
   return result;
 }
 
-}  // namespace detail
+/**
+ * @brief Returns the lazy null counts of the slices of `columns`
+ */
+template <typename ColumnViews>
+std::shared_ptr<cudf::detail::lazy_null_counts> make_lazy_null_counts(
+  ColumnViews const& columns, std::vector<size_type> const& indices) {
+  std::vector<bitmask_type const*> null_masks;
+  std::vector<size_type> offsets;
+  for (column_view const& c : columns) {
+    null_masks.push_back(c.null_mask());
+    offsets.push_back(c.offset());
+  }
+  return std::make_shared<cudf::detail::lazy_null_counts>(
+    std::move(null_masks), std::move(offsets), indices);
+}
 
-std::vector<cudf::column_view> slice(cudf::column_view const& input,
-                                     std::vector<size_type> const& indices) {
-  CUDF_FUNC_RANGE();
-  return detail::slice(input, indices, 0);
+}  // namespace
+
+std::vector<column_view> slice(column_view const& input,
+                               std::vector<size_type> const& indices,
+                               cudaStream_t stream) {
+  CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even");
+
+  if (indices.size() == 0 or input.size() == 0) { return std::vector<column_view>{}; }
+
+  auto const null_counts = make_lazy_null_counts(std::vector<column_view>{input}, indices);
+  return slice(input, indices, null_counts, 0);
 }
 
-std::vector<cudf::table_view> slice(cudf::table_view const& input,
-                                    std::vector<size_type> const& indices) {
-  CUDF_FUNC_RANGE();
+std::vector<table_view> slice(table_view const& input,
+                              std::vector<size_type> const& indices,
+                              cudaStream_t stream) {
   CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even");
-  std::vector<cudf::table_view> result{};
+  std::vector<table_view> result{};
 
   if (indices.size() == 0 or input.num_columns() == 0) { return result; }
 
+  // The null counts of all the sliced columns are counted together, when the
+  // first is needed
+  auto const null_counts = make_lazy_null_counts(input, indices);
+
   // 2d arrangement of column_views that represent the outgoing table_views
   // sliced_table[i][j]
   // where i is the i'th column of the j'th table_view
-  std::vector<std::vector<cudf::column_view>> sliced_table;
-  sliced_table.reserve(indices.size() + 1);
-  std::transform(input.begin(),
-                 input.end(),
-                 std::back_inserter(sliced_table),
-                 [&indices](cudf::column_view const& c) { return slice(c, indices); });
+  std::vector<std::vector<column_view>> sliced_table;
+  sliced_table.reserve(input.num_columns());
+  for (size_type i = 0; i < input.num_columns(); i++) {
+    sliced_table.push_back(slice(input.column(i), indices, null_counts, i));
+  }
 
   // distribute columns into outgoing table_views
   size_t num_output_tables = indices.size() / 2;
   for (size_t i = 0; i < num_output_tables; i++) {
-    std::vector<cudf::column_view> table_columns;
-    for (size_t j = 0; j < input.num_columns(); j++) {
+    std::vector<column_view> table_columns;
+    for (size_type j = 0; j < input.num_columns(); j++) {
       table_columns.emplace_back(sliced_table[j][i]);
     }
     result.emplace_back(table_view{table_columns});
   }
 
   return result;
-};
+}
+
+}  // namespace detail
+
+std::vector<cudf::column_view> slice(cudf::column_view const& input,
+                                     std::vector<size_type> const& indices) {
+  CUDF_FUNC_RANGE();
+  return detail::slice(input, indices, 0);
+}
+
+std::vector<cudf::table_view> slice(cudf::table_view const& input,
+                                    std::vector<size_type> const& indices) {
+  CUDF_FUNC_RANGE();
+  return detail::slice(input, indices, 0);
+}
 
 }  // namespace experimental
 }  // namespace cudf
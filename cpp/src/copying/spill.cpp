@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/spill.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns a view of `col` whose buffers are at the same offsets from
+ * `new_base` as the buffers of `col` are from `old_base`
+ */
+column_view rebase_column(column_view const& col,
+                          uint8_t const* old_base,
+                          uint8_t const* new_base) {
+  auto rebase = [old_base, new_base](void const* ptr) -> void const* {
+    if (ptr == nullptr) { return nullptr; }
+    return new_base + (static_cast<uint8_t const*>(ptr) - old_base);
+  };
+  std::vector<column_view> children;
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    children.push_back(rebase_column(col.child(i), old_base, new_base));
+  }
+  return column_view(col.type(),
+                     col.size(),
+                     rebase(col.head()),
+                     static_cast<bitmask_type const*>(rebase(col.null_mask())),
+                     col.null_count(),
+                     col.offset(),
+                     children);
+}
+
+table_view rebase_table(table_view const& t, uint8_t const* old_base, uint8_t const* new_base) {
+  std::vector<column_view> columns;
+  for (auto const& col : t) { columns.push_back(rebase_column(col, old_base, new_base)); }
+  return table_view(columns);
+}
+
+}  // namespace
+
+spilled_table spill_to_host(table_view const& t, cudaStream_t stream) {
+  auto packed = experimental::contiguous_split(t, {});
+  auto& data  = packed.front().all_data;
+
+  spilled_table spilled;
+  spilled.size = data->size();
+  if (spilled.size != 0) {
+    void* ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, spilled.size));
+    spilled.data.reset(static_cast<uint8_t*>(ptr));
+    CUDA_TRY(cudaMemcpyAsync(ptr, data->data(), spilled.size, cudaMemcpyDeviceToHost, stream));
+    CUDF_STREAM_SYNC(stream);
+  }
+  // Null counts are computed here, while the device data is still available
+  spilled.view = rebase_table(
+    packed.front().table, static_cast<uint8_t const*>(data->data()), spilled.data.get());
+  return spilled;
+}
+
+std::pair<rmm::device_buffer, table_view> restore_to_device(spilled_table const& spilled,
+                                                            cudaStream_t stream) {
+  rmm::device_buffer data(spilled.data.get(), spilled.size, stream);
+  auto const view =
+    rebase_table(spilled.view, spilled.data.get(), static_cast<uint8_t const*>(data.data()));
+  return std::make_pair(std::move(data), view);
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -14,16 +14,27 @@
  * limitations under the License.
  */
 
+#include <datetime/timezone.hpp>
+
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -61,31 +72,75 @@ struct extract_component_operator {
   }
 };
 
-// Round up the date to the last day of the month and return the
-// date only (without the time component)
-struct extract_last_day_of_month {
-  CUDA_DEVICE_CALLABLE auto days_in_month(simt::std::chrono::month mon, bool is_leap_year) const
-    -> uint8_t {
+// Extract several components of each timestamp, converting it to a civil date
+// at most once
+template <typename Timestamp>
+struct extract_components_operator {
+  Timestamp const* timestamps;
+  datetime_component const* components;
+  int16_t* const* outputs;  ///< One output column per component
+  size_type num_components;
+  bool needs_date;  ///< Whether a component of the civil date is extracted
+
+  CUDA_DEVICE_CALLABLE void operator()(size_type row) const {
     using namespace simt::std::chrono;
-    // The expression in switch has to be integral/enumerated type.
-    // The constexpr in case has to match the switch type
-    switch (unsigned{mon}) {
-      case unsigned{January}: return 31;
-      case unsigned{February}: return is_leap_year ? 29 : 28;
-      case unsigned{March}: return 31;
-      case unsigned{April}: return 30;
-      case unsigned{May}: return 31;
-      case unsigned{June}: return 30;
-      case unsigned{July}: return 31;
-      case unsigned{August}: return 31;
-      case unsigned{September}: return 30;
-      case unsigned{October}: return 31;
-      case unsigned{November}: return 30;
-      case unsigned{December}: return 31;
-      default: return 0;
+
+    auto const ts               = timestamps[row];
+    auto const days_since_epoch = floor<days>(ts);
+
+    auto time_since_midnight = ts - days_since_epoch;
+
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    auto const hrs_  = duration_cast<hours>(time_since_midnight);
+    auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+    auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+
+    auto const date = needs_date ? year_month_day(days_since_epoch) : year_month_day{};
+
+    for (size_type i = 0; i < num_components; ++i) {
+      int16_t value = 0;
+      switch (components[i]) {
+        case datetime_component::YEAR: value = static_cast<int>(date.year()); break;
+        case datetime_component::MONTH: value = static_cast<unsigned>(date.month()); break;
+        case datetime_component::DAY: value = static_cast<unsigned>(date.day()); break;
+        case datetime_component::WEEKDAY:
+          value = year_month_weekday(days_since_epoch).weekday().iso_encoding();
+          break;
+        case datetime_component::HOUR: value = hrs_.count(); break;
+        case datetime_component::MINUTE: value = mins_.count(); break;
+        case datetime_component::SECOND: value = secs_.count(); break;
+        default: break;
+      }
+      outputs[i][row] = value;
     }
   }
+};
+
+CUDA_DEVICE_CALLABLE uint8_t days_in_month(simt::std::chrono::month mon, bool is_leap_year) {
+  using namespace simt::std::chrono;
+  // The expression in switch has to be integral/enumerated type.
+  // The constexpr in case has to match the switch type
+  switch (unsigned{mon}) {
+    case unsigned{January}: return 31;
+    case unsigned{February}: return is_leap_year ? 29 : 28;
+    case unsigned{March}: return 31;
+    case unsigned{April}: return 30;
+    case unsigned{May}: return 31;
+    case unsigned{June}: return 30;
+    case unsigned{July}: return 31;
+    case unsigned{August}: return 31;
+    case unsigned{September}: return 30;
+    case unsigned{October}: return 31;
+    case unsigned{November}: return 30;
+    case unsigned{December}: return 31;
+    default: return 0;
+  }
+}
 
+// Round up the date to the last day of the month and return the
+// date only (without the time component)
+struct extract_last_day_of_month {
   template <typename Timestamp>
   CUDA_DEVICE_CALLABLE timestamp_D operator()(Timestamp const ts) const {
     using namespace simt::std::chrono;
@@ -104,13 +159,96 @@ struct extract_last_day_of_month {
   }
 };
 
+// Round the timestamp down, or up when `round_up` and it is not already
+// rounded, to a multiple of `Unit`
+template <typename Unit, typename Timestamp>
+CUDA_DEVICE_CALLABLE Timestamp round_to_unit(Timestamp const ts, bool round_up) {
+  using namespace simt::std::chrono;
+  auto const floored = floor<Unit>(ts);
+  auto const rounded = (round_up and floored < ts) ? floored + Unit{1} : floored;
+  return Timestamp{duration_cast<typename Timestamp::duration>(rounded.time_since_epoch())};
+}
+
+// Round the timestamp down, or up when `round_up` and it is not already
+// rounded, to the first day of a month
+template <typename Timestamp>
+CUDA_DEVICE_CALLABLE Timestamp round_to_month(Timestamp const ts, bool round_up) {
+  using namespace simt::std::chrono;
+  auto const days_since_epoch = floor<days>(ts);
+  auto const date             = year_month_day(days_since_epoch);
+  auto const first_day        = days_since_epoch - days(static_cast<unsigned>(date.day()) - 1);
+  auto const rounded          = (round_up and first_day < ts)
+                         ? first_day + days(days_in_month(date.month(), date.year().is_leap()))
+                         : first_day;
+  return Timestamp{duration_cast<typename Timestamp::duration>(rounded.time_since_epoch())};
+}
+
+// Round timestamps to the start of a month, day, etc.
+struct round_datetime_operator {
+  rounding_frequency frequency;
+  bool round_up;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const {
+    using namespace simt::std::chrono;
+    switch (frequency) {
+      case rounding_frequency::MONTH: return round_to_month(ts, round_up);
+      case rounding_frequency::DAY: return round_to_unit<days>(ts, round_up);
+      case rounding_frequency::HOUR: return round_to_unit<hours>(ts, round_up);
+      case rounding_frequency::MINUTE: return round_to_unit<minutes>(ts, round_up);
+      case rounding_frequency::SECOND: return round_to_unit<seconds>(ts, round_up);
+      default: return ts;
+    }
+  }
+};
+
+template <typename Timestamp>
+CUDA_DEVICE_CALLABLE int64_t seconds_since_epoch(Timestamp const ts) {
+  using namespace simt::std::chrono;
+  return floor<seconds>(ts).time_since_epoch().count();
+}
+
+// Timestamps of days are only moved by offsets of whole days
+template <typename Timestamp>
+CUDA_DEVICE_CALLABLE Timestamp add_seconds(Timestamp const ts, int64_t offset) {
+  using namespace simt::std::chrono;
+  return Timestamp{ts.time_since_epoch() +
+                   duration_cast<typename Timestamp::duration>(seconds{offset})};
+}
+
+// Apply the operator to the local time in `timezone` of each UTC timestamp
+template <typename Operator>
+struct localized_operator {
+  timezone_table_view timezone;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE auto operator()(Timestamp const ts) const {
+    return Operator{}(add_seconds(ts, timezone.utc_offset(seconds_since_epoch(ts))));
+  }
+};
+
+// Convert the local times in `from` to local times in `to`
+struct convert_timezone_operator {
+  timezone_table_view from;
+  timezone_table_view to;
+
+  template <typename Timestamp>
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const {
+    auto const utc =
+      from.is_utc() ? ts : add_seconds(ts, -from.local_offset(seconds_since_epoch(ts)));
+    return to.is_utc() ? utc : add_seconds(utc, to.utc_offset(seconds_since_epoch(utc)));
+  }
+};
+
 // Apply the functor for every element/row in the input column to create the output column
 template <typename TransformFunctor, typename OutputColT>
 struct launch_functor {
   column_view input;
   mutable_column_view output;
+  TransformFunctor functor;
 
-  launch_functor(column_view inp, mutable_column_view out) : input(inp), output(out) {}
+  launch_functor(column_view inp, mutable_column_view out, TransformFunctor f)
+    : input(inp), output(out), functor(f) {}
 
   template <typename Element>
   typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
@@ -125,7 +263,7 @@ struct launch_functor {
                       input.begin<Timestamp>(),
                       input.end<Timestamp>(),
                       output.begin<OutputColT>(),
-                      TransformFunctor{});
+                      functor);
   }
 };
 
@@ -133,7 +271,8 @@ struct launch_functor {
 template <typename TransformFunctor, cudf::type_id OutputColCudfT>
 std::unique_ptr<column> apply_datetime_op(column_view const& column,
                                           cudaStream_t stream,
-                                          rmm::mr::device_memory_resource* mr) {
+                                          rmm::mr::device_memory_resource* mr,
+                                          TransformFunctor functor = {}) {
   auto size            = column.size();
   auto output_col_type = data_type{OutputColCudfT};
   auto null_mask       = copy_bitmask(column, stream, mr);
@@ -147,20 +286,193 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
 
   auto launch = launch_functor<TransformFunctor,
                                typename cudf::experimental::id_to_type_impl<OutputColCudfT>::type>{
-    column, static_cast<mutable_column_view>(*output)};
+    column, static_cast<mutable_column_view>(*output), functor};
 
   experimental::type_dispatcher(column.type(), launch, stream);
 
   return output;
 }
 
+// Extract a component of the local time in `timezone` of every UTC timestamp
+template <datetime_component Component>
+std::unique_ptr<column> extract_local_component(column_view const& column,
+                                                std::string const& timezone,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr) {
+  using localized_extractor = localized_operator<extract_component_operator<Component>>;
+  return apply_datetime_op<localized_extractor, cudf::INT16>(
+    column, stream, mr, localized_extractor{get_timezone_table(timezone, stream)});
+}
+
+struct dispatch_convert_timezone {
+  template <typename Element>
+  std::enable_if_t<!cudf::is_timestamp_t<Element>::value, std::unique_ptr<column>> operator()(
+    column_view const&, convert_timezone_operator, cudaStream_t, rmm::mr::device_memory_resource*) {
+    CUDF_FAIL("Cannot convert the time zone of a non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, std::unique_ptr<column>> operator()(
+    column_view const& timestamps,
+    convert_timezone_operator op,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr) {
+    auto output = make_fixed_width_column(timestamps.type(),
+                                          timestamps.size(),
+                                          copy_bitmask(timestamps, stream, mr),
+                                          timestamps.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      timestamps.begin<Timestamp>(),
+                      timestamps.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      op);
+    return output;
+  }
+};
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr) {
+  convert_timezone_operator op{get_timezone_table(from_timezone, stream),
+                               get_timezone_table(to_timezone, stream)};
+  return experimental::type_dispatcher(
+    timestamps.type(), dispatch_convert_timezone{}, timestamps, op, stream, mr);
+}
+
+struct dispatch_extract_components {
+  template <typename Element>
+  std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&,
+    rmm::device_vector<datetime_component> const&,
+    rmm::device_vector<int16_t*> const&,
+    bool,
+    cudaStream_t) {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& column,
+    rmm::device_vector<datetime_component> const& components,
+    rmm::device_vector<int16_t*> const& outputs,
+    bool needs_date,
+    cudaStream_t stream) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       column.size(),
+                       extract_components_operator<Timestamp>{
+                         column.data<Timestamp>(),
+                         components.data().get(),
+                         outputs.data().get(),
+                         static_cast<size_type>(components.size()),
+                         needs_date});
+  }
+};
+
+std::unique_ptr<experimental::table> extract_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_EXPECTS(is_timestamp(column.type()),
+               "Cannot extract datetime component from non-timestamp column.");
+  CUDF_EXPECTS(std::none_of(components.begin(),
+                            components.end(),
+                            [](auto c) { return c == datetime_component::INVALID; }),
+               "Invalid datetime component.");
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<int16_t*> outputs;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    columns.push_back(make_fixed_width_column(data_type{INT16},
+                                              column.size(),
+                                              copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    outputs.push_back(columns.back()->mutable_view().data<int16_t>());
+  }
+  if (column.size() > 0 and not components.empty()) {
+    bool const needs_date = std::any_of(components.begin(), components.end(), [](auto c) {
+      return c == datetime_component::YEAR or c == datetime_component::MONTH or
+             c == datetime_component::DAY;
+    });
+    rmm::device_vector<datetime_component> d_components(components);
+    rmm::device_vector<int16_t*> d_outputs(outputs);
+    experimental::type_dispatcher(column.type(),
+                                  dispatch_extract_components{},
+                                  column,
+                                  d_components,
+                                  d_outputs,
+                                  needs_date,
+                                  stream);
+  }
+  return std::make_unique<experimental::table>(std::move(columns));
+}
+
+struct dispatch_round_datetimes {
+  template <typename Element>
+  std::enable_if_t<!cudf::is_timestamp_t<Element>::value, std::unique_ptr<column>> operator()(
+    column_view const&, round_datetime_operator, cudaStream_t, rmm::mr::device_memory_resource*) {
+    CUDF_FAIL("Cannot round a non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, std::unique_ptr<column>> operator()(
+    column_view const& column,
+    round_datetime_operator op,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr) {
+    auto output = make_fixed_width_column(column.type(),
+                                          column.size(),
+                                          copy_bitmask(column, stream, mr),
+                                          column.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      column.begin<Timestamp>(),
+                      column.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      op);
+    return output;
+  }
+};
+
+std::unique_ptr<column> floor_datetimes(column_view const& column,
+                                        rounding_frequency frequency,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource* mr) {
+  return experimental::type_dispatcher(column.type(),
+                                       dispatch_round_datetimes{},
+                                       column,
+                                       round_datetime_operator{frequency, false},
+                                       stream,
+                                       mr);
+}
+
+std::unique_ptr<column> ceil_datetimes(column_view const& column,
+                                       rounding_frequency frequency,
+                                       cudaStream_t stream,
+                                       rmm::mr::device_memory_resource* mr) {
+  return experimental::type_dispatcher(column.type(),
+                                       dispatch_round_datetimes{},
+                                       column,
+                                       round_datetime_operator{frequency, true},
+                                       stream,
+                                       mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -169,7 +481,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
   CUDF_FUNC_RANGE();
 
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -177,7 +489,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -185,7 +497,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -193,7 +505,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -201,7 +513,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::INT16>(column, 0, mr);
 }
 
@@ -209,10 +521,32 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::INT16>(column, 0, mr);
 }
 
+std::unique_ptr<experimental::table> extract_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_components(column, components, 0, mr);
+}
+
+std::unique_ptr<column> floor_datetimes(column_view const& column,
+                                        rounding_frequency frequency,
+                                        rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::floor_datetimes(column, frequency, 0, mr);
+}
+
+std::unique_ptr<column> ceil_datetimes(column_view const& column,
+                                       rounding_frequency frequency,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::ceil_datetimes(column, frequency, 0, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
@@ -220,5 +554,69 @@ std::unique_ptr<column> last_day_of_month(column_view const& column,
     column, 0, mr);
 }
 
+std::unique_ptr<column> extract_year(column_view const& column,
+                                     std::string const& timezone,
+                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::YEAR>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_month(column_view const& column,
+                                      std::string const& timezone,
+                                      rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::MONTH>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_day(column_view const& column,
+                                    std::string const& timezone,
+                                    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::DAY>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_weekday(column_view const& column,
+                                        std::string const& timezone,
+                                        rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::WEEKDAY>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_hour(column_view const& column,
+                                     std::string const& timezone,
+                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::HOUR>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_minute(column_view const& column,
+                                       std::string const& timezone,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::MINUTE>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> extract_second(column_view const& column,
+                                       std::string const& timezone,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::extract_local_component<datetime_component::SECOND>(
+    column, timezone, 0, mr);
+}
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(timestamps, from_timezone, to_timezone, 0, mr);
+}
+
 }  // namespace datetime
 }  // namespace cudf
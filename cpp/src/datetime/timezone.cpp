@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <datetime/timezone.hpp>
+#include <io/orc/timezone.h>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+
+namespace {
+
+// The ORC table ends with 2 transitions per year for 400 years
+constexpr size_type cycle_entries = 800;
+
+/**
+ * @brief The tables of each device and zone
+ *
+ * The tables are allocated with `cudaMalloc` rather than from the default
+ * memory resource, which may be replaced or destroyed before the process
+ * exits. The cache is never destroyed: its device memory is released with the
+ * CUDA context.
+ */
+struct timezone_cache {
+  std::mutex mutex;
+  std::map<std::pair<int, std::string>, timezone_table_view> tables;
+};
+
+timezone_cache& get_cache() {
+  static auto* cache = new timezone_cache;
+  return *cache;
+}
+
+timezone_table_view build_table(std::string const& timezone, cudaStream_t stream) {
+  // 1 offset, then (UTC time, offset) of each transition
+  std::vector<int64_t> orc_table;
+  CUDF_EXPECTS(io::BuildTimezoneTransitionTable(orc_table, timezone), "Unknown time zone");
+  size_type const num_entries = orc_table.size() / 2;
+  timezone_table_view view{};
+  if (num_entries == 0) { return view; }
+  view.num_cycle = num_entries > cycle_entries ? cycle_entries : 0;
+  view.num_fixed = num_entries - view.num_cycle;
+
+  std::vector<int64_t> host_table(3 * num_entries);
+  auto utc_times   = host_table.data();
+  auto local_times = utc_times + num_entries;
+  auto offsets     = local_times + num_entries;
+  for (size_type i = 0; i < num_entries; ++i) {
+    utc_times[i] = orc_table[2 * i + 1];
+    offsets[i]   = orc_table[2 * i + 2];
+  }
+  // The larger of the offsets around a transition is used until the local
+  // time reaches it; the first cycle transition follows the last one
+  for (size_type i = 0; i < num_entries; ++i) {
+    auto const previous = i == 0 ? offsets[0]
+                                 : i == view.num_fixed ? offsets[num_entries - 1] : offsets[i - 1];
+    local_times[i] = utc_times[i] + std::max(previous, offsets[i]);
+  }
+
+  int64_t* device_table = nullptr;
+  auto const bytes      = host_table.size() * sizeof(int64_t);
+  CUDA_TRY(cudaMalloc(&device_table, bytes));
+  CUDA_TRY(cudaMemcpyAsync(device_table, host_table.data(), bytes, cudaMemcpyHostToDevice, stream));
+  CUDF_STREAM_SYNC(stream);
+  view.utc_times   = device_table;
+  view.local_times = device_table + num_entries;
+  view.offsets     = device_table + 2 * num_entries;
+  return view;
+}
+
+}  // namespace
+
+timezone_table_view get_timezone_table(std::string const& timezone, cudaStream_t stream) {
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  auto& cache = get_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto const key = std::make_pair(device, timezone);
+  auto it        = cache.tables.find(key);
+  if (it == cache.tables.end()) {
+    it = cache.tables.emplace(key, build_table(timezone, stream)).first;
+  }
+  return it->second;
+}
+
+}  // namespace detail
+}  // namespace datetime
+}  // namespace cudf
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cuda_runtime.h>
+
+#include <string>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+
+/**
+ * @brief Device view of the transitions of a time zone between offsets from
+ * UTC
+ *
+ * Entry `i` is the offset, in seconds, added to UTC to get the local time from
+ * `utc_times[i]` on. The first `num_fixed` entries are the transitions of the
+ * zone database; the `num_cycle` entries after them repeat every 400 years
+ * from 1970 and apply after the last of the fixed transitions. A zone without
+ * entries is UTC.
+ */
+struct timezone_table_view {
+  int64_t const* utc_times   = nullptr;  ///< UTC seconds of each transition
+  int64_t const* local_times = nullptr;  ///< Local seconds from which each offset is used to
+                                         ///< convert local times to UTC
+  int64_t const* offsets     = nullptr;  ///< Offset from UTC after each transition
+  size_type num_fixed        = 0;
+  size_type num_cycle        = 0;
+
+  CUDA_HOST_DEVICE_CALLABLE bool is_utc() const { return num_fixed == 0; }
+
+  /**
+   * @brief Returns the offset to add to the UTC time `utc_seconds` to get the
+   * local time
+   */
+  CUDA_DEVICE_CALLABLE int64_t utc_offset(int64_t utc_seconds) const {
+    return find_offset(utc_times, utc_seconds);
+  }
+
+  /**
+   * @brief Returns the offset to subtract from the local time `local_seconds`
+   * to get the UTC time
+   *
+   * A local time skipped by a forward transition uses the offset before it,
+   * i.e. it is moved forward by the length of the gap; a local time repeated
+   * by a backward transition converts to the earlier of its two UTC times.
+   */
+  CUDA_DEVICE_CALLABLE int64_t local_offset(int64_t local_seconds) const {
+    return find_offset(local_times, local_seconds);
+  }
+
+ private:
+  CUDA_DEVICE_CALLABLE int64_t find_offset(int64_t const* times, int64_t ts) const {
+    if (is_utc()) { return 0; }
+    if (ts <= times[0]) { return offsets[0]; }
+    size_type first = 0;
+    size_type last  = num_fixed - 1;
+    if (ts > times[last] and num_cycle > 0) {
+      constexpr int64_t seconds_per_400_years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+      ts %= seconds_per_400_years;
+      if (ts < 0) { ts += seconds_per_400_years; }
+      first = num_fixed;
+      last  = num_fixed + num_cycle - 1;
+      if (ts < times[first]) { return offsets[last]; }
+    }
+    // Find the last transition at or before `ts`
+    while (first < last) {
+      size_type const mid = first + (last - first + 1) / 2;
+      if (times[mid] <= ts) {
+        first = mid;
+      } else {
+        last = mid - 1;
+      }
+    }
+    return offsets[first];
+  }
+};
+
+/**
+ * @brief Returns the transition table of a time zone on the current device
+ *
+ * The table is read from the zone database in `/usr/share/zoneinfo` and
+ * copied to the device on the first call for a zone and device; later calls
+ * return the cached table, which lives until the process exits.
+ *
+ * @throw cudf::logic_error if the time zone is not in the zone database
+ *
+ * @param timezone Name of the zone, e.g. "America/New_York"; "UTC" and the
+ * empty name are UTC
+ * @param stream Stream on which to copy a new table to the device
+ */
+timezone_table_view get_timezone_table(std::string const& timezone, cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace datetime
+}  // namespace cudf
@@ -15,65 +15,149 @@
  */
 
 #include <cudf/column/column.hpp>
-#include <cudf/copying.hpp>
-#include <cudf/detail/search.hpp>
-#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
-#include <cudf/stream_compaction.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <limits>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns the first row of each row's value, computed by inserting the
+ * rows into a hash map keyed on their values.
+ *
+ * Null rows are not inserted and their first row is `input.size()`.
+ */
+rmm::device_vector<size_type> compute_first_rows(column_view const& input, cudaStream_t stream) {
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+  using hasher_type   = experimental::row_hasher<default_hash>;
+  using equality_type = experimental::row_equality_comparator<true>;
+  using map_type      = concurrent_unordered_map<size_type, size_type, hasher_type, equality_type>;
+  if (input.size() == 0) return rmm::device_vector<size_type>{};
+
+  auto d_table  = table_device_view::create(table_view{{input}}, stream);
+  auto d_column = d_table->column(0);
+  auto map      = map_type::create(compute_hash_table_size(input.size()),
+                                   unused_value,
+                                   unused_key,
+                                   hasher_type{*d_table},
+                                   equality_type{*d_table, *d_table},
+                                   typename map_type::allocator_type(),
+                                   stream);
+  auto d_map    = *map;
+
+  auto execpol = rmm::exec_policy(stream);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     [d_map, d_column] __device__(size_type idx) mutable {
+                       if (d_column.is_valid(idx)) d_map.insert(thrust::make_pair(idx, idx));
+                     });
+  rmm::device_vector<size_type> first_rows(input.size());
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    first_rows.begin(),
+                    [d_map, d_column] __device__(size_type idx) {
+                      return d_column.is_valid(idx) ? d_map.find(idx)->second
+                                                    : d_column.size();
+                    });
+  return first_rows;
+}
+
+}  // namespace
 
 /**
  * @brief Create a new dictionary column from a column_view.
  *
+ * The distinct values are found in linear time with a hash map, and only
+ * those values are sorted to build the keys.
  */
 std::unique_ptr<column> encode(column_view const& input_column,
                                data_type indices_type,
                                rmm::mr::device_memory_resource* mr,
                                cudaStream_t stream) {
   CUDF_EXPECTS(indices_type.id() == INT32, "only INT32 type for indices");
+  auto const rows_count = input_column.size();
+
+  // the rows that are the first of their value hold the distinct values
+  auto first_rows = compute_first_rows(input_column, stream);
+  auto execpol    = rmm::exec_policy(stream);
+  rmm::device_vector<size_type> distinct_rows(rows_count);
+  auto d_first_rows = first_rows.data().get();
+  auto distinct_end = thrust::copy_if(execpol->on(stream),
+                                      thrust::make_counting_iterator<size_type>(0),
+                                      thrust::make_counting_iterator<size_type>(rows_count),
+                                      distinct_rows.begin(),
+                                      [d_first_rows] __device__(size_type idx) {
+                                        return d_first_rows[idx] == idx;
+                                      });
+  auto const keys_count =
+    static_cast<size_type>(thrust::distance(distinct_rows.begin(), distinct_end));
 
-  // side effects of this function were are now dependent on:
-  // - resulting column elements are sorted ascending
-  // - nulls are sorted to the beginning
-  auto table_keys =
-    experimental::detail::drop_duplicates(table_view{{input_column}},
-                                          std::vector<size_type>{0},
-                                          experimental::duplicate_keep_option::KEEP_FIRST,
-                                          true,
-                                          mr,
-                                          stream)
-      ->release();  // true == nulls are equal
+  // sort only the distinct values
+  column_view distinct_map(data_type{INT32}, keys_count, distinct_rows.data().get());
+  auto distinct_keys = experimental::detail::gather(table_view{{input_column}},
+                                                    distinct_map,
+                                                    false,
+                                                    false,
+                                                    false,
+                                                    rmm::mr::get_default_resource(),
+                                                    stream);
+  auto sorted_map      = experimental::detail::sorted_order(distinct_keys->view(),
+                                                      std::vector<order>{order::ASCENDING},
+                                                      std::vector<null_order>{},
+                                                      rmm::mr::get_default_resource(),
+                                                      stream);
+  auto d_sorted_map    = sorted_map->view().data<size_type>();
+  auto d_distinct_rows = distinct_rows.data().get();
+  auto table_keys      = experimental::detail::gather(
+                      distinct_keys->view(), sorted_map->view(), false, false, false, mr, stream)
+                      ->release();
   std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+  keys_column->set_null_mask(rmm::device_buffer{}, 0);  // the keys have no nulls
 
-  if (input_column.has_nulls()) {
-    // the single null entry should be at the beginning -- side effect from drop_duplicates
-    // copy the column without the null entry
-    keys_column = std::make_unique<column>(
-      experimental::slice(keys_column->view(), std::vector<size_type>{1, keys_column->size()})
-        .front(),
-      stream,
-      mr);
-    keys_column->set_null_mask(rmm::device_buffer{}, 0);  // remove the null-mask
-  }
-
-  // this returns a column with no null entries
-  // - it appears to ignore the null entries in the input and tries to place the value regardless
+  // the index of a row is the position of its first row in the sorted keys,
+  // and the index of a null row is the number of keys
+  rmm::device_vector<size_type> key_positions(rows_count);
+  auto d_key_positions = key_positions.data().get();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     keys_count,
+                     [d_sorted_map, d_distinct_rows, d_key_positions] __device__(size_type idx) {
+                       d_key_positions[d_distinct_rows[d_sorted_map[idx]]] = idx;
+                     });
   auto indices_column =
-    cudf::experimental::detail::lower_bound(table_view{{keys_column->view()}},
-                                            table_view{{input_column}},
-                                            std::vector<order>{order::ASCENDING},
-                                            std::vector<null_order>{null_order::AFTER},
-                                            mr,
-                                            stream);
-  // we should probably copy/cast to INT32 type if different
-  CUDF_EXPECTS(indices_column->type() == indices_type, "expecting INT32 indices type");
+    make_numeric_column(indices_type, rows_count, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(execpol->on(stream),
+                    first_rows.begin(),
+                    first_rows.end(),
+                    indices_column->mutable_view().data<int32_t>(),
+                    [d_key_positions, rows_count, keys_count] __device__(size_type first_row) {
+                      return first_row < rows_count ? d_key_positions[first_row] : keys_count;
+                    });
 
   // create column with keys_column and indices_column
   return make_dictionary_column(std::move(keys_column),
@@ -21,10 +21,12 @@
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/binary_search.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace dictionary {
@@ -128,6 +130,63 @@ std::unique_ptr<column> set_keys(
                                 std::move(new_nulls.first),
                                 new_nulls.second);
 }
+
+std::unique_ptr<column> keys_ordinals(dictionary_column_view const& dictionary_column,
+                                      column_view const& keys,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream) {
+  auto old_keys = dictionary_column.keys();
+  CUDF_EXPECTS(old_keys.type() == keys.type(), "keys types must match");
+
+  // compute the ordinal of each key of the dictionary, which has few rows
+  std::vector<order> const column_order{order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::BEFORE};
+  auto lower = experimental::detail::lower_bound(table_view{{keys}},
+                                                 table_view{{old_keys}},
+                                                 column_order,
+                                                 null_precedence,
+                                                 rmm::mr::get_default_resource(),
+                                                 stream);
+  auto upper = experimental::detail::upper_bound(table_view{{keys}},
+                                                 table_view{{old_keys}},
+                                                 column_order,
+                                                 null_precedence,
+                                                 rmm::mr::get_default_resource(),
+                                                 stream);
+  auto d_lower = lower->view().data<size_type>();
+  auto d_upper = upper->view().data<size_type>();
+  rmm::device_vector<int32_t> key_ordinals(old_keys.size());
+  auto execpol = rmm::exec_policy(stream);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(old_keys.size()),
+                    key_ordinals.begin(),
+                    [d_lower, d_upper] __device__(size_type idx) {
+                      return 2 * d_lower[idx] + (d_upper[idx] > d_lower[idx]);
+                    });
+
+  // gather the ordinals of the keys of the rows
+  auto result = make_numeric_column(data_type{INT32},
+                                    dictionary_column.size(),
+                                    copy_bitmask(dictionary_column.parent(), stream, mr),
+                                    dictionary_column.null_count(),
+                                    stream,
+                                    mr);
+  auto d_key_ordinals = key_ordinals.data().get();
+  auto indices_column = dictionary_column.get_indices_annotated();
+  auto indices_view   = column_device_view::create(indices_column, stream);
+  auto d_indices      = *indices_view;
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(dictionary_column.size()),
+                    result->mutable_view().data<int32_t>(),
+                    [d_key_ordinals, d_indices] __device__(size_type idx) {
+                      if (d_indices.is_null(idx)) return 0;
+                      return d_key_ordinals[d_indices.element<int32_t>(idx)];
+                    });
+  return result;
+}
+
 }  // namespace detail
 
 // external API
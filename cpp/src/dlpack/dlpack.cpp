@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/dlpack.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -101,28 +102,16 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
-
-namespace detail {
-
-std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                                 rmm::mr::device_memory_resource* mr,
-                                                 cudaStream_t stream) {
-  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
-  auto const& tensor = managed_tensor->dl_tensor;
-
-  // We can copy from host or device pointers
-  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
-                 kDLCPUPinned == tensor.ctx.device_type,
-               "DLTensor must be GPU, CPU, or pinned type");
-
-  // Make sure the current device ID matches the Tensor's device ID
-  if (tensor.ctx.device_type != kDLCPU) {
-    int device_id = 0;
-    CUDA_TRY(cudaGetDevice(&device_id));
-    CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
-  }
+// Layout of the columns in a validated DLTensor
+struct tensor_layout {
+  data_type dtype;
+  size_t num_rows;
+  size_t num_columns;
+  size_t col_stride;  // bytes between the start of each column
+  uintptr_t data;     // address of the first element
+};
 
+tensor_layout get_tensor_layout(DLTensor const& tensor) {
   // Currently only 1D and 2D tensors are supported
   CUDF_EXPECTS(tensor.ndim > 0 && tensor.ndim <= 2, "DLTensor must be 1D or 2D");
 
@@ -137,14 +126,12 @@ std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_
                  "DLTensor second dim exceeds size supported by cudf");
   }
 
-  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
-
   // Validate and convert data type to cudf
   data_type const dtype = DLDataType_to_data_type(tensor.dtype);
 
-  size_t const byte_width = size_of(dtype);
-  size_t const num_rows   = static_cast<size_t>(tensor.shape[0]);
-  size_t const bytes      = num_rows * byte_width;
+  size_t const byte_width  = size_of(dtype);
+  size_t const num_rows    = static_cast<size_t>(tensor.shape[0]);
+  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
 
   // For 2D tensors, if the strides pointer is not null, then strides[1] is the
   // number of elements (not bytes) between the start of each column
@@ -152,12 +139,45 @@ std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_
                               ? byte_width * tensor.strides[1]
                               : byte_width * num_rows;
 
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+  auto const data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+  return tensor_layout{dtype, num_rows, num_columns, col_stride, data};
+}
+
+void check_tensor_device(DLTensor const& tensor) {
+  if (tensor.ctx.device_type != kDLCPU) {
+    int device_id = 0;
+    CUDA_TRY(cudaGetDevice(&device_id));
+    CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
+  }
+}
+
+}  // namespace
+
+namespace detail {
+
+std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream) {
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // We can copy from host or device pointers
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
+                 kDLCPUPinned == tensor.ctx.device_type,
+               "DLTensor must be GPU, CPU, or pinned type");
+
+  // Make sure the current device ID matches the Tensor's device ID
+  check_tensor_device(tensor);
+
+  auto const layout  = get_tensor_layout(tensor);
+  size_t const bytes = layout.num_rows * size_of(layout.dtype);
+  auto tensor_data   = layout.data;
+
+  std::vector<std::unique_ptr<column>> columns(layout.num_columns);
 
   // Allocate columns and copy data from tensor
-  std::vector<std::unique_ptr<column>> columns(num_columns);
   for (auto& col : columns) {
-    col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
+    col = make_numeric_column(layout.dtype, layout.num_rows, mask_state::UNALLOCATED, stream, mr);
 
     CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
                              reinterpret_cast<void*>(tensor_data),
@@ -165,12 +185,42 @@ std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_
                              cudaMemcpyDefault,
                              stream));
 
-    tensor_data += col_stride;
+    tensor_data += layout.col_stride;
   }
 
   return std::make_unique<experimental::table>(std::move(columns));
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor) {
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // The columns point into the tensor memory, so it must be device memory
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type, "DLTensor must be GPU type");
+  check_tensor_device(tensor);
+
+  // Each column must be a dense, aligned run of elements
+  if (nullptr != tensor.strides) {
+    CUDF_EXPECTS(tensor.strides[0] == 1, "DLTensor must be column-major with unit row stride");
+  }
+  auto const layout       = get_tensor_layout(tensor);
+  size_t const byte_width = size_of(layout.dtype);
+  CUDF_EXPECTS(layout.data % byte_width == 0, "DLTensor data must be aligned to its element size");
+
+  std::vector<column_view> columns;
+  columns.reserve(layout.num_columns);
+  auto tensor_data = layout.data;
+  for (size_t i = 0; i < layout.num_columns; ++i) {
+    columns.emplace_back(layout.dtype,
+                         static_cast<size_type>(layout.num_rows),
+                         reinterpret_cast<void const*>(tensor_data),
+                         nullptr,
+                         0);
+    tensor_data += layout.col_stride;
+  }
+  return table_view(columns);
+}
+
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr,
                            cudaStream_t stream) {
@@ -242,6 +292,45 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input) {
+  CUDF_EXPECTS(nullptr != input, "input column is null");
+  auto const num_rows = input->size();
+  if (num_rows == 0) { return nullptr; }
+
+  // Ensure that type is convertible to DLDataType
+  DLDataType const dltype = data_type_to_DLDataType(input->type());
+
+  // A shared column owns no buffer to hand over, so its data is copied
+  if (input->is_shared()) { input = std::make_unique<column>(*input); }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = num_rows;
+
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+
+  // An owning column always starts at offset 0 of its data buffer, so the
+  // buffer can be handed to the tensor as is. The null mask is freed here.
+  auto contents   = input->release();
+  context->buffer = std::move(*contents.data);
+  tensor.data     = context->buffer.data();
+
+  // Defer ownership of managed tensor to caller
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+DLManagedTensor* mask_to_dlpack(column_view const& input, rmm::mr::device_memory_resource* mr) {
+  return to_dlpack(experimental::is_valid(input, mr));
+}
+
 }  // namespace detail
 
 std::unique_ptr<experimental::table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -253,4 +342,16 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, mr);
 }
 
+table_view from_dlpack_view(DLManagedTensor const* managed_tensor) {
+  return detail::from_dlpack_view(managed_tensor);
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input) {
+  return detail::to_dlpack(std::move(input));
+}
+
+DLManagedTensor* mask_to_dlpack(column_view const& input, rmm::mr::device_memory_resource* mr) {
+  return detail::mask_to_dlpack(input, mr);
+}
+
 }  // namespace cudf
@@ -115,6 +115,24 @@ struct out_of_place_fill_range_dispatch {
              cudaStream_t stream                 = 0) {
     CUDF_FAIL("dictionary not supported yet");
   }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<cudf::list_view, T>::value, std::unique_ptr<cudf::column>>
+  operator()(cudf::size_type begin,
+             cudf::size_type end,
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+             cudaStream_t stream                 = 0) {
+    CUDF_FAIL("list not supported yet");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same<cudf::struct_view, T>::value, std::unique_ptr<cudf::column>>
+  operator()(cudf::size_type begin,
+             cudf::size_type end,
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+             cudaStream_t stream                 = 0) {
+    CUDF_FAIL("struct not supported yet");
+  }
 };
 
 }  // namespace
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <groupby/hash/shared_memory_aggs.cuh>
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
@@ -23,7 +25,11 @@
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/memory_budget.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/structs/detail/utilities.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -50,6 +56,71 @@ groupby::groupby(table_view const& keys,
     _column_order{column_order},
     _null_precedence{null_precedence} {}
 
+namespace {
+/**
+ * @brief Returns the number of bytes of device memory used by a hash groupby
+ * besides its results: the hash map and one sparse result column per
+ * aggregation, with room for 8-byte values
+ */
+size_t hash_groupby_working_set(table_view const& keys,
+                                std::vector<aggregation_request> const& requests) {
+  size_t const num_rows = keys.num_rows();
+  // The hash map has about two slots of a key and a value index per row
+  size_t working_set = 2 * num_rows * 2 * sizeof(size_type);
+  for (auto const& request : requests) {
+    working_set += request.aggregations.size() * num_rows * sizeof(int64_t);
+  }
+  return working_set;
+}
+
+// Inputs with fewer rows are grouped by the static rule, as checking their
+// order or estimating their groups would cost about as much as the groupby
+constexpr size_type GROUPBY_PLAN_MIN_ROWS = 1 << 16;
+// Precision of the estimate of the number of groups, see `approx_distinct_count`
+constexpr int GROUPBY_PLAN_PRECISION = 12;
+
+/**
+ * @brief Returns whether the planner may check if `keys` are already sorted in
+ * `column_order`
+ *
+ * The sort groupby of presorted keys expects the rows of null keys to be last
+ * when they are not grouped, which an order check cannot ensure.
+ */
+bool can_detect_sorted_keys(table_view const& keys,
+                            include_nulls include_null_keys,
+                            std::vector<order> const& column_order,
+                            std::vector<null_order> const& null_precedence) {
+  auto const matches_keys = [&keys](auto const& v) {
+    return v.empty() or v.size() == static_cast<size_t>(keys.num_columns());
+  };
+  return keys.num_rows() >= GROUPBY_PLAN_MIN_ROWS and matches_keys(column_order) and
+         matches_keys(null_precedence) and not cudf::structs::detail::has_nested_columns(keys) and
+         (include_null_keys == include_nulls::YES or not has_nulls(keys));
+}
+
+/**
+ * @brief Plans a hash groupby of `keys` from an estimate of their number of
+ * groups
+ *
+ * Each block of the shared memory pre-aggregation falls back to the global
+ * hash map once it sees more distinct keys than its slots can hold, so it is
+ * only used when the estimate fits in the slots of a block.
+ */
+detail::hash::hash_groupby_plan plan_hash_groupby(table_view const& keys, cudaStream_t stream) {
+  detail::hash::hash_groupby_plan plan{};
+  if (keys.num_rows() < GROUPBY_PLAN_MIN_ROWS or
+      cudf::structs::detail::has_nested_columns(keys)) {
+    return plan;
+  }
+  plan.estimated_num_groups =
+    experimental::detail::approx_distinct_count(keys, GROUPBY_PLAN_PRECISION, stream);
+  plan.use_shared_memory =
+    plan.estimated_num_groups <=
+    detail::hash::SHARED_MEMORY_AGGS_SLOTS - detail::hash::SHARED_MEMORY_AGGS_BLOCK_SIZE;
+  return plan;
+}
+}  // namespace
+
 // Select hash vs. sort groupby implementation
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::dispatch_aggregation(
   std::vector<aggregation_request> const& requests,
@@ -59,11 +130,23 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // always use sort groupby from now on. Because once keys are sorted,
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
-  // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
-  if (_keys_are_sorted == sorted::NO and not _helper and
-      detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+  if (_keys_are_sorted == sorted::YES or _helper) { return sort_aggregate(requests, stream, mr); }
+
+  // Keys that are already sorted are grouped without sorting or hashing them,
+  // and are known to be sorted by later calls on this groupby object
+  if (can_detect_sorted_keys(_keys, _include_null_keys, _column_order, _null_precedence) and
+      cudf::experimental::is_sorted(_keys, _column_order, _null_precedence)) {
+    _keys_are_sorted = sorted::YES;
+    return sort_aggregate(requests, stream, mr);
+  }
+
+  // Only use hash groupby if all requests can be satisfied with a hash
+  // implementation. The sort groupby has no sparse results, so it is used when
+  // the hash groupby does not fit in the memory budget.
+  if (detail::hash::can_use_hash_groupby(_keys, requests) and
+      cudf::detail::fits_memory_budget(hash_groupby_working_set(_keys, requests))) {
+    return detail::hash::groupby(
+      _keys, requests, _include_null_keys, plan_hash_groupby(_keys, stream), stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -115,7 +198,9 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests) {
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr) {
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(
     std::all_of(requests.begin(),
@@ -127,7 +212,7 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
 
-  return dispatch_aggregation(requests, 0, mr);
+  return dispatch_aggregation(requests, stream, mr);
 }
 
 groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr) {
@@ -140,7 +225,10 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 
   std::unique_ptr<table> grouped_values{nullptr};
   if (values.num_columns()) {
-    grouped_values = cudf::experimental::detail::gather(values, helper().key_sort_order());
+    grouped_values = helper().is_presorted()
+                       ? std::make_unique<table>(values, 0, mr)
+                       : cudf::experimental::detail::gather(
+                           values, helper().key_sort_order(), false, false, false, mr);
     return groupby::groups{
       std::move(grouped_keys), std::move(group_offsets_vector), std::move(grouped_values)};
   } else {
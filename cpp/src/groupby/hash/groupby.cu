@@ -16,6 +16,7 @@
 
 #include <groupby/common/utils.hpp>
 #include <groupby/hash/groupby_kernels.cuh>
+#include <groupby/hash/shared_memory_aggs.cuh>
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -24,14 +25,20 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/scratch_arena.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/structs/detail/utilities.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
@@ -40,7 +47,16 @@
 #include <cudf/utilities/traits.hpp>
 #include <hash/concurrent_unordered_map.cuh>
 
+#include <rmm/device_scalar.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
 #include <memory>
+#include <set>
 #include <utility>
 
 namespace cudf {
@@ -87,6 +103,42 @@ bool constexpr is_hash_aggregation(aggregation::Kind t) {
          (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
 }
 
+/**
+ * @brief Indicates whether the specified aggregation operation can be computed
+ * with a hash-based implementation when the values are numeric.
+ *
+ * MEAN, VARIANCE and STD are computed from the SUM and COUNT_VALID single pass
+ * aggregations, VARIANCE (and therefore STD) with one more pass over the
+ * values.
+ *
+ * @param t The aggregation operation to verify
+ * @return true `t` is valid for a hash based groupby of numeric values
+ * @return false `t` is invalid for a hash based groupby of numeric values
+ */
+bool constexpr is_numeric_hash_aggregation(aggregation::Kind t) {
+  return (t == aggregation::SUM_OF_SQUARES) or (t == aggregation::MEAN) or
+         (t == aggregation::VARIANCE) or (t == aggregation::STD);
+}
+
+/**
+ * @brief Indicates whether the specified aggregation operation can be computed
+ * with a hash-based implementation from the group of each row.
+ *
+ * NUNIQUE inserts the (group, value) pairs of the rows into a second hash set,
+ * so its values must be fixed-width or strings; COLLECT orders the rows by
+ * their group and gathers the values of any type.
+ *
+ * @param t The aggregation operation to verify
+ * @param values The type of the values to aggregate
+ * @return true `t` is valid for a hash based groupby of `values`
+ * @return false `t` is invalid for a hash based groupby of `values`
+ */
+bool is_group_index_hash_aggregation(aggregation::Kind t, data_type values) {
+  return (t == aggregation::NUNIQUE and
+          (is_fixed_width(values) or values.id() == type_id::STRING)) or
+         (t == aggregation::COLLECT);
+}
+
 // flatten aggs to filter in single pass aggs
 std::tuple<table_view, std::vector<aggregation::Kind>, std::vector<size_t>>
 flatten_single_pass_aggs(std::vector<aggregation_request> const& requests) {
@@ -98,7 +150,12 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests) {
     auto const& request = requests[i];
     auto const& agg_v   = request.aggregations;
 
-    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, i](aggregation::Kind k) {
+    // Compound aggregations may share their single pass aggregations
+    std::set<aggregation::Kind> request_kinds;
+
+    auto insert_agg = [&agg_kinds, &columns, &col_ids, &request, &request_kinds, i](
+                        aggregation::Kind k) {
+      if (not request_kinds.insert(k).second) { return; }
       agg_kinds.push_back(k);
       columns.push_back(request.values);
       col_ids.push_back(i);
@@ -119,6 +176,13 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests) {
             insert_agg(aggregation::ARGMAX);
           }
         }
+      } else if (is_numeric_hash_aggregation(agg->kind) and is_numeric(request.values.type())) {
+        if (agg->kind == aggregation::SUM_OF_SQUARES) {
+          insert_agg(aggregation::SUM_OF_SQUARES);
+        } else {
+          insert_agg(aggregation::SUM);
+          insert_agg(aggregation::COUNT_VALID);
+        }
       }
     }
   }
@@ -187,30 +251,95 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
   }
 }
 
+/**
+ * @brief Hashes a row of the keys, or reads its hash when the hashes of the
+ * rows were computed beforehand
+ */
+template <bool keys_have_nulls>
+struct cached_row_hasher {
+  row_hasher<default_hash, keys_have_nulls> hasher;
+  hash_value_type const* row_hashes;  ///< Hash of each row, or `nullptr` to hash on every probe
+
+  __device__ hash_value_type operator()(size_type row_index) const {
+    return row_hashes != nullptr ? row_hashes[row_index] : hasher(row_index);
+  }
+};
+
+/**
+ * @brief Compares two rows of the keys, comparing first their hashes when they
+ * were computed beforehand
+ *
+ * Rows of different hashes are unequal, which keeps most probes that collide
+ * from comparing the elements of the rows.
+ */
+template <bool keys_have_nulls>
+struct cached_row_equality_comparator {
+  row_equality_comparator<keys_have_nulls> rows_equal;
+  hash_value_type const* row_hashes;  ///< Hash of each row, or `nullptr` to compare rows only
+
+  __device__ bool operator()(size_type lhs_row_index, size_type rhs_row_index) const {
+    return (row_hashes == nullptr or row_hashes[lhs_row_index] == row_hashes[rhs_row_index]) and
+           rows_equal(lhs_row_index, rhs_row_index);
+  }
+};
+
+/**
+ * @brief Returns whether the map of `keys` should hash each row once beforehand
+ *
+ * Hashing and comparing strings reads their characters, which costs far more
+ * than reading one precomputed hash on each probe. Fixed-width keys are hashed
+ * on every probe, as they are about as cheap to read as their hash.
+ */
+bool should_cache_row_hashes(table_view const& keys) {
+  return std::any_of(keys.begin(), keys.end(), [](column_view const& col) {
+    return col.type().id() == type_id::STRING;
+  });
+}
+
+/**
+ * @brief Computes the hash of each row of `d_keys` into `row_hashes`
+ */
+template <bool keys_have_nulls>
+void compute_row_hashes(table_device_view const& d_keys,
+                        hash_value_type* row_hashes,
+                        cudaStream_t stream) {
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(d_keys.num_rows()),
+                    row_hashes,
+                    row_hasher<default_hash, keys_have_nulls>{d_keys});
+}
+
 /**
  * @brief Construct hash map that uses row comparator and row hasher on 
  * `d_keys` table and stores indices
+ *
+ * The map is sized for `max_num_keys` distinct keys. When `row_hashes` is not
+ * `nullptr`, the map reads the hash of each row from it, see
+ * `compute_row_hashes`.
  */
 template <bool keys_have_nulls>
 auto create_hash_map(table_device_view const& d_keys,
-                     include_nulls include_null_keys,
+                     bool null_keys_are_equal,
+                     size_type max_num_keys,
+                     hash_value_type const* row_hashes,
                      cudaStream_t stream = 0) {
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
   size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
 
   using map_type = concurrent_unordered_map<size_type,
                                             size_type,
-                                            row_hasher<default_hash, keys_have_nulls>,
-                                            row_equality_comparator<keys_have_nulls>>;
+                                            cached_row_hasher<keys_have_nulls>,
+                                            cached_row_equality_comparator<keys_have_nulls>>;
 
   using allocator_type = typename map_type::allocator_type;
 
-  bool const null_keys_are_equal{include_null_keys == include_nulls::YES};
-
-  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
-  row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
+  cached_row_hasher<keys_have_nulls> hasher{row_hasher<default_hash, keys_have_nulls>{d_keys},
+                                            row_hashes};
+  cached_row_equality_comparator<keys_have_nulls> rows_equal{
+    row_equality_comparator<keys_have_nulls>{d_keys, d_keys, null_keys_are_equal}, row_hashes};
 
-  return map_type::create(compute_hash_table_size(d_keys.num_rows()),
+  return map_type::create(compute_hash_table_size(max_num_keys),
                           unused_key,
                           unused_value,
                           hasher,
@@ -219,19 +348,89 @@ auto create_hash_map(table_device_view const& d_keys,
                           stream);
 }
 
+// Inputs with fewer rows keep a map sized for one group per row, whose cost is small next to an
+// estimate of the number of groups
+constexpr size_type GROUPBY_ESTIMATE_MIN_ROWS = 1 << 20;
+// 2^12 registers estimate the number of groups within about 1.6%
+constexpr int GROUPBY_ESTIMATE_PRECISION = 12;
+
+/**
+ * @brief Construct the hash map of the groups of `flattened_keys`, and insert
+ * the rows of every group into it
+ *
+ * A map sized for one group per row is mostly empty when there are few groups,
+ * which wastes memory and spreads the probes of the aggregations over far more
+ * cache lines than the groups occupy. For inputs of at least
+ * `GROUPBY_ESTIMATE_MIN_ROWS` rows, the map is instead sized for twice the
+ * number of groups estimated by `approx_distinct_count`, and populated before
+ * the aggregations. Should the estimate be too low for the map to hold every
+ * group, the map is rebuilt for one group per row.
+ *
+ * @param flattened_keys The key columns
+ * @param d_keys Device view of `flattened_keys`
+ * @param null_keys_are_equal Whether null keys compare equal
+ * @param row_bitmask Bitmask of the rows to group, or `nullptr` for all rows
+ * @param row_hashes Hash of each row, or `nullptr` to hash the rows on every probe
+ * @param estimated_num_groups Number of groups already estimated by the
+ * planner, or -1 to estimate it here
+ * @param stream CUDA stream on which to execute kernels
+ */
+template <bool keys_have_nulls>
+auto create_groups_hash_map(table_view const& flattened_keys,
+                            table_device_view const& d_keys,
+                            bool null_keys_are_equal,
+                            bitmask_type const* row_bitmask,
+                            hash_value_type const* row_hashes,
+                            size_type estimated_num_groups,
+                            cudaStream_t stream) {
+  auto const num_rows = flattened_keys.num_rows();
+  if (num_rows >= GROUPBY_ESTIMATE_MIN_ROWS) {
+    auto const num_groups = estimated_num_groups >= 0
+                              ? estimated_num_groups
+                              : experimental::detail::approx_distinct_count(
+                                  flattened_keys, GROUPBY_ESTIMATE_PRECISION, stream);
+    // Headroom for the error of the estimate
+    auto const estimate = 2 * static_cast<int64_t>(num_groups);
+    if (estimate < num_rows) {
+      auto map = create_hash_map<keys_have_nulls>(
+        d_keys, null_keys_are_equal, static_cast<size_type>(estimate), row_hashes, stream);
+      using Map = std::decay_t<decltype(*map)>;
+      rmm::device_scalar<bool> overflow(false, stream);
+      if (row_bitmask != nullptr) {
+        thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                           thrust::make_counting_iterator(0),
+                           num_rows,
+                           hash::insert_keys_fn<true, Map>{*map, row_bitmask, overflow.data()});
+      } else {
+        thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                           thrust::make_counting_iterator(0),
+                           num_rows,
+                           hash::insert_keys_fn<false, Map>{*map, row_bitmask, overflow.data()});
+      }
+      if (not overflow.value()) { return map; }
+    }
+  }
+  return create_hash_map<keys_have_nulls>(
+    d_keys, null_keys_are_equal, num_rows, row_hashes, stream);
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
+ *
+ * The sparse results are allocated from `scratch_mr`.
  * 
  * @see groupby_null_templated()
  */
-template <bool keys_have_nulls, typename Map>
+template <typename Map>
 void compute_single_pass_aggs(table_view const& keys,
                               std::vector<aggregation_request> const& requests,
                               experimental::detail::result_cache* sparse_results,
                               Map& map,
-                              include_nulls include_null_keys,
-                              cudaStream_t stream) {
+                              bitmask_type const* row_bitmask,
+                              bool allow_shared_memory,
+                              cudaStream_t stream,
+                              rmm::mr::device_memory_resource* scratch_mr) {
   // flatten the aggs to a table that can be operated on by aggregate_row
   table_view flattened_values;
   std::vector<aggregation::Kind> aggs;
@@ -245,14 +444,17 @@ void compute_single_pass_aggs(table_view const& keys,
     flattened_values.end(),
     aggs.begin(),
     std::back_inserter(sparse_columns),
-    [stream](auto const& col, auto const& agg) {
+    [stream, scratch_mr](auto const& col, auto const& agg) {
       bool nullable = (agg == aggregation::COUNT_VALID or agg == aggregation::COUNT_ALL)
                         ? false
                         : col.has_nulls();
       auto mask_flag = (nullable) ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
 
-      return make_fixed_width_column(
-        experimental::detail::target_type(col.type(), agg), col.size(), mask_flag, stream);
+      return make_fixed_width_column(experimental::detail::target_type(col.type(), agg),
+                                     col.size(),
+                                     mask_flag,
+                                     stream,
+                                     scratch_mr);
     });
 
   table sparse_table(std::move(sparse_columns));
@@ -260,24 +462,39 @@ void compute_single_pass_aggs(table_view const& keys,
   experimental::detail::initialize_with_identity(table_view, aggs, stream);
 
   // prepare to launch kernel to do the actual aggregation
-  auto d_sparse_table = mutable_table_device_view::create(sparse_table);
-  auto d_values       = table_device_view::create(flattened_values);
+  auto d_sparse_table = mutable_table_device_view::create(sparse_table, stream);
+  auto d_values       = table_device_view::create(flattened_values, stream);
   rmm::device_vector<aggregation::Kind> d_aggs(aggs);
 
-  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == include_nulls::NO;
+  // Pre-aggregates rows of the same key in shared memory when the plan and all aggs allow it
+  bool const use_shared_memory =
+    allow_shared_memory and keys.num_rows() > 0 and aggs.size() <= SHARED_MEMORY_AGGS_MAX_AGGS and
+    std::all_of(aggs.begin(), aggs.end(), is_shared_memory_aggregation);
 
-  if (skip_key_rows_with_nulls) {
-    auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
-    thrust::for_each_n(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0),
-      keys.num_rows(),
-      hash::compute_single_pass_aggs<true, Map>{map,
-                                                keys.num_rows(),
-                                                *d_values,
-                                                *d_sparse_table,
-                                                d_aggs.data().get(),
-                                                static_cast<bitmask_type*>(row_bitmask.data())});
+  if (use_shared_memory) {
+    cudf::experimental::detail::grid_1d grid{
+      keys.num_rows(), SHARED_MEMORY_AGGS_BLOCK_SIZE, SHARED_MEMORY_AGGS_ROWS_PER_THREAD};
+    auto const shared_memory_size = shared_memory_aggs_size(aggs.size());
+    if (row_bitmask != nullptr) {
+      hash::compute_shared_memory_aggs<true>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_memory_size, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(), row_bitmask);
+    } else {
+      hash::compute_shared_memory_aggs<false>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_memory_size, stream>>>(
+          map, keys.num_rows(), *d_values, *d_sparse_table, d_aggs.data().get(), nullptr);
+    }
+    CHECK_CUDA(stream);
+  } else if (row_bitmask != nullptr) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       keys.num_rows(),
+                       hash::compute_single_pass_aggs<true, Map>{map,
+                                                                 keys.num_rows(),
+                                                                 *d_values,
+                                                                 *d_sparse_table,
+                                                                 d_aggs.data().get(),
+                                                                 row_bitmask});
   } else {
     thrust::for_each_n(
       rmm::exec_policy(stream)->on(stream),
@@ -295,6 +512,316 @@ void compute_single_pass_aggs(table_view const& keys,
   }
 }
 
+/**
+ * @brief Computes the sparse MEAN of `values` from the SUM and COUNT_VALID
+ * results in `sparse_results`, unless it was already computed
+ */
+void compute_sparse_mean(column_view const& values,
+                         size_t col_idx,
+                         experimental::detail::result_cache* sparse_results,
+                         cudaStream_t stream,
+                         rmm::mr::device_memory_resource* scratch_mr) {
+  auto mean_agg = make_mean_aggregation();
+  if (sparse_results->has_result(col_idx, mean_agg)) { return; }
+
+  auto result = experimental::detail::binary_operation(
+    sparse_results->get_result(col_idx, make_sum_aggregation()),
+    sparse_results->get_result(col_idx, make_count_aggregation()),
+    binary_operator::DIV,
+    experimental::detail::target_type(values.type(), aggregation::MEAN),
+    scratch_mr,
+    stream);
+  sparse_results->add_result(col_idx, mean_agg, std::move(result));
+}
+
+/**
+ * @brief Computes the sparse VARIANCE of `values` with `ddof` delta degrees of
+ * freedom, unless it was already computed
+ *
+ * Each group's mean is computed first, then a second pass over the rows adds
+ * their squared deviations from the mean of their group.
+ */
+template <typename Map>
+void compute_sparse_variance(column_view const& values,
+                             size_t col_idx,
+                             size_type ddof,
+                             experimental::detail::result_cache* sparse_results,
+                             Map const& map,
+                             bitmask_type const* row_bitmask,
+                             cudaStream_t stream,
+                             rmm::mr::device_memory_resource* scratch_mr) {
+  auto var_agg = make_variance_aggregation(ddof);
+  if (sparse_results->has_result(col_idx, var_agg)) { return; }
+
+  compute_sparse_mean(values, col_idx, sparse_results, stream, scratch_mr);
+
+  // VARIANCE is computed in double for every numeric type
+  using Target = double;
+  auto result  = make_fixed_width_column(
+    data_type(type_to_id<Target>()), values.size(), mask_state::ALL_NULL, stream, scratch_mr);
+  auto result_view = result->mutable_view();
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               result_view.begin<Target>(),
+               result_view.end<Target>(),
+               Target{0});
+
+  auto d_result = mutable_column_device_view::create(result_view, stream);
+  auto d_values = column_device_view::create(values, stream);
+  auto d_means  = column_device_view::create(
+    sparse_results->get_result(col_idx, make_mean_aggregation()), stream);
+  auto d_group_sizes = column_device_view::create(
+    sparse_results->get_result(col_idx, make_count_aggregation()), stream);
+
+  if (row_bitmask != nullptr) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::var_hash_functor<true, Map>{
+                         map, row_bitmask, *d_result, *d_values, *d_means, *d_group_sizes, ddof});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::var_hash_functor<false, Map>{
+                         map, nullptr, *d_result, *d_values, *d_means, *d_group_sizes, ddof});
+  }
+  sparse_results->add_result(col_idx, var_agg, std::move(result));
+}
+
+/**
+ * @brief Computes all aggregations from `requests` that are derived from the
+ * single pass aggregations and stores the results in `sparse_results`
+ *
+ * @see groupby_null_templated()
+ */
+template <typename Map>
+void compute_multi_pass_aggs(std::vector<aggregation_request> const& requests,
+                             experimental::detail::result_cache* sparse_results,
+                             Map const& map,
+                             bitmask_type const* row_bitmask,
+                             cudaStream_t stream,
+                             rmm::mr::device_memory_resource* scratch_mr) {
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    if (not is_numeric(values.type())) { continue; }
+
+    for (auto&& agg : requests[i].aggregations) {
+      if (agg->kind == aggregation::MEAN) {
+        compute_sparse_mean(values, i, sparse_results, stream, scratch_mr);
+      } else if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+        auto const ddof =
+          static_cast<experimental::detail::std_var_aggregation const*>(agg.get())->_ddof;
+        compute_sparse_variance(
+          values, i, ddof, sparse_results, map, row_bitmask, stream, scratch_mr);
+
+        if (agg->kind == aggregation::STD and not sparse_results->has_result(i, agg)) {
+          auto result = experimental::detail::unary_operation(
+            sparse_results->get_result(i, make_variance_aggregation(ddof)),
+            experimental::unary_op::SQRT,
+            scratch_mr,
+            stream);
+          sparse_results->add_result(i, agg, std::move(result));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns the sparse index of the group of each row of the keys, which
+ * NUNIQUE and COLLECT use to find the rows of each group
+ */
+template <typename Map>
+rmm::device_vector<size_type> compute_group_indices(Map const& map,
+                                                    size_type num_keys,
+                                                    bitmask_type const* row_bitmask,
+                                                    cudaStream_t stream) {
+  rmm::device_vector<size_type> group_indices(num_keys);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_keys),
+                    group_indices.begin(),
+                    hash::group_index_functor<Map>{map, row_bitmask});
+  return group_indices;
+}
+
+/**
+ * @brief Computes the sparse NUNIQUE of `values` by inserting the (group,
+ * value) pairs of the rows into a hash set, unless it was already computed
+ */
+template <bool values_have_nulls>
+void compute_sparse_nunique(column_view const& values,
+                            size_t col_idx,
+                            std::unique_ptr<aggregation> const& agg,
+                            experimental::detail::result_cache* sparse_results,
+                            rmm::device_vector<size_type> const& group_indices,
+                            bitmask_type const* row_bitmask,
+                            cudaStream_t stream,
+                            rmm::mr::device_memory_resource* scratch_mr) {
+  if (sparse_results->has_result(col_idx, agg)) { return; }
+
+  auto const include_null_values =
+    static_cast<experimental::detail::nunique_aggregation const*>(agg.get())->_include_nulls ==
+    include_nulls::YES;
+
+  auto result = make_fixed_width_column(
+    data_type(type_to_id<size_type>()), values.size(), mask_state::UNALLOCATED, stream, scratch_mr);
+  auto result_view = result->mutable_view();
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               result_view.begin<size_type>(),
+               result_view.end<size_type>(),
+               size_type{0});
+
+  // Null values are equal, so that they count once with `include_nulls::YES`
+  column_view group_index_view(
+    data_type(type_to_id<size_type>()), values.size(), group_indices.data().get());
+  auto d_pairs  = table_device_view::create(table_view({group_index_view, values}), stream);
+  auto set      = create_hash_map<values_have_nulls>(
+    *d_pairs, true, values.size(), nullptr, stream);
+  auto d_values = column_device_view::create(values, stream);
+
+  using Set = std::decay_t<decltype(*set)>;
+  if (row_bitmask != nullptr) {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::nunique_hash_functor<true, Set>{*set,
+                                                             row_bitmask,
+                                                             *d_values,
+                                                             include_null_values,
+                                                             group_indices.data().get(),
+                                                             result_view.data<size_type>()});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       hash::nunique_hash_functor<false, Set>{*set,
+                                                              nullptr,
+                                                              *d_values,
+                                                              include_null_values,
+                                                              group_indices.data().get(),
+                                                              result_view.data<size_type>()});
+  }
+  sparse_results->add_result(col_idx, agg, std::move(result));
+}
+
+/**
+ * @brief Computes the sparse NUNIQUE results of `requests` and stores them in
+ * `sparse_results`
+ */
+void compute_sparse_nuniques(std::vector<aggregation_request> const& requests,
+                             experimental::detail::result_cache* sparse_results,
+                             rmm::device_vector<size_type> const& group_indices,
+                             bitmask_type const* row_bitmask,
+                             cudaStream_t stream,
+                             rmm::mr::device_memory_resource* scratch_mr) {
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    for (auto&& agg : requests[i].aggregations) {
+      if (agg->kind != aggregation::NUNIQUE) { continue; }
+      if (values.has_nulls()) {
+        compute_sparse_nunique<true>(
+          values, i, agg, sparse_results, group_indices, row_bitmask, stream, scratch_mr);
+      } else {
+        compute_sparse_nunique<false>(
+          values, i, agg, sparse_results, group_indices, row_bitmask, stream, scratch_mr);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the dense COLLECT results of `requests` and stores them in
+ * `dense_results`
+ *
+ * The rows are ordered by the dense index of their group with a stable sort of
+ * the group indices, which keeps the rows of each group in their order, and
+ * the values are gathered in that order into the child of the lists.
+ */
+void compute_dense_collects(std::vector<aggregation_request> const& requests,
+                            experimental::detail::result_cache* dense_results,
+                            rmm::device_vector<size_type> const& group_indices,
+                            rmm::device_vector<size_type> const& gather_map,
+                            size_type map_size,
+                            bitmask_type const* row_bitmask,
+                            cudaStream_t stream,
+                            rmm::mr::device_memory_resource* mr) {
+  auto const collect_agg = make_collect_aggregation();
+  rmm::device_vector<size_type> sorted_rows;
+  std::unique_ptr<column> offsets;
+  size_type num_collected = 0;
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& agg_v = requests[i].aggregations;
+    if (std::none_of(agg_v.begin(), agg_v.end(), [](auto const& agg) {
+          return agg->kind == aggregation::COLLECT;
+        }) or
+        dense_results->has_result(i, collect_agg)) {
+      continue;
+    }
+
+    // The order of the rows is shared by the requests; the rows skipped for
+    // their null keys get the group `map_size`, which is sorted last
+    if (not offsets) {
+      auto const num_keys = static_cast<size_type>(group_indices.size());
+      auto exec           = rmm::exec_policy(stream);
+      rmm::device_vector<size_type> dense_indices(num_keys);
+      thrust::scatter(exec->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(map_size),
+                      gather_map.begin(),
+                      dense_indices.begin());
+      rmm::device_vector<size_type> row_groups(num_keys);
+      thrust::transform(exec->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_keys),
+                        row_groups.begin(),
+                        [d_group_indices = group_indices.data().get(),
+                         d_dense_indices = dense_indices.data().get(),
+                         row_bitmask,
+                         map_size] __device__(size_type row) {
+                          if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) {
+                            return map_size;
+                          }
+                          return d_dense_indices[d_group_indices[row]];
+                        });
+      sorted_rows = rmm::device_vector<size_type>(num_keys);
+      thrust::sequence(exec->on(stream), sorted_rows.begin(), sorted_rows.end());
+      thrust::stable_sort_by_key(
+        exec->on(stream), row_groups.begin(), row_groups.end(), sorted_rows.begin());
+
+      offsets = make_numeric_column(
+        data_type(type_to_id<size_type>()), map_size + 1, mask_state::UNALLOCATED, stream, mr);
+      auto d_offsets = offsets->mutable_view().data<size_type>();
+      thrust::lower_bound(exec->on(stream),
+                          row_groups.begin(),
+                          row_groups.end(),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(map_size + 1),
+                          d_offsets);
+      CUDA_TRY(cudaMemcpyAsync(&num_collected,
+                               d_offsets + map_size,
+                               sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDF_STREAM_SYNC(stream);
+    }
+
+    auto child = experimental::detail::gather(table_view({requests[i].values}),
+                                              sorted_rows.begin(),
+                                              sorted_rows.begin() + num_collected,
+                                              false,
+                                              mr,
+                                              stream);
+    auto offsets_copy = std::make_unique<column>(offsets->view(), stream, mr);
+    dense_results->add_result(
+      i,
+      collect_agg,
+      make_lists_column(
+        map_size, std::move(offsets_copy), std::move(child->release()[0]), 0, {}, stream, mr));
+  }
+}
+
 /**
  * @brief Computes and returns a device vector containing all populated keys in
  * `map`. 
@@ -351,24 +878,89 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(
  */
 template <bool keys_have_nulls>
 std::unique_ptr<table> groupby_null_templated(table_view const& keys,
+                                              table_view const& flattened_keys,
                                               std::vector<aggregation_request> const& requests,
                                               experimental::detail::result_cache* cache,
                                               include_nulls include_null_keys,
+                                              hash_groupby_plan const& plan,
                                               cudaStream_t stream,
                                               rmm::mr::device_memory_resource* mr) {
-  auto d_keys = table_device_view::create(keys);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  // Null fields of valid struct keys are always grouped together; only the
+  // rows of null keys are skipped when nulls are not grouped
+  bool const null_keys_are_equal =
+    include_null_keys == include_nulls::YES or structs::detail::has_nested_columns(keys);
+  auto d_keys = table_device_view::create(flattened_keys, stream);
+
+  // The sparse results are only read by the gathers into the dense results,
+  // so they are allocated from the scratch arena
+  experimental::detail::scratch_scope scratch(stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   experimental::detail::result_cache sparse_results(requests.size());
 
-  // Compute all single pass aggs first
-  compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
+  // Rows with null keys are skipped by every pass unless nulls are grouped
+  bool const skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == include_nulls::NO;
+  rmm::device_buffer row_bitmask{};
+  if (skip_key_rows_with_nulls) {
+    row_bitmask = bitmask_and(keys, scratch.resource(), stream);
+  }
+  auto const d_row_bitmask =
+    skip_key_rows_with_nulls ? static_cast<bitmask_type const*>(row_bitmask.data()) : nullptr;
+
+  // The map reads the hashes of string keys, which must outlive it
+  rmm::device_buffer row_hashes{};
+  if (should_cache_row_hashes(flattened_keys)) {
+    row_hashes = rmm::device_buffer(
+      flattened_keys.num_rows() * sizeof(hash_value_type), stream, scratch.resource());
+    compute_row_hashes<keys_have_nulls>(
+      *d_keys, static_cast<hash_value_type*>(row_hashes.data()), stream);
+  }
+
+  auto map = create_groups_hash_map<keys_have_nulls>(
+    flattened_keys,
+    *d_keys,
+    null_keys_are_equal,
+    d_row_bitmask,
+    static_cast<hash_value_type const*>(row_hashes.data()),
+    plan.estimated_num_groups,
+    stream);
+
+  // Sparse index of the group of each row, for the aggregations that need it
+  rmm::device_vector<size_type> group_indices;
 
-  // Now continue with remaining multi-pass aggs
-  // <placeholder>
+  {
+    CUDF_PHASE_RANGE("hash_groupby_aggregate");
+    // Compute all single pass aggs first
+    compute_single_pass_aggs(keys,
+                             requests,
+                             &sparse_results,
+                             *map,
+                             d_row_bitmask,
+                             plan.use_shared_memory,
+                             stream,
+                             scratch.resource());
+
+    // Now continue with remaining multi-pass aggs
+    compute_multi_pass_aggs(
+      requests, &sparse_results, *map, d_row_bitmask, stream, scratch.resource());
+
+    // NUNIQUE and COLLECT find the rows of each group from the group indices
+    bool const needs_group_indices =
+      std::any_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
+        return std::any_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
+          return a->kind == aggregation::NUNIQUE or a->kind == aggregation::COLLECT;
+        });
+      });
+    if (needs_group_indices) {
+      group_indices = compute_group_indices(*map, keys.num_rows(), d_row_bitmask, stream);
+    }
+    compute_sparse_nuniques(
+      requests, &sparse_results, group_indices, d_row_bitmask, stream, scratch.resource());
+  }
+
+  CUDF_PHASE_RANGE("hash_groupby_gather");
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
@@ -378,6 +970,8 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 
   // Compact all results from sparse_results and insert into cache
   sparse_to_dense_results(requests, sparse_results, cache, gather_map, map_size, stream, mr);
+  compute_dense_collects(
+    requests, cache, group_indices, gather_map, map_size, d_row_bitmask, stream, mr);
 
   auto unique_keys = experimental::detail::gather(
     keys, gather_map.begin(), gather_map.begin() + map_size, false, mr, stream);
@@ -399,8 +993,10 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 bool can_use_hash_groupby(table_view const& keys,
                           std::vector<aggregation_request> const& requests) {
   return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-      return is_hash_aggregation(a->kind);
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&r](auto const& a) {
+      return is_hash_aggregation(a->kind) or
+             (is_numeric_hash_aggregation(a->kind) and is_numeric(r.values.type())) or
+             is_group_index_hash_aggregation(a->kind, r.values.type());
     });
   });
 }
@@ -410,17 +1006,22 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   include_nulls include_null_keys,
+  hash_groupby_plan const& plan,
   cudaStream_t stream,
   rmm::mr::device_memory_resource* mr) {
   experimental::detail::result_cache cache(requests.size());
 
+  // Struct keys are hashed and compared by the columns of their fields
+  auto const flattened       = structs::detail::flatten_nested_columns(keys, {}, {}, stream);
+  auto const& flattened_keys = flattened.flattened_columns;
+
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
-    unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+  if (has_nulls(flattened_keys)) {
+    unique_keys = groupby_null_templated<true>(
+      keys, flattened_keys, requests, &cache, include_null_keys, plan, stream, mr);
   } else {
-    unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<false>(
+      keys, flattened_keys, requests, &cache, include_null_keys, plan, stream, mr);
   }
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
@@ -20,6 +20,7 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 namespace cudf {
 namespace experimental {
@@ -110,7 +111,174 @@ struct compute_single_pass_aggs {
   }
 };
 
-// TODO (dm): variance kernel
+/**
+ * @brief Accumulates the variance of each group of `source` into the sparse
+ * `target` column, using the group means and sizes computed beforehand
+ *
+ * For every row `i` of the keys, the row's group is looked up in `map` and the
+ * squared deviation of `source[i]` from the group mean, divided by
+ * `group_size - ddof`, is added to the group's element of `target`. Groups
+ * with `group_size - ddof <= 0` are left untouched, so `target` is expected to
+ * be initialized to zero and all null; elements receiving a value are marked
+ * valid.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in input keys containing null
+ * values should be skipped. If `true`, it is assumed `row_bitmask` is a bitmask
+ * where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map
+ */
+template <bool skip_rows_with_nulls, typename Map>
+struct var_hash_functor {
+  Map map;
+  bitmask_type const* __restrict__ row_bitmask;
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view means;
+  column_device_view group_sizes;
+  size_type ddof;
+
+  var_hash_functor(Map map,
+                   bitmask_type const* row_bitmask,
+                   mutable_column_device_view target,
+                   column_device_view source,
+                   column_device_view means,
+                   column_device_view group_sizes,
+                   size_type ddof)
+    : map(map),
+      row_bitmask(row_bitmask),
+      target(target),
+      source(source),
+      means(means),
+      group_sizes(group_sizes),
+      ddof(ddof) {}
+
+  template <typename Source>
+  __device__ std::enable_if_t<not std::is_arithmetic<Source>::value> operator()(
+    size_type source_index, size_type target_index) noexcept {
+    release_assert(false and "Only numeric types are supported in std/variance");
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<std::is_arithmetic<Source>::value> operator()(
+    size_type source_index, size_type target_index) noexcept {
+    using Target    = experimental::detail::target_type_t<Source, aggregation::VARIANCE>;
+    using CountType = experimental::detail::target_type_t<Source, aggregation::COUNT_VALID>;
+
+    if (source.is_null(source_index)) { return; }
+
+    auto const group_size = group_sizes.element<CountType>(target_index);
+    if (group_size == 0 or group_size - ddof <= 0) { return; }
+
+    auto const x    = static_cast<Target>(source.element<Source>(source_index));
+    auto const mean = means.element<Target>(target_index);
+    atomicAdd(&target.element<Target>(target_index),
+              (x - mean) * (x - mean) / (group_size - ddof));
+
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+
+  __device__ void operator()(size_type i) {
+    if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
+      auto const target_index = map.find(i)->second;
+      experimental::type_dispatcher(source.type(), *this, i, target_index);
+    }
+  }
+};
+
+/**
+ * @brief Looks up the sparse index of the group of each row of the input keys
+ * in `map`, i.e. the index of the first row inserted with the row's key
+ *
+ * Rows containing nulls that are skipped by `row_bitmask`, if it is not
+ * `nullptr`, are not looked up and get their own index.
+ *
+ * @tparam Map The type of the hash map
+ */
+template <typename Map>
+struct group_index_functor {
+  Map map;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  group_index_functor(Map map, bitmask_type const* row_bitmask)
+    : map(map), row_bitmask(row_bitmask) {}
+
+  __device__ size_type operator()(size_type i) const {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, i)) { return i; }
+    return map.find(i)->second;
+  }
+};
+
+/**
+ * @brief Counts the distinct values of each group into the sparse `counts`
+ *
+ * Every row `i` of the keys is inserted into `set`, which hashes and compares
+ * the rows of a table of the group index of each row and the values. The
+ * first row of each (group, value) pair to be inserted increments the count
+ * of its group, which is expected to be initialized to zero.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in input keys containing null
+ * values should be skipped. If `true`, it is assumed `row_bitmask` is a bitmask
+ * where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Set The type of the hash map of the (group, value) pairs
+ */
+template <bool skip_rows_with_nulls, typename Set>
+struct nunique_hash_functor {
+  Set set;
+  bitmask_type const* __restrict__ row_bitmask;
+  column_device_view values;
+  bool include_null_values;
+  size_type const* __restrict__ group_indices;
+  size_type* __restrict__ counts;
+
+  nunique_hash_functor(Set set,
+                       bitmask_type const* row_bitmask,
+                       column_device_view values,
+                       bool include_null_values,
+                       size_type const* group_indices,
+                       size_type* counts)
+    : set(set),
+      row_bitmask(row_bitmask),
+      values(values),
+      include_null_values(include_null_values),
+      group_indices(group_indices),
+      counts(counts) {}
+
+  __device__ void operator()(size_type i) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    if (not include_null_values and values.is_null(i)) { return; }
+    if (set.insert(thrust::make_pair(i, i)).second) { atomicAdd(&counts[group_indices[i]], 1); }
+  }
+};
+
+/**
+ * @brief Inserts the row index of every row of the keys into `map`, and sets
+ * `*overflow` if `map` is too small to hold them all
+ *
+ * Used to populate a map sized from an estimate of the number of groups before
+ * any aggregation writes to the results: if the estimate was too low, nothing
+ * but the map has to be discarded.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in input keys containing null
+ * values should be skipped. If `true`, it is assumed `row_bitmask` is a bitmask
+ * where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map
+ */
+template <bool skip_rows_with_nulls, typename Map>
+struct insert_keys_fn {
+  Map map;
+  bitmask_type const* __restrict__ row_bitmask;
+  bool* overflow;
+
+  insert_keys_fn(Map map, bitmask_type const* row_bitmask, bool* overflow)
+    : map(map), row_bitmask(row_bitmask), overflow(overflow) {}
+
+  __device__ void operator()(size_type i) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { return; }
+    // Once the map is full, the remaining rows would each probe the whole map
+    if (*static_cast<bool volatile*>(overflow)) { return; }
+    if (not map.try_insert(thrust::make_pair(i, i))) { *overflow = true; }
+  }
+};
 
 }  // namespace hash
 }  // namespace detail
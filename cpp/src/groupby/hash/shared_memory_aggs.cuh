@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/// Number of threads per block of `compute_shared_memory_aggs`
+constexpr size_type SHARED_MEMORY_AGGS_BLOCK_SIZE = 128;
+
+/// Number of slots of the hash table each block keeps in shared memory
+constexpr size_type SHARED_MEMORY_AGGS_SLOTS = 2 * SHARED_MEMORY_AGGS_BLOCK_SIZE;
+
+/// Number of rows aggregated by each thread of `compute_shared_memory_aggs`
+constexpr size_type SHARED_MEMORY_AGGS_ROWS_PER_THREAD = 32;
+
+/// Maximum number of aggregations `compute_shared_memory_aggs` can compute
+constexpr size_type SHARED_MEMORY_AGGS_MAX_AGGS = 16;
+
+/**
+ * @brief Indicates whether the specified aggregation operation can be
+ * pre-aggregated in shared memory by `compute_shared_memory_aggs`.
+ */
+bool constexpr is_shared_memory_aggregation(aggregation::Kind k) {
+  return (k == aggregation::SUM) or (k == aggregation::SUM_OF_SQUARES) or
+         (k == aggregation::MIN) or (k == aggregation::MAX) or (k == aggregation::COUNT_VALID) or
+         (k == aggregation::COUNT_ALL) or (k == aggregation::ARGMIN) or
+         (k == aggregation::ARGMAX);
+}
+
+/**
+ * @brief Returns the bytes of dynamic shared memory `compute_shared_memory_aggs`
+ * requires to compute `num_aggs` aggregations
+ */
+inline size_t shared_memory_aggs_size(size_type num_aggs) {
+  return SHARED_MEMORY_AGGS_SLOTS *
+         (num_aggs * (sizeof(int64_t) + sizeof(bool)) + sizeof(size_type));
+}
+
+/**
+ * @brief Operations on a partial aggregate held in an 8-byte shared memory
+ * slot.
+ *
+ * `initialize` stores the identity of the aggregation in the slot, `update`
+ * aggregates the element of `source` at `source_index` into the slot and
+ * `merge` aggregates the slot into the element of `target` at `target_index`.
+ * The validity of a slot is set by `update` when a valid element is
+ * aggregated into it and slots that are not valid are not merged.
+ */
+template <typename Source, aggregation::Kind k, typename Enable = void>
+struct shared_memory_element {
+  __device__ static void initialize(int64_t* slot) noexcept {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+
+  __device__ static void merge(mutable_column_device_view target,
+                               size_type target_index,
+                               int64_t const* slot,
+                               column_device_view source) noexcept {
+    release_assert(false and "Invalid source type and aggregation combination.");
+  }
+};
+
+/**
+ * @brief Partial aggregates for the aggregations that add a contribution of
+ * each element.
+ */
+template <typename Target>
+struct additive_shared_memory_element {
+  __device__ static void initialize(int64_t* slot) noexcept {
+    *reinterpret_cast<Target*>(slot) = Target{0};
+  }
+
+  __device__ static void merge(mutable_column_device_view target,
+                               size_type target_index,
+                               int64_t const* slot,
+                               column_device_view) noexcept {
+    atomicAdd(&target.element<Target>(target_index), *reinterpret_cast<Target const*>(slot));
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<Source,
+                             aggregation::SUM,
+                             std::enable_if_t<is_fixed_width<Source>()>>
+  : additive_shared_memory_element<target_type_t<Source, aggregation::SUM>> {
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    using Target = target_type_t<Source, aggregation::SUM>;
+    atomicAdd(reinterpret_cast<Target*>(slot),
+              static_cast<Target>(source.element<Source>(source_index)));
+    *slot_valid = true;
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<Source,
+                             aggregation::SUM_OF_SQUARES,
+                             std::enable_if_t<is_numeric<Source>()>>
+  : additive_shared_memory_element<target_type_t<Source, aggregation::SUM_OF_SQUARES>> {
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    using Target     = target_type_t<Source, aggregation::SUM_OF_SQUARES>;
+    auto const value = static_cast<Target>(source.element<Source>(source_index));
+    atomicAdd(reinterpret_cast<Target*>(slot), value * value);
+    *slot_valid = true;
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<
+  Source,
+  aggregation::COUNT_VALID,
+  std::enable_if_t<is_valid_aggregation<Source, aggregation::COUNT_VALID>()>>
+  : additive_shared_memory_element<target_type_t<Source, aggregation::COUNT_VALID>> {
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    using Target = target_type_t<Source, aggregation::COUNT_VALID>;
+    atomicAdd(reinterpret_cast<Target*>(slot), Target{1});
+    *slot_valid = true;
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<
+  Source,
+  aggregation::COUNT_ALL,
+  std::enable_if_t<is_valid_aggregation<Source, aggregation::COUNT_ALL>()>>
+  : additive_shared_memory_element<target_type_t<Source, aggregation::COUNT_ALL>> {
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view,
+                                size_type) noexcept {
+    using Target = target_type_t<Source, aggregation::COUNT_ALL>;
+    atomicAdd(reinterpret_cast<Target*>(slot), Target{1});
+    *slot_valid = true;
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<Source,
+                             aggregation::MIN,
+                             std::enable_if_t<is_fixed_width<Source>()>> {
+  using Target = target_type_t<Source, aggregation::MIN>;
+
+  __device__ static void initialize(int64_t* slot) noexcept {
+    *reinterpret_cast<Target*>(slot) = DeviceMin::identity<Target>();
+  }
+
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    atomicMin(reinterpret_cast<Target*>(slot),
+              static_cast<Target>(source.element<Source>(source_index)));
+    *slot_valid = true;
+  }
+
+  __device__ static void merge(mutable_column_device_view target,
+                               size_type target_index,
+                               int64_t const* slot,
+                               column_device_view) noexcept {
+    atomicMin(&target.element<Target>(target_index), *reinterpret_cast<Target const*>(slot));
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
+template <typename Source>
+struct shared_memory_element<Source,
+                             aggregation::MAX,
+                             std::enable_if_t<is_fixed_width<Source>()>> {
+  using Target = target_type_t<Source, aggregation::MAX>;
+
+  __device__ static void initialize(int64_t* slot) noexcept {
+    *reinterpret_cast<Target*>(slot) = DeviceMax::identity<Target>();
+  }
+
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    atomicMax(reinterpret_cast<Target*>(slot),
+              static_cast<Target>(source.element<Source>(source_index)));
+    *slot_valid = true;
+  }
+
+  __device__ static void merge(mutable_column_device_view target,
+                               size_type target_index,
+                               int64_t const* slot,
+                               column_device_view) noexcept {
+    atomicMax(&target.element<Target>(target_index), *reinterpret_cast<Target const*>(slot));
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
+/**
+ * @brief Partial aggregates for ARGMIN and ARGMAX, which hold the index of the
+ * minimum (maximum) element aggregated so far.
+ *
+ * Merging a slot aggregates the element at that index into the target.
+ */
+template <typename Source, aggregation::Kind k>
+struct shared_memory_element<
+  Source,
+  k,
+  std::enable_if_t<(k == aggregation::ARGMIN or k == aggregation::ARGMAX) and
+                   is_valid_aggregation<Source, k>()>> {
+  using Target = target_type_t<Source, k>;
+
+  __device__ static void initialize(int64_t* slot) noexcept {
+    *reinterpret_cast<Target*>(slot) =
+      (k == aggregation::ARGMIN) ? ARGMIN_SENTINEL : ARGMAX_SENTINEL;
+  }
+
+  __device__ static bool is_better(column_device_view source, Target index, Target other) {
+    return (k == aggregation::ARGMIN)
+             ? source.element<Source>(index) < source.element<Source>(other)
+             : source.element<Source>(index) > source.element<Source>(other);
+  }
+
+  __device__ static void update(int64_t* slot,
+                                bool* slot_valid,
+                                column_device_view source,
+                                size_type source_index) noexcept {
+    if (source.is_null(source_index)) { return; }
+
+    Target const sentinel = (k == aggregation::ARGMIN) ? ARGMIN_SENTINEL : ARGMAX_SENTINEL;
+    auto element          = reinterpret_cast<Target*>(slot);
+    auto old              = atomicCAS(element, sentinel, source_index);
+    while (old != sentinel and is_better(source, source_index, old)) {
+      auto const assumed = old;
+      old                = atomicCAS(element, assumed, source_index);
+      if (old == assumed) { break; }
+    }
+    *slot_valid = true;
+  }
+
+  __device__ static void merge(mutable_column_device_view target,
+                               size_type target_index,
+                               int64_t const* slot,
+                               column_device_view source) noexcept {
+    update_target_element<Source, k, true, false>{}(
+      target, target_index, source, *reinterpret_cast<Target const*>(slot));
+  }
+};
+
+struct initialize_shared_memory_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(int64_t* slot) const noexcept {
+    shared_memory_element<Source, k>::initialize(slot);
+  }
+};
+
+struct update_shared_memory_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(int64_t* slot,
+                             bool* slot_valid,
+                             column_device_view source,
+                             size_type source_index) const noexcept {
+    shared_memory_element<Source, k>::update(slot, slot_valid, source, source_index);
+  }
+};
+
+struct merge_shared_memory_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             int64_t const* slot,
+                             column_device_view source) const noexcept {
+    shared_memory_element<Source, k>::merge(target, target_index, slot, source);
+  }
+};
+
+/**
+ * @brief Computes single-pass aggregations like `compute_single_pass_aggs`,
+ * pre-aggregating rows with equal keys in shared memory.
+ *
+ * Each block aggregates a contiguous range of
+ * `SHARED_MEMORY_AGGS_BLOCK_SIZE * SHARED_MEMORY_AGGS_ROWS_PER_THREAD` rows.
+ * The block's rows are inserted into a hash table of
+ * `SHARED_MEMORY_AGGS_SLOTS` slots in shared memory, keyed by the index of the
+ * first row of each key seen by the block, and aggregated into the slot's
+ * partial aggregates with shared memory atomics. The partial aggregates are
+ * merged into `output_values` through `map` once the block is done, so rows
+ * of a key repeated within the block contend on the global `map` and
+ * `output_values` only once per block.
+ *
+ * If the shared memory table could overflow in the next round of rows, i.e.
+ * the block saw many distinct keys, the table is merged early and the rest of
+ * the block's rows are aggregated directly as in `compute_single_pass_aggs`.
+ *
+ * Only aggregations satisfying `is_shared_memory_aggregation` are supported,
+ * and at most `SHARED_MEMORY_AGGS_MAX_AGGS` of them. The kernel must be
+ * launched with `SHARED_MEMORY_AGGS_BLOCK_SIZE` threads per block and
+ * `shared_memory_aggs_size(output_values.num_columns())` bytes of dynamic
+ * shared memory.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in input keys containing null
+ * values should be skipped. If `true`, it is assumed `row_bitmask` is a bitmask
+ * where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map
+ *
+ * @param map Hash map of the indices of the unique keys
+ * @param num_keys The number of rows in input keys table
+ * @param input_values The table whose rows are aggregated
+ * @param output_values Sparse table that stores the results of aggregating
+ * rows of `input_values`
+ * @param aggs The aggregation operations to perform on the columns of
+ * `input_values`
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
+ * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
+ */
+template <bool skip_rows_with_nulls, typename Map>
+__global__ void compute_shared_memory_aggs(Map map,
+                                           size_type num_keys,
+                                           table_device_view input_values,
+                                           mutable_table_device_view output_values,
+                                           aggregation::Kind const* __restrict__ aggs,
+                                           bitmask_type const* __restrict__ row_bitmask) {
+  // Partial aggregates of aggregation `c` are at [c * SLOTS, (c + 1) * SLOTS)
+  extern __shared__ int64_t slot_values[];
+  auto const num_aggs = output_values.num_columns();
+  auto slot_keys =
+    reinterpret_cast<size_type*>(slot_values + num_aggs * SHARED_MEMORY_AGGS_SLOTS);
+  auto slot_valids = reinterpret_cast<bool*>(slot_keys + SHARED_MEMORY_AGGS_SLOTS);
+  __shared__ size_type num_used_slots;
+
+  auto const unused_key = map.get_unused_key();
+  auto const key_equal  = map.get_key_equal();
+  auto const hasher     = map.get_hash_function();
+
+  for (auto slot = threadIdx.x; slot < SHARED_MEMORY_AGGS_SLOTS; slot += blockDim.x) {
+    slot_keys[slot] = unused_key;
+    for (auto c = 0; c < num_aggs; ++c) {
+      slot_valids[c * SHARED_MEMORY_AGGS_SLOTS + slot] = false;
+      experimental::detail::dispatch_type_and_aggregation(
+        input_values.column(c).type(),
+        aggs[c],
+        initialize_shared_memory_element{},
+        slot_values + c * SHARED_MEMORY_AGGS_SLOTS + slot);
+    }
+  }
+  if (threadIdx.x == 0) { num_used_slots = 0; }
+  __syncthreads();
+
+  // Merges the partial aggregates of every used slot into `output_values`
+  auto merge_slots = [&]() {
+    for (auto slot = threadIdx.x; slot < SHARED_MEMORY_AGGS_SLOTS; slot += blockDim.x) {
+      auto const key = slot_keys[slot];
+      if (key == unused_key) { continue; }
+      auto const target_index = map.insert(thrust::make_pair(key, key)).first->second;
+      for (auto c = 0; c < num_aggs; ++c) {
+        if (not slot_valids[c * SHARED_MEMORY_AGGS_SLOTS + slot]) { continue; }
+        experimental::detail::dispatch_type_and_aggregation(
+          input_values.column(c).type(),
+          aggs[c],
+          merge_shared_memory_element{},
+          output_values.column(c),
+          target_index,
+          slot_values + c * SHARED_MEMORY_AGGS_SLOTS + slot,
+          input_values.column(c));
+      }
+    }
+  };
+
+  size_type const block_size     = blockDim.x;
+  size_type const rows_per_block = SHARED_MEMORY_AGGS_ROWS_PER_THREAD * block_size;
+  size_type const block_begin    = blockIdx.x * rows_per_block;
+  size_type const block_end      = min(num_keys, block_begin + rows_per_block);
+  // The table is merged early once fewer than `block_size` slots are unused
+  size_type const max_used_slots = SHARED_MEMORY_AGGS_SLOTS - block_size;
+
+  bool use_shared_memory = true;
+  for (auto round_begin = block_begin; round_begin < block_end; round_begin += block_size) {
+    size_type const i = round_begin + threadIdx.x;
+    bool table_filled = false;
+
+    if (i < block_end and (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i))) {
+      if (use_shared_memory) {
+        // At most `block_size` keys are added per round, and the table has at
+        // least as many unused slots at the start of the round
+        auto slot = hasher(i) % SHARED_MEMORY_AGGS_SLOTS;
+        while (true) {
+          auto const existing = atomicCAS(&slot_keys[slot], unused_key, i);
+          if (existing == unused_key) {
+            table_filled = atomicAdd(&num_used_slots, 1) >= max_used_slots;
+            break;
+          }
+          if (key_equal(existing, i)) { break; }
+          slot = (slot + 1) % SHARED_MEMORY_AGGS_SLOTS;
+        }
+
+        for (auto c = 0; c < num_aggs; ++c) {
+          experimental::detail::dispatch_type_and_aggregation(
+            input_values.column(c).type(),
+            aggs[c],
+            update_shared_memory_element{},
+            slot_values + c * SHARED_MEMORY_AGGS_SLOTS + slot,
+            slot_valids + c * SHARED_MEMORY_AGGS_SLOTS + slot,
+            input_values.column(c),
+            i);
+        }
+      } else {
+        auto result = map.insert(thrust::make_pair(i, i));
+        experimental::detail::aggregate_row<true, true>(
+          output_values, result.first->second, input_values, i, aggs);
+      }
+    }
+
+    if (use_shared_memory and __syncthreads_or(table_filled)) {
+      merge_slots();
+      use_shared_memory = false;
+    }
+  }
+
+  if (use_shared_memory) { merge_slots(); }
+}
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
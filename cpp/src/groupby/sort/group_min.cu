@@ -14,7 +14,11 @@
  * limitations under the License.
  */
 
-#include <groupby/sort/group_single_pass_reduction_util.cuh>
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 namespace cudf {
 namespace experimental {
@@ -23,16 +27,18 @@ namespace detail {
 
 std::unique_ptr<column> group_min(column_view const& values,
                                   size_type num_groups,
-                                  rmm::device_vector<size_type> const& group_labels,
+                                  rmm::device_vector<size_type> const& group_offsets,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream) {
-  return type_dispatcher(values.type(),
-                         reduce_functor<aggregation::MIN>{},
-                         values,
-                         num_groups,
-                         group_labels,
-                         mr,
-                         stream);
+  auto const offsets = column_view(
+    data_type{type_to_id<size_type>()}, num_groups + 1, group_offsets.data().get());
+  return experimental::detail::segmented_reduce(
+    values,
+    offsets,
+    aggregation::MIN,
+    experimental::detail::target_type(values.type(), aggregation::MIN),
+    mr,
+    stream);
 }
 
 }  // namespace detail
@@ -33,13 +33,13 @@ namespace detail {
  * 
  * @param values Grouped values to get sum of
  * @param num_groups Number of groups
- * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
  * @param mr Memory resource to allocate output with
  * @param stream Stream to perform computation in
  */
 std::unique_ptr<column> group_sum(column_view const& values,
                                   size_type num_groups,
-                                  rmm::device_vector<size_type> const& group_labels,
+                                  rmm::device_vector<size_type> const& group_offsets,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
@@ -48,13 +48,13 @@ std::unique_ptr<column> group_sum(column_view const& values,
  * 
  * @param values Grouped values to get minimum from
  * @param num_groups Number of groups
- * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
  * @param mr Memory resource to allocate output with
  * @param stream Stream to perform computation in
  */
 std::unique_ptr<column> group_min(column_view const& values,
                                   size_type num_groups,
-                                  rmm::device_vector<size_type> const& group_labels,
+                                  rmm::device_vector<size_type> const& group_offsets,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
@@ -63,13 +63,13 @@ std::unique_ptr<column> group_min(column_view const& values,
  * 
  * @param values Grouped values to get maximum from
  * @param num_groups Number of groups
- * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
  * @param mr Memory resource to allocate output with
  * @param stream Stream to perform computation in
  */
 std::unique_ptr<column> group_max(column_view const& values,
                                   size_type num_groups,
-                                  rmm::device_vector<size_type> const& group_labels,
+                                  rmm::device_vector<size_type> const& group_offsets,
                                   rmm::mr::device_memory_resource* mr,
                                   cudaStream_t stream = 0);
 
@@ -55,11 +55,11 @@ struct reduce_functor {
     rmm::device_vector<cudf::size_type> const& group_labels,
     rmm::mr::device_memory_resource* mr,
     cudaStream_t stream) {
-    using OpType     = cudf::experimental::detail::corresponding_operator_t<K>;
-    using ResultType = cudf::experimental::detail::target_type_t<T, K>;
+    using OpType = cudf::experimental::detail::corresponding_operator_t<K>;
 
+    // the target type keeps the scale of fixed-point values
     std::unique_ptr<column> result =
-      make_fixed_width_column(data_type(type_to_id<ResultType>()),
+      make_fixed_width_column(experimental::detail::target_type(values.type(), K),
                               num_groups,
                               values.has_nulls() ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
                               stream,
@@ -27,6 +27,7 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
@@ -73,7 +74,10 @@ struct store_result_functor {
   column_view get_grouped_values() {
     // TODO (dm): After implementing single pass mutli-agg, explore making a
     //            cache of all grouped value columns rather than one at a time
-    if (grouped_values)
+    // Values of pre-sorted keys are already grouped
+    if (helper.is_presorted())
+      return values;
+    else if (grouped_values)
       return grouped_values->view();
     else if (sorted_values)
       // TODO (dm): When we implement scan, it wouldn't be ok to return sorted
@@ -104,6 +108,16 @@ struct store_result_functor {
   cudaStream_t stream;                  ///< CUDA stream on which to execute kernels
   rmm::mr::device_memory_resource* mr;  ///< Memory resource to allocate space for results
 
+  /**
+   * @brief Get the `num_groups + 1` offsets of the groups as a column
+   */
+  column_view group_offsets_column() {
+    auto const& offsets = helper.group_offsets();
+    return column_view(data_type{type_to_id<size_type>()},
+                       static_cast<size_type>(offsets.size()),
+                       offsets.data().get());
+  };
+
   std::unique_ptr<column> sorted_values;   ///< Memoised grouped and sorted values
   std::unique_ptr<column> grouped_values;  ///< Memoised grouped values
 };
@@ -135,10 +149,11 @@ template <>
 void store_result_functor::operator()<aggregation::SUM>(std::unique_ptr<aggregation> const& agg) {
   if (cache.has_result(col_idx, agg)) return;
 
-  cache.add_result(col_idx,
-                   agg,
-                   detail::group_sum(
-                     get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream));
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_sum(
+      get_grouped_values(), helper.num_groups(), helper.group_offsets(), mr, stream));
 };
 
 template <>
@@ -178,7 +193,7 @@ void store_result_functor::operator()<aggregation::MIN>(std::unique_ptr<aggregat
   auto result = [&]() {
     if (cudf::is_fixed_width(values.type())) {
       return detail::group_min(
-        get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream);
+        get_grouped_values(), helper.num_groups(), helper.group_offsets(), mr, stream);
     } else {
       auto argmin_agg = make_argmin_aggregation();
       operator()<aggregation::ARGMIN>(argmin_agg);
@@ -208,7 +223,7 @@ void store_result_functor::operator()<aggregation::MAX>(std::unique_ptr<aggregat
   auto result = [&]() {
     if (cudf::is_fixed_width(values.type())) {
       return detail::group_max(
-        get_grouped_values(), helper.num_groups(), helper.group_labels(), mr, stream);
+        get_grouped_values(), helper.num_groups(), helper.group_offsets(), mr, stream);
     } else {
       auto argmax_agg = make_argmax_aggregation();
       operator()<aggregation::ARGMAX>(argmax_agg);
@@ -378,6 +393,76 @@ void store_result_functor::operator()<aggregation::NTH_ELEMENT>(
                                              mr,
                                              stream));
 }
+
+template <>
+void store_result_functor::operator()<aggregation::COLLECT>(
+  std::unique_ptr<aggregation> const& agg) {
+  if (cache.has_result(col_idx, agg)) return;
+
+  // The grouped values are the elements of the lists, delimited by the group
+  // offsets
+  cache.add_result(col_idx,
+                   agg,
+                   make_lists_column(helper.num_groups(),
+                                     std::make_unique<column>(group_offsets_column(), stream, mr),
+                                     std::make_unique<column>(get_grouped_values(), stream, mr),
+                                     0,
+                                     {},
+                                     stream,
+                                     mr));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::TDIGEST>(
+  std::unique_ptr<aggregation> const& agg) {
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<experimental::detail::tdigest_aggregation const*>(agg.get());
+
+  cache.add_result(col_idx,
+                   agg,
+                   experimental::detail::make_tdigest(get_grouped_values(),
+                                                      group_offsets_column(),
+                                                      tdigest_agg->_max_centroids,
+                                                      mr,
+                                                      stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::MERGE_TDIGEST>(
+  std::unique_ptr<aggregation> const& agg) {
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<experimental::detail::tdigest_aggregation const*>(agg.get());
+
+  cache.add_result(col_idx,
+                   agg,
+                   experimental::detail::merge_tdigests(get_grouped_values(),
+                                                        group_offsets_column(),
+                                                        tdigest_agg->_max_centroids,
+                                                        mr,
+                                                        stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_QUANTILE>(
+  std::unique_ptr<aggregation> const& agg) {
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto quantile_agg =
+    static_cast<experimental::detail::approx_quantile_aggregation const*>(agg.get());
+
+  // The digests of the groups are cached, so that quantiles requested with
+  // several aggregations digest the values once
+  auto tdigest_agg = make_tdigest_aggregation(quantile_agg->_max_centroids);
+  operator()<aggregation::TDIGEST>(tdigest_agg);
+  column_view digests = cache.get_result(col_idx, tdigest_agg);
+
+  cache.add_result(
+    col_idx,
+    agg,
+    experimental::detail::approx_quantiles(digests, quantile_agg->_quantiles, mr, stream));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -22,7 +22,9 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/structs/detail/utilities.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
 #include <thrust/binary_search.h>
@@ -44,10 +46,10 @@ namespace {
  * ordered according to a specified permutation map.
  *
  */
-template <bool nullable = true>
+template <bool nullable = true, typename MapIterator = cudf::size_type const*>
 struct permuted_row_equality_comparator {
   cudf::experimental::row_equality_comparator<nullable> _comparator;
-  cudf::size_type const* _map;
+  MapIterator _map;
 
   /**
    * @brief Construct a permuted_row_equality_comparator.
@@ -56,7 +58,7 @@ struct permuted_row_equality_comparator {
    * @param map The permutation map that specifies the effective ordering of
    *`t`. Must be the same size as `t.num_rows()`
    */
-  permuted_row_equality_comparator(cudf::table_device_view const& t, cudf::size_type const* map)
+  permuted_row_equality_comparator(cudf::table_device_view const& t, MapIterator map)
     : _comparator(t, t, true), _map{map} {}
 
   /**
@@ -156,26 +158,37 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(cuda
 
   _group_offsets = std::make_unique<index_vector>(num_keys(stream) + 1);
 
-  auto device_input_table = table_device_view::create(_keys, stream);
-  auto sorted_order       = key_sort_order().data<size_type>();
-  decltype(_group_offsets->begin()) result_end;
-  auto exec = rmm::exec_policy(stream);
+  // Struct keys are compared by the columns of their fields
+  auto const flattened    = structs::detail::flatten_nested_columns(_keys, {}, {}, stream);
+  auto const& keys        = flattened.flattened_columns;
+  auto device_input_table = table_device_view::create(keys, stream);
+  auto exec               = rmm::exec_policy(stream);
+
+  auto unique_copy = [&](auto sorted_order) {
+    if (has_nulls(keys)) {
+      return thrust::unique_copy(
+        exec->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(num_keys(stream)),
+        _group_offsets->begin(),
+        permuted_row_equality_comparator<true, decltype(sorted_order)>(*device_input_table,
+                                                                      sorted_order));
+    } else {
+      return thrust::unique_copy(
+        exec->on(stream),
+        thrust::make_counting_iterator<size_type>(0),
+        thrust::make_counting_iterator<size_type>(num_keys(stream)),
+        _group_offsets->begin(),
+        permuted_row_equality_comparator<false, decltype(sorted_order)>(*device_input_table,
+                                                                       sorted_order));
+    }
+  };
 
-  if (has_nulls(_keys)) {
-    result_end = thrust::unique_copy(
-      exec->on(stream),
-      thrust::make_counting_iterator<size_type>(0),
-      thrust::make_counting_iterator<size_type>(num_keys(stream)),
-      _group_offsets->begin(),
-      permuted_row_equality_comparator<true>(*device_input_table, sorted_order));
-  } else {
-    result_end = thrust::unique_copy(
-      exec->on(stream),
-      thrust::make_counting_iterator<size_type>(0),
-      thrust::make_counting_iterator<size_type>(num_keys(stream)),
-      _group_offsets->begin(),
-      permuted_row_equality_comparator<false>(*device_input_table, sorted_order));
-  }
+  // Pre-sorted keys are compared in their given order without materializing
+  // the identity sort order
+  auto const result_end = is_presorted()
+                            ? unique_copy(thrust::make_counting_iterator<size_type>(0))
+                            : unique_copy(key_sort_order().data<size_type>());
 
   size_type num_groups          = thrust::distance(_group_offsets->begin(), result_end);
   (*_group_offsets)[num_groups] = num_keys(stream);
@@ -208,6 +221,13 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_labels(cudaS
 }
 
 column_view sort_groupby_helper::unsorted_keys_labels(cudaStream_t stream) {
+  // The keys are in sorted order, so are their labels
+  if (is_presorted()) {
+    return column_view(data_type(type_to_id<size_type>()),
+                       group_labels(stream).size(),
+                       group_labels(stream).data().get());
+  }
+
   if (_unsorted_keys_labels) return _unsorted_keys_labels->view();
 
   column_ptr temp_labels = make_numeric_column(
@@ -273,6 +293,8 @@ sort_groupby_helper::column_ptr sort_groupby_helper::sorted_values(
 
 sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
   column_view const& values, rmm::mr::device_memory_resource* mr, cudaStream_t stream) {
+  if (is_presorted()) { return std::make_unique<column>(values, stream, mr); }
+
   auto gather_map = key_sort_order();
 
   auto grouped_values_table = cudf::experimental::detail::gather(
@@ -283,6 +305,11 @@ sort_groupby_helper::column_ptr sort_groupby_helper::grouped_values(
 
 std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::mr::device_memory_resource* mr,
                                                         cudaStream_t stream) {
+  if (is_presorted()) {
+    return cudf::experimental::detail::gather(
+      _keys, group_offsets().begin(), group_offsets().end() - 1, false, mr, stream);
+  }
+
   auto idx_data = key_sort_order().data<size_type>();
 
   auto gather_map_it = thrust::make_transform_iterator(
@@ -294,6 +321,8 @@ std::unique_ptr<table> sort_groupby_helper::unique_keys(rmm::mr::device_memory_r
 
 std::unique_ptr<table> sort_groupby_helper::sorted_keys(rmm::mr::device_memory_resource* mr,
                                                         cudaStream_t stream) {
+  if (is_presorted()) { return std::make_unique<table>(_keys, stream, mr); }
+
   return cudf::experimental::detail::gather(
     _keys, key_sort_order(), false, false, false, mr, stream);
 }
@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace groupby {
+namespace {
+
+/**
+ * @brief The partial results kept for one column of values
+ *
+ * The partial result columns of a column of values are, in this order, those
+ * of the members that are `true`. `moments` stands for three columns: the
+ * INT64 count, and the FLOAT64 mean and sum of squared deviations from the
+ * mean (M2) of the valid values.
+ */
+struct partial_columns {
+  bool sum{false};
+  bool count_valid{false};
+  bool count_all{false};
+  bool min{false};
+  bool max{false};
+  bool moments{false};
+
+  size_type size() const { return sum + count_valid + count_all + min + max + 3 * moments; }
+};
+
+partial_columns make_partial_columns(std::vector<std::unique_ptr<aggregation>> const& aggs) {
+  partial_columns partials{};
+  for (auto const& agg : aggs) {
+    switch (agg->kind) {
+      case aggregation::SUM: partials.sum = true; break;
+      case aggregation::COUNT_VALID: partials.count_valid = true; break;
+      case aggregation::COUNT_ALL: partials.count_all = true; break;
+      case aggregation::MIN: partials.min = true; break;
+      case aggregation::MAX: partials.max = true; break;
+      case aggregation::MEAN:
+        partials.sum         = true;
+        partials.count_valid = true;
+        break;
+      case aggregation::VARIANCE:
+      case aggregation::STD: partials.moments = true; break;
+      default: CUDF_FAIL("Unsupported aggregation in streaming groupby.");
+    }
+  }
+  return partials;
+}
+
+std::vector<partial_columns> make_partial_columns(
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggregations) {
+  std::vector<partial_columns> partials;
+  std::transform(aggregations.begin(),
+                 aggregations.end(),
+                 std::back_inserter(partials),
+                 [](auto const& aggs) { return make_partial_columns(aggs); });
+  return partials;
+}
+
+/**
+ * @brief Views of the partial result columns of one column of values, starting
+ * at column `first` of `partial_results`
+ */
+struct partial_views {
+  column_view sum, count_valid, count_all, min, max, count, mean, m2;
+
+  partial_views(table_view const& partial_results, size_type first, partial_columns const& p) {
+    if (p.sum) { sum = partial_results.column(first++); }
+    if (p.count_valid) { count_valid = partial_results.column(first++); }
+    if (p.count_all) { count_all = partial_results.column(first++); }
+    if (p.min) { min = partial_results.column(first++); }
+    if (p.max) { max = partial_results.column(first++); }
+    if (p.moments) {
+      count = partial_results.column(first++);
+      mean  = partial_results.column(first++);
+      m2    = partial_results.column(first++);
+    }
+  }
+};
+
+std::vector<size_type> column_range(size_type begin, size_type end) {
+  std::vector<size_type> indices(end - begin);
+  std::iota(indices.begin(), indices.end(), begin);
+  return indices;
+}
+
+/**
+ * @brief Combines the count, mean and M2 of the partial results of each group
+ * with the parallel algorithm of Chan et al.
+ */
+struct merge_moments_fn {
+  size_type const* offsets;
+  column_device_view counts;
+  column_device_view means;
+  column_device_view m2s;
+  mutable_column_device_view merged_counts;
+  mutable_column_device_view merged_means;
+  mutable_column_device_view merged_m2s;
+
+  __device__ void operator()(size_type group) {
+    int64_t count{0};
+    double mean{0};
+    double m2{0};
+    for (auto i = offsets[group]; i < offsets[group + 1]; ++i) {
+      auto const n = counts.element<int64_t>(i);
+      if (n == 0) { continue; }
+      auto const total = count + n;
+      auto const delta = means.element<double>(i) - mean;
+      mean += delta * n / total;
+      m2 += m2s.element<double>(i) + delta * delta * count * n / total;
+      count = total;
+    }
+
+    merged_counts.element<int64_t>(group) = count;
+    merged_means.element<double>(group)   = mean;
+    merged_m2s.element<double>(group)     = m2;
+    if (count == 0) {
+      merged_means.set_null(group);
+      merged_m2s.set_null(group);
+    } else {
+      merged_means.set_valid(group);
+      merged_m2s.set_valid(group);
+    }
+  }
+};
+
+std::vector<std::unique_ptr<column>> merge_moments(column_view const& counts,
+                                                   column_view const& means,
+                                                   column_view const& m2s,
+                                                   rmm::device_vector<size_type> const& offsets,
+                                                   rmm::mr::device_memory_resource* mr) {
+  size_type const num_groups = offsets.size() - 1;
+
+  std::vector<std::unique_ptr<column>> merged;
+  merged.push_back(
+    make_numeric_column(data_type(INT64), num_groups, mask_state::UNALLOCATED, 0, mr));
+  merged.push_back(
+    make_numeric_column(data_type(FLOAT64), num_groups, mask_state::UNINITIALIZED, 0, mr));
+  merged.push_back(
+    make_numeric_column(data_type(FLOAT64), num_groups, mask_state::UNINITIALIZED, 0, mr));
+
+  auto d_counts        = column_device_view::create(counts);
+  auto d_means         = column_device_view::create(means);
+  auto d_m2s           = column_device_view::create(m2s);
+  auto d_merged_counts = mutable_column_device_view::create(merged[0]->mutable_view());
+  auto d_merged_means  = mutable_column_device_view::create(merged[1]->mutable_view());
+  auto d_merged_m2s    = mutable_column_device_view::create(merged[2]->mutable_view());
+
+  thrust::for_each_n(rmm::exec_policy(0)->on(0),
+                     thrust::make_counting_iterator(0),
+                     num_groups,
+                     merge_moments_fn{offsets.data().get(),
+                                      *d_counts,
+                                      *d_means,
+                                      *d_m2s,
+                                      *d_merged_counts,
+                                      *d_merged_means,
+                                      *d_merged_m2s});
+  return merged;
+}
+
+/**
+ * @brief Computes the variance of each group from its count and M2
+ */
+struct variance_fn {
+  column_device_view counts;
+  column_device_view m2s;
+  mutable_column_device_view variances;
+  size_type ddof;
+
+  __device__ void operator()(size_type i) {
+    auto const count = counts.element<int64_t>(i);
+    if (count - ddof <= 0) {
+      variances.set_null(i);
+    } else {
+      variances.element<double>(i) = m2s.element<double>(i) / (count - ddof);
+      variances.set_valid(i);
+    }
+  }
+};
+
+std::unique_ptr<column> compute_variance(column_view const& counts,
+                                         column_view const& m2s,
+                                         size_type ddof,
+                                         rmm::mr::device_memory_resource* mr) {
+  auto variances =
+    make_numeric_column(data_type(FLOAT64), counts.size(), mask_state::UNINITIALIZED, 0, mr);
+
+  auto d_counts    = column_device_view::create(counts);
+  auto d_m2s       = column_device_view::create(m2s);
+  auto d_variances = mutable_column_device_view::create(variances->mutable_view());
+
+  thrust::for_each_n(rmm::exec_policy(0)->on(0),
+                     thrust::make_counting_iterator(0),
+                     counts.size(),
+                     variance_fn{*d_counts, *d_m2s, *d_variances, ddof});
+  return variances;
+}
+
+/**
+ * @brief Groups a chunk of rows and returns its unique keys followed by the
+ * partial results of each column of `values`
+ */
+std::unique_ptr<table> aggregate_chunk(table_view const& keys,
+                                       table_view const& values,
+                                       std::vector<partial_columns> const& partials,
+                                       include_nulls include_null_keys,
+                                       rmm::mr::device_memory_resource* mr) {
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    auto const& p      = partials[i];
+    auto& aggs         = requests[i].aggregations;
+    requests[i].values = values.column(i);
+    if (p.sum) { aggs.push_back(make_sum_aggregation()); }
+    if (p.count_valid) { aggs.push_back(make_count_aggregation()); }
+    if (p.count_all) { aggs.push_back(make_count_aggregation(include_nulls::YES)); }
+    if (p.min) { aggs.push_back(make_min_aggregation()); }
+    if (p.max) { aggs.push_back(make_max_aggregation()); }
+    if (p.moments) {
+      aggs.push_back(make_count_aggregation());
+      aggs.push_back(make_mean_aggregation());
+      aggs.push_back(make_variance_aggregation(0));
+    }
+  }
+
+  groupby gb(keys, include_null_keys);
+  auto result  = gb.aggregate(requests, mr);
+  auto columns = result.first->release();
+
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    auto const& p = partials[i];
+    auto& results = result.second[i].results;
+    auto next     = results.begin();
+    if (p.sum) { columns.push_back(std::move(*next++)); }
+    if (p.count_valid) { columns.push_back(cast(**next++, data_type(INT64), mr)); }
+    if (p.count_all) { columns.push_back(cast(**next++, data_type(INT64), mr)); }
+    if (p.min) { columns.push_back(std::move(*next++)); }
+    if (p.max) { columns.push_back(std::move(*next++)); }
+    if (p.moments) {
+      auto count    = cast(**next++, data_type(INT64), mr);
+      auto mean     = std::move(*next++);
+      auto variance = std::move(*next++);
+      // M2 is the variance with zero delta degrees of freedom times the count
+      auto m2 = binary_operation(*variance, *count, binary_operator::MUL, data_type(FLOAT64), mr);
+      columns.push_back(std::move(count));
+      columns.push_back(std::move(mean));
+      columns.push_back(std::move(m2));
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Combines the partial results of rows of `partial_results` with
+ * equal keys
+ */
+std::unique_ptr<table> combine_partials(table_view const& partial_results,
+                                        size_type num_key_columns,
+                                        std::vector<partial_columns> const& partials,
+                                        include_nulls include_null_keys,
+                                        rmm::mr::device_memory_resource* mr) {
+  if (partial_results.num_rows() == 0) { return std::make_unique<table>(partial_results, 0, mr); }
+
+  auto const keys = partial_results.select(column_range(0, num_key_columns));
+  auto const values =
+    partial_results.select(column_range(num_key_columns, partial_results.num_columns()));
+
+  groupby gb(keys, include_null_keys);
+  auto groups               = gb.get_groups(values);
+  auto const grouped_values = groups.values->view();
+
+  // The grouped keys are sorted, so the groups of this groupby are in the
+  // order of `groups.offsets`
+  groupby sorted_gb(groups.keys->view(), include_null_keys, sorted::YES);
+
+  std::vector<aggregation_request> requests;
+  auto add_request = [&requests, &grouped_values](size_type column,
+                                                  std::unique_ptr<aggregation>&& agg) {
+    requests.emplace_back();
+    requests.back().values = grouped_values.column(column);
+    requests.back().aggregations.push_back(std::move(agg));
+  };
+
+  size_type column = 0;
+  for (auto const& p : partials) {
+    if (p.sum) { add_request(column++, make_sum_aggregation()); }
+    if (p.count_valid) { add_request(column++, make_sum_aggregation()); }
+    if (p.count_all) { add_request(column++, make_sum_aggregation()); }
+    if (p.min) { add_request(column++, make_min_aggregation()); }
+    if (p.max) { add_request(column++, make_max_aggregation()); }
+    if (p.moments) { column += 3; }
+  }
+
+  auto result  = sorted_gb.aggregate(requests, mr);
+  auto columns = result.first->release();
+  rmm::device_vector<size_type> const offsets(groups.offsets);
+
+  auto next_result = result.second.begin();
+  column           = 0;
+  for (auto const& p : partials) {
+    for (auto i = 0; i < p.size() - 3 * p.moments; ++i, ++column) {
+      columns.push_back(std::move((next_result++)->results.front()));
+    }
+    if (p.moments) {
+      auto moments = merge_moments(grouped_values.column(column),
+                                   grouped_values.column(column + 1),
+                                   grouped_values.column(column + 2),
+                                   offsets,
+                                   mr);
+      std::move(moments.begin(), moments.end(), std::back_inserter(columns));
+      column += 3;
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
+
+streaming_groupby::streaming_groupby(
+  std::vector<std::vector<std::unique_ptr<aggregation>>>&& aggregations,
+  include_nulls include_null_keys)
+  : _aggregations{std::move(aggregations)}, _include_null_keys{include_null_keys} {
+  // Fails on unsupported aggregations
+  make_partial_columns(_aggregations);
+}
+
+// Needs to be in source file because table was forward declared
+streaming_groupby::~streaming_groupby() = default;
+
+void streaming_groupby::aggregate(table_view const& keys,
+                                  table_view const& values,
+                                  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Size mismatch between values and groupby keys.");
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == _aggregations.size(),
+               "Mismatch between the columns of values and the aggregations.");
+
+  auto const partials = make_partial_columns(_aggregations);
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    for (auto const& agg : _aggregations[i]) {
+      auto const needs_numeric = agg->kind == aggregation::MEAN or
+                                 agg->kind == aggregation::VARIANCE or
+                                 agg->kind == aggregation::STD;
+      CUDF_EXPECTS(not needs_numeric or is_numeric(values.column(i).type()),
+                   "MEAN, VARIANCE and STD are only supported on numeric values.");
+    }
+  }
+
+  auto chunk = aggregate_chunk(keys, values, partials, _include_null_keys, mr);
+  if (not _partial_results) {
+    _num_key_columns = keys.num_columns();
+    _partial_results = std::move(chunk);
+  } else {
+    merge(chunk->view(), keys.num_columns(), mr);
+  }
+}
+
+void streaming_groupby::merge(streaming_groupby const& other,
+                              rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  auto const partials       = make_partial_columns(_aggregations);
+  auto const other_partials = make_partial_columns(other._aggregations);
+  CUDF_EXPECTS(std::equal(partials.begin(),
+                          partials.end(),
+                          other_partials.begin(),
+                          other_partials.end(),
+                          [](auto const& lhs, auto const& rhs) {
+                            return lhs.sum == rhs.sum and lhs.count_valid == rhs.count_valid and
+                                   lhs.count_all == rhs.count_all and lhs.min == rhs.min and
+                                   lhs.max == rhs.max and lhs.moments == rhs.moments;
+                          }),
+               "Mismatch between the aggregations of the streaming groupbys.");
+
+  if (other._partial_results) { merge(other.partial_results(), other._num_key_columns, mr); }
+}
+
+void streaming_groupby::merge(table_view const& partial_results,
+                              size_type num_key_columns,
+                              rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  auto const partials = make_partial_columns(_aggregations);
+  auto const num_partial_columns =
+    std::accumulate(partials.begin(), partials.end(), size_type{0}, [](auto sum, auto const& p) {
+      return sum + p.size();
+    });
+  CUDF_EXPECTS(partial_results.num_columns() == num_key_columns + num_partial_columns,
+               "Mismatch between the partial results and the aggregations.");
+
+  if (not _partial_results) {
+    _num_key_columns = num_key_columns;
+    _partial_results = std::make_unique<table>(partial_results, 0, mr);
+    return;
+  }
+
+  CUDF_EXPECTS(num_key_columns == _num_key_columns and
+                 have_same_types(partial_results, _partial_results->view()),
+               "Mismatch between the column types of the partial results.");
+
+  auto const concatenated = concatenate({_partial_results->view(), partial_results});
+  _partial_results =
+    combine_partials(concatenated->view(), _num_key_columns, partials, _include_null_keys, mr);
+}
+
+table_view streaming_groupby::partial_results() const {
+  return _partial_results ? _partial_results->view() : table_view{};
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_groupby::finalize(
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_partial_results != nullptr, "No chunk was aggregated.");
+
+  auto const partial_results = _partial_results->view();
+  auto const partials        = make_partial_columns(_aggregations);
+
+  auto keys = std::make_unique<table>(
+    partial_results.select(column_range(0, _num_key_columns)), 0, mr);
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  size_type first = _num_key_columns;
+  for (size_t i = 0; i < _aggregations.size(); ++i) {
+    partial_views const views(partial_results, first, partials[i]);
+    first += partials[i].size();
+
+    for (auto const& agg : _aggregations[i]) {
+      auto& result = results[i].results;
+      switch (agg->kind) {
+        case aggregation::SUM: result.push_back(std::make_unique<column>(views.sum, 0, mr)); break;
+        case aggregation::COUNT_VALID:
+          result.push_back(std::make_unique<column>(views.count_valid, 0, mr));
+          break;
+        case aggregation::COUNT_ALL:
+          result.push_back(std::make_unique<column>(views.count_all, 0, mr));
+          break;
+        case aggregation::MIN: result.push_back(std::make_unique<column>(views.min, 0, mr)); break;
+        case aggregation::MAX: result.push_back(std::make_unique<column>(views.max, 0, mr)); break;
+        case aggregation::MEAN:
+          result.push_back(binary_operation(
+            views.sum, views.count_valid, binary_operator::DIV, data_type(FLOAT64), mr));
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD: {
+          auto const ddof =
+            static_cast<experimental::detail::std_var_aggregation const*>(agg.get())->_ddof;
+          if (agg->kind == aggregation::VARIANCE) {
+            result.push_back(compute_variance(views.count, views.m2, ddof, mr));
+          } else {
+            auto const variance = compute_variance(views.count, views.m2, ddof);
+            result.push_back(unary_operation(*variance, unary_op::SQRT, mr));
+          }
+          break;
+        }
+        default: CUDF_FAIL("Unsupported aggregation in streaming groupby.");
+      }
+    }
+  }
+  return std::make_pair(std::move(keys), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLOOM_FILTER_CUH
+#define BLOOM_FILTER_CUH
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+
+constexpr uint32_t DEFAULT_BLOOM_FILTER_BITS_PER_KEY = 16;
+
+/**---------------------------------------------------------------------------*
+ * @brief Non-owning device view of a blocked Bloom filter over 32-bit hashes.
+ *
+ * The filter is split into blocks of 256 bits (one 32-byte memory sector). A
+ * hash selects one block and sets one bit in each of its eight words, as in
+ * the split block Bloom filters of the Parquet format, so that every insert
+ * or lookup touches a single sector.
+ *
+ * A view without blocks is a disabled filter that accepts every hash.
+ *---------------------------------------------------------------------------**/
+struct bloom_filter_view {
+  static constexpr uint32_t words_per_block = 8;
+
+  uint32_t* blocks{nullptr};
+  uint32_t num_blocks{0};
+
+  __device__ void insert(uint32_t hash) {
+    if (num_blocks == 0) { return; }
+    uint32_t* block = blocks + block_index(hash) * words_per_block;
+    for (uint32_t i = 0; i < words_per_block; ++i) { atomicOr(block + i, bit_mask(hash, i)); }
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Returns `false` only if no key with `hash` was inserted
+   *---------------------------------------------------------------------------**/
+  __device__ bool might_contain(uint32_t hash) const {
+    if (num_blocks == 0) { return true; }
+    uint32_t const* block = blocks + block_index(hash) * words_per_block;
+    for (uint32_t i = 0; i < words_per_block; ++i) {
+      auto const mask = bit_mask(hash, i);
+      if ((block[i] & mask) != mask) { return false; }
+    }
+    return true;
+  }
+
+ private:
+  __device__ uint32_t block_index(uint32_t hash) const {
+    // Maps the hash onto [0, num_blocks) with its high bits, leaving the
+    // low bits used by the hash tables uncorrelated with the block
+    return static_cast<uint32_t>((static_cast<uint64_t>(hash) * num_blocks) >> 32);
+  }
+
+  __device__ static uint32_t bit_mask(uint32_t hash, uint32_t word) {
+    constexpr uint32_t salts[words_per_block] = {0x47b6137bU,
+                                                 0x44974d91U,
+                                                 0x8824ad5bU,
+                                                 0xa2b7289dU,
+                                                 0x705495c7U,
+                                                 0x2df1424bU,
+                                                 0x9efc4947U,
+                                                 0x5c6bfb31U};
+    return 1u << ((hash * salts[word]) >> 27);
+  }
+};
+
+/**---------------------------------------------------------------------------*
+ * @brief Owns the device memory of a blocked Bloom filter.
+ *
+ * The filter is sized for `num_keys` keys; a filter constructed for zero keys
+ * is disabled and its view accepts every hash.
+ *---------------------------------------------------------------------------**/
+class bloom_filter {
+ public:
+  /**---------------------------------------------------------------------------*
+   * @brief Allocates a cleared filter for `num_keys` keys.
+   *
+   * @param num_keys The number of keys that will be inserted
+   * @param stream CUDA stream to use for device operations.
+   * @param bits_per_key Bits of filter per key; 16 bits give a false positive
+   * rate well under 1%
+   *---------------------------------------------------------------------------**/
+  explicit bloom_filter(size_t num_keys,
+                        cudaStream_t stream   = 0,
+                        uint32_t bits_per_key = DEFAULT_BLOOM_FILTER_BITS_PER_KEY)
+    : _num_blocks(num_blocks_for(num_keys, bits_per_key)),
+      _blocks(_num_blocks * bloom_filter_view::words_per_block * sizeof(uint32_t), stream) {
+    if (_num_blocks > 0) { CUDA_TRY(cudaMemsetAsync(_blocks.data(), 0, _blocks.size(), stream)); }
+  }
+
+  bloom_filter_view view() const {
+    return bloom_filter_view{static_cast<uint32_t*>(const_cast<void*>(_blocks.data())),
+                             _num_blocks};
+  }
+
+ private:
+  static uint32_t num_blocks_for(size_t num_keys, uint32_t bits_per_key) {
+    constexpr size_t bits_per_block = bloom_filter_view::words_per_block * 32;
+    return static_cast<uint32_t>((num_keys * bits_per_key + bits_per_block - 1) / bits_per_block);
+  }
+
+  uint32_t _num_blocks;
+  rmm::device_buffer _blocks;
+};
+
+#endif  // BLOOM_FILTER_CUH
@@ -228,6 +228,10 @@ class concurrent_unordered_map {
 
   __host__ __device__ mapped_type get_unused_element() const { return m_unused_element; }
 
+  __host__ __device__ hasher get_hash_function() const { return m_hf; }
+
+  __host__ __device__ key_equal get_key_equal() const { return m_equal; }
+
   __host__ __device__ size_type capacity() const { return m_capacity; }
 
  private:
@@ -328,6 +332,29 @@ class concurrent_unordered_map {
       iterator(m_hashtbl_values, m_hashtbl_values + m_capacity, current_bucket), insert_success);
   }
 
+  /**---------------------------------------------------------------------------*
+   * @brief Attempts to insert a key, value pair into a map that may be full.
+   *
+   * Unlike `insert`, which probes until it finds a free slot, the probe stops
+   * after visiting every slot of the map once.
+   *
+   * @param insert_pair The key and value pair to insert
+   * @return `true` if the pair was inserted or its key was already present,
+   * `false` if the map is full
+   *---------------------------------------------------------------------------**/
+  __device__ bool try_insert(value_type const& insert_pair) {
+    const size_type key_hash{m_hf(insert_pair.first)};
+    size_type index{key_hash % m_capacity};
+
+    for (size_type probes = 0; probes < m_capacity; ++probes) {
+      if (attempt_insert(&m_hashtbl_values[index], insert_pair) != insert_result::CONTINUE) {
+        return true;
+      }
+      index = (index + 1) % m_capacity;
+    }
+    return false;
+  }
+
   /**---------------------------------------------------------------------------*
    * @brief Searches the map for the specified key.
    *
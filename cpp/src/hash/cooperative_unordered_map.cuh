@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATIVE_UNORDERED_MAP_CUH
+#define COOPERATIVE_UNORDERED_MAP_CUH
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+#include <utilities/legacy/device_atomics.cuh>
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <cooperative_groups.h>
+#include <thrust/pair.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+
+namespace cg = cooperative_groups;
+
+template <typename map_type, typename InputIt>
+__global__ void cooperative_insert_kernel(map_type map, InputIt first, size_t num_pairs);
+
+template <typename map_type,
+          typename InputIt,
+          typename OutputIt,
+          typename find_hasher,
+          typename find_key_equal>
+__global__ void cooperative_contains_kernel(map_type map,
+                                            InputIt first,
+                                            size_t num_keys,
+                                            OutputIt output,
+                                            find_hasher f_hash,
+                                            find_key_equal f_equal);
+
+/**
+ * @brief Open-addressing hash map whose keys are probed by a tile of threads
+ * at a time.
+ *
+ * The slots are grouped in buckets of `TileSize` consecutive slots. Each key
+ * is handled by a cooperative group of `TileSize` threads: every thread of the
+ * tile loads one slot of the bucket, and the tile compares the whole bucket
+ * in one step with a ballot. A key is only moved to the next bucket once the
+ * current bucket is full, so at high occupancy a probe touches far fewer
+ * cache lines than the slot-by-slot linear probing of
+ * `concurrent_unordered_map`, and the cost of an insert does not depend on
+ * whether the key, value pair fits a single `atomicCAS`.
+ *
+ * Supports concurrent insert, but not concurrent insert and find.
+ *
+ * The device functions must be called by all the threads of the tile with the
+ * same key; `insert()` and `contains()` launch kernels that do so.
+ *
+ * @note The user is responsible for the same stream semantics as for
+ * `concurrent_unordered_map`.
+ *
+ * @tparam TileSize Number of slots in a bucket and threads probing a key; a
+ * power of two no larger than the warp size
+ */
+template <typename Key,
+          typename Element,
+          typename Hasher    = default_hash<Key>,
+          typename Equality  = equal_to<Key>,
+          typename Allocator = default_allocator<thrust::pair<Key, Element>>,
+          uint32_t TileSize  = 4>
+class cooperative_unordered_map {
+  static_assert(TileSize > 0 && TileSize <= 32 && (TileSize & (TileSize - 1)) == 0,
+                "TileSize must be a power of two no larger than the warp size");
+
+ public:
+  using size_type      = size_t;
+  using hasher         = Hasher;
+  using key_equal      = Equality;
+  using allocator_type = Allocator;
+  using key_type       = Key;
+  using mapped_type    = Element;
+  using value_type     = thrust::pair<Key, Element>;
+
+  static constexpr uint32_t tile_size = TileSize;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Factory to construct a new cooperative unordered map.
+   *
+   * Returns a `std::unique_ptr` to a new map object. The map is non-owning and
+   * trivially copyable and should be passed by value into kernels. The
+   * `unique_ptr` contains a custom deleter that will free the map's contents.
+   *
+   * @note As for `concurrent_unordered_map`, empty slots hold
+   * (unused_key, unused_element), and inserting a key equal to `unused_key`
+   * results in undefined behavior.
+   *
+   * @param capacity The minimum number of pairs the map may hold; rounded up
+   * to a whole number of buckets
+   * @param unused_element The sentinel value to use for an empty value
+   * @param unused_key The sentinel value to use for an empty key
+   * @param hash_function The hash function to use for hashing keys
+   * @param equal The equality comparison function for comparing if two keys are
+   * equal
+   * @param allocator The allocator to use for allocation the hash table's
+   * storage
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  static auto create(size_type capacity,
+                     const mapped_type unused_element = std::numeric_limits<mapped_type>::max(),
+                     const key_type unused_key        = std::numeric_limits<key_type>::max(),
+                     const Hasher& hash_function      = hasher(),
+                     const Equality& equal            = key_equal(),
+                     const allocator_type& allocator  = allocator_type(),
+                     cudaStream_t stream              = 0) {
+    CUDF_FUNC_RANGE();
+    using Self = cooperative_unordered_map<Key, Element, Hasher, Equality, Allocator, TileSize>;
+
+    auto deleter = [stream](Self* p) { p->destroy(stream); };
+
+    return std::unique_ptr<Self, std::function<void(Self*)>>{
+      new Self(capacity, unused_element, unused_key, hash_function, equal, allocator, stream),
+      deleter};
+  }
+
+  __host__ __device__ value_type* data() const { return m_slots; }
+
+  __host__ __device__ key_type get_unused_key() const { return m_unused_key; }
+
+  __host__ __device__ mapped_type get_unused_element() const { return m_unused_element; }
+
+  __host__ __device__ size_type capacity() const { return m_num_buckets * TileSize; }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Attempts to insert a key, value pair into the map, cooperatively with
+   * the other threads of `tile`.
+   *
+   * @param tile The group of threads inserting `insert_pair`
+   * @param insert_pair The key and value pair to insert
+   * @return `true` on every thread of the tile if the pair was inserted,
+   * `false` if the key was already present
+   *---------------------------------------------------------------------------**/
+  template <typename Tile>
+  __device__ bool insert(Tile const& tile, value_type const& insert_pair) {
+    auto const lane = tile.thread_rank();
+    size_type bucket{m_hf(insert_pair.first) % m_num_buckets};
+
+    while (true) {
+      value_type* const slot   = &m_slots[bucket * TileSize + lane];
+      key_type const slot_key  = slot->first;
+      bool const slot_is_empty = (slot_key == m_unused_key);
+
+      if (tile.any(not slot_is_empty && m_equal(slot_key, insert_pair.first))) { return false; }
+
+      // Claim the empty slots of the bucket in lane order until one succeeds
+      auto empty_slots = tile.ballot(slot_is_empty);
+      while (empty_slots) {
+        auto const winner = __ffs(empty_slots) - 1;
+        int status        = 0;  // 0: slot taken by another key, 1: inserted, 2: duplicate
+        if (lane == winner) {
+          key_type const old_key = atomicCAS(&(slot->first), m_unused_key, insert_pair.first);
+          if (old_key == m_unused_key) {
+            slot->second = insert_pair.second;
+            status       = 1;
+          } else if (m_equal(old_key, insert_pair.first)) {
+            status = 2;
+          }
+        }
+        status = tile.shfl(status, winner);
+        if (status != 0) { return status == 1; }
+        empty_slots &= ~(1u << winner);
+      }
+
+      bucket = (bucket + 1) % m_num_buckets;
+    }
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Searches the map for the specified key, cooperatively with the other
+   * threads of `tile`.
+   *
+   * As with `concurrent_unordered_map::find`, the caller may use different
+   * hash and equality functions than those used for insertion, as long as the
+   * hash of a key is the same.
+   *
+   * @note `find` is not threadsafe with `insert`.
+   *
+   * @param tile The group of threads searching for `k`
+   * @param k The key to search for
+   * @param f_hash The hashing function to use to hash this key
+   * @param f_equal The equality function to use to compare this key with the
+   * contents of the hash table
+   * @return Pointer to the matching pair on every thread of the tile, or
+   * `nullptr` if the key is not present
+   *---------------------------------------------------------------------------**/
+  template <typename Tile, typename find_hasher, typename find_key_equal>
+  __device__ value_type* find(Tile const& tile,
+                              key_type const& k,
+                              find_hasher f_hash,
+                              find_key_equal f_equal) const {
+    auto const lane = tile.thread_rank();
+    size_type bucket{f_hash(k) % m_num_buckets};
+
+    while (true) {
+      value_type* const slot   = &m_slots[bucket * TileSize + lane];
+      key_type const slot_key  = slot->first;
+      bool const slot_is_empty = (slot_key == m_unused_key);
+
+      auto const matches = tile.ballot(not slot_is_empty && f_equal(k, slot_key));
+      if (matches) { return &m_slots[bucket * TileSize + __ffs(matches) - 1]; }
+
+      // Keys are only placed past a bucket once it is full
+      if (tile.any(slot_is_empty)) { return nullptr; }
+
+      bucket = (bucket + 1) % m_num_buckets;
+    }
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @copydoc find(Tile const&, key_type const&, find_hasher, find_key_equal)
+   *---------------------------------------------------------------------------**/
+  template <typename Tile>
+  __device__ value_type* find(Tile const& tile, key_type const& k) const {
+    return find(tile, k, m_hf, m_equal);
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Inserts the key, value pairs of `[first, last)` into the map.
+   *
+   * Pairs whose key is already present are not inserted.
+   *
+   * @param first Beginning of the device-accessible sequence of pairs
+   * @param last End of the sequence of pairs
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last, cudaStream_t stream = 0) {
+    auto const num_pairs = std::distance(first, last);
+    if (num_pairs == 0) { return; }
+    cooperative_insert_kernel<<<grid_size(num_pairs), block_size, 0, stream>>>(
+      *this, first, num_pairs);
+    CUDA_TRY(cudaGetLastError());
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Writes to `output[i]` whether the key `first[i]` is present in the map.
+   *
+   * @param first Beginning of the device-accessible sequence of keys
+   * @param last End of the sequence of keys
+   * @param output Beginning of the device-accessible output sequence of bools
+   * @param f_hash The hashing function to use to hash the keys
+   * @param f_equal The equality function to use to compare the keys with the
+   * contents of the hash table
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  template <typename InputIt, typename OutputIt, typename find_hasher, typename find_key_equal>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output,
+                find_hasher f_hash,
+                find_key_equal f_equal,
+                cudaStream_t stream = 0) const {
+    auto const num_keys = std::distance(first, last);
+    if (num_keys == 0) { return; }
+    cooperative_contains_kernel<<<grid_size(num_keys), block_size, 0, stream>>>(
+      *this, first, num_keys, output, f_hash, f_equal);
+    CUDA_TRY(cudaGetLastError());
+  }
+
+  void clear_async(cudaStream_t stream = 0) {
+    init_hashtbl<<<((capacity() - 1) / block_size) + 1, block_size, 0, stream>>>(
+      m_slots, capacity(), m_unused_key, m_unused_element);
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Frees the contents of the map and destroys the map object.
+   *
+   * This function is invoked as the deleter of the `std::unique_ptr` returned
+   * from the `create()` factory function.
+   *
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  void destroy(cudaStream_t stream = 0) {
+    m_allocator.deallocate(m_slots, capacity(), stream);
+    delete this;
+  }
+
+  cooperative_unordered_map()                                 = delete;
+  cooperative_unordered_map(cooperative_unordered_map const&) = default;
+  cooperative_unordered_map(cooperative_unordered_map&&)      = default;
+  cooperative_unordered_map& operator=(cooperative_unordered_map const&) = default;
+  cooperative_unordered_map& operator=(cooperative_unordered_map&&) = default;
+  ~cooperative_unordered_map()                                      = default;
+
+ private:
+  static constexpr int block_size = 128;
+
+  static int grid_size(size_t num_keys) {
+    constexpr size_t keys_per_block = block_size / TileSize;
+    constexpr size_t max_grid_size  = 65535;
+    return static_cast<int>(
+      std::min((num_keys + keys_per_block - 1) / keys_per_block, max_grid_size));
+  }
+
+  hasher m_hf;
+  key_equal m_equal;
+  mapped_type m_unused_element;
+  key_type m_unused_key;
+  allocator_type m_allocator;
+  size_type m_num_buckets;
+  value_type* m_slots;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Private constructor used by `create` factory function.
+   *---------------------------------------------------------------------------**/
+  cooperative_unordered_map(size_type capacity,
+                            const mapped_type unused_element,
+                            const key_type unused_key,
+                            const Hasher& hash_function,
+                            const Equality& equal,
+                            const allocator_type& allocator,
+                            cudaStream_t stream = 0)
+    : m_hf(hash_function),
+      m_equal(equal),
+      m_unused_element(unused_element),
+      m_unused_key(unused_key),
+      m_allocator(allocator),
+      m_num_buckets(std::max<size_type>((capacity + TileSize - 1) / TileSize, 1)) {
+    m_slots = m_allocator.allocate(this->capacity(), stream);
+    clear_async(stream);
+    CUDA_TRY(cudaGetLastError());
+  }
+};
+
+/**
+ * @brief Inserts `num_pairs` pairs into `map`, one pair per tile of threads
+ */
+template <typename map_type, typename InputIt>
+__global__ void cooperative_insert_kernel(map_type map, InputIt first, size_t num_pairs) {
+  auto tile = cg::tiled_partition<map_type::tile_size>(cg::this_thread_block());
+  auto const tiles_per_grid = (gridDim.x * blockDim.x) / map_type::tile_size;
+  // All threads of a tile share the pair index, keeping the loop tile-uniform
+  for (size_t i = (blockIdx.x * blockDim.x + threadIdx.x) / map_type::tile_size; i < num_pairs;
+       i += tiles_per_grid) {
+    map.insert(tile, *(first + i));
+  }
+}
+
+/**
+ * @brief Looks up `num_keys` keys in `map`, one key per tile of threads
+ */
+template <typename map_type,
+          typename InputIt,
+          typename OutputIt,
+          typename find_hasher,
+          typename find_key_equal>
+__global__ void cooperative_contains_kernel(map_type map,
+                                            InputIt first,
+                                            size_t num_keys,
+                                            OutputIt output,
+                                            find_hasher f_hash,
+                                            find_key_equal f_equal) {
+  auto tile = cg::tiled_partition<map_type::tile_size>(cg::this_thread_block());
+  auto const tiles_per_grid = (gridDim.x * blockDim.x) / map_type::tile_size;
+  for (size_t i = (blockIdx.x * blockDim.x + threadIdx.x) / map_type::tile_size; i < num_keys;
+       i += tiles_per_grid) {
+    auto const found = map.find(tile, *(first + i), f_hash, f_equal) != nullptr;
+    if (tile.thread_rank() == 0) { *(output + i) = found; }
+  }
+}
+
+#endif  // COOPERATIVE_UNORDERED_MAP_CUH
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COOPERATIVE_UNORDERED_SET_CUH
+#define COOPERATIVE_UNORDERED_SET_CUH
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <hash/bloom_filter.cuh>
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cooperative_groups.h>
+#include <thrust/fill.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+
+namespace cg = cooperative_groups;
+
+template <typename set_type, typename InputIt>
+__global__ void cooperative_set_insert_kernel(set_type set,
+                                              InputIt first,
+                                              size_t num_keys,
+                                              bloom_filter_view filter);
+
+template <typename set_type,
+          typename InputIt,
+          typename OutputIt,
+          typename find_hasher,
+          typename find_key_equal>
+__global__ void cooperative_set_contains_kernel(set_type set,
+                                                InputIt first,
+                                                size_t num_keys,
+                                                OutputIt output,
+                                                find_hasher f_hash,
+                                                find_key_equal f_equal,
+                                                bloom_filter_view filter);
+
+/**
+ * @brief Open-addressing hash set whose keys are probed by a tile of threads
+ * at a time.
+ *
+ * The set is laid out and probed as `cooperative_unordered_map`, but its
+ * slots only hold keys: for existence queries such as semi and anti joins
+ * the table is half the size of a map of (key, bool) pairs, so twice as many
+ * slots fit in a bucket's cache lines, and an insert is a single `atomicCAS`
+ * of the key.
+ *
+ * Supports concurrent insert, but not concurrent insert and find.
+ *
+ * The bulk `insert()` and `contains()` optionally maintain and check a Bloom
+ * filter of the hashes of the keys, so that most probes of absent keys skip
+ * the table entirely.
+ *
+ * @note The user is responsible for the same stream semantics as for
+ * `concurrent_unordered_map`.
+ *
+ * @tparam TileSize Number of slots in a bucket and threads probing a key; a
+ * power of two no larger than the warp size
+ */
+template <typename Key,
+          typename Hasher    = default_hash<Key>,
+          typename Equality  = equal_to<Key>,
+          typename Allocator = default_allocator<Key>,
+          uint32_t TileSize  = 4>
+class cooperative_unordered_set {
+  static_assert(TileSize > 0 && TileSize <= 32 && (TileSize & (TileSize - 1)) == 0,
+                "TileSize must be a power of two no larger than the warp size");
+
+ public:
+  using size_type      = size_t;
+  using hasher         = Hasher;
+  using key_equal      = Equality;
+  using allocator_type = Allocator;
+  using key_type       = Key;
+  using value_type     = Key;
+
+  static constexpr uint32_t tile_size = TileSize;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Factory to construct a new cooperative unordered set.
+   *
+   * Returns a `std::unique_ptr` to a new set object. The set is non-owning and
+   * trivially copyable and should be passed by value into kernels. The
+   * `unique_ptr` contains a custom deleter that will free the set's contents.
+   *
+   * @note Empty slots hold `unused_key`, and inserting a key equal to
+   * `unused_key` results in undefined behavior.
+   *
+   * @param capacity The minimum number of keys the set may hold; rounded up
+   * to a whole number of buckets
+   * @param unused_key The sentinel value to use for an empty slot
+   * @param hash_function The hash function to use for hashing keys
+   * @param equal The equality comparison function for comparing if two keys are
+   * equal
+   * @param allocator The allocator to use for allocation the hash table's
+   * storage
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  static auto create(size_type capacity,
+                     const key_type unused_key       = std::numeric_limits<key_type>::max(),
+                     const Hasher& hash_function     = hasher(),
+                     const Equality& equal           = key_equal(),
+                     const allocator_type& allocator = allocator_type(),
+                     cudaStream_t stream             = 0) {
+    CUDF_FUNC_RANGE();
+    using Self = cooperative_unordered_set<Key, Hasher, Equality, Allocator, TileSize>;
+
+    auto deleter = [stream](Self* p) { p->destroy(stream); };
+
+    return std::unique_ptr<Self, std::function<void(Self*)>>{
+      new Self(capacity, unused_key, hash_function, equal, allocator, stream), deleter};
+  }
+
+  __host__ __device__ key_type* data() const { return m_slots; }
+
+  __host__ __device__ key_type get_unused_key() const { return m_unused_key; }
+
+  __host__ __device__ size_type capacity() const { return m_num_buckets * TileSize; }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Attempts to insert a key into the set, cooperatively with the other
+   * threads of `tile`.
+   *
+   * @param tile The group of threads inserting `key`
+   * @param key The key to insert
+   * @param hash The hash of `key` by the set's hash function
+   * @return `true` on every thread of the tile if the key was inserted,
+   * `false` if it was already present
+   *---------------------------------------------------------------------------**/
+  template <typename Tile>
+  __device__ bool insert(Tile const& tile, key_type const& key, uint32_t hash) {
+    auto const lane = tile.thread_rank();
+    size_type bucket{hash % m_num_buckets};
+
+    while (true) {
+      key_type* const slot     = &m_slots[bucket * TileSize + lane];
+      key_type const slot_key  = *slot;
+      bool const slot_is_empty = (slot_key == m_unused_key);
+
+      if (tile.any(not slot_is_empty && m_equal(slot_key, key))) { return false; }
+
+      // Claim the empty slots of the bucket in lane order until one succeeds
+      auto empty_slots = tile.ballot(slot_is_empty);
+      while (empty_slots) {
+        auto const winner = __ffs(empty_slots) - 1;
+        int status        = 0;  // 0: slot taken by another key, 1: inserted, 2: duplicate
+        if (lane == winner) {
+          key_type const old_key = atomicCAS(slot, m_unused_key, key);
+          if (old_key == m_unused_key) {
+            status = 1;
+          } else if (m_equal(old_key, key)) {
+            status = 2;
+          }
+        }
+        status = tile.shfl(status, winner);
+        if (status != 0) { return status == 1; }
+        empty_slots &= ~(1u << winner);
+      }
+
+      bucket = (bucket + 1) % m_num_buckets;
+    }
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Indicates whether the set holds a key equal to `k`, cooperatively
+   * with the other threads of `tile`.
+   *
+   * As with `concurrent_unordered_map::find`, the caller may use a different
+   * equality function than the one used for insertion, as long as `hash` is
+   * the hash the key would be inserted with.
+   *
+   * @note `contains` is not threadsafe with `insert`.
+   *
+   * @param tile The group of threads searching for `k`
+   * @param k The key to search for
+   * @param hash The hash of `k`
+   * @param f_equal The equality function to use to compare this key with the
+   * contents of the hash table
+   * @return `true` on every thread of the tile if the key is present
+   *---------------------------------------------------------------------------**/
+  template <typename Tile, typename find_key_equal>
+  __device__ bool contains(Tile const& tile,
+                           key_type const& k,
+                           uint32_t hash,
+                           find_key_equal f_equal) const {
+    auto const lane = tile.thread_rank();
+    size_type bucket{hash % m_num_buckets};
+
+    while (true) {
+      key_type const slot_key  = m_slots[bucket * TileSize + lane];
+      bool const slot_is_empty = (slot_key == m_unused_key);
+
+      if (tile.any(not slot_is_empty && f_equal(k, slot_key))) { return true; }
+
+      // Keys are only placed past a bucket once it is full
+      if (tile.any(slot_is_empty)) { return false; }
+
+      bucket = (bucket + 1) % m_num_buckets;
+    }
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Inserts the keys of `[first, last)` into the set.
+   *
+   * Keys that are already present are not inserted.
+   *
+   * @param first Beginning of the device-accessible sequence of keys
+   * @param last End of the sequence of keys
+   * @param filter Bloom filter the hashes of the keys are also inserted into;
+   * a disabled filter by default
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  template <typename InputIt>
+  void insert(InputIt first,
+              InputIt last,
+              bloom_filter_view filter = bloom_filter_view{},
+              cudaStream_t stream      = 0) {
+    auto const num_keys = std::distance(first, last);
+    if (num_keys == 0) { return; }
+    cooperative_set_insert_kernel<<<grid_size(num_keys), block_size, 0, stream>>>(
+      *this, first, num_keys, filter);
+    CUDA_TRY(cudaGetLastError());
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Writes to `output[i]` whether the key `first[i]` is present in the set.
+   *
+   * @param first Beginning of the device-accessible sequence of keys
+   * @param last End of the sequence of keys
+   * @param output Beginning of the device-accessible output sequence of bools
+   * @param f_hash The hashing function to use to hash the keys
+   * @param f_equal The equality function to use to compare the keys with the
+   * contents of the hash table
+   * @param filter The Bloom filter built by `insert()`, checked before the
+   * table; a disabled filter by default
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  template <typename InputIt, typename OutputIt, typename find_hasher, typename find_key_equal>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output,
+                find_hasher f_hash,
+                find_key_equal f_equal,
+                bloom_filter_view filter = bloom_filter_view{},
+                cudaStream_t stream      = 0) const {
+    auto const num_keys = std::distance(first, last);
+    if (num_keys == 0) { return; }
+    cooperative_set_contains_kernel<<<grid_size(num_keys), block_size, 0, stream>>>(
+      *this, first, num_keys, output, f_hash, f_equal, filter);
+    CUDA_TRY(cudaGetLastError());
+  }
+
+  __device__ hasher const& hash_function() const { return m_hf; }
+
+  void clear_async(cudaStream_t stream = 0) {
+    thrust::fill_n(rmm::exec_policy(stream)->on(stream), m_slots, capacity(), m_unused_key);
+  }
+
+  /**---------------------------------------------------------------------------*
+   * @brief Frees the contents of the set and destroys the set object.
+   *
+   * This function is invoked as the deleter of the `std::unique_ptr` returned
+   * from the `create()` factory function.
+   *
+   * @param stream CUDA stream to use for device operations.
+   *---------------------------------------------------------------------------**/
+  void destroy(cudaStream_t stream = 0) {
+    m_allocator.deallocate(m_slots, capacity(), stream);
+    delete this;
+  }
+
+  cooperative_unordered_set()                                 = delete;
+  cooperative_unordered_set(cooperative_unordered_set const&) = default;
+  cooperative_unordered_set(cooperative_unordered_set&&)      = default;
+  cooperative_unordered_set& operator=(cooperative_unordered_set const&) = default;
+  cooperative_unordered_set& operator=(cooperative_unordered_set&&) = default;
+  ~cooperative_unordered_set()                                      = default;
+
+ private:
+  static constexpr int block_size = 128;
+
+  static int grid_size(size_t num_keys) {
+    constexpr size_t keys_per_block = block_size / TileSize;
+    constexpr size_t max_grid_size  = 65535;
+    return static_cast<int>(
+      std::min((num_keys + keys_per_block - 1) / keys_per_block, max_grid_size));
+  }
+
+  hasher m_hf;
+  key_equal m_equal;
+  key_type m_unused_key;
+  allocator_type m_allocator;
+  size_type m_num_buckets;
+  key_type* m_slots;
+
+  /**---------------------------------------------------------------------------*
+   * @brief Private constructor used by `create` factory function.
+   *---------------------------------------------------------------------------**/
+  cooperative_unordered_set(size_type capacity,
+                            const key_type unused_key,
+                            const Hasher& hash_function,
+                            const Equality& equal,
+                            const allocator_type& allocator,
+                            cudaStream_t stream = 0)
+    : m_hf(hash_function),
+      m_equal(equal),
+      m_unused_key(unused_key),
+      m_allocator(allocator),
+      m_num_buckets(std::max<size_type>((capacity + TileSize - 1) / TileSize, 1)) {
+    m_slots = m_allocator.allocate(this->capacity(), stream);
+    clear_async(stream);
+  }
+};
+
+/**
+ * @brief Inserts `num_keys` keys into `set`, and their hashes into `filter`,
+ * one key per tile of threads
+ */
+template <typename set_type, typename InputIt>
+__global__ void cooperative_set_insert_kernel(set_type set,
+                                              InputIt first,
+                                              size_t num_keys,
+                                              bloom_filter_view filter) {
+  auto tile = cg::tiled_partition<set_type::tile_size>(cg::this_thread_block());
+  auto const tiles_per_grid = (gridDim.x * blockDim.x) / set_type::tile_size;
+  // All threads of a tile share the key index, keeping the loop tile-uniform
+  for (size_t i = (blockIdx.x * blockDim.x + threadIdx.x) / set_type::tile_size; i < num_keys;
+       i += tiles_per_grid) {
+    auto const key  = *(first + i);
+    auto const hash = static_cast<uint32_t>(set.hash_function()(key));
+    if (tile.thread_rank() == 0) { filter.insert(hash); }
+    set.insert(tile, key, hash);
+  }
+}
+
+/**
+ * @brief Looks up `num_keys` keys in `set`, one key per tile of threads
+ *
+ * Keys rejected by `filter` are not looked up in the table.
+ */
+template <typename set_type,
+          typename InputIt,
+          typename OutputIt,
+          typename find_hasher,
+          typename find_key_equal>
+__global__ void cooperative_set_contains_kernel(set_type set,
+                                                InputIt first,
+                                                size_t num_keys,
+                                                OutputIt output,
+                                                find_hasher f_hash,
+                                                find_key_equal f_equal,
+                                                bloom_filter_view filter) {
+  auto tile = cg::tiled_partition<set_type::tile_size>(cg::this_thread_block());
+  auto const tiles_per_grid = (gridDim.x * blockDim.x) / set_type::tile_size;
+  for (size_t i = (blockIdx.x * blockDim.x + threadIdx.x) / set_type::tile_size; i < num_keys;
+       i += tiles_per_grid) {
+    auto const key  = *(first + i);
+    auto const hash = static_cast<uint32_t>(f_hash(key));
+    // The filter check is uniform across the tile, since all its threads hash the same key
+    auto const found = filter.might_contain(hash) && set.contains(tile, key, hash, f_equal);
+    if (tile.thread_rank() == 0) { *(output + i) = found; }
+  }
+}
+
+#endif  // COOPERATIVE_UNORDERED_SET_CUH
@@ -22,11 +22,14 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/partitioning.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
 #include <thrust/tabulate.h>
 
+#include <limits>
+
 namespace cudf {
 
 namespace {
@@ -599,6 +602,108 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
   }
 }
 
+/**
+ * @brief Computes the hash value of each row of `input` into a column of
+ * `output_type`
+ *
+ * @tparam row_hasher_t Row hasher constructed from the table and `seed`
+ * @tparam hash_function Hash functor to use for hashing elements
+ */
+template <template <template <typename> class, bool> class row_hasher_t,
+          template <typename> class hash_function,
+          typename output_type,
+          typename seed_type>
+std::unique_ptr<column> hash_rows(table_view const& input,
+                                  seed_type seed,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream) {
+  auto output = make_numeric_column(data_type(experimental::type_to_id<output_type>()),
+                                    input.num_rows(),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto output_view        = output->mutable_view();
+  if (has_nulls(input)) {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<output_type>(),
+                     output_view.end<output_type>(),
+                     row_hasher_t<hash_function, true>(*device_input, seed));
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<output_type>(),
+                     output_view.end<output_type>(),
+                     row_hasher_t<hash_function, false>(*device_input, seed));
+  }
+  return output;
+}
+
+// Hash strings with a warp per row if they average at least this many bytes
+constexpr int64_t WARP_PER_STRING_MIN_AVERAGE_BYTES = 256;
+constexpr size_type WARP_PER_STRING_BLOCK_SIZE      = 256;
+
+/**
+ * @brief Returns whether `input` is a single column of strings long enough to
+ * be hashed faster by a warp per row than by a thread per row
+ */
+bool is_long_strings_table(table_view const& input) {
+  if (input.num_columns() != 1 || input.column(0).type().id() != STRING) { return false; }
+  auto const chars_size = strings_column_view(input.column(0)).chars_size();
+  return chars_size >= WARP_PER_STRING_MIN_AVERAGE_BYTES * input.num_rows();
+}
+
+/**
+ * @brief Computes the hash value of each row of a table of one strings column
+ * as `row_hasher<MurmurHash3_32>` does, with a warp per row
+ */
+template <bool has_nulls>
+__global__ void hash_strings_warp_per_row(column_device_view strings,
+                                          hash_value_type seed,
+                                          int32_t* output) {
+  using experimental::detail::warp_size;
+  size_type const num_warps = (gridDim.x * blockDim.x) / warp_size;
+  for (size_type row = (threadIdx.x + blockIdx.x * blockDim.x) / warp_size; row < strings.size();
+       row += num_warps) {
+    // The row is the same on every lane, so the warp takes the same branch
+    hash_value_type hash = std::numeric_limits<hash_value_type>::max();
+    if (not has_nulls or strings.is_valid(row)) {
+      hash = murmur_hash3_32_warp(strings.element<string_view>(row), seed);
+    }
+    if (threadIdx.x % warp_size == 0) {
+      output[row] = MurmurHash3_32<hash_value_type>{}.hash_combine(0, hash);
+    }
+  }
+}
+
+/**
+ * @brief Computes as `hash_rows<row_hasher, MurmurHash3_32>` the hash value of
+ * each row of a table of one strings column, with a warp per row
+ */
+std::unique_ptr<column> hash_long_strings(column_view const& strings,
+                                          hash_value_type seed,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream) {
+  auto output = make_numeric_column(
+    data_type(INT32), strings.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const d_strings       = column_device_view::create(strings, stream);
+  auto const warps_per_block = WARP_PER_STRING_BLOCK_SIZE / experimental::detail::warp_size;
+  auto const num_blocks      = util::div_rounding_up_safe(strings.size(), warps_per_block);
+  auto const d_output        = output->mutable_view().data<int32_t>();
+  if (strings.has_nulls()) {
+    hash_strings_warp_per_row<true>
+      <<<num_blocks, WARP_PER_STRING_BLOCK_SIZE, 0, stream>>>(*d_strings, seed, d_output);
+  } else {
+    hash_strings_warp_per_row<false>
+      <<<num_blocks, WARP_PER_STRING_BLOCK_SIZE, 0, stream>>>(*d_strings, seed, d_output);
+  }
+  CHECK_CUDA(stream);
+  return output;
+}
+
 }  // namespace
 
 namespace detail {
@@ -635,6 +740,10 @@ std::unique_ptr<column> hash(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
+  if (initial_hash.empty() && is_long_strings_table(input)) {
+    return hash_long_strings(input.column(0), 0, mr, stream);
+  }
+
   bool const nullable     = has_nulls(input);
   auto const device_input = table_device_view::create(input, stream);
   auto output_view        = output->mutable_view();
@@ -675,6 +784,33 @@ std::unique_ptr<column> hash(table_view const& input,
   return output;
 }
 
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             uint64_t seed,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) {
+  CUDF_EXPECTS(hash_function == hash_id::HASH_XXHASH64 ||
+                 seed <= std::numeric_limits<hash_value_type>::max(),
+               "Seed of a 32-bit hash function must fit in 32 bits");
+  auto const seed32 = static_cast<hash_value_type>(seed);
+
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      if (input.num_rows() > 0 && is_long_strings_table(input)) {
+        return hash_long_strings(input.column(0), seed32, mr, stream);
+      }
+      return hash_rows<experimental::row_hasher, MurmurHash3_32, int32_t>(
+        input, seed32, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return hash_rows<experimental::seeded_row_hasher, SparkMurmurHash3_32, int32_t>(
+        input, seed32, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return hash_rows<experimental::seeded_row_hasher, XXHash_64, int64_t>(
+        input, seed, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
@@ -684,4 +820,12 @@ std::unique_ptr<column> hash(table_view const& input,
   return detail::hash(input, initial_hash, mr);
 }
 
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             uint64_t seed,
+                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::hash(input, hash_function, seed, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file reader_impl.cpp
+ * @brief cuDF-IO Arrow IPC reader class implementation
+ */
+
+#include "reader_impl.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <arrow/io/memory.h>
+#include <arrow/ipc/api.h>
+#include <arrow/util/bit_util.h>
+
+#include <cstring>
+#include <limits>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+
+namespace {
+
+/**
+ * @brief Returns the column type of an Arrow type
+ */
+data_type to_cudf_type(arrow::DataType const &type) {
+  switch (type.id()) {
+    case arrow::Type::BOOL: return data_type{BOOL8};
+    case arrow::Type::INT8: return data_type{INT8};
+    case arrow::Type::INT16: return data_type{INT16};
+    case arrow::Type::INT32: return data_type{INT32};
+    case arrow::Type::INT64: return data_type{INT64};
+    case arrow::Type::FLOAT: return data_type{FLOAT32};
+    case arrow::Type::DOUBLE: return data_type{FLOAT64};
+    case arrow::Type::DATE32: return data_type{TIMESTAMP_DAYS};
+    case arrow::Type::TIMESTAMP:
+      // Time zones are not part of cudf timestamps
+      switch (static_cast<arrow::TimestampType const &>(type).unit()) {
+        case arrow::TimeUnit::SECOND: return data_type{TIMESTAMP_SECONDS};
+        case arrow::TimeUnit::MILLI: return data_type{TIMESTAMP_MILLISECONDS};
+        case arrow::TimeUnit::MICRO: return data_type{TIMESTAMP_MICROSECONDS};
+        default: return data_type{TIMESTAMP_NANOSECONDS};
+      }
+    case arrow::Type::STRING: return data_type{STRING};
+    default: CUDF_FAIL("Unsupported Arrow type: " + type.ToString());
+  }
+}
+
+/**
+ * @brief Unpacks `size` bits of an Arrow bitmap starting at bit `offset`
+ * into a bitmap starting at bit zero
+ */
+std::vector<uint8_t> unpack_bits(uint8_t const *bits, int64_t offset, size_type size) {
+  std::vector<uint8_t> out((size + 7) / 8, 0);
+  for (size_type i = 0; i < size; ++i) {
+    if (arrow::BitUtil::GetBit(bits, offset + i)) { out[i / 8] |= 1 << (i % 8); }
+  }
+  return out;
+}
+
+}  // namespace
+
+reader::impl::impl(std::unique_ptr<datasource> source,
+                   reader_options const &options,
+                   rmm::mr::device_memory_resource *mr)
+  : _mr(mr), _source(std::move(source)), _columns(options.columns) {}
+
+std::shared_ptr<arrow::Schema> reader::impl::read_batches(
+  std::vector<std::shared_ptr<arrow::RecordBatch>> &batches) {
+  _buffer = _source->get_buffer(0, _source->size());
+  arrow::io::BufferReader input(_buffer);
+
+  // The file format begins with its magic bytes, the stream format with a message
+  constexpr char file_magic[] = "ARROW1";
+  constexpr auto magic_size   = sizeof(file_magic) - 1;
+  if (_buffer->size() >= static_cast<int64_t>(magic_size) &&
+      std::memcmp(_buffer->data(), file_magic, magic_size) == 0) {
+    std::shared_ptr<arrow::ipc::RecordBatchFileReader> reader;
+    CUDF_EXPECTS(arrow::ipc::RecordBatchFileReader::Open(&input, &reader).ok(),
+                 "Cannot open the Arrow IPC file");
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      CUDF_EXPECTS(reader->ReadRecordBatch(i, &batch).ok(), "Cannot read an Arrow record batch");
+      batches.push_back(std::move(batch));
+    }
+    return reader->schema();
+  }
+
+  std::shared_ptr<arrow::RecordBatchReader> reader;
+  CUDF_EXPECTS(arrow::ipc::RecordBatchStreamReader::Open(&input, &reader).ok(),
+               "Cannot open the Arrow IPC stream");
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    CUDF_EXPECTS(reader->ReadNext(&batch).ok(), "Cannot read an Arrow record batch");
+    if (batch == nullptr) { break; }
+    batches.push_back(std::move(batch));
+  }
+  return reader->schema();
+}
+
+std::unique_ptr<column> reader::impl::array_to_column(arrow::Array const &array,
+                                                      data_type type,
+                                                      cudaStream_t stream) {
+  CUDF_EXPECTS(array.length() <= std::numeric_limits<size_type>::max(),
+               "Arrow array exceeds the column size limit");
+  auto const num_rows = static_cast<size_type>(array.length());
+  if (num_rows == 0) { return make_empty_column(type); }
+  auto const offset     = array.offset();
+  auto const null_count = static_cast<size_type>(array.null_count());
+  auto const &buffers   = array.data()->buffers;
+
+  // Copies from temporary host data are synchronized before it is freed
+  auto const copy_to_device = [stream](void *dst, void const *src, size_t size, bool sync) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyHostToDevice, stream));
+    if (sync) { CUDF_STREAM_SYNC(stream); }
+  };
+
+  rmm::device_buffer null_mask{};
+  if (null_count > 0) {
+    null_mask = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, _mr);
+    auto const bits = array.null_bitmap_data();
+    if (offset % 8 == 0) {
+      copy_to_device(null_mask.data(), bits + offset / 8, (num_rows + 7) / 8, false);
+    } else {
+      auto const unpacked = unpack_bits(bits, offset, num_rows);
+      copy_to_device(null_mask.data(), unpacked.data(), unpacked.size(), true);
+    }
+  }
+
+  if (type.id() == STRING) {
+    // Offsets are rebased to the first string of the array if it is sliced
+    auto const offsets = reinterpret_cast<int32_t const *>(buffers[1]->data()) + offset;
+    auto const first   = offsets[0];
+    auto offsets_col   = make_numeric_column(
+      data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, _mr);
+    auto const offsets_size = (num_rows + 1) * sizeof(int32_t);
+    if (first == 0) {
+      copy_to_device(offsets_col->mutable_view().data<int32_t>(), offsets, offsets_size, false);
+    } else {
+      std::vector<int32_t> rebased(offsets, offsets + num_rows + 1);
+      for (auto &o : rebased) { o -= first; }
+      copy_to_device(
+        offsets_col->mutable_view().data<int32_t>(), rebased.data(), offsets_size, true);
+    }
+    auto const num_chars = offsets[num_rows] - first;
+    auto chars_col =
+      make_numeric_column(data_type{INT8}, num_chars, mask_state::UNALLOCATED, stream, _mr);
+    if (num_chars > 0) {
+      copy_to_device(
+        chars_col->mutable_view().data<int8_t>(), buffers[2]->data() + first, num_chars, false);
+    }
+    return make_strings_column(num_rows,
+                               std::move(offsets_col),
+                               std::move(chars_col),
+                               null_count,
+                               std::move(null_mask),
+                               stream,
+                               _mr);
+  }
+
+  rmm::device_buffer data(num_rows * size_of(type), stream, _mr);
+  if (type.id() == BOOL8) {
+    // Arrow booleans are bit-packed
+    std::vector<int8_t> bools(num_rows);
+    for (size_type i = 0; i < num_rows; ++i) {
+      bools[i] = arrow::BitUtil::GetBit(buffers[1]->data(), offset + i);
+    }
+    copy_to_device(data.data(), bools.data(), bools.size(), true);
+  } else {
+    copy_to_device(data.data(), buffers[1]->data() + offset * size_of(type), data.size(), false);
+  }
+  return std::make_unique<column>(
+    type, num_rows, std::move(data), std::move(null_mask), null_count);
+}
+
+table_with_metadata reader::impl::read(cudaStream_t stream) {
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  auto const schema = read_batches(batches);
+
+  // Select only columns required by the options; unknown names are ignored
+  std::vector<int> selected;
+  if (_columns.empty()) {
+    for (int i = 0; i < schema->num_fields(); ++i) { selected.push_back(i); }
+  } else {
+    for (auto const &name : _columns) {
+      auto const index = schema->GetFieldIndex(name);
+      if (index >= 0) { selected.push_back(index); }
+    }
+  }
+
+  int64_t total_rows = 0;
+  for (auto const &batch : batches) { total_rows += batch->num_rows(); }
+  CUDF_EXPECTS(total_rows <= std::numeric_limits<size_type>::max(),
+               "Arrow IPC data exceeds the column size limit");
+
+  table_metadata metadata;
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (auto const index : selected) {
+    auto const type = to_cudf_type(*schema->field(index)->type());
+    std::vector<std::unique_ptr<column>> pieces;
+    for (auto const &batch : batches) {
+      pieces.push_back(array_to_column(*batch->column(index), type, stream));
+    }
+    if (pieces.empty()) {
+      out_columns.push_back(make_empty_column(type));
+    } else if (pieces.size() == 1) {
+      out_columns.push_back(std::move(pieces.front()));
+    } else {
+      // The record batches are concatenated on the device
+      CUDF_STREAM_SYNC(stream);
+      std::vector<column_view> views;
+      for (auto const &piece : pieces) { views.push_back(piece->view()); }
+      out_columns.push_back(cudf::concatenate(views, _mr));
+    }
+    metadata.column_names.push_back(schema->field(index)->name());
+  }
+  // The buffers of the record batches reference the source buffer
+  CUDF_STREAM_SYNC(stream);
+
+  if (schema->metadata() != nullptr) {
+    auto const &kv = *schema->metadata();
+    for (int64_t i = 0; i < kv.size(); ++i) { metadata.user_data.insert({kv.key(i), kv.value(i)}); }
+  }
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+}
+
+// Forward to implementation
+reader::reader(std::string filepath,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr)) {}
+
+// Forward to implementation
+reader::reader(const char *buffer,
+               size_t length,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(datasource::create(buffer, length), options, mr)) {}
+
+// Forward to implementation
+reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(datasource::create(file), options, mr)) {}
+
+// Destructor within this translation unit
+reader::~reader() = default;
+
+// Forward to implementation
+table_with_metadata reader::read_all(cudaStream_t stream) { return _impl->read(stream); }
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file reader_impl.hpp
+ * @brief cuDF-IO Arrow IPC reader class implementation header
+ */
+
+#pragma once
+
+#include <io/utilities/datasource.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/readers.hpp>
+
+#include <arrow/api.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+
+using namespace cudf::io;
+
+/**
+ * @brief Implementation for Arrow IPC reader
+ */
+class reader::impl {
+ public:
+  /**
+   * @brief Constructor from a dataset source with reader options.
+   *
+   * @param source Dataset source
+   * @param options Settings for controlling reading behavior
+   * @param mr Resource to use for device memory allocation
+   */
+  explicit impl(std::unique_ptr<datasource> source,
+                reader_options const &options,
+                rmm::mr::device_memory_resource *mr);
+
+  /**
+   * @brief Read the entire dataset and returns a set of columns
+   *
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read(cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Reads the schema and all the record batches of the source
+   *
+   * Record batches are read from the host buffer of the whole source; their
+   * buffers reference it without copies.
+   *
+   * @param batches The record batches read
+   *
+   * @return The schema of the record batches
+   */
+  std::shared_ptr<arrow::Schema> read_batches(
+    std::vector<std::shared_ptr<arrow::RecordBatch>> &batches);
+
+  /**
+   * @brief Copies an array of a record batch into a column
+   *
+   * @param array The array to copy
+   * @param type The type of the column
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The column
+   */
+  std::unique_ptr<column> array_to_column(arrow::Array const &array,
+                                          data_type type,
+                                          cudaStream_t stream);
+
+ private:
+  rmm::mr::device_memory_resource *_mr = nullptr;
+  std::unique_ptr<datasource> _source;
+  std::shared_ptr<arrow::Buffer> _buffer;
+  std::vector<std::string> _columns;
+};
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
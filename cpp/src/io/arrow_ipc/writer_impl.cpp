@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cpp
+ * @brief cuDF-IO Arrow IPC writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/copying.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <arrow/io/interfaces.h>
+#include <arrow/ipc/api.h>
+#include <arrow/util/bit_util.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+
+namespace {
+
+/**
+ * @brief Arrow output stream writing to a data sink
+ */
+class sink_output_stream : public arrow::io::OutputStream {
+ public:
+  explicit sink_output_stream(data_sink* sink) : _sink(sink) {}
+
+  arrow::Status Close() override {
+    _closed = true;
+    return arrow::Status::OK();
+  }
+
+  arrow::Status Tell(int64_t* position) const override {
+    *position = _position;
+    return arrow::Status::OK();
+  }
+
+  bool closed() const override { return _closed; }
+
+  using arrow::io::OutputStream::Write;
+
+  arrow::Status Write(const void* data, int64_t nbytes) override {
+    _sink->host_write(data, nbytes);
+    _position += nbytes;
+    return arrow::Status::OK();
+  }
+
+ private:
+  data_sink* _sink;
+  int64_t _position = 0;
+  bool _closed      = false;
+};
+
+/**
+ * @brief Returns the Arrow type of a column type
+ */
+std::shared_ptr<arrow::DataType> to_arrow_type(data_type type) {
+  switch (type.id()) {
+    case BOOL8: return arrow::boolean();
+    case INT8: return arrow::int8();
+    case INT16: return arrow::int16();
+    case INT32: return arrow::int32();
+    case INT64: return arrow::int64();
+    case FLOAT32: return arrow::float32();
+    case FLOAT64: return arrow::float64();
+    case TIMESTAMP_DAYS: return arrow::date32();
+    case TIMESTAMP_SECONDS: return arrow::timestamp(arrow::TimeUnit::SECOND);
+    case TIMESTAMP_MILLISECONDS: return arrow::timestamp(arrow::TimeUnit::MILLI);
+    case TIMESTAMP_MICROSECONDS: return arrow::timestamp(arrow::TimeUnit::MICRO);
+    case TIMESTAMP_NANOSECONDS: return arrow::timestamp(arrow::TimeUnit::NANO);
+    case STRING: return arrow::utf8();
+    default: CUDF_FAIL("Unsupported column type for Arrow IPC");
+  }
+}
+
+std::shared_ptr<arrow::Buffer> allocate_host_buffer(int64_t size) {
+  std::shared_ptr<arrow::Buffer> buffer;
+  CUDF_EXPECTS(arrow::AllocateBuffer(arrow::default_memory_pool(), size, &buffer).ok(),
+               "Cannot allocate an Arrow buffer");
+  return buffer;
+}
+
+}  // namespace
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : _mr(mr), out_sink_(std::move(sink)), options_(options) {}
+
+std::shared_ptr<arrow::Array> writer::impl::column_to_array(column_view const& column,
+                                                            cudaStream_t stream) {
+  auto const num_rows = column.size();
+  auto const copy_to_host = [stream](void* dst, void const* src, size_t size) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyDeviceToHost, stream));
+  };
+
+  // The validity buffer is the first buffer of every array; the copied mask
+  // is kept until the copies complete
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(1);
+  size_type const null_count = column.nullable() ? column.null_count() : 0;
+  rmm::device_buffer mask{};
+  if (null_count > 0) {
+    mask       = copy_bitmask(column, stream, _mr);
+    buffers[0] = allocate_host_buffer((num_rows + 7) / 8);
+    copy_to_host(buffers[0]->mutable_data(), mask.data(), buffers[0]->size());
+  }
+
+  std::vector<int8_t> bools;
+  if (column.type().id() == STRING) {
+    // Offsets are rebased to the first string of the column if it is sliced
+    auto offsets         = allocate_host_buffer((num_rows + 1) * sizeof(int32_t));
+    auto const h_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    h_offsets[0]         = 0;
+    if (num_rows > 0) {
+      strings_column_view const scv(column);
+      copy_to_host(h_offsets, scv.offsets().data<int32_t>() + scv.offset(), offsets->size());
+      // The offsets give the size of the chars to copy
+      CUDF_STREAM_SYNC(stream);
+      auto const first = h_offsets[0];
+      for (size_type i = 0; i <= num_rows; ++i) { h_offsets[i] -= first; }
+      auto chars = allocate_host_buffer(h_offsets[num_rows]);
+      copy_to_host(chars->mutable_data(), scv.chars().data<char>() + first, chars->size());
+      buffers.push_back(std::move(offsets));
+      buffers.push_back(std::move(chars));
+    } else {
+      buffers.push_back(std::move(offsets));
+      buffers.push_back(allocate_host_buffer(0));
+    }
+  } else if (column.type().id() == BOOL8) {
+    bools.resize(num_rows);
+    copy_to_host(bools.data(), column.data<int8_t>(), bools.size());
+  } else {
+    auto const width = size_of(column.type());
+    auto data        = allocate_host_buffer(num_rows * width);
+    copy_to_host(
+      data->mutable_data(), column.head<uint8_t>() + column.offset() * width, data->size());
+    buffers.push_back(std::move(data));
+  }
+  CUDF_STREAM_SYNC(stream);
+
+  if (column.type().id() == BOOL8) {
+    // Arrow booleans are bit-packed
+    auto bits = allocate_host_buffer((num_rows + 7) / 8);
+    std::memset(bits->mutable_data(), 0, bits->size());
+    for (size_type i = 0; i < num_rows; ++i) {
+      arrow::BitUtil::SetBitTo(bits->mutable_data(), i, bools[i] != 0);
+    }
+    buffers.push_back(std::move(bits));
+  }
+
+  return arrow::MakeArray(arrow::ArrayData::Make(
+    to_arrow_type(column.type()), num_rows, std::move(buffers), null_count));
+}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata,
+                         cudaStream_t stream) {
+  CUDF_EXPECTS(options_.batch_size_rows > 0, "Invalid number of rows per batch");
+
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    auto const& col = table.column(i);
+    auto const name =
+      (metadata != nullptr && static_cast<size_t>(i) < metadata->column_names.size())
+        ? metadata->column_names[i]
+        : "_col" + std::to_string(i);
+    fields.push_back(arrow::field(name, to_arrow_type(col.type()), col.nullable()));
+  }
+  std::shared_ptr<arrow::KeyValueMetadata> user_data;
+  if (metadata != nullptr && not metadata->user_data.empty()) {
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    for (auto const& kv : metadata->user_data) {
+      keys.push_back(kv.first);
+      values.push_back(kv.second);
+    }
+    user_data = std::make_shared<arrow::KeyValueMetadata>(keys, values);
+  }
+  auto const schema = arrow::schema(fields, user_data);
+
+  sink_output_stream output(out_sink_.get());
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+  auto const status = options_.file_format
+                        ? arrow::ipc::RecordBatchFileWriter::Open(&output, schema, &writer)
+                        : arrow::ipc::RecordBatchStreamWriter::Open(&output, schema, &writer);
+  CUDF_EXPECTS(status.ok(), "Cannot open the Arrow IPC writer");
+
+  for (size_type start = 0; start < table.num_rows(); start += options_.batch_size_rows) {
+    auto const end  = std::min(table.num_rows(), start + options_.batch_size_rows);
+    auto const rows = experimental::slice(table, {start, end}).front();
+    std::vector<std::shared_ptr<arrow::Array>> arrays;
+    for (auto const& col : rows) { arrays.push_back(column_to_array(col, stream)); }
+    auto const batch = arrow::RecordBatch::Make(schema, end - start, arrays);
+    CUDF_EXPECTS(writer->WriteRecordBatch(*batch).ok(), "Cannot write an Arrow record batch");
+  }
+  CUDF_EXPECTS(writer->Close().ok(), "Cannot finish the Arrow IPC data");
+  out_sink_->flush();
+}
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr)) {}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+// Forward to implementation
+void writer::write_all(table_view const& table,
+                       const table_metadata* metadata,
+                       cudaStream_t stream) {
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.hpp
+ * @brief cuDF-IO Arrow IPC writer class implementation header
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/writers.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <arrow/api.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+
+using namespace cudf::io;
+
+/**
+ * @brief Implementation for Arrow IPC writer
+ **/
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Resource to use for device memory allocation
+   **/
+  explicit impl(std::unique_ptr<data_sink> sink,
+                writer_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to Arrow IPC format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream Stream to use for memory allocation and kernels
+   **/
+  void write(table_view const& table, const table_metadata* metadata, cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Copies the rows of a column into an Arrow array in host memory
+   *
+   * @param column The column rows to copy
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The Arrow array
+   **/
+  std::shared_ptr<arrow::Array> column_to_array(column_view const& column, cudaStream_t stream);
+
+ private:
+  rmm::mr::device_memory_resource* _mr = nullptr;
+
+  std::unique_ptr<data_sink> out_sink_;
+  writer_options options_;
+};
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -218,6 +218,7 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
  * @param[in] avro_data Raw block data
  * @param[in] num_blocks Number of blocks
  * @param[in] schema_len Number of entries in schema
+ * @param[in] projected_len Number of leading schema entries holding all selected columns
  * @param[in] num_dictionary_entries Number of entries in global dictionary
  * @param[in] min_row_size Minimum size in bytes of a row
  * @param[in] max_rows Maximum number of rows to load
@@ -232,6 +233,7 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
                           const uint8_t *avro_data,
                           uint32_t num_blocks,
                           uint32_t schema_len,
+                          uint32_t projected_len,
                           uint32_t num_dictionary_entries,
                           uint32_t min_row_size,
                           size_t max_rows,
@@ -272,19 +274,24 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
   end            = cur + blk->size;
   while (rows_remaining > 0 && cur < end) {
     uint32_t nrows;
+    uint32_t row_schema_len;
     const uint8_t *start = cur;
 
-    if (cur_row > first_row + max_rows) break;
+    if (cur_row >= first_row + max_rows) break;
     if (cur + min_row_size * rows_remaining == end) {
-      nrows = min(rows_remaining, 32);
+      // Row boundaries are known, so the fields after the last selected
+      // column don't need to be parsed
+      nrows          = min(rows_remaining, 32);
+      row_schema_len = projected_len;
       cur += threadIdx.x * min_row_size;
     } else {
-      nrows = 1;
+      nrows          = 1;
+      row_schema_len = schema_len;
     }
     if (threadIdx.x < nrows) {
       cur = avro_decode_row(schema,
                             schema_g,
-                            schema_len,
+                            row_schema_len,
                             cur_row - first_row + threadIdx.x,
                             max_rows,
                             cur,
@@ -312,6 +319,7 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
  * @param[in] avro_data Raw block data
  * @param[in] num_blocks Number of blocks
  * @param[in] schema_len Number of entries in schema
+ * @param[in] projected_len Number of leading schema entries holding all selected columns
  * @param[in] num_dictionary_entries Number of entries in global dictionary
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
@@ -326,6 +334,7 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
                                           const uint8_t *avro_data,
                                           uint32_t num_blocks,
                                           uint32_t schema_len,
+                                          uint32_t projected_len,
                                           uint32_t num_dictionary_entries,
                                           size_t max_rows,
                                           size_t first_row,
@@ -340,6 +349,7 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
                                                               avro_data,
                                                               num_blocks,
                                                               schema_len,
+                                                              projected_len,
                                                               num_dictionary_entries,
                                                               min_row_size,
                                                               max_rows,
@@ -347,6 +357,61 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
   return cudaSuccess;
 }
 
+/**
+ * @brief Checks the CRC32 of decompressed snappy blocks, one block per thread
+ *
+ * @param[in] inputs Decompression inputs, the CRC following each input
+ * @param[in,out] outputs Decompression status of each block
+ * @param[in] count Number of blocks
+ **/
+extern "C" __global__ void __launch_bounds__(128)
+  gpuCheckSnappyBlockCRC(const gpu_inflate_input_s *inputs,
+                         gpu_inflate_status_s *outputs,
+                         uint32_t count) {
+  __shared__ uint32_t crc_table[256];
+
+  for (uint32_t i = threadIdx.x; i < 256; i += blockDim.x) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++) { c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1; }
+    crc_table[i] = c;
+  }
+  __syncthreads();
+
+  const uint32_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= count || outputs[i].status != 0) { return; }
+  const auto crc_ptr      = static_cast<const uint8_t *>(inputs[i].srcDevice) + inputs[i].srcSize;
+  const uint32_t expected = (static_cast<uint32_t>(crc_ptr[0]) << 24) | (crc_ptr[1] << 16) |
+                            (crc_ptr[2] << 8) | crc_ptr[3];
+  const auto data = static_cast<const uint8_t *>(inputs[i].dstDevice);
+  uint32_t crc    = ~0u;
+  for (uint64_t j = 0; j < outputs[i].bytes_written; j++) {
+    crc = crc_table[(crc ^ data[j]) & 0xff] ^ (crc >> 8);
+  }
+  if (~crc != expected) { outputs[i].status = 1; }
+}
+
+/**
+ * @brief Launches kernel for checking the CRC of decompressed snappy blocks
+ *
+ * @param[in] inputs Decompression inputs, the CRC following each input
+ * @param[in,out] outputs Decompression status of each block
+ * @param[in] count Number of blocks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t __host__ CheckSnappyBlockCRC(const gpu_inflate_input_s *inputs,
+                                         gpu_inflate_status_s *outputs,
+                                         uint32_t count,
+                                         cudaStream_t stream) {
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((count + 127) / 128, 1);  // 1 thread per block
+  if (count > 0) {
+    gpuCheckSnappyBlockCRC<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count);
+  }
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace avro
 }  // namespace io
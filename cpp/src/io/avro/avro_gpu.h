@@ -18,6 +18,8 @@
 
 #include "avro_common.h"
 
+#include <io/comp/gpuinflate.h>
+
 namespace cudf {
 namespace io {
 namespace avro {
@@ -50,6 +52,7 @@ struct schemadesc_s {
  * @param[in] avro_data Raw block data
  * @param[in] num_blocks Number of blocks
  * @param[in] schema_len Number of entries in schema
+ * @param[in] projected_len Number of leading schema entries holding all selected columns
  * @param[in] num_dictionary_entries Number of entries in global dictionary
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
@@ -64,12 +67,31 @@ cudaError_t DecodeAvroColumnData(block_desc_s *blocks,
                                  const uint8_t *avro_data,
                                  uint32_t num_blocks,
                                  uint32_t schema_len,
+                                 uint32_t projected_len,
                                  uint32_t num_dictionary_entries,
                                  size_t max_rows       = ~0,
                                  size_t first_row      = 0,
                                  uint32_t min_row_size = 0,
                                  cudaStream_t stream   = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for checking the CRC of decompressed snappy blocks
+ *
+ * In Avro files, each snappy block is followed by the big-endian CRC32 of the
+ * uncompressed data. The status of the blocks failing the check is set to 1.
+ *
+ * @param[in] inputs Decompression inputs, the CRC following each input
+ * @param[in,out] outputs Decompression status of each block
+ * @param[in] count Number of blocks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t CheckSnappyBlockCRC(const gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                uint32_t count,
+                                cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace avro
 }  // namespace io
@@ -22,6 +22,7 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/pipelined_reader.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +31,9 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <algorithm>
+#include <string>
+
 namespace cudf {
 namespace experimental {
 namespace io {
@@ -59,6 +63,74 @@ type_id to_type_id(const avro::schema_entry *col) {
   }
 }
 
+/**
+ * @brief Maximum number of compressed bytes to read and decompress as a single batch
+ **/
+constexpr size_t default_batch_size = 16 * 1024 * 1024;
+
+/**
+ * @brief Number of times the output of a block that doesn't fit is reallocated
+ **/
+constexpr int max_output_size_retries = 4;
+
+/**
+ * @brief Returns the uncompressed size stored at the start of a compressed
+ * block, or zero if the codec doesn't store it
+ *
+ * @param[in] codec Compression codec of the file
+ * @param[in] blk Start of the block data
+ * @param[in] len Number of bytes available at `blk`
+ **/
+size_t get_uncompressed_size(std::string const &codec, const uint8_t *blk, size_t len) {
+  if (codec == "snappy" && len >= 4) {
+    // Varint at the start of the snappy stream
+    uint32_t blk_len = blk[0];
+    if (blk_len > 0x7f) {
+      blk_len = (blk_len & 0x7f) | (blk[1] << 7);
+      if (blk_len > 0x3fff) {
+        blk_len = (blk_len & 0x3fff) | (blk[2] << 14);
+        if (blk_len > 0x1fffff) { blk_len = (blk_len & 0x1fffff) | (blk[3] << 21); }
+      }
+    }
+    return blk_len;
+  } else if (codec == "zstandard" && len >= 6) {
+    // Frame_Content_Size of the first frame, which is optional
+    const uint32_t magic = blk[0] | (blk[1] << 8) | (blk[2] << 16) | (blk[3] << 24);
+    if (magic != 0xfd2fb528) { return 0; }
+    const uint32_t descriptor   = blk[4];
+    const uint32_t fcs_flag     = descriptor >> 6;
+    const bool single_segment   = (descriptor >> 5) & 1;
+    const uint32_t dict_id_size = ((descriptor & 3) == 3) ? 4 : (descriptor & 3);
+    const uint32_t fcs_size     = (fcs_flag == 0) ? (single_segment ? 1 : 0) : (1 << fcs_flag);
+    const size_t fcs_pos        = 5 + (single_segment ? 0 : 1) + dict_id_size;
+    if (fcs_size == 0 || fcs_pos + fcs_size > len) { return 0; }
+    size_t content_size = 0;
+    for (uint32_t i = 0; i < fcs_size; ++i) {
+      content_size |= static_cast<size_t>(blk[fcs_pos + i]) << (i * 8);
+    }
+    return (fcs_size == 2) ? content_size + 256 : content_size;
+  }
+  return 0;
+}
+
+/**
+ * @brief Decompresses a group of blocks with the GPU codec of the file
+ **/
+cudaError_t decompress_blocks(std::string const &codec,
+                              gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              int count,
+                              cudaStream_t stream) {
+  if (codec == "deflate") {
+    return gpuinflate(inputs, outputs, count, 0, stream);
+  } else if (codec == "snappy") {
+    return gpu_unsnap(inputs, outputs, count, stream);
+  } else if (codec == "zstandard") {
+    return gpu_unzstd(inputs, outputs, count, stream);
+  }
+  CUDF_FAIL("Unsupported compression codec\n");
+}
+
 }  // namespace
 
 /**
@@ -134,109 +206,178 @@ class metadata : public file_metadata {
   datasource *const source;
 };
 
-rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
-                                                 cudaStream_t stream) {
-  size_t uncompressed_data_size = 0;
-  hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
-  hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
-
-  if (_metadata->codec == "deflate") {
-    // Guess an initial maximum uncompressed block size
-    uint32_t initial_blk_len = (_metadata->max_block_size * 2 + 0xfff) & ~0xfff;
-    uncompressed_data_size   = initial_blk_len * _metadata->block_list.size();
-    for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
-  } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
-    for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->get_buffer(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
-      uint32_t blk_len   = blk[0];
-      if (blk_len > 0x7f) {
-        blk_len = (blk_len & 0x7f) | (blk[1] << 7);
-        if (blk_len > 0x3fff) {
-          blk_len = (blk_len & 0x3fff) | (blk[2] << 14);
-          if (blk_len > 0x1fffff) { blk_len = (blk_len & 0x1fffff) | (blk[3] << 21); }
-        }
-      }
-      inflate_in[i].dstSize = blk_len;
-      uncompressed_data_size += blk_len;
+std::vector<block_batch> reader::impl::read_blocks(cudaStream_t stream) {
+  const auto &block_list = _metadata->block_list;
+  const auto &codec      = _metadata->codec;
+  const bool compressed  = (codec != "" && codec != "null");
+  CUDF_EXPECTS(!compressed || codec == "deflate" || codec == "snappy" || codec == "zstandard",
+               "Unsupported compression codec\n");
+
+  // Group the blocks into batches of contiguous file ranges
+  std::vector<std::pair<size_t, size_t>> batch_ranges;
+  for (size_t first = 0, last = 0; first < block_list.size(); first = last) {
+    last = first + 1;
+    while (last < block_list.size() &&
+           block_list[last].offset + block_list[last].size - block_list[first].offset <=
+             default_batch_size) {
+      ++last;
     }
-  } else {
-    CUDF_FAIL("Unsupported compression codec\n");
+    batch_ranges.emplace_back(first, last - first);
   }
 
-  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
-
-  const auto base_offset = _metadata->block_list[0].offset;
-  for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-    const auto src_pos = _metadata->block_list[i].offset - base_offset;
+  // Guess an initial maximum uncompressed block size for codecs that don't store it
+  const uint32_t initial_blk_len = (_metadata->max_block_size * 2 + 0xfff) & ~0xfff;
+
+  std::vector<block_batch> batches(batch_ranges.size());
+  std::vector<rmm::device_buffer> comp_data(compressed ? batch_ranges.size() : 0);
+  std::vector<std::pair<size_t, size_t>> block_location(block_list.size());
+  hostdevice_vector<gpu_inflate_input_s> inflate_in(compressed ? block_list.size() : 0, stream);
+  hostdevice_vector<gpu_inflate_status_s> inflate_out(compressed ? block_list.size() : 0, stream);
+  pipelined_reader source_reader(_source.get(), stream);
+  for (size_t b = 0; b < batch_ranges.size(); ++b) {
+    const auto first = batch_ranges[b].first;
+    const auto count = batch_ranges[b].second;
+    const auto &last = block_list[first + count - 1];
+    const auto base  = block_list[first].offset;
+    rmm::device_buffer raw_data(last.offset + last.size - base, stream);
+    source_reader.read(base, raw_data.size(), static_cast<uint8_t *>(raw_data.data()));
+
+    auto &blocks = batches[b].blocks;
+    blocks.assign(block_list.begin() + first, block_list.begin() + first + count);
+    for (size_t i = 0; i < count; ++i) {
+      blocks[i].offset -= base;
+      block_location[first + i] = {b, i};
+    }
+    if (!compressed) {
+      batches[b].data = std::move(raw_data);
+      continue;
+    }
 
-    inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
-    inflate_in[i].srcSize   = _metadata->block_list[i].size;
-    inflate_in[i].dstDevice = static_cast<uint8_t *>(decomp_block_data.data()) + dst_pos;
+    size_t decomp_size = 0;
+    for (size_t i = 0; i < count; ++i) {
+      auto &input = inflate_in[first + i];
+      // Snappy blocks are followed by the CRC32 of the uncompressed data
+      input.srcSize = blocks[i].size;
+      if (codec == "snappy") {
+        CUDF_EXPECTS(input.srcSize >= 4, "Snappy block is missing its CRC");
+        input.srcSize -= 4;
+      }
 
-    // Update blocks offsets & sizes to refer to uncompressed data
-    _metadata->block_list[i].offset = dst_pos;
-    _metadata->block_list[i].size   = static_cast<uint32_t>(inflate_in[i].dstSize);
-    dst_pos += _metadata->block_list[i].size;
-  }
+      const auto header =
+        _source->get_buffer(block_list[first + i].offset, std::min<size_t>(blocks[i].size, 18));
+      const auto stored_size = get_uncompressed_size(codec, header->data(), header->size());
+      input.dstSize          = (stored_size != 0) ? stored_size : initial_blk_len;
+      decomp_size += input.dstSize;
+    }
+    batches[b].data = rmm::device_buffer(decomp_size, stream);
+    for (size_t i = 0, dst_pos = 0; i < count; ++i) {
+      auto &input      = inflate_in[first + i];
+      input.srcDevice  = static_cast<const uint8_t *>(raw_data.data()) + blocks[i].offset;
+      input.dstDevice  = static_cast<uint8_t *>(batches[b].data.data()) + dst_pos;
+      blocks[i].offset = dst_pos;
+      dst_pos += input.dstSize;
+    }
 
-  for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
-    CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(),
-                             inflate_in.host_ptr(),
-                             inflate_in.memory_size(),
+    // Queue the decompression of this batch; the host moves on to read the next one
+    CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(first),
+                             inflate_in.host_ptr(first),
+                             count * sizeof(gpu_inflate_input_s),
                              cudaMemcpyHostToDevice,
                              stream));
-    CUDA_TRY(cudaMemsetAsync(inflate_out.device_ptr(), 0, inflate_out.memory_size(), stream));
-    if (_metadata->codec == "deflate") {
-      CUDA_TRY(gpuinflate(
-        inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), 0, stream));
-    } else if (_metadata->codec == "snappy") {
-      CUDA_TRY(
-        gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), stream));
-    } else {
-      CUDF_FAIL("Unsupported compression codec\n");
-    }
-    CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(),
-                             inflate_out.device_ptr(),
-                             inflate_out.memory_size(),
+    CUDA_TRY(cudaMemsetAsync(
+      inflate_out.device_ptr(first), 0, count * sizeof(gpu_inflate_status_s), stream));
+    CUDA_TRY(decompress_blocks(
+      codec, inflate_in.device_ptr(first), inflate_out.device_ptr(first), count, stream));
+    CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(first),
+                             inflate_out.device_ptr(first),
+                             count * sizeof(gpu_inflate_status_s),
                              cudaMemcpyDeviceToHost,
                              stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    // Check if larger output is required, as it's not known ahead of time
-    if (_metadata->codec == "deflate" && !loop_cnt) {
-      size_t actual_uncompressed_size = 0;
-      for (size_t i = 0; i < _metadata->block_list.size(); i++) {
+    comp_data[b] = std::move(raw_data);
+  }
+  if (!compressed) { return batches; }
+  CUDF_STREAM_SYNC(stream);
+
+  // Blocks whose output didn't fit are decompressed again into a separate
+  // batch, as the uncompressed size is not always known ahead of time
+  for (int retry = 0; retry < max_output_size_retries; ++retry) {
+    std::vector<size_t> failed;
+    for (size_t i = 0; i < block_list.size(); ++i) {
+      if (inflate_out[i].status == 0) { continue; }
+      if (codec == "deflate") {
         // If error status is 1 (buffer too small), the `bytes_written` field
-        // is actually contains the uncompressed data size
+        // actually contains the uncompressed data size
         if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
           inflate_in[i].dstSize = inflate_out[i].bytes_written;
+          failed.push_back(i);
         }
-        actual_uncompressed_size += inflate_in[i].dstSize;
+      } else if (codec == "zstandard") {
+        inflate_in[i].dstSize *= 2;
+        failed.push_back(i);
       }
-      if (actual_uncompressed_size > uncompressed_data_size) {
-        decomp_block_data.resize(actual_uncompressed_size);
-        for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-          auto dst_base           = static_cast<uint8_t *>(decomp_block_data.data());
-          inflate_in[i].dstDevice = dst_base + dst_pos;
-
-          _metadata->block_list[i].offset = dst_pos;
-          _metadata->block_list[i].size   = static_cast<uint32_t>(inflate_in[i].dstSize);
-          dst_pos += _metadata->block_list[i].size;
-        }
-      } else {
-        break;
-      }
-    } else {
-      break;
     }
+    if (failed.empty()) { break; }
+
+    block_batch retry_batch;
+    hostdevice_vector<gpu_inflate_input_s> retry_in(failed.size(), stream);
+    hostdevice_vector<gpu_inflate_status_s> retry_out(failed.size(), stream);
+    size_t decomp_size = 0;
+    for (auto i : failed) { decomp_size += inflate_in[i].dstSize; }
+    retry_batch.data = rmm::device_buffer(decomp_size, stream);
+    for (size_t j = 0, dst_pos = 0; j < failed.size(); ++j) {
+      const auto i  = failed[j];
+      auto &old_blk = batches[block_location[i].first].blocks[block_location[i].second];
+      retry_batch.blocks.push_back(old_blk);
+      retry_batch.blocks.back().offset = dst_pos;
+      // The partial output in the original batch is left unused
+      old_blk.num_rows = 0;
+      old_blk.size     = 0;
+
+      inflate_in[i].dstDevice = static_cast<uint8_t *>(retry_batch.data.data()) + dst_pos;
+      retry_in[j]             = inflate_in[i];
+      block_location[i]       = {batches.size(), j};
+      dst_pos += inflate_in[i].dstSize;
+    }
+    CUDA_TRY(cudaMemcpyAsync(retry_in.device_ptr(),
+                             retry_in.host_ptr(),
+                             retry_in.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(cudaMemsetAsync(retry_out.device_ptr(), 0, retry_out.memory_size(), stream));
+    CUDA_TRY(decompress_blocks(
+      codec, retry_in.device_ptr(), retry_out.device_ptr(), retry_in.size(), stream));
+    CUDA_TRY(cudaMemcpyAsync(retry_out.host_ptr(),
+                             retry_out.device_ptr(),
+                             retry_out.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
+    for (size_t j = 0; j < failed.size(); ++j) { inflate_out[failed[j]] = retry_out[j]; }
+    batches.emplace_back(std::move(retry_batch));
+  }
+
+  if (codec == "snappy") {
+    CUDA_TRY(gpu::CheckSnappyBlockCRC(
+      inflate_in.device_ptr(), inflate_out.device_ptr(), block_list.size(), stream));
+    CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(),
+                             inflate_out.device_ptr(),
+                             inflate_out.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
   }
 
-  return decomp_block_data;
+  // Update the block sizes to refer to the uncompressed data
+  for (size_t i = 0; i < block_list.size(); ++i) {
+    CUDF_EXPECTS(inflate_out[i].status == 0, "Error decompressing Avro block data");
+    batches[block_location[i].first].blocks[block_location[i].second].size =
+      static_cast<uint32_t>(inflate_out[i].bytes_written);
+  }
+
+  return batches;
 }
 
-void reader::impl::decode_data(const rmm::device_buffer &block_data,
+void reader::impl::decode_data(const std::vector<block_batch> &batches,
                                const std::vector<std::pair<uint32_t, uint32_t>> &dict,
                                hostdevice_vector<uint8_t> &global_dictionary,
                                size_t total_dictionary_entries,
@@ -245,8 +386,9 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
                                std::vector<column_buffer> &out_buffers,
                                cudaStream_t stream) {
   // Build gpu schema
-  hostdevice_vector<gpu::schemadesc_s> schema_desc(_metadata->schema.size());
+  hostdevice_vector<gpu::schemadesc_s> schema_desc(_metadata->schema.size(), stream);
   uint32_t min_row_data_size = 0;
+  uint32_t projected_len     = 0;
   int skip_field_cnt         = 0;
   for (size_t i = 0; i < _metadata->schema.size(); i++) {
     type_kind_e kind = _metadata->schema[i].kind;
@@ -285,6 +427,8 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
     const auto col_idx  = selection[i].first;
     int schema_data_idx = _metadata->columns[col_idx].schema_data_idx;
     int schema_null_idx = _metadata->columns[col_idx].schema_null_idx;
+    projected_len =
+      std::max<uint32_t>(projected_len, std::max(schema_data_idx, schema_null_idx) + 1);
 
     schema_desc[schema_data_idx].dataptr = out_buffers[i].data();
     if (schema_null_idx >= 0) {
@@ -301,26 +445,32 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
       set_null_mask(out_buffers[i].null_mask(), 0, num_rows, true, stream);
     }
   }
-  rmm::device_buffer block_list(
-    _metadata->block_list.data(), _metadata->block_list.size() * sizeof(block_desc_s), stream);
   CUDA_TRY(cudaMemcpyAsync(schema_desc.device_ptr(),
                            schema_desc.host_ptr(),
                            schema_desc.memory_size(),
                            cudaMemcpyHostToDevice,
                            stream));
 
-  CUDA_TRY(
-    gpu::DecodeAvroColumnData(static_cast<block_desc_s *>(block_list.data()),
-                              schema_desc.device_ptr(),
-                              reinterpret_cast<gpu::nvstrdesc_s *>(global_dictionary.device_ptr()),
-                              static_cast<const uint8_t *>(block_data.data()),
-                              static_cast<uint32_t>(_metadata->block_list.size()),
-                              static_cast<uint32_t>(schema_desc.size()),
-                              static_cast<uint32_t>(total_dictionary_entries),
-                              _metadata->num_rows,
-                              _metadata->skip_rows,
-                              min_row_data_size,
-                              stream));
+  // Null counts accumulate in the device schema across the batches
+  std::vector<rmm::device_buffer> block_lists;
+  for (const auto &batch : batches) {
+    if (batch.blocks.empty()) { continue; }
+    block_lists.emplace_back(
+      batch.blocks.data(), batch.blocks.size() * sizeof(block_desc_s), stream);
+    CUDA_TRY(gpu::DecodeAvroColumnData(
+      static_cast<block_desc_s *>(block_lists.back().data()),
+      schema_desc.device_ptr(),
+      reinterpret_cast<gpu::nvstrdesc_s *>(global_dictionary.device_ptr()),
+      static_cast<const uint8_t *>(batch.data.data()),
+      static_cast<uint32_t>(batch.blocks.size()),
+      static_cast<uint32_t>(schema_desc.size()),
+      projected_len,
+      static_cast<uint32_t>(total_dictionary_entries),
+      _metadata->num_rows,
+      _metadata->skip_rows,
+      min_row_data_size,
+      stream));
+  }
 
   // Copy valid bits that are shared between columns
   for (size_t i = 0; i < out_buffers.size(); i++) {
@@ -337,7 +487,7 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
                            schema_desc.memory_size(),
                            cudaMemcpyDeviceToHost,
                            stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
   for (size_t i = 0; i < out_buffers.size(); i++) {
     const auto col_idx          = selection[i].first;
     const auto schema_null_idx  = _metadata->columns[col_idx].schema_null_idx;
@@ -374,19 +524,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
     }
 
     if (_metadata->total_data_size > 0) {
-      const auto buffer =
-        _source->get_buffer(_metadata->block_list[0].offset, _metadata->total_data_size);
-      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
-
-      if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
-        block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = _metadata->block_list[0].offset;
-        for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-          _metadata->block_list[i].offset -= dst_ofs;
-        }
-      }
+      auto block_data = read_blocks(stream);
 
       size_t total_dictionary_entries = 0;
       size_t dictionary_data_size     = 0;
@@ -401,7 +539,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
       }
 
       hostdevice_vector<uint8_t> global_dictionary(
-        total_dictionary_entries * sizeof(gpu::nvstrdesc_s) + dictionary_data_size);
+        total_dictionary_entries * sizeof(gpu::nvstrdesc_s) + dictionary_data_size, stream);
       if (total_dictionary_entries > 0) {
         size_t dict_pos = total_dictionary_entries * sizeof(gpu::nvstrdesc_s);
         for (size_t i = 0; i < column_types.size(); ++i) {
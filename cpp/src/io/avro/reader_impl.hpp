@@ -47,6 +47,14 @@ using namespace cudf::io;
 // Forward declarations
 class metadata;
 
+/**
+ * @brief Device data of a group of blocks
+ */
+struct block_batch {
+  rmm::device_buffer data;           // Uncompressed block data
+  std::vector<block_desc_s> blocks;  // Blocks, with offsets relative to the start of `data`
+};
+
 /**
  * @brief Implementation for Avro reader
  */
@@ -76,27 +84,28 @@ class reader::impl {
 
  private:
   /**
-   * @brief Decompresses the block data.
+   * @brief Reads the selected blocks into device memory and decompresses them.
+   *
+   * Blocks are read in batches of contiguous file ranges, and each batch is
+   * decompressed with the batched GPU codecs while the next one is read.
    *
-   * @param comp_block_data Compressed block data
    * @param stream Stream to use for memory allocation and kernels
    *
-   * @return Device buffer to decompressed block data
+   * @return Batches of uncompressed block data
    */
-  rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
-                                     cudaStream_t stream);
+  std::vector<block_batch> read_blocks(cudaStream_t stream);
 
   /**
    * @brief Convert the avro row-based block data and outputs to columns
    *
-   * @param block_data Uncompressed block data
+   * @param batches Uncompressed block data
    * @param dict Dictionary entries
    * @param global_dictionary Dictionary allocation
    * @param total_dictionary_entries Number of dictionary entries
    * @param out_buffers Output columns' device buffers
    * @param stream Stream to use for memory allocation and kernels
    */
-  void decode_data(const rmm::device_buffer &block_data,
+  void decode_data(const std::vector<block_batch> &batches,
                    const std::vector<std::pair<uint32_t, uint32_t>> &dict,
                    hostdevice_vector<uint8_t> &global_dictionary,
                    size_t total_dictionary_entries,
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime.h>
+#include "gpuinflate.h"
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/decompression.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+// The public descriptors are passed through to the kernels as-is
+static_assert(sizeof(device_decompress_input) == sizeof(cudf::io::gpu_inflate_input_s) &&
+                offsetof(device_decompress_input, src) ==
+                  offsetof(cudf::io::gpu_inflate_input_s, srcDevice) &&
+                offsetof(device_decompress_input, src_size) ==
+                  offsetof(cudf::io::gpu_inflate_input_s, srcSize) &&
+                offsetof(device_decompress_input, dst) ==
+                  offsetof(cudf::io::gpu_inflate_input_s, dstDevice) &&
+                offsetof(device_decompress_input, dst_size) ==
+                  offsetof(cudf::io::gpu_inflate_input_s, dstSize),
+              "Mismatched decompression input layout");
+static_assert(sizeof(device_decompress_status) == sizeof(cudf::io::gpu_inflate_status_s) &&
+                offsetof(device_decompress_status, bytes_written) ==
+                  offsetof(cudf::io::gpu_inflate_status_s, bytes_written) &&
+                offsetof(device_decompress_status, status) ==
+                  offsetof(cudf::io::gpu_inflate_status_s, status),
+              "Mismatched decompression status layout");
+
+size_t batched_decompress_scratch_size(compression_type type, size_type num_inputs) {
+  switch (type) {
+    case compression_type::GZIP:
+    case compression_type::SNAPPY:
+    case compression_type::ZSTD:
+    case compression_type::LZ4: return 0;
+    case compression_type::BROTLI: return cudf::io::get_gpu_debrotli_scratch_size(num_inputs);
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+void batched_decompress(compression_type type,
+                        device_decompress_input const *inputs,
+                        device_decompress_status *statuses,
+                        size_type num_inputs,
+                        void *scratch,
+                        size_t scratch_size,
+                        cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_inputs >= 0, "Invalid number of inputs");
+  CUDF_EXPECTS(scratch_size >= batched_decompress_scratch_size(type, num_inputs),
+               "Insufficient scratch memory");
+  if (num_inputs == 0) { return; }
+
+  // The kernels do not modify the input descriptors
+  auto d_inputs = const_cast<cudf::io::gpu_inflate_input_s *>(
+    reinterpret_cast<cudf::io::gpu_inflate_input_s const *>(inputs));
+  auto d_statuses = reinterpret_cast<cudf::io::gpu_inflate_status_s *>(statuses);
+  switch (type) {
+    case compression_type::GZIP:
+      CUDA_TRY(cudf::io::gpuinflate(d_inputs, d_statuses, num_inputs, 1, stream));
+      break;
+    case compression_type::SNAPPY:
+      CUDA_TRY(cudf::io::gpu_unsnap(d_inputs, d_statuses, num_inputs, stream));
+      break;
+    case compression_type::BROTLI:
+      CUDA_TRY(
+        cudf::io::gpu_debrotli(d_inputs, d_statuses, scratch, scratch_size, num_inputs, stream));
+      break;
+    case compression_type::ZSTD:
+      CUDA_TRY(cudf::io::gpu_unzstd(d_inputs, d_statuses, num_inputs, stream));
+      break;
+    case compression_type::LZ4:
+      CUDA_TRY(cudf::io::gpu_unlz4(d_inputs, d_statuses, num_inputs, 1, stream));
+      break;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
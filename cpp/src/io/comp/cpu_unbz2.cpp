@@ -517,8 +517,12 @@ static void bzUnRLE(unbz_state_s *s) {
   s->out = out;
 }
 
-int32_t cpu_bz2_uncompress(
-  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start) {
+int32_t cpu_bz2_uncompress(const uint8_t *source,
+                           size_t sourceLen,
+                           uint8_t *dest,
+                           size_t *destLen,
+                           uint64_t *block_start,
+                           uint64_t block_end) {
   unbz_state_s s;
   uint32_t v;
   int ret;
@@ -577,9 +581,10 @@ int32_t cpu_bz2_uncompress(
         ret = (s.out < s.outend) ? BZ_UNEXPECTED_EOF : BZ_OUTBUFF_FULL;
       }
     }
-  } while (ret == BZ_OK);
+  } while (ret == BZ_OK &&
+           (block_end == 0 || ((s.cur - s.base) << 3) + (s.bitpos) < block_end));
 
-  if (ret == BZ_STREAM_END) {
+  if (ret == BZ_STREAM_END || ret == BZ_OK) {
     // normal termination
     last_valid_block_in  = ((s.cur - s.base) << 3) + (s.bitpos);
     last_valid_block_out = s.out - s.outbase;
@@ -56,6 +56,9 @@ THE SOFTWARE.
 #include "brotli_dict.h"
 #include "gpuinflate.h"
 
+#include <mutex>
+#include <vector>
+
 namespace cudf {
 namespace io {
 
@@ -75,6 +78,17 @@ namespace io {
 
 #define BREV8(x) (__brev(x) >> 24u)  // kReverseBits[x]
 
+/**
+ * @brief Static dictionary, uploaded once per device (see init_brotli_dictionary)
+ *
+ * The word data is too large for constant memory and is read through the
+ * read-only data cache, while the small per-length tables, which all the
+ * threads of a warp index uniformly, are read from the constant cache.
+ **/
+__constant__ uint8_t g_dict_size_bits[32];
+__constant__ uint32_t g_dict_offsets[32];
+__device__ uint8_t g_dict_words[sizeof(brotli_dictionary_s::data)];
+
 /**
  * @brief Various local scratch arrays
  **/
@@ -143,6 +157,7 @@ struct debrotli_state_s {
   uint8_t *context_modes;
   uint8_t *fb_base;
   uint32_t fb_size;
+  uint32_t fb_capacity;  // size of fb_base, kept across meta-blocks
   uint8_t block_type_rb[6];
   uint8_t pad[2];
   int dist_rb_idx;
@@ -1356,7 +1371,8 @@ static __device__ debrotli_huff_tree_group_s *HuffmanTreeGroupInit(debrotli_stat
 }
 
 static __device__ void HuffmanTreeGroupAlloc(debrotli_state_s *s,
-                                             debrotli_huff_tree_group_s *group) {
+                                             debrotli_huff_tree_group_s *group,
+                                             uint8_t *fb_base) {
   if (!group->htrees[0]) {
     uint32_t alphabet_size  = group->alphabet_size;
     uint32_t ntrees         = group->num_htrees;
@@ -1364,7 +1380,7 @@ static __device__ void HuffmanTreeGroupAlloc(debrotli_state_s *s,
     uint32_t code_size      = sizeof(uint16_t) * ntrees * max_table_size;
     group->htrees[0]        = (uint16_t *)local_alloc(s, code_size);
     if (!group->htrees[0]) {
-      if (s->fb_base) { group->htrees[0] = (uint16_t *)(s->fb_base + s->fb_size); }
+      if (fb_base) { group->htrees[0] = (uint16_t *)(fb_base + s->fb_size); }
       s->fb_size += (code_size + 3) & ~3;
     }
   }
@@ -1424,22 +1440,28 @@ static __device__ void DecodeHuffmanTreeGroups(debrotli_state_s *s,
     HuffmanTreeGroupInit(s, num_distance_codes, num_distance_codes, num_dist_htrees);
   // Attempt to allocate local memory first, before going to fb
   s->fb_size = 0;
-  HuffmanTreeGroupAlloc(s, s->literal_hgroup);
-  HuffmanTreeGroupAlloc(s, s->insert_copy_hgroup);
-  HuffmanTreeGroupAlloc(s, s->distance_hgroup);
+  HuffmanTreeGroupAlloc(s, s->literal_hgroup, nullptr);
+  HuffmanTreeGroupAlloc(s, s->insert_copy_hgroup, nullptr);
+  HuffmanTreeGroupAlloc(s, s->distance_hgroup, nullptr);
   if (s->fb_size != 0) {
-    // Did not fit in local memory -> allocate fb
-    s->fb_base = ext_heap_alloc(s->fb_size, fb_heap_base, fb_heap_size);
-    if (!s->fb_base) {
-      s->error   = -2;
-      s->fb_size = 0;
-      return;
+    // Did not fit in local memory -> reuse the fb of a previous meta-block if large enough,
+    // avoiding a round-trip through the heap shared by all blocks for every meta-block
+    if (s->fb_size > s->fb_capacity) {
+      if (s->fb_base) { ext_heap_free(s->fb_base, s->fb_capacity, fb_heap_base, fb_heap_size); }
+      s->fb_base = ext_heap_alloc(s->fb_size, fb_heap_base, fb_heap_size);
+      if (!s->fb_base) {
+        s->error       = -2;
+        s->fb_size     = 0;
+        s->fb_capacity = 0;
+        return;
+      }
+      s->fb_capacity = s->fb_size;
     }
     // Repeat allocation falling back to fb
     s->fb_size = 0;
-    HuffmanTreeGroupAlloc(s, s->literal_hgroup);
-    HuffmanTreeGroupAlloc(s, s->insert_copy_hgroup);
-    HuffmanTreeGroupAlloc(s, s->distance_hgroup);
+    HuffmanTreeGroupAlloc(s, s->literal_hgroup, s->fb_base);
+    HuffmanTreeGroupAlloc(s, s->insert_copy_hgroup, s->fb_base);
+    HuffmanTreeGroupAlloc(s, s->distance_hgroup, s->fb_base);
   }
   HuffmanTreeGroupDecode(s, s->literal_hgroup);
   if (s->error) return;
@@ -1502,7 +1524,7 @@ inline __device__ int ToUpperCase(uint8_t *p) {
 }
 
 static __device__ int TransformDictionaryWord(uint8_t *dst,
-                                              const uint8_t *word,
+                                              const uint8_t *__restrict__ word,
                                               int len,
                                               int transform_idx) {
   int idx               = 0;
@@ -1523,7 +1545,7 @@ static __device__ int TransformDictionaryWord(uint8_t *dst,
       word += skip;
       len -= skip;
     }
-    while (i < len) { dst[idx++] = word[i++]; }
+    while (i < len) { dst[idx++] = __ldg(&word[i++]); }
     if (t == BROTLI_TRANSFORM_UPPERCASE_FIRST) {
       ToUpperCase(&dst[idx - len]);
     } else if (t == BROTLI_TRANSFORM_UPPERCASE_ALL) {
@@ -1543,9 +1565,7 @@ static __device__ int TransformDictionaryWord(uint8_t *dst,
 }
 
 /// ProcessCommands, actual decoding: 1 warp, most work done by thread0
-static __device__ void ProcessCommands(debrotli_state_s *s,
-                                       const brotli_dictionary_s *words,
-                                       int t) {
+static __device__ void ProcessCommands(debrotli_state_s *s, int t) {
   int32_t meta_block_len = s->meta_block_len;
   uint8_t *out           = s->out;
   int32_t pos            = 0;
@@ -1717,8 +1737,8 @@ static __device__ void ProcessCommands(debrotli_state_s *s,
               pos         = meta_block_len;
               copy_length = 0;
             } else {
-              int32_t offset         = (int32_t)words->offsets_by_length[copy_length];
-              uint32_t shift         = words->size_bits_by_length[copy_length];
+              int32_t offset         = (int32_t)g_dict_offsets[copy_length];
+              uint32_t shift         = g_dict_size_bits[copy_length];
               uint32_t address       = distance_code - max_distance - 1;
               int32_t word_idx       = address & ((1 << shift) - 1);
               uint32_t transform_idx = address >> shift;
@@ -1729,7 +1749,7 @@ static __device__ void ProcessCommands(debrotli_state_s *s,
                 distance_code = -offset;
               } else if (transform_idx < kNumTransforms) {
                 copy_length = TransformDictionaryWord(
-                  dict_scratch, &words->data[offset], copy_length, transform_idx);
+                  dict_scratch, &g_dict_words[offset], copy_length, transform_idx);
                 distance_code = 0;
                 if (copy_length == 1) {
                   // Special case for single byte output
@@ -1779,12 +1799,13 @@ static __device__ void ProcessCommands(debrotli_state_s *s,
         }
       } else {
         // Dictionary
-        const uint8_t *src = (distance_code < 0) ? &words->data[-distance_code] : dict_scratch;
+        const uint8_t *src = (distance_code < 0) ? &g_dict_words[-distance_code] : dict_scratch;
+        bool const is_word = (distance_code < 0);
         if (t < copy_length) {
-          b            = src[t];
+          b            = is_word ? __ldg(&src[t]) : src[t];
           out[pos + t] = b;
           if (32 + t < copy_length) {
-            b                 = src[32 + t];
+            b                 = is_word ? __ldg(&src[32 + t]) : src[32 + t];
             out[pos + 32 + t] = b;
           }
         }
@@ -1840,11 +1861,14 @@ extern "C" __global__ void __launch_bounds__(NUMTHREADS, 2)
       s->dist_rb[3]       = 4;
       s->dist_rb_idx      = 0;
       s->p1 = s->p2 = 0;
+      s->fb_base     = nullptr;
+      s->fb_capacity = 0;
       initbits(s, src, src_size);
       DecodeStreamHeader(s);
     } else {
       s->error = 1;
       s->out = s->outbase = nullptr;
+      s->fb_base          = nullptr;
     }
   }
   __syncthreads();
@@ -1877,19 +1901,13 @@ extern "C" __global__ void __launch_bounds__(NUMTHREADS, 2)
           if (!t) {
             s->heap_used  = 0;
             s->heap_limit = (uint16_t)(sizeof(s->heap) / sizeof(s->heap[0]));
-            s->fb_base    = nullptr;
             s->fb_size    = 0;
             DecodeHuffmanTables(s);
             if (!s->error) { DecodeHuffmanTreeGroups(s, scratch, scratch_size); }
           }
           __syncthreads();
           if (!s->error) {
-            if (t < 32) ProcessCommands(s, (brotli_dictionary_s *)(scratch + scratch_size), t);
-            __syncthreads();
-          }
-          // Free any allocated memory
-          if (s->fb_base) {
-            if (!t) { ext_heap_free(s->fb_base, s->fb_size, scratch, scratch_size); }
+            if (t < 32) ProcessCommands(s, t);
             __syncthreads();
           }
         }
@@ -1902,6 +1920,11 @@ extern "C" __global__ void __launch_bounds__(NUMTHREADS, 2)
     } while (!s->error && !s->is_last && s->bytes_left != 0);
   }
   __syncthreads();
+  // Free the memory kept for the tables of all the meta-blocks
+  if (s->fb_base) {
+    if (!t) { ext_heap_free(s->fb_base, s->fb_capacity, scratch, scratch_size); }
+    __syncthreads();
+  }
   if (!t) {
     outputs[z].bytes_written = s->out - s->outbase;
     outputs[z].status        = s->error;
@@ -1930,7 +1953,41 @@ size_t __host__ get_gpu_debrotli_scratch_size(int max_num_inputs) {
   // Allocate at least two worst-case metablocks or 1 metablock plus typical size for every other block
   fb_size = max(max_fb_size * min(max_num_inputs, 2), max_fb_size + max_num_inputs * min_fb_size);
   // Add some room for alignment
-  return fb_size + 16 + sizeof(brotli_dictionary_s);
+  return fb_size + 16;
+}
+
+/**
+ * @brief Copies the static dictionary to the current device, once per device
+ *
+ * @param[in] stream CUDA stream to use
+ **/
+static cudaError_t __host__ init_brotli_dictionary(cudaStream_t stream) {
+  static std::mutex init_mutex;
+  static std::vector<bool> initialized;
+  int dev = 0;
+  CUDA_TRY(cudaGetDevice(&dev));
+  std::lock_guard<std::mutex> lock(init_mutex);
+  if (initialized.size() <= static_cast<size_t>(dev)) { initialized.resize(dev + 1, false); }
+  if (!initialized[dev]) {
+    const brotli_dictionary_s *dict = get_brotli_dictionary();
+    CUDA_TRY(cudaMemcpyToSymbolAsync(g_dict_size_bits,
+                                     dict->size_bits_by_length,
+                                     sizeof(g_dict_size_bits),
+                                     0,
+                                     cudaMemcpyHostToDevice,
+                                     stream));
+    CUDA_TRY(cudaMemcpyToSymbolAsync(g_dict_offsets,
+                                     dict->offsets_by_length,
+                                     sizeof(g_dict_offsets),
+                                     0,
+                                     cudaMemcpyHostToDevice,
+                                     stream));
+    CUDA_TRY(cudaMemcpyToSymbolAsync(
+      g_dict_words, dict->data, sizeof(g_dict_words), 0, cudaMemcpyHostToDevice, stream));
+    CUDF_STREAM_SYNC(stream);
+    initialized[dev] = true;
+  }
+  return cudaSuccess;
 }
 
 #define DUMP_FB_HEAP 0
@@ -1950,17 +2007,14 @@ cudaError_t __host__ gpu_debrotli(gpu_inflate_input_s *inputs,
   dim3 dim_block(NUMTHREADS, 1);
   dim3 dim_grid(count32, 1);  // TODO: Check max grid dimensions vs max expected count
 
-  if (scratch_size < sizeof(brotli_dictionary_s)) { return cudaErrorLaunchOutOfResources; }
+  if (scratch_size < 16) { return cudaErrorLaunchOutOfResources; }
   scratch_size = min(scratch_size, (size_t)0xffffffffu);
-  fb_heap_size = (uint32_t)((scratch_size - sizeof(brotli_dictionary_s)) & ~0xf);
+  fb_heap_size = (uint32_t)(scratch_size & ~0xf);
 
+  // The dictionary is only copied by the first call on each device rather than every call, as the
+  // 128KB copy has a relatively large overhead since the source isn't page-locked
+  CUDA_TRY(init_brotli_dictionary(stream));
   CUDA_TRY(cudaMemsetAsync(scratch_u8, 0, 2 * sizeof(uint32_t), stream));
-  // NOTE: The 128KB dictionary copy can have a relatively large overhead since source isn't page-locked
-  CUDA_TRY(cudaMemcpyAsync(scratch_u8 + fb_heap_size,
-                           get_brotli_dictionary(),
-                           sizeof(brotli_dictionary_s),
-                           cudaMemcpyHostToDevice,
-                           stream));
   gpu_debrotli_kernel<<<dim_grid, dim_block, 0, stream>>>(
     inputs, outputs, scratch_u8, fb_heap_size, count32);
 #if DUMP_FB_HEAP
@@ -1970,7 +2024,7 @@ cudaError_t __host__ gpu_debrotli(gpu_inflate_input_s *inputs,
   while (cur < fb_heap_size && !(cur & 3)) {
     CUDA_TRY(cudaMemcpyAsync(
       &dump[0], scratch_u8 + cur, 2 * sizeof(uint32_t), cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_STREAM_SYNC(stream);
     printf("@%d: next = %d, size = %d\n", cur, dump[0], dump[1]);
     cur = (dump[0] > cur) ? dump[0] : 0xffffffffu;
   }
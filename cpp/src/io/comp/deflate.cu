@@ -0,0 +1,783 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+
+#define HASH_BITS 12
+
+// Limits the literal search before the literals are added to the block histograms
+#define MAX_LITERAL_SEARCH 256
+
+#define MIN_MATCH 4                // Minimum match length found by the 4-byte hashes
+#define MAX_MATCH 258              // Syntax limit
+#define MAX_COPY_DISTANCE 32768    // Syntax limit (window size)
+#define BLOCK_INPUT_SIZE 16384     // Input bytes of a DEFLATE block, not counting the last match
+#define MAX_SEQUENCES 4096         // Limits the number of sequences of a DEFLATE block
+#define NUM_LITLEN_SYMS 286        // Literals, end of block and lengths
+#define NUM_DIST_SYMS 30           // Distances
+#define NUM_CLEN_SYMS 19           // Code lengths of the dynamic block header
+#define MAX_CODE_BITS 15           // Maximum length of the literal/length and distance codes
+#define MAX_CLEN_BITS 7            // Maximum length of the code length codes
+#define END_OF_BLOCK 256
+
+#define NUMTHREADS 128
+
+/**
+ * @brief DEFLATE compressor state
+ *
+ * The input is split into DEFLATE blocks of about BLOCK_INPUT_SIZE bytes. The
+ * LZ77 sequences of a block (literals followed by an optional match) are kept
+ * in shared memory, along with their symbol frequencies, to build the Huffman
+ * codes of the block before the block is written.
+ **/
+struct deflate_state_s {
+  const uint8_t *src;                       ///< Ptr to uncompressed data
+  uint32_t src_len;                         ///< Uncompressed data length
+  uint8_t *dst;                             ///< Base ptr to output compressed data
+  uint32_t dst_len;                         ///< Size of the output buffer
+  uint32_t bit_pos;                         ///< Number of bits written
+  int32_t error;                            ///< Nonzero if the output buffer is too small
+  volatile uint32_t copy_length;            ///< Number of copy bytes
+  volatile uint32_t copy_distance;          ///< Distance for copy bytes
+  uint32_t block_start;                     ///< Position of the current block in the input
+  uint32_t block_len;                       ///< Number of input bytes of the current block
+  uint32_t block_bits;                      ///< Estimated size in bits of the current block
+  uint32_t block_type;                      ///< 0: stored, 1: fixed, 2: dynamic Huffman codes
+  uint32_t num_seq;                         ///< Number of sequences of the current block
+  uint32_t extra_bits;                      ///< Length and distance extra bits of the block
+  uint32_t hlit;                            ///< Number of literal/length code lengths
+  uint32_t hdist;                           ///< Number of distance code lengths
+  uint32_t hclen;                           ///< Number of code length code lengths
+  uint32_t num_rle;                         ///< Number of run-length coded code lengths
+  uint32_t lit_freq[NUM_LITLEN_SYMS];       ///< Literal/length symbol frequencies
+  uint32_t dist_freq[NUM_DIST_SYMS];        ///< Distance symbol frequencies
+  uint32_t clen_freq[NUM_CLEN_SYMS];        ///< Code length symbol frequencies
+  uint32_t work[NUM_LITLEN_SYMS];           ///< Scratch for the code length computation
+  uint32_t scan[NUMTHREADS];                ///< Scratch for the prefix sums
+  uint16_t lit_code[NUM_LITLEN_SYMS];       ///< Bit-reversed literal/length codes
+  uint16_t dist_code[NUM_DIST_SYMS];        ///< Bit-reversed distance codes
+  uint16_t clen_code[NUM_CLEN_SYMS];        ///< Bit-reversed code length codes
+  uint16_t sorted[NUM_LITLEN_SYMS];         ///< Symbols sorted by frequency
+  uint8_t lit_len[NUM_LITLEN_SYMS];         ///< Literal/length code lengths
+  uint8_t dist_len[NUM_DIST_SYMS];          ///< Distance code lengths
+  uint8_t clen_len[NUM_CLEN_SYMS];          ///< Code length code lengths
+  uint8_t rle_sym[NUM_LITLEN_SYMS + NUM_DIST_SYMS];    ///< Run-length coded code lengths
+  uint8_t rle_extra[NUM_LITLEN_SYMS + NUM_DIST_SYMS];  ///< Repeat counts of codes 16 to 18
+  uint16_t seq_lit[MAX_SEQUENCES];          ///< Number of literals of each sequence
+  uint16_t seq_copy[MAX_SEQUENCES];         ///< Match length of each sequence, zero if none
+  uint16_t seq_dist[MAX_SEQUENCES];         ///< Match distance of each sequence
+  uint16_t hash_map[1 << HASH_BITS];        ///< Low 16-bit offset from hash
+};
+
+// Order of the code length code lengths in the dynamic block header
+static const __device__ __constant__ uint8_t g_clen_order[NUM_CLEN_SYMS] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/**
+ * @brief Writes bits to the output, LSB first, from any thread
+ *
+ * The bits are ORed into the aligned 32-bit words covering the output, so
+ * that threads can write adjacent bit ranges concurrently; the bytes of the
+ * output must be zero beforehand.
+ **/
+struct bit_writer_s {
+  uint32_t *base;  ///< Aligned base of the output
+  uint32_t word;   ///< Index of the next word to write
+  uint32_t nbits;  ///< Number of bits in buf
+  uint64_t buf;    ///< Bits to write at word
+};
+
+static inline __device__ void init_bit_writer(bit_writer_s *w, uint8_t *dst, uint32_t bit_pos) {
+  uint32_t align = 3 & reinterpret_cast<uintptr_t>(dst);
+  uint32_t pos   = bit_pos + align * 8;
+  w->base        = reinterpret_cast<uint32_t *>(dst - align);
+  w->word        = pos >> 5;
+  w->nbits       = pos & 0x1f;
+  w->buf         = 0;
+}
+
+/// @brief Writes the lowest `n` bits of `v`, with n <= 32
+static inline __device__ void put_bits(bit_writer_s *w, uint32_t v, uint32_t n) {
+  w->buf |= static_cast<uint64_t>(v) << w->nbits;
+  w->nbits += n;
+  if (w->nbits >= 32) {
+    atomicOr(&w->base[w->word], static_cast<uint32_t>(w->buf));
+    w->word++;
+    w->buf >>= 32;
+    w->nbits -= 32;
+  }
+}
+
+static inline __device__ void flush_bits(bit_writer_s *w) {
+  if (w->nbits > 0) { atomicOr(&w->base[w->word], static_cast<uint32_t>(w->buf)); }
+}
+
+/**
+ * @brief Returns the length symbol (257 to 285) of a match length, and its extra bits
+ **/
+static inline __device__ uint32_t length_symbol(uint32_t len,
+                                                uint32_t &extra_bits,
+                                                uint32_t &extra) {
+  uint32_t x = len - 3;
+  if (x < 8 || len == MAX_MATCH) {
+    extra_bits = 0;
+    extra      = 0;
+    return (len == MAX_MATCH) ? 285 : 257 + x;
+  }
+  uint32_t n = 31 - __clz(x);  // 3..7
+  extra_bits = n - 2;
+  extra      = x & ((1 << extra_bits) - 1);
+  return 257 + 4 * (n - 1) + ((x >> (n - 2)) & 3);
+}
+
+/**
+ * @brief Returns the distance symbol (0 to 29) of a match distance, and its extra bits
+ **/
+static inline __device__ uint32_t distance_symbol(uint32_t dist,
+                                                  uint32_t &extra_bits,
+                                                  uint32_t &extra) {
+  uint32_t x = dist - 1;
+  if (x < 4) {
+    extra_bits = 0;
+    extra      = 0;
+    return x;
+  }
+  uint32_t n = 31 - __clz(x);  // 2..14
+  extra_bits = n - 1;
+  extra      = x & ((1 << extra_bits) - 1);
+  return 2 * n + ((x >> (n - 1)) & 1);
+}
+
+/// @brief Returns the length of the fixed Huffman code of a literal/length symbol
+static inline __device__ uint32_t fixed_lit_len(uint32_t sym) {
+  return (sym < 144) ? 8 : (sym < 256) ? 9 : (sym < 280) ? 7 : 8;
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ **/
+static inline __device__ uint32_t fetch4(const uint8_t *src) {
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ **/
+static inline __device__ uint32_t deflate_hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ **/
+static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t) {
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < HASH_BITS; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = BALLOT(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first occurence of a consecutive 4-byte match in the input sequence,
+ * or at most MAX_LITERAL_SEARCH bytes
+ *
+ * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
+ * @param src Uncompressed buffer
+ * @param pos0 Position in uncompressed buffer
+ * @param t thread in warp
+ *
+ * @return Number of bytes before first match (literal length)
+ **/
+static __device__ uint32_t FindFourByteMatch(deflate_state_s *s,
+                                             const uint8_t *src,
+                                             uint32_t pos0,
+                                             uint32_t t) {
+  uint32_t len    = s->src_len;
+  uint32_t pos    = pos0;
+  uint32_t maxpos = pos0 + MAX_LITERAL_SEARCH - 31;
+  uint32_t match_mask, literal_cnt;
+  if (t == 0) { s->copy_length = 0; }
+  do {
+    bool valid4               = (pos + t + 4 <= len);
+    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? deflate_hash(data32) : 0;
+    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+    uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match =
+          (offset < pos && offset + MAX_COPY_DISTANCE >= pos + t && fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask = BALLOT(match);
+    if (match_mask != 0) {
+      literal_cnt = __ffs(match_mask) - 1;
+      if (t == literal_cnt) {
+        s->copy_distance = pos + t - offset;
+        s->copy_length   = MIN_MATCH;
+      }
+    } else {
+      literal_cnt = 32;
+    }
+    // Update hash up to the first 4 bytes of the copy length
+    local_match &= (0x2 << literal_cnt) - 1;
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    pos += literal_cnt;
+  } while (literal_cnt == 32 && pos < maxpos);
+  return min(pos, len) - pos0;
+}
+
+/// @brief Returns the number of matching bytes for two byte sequences up to `len` bytes
+static __device__ uint32_t MatchLength(const uint8_t *src1,
+                                       const uint8_t *src2,
+                                       uint32_t len,
+                                       uint32_t t) {
+  uint32_t match_len = 0;
+  while (match_len < len) {
+    uint32_t i        = match_len + t;
+    uint32_t mismatch = BALLOT(i >= len || src1[i] != src2[i]);
+    if (mismatch != 0) { return match_len + __ffs(mismatch) - 1; }
+    match_len += 32;
+  }
+  return len;
+}
+
+/**
+ * @brief Finds the LZ77 sequences of the block starting at s->block_start, and
+ * counts the frequencies of their symbols (single warp)
+ *
+ * @param s Compressor state
+ * @param t thread in warp
+ **/
+static __device__ void FindSequences(deflate_state_s *s, uint32_t t) {
+  const uint8_t *src = s->src;
+  uint32_t src_len   = s->src_len;
+  uint32_t pos       = s->block_start;
+  uint32_t limit     = min(pos + BLOCK_INPUT_SIZE, src_len);
+  uint32_t num_seq   = 0;
+  uint32_t lit_len   = 0;
+  uint32_t extra     = 0;
+  // Keeps room for the last sequence, which may have literals only
+  while (pos < limit && num_seq < MAX_SEQUENCES - 1) {
+    uint32_t literal_len = FindFourByteMatch(s, src, pos, t);
+    SYNCWARP();
+    uint32_t copy_len = s->copy_length;
+    uint32_t distance = s->copy_distance;
+    for (uint32_t i = t; i < literal_len; i += 32) { atomicAdd(&s->lit_freq[src[pos + i]], 1); }
+    pos += literal_len;
+    lit_len += literal_len;
+    if (copy_len != 0) {
+      uint32_t match_pos = pos + copy_len;  // NOTE: copy_len is always 4 here
+      copy_len += MatchLength(src + match_pos,
+                              src + match_pos - distance,
+                              min(src_len - match_pos, MAX_MATCH - copy_len),
+                              t);
+      if (t == 0) {
+        uint32_t len_bits, len_extra, dist_bits, dist_extra;
+        uint32_t len_sym  = length_symbol(copy_len, len_bits, len_extra);
+        uint32_t dist_sym = distance_symbol(distance, dist_bits, dist_extra);
+        s->lit_freq[len_sym]++;
+        s->dist_freq[dist_sym]++;
+        extra += len_bits + dist_bits;
+        s->seq_lit[num_seq]  = lit_len;
+        s->seq_copy[num_seq] = copy_len;
+        s->seq_dist[num_seq] = distance;
+      }
+      num_seq++;
+      lit_len = 0;
+      pos += copy_len;
+    }
+    SYNCWARP();
+  }
+  if (t == 0) {
+    if (lit_len > 0) {
+      s->seq_lit[num_seq]  = lit_len;
+      s->seq_copy[num_seq] = 0;
+      s->seq_dist[num_seq] = 0;
+      num_seq++;
+    }
+    s->lit_freq[END_OF_BLOCK]++;
+    s->num_seq    = num_seq;
+    s->block_len  = pos - s->block_start;
+    s->extra_bits = extra;
+  }
+}
+
+/**
+ * @brief Computes the lengths of a Huffman code from increasing frequencies, in place
+ * See Moffat and Katajainen, "In-place calculation of minimum-redundancy codes"
+ *
+ * @param a Frequencies of the symbols in increasing order, replaced by their code lengths
+ * @param n Number of symbols, at least 2
+ **/
+static __device__ void MinimumRedundancyLengths(uint32_t *a, int n) {
+  int root = 0, leaf = 2, next;
+  // First pass, left to right, setting parent pointers
+  a[0] += a[1];
+  for (next = 1; next < n - 1; next++) {
+    // Select the first item for a pairing
+    if (leaf >= n || a[root] < a[leaf]) {
+      a[next]   = a[root];
+      a[root++] = next;
+    } else {
+      a[next] = a[leaf++];
+    }
+    // Add on the second item
+    if (leaf >= n || (root < next && a[root] < a[leaf])) {
+      a[next] += a[root];
+      a[root++] = next;
+    } else {
+      a[next] += a[leaf++];
+    }
+  }
+  // Second pass, right to left, setting internal depths
+  a[n - 2] = 0;
+  for (next = n - 3; next >= 0; next--) { a[next] = a[a[next]] + 1; }
+  // Third pass, right to left, setting leaf depths
+  int avbl = 1, used = 0, dpth = 0;
+  root = n - 2;
+  next = n - 1;
+  while (avbl > 0) {
+    while (root >= 0 && a[root] == dpth) {
+      used++;
+      root--;
+    }
+    while (avbl > used) {
+      a[next--] = dpth;
+      avbl--;
+    }
+    avbl = 2 * used;
+    dpth++;
+    used = 0;
+  }
+}
+
+/**
+ * @brief Assigns the bit-reversed canonical Huffman codes of the given code lengths
+ **/
+static __device__ void AssignCanonicalCodes(const uint8_t *lens, uint32_t n, uint16_t *codes) {
+  uint32_t bl_count[MAX_CODE_BITS + 1] = {0};
+  uint32_t next_code[MAX_CODE_BITS + 1];
+  for (uint32_t i = 0; i < n; i++) { bl_count[lens[i]]++; }
+  bl_count[0] = 0;
+  uint32_t code = 0;
+  for (uint32_t bits = 1; bits <= MAX_CODE_BITS; bits++) {
+    code            = (code + bl_count[bits - 1]) << 1;
+    next_code[bits] = code;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t len = lens[i];
+    codes[i]     = (len != 0) ? __brev(next_code[len]++) >> (32 - len) : 0;
+  }
+}
+
+/**
+ * @brief Builds a length-limited Huffman code from symbol frequencies (all threads)
+ *
+ * Unused symbols get zero-length codes. At least two symbols are given a code
+ * so that the code is complete, as expected by common decoders.
+ *
+ * @param s Compressor state
+ * @param freq Symbol frequencies; unused symbols may be given a frequency of one
+ * @param n Number of symbols
+ * @param max_bits Maximum code length
+ * @param lens Output code lengths
+ * @param codes Output bit-reversed codes
+ * @param t thread in block
+ **/
+static __device__ void BuildHuffmanCode(deflate_state_s *s,
+                                        uint32_t *freq,
+                                        uint32_t n,
+                                        uint32_t max_bits,
+                                        uint8_t *lens,
+                                        uint16_t *codes,
+                                        uint32_t t) {
+  if (t == 0) {
+    uint32_t num_used = 0;
+    for (uint32_t i = 0; i < n; i++) { num_used += (freq[i] != 0); }
+    for (uint32_t i = 0; num_used < 2; i++) {
+      if (freq[i] == 0) {
+        freq[i] = 1;
+        num_used++;
+      }
+    }
+  }
+  __syncthreads();
+  // Sort the used symbols by increasing frequency
+  for (uint32_t i = t; i < n; i += NUMTHREADS) {
+    uint32_t f = freq[i];
+    if (f != 0) {
+      uint32_t rank = 0;
+      for (uint32_t j = 0; j < n; j++) {
+        uint32_t fj = freq[j];
+        rank += (fj != 0 && (fj < f || (fj == f && j < i)));
+      }
+      s->sorted[rank] = i;
+    }
+    lens[i] = 0;
+  }
+  __syncthreads();
+  if (t == 0) {
+    uint32_t *a       = s->work;
+    uint32_t num_used = 0;
+    for (uint32_t i = 0; i < n; i++) { num_used += (freq[i] != 0); }
+    for (uint32_t k = 0; k < num_used; k++) { a[k] = freq[s->sorted[k]]; }
+    MinimumRedundancyLengths(a, num_used);
+    // Limit the code lengths, then restore the Kraft equality by moving leaves down the tree
+    uint32_t bl_count[MAX_CODE_BITS + 1] = {0};
+    uint32_t total                       = 0;
+    for (uint32_t k = 0; k < num_used; k++) { bl_count[min(a[k], max_bits)]++; }
+    for (uint32_t bits = 1; bits <= max_bits; bits++) {
+      total += bl_count[bits] << (max_bits - bits);
+    }
+    while (total != (1u << max_bits)) {
+      bl_count[max_bits]--;
+      for (uint32_t bits = max_bits - 1; bits > 0; bits--) {
+        if (bl_count[bits] != 0) {
+          bl_count[bits]--;
+          bl_count[bits + 1] += 2;
+          break;
+        }
+      }
+      total--;
+    }
+    // The least frequent symbols get the longest codes
+    uint32_t k = 0;
+    for (uint32_t bits = max_bits; bits > 0; bits--) {
+      for (uint32_t i = bl_count[bits]; i > 0; i--) { lens[s->sorted[k++]] = bits; }
+    }
+    AssignCanonicalCodes(lens, n, codes);
+  }
+  __syncthreads();
+}
+
+/// @brief Returns the code length of a symbol in the concatenated literal/length and distance
+/// code lengths of the dynamic block header
+static inline __device__ uint32_t CodeLengthAt(const deflate_state_s *s, uint32_t i) {
+  return (i < s->hlit) ? s->lit_len[i] : s->dist_len[i - s->hlit];
+}
+
+static inline __device__ void AddCodeLength(deflate_state_s *s, uint32_t sym, uint32_t extra) {
+  s->rle_sym[s->num_rle]   = sym;
+  s->rle_extra[s->num_rle] = extra;
+  s->num_rle++;
+  s->clen_freq[sym]++;
+}
+
+/**
+ * @brief Run-length codes the code lengths of the dynamic block header (single thread)
+ **/
+static __device__ void EncodeCodeLengths(deflate_state_s *s) {
+  uint32_t hlit = NUM_LITLEN_SYMS, hdist = NUM_DIST_SYMS;
+  while (hlit > END_OF_BLOCK + 1 && s->lit_len[hlit - 1] == 0) { hlit--; }
+  while (hdist > 1 && s->dist_len[hdist - 1] == 0) { hdist--; }
+  s->hlit    = hlit;
+  s->hdist   = hdist;
+  s->num_rle = 0;
+  uint32_t total = hlit + hdist;
+  for (uint32_t i = 0; i < total;) {
+    uint32_t len = CodeLengthAt(s, i);
+    uint32_t run = 1;
+    while (i + run < total && CodeLengthAt(s, i + run) == len) { run++; }
+    i += run;
+    if (len == 0) {
+      while (run >= 11) {
+        uint32_t r = min(run, 138u);
+        AddCodeLength(s, 18, r - 11);
+        run -= r;
+      }
+      if (run >= 3) {
+        AddCodeLength(s, 17, run - 3);
+        run = 0;
+      }
+    } else {
+      AddCodeLength(s, len, 0);
+      run--;
+      while (run >= 3) {
+        uint32_t r = min(run, 6u);
+        AddCodeLength(s, 16, r - 3);
+        run -= r;
+      }
+    }
+    for (; run > 0; run--) { AddCodeLength(s, len, 0); }
+  }
+}
+
+/**
+ * @brief Picks the smallest of the stored, fixed and dynamic block types, and
+ * checks that the block fits in the output (single thread)
+ **/
+static __device__ void ChooseBlockType(deflate_state_s *s) {
+  uint32_t hclen = NUM_CLEN_SYMS;
+  while (hclen > 4 && s->clen_len[g_clen_order[hclen - 1]] == 0) { hclen--; }
+  s->hclen = hclen;
+
+  uint32_t dyn_bits   = 3 + 5 + 5 + 4 + 3 * hclen + s->extra_bits;
+  uint32_t fixed_bits = 3 + s->extra_bits;
+  for (uint32_t i = 0; i < s->num_rle; i++) {
+    uint32_t sym = s->rle_sym[i];
+    dyn_bits += s->clen_len[sym] + ((sym == 16) ? 2 : (sym == 17) ? 3 : (sym == 18) ? 7 : 0);
+  }
+  for (uint32_t i = 0; i < NUM_LITLEN_SYMS; i++) {
+    dyn_bits += s->lit_freq[i] * s->lit_len[i];
+    fixed_bits += s->lit_freq[i] * fixed_lit_len(i);
+  }
+  for (uint32_t i = 0; i < NUM_DIST_SYMS; i++) {
+    dyn_bits += s->dist_freq[i] * s->dist_len[i];
+    fixed_bits += s->dist_freq[i] * 5;
+  }
+  uint32_t stored_bits = (((s->bit_pos + 3 + 7) & ~7) - s->bit_pos) + 32 + 8 * s->block_len;
+
+  if (stored_bits <= min(fixed_bits, dyn_bits)) {
+    s->block_type = 0;
+    s->block_bits = stored_bits;
+  } else if (fixed_bits <= dyn_bits) {
+    s->block_type = 1;
+    s->block_bits = fixed_bits;
+    for (uint32_t i = 0; i < NUM_LITLEN_SYMS; i++) { s->lit_len[i] = fixed_lit_len(i); }
+    for (uint32_t i = 0; i < NUM_DIST_SYMS; i++) { s->dist_len[i] = 5; }
+    AssignCanonicalCodes(s->lit_len, NUM_LITLEN_SYMS, s->lit_code);
+    AssignCanonicalCodes(s->dist_len, NUM_DIST_SYMS, s->dist_code);
+  } else {
+    s->block_type = 2;
+    s->block_bits = dyn_bits;
+  }
+  if (((s->bit_pos + s->block_bits + 7) >> 3) > s->dst_len) { s->error = 1; }
+}
+
+/**
+ * @brief Writes the header of the current block, updating s->bit_pos (single thread)
+ **/
+static __device__ void WriteBlockHeader(deflate_state_s *s) {
+  bit_writer_s w;
+  uint32_t bit_pos = s->bit_pos;
+  bool is_last     = (s->block_start + s->block_len >= s->src_len);
+  init_bit_writer(&w, s->dst, bit_pos);
+  put_bits(&w, (is_last ? 1 : 0) | (s->block_type << 1), 3);
+  bit_pos += 3;
+  if (s->block_type == 0) {
+    uint32_t pad = (8 - (bit_pos & 7)) & 7;
+    put_bits(&w, 0, pad);
+    put_bits(&w, s->block_len | ((~s->block_len & 0xffff) << 16), 32);
+    bit_pos += pad + 32;
+  } else if (s->block_type == 2) {
+    put_bits(&w, s->hlit - 257, 5);
+    put_bits(&w, s->hdist - 1, 5);
+    put_bits(&w, s->hclen - 4, 4);
+    bit_pos += 14;
+    for (uint32_t i = 0; i < s->hclen; i++) { put_bits(&w, s->clen_len[g_clen_order[i]], 3); }
+    bit_pos += 3 * s->hclen;
+    for (uint32_t i = 0; i < s->num_rle; i++) {
+      uint32_t sym   = s->rle_sym[i];
+      uint32_t nbits = (sym == 16) ? 2 : (sym == 17) ? 3 : (sym == 18) ? 7 : 0;
+      put_bits(&w, s->clen_code[sym], s->clen_len[sym]);
+      put_bits(&w, s->rle_extra[i], nbits);
+      bit_pos += s->clen_len[sym] + nbits;
+    }
+  }
+  flush_bits(&w);
+  s->bit_pos = bit_pos;
+}
+
+/**
+ * @brief Returns the exclusive prefix sum of `v` over the threads of the block,
+ * and the total in `total`
+ **/
+static __device__ uint32_t ExclusiveSum(deflate_state_s *s,
+                                        uint32_t v,
+                                        uint32_t &total,
+                                        uint32_t t) {
+  uint32_t sum = 0;
+  s->scan[t]   = v;
+  __syncthreads();
+  total = 0;
+  for (uint32_t i = 0; i < NUMTHREADS; i++) {
+    uint32_t x = s->scan[i];
+    if (i < t) { sum += x; }
+    total += x;
+  }
+  __syncthreads();
+  return sum;
+}
+
+/**
+ * @brief Writes the symbols of the sequences of the current block and the end
+ * of block code, with each thread writing a range of sequences
+ **/
+static __device__ void EncodeSequences(deflate_state_s *s, uint32_t t) {
+  const uint8_t *src = s->src;
+  uint32_t num_seq   = s->num_seq;
+  uint32_t chunk     = (num_seq + NUMTHREADS - 1) / NUMTHREADS;
+  uint32_t first     = min(t * chunk, num_seq);
+  uint32_t last      = min(first + chunk, num_seq);
+  uint32_t bytes = 0, bits = 0, total;
+
+  for (uint32_t i = first; i < last; i++) { bytes += s->seq_lit[i] + s->seq_copy[i]; }
+  uint32_t pos = s->block_start + ExclusiveSum(s, bytes, total, t);
+  for (uint32_t i = first, p = pos; i < last; i++) {
+    uint32_t lit_len = s->seq_lit[i], copy_len = s->seq_copy[i];
+    for (uint32_t j = 0; j < lit_len; j++) { bits += s->lit_len[src[p + j]]; }
+    if (copy_len != 0) {
+      uint32_t len_bits, len_extra, dist_bits, dist_extra;
+      uint32_t len_sym  = length_symbol(copy_len, len_bits, len_extra);
+      uint32_t dist_sym = distance_symbol(s->seq_dist[i], dist_bits, dist_extra);
+      bits += s->lit_len[len_sym] + len_bits + s->dist_len[dist_sym] + dist_bits;
+    }
+    p += lit_len + copy_len;
+  }
+  uint32_t bit_pos = s->bit_pos + ExclusiveSum(s, bits, total, t);
+
+  bit_writer_s w;
+  init_bit_writer(&w, s->dst, bit_pos);
+  for (uint32_t i = first; i < last; i++) {
+    uint32_t lit_len = s->seq_lit[i], copy_len = s->seq_copy[i];
+    for (uint32_t j = 0; j < lit_len; j++) {
+      uint32_t b = src[pos + j];
+      put_bits(&w, s->lit_code[b], s->lit_len[b]);
+    }
+    if (copy_len != 0) {
+      uint32_t len_bits, len_extra, dist_bits, dist_extra;
+      uint32_t len_sym  = length_symbol(copy_len, len_bits, len_extra);
+      uint32_t dist_sym = distance_symbol(s->seq_dist[i], dist_bits, dist_extra);
+      put_bits(&w, s->lit_code[len_sym] | (len_extra << s->lit_len[len_sym]),
+               s->lit_len[len_sym] + len_bits);
+      put_bits(&w, s->dist_code[dist_sym] | (dist_extra << s->dist_len[dist_sym]),
+               s->dist_len[dist_sym] + dist_bits);
+    }
+    pos += lit_len + copy_len;
+  }
+  flush_bits(&w);
+  if (t == 0) {
+    bit_pos = s->bit_pos + total;
+    init_bit_writer(&w, s->dst, bit_pos);
+    put_bits(&w, s->lit_code[END_OF_BLOCK], s->lit_len[END_OF_BLOCK]);
+    flush_bits(&w);
+  }
+  __syncthreads();
+  if (t == 0) { s->bit_pos = bit_pos + s->lit_len[END_OF_BLOCK]; }
+}
+
+/**
+ * @brief DEFLATE compression kernel
+ * See https://tools.ietf.org/html/rfc1951
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ **/
+extern "C" __global__ void __launch_bounds__(NUMTHREADS)
+  deflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count) {
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s *const s = &state_g;
+  uint32_t t               = threadIdx.x;
+
+  if (!t) {
+    s->src         = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    s->src_len     = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    s->dst         = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    s->dst_len     = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    s->bit_pos     = 0;
+    s->error       = 0;
+    s->block_start = 0;
+  }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += NUMTHREADS) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  __syncthreads();
+  do {
+    for (uint32_t i = t; i < NUM_LITLEN_SYMS; i += NUMTHREADS) { s->lit_freq[i] = 0; }
+    if (t < NUM_DIST_SYMS) { s->dist_freq[t] = 0; }
+    if (t < NUM_CLEN_SYMS) { s->clen_freq[t] = 0; }
+    __syncthreads();
+    if (t < 32) { FindSequences(s, t); }
+    __syncthreads();
+    BuildHuffmanCode(s, s->lit_freq, NUM_LITLEN_SYMS, MAX_CODE_BITS, s->lit_len, s->lit_code, t);
+    BuildHuffmanCode(s, s->dist_freq, NUM_DIST_SYMS, MAX_CODE_BITS, s->dist_len, s->dist_code, t);
+    if (!t) { EncodeCodeLengths(s); }
+    __syncthreads();
+    BuildHuffmanCode(s, s->clen_freq, NUM_CLEN_SYMS, MAX_CLEN_BITS, s->clen_len, s->clen_code, t);
+    if (!t) { ChooseBlockType(s); }
+    __syncthreads();
+    if (s->error) { break; }
+    // The bits are ORed into the output, so clear the bytes of the block first
+    for (uint32_t i = ((s->bit_pos + 7) >> 3) + t; i < ((s->bit_pos + s->block_bits + 7) >> 3);
+         i += NUMTHREADS) {
+      s->dst[i] = 0;
+    }
+    __syncthreads();
+    if (!t) { WriteBlockHeader(s); }
+    __syncthreads();
+    if (s->block_type == 0) {
+      uint8_t *dst       = s->dst + (s->bit_pos >> 3);
+      const uint8_t *src = s->src + s->block_start;
+      for (uint32_t i = t; i < s->block_len; i += NUMTHREADS) { dst[i] = src[i]; }
+      __syncthreads();
+      if (!t) { s->bit_pos += 8 * s->block_len; }
+    } else {
+      EncodeSequences(s, t);
+    }
+    __syncthreads();
+    if (!t) { s->block_start += s->block_len; }
+    __syncthreads();
+  } while (s->block_start < s->src_len);
+  if (!t) {
+    outputs[blockIdx.x].bytes_written = (s->bit_pos + 7) >> 3;
+    outputs[blockIdx.x].status        = s->error;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s *inputs,
+                                 gpu_inflate_status_s *outputs,
+                                 int count,
+                                 cudaStream_t stream) {
+  dim3 dim_block(NUMTHREADS, 1);  // 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) { deflate_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -43,9 +43,13 @@ misrepresented as being the original software.
 Mark Adler    madler@alumni.caltech.edu
 */
 
+#include <cudf/utilities/error.hpp>
 #include <io/utilities/block_utils.cuh>
 #include "gpuinflate.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace io {
 
@@ -60,6 +64,12 @@ namespace io {
 #define LOG2LENLUT 10
 #define LOG2DISTLUT 8
 
+#define WINDOW_SIZE 32768  // Size of the sliding window of back-references
+
+#define SPLIT_PART_SIZE (1 << 20)  // Minimum size of the compressed data of a part of a stream
+#define SPLIT_MAX_PARTS 4096       // Maximum number of parts of a stream
+#define SPLIT_SCAN_BITS (1 << 21)  // Number of bit offsets scanned for a block header per part
+
 /**
  * @brief Intermediate arrays for building huffman tables
  **/
@@ -118,8 +128,10 @@ struct inflate_state_s {
   uint8_t *outbase;  ///< start of output buffer
   uint8_t *outend;   ///< end of output buffer
   // Input state
-  uint8_t *cur;  ///< input buffer
-  uint8_t *end;  ///< end of input buffer
+  uint8_t *cur;     ///< input buffer
+  uint8_t *end;     ///< end of input buffer
+  uint8_t *begin;   ///< start of the DEFLATE data
+  int64_t end_bit;  ///< bit offset from begin of the block boundary at which decoding stops
 
   uint2 bitbuf;     ///< bit buffer (64-bit)
   uint32_t bitpos;  ///< position in bit buffer
@@ -186,6 +198,22 @@ __device__ uint32_t getbits(inflate_state_s *s, uint32_t n) {
   return v;
 }
 
+/// @brief Positions the bitstream at the byte-aligned input location p
+inline __device__ void init_bitstream(inflate_state_s *s, uint8_t *p) {
+  uint32_t prefix_bytes = (uint32_t)(((size_t)p) & 3);
+  p -= prefix_bytes;
+  s->cur      = p;
+  s->bitbuf.x = (p < s->end) ? *(uint32_t *)p : 0;
+  p += 4;
+  s->bitbuf.y = (p < s->end) ? *(uint32_t *)p : 0;
+  s->bitpos   = prefix_bytes * 8;
+}
+
+/// @brief Returns the bit offset of the bitstream from the start of the DEFLATE data
+inline __device__ int64_t bit_position(const inflate_state_s *s) {
+  return (int64_t)(s->cur - s->begin) * 8 + s->bitpos;
+}
+
 /**
  * @brief Decode a code from the stream s using huffman table {symbols,counts}.
  * Return the symbol or a negative value if there is an error.
@@ -744,12 +772,30 @@ __device__ void init_distance_lut(inflate_state_s *s, int t) {
   }
 }
 
-/// @brief WARP1: process symbols and output uncompressed stream
+/**
+ * @brief Returns the output symbol of the byte at `pos` < 0 before the start of the output
+ *
+ * Bytes before the start of a stream are zero. The 16-bit outputs of a part of a stream decoded
+ * speculatively keep the position of the byte in the unknown window preceding the part instead,
+ * as a symbol 256 + [0, WINDOW_SIZE) that is resolved once the window is known.
+ **/
+template <typename T>
+inline __device__ T window_symbol(ptrdiff_t) {
+  return 0;
+}
+
+template <>
+inline __device__ uint16_t window_symbol<uint16_t>(ptrdiff_t pos) {
+  return (pos >= -WINDOW_SIZE) ? (uint16_t)(256 + WINDOW_SIZE + pos) : 0;
+}
+
+/// @brief WARP1: process symbols and output uncompressed stream of bytes or 16-bit symbols
+template <typename T>
 __device__ void process_symbols(inflate_state_s *s, int t) {
-  uint8_t *out           = s->out;
-  const uint8_t *outend  = s->outend;
-  const uint8_t *outbase = s->outbase;
-  int batch              = 0;
+  T *out           = reinterpret_cast<T *>(s->out);
+  const T *outend  = reinterpret_cast<const T *>(s->outend);
+  const T *outbase = reinterpret_cast<const T *>(s->outbase);
+  int batch        = 0;
 
   do {
     volatile uint32_t *b = &s->x.u.symqueue[batch * BATCH_SIZE];
@@ -780,9 +826,10 @@ __device__ void process_symbols(inflate_state_s *s, int t) {
       len    = max((symbol & 0xffff) - 256, 0);  // max should be unnecessary, but just in case
       dist   = symbol >> 16;
       for (int i = t; i < len; i += 32) {
-        const uint8_t *src = out + ((i >= dist) ? (i % dist) : i) - dist;
-        uint8_t b          = (src < outbase) ? 0 : *src;
-        if (out + i < outend) { out[i] = b; }
+        if (out + i < outend) {
+          const T *src = out + ((i >= dist) ? (i % dist) : i) - dist;
+          out[i]       = (src < outbase) ? window_symbol<T>(src - outbase) : *src;
+        }
       }
       out += len;
       pos++;
@@ -800,7 +847,7 @@ __device__ void process_symbols(inflate_state_s *s, int t) {
     batch = (batch + 1) & (BATCH_COUNT - 1);
   } while (1);
 
-  if (t == 0) { s->out = out; }
+  if (t == 0) { s->out = reinterpret_cast<uint8_t *>(out); }
 }
 
 /**
@@ -900,15 +947,28 @@ __device__ void copy_stored(inflate_state_s *s, int t) {
   __syncthreads();
   if (t == 0) {
     // Reset bitstream to end of block
-    uint8_t *p            = cur + len;
-    uint32_t prefix_bytes = (uint32_t)(((size_t)p) & 3);
-    p -= prefix_bytes;
-    s->cur      = p;
-    s->bitbuf.x = (p < s->end) ? *(uint32_t *)p : 0;
-    p += 4;
-    s->bitbuf.y = (p < s->end) ? *(uint32_t *)p : 0;
-    s->bitpos   = prefix_bytes * 8;
-    s->out      = out;
+    init_bitstream(s, cur + len);
+    s->out = out;
+  }
+}
+
+/// Copy bytes from stored block to a 16-bit symbol output
+__device__ void copy_stored_symbols(inflate_state_s *s, int t) {
+  int len          = s->stored_blk_len;
+  uint8_t *cur     = s->cur + (s->bitpos >> 3);
+  uint16_t *out    = reinterpret_cast<uint16_t *>(s->out);
+  uint16_t *outend = reinterpret_cast<uint16_t *>(s->outend);
+
+  for (int i = t; i < len; i += NUMTHREADS) {
+    if (out + i < outend) {
+      out[i] = cur[i];  // Input range has already been validated in init_stored()
+    }
+  }
+  __syncthreads();
+  if (t == 0) {
+    // Reset bitstream to end of block
+    init_bitstream(s, cur + len);
+    s->out = reinterpret_cast<uint8_t *>(out + len);
   }
 }
 
@@ -998,55 +1058,62 @@ __device__ int parse_gzip_header(const uint8_t *src, size_t src_size) {
 }
 
 /**
- * @brief INFLATE decompression kernel
+ * @brief Locates the DEFLATE data of a compressed stream, skipping the GZIP header and footer
+ * if `parse_hdr` is nonzero
  *
- * blockDim {NUMTHREADS,1,1}
- *
- * @param inputs Source and destination buffer information per block
- * @param outputs Decompression status buffer per block
- * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ * @return The length of the GZIP header, or a negative value if it is invalid
  **/
-__global__ void __launch_bounds__(NUMTHREADS)
-  inflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int parse_hdr) {
-  __shared__ __align__(16) inflate_state_s state_g;
-
-  int t                  = threadIdx.x;
-  int z                  = blockIdx.x;
-  inflate_state_s *state = &state_g;
-
-  if (!t) {
-    uint8_t *p      = (uint8_t *)inputs[z].srcDevice;
-    size_t src_size = inputs[z].srcSize;
-    uint32_t prefix_bytes;
-    // Parse header if needed
-    state->err = 0;
-    if (parse_hdr) {
-      int hdr_len = parse_gzip_header(p, src_size);
-      src_size    = (src_size >= 8) ? src_size - 8 : 0;  // ignore footer
-      if (hdr_len >= 0) {
-        p += hdr_len;
-        src_size -= hdr_len;
-      } else {
-        state->err = hdr_len;
-      }
+__device__ int locate_deflate_data(const uint8_t *&src, size_t &src_size, int parse_hdr) {
+  int hdr_len = 0;
+  if (parse_hdr) {
+    hdr_len  = parse_gzip_header(src, src_size);
+    src_size = (src_size >= 8) ? src_size - 8 : 0;  // ignore footer
+    if (hdr_len >= 0) {
+      src += hdr_len;
+      src_size -= hdr_len;
     }
-    // Initialize shared state
-    state->out     = (uint8_t *)inputs[z].dstDevice;
-    state->outbase = state->out;
-    state->outend  = state->out + inputs[z].dstSize;
-    state->end     = p + src_size;
-    prefix_bytes   = (uint32_t)(((size_t)p) & 3);
-    p -= prefix_bytes;
-    state->cur      = p;
-    state->bitbuf.x = (p < state->end) ? *(uint32_t *)p : 0;
-    p += 4;
-    state->bitbuf.y = (p < state->end) ? *(uint32_t *)p : 0;
-    state->bitpos   = prefix_bytes * 8;
   }
-  __syncthreads();
+  return hdr_len;
+}
+
+/**
+ * @brief Thread 0 only: initializes the decoder state for decoding the blocks of a stream from
+ * bit offset `bit_start` of its DEFLATE data up to the block boundary at `end_bit`, if any
+ **/
+__device__ void init_state(inflate_state_s *state,
+                           const uint8_t *src,
+                           size_t src_size,
+                           uint8_t *dst,
+                           size_t dst_size,
+                           int parse_hdr,
+                           int64_t bit_start,
+                           int64_t end_bit) {
+  int hdr_len = locate_deflate_data(src, src_size, parse_hdr);
+  // Initialize shared state
+  state->err     = (hdr_len >= 0) ? 0 : hdr_len;
+  state->out     = dst;
+  state->outbase = state->out;
+  state->outend  = state->out + dst_size;
+  state->begin   = const_cast<uint8_t *>(src);
+  state->end     = state->begin + src_size;
+  state->end_bit = end_bit;
+  init_bitstream(state, state->begin + (bit_start >> 3));
+  if (bit_start & 7) { skipbits(state, bit_start & 7); }
+}
+
+/**
+ * @brief Decodes blocks into an output of bytes or 16-bit symbols until the last block of the
+ * stream or the block boundary at `state->end_bit`
+ **/
+template <typename T>
+__device__ void inflate_blocks(inflate_state_s *state, int t) {
   while (!state->err) {
     if (!t) {
-      if (state->cur + (state->bitpos >> 3) >= state->end)
+      if (bit_position(state) >= state->end_bit) {
+        // End of a part of the stream: No block to decode
+        state->blast = 1;
+        state->btype = -1;
+      } else if (state->cur + (state->bitpos >> 3) >= state->end)
         state->err = 2;
       else {
         state->blast = getbits(state, 1);
@@ -1081,7 +1148,7 @@ __global__ void __launch_bounds__(NUMTHREADS)
         }
       } else if (t < 2 * 32) {
         // WARP1
-        process_symbols(state, t & 0x1f);
+        process_symbols<T>(state, t & 0x1f);
       }
 #if ENABLE_PREFETCH
       else if (t < 3 * 32) {
@@ -1090,12 +1157,47 @@ __global__ void __launch_bounds__(NUMTHREADS)
       }
 #endif
     } else if (!state->err && state->btype == 0) {
-      copy_stored(state, t);
+      if (sizeof(T) == 1) {
+        copy_stored(state, t);
+      } else {
+        copy_stored_symbols(state, t);
+      }
     }
     if (state->blast) break;
     __syncthreads();
   }
   __syncthreads();
+}
+
+/**
+ * @brief INFLATE decompression kernel
+ *
+ * blockDim {NUMTHREADS,1,1}
+ *
+ * @param inputs Source and destination buffer information per block
+ * @param outputs Decompression status buffer per block
+ * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ **/
+__global__ void __launch_bounds__(NUMTHREADS)
+  inflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int parse_hdr) {
+  __shared__ __align__(16) inflate_state_s state_g;
+
+  int t                  = threadIdx.x;
+  int z                  = blockIdx.x;
+  inflate_state_s *state = &state_g;
+
+  if (!t) {
+    init_state(state,
+               (const uint8_t *)inputs[z].srcDevice,
+               inputs[z].srcSize,
+               (uint8_t *)inputs[z].dstDevice,
+               inputs[z].dstSize,
+               parse_hdr,
+               0,
+               INT64_MAX);
+  }
+  __syncthreads();
+  inflate_blocks<uint8_t>(state, t);
   if (!t) {
     if (state->err == 0 && state->cur + ((state->bitpos + 7) >> 3) > state->end) {
       // Read past the end of the input buffer
@@ -1110,6 +1212,302 @@ __global__ void __launch_bounds__(NUMTHREADS)
   }
 }
 
+/**
+ * @brief Part of a single stream, from one block boundary to the next, that is decoded in
+ * parallel with the other parts
+ **/
+struct inflate_part_s {
+  int64_t bit_start;  ///< Bit offset of the first block in the DEFLATE data
+  int64_t bit_end;    ///< Bit offset past the last block, or INT64_MAX for the last part
+  uint16_t *dst;      ///< Symbol output
+  uint64_t dst_size;  ///< Number of symbols of the output, 0 to only measure the output size
+};
+
+/**
+ * @brief Speculative INFLATE kernel decoding parts of a stream into 16-bit symbols
+ *
+ * blockDim {NUMTHREADS,1,1}
+ *
+ * References into the window preceding each part are output as window offsets (see
+ * window_symbol()). A part only decodes successfully if its blocks end exactly at
+ * `bit_end`, which validates the block boundaries found by the speculative scan.
+ *
+ * @param input Compressed stream
+ * @param parts Parts of the stream per block
+ * @param outputs Decoding status per block, the size being the number of symbols
+ * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ **/
+__global__ void __launch_bounds__(NUMTHREADS) inflate_parts_kernel(const gpu_inflate_input_s *input,
+                                                                  const inflate_part_s *parts,
+                                                                  gpu_inflate_status_s *outputs,
+                                                                  int parse_hdr) {
+  __shared__ __align__(16) inflate_state_s state_g;
+
+  int t                  = threadIdx.x;
+  int z                  = blockIdx.x;
+  inflate_state_s *state = &state_g;
+
+  if (!t) {
+    init_state(state,
+               (const uint8_t *)input->srcDevice,
+               input->srcSize,
+               reinterpret_cast<uint8_t *>(parts[z].dst),
+               parts[z].dst_size * sizeof(uint16_t),
+               parse_hdr,
+               parts[z].bit_start,
+               parts[z].bit_end);
+  }
+  __syncthreads();
+  inflate_blocks<uint16_t>(state, t);
+  if (!t) {
+    if (state->err == 0 && state->end_bit != INT64_MAX && bit_position(state) != state->end_bit) {
+      // The blocks do not end at the next boundary
+      state->err = 3;
+    } else if (state->err == 0 && state->cur + ((state->bitpos + 7) >> 3) > state->end) {
+      // Read past the end of the input buffer
+      state->err = 2;
+    } else if (state->err == 0 && parts[z].dst_size != 0 && state->out > state->outend) {
+      // Output buffer too small
+      state->err = 1;
+    }
+    outputs[z].bytes_written = (state->out - state->outbase) / sizeof(uint16_t);
+    outputs[z].status        = state->err;
+    outputs[z].reserved      = (int)(state->end - state->cur);
+  }
+}
+
+/**
+ * @brief Reads `n` <= 25 bits at bit offset `pos` of `src`, reading zeros past the end
+ **/
+inline __device__ uint32_t peek_bits(const uint8_t *src, size_t src_size, int64_t pos, uint32_t n) {
+  size_t byte = pos >> 3;
+  uint32_t v  = 0;
+  for (int i = 0; i < 4; i++) {
+    v |= (uint32_t)((byte + i < src_size) ? src[byte + i] : 0) << (i * 8);
+  }
+  return (v >> (pos & 7)) & ((1u << n) - 1);
+}
+
+/**
+ * @brief Returns the number of codes left unused by a set of code lengths, which is negative
+ * for an over-subscribed set, as in construct()
+ **/
+inline __device__ int codes_left(const int16_t *counts, int n) {
+  int left = 1;
+  if (counts[0] == n) return 0;
+  for (int len = 1; len <= MAXBITS; len++) {
+    left <<= 1;
+    left -= counts[len];
+    if (left < 0) break;
+  }
+  return left;
+}
+
+/**
+ * @brief Checks whether a non-final dynamic block header at bit offset `pos` describes valid
+ * code tables, applying the checks of init_dynamic() without building the tables
+ **/
+__device__ bool is_dynamic_block_header(const uint8_t *src, size_t src_size, int64_t pos) {
+  int16_t code_counts[MAXBITS + 1];
+  int16_t lit_counts[MAXBITS + 1];
+  int16_t dist_counts[MAXBITS + 1];
+  int16_t offs[8];
+  int16_t symbols[19];
+  uint8_t lengths[19];
+  int nlen, ndist, ncode, index, prev, eob_len, err;
+
+  if (peek_bits(src, src_size, pos, 3) != (2 << 1)) return false;  // BFINAL=0, BTYPE=2
+  nlen  = peek_bits(src, src_size, pos + 3, 5) + 257;
+  ndist = peek_bits(src, src_size, pos + 8, 5) + 1;
+  ncode = peek_bits(src, src_size, pos + 13, 4) + 4;
+  pos += 17;
+  if (nlen > MAXLCODES || ndist > MAXDCODES) return false;
+
+  // Code length codes, which must be complete
+  for (index = 0; index < 19; index++) {
+    lengths[g_code_order[index]] =
+      (index < ncode) ? peek_bits(src, src_size, pos + index * 3, 3) : 0;
+  }
+  pos += ncode * 3;
+  for (int len = 0; len <= MAXBITS; len++) {
+    code_counts[len] = 0;
+    lit_counts[len]  = 0;
+    dist_counts[len] = 0;
+  }
+  for (index = 0; index < 19; index++) code_counts[lengths[index]]++;
+  if (code_counts[0] == 19 || codes_left(code_counts, 19) != 0) return false;
+  offs[1] = 0;
+  for (int len = 1; len < 7; len++) offs[len + 1] = offs[len] + code_counts[len];
+  for (index = 0; index < 19; index++) {
+    if (lengths[index] != 0) symbols[offs[lengths[index]]++] = index;
+  }
+
+  // Literal/length and distance code lengths, which are only counted
+  index   = 0;
+  prev    = 0;
+  eob_len = 0;
+  while (index < nlen + ndist) {
+    // Slow canonical decode of a code length code, as in decode()
+    int code = 0, first = 0, count, symbol = -1, sym_index = 0, len;
+    for (len = 1; len <= 7; len++) {
+      code |= peek_bits(src, src_size, pos++, 1);
+      count = code_counts[len];
+      if (code - count < first) {
+        symbol = symbols[sym_index + (code - first)];
+        break;
+      }
+      sym_index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    if (symbol < 0) return false;
+    int repeat = 1;
+    if (symbol < 16) {
+      len = symbol;
+    } else if (symbol == 16) {
+      if (index == 0) return false;  // no last length!
+      len    = prev;
+      repeat = 3 + peek_bits(src, src_size, pos, 2);
+      pos += 2;
+    } else if (symbol == 17) {
+      len    = 0;
+      repeat = 3 + peek_bits(src, src_size, pos, 3);
+      pos += 3;
+    } else {
+      len    = 0;
+      repeat = 11 + peek_bits(src, src_size, pos, 7);
+      pos += 7;
+    }
+    if (index + repeat > nlen + ndist) return false;  // too many lengths!
+    for (; repeat > 0; repeat--, index++) {
+      if (index < nlen) {
+        lit_counts[len]++;
+        if (index == 256) eob_len = len;
+      } else {
+        dist_counts[len]++;
+      }
+    }
+    prev = len;
+  }
+  if (eob_len == 0) return false;  // no end-of-block code
+  // Incomplete codes are only allowed for a single length 1 code
+  err = codes_left(lit_counts, nlen);
+  if (err && (err < 0 || nlen != lit_counts[0] + lit_counts[1])) return false;
+  err = codes_left(dist_counts, ndist);
+  if (err && (err < 0 || ndist != dist_counts[0] + dist_counts[1])) return false;
+  return true;
+}
+
+/**
+ * @brief Speculatively scans a stream for the first plausible dynamic block header of each part
+ *
+ * blockDim {NUMTHREADS,1,1}
+ *
+ * Block z scans bit offsets [(z + 1) * part_bits, (z + 1) * part_bits + SPLIT_SCAN_BITS) of
+ * the DEFLATE data.
+ *
+ * @param input Compressed stream
+ * @param boundaries Bit offset of the first header found per block, or -1 if none
+ * @param part_bits Size in bits of the DEFLATE data of each part
+ * @param parse_hdr If nonzero, indicates that the compressed bitstream includes a GZIP header
+ **/
+__global__ void __launch_bounds__(NUMTHREADS) scan_block_boundaries_kernel(
+  const gpu_inflate_input_s *input, int64_t *boundaries, int64_t part_bits, int parse_hdr) {
+  __shared__ unsigned long long first_g;
+
+  int t              = threadIdx.x;
+  int z              = blockIdx.x;
+  const uint8_t *src = (const uint8_t *)input->srcDevice;
+  size_t src_size    = input->srcSize;
+
+  if (!t) { first_g = ~0ull; }
+  __syncthreads();
+  if (locate_deflate_data(src, src_size, parse_hdr) >= 0) {
+    int64_t start = (z + 1) * part_bits;
+    int64_t end   = min(start + SPLIT_SCAN_BITS, (int64_t)src_size * 8);
+    for (int64_t pos = start; pos < end; pos += NUMTHREADS) {
+      bool is_header = (pos + t < end) && is_dynamic_block_header(src, src_size, pos + t);
+      if (__syncthreads_or(is_header)) {
+        if (is_header) { atomicMin(&first_g, (unsigned long long)(pos + t)); }
+        __syncthreads();
+        break;
+      }
+    }
+  }
+  if (!t) { boundaries[z] = (first_g != ~0ull) ? (int64_t)first_g : -1; }
+}
+
+/**
+ * @brief Writes the bytes of symbols [begin, end) of a part decoded speculatively, reading the
+ * window preceding the part from the output already written
+ **/
+inline __device__ void resolve_symbols(const uint16_t *symbols,
+                                       uint8_t *out,
+                                       const uint8_t *outbase,
+                                       uint64_t begin,
+                                       uint64_t end,
+                                       int t) {
+  for (uint64_t i = begin + t; i < end; i += blockDim.x) {
+    uint32_t sym = symbols[i];
+    if (sym >= 256) {
+      const uint8_t *src = out + (sym - 256) - WINDOW_SIZE;
+      sym                = (src >= outbase) ? *src : 0;
+    }
+    out[i] = sym;
+  }
+}
+
+/**
+ * @brief Hands off the windows from part to part, resolving the last WINDOW_SIZE bytes of
+ * each part in turn
+ *
+ * blockDim {1024,1,1}, gridDim {1,1,1}
+ *
+ * @param symbols Symbols of the parts
+ * @param offsets Offset of the symbols and bytes of each part, followed by the total size
+ * @param num_parts Number of parts
+ * @param dst Output bytes
+ * @param output Decompression status of the stream
+ * @param status Status to write once the windows are resolved
+ **/
+__global__ void __launch_bounds__(1024) resolve_windows_kernel(const uint16_t *symbols,
+                                                               const uint64_t *offsets,
+                                                               int num_parts,
+                                                               uint8_t *dst,
+                                                               gpu_inflate_status_s *output,
+                                                               gpu_inflate_status_s status) {
+  int t = threadIdx.x;
+
+  for (int k = 0; k < num_parts; k++) {
+    uint64_t begin = offsets[k];
+    uint64_t size  = offsets[k + 1] - begin;
+    uint64_t tail  = (size > WINDOW_SIZE) ? size - WINDOW_SIZE : 0;
+    resolve_symbols(symbols + begin, dst + begin, dst, tail, size, t);
+    __syncthreads();
+  }
+  if (!t) { *output = status; }
+}
+
+/**
+ * @brief Resolves the bytes of the parts before their last WINDOW_SIZE bytes
+ *
+ * blockDim {1024,1,1}
+ *
+ * @param symbols Symbols of the parts
+ * @param offsets Offset of the symbols and bytes of each part per block, followed by the total
+ * @param dst Output bytes
+ **/
+__global__ void __launch_bounds__(1024)
+  resolve_parts_kernel(const uint16_t *symbols, const uint64_t *offsets, uint8_t *dst) {
+  int z          = blockIdx.x;
+  uint64_t begin = offsets[z];
+  uint64_t size  = offsets[z + 1] - begin;
+  uint64_t tail  = (size > WINDOW_SIZE) ? size - WINDOW_SIZE : 0;
+
+  resolve_symbols(symbols + begin, dst + begin, dst, 0, tail, threadIdx.x);
+}
+
 /**
  * @brief Copy a group of buffers
  *
@@ -1182,5 +1580,150 @@ cudaError_t __host__ gpu_copy_uncompressed_blocks(gpu_inflate_input_s *inputs,
   return cudaSuccess;
 }
 
+/**
+ * @brief Temporary memory of gpuinflate_split()
+ **/
+struct split_scratch_s {
+  gpu_inflate_input_s *input;
+  int64_t *boundaries;             ///< Block boundary found per part after the first
+  inflate_part_s *parts;           ///< Parts decoded by inflate_parts_kernel
+  gpu_inflate_status_s *statuses;  ///< Status per part
+  uint64_t *offsets;               ///< Output offset per part, followed by the total size
+  uint16_t *symbols;               ///< Symbols of the parts
+  size_t size;                     ///< Size in bytes of the temporary memory
+};
+
+static size_t max_split_parts(size_t src_size) {
+  return std::min<size_t>(std::max<size_t>(src_size / SPLIT_PART_SIZE, 1), SPLIT_MAX_PARTS);
+}
+
+static split_scratch_s split_scratch(void *scratch, size_t src_size, size_t dst_size) {
+  size_t const max_parts = max_split_parts(src_size);
+  split_scratch_s s{};
+  auto reserve = [&](size_t bytes) {
+    auto p = reinterpret_cast<uint8_t *>(scratch) + s.size;
+    s.size += (bytes + 255) & ~255;
+    return p;
+  };
+  s.input      = reinterpret_cast<gpu_inflate_input_s *>(reserve(sizeof(gpu_inflate_input_s)));
+  s.boundaries = reinterpret_cast<int64_t *>(reserve(max_parts * sizeof(int64_t)));
+  s.parts      = reinterpret_cast<inflate_part_s *>(reserve(max_parts * sizeof(inflate_part_s)));
+  s.statuses =
+    reinterpret_cast<gpu_inflate_status_s *>(reserve(max_parts * sizeof(gpu_inflate_status_s)));
+  s.offsets = reinterpret_cast<uint64_t *>(reserve((max_parts + 1) * sizeof(uint64_t)));
+  s.symbols = reinterpret_cast<uint16_t *>(reserve(dst_size * sizeof(uint16_t)));
+  return s;
+}
+
+size_t __host__ get_gpuinflate_split_scratch_size(size_t src_size, size_t dst_size) {
+  return split_scratch(nullptr, src_size, dst_size).size;
+}
+
+cudaError_t __host__ gpuinflate_split(gpu_inflate_input_s const &input,
+                                      gpu_inflate_status_s *output,
+                                      void *scratch,
+                                      size_t scratch_size,
+                                      int parse_hdr,
+                                      cudaStream_t stream) {
+  split_scratch_s const s = split_scratch(scratch, input.srcSize, input.dstSize);
+  size_t const max_parts  = max_split_parts(input.srcSize);
+
+  if (scratch_size < s.size) { return cudaErrorLaunchOutOfResources; }
+  CUDA_TRY(cudaMemcpyAsync(s.input, &input, sizeof(input), cudaMemcpyHostToDevice, stream));
+
+  // Split at the first block header found past the nominal start of each part
+  std::vector<inflate_part_s> parts{{0, INT64_MAX, s.symbols, 0}};
+  if (max_parts > 1) {
+    std::vector<int64_t> boundaries(max_parts - 1);
+    scan_block_boundaries_kernel<<<max_parts - 1, NUMTHREADS, 0, stream>>>(
+      s.input, s.boundaries, (int64_t)(input.srcSize / max_parts) * 8, parse_hdr);
+    CUDA_TRY(cudaMemcpyAsync(boundaries.data(),
+                             s.boundaries,
+                             boundaries.size() * sizeof(int64_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
+    for (auto b : boundaries) {
+      if (b > 0) {
+        parts.back().bit_end = b;
+        parts.push_back({b, INT64_MAX, s.symbols, 0});
+      }
+    }
+  }
+
+  // Measure the output of the parts, merging each part that fails to decode with the next one:
+  // the start of the next part was then a false positive of the scan, or the data is corrupt
+  std::vector<uint64_t> sizes(parts.size(), 0);
+  std::vector<uint8_t> measured(parts.size(), 0);
+  gpu_inflate_status_s last_status{};
+  while (parts.size() > 1) {
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < parts.size(); i++) {
+      if (!measured[i]) { pending.push_back(i); }
+    }
+    if (pending.empty()) { break; }
+    std::vector<inflate_part_s> batch;
+    for (auto i : pending) { batch.push_back(parts[i]); }
+    std::vector<gpu_inflate_status_s> statuses(batch.size());
+    CUDA_TRY(cudaMemcpyAsync(s.parts,
+                             batch.data(),
+                             batch.size() * sizeof(inflate_part_s),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    inflate_parts_kernel<<<batch.size(), NUMTHREADS, 0, stream>>>(
+      s.input, s.parts, s.statuses, parse_hdr);
+    CUDA_TRY(cudaMemcpyAsync(statuses.data(),
+                             s.statuses,
+                             statuses.size() * sizeof(gpu_inflate_status_s),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
+    for (size_t j = 0; j < pending.size(); j++) {
+      measured[pending[j]] = (statuses[j].status == 0);
+      sizes[pending[j]]    = statuses[j].bytes_written;
+      if (pending[j] + 1 == parts.size()) { last_status = statuses[j]; }
+    }
+    // The last part follows a valid boundary if the part before it succeeded
+    size_t const n = parts.size();
+    if (!measured[n - 1] && measured[n - 2]) { break; }
+    for (size_t i = 0; i + 1 < parts.size(); i++) {
+      if (!measured[i]) {
+        parts[i].bit_end = parts[i + 1].bit_end;
+        parts.erase(parts.begin() + i + 1);
+        sizes.erase(sizes.begin() + i + 1);
+        measured.erase(measured.begin() + i + 1);
+      }
+    }
+  }
+  std::vector<uint64_t> offsets(parts.size() + 1, 0);
+  for (size_t i = 0; i < parts.size(); i++) { offsets[i + 1] = offsets[i] + sizes[i]; }
+  if (parts.size() < 2 || !measured.back() || offsets.back() > input.dstSize) {
+    // Decode the whole stream with a single thread block
+    inflate_kernel<<<1, NUMTHREADS, 0, stream>>>(s.input, output, parse_hdr);
+    return cudaSuccess;
+  }
+
+  // Decode the parts into symbols, then resolve the windows in order and the rest in parallel
+  for (size_t i = 0; i < parts.size(); i++) {
+    parts[i].dst      = s.symbols + offsets[i];
+    parts[i].dst_size = sizes[i];
+  }
+  CUDA_TRY(cudaMemcpyAsync(s.parts,
+                           parts.data(),
+                           parts.size() * sizeof(inflate_part_s),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    s.offsets, offsets.data(), offsets.size() * sizeof(uint64_t), cudaMemcpyHostToDevice, stream));
+  inflate_parts_kernel<<<parts.size(), NUMTHREADS, 0, stream>>>(
+    s.input, s.parts, s.statuses, parse_hdr);
+  auto dst = reinterpret_cast<uint8_t *>(input.dstDevice);
+  resolve_windows_kernel<<<1, 1024, 0, stream>>>(
+    s.symbols, s.offsets, parts.size(), dst, output, {offsets.back(), 0, last_status.reserved});
+  resolve_parts_kernel<<<parts.size(), 1024, 0, stream>>>(s.symbols, s.offsets, dst);
+  CUDF_STREAM_SYNC(stream);
+  return cudaSuccess;
+}
+
 }  // namespace io
 }  // namespace cudf
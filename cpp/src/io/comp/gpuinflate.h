@@ -59,6 +59,43 @@ cudaError_t gpuinflate(gpu_inflate_input_s *inputs,
                        int parse_hdr       = 0,
                        cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Computes the size of temporary memory for decompressing a stream with
+ * gpuinflate_split()
+ *
+ * @param[in] src_size Size in bytes of the compressed stream
+ * @param[in] dst_size Size in bytes of the uncompressed output
+ *
+ * @return The size in bytes of required temporary memory
+ **/
+size_t get_gpuinflate_split_scratch_size(size_t src_size, size_t dst_size);
+
+/**
+ * @brief Interface for decompressing a single large GZIP-compressed stream with
+ * multiple thread blocks
+ *
+ * The stream is split into parts at block headers found by a speculative scan,
+ * and the parts are decoded in parallel into 16-bit symbols that keep the
+ * references into the unknown window preceding each part. The windows are then
+ * handed off from part to part to resolve the symbols into bytes. A part whose
+ * blocks do not end at the start of the next part is merged with it; streams
+ * that do not split are decompressed by a single thread block as by gpuinflate().
+ * The host waits for the stream to complete.
+ *
+ * @param[in] input Input argument structure, in host memory
+ * @param[out] output Output status structure
+ * @param[in] scratch Temporary memory for intermediate work
+ * @param[in] scratch_size Size in bytes of the temporary memory
+ * @param[in] parse_hdr Whether or not to parse GZIP header, default false
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpuinflate_split(gpu_inflate_input_s const &input,
+                             gpu_inflate_status_s *output,
+                             void *scratch,
+                             size_t scratch_size,
+                             int parse_hdr       = 0,
+                             cudaStream_t stream = (cudaStream_t)0);
+
 /**
 * @brief Interface for copying uncompressed byte blocks
 *
@@ -115,6 +152,38 @@ cudaError_t gpu_debrotli(gpu_inflate_input_s *inputs,
                          int count           = 1,
                          cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing Zstandard-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk may consist of several frames; dictionaries are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count           = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Decompresses Zstandard-compressed data in host memory
+ *
+ * Uses the same decoder as `gpu_unzstd`, for small buffers such as file
+ * metadata where a device round trip would cost more than the decoding.
+ *
+ * @param[in] src Compressed data
+ * @param[in] src_size Compressed size in bytes
+ * @param[out] dst Output buffer
+ * @param[in] dst_size Output buffer size in bytes
+ *
+ * @return Number of bytes written to the output, zero on error
+ **/
+size_t cpu_unzstd(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size);
+
 /**
  * @brief Interface for compressing data with Snappy
  *
@@ -123,14 +192,82 @@ cudaError_t gpu_debrotli(gpu_inflate_input_s *inputs,
  *
  * @param[in] inputs List of input argument structures
  * @param[out] outputs List of output status structures
+ * Level 0 matches the hash table size and copy distance of the original
+ * encoder. Level 1 uses a 4x larger hash table and copy distances up to 64KB,
+ * and level 2 also extends matches past the 64-byte limit of a copy symbol,
+ * trading encoding speed for a higher compression ratio.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
  * @param[in] count Number of input/output structures, default 1
+ * @param[in] level Compression level (0-2), default 0
  * @param[in] stream CUDA stream to use, default 0
  **/
 cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      gpu_inflate_status_s *outputs,
                      int count           = 1,
+                     int level           = 0,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing LZ4-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * With Hadoop framing, chunks that consist of Hadoop codec frames (big-endian
+ * uncompressed and compressed sizes followed by a raw block) are decoded frame
+ * by frame; other chunks are decoded as a single raw LZ4 block.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether to detect Hadoop codec framing, default false
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unlz4(gpu_inflate_input_s *inputs,
+                      gpu_inflate_status_s *outputs,
+                      int count           = 1,
+                      int hadoop_framing  = 0,
+                      cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with LZ4
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk is compressed as a single raw LZ4 block, optionally prefixed by
+ * the 8-byte Hadoop codec frame header.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether to write the Hadoop codec frame header, default false
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_lz4(gpu_inflate_input_s *inputs,
+                    gpu_inflate_status_s *outputs,
+                    int count           = 1,
+                    int hadoop_framing  = 0,
+                    cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with DEFLATE
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk is compressed as a raw DEFLATE stream (no zlib or gzip header),
+ * using stored, fixed or dynamic Huffman blocks, whichever is smallest.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_deflate(gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *outputs,
+                        int count           = 1,
+                        cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
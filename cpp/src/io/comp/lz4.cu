@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+
+#define HASH_BITS 12
+
+// Limits the literal search before overlapping the encoding with the next match search
+#define MAX_LITERAL_SEARCH 256
+
+#define MIN_MATCH 4  // Minimum match length
+#define MAX_COPY_DISTANCE 65535  // Syntax limit (16-bit offsets)
+#define MATCH_START_MARGIN 12  // The last match must start at least 12 bytes before the end
+#define LAST_LITERALS 5  // The last 5 bytes are always literals
+#define HADOOP_HEADER_SIZE 8  // Big-endian uncompressed and compressed sizes
+
+/**
+ * @brief LZ4 compressor state
+ **/
+struct lz4_state_s {
+  const uint8_t *src;                 ///< Ptr to uncompressed data
+  uint32_t src_len;                   ///< Uncompressed data length
+  uint32_t match_limit;               ///< Matches must start before this position
+  uint8_t *dst_base;                  ///< Base ptr to output compressed data
+  uint8_t *dst;                       ///< Current ptr to compressed data
+  uint8_t *end;                       ///< End of compressed data buffer
+  volatile uint32_t literal_length;   ///< Number of literal bytes
+  volatile uint32_t copy_length;      ///< Number of copy bytes
+  volatile uint32_t copy_distance;    ///< Distance for copy bytes
+  uint16_t hash_map[1 << HASH_BITS];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ **/
+static inline __device__ uint32_t lz4_hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ **/
+static inline __device__ uint32_t fetch4(const uint8_t *src) {
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Outputs an LZ4 length extension (sequence of 255s followed by the remainder)
+ *
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param len Length in excess of the 4-bit token field (length - 15)
+ * @param t Thread in warp
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *StoreLengthExt(uint8_t *dst, uint8_t *end, uint32_t len, uint32_t t) {
+  uint32_t num_bytes = len / 255 + 1;
+  for (uint32_t i = t; i < num_bytes; i += 32) {
+    if (dst + i < end) dst[i] = (i + 1 < num_bytes) ? 255 : len % 255;
+  }
+  return dst + num_bytes;
+}
+
+/**
+ * @brief Outputs an LZ4 sequence: literals optionally followed by a match
+ *
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param src Pointer to literal bytes
+ * @param literal_len Number of literal bytes
+ * @param copy_len Match length, zero for the last sequence of the block
+ * @param distance Match distance
+ * @param t Thread in warp
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *StoreSequence(uint8_t *dst,
+                                         uint8_t *end,
+                                         const uint8_t *src,
+                                         uint32_t literal_len,
+                                         uint32_t copy_len,
+                                         uint32_t distance,
+                                         uint32_t t) {
+  uint32_t match_len = (copy_len > 0) ? copy_len - MIN_MATCH : 0;
+  if (!t && dst < end) dst[0] = (min(literal_len, 15) << 4) | min(match_len, 15);
+  dst += 1;
+  if (literal_len >= 15) { dst = StoreLengthExt(dst, end, literal_len - 15, t); }
+  for (uint32_t i = t; i < literal_len; i += 32) {
+    if (dst + i < end) dst[i] = src[i];
+  }
+  dst += literal_len;
+  if (copy_len > 0) {
+    if (!t && dst + 2 <= end) {
+      dst[0] = distance;
+      dst[1] = distance >> 8;
+    }
+    dst += 2;
+    if (match_len >= 15) { dst = StoreLengthExt(dst, end, match_len - 15, t); }
+  }
+  return dst;
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ **/
+static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t) {
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < HASH_BITS; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = BALLOT(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first occurence of a consecutive 4-byte match in the input sequence,
+ * or at most MAX_LITERAL_SEARCH bytes
+ *
+ * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
+ * @param src Uncompressed buffer
+ * @param pos0 Position in uncompressed buffer
+ * @param t thread in warp
+ *
+ * @return Number of bytes before first match (literal length)
+ **/
+static __device__ uint32_t FindFourByteMatch(lz4_state_s *s,
+                                             const uint8_t *src,
+                                             uint32_t pos0,
+                                             uint32_t t) {
+  uint32_t len    = s->src_len;
+  uint32_t limit  = s->match_limit;
+  uint32_t pos    = pos0;
+  uint32_t maxpos = pos0 + MAX_LITERAL_SEARCH - 31;
+  uint32_t match_mask, literal_cnt;
+  if (t == 0) { s->copy_length = 0; }
+  do {
+    bool valid4               = (pos + t < limit);
+    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? lz4_hash(data32) : 0;
+    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+    uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match =
+          (offset < pos && offset + MAX_COPY_DISTANCE >= pos + t && fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask = BALLOT(match);
+    if (match_mask != 0) {
+      literal_cnt = __ffs(match_mask) - 1;
+      if (t == literal_cnt) {
+        s->copy_distance = pos + t - offset;
+        s->copy_length   = MIN_MATCH;
+      }
+    } else {
+      literal_cnt = 32;
+    }
+    // Update hash up to the first 4 bytes of the copy length
+    local_match &= (0x2 << literal_cnt) - 1;
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    pos += literal_cnt;
+  } while (literal_cnt == 32 && pos < maxpos);
+  return min(pos, len) - pos0;
+}
+
+/// @brief Returns the number of matching bytes for two byte sequences up to `len` bytes
+static __device__ uint32_t MatchLength(const uint8_t *src1,
+                                       const uint8_t *src2,
+                                       uint32_t len,
+                                       uint32_t t) {
+  uint32_t match_len = 0;
+  while (match_len < len) {
+    uint32_t i        = match_len + t;
+    uint32_t mismatch = BALLOT(i >= len || src1[i] != src2[i]);
+    if (mismatch != 0) { return match_len + __ffs(mismatch) - 1; }
+    match_len += 32;
+  }
+  return len;
+}
+
+/**
+ * @brief LZ4 block compression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ * @param[in] hadoop_framing Whether to prefix the block with the Hadoop codec sizes
+ **/
+extern "C" __global__ void __launch_bounds__(128) lz4_kernel(gpu_inflate_input_s *inputs,
+                                                             gpu_inflate_status_s *outputs,
+                                                             int count,
+                                                             int hadoop_framing) {
+  __shared__ __align__(16) lz4_state_s state_g;
+
+  lz4_state_s *const s = &state_g;
+  uint32_t t           = threadIdx.x;
+  uint32_t pos;
+  const uint8_t *src;
+
+  if (!t) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    uint32_t src_len   = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    uint8_t *dst       = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint32_t dst_len   = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    s->src             = src;
+    s->src_len         = src_len;
+    s->match_limit     = (src_len > MATCH_START_MARGIN) ? src_len - MATCH_START_MARGIN + 1 : 0;
+    s->dst_base        = dst;
+    s->end             = dst + dst_len;
+    s->dst             = (hadoop_framing) ? dst + HADOOP_HEADER_SIZE : dst;
+    s->literal_length  = 0;
+    s->copy_length     = 0;
+    s->copy_distance   = 0;
+  }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 128) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  __syncthreads();
+  src = s->src;
+  pos = 0;
+  // Sequences always end with a match, so literals are accumulated by warp 0
+  // until the next match is found
+  uint32_t literal_start = 0;
+  while (pos < s->src_len) {
+    uint32_t literal_len = s->literal_length;
+    uint32_t copy_len    = s->copy_length;
+    uint32_t distance    = s->copy_distance;
+    __syncthreads();
+    if (t < 32) {
+      // WARP0: Encode sequences
+      pos += literal_len;
+      if (copy_len > 0) {
+        uint8_t *dst = StoreSequence(
+          s->dst, s->end, src + literal_start, pos - literal_start, copy_len, distance, t);
+        pos += copy_len;
+        literal_start = pos;
+        SYNCWARP();
+        if (t == 0) { s->dst = dst; }
+      }
+    } else {
+      pos += literal_len + copy_len;
+      if (t < 32 * 2) {
+        // WARP1: Find a match using 12-bit hashes of 4-byte blocks
+        uint32_t t5 = t & 0x1f;
+        literal_len = FindFourByteMatch(s, src, pos, t5);
+        if (t5 == 0) { s->literal_length = literal_len; }
+        SYNCWARP();
+        copy_len = s->copy_length;
+        if (copy_len != 0) {
+          uint32_t match_pos = pos + literal_len + copy_len;  // NOTE: copy_len is always 4 here
+          copy_len += MatchLength(src + match_pos,
+                                  src + match_pos - s->copy_distance,
+                                  s->src_len - LAST_LITERALS - match_pos,
+                                  t5);
+          if (t5 == 0) { s->copy_length = copy_len; }
+        }
+      }
+    }
+    __syncthreads();
+  }
+  if (t < 32) {
+    // Flush the remaining literals (the last sequence has no match)
+    uint32_t literal_len = s->src_len - literal_start;
+    uint8_t *dst = StoreSequence(s->dst, s->end, src + literal_start, literal_len, 0, 0, t);
+    SYNCWARP();
+    if (t == 0) { s->dst = dst; }
+  }
+  __syncthreads();
+  if (!t) {
+    uint8_t *dst_base = s->dst_base;
+    if (hadoop_framing && dst_base + HADOOP_HEADER_SIZE <= s->end) {
+      uint32_t src_len  = s->src_len;
+      uint32_t comp_len = static_cast<uint32_t>(s->dst - dst_base) - HADOOP_HEADER_SIZE;
+      dst_base[0]       = src_len >> 24;
+      dst_base[1]       = src_len >> 16;
+      dst_base[2]       = src_len >> 8;
+      dst_base[3]       = src_len;
+      dst_base[4]       = comp_len >> 24;
+      dst_base[5]       = comp_len >> 16;
+      dst_base[6]       = comp_len >> 8;
+      dst_base[7]       = comp_len;
+    }
+    outputs[blockIdx.x].bytes_written = s->dst - dst_base;
+    outputs[blockIdx.x].status        = (s->dst > s->end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_lz4(gpu_inflate_input_s *inputs,
+                             gpu_inflate_status_s *outputs,
+                             int count,
+                             int hadoop_framing,
+                             cudaStream_t stream) {
+  dim3 dim_block(128, 1);  // 4 warps per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    lz4_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count, hadoop_framing);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
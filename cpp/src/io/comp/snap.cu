@@ -20,7 +20,8 @@
 namespace cudf {
 namespace io {
 
-#define HASH_BITS 12
+#define HASH_BITS 12       // Hash bits of the default level
+#define HASH_BITS_HIGH 14  // Hash bits of higher levels (32KB hash table in shared memory)
 
 // TBD: Tentatively limits to 2-byte codes to prevent long copy search followed by long literal encoding
 #define MAX_LITERAL_LENGTH 256
@@ -28,9 +29,16 @@ namespace io {
 #define MAX_COPY_LENGTH 64       // Syntax limit
 #define MAX_COPY_DISTANCE 32768  // Matches encoder limit as described in snappy format description
 
+// Limits of higher levels: longest 2-byte offset, and matches stored as several copy symbols
+#define MAX_COPY_DISTANCE_HIGH 0xffff
+#define MAX_LONG_COPY_LENGTH 256
+
 /**
  * @brief snappy compressor state
+ *
+ * @tparam hash_bits Number of bits of the match-finding hash
  **/
+template <int hash_bits>
 struct snap_state_s {
   const uint8_t *src;                 ///< Ptr to uncompressed data
   uint32_t src_len;                   ///< Uncompressed data length
@@ -40,14 +48,15 @@ struct snap_state_s {
   volatile uint32_t literal_length;   ///< Number of literal bytes
   volatile uint32_t copy_length;      ///< Number of copy bytes
   volatile uint32_t copy_distance;    ///< Distance for copy bytes
-  uint16_t hash_map[1 << HASH_BITS];  ///< Low 16-bit offset from hash
+  uint16_t hash_map[1 << hash_bits];  ///< Low 16-bit offset from hash
 };
 
 /**
- * @brief 12-bit hash from four consecutive bytes
+ * @brief hash_bits-bit hash from four consecutive bytes
  **/
+template <int hash_bits>
 static inline __device__ uint32_t snap_hash(uint32_t v) {
-  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - HASH_BITS);
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - hash_bits);
 }
 
 /**
@@ -145,16 +154,41 @@ static __device__ uint8_t *StoreCopy(uint8_t *dst,
   }
 }
 
+/**
+ * @brief Outputs a snappy copy of any length up to MAX_LONG_COPY_LENGTH as a
+ * sequence of copy symbols (assumed to be called by a single thread)
+ *
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param copy_len Copy length
+ * @param distance Copy distance
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *StoreLongCopy(uint8_t *dst,
+                                         uint8_t *end,
+                                         uint32_t copy_len,
+                                         uint32_t distance) {
+  while (copy_len > MAX_COPY_LENGTH) {
+    // Leave at least 4 bytes for the last symbol
+    uint32_t len = (copy_len - MAX_COPY_LENGTH < 4) ? MAX_COPY_LENGTH - 4 : MAX_COPY_LENGTH;
+    dst          = StoreCopy(dst, end, len, distance);
+    copy_len -= len;
+  }
+  return StoreCopy(dst, end, copy_len, distance);
+}
+
 /**
  * @brief Returns mask of any thread in the warp that has a hash value
  * equal to that of the calling thread
  **/
+template <int hash_bits>
 static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t) {
 #if (__CUDA_ARCH__ >= 700)
   return __match_any_sync(~0, v);
 #else
   uint32_t err_map = 0;
-  for (uint32_t i = 0; i < HASH_BITS; i++, v >>= 1) {
+  for (uint32_t i = 0; i < hash_bits; i++, v >>= 1) {
     uint32_t b       = v & 1;
     uint32_t match_b = BALLOT(b);
     err_map |= match_b ^ -(int32_t)b;
@@ -170,13 +204,16 @@ static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t) {
  * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
  * @param src Uncompressed buffer
  * @param pos0 Position in uncompressed buffer
+ * @param max_distance Maximum copy distance
  * @param t thread in warp
  *
  * @return Number of bytes before first match (literal length)
  **/
-static __device__ uint32_t FindFourByteMatch(snap_state_s *s,
+template <int hash_bits>
+static __device__ uint32_t FindFourByteMatch(snap_state_s<hash_bits> *s,
                                              const uint8_t *src,
                                              uint32_t pos0,
+                                             uint32_t max_distance,
                                              uint32_t t) {
   uint32_t len    = s->src_len;
   uint32_t pos    = pos0;
@@ -186,8 +223,8 @@ static __device__ uint32_t FindFourByteMatch(snap_state_s *s,
   do {
     bool valid4               = (pos + t + 4 <= len);
     uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
-    uint32_t hash             = (valid4) ? snap_hash(data32) : 0;
-    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t hash             = (valid4) ? snap_hash<hash_bits>(data32) : 0;
+    uint32_t local_match      = HashMatchAny<hash_bits>(hash, t);
     uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
     uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
     uint32_t offset, match;
@@ -199,7 +236,7 @@ static __device__ uint32_t FindFourByteMatch(snap_state_s *s,
         offset = (pos & ~0xffff) | s->hash_map[hash];
         if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
         match =
-          (offset < pos && offset + MAX_COPY_DISTANCE >= pos + t && fetch4(src + offset) == data32);
+          (offset < pos && offset + max_distance >= pos + t && fetch4(src + offset) == data32);
       }
     } else {
       match       = 0;
@@ -244,15 +281,23 @@ static __device__ uint32_t Match60(const uint8_t *src1,
  *
  * blockDim {128,1,1}
  *
+ * @tparam hash_bits Number of bits of the match-finding hash
+ *
  * @param[in] inputs Source/Destination buffer information per block
  * @param[out] outputs Compression status per block
  * @param[in] count Number of blocks to compress
+ * @param[in] max_distance Maximum copy distance
+ * @param[in] max_copy_len Maximum length of a match, up to MAX_LONG_COPY_LENGTH
  **/
-extern "C" __global__ void __launch_bounds__(128)
-  snap_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count) {
-  __shared__ __align__(16) snap_state_s state_g;
+template <int hash_bits>
+__global__ void __launch_bounds__(128) snap_kernel(gpu_inflate_input_s *inputs,
+                                                   gpu_inflate_status_s *outputs,
+                                                   int count,
+                                                   uint32_t max_distance,
+                                                   uint32_t max_copy_len) {
+  __shared__ __align__(16) snap_state_s<hash_bits> state_g;
 
-  snap_state_s *const s = &state_g;
+  snap_state_s<hash_bits> *const s = &state_g;
   uint32_t t            = threadIdx.x;
   uint32_t pos;
   const uint8_t *src;
@@ -298,7 +343,7 @@ extern "C" __global__ void __launch_bounds__(128)
         pos += literal_len;
       }
       if (copy_len > 0) {
-        if (t == 0) { dst = StoreCopy(dst, end, copy_len, distance); }
+        if (t == 0) { dst = StoreLongCopy(dst, end, copy_len, distance); }
         pos += copy_len;
       }
       SYNCWARP();
@@ -306,17 +351,22 @@ extern "C" __global__ void __launch_bounds__(128)
     } else {
       pos += literal_len + copy_len;
       if (t < 32 * 2) {
-        // WARP1: Find a match using 12-bit hashes of 4-byte blocks
+        // WARP1: Find a match using hashes of 4-byte blocks
         uint32_t t5 = t & 0x1f;
-        literal_len = FindFourByteMatch(s, src, pos, t5);
+        literal_len = FindFourByteMatch(s, src, pos, max_distance, t5);
         if (t5 == 0) { s->literal_length = literal_len; }
         copy_len = s->copy_length;
         if (copy_len != 0) {
           uint32_t match_pos = pos + literal_len + copy_len;  // NOTE: copy_len is always 4 here
-          copy_len += Match60(src + match_pos,
-                              src + match_pos - s->copy_distance,
-                              min(s->src_len - match_pos, 64 - copy_len),
-                              t5);
+          uint32_t len;
+          // Extend the match by up to 60 bytes at a time
+          do {
+            len        = min(min(s->src_len - match_pos, max_copy_len - copy_len), 60u);
+            uint32_t n = Match60(src + match_pos, src + match_pos - s->copy_distance, len, t5);
+            copy_len += n;
+            match_pos += n;
+            if (n < len) { break; }
+          } while (len != 0);
           if (t5 == 0) { s->copy_length = copy_len; }
         }
       }
@@ -334,10 +384,24 @@ extern "C" __global__ void __launch_bounds__(128)
 cudaError_t __host__ gpu_snap(gpu_inflate_input_s *inputs,
                               gpu_inflate_status_s *outputs,
                               int count,
+                              int level,
                               cudaStream_t stream) {
   dim3 dim_block(128, 1);  // 4 warps per stream, 1 stream per block
   dim3 dim_grid(count, 1);
-  if (count > 0) { snap_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  if (count <= 0) { return cudaSuccess; }
+  if (level <= 0) {
+    snap_kernel<HASH_BITS><<<dim_grid, dim_block, 0, stream>>>(
+      inputs, outputs, count, MAX_COPY_DISTANCE, MAX_COPY_LENGTH);
+  } else {
+    // Larger hash table and longer copy distance, with matches extended past a single symbol
+    // from level 2
+    snap_kernel<HASH_BITS_HIGH><<<dim_grid, dim_block, 0, stream>>>(
+      inputs,
+      outputs,
+      count,
+      MAX_COPY_DISTANCE_HIGH,
+      (level >= 2) ? MAX_LONG_COPY_LENGTH : MAX_COPY_LENGTH);
+  }
   return cudaSuccess;
 }
 
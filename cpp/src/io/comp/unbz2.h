@@ -83,6 +83,8 @@ namespace io {
 
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to the end of the last valid block,
 // and block_start will contain the offset in bits of the beginning of the block, so it can be passed in to resume decoding later on.
+// If block_end is non-zero, decoding stops after the first block ending at or past that bit offset, and
+// block_start (if non-NULL) will contain the offset in bits of the end of that block.
 #define BZ_OK 0
 #define BZ_RUN_OK 1
 #define BZ_FLUSH_OK 2
@@ -101,7 +103,8 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t inlen,
                            uint8_t *dst,
                            size_t *dstlen,
-                           uint64_t *block_start = nullptr);
+                           uint64_t *block_start = nullptr,
+                           uint64_t block_end    = 0);
 
 }  // namespace io
 }  // namespace cudf
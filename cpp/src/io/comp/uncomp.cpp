@@ -15,12 +15,18 @@
  */
 
 #include <cuda_runtime.h>
+#include <rmm/device_buffer.hpp>
 #include <rmm/rmm.h>
 #include <string.h>  // memset
 #include <zlib.h>    // uncompress
+#include "gpuinflate.h"
 #include "io_uncomp.h"
 #include "unbz2.h"  // bz2 uncompress
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 namespace cudf {
 namespace io {
 
@@ -274,6 +280,328 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+namespace {
+
+#define BZ2_BLOCK_MAGIC 0x314159265359ull  // Start of a compressed block (48 bits)
+#define BZ2_EOS_MAGIC 0x177245385090ull    // End of stream (48 bits)
+#define BZ2_SCAN_RANGE_SIZE (1 << 20)      // Minimum amount of data scanned for blocks per thread
+#define GPU_INFLATE_MIN_SIZE (8 << 20)     // Minimum size of a stream decoded on the GPU
+
+/**
+ * @brief Range of the compressed input decompressed independently on a host thread
+ **/
+struct host_segment_s {
+  size_t ofs;          // Byte offset of the gzip member or bz2 stream
+  size_t len;          // Size of the gzip member or bz2 stream in bytes
+  uint64_t bit_start;  // bz2 only: bit offset of the first block in the stream (0: first block)
+  uint64_t bit_end;    // bz2 only: bit offset past the last block in the stream (0: end of stream)
+};
+
+/**
+ * @brief Calls `fn(i)` for every i in [0, count), spreading the calls across host threads
+ **/
+template <typename Fn>
+void host_parallel_for(size_t count, Fn fn) {
+  const size_t num_workers =
+    std::min<size_t>(count, std::max<size_t>(1, std::thread::hardware_concurrency()));
+  auto work = [&](size_t first) {
+    for (size_t i = first; i < count; i += num_workers) { fn(i); }
+  };
+  if (num_workers > 1) {
+    std::vector<std::future<void>> workers;
+    for (size_t w = 0; w < num_workers; ++w) {
+      workers.emplace_back(std::async(std::launch::async, work, w));
+    }
+    for (auto &worker : workers) { worker.get(); }
+  } else if (count != 0) {
+    work(0);
+  }
+}
+
+/**
+ * @brief Decompresses segments on host threads and concatenates the results
+ *
+ * A segment that fails to decode is merged with the next one and retried: the boundary
+ * between the two was then a false positive of the signature scan that produced them.
+ *
+ * @param segments[in] Segments in input order
+ * @param dst[out] Destination vector
+ * @param decode[in] Functor decompressing a segment into a vector, returning success
+ * @param merge[in] Functor extending a segment by the next one, returning false if impossible
+ *
+ * @returns Whether all segments were decompressed
+ */
+template <typename Decode, typename Merge>
+bool host_uncompress_segments(std::vector<host_segment_s> segments,
+                              std::vector<char> &dst,
+                              Decode decode,
+                              Merge merge) {
+  std::vector<std::vector<char>> outputs(segments.size());
+  std::vector<uint8_t> decoded(segments.size(), 0);
+  for (;;) {
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < segments.size(); ++i) {
+      if (!decoded[i]) { pending.push_back(i); }
+    }
+    if (pending.empty()) { break; }
+    host_parallel_for(pending.size(), [&](size_t j) {
+      const auto i = pending[j];
+      decoded[i]   = decode(segments[i], outputs[i]);
+    });
+    size_t num_merged = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+      if (!decoded[i]) {
+        if (i + 1 >= segments.size() || !merge(segments[i], segments[i + 1])) { return false; }
+        outputs[i].clear();
+        segments.erase(segments.begin() + i + 1);
+        outputs.erase(outputs.begin() + i + 1);
+        decoded.erase(decoded.begin() + i + 1);
+        num_merged++;
+      }
+    }
+    if (num_merged == 0) { break; }
+  }
+  size_t total_len = 0;
+  for (const auto &out : outputs) { total_len += out.size(); }
+  dst.resize(total_len);
+  size_t pos = 0;
+  for (const auto &out : outputs) {
+    memcpy(dst.data() + pos, out.data(), out.size());
+    pos += out.size();
+  }
+  return true;
+}
+
+/**
+ * @brief Inflates a complete gzip member to a char vector
+ *
+ * @returns Whether the member was decoded up to its trailer and matches the stored size
+ */
+bool inflate_gzip_member(const uint8_t *raw, size_t len, std::vector<char> &dst) {
+  gz_archive_s gz;
+  z_stream strm;
+  int zerr;
+
+  if (!ParseGZArchive(&gz, raw, len)) { return false; }
+  memset(&strm, 0, sizeof(strm));
+  if (inflateInit2(&strm, -15) != Z_OK) { return false; }
+  strm.next_in  = const_cast<Bytef *>(gz.comp_data);
+  strm.avail_in = gz.comp_len;
+  dst.resize(std::max<size_t>(gz.isize, 4096));
+  do {
+    if (strm.total_out == dst.size()) { dst.resize(dst.size() * 2); }
+    strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + strm.total_out;
+    strm.avail_out = std::min<size_t>(dst.size() - strm.total_out, 1 << 30);
+    zerr           = inflate(&strm, Z_NO_FLUSH);
+  } while (zerr == Z_OK || (zerr == Z_BUF_ERROR && strm.avail_out == 0));
+  dst.resize(strm.total_out);
+  inflateEnd(&strm);
+  return (zerr == Z_STREAM_END && strm.avail_in == 0 &&
+          static_cast<uint32_t>(strm.total_out) == gz.isize);
+}
+
+/**
+ * @brief Decompresses a range of blocks of a bz2 stream to a char vector
+ *
+ * @returns Whether the blocks were decoded and the last one ends exactly at `bit_end`
+ */
+bool bz2_uncompress_blocks(
+  const uint8_t *raw, size_t len, uint64_t bit_start, uint64_t bit_end, std::vector<char> &dst) {
+  uint64_t block_start = bit_start;
+  size_t dst_pos       = 0;
+  int bz_err           = 0;
+  // In case uncompressed size isn't known in advance, assume ~4:1 compression for initial size
+  dst.resize((((bit_end != 0) ? bit_end : len * 8) - bit_start) / 2 + 4096);
+  do {
+    size_t dst_len = dst.size() - dst_pos;
+    bz_err         = cpu_bz2_uncompress(raw,
+                                len,
+                                reinterpret_cast<uint8_t *>(dst.data()) + dst_pos,
+                                &dst_len,
+                                &block_start,
+                                bit_end);
+    dst_pos += dst_len;
+    if (bz_err == BZ_OUTBUFF_FULL) { dst.resize(dst.size() + dst.size() / 2); }
+  } while (bz_err == BZ_OUTBUFF_FULL);
+  dst.resize(dst_pos);
+  return (bz_err == BZ_OK && (bit_end == 0 || block_start == bit_end));
+}
+
+/**
+ * @brief Splits concatenated gzip members at the byte offsets of plausible member headers
+ */
+std::vector<host_segment_s> find_gzip_members(const uint8_t *raw, size_t len) {
+  std::vector<host_segment_s> members;
+  for (size_t pos = 0; pos + sizeof(gz_file_header_s) < len; pos++) {
+    const void *next = memchr(raw + pos, 0x1f, len - pos);
+    if (!next) { break; }
+    pos                         = static_cast<const uint8_t *>(next) - raw;
+    const gz_file_header_s *hdr = reinterpret_cast<const gz_file_header_s *>(raw + pos);
+    // Deflate method, no reserved flag bits, known extra flags and OS id
+    if (pos + sizeof(gz_file_header_s) < len && hdr->id2 == 0x8b && hdr->comp_mthd == 8 &&
+        (hdr->flags & 0xe0) == 0 && (hdr->xflags == 0 || hdr->xflags == 2 || hdr->xflags == 4) &&
+        (hdr->os <= 13 || hdr->os == 255)) {
+      if (!members.empty()) { members.back().len = pos - members.back().ofs; }
+      members.push_back({pos, len - pos, 0, 0});
+    }
+  }
+  return members;
+}
+
+/**
+ * @brief Returns the bit offsets of the compressed block signatures found in a bz2 stream
+ *
+ * Blocks are not byte-aligned, so every bit position is tested; the stream is split into
+ * byte ranges scanned on separate host threads.
+ */
+std::vector<uint64_t> find_bz2_blocks(const uint8_t *raw, size_t len) {
+  const size_t scan_start = sizeof(bz2_file_header_s);
+  if (len < scan_start + 8) { return {}; }
+  const size_t scan_len   = len - 8 + 1 - scan_start;
+  const size_t num_ranges = std::min<size_t>(
+    std::max<size_t>(1, std::thread::hardware_concurrency()), scan_len / BZ2_SCAN_RANGE_SIZE + 1);
+  const size_t range_len = (scan_len + num_ranges - 1) / num_ranges;
+  std::vector<std::vector<uint64_t>> range_blocks(num_ranges);
+  host_parallel_for(num_ranges, [&](size_t r) {
+    const size_t end = std::min(scan_start + (r + 1) * range_len, scan_start + scan_len);
+    for (size_t pos = scan_start + r * range_len; pos < end; pos++) {
+      uint64_t bits = 0;
+      for (int i = 0; i < 8; i++) { bits = (bits << 8) | raw[pos + i]; }
+      for (uint32_t bitpos = 0; bitpos < 8; bitpos++) {
+        if (((bits >> (16 - bitpos)) & 0xffffffffffffull) == BZ2_BLOCK_MAGIC) {
+          range_blocks[r].push_back(pos * 8 + bitpos);
+        }
+      }
+    }
+  });
+  std::vector<uint64_t> blocks;
+  for (const auto &b : range_blocks) { blocks.insert(blocks.end(), b.begin(), b.end()); }
+  return blocks;
+}
+
+/**
+ * @brief Splits concatenated bz2 streams into groups of blocks
+ *
+ * Streams start byte-aligned with a "BZh1".."BZh9" header followed by a block or
+ * end-of-stream signature; the blocks of each stream are split into as many groups
+ * as there are host threads.
+ */
+std::vector<host_segment_s> find_bz2_segments(const uint8_t *raw, size_t len) {
+  const size_t hdr_len = sizeof(bz2_file_header_s) + 6;
+  std::vector<size_t> streams;
+  for (size_t pos = 0; pos + hdr_len <= len; pos++) {
+    const void *next = memchr(raw + pos, 'B', len - pos);
+    if (!next) { break; }
+    pos = static_cast<const uint8_t *>(next) - raw;
+    if (pos + hdr_len <= len && raw[pos + 1] == 'Z' && raw[pos + 2] == 'h' &&
+        raw[pos + 3] >= '1' && raw[pos + 3] <= '9') {
+      uint64_t magic = 0;
+      for (int i = 4; i < 10; i++) { magic = (magic << 8) | raw[pos + i]; }
+      if (magic == BZ2_BLOCK_MAGIC || magic == BZ2_EOS_MAGIC) { streams.push_back(pos); }
+    }
+  }
+  const size_t num_workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+  std::vector<host_segment_s> segments;
+  for (size_t s = 0; s < streams.size(); s++) {
+    const size_t ofs = streams[s];
+    const size_t end = (s + 1 < streams.size()) ? streams[s + 1] : len;
+    // Only split streams into blocks when there are fewer streams than threads
+    std::vector<uint64_t> blocks;
+    if (streams.size() < num_workers) { blocks = find_bz2_blocks(raw + ofs, end - ofs); }
+    // The first block immediately follows the stream header
+    if (blocks.size() > 1 && blocks[0] == sizeof(bz2_file_header_s) * 8) {
+      const size_t num_groups   = std::min(blocks.size(), num_workers);
+      const size_t group_blocks = (blocks.size() + num_groups - 1) / num_groups;
+      for (size_t b = 0; b < blocks.size(); b += group_blocks) {
+        const uint64_t bit_end = (b + group_blocks < blocks.size()) ? blocks[b + group_blocks] : 0;
+        segments.push_back({ofs, end - ofs, blocks[b], bit_end});
+      }
+    } else {
+      segments.push_back({ofs, end - ofs, 0, 0});
+    }
+  }
+  return segments;
+}
+
+/**
+ * @brief Inflates a single large DEFLATE stream on the GPU, split across thread blocks
+ *
+ * @returns Whether the stream was decoded to exactly `uncomp_len` bytes
+ */
+bool gpu_inflate_stream(const uint8_t *comp_data,
+                        size_t comp_len,
+                        size_t uncomp_len,
+                        std::vector<char> &dst) {
+  const size_t scratch_size = get_gpuinflate_split_scratch_size(comp_len, uncomp_len);
+  size_t free_mem = 0, total_mem = 0;
+  if (cudaMemGetInfo(&free_mem, &total_mem) != cudaSuccess ||
+      free_mem < comp_len + uncomp_len + scratch_size) {
+    return false;
+  }
+  rmm::device_buffer src(comp_data, comp_len);
+  rmm::device_buffer out(uncomp_len);
+  rmm::device_buffer scratch(scratch_size);
+  rmm::device_buffer d_status(sizeof(gpu_inflate_status_s));
+  gpu_inflate_input_s input{src.data(), comp_len, out.data(), uncomp_len};
+  gpu_inflate_status_s status{};
+  if (gpuinflate_split(input,
+                       static_cast<gpu_inflate_status_s *>(d_status.data()),
+                       scratch.data(),
+                       scratch.size()) != cudaSuccess ||
+      cudaMemcpy(&status, d_status.data(), sizeof(status), cudaMemcpyDeviceToHost) !=
+        cudaSuccess ||
+      status.status != 0 || status.bytes_written != uncomp_len) {
+    return false;
+  }
+  dst.resize(uncomp_len);
+  return cudaMemcpy(dst.data(), out.data(), uncomp_len, cudaMemcpyDeviceToHost) == cudaSuccess;
+}
+
+/**
+ * @brief Decompresses concatenated gzip members in parallel
+ *
+ * @returns Whether the input was fully decoded as a sequence of complete members
+ */
+bool host_uncompress_gzip(const uint8_t *raw, size_t len, std::vector<char> &dst) {
+  auto members = find_gzip_members(raw, len);
+  if (members.empty() || members[0].ofs != 0) { return false; }
+  return host_uncompress_segments(
+    std::move(members),
+    dst,
+    [&](const host_segment_s &m, std::vector<char> &out) {
+      return inflate_gzip_member(raw + m.ofs, m.len, out);
+    },
+    [](host_segment_s &m, const host_segment_s &next) {
+      m.len = next.ofs + next.len - m.ofs;
+      return true;
+    });
+}
+
+/**
+ * @brief Decompresses concatenated bz2 streams in parallel, splitting streams at block
+ * boundaries
+ *
+ * @returns Whether all streams were decoded
+ */
+bool host_uncompress_bz2(const uint8_t *raw, size_t len, std::vector<char> &dst) {
+  auto segments = find_bz2_segments(raw, len);
+  if (segments.empty() || segments[0].ofs != 0) { return false; }
+  return host_uncompress_segments(
+    std::move(segments),
+    dst,
+    [&](const host_segment_s &s, std::vector<char> &out) {
+      return bz2_uncompress_blocks(raw + s.ofs, s.len, s.bit_start, s.bit_end, out);
+    },
+    [](host_segment_s &s, const host_segment_s &next) {
+      // Blocks of different streams cannot be decoded together
+      if (next.ofs != s.ofs) { return false; }
+      s.bit_end = next.bit_end;
+      return true;
+    });
+}
+
+}  // namespace
+
 /* --------------------------------------------------------------------------*/
 /** 
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
@@ -371,8 +699,20 @@ gdf_error io_uncompress_single_h2d(const void *src,
       4096;  // In case uncompressed size isn't known in advance, assume ~4:1 compression for initial size
   }
 
+  // Large single streams are split across GPU thread blocks, and smaller or concatenated gzip
+  // members decoded on host threads
+  const bool is_single_stream =
+    strm_type == IO_UNCOMP_STREAM_TYPE_ZIP ||
+    (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP && find_gzip_members(raw, src_size).size() == 1);
+  if (is_single_stream && comp_len >= GPU_INFLATE_MIN_SIZE &&
+      gpu_inflate_stream(comp_data, comp_len, uncomp_len, dst)) {
+    return GDF_SUCCESS;
+  }
+  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP && host_uncompress_gzip(raw, src_size, dst)) {
+    return GDF_SUCCESS;
+  }
   if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP || strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
-    // INFLATE
+    // INFLATE (zip entries and gzip files that do not split into complete members)
     dst.resize(uncomp_len);
     int zerr = cpu_inflate_vector(dst, comp_data, comp_len);
     if (zerr != 0) {
@@ -380,27 +720,10 @@ gdf_error io_uncompress_single_h2d(const void *src,
       return GDF_FILE_ERROR;
     }
   } else if (strm_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    dst.resize(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, ((uint8_t *)dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    if (bz_err != 0) {
+    // Concatenated streams and groups of blocks are decoded in parallel, falling back to
+    // decoding the first stream sequentially
+    if (!host_uncompress_bz2(comp_data, comp_len, dst) &&
+        !bz2_uncompress_blocks(comp_data, comp_len, 0, 0, dst)) {
       dst.resize(0);
       return GDF_FILE_ERROR;
     }
@@ -565,6 +888,87 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/* --------------------------------------------------------------------------*/
+/**
+* @Brief LZ4 host decompressor class (raw blocks)
+*/
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override {
+    const uint8_t *cur = srcBytes;
+    const uint8_t *end = srcBytes + srcLen;
+    size_t dst_pos     = 0;
+
+    if (!dstBytes || srcLen < 1) { return 0; }
+    for (;;) {
+      uint32_t token   = *cur++;
+      size_t lit_len   = token >> 4;
+      size_t match_len = (token & 0xf) + 4;
+      if (lit_len == 15) {
+        uint32_t b;
+        do {
+          if (cur >= end) { return 0; }
+          b = *cur++;
+          lit_len += b;
+        } while (b == 255);
+      }
+      if (lit_len > static_cast<size_t>(end - cur) || lit_len > dstLen - dst_pos) { return 0; }
+      memcpy(dstBytes + dst_pos, cur, lit_len);
+      cur += lit_len;
+      dst_pos += lit_len;
+      if (cur == end) {
+        // The last sequence of the block only has literals
+        return dst_pos;
+      }
+      if (end - cur < 2) { return 0; }
+      uint32_t offset = cur[0] | (cur[1] << 8);
+      cur += 2;
+      if ((token & 0xf) == 0xf) {
+        uint32_t b;
+        do {
+          if (cur >= end) { return 0; }
+          b = *cur++;
+          match_len += b;
+        } while (b == 255);
+      }
+      if (offset == 0 || offset > dst_pos || match_len > dstLen - dst_pos || cur >= end) {
+        return 0;
+      }
+      do {
+        dstBytes[dst_pos] = dstBytes[dst_pos - offset];
+        dst_pos++;
+      } while (--match_len);
+    }
+  }
+};
+
+/* --------------------------------------------------------------------------*/
+/**
+* @Brief ZSTD host decompressor class
+*
+* Runs the GPU decoder on the host, without staging the data through device
+* memory. This is only intended for small buffers such as file metadata.
+*/
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override {
+    if (!dstBytes || srcLen < 1 || dstLen < 1) { return 0; }
+    return cpu_unzstd(srcBytes, srcLen, dstBytes, dstLen);
+  }
+};
+
 /* --------------------------------------------------------------------------*/
 /**
 * @Brief CPU decompression class
@@ -581,6 +985,8 @@ HostDecompressor *HostDecompressor::Create(int stream_type) {
     case IO_UNCOMP_STREAM_TYPE_GZIP: decompressor = new HostDecompressor_ZLIB(true); break;
     case IO_UNCOMP_STREAM_TYPE_INFLATE: decompressor = new HostDecompressor_ZLIB(false); break;
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: decompressor = new HostDecompressor_SNAPPY(); break;
+    case IO_UNCOMP_STREAM_TYPE_LZ4: decompressor = new HostDecompressor_LZ4(); break;
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: decompressor = new HostDecompressor_ZSTD(); break;
     default: decompressor = nullptr; break;
   }
   return decompressor;
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unlz4.cu
+ *
+ * CUDA-based LZ4 block decompression
+ *
+ * Each stream is decoded by a single warp: lane 0 parses the sequence headers
+ * while the whole warp copies literals and matches.
+ **/
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+
+#define LZ4_MIN_MATCH 4
+#define HADOOP_HEADER_SIZE 8
+#define NUM_WARPS 4
+
+/**
+ * @brief Reads a 32-bit big-endian value
+ **/
+inline __device__ uint32_t read_be32(const uint8_t *p) {
+  return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/**
+ * @brief Reads an LZ4 length extension (a sequence of bytes terminated by a value below 255)
+ *
+ * @return Whether the extension fits in the input
+ **/
+inline __device__ bool read_length_ext(const uint8_t *src,
+                                       uint32_t src_len,
+                                       uint32_t &cur,
+                                       uint32_t &len) {
+  uint32_t b;
+  do {
+    if (cur >= src_len) { return false; }
+    b = src[cur++];
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+/**
+ * @brief Decodes a raw LZ4 block (warp-synchronous)
+ *
+ * @param[in] src Compressed block
+ * @param[in] src_len Size of the compressed block in bytes
+ * @param[in] dst Output buffer
+ * @param[in] dst_pos Starting position of the block in the output buffer
+ * @param[in] dst_len Size of the output buffer
+ * @param[in] t Thread in warp
+ *
+ * @return Position in the output after the block, or -1 on error
+ **/
+__device__ int64_t unlz4_block(const uint8_t *src,
+                               uint32_t src_len,
+                               uint8_t *dst,
+                               uint32_t dst_pos,
+                               uint32_t dst_len,
+                               uint32_t t) {
+  const uint32_t block_start = dst_pos;
+  uint32_t cur               = 0;
+  for (;;) {
+    uint32_t literal_len = 0, literal_pos = 0, match_len = 0, offset = 0, error = 0;
+    if (t == 0) {
+      if (cur >= src_len) {
+        error = 1;
+      } else {
+        uint32_t token = src[cur++];
+        literal_len    = token >> 4;
+        if (literal_len == 15 && !read_length_ext(src, src_len, cur, literal_len)) { error = 1; }
+        literal_pos = cur;
+        if (literal_len > src_len - cur) {
+          error = 1;
+        } else {
+          cur += literal_len;
+        }
+        if (!error && cur < src_len) {
+          // The last sequence of the block only has literals
+          if (src_len - cur < 2) {
+            error = 1;
+          } else {
+            offset = src[cur] | (src[cur + 1] << 8);
+            cur += 2;
+            match_len = (token & 0xf) + LZ4_MIN_MATCH;
+            if ((token & 0xf) == 0xf && !read_length_ext(src, src_len, cur, match_len)) {
+              error = 1;
+            }
+          }
+        }
+      }
+    }
+    error       = SHFL0(error);
+    literal_len = SHFL0(literal_len);
+    literal_pos = SHFL0(literal_pos);
+    match_len   = SHFL0(match_len);
+    offset      = SHFL0(offset);
+    cur         = SHFL0(cur);
+    if (error || literal_len > dst_len - dst_pos || match_len > dst_len - dst_pos - literal_len) {
+      return -1;
+    }
+    for (uint32_t i = t; i < literal_len; i += 32) { dst[dst_pos + i] = src[literal_pos + i]; }
+    dst_pos += literal_len;
+    if (match_len == 0) { break; }
+    if (offset == 0 || offset > dst_pos - block_start) { return -1; }
+    SYNCWARP();
+    // Overlapping matches are copied in chunks of at most `offset` bytes
+    uint32_t chunk = min(offset, 32);
+    for (uint32_t i = 0; i < match_len; i += chunk) {
+      if (t < chunk && i + t < match_len) {
+        dst[dst_pos + i + t] = dst[dst_pos + i + t - offset];
+      }
+      SYNCWARP();
+    }
+    dst_pos += match_len;
+  }
+  return dst_pos;
+}
+
+/**
+ * @brief Returns whether the input is a valid sequence of Hadoop codec frames
+ * (each a big-endian uncompressed size and compressed size followed by a raw LZ4 block)
+ **/
+__device__ bool is_hadoop_framed(const uint8_t *src, uint32_t src_len, uint32_t dst_len) {
+  uint32_t cur = 0, total_len = 0;
+  if (src_len < HADOOP_HEADER_SIZE) { return false; }
+  while (cur < src_len) {
+    if (src_len - cur < HADOOP_HEADER_SIZE) { return false; }
+    uint32_t uncomp_len = read_be32(src + cur);
+    uint32_t comp_len   = read_be32(src + cur + 4);
+    cur += HADOOP_HEADER_SIZE;
+    if (comp_len > src_len - cur || uncomp_len > dst_len - total_len) { return false; }
+    cur += comp_len;
+    total_len += uncomp_len;
+  }
+  return true;
+}
+
+/**
+ * @brief LZ4 decompression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source & destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ * @param[in] hadoop_framing Whether to detect Hadoop codec framing
+ **/
+extern "C" __global__ void __launch_bounds__(NUM_WARPS * 32) unlz4_kernel(
+  gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count, int hadoop_framing) {
+  const int strm_id = blockIdx.x * NUM_WARPS + (threadIdx.x >> 5);
+  const uint32_t t  = threadIdx.x & 0x1f;
+  if (strm_id >= count) { return; }
+
+  const uint8_t *src = static_cast<const uint8_t *>(inputs[strm_id].srcDevice);
+  uint32_t src_len   = static_cast<uint32_t>(inputs[strm_id].srcSize);
+  uint8_t *dst       = static_cast<uint8_t *>(inputs[strm_id].dstDevice);
+  uint32_t dst_len   = static_cast<uint32_t>(inputs[strm_id].dstSize);
+  int64_t dst_pos    = -1;
+
+  uint32_t framed = 0;
+  if (hadoop_framing && t == 0) { framed = is_hadoop_framed(src, src_len, dst_len); }
+  if (SHFL0(framed)) {
+    uint32_t cur = 0;
+    dst_pos      = 0;
+    while (cur < src_len && dst_pos >= 0) {
+      uint32_t uncomp_len = read_be32(src + cur);
+      uint32_t comp_len   = read_be32(src + cur + 4);
+      int64_t frame_start = dst_pos;
+      dst_pos = unlz4_block(src + cur + HADOOP_HEADER_SIZE, comp_len, dst, dst_pos, dst_len, t);
+      if (dst_pos >= 0 && dst_pos - frame_start != uncomp_len) { dst_pos = -1; }
+      cur += HADOOP_HEADER_SIZE + comp_len;
+    }
+  }
+  if (dst_pos < 0) {
+    // Not framed, or not a valid framed stream: decode as a single raw block
+    dst_pos = unlz4_block(src, src_len, dst, 0, dst_len, t);
+  }
+  if (t == 0) {
+    outputs[strm_id].bytes_written = (dst_pos >= 0) ? dst_pos : 0;
+    outputs[strm_id].status        = (dst_pos >= 0) ? 0 : 1;
+    outputs[strm_id].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unlz4(gpu_inflate_input_s *inputs,
+                               gpu_inflate_status_s *outputs,
+                               int count,
+                               int hadoop_framing,
+                               cudaStream_t stream) {
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(NUM_WARPS * 32, 1);  // 1 warp per stream, 4 streams per block
+  dim3 dim_grid((count32 + NUM_WARPS - 1) / NUM_WARPS, 1);
+
+  if (count32 > 0) {
+    unlz4_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count, hadoop_framing);
+  }
+
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,970 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unzstd.cu
+ *
+ * CUDA-based Zstandard decompression
+ *
+ * Implements the frame format described in RFC 8878, without support for
+ * dictionaries. Each stream is decoded by a single thread, with independent
+ * streams (pages, stripe blocks) decoded in parallel across thread blocks.
+ * Back-references are resolved directly in the output buffer, and the decoded
+ * literals of each block are staged at the end of the output buffer, so no
+ * window memory is needed beyond the output itself. The same decoder is
+ * built for the host, for buffers too small to be worth a kernel launch.
+ **/
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+
+#define ZSTD_MAGIC 0xFD2FB528u
+#define ZSTD_SKIPPABLE_MAGIC 0x184D2A50u
+#define ZSTD_MAX_BLOCK_SIZE (128 * 1024)
+
+#define HUF_MAX_BITS 11
+#define HUF_MAX_SYMBOLS 256
+#define HUFW_MAX_LOG 6
+#define HUFW_MAX_SYMBOL 15
+
+#define LL_MAX_LOG 9
+#define ML_MAX_LOG 9
+#define OF_MAX_LOG 8
+#define LL_MAX_SYMBOL 35
+#define ML_MAX_SYMBOL 52
+#define OF_MAX_SYMBOL 31
+
+/**
+ * @brief Single entry of an FSE decoding table
+ **/
+struct fse_entry_s {
+  uint16_t baseline;  ///< Base of the next state
+  uint8_t symbol;     ///< Decoded symbol
+  uint8_t nbits;      ///< Number of bits to read for the next state
+};
+
+/**
+ * @brief Decoding state of a zstd frame, persistent across blocks
+ **/
+struct unzstd_state_s {
+  uint16_t huf_table[1 << HUF_MAX_BITS];  ///< Literals Huffman table, (symbol << 8) | nbits
+  fse_entry_s ll_table[1 << LL_MAX_LOG];  ///< Literal lengths table
+  fse_entry_s ml_table[1 << ML_MAX_LOG];  ///< Match lengths table
+  fse_entry_s of_table[1 << OF_MAX_LOG];  ///< Offsets table
+  fse_entry_s hufw_table[1 << HUFW_MAX_LOG];  ///< Huffman weights table
+  int32_t huf_max_bits;                       ///< Huffman table depth, zero if no table
+  int32_t ll_log;                             ///< Literal lengths table log, -1 if no table
+  int32_t ml_log;                             ///< Match lengths table log, -1 if no table
+  int32_t of_log;                             ///< Offsets table log, -1 if no table
+  uint32_t rep[3];                            ///< Repeated offsets
+};
+
+// The decoder also runs on the host, for small buffers such as file metadata,
+// so each compilation pass gets its own copy of the tables
+#ifdef __CUDA_ARCH__
+#define ZSTD_TABLE __device__ static const
+#else
+#define ZSTD_TABLE static const
+#endif
+
+// Predefined FSE distributions (RFC 8878, section 3.1.1.3.2.2)
+ZSTD_TABLE int16_t ll_default_norm[36] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+  -1, -1, -1, -1};
+ZSTD_TABLE int16_t ml_default_norm[53] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  1,  1,  1,  1,  1,  1,  1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+ZSTD_TABLE int16_t of_default_norm[29] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+
+// Literal length and match length codes (RFC 8878, section 3.1.1.3.2.1.1)
+ZSTD_TABLE uint32_t ll_base[36] = {
+  0,  1,  2,  3,  4,  5,  6,  7,   8,   9,   10,  11,   12,   13,   14,   15,    16,    18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+ZSTD_TABLE uint8_t ll_bits[36] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3,
+                                               4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+ZSTD_TABLE uint32_t ml_base[53] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11, 12,  13,  14,  15,  16,   17,   18,   19,   20,
+  21, 22, 23, 24, 25, 26, 27, 28, 29, 30,  31,  32,  33,  34,   35,   37,   39,   41,
+  43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+ZSTD_TABLE uint8_t ml_bits[53] = {0, 0, 0, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 0,
+                                               0, 0, 0, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 0,
+                                               0, 0, 0, 0,  1,  1,  1,  1,  2,  2,  3,  3,  4, 4,
+                                               5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero value
+ **/
+inline __host__ __device__ int highbit32(uint32_t v) {
+#ifdef __CUDA_ARCH__
+  return 31 - __clz(v);
+#else
+  return 31 - __builtin_clz(v);
+#endif
+}
+
+/**
+ * @brief Returns up to 32 bits of a little-endian, forward bitstream
+ *
+ * Bits past the end of the stream read as zero.
+ *
+ * @param[in] p Start of the stream
+ * @param[in] len Length of the stream in bytes
+ * @param[in] bitpos Position of the first bit to return
+ **/
+inline __host__ __device__ uint32_t fwd_peek(const uint8_t *p, uint32_t len, uint32_t bitpos) {
+  uint64_t v        = 0;
+  const uint32_t b0 = bitpos >> 3;
+  for (uint32_t i = 0; i < 5; i++) {
+    if (b0 + i < len) { v |= static_cast<uint64_t>(p[b0 + i]) << (i * 8); }
+  }
+  return static_cast<uint32_t>(v >> (bitpos & 7));
+}
+
+/**
+ * @brief Backward bitstream, read from the last byte towards the first
+ **/
+struct bwd_bitstream_s {
+  const uint8_t *base;  ///< Start of the stream
+  int32_t pos;          ///< Number of unread bits
+};
+
+/**
+ * @brief Initializes a backward bitstream, skipping the padding of the last byte
+ *
+ * @return Whether the stream is valid
+ **/
+inline __host__ __device__ bool bwd_init(bwd_bitstream_s *b, const uint8_t *p, uint32_t len) {
+  if (len == 0 || p[len - 1] == 0) { return false; }
+  b->base = p;
+  b->pos  = (len - 1) * 8 + highbit32(p[len - 1]);
+  return true;
+}
+
+/**
+ * @brief Returns the next `n` bits (n <= 32) of a backward bitstream without
+ * consuming them; bits past the start of the stream read as zero
+ **/
+inline __host__ __device__ uint32_t bwd_peek(const bwd_bitstream_s *b, int n) {
+  if (n == 0) { return 0; }
+  const int32_t lo    = b->pos - n;
+  const int32_t start = (lo < 0) ? 0 : lo;
+  const int32_t avail = b->pos - start;
+  if (avail <= 0) { return 0; }
+  uint64_t v = 0;
+  for (int32_t i = (b->pos - 1) >> 3; i >= (start >> 3); i--) { v = (v << 8) | b->base[i]; }
+  v = (v >> (start & 7)) & ((1ull << avail) - 1);
+  return static_cast<uint32_t>((lo < 0) ? v << (-lo) : v);
+}
+
+/**
+ * @brief Reads `n` bits (n <= 32) from a backward bitstream
+ *
+ * Reading past the start of the stream leaves a negative bit count.
+ **/
+inline __host__ __device__ uint32_t bwd_read(bwd_bitstream_s *b, int n) {
+  const uint32_t v = bwd_peek(b, n);
+  b->pos -= n;
+  return v;
+}
+
+/**
+ * @brief Decodes an FSE table description (normalized symbol counts)
+ *
+ * @param[out] norm Normalized count of symbols 0..max_symbol
+ * @param[in] max_symbol Largest allowed symbol value
+ * @param[in] max_log Largest allowed accuracy log
+ * @param[in] p Start of the table description
+ * @param[in] len Number of bytes available
+ * @param[out] log Accuracy log of the table
+ *
+ * @return Number of bytes consumed, or -1 if the description is invalid
+ **/
+__host__ __device__ int fse_read_ncount(
+  int16_t *norm, int max_symbol, int max_log, const uint8_t *p, uint32_t len, int *log) {
+  if (len == 0) { return -1; }
+  const int accuracy_log = (p[0] & 0xf) + 5;
+  if (accuracy_log > max_log) { return -1; }
+  uint32_t bitpos   = 4;
+  int32_t remaining = (1 << accuracy_log) + 1;
+  int32_t threshold = 1 << accuracy_log;
+  int nbits         = accuracy_log + 1;
+  int symbol        = 0;
+  while (remaining > 1 && symbol <= max_symbol) {
+    const uint32_t bits = fwd_peek(p, len, bitpos);
+    const int32_t max   = (2 * threshold - 1) - remaining;
+    int32_t count;
+    if (static_cast<int32_t>(bits & (threshold - 1)) < max) {
+      count = bits & (threshold - 1);
+      bitpos += nbits - 1;
+    } else {
+      count = bits & (2 * threshold - 1);
+      if (count >= threshold) { count -= max; }
+      bitpos += nbits;
+    }
+    count--;
+    remaining -= (count < 0) ? -count : count;
+    norm[symbol++] = count;
+    if (count == 0) {
+      // Zero probabilities are followed by 2-bit repeat counts of further zeros
+      uint32_t repeat;
+      do {
+        repeat = fwd_peek(p, len, bitpos) & 3;
+        bitpos += 2;
+        for (uint32_t i = 0; i < repeat; i++) {
+          if (symbol > max_symbol) { return -1; }
+          norm[symbol++] = 0;
+        }
+      } while (repeat == 3);
+    }
+    while (remaining < threshold) {
+      nbits--;
+      threshold >>= 1;
+    }
+  }
+  if (remaining != 1 || ((bitpos + 7) >> 3) > len) { return -1; }
+  while (symbol <= max_symbol) { norm[symbol++] = 0; }
+  *log = accuracy_log;
+  return (bitpos + 7) >> 3;
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized symbol counts
+ *
+ * @return Whether the counts describe a valid table
+ **/
+__host__ __device__ bool fse_build_table(fse_entry_s *table,
+                                         const int16_t *norm,
+                                         int max_symbol,
+                                         int log) {
+  const uint32_t size = 1 << log;
+  const uint32_t mask = size - 1;
+  const uint32_t step = (size >> 1) + (size >> 3) + 3;
+  uint32_t high       = size - 1;
+  uint16_t next_state[ML_MAX_SYMBOL + 1];
+
+  // Symbols with "less than 1" probability are placed at the end of the table
+  for (int s = 0; s <= max_symbol; s++) {
+    if (norm[s] == -1) {
+      table[high--].symbol = s;
+      next_state[s]        = 1;
+    } else {
+      next_state[s] = norm[s];
+    }
+  }
+  uint32_t pos = 0;
+  for (int s = 0; s <= max_symbol; s++) {
+    for (int i = 0; i < norm[s]; i++) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & mask;
+      } while (pos > high);
+    }
+  }
+  if (pos != 0) { return false; }
+  for (uint32_t u = 0; u < size; u++) {
+    const uint32_t state = next_state[table[u].symbol]++;
+    const int nbits      = log - highbit32(state);
+    table[u].nbits       = nbits;
+    table[u].baseline    = (state << nbits) - size;
+  }
+  return true;
+}
+
+/**
+ * @brief Sets up the FSE table of a sequence symbol type according to its compression mode
+ *
+ * @return Number of bytes consumed, or -1 if the table description is invalid
+ **/
+__host__ __device__ int fse_setup_table(fse_entry_s *table,
+                                        int32_t *log,
+                                        int mode,
+                                        const int16_t *default_norm,
+                                        int default_max_symbol,
+                                        int default_log,
+                                        int max_symbol,
+                                        int max_log,
+                                        const uint8_t *p,
+                                        uint32_t len) {
+  switch (mode) {
+    case 0:  // Predefined_Mode
+      if (!fse_build_table(table, default_norm, default_max_symbol, default_log)) { return -1; }
+      *log = default_log;
+      return 0;
+    case 1:  // RLE_Mode
+      if (len < 1 || p[0] > max_symbol) { return -1; }
+      table[0].symbol   = p[0];
+      table[0].nbits    = 0;
+      table[0].baseline = 0;
+      *log              = 0;
+      return 1;
+    case 2: {  // FSE_Compressed_Mode
+      int16_t norm[ML_MAX_SYMBOL + 1];
+      int table_log;
+      const int n = fse_read_ncount(norm, max_symbol, max_log, p, len, &table_log);
+      if (n < 0 || !fse_build_table(table, norm, max_symbol, table_log)) { return -1; }
+      *log = table_log;
+      return n;
+    }
+    default:  // Repeat_Mode
+      return (*log < 0) ? -1 : 0;
+  }
+}
+
+/**
+ * @brief Decodes a Huffman tree description and builds the literals decoding table
+ *
+ * @return Number of bytes consumed, or -1 if the description is invalid
+ **/
+__host__ __device__ int huf_read_table(unzstd_state_s *s, const uint8_t *p, uint32_t len) {
+  uint8_t weights[HUF_MAX_SYMBOLS];
+  uint32_t num_weights = 0;
+  int consumed;
+  if (len < 1) { return -1; }
+  const uint32_t header = p[0];
+  if (header >= 128) {
+    // Weights stored directly as 4-bit values
+    num_weights = header - 127;
+    consumed    = 1 + (num_weights + 1) / 2;
+    if (static_cast<uint32_t>(consumed) > len) { return -1; }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      weights[i] = (i & 1) ? p[1 + i / 2] & 0xf : p[1 + i / 2] >> 4;
+    }
+  } else {
+    // FSE-compressed weights, decoded with two interleaved states
+    int16_t norm[HUFW_MAX_SYMBOL + 1];
+    int log;
+    consumed = 1 + header;
+    if (header == 0 || static_cast<uint32_t>(consumed) > len) { return -1; }
+    const int n = fse_read_ncount(norm, HUFW_MAX_SYMBOL, HUFW_MAX_LOG, p + 1, header, &log);
+    if (n < 0 || !fse_build_table(s->hufw_table, norm, HUFW_MAX_SYMBOL, log)) { return -1; }
+    bwd_bitstream_s bs;
+    if (!bwd_init(&bs, p + 1 + n, header - n)) { return -1; }
+    uint32_t state[2];
+    state[0] = bwd_read(&bs, log);
+    state[1] = bwd_read(&bs, log);
+    if (bs.pos < 0) { return -1; }
+    for (int i = 0;; i ^= 1) {
+      if (num_weights >= HUF_MAX_SYMBOLS - 2) { return -1; }
+      const fse_entry_s &e = s->hufw_table[state[i]];
+      weights[num_weights++] = e.symbol;
+      state[i]               = e.baseline + bwd_read(&bs, e.nbits);
+      if (bs.pos < 0) {
+        weights[num_weights++] = s->hufw_table[state[i ^ 1]].symbol;
+        break;
+      }
+    }
+  }
+
+  // The weight of the last symbol is implied by the others
+  uint32_t weight_total = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] > HUF_MAX_BITS) { return -1; }
+    if (weights[i] != 0) { weight_total += 1 << (weights[i] - 1); }
+  }
+  if (weight_total == 0 || num_weights >= HUF_MAX_SYMBOLS) { return -1; }
+  const int max_bits = highbit32(weight_total) + 1;
+  if (max_bits > HUF_MAX_BITS) { return -1; }
+  const uint32_t rest = (1 << max_bits) - weight_total;
+  if (rest & (rest - 1)) { return -1; }
+  weights[num_weights++] = highbit32(rest) + 1;
+
+  // Codes are assigned by increasing weight, then by increasing symbol value
+  uint32_t rank_start[HUF_MAX_BITS + 2] = {0};
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] != 0) { rank_start[weights[i] + 1] += 1 << (weights[i] - 1); }
+  }
+  for (int w = 1; w <= max_bits; w++) { rank_start[w + 1] += rank_start[w]; }
+  for (uint32_t i = 0; i < num_weights; i++) {
+    const int w = weights[i];
+    if (w == 0) { continue; }
+    const uint16_t entry = static_cast<uint16_t>((i << 8) | (max_bits + 1 - w));
+    for (uint32_t j = 0; j < (1u << (w - 1)); j++) { s->huf_table[rank_start[w]++] = entry; }
+  }
+  s->huf_max_bits = max_bits;
+  return consumed;
+}
+
+/**
+ * @brief Decodes a single Huffman-coded literals stream
+ *
+ * @return Whether the stream was valid and fully consumed
+ **/
+__host__ __device__ bool huf_decode_stream(
+  const unzstd_state_s *s, const uint8_t *src, uint32_t len, uint8_t *dst, uint32_t count) {
+  bwd_bitstream_s bs;
+  if (!bwd_init(&bs, src, len)) { return false; }
+  const int max_bits = s->huf_max_bits;
+  for (uint32_t i = 0; i < count; i++) {
+    const uint16_t entry = s->huf_table[bwd_peek(&bs, max_bits)];
+    dst[i]               = static_cast<uint8_t>(entry >> 8);
+    bs.pos -= entry & 0xff;
+    if (bs.pos < 0) { return false; }
+  }
+  return bs.pos == 0;
+}
+
+/**
+ * @brief Decodes the literals section of a compressed block
+ *
+ * Raw literals are referenced in place; other literals are decoded into the
+ * end of the output buffer, past the output of the block.
+ *
+ * @param[in] s Decoder state
+ * @param[in] p Start of the literals section
+ * @param[in] len Number of bytes available in the block
+ * @param[in] out Current output position
+ * @param[in] out_end End of the output buffer
+ * @param[out] literals Decoded literals
+ * @param[out] literals_size Number of decoded literals
+ *
+ * @return Number of bytes consumed, or -1 on error
+ **/
+__host__ __device__ int decode_literals(unzstd_state_s *s,
+                                        const uint8_t *p,
+                                        uint32_t len,
+                                        const uint8_t *out,
+                                        uint8_t *out_end,
+                                        const uint8_t **literals,
+                                        uint32_t *literals_size) {
+  if (len < 1) { return -1; }
+  const uint32_t block_type  = p[0] & 3;
+  const uint32_t size_format = (p[0] >> 2) & 3;
+  if (block_type <= 1) {
+    // Raw_Literals_Block or RLE_Literals_Block
+    uint32_t header_size, regen_size;
+    if (size_format == 1) {
+      header_size = 2;
+      regen_size  = (p[0] >> 4) + (fwd_peek(p, len, 8) & 0xff) * 16;
+    } else if (size_format == 3) {
+      header_size = 3;
+      regen_size  = (p[0] >> 4) + (fwd_peek(p, len, 8) & 0xffff) * 16;
+    } else {
+      header_size = 1;
+      regen_size  = p[0] >> 3;
+    }
+    if (header_size + (block_type == 0 ? regen_size : 1) > len) { return -1; }
+    *literals_size = regen_size;
+    if (block_type == 0) {
+      *literals = p + header_size;
+      return header_size + regen_size;
+    }
+    if (regen_size > static_cast<size_t>(out_end - out)) { return -1; }
+    uint8_t *dst = out_end - regen_size;
+    for (uint32_t i = 0; i < regen_size; i++) { dst[i] = p[header_size]; }
+    *literals = dst;
+    return header_size + 1;
+  }
+
+  // Compressed_Literals_Block or Treeless_Literals_Block
+  uint32_t header_size, regen_size, comp_size;
+  const uint32_t header = fwd_peek(p, len, 0);
+  const int num_streams = (size_format == 0) ? 1 : 4;
+  if (size_format <= 1) {
+    header_size = 3;
+    regen_size  = (header >> 4) & 0x3ff;
+    comp_size   = (header >> 14) & 0x3ff;
+  } else if (size_format == 2) {
+    header_size = 4;
+    regen_size  = (header >> 4) & 0x3fff;
+    comp_size   = header >> 18;
+  } else {
+    header_size = 5;
+    regen_size  = (header >> 4) & 0x3ffff;
+    comp_size   = (header >> 22) | ((fwd_peek(p, len, 32) & 0xff) << 10);
+  }
+  if (header_size + comp_size > len) { return -1; }
+  const uint8_t *src = p + header_size;
+  uint32_t src_len   = comp_size;
+  if (block_type == 2) {
+    const int n = huf_read_table(s, src, src_len);
+    if (n < 0) { return -1; }
+    src += n;
+    src_len -= n;
+  } else if (s->huf_max_bits == 0) {
+    return -1;
+  }
+  if (regen_size > static_cast<size_t>(out_end - out)) { return -1; }
+  uint8_t *dst = out_end - regen_size;
+  if (num_streams == 1) {
+    if (!huf_decode_stream(s, src, src_len, dst, regen_size)) { return -1; }
+  } else {
+    // Four streams preceded by a jump table with the size of the first three
+    if (src_len < 6) { return -1; }
+    uint32_t stream_size[4];
+    stream_size[0]          = src[0] | (src[1] << 8);
+    stream_size[1]          = src[2] | (src[3] << 8);
+    stream_size[2]          = src[4] | (src[5] << 8);
+    const uint32_t total123 = 6 + stream_size[0] + stream_size[1] + stream_size[2];
+    if (total123 > src_len) { return -1; }
+    stream_size[3]           = src_len - total123;
+    const uint32_t seg_count = (regen_size + 3) / 4;
+    if (3 * seg_count > regen_size) { return -1; }
+    src += 6;
+    for (int i = 0; i < 4; i++) {
+      const uint32_t count = (i < 3) ? seg_count : regen_size - 3 * seg_count;
+      if (!huf_decode_stream(s, src, stream_size[i], dst + i * seg_count, count)) { return -1; }
+      src += stream_size[i];
+    }
+  }
+  *literals      = dst;
+  *literals_size = regen_size;
+  return header_size + comp_size;
+}
+
+/**
+ * @brief Decodes and executes the sequences section of a compressed block
+ *
+ * @param[in] s Decoder state
+ * @param[in] p Start of the sequences section
+ * @param[in] len Number of bytes in the sequences section
+ * @param[in] frame_start Start of the output of the current frame
+ * @param[in,out] out Current output position
+ * @param[in] out_end End of the output buffer
+ * @param[in] literals Decoded literals of the block
+ * @param[in] literals_size Number of decoded literals
+ *
+ * @return Whether the section was valid
+ **/
+__host__ __device__ bool decode_sequences(unzstd_state_s *s,
+                                          const uint8_t *p,
+                                          uint32_t len,
+                                          const uint8_t *frame_start,
+                                          uint8_t *&out,
+                                          const uint8_t *out_end,
+                                          const uint8_t *literals,
+                                          uint32_t literals_size) {
+  uint32_t num_sequences = 0;
+  uint32_t pos           = 0;
+  if (len < 1) { return false; }
+  if (p[0] < 128) {
+    num_sequences = p[0];
+    pos           = 1;
+  } else if (p[0] < 255) {
+    if (len < 2) { return false; }
+    num_sequences = ((p[0] - 128) << 8) + p[1];
+    pos           = 2;
+  } else {
+    if (len < 3) { return false; }
+    num_sequences = p[1] + (p[2] << 8) + 0x7f00;
+    pos           = 3;
+  }
+
+  uint32_t lit_pos = 0;
+  if (num_sequences != 0) {
+    if (pos >= len) { return false; }
+    const uint32_t modes = p[pos++];
+    if (modes & 3) { return false; }
+    int n = fse_setup_table(s->ll_table,
+                            &s->ll_log,
+                            (modes >> 6) & 3,
+                            ll_default_norm,
+                            35,
+                            6,
+                            LL_MAX_SYMBOL,
+                            LL_MAX_LOG,
+                            p + pos,
+                            len - pos);
+    if (n < 0) { return false; }
+    pos += n;
+    n = fse_setup_table(s->of_table,
+                        &s->of_log,
+                        (modes >> 4) & 3,
+                        of_default_norm,
+                        28,
+                        5,
+                        OF_MAX_SYMBOL,
+                        OF_MAX_LOG,
+                        p + pos,
+                        len - pos);
+    if (n < 0) { return false; }
+    pos += n;
+    n = fse_setup_table(s->ml_table,
+                        &s->ml_log,
+                        (modes >> 2) & 3,
+                        ml_default_norm,
+                        52,
+                        6,
+                        ML_MAX_SYMBOL,
+                        ML_MAX_LOG,
+                        p + pos,
+                        len - pos);
+    if (n < 0) { return false; }
+    pos += n;
+
+    bwd_bitstream_s bs;
+    if (pos >= len || !bwd_init(&bs, p + pos, len - pos)) { return false; }
+    uint32_t ll_state = bwd_read(&bs, s->ll_log);
+    uint32_t of_state = bwd_read(&bs, s->of_log);
+    uint32_t ml_state = bwd_read(&bs, s->ml_log);
+    for (uint32_t i = 0; i < num_sequences; i++) {
+      const fse_entry_s &ll_entry = s->ll_table[ll_state];
+      const fse_entry_s &of_entry = s->of_table[of_state];
+      const fse_entry_s &ml_entry = s->ml_table[ml_state];
+      const uint32_t of_code      = of_entry.symbol;
+      const uint32_t ml_code      = ml_entry.symbol;
+      const uint32_t ll_code      = ll_entry.symbol;
+      if (of_code > OF_MAX_SYMBOL || ml_code > ML_MAX_SYMBOL || ll_code > LL_MAX_SYMBOL) {
+        return false;
+      }
+      // Extra bits are stored in offset, match length, literal length order
+      const uint32_t offset_value = (1u << of_code) + bwd_read(&bs, of_code);
+      const uint32_t match_length = ml_base[ml_code] + bwd_read(&bs, ml_bits[ml_code]);
+      const uint32_t lit_length   = ll_base[ll_code] + bwd_read(&bs, ll_bits[ll_code]);
+
+      uint32_t offset;
+      if (offset_value > 3) {
+        offset    = offset_value - 3;
+        s->rep[2] = s->rep[1];
+        s->rep[1] = s->rep[0];
+        s->rep[0] = offset;
+      } else {
+        // Repeat offsets are shifted by one when there are no literals
+        const uint32_t idx = offset_value - 1 + (lit_length == 0);
+        if (idx == 0) {
+          offset = s->rep[0];
+        } else {
+          offset = (idx == 3) ? s->rep[0] - 1 : s->rep[idx];
+          if (idx > 1) { s->rep[2] = s->rep[1]; }
+          s->rep[1] = s->rep[0];
+          s->rep[0] = offset;
+        }
+      }
+
+      // State updates are stored in literal length, match length, offset order
+      if (i + 1 < num_sequences) {
+        ll_state = ll_entry.baseline + bwd_read(&bs, ll_entry.nbits);
+        ml_state = ml_entry.baseline + bwd_read(&bs, ml_entry.nbits);
+        of_state = of_entry.baseline + bwd_read(&bs, of_entry.nbits);
+      }
+      if (bs.pos < 0) { return false; }
+
+      // Execute the sequence
+      if (lit_length > literals_size - lit_pos ||
+          lit_length + match_length > static_cast<size_t>(out_end - out)) {
+        return false;
+      }
+      for (uint32_t j = 0; j < lit_length; j++) { out[j] = literals[lit_pos + j]; }
+      out += lit_length;
+      lit_pos += lit_length;
+      if (offset == 0 || offset > static_cast<size_t>(out - frame_start)) { return false; }
+      const uint8_t *match = out - offset;
+      for (uint32_t j = 0; j < match_length; j++) { out[j] = match[j]; }
+      out += match_length;
+    }
+    if (bs.pos != 0) { return false; }
+  } else if (pos != len) {
+    return false;
+  }
+
+  // Copy the literals that follow the last sequence
+  const uint32_t remaining = literals_size - lit_pos;
+  if (remaining > static_cast<size_t>(out_end - out)) { return false; }
+  for (uint32_t j = 0; j < remaining; j++) { out[j] = literals[lit_pos + j]; }
+  out += remaining;
+  return true;
+}
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ull
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4Full
+#define XXH_PRIME64_3 0x165667B19E3779F9ull
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ull
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ull
+
+__host__ __device__ inline uint64_t xxh64_rotl(uint64_t v, int r) {
+  return (v << r) | (v >> (64 - r));
+}
+
+__host__ __device__ inline uint64_t xxh64_read64(const uint8_t *p) {
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++) { v |= static_cast<uint64_t>(p[i]) << (i * 8); }
+  return v;
+}
+
+__host__ __device__ inline uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+  return xxh64_rotl(acc + input * XXH_PRIME64_2, 31) * XXH_PRIME64_1;
+}
+
+__host__ __device__ inline uint64_t xxh64_merge(uint64_t acc, uint64_t v) {
+  return (acc ^ xxh64_round(0, v)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/**
+ * @brief Computes the XXH64 hash (seed 0) of a buffer, used for the content
+ * checksum of zstd frames
+ **/
+__host__ __device__ uint64_t xxh64(const uint8_t *p, size_t len) {
+  const uint8_t *end = p + len;
+  uint64_t h;
+  if (len >= 32) {
+    uint64_t v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+    uint64_t v2 = XXH_PRIME64_2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - XXH_PRIME64_1;
+    for (; end - p >= 32; p += 32) {
+      v1 = xxh64_round(v1, xxh64_read64(p));
+      v2 = xxh64_round(v2, xxh64_read64(p + 8));
+      v3 = xxh64_round(v3, xxh64_read64(p + 16));
+      v4 = xxh64_round(v4, xxh64_read64(p + 24));
+    }
+    h = xxh64_rotl(v1, 1) + xxh64_rotl(v2, 7) + xxh64_rotl(v3, 12) + xxh64_rotl(v4, 18);
+    h = xxh64_merge(h, v1);
+    h = xxh64_merge(h, v2);
+    h = xxh64_merge(h, v3);
+    h = xxh64_merge(h, v4);
+  } else {
+    h = XXH_PRIME64_5;
+  }
+  h += len;
+  for (; end - p >= 8; p += 8) {
+    h ^= xxh64_round(0, xxh64_read64(p));
+    h = xxh64_rotl(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+  }
+  if (end - p >= 4) {
+    const uint32_t k = p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    h ^= k * XXH_PRIME64_1;
+    h = xxh64_rotl(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+    p += 4;
+  }
+  for (; p < end; p++) {
+    h ^= *p * XXH_PRIME64_5;
+    h = xxh64_rotl(h, 11) * XXH_PRIME64_1;
+  }
+  h ^= h >> 33;
+  h *= XXH_PRIME64_2;
+  h ^= h >> 29;
+  h *= XXH_PRIME64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Decompresses a stream made of one or more zstd frames
+ *
+ * @param[in] s Decoder state
+ * @param[in] src Compressed data
+ * @param[in] src_size Compressed size in bytes
+ * @param[in] dst Output buffer
+ * @param[in] dst_size Output buffer size in bytes
+ * @param[out] bytes_written Number of bytes written to the output
+ *
+ * @return Zero on success, non-zero on error
+ **/
+__host__ __device__ int32_t unzstd_stream(unzstd_state_s *s,
+                                          const uint8_t *src,
+                                          size_t src_size,
+                                          uint8_t *dst,
+                                          size_t dst_size,
+                                          uint64_t *bytes_written) {
+  const uint8_t *cur = src;
+  const uint8_t *end = src + src_size;
+  uint8_t *out       = dst;
+  uint8_t *out_end   = dst + dst_size;
+  int32_t error      = 0;
+
+  while (cur < end && !error) {
+    if (end - cur < 4) {
+      error = 1;
+      break;
+    }
+    const uint32_t magic = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+    if ((magic & 0xfffffff0u) == ZSTD_SKIPPABLE_MAGIC) {
+      if (end - cur < 8) {
+        error = 1;
+        break;
+      }
+      const uint32_t frame_size = cur[4] | (cur[5] << 8) | (cur[6] << 16) | (cur[7] << 24);
+      if (frame_size > static_cast<size_t>(end - cur - 8)) {
+        error = 1;
+        break;
+      }
+      cur += 8 + frame_size;
+      continue;
+    }
+    if (magic != ZSTD_MAGIC || end - cur < 5) {
+      error = 2;
+      break;
+    }
+    cur += 4;
+
+    // Frame header
+    const uint32_t descriptor   = *cur++;
+    const uint32_t fcs_flag     = descriptor >> 6;
+    const bool single_segment   = (descriptor >> 5) & 1;
+    const bool has_checksum     = (descriptor >> 2) & 1;
+    const uint32_t dict_id_flag = descriptor & 3;
+    const uint32_t dict_id_size = (dict_id_flag == 3) ? 4 : dict_id_flag;
+    const uint32_t fcs_size     = (fcs_flag == 0) ? (single_segment ? 1 : 0) : (1 << fcs_flag);
+    const uint32_t header_size  = (single_segment ? 0 : 1) + dict_id_size + fcs_size;
+    if ((descriptor & 8) || header_size > static_cast<size_t>(end - cur)) {
+      error = 3;
+      break;
+    }
+    if (!single_segment) { cur++; }  // Window size is implied by the output buffer
+    uint32_t dict_id = 0;
+    for (uint32_t i = 0; i < dict_id_size; i++) { dict_id |= cur[i] << (i * 8); }
+    cur += dict_id_size;
+    if (dict_id != 0) {
+      error = 4;  // Dictionaries are not supported
+      break;
+    }
+    uint64_t content_size = 0;
+    for (uint32_t i = 0; i < fcs_size; i++) {
+      content_size |= static_cast<uint64_t>(cur[i]) << (i * 8);
+    }
+    if (fcs_size == 2) { content_size += 256; }
+    cur += fcs_size;
+    if (fcs_size != 0 && content_size > static_cast<size_t>(out_end - out)) {
+      error = 5;
+      break;
+    }
+
+    // Blocks
+    const uint8_t *frame_start = out;
+    s->huf_max_bits            = 0;
+    s->ll_log                  = -1;
+    s->ml_log                  = -1;
+    s->of_log                  = -1;
+    s->rep[0]                  = 1;
+    s->rep[1]                  = 4;
+    s->rep[2]                  = 8;
+    bool last_block            = false;
+    while (!last_block && !error) {
+      if (end - cur < 3) {
+        error = 6;
+        break;
+      }
+      const uint32_t block_header = cur[0] | (cur[1] << 8) | (cur[2] << 16);
+      const uint32_t block_type   = (block_header >> 1) & 3;
+      const uint32_t block_size   = block_header >> 3;
+      last_block                  = block_header & 1;
+      cur += 3;
+      switch (block_type) {
+        case 0:  // Raw_Block
+          if (block_size > static_cast<size_t>(end - cur) ||
+              block_size > static_cast<size_t>(out_end - out)) {
+            error = 7;
+            break;
+          }
+          for (uint32_t i = 0; i < block_size; i++) { out[i] = cur[i]; }
+          cur += block_size;
+          out += block_size;
+          break;
+        case 1:  // RLE_Block
+          if (cur >= end || block_size > static_cast<size_t>(out_end - out)) {
+            error = 7;
+            break;
+          }
+          for (uint32_t i = 0; i < block_size; i++) { out[i] = *cur; }
+          cur += 1;
+          out += block_size;
+          break;
+        case 2: {  // Compressed_Block
+          if (block_size > static_cast<size_t>(end - cur) || block_size > ZSTD_MAX_BLOCK_SIZE) {
+            error = 7;
+            break;
+          }
+          const uint8_t *literals;
+          uint32_t literals_size;
+          const int n =
+            decode_literals(s, cur, block_size, out, out_end, &literals, &literals_size);
+          if (n < 0) {
+            error = 8;
+            break;
+          }
+          if (!decode_sequences(
+                s, cur + n, block_size - n, frame_start, out, out_end, literals, literals_size)) {
+            error = 9;
+            break;
+          }
+          cur += block_size;
+          break;
+        }
+        default: error = 7; break;
+      }
+    }
+    if (!error && fcs_size != 0 && static_cast<uint64_t>(out - frame_start) != content_size) {
+      error = 10;
+    }
+    if (!error && has_checksum) {
+      if (end - cur < 4) {
+        error = 11;
+      } else {
+        // Lower 32 bits of the XXH64 of the frame content
+        const uint32_t checksum = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+        if (checksum != static_cast<uint32_t>(xxh64(frame_start, out - frame_start))) {
+          error = 12;
+        }
+        cur += 4;
+      }
+    }
+  }
+  *bytes_written = out - dst;
+  return error;
+}
+
+/**
+ * @brief Zstandard decompression kernel
+ *
+ * blockDim {1,1,1}
+ *
+ * @param[in] inputs Source & destination information per block
+ * @param[out] outputs Decompression status per block
+ **/
+extern "C" __global__ void __launch_bounds__(1)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs) {
+  __shared__ __align__(16) unzstd_state_s state_g;
+
+  const int strm_id = blockIdx.x;
+  uint64_t bytes_written;
+  const int32_t error = unzstd_stream(&state_g,
+                                      static_cast<const uint8_t *>(inputs[strm_id].srcDevice),
+                                      inputs[strm_id].srcSize,
+                                      static_cast<uint8_t *>(inputs[strm_id].dstDevice),
+                                      inputs[strm_id].dstSize,
+                                      &bytes_written);
+  outputs[strm_id].bytes_written = bytes_written;
+  outputs[strm_id].status        = error;
+  outputs[strm_id].reserved      = 0;
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                cudaStream_t stream) {
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(1, 1);       // 1 thread per stream, 1 stream per block
+  dim3 dim_grid(count32, 1);  // Any non-negative int count fits the grid x-dimension
+
+  if (count32 > 0) { unzstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs); }
+
+  return cudaSuccess;
+}
+
+size_t __host__ cpu_unzstd(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size) {
+  auto state             = std::make_unique<unzstd_state_s>();
+  uint64_t bytes_written = 0;
+  if (unzstd_stream(state.get(), src, src_size, dst, dst_size, &bytes_written) != 0) { return 0; }
+  return bytes_written;
+}
+
+}  // namespace io
+}  // namespace cudf
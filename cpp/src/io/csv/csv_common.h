@@ -52,6 +52,19 @@ struct stats {
 };
 }  // namespace column_parse
 
+/**
+ * @brief States of the row boundary detection, each quote character toggling
+ * between the outside and inside states
+ */
+namespace row_parse {
+enum state : uint32_t {
+  outside_quotes = 0,  ///< terminators end a row
+  inside_quotes  = 1,  ///< terminators are part of a quoted field
+  partial_row    = 2,  ///< quotes are ignored until the first terminator
+  num_states     = 3,
+};
+}  // namespace row_parse
+
 }  // namespace csv
 }  // namespace io
 }  // namespace cudf
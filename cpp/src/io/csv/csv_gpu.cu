@@ -28,6 +28,9 @@
 
 #include <io/utilities/parsing_utils.cuh>
 
+#include <cub/cub.cuh>
+#include <thrust/scan.h>
+
 #include <cuda_runtime.h>
 
 using namespace ::cudf::experimental::io;
@@ -350,6 +353,21 @@ __inline__ __device__ cudf::dictionary32 decode_value(const char *data,
                                                       ParseOptions const &opts) {
   return cudf::dictionary32{};
 }
+template <>
+__inline__ __device__ cudf::list_view decode_value(const char *data,
+                                                   long start,
+                                                   long end,
+                                                   ParseOptions const &opts) {
+  return cudf::list_view{};
+}
+
+template <>
+__inline__ __device__ cudf::struct_view decode_value(const char *data,
+                                                     long start,
+                                                     long end,
+                                                     ParseOptions const &opts) {
+  return cudf::struct_view{};
+}
 
 /**
  * @brief Functor for converting CSV raw data to typed value.
@@ -552,6 +570,170 @@ __global__ void convertCsvToGdf(const char *raw_csv,
   }
 }
 
+constexpr int rowofs_block_dim        = 256;
+constexpr int rowofs_bytes_per_thread = 32;
+constexpr int rowofs_block_bytes      = rowofs_block_dim * rowofs_bytes_per_thread;
+
+/**
+ * @brief Row boundary detection of a run of characters from every starting state
+ *
+ * The state reached from starting state `s` is stored in the bits `2s` and
+ * `2s + 1` of `next`, and `count[s]` is the number of row boundaries found.
+ */
+struct row_context {
+  uint32_t next;
+  uint32_t count[row_parse::num_states];
+
+  __host__ __device__ uint32_t next_state(uint32_t s) const { return (next >> (2 * s)) & 3; }
+};
+
+__host__ __device__ inline row_context row_context_identity() {
+  return row_context{row_parse::outside_quotes | (row_parse::inside_quotes << 2) |
+                       (row_parse::partial_row << 4),
+                     {0, 0, 0}};
+}
+
+/**
+ * @brief Composes the contexts of two consecutive runs of characters
+ */
+struct compose_row_context {
+  __host__ __device__ row_context operator()(row_context const &first,
+                                             row_context const &second) const {
+    row_context result{0, {0, 0, 0}};
+    for (uint32_t s = 0; s < row_parse::num_states; ++s) {
+      auto const mid = first.next_state(s);
+      result.next |= second.next_state(mid) << (2 * s);
+      result.count[s] = first.count[s] + second.count[mid];
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Returns the state after the character `c`, and whether it ends a row
+ */
+__device__ inline uint32_t row_state_step(
+  uint32_t state, char c, char terminator, char quotechar, bool &is_boundary) {
+  is_boundary = false;
+  if (c == terminator) {
+    if (state == row_parse::inside_quotes) { return state; }
+    is_boundary = true;
+    return row_parse::outside_quotes;
+  }
+  if (quotechar != '\0' && c == quotechar && state != row_parse::partial_row) {
+    return state ^ 1;
+  }
+  return state;
+}
+
+/**
+ * @brief Finds the row boundaries of `rowofs_block_bytes` of data per block.
+ *
+ * Each thread evaluates `rowofs_bytes_per_thread` consecutive characters from
+ * every possible starting state, and the threads of a block are composed with
+ * a block scan. The first pass stores the context of each block. Once these
+ * have been scanned, the second pass knows the state at the start of each
+ * thread and writes the position after each of its row boundaries.
+ */
+template <bool write_offsets>
+__global__ void __launch_bounds__(rowofs_block_dim)
+  gather_row_offsets_kernel(const char *data,
+                            size_t size,
+                            uint64_t offset,
+                            char terminator,
+                            char quotechar,
+                            row_parse::state start_state,
+                            row_context *block_contexts,
+                            uint64_t *row_offsets) {
+  using block_scan = cub::BlockScan<row_context, rowofs_block_dim>;
+  __shared__ typename block_scan::TempStorage temp_storage;
+
+  size_t const begin = static_cast<size_t>(blockIdx.x) * rowofs_block_bytes +
+                       threadIdx.x * rowofs_bytes_per_thread;
+  size_t const end = min(begin + rowofs_bytes_per_thread, size);
+
+  // Run the characters of the thread from every starting state at once
+  uint32_t states[row_parse::num_states] = {
+    row_parse::outside_quotes, row_parse::inside_quotes, row_parse::partial_row};
+  row_context context{0, {0, 0, 0}};
+  for (size_t pos = begin; pos < end; ++pos) {
+    auto const c = data[pos];
+    for (uint32_t s = 0; s < row_parse::num_states; ++s) {
+      bool is_boundary;
+      states[s] = row_state_step(states[s], c, terminator, quotechar, is_boundary);
+      if (is_boundary) { context.count[s]++; }
+    }
+  }
+  for (uint32_t s = 0; s < row_parse::num_states; ++s) { context.next |= states[s] << (2 * s); }
+
+  row_context prefix, aggregate;
+  block_scan(temp_storage)
+    .ExclusiveScan(context, prefix, row_context_identity(), compose_row_context{}, aggregate);
+
+  if (!write_offsets) {
+    if (threadIdx.x == 0) { block_contexts[blockIdx.x] = aggregate; }
+    return;
+  }
+
+  // The scanned block contexts start from the state at the start of the data
+  auto const &block_prefix = block_contexts[blockIdx.x];
+  auto const block_state   = block_prefix.next_state(start_state);
+  auto state               = prefix.next_state(block_state);
+  auto index               = block_prefix.count[start_state] + prefix.count[block_state];
+  for (size_t pos = begin; pos < end; ++pos) {
+    bool is_boundary;
+    state = row_state_step(state, data[pos], terminator, quotechar, is_boundary);
+    if (is_boundary) { row_offsets[index++] = offset + pos + 1; }
+  }
+}
+
+cudaError_t __host__ GatherRowOffsets(const char *data,
+                                      size_t size,
+                                      uint64_t offset,
+                                      const ParseOptions &options,
+                                      row_parse::state &state,
+                                      rmm::device_vector<uint64_t> &row_offsets,
+                                      cudaStream_t stream) {
+  if (size == 0) { return cudaSuccess; }
+  auto const num_blocks = static_cast<int>((size + rowofs_block_bytes - 1) / rowofs_block_bytes);
+  rmm::device_vector<row_context> block_contexts(num_blocks);
+
+  gather_row_offsets_kernel<false><<<num_blocks, rowofs_block_dim, 0, stream>>>(
+    data, size, offset, options.terminator, options.quotechar, state, block_contexts.data().get(),
+    nullptr);
+
+  // The context of the whole data is the last block composed after its prefix
+  row_context last_block;
+  CUDA_TRY(cudaMemcpyAsync(&last_block,
+                           block_contexts.data().get() + num_blocks - 1,
+                           sizeof(row_context),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         block_contexts.begin(),
+                         block_contexts.end(),
+                         block_contexts.begin(),
+                         row_context_identity(),
+                         compose_row_context{});
+  row_context last_prefix;
+  CUDA_TRY(cudaMemcpyAsync(&last_prefix,
+                           block_contexts.data().get() + num_blocks - 1,
+                           sizeof(row_context),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  auto const total = compose_row_context{}(last_prefix, last_block);
+
+  auto const first_index = row_offsets.size();
+  row_offsets.resize(first_index + total.count[state]);
+  gather_row_offsets_kernel<true><<<num_blocks, rowofs_block_dim, 0, stream>>>(
+    data, size, offset, options.terminator, options.quotechar, state, block_contexts.data().get(),
+    row_offsets.data().get() + first_index);
+
+  state = static_cast<row_parse::state>(total.next_state(state));
+  return cudaSuccess;
+}
+
 cudaError_t __host__ DetectColumnTypes(const char *data,
                                        const uint64_t *row_starts,
                                        size_t num_rows,
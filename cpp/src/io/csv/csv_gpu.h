@@ -19,11 +19,39 @@
 #include <cudf/types.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 namespace cudf {
 namespace io {
 namespace csv {
 namespace gpu {
 
+/**
+ * @brief Appends the position after each row terminator of the data to the
+ * row offsets, skipping the terminators within quoted fields
+ *
+ * Each block of the data is evaluated from every possible starting state at
+ * once, and the results of the blocks are composed with a scan, so the
+ * detection is parallel however the fields are quoted.
+ *
+ * @param[in] data The character data in device memory
+ * @param[in] size Number of bytes of data
+ * @param[in] offset Position of the data in the input, added to the output positions
+ * @param[in] options Options that define the terminator and quote characters
+ * @param[in,out] state State at the start of the data; set to the state at its end
+ * @param[in,out] row_offsets Row offsets to append the found positions to
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t GatherRowOffsets(const char *data,
+                             size_t size,
+                             uint64_t offset,
+                             const cudf::experimental::io::ParseOptions &options,
+                             row_parse::state &state,
+                             rmm::device_vector<uint64_t> &row_offsets,
+                             cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for detecting possible dtype of each column of data
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <strings/convert/iso8601.cuh>
+
 /**
  * @brief Returns location to the first occurrence of a character in a string
  *
@@ -288,6 +290,62 @@ __inline__ __device__ void extractTime(
   }
 }
 
+/**
+ * @brief Returns the ISO-8601 layout of a date or datetime string whose fields
+ * are all digits at fixed offsets
+ *
+ * The layouts are YYYY-MM-DD and YYYY-MM-DDTHH:MM:SS, with a 'T' or a space
+ * separator, optionally followed by '.' and 3 millisecond digits and by 'Z'.
+ * Such strings are parsed to the same values as by the general parsing.
+ *
+ * @param[in] data The character stream to check
+ * @param[in] start The start index of the character stream
+ * @param[in] end The end index of the character stream
+ *
+ * @return The layout of the string, or `iso8601_layout::NONE`
+ */
+__inline__ __device__ cudf::strings::detail::iso8601_layout findISO8601Layout(const char *data,
+                                                                               long start,
+                                                                               long end) {
+  using cudf::strings::detail::iso8601_layout;
+  const char *str   = data + start;
+  const long length = end - start + 1;
+  const bool utc    = length > 19 && str[length - 1] == 'Z';
+  const long fields = length - utc;
+  if (fields != 10 && fields != 19 && fields != 23) return iso8601_layout::NONE;
+  for (long i = 0; i < fields; ++i) {
+    const char c = str[i];
+    bool good;
+    switch (i) {
+      case 4:
+      case 7: good = c == '-'; break;
+      case 10: good = c == 'T' || c == ' '; break;
+      case 13:
+      case 16: good = c == ':'; break;
+      case 19: good = c == '.'; break;
+      default: good = c >= '0' && c <= '9';
+    }
+    if (!good) return iso8601_layout::NONE;
+  }
+  if (fields == 10) return iso8601_layout::DATE;
+  if (fields == 19) return utc ? iso8601_layout::DATETIME_Z : iso8601_layout::DATETIME;
+  return utc ? iso8601_layout::DATETIME_SUBSECOND_Z : iso8601_layout::DATETIME_SUBSECOND;
+}
+
+/**
+ * @brief Computes the milliseconds since epoch of a string of an ISO-8601
+ * layout found by `findISO8601Layout`
+ *
+ * @param[in] str The first character of the string
+ *
+ * @return Milliseconds since epoch
+ */
+template <cudf::strings::detail::iso8601_layout layout>
+__inline__ __device__ int64_t parseISO8601(const char *str) {
+  const auto f = cudf::strings::detail::parse_iso8601<layout>(str, 3);
+  return secondsSinceEpoch(f.year, f.month, f.day, f.hour, f.minute, f.second) * 1000 + f.subsecond;
+}
+
 /**
  * @brief Parse a Date string into a date32, days since epoch
  *
@@ -305,6 +363,12 @@ __inline__ __device__ int32_t parseDateFormat(const char *data,
                                               long start_idx,
                                               long end_idx,
                                               bool dayfirst) {
+  using cudf::strings::detail::iso8601_layout;
+  if (findISO8601Layout(data, start_idx, end_idx) == iso8601_layout::DATE) {
+    const auto f = cudf::strings::detail::parse_iso8601<iso8601_layout::DATE>(data + start_idx, 0);
+    return daysSinceEpoch(f.year, f.month, f.day);
+  }
+
   int day, month, year;
   int32_t e = -1;
 
@@ -333,6 +397,19 @@ __inline__ __device__ int64_t parseDateTimeFormat(const char *data,
                                                   long start,
                                                   long end,
                                                   bool dayfirst) {
+  // The common ISO-8601 layouts are read at fixed offsets
+  using cudf::strings::detail::iso8601_layout;
+  switch (findISO8601Layout(data, start, end)) {
+    case iso8601_layout::DATE: return parseISO8601<iso8601_layout::DATE>(data + start);
+    case iso8601_layout::DATETIME: return parseISO8601<iso8601_layout::DATETIME>(data + start);
+    case iso8601_layout::DATETIME_Z: return parseISO8601<iso8601_layout::DATETIME_Z>(data + start);
+    case iso8601_layout::DATETIME_SUBSECOND:
+      return parseISO8601<iso8601_layout::DATETIME_SUBSECOND>(data + start);
+    case iso8601_layout::DATETIME_SUBSECOND_Z:
+      return parseISO8601<iso8601_layout::DATETIME_SUBSECOND_Z>(data + start);
+    default: break;
+  }
+
   int day, month, year;
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
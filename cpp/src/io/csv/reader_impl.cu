@@ -53,6 +53,9 @@ namespace csv {
 using namespace cudf::io::csv;
 using namespace cudf::io;
 
+// Largest part of the host data copied to the device at a time to find the rows
+constexpr size_t max_row_offsets_chunk_bytes = 256 * 1024 * 1024;  // 256MB
+
 /**---------------------------------------------------------------------------*
  * @brief Estimates the maximum expected length or a row, based on the number
  * of columns
@@ -183,9 +186,6 @@ table_with_metadata reader::impl::read(size_t range_offset,
                                        int skip_end_rows,
                                        int num_rows,
                                        cudaStream_t stream) {
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata metadata;
-
   if (range_offset > 0 || range_size > 0) {
     CUDF_EXPECTS(compression_type_ == "none",
                  "Reading compressed data using `byte range` is unsupported");
@@ -205,18 +205,17 @@ table_with_metadata reader::impl::read(size_t range_offset,
 
   // Return an empty dataframe if no data and no column metadata to process
   if (source_->empty() && (args_.names.empty() || args_.dtype.empty())) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+    return {std::make_unique<table>(std::vector<std::unique_ptr<column>>{}), table_metadata{}};
   }
 
-  // Transfer source data to GPU
+  const char *h_uncomp_data = nullptr;
+  size_t h_uncomp_size      = 0;
+  std::shared_ptr<arrow::Buffer> buffer;
+  std::vector<char> h_uncomp_data_owner;
   if (!source_->empty()) {
-    const char *h_uncomp_data = nullptr;
-    size_t h_uncomp_size      = 0;
-
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->get_buffer(range_offset, data_size);
+    buffer         = source_->get_buffer(range_offset, data_size);
 
-    std::vector<char> h_uncomp_data_owner;
     if (compression_type_ == "none") {
       // Do not use the owner vector here to avoid extra copy
       h_uncomp_data = reinterpret_cast<const char *>(buffer->data());
@@ -230,6 +229,33 @@ table_with_metadata reader::impl::read(size_t range_offset,
       h_uncomp_data = h_uncomp_data_owner.data();
       h_uncomp_size = h_uncomp_data_owner.size();
     }
+  }
+
+  return read_host_data(h_uncomp_data,
+                        h_uncomp_size,
+                        range_offset,
+                        range_size,
+                        skip_rows,
+                        skip_end_rows,
+                        num_rows,
+                        stream);
+}
+
+table_with_metadata reader::impl::read_host_data(const char *h_uncomp_data,
+                                                 size_t h_uncomp_size,
+                                                 size_t range_offset,
+                                                 size_t range_size,
+                                                 int skip_rows,
+                                                 int skip_end_rows,
+                                                 int num_rows,
+                                                 cudaStream_t stream) {
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata metadata;
+
+  num_records = 0;
+
+  // Transfer source data to GPU
+  if (h_uncomp_size != 0) {
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows == 0 &&
                                  skip_end_rows == 0 && num_rows == -1;
@@ -244,7 +270,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
     auto row_range = select_rows(
       h_uncomp_data, h_uncomp_size, range_size, skip_rows, skip_end_rows, num_rows, stream);
 
-    data_size = row_range.second - row_range.first;
+    const auto data_size = row_range.second - row_range.first;
     CUDF_EXPECTS(data_size <= h_uncomp_size, "Row range exceeds data size");
 
     num_bits = (data_size + 63) / 64;
@@ -253,11 +279,59 @@ table_with_metadata reader::impl::read(size_t range_offset,
       data_ptr = static_cast<char *>(data_.data()) + row_range.first;
     } else {
       // The start offset is applied to the device data buffer
-      data_    = rmm::device_buffer(h_uncomp_data + row_range.first, data_size);
+      data_    = rmm::device_buffer(h_uncomp_data + row_range.first, data_size, stream);
       data_ptr = static_cast<char *>(data_.data());
     }
   }
 
+  // Column names and selection are only resolved once for chunked reads
+  if (!fixed_schema_) { resolve_columns(); }
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols == 0) {
+    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+  }
+
+  std::vector<data_type> column_types =
+    fixed_schema_ ? chunk_column_types_ : gather_column_types(stream);
+
+  // Alloc output; columns' data memory is still expected for empty dataframe
+  std::vector<column_buffer> out_buffers;
+  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
+    if (h_column_flags[col] & column_parse::enabled) {
+      out_buffers.emplace_back(column_types[active_col], num_records, true, stream, mr_);
+      metadata.column_names.emplace_back(col_names[col]);
+      active_col++;
+    }
+  }
+
+  if (num_records != 0) { decode_data(column_types, out_buffers, stream); }
+
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    out_columns.emplace_back(make_column(column_types[i], num_records, out_buffers[i]));
+  }
+
+  // TODO: String columns need to be reworked to actually copy characters in
+  // kernel to allow skipping quotation characters
+  /*for (auto &column : columns) {
+    column.finalize();
+
+    // PANDAS' default behavior of enabling doublequote for two consecutive
+    // quotechars in quoted fields results in reduction to a single quotechar
+    if (column->dtype == GDF_STRING &&
+        (opts.quotechar != '\0' && opts.doublequote == true)) {
+      const std::string quotechar(1, opts.quotechar);
+      const std::string dblquotechar(2, opts.quotechar);
+      auto str_data = static_cast<NVStrings *>(column->data);
+      column->data = str_data->replace(dblquotechar.c_str(), quotechar.c_str());
+      NVStrings::destroy(str_data);
+    }
+  }*/
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+}
+
+void reader::impl::resolve_columns() {
   // Check if the user gave us a list of column names
   if (not args_.names.empty()) {
     h_column_flags.resize(args_.names.size(), column_parse::enabled);
@@ -330,48 +404,6 @@ table_with_metadata reader::impl::read(size_t range_offset,
       }
     }
   }
-
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols == 0) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
-  }
-
-  std::vector<data_type> column_types = gather_column_types(stream);
-
-  // Alloc output; columns' data memory is still expected for empty dataframe
-  std::vector<column_buffer> out_buffers;
-  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
-    if (h_column_flags[col] & column_parse::enabled) {
-      out_buffers.emplace_back(column_types[active_col], num_records, true, stream, mr_);
-      metadata.column_names.emplace_back(col_names[col]);
-      active_col++;
-    }
-  }
-
-  if (num_records != 0) { decode_data(column_types, out_buffers, stream); }
-
-  for (size_t i = 0; i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_column(column_types[i], num_records, out_buffers[i]));
-  }
-
-  // TODO: String columns need to be reworked to actually copy characters in
-  // kernel to allow skipping quotation characters
-  /*for (auto &column : columns) {
-    column.finalize();
-
-    // PANDAS' default behavior of enabling doublequote for two consecutive
-    // quotechars in quoted fields results in reduction to a single quotechar
-    if (column->dtype == GDF_STRING &&
-        (opts.quotechar != '\0' && opts.doublequote == true)) {
-      const std::string quotechar(1, opts.quotechar);
-      const std::string dblquotechar(2, opts.quotechar);
-      auto str_data = static_cast<NVStrings *>(column->data);
-      column->data = str_data->replace(dblquotechar.c_str(), quotechar.c_str());
-      NVStrings::destroy(str_data);
-    }
-  }*/
-
-  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
 void reader::impl::gather_row_offsets(const char *h_data,
@@ -379,45 +411,37 @@ void reader::impl::gather_row_offsets(const char *h_data,
                                       size_t range_offset,
                                       cudaStream_t stream,
                                       const rmm::device_buffer *d_data) {
-  // Account for the start and end of row region offsets
-  const bool require_first_line_start = (range_offset == 0);
-  const bool require_last_line_end    = (h_data[h_size - 1] != opts.terminator);
-
-  auto symbols = (opts.quotechar != '\0') ? std::vector<char>{opts.terminator, opts.quotechar}
-                                          : std::vector<char>{opts.terminator};
+  // Account for the start of row region offsets
+  row_offsets.resize(0);
+  if (range_offset == 0) { row_offsets.push_back(0); }
 
-  cudf::size_type num_rows = (require_first_line_start ? 1 : 0);
+  // A byte range starting within the file begins in a row of unknown quoting
+  auto state = (range_offset == 0) ? row_parse::outside_quotes : row_parse::partial_row;
   if (d_data) {
     // preloaded to device memory
-    num_rows += count_all_from_set(*d_data, symbols);
+    CUDA_TRY(gpu::GatherRowOffsets(
+      static_cast<const char *>(d_data->data()), h_size, 0, opts, state, row_offsets, stream));
   } else {
-    num_rows += count_all_from_set(h_data, h_size, symbols);
+    // The detection state carries over from one chunk of the host data to the next
+    rmm::device_buffer d_chunk(std::min(max_row_offsets_chunk_bytes, h_size), stream);
+    for (size_t pos = 0; pos < h_size; pos += max_row_offsets_chunk_bytes) {
+      const auto chunk_bytes = std::min(max_row_offsets_chunk_bytes, h_size - pos);
+      CUDA_TRY(cudaMemcpyAsync(
+        d_chunk.data(), h_data + pos, chunk_bytes, cudaMemcpyHostToDevice, stream));
+      CUDA_TRY(gpu::GatherRowOffsets(static_cast<const char *>(d_chunk.data()),
+                                     chunk_bytes,
+                                     pos,
+                                     opts,
+                                     state,
+                                     row_offsets,
+                                     stream));
+    }
   }
-  const auto num_offsets = num_rows + (require_last_line_end ? 1 : 0);
-  row_offsets.resize(num_offsets);
 
-  auto ptr_first = row_offsets.data().get();
-  auto ptr_last  = ptr_first + num_rows;
-  if (require_first_line_start) {
-    ptr_first++;
-    const uint64_t first_entry = 0;
-    row_offsets.front()        = first_entry;
-  }
-  if (require_last_line_end) {
-    const uint64_t last_entry = h_size;
-    row_offsets.back()        = last_entry;
+  // Account for the end of row region offsets
+  if (row_offsets.empty() || static_cast<uint64_t>(row_offsets.back()) != h_size) {
+    row_offsets.push_back(h_size);
   }
-
-  // Passing offset = 1 to return positions AFTER the found character
-  if (d_data) {
-    find_all_from_set(*d_data, symbols, 1, ptr_first);
-  } else {
-    find_all_from_set(h_data, h_size, symbols, 1, ptr_first);
-  }
-
-  // Sort the row info according to ascending start offset
-  // Subsequent processing (filtering, etc.) may require row order
-  thrust::sort(rmm::exec_policy(stream)->on(stream), ptr_first, ptr_last);
 }
 
 std::pair<uint64_t, uint64_t> reader::impl::select_rows(const char *h_data,
@@ -432,41 +456,6 @@ std::pair<uint64_t, uint64_t> reader::impl::select_rows(const char *h_data,
   auto it_end                                 = h_row_offsets.end();
   assert(std::distance(it_begin, it_end) >= 1);
 
-  // Currently, ignoring lineterminations within quotes is handled by recording
-  // the records of both, and then filtering out the records that is a quotechar
-  // or a linetermination within a quotechar pair.
-  if (opts.quotechar != '\0') {
-    auto count = std::distance(it_begin, it_end) - 1;
-    // First element is zero if reading from start of file, skip it in that case
-    // Check the first element otherwise, it could be a quotation
-    const int start = (h_row_offsets[0] == 0) ? 1 : 0;
-    // Starting in the incomplete first row (before first line terminator in the byte range)?
-    bool is_partial_row = (h_row_offsets[0] != 0);
-    auto filtered_count = count;
-    bool quotation      = false;
-    for (int i = start; i < count; ++i) {
-      auto &offset = h_row_offsets[i];
-      if (offset > 0 && h_data[offset - 1] == opts.quotechar) {
-        // Don't update the quotation state before hitting the first line terminator
-        if (!is_partial_row) { quotation = !quotation; }
-        offset = static_cast<uint64_t>(-1);
-        filtered_count--;
-      } else if (offset > 0 && h_data[offset - 1] == opts.terminator) {
-        if (quotation) {
-          offset = static_cast<uint64_t>(-1);
-          filtered_count--;
-        } else if (is_partial_row) {
-          // Hit the the first line terminator, reset the is_partial_row flag
-          is_partial_row = false;
-        }
-      }
-    }
-    if (filtered_count != count) {
-      it_end = std::remove_if(
-        it_begin, it_end, [](uint64_t pos) { return (pos == static_cast<uint64_t>(-1)); });
-    }
-  }
-
   // Exclude the rows that are to be skipped from the start
   if (skip_rows != 0 && skip_rows < std::distance(it_begin, it_end)) { it_begin += skip_rows; }
 
@@ -489,8 +478,8 @@ std::pair<uint64_t, uint64_t> reader::impl::select_rows(const char *h_data,
     });
   }
 
-  // Exclude the rows before the header row (inclusive)
-  if (std::distance(it_begin, it_end) > 1) {
+  // Exclude the rows before the header row (inclusive); chunks after the first have no header
+  if (std::distance(it_begin, it_end) > 1 && !fixed_schema_) {
     if (args_.header == -1) {
       header.assign(h_data + *(it_begin), h_data + *(it_begin + 1));
     } else {
@@ -539,28 +528,34 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream) {
     } else {
       d_column_flags = h_column_flags;
 
-      hostdevice_vector<column_parse::stats> column_stats(num_active_cols);
+      hostdevice_vector<column_parse::stats> column_stats(num_active_cols, stream);
       CUDA_TRY(cudaMemsetAsync(column_stats.device_ptr(), 0, column_stats.memory_size(), stream));
-      CUDA_TRY(cudf::io::csv::gpu::DetectColumnTypes(data_ptr,
-                                                     row_offsets.data().get(),
-                                                     num_records,
-                                                     num_actual_cols,
-                                                     opts,
-                                                     d_column_flags.data().get(),
-                                                     column_stats.device_ptr(),
-                                                     stream));
+
+      // The statistics of all the sampled runs of rows accumulate
+      size_t num_sampled_records = 0;
+      for (const auto &run : select_sample_rows(num_records, args_.infer_sample_rows)) {
+        CUDA_TRY(cudf::io::csv::gpu::DetectColumnTypes(data_ptr,
+                                                       row_offsets.data().get() + run.first,
+                                                       run.second,
+                                                       num_actual_cols,
+                                                       opts,
+                                                       d_column_flags.data().get(),
+                                                       column_stats.device_ptr(),
+                                                       stream));
+        num_sampled_records += run.second;
+      }
       CUDA_TRY(cudaMemcpyAsync(column_stats.host_ptr(),
                                column_stats.device_ptr(),
                                column_stats.memory_size(),
                                cudaMemcpyDeviceToHost,
                                stream));
-      CUDA_TRY(cudaStreamSynchronize(stream));
+      CUDF_STREAM_SYNC(stream);
 
       for (int col = 0; col < num_active_cols; col++) {
         unsigned long long countInt = column_stats[col].countInt8 + column_stats[col].countInt16 +
                                       column_stats[col].countInt32 + column_stats[col].countInt64;
 
-        if (column_stats[col].countNULL == num_records) {
+        if (column_stats[col].countNULL == num_sampled_records) {
           // Entire column is NULL; allocate the smallest amount of memory
           dtypes.emplace_back(cudf::type_id::INT8);
         } else if (column_stats[col].countString > 0L) {
@@ -673,11 +668,72 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
                                                    d_data.data().get(),
                                                    d_valid.data().get(),
                                                    stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   for (int i = 0; i < num_active_cols; ++i) { out_buffers[i].null_count() = UNKNOWN_NULL_COUNT; }
 }
 
+size_t reader::impl::load_chunk_window(size_t offset,
+                                        size_t size,
+                                        int slot,
+                                        cudaStream_t stream) {
+  auto &staging = chunk_staging_[slot];
+  if (chunk_staging_size_[slot] < size) {
+    staging                   = make_pinned_buffer<char>(size, stream);
+    chunk_staging_size_[slot] = size;
+  }
+  const auto buffer = source_->get_buffer(offset, size);
+  memcpy(staging.get(), buffer->data(), buffer->size());
+  return buffer->size();
+}
+
+table_with_metadata reader::impl::read_chunk(size_t chunk_size, cudaStream_t stream) {
+  CUDF_EXPECTS(compression_type_ == "none", "Reading compressed data in chunks is unsupported");
+  if (source_ == nullptr) {
+    assert(!filepath_.empty());
+    source_ = datasource::create(filepath_);
+  }
+  CUDF_EXPECTS(chunk_offset_ == 0 || chunk_offset_ < source_->size(), "No more chunks to read");
+
+  // Each window extends past the chunk to complete the last row beginning within it
+  const auto num_columns = std::max(args_.names.size(), args_.dtype.size());
+  const size_t max_window_size = chunk_size + calculateMaxRowSize(num_columns);
+  const size_t window_size     = std::min(max_window_size, source_->size() - chunk_offset_);
+
+  // Wait for the window prefetched by the previous call, if any
+  size_t h_size = chunk_prefetch_.valid() ? chunk_prefetch_.get() : 0;
+  if (h_size != window_size && window_size != 0) {
+    h_size = load_chunk_window(chunk_offset_, window_size, chunk_slot_, stream);
+  }
+
+  // Start reading the next window into the other staging buffer while this one is parsed
+  const size_t next_offset = chunk_offset_ + chunk_size;
+  if (next_offset < source_->size()) {
+    const size_t next_size = std::min(max_window_size, source_->size() - next_offset);
+    const int next_slot    = chunk_slot_ ^ 1;
+    chunk_prefetch_        = std::async(std::launch::async, [=]() {
+      return load_chunk_window(next_offset, next_size, next_slot, stream);
+    });
+  }
+
+  auto result = read_host_data(
+    chunk_staging_[chunk_slot_].get(), h_size, chunk_offset_, chunk_size, 0, 0, -1, stream);
+  // The staging buffer is refilled by the prefetch issued in the next call
+  CUDF_STREAM_SYNC(stream);
+
+  // Parse the following chunks with the column names and types of the first one
+  if (!fixed_schema_) {
+    for (size_type i = 0; i < result.tbl->num_columns(); ++i) {
+      chunk_column_types_.push_back(result.tbl->get_column(i).type());
+    }
+    fixed_schema_ = true;
+  }
+  chunk_offset_ = next_offset;
+  chunk_slot_ ^= 1;
+
+  return result;
+}
+
 reader::impl::impl(std::unique_ptr<datasource> source,
                    std::string filepath,
                    reader_options const &options,
@@ -782,6 +838,14 @@ table_with_metadata reader::read_rows(size_type num_skip_header,
   return _impl->read(0, 0, num_skip_header, num_skip_footer, num_rows, stream);
 }
 
+// Forward to implementation
+table_with_metadata reader::read_chunk(size_t chunk_size, cudaStream_t stream) {
+  return _impl->read_chunk(chunk_size, stream);
+}
+
+// Forward to implementation
+bool reader::has_next_chunk() const { return _impl->has_next_chunk(); }
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -28,9 +28,12 @@
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/datasource.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
 
 #include <cudf/io/readers.hpp>
 
+#include <array>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -83,7 +86,63 @@ class reader::impl {
                            int num_rows,
                            cudaStream_t stream);
 
+  /**
+   * @brief Reads the rows beginning within the next byte window of the dataset.
+   *
+   * @param chunk_size Size of the byte window
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(size_t chunk_size, cudaStream_t stream);
+
+  /**
+   * @brief Returns whether there are byte windows left to read with `read_chunk()`.
+   */
+  bool has_next_chunk() const { return source_ == nullptr || chunk_offset_ < source_->size(); }
+
  private:
+  /**
+   * @brief Parses uncompressed input data in host memory and returns a set of columns.
+   *
+   * @param h_data Uncompressed input data in host memory
+   * @param h_size Number of bytes of uncompressed input data
+   * @param range_offset Number of bytes offset from the start
+   * @param range_size Bytes to read; use `0` for all remaining data
+   * @param skip_rows Number of rows to skip from the start
+   * @param skip_rows_end Number of rows to skip from the end
+   * @param num_rows Number of rows to read
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_host_data(const char *h_data,
+                                     size_t h_size,
+                                     size_t range_offset,
+                                     size_t range_size,
+                                     int skip_rows,
+                                     int skip_end_rows,
+                                     int num_rows,
+                                     cudaStream_t stream);
+
+  /**
+   * @brief Copies a byte window of the source into one of the pinned staging buffers.
+   *
+   * @param offset Number of bytes offset from the start
+   * @param size Number of bytes to copy
+   * @param slot Index of the staging buffer
+   * @param stream CUDA stream the staging buffer is copied on
+   *
+   * @return Number of bytes copied
+   */
+  size_t load_chunk_window(size_t offset, size_t size, int slot, cudaStream_t stream);
+
+  /**
+   * @brief Sets the column names and the columns to parse from the options and
+   * the header row.
+   */
+  void resolve_columns();
+
   /**
    * @brief Finds row positions within the specified input data.
    *
@@ -170,6 +229,15 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names;
   std::vector<char> header;
+
+  // Chunked read state
+  bool fixed_schema_ = false;  // Whether the column names and types are kept from the first chunk
+  std::vector<data_type> chunk_column_types_;
+  size_t chunk_offset_ = 0;
+  int chunk_slot_      = 0;
+  std::array<pinned_buffer<char>, 2> chunk_staging_;
+  std::array<size_t, 2> chunk_staging_size_{{0, 0}};
+  std::future<size_t> chunk_prefetch_;
 };
 
 }  // namespace csv
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO CSV writer class implementation
+ *
+ * Rows are formatted on the GPU in chunks of `rows_per_chunk`: each column is
+ * converted to a strings column of CSV fields, the fields of a row are
+ * concatenated and the rows of the chunk are joined into a single device
+ * buffer that is passed to the data sink.
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <strings/utilities.cuh>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <future>
+#include <utility>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace csv {
+
+namespace {
+
+/**
+ * @brief Functor for `make_strings_children` that builds the CSV fields of a
+ * strings column
+ *
+ * Null entries are replaced with `d_narep`. Strings containing the delimiter,
+ * a quote or a line break are enclosed in quotes, with embedded quotes doubled.
+ * `d_suffix` is appended to every field.
+ **/
+struct csv_fields_fn {
+  column_device_view const d_strings;
+  string_view const d_narep;
+  string_view const d_suffix;
+  char const delimiter;
+  int32_t const* d_offsets{};
+  char* d_chars{};
+
+  __device__ size_type operator()(size_type idx) {
+    char* out_ptr = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes;
+    if (d_strings.is_null(idx)) {
+      bytes = d_narep.size_bytes();
+      if (out_ptr) { out_ptr = copy_string(out_ptr, d_narep); }
+    } else {
+      string_view const d_str = d_strings.element<string_view>(idx);
+      char const* in_ptr      = d_str.data();
+      size_type quotes        = 0;
+      bool needs_quotes       = false;
+      for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+        char const ch = in_ptr[i];
+        if (ch == '"') {
+          ++quotes;
+        } else if (ch == delimiter || ch == '\n' || ch == '\r') {
+          needs_quotes = true;
+        }
+      }
+      needs_quotes = needs_quotes || quotes > 0;
+      bytes        = d_str.size_bytes() + quotes + (needs_quotes ? 2 : 0);
+      if (out_ptr) {
+        if (needs_quotes) { *out_ptr++ = '"'; }
+        for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+          if (in_ptr[i] == '"') { *out_ptr++ = '"'; }
+          *out_ptr++ = in_ptr[i];
+        }
+        if (needs_quotes) { *out_ptr++ = '"'; }
+      }
+    }
+    if (out_ptr) { copy_string(out_ptr, d_suffix); }
+    return bytes + d_suffix.size_bytes();
+  }
+};
+
+/**
+ * @brief Quotes a column name for the header row if needed
+ **/
+std::string escape_name(std::string const& name, char delimiter) {
+  if (name.find_first_of(std::string{'"', '\n', '\r', delimiter}) == std::string::npos) {
+    return name;
+  }
+  std::string escaped = "\"";
+  for (auto ch : name) {
+    if (ch == '"') { escaped += '"'; }
+    escaped += ch;
+  }
+  return escaped + "\"";
+}
+
+}  // namespace
+
+std::unique_ptr<column> writer::impl::column_to_fields(column_view const& col,
+                                                       string_view const& d_narep,
+                                                       string_view const& d_suffix,
+                                                       cudaStream_t stream) {
+  std::unique_ptr<column> converted;
+  switch (col.type().id()) {
+    case INT8:
+    case INT16:
+    case INT32:
+    case INT64: converted = cudf::strings::from_integers(col, _mr); break;
+    case FLOAT32:
+    case FLOAT64: converted = cudf::strings::from_floats(col, _mr); break;
+    case BOOL8:
+      converted = cudf::strings::from_booleans(
+        col, string_scalar(options_.true_value), string_scalar(options_.false_value), _mr);
+      break;
+    case TIMESTAMP_DAYS:
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS:
+      converted = cudf::strings::from_timestamps(col, "%Y-%m-%dT%H:%M:%SZ", _mr);
+      break;
+    case STRING: break;
+    default: CUDF_FAIL("Unsupported column type for CSV output");
+  }
+
+  auto const strings  = converted ? converted->view() : col;
+  auto strings_column = column_device_view::create(strings, stream);
+  auto const num_rows = strings.size();
+  auto children       = cudf::strings::detail::make_strings_children(
+    csv_fields_fn{*strings_column, d_narep, d_suffix, options_.inter_column_delimiter},
+    num_rows,
+    0,
+    _mr,
+    stream);
+
+  return make_strings_column(num_rows,
+                             std::move(children.first),
+                             std::move(children.second),
+                             0,
+                             rmm::device_buffer{},
+                             stream,
+                             _mr);
+}
+
+std::unique_ptr<column> writer::impl::format_rows(table_view const& rows, cudaStream_t stream) {
+  string_scalar const narep(options_.na_rep, true, stream);
+  string_scalar const terminator(options_.line_terminator, true, stream);
+  string_scalar const empty("", true, stream);
+
+  // The last field of each row carries the line terminator, so that the rows
+  // can be joined without a separator
+  std::vector<std::unique_ptr<column>> fields;
+  std::vector<column_view> views;
+  for (size_type i = 0; i < rows.num_columns(); ++i) {
+    auto const& d_suffix = (i + 1 < rows.num_columns()) ? empty : terminator;
+    fields.emplace_back(column_to_fields(
+      rows.column(i), narep.value(stream), d_suffix.value(stream), stream));
+    views.push_back(fields.back()->view());
+  }
+
+  auto const lines = (views.size() == 1)
+                       ? std::move(fields.front())
+                       : cudf::strings::concatenate(table_view{views},
+                                                    string_scalar(std::string{
+                                                      options_.inter_column_delimiter}),
+                                                    string_scalar("", false),
+                                                    _mr);
+  return cudf::strings::join_strings(
+    strings_column_view{lines->view()}, empty, string_scalar("", false), _mr);
+}
+
+void writer::impl::write_header(table_view const& table, const table_metadata* metadata) {
+  if (!options_.include_header || metadata == nullptr) { return; }
+  CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+               "Mismatch between number of column names and table columns");
+
+  std::string header;
+  for (size_t i = 0; i < metadata->column_names.size(); ++i) {
+    if (i > 0) { header += options_.inter_column_delimiter; }
+    header += escape_name(metadata->column_names[i], options_.inter_column_delimiter);
+  }
+  header += options_.line_terminator;
+  out_sink_->host_write(header.data(), header.size());
+}
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : _mr(mr), out_sink_(std::move(sink)), options_(options) {}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata,
+                         cudaStream_t stream) {
+  CUDF_EXPECTS(options_.rows_per_chunk > 0, "Invalid number of rows per chunk");
+  CUDF_EXPECTS(table.num_columns() > 0, "No columns to write");
+
+  write_header(table, metadata);
+
+  // The host copy of one chunk is written to the sink on a separate thread
+  // while the next chunk is formatted, unless the sink reads device memory
+  std::array<pinned_buffer<char>, 2> staging;
+  std::array<size_t, 2> staging_size{0, 0};
+  std::future<void> pending_write;
+  int slot = 0;
+
+  auto const num_rows = table.num_rows();
+  for (size_type start = 0; start < num_rows; start += options_.rows_per_chunk) {
+    auto const end  = std::min(num_rows, start + options_.rows_per_chunk);
+    auto const rows = cudf::experimental::slice(table, {start, end}).front();
+
+    auto const text  = format_rows(rows, stream);
+    auto const chars = strings_column_view{text->view()}.chars();
+    auto const size  = static_cast<size_t>(chars.size());
+    if (size == 0) { continue; }
+
+    if (out_sink_->supports_device_write()) {
+      out_sink_->device_write(chars.data<char>(), size, stream);
+      continue;
+    }
+
+    if (staging_size[slot] < size) {
+      staging[slot]      = make_pinned_buffer<char>(size, stream);
+      staging_size[slot] = size;
+    }
+    CUDA_TRY(cudaMemcpyAsync(
+      staging[slot].get(), chars.data<char>(), size, cudaMemcpyDeviceToHost, stream));
+    CUDF_STREAM_SYNC(stream);
+
+    // Writes to the sink must remain in order
+    if (pending_write.valid()) { pending_write.get(); }
+    auto const buffer = staging[slot].get();
+    pending_write     = std::async(
+      std::launch::async, [this, buffer, size]() { out_sink_->host_write(buffer, size); });
+    slot ^= 1;
+  }
+  if (pending_write.valid()) { pending_write.get(); }
+
+  out_sink_->flush();
+}
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr)) {}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+// Forward to implementation
+void writer::write_all(table_view const& table,
+                       const table_metadata* metadata,
+                       cudaStream_t stream) {
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
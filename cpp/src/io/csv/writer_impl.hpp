@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.hpp
+ * @brief cuDF-IO CSV writer class implementation header
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/writers.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace detail {
+namespace csv {
+
+using namespace cudf::io;
+
+/**
+ * @brief Implementation for CSV writer
+ **/
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Resource to use for device memory allocation
+   **/
+  explicit impl(std::unique_ptr<data_sink> sink,
+                writer_options const& options,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to CSV format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream Stream to use for memory allocation and kernels
+   **/
+  void write(table_view const& table, const table_metadata* metadata, cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Writes the header row with the column names
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   **/
+  void write_header(table_view const& table, const table_metadata* metadata);
+
+  /**
+   * @brief Converts a column of a chunk of rows to the text of its CSV fields
+   *
+   * The result has no nulls; null entries are replaced with `na_rep` and
+   * strings are quoted where needed.
+   *
+   * @param column The column rows to convert
+   * @param d_narep Device string to use for null entries
+   * @param d_suffix Device string to append to every field
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return Strings column of the fields
+   **/
+  std::unique_ptr<column> column_to_fields(column_view const& column,
+                                           string_view const& d_narep,
+                                           string_view const& d_suffix,
+                                           cudaStream_t stream);
+
+  /**
+   * @brief Formats a chunk of rows into a single buffer of CSV text
+   *
+   * @param rows The rows to format
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return Single-row strings column holding the text of all the rows
+   **/
+  std::unique_ptr<column> format_rows(table_view const& rows, cudaStream_t stream);
+
+ private:
+  rmm::mr::device_memory_resource* _mr = nullptr;
+
+  std::unique_ptr<data_sink> out_sink_;
+  writer_options options_;
+};
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -23,6 +23,7 @@
 
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
+#include "utilities/thread_pool.hpp"
 
 namespace cudf {
 namespace experimental {
@@ -65,6 +66,49 @@ std::unique_ptr<writer> make_writer(sink_info const& sink,
   }
 }
 
+/**
+ * @brief Translates the `read_csv()` settings to CSV reader options
+ */
+detail::csv::reader_options make_csv_options(read_csv_args const& args) {
+  detail::csv::reader_options options{};
+  options.compression      = args.compression;
+  options.lineterminator   = args.lineterminator;
+  options.delimiter        = args.delimiter;
+  options.decimal          = args.decimal;
+  options.thousands        = args.thousands;
+  options.comment          = args.comment;
+  options.dayfirst         = args.dayfirst;
+  options.delim_whitespace = args.delim_whitespace;
+  options.skipinitialspace = args.skipinitialspace;
+  options.skip_blank_lines = args.skip_blank_lines;
+  options.header           = args.header;
+  options.names            = args.names;
+  options.dtype            = args.dtype;
+  options.use_cols_indexes = args.use_cols_indexes;
+  options.use_cols_names   = args.use_cols_names;
+  options.true_values.insert(
+    options.true_values.end(), args.true_values.begin(), args.true_values.end());
+  options.false_values.insert(
+    options.false_values.end(), args.false_values.begin(), args.false_values.end());
+  if (!args.na_filter) {
+    options.na_values.clear();
+  } else if (!args.keep_default_na) {
+    options.na_values = args.na_values;
+  } else {
+    options.na_values.insert(options.na_values.end(), args.na_values.begin(), args.na_values.end());
+  }
+  options.prefix           = args.prefix;
+  options.mangle_dupe_cols = args.mangle_dupe_cols;
+  options.quotechar        = args.quotechar;
+  options.quoting          = args.quoting;
+  options.doublequote      = args.doublequote;
+  options.timestamp_type   = args.timestamp_type;
+
+  options.infer_sample_rows = args.infer_sample_rows;
+
+  return options;
+}
+
 }  // namespace
 
 // Freeform API wraps the detail reader class API
@@ -87,7 +131,9 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
   namespace json = cudf::experimental::io::detail::json;
 
   CUDF_FUNC_RANGE();
-  json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
+  json::reader_options options{
+    args.lines, args.compression, args.dtype, args.dayfirst, args.columns};
+  options.infer_sample_rows = args.infer_sample_rows;
   auto reader = make_reader<json::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
@@ -102,40 +148,7 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   namespace csv = cudf::experimental::io::detail::csv;
 
   CUDF_FUNC_RANGE();
-  csv::reader_options options{};
-  options.compression      = args.compression;
-  options.lineterminator   = args.lineterminator;
-  options.delimiter        = args.delimiter;
-  options.decimal          = args.decimal;
-  options.thousands        = args.thousands;
-  options.comment          = args.comment;
-  options.dayfirst         = args.dayfirst;
-  options.delim_whitespace = args.delim_whitespace;
-  options.skipinitialspace = args.skipinitialspace;
-  options.skip_blank_lines = args.skip_blank_lines;
-  options.header           = args.header;
-  options.names            = args.names;
-  options.dtype            = args.dtype;
-  options.use_cols_indexes = args.use_cols_indexes;
-  options.use_cols_names   = args.use_cols_names;
-  options.true_values.insert(
-    options.true_values.end(), args.true_values.begin(), args.true_values.end());
-  options.false_values.insert(
-    options.false_values.end(), args.false_values.begin(), args.false_values.end());
-  if (!args.na_filter) {
-    options.na_values.clear();
-  } else if (!args.keep_default_na) {
-    options.na_values = args.na_values;
-  } else {
-    options.na_values.insert(options.na_values.end(), args.na_values.begin(), args.na_values.end());
-  }
-  options.prefix           = args.prefix;
-  options.mangle_dupe_cols = args.mangle_dupe_cols;
-  options.quotechar        = args.quotechar;
-  options.quoting          = args.quoting;
-  options.doublequote      = args.doublequote;
-  options.timestamp_type   = args.timestamp_type;
-  auto reader              = make_reader<csv::reader>(args.source, options, mr);
+  auto reader = make_reader<csv::reader>(args.source, make_csv_options(args), mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
     return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
@@ -146,6 +159,49 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   }
 }
 
+std::future<table_with_metadata> read_csv_async(read_csv_args const& args,
+                                                rmm::mr::device_memory_resource* mr) {
+  return cudf::io::thread_pool::instance().submit([args, mr]() { return read_csv(args, mr); });
+}
+
+// Freeform API wraps the detail reader class API
+chunked_csv_reader::chunked_csv_reader(read_csv_args const& args,
+                                       size_t chunk_size,
+                                       rmm::mr::device_memory_resource* mr)
+  : _chunk_size(chunk_size) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(chunk_size > 0, "Chunk size must be positive");
+  _reader = make_reader<detail::csv::reader>(args.source, make_csv_options(args), mr);
+}
+
+// Destructor within this translation unit
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+bool chunked_csv_reader::has_next() const { return _reader->has_next_chunk(); }
+
+table_with_metadata chunked_csv_reader::read_chunk(cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  return _reader->read_chunk(_chunk_size, stream);
+}
+
+// Freeform API wraps the detail writer class API
+void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr) {
+  namespace csv = cudf::experimental::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  csv::writer_options options{args.na_rep,
+                              args.include_header,
+                              args.rows_per_chunk,
+                              args.line_terminator,
+                              args.delimiter,
+                              args.true_value,
+                              args.false_value};
+  auto writer = make_writer<csv::writer>(args.sink, options, mr);
+
+  writer->write_all(args.table, args.metadata);
+}
+
 namespace orc = cudf::experimental::io::detail::orc;
 
 // Freeform API wraps the detail reader class API
@@ -156,7 +212,9 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
                               args.use_np_dtypes,
                               args.timestamp_type,
                               args.decimals_as_float,
-                              args.forced_decimals_scale};
+                              args.forced_decimals_scale,
+                              args.filters,
+                              args.strings_to_dictionary};
   auto reader = make_reader<orc::reader>(args.source, options, mr);
 
   if (args.stripe_list.size() > 0) {
@@ -170,10 +228,20 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
   }
 }
 
+std::future<table_with_metadata> read_orc_async(read_orc_args const& args,
+                                                rmm::mr::device_memory_resource* mr) {
+  return cudf::io::thread_pool::instance().submit([args, mr]() { return read_orc(args, mr); });
+}
+
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  orc::writer_options options{args.compression, args.enable_statistics};
+  orc::writer_options options{args.compression,
+                              args.enable_statistics,
+                              args.stripe_size_bytes,
+                              args.stripe_size_rows,
+                              args.row_index_stride,
+                              args.compression_level};
   auto writer = make_writer<orc::writer>(args.sink, options, mr);
 
   writer->write_all(args.table, args.metadata);
@@ -186,7 +254,12 @@ void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
 std::shared_ptr<orc::orc_chunked_state> write_orc_chunked_begin(
   write_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  orc::writer_options options{args.compression, args.enable_statistics};
+  orc::writer_options options{args.compression,
+                              args.enable_statistics,
+                              args.stripe_size_bytes,
+                              args.stripe_size_rows,
+                              args.row_index_stride,
+                              args.compression_level};
 
   auto state = std::make_shared<orc::orc_chunked_state>();
   state->wp  = make_writer<orc::writer>(args.sink, options, mr);
@@ -228,9 +301,17 @@ namespace parquet = cudf::experimental::io::detail::parquet;
 table_with_metadata read_parquet(read_parquet_args const& args,
                                  rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  parquet::reader_options options{
-    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
-  auto reader = make_reader<parquet::reader>(args.source, options, mr);
+  parquet::reader_options options{args.columns,
+                                  args.strings_to_categorical,
+                                  args.use_pandas_metadata,
+                                  args.timestamp_type,
+                                  args.filters,
+                                  args.filter_rows,
+                                  args.strings_to_dictionary,
+                                  args.decimals_as_float};
+  auto reader = args.sources.empty()
+                  ? make_reader<parquet::reader>(args.source, options, mr)
+                  : std::make_unique<parquet::reader>(args.sources, options, mr);
 
   if (args.row_group_list.size() > 0) {
     return reader->read_row_groups(args.row_group_list);
@@ -243,11 +324,52 @@ table_with_metadata read_parquet(read_parquet_args const& args,
   }
 }
 
+std::future<table_with_metadata> read_parquet_async(read_parquet_args const& args,
+                                                    rmm::mr::device_memory_resource* mr) {
+  return cudf::io::thread_pool::instance().submit([args, mr]() { return read_parquet(args, mr); });
+}
+
+// Freeform API wraps the detail reader class API
+chunked_parquet_reader::chunked_parquet_reader(read_parquet_args const& args,
+                                               size_t chunk_read_limit,
+                                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(chunk_read_limit > 0, "Chunk read limit must be positive");
+  parquet::reader_options options{args.columns,
+                                  args.strings_to_categorical,
+                                  args.use_pandas_metadata,
+                                  args.timestamp_type,
+                                  args.filters,
+                                  args.filter_rows,
+                                  args.strings_to_dictionary,
+                                  args.decimals_as_float};
+  _reader     = args.sources.empty()
+              ? make_reader<parquet::reader>(args.source, options, mr)
+              : std::make_unique<parquet::reader>(args.sources, options, mr);
+  _row_chunks = _reader->get_row_chunks(chunk_read_limit);
+}
+
+// Destructor within this translation unit
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+table_with_metadata chunked_parquet_reader::read_chunk(cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  return _reader->read_row_group_chunk(_row_chunks[_next_chunk++], stream);
+}
+
 // Freeform API wraps the detail writer class API
 std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& args,
                                                     rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  parquet::writer_options options{args.compression, args.stats_level};
+  parquet::writer_options options{args.compression,
+                                  args.stats_level,
+                                  args.enable_delta_encoding,
+                                  args.bloom_filter_columns,
+                                  args.compression_level,
+                                  args.row_group_size_bytes,
+                                  args.row_group_size_rows,
+                                  args.max_page_size_bytes};
   auto writer = make_writer<parquet::writer>(args.sink, options, mr);
 
   return writer->write_all(args.table, args.metadata, args.return_filemetadata);
@@ -270,7 +392,14 @@ std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
 std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
   write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  parquet::writer_options options{args.compression, args.stats_level};
+  parquet::writer_options options{args.compression,
+                                  args.stats_level,
+                                  args.enable_delta_encoding,
+                                  args.bloom_filter_columns,
+                                  args.compression_level,
+                                  args.row_group_size_bytes,
+                                  args.row_group_size_rows,
+                                  args.max_page_size_bytes};
 
   auto state = std::make_shared<pq_chunked_state>();
   state->wp  = make_writer<parquet::writer>(args.sink, options, mr);
@@ -305,6 +434,29 @@ void write_parquet_chunked_end(std::shared_ptr<pq_chunked_state>& state) {
   state.reset();
 }
 
+// Freeform API wraps the detail reader class API
+table_with_metadata read_arrow_ipc(read_arrow_ipc_args const& args,
+                                   rmm::mr::device_memory_resource* mr) {
+  namespace arrow_ipc = cudf::experimental::io::detail::arrow_ipc;
+
+  CUDF_FUNC_RANGE();
+  arrow_ipc::reader_options options{args.columns};
+  auto reader = make_reader<arrow_ipc::reader>(args.source, options, mr);
+
+  return reader->read_all();
+}
+
+// Freeform API wraps the detail writer class API
+void write_arrow_ipc(write_arrow_ipc_args const& args, rmm::mr::device_memory_resource* mr) {
+  namespace arrow_ipc = cudf::experimental::io::detail::arrow_ipc;
+
+  CUDF_FUNC_RANGE();
+  arrow_ipc::writer_options options{args.batch_size_rows, args.file_format};
+  auto writer = make_writer<arrow_ipc::writer>(args.sink, options, mr);
+
+  writer->write_all(args.table, args.metadata);
+}
+
 }  // namespace io
 }  // namespace experimental
 }  // namespace cudf
@@ -34,6 +34,25 @@ struct ColumnInfo {
   cudf::size_type null_count;
 };
 
+/**
+ * @brief Kind of a JSON token
+ **/
+enum class json_token_type : int32_t { OBJECT, ARRAY, FIELD_NAME, VALUE };
+
+/**
+ * @brief Token of a JSON record
+ *
+ * The tokens of a record are stored in pre-order: the tokens inside an object
+ * or array follow it and precede the next token outside of it. Objects and
+ * arrays nested deeper than the tokenizer supports are returned as values.
+ **/
+struct json_token {
+  uint64_t begin;          ///< Offset of the first character
+  uint64_t end;            ///< Offset after the last character, including closing brackets
+  cudf::size_type parent;  ///< Index of the enclosing object or array; -1 for the root
+  json_token_type type;
+};
+
 }  // namespace json
 }  // namespace io
 }  // namespace experimental
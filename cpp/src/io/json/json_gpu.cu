@@ -18,6 +18,9 @@
 #include "json_gpu.h"
 
 #include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/scan.h>
 
 #include <cudf/detail/utilities/trie.cuh>
 
@@ -234,6 +237,21 @@ __inline__ __device__ cudf::dictionary32 decode_value(const char *data,
                                                       ParseOptions const &opts) {
   return cudf::dictionary32{};
 }
+template <>
+__inline__ __device__ cudf::list_view decode_value(const char *data,
+                                                   long start,
+                                                   long end,
+                                                   ParseOptions const &opts) {
+  return cudf::list_view{};
+}
+
+template <>
+__inline__ __device__ cudf::struct_view decode_value(const char *data,
+                                                     long start,
+                                                     long end,
+                                                     ParseOptions const &opts) {
+  return cudf::struct_view{};
+}
 
 /**
  * @brief Functor for converting plain text data to cuDF data type value.
@@ -381,6 +399,60 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Converts a single field and stores it in its output column.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] start Offset of the first character of the field
+ * @param[in] field_end Offset of the first character after the field
+ * @param[in] rec_id The output row of the field
+ * @param[in] dtype The data type of the output column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_column The output column data
+ * @param[out] valid_field The bitmap indicating whether column fields are valid
+ * @param[out] num_valid_field The number of valid fields in the column
+ *
+ * @return void
+ **/
+__device__ void convert_field(const char *data,
+                              long start,
+                              long field_end,
+                              long rec_id,
+                              data_type dtype,
+                              const ParseOptions &opts,
+                              void *output_column,
+                              bitmask_type *valid_field,
+                              cudf::size_type *num_valid_field) {
+  long field_data_last = field_end - 1;
+  // Modify start & end to ignore whitespace and quotechars
+  trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
+  // Empty fields are not legal values
+  if (start <= field_data_last &&
+      !serializedTrieContains(opts.naValuesTrie, data + start, field_end - start)) {
+    // Type dispatcher does not handle strings
+    if (dtype.id() == STRING) {
+      auto str_list           = static_cast<string_pair *>(output_column);
+      str_list[rec_id].first  = data + start;
+      str_list[rec_id].second = field_data_last - start + 1;
+
+      // set the valid bitmap - all bits were set to 0 to start
+      set_bit(valid_field, rec_id);
+      atomicAdd(num_valid_field, 1);
+    } else {
+      if (cudf::experimental::type_dispatcher(
+            dtype, ConvertFunctor{}, data, output_column, rec_id, start, field_data_last, opts)) {
+        // set the valid bitmap - all bits were set to 0 to start
+        set_bit(valid_field, rec_id);
+        atomicAdd(num_valid_field, 1);
+      }
+    }
+  } else if (dtype.id() == STRING) {
+    auto str_list           = static_cast<string_pair *>(output_column);
+    str_list[rec_id].first  = nullptr;
+    str_list[rec_id].second = 0;
+  }
+}
+
 /**
  * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
  *
@@ -390,10 +462,11 @@ __device__ __inline__ bool is_like_float(
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] rec_starts The start of each data record
  * @param[in] num_records The number of lines/rows
- * @param[in] dtypes The data type of each column
+ * @param[in] dtypes The data type of each output column
  * @param[in] opts A set of parsing options
  * @param[out] output_columns The output column data
- * @param[in] num_columns The number of columns
+ * @param[in] num_columns The number of input columns to tokenize
+ * @param[in] col_map The output column of each input column; negative to skip
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
  *
@@ -407,6 +480,7 @@ __global__ void convert_json_to_columns_kernel(const char *data,
                                                ParseOptions opts,
                                                void *const *output_columns,
                                                int num_columns,
+                                               const int *col_map,
                                                bitmask_type *const *valid_fields,
                                                cudf::size_type *num_valid_fields) {
   const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
@@ -419,45 +493,124 @@ __global__ void convert_json_to_columns_kernel(const char *data,
   limit_range_to_brackets(data, start, stop);
   const bool is_object = (data[start - 1] == '{');
 
-  for (int col = 0; col < num_columns && start < stop; col++) {
+  for (int input_col = 0; input_col < num_columns && start < stop; input_col++) {
     if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
     // field_end is at the next delimiter/newline
     const long field_end = cudf::experimental::io::gpu::seek_field_end(data, opts, start, stop);
-    long field_data_last = field_end - 1;
-    // Modify start & end to ignore whitespace and quotechars
-    trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
-    // Empty fields are not legal values
-    if (start <= field_data_last &&
-        !serializedTrieContains(opts.naValuesTrie, data + start, field_end - start)) {
-      // Type dispatcher does not handle strings
-      if (dtypes[col].id() == STRING) {
-        auto str_list           = static_cast<string_pair *>(output_columns[col]);
-        str_list[rec_id].first  = data + start;
-        str_list[rec_id].second = field_data_last - start + 1;
+    // Fields of unselected columns are only tokenized
+    const int col = col_map[input_col];
+    if (col < 0) {
+      start = field_end + 1;
+      continue;
+    }
+    convert_field(data,
+                  start,
+                  field_end,
+                  rec_id,
+                  dtypes[col],
+                  opts,
+                  output_columns[col],
+                  valid_fields[col],
+                  &num_valid_fields[col]);
+    start = field_end + 1;
+  }
+}
 
-        // set the valid bitmap - all bits were set to 0 to start
-        set_bit(valid_fields[col], rec_id);
-        atomicAdd(&num_valid_fields[col], 1);
+/**
+ * @brief Determines the type of a single field and updates the counts of its column.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] field_start Offset of the first character of the field
+ * @param[in] field_end Offset of the first character after the field
+ * @param[in] opts A set of parsing options
+ * @param[out] column_info The count for each data type of the field column
+ *
+ * @returns void
+ **/
+__device__ void detect_field_type(const char *data,
+                                  long field_start,
+                                  long field_end,
+                                  const ParseOptions &opts,
+                                  ColumnInfo *column_info) {
+  long field_data_last = field_end - 1;
+  trim_field_start_end(data, &field_start, &field_data_last);
+  const int field_len = field_data_last - field_start + 1;
+
+  // Checking if the field is empty
+  if (field_start > field_data_last ||
+      serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->null_count, 1);
+    return;
+  }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
+    atomicAdd(&column_info->string_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
+     (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
+      data[field_start + 2] == 'x'));
+  for (long pos = field_start; pos <= field_data_last; pos++) {
+    if (is_digit(data[pos], maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (data[pos]) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    atomicAdd(&column_info->int_count, 1);
+  } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    atomicAdd(&column_info->float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&column_info->string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one of them
+    // To simplify the process of auto column detection, we are not covering all the date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&column_info->datetime_count, 1);
       } else {
-        if (cudf::experimental::type_dispatcher(dtypes[col],
-                                                ConvertFunctor{},
-                                                data,
-                                                output_columns[col],
-                                                rec_id,
-                                                start,
-                                                field_data_last,
-                                                opts)) {
-          // set the valid bitmap - all bits were set to 0 to start
-          set_bit(valid_fields[col], rec_id);
-          atomicAdd(&num_valid_fields[col], 1);
-        }
+        atomicAdd(&column_info->string_count, 1);
       }
-    } else if (dtypes[col].id() == STRING) {
-      auto str_list           = static_cast<string_pair *>(output_columns[col]);
-      str_list[rec_id].first  = nullptr;
-      str_list[rec_id].second = 0;
+    } else {
+      // Default field type is string
+      atomicAdd(&column_info->string_count, 1);
     }
-    start = field_end + 1;
   }
 }
 
@@ -471,10 +624,11 @@ __global__ void convert_json_to_columns_kernel(const char *data,
  * @param[in] data Input data buffer
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] opts A set of parsing options
- * @param[in] num_columns The number of columns of input data
+ * @param[in] num_columns The number of columns of input data to tokenize
+ * @param[in] col_map The output column of each input column; negative to skip
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data 
- * @param[out] column_infos The count for each column data type
+ * @param[out] column_infos The count for each output column data type
  *
  * @returns void
  **/
@@ -482,6 +636,7 @@ __global__ void detect_json_data_types(const char *data,
                                        size_t data_size,
                                        const ParseOptions opts,
                                        int num_columns,
+                                       const int *col_map,
                                        const uint64_t *rec_starts,
                                        cudf::size_type num_records,
                                        ColumnInfo *column_infos) {
@@ -495,93 +650,320 @@ __global__ void detect_json_data_types(const char *data,
   limit_range_to_brackets(data, start, stop);
   const bool is_object = (data[start - 1] == '{');
 
-  for (int col = 0; col < num_columns; col++) {
+  for (int input_col = 0; input_col < num_columns; input_col++) {
     if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
     auto field_start = start;
     const long field_end =
       cudf::experimental::io::gpu::seek_field_end(data, opts, field_start, stop);
-    long field_data_last = field_end - 1;
-    trim_field_start_end(data, &field_start, &field_data_last);
-    const int field_len = field_data_last - field_start + 1;
     // Advance the start offset
     start = field_end + 1;
+    const int col = col_map[input_col];
+    if (col < 0) { continue; }
+    detect_field_type(data, field_start, field_end, opts, &column_infos[col]);
+  }
+}
 
-    // Checking if the field is empty
-    if (field_start > field_data_last ||
-        serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].null_count, 1);
-      continue;
+// Objects and arrays nested deeper than this are tokenized as a single value
+constexpr int max_nesting_depth = 32;
+
+/**
+ * @brief Checks whether the given character is a JSON whitespace character.
+ **/
+__inline__ __device__ bool is_json_whitespace(char ch) {
+  return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+/**
+ * @brief Returns the position after the closing quote of a quoted string
+ *
+ * @param[in] data The character stream to scan
+ * @param[in] quotechar The character used to denote quotes
+ * @param[in] pos Position of the opening quote
+ * @param[in] stop Offset of the first character after the range
+ **/
+__device__ long seek_quote_end(const char *data, char quotechar, long pos, long stop) {
+  for (++pos; pos < stop; ++pos) {
+    if (data[pos] == '\\') {
+      ++pos;
+    } else if (data[pos] == quotechar) {
+      return pos + 1;
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
-      atomicAdd(&column_infos[col].string_count, 1);
+  }
+  return stop;
+}
+
+/**
+ * @brief Returns the position after the closing bracket of an object or array
+ *
+ * @param[in] data The character stream to scan
+ * @param[in] quotechar The character used to denote quotes
+ * @param[in] pos Position of the opening bracket
+ * @param[in] stop Offset of the first character after the range
+ **/
+__device__ long seek_container_end(const char *data, char quotechar, long pos, long stop) {
+  int depth = 0;
+  while (pos < stop) {
+    const char ch = data[pos];
+    if (ch == quotechar) {
+      pos = seek_quote_end(data, quotechar, pos, stop);
       continue;
     }
+    if (ch == '{' || ch == '[') {
+      ++depth;
+    } else if ((ch == '}' || ch == ']') && --depth == 0) {
+      return pos + 1;
+    }
+    ++pos;
+  }
+  return stop;
+}
 
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
-       (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
-        data[field_start + 2] == 'x'));
-    for (long pos = field_start; pos <= field_data_last; pos++) {
-      if (is_digit(data[pos], maybe_hex)) {
-        digit_count++;
+/**
+ * @brief Tokenizes a single JSON record with a finite-state scanner.
+ *
+ * Characters before the opening bracket of the record and after its closing
+ * bracket are ignored.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] start Offset of the first character of the record
+ * @param[in] stop Offset of the first character after the record
+ * @param[in] opts A set of parsing options
+ * @param[out] tokens The tokens of the record; only counted if nullptr
+ *
+ * @return The number of tokens of the record
+ **/
+__device__ cudf::size_type tokenize_record(
+  const char *data, long start, long stop, const ParseOptions &opts, json_token *tokens) {
+  cudf::size_type open_tokens[max_nesting_depth];
+  bool open_is_object[max_nesting_depth];
+  int depth             = 0;
+  bool expect_key       = false;
+  cudf::size_type count = 0;
+
+  auto add_token = [&](json_token_type type, long begin, long end) {
+    if (tokens != nullptr) {
+      tokens[count] = json_token{static_cast<uint64_t>(begin),
+                                 static_cast<uint64_t>(end),
+                                 (depth > 0) ? open_tokens[depth - 1] : -1,
+                                 type};
+    }
+    return count++;
+  };
+
+  long pos = start;
+  while (pos < stop) {
+    const char ch = data[pos];
+    if (ch == '{' || ch == '[') {
+      if (depth == max_nesting_depth) {
+        const long end = seek_container_end(data, opts.quotechar, pos, stop);
+        add_token(json_token_type::VALUE, pos, end);
+        pos = end;
         continue;
       }
-      // Looking for unique characters that will help identify column types
-      switch (data[pos]) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
-          break;
-        default: other_count++; break;
+      const bool is_object = (ch == '{');
+      // The end of the object or array is set once its closing bracket is found
+      open_tokens[depth] =
+        add_token(is_object ? json_token_type::OBJECT : json_token_type::ARRAY, pos, stop);
+      open_is_object[depth] = is_object;
+      ++depth;
+      expect_key = is_object;
+      ++pos;
+    } else if (depth == 0) {
+      // Outside of the record
+      ++pos;
+    } else if (ch == '}' || ch == ']') {
+      --depth;
+      if (tokens != nullptr) { tokens[open_tokens[depth]].end = pos + 1; }
+      ++pos;
+      if (depth == 0) { break; }
+    } else if (ch == ',') {
+      expect_key = open_is_object[depth - 1];
+      ++pos;
+    } else if (ch == ':') {
+      expect_key = false;
+      ++pos;
+    } else if (is_json_whitespace(ch)) {
+      ++pos;
+    } else if (ch == opts.quotechar) {
+      const long end = seek_quote_end(data, opts.quotechar, pos, stop);
+      add_token(expect_key ? json_token_type::FIELD_NAME : json_token_type::VALUE, pos, end);
+      pos = end;
+    } else {
+      // Unquoted value: number, boolean or null
+      long end = pos + 1;
+      while (end < stop && data[end] != ',' && data[end] != ':' && data[end] != '}' &&
+             data[end] != ']' && !is_json_whitespace(data[end])) {
+        ++end;
       }
+      add_token(json_token_type::VALUE, pos, end);
+      pos = end;
     }
+  }
+  return count;
+}
+
+/**
+ * @brief CUDA kernel that tokenizes JSON records.
+ *
+ * Data is processed one record at a time. Each record is first tokenized with
+ * `tokens` set to nullptr to count its tokens, then again to store them.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] opts A set of parsing options
+ * @param[in,out] token_offsets The number of tokens of each record if counting;
+ * otherwise, the offset of the first token of each record
+ * @param[out] tokens The tokens of all the records; nullptr to count them
+ *
+ * @return void
+ **/
+__global__ void tokenize_json_kernel(const char *data,
+                                     size_t data_size,
+                                     const uint64_t *rec_starts,
+                                     cudf::size_type num_records,
+                                     ParseOptions opts,
+                                     cudf::size_type *token_offsets,
+                                     json_token *tokens) {
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  const long start = rec_starts[rec_id];
+  const long stop  = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
+  if (tokens == nullptr) {
+    token_offsets[rec_id] = tokenize_record(data, start, stop, opts, nullptr);
+  } else {
+    tokenize_record(data, start, stop, opts, tokens + token_offsets[rec_id]);
+  }
+}
+
+/**
+ * @brief Returns the index of the next leaf field of a tokenized record.
+ *
+ * Leaf fields are the values and the arrays below the top level of the record,
+ * in order; the contents of arrays are skipped. The root object or array of
+ * the record is at index 0.
+ *
+ * @param[in] tokens The tokens of the record
+ * @param[in] num_tokens The number of tokens of the record
+ * @param[in] pos Index of the previous leaf field; 0 to find the first one
+ *
+ * @return The index of the next leaf field, or `num_tokens` if there is none
+ **/
+__device__ cudf::size_type next_leaf_field(const json_token *tokens,
+                                           cudf::size_type num_tokens,
+                                           cudf::size_type pos) {
+  if (pos > 0 && tokens[pos].type == json_token_type::ARRAY) {
+    while (pos + 1 < num_tokens && tokens[pos + 1].begin < tokens[pos].end) { ++pos; }
+  }
+  for (++pos; pos < num_tokens; ++pos) {
+    const auto type = tokens[pos].type;
+    if (type == json_token_type::VALUE || type == json_token_type::ARRAY) { break; }
+  }
+  return pos;
+}
 
-    // Integers have to have the length of the string
-    int int_req_number_cnt = field_len;
-    // Off by one if they start with a minus sign
-    if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
-        serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[col].int_count, 1);
-    } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[col].float_count, 1);
+/**
+ * @brief CUDA kernel that converts tokenized JSON records into cuDF column data.
+ *
+ * Data is processed one record at a time; the leaf fields of the record are
+ * its input columns.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] tokens The tokens of all the records
+ * @param[in] token_offsets The offset of the first token of each record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] dtypes The data type of each output column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_columns The output column data
+ * @param[in] num_columns The number of input columns to convert
+ * @param[in] col_map The output column of each input column; negative to skip
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ *
+ * @return void
+ **/
+__global__ void convert_nested_json_to_columns_kernel(const char *data,
+                                                      const json_token *tokens,
+                                                      const cudf::size_type *token_offsets,
+                                                      cudf::size_type num_records,
+                                                      const data_type *dtypes,
+                                                      ParseOptions opts,
+                                                      void *const *output_columns,
+                                                      int num_columns,
+                                                      const int *col_map,
+                                                      bitmask_type *const *valid_fields,
+                                                      cudf::size_type *num_valid_fields) {
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  const json_token *rec_tokens = tokens + token_offsets[rec_id];
+  const auto num_tokens        = token_offsets[rec_id + 1] - token_offsets[rec_id];
+
+  cudf::size_type pos = next_leaf_field(rec_tokens, num_tokens, 0);
+  for (int input_col = 0; input_col < num_columns && pos < num_tokens; input_col++) {
+    const int col = col_map[input_col];
+    if (col >= 0) {
+      convert_field(data,
+                    rec_tokens[pos].begin,
+                    rec_tokens[pos].end,
+                    rec_id,
+                    dtypes[col],
+                    opts,
+                    output_columns[col],
+                    valid_fields[col],
+                    &num_valid_fields[col]);
     }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[col].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one of them
-      // To simplify the process of auto column detection, we are not covering all the date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[col].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[col].string_count, 1);
-        }
-      } else {
-        // Default field type is string
+    pos = next_leaf_field(rec_tokens, num_tokens, pos);
+  }
+}
+
+/**
+ * @brief CUDA kernel that determines the column types of tokenized JSON records.
+ *
+ * Data is processed one record at a time; the leaf fields of the record are
+ * its input columns. Arrays are always detected as strings.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] tokens The tokens of all the records
+ * @param[in] token_offsets The offset of the first token of each record
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of input columns to examine
+ * @param[in] col_map The output column of each input column; negative to skip
+ * @param[in] num_records The number of lines/rows of input data
+ * @param[out] column_infos The count for each output column data type
+ *
+ * @returns void
+ **/
+__global__ void detect_nested_json_data_types(const char *data,
+                                              const json_token *tokens,
+                                              const cudf::size_type *token_offsets,
+                                              const ParseOptions opts,
+                                              int num_columns,
+                                              const int *col_map,
+                                              cudf::size_type num_records,
+                                              ColumnInfo *column_infos) {
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  const json_token *rec_tokens = tokens + token_offsets[rec_id];
+  const auto num_tokens        = token_offsets[rec_id + 1] - token_offsets[rec_id];
+
+  cudf::size_type pos = next_leaf_field(rec_tokens, num_tokens, 0);
+  for (int input_col = 0; input_col < num_columns; input_col++) {
+    const int col = col_map[input_col];
+    if (col >= 0) {
+      if (pos >= num_tokens) {
+        atomicAdd(&column_infos[col].null_count, 1);
+      } else if (rec_tokens[pos].type == json_token_type::ARRAY) {
         atomicAdd(&column_infos[col].string_count, 1);
+      } else {
+        detect_field_type(
+          data, rec_tokens[pos].begin, rec_tokens[pos].end, opts, &column_infos[col]);
       }
     }
+    if (pos < num_tokens) { pos = next_leaf_field(rec_tokens, num_tokens, pos); }
   }
 }
 
@@ -596,6 +978,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              void *const *output_columns,
                              cudf::size_type num_records,
                              cudf::size_type num_columns,
+                             const int *col_map,
                              const uint64_t *rec_starts,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
@@ -617,6 +1000,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
     opts,
     output_columns,
     num_columns,
+    col_map,
     valid_fields,
     num_valid_fields);
 
@@ -632,6 +1016,7 @@ void detect_data_types(ColumnInfo *column_infos,
                        size_t data_size,
                        const ParseOptions &options,
                        int num_columns,
+                       const int *col_map,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
                        cudaStream_t stream) {
@@ -643,7 +1028,122 @@ void detect_data_types(ColumnInfo *column_infos,
   const int grid_size = (num_records + block_size - 1) / block_size;
 
   detect_json_data_types<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, num_columns, rec_starts, num_records, column_infos);
+    data, data_size, options, num_columns, col_map, rec_starts, num_records, column_infos);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::tokenize_json
+ *
+ **/
+void tokenize_json(rmm::device_buffer const &input_data,
+                   const uint64_t *rec_starts,
+                   cudf::size_type num_records,
+                   ParseOptions const &opts,
+                   rmm::device_vector<json_token> &tokens,
+                   rmm::device_vector<cudf::size_type> &token_offsets,
+                   cudaStream_t stream) {
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, tokenize_json_kernel));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+  const auto data     = static_cast<const char *>(input_data.data());
+
+  // Count the tokens of each record, then scan the counts into offsets
+  token_offsets.resize(num_records + 1);
+  CUDA_TRY(cudaMemsetAsync(
+    token_offsets.data().get() + num_records, 0, sizeof(cudf::size_type), stream));
+  tokenize_json_kernel<<<grid_size, block_size, 0, stream>>>(
+    data, input_data.size(), rec_starts, num_records, opts, token_offsets.data().get(), nullptr);
+  CUDA_TRY(cudaGetLastError());
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         token_offsets.begin(),
+                         token_offsets.end(),
+                         token_offsets.begin());
+
+  cudf::size_type num_tokens = 0;
+  CUDA_TRY(cudaMemcpyAsync(&num_tokens,
+                           token_offsets.data().get() + num_records,
+                           sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+
+  tokens.resize(num_tokens);
+  tokenize_json_kernel<<<grid_size, block_size, 0, stream>>>(data,
+                                                             input_data.size(),
+                                                             rec_starts,
+                                                             num_records,
+                                                             opts,
+                                                             token_offsets.data().get(),
+                                                             tokens.data().get());
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_nested_json_to_columns
+ *
+ **/
+void convert_nested_json_to_columns(rmm::device_buffer const &input_data,
+                                    const json_token *tokens,
+                                    const cudf::size_type *token_offsets,
+                                    data_type *const dtypes,
+                                    void *const *output_columns,
+                                    cudf::size_type num_records,
+                                    cudf::size_type num_columns,
+                                    const int *col_map,
+                                    bitmask_type *const *valid_fields,
+                                    cudf::size_type *num_valid_fields,
+                                    ParseOptions const &opts,
+                                    cudaStream_t stream) {
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, convert_nested_json_to_columns_kernel));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  convert_nested_json_to_columns_kernel<<<grid_size, block_size, 0, stream>>>(
+    static_cast<const char *>(input_data.data()),
+    tokens,
+    token_offsets,
+    num_records,
+    dtypes,
+    opts,
+    output_columns,
+    num_columns,
+    col_map,
+    valid_fields,
+    num_valid_fields);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::detect_nested_data_types
+ *
+ **/
+void detect_nested_data_types(ColumnInfo *column_infos,
+                              const char *data,
+                              const json_token *tokens,
+                              const cudf::size_type *token_offsets,
+                              const ParseOptions &options,
+                              int num_columns,
+                              const int *col_map,
+                              cudf::size_type num_records,
+                              cudaStream_t stream) {
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, detect_nested_json_data_types));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  detect_nested_json_data_types<<<grid_size, block_size, 0, stream>>>(
+    data, tokens, token_offsets, options, num_columns, col_map, num_records, column_infos);
 
   CUDA_TRY(cudaGetLastError());
 }
@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include "json_common.h"
+
 #include <cudf/types.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 namespace cudf {
 namespace experimental {
 namespace io {
@@ -29,10 +33,11 @@ namespace gpu {
  * @brief Convert a buffer of input data (text) into raw cuDF column data. 
  *
  * @param[in] input_data The entire data to read
- * @param[in] dtypes The data type of each column
+ * @param[in] dtypes The data type of each output column
  * @param[out] output_columns The output column data
  * @param[in] num_records The number of lines/rows 
- * @param[in] num_columns The number of columns
+ * @param[in] num_columns The number of input columns to tokenize
+ * @param[in] col_map The output column of each input column; negative to skip
  * @param[in] rec_starts The start of each data record
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns 
@@ -46,6 +51,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              void *const *output_columns,
                              cudf::size_type num_records,
                              cudf::size_type num_columns,
+                             const int *col_map,
                              const uint64_t *rec_starts,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
@@ -55,11 +61,12 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
 /**
  * @brief Process a buffer of data and determine information about the column types within.  
  *
- * @param[out] column_infos The count for each column data type
+ * @param[out] column_infos The count for each output column data type
  * @param[in] data Input data buffer
  * @param[in] data_size Size of the data buffer, in bytes
  * @param[in] opts A set of parsing options
- * @param[in] num_columns The number of columns of input data
+ * @param[in] num_columns The number of columns of input data to tokenize
+ * @param[in] col_map The output column of each input column; negative to skip
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data 
  * @param[in] stream Cuda stream to run kernels on
@@ -71,10 +78,92 @@ void detect_data_types(ColumnInfo *column_infos,
                        size_t data_size,
                        const ParseOptions &options,
                        int num_columns,
+                       const int *col_map,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
                        cudaStream_t stream = 0);
 
+/**
+ * @brief Tokenizes JSON records, including nested objects and arrays.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] opts A set of parsing options
+ * @param[out] tokens The tokens of all the records, in record order
+ * @param[out] token_offsets The offset of the first token of each record, and
+ * the total number of tokens
+ * @param[in] stream Cuda stream to run kernels on
+ *
+ * @returns void
+ **/
+void tokenize_json(rmm::device_buffer const &input_data,
+                   const uint64_t *rec_starts,
+                   cudf::size_type num_records,
+                   ParseOptions const &opts,
+                   rmm::device_vector<json_token> &tokens,
+                   rmm::device_vector<cudf::size_type> &token_offsets,
+                   cudaStream_t stream = 0);
+
+/**
+ * @brief Convert tokenized JSON records into raw cuDF column data.
+ *
+ * The input columns are the leaf fields of the records: the values and the
+ * arrays nested in objects, in order. Arrays are converted as strings.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] tokens The tokens of all the records
+ * @param[in] token_offsets The offset of the first token of each record
+ * @param[in] dtypes The data type of each output column
+ * @param[out] output_columns The output column data
+ * @param[in] num_records The number of lines/rows
+ * @param[in] num_columns The number of input columns to convert
+ * @param[in] col_map The output column of each input column; negative to skip
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[in] opts A set of parsing options
+ * @param[in] stream Cuda stream to run kernels on
+ *
+ * @returns void
+ **/
+void convert_nested_json_to_columns(rmm::device_buffer const &input_data,
+                                    const json_token *tokens,
+                                    const cudf::size_type *token_offsets,
+                                    data_type *const dtypes,
+                                    void *const *output_columns,
+                                    cudf::size_type num_records,
+                                    cudf::size_type num_columns,
+                                    const int *col_map,
+                                    bitmask_type *const *valid_fields,
+                                    cudf::size_type *num_valid_fields,
+                                    ParseOptions const &opts,
+                                    cudaStream_t stream = 0);
+
+/**
+ * @brief Determine information about the column types of tokenized JSON records.
+ *
+ * @param[out] column_infos The count for each output column data type
+ * @param[in] data Input data buffer
+ * @param[in] tokens The tokens of all the records
+ * @param[in] token_offsets The offset of the first token of each record
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of input columns to examine
+ * @param[in] col_map The output column of each input column; negative to skip
+ * @param[in] num_records The number of lines/rows of input data
+ * @param[in] stream Cuda stream to run kernels on
+ *
+ * @returns void
+ **/
+void detect_nested_data_types(ColumnInfo *column_infos,
+                              const char *data,
+                              const json_token *tokens,
+                              const cudf::size_type *token_offsets,
+                              const ParseOptions &options,
+                              int num_columns,
+                              const int *col_map,
+                              cudf::size_type num_records,
+                              cudaStream_t stream = 0);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
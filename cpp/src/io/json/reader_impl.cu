@@ -33,6 +33,9 @@
 
 #include <cudf/table/table.hpp>
 
+#include <algorithm>
+#include <numeric>
+
 namespace cudf {
 namespace experimental {
 namespace io {
@@ -40,6 +43,8 @@ namespace detail {
 namespace json {
 
 using namespace cudf::io;
+using cudf::experimental::io::json::json_token;
+using cudf::experimental::io::json::json_token_type;
 
 namespace {
 
@@ -85,6 +90,73 @@ std::vector<std::string> get_names_from_json_object(const std::vector<char> &jso
   return names;
 }
 
+/**
+ * @brief Returns whether a JSON row contains nested objects or arrays
+ *
+ * @param[in] row Host vector containing the JSON row
+ * @param[in] opts Parsing options (e.g. delimiter and quotation character)
+ **/
+bool is_nested_row(const std::vector<char> &row, const ParseOptions &opts) {
+  bool quotation = false;
+  int depth      = 0;
+  for (size_t pos = 0; pos < row.size(); ++pos) {
+    if (row[pos] == opts.quotechar && (pos == 0 || row[pos - 1] != '\\')) {
+      quotation = !quotation;
+    } else if (!quotation && (row[pos] == '{' || row[pos] == '[')) {
+      if (++depth > 1) { return true; }
+    } else if (!quotation && (row[pos] == '}' || row[pos] == ']')) {
+      --depth;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Extract the names of the leaf fields of a tokenized JSON row
+ *
+ * Fields of nested objects are named by their path, with the names separated
+ * by periods; elements of top-level arrays are named by their position.
+ *
+ * @param[in] tokens Host vector containing the tokens of the row
+ * @param[in] row Host vector containing the JSON row
+ *
+ * @return std::vector<std::string> names of the leaf fields
+ **/
+std::vector<std::string> get_names_from_json_tokens(const std::vector<json_token> &tokens,
+                                                    const std::vector<char> &row) {
+  std::vector<std::string> names;
+  // Path prefix of the fields of each object
+  std::vector<std::string> prefixes(tokens.size());
+  std::vector<int> child_counts(tokens.size(), 0);
+  for (size_t i = 1; i < tokens.size(); ++i) {
+    const auto &token = tokens[i];
+    if (token.type == json_token_type::FIELD_NAME) { continue; }
+
+    const auto parent = token.parent;
+    const auto &key   = tokens[i - 1];
+    std::string name;
+    if (tokens[parent].type == json_token_type::OBJECT &&
+        key.type == json_token_type::FIELD_NAME && key.end - key.begin >= 2) {
+      name.assign(&row[key.begin + 1], &row[key.end - 1]);
+    } else {
+      name = std::to_string(child_counts[parent]);
+    }
+    child_counts[parent]++;
+    name = prefixes[parent] + name;
+
+    if (token.type == json_token_type::OBJECT) {
+      prefixes[i] = name + ".";
+    } else {
+      names.push_back(name);
+      // Arrays are a single field
+      if (token.type == json_token_type::ARRAY) {
+        while (i + 1 < tokens.size() && tokens[i + 1].begin < token.end) { ++i; }
+      }
+    }
+  }
+  return names;
+}
+
 /**
  * @brief Estimates the maximum expected length or a row, based on the number
  * of columns
@@ -308,7 +380,7 @@ void reader::impl::set_column_names(cudaStream_t stream) {
   std::vector<char> first_row(first_row_len);
   CUDA_TRY(cudaMemcpyAsync(
     first_row.data(), data_.data(), first_row_len * sizeof(char), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   // Determine the row format between:
   //   JSON array - [val1, val2, ...] and
@@ -318,6 +390,33 @@ void reader::impl::set_column_names(cudaStream_t stream) {
   const auto first_curly_bracket  = std::find(first_row.begin(), first_row.end(), '{');
   CUDF_EXPECTS(first_curly_bracket != first_row.end() || first_square_bracket != first_row.end(),
                "Input data is not a valid JSON file.");
+  if (is_nested_row(first_row, opts_)) {
+    nested_ = true;
+    cudf::experimental::io::json::gpu::tokenize_json(data_,
+                                                     rec_starts_.data().get(),
+                                                     rec_starts_.size(),
+                                                     opts_,
+                                                     d_tokens_,
+                                                     d_token_offsets_,
+                                                     stream);
+    cudf::size_type first_row_tokens = 0;
+    CUDA_TRY(cudaMemcpyAsync(&first_row_tokens,
+                             d_token_offsets_.data().get() + 1,
+                             sizeof(cudf::size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
+    std::vector<json_token> h_tokens(first_row_tokens);
+    CUDA_TRY(cudaMemcpyAsync(h_tokens.data(),
+                             d_tokens_.data().get(),
+                             first_row_tokens * sizeof(json_token),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDF_STREAM_SYNC(stream);
+    metadata.column_names = get_names_from_json_tokens(h_tokens, first_row);
+    return;
+  }
+
   // If the first opening bracket is '{', assume object format
   const bool is_object = first_curly_bracket < first_square_bracket;
   if (is_object) {
@@ -338,6 +437,36 @@ void reader::impl::set_column_names(cudaStream_t stream) {
   }
 }
 
+/**
+ * @brief Selects the columns to read, if specified in the options
+ *
+ * Sets the d_col_map_ data member and keeps only the selected column names.
+ * Input columns past the last selected one are excluded from the map so that
+ * their fields are not tokenized.
+ *
+ * @return void
+ **/
+void reader::impl::select_columns() {
+  const auto &all_names = metadata.column_names;
+  std::vector<int> col_map(all_names.size(), -1);
+  if (args_.columns.empty()) {
+    std::iota(col_map.begin(), col_map.end(), 0);
+  } else {
+    int last_col = -1;
+    for (size_t i = 0; i < args_.columns.size(); ++i) {
+      const auto it = std::find(all_names.begin(), all_names.end(), args_.columns[i]);
+      CUDF_EXPECTS(it != all_names.end(), "Selected column not found in the input.\n");
+      const int input_col = std::distance(all_names.begin(), it);
+      CUDF_EXPECTS(col_map[input_col] < 0, "Column selected more than once.\n");
+      col_map[input_col] = i;
+      last_col           = std::max(last_col, input_col);
+    }
+    col_map.resize(last_col + 1);
+    metadata.column_names = args_.columns;
+  }
+  d_col_map_ = col_map;
+}
+
 /**
  * @brief Set the data type array data member
  *
@@ -393,18 +522,42 @@ void reader::impl::set_data_types(cudaStream_t stream) {
 
     rmm::device_vector<cudf::experimental::io::json::ColumnInfo> d_column_infos(
       num_columns, cudf::experimental::io::json::ColumnInfo{});
-    cudf::experimental::io::json::gpu::detect_data_types(d_column_infos.data().get(),
-                                                         static_cast<const char *>(data_.data()),
-                                                         data_.size(),
-                                                         opts_,
-                                                         num_columns,
-                                                         rec_starts_.data().get(),
-                                                         rec_starts_.size(),
-                                                         stream);
+    // The counts of all the sampled runs of records accumulate
+    size_t num_sampled_records = 0;
+    for (const auto &run : select_sample_rows(rec_starts_.size(), args_.infer_sample_rows)) {
+      if (nested_) {
+        cudf::experimental::io::json::gpu::detect_nested_data_types(
+          d_column_infos.data().get(),
+          static_cast<const char *>(data_.data()),
+          d_tokens_.data().get(),
+          d_token_offsets_.data().get() + run.first,
+          opts_,
+          d_col_map_.size(),
+          d_col_map_.data().get(),
+          run.second,
+          stream);
+      } else {
+        // The last record of a run ends where the next record starts
+        const auto run_end = run.first + run.second;
+        const size_t run_data_size =
+          (run_end < rec_starts_.size()) ? static_cast<size_t>(rec_starts_[run_end]) : data_.size();
+        cudf::experimental::io::json::gpu::detect_data_types(
+          d_column_infos.data().get(),
+          static_cast<const char *>(data_.data()),
+          run_data_size,
+          opts_,
+          d_col_map_.size(),
+          d_col_map_.data().get(),
+          rec_starts_.data().get() + run.first,
+          run.second,
+          stream);
+      }
+      num_sampled_records += run.second;
+    }
     thrust::host_vector<cudf::experimental::io::json::ColumnInfo> h_column_infos = d_column_infos;
 
     for (const auto &cinfo : h_column_infos) {
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
+      if (cinfo.null_count == static_cast<int>(num_sampled_records)) {
         // Entire column is NULL; allocate the smallest amount of memory
         dtypes_.push_back(data_type(INT8));
       } else if (cinfo.string_count > 0) {
@@ -456,17 +609,34 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream) {
   rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
   rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
 
-  cudf::experimental::io::json::gpu::convert_json_to_columns(data_,
-                                                             d_dtypes.data().get(),
-                                                             d_data.data().get(),
-                                                             num_records,
-                                                             num_columns,
-                                                             rec_starts_.data().get(),
-                                                             d_valid.data().get(),
-                                                             d_valid_counts.data().get(),
-                                                             opts_,
-                                                             stream);
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  if (nested_) {
+    cudf::experimental::io::json::gpu::convert_nested_json_to_columns(
+      data_,
+      d_tokens_.data().get(),
+      d_token_offsets_.data().get(),
+      d_dtypes.data().get(),
+      d_data.data().get(),
+      num_records,
+      d_col_map_.size(),
+      d_col_map_.data().get(),
+      d_valid.data().get(),
+      d_valid_counts.data().get(),
+      opts_,
+      stream);
+  } else {
+    cudf::experimental::io::json::gpu::convert_json_to_columns(data_,
+                                                               d_dtypes.data().get(),
+                                                               d_data.data().get(),
+                                                               num_records,
+                                                               d_col_map_.size(),
+                                                               d_col_map_.data().get(),
+                                                               rec_starts_.data().get(),
+                                                               d_valid.data().get(),
+                                                               d_valid_counts.data().get(),
+                                                               opts_,
+                                                               stream);
+  }
+  CUDF_STREAM_SYNC(stream);
   CUDA_TRY(cudaGetLastError());
 
   // postprocess columns
@@ -530,6 +700,8 @@ table_with_metadata reader::impl::read(size_t range_offset,
   set_column_names(stream);
   CUDF_EXPECTS(!metadata.column_names.empty(), "Error determining column names.\n");
 
+  select_columns();
+
   set_data_types(stream);
   CUDF_EXPECTS(!dtypes_.empty(), "Error in data type detection.\n");
 
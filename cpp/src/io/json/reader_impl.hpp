@@ -70,6 +70,13 @@ class reader::impl {
 
   table_metadata metadata;
   std::vector<data_type> dtypes_;
+  // Output column of each input column to tokenize; negative if not selected
+  rmm::device_vector<int> d_col_map_;
+
+  // Token stream of the records, used if they contain nested objects or arrays
+  bool nested_ = false;
+  rmm::device_vector<cudf::experimental::io::json::json_token> d_tokens_;
+  rmm::device_vector<cudf::size_type> d_token_offsets_;
   //std::vector<gdf_dtype_extra_info> dtypes_extra_info_;
 
   // parsing options
@@ -126,6 +133,8 @@ class reader::impl {
    * @brief Parse the first row to set the column name
    *
    * Sets the column_names_ data member
+   * If the first row contains nested objects or arrays, tokenizes all records
+   * and names the leaf fields by their path, e.g. "a.b"
    * 
    * @param[in] stream Cuda stream to execute gpu operations on
    *
@@ -133,6 +142,17 @@ class reader::impl {
    **/
   void set_column_names(cudaStream_t stream);
 
+  /**
+   * @brief Selects the columns to read, if specified in the options
+   *
+   * Sets the d_col_map_ data member and keeps only the selected column names.
+   * Input columns past the last selected one are excluded from the map so that
+   * their fields are not tokenized.
+   *
+   * @return void
+   **/
+  void select_columns();
+
   /**
    * @brief Set the data type array data member
    *
@@ -106,6 +106,45 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct IntegerStatistics {
+  int64_t minimum  = 0;
+  int64_t maximum  = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0;
+  double maximum   = 0;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;
+  std::string maximum;
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+// Decoded contents of a ColumnStatistics blob (only the fields used for filtering)
+struct ParsedColumnStatistics {
+  uint64_t numberOfValues = 0;  // number of non-null values
+  bool has_numberOfValues = false;
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  IntegerStatistics dateStatistics;
+};
+
+struct RowIndexEntry {
+  ColumnStatistics statistics;  // Column statistics blob of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -165,6 +204,12 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(IntegerStatistics);
+  DECL_ORC_STRUCT(DoubleStatistics);
+  DECL_ORC_STRUCT(StringStatistics);
+  DECL_ORC_STRUCT(ParsedColumnStatistics);
+  DECL_ORC_STRUCT(RowIndexEntry);
+  DECL_ORC_STRUCT(RowIndex);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
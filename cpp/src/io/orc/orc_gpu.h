@@ -94,6 +94,7 @@ struct ColumnDesc {
   uint32_t num_rows;                       // starting row of the stripe
   uint32_t dictionary_start;               // start position in global dictionary
   uint32_t dict_len;                       // length of local dictionary
+  uint32_t dict_key_offset;                // position of local dictionary in dictionary column keys
   uint32_t null_count;                     // number of null values in this stripe's column
   uint32_t skip_count;                     // number of non-null values to skip
   uint32_t rowgroup_id;                    // row group position
@@ -356,6 +357,7 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
                                    uint32_t comp_blk_size,
+                                   int comp_level,
                                    cudaStream_t stream = (cudaStream_t)0);
 
 /**
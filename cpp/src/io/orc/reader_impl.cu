@@ -23,16 +23,26 @@
 #include "timezone.h"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/file_metadata_cache.hpp>
+#include <io/utilities/pipelined_reader.hpp>
+#include <io/utilities/predicate_utils.hpp>
 
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <iterator>
 
 namespace cudf {
 namespace experimental {
@@ -74,8 +84,8 @@ constexpr type_id to_type_id(const orc::SchemaType &schema,
       // There isn't a (DAYS -> np.dtype) mapping
       return (use_np_dtypes) ? type_id::TIMESTAMP_MILLISECONDS : type_id::TIMESTAMP_DAYS;
     case orc::DECIMAL:
-      // There isn't an arbitrary-precision type in cuDF, so map as float or int
-      return (decimals_as_float) ? type_id::FLOAT64 : type_id::INT64;
+      // There isn't an arbitrary-precision type in cuDF, so map as float or 64-bit fixed-point
+      return (decimals_as_float) ? type_id::FLOAT64 : type_id::DECIMAL64;
     default: break;
   }
 
@@ -118,6 +128,126 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Returns whether a string contains characters in the U+E000-U+FFFF
+ * range, for which the UTF-16 order of ORC string statistics differs from the
+ * bytewise UTF-8 order
+ **/
+bool has_high_bmp_chars(std::string const &str) {
+  return std::any_of(str.begin(), str.end(), [](char ch) {
+    return static_cast<uint8_t>(ch) == 0xee || static_cast<uint8_t>(ch) == 0xef;
+  });
+}
+
+/**
+ * @brief Returns whether the section (file, stripe or row group) described by
+ * its column statistics may contain rows that satisfy the predicate
+ *
+ * Returns true whenever the statistics are missing or cannot be interpreted.
+ *
+ * @param blob Encoded column statistics
+ * @param type Schema type of the column
+ * @param pred Predicate to evaluate
+ **/
+bool statistics_may_match(ColumnStatistics const &blob,
+                          SchemaType const &type,
+                          column_predicate const &pred) {
+  using value_kind = column_predicate::value_kind;
+
+  ParsedColumnStatistics stats;
+  ProtobufReader pb(blob.data(), blob.size());
+  if (blob.empty() || !pb.read(&stats, blob.size())) { return true; }
+
+  // Comparisons never match nulls, so sections without any values can be skipped
+  if (stats.has_numberOfValues && stats.numberOfValues == 0) { return false; }
+
+  auto match_integers = [&](IntegerStatistics const &is) {
+    if (!is.has_minimum || !is.has_maximum) { return true; }
+    if (pred.kind == value_kind::INTEGER) {
+      return range_may_match(is.minimum, is.maximum, pred.op, pred.int_value);
+    } else if (pred.kind == value_kind::FLOAT && !std::isnan(pred.float_value)) {
+      return range_may_match<double>(is.minimum, is.maximum, pred.op, pred.float_value);
+    }
+    return true;
+  };
+
+  switch (type.kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG: return match_integers(stats.intStatistics);
+    case orc::DATE: return match_integers(stats.dateStatistics);
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      auto const &ds = stats.doubleStatistics;
+      if (!ds.has_minimum || !ds.has_maximum) { return true; }
+      if (std::isnan(ds.minimum) || std::isnan(ds.maximum)) { return true; }
+      if (pred.kind == value_kind::INTEGER) {
+        return range_may_match<double>(ds.minimum, ds.maximum, pred.op, pred.int_value);
+      } else if (pred.kind == value_kind::FLOAT && !std::isnan(pred.float_value)) {
+        return range_may_match(ds.minimum, ds.maximum, pred.op, pred.float_value);
+      }
+      return true;
+    }
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR: {
+      auto const &ss = stats.stringStatistics;
+      if (!ss.has_minimum || !ss.has_maximum || pred.kind != value_kind::STRING) { return true; }
+      if (has_high_bmp_chars(ss.minimum) || has_high_bmp_chars(ss.maximum) ||
+          has_high_bmp_chars(pred.string_value)) {
+        return true;
+      }
+      return range_may_match(ss.minimum, ss.maximum, pred.op, pred.string_value);
+    }
+    default: return true;
+  }
+}
+
+/**
+ * @brief Postscript and file footer of a source, shared by the readers of the same file
+ **/
+struct file_footer {
+  PostScript ps;
+  FileFooter ff;
+  size_t postscript_length = 0;
+};
+
+/**
+ * @brief Reads and parses the postscript and file footer of a source
+ *
+ * @param source Dataset source
+ *
+ * @return The parsed footer and the size in bytes of its serialized form
+ **/
+std::pair<std::shared_ptr<const file_footer>, size_t> parse_file_footer(datasource *source) {
+  auto footer            = std::make_shared<file_footer>();
+  const auto len         = source->size();
+  const auto max_ps_size = std::min(len, static_cast<size_t>(256));
+
+  // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
+  auto buffer            = source->get_buffer(len - max_ps_size, max_ps_size);
+  const size_t ps_length = buffer->data()[max_ps_size - 1];
+  const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
+  ProtobufReader pb;
+  pb.init(ps_data, ps_length);
+  CUDF_EXPECTS(pb.read(&footer->ps, ps_length), "Cannot read postscript");
+  CUDF_EXPECTS(footer->ps.footerLength + ps_length < len, "Invalid footer length");
+  footer->postscript_length = ps_length;
+
+  // Read compressed filefooter section
+  const auto &ps = footer->ps;
+  OrcDecompressor decompressor(ps.compression, ps.compressionBlockSize);
+  buffer           = source->get_buffer(len - ps_length - 1 - ps.footerLength, ps.footerLength);
+  size_t ff_length = 0;
+  auto ff_data     = decompressor.Decompress(buffer->data(), ps.footerLength, &ff_length);
+  pb.init(ff_data, ff_length);
+  CUDF_EXPECTS(pb.read(&footer->ff, ff_length), "Cannot read filefooter");
+
+  const size_t footer_bytes = ps_length + 1 + ps.footerLength;
+  return {std::move(footer), footer_bytes};
+}
+
 }  // namespace
 
 /**
@@ -128,29 +258,16 @@ class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
  public:
-  explicit metadata(datasource *const src) : source(src) {
-    const auto len         = source->size();
-    const auto max_ps_size = std::min(len, static_cast<size_t>(256));
-
-    // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
-    auto buffer            = source->get_buffer(len - max_ps_size, max_ps_size);
-    const size_t ps_length = buffer->data()[max_ps_size - 1];
-    const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
-    ProtobufReader pb;
-    pb.init(ps_data, ps_length);
-    CUDF_EXPECTS(pb.read(&ps, ps_length), "Cannot read postscript");
-    CUDF_EXPECTS(ps.footerLength + ps_length < len, "Invalid footer length");
+  metadata(datasource *const src, std::string const &path) : source(src) {
+    const auto footer = file_metadata_cache<file_footer>::instance().get_or_load(
+      path, [&]() { return parse_file_footer(source); });
+    ps                = footer->ps;
+    ff                = footer->ff;
+    postscript_length = footer->postscript_length;
 
     // If compression is used, all the rest of the metadata is compressed
     // If no compressed is used, the decompressor is simply a pass-through
     decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
-
-    // Read compressed filefooter section
-    buffer           = source->get_buffer(len - ps_length - 1 - ps.footerLength, ps.footerLength);
-    size_t ff_length = 0;
-    auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
-    pb.init(ff_data, ff_length);
-    CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
   }
 
@@ -277,6 +394,133 @@ class metadata {
     return selection;
   }
 
+  /**
+   * @brief Removes the stripes whose statistics show that they cannot contain
+   * any rows satisfying all of the predicates
+   *
+   * Stripe-level statistics from the file metadata are checked first, without
+   * reading any stripe data. If `use_index` is set, the remaining stripes are
+   * also removed if none of their row groups can match, based on the
+   * statistics in the row index. A row range can then be applied to the rows
+   * of the remaining stripes with `trim_stripes()`.
+   *
+   * @param[in,out] selection List of stripe info, as returned by `select_stripes`
+   * @param[in] filters List of predicates, evaluated as a conjunction
+   * @param[in] use_index Whether to use the row index statistics
+   **/
+  void filter_stripes(std::vector<OrcStripeInfo> &selection,
+                      std::vector<column_predicate> const &filters,
+                      bool use_index) {
+    if (filters.empty() || selection.empty()) { return; }
+
+    // Resolve the column index of each filtered column
+    std::vector<uint32_t> filter_columns;
+    for (const auto &filter : filters) {
+      int col = 0;
+      while (col < get_num_columns() && ff.GetColumnName(col) != filter.column) { ++col; }
+      CUDF_EXPECTS(col < get_num_columns(), "Filter column not found");
+      filter_columns.push_back(col);
+    }
+
+    // Stripe statistics are stored in the file metadata section
+    if (ps.metadataLength != 0 && md.stripeStats.empty()) {
+      const auto md_offset =
+        source->size() - postscript_length - 1 - ps.footerLength - ps.metadataLength;
+      const auto buffer = source->get_buffer(md_offset, ps.metadataLength);
+      size_t md_length  = 0;
+      auto md_data = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+      ProtobufReader pb(md_data, md_length);
+      if (!pb.read(&md, md_length)) { md.stripeStats.clear(); }
+    }
+
+    auto stripe_may_match = [&](OrcStripeInfo const &stripe_info) {
+      const auto stripe_idx = static_cast<size_t>(stripe_info.first - ff.stripes.data());
+      if (stripe_idx < md.stripeStats.size()) {
+        const auto &col_stats = md.stripeStats[stripe_idx].colStats;
+        for (size_t i = 0; i < filters.size(); ++i) {
+          const auto col = filter_columns[i];
+          if (col < col_stats.size() &&
+              !statistics_may_match(col_stats[col], ff.types[col], filters[i])) {
+            return false;
+          }
+        }
+      }
+      if (!use_index || ff.rowIndexStride == 0) { return true; }
+
+      // Read the row index of each filtered column
+      std::vector<RowIndex> indexes(filters.size());
+      uint64_t offset = stripe_info.first->offset;
+      for (const auto &stream : stripe_info.second->streams) {
+        if (stream.kind == orc::ROW_INDEX && stream.length != 0) {
+          for (size_t i = 0; i < filters.size(); ++i) {
+            if (stream.column != filter_columns[i]) { continue; }
+            const auto buffer = source->get_buffer(offset, stream.length);
+            size_t ix_length  = 0;
+            auto ix_data = decompressor->Decompress(buffer->data(), stream.length, &ix_length);
+            ProtobufReader pb(ix_data, ix_length);
+            if (!pb.read(&indexes[i], ix_length)) { indexes[i].entry.clear(); }
+          }
+        }
+        offset += stream.length;
+      }
+      const auto num_rowgroups =
+        (stripe_info.first->numberOfRows + ff.rowIndexStride - 1) / ff.rowIndexStride;
+      for (size_t g = 0; g < num_rowgroups; ++g) {
+        bool group_may_match = true;
+        for (size_t i = 0; i < filters.size() && group_may_match; ++i) {
+          const auto col = filter_columns[i];
+          // A missing or incomplete index can't rule out any row group
+          if (indexes[i].entry.size() != num_rowgroups) { continue; }
+          group_may_match =
+            statistics_may_match(indexes[i].entry[g].statistics, ff.types[col], filters[i]);
+        }
+        if (group_may_match) { return true; }
+      }
+      return num_rowgroups == 0;
+    };
+
+    std::vector<OrcStripeInfo> filtered;
+    std::copy_if(selection.begin(), selection.end(), std::back_inserter(filtered), stripe_may_match);
+    selection = std::move(filtered);
+  }
+
+  /**
+   * @brief Reduces a selection of stripes down to the stripes overlapping a
+   * range of their rows
+   *
+   * @param[in,out] selection List of stripe info, as returned by `select_stripes`
+   * @param[in,out] row_start Starting row of the range, in the rows of the
+   * selection; set to the rows to skip in the first remaining stripe
+   * @param[in,out] row_count Number of rows of the range, or negative for all
+   * the remaining rows; set to the number of rows selected
+   **/
+  void trim_stripes(std::vector<OrcStripeInfo> &selection,
+                    size_type &row_start,
+                    size_type &row_count) {
+    size_t total_rows = 0;
+    for (const auto &stripe_info : selection) { total_rows += stripe_info.first->numberOfRows; }
+    row_start = std::max(row_start, 0);
+    CUDF_EXPECTS(static_cast<size_t>(row_start) <= total_rows, "Invalid row start");
+    const size_t range_begin = row_start;
+    const size_t range_end =
+      (row_count < 0) ? total_rows : std::min(total_rows, range_begin + row_count);
+
+    std::vector<OrcStripeInfo> trimmed;
+    size_t trimmed_start = 0;
+    size_t stripe_start  = 0;
+    for (const auto &stripe_info : selection) {
+      const size_t stripe_end = stripe_start + stripe_info.first->numberOfRows;
+      if (stripe_start < range_end && stripe_end > range_begin) {
+        if (trimmed.empty()) { trimmed_start = range_begin - stripe_start; }
+        trimmed.push_back(stripe_info);
+      }
+      stripe_start = stripe_end;
+    }
+    selection = std::move(trimmed);
+    row_start = static_cast<size_type>(trimmed_start);
+    row_count = static_cast<size_type>(range_end - range_begin);
+  }
+
   inline size_t get_total_rows() const { return ff.numberOfRows; }
   inline int get_num_stripes() const { return ff.stripes.size(); }
   inline int get_num_columns() const { return ff.types.size(); }
@@ -285,15 +529,45 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
+  Metadata md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
  private:
   datasource *const source;
+  size_t postscript_length = 0;
 };
 
 namespace {
 
+/**
+ * @brief Owns the stream that stripes are decompressed on, and the event that
+ * orders it with the stream the stripe data is read on
+ **/
+struct decompression_stream {
+  cudaStream_t stream{};
+  cudaEvent_t event{};
+
+  decompression_stream() {
+    CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+
+  ~decompression_stream() {
+    cudaStreamSynchronize(stream);
+    cudaEventDestroy(event);
+    cudaStreamDestroy(stream);
+  }
+
+  /**
+   * @brief Makes the work later queued on `waiting` wait for the work queued so far on `source`
+   **/
+  void wait(cudaStream_t source, cudaStream_t waiting) {
+    CUDA_TRY(cudaEventRecord(event, source));
+    CUDA_TRY(cudaStreamWaitEvent(waiting, event, 0));
+  }
+};
+
 /**
  * @brief Struct that maps ORC streams to columns
  **/
@@ -313,8 +587,21 @@ struct orc_stream_info {
   uint32_t stripe_idx;  // stripe index
 };
 
+/**
+ * @brief Returns the string of an entry of a stripe dictionary
+ **/
+struct dictionary_entry_to_string {
+  const char *dictionary_data;
+  __device__ column_buffer::str_pair operator()(gpu::DictionaryEntry const &entry) const {
+    return {dictionary_data + entry.pos, static_cast<size_type>(entry.len)};
+  }
+};
+
 /**
  * @brief Function that populates column descriptors stream/chunk
+ *
+ * Only the streams needed to decode the selected columns are gathered, so the
+ * reads and decompression of a stripe scale with the number of selected columns
  **/
 size_t gather_stream_info(const size_t stripe_index,
                           const orc::StripeInformation *stripeinfo,
@@ -330,8 +617,10 @@ size_t gather_stream_info(const size_t stripe_index,
   uint64_t src_offset    = 0;
   uint64_t dst_offset    = 0;
   for (const auto &stream : stripefooter->streams) {
-    if (stream.column >= orc2gdf.size()) {
-      dst_offset += stream.length;
+    // Streams of unselected columns are neither read nor decompressed, nor
+    // are the row index streams when the index is not used
+    if (stream.column >= orc2gdf.size() || (src_offset < stripeinfo->indexLength && !use_index)) {
+      src_offset += stream.length;
       continue;
     }
 
@@ -356,26 +645,24 @@ size_t gather_stream_info(const size_t stripe_index,
       }
     }
     if (col != -1) {
-      if (src_offset >= stripeinfo->indexLength || use_index) {
-        // NOTE: skip_count field is temporarily used to track index ordering
-        auto &chunk = chunks[stripe_index * num_columns + col];
-        const auto idx =
-          get_index_type_and_pos(stream.kind, chunk.skip_count, col == orc2gdf[stream.column]);
-        if (idx.first < gpu::CI_NUM_STREAMS) {
-          chunk.strm_id[idx.first]  = stream_info.size();
-          chunk.strm_len[idx.first] = stream.length;
-          chunk.skip_count          = idx.second;
-
-          if (idx.first == gpu::CI_DICTIONARY) {
-            chunk.dictionary_start = *num_dictionary_entries;
-            chunk.dict_len         = stripefooter->columns[stream.column].dictionarySize;
-            *num_dictionary_entries += stripefooter->columns[stream.column].dictionarySize;
-          }
+      // NOTE: skip_count field is temporarily used to track index ordering
+      auto &chunk = chunks[stripe_index * num_columns + col];
+      const auto idx =
+        get_index_type_and_pos(stream.kind, chunk.skip_count, col == orc2gdf[stream.column]);
+      if (idx.first < gpu::CI_NUM_STREAMS) {
+        chunk.strm_id[idx.first]  = stream_info.size();
+        chunk.strm_len[idx.first] = stream.length;
+        chunk.skip_count          = idx.second;
+
+        if (idx.first == gpu::CI_DICTIONARY) {
+          chunk.dictionary_start = *num_dictionary_entries;
+          chunk.dict_len         = stripefooter->columns[stream.column].dictionarySize;
+          *num_dictionary_entries += stripefooter->columns[stream.column].dictionarySize;
         }
+        stream_info.emplace_back(
+          stripeinfo->offset + src_offset, dst_offset, stream.length, col, stripe_index);
+        dst_offset += stream.length;
       }
-      stream_info.emplace_back(
-        stripeinfo->offset + src_offset, dst_offset, stream.length, col, stripe_index);
-      dst_offset += stream.length;
     }
     src_offset += stream.length;
   }
@@ -387,42 +674,45 @@ size_t gather_stream_info(const size_t stripe_index,
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
   hostdevice_vector<gpu::ColumnDesc> &chunks,
-  const std::vector<rmm::device_buffer> &stripe_data,
+  const rmm::device_buffer &stripe_data,
   const OrcDecompressor *decompressor,
   std::vector<orc_stream_info> &stream_info,
-  size_t num_stripes,
-  rmm::device_vector<gpu::RowGroup> &row_groups,
-  size_t row_index_stride,
+  hostdevice_vector<gpu::CompressedStreamInfo> &compinfo,
+  size_t stripe_idx,
+  size_t first_stream,
+  size_t num_streams,
+  size_t num_columns,
   cudaStream_t stream) {
   // Parse the columns' compressed info
-  hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
-  for (const auto &info : stream_info) {
-    compinfo.insert(gpu::CompressedStreamInfo(
-      static_cast<const uint8_t *>(stripe_data[info.stripe_idx].data()) + info.dst_pos,
-      info.length));
+  for (size_t i = first_stream; i < first_stream + num_streams; ++i) {
+    compinfo[i] = gpu::CompressedStreamInfo(
+      static_cast<const uint8_t *>(stripe_data.data()) + stream_info[i].dst_pos,
+      stream_info[i].length);
   }
-  CUDA_TRY(cudaMemcpyAsync(compinfo.device_ptr(),
-                           compinfo.host_ptr(),
-                           compinfo.memory_size(),
-                           cudaMemcpyHostToDevice,
-                           stream));
-  CUDA_TRY(gpu::ParseCompressedStripeData(compinfo.device_ptr(),
-                                          compinfo.size(),
+  auto copy_compinfo = [&](cudaMemcpyKind kind) {
+    const auto size = num_streams * sizeof(gpu::CompressedStreamInfo);
+    if (kind == cudaMemcpyHostToDevice) {
+      CUDA_TRY(cudaMemcpyAsync(
+        compinfo.device_ptr(first_stream), compinfo.host_ptr(first_stream), size, kind, stream));
+    } else {
+      CUDA_TRY(cudaMemcpyAsync(
+        compinfo.host_ptr(first_stream), compinfo.device_ptr(first_stream), size, kind, stream));
+    }
+  };
+  copy_compinfo(cudaMemcpyHostToDevice);
+  CUDA_TRY(gpu::ParseCompressedStripeData(compinfo.device_ptr(first_stream),
+                                          num_streams,
                                           decompressor->GetBlockSize(),
                                           decompressor->GetLog2MaxCompressionRatio(),
                                           stream));
-  CUDA_TRY(cudaMemcpyAsync(compinfo.host_ptr(),
-                           compinfo.device_ptr(),
-                           compinfo.memory_size(),
-                           cudaMemcpyDeviceToHost,
-                           stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  copy_compinfo(cudaMemcpyDeviceToHost);
+  CUDF_STREAM_SYNC(stream);
 
   // Count the exact number of compressed blocks
   size_t num_compressed_blocks   = 0;
   size_t num_uncompressed_blocks = 0;
   size_t total_decomp_size       = 0;
-  for (size_t i = 0; i < compinfo.size(); ++i) {
+  for (size_t i = first_stream; i < first_stream + num_streams; ++i) {
     num_compressed_blocks += compinfo[i].num_compressed_blocks;
     num_uncompressed_blocks += compinfo[i].num_uncompressed_blocks;
     total_decomp_size += compinfo[i].max_uncompressed_size;
@@ -438,7 +728,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   size_t decomp_offset      = 0;
   uint32_t start_pos        = 0;
   uint32_t start_pos_uncomp = (uint32_t)num_compressed_blocks;
-  for (size_t i = 0; i < compinfo.size(); ++i) {
+  for (size_t i = first_stream; i < first_stream + num_streams; ++i) {
     auto dst_base                 = static_cast<uint8_t *>(decomp_data.data());
     compinfo[i].uncompressed_data = dst_base + decomp_offset;
     compinfo[i].decctl            = inflate_in.data().get() + start_pos;
@@ -450,13 +740,9 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
     start_pos += compinfo[i].num_compressed_blocks;
     start_pos_uncomp += compinfo[i].num_uncompressed_blocks;
   }
-  CUDA_TRY(cudaMemcpyAsync(compinfo.device_ptr(),
-                           compinfo.host_ptr(),
-                           compinfo.memory_size(),
-                           cudaMemcpyHostToDevice,
-                           stream));
-  CUDA_TRY(gpu::ParseCompressedStripeData(compinfo.device_ptr(),
-                                          compinfo.size(),
+  copy_compinfo(cudaMemcpyHostToDevice);
+  CUDA_TRY(gpu::ParseCompressedStripeData(compinfo.device_ptr(first_stream),
+                                          num_streams,
                                           decompressor->GetBlockSize(),
                                           decompressor->GetLog2MaxCompressionRatio(),
                                           stream));
@@ -472,6 +758,14 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
         CUDA_TRY(gpu_unsnap(
           inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
         break;
+      case orc::ZSTD:
+        CUDA_TRY(gpu_unzstd(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
+        break;
+      case orc::LZ4:
+        CUDA_TRY(gpu_unlz4(
+          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
+        break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -479,50 +773,27 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
     CUDA_TRY(gpu_copy_uncompressed_blocks(
       inflate_in.data().get() + num_compressed_blocks, num_uncompressed_blocks, stream));
   }
-  CUDA_TRY(gpu::PostDecompressionReassemble(compinfo.device_ptr(), compinfo.size(), stream));
+  CUDA_TRY(gpu::PostDecompressionReassemble(
+    compinfo.device_ptr(first_stream), num_streams, stream));
 
   // Update the stream information with the updated uncompressed info
   // TBD: We could update the value from the information we already
   // have in stream_info[], but using the gpu results also updates
   // max_uncompressed_size to the actual uncompressed size, or zero if
   // decompression failed.
-  CUDA_TRY(cudaMemcpyAsync(compinfo.host_ptr(),
-                           compinfo.device_ptr(),
-                           compinfo.memory_size(),
-                           cudaMemcpyDeviceToHost,
-                           stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
-
-  const size_t num_columns = chunks.size() / num_stripes;
-
-  for (size_t i = 0; i < num_stripes; ++i) {
-    for (size_t j = 0; j < num_columns; ++j) {
-      auto &chunk = chunks[i * num_columns + j];
-      for (int k = 0; k < gpu::CI_NUM_STREAMS; ++k) {
-        if (chunk.strm_len[k] > 0 && chunk.strm_id[k] < compinfo.size()) {
-          chunk.streams[k]  = compinfo[chunk.strm_id[k]].uncompressed_data;
-          chunk.strm_len[k] = compinfo[chunk.strm_id[k]].max_uncompressed_size;
-        }
+  copy_compinfo(cudaMemcpyDeviceToHost);
+  CUDF_STREAM_SYNC(stream);
+
+  for (size_t j = 0; j < num_columns; ++j) {
+    auto &chunk = chunks[stripe_idx * num_columns + j];
+    for (int k = 0; k < gpu::CI_NUM_STREAMS; ++k) {
+      if (chunk.strm_len[k] > 0 && chunk.strm_id[k] < compinfo.size()) {
+        chunk.streams[k]  = compinfo[chunk.strm_id[k]].uncompressed_data;
+        chunk.strm_len[k] = compinfo[chunk.strm_id[k]].max_uncompressed_size;
       }
     }
   }
 
-  if (not row_groups.empty()) {
-    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
-                             chunks.host_ptr(),
-                             chunks.memory_size(),
-                             cudaMemcpyHostToDevice,
-                             stream));
-    CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
-                                     compinfo.device_ptr(),
-                                     chunks.device_ptr(),
-                                     num_columns,
-                                     num_stripes,
-                                     row_groups.size() / num_columns,
-                                     row_index_stride,
-                                     stream));
-  }
-
   return decomp_data;
 }
 
@@ -562,6 +833,22 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                                  num_rows,
                                                  skip_rows,
                                                  stream));
+
+  // Dictionary columns keep the dictionary entries of all their stripes as keys
+  for (size_t i = 0; i < num_stripes; ++i) {
+    for (size_t j = 0; j < num_columns; ++j) {
+      auto const &chunk = chunks[i * num_columns + j];
+      if (out_buffers[j]._keys.empty() || chunk.dict_len == 0) { continue; }
+      auto const entries = global_dict.begin() + chunk.dictionary_start;
+      thrust::transform(
+        rmm::exec_policy(stream)->on(stream),
+        entries,
+        entries + chunk.dict_len,
+        out_buffers[j]._keys.begin() + chunk.dict_key_offset,
+        dictionary_entry_to_string{
+          reinterpret_cast<const char *>(chunk.streams[gpu::CI_DICTIONARY])});
+    }
+  }
   CUDA_TRY(gpu::DecodeOrcColumnData(chunks.device_ptr(),
                                     global_dict.data().get(),
                                     num_columns,
@@ -576,7 +863,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                     stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   for (size_t i = 0; i < num_stripes; ++i) {
     for (size_t j = 0; j < num_columns; ++j) {
@@ -586,11 +873,12 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &path,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr) {
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  _metadata = std::make_unique<metadata>(_source.get(), path);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, _has_timestamp_column);
@@ -607,6 +895,12 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float     = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
+
+  // Predicates used to skip stripes
+  _filters = options.filters;
+
+  // Return strings as dictionaries, using the stripe dictionaries as keys if possible
+  _strings_to_dictionary = options.strings_to_dictionary;
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -618,9 +912,28 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
 
+  // With filters, a row range applies to the rows of the stripes that pass them, so all the
+  // stripes are selected and filtered before the range is applied
+  const bool filter_by_rows = !_filters.empty() && stripe == -1 && !stripe_indices;
+  size_type selected_start  = filter_by_rows ? 0 : skip_rows;
+  size_type selected_count  = filter_by_rows ? -1 : num_rows;
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+  auto selected_stripes = _metadata->select_stripes(
+    stripe, max_stripe_count, stripe_indices, selected_start, selected_count);
+
+  if (_filters.empty()) {
+    skip_rows = selected_start;
+    num_rows  = selected_count;
+  } else {
+    // Skip stripes that cannot contain rows matching the filters
+    _metadata->filter_stripes(selected_stripes, _filters, _use_index);
+    if (!filter_by_rows) {
+      skip_rows = 0;
+      num_rows  = -1;
+    }
+    _metadata->trim_stripes(selected_stripes, skip_rows, num_rows);
+  }
 
   // Association between each ORC column and its gdf_column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
@@ -631,7 +944,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     auto col_type = to_type_id(
       _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-    column_types.emplace_back(col_type);
+    if (_strings_to_dictionary && col_type == type_id::STRING) { col_type = type_id::DICTIONARY32; }
+    if (col_type == type_id::DECIMAL64) {
+      // The decoded integers are the decimals scaled by 10^decimal_scale
+      auto const decimal_scale =
+        (_decimals_as_int_scale < 0) ? _metadata->ff.types[col].scale : _decimals_as_int_scale;
+      column_types.emplace_back(col_type, -static_cast<int32_t>(decimal_scale));
+    } else {
+      column_types.emplace_back(col_type);
+    }
 
     // Map each ORC column to its column
     orc_col_map[col] = column_types.size() - 1;
@@ -642,7 +963,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     std::transform(column_types.cbegin(),
                    column_types.cend(),
                    std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
+                   [](auto const &dtype) {
+                     if (dtype.id() == type_id::DICTIONARY32) {
+                       return make_dictionary_column(make_empty_column(data_type{STRING}),
+                                                     make_empty_column(data_type{INT32}),
+                                                     rmm::device_buffer{},
+                                                     0);
+                     }
+                     return make_empty_column(dtype);
+                   });
   } else {
     const auto num_columns = _selected_columns.size();
     const auto num_chunks  = selected_stripes.size() * num_columns;
@@ -662,9 +991,17 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Logically view streams as columns
     std::vector<orc_stream_info> stream_info;
 
+    // Stream that the stripes are decompressed on, outliving the decompressed data
+    decompression_stream decomp;
+
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Streams of each stripe, and their coalesced reads
+    std::vector<std::pair<size_t, size_t>> stripe_streams;
+    std::vector<std::vector<std::pair<size_t, size_t>>> stripe_ranges;
+    std::vector<std::vector<uint8_t *>> stripe_dsts;
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -684,11 +1021,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                       chunks,
                                                       stream_info);
       CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+      stripe_streams.emplace_back(stream_count, stream_info.size() - stream_count);
 
       stripe_data.emplace_back(total_data_size, stream);
       auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
 
       // Coalesce consecutive streams into one read
+      std::vector<std::pair<size_t, size_t>> ranges;
+      std::vector<uint8_t *> dsts;
       while (stream_count < stream_info.size()) {
         const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
         const auto offset = stream_info[stream_count].offset;
@@ -700,10 +1040,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        const auto buffer = _source->get_buffer(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+        ranges.emplace_back(offset, len);
+        dsts.push_back(d_dst);
       }
+      stripe_ranges.push_back(std::move(ranges));
+      stripe_dsts.push_back(std::move(dsts));
 
       // Update chunks to reference streams pointers
       for (size_t j = 0; j < num_columns; j++) {
@@ -721,7 +1062,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           chunk.decimal_scale = _decimals_as_int_scale;
         }
         chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+        chunk.dtype_len   = (column_types[j].id() == type_id::STRING ||
+                           column_types[j].id() == type_id::DICTIONARY32)
                             ? sizeof(std::pair<const char *, size_t>)
                             : cudf::size_of(column_types[j]);
         if (chunk.type_kind == orc::TIMESTAMP) {
@@ -740,37 +1082,84 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       }
     }
 
+    // Dictionary columns are decoded as indices into the stripe dictionaries if
+    // all their stripes are dictionary-encoded, and as strings otherwise
+    std::vector<data_type> buffer_types(column_types);
+    std::vector<size_type> num_keys(num_columns, 0);
+    for (size_t j = 0; j < num_columns; j++) {
+      if (buffer_types[j].id() != type_id::DICTIONARY32) { continue; }
+      for (size_t i = 0; i < selected_stripes.size(); ++i) {
+        auto const encoding = chunks[i * num_columns + j].encoding_kind;
+        if (encoding != orc::DICTIONARY && encoding != orc::DICTIONARY_V2) {
+          buffer_types[j] = data_type{type_id::STRING};
+          break;
+        }
+      }
+      if (buffer_types[j].id() != type_id::DICTIONARY32) { continue; }
+      for (size_t i = 0; i < selected_stripes.size(); ++i) {
+        auto &chunk           = chunks[i * num_columns + j];
+        chunk.dict_key_offset = num_keys[j];
+        chunk.dtype_len       = sizeof(int32_t);
+        num_keys[j] += chunk.dict_len;
+      }
+    }
+
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
+      // Each stripe is decompressed on a separate stream once its data is on the device, while
+      // the data of the next stripe is read from the source
+      const bool is_compressed = (_metadata->ps.compression != orc::NONE);
+      hostdevice_vector<gpu::CompressedStreamInfo> compinfo(
+        is_compressed ? stream_info.size() : 0, stream);
+      std::vector<rmm::device_buffer> decomp_data(is_compressed ? stripe_data.size() : 0);
+      {
+        // Overlaps reading the stream data from the source with the device copies
+        pipelined_reader stripe_reader(_source.get(), stream);
+        std::future<void> decompression;
+        int device = 0;
+        CUDA_TRY(cudaGetDevice(&device));
+        for (size_t i = 0; i < stripe_data.size(); ++i) {
+          // Request all the streams of the stripe at once
+          stripe_reader.read(stripe_ranges[i], stripe_dsts[i]);
+          if (!is_compressed) { continue; }
+          if (decompression.valid()) { decompression.get(); }
+          decomp.wait(stream, decomp.stream);
+          decompression = std::async(std::launch::async, [&, i]() {
+            CUDA_TRY(cudaSetDevice(device));
+            decomp_data[i] = decompress_stripe_data(chunks,
+                                                    stripe_data[i],
+                                                    _metadata->decompressor.get(),
+                                                    stream_info,
+                                                    compinfo,
+                                                    i,
+                                                    stripe_streams[i].first,
+                                                    stripe_streams[i].second,
+                                                    num_columns,
+                                                    decomp.stream);
+            // The compressed data is no longer needed
+            stripe_data[i] = rmm::device_buffer{};
+          });
+        }
+        if (decompression.valid()) { decompression.get(); }
+      }
+      if (is_compressed) { decomp.wait(decomp.stream, stream); }
+
       // Setup row group descriptors if using indexes
       rmm::device_vector<gpu::RowGroup> row_groups(num_rowgroups * num_columns);
-      if (_metadata->ps.compression != orc::NONE) {
-        auto decomp_data = decompress_stripe_data(chunks,
-                                                  stripe_data,
-                                                  _metadata->decompressor.get(),
-                                                  stream_info,
-                                                  selected_stripes.size(),
-                                                  row_groups,
-                                                  _metadata->get_row_index_stride(),
-                                                  stream);
-        stripe_data.clear();
-        stripe_data.push_back(std::move(decomp_data));
-      } else {
-        if (not row_groups.empty()) {
-          CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
-                                   chunks.host_ptr(),
-                                   chunks.memory_size(),
-                                   cudaMemcpyHostToDevice,
-                                   stream));
-          CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
-                                           nullptr,
-                                           chunks.device_ptr(),
-                                           num_columns,
-                                           selected_stripes.size(),
-                                           num_rowgroups,
-                                           _metadata->get_row_index_stride(),
-                                           stream));
-        }
+      if (not row_groups.empty()) {
+        CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                                 chunks.host_ptr(),
+                                 chunks.memory_size(),
+                                 cudaMemcpyHostToDevice,
+                                 stream));
+        CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
+                                         is_compressed ? compinfo.device_ptr() : nullptr,
+                                         chunks.device_ptr(),
+                                         num_columns,
+                                         selected_stripes.size(),
+                                         num_rowgroups,
+                                         _metadata->get_row_index_stride(),
+                                         stream));
       }
 
       // Setup table for converting timestamp columns from local to UTC time
@@ -790,7 +1179,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             break;
           }
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        out_buffers.emplace_back(buffer_types[i], num_rows, is_nullable, stream, _mr);
+        out_buffers.back()._keys.resize(num_keys[i]);
       }
 
       decode_stream_data(chunks,
@@ -804,8 +1194,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        auto out_column = make_column(buffer_types[i], num_rows, out_buffers[i], stream, _mr);
+        if (column_types[i].id() != buffer_types[i].id()) {
+          out_column = dictionary::encode(out_column->view(), data_type{type_id::INT32}, _mr);
+        }
+        out_columns.emplace_back(std::move(out_column));
       }
     }
   }
@@ -827,20 +1220,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr)) {}
+  : _impl(std::make_unique<impl>(datasource::create(filepath), filepath, options, mr)) {}
 
 // Forward to implementation
 reader::reader(const char *buffer,
                size_t length,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(buffer, length), options, mr)) {}
+  : _impl(std::make_unique<impl>(datasource::create(buffer, length), "", options, mr)) {}
 
 // Forward to implementation
 reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(file), options, mr)) {}
+  : _impl(std::make_unique<impl>(datasource::create(file), "", options, mr)) {}
 
 // Destructor within this translation unit
 reader::~reader() = default;
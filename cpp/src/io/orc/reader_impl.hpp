@@ -59,12 +59,14 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param path Path of the source file; empty if the source is not a file
    * @param options Settings for controlling reading behavior
    * @param mr Resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
-                reader_options const &options,
-                rmm::mr::device_memory_resource *mr);
+  impl(std::unique_ptr<datasource> source,
+       std::string const &path,
+       reader_options const &options,
+       rmm::mr::device_memory_resource *mr);
 
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
@@ -87,27 +89,35 @@ class reader::impl {
 
  private:
   /**
-   * @brief Decompresses the stripe data, at stream granularity
+   * @brief Decompresses the data of a stripe, at stream granularity
+   *
+   * Only the streams and column chunks of the stripe are accessed, so the
+   * stripes can be decompressed concurrently.
    *
    * @param chunks List of column chunk descriptors
-   * @param stripe_data List of source stripe column data
+   * @param stripe_data Source column data of the stripe
    * @param decompressor Originally host decompressor
    * @param stream_info List of stream to column mappings
-   * @param num_stripes Number of stripes making up column chunks
-   * @param row_groups List of row index descriptors
-   * @param row_index_stride Distance between each row index
+   * @param compinfo Compressed info of every stream, set for the streams of the stripe
+   * @param stripe_idx Index of the stripe in the selected stripes
+   * @param first_stream Index of the first stream of the stripe
+   * @param num_streams Number of streams of the stripe
+   * @param num_columns Number of columns making up the column chunks of each stripe
    * @param stream Stream to use for memory allocation and kernels
    *
-   * @return Device buffer to decompressed page data
+   * @return Device buffer to decompressed stripe data
    */
-  rmm::device_buffer decompress_stripe_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
-                                            const std::vector<rmm::device_buffer> &stripe_data,
-                                            const OrcDecompressor *decompressor,
-                                            std::vector<orc_stream_info> &stream_info,
-                                            size_t num_stripes,
-                                            rmm::device_vector<gpu::RowGroup> &row_groups,
-                                            size_t row_index_stride,
-                                            cudaStream_t stream);
+  rmm::device_buffer decompress_stripe_data(
+    hostdevice_vector<gpu::ColumnDesc> &chunks,
+    const rmm::device_buffer &stripe_data,
+    const OrcDecompressor *decompressor,
+    std::vector<orc_stream_info> &stream_info,
+    hostdevice_vector<gpu::CompressedStreamInfo> &compinfo,
+    size_t stripe_idx,
+    size_t first_stream,
+    size_t num_streams,
+    size_t num_columns,
+    cudaStream_t stream);
 
   /**
    * @brief Converts the stripe column data and outputs to columns
@@ -143,7 +153,9 @@ class reader::impl {
   bool _has_timestamp_column = false;
   bool _decimals_as_float    = true;
   int _decimals_as_int_scale = -1;
+  bool _strings_to_dictionary = false;
   data_type _timestamp_type{type_id::EMPTY};
+  std::vector<column_predicate> _filters;
 };
 
 }  // namespace orc
@@ -1716,6 +1716,14 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
             case BINARY:
             case VARCHAR:
             case CHAR: {
+              if (s->chunk.dtype_len == 4) {
+                // Output the index of the entry in the keys of the dictionary column
+                // (entries past the local dictionary are corrupted and output the first key)
+                uint32_t dict_idx = s->vals.u32[t + vals_skipped];
+                reinterpret_cast<uint32_t *>(data_out)[row] =
+                  (dict_idx < s->chunk.dict_len) ? s->chunk.dict_key_offset + dict_idx : 0;
+                break;
+              }
               nvstrdesc_s *strdesc = &reinterpret_cast<nvstrdesc_s *>(data_out)[row];
               const uint8_t *ptr;
               uint32_t count;
@@ -1249,6 +1249,7 @@ cudaError_t CompactOrcDataStreams(StripeStream *strm_desc,
  * @param[in] num_compressed_blocks Total number of compressed blocks
  * @param[in] compression Type of compression
  * @param[in] comp_blk_size Compression block size
+ * @param[in] comp_level Compression level
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1262,12 +1263,19 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
                                    uint32_t num_compressed_blocks,
                                    CompressionKind compression,
                                    uint32_t comp_blk_size,
+                                   int comp_level,
                                    cudaStream_t stream) {
   dim3 dim_block_init(256, 1);
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  if (compression == SNAPPY) {
+    gpu_snap(comp_in, comp_out, num_compressed_blocks, comp_level, stream);
+  } else if (compression == LZ4) {
+    gpu_lz4(comp_in, comp_out, num_compressed_blocks, 0, stream);
+  } else if (compression == ZLIB) {
+    gpu_deflate(comp_in, comp_out, num_compressed_blocks, stream);
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
@@ -21,11 +21,15 @@
 
 #include "writer_impl.hpp"
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <future>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -42,12 +46,6 @@ using namespace cudf::io;
 
 namespace {
 
-/**
- * @brief Helper for pinned host memory
- **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  **/
@@ -55,6 +53,9 @@ orc::CompressionKind to_orc_compression(compression_type compression) {
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
+    case compression_type::GZIP:
+    case compression_type::ZIP: return orc::CompressionKind::ZLIB;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -161,7 +162,7 @@ class orc_column_view {
         _nulls,
         _data_count);
       _data = _indexes.data();
-      CUDA_TRY(cudaStreamSynchronize(stream));
+      CUDF_STREAM_SYNC(stream);
     }
     // Generating default name if name isn't present in metadata
     if (metadata && _id < metadata->column_names.size()) {
@@ -279,7 +280,7 @@ void writer::impl::init_dictionaries(orc_column_view *columns,
     gpu::InitDictionaryIndices(dict.device_ptr(), str_col_ids.size(), num_rowgroups, stream));
   CUDA_TRY(cudaMemcpyAsync(
     dict.host_ptr(), dict.device_ptr(), dict.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 void writer::impl::build_dictionaries(orc_column_view *columns,
@@ -343,7 +344,7 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
                            stripe_dict.memory_size(),
                            cudaMemcpyDeviceToHost,
                            stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
@@ -630,7 +631,7 @@ rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
                                            stream));
   }
   CUDA_TRY(gpu::EncodeOrcColumnData(chunks.device_ptr(), num_columns, num_rowgroups, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   return output;
 }
@@ -687,7 +688,7 @@ std::vector<StripeInformation> writer::impl::gather_stripes(
                            stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   return stripes;
 }
@@ -704,8 +705,8 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
   size_t num_stat_blobs = (1 + stripe_list.size()) * num_columns;
   size_t num_chunks     = chunks.size();
   std::vector<std::vector<uint8_t>> stat_blobs(num_stat_blobs);
-  hostdevice_vector<stats_column_desc> stat_desc(num_columns);
-  hostdevice_vector<statistics_merge_group> stat_merge(num_stat_blobs);
+  hostdevice_vector<stats_column_desc> stat_desc(num_columns, stream);
+  hostdevice_vector<statistics_merge_group> stat_merge(num_stat_blobs, stream);
   rmm::device_vector<statistics_chunk> stat_chunks(num_chunks + num_stat_blobs);
   rmm::device_vector<statistics_group> stat_groups(num_chunks);
 
@@ -787,10 +788,10 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
                            stat_merge.memory_size(),
                            cudaMemcpyDeviceToHost,
                            stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
-  hostdevice_vector<uint8_t> blobs(stat_merge[num_stat_blobs - 1].start_chunk +
-                                   stat_merge[num_stat_blobs - 1].num_chunks);
+  hostdevice_vector<uint8_t> blobs(
+    stat_merge[num_stat_blobs - 1].start_chunk + stat_merge[num_stat_blobs - 1].num_chunks, stream);
   CUDA_TRY(gpu::orc_encode_statistics(blobs.device_ptr(),
                                       stat_merge.device_ptr(),
                                       stat_chunks.data().get() + num_chunks,
@@ -803,7 +804,7 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
                            stream));
   CUDA_TRY(cudaMemcpyAsync(
     blobs.host_ptr(), blobs.device_ptr(), blobs.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   for (size_t i = 0; i < num_stat_blobs; i++) {
     const uint8_t *stat_begin = blobs.host_ptr(stat_merge[i].start_chunk);
@@ -912,10 +913,13 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
   if (length != 0) {
     const auto *stream_in = (compression_kind_ == NONE) ? chunk.streams[strm_desc.strm_type]
                                                         : (compressed_data + strm_desc.bfr_offset);
-    CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    out_sink_->host_write(stream_out, length);
+    if (out_sink_->supports_device_write()) {
+      // let the sink do what it wants to retrieve the data from the gpu
+      out_sink_->device_write(stream_in, length, stream);
+    } else {
+      // Written to the sink together with the rest of the stripe's data
+      CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
+    }
   }
   stripe.dataLength += length;
 }
@@ -942,10 +946,21 @@ void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v) {
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : compression_kind_(to_orc_compression(options.compression)),
+  : _mr(mr),
+    max_stripe_size_(options.stripe_size_bytes),
+    max_stripe_rows_(options.stripe_size_rows),
+    row_index_stride_(options.row_index_stride),
+    compression_kind_(to_orc_compression(options.compression)),
+    compression_level_(options.compression_level),
     enable_statistics_(options.enable_statistics),
-    out_sink_(std::move(sink)),
-    _mr(mr) {}
+    out_sink_(std::move(sink)) {
+  CUDF_EXPECTS(max_stripe_size_ > 0, "Invalid stripe size");
+  // Row groups must start on a byte boundary of the column validity masks
+  CUDF_EXPECTS(row_index_stride_ > 0 && row_index_stride_ % 8 == 0,
+               "Row index stride must be a positive multiple of 8");
+  CUDF_EXPECTS(max_stripe_rows_ == 0 || max_stripe_rows_ >= row_index_stride_,
+               "Stripe size in rows cannot be smaller than the row index stride");
+}
 
 void writer::impl::write(table_view const &table,
                          const table_metadata *metadata,
@@ -998,7 +1013,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   // Build per-column dictionary indices
   const auto num_rowgroups   = div_by_rowgroups<size_t>(num_rows);
   const auto num_dict_chunks = num_rowgroups * str_col_ids.size();
-  hostdevice_vector<gpu::DictionaryChunk> dict(num_dict_chunks);
+  hostdevice_vector<gpu::DictionaryChunk> dict(num_dict_chunks, state.stream);
   if (str_col_ids.size() != 0) {
     init_dictionaries(orc_columns.data(),
                       num_rows,
@@ -1024,7 +1039,9 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
     }
 
     // Apply rows per stripe limit to limit string dictionaries
-    const size_t max_stripe_rows = !str_col_ids.empty() ? 1000000 : 5000000;
+    const size_t max_stripe_rows = (max_stripe_rows_ != 0)
+                                     ? max_stripe_rows_
+                                     : !str_col_ids.empty() ? 1000000 : 5000000;
     if ((g > stripe_start) && (stripe_size + rowgroup_size > max_stripe_size_ ||
                                (g + 1 - stripe_start) * row_index_stride_ > max_stripe_rows)) {
       stripe_list.push_back(g - stripe_start);
@@ -1037,7 +1054,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
 
   // Build stripe-level dictionaries
   const auto num_stripe_dict = stripe_list.size() * str_col_ids.size();
-  hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict);
+  hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict, state.stream);
   if (str_col_ids.size() != 0) {
     build_dictionaries(orc_columns.data(),
                        num_rows,
@@ -1056,7 +1073,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
 
   // Encode column data chunks
   const auto num_chunks = num_rowgroups * num_columns;
-  hostdevice_vector<gpu::EncChunk> chunks(num_chunks);
+  hostdevice_vector<gpu::EncChunk> chunks(num_chunks, state.stream);
   auto output = encode_columns(orc_columns.data(),
                                num_columns,
                                num_rows,
@@ -1072,7 +1089,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   const auto num_index_streams  = (num_columns + 1);
   const auto num_data_streams   = streams.size() - num_index_streams;
   const auto num_stripe_streams = stripe_list.size() * num_data_streams;
-  hostdevice_vector<gpu::StripeStream> strm_desc(num_stripe_streams);
+  hostdevice_vector<gpu::StripeStream> strm_desc(num_stripe_streams, state.stream);
   auto stripes = gather_stripes(num_columns,
                                 num_rows,
                                 num_index_streams,
@@ -1098,39 +1115,43 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   // Allocate intermediate output stream buffer
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
-    size_t max_stream_size = 0;
-
-    for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
-      for (size_t i = 0; i < num_data_streams; i++) {
-        gpu::StripeStream *ss = &strm_desc[stripe_id * num_data_streams + i];
-        size_t stream_size    = ss->stream_size;
-        if (compression_kind_ != NONE) {
-          ss->first_block = num_compressed_blocks;
-          ss->bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * 3;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += stream_size;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
+  size_t max_stripe_data_size  = 0;
+  for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
+    size_t stripe_data_size = 0;
+    for (size_t i = 0; i < num_data_streams; i++) {
+      gpu::StripeStream *ss = &strm_desc[stripe_id * num_data_streams + i];
+      size_t stream_size    = ss->stream_size;
+      if (compression_kind_ != NONE) {
+        ss->first_block = num_compressed_blocks;
+        ss->bfr_offset  = compressed_bfr_size;
+
+        auto num_blocks = std::max<uint32_t>(
+          (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+        stream_size += num_blocks * 3;
+        num_compressed_blocks += num_blocks;
+        compressed_bfr_size += stream_size;
       }
+      stripe_data_size += stream_size;
     }
+    max_stripe_data_size = std::max(max_stripe_data_size, stripe_data_size);
+  }
 
-    return pinned_buffer<uint8_t>{[](size_t size) {
-                                    uint8_t *ptr = nullptr;
-                                    CUDA_TRY(cudaMallocHost(&ptr, size));
-                                    return ptr;
-                                  }(max_stream_size),
-                                  cudaFreeHost};
-  }();
+  // The data of one stripe is written to the sink on a separate thread while
+  // the data of the next stripe is copied from the device, unless the sink
+  // reads device memory and we don't need this scratch space
+  auto alloc_staging = [&]() {
+    if (out_sink_->supports_device_write()) { return pinned_buffer<uint8_t>{}; }
+    return make_pinned_buffer<uint8_t>(std::max<size_t>(max_stripe_data_size, 1), state.stream);
+  };
+  std::array<pinned_buffer<uint8_t>, 2> staging{
+    alloc_staging(), stripe_list.size() > 1 ? alloc_staging() : pinned_buffer<uint8_t>{}};
+  std::future<void> pending_write;
+  int slot = 0;
 
   // Compress the data streams
   rmm::device_buffer compressed_data(compressed_bfr_size, state.stream);
-  hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks);
-  hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks);
+  hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks, state.stream);
+  hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks, state.stream);
   if (compression_kind_ != NONE) {
     CUDA_TRY(cudaMemcpyAsync(strm_desc.device_ptr(),
                              strm_desc.host_ptr(),
@@ -1146,6 +1167,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                                          num_compressed_blocks,
                                          compression_kind_,
                                          compression_blocksize_,
+                                         compression_level_,
                                          state.stream));
     CUDA_TRY(cudaMemcpyAsync(strm_desc.host_ptr(),
                              strm_desc.device_ptr(),
@@ -1157,15 +1179,41 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                              comp_out.memory_size(),
                              cudaMemcpyDeviceToHost,
                              state.stream));
-    CUDA_TRY(cudaStreamSynchronize(state.stream));
+    CUDF_STREAM_SYNC(state.stream);
   }
 
   ProtobufWriter pbw_(&buffer_);
 
   // Write stripes
-  size_t group = 0;
+  const bool host_staging = !out_sink_->supports_device_write();
+  size_t group            = 0;
   for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
-    auto groups_in_stripe     = div_by_rowgroups(stripes[stripe_id].numberOfRows);
+    auto groups_in_stripe = div_by_rowgroups(stripes[stripe_id].numberOfRows);
+
+    // Column data consisting one or more separate streams
+    auto write_data_streams = [&]() {
+      stripes[stripe_id].dataLength = 0;
+      for (size_t i = 0; i < num_data_streams; i++) {
+        const auto &ss = strm_desc[stripe_id * num_data_streams + i];
+        const auto &ck = chunks[group * num_columns + ss.column_id];
+
+        write_data_stream(ss,
+                          ck,
+                          static_cast<uint8_t *>(compressed_data.data()),
+                          host_staging ? staging[slot].get() + stripes[stripe_id].dataLength
+                                       : nullptr,
+                          stripes[stripe_id],
+                          streams,
+                          state.stream);
+      }
+    };
+    if (host_staging) {
+      // Copy while the previous stripe is being written, then wait for it to
+      // complete, as writes to the sink must remain in order
+      write_data_streams();
+      CUDF_STREAM_SYNC(state.stream);
+      if (pending_write.valid()) { pending_write.get(); }
+    }
     stripes[stripe_id].offset = out_sink_->bytes_written();
 
     // Column (skippable) index streams appear at the start of the stripe
@@ -1186,20 +1234,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                          &pbw_);
     }
 
-    // Column data consisting one or more separate streams
-    stripes[stripe_id].dataLength = 0;
-    for (size_t i = 0; i < num_data_streams; i++) {
-      const auto &ss = strm_desc[stripe_id * num_data_streams + i];
-      const auto &ck = chunks[group * num_columns + ss.column_id];
-
-      write_data_stream(ss,
-                        ck,
-                        static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
-                        stripes[stripe_id],
-                        streams,
-                        state.stream);
-    }
+    if (!host_staging) { write_data_streams(); }
 
     // Write stripefooter consisting of stream information
     StripeFooter sf;
@@ -1223,10 +1258,21 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
       buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
     }
-    out_sink_->host_write(buffer_.data(), buffer_.size());
+    if (host_staging) {
+      auto const data = staging[slot].get();
+      auto const size = stripes[stripe_id].dataLength;
+      pending_write   = std::async(std::launch::async, [this, data, size, footer = buffer_]() {
+        out_sink_->host_write(data, size);
+        out_sink_->host_write(footer.data(), footer.size());
+      });
+      slot ^= 1;
+    } else {
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+    }
 
     group += groups_in_stripe;
   }
+  if (pending_write.valid()) { pending_write.get(); }
 
   if (column_stats.size() != 0) {
     // File-level statistics
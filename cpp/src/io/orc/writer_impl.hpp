@@ -57,12 +57,6 @@ class writer::impl {
   // ORC datasets start with a 3 byte header
   static constexpr const char* MAGIC = "ORC";
 
-  // ORC datasets are divided into fixed-size, independent stripes
-  static constexpr uint32_t DEFAULT_STRIPE_SIZE = 64 * 1024 * 1024;
-
-  // ORC rows are divided into groups and assigned indexes for faster seeking
-  static constexpr uint32_t DEFAULT_ROW_INDEX_STRIDE = 10000;
-
   // ORC compresses streams into independent chunks
   static constexpr uint32_t DEFAULT_COMPRESSION_BLOCKSIZE = 256 * 1024;
 
@@ -277,10 +271,13 @@ class writer::impl {
   /**
    * @brief Write the specified column's data streams
    *
+   * Unless the sink supports device writes, the data is only copied to
+   * `stream_out` and the caller writes it to the sink once the copy completes.
+   *
    * @param strm_desc Stream's descriptor
    * @param chunk First column chunk of the stream
    * @param compressed_data Compressed stream data
-   * @param stream_out Temporary host output buffer
+   * @param stream_out Host output buffer for the stream's data
    * @param stripe Stream's parent stripe
    * @param streams List of all streams
    * @param stream Stream to use for memory allocation and kernels
@@ -325,10 +322,12 @@ class writer::impl {
  private:
   rmm::mr::device_memory_resource* _mr = nullptr;
 
-  size_t max_stripe_size_           = DEFAULT_STRIPE_SIZE;
-  size_t row_index_stride_          = DEFAULT_ROW_INDEX_STRIDE;
+  size_t max_stripe_size_           = 0;
+  size_t max_stripe_rows_           = 0;
+  size_t row_index_stride_          = 0;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
+  int compression_level_            = 0;
 
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @file bloom_filter.h
+ * @brief Parquet split block Bloom filter helpers, shared by the GPU writer
+ * and the host-side reader
+ *
+ * A filter consists of 256-bit blocks of eight 32-bit words. Each value is
+ * hashed with xxHash64 (seed 0) over its plain encoding (without the length
+ * prefix for byte arrays); the upper 32 bits of the hash select the block and
+ * the lower 32 bits set one bit in each of the block's words.
+ */
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+constexpr uint32_t BLOOM_FILTER_BLOCK_WORDS = 8;
+constexpr uint32_t BLOOM_FILTER_BLOCK_BYTES = BLOOM_FILTER_BLOCK_WORDS * sizeof(uint32_t);
+constexpr uint32_t BLOOM_FILTER_MIN_BYTES   = BLOOM_FILTER_BLOCK_BYTES;
+constexpr uint32_t BLOOM_FILTER_MAX_BYTES   = 128 * 1024 * 1024;
+
+/**
+ * @brief Returns the salt used to set the bit of the `i`-th word of a block
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_salt(int i) {
+  constexpr uint32_t salt[BLOOM_FILTER_BLOCK_WORDS] = {0x47b6137bu,
+                                                       0x44974d91u,
+                                                       0x8824ad5bu,
+                                                       0xa2b7289du,
+                                                       0x705495c7u,
+                                                       0x2df1424bu,
+                                                       0x9efc4947u,
+                                                       0x5c6bfb31u};
+  return salt[i];
+}
+
+/**
+ * @brief Returns the index of the block a hash maps to
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_block(uint64_t hash, uint32_t num_blocks) {
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit mask of the `i`-th word of a block for a hash
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_mask(uint64_t hash, int i) {
+  return 1u << ((static_cast<uint32_t>(hash) * bloom_filter_salt(i)) >> 27);
+}
+
+/**
+ * @brief Returns whether the filter may contain a value with the given hash
+ *
+ * @param bitset Filter blocks
+ * @param num_blocks Number of blocks in the filter
+ * @param hash xxHash64 of the value
+ **/
+inline bool bloom_filter_may_contain(uint32_t const *bitset, uint32_t num_blocks, uint64_t hash) {
+  uint32_t const *block = bitset + bloom_filter_block(hash, num_blocks) * BLOOM_FILTER_BLOCK_WORDS;
+  for (int i = 0; i < static_cast<int>(BLOOM_FILTER_BLOCK_WORDS); i++) {
+    if (!(block[i] & bloom_filter_mask(hash, i))) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Computes the xxHash64 (seed 0) of a byte sequence
+ *
+ * The data is read bytewise, so it need not be aligned.
+ **/
+CUDA_HOST_DEVICE_CALLABLE uint64_t xxhash64(uint8_t const *data, size_t len) {
+  return XXHash_64<uint8_t>{}.compute_bytes(data, len);
+}
+
+/**
+ * @brief Computes the xxHash64 of the little-endian encoding of a 32 or 64-bit value
+ **/
+template <typename T>
+CUDA_HOST_DEVICE_CALLABLE uint64_t xxhash64_value(T value) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported value size");
+  uint8_t bytes[sizeof(T)];
+  uint64_t v = 0;
+  memcpy(&v, &value, sizeof(T));
+  for (size_t i = 0; i < sizeof(T); i++) { bytes[i] = static_cast<uint8_t>(v >> (i * 8)); }
+  return xxhash64(bytes, sizeof(T));
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -41,6 +41,10 @@ struct pq_chunked_state {
   cudf::io::parquet::FileMetaData md;
   /// current write position for rowgroups/chunks
   size_t current_chunk_offset;
+  /// page indexes of the column chunks in md.row_groups order, written during write_chunked_end().
+  /// column indexes are left empty for the chunks without page-level min/max statistics
+  std::vector<cudf::io::parquet::ColumnIndex> column_indexes;
+  std::vector<cudf::io::parquet::OffsetIndex> offset_indexes;
   /// optional user metadata
   table_metadata const* user_metadata = nullptr;
   /// only used in the write_chunked() case. copied from the (optionally) user supplied
@@ -59,6 +59,15 @@ struct page_state_s {
   int32_t dict_pos;     // write position of dictionary indices
   int32_t out_pos;      // read position of final output
   int32_t ts_scale;     // timestamp scale: <0: divide by -ts_scale, >0: multiply by ts_scale
+  const uint8_t *delta_cur;     // DELTA_BINARY_PACKED: current miniblock data
+  const uint8_t *delta_widths;  // DELTA_BINARY_PACKED: miniblock bit widths of the current block
+  int64_t delta_min;            // DELTA_BINARY_PACKED: min delta of the current block
+  int64_t delta_last;           // DELTA_BINARY_PACKED: last decoded value
+  int32_t delta_count;          // DELTA_BINARY_PACKED: number of values left to decode
+  uint32_t delta_num_mbs;       // DELTA_BINARY_PACKED: number of miniblocks per block
+  uint32_t delta_mb_size;       // DELTA_BINARY_PACKED: number of values per miniblock
+  uint32_t delta_mb_idx;        // DELTA_BINARY_PACKED: current miniblock in block
+  uint32_t delta_mb_pos;        // DELTA_BINARY_PACKED: position in current miniblock
   uint32_t nz_idx[NZ_BFRSZ];    // circular buffer of non-null row positions
   uint32_t dict_idx[NZ_BFRSZ];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[NZ_BFRSZ];   // String length for plain encoding of strings
@@ -144,6 +153,89 @@ inline __device__ uint32_t get_vlq32(const uint8_t *&cur, const uint8_t *end) {
   return v;
 }
 
+/**
+ * @brief Read a 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ **/
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end) {
+  uint64_t v = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    uint32_t c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Read a zigzag-encoded 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit signed value read
+ **/
+inline __device__ int64_t get_zigzag64(const uint8_t *&cur, const uint8_t *end) {
+  uint64_t v = get_vlq64(cur, end);
+  return static_cast<int64_t>((v >> 1) ^ (~(v & 1) + 1));
+}
+
+/**
+ * @brief Parse the header of a DELTA_BINARY_PACKED section
+ *
+ * @param[in,out] s The page state
+ * @param[in] cur The current data position
+ * @param[in] end The end of the data
+ *
+ * @return The length of the header
+ **/
+__device__ uint32_t InitDeltaSection(page_state_s *s, const uint8_t *cur, const uint8_t *end) {
+  const uint8_t *start = cur;
+  uint32_t block_size  = static_cast<uint32_t>(get_vlq64(cur, end));
+  uint32_t num_mbs    = static_cast<uint32_t>(get_vlq64(cur, end));
+  s->delta_count      = static_cast<int32_t>(get_vlq64(cur, end));
+  s->delta_last       = get_zigzag64(cur, end);
+  s->delta_num_mbs    = num_mbs;
+  s->delta_mb_size    = (num_mbs != 0) ? block_size / num_mbs : 0;
+  s->delta_mb_idx     = num_mbs;  // Next read starts a new block
+  s->delta_mb_pos     = 0;
+  s->delta_widths     = cur;
+  s->delta_cur        = cur;
+  // Miniblocks are decoded 32 values at a time
+  if (s->delta_mb_size == 0 || (s->delta_mb_size & 0x1f) != 0 || s->delta_count < 0) {
+    s->error = 4;
+  }
+  return static_cast<uint32_t>(cur - start);
+}
+
+/**
+ * @brief Find the end of a DELTA_BINARY_PACKED section from its block headers
+ *
+ * @param[in] s The page state, after InitDeltaSection
+ * @param[in] end The end of the data
+ *
+ * @return The length of the section data following the header
+ **/
+__device__ uint32_t SkipDeltaSection(const page_state_s *s, const uint8_t *end) {
+  const uint8_t *cur = s->delta_cur;
+  int32_t remaining  = s->delta_count - 1;  // The first value is stored in the header
+  while (remaining > 0 && cur < end) {
+    const uint8_t *widths;
+    get_zigzag64(cur, end);  // min delta
+    widths = cur;
+    cur += s->delta_num_mbs;
+    for (uint32_t i = 0; i < s->delta_num_mbs && remaining > 0; i++) {
+      cur += (s->delta_mb_size * ((widths + i < end) ? widths[i] : 0)) >> 3;
+      remaining -= s->delta_mb_size;
+    }
+  }
+  return static_cast<uint32_t>(cur - s->delta_cur);
+}
+
 /**
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
@@ -428,6 +520,126 @@ __device__ int gpuDecodeDictionaryIndices(volatile page_state_s *s, int target_p
   return pos;
 }
 
+/**
+ * @brief Decodes DELTA_BINARY_PACKED values, one miniblock of 32 values at a time
+ *
+ * The 64-bit values are stored in dict_idx (lower 32 bits) and str_len (upper 32 bits).
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target write position
+ * @param[in] t Warp1 thread ID (0..31)
+ *
+ * @return The new output position
+ **/
+__device__ int gpuDecodeDeltaBinaryPacked(volatile page_state_s *s, int target_pos, int t) {
+  const uint8_t *end    = s->data_end;
+  const uint8_t *cur    = s->delta_cur;
+  const uint8_t *widths = s->delta_widths;
+  int64_t min_delta     = s->delta_min;
+  int64_t last          = s->delta_last;
+  int32_t count         = s->delta_count;
+  uint32_t num_mbs      = s->delta_num_mbs;
+  uint32_t mb_size      = s->delta_mb_size;
+  uint32_t mb_idx       = s->delta_mb_idx;
+  uint32_t mb_pos       = s->delta_mb_pos;
+  int pos               = s->dict_pos;
+
+  // Every lane walks the block headers, keeping identical copies of the decoder state
+  while (pos < target_pos && count > 0) {
+    int batch_len;
+    uint64_t v = 0;
+    if (pos == 0) {
+      // The first value is stored in the header
+      batch_len = 1;
+      v         = last;
+    } else {
+      uint32_t w;
+      if (mb_pos >= mb_size) {
+        // Next miniblock
+        cur += (mb_size * ((widths + mb_idx < end) ? widths[mb_idx] : 0)) >> 3;
+        mb_idx++;
+        mb_pos = 0;
+      }
+      if (mb_idx >= num_mbs) {
+        // Next block: min delta followed by the bit widths of the miniblocks
+        min_delta = get_zigzag64(cur, end);
+        widths    = cur;
+        cur += num_mbs;
+        mb_idx = 0;
+      }
+      w = (widths + mb_idx < end) ? widths[mb_idx] : 0;
+      if (w > 64) {
+        if (!t) { s->error = 5; }
+        break;
+      }
+      batch_len = min(count, 32);
+      if (t < batch_len) {
+        uint32_t bitpos  = (mb_pos + t) * w;
+        const uint8_t *p = cur + (bitpos >> 3);
+        int32_t shift    = -static_cast<int32_t>(bitpos & 7);
+        uint64_t u       = 0;
+        for (; shift < static_cast<int32_t>(w); shift += 8, p++) {
+          uint64_t b = (p < end) ? *p : 0;
+          u |= (shift >= 0) ? b << shift : b >> -shift;
+        }
+        if (w < 64) { u &= (1ull << w) - 1; }
+        v = u + static_cast<uint64_t>(min_delta);
+      }
+      v = WarpReducePos32(v, t) + static_cast<uint64_t>(last);
+      last = SHFL(v, batch_len - 1);
+      mb_pos += 32;
+    }
+    if (t < batch_len) {
+      s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = static_cast<uint32_t>(v);
+      s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = static_cast<uint32_t>(v >> 32);
+    }
+    count -= batch_len;
+    pos += batch_len;
+  }
+  // Positions past the last value are never output (unless the page is corrupted)
+  if (count <= 0) { pos = max(pos, target_pos); }
+  if (!t) {
+    s->delta_cur    = cur;
+    s->delta_widths = widths;
+    s->delta_min    = min_delta;
+    s->delta_last   = last;
+    s->delta_count  = count;
+    s->delta_mb_idx = mb_idx;
+    s->delta_mb_pos = mb_pos;
+  }
+  return pos;
+}
+
+/**
+ * @brief Decodes DELTA_LENGTH_BYTE_ARRAY string lengths and computes the string positions
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target write position
+ * @param[in] t Warp1 thread ID (0..31)
+ *
+ * @return The new output position
+ **/
+__device__ int gpuDecodeDeltaLengthByteArray(volatile page_state_s *s, int target_pos, int t) {
+  int pos     = s->dict_pos;
+  int end_pos = gpuDecodeDeltaBinaryPacked(s, target_pos, t);
+  uint32_t k  = s->dict_val;
+
+  SYNCWARP();
+  for (; pos < end_pos; pos += 32) {
+    uint32_t len = (pos + t < end_pos) ? s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] : 0;
+    uint32_t ofs = WarpReducePos32(len, t);
+    if (pos + t < end_pos) {
+      uint32_t str_start = k + ofs - len;
+      bool in_range      = (static_cast<uint64_t>(str_start) + len <= (uint32_t)s->dict_size);
+      s->dict_idx[(pos + t) & (NZ_BFRSZ - 1)] = str_start;
+      s->str_len[(pos + t) & (NZ_BFRSZ - 1)]  = (in_range) ? len : 0;
+    }
+    k += SHFL(ofs, 31);
+  }
+  if (!t) { s->dict_val = k; }
+  return end_pos;
+}
+
 /**
  * @brief Performs RLE decoding of dictionary indexes, for when dict_size=1
  *
@@ -531,7 +743,7 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary index)
  **/
 inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, void *dstv) {
   const char *ptr = NULL;
@@ -541,6 +753,12 @@ inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, vo
     // String dictionary
     uint32_t dict_pos =
       (s->dict_bits > 0) ? s->dict_idx[src_pos & (NZ_BFRSZ - 1)] * sizeof(nvstrdesc_s) : 0;
+    if (s->col.dict_key_offset >= 0) {
+      // Output index into the column's dictionary keys
+      uint32_t key = (dict_pos < (uint32_t)s->dict_size) ? dict_pos / sizeof(nvstrdesc_s) : 0;
+      *reinterpret_cast<uint32_t *>(dstv) = s->col.dict_key_offset + key;
+      return;
+    }
     if (dict_pos < (uint32_t)s->dict_size) {
       const nvstrdesc_s *src = reinterpret_cast<const nvstrdesc_s *>(s->dict_base + dict_pos);
       ptr                    = src->ptr;
@@ -554,9 +772,20 @@ inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, vo
       len = s->str_len[src_pos & (NZ_BFRSZ - 1)];
     }
   }
-  if (s->dtype_len == 4) {
-    // Output hash
-    *reinterpret_cast<uint32_t *>(dstv) = device_str2hash32(ptr, len);
+  if (s->col.direct_strings) {
+    // Output the string length, or copy the string to its offset in the chars once the lengths
+    // are scanned into offsets
+    int32_t *offset = reinterpret_cast<int32_t *>(dstv);
+    uint8_t *chars  = s->col.str_data;
+    if (!chars) {
+      *offset = static_cast<int32_t>(len);
+    } else if (len != 0) {
+      memcpy(chars + *offset, ptr, len);
+    }
+  } else if (s->dtype_len == 4) {
+    // Output hash (or the first dictionary key, for pages without dictionary)
+    *reinterpret_cast<uint32_t *>(dstv) =
+      (s->col.dict_key_offset >= 0) ? s->col.dict_key_offset : device_str2hash32(ptr, len);
   } else {
     // Output string descriptor
     nvstrdesc_s *dst = reinterpret_cast<nvstrdesc_s *>(dstv);
@@ -832,6 +1061,47 @@ inline __device__ void gpuOutputDecimal(volatile page_state_s *s,
   *dst  = (scale < 0) ? (d * kPow10[min(-scale, 39)]) : (d / kPow10[min(scale, 39)]);
 }
 
+/**
+ * @brief Output a DELTA_BINARY_PACKED value
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ * @param[in] dtype Stored data type
+ **/
+inline __device__ void gpuOutputDeltaValue(volatile page_state_s *s,
+                                           int src_pos,
+                                           uint8_t *dst,
+                                           int dtype) {
+  uint64_t lo = s->dict_idx[src_pos & (NZ_BFRSZ - 1)];
+  uint64_t hi = s->str_len[src_pos & (NZ_BFRSZ - 1)];
+  int64_t v   = static_cast<int64_t>((hi << 32) | lo);
+
+  if (dtype == INT32) { v = static_cast<int32_t>(v); }  // Deltas wrap around in 32 bits
+  if (s->col.converted_type == DECIMAL) {
+    int32_t scale                    = s->col.decimal_scale;
+    double d                         = Int128ToDouble_rn(v, v >> 63);
+    *reinterpret_cast<double *>(dst) = (scale < 0) ? (d * kPow10[min(-scale, 39)])
+                                                   : (d / kPow10[min(scale, 39)]);
+  } else if (s->dtype_len == 8) {
+    int32_t ts_scale = s->ts_scale;
+    if (ts_scale < 0) {
+      // round towards negative infinity
+      int sign = (v < 0);
+      v        = ((v + sign) / -ts_scale) + sign;
+    } else if (ts_scale > 0) {
+      v *= ts_scale;
+    }
+    *reinterpret_cast<int64_t *>(dst) = v;
+  } else if (s->dtype_len == 4) {
+    *reinterpret_cast<int32_t *>(dst) = static_cast<int32_t>(v);
+  } else if (s->dtype_len == 2) {
+    *reinterpret_cast<int16_t *>(dst) = static_cast<int16_t>(v);
+  } else {
+    *dst = static_cast<uint8_t>(v);
+  }
+}
+
 /**
  * @brief Output a small fixed-length value
  *
@@ -925,7 +1195,15 @@ static __device__ void gpuOutputGeneric(volatile page_state_s *s,
  * @param[in] num_chunks Number of column chunks
  **/
 // blockDim {NTHREADS,1,1}
-extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
+/**
+ * @brief Kernel for reading the column data stored in the pages
+ *
+ * Strings of the chunks with `direct_strings` set are decoded in two passes: the first one
+ * outputs their lengths, and the second one (`decode_chars`, only decoding these chunks) copies
+ * them into the chars at the offsets scanned from the lengths
+ **/
+template <bool decode_chars>
+__global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   PageInfo *pages, ColumnChunkDesc *chunks, size_t min_row, size_t num_rows, int32_t num_chunks) {
   __shared__ __align__(16) page_state_s state_g;
 
@@ -941,6 +1219,13 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   }
   __syncthreads();
   if (s->page.flags & PAGEINFO_FLAGS_DICTIONARY) { return; }
+  if (s->page.flags & PAGEINFO_FLAGS_SKIP) {
+    if (!t) {
+      pages[page_idx].num_rows    = 0;
+      pages[page_idx].valid_count = 0;
+    }
+    return;
+  }
   // Fetch column chunk info
   chunk_idx = s->page.chunk_idx;
   if ((uint32_t)chunk_idx < (uint32_t)num_chunks) {
@@ -950,6 +1235,7 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
     }
   }
   __syncthreads();
+  if (decode_chars && !s->col.direct_strings) { return; }
   if (!t) {
     s->num_rows         = 0;
     s->page.valid_count = 0;
@@ -958,6 +1244,11 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       uint8_t *cur           = s->page.page_data;
       uint8_t *end           = cur + s->page.uncompressed_page_size;
       size_t page_start_row  = s->col.start_row + s->page.chunk_row;
+      if (s->col.max_rep_level > 0) {
+        // Repeated chunks are output by value, rows being selected when assembling the lists
+        min_row  = 0;
+        num_rows = static_cast<size_t>(-1);
+      }
       uint32_t dtype_len_out = s->col.data_type >> 3;
       s->ts_scale            = 0;
       // Validate data type
@@ -995,8 +1286,9 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       } else if ((s->col.data_type & 7) == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
-      } else if ((s->col.data_type & 7) == BYTE_ARRAY && dtype_len_out == 4) {
-        s->dtype_len = 4;  // HASH32 output
+      } else if ((s->col.data_type & 7) == BYTE_ARRAY &&
+                 (dtype_len_out == 4 || s->col.dict_key_offset >= 0 || s->col.direct_strings)) {
+        s->dtype_len = 4;  // HASH32, dictionary index or string length/offset output
       } else if ((s->col.data_type & 7) == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
@@ -1019,12 +1311,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       if (page_start_row + s->num_rows > min_row + num_rows) {
         s->num_rows = (int32_t)max((int64_t)(min_row + num_rows - page_start_row), INT64_C(0));
       }
+      // Find the compressed size of repetition levels, which precede the definition levels
+      cur +=
+        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       // Find the compressed size of definition levels
       cur +=
         InitLevelSection(s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
-      // Find the compressed size of repetition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       s->dict_bits = 0;
       s->dict_base = 0;
       s->dict_size = 0;
@@ -1052,6 +1344,19 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case RLE: s->dict_run = 0; break;
+        case DELTA_BINARY_PACKED:
+          cur += InitDeltaSection(s, cur, end);
+          s->dict_size = static_cast<int32_t>(end - cur);
+          if ((s->col.data_type & 7) != INT32 && (s->col.data_type & 7) != INT64) { s->error = 1; }
+          break;
+        case DELTA_LENGTH_BYTE_ARRAY:
+          // Lengths are DELTA_BINARY_PACKED, followed by the concatenated string data
+          cur += InitDeltaSection(s, cur, end);
+          cur += SkipDeltaSection(s, end);
+          s->dict_size = static_cast<int32_t>(end - cur);
+          s->dict_val  = 0;
+          if ((s->col.data_type & 7) != BYTE_ARRAY) { s->error = 1; }
+          break;
         default:
           s->error = 1;  // Unsupported encoding
           break;
@@ -1073,8 +1378,10 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
   } else {
-    out_thread0 =
-      ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY) ? 64 : 32;
+    out_thread0 = ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY ||
+                   s->page.encoding == DELTA_BINARY_PACKED)
+                    ? 64
+                    : 32;
   }
 
   while (!s->error && (s->value_count < s->num_values || s->out_pos < s->nz_count)) {
@@ -1096,6 +1403,10 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         target_pos = gpuDecodeDictionaryIndices(s, target_pos, t & 0x1f);
+      } else if (s->page.encoding == DELTA_BINARY_PACKED) {
+        target_pos = gpuDecodeDeltaBinaryPacked(s, target_pos, t & 0x1f);
+      } else if (s->page.encoding == DELTA_LENGTH_BYTE_ARRAY) {
+        target_pos = gpuDecodeDeltaLengthByteArray(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BOOLEAN) {
         target_pos = gpuDecodeRleBooleans(s, target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BYTE_ARRAY) {
@@ -1114,6 +1425,8 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           gpuOutputString(s, out_pos, dst);
         else if (dtype == BOOLEAN)
           gpuOutputBoolean(s, out_pos, dst);
+        else if (s->page.encoding == DELTA_BINARY_PACKED)
+          gpuOutputDeltaValue(s, out_pos, dst, dtype);
         else if (s->col.converted_type == DECIMAL)
           gpuOutputDecimal(s, out_pos, reinterpret_cast<double *>(dst), dtype);
         else if (dtype == INT96)
@@ -1140,6 +1453,113 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   }
 }
 
+/**
+ * @brief Decode a RLE/bit-packed hybrid level section into every other byte of the output
+ *
+ * @param[in] cur Start of the level runs
+ * @param[in] end End of the level section
+ * @param[in] level_bits The bits of each level
+ * @param[in] first Index of the first value to output
+ * @param[in] last Index after the last value to output
+ * @param[out] out Output for the level of the first value
+ * @param[in] t Thread ID in the warp (0..31)
+ *
+ * @return false if the section is truncated, true otherwise
+ **/
+__device__ bool gpuDecodeLevelSection(const uint8_t *cur,
+                                      const uint8_t *end,
+                                      int level_bits,
+                                      int32_t first,
+                                      int32_t last,
+                                      uint8_t *out,
+                                      int t) {
+  int32_t pos = 0;
+  while (pos < last) {
+    if (cur >= end) { return false; }
+    uint32_t run = get_vlq32(cur, end);
+    int32_t len, lo, hi;
+    if (run & 1) {
+      // Literal run of groups of 8 bit-packed levels
+      len = (run >> 1) * 8;
+      lo  = max(pos, first);
+      hi  = min(pos + len, last);
+      for (int32_t i = lo + t; i < hi; i += 32) {
+        uint32_t bitpos = (i - pos) * level_bits;
+        const uint8_t *p = cur + (bitpos >> 3);
+        uint32_t v       = 0;
+        for (int b = 0; b < 3 && p + b < end; b++) { v |= p[b] << (b * 8); }
+        out[(i - first) * 2] = (v >> (bitpos & 7)) & ((1 << level_bits) - 1);
+      }
+      cur += (run >> 1) * level_bits;
+    } else {
+      // Repeated level
+      uint32_t v = (cur < end) ? cur[0] : 0;
+      if (level_bits > 8) { v |= ((cur + 1 < end) ? cur[1] : 0) << 8; }
+      cur += (level_bits + 7) >> 3;
+      len = run >> 1;
+      lo  = max(pos, first);
+      hi  = min(pos + len, last);
+      for (int32_t i = lo + t; i < hi; i += 32) { out[(i - first) * 2] = v; }
+    }
+    if (len == 0) { return false; }
+    pos += len;
+  }
+  return true;
+}
+
+/**
+ * @brief Kernel for outputting the definition and repetition levels of the pages
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] min_row crop all rows below min_row
+ * @param[in] num_rows Maximum number of rows to read
+ * @param[in] num_pages Number of pages
+ * @param[in] num_chunks Number of column chunks
+ **/
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128) gpuDecodePageLevels(PageInfo *pages,
+                                                                      ColumnChunkDesc *chunks,
+                                                                      size_t min_row,
+                                                                      size_t num_rows,
+                                                                      int32_t num_pages,
+                                                                      int32_t num_chunks) {
+  int t        = threadIdx.x & 0x1f;
+  int page_idx = blockIdx.x * 4 + (threadIdx.x >> 5);
+  if (page_idx >= num_pages) { return; }
+  const PageInfo *page = &pages[page_idx];
+  if (page->flags & (PAGEINFO_FLAGS_DICTIONARY | PAGEINFO_FLAGS_SKIP)) { return; }
+  if ((uint32_t)page->chunk_idx >= (uint32_t)num_chunks) { return; }
+  const ColumnChunkDesc *col = &chunks[page->chunk_idx];
+  if (!col->levels_base) { return; }
+  if (col->max_rep_level > 0) {
+    min_row  = 0;
+    num_rows = static_cast<size_t>(-1);
+  }
+  // Levels of the values in [first, last) relative to the page are output
+  size_t page_start = col->start_row + page->chunk_row;
+  size_t page_end   = page_start + page->num_values;
+  size_t row_end    = (min_row + num_rows < min_row) ? page_end : min_row + num_rows;
+  int32_t first     = static_cast<int32_t>(max(min_row, page_start) - page_start);
+  int32_t last      = static_cast<int32_t>(min(row_end, page_end) - page_start);
+  if (page_end <= min_row || first >= last) { return; }
+  uint8_t *out      = col->levels_base + (page_start + first - min_row) * 2;
+  const uint8_t *cur = page->page_data;
+  const uint8_t *end = cur + page->uncompressed_page_size;
+  // Repetition levels precede the definition levels, both prefixed by their length
+  if (col->rep_level_bits > 0 && page->repetition_level_encoding == RLE && cur + 4 <= end) {
+    uint32_t len = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+    cur += 4;
+    gpuDecodeLevelSection(cur, min(cur + len, end), col->rep_level_bits, first, last, out + 1, t);
+    cur += len;
+  }
+  if (col->def_level_bits > 0 && page->definition_level_encoding == RLE && cur + 4 <= end) {
+    uint32_t len = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+    cur += 4;
+    gpuDecodeLevelSection(cur, min(cur + len, end), col->def_level_bits, first, last, out, t);
+  }
+}
+
 cudaError_t __host__ DecodePageData(PageInfo *pages,
                                     int32_t num_pages,
                                     ColumnChunkDesc *chunks,
@@ -1149,11 +1569,41 @@ cudaError_t __host__ DecodePageData(PageInfo *pages,
                                     cudaStream_t stream) {
   dim3 dim_block(NTHREADS, 1);
   dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
-  gpuDecodePageData<<<dim_grid, dim_block, 0, stream>>>(
+  gpuDecodePageData<false><<<dim_grid, dim_block, 0, stream>>>(
     pages, chunks, min_row, num_rows, num_chunks);
   return cudaSuccess;
 }
 
+cudaError_t __host__ DecodePageStrings(PageInfo *pages,
+                                       int32_t num_pages,
+                                       ColumnChunkDesc *chunks,
+                                       int32_t num_chunks,
+                                       size_t num_rows,
+                                       size_t min_row,
+                                       cudaStream_t stream) {
+  dim3 dim_block(NTHREADS, 1);
+  dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
+  gpuDecodePageData<true><<<dim_grid, dim_block, 0, stream>>>(
+    pages, chunks, min_row, num_rows, num_chunks);
+  return cudaSuccess;
+}
+
+cudaError_t __host__ DecodePageLevels(PageInfo *pages,
+                                      int32_t num_pages,
+                                      ColumnChunkDesc *chunks,
+                                      int32_t num_chunks,
+                                      size_t num_rows,
+                                      size_t min_row,
+                                      cudaStream_t stream) {
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((num_pages + 3) >> 2, 1);  // 4 warps per threadblock, 1 warp per page
+  if (num_pages > 0) {
+    gpuDecodePageLevels<<<dim_grid, dim_block, 0, stream>>>(
+      pages, chunks, min_row, num_rows, num_pages, num_chunks);
+  }
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
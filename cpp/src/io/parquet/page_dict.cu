@@ -22,19 +22,16 @@ namespace io {
 namespace parquet {
 namespace gpu {
 
-struct dict_state_s {
-  uint32_t row_cnt;
-  PageFragment *cur_fragment;
-  uint32_t *hashmap;
-  uint32_t total_dict_entries;  //!< Total number of entries in dictionary
-  uint32_t dictionary_size;     //!< Total dictionary size in bytes
-  uint32_t num_dict_entries;    //!< Dictionary entries in current fragment to add
-  uint32_t frag_dict_size;
+/**
+ * @brief Shared state of a block working on one fragment of a column chunk
+ **/
+struct dict_frag_state_s {
   EncColumnChunk ck;
   EncColumnDesc col;
   PageFragment frag;
+  uint32_t frag_start_row;  //!< First row of the fragment
+  uint32_t num_entries;     //!< Dictionary entries before the current rows of the fragment
   volatile uint32_t scratch_red[32];
-  uint16_t frag_dict[MAX_PAGE_FRAGMENT_SIZE];
 };
 
 /**
@@ -68,256 +65,404 @@ inline __device__ uint32_t nvstr_hash16(const uint8_t *p, uint32_t len) {
 }
 
 /**
- * @brief Fetch a page fragment and its dictionary entries in row-ascending order
- *
- * @param[in,out] s dictionary state
- * @param[in,out] dict_data fragment dictionary data for the current column (zeroed out after fetching)
- * @param[in] frag_start_row row position of current fragment
- * @param[in] t thread id
+ * @brief Returns the size in bytes of a value in the column data
  **/
-__device__ void FetchDictionaryFragment(dict_state_s *s,
-                                        uint32_t *dict_data,
-                                        uint32_t frag_start_row,
-                                        uint32_t t) {
-  if (t < sizeof(PageFragment) / sizeof(uint32_t)) {
-    reinterpret_cast<uint32_t *>(&s->frag)[t] =
-      reinterpret_cast<const uint32_t *>(s->cur_fragment)[t];
-  }
-  __syncthreads();
-  // Store the row values in shared mem and set the corresponding dict_data to zero (end-of-list)
-  // It's easiest to do this here since we're only dealing with values all within a 5K-row window
-  for (uint32_t i = t; i < s->frag.num_dict_vals; i += 1024) {
-    uint32_t r      = dict_data[frag_start_row + i] - frag_start_row;
-    s->frag_dict[i] = r;
+inline __device__ uint32_t dict_value_size(const EncColumnDesc &col) {
+  uint32_t dtype = col.physical_type;
+  if (dtype == INT32) {
+    uint32_t converted_type = col.converted_type;
+    return (converted_type == INT_8) ? 1 : (converted_type == INT_16) ? 2 : 4;
   }
-  __syncthreads();
-  for (uint32_t i = t; i < s->frag.num_dict_vals; i += 1024) {
-    uint32_t r                    = s->frag_dict[i];
-    dict_data[frag_start_row + r] = 0;
+  return (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : (dtype == INT64 || dtype == DOUBLE) ? 8 : 4;
+}
+
+/**
+ * @brief Loads a fixed-length value from the column data
+ **/
+inline __device__ uint64_t load_dict_value(const void *data, uint32_t dtype_len_in, uint32_t row) {
+  return (dtype_len_in == 8)
+           ? reinterpret_cast<const uint64_t *>(data)[row]
+           : (dtype_len_in == 4)
+               ? reinterpret_cast<const uint32_t *>(data)[row]
+               : (dtype_len_in == 2) ? reinterpret_cast<const uint16_t *>(data)[row]
+                                     : reinterpret_cast<const uint8_t *>(data)[row];
+}
+
+/**
+ * @brief Computes the dictionary hash of the value of a row
+ **/
+inline __device__ uint32_t dict_value_hash(const EncColumnDesc &col,
+                                           uint32_t dtype_len_in,
+                                           uint32_t row) {
+  if (col.physical_type == BYTE_ARRAY) {
+    const nvstrdesc_s &str = reinterpret_cast<const nvstrdesc_s *>(col.column_data_base)[row];
+    return nvstr_hash16(reinterpret_cast<const uint8_t *>(str.ptr), (uint32_t)str.count);
   }
-  __syncthreads();
+  uint64_t val = load_dict_value(col.column_data_base, dtype_len_in, row);
+  return (dtype_len_in == 8) ? uint64_hash16(val) : uint32_hash16((uint32_t)val);
 }
 
-/// Generate dictionary indices in ascending row order
-__device__ void GenerateDictionaryIndices(dict_state_s *s, uint32_t t) {
-  uint32_t *dict_index      = s->col.dict_index;
-  uint32_t *dict_data       = s->col.dict_data + s->ck.start_row;
-  const uint32_t *valid_map = s->col.valid_map_base;
-  uint32_t num_dict_entries = 0;
-
-  for (uint32_t i = 0; i < s->row_cnt; i += 1024) {
-    uint32_t row      = s->ck.start_row + i + t;
-    uint32_t is_valid = (i + t < s->row_cnt && row < s->col.num_rows)
-                          ? (valid_map) ? (valid_map[row >> 5] >> (row & 0x1f)) & 1 : 1
-                          : 0;
-    uint32_t dict_idx = (is_valid) ? dict_index[row] : 0;
-    uint32_t is_unique =
-      (is_valid &&
-       dict_idx ==
-         row);  // Any value that doesn't have bit31 set should have dict_idx=row at this point
-    uint32_t umask = BALLOT(is_unique);
-    uint32_t pos   = num_dict_entries + __popc(umask & ((1 << (t & 0x1f)) - 1));
-    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(umask); }
-    num_dict_entries += __syncthreads_count(is_unique);
-    if (t < 32) { s->scratch_red[t] = WarpReducePos32(s->scratch_red[t], t); }
-    __syncthreads();
-    if (t >= 32) { pos += s->scratch_red[(t - 32) >> 5]; }
-    if (is_valid && is_unique) {
-      dict_data[pos]  = row;
-      dict_index[row] = pos;
-    }
-    __syncthreads();
-    if (is_valid && !is_unique) {
-      // NOTE: Should have at most 3 iterations (once for early duplicate elimination, once for final dictionary duplicate elimination and once for re-ordering)
-      // (If something went wrong building the dictionary, it will likely hang or crash right here)
-      do { dict_idx = dict_index[dict_idx & 0x7fffffff]; } while (dict_idx > 0x7fffffff);
-      dict_index[row] = dict_idx;
-    }
+/**
+ * @brief Returns true if two rows hold the same value
+ **/
+inline __device__ bool dict_values_equal(const EncColumnDesc &col,
+                                         uint32_t dtype_len_in,
+                                         uint32_t row1,
+                                         uint32_t row2) {
+  if (col.physical_type == BYTE_ARRAY) {
+    const nvstrdesc_s &str1 = reinterpret_cast<const nvstrdesc_s *>(col.column_data_base)[row1];
+    const nvstrdesc_s &str2 = reinterpret_cast<const nvstrdesc_s *>(col.column_data_base)[row2];
+    return str1.count == str2.count &&
+           nvstr_is_equal(str1.ptr, (uint32_t)str1.count, str2.ptr, (uint32_t)str2.count);
   }
+  return load_dict_value(col.column_data_base, dtype_len_in, row1) ==
+         load_dict_value(col.column_data_base, dtype_len_in, row2);
 }
 
-// blockDim(1024, 1, 1)
-__global__ void __launch_bounds__(1024, 1)
-  gpuBuildChunkDictionaries(EncColumnChunk *chunks, uint32_t *dev_scratch) {
-  __shared__ __align__(8) dict_state_s state_g;
+inline __device__ bool is_valid_row(const EncColumnDesc &col, uint32_t row) {
+  return row < col.num_rows &&
+         (!col.valid_map_base || ((col.valid_map_base[row >> 5] >> (row & 0x1f)) & 1));
+}
 
-  dict_state_s *const s = &state_g;
-  uint32_t t            = threadIdx.x;
-  uint32_t dtype, dtype_len, dtype_len_in;
+/**
+ * @brief Follows the duplicate links of a row to the row holding its dictionary entry
+ **/
+inline __device__ uint32_t find_dict_root(const uint32_t *dict_index, uint32_t dict_idx) {
+  while (dict_idx & (1u << 31)) { dict_idx = dict_index[dict_idx & 0x7fffffff]; }
+  return dict_idx;
+}
 
+/**
+ * @brief Fetch the column chunk and page fragment of the block
+ *
+ * Chunks are indexed by blockIdx.x and the fragments of a chunk by blockIdx.y
+ *
+ * @param[in,out] s fragment state
+ * @param[in] chunks column chunks
+ * @param[in] fragment_size number of rows per fragment
+ * @param[in] dict_fragments_only only accept fragments encoded with the dictionary
+ * @param[in] t thread id
+ *
+ * @return false if the block has no fragment to work on
+ **/
+__device__ bool FetchChunkFragment(dict_frag_state_s *s,
+                                   const EncColumnChunk *chunks,
+                                   uint32_t fragment_size,
+                                   bool dict_fragments_only,
+                                   uint32_t t) {
   if (t < sizeof(EncColumnChunk) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->ck)[t] =
       reinterpret_cast<const uint32_t *>(&chunks[blockIdx.x])[t];
   }
   __syncthreads();
-  if (!s->ck.has_dictionary) { return; }
+  uint32_t num_fragments = (dict_fragments_only)
+                             ? s->ck.num_dict_fragments
+                             : (s->ck.num_rows + fragment_size - 1) / fragment_size;
+  if (!s->ck.has_dictionary || blockIdx.y >= num_fragments) { return false; }
   if (t < sizeof(EncColumnDesc) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->col)[t] =
       reinterpret_cast<const uint32_t *>(s->ck.col_desc)[t];
   }
-  __syncthreads();
+  if (t < sizeof(PageFragment) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&s->frag)[t] =
+      reinterpret_cast<const uint32_t *>(&s->ck.fragments[blockIdx.y])[t];
+  }
   if (!t) {
-    s->hashmap               = dev_scratch + s->ck.dictionary_id * (size_t)(1 << kDictHashBits);
-    s->row_cnt               = 0;
-    s->cur_fragment          = s->ck.fragments;
-    s->total_dict_entries    = 0;
-    s->dictionary_size       = 0;
-    s->ck.num_dict_fragments = 0;
+    s->frag_start_row = s->ck.start_row + blockIdx.y * fragment_size;
+    s->num_entries    = 0;
   }
-  dtype     = s->col.physical_type;
-  dtype_len = (dtype == INT64 || dtype == DOUBLE) ? 8 : 4;
-  if (dtype == INT32) {
-    uint32_t converted_type = s->col.converted_type;
-    dtype_len_in            = (converted_type == INT_8) ? 1 : (converted_type == INT_16) ? 2 : 4;
-  } else {
-    dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len;
+  __syncthreads();
+  return true;
+}
+
+/**
+ * @brief Inserts the unique values of the page fragments into the chunk hash map
+ *
+ * Every block inserts one fragment, with the hash chains linked through
+ * dict_data. Rows whose value is already in the map are marked as duplicates
+ * of the row they were matched with.
+ *
+ * @param[in,out] chunks Column chunks
+ * @param[in] dev_scratch Hash maps of the chunk dictionaries
+ * @param[in] fragment_size Number of rows per fragment
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuInsertDictionaryFragments(EncColumnChunk *chunks,
+                               uint32_t *dev_scratch,
+                               uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, false, t)) { return; }
+  uint32_t *hashmap     = dev_scratch + s->ck.dictionary_id * (size_t)(1 << kDictHashBits);
+  uint32_t dtype_len_in = dict_value_size(s->col);
+  // Clear the fragment's links before any of its rows become reachable from the hash map
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    s->col.dict_data[s->frag_start_row + i] = 0;
   }
+  __threadfence();
   __syncthreads();
-  while (s->row_cnt < s->ck.num_rows) {
-    uint32_t frag_start_row = s->ck.start_row + s->row_cnt, num_dict_entries, frag_dict_size;
-    FetchDictionaryFragment(s, s->col.dict_data, frag_start_row, t);
-    __syncthreads();
-    num_dict_entries = s->frag.num_dict_vals;
-    if (!t) {
-      s->num_dict_entries = 0;
-      s->frag_dict_size   = 0;
-    }
-    for (uint32_t i = 0; i < num_dict_entries; i += 1024) {
-      bool is_valid    = (i + t < num_dict_entries);
-      uint32_t len     = 0;
-      uint32_t is_dupe = 0;
-      uint32_t row, hash, next, *next_addr;
-      uint32_t new_dict_entries;
-
-      if (is_valid) {
-        row = frag_start_row + s->frag_dict[i + t];
-        len = dtype_len;
-        if (dtype == BYTE_ARRAY) {
-          const char *ptr = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].ptr;
-          uint32_t count =
-            (uint32_t) reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].count;
-          len += count;
-          hash = nvstr_hash16(reinterpret_cast<const uint8_t *>(ptr), count);
-          // Walk the list of rows with the same hash
-          next_addr = &s->hashmap[hash];
-          while ((next = atomicCAS(next_addr, 0, row + 1)) != 0) {
-            const char *ptr2 =
-              reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[next - 1].ptr;
-            uint32_t count2 =
-              reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[next - 1].count;
-            if (count2 == count && nvstr_is_equal(ptr, count, ptr2, count2)) {
-              is_dupe = 1;
-              break;
-            }
-            next_addr = &s->col.dict_data[next - 1];
-          }
-        } else {
-          uint64_t val;
-
-          if (dtype_len_in == 8) {
-            val  = reinterpret_cast<const uint64_t *>(s->col.column_data_base)[row];
-            hash = uint64_hash16(val);
-          } else {
-            val = (dtype_len_in == 4)
-                    ? reinterpret_cast<const uint32_t *>(s->col.column_data_base)[row]
-                    : (dtype_len_in == 2)
-                        ? reinterpret_cast<const uint16_t *>(s->col.column_data_base)[row]
-                        : reinterpret_cast<const uint8_t *>(s->col.column_data_base)[row];
-            hash = uint32_hash16(val);
-          }
-          // Walk the list of rows with the same hash
-          next_addr = &s->hashmap[hash];
-          while ((next = atomicCAS(next_addr, 0, row + 1)) != 0) {
-            uint64_t val2 =
-              (dtype_len_in == 8)
-                ? reinterpret_cast<const uint64_t *>(s->col.column_data_base)[next - 1]
-                : (dtype_len_in == 4)
-                    ? reinterpret_cast<const uint32_t *>(s->col.column_data_base)[next - 1]
-                    : (dtype_len_in == 2)
-                        ? reinterpret_cast<const uint16_t *>(s->col.column_data_base)[next - 1]
-                        : reinterpret_cast<const uint8_t *>(s->col.column_data_base)[next - 1];
-            if (val2 == val) {
-              is_dupe = 1;
-              break;
-            }
-            next_addr = &s->col.dict_data[next - 1];
-          }
-        }
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    uint32_t row = s->frag_start_row + i;
+    // Values that repeat within the fragment already link to their first occurrence
+    if (!is_valid_row(s->col, row) || (s->col.dict_index[row] & (1u << 31))) { continue; }
+    uint32_t hash       = dict_value_hash(s->col, dtype_len_in, row);
+    uint32_t *next_addr = &hashmap[hash];
+    uint32_t next;
+    bool is_dupe = false;
+    // Walk the list of rows with the same hash
+    while ((next = atomicCAS(next_addr, 0, row + 1)) != 0) {
+      if (dict_values_equal(s->col, dtype_len_in, row, next - 1)) {
+        is_dupe = true;
+        break;
       }
-      // Count the non-duplicate entries
-      frag_dict_size = WarpReduceSum32((is_valid && !is_dupe) ? len : 0);
-      if (!(t & 0x1f)) { s->scratch_red[t >> 5] = frag_dict_size; }
-      new_dict_entries = __syncthreads_count(is_valid && !is_dupe);
-      if (t < 32) {
-        frag_dict_size = WarpReduceSum32(s->scratch_red[t]);
-        if (t == 0) {
-          s->frag_dict_size += frag_dict_size;
-          s->num_dict_entries += new_dict_entries;
-        }
-      }
-      if (is_valid) {
-        if (!is_dupe) {
-          s->col.dict_index[row] = row;
-        } else {
-          s->col.dict_index[row] = (next - 1) | (1u << 31);
-        }
-      }
-      __syncthreads();
-      // At this point, the dictionary order is non-deterministic, and we want insertion order
-      // Make sure that the non-duplicate entry corresponds to the lower row number
-      // (The entry in dict_data (next-1) used for duplicate elimination does not need
-      // to be the lowest row number)
-      bool reorder_check = (is_valid && is_dupe && next - 1 > row);
-      if (reorder_check) {
-        next = s->col.dict_index[next - 1];
-        while (next & (1u << 31)) { next = s->col.dict_index[next & 0x7fffffff]; }
-      }
-      if (__syncthreads_or(reorder_check)) {
-        if (reorder_check) { atomicMin(&s->col.dict_index[next], row); }
-        __syncthreads();
-        if (reorder_check && s->col.dict_index[next] == row) {
-          s->col.dict_index[next] = row | (1u << 31);
-          s->col.dict_index[row]  = row;
-        }
-        __syncthreads();
+      next_addr = &s->col.dict_data[next - 1];
+    }
+    s->col.dict_index[row] = (is_dupe) ? (next - 1) | (1u << 31) : row;
+  }
+}
+
+/**
+ * @brief Finds the lowest row of every dictionary value
+ *
+ * Each root row of the hash map ends up holding the lowest row with the same value.
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuFindFirstDictionaryRows(EncColumnChunk *chunks, uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, false, t)) { return; }
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    uint32_t row = s->frag_start_row + i;
+    if (!is_valid_row(s->col, row)) { continue; }
+    uint32_t dict_idx = s->col.dict_index[row];
+    if (dict_idx & (1u << 31)) {
+      // Roots don't have bit31 set, but their value is being lowered by atomicMin
+      uint32_t root = dict_idx & 0x7fffffff;
+      while ((dict_idx = s->col.dict_index[root]) & (1u << 31)) { root = dict_idx & 0x7fffffff; }
+      atomicMin(&s->col.dict_index[root], row);
+    }
+  }
+}
+
+/**
+ * @brief Makes the lowest row of every dictionary value the holder of its entry
+ *
+ * This keeps the dictionary in insertion order regardless of the order in which
+ * the hash map was filled.
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuReorderDictionaryRoots(EncColumnChunk *chunks, uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, false, t)) { return; }
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    uint32_t row = s->frag_start_row + i;
+    if (!is_valid_row(s->col, row)) { continue; }
+    uint32_t first_row = s->col.dict_index[row];
+    if (!(first_row & (1u << 31)) && first_row != row) {
+      s->col.dict_index[first_row] = first_row;
+      s->col.dict_index[row]       = first_row | (1u << 31);
+    }
+  }
+}
+
+/**
+ * @brief Counts the dictionary entries first seen in each fragment, and their size
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuCountDictionaryEntries(EncColumnChunk *chunks, uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+  uint32_t num_dict_entries  = 0;
+  uint32_t dict_data_size    = 0;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, false, t)) { return; }
+  uint32_t dtype     = s->col.physical_type;
+  uint32_t dtype_len = (dtype == INT64 || dtype == DOUBLE) ? 8 : 4;
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    uint32_t row = s->frag_start_row + i;
+    if (is_valid_row(s->col, row) && s->col.dict_index[row] == row) {
+      num_dict_entries++;
+      dict_data_size += dtype_len;
+      if (dtype == BYTE_ARRAY) {
+        dict_data_size +=
+          (uint32_t) reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row].count;
       }
     }
-    __syncthreads();
-    num_dict_entries = s->num_dict_entries;
-    frag_dict_size   = s->frag_dict_size;
-    if (s->total_dict_entries + num_dict_entries > 65536 ||
-        s->dictionary_size + frag_dict_size > 512 * 1024) {
+  }
+  num_dict_entries = WarpReduceSum32(num_dict_entries);
+  dict_data_size   = WarpReduceSum32(dict_data_size);
+  if (!(t & 0x1f)) {
+    atomicAdd(&s->num_entries, num_dict_entries);
+    s->scratch_red[t >> 5] = dict_data_size;
+  }
+  __syncthreads();
+  if (t < 32) {
+    dict_data_size = WarpReduceSum32(s->scratch_red[t]);
+    if (!t) {
+      s->ck.fragments[blockIdx.y].num_dict_vals  = s->num_entries;
+      s->ck.fragments[blockIdx.y].dict_data_size = dict_data_size;
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of bits used to encode dictionary indices
+ **/
+inline __device__ uint32_t dict_index_bits(uint32_t num_dict_entries) {
+  return (num_dict_entries <= 2)
+           ? 1
+           : (num_dict_entries <= 4)
+               ? 2
+               : (num_dict_entries <= 16)
+                   ? 4
+                   : (num_dict_entries <= 256) ? 8 : (num_dict_entries <= 4096) ? 12 : 16;
+}
+
+/**
+ * @brief Selects the fragments of each chunk to encode with the dictionary
+ *
+ * Fragments are added until the dictionary exceeds 64K entries or 512KB, and
+ * the chunk falls back to plain encoding if the dictionary-encoded fragments
+ * would not be smaller than their plain encoding.
+ *
+ * @param[in,out] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] fragment_size Number of rows per fragment
+ **/
+// blockDim(128, 1, 1), one chunk per thread
+__global__ void __launch_bounds__(128) gpuSelectDictionaryFragments(EncColumnChunk *chunks,
+                                                                    uint32_t num_chunks,
+                                                                    uint32_t fragment_size) {
+  uint32_t chunk_id = blockIdx.x * 128 + threadIdx.x;
+  if (chunk_id >= num_chunks || !chunks[chunk_id].has_dictionary) { return; }
+
+  EncColumnChunk *ck          = &chunks[chunk_id];
+  uint32_t num_fragments      = (ck->num_rows + fragment_size - 1) / fragment_size;
+  uint32_t num_dict_fragments = 0;
+  uint32_t total_dict_entries = 0;
+  uint32_t dictionary_size    = 0;
+  uint32_t num_values         = 0;
+  size_t plain_size           = 0;
+  for (; num_dict_fragments < num_fragments; num_dict_fragments++) {
+    const PageFragment *frag = &ck->fragments[num_dict_fragments];
+    if (total_dict_entries + frag->num_dict_vals > 65536 ||
+        dictionary_size + frag->dict_data_size > 512 * 1024) {
       break;
     }
+    total_dict_entries += frag->num_dict_vals;
+    dictionary_size += frag->dict_data_size;
+    num_values += frag->non_nulls;
+    plain_size += frag->fragment_data_size;
+  }
+  size_t dict_encoded_size =
+    dictionary_size + ((size_t)num_values * dict_index_bits(total_dict_entries) + 7) / 8;
+  if (num_dict_fragments == 0 || dict_encoded_size >= plain_size) {
+    ck->has_dictionary = 0;
+    num_dict_fragments = 0;
+    total_dict_entries = 0;
+    dictionary_size    = 0;
+  }
+  ck->num_dict_fragments = num_dict_fragments;
+  ck->total_dict_entries = total_dict_entries;
+  ck->dictionary_size    = dictionary_size;
+}
+
+/**
+ * @brief Assigns dictionary positions in ascending row order to the dictionary entries
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuAssignDictionaryPositions(EncColumnChunk *chunks, uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, true, t)) { return; }
+  // Entries of the fragments before this one come first
+  uint32_t num_prior_entries = 0;
+  for (uint32_t f = t; f < blockIdx.y; f += 1024) {
+    num_prior_entries += s->ck.fragments[f].num_dict_vals;
+  }
+  num_prior_entries = WarpReduceSum32(num_prior_entries);
+  if (!(t & 0x1f) && num_prior_entries != 0) { atomicAdd(&s->num_entries, num_prior_entries); }
+  __syncthreads();
+
+  uint32_t *dict_data = s->col.dict_data + s->ck.start_row;
+  for (uint32_t i = 0; i < s->frag.num_rows; i += 1024) {
+    uint32_t row       = s->frag_start_row + i + t;
+    uint32_t is_unique = (i + t < s->frag.num_rows && is_valid_row(s->col, row) &&
+                          s->col.dict_index[row] == row);
+    uint32_t umask     = BALLOT(is_unique);
+    uint32_t pos       = s->num_entries + __popc(umask & ((1 << (t & 0x1f)) - 1));
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(umask); }
+    uint32_t num_new_entries = __syncthreads_count(is_unique);
+    if (t < 32) { s->scratch_red[t] = WarpReducePos32(s->scratch_red[t], t); }
     __syncthreads();
-    if (!t) {
-      if (num_dict_entries != s->frag.num_dict_vals) {
-        s->cur_fragment->num_dict_vals = num_dict_entries;
-      }
-      if (frag_dict_size != s->frag.dict_data_size) { s->frag.dict_data_size = frag_dict_size; }
-      s->total_dict_entries += num_dict_entries;
-      s->dictionary_size += frag_dict_size;
-      s->row_cnt += s->frag.num_rows;
-      s->cur_fragment++;
-      s->ck.num_dict_fragments++;
+    if (t >= 32) { pos += s->scratch_red[(t - 32) >> 5]; }
+    if (is_unique) {
+      dict_data[pos]         = row;
+      s->col.dict_index[row] = pos;
     }
     __syncthreads();
+    if (!t) { s->num_entries += num_new_entries; }
+    __syncthreads();
   }
-  __syncthreads();
-  GenerateDictionaryIndices(s, t);
-  if (!t) {
-    chunks[blockIdx.x].num_dict_fragments = s->ck.num_dict_fragments;
-    chunks[blockIdx.x].dictionary_size    = s->dictionary_size;
-    chunks[blockIdx.x].total_dict_entries = s->total_dict_entries;
+}
+
+/**
+ * @brief Replaces the duplicate links of the dictionary-encoded rows with dictionary positions
+ **/
+// blockDim(1024, 1, 1)
+__global__ void __launch_bounds__(1024)
+  gpuResolveDictionaryIndices(EncColumnChunk *chunks, uint32_t fragment_size) {
+  __shared__ __align__(8) dict_frag_state_s state_g;
+
+  dict_frag_state_s *const s = &state_g;
+  uint32_t t                 = threadIdx.x;
+
+  if (!FetchChunkFragment(s, chunks, fragment_size, true, t)) { return; }
+  for (uint32_t i = t; i < s->frag.num_rows; i += 1024) {
+    uint32_t row = s->frag_start_row + i;
+    if (!is_valid_row(s->col, row)) { continue; }
+    uint32_t dict_idx = s->col.dict_index[row];
+    if (dict_idx & (1u << 31)) {
+      // The entry of every value is held by a row of a dictionary-encoded fragment
+      s->col.dict_index[row] = find_dict_root(s->col.dict_index, dict_idx);
+    }
   }
 }
 
 /**
- * @brief Launches kernel for building chunk dictionaries
+ * @brief Launches kernels for building chunk dictionaries
+ *
+ * The fragments of every chunk are processed by separate blocks: the unique
+ * values are first inserted into a per-chunk hash map, then the dictionary is
+ * put in row order, truncated to the leading fragments that fit and dropped
+ * if it doesn't pay off.
  *
- * @param[in] chunks Column chunks
+ * @param[in,out] chunks Column chunks
  * @param[in] dev_scratch Device scratch data (kDictScratchSize per dictionary)
+ * @param[in] scratch_size size of scratch data in bytes
  * @param[in] num_chunks Number of column chunks
+ * @param[in] fragment_size Number of rows per fragment
+ * @param[in] max_fragments Maximum number of fragments in a chunk
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -326,10 +471,20 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t *dev_scratch,
                                    size_t scratch_size,
                                    uint32_t num_chunks,
+                                   uint32_t fragment_size,
+                                   uint32_t max_fragments,
                                    cudaStream_t stream) {
   if (num_chunks > 0 && scratch_size > 0) {  // zero scratch size implies no dictionaries
+    dim3 dim_grid(num_chunks, max_fragments);
     CUDA_TRY(cudaMemsetAsync(dev_scratch, 0, scratch_size, stream));
-    gpuBuildChunkDictionaries<<<num_chunks, 1024, 0, stream>>>(chunks, dev_scratch);
+    gpuInsertDictionaryFragments<<<dim_grid, 1024, 0, stream>>>(chunks, dev_scratch, fragment_size);
+    gpuFindFirstDictionaryRows<<<dim_grid, 1024, 0, stream>>>(chunks, fragment_size);
+    gpuReorderDictionaryRoots<<<dim_grid, 1024, 0, stream>>>(chunks, fragment_size);
+    gpuCountDictionaryEntries<<<dim_grid, 1024, 0, stream>>>(chunks, fragment_size);
+    gpuSelectDictionaryFragments<<<(num_chunks + 127) / 128, 128, 0, stream>>>(
+      chunks, num_chunks, fragment_size);
+    gpuAssignDictionaryPositions<<<dim_grid, 1024, 0, stream>>>(chunks, fragment_size);
+    gpuResolveDictionaryIndices<<<dim_grid, 1024, 0, stream>>>(chunks, fragment_size);
   }
   return cudaSuccess;
 }
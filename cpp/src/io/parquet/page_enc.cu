@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <io/utilities/block_utils.cuh>
+#include "bloom_filter.h"
 #include "parquet_gpu.h"
 
 namespace cudf {
@@ -29,6 +30,7 @@ namespace gpu {
 struct frag_init_state_s {
   EncColumnDesc col;
   PageFragment frag;
+  uint32_t start_row;
   uint32_t total_dupes;
   volatile uint32_t scratch_red[32];
   uint32_t dict[MAX_PAGE_FRAGMENT_SIZE];
@@ -42,6 +44,9 @@ struct frag_init_state_s {
 #define RLE_BFRSZ (1 << LOG2_RLE_BFRSZ)
 #define RLE_MAX_LIT_RUN 0xfff8  // Maximum literal run for 2-byte run code
 
+#define DELTA_BLOCK_SIZE 128  // Values per DELTA_BINARY_PACKED block (4 miniblocks of 32 values)
+#define DELTA_BFRSZ (DELTA_BLOCK_SIZE * 2)
+
 struct page_enc_state_s {
   uint8_t *cur;          //!< current output ptr
   uint8_t *rle_out;      //!< current RLE write ptr
@@ -51,14 +56,22 @@ struct page_enc_state_s {
   uint32_t rle_numvals;  //!< RLE input value count
   uint32_t rle_lit_count;
   uint32_t rle_rpt_count;
+  uint32_t delta_pos;      //!< DELTA encoder position (first value not yet encoded)
+  uint32_t delta_numvals;  //!< DELTA encoder input value count
+  uint32_t delta_count;    //!< Total number of values in a DELTA-encoded page
   volatile uint32_t rpt_map[4];
   volatile uint32_t scratch_red[32];
+  volatile int64_t delta_min[4];
   EncPage page;
   EncColumnChunk ck;
   EncColumnDesc col;
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
-  uint16_t vals[RLE_BFRSZ];
+  union {
+    uint16_t vals[RLE_BFRSZ];
+    uint64_t delta_packed[DELTA_BLOCK_SIZE];  //!< Deltas of the current block, minus the min delta
+  };
+  int64_t delta_vals[DELTA_BFRSZ];
 };
 
 /**
@@ -110,10 +123,19 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
   __syncthreads();
-  start_row = blockIdx.y * fragment_size;
   if (!t) {
-    s->col.num_rows            = min(s->col.num_rows, max_num_rows);
-    s->frag.num_rows           = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    start_row = blockIdx.y * fragment_size;
+    if (s->col.level_offsets) {
+      // The rows of nested leaves are their values, num_rows being their total count
+      const uint32_t *lo = s->col.level_offsets;
+      uint32_t end_row   = lo[min(start_row + fragment_size, max_num_rows)];
+      start_row          = lo[min(start_row, max_num_rows)];
+      s->frag.num_rows   = end_row - start_row;
+    } else {
+      s->col.num_rows  = min(s->col.num_rows, max_num_rows);
+      s->frag.num_rows = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    }
+    s->start_row               = start_row;
     s->frag.non_nulls          = 0;
     s->frag.num_dict_vals      = 0;
     s->frag.fragment_data_size = 0;
@@ -129,7 +151,8 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len;
   }
   __syncthreads();
-  nrows = s->frag.num_rows;
+  start_row = s->start_row;
+  nrows     = s->frag.num_rows;
   for (uint32_t i = 0; i < nrows; i += 512) {
     const uint32_t *valid = s->col.valid_map_base;
     uint32_t row          = start_row + i + t;
@@ -358,8 +381,9 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   uint32_t column_id        = blockIdx.x;
   statistics_group *const g = &group_g[threadIdx.x >> 5];
   if (!t && frag_id < num_fragments) {
-    g->col       = &col_desc[column_id];
-    g->start_row = frag_id * fragment_size;
+    const uint32_t *lo = col_desc[column_id].level_offsets;
+    g->col             = &col_desc[column_id];
+    g->start_row       = (lo) ? lo[frag_id * fragment_size] : frag_id * fragment_size;
     g->num_rows  = fragments[column_id * num_fragments + frag_id].num_rows;
   }
   __syncthreads();
@@ -369,6 +393,31 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   }
 }
 
+/**
+ * @brief Returns the worst-case size of DELTA-encoded page values in excess of their PLAIN size
+ *
+ * @param[in] num_values Number of values in the page
+ **/
+inline __device__ uint32_t GetMaxDeltaEncodingOverhead(uint32_t num_values) {
+  // Page header, block headers (zigzag min delta and miniblock bit widths), and padding of the
+  // last miniblock to 32 values
+  return 18 + ((num_values + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE) * 14 + 32 * 8;
+}
+
+/**
+ * @brief Returns the encoding of the values of a page
+ *
+ * @param[in] page Encoder page
+ * @param[in] col Column description
+ **/
+inline __device__ int GetPageEncoding(const EncPage &page, const EncColumnDesc &col) {
+  if (page.page_type == DICTIONARY_PAGE || page.dict_bits_plus1 != 0) { return PLAIN_DICTIONARY; }
+  if (col.use_delta) {
+    return (col.physical_type == BYTE_ARRAY) ? DELTA_LENGTH_BYTE_ARRAY : DELTA_BINARY_PACKED;
+  }
+  return PLAIN;
+}
+
 // blockDim {128,1,1}
 __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     EncPage *pages,
@@ -376,7 +425,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     statistics_merge_group *page_grstats,
                                                     statistics_merge_group *chunk_grstats,
                                                     int32_t num_rowgroups,
-                                                    int32_t num_columns) {
+                                                    int32_t num_columns,
+                                                    uint32_t target_page_size) {
   __shared__ __align__(8) EncColumnDesc col_g;
   __shared__ __align__(8) EncColumnChunk ck_g;
   __shared__ __align__(8) PageFragment frag_g;
@@ -464,9 +514,12 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
       } else {
         fragment_data_size = frag_g.fragment_data_size;
       }
+      // Pages spanning a large share of the chunk are limited to a half or three quarters of
+      // the target size (256KB or 384KB by default), so that chunks have several pages
       max_page_size = (rows_in_page * 2 >= ck_g.num_rows)
-                        ? 256 * 1024
-                        : (rows_in_page * 3 >= ck_g.num_rows) ? 384 * 1024 : 512 * 1024;
+                        ? target_page_size / 2
+                        : (rows_in_page * 3 >= ck_g.num_rows) ? target_page_size / 4 * 3
+                                                              : target_page_size;
       if (num_rows >= ck_g.num_rows || page_size + fragment_data_size > max_page_size ||
           (ck_g.has_dictionary && rows_in_page > 0 &&
            fragments_in_chunk == ck_g.num_dict_fragments)) {
@@ -491,13 +544,19 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
           dict_bits_plus1 = dict_bits + 1;
         } else {
           dict_bits_plus1 = 0;
+          if (col_g.use_delta) { page_size += GetMaxDeltaEncodingOverhead(rows_in_page); }
         }
         if (!t) {
           uint32_t def_level_bits = col_g.level_bits & 0xf;
+          uint32_t rep_level_bits = col_g.level_bits >> 4;
           uint32_t def_level_size =
             (def_level_bits)
               ? 4 + 5 + ((def_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8)
               : 0;
+          if (rep_level_bits) {
+            def_level_size +=
+              4 + 5 + ((rep_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8);
+          }
           page_g.num_fragments   = fragments_in_chunk - page_start;
           page_g.chunk_id        = blockIdx.y * num_columns + blockIdx.x;
           page_g.page_type       = DATA_PAGE;
@@ -591,6 +650,19 @@ inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v) {
   return p;
 }
 
+/**
+ * @brief Zigzag-encode a signed integer as a variable-length integer
+ **/
+inline __device__ uint8_t *ZigZagVlqEncode(uint8_t *p, int64_t v) {
+  uint64_t u = (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+  while (u > 0x7f) {
+    *p++ = (u | 0x80);
+    u >>= 7;
+  }
+  *p++ = u;
+  return p;
+}
+
 /**
  * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
  **/
@@ -804,6 +876,149 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief DELTA_BINARY_PACKED encoder
+ *
+ * Values are encoded in blocks of 128 deltas (4 miniblocks of 32), one delta per thread; the
+ * page header holding the first value is written on the first call. INT64 deltas wrap around
+ * in 64 bits, all other deltas (INT32 values, string lengths) wrap around in 32 bits.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Total count of input values
+ * @param[in] flush nonzero if last batch in block
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncode(page_enc_state_s *s,
+                                   uint32_t numvals,
+                                   uint32_t flush,
+                                   uint32_t t) {
+  uint32_t delta_pos = s->delta_pos;
+  uint8_t *dst       = s->rle_out;
+  bool is_int64      = (s->col.physical_type == INT64);
+
+  if (delta_pos == 0 && (numvals != 0 || flush)) {
+    // Page header: block size, miniblocks per block, total value count and first value
+    if (!t) {
+      dst        = VlqEncode(dst, DELTA_BLOCK_SIZE);
+      dst        = VlqEncode(dst, DELTA_BLOCK_SIZE / 32);
+      dst        = VlqEncode(dst, s->delta_count);
+      dst        = ZigZagVlqEncode(dst, (numvals != 0) ? s->delta_vals[0] : 0);
+      s->rle_out = dst;
+    }
+    __syncthreads();
+    dst       = s->rle_out;
+    delta_pos = 1;
+  }
+  while (numvals >= delta_pos + DELTA_BLOCK_SIZE || (flush && numvals > delta_pos)) {
+    uint32_t nvals    = min(numvals - delta_pos, DELTA_BLOCK_SIZE);
+    uint32_t mb_start = 0;  // Byte offset of this thread's miniblock in the block data
+    int64_t delta     = 0, min_delta;
+    uint64_t v;
+    uint32_t w;
+    if (t < nvals) {
+      int64_t cur  = s->delta_vals[(delta_pos + t) & (DELTA_BFRSZ - 1)];
+      int64_t prev = s->delta_vals[(delta_pos + t - 1) & (DELTA_BFRSZ - 1)];
+      delta = (is_int64) ? static_cast<int64_t>(static_cast<uint64_t>(cur) -
+                                                static_cast<uint64_t>(prev))
+                         : static_cast<int32_t>(static_cast<uint32_t>(cur) -
+                                                static_cast<uint32_t>(prev));
+    }
+    // Minimum delta of the block
+    min_delta = (t < nvals) ? delta : INT64_MAX;
+    for (uint32_t i = 1; i < 32; i <<= 1) {
+      int64_t other = SHFL_XOR(min_delta, i);
+      min_delta     = (other < min_delta) ? other : min_delta;
+    }
+    if (!(t & 0x1f)) { s->delta_min[t >> 5] = min_delta; }
+    __syncthreads();
+    for (uint32_t i = 0; i < 4; i++) {
+      min_delta = (s->delta_min[i] < min_delta) ? s->delta_min[i] : min_delta;
+    }
+    // Bit width of each miniblock
+    v = (t < nvals) ? static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_delta) : 0;
+    w = 64 - __clzll(v);
+    for (uint32_t i = 1; i < 32; i <<= 1) { w = max(w, SHFL_XOR(w, i)); }
+    s->delta_packed[t] = v;
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = w; }
+    __syncthreads();
+    if (!t) {
+      uint8_t *p = ZigZagVlqEncode(dst, min_delta);
+      for (uint32_t i = 0; i < 4; i++) { p[i] = s->scratch_red[i]; }
+      s->rle_out = p + 4;
+    }
+    for (uint32_t i = 0; i < (t >> 5); i++) { mb_start += s->scratch_red[i] * 4; }
+    __syncthreads();
+    // Pack the 32 values of each miniblock, one output byte per thread
+    dst = s->rle_out;
+    for (uint32_t j = t & 0x1f; j < w * 4; j += 32) {
+      const uint64_t *mb = &s->delta_packed[t & ~0x1f];
+      uint32_t bitpos    = j * 8;
+      uint64_t b         = 0;
+      for (uint32_t k = bitpos / w; k < 32 && k * w < bitpos + 8; k++) {
+        b |= (k * w >= bitpos) ? mb[k] << (k * w - bitpos) : mb[k] >> (bitpos - k * w);
+      }
+      dst[mb_start + j] = static_cast<uint8_t>(b);
+    }
+    for (uint32_t i = 0; i < 4; i++) { dst += s->scratch_red[i] * 4; }
+    delta_pos += nvals;
+    __syncthreads();
+  }
+  if (!t) {
+    s->delta_pos     = delta_pos;
+    s->delta_numvals = numvals;
+    s->rle_out       = dst;
+  }
+  __syncthreads();
+}
+
+/**
+ * @brief Encode the levels of the values of a page as a RLE section prefixed by its length
+ *
+ * @param[in,out] s Page encoder state
+ * @param[in] levels Level of each value, or null to use the validity of the values
+ * @param[in] level_bits Bits of each level, nothing being encoded if zero
+ * @param[in] t Thread ID (0..127)
+ **/
+static __device__ void EncodeLevels(page_enc_state_s *s,
+                                    const uint8_t *levels,
+                                    uint32_t level_bits,
+                                    uint32_t t) {
+  const uint32_t *valid = s->col.valid_map_base;
+  if (level_bits == 0) { return; }
+  if (!t) {
+    s->rle_run     = 0;
+    s->rle_pos     = 0;
+    s->rle_numvals = 0;
+    s->rle_out     = s->cur + 4;
+  }
+  __syncthreads();
+  while (s->rle_numvals < s->page.num_rows) {
+    uint32_t rle_numvals = s->rle_numvals;
+    uint32_t nrows       = min(s->page.num_rows - rle_numvals, 128);
+    uint32_t row         = s->page.start_row + rle_numvals + t;
+    uint32_t lvl         = 0;
+    if (rle_numvals + t < s->page.num_rows && row < s->col.num_rows) {
+      lvl = (levels) ? levels[row] : (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1;
+    }
+    s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = lvl;
+    __syncthreads();
+    rle_numvals += nrows;
+    RleEncode(s, rle_numvals, level_bits, (rle_numvals == s->page.num_rows), t);
+    __syncthreads();
+  }
+  if (t < 32) {
+    uint8_t *cur     = s->cur;
+    uint8_t *rle_out = s->rle_out;
+    if (t < 4) {
+      uint32_t rle_bytes = (uint32_t)(rle_out - cur) - 4;
+      cur[t]             = rle_bytes >> (t * 8);
+    }
+    SYNCWARP();
+    if (t == 0) { s->cur = rle_out; }
+  }
+  __syncthreads();
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -815,7 +1030,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   page_enc_state_s *const s = &state_g;
   uint32_t t                = threadIdx.x;
   uint32_t dtype, dtype_len_in, dtype_len_out;
-  int32_t dict_bits;
+  int32_t dict_bits, encoding;
 
   if (t < sizeof(EncPage) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->page)[t] =
@@ -834,42 +1049,10 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   __syncthreads();
   if (!t) { s->cur = s->page.page_data + s->page.max_hdr_size; }
   __syncthreads();
-  // Encode NULLs
+  // Encode repetition levels, followed by definition levels (NULLs)
   if (s->page.page_type != DICTIONARY_PAGE && s->col.level_bits != 0) {
-    const uint32_t *valid = s->col.valid_map_base;
-    uint32_t def_lvl_bits = s->col.level_bits & 0xf;
-    if (def_lvl_bits != 0) {
-      if (!t) {
-        s->rle_run     = 0;
-        s->rle_pos     = 0;
-        s->rle_numvals = 0;
-        s->rle_out     = s->cur + 4;
-      }
-      __syncthreads();
-      while (s->rle_numvals < s->page.num_rows) {
-        uint32_t rle_numvals = s->rle_numvals;
-        uint32_t nrows       = min(s->page.num_rows - rle_numvals, 128);
-        uint32_t row         = s->page.start_row + rle_numvals + t;
-        uint32_t def_lvl     = (rle_numvals + t < s->page.num_rows && row < s->col.num_rows)
-                             ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
-                             : 0;
-        s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = def_lvl;
-        __syncthreads();
-        rle_numvals += nrows;
-        RleEncode(s, rle_numvals, def_lvl_bits, (rle_numvals == s->page.num_rows), t);
-        __syncthreads();
-      }
-      if (t < 32) {
-        uint8_t *cur     = s->cur;
-        uint8_t *rle_out = s->rle_out;
-        if (t < 4) {
-          uint32_t rle_bytes = (uint32_t)(rle_out - cur) - 4;
-          cur[t]             = rle_bytes >> (t * 8);
-        }
-        SYNCWARP();
-        if (t == 0) { s->cur = rle_out; }
-      }
-    }
+    EncodeLevels(s, s->col.rep_levels, s->col.level_bits >> 4, t);
+    EncodeLevels(s, s->col.def_levels, s->col.level_bits & 0xf, t);
   }
   // Encode data values
   __syncthreads();
@@ -882,6 +1065,25 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len_out;
   }
   dict_bits = (dtype == BOOLEAN) ? 1 : (s->page.dict_bits_plus1 - 1);
+  encoding  = GetPageEncoding(s->page, s->col);
+  if (encoding == DELTA_BINARY_PACKED || encoding == DELTA_LENGTH_BYTE_ARRAY) {
+    // The total number of values is stored in the header, ahead of the encoded values
+    const uint32_t *valid = s->col.valid_map_base;
+    uint32_t count        = 0;
+    for (uint32_t i = t; i < s->page.num_rows; i += 128) {
+      uint32_t row = s->page.start_row + i;
+      count += (row < s->col.num_rows) ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1 : 0;
+    }
+    count = WarpReduceSum32(count);
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = count; }
+    __syncthreads();
+    if (t == 0) {
+      s->delta_count =
+        s->scratch_red[0] + s->scratch_red[1] + s->scratch_red[2] + s->scratch_red[3];
+      s->delta_pos     = 0;
+      s->delta_numvals = 0;
+    }
+  }
   if (t == 0) {
     uint8_t *dst   = s->cur;
     s->rle_run     = 0;
@@ -943,6 +1145,47 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       }
       if (t == 0) { s->cur = s->rle_out; }
       __syncthreads();
+    } else if (encoding != PLAIN) {
+      // Delta encoding of the values, or of the string lengths
+      uint32_t delta_numvals;
+
+      pos = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+      if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+      __syncthreads();
+      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+      __syncthreads();
+      pos           = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+      delta_numvals = s->delta_numvals;
+      if (is_valid) {
+        const uint8_t *src8 =
+          reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+        int64_t v;
+        if (dtype == BYTE_ARRAY) {
+          v = reinterpret_cast<const nvstrdesc_s *>(src8)->count;
+        } else if (dtype == INT64) {
+          int32_t ts_scale = s->col.ts_scale;
+          v                = *reinterpret_cast<const int64_t *>(src8);
+          if (ts_scale != 0) {
+            if (ts_scale < 0) {
+              v /= -ts_scale;
+            } else {
+              v *= ts_scale;
+            }
+          }
+        } else if (dtype_len_in == 4) {
+          v = *reinterpret_cast<const int32_t *>(src8);
+        } else if (dtype_len_in == 2) {
+          v = *reinterpret_cast<const int16_t *>(src8);
+        } else {
+          v = *reinterpret_cast<const int8_t *>(src8);
+        }
+        s->delta_vals[(delta_numvals + pos) & (DELTA_BFRSZ - 1)] = v;
+      }
+      delta_numvals += s->scratch_red[3];
+      __syncthreads();
+      DeltaEncode(s, delta_numvals, (cur_row == s->page.num_rows), t);
+      if (t == 0) { s->cur = s->rle_out; }
+      __syncthreads();
     } else {
       // Non-dictionary encoding
       uint8_t *dst = s->cur;
@@ -1015,6 +1258,29 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       __syncthreads();
     }
   }
+  if (encoding == DELTA_LENGTH_BYTE_ARRAY) {
+    // The string data follows the encoded lengths
+    for (uint32_t cur_row = 0; cur_row < s->page.num_rows; cur_row += 128) {
+      const uint32_t *valid = s->col.valid_map_base;
+      uint32_t row          = s->page.start_row + cur_row + t;
+      uint32_t is_valid     = (row < s->col.num_rows && cur_row + t < s->page.num_rows)
+                            ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+                            : 0;
+      const nvstrdesc_s *str =
+        (is_valid) ? &reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base)[row] : nullptr;
+      uint32_t len = (is_valid) ? (uint32_t)str->count : 0;
+      uint32_t pos = WarpReducePos32(len, t);
+      if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = pos; }
+      __syncthreads();
+      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+      __syncthreads();
+      pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - len;
+      if (len != 0) { memcpy(s->cur + pos, str->ptr, len); }
+      __syncthreads();
+      if (t == 0) { s->cur += s->scratch_red[3]; }
+      __syncthreads();
+    }
+  }
   if (t == 0) {
     uint8_t *base                = s->page.page_data + s->page.max_hdr_size;
     uint32_t actual_data_size    = static_cast<uint32_t>(s->cur - base);
@@ -1275,13 +1541,9 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     // NOTE: For dictionary encoding, parquet v2 recommends using PLAIN in dictionary page and RLE_DICTIONARY in data page,
     // but parquet v1 uses PLAIN_DICTIONARY in both dictionary and data pages (actual encoding is identical).
 #if ENABLE_BOOL_RLE
-    int encoding =
-      (col_g.physical_type != BOOLEAN)
-        ? (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN
-        : RLE;
+    int encoding = (col_g.physical_type != BOOLEAN) ? GetPageEncoding(page_g, col_g) : RLE;
 #else
-    int encoding =
-      (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
+    int encoding = GetPageEncoding(page_g, col_g);
 #endif
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
@@ -1370,6 +1632,81 @@ __global__ void __launch_bounds__(1024)
   }
 }
 
+// blockDim(256, 1, 1)
+__global__ void __launch_bounds__(256) gpuBuildBloomFilters(BloomFilterChunk *filters) {
+  __shared__ __align__(8) BloomFilterChunk bf_g;
+  __shared__ __align__(8) EncColumnDesc col_g;
+
+  uint32_t t = threadIdx.x;
+  uint32_t dtype, dtype_len_in;
+
+  if (t < sizeof(BloomFilterChunk) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&bf_g)[t] =
+      reinterpret_cast<const uint32_t *>(&filters[blockIdx.x])[t];
+  }
+  __syncthreads();
+  if (t < sizeof(EncColumnDesc) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&col_g)[t] = reinterpret_cast<const uint32_t *>(bf_g.col_desc)[t];
+  }
+  __syncthreads();
+  dtype = col_g.physical_type;
+  if (dtype == INT32) {
+    uint32_t converted_type = col_g.converted_type;
+    dtype_len_in            = (converted_type == INT_8) ? 1 : (converted_type == INT_16) ? 2 : 4;
+  } else {
+    dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : (dtype == FLOAT) ? 4 : 8;
+  }
+  for (uint32_t i = (blockIdx.y * blockDim.x) + t; i < bf_g.num_rows;
+       i += gridDim.y * blockDim.x) {
+    uint32_t row = bf_g.start_row + i;
+    uint64_t hash;
+    if (row >= col_g.num_rows ||
+        (col_g.valid_map_base && !((col_g.valid_map_base[row >> 5] >> (row & 0x1f)) & 1))) {
+      continue;
+    }
+    // Hash the plain encoding of the value, as written by the page encoder
+    const uint8_t *src8 =
+      reinterpret_cast<const uint8_t *>(col_g.column_data_base) + row * (size_t)dtype_len_in;
+    switch (dtype) {
+      case INT32: {
+        int32_t v;
+        if (dtype_len_in == 4)
+          v = *reinterpret_cast<const int32_t *>(src8);
+        else if (dtype_len_in == 2)
+          v = *reinterpret_cast<const int16_t *>(src8);
+        else
+          v = *reinterpret_cast<const int8_t *>(src8);
+        hash = xxhash64_value(v);
+      } break;
+      case INT64: {
+        int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+        int32_t ts_scale = col_g.ts_scale;
+        if (ts_scale != 0) {
+          if (ts_scale < 0) {
+            v /= -ts_scale;
+          } else {
+            v *= ts_scale;
+          }
+        }
+        hash = xxhash64_value(v);
+      } break;
+      case FLOAT: hash = xxhash64_value(*reinterpret_cast<const uint32_t *>(src8)); break;
+      case DOUBLE: hash = xxhash64_value(*reinterpret_cast<const uint64_t *>(src8)); break;
+      case BYTE_ARRAY: {
+        const nvstrdesc_s *str = reinterpret_cast<const nvstrdesc_s *>(src8);
+        const uint8_t *ptr     = reinterpret_cast<const uint8_t *>(str->ptr);
+        hash                   = xxhash64(ptr, str->count);
+      } break;
+      default: continue;
+    }
+    uint32_t *block =
+      bf_g.bitset + bloom_filter_block(hash, bf_g.num_blocks) * BLOOM_FILTER_BLOCK_WORDS;
+    for (uint32_t w = 0; w < BLOOM_FILTER_BLOCK_WORDS; w++) {
+      atomicOr(&block[w], bloom_filter_mask(hash, w));
+    }
+  }
+}
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -1430,6 +1767,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] num_columns Number of columns
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
+ * @param[in] max_page_size Target uncompressed size of a page in bytes
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1441,10 +1779,17 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              int32_t num_columns,
                              statistics_merge_group *page_grstats,
                              statistics_merge_group *chunk_grstats,
+                             uint32_t max_page_size,
                              cudaStream_t stream) {
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, num_rowgroups, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream>>>(chunks,
+                                             pages,
+                                             col_desc,
+                                             page_grstats,
+                                             chunk_grstats,
+                                             num_rowgroups,
+                                             num_columns,
+                                             max_page_size);
   return cudaSuccess;
 }
 
@@ -1539,6 +1884,23 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
   return cudaSuccess;
 }
 
+/**
+ * @brief Launches kernel for inserting column chunk values into Bloom filters
+ *
+ * @param[in,out] filters Bloom filter of each column chunk
+ * @param[in] num_filters Number of Bloom filters
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk *filters,
+                              uint32_t num_filters,
+                              cudaStream_t stream) {
+  dim3 dim_grid(num_filters, 8);  // 8 threadblocks per column chunk
+  gpuBuildBloomFilters<<<dim_grid, 256, 0, stream>>>(filters);
+  return cudaSuccess;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -233,11 +233,13 @@ extern "C" __global__ void __launch_bounds__(128)
         if (gpuParsePageHeader(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case DATA_PAGE:
-              // TODO: Unless the file only uses V2 page headers or has no complex nesting (num_rows == num_values), we can't infer num_rows at this time
-              // -> we'll need another pass after decompression to parse the definition and repetition levels to infer the correct value of num_rows
-              bs->page.num_rows = bs->page.num_values;  // Assumes num_rows == num_values
-                                                        // Fall-through to V2
+              // Rows match values in non-repeated columns
+              bs->page.num_rows = bs->page.num_values;
+              // Fall-through to V2
             case DATA_PAGE_V2:
+              // Repeated columns are decoded by value, their rows being assembled from the
+              // repetition levels output by DecodePageLevels
+              if (bs->ck.max_rep_level > 0) { bs->page.num_rows = bs->page.num_values; }
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
               bs->page.flags = 0;
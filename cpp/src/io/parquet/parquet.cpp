@@ -16,6 +16,8 @@
 
 #include "parquet.h"
 
+#include <future>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -81,6 +83,57 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth) {
   return true;
 }
 
+/**
+ * @brief Parses a list of `n` structs
+ *
+ * Lists spanning enough bytes are split across the reader's workers, which parse the structs
+ * from their start positions found by a faster serial pass skipping over them
+ *
+ * @param[out] v Output structs
+ * @param[in] n Number of structs in the list
+ *
+ * @return True if all the structs were parsed successfully, false otherwise
+ **/
+template <typename T>
+bool CompactProtocolReader::read_struct_list(std::vector<T> &v, int n) {
+  constexpr size_t min_bytes_per_worker = 64 * 1024;
+
+  v.resize(n);
+  if (m_num_workers <= 1 || n <= 1) {
+    for (int32_t i = 0; i < n; i++) {
+      if (!read(&v[i])) return false;
+    }
+    return true;
+  }
+  std::vector<const uint8_t *> starts(n + 1);
+  for (int32_t i = 0; i < n; i++) {
+    starts[i] = m_cur;
+    if (!skip_struct_field(ST_FLD_STRUCT)) return false;
+  }
+  starts[n] = m_cur;
+  const size_t list_size = static_cast<size_t>(starts[n] - starts[0]);
+  const int num_workers  = static_cast<int>(std::min<size_t>(
+    std::min(m_num_workers, n), std::max<size_t>(list_size / min_bytes_per_worker, 1)));
+  // Workers of few large structs are left to parse the lists within them in parallel
+  auto parse = [&](int first, int last) {
+    CompactProtocolReader cp(starts[first], static_cast<size_t>(starts[last] - starts[first]));
+    cp.set_num_workers(m_num_workers / num_workers);
+    for (int32_t i = first; i < last; i++) {
+      if (!cp.read(&v[i])) return false;
+    }
+    return true;
+  };
+  if (num_workers <= 1) { return parse(0, n); }
+  std::vector<std::future<bool>> workers;
+  for (int w = 0; w < num_workers; w++) {
+    workers.emplace_back(
+      std::async(std::launch::async, parse, n * w / num_workers, n * (w + 1) / num_workers));
+  }
+  bool success = true;
+  for (auto &worker : workers) { success &= worker.get(); }
+  return success;
+}
+
 #define PARQUET_BEGIN_STRUCT(st)                                  \
   bool CompactProtocolReader::read(st *s) { /*printf(#st "\n");*/ \
     int fld = 0;                                                  \
@@ -145,6 +198,19 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth) {
       break;                                        \
     }
 
+#define PARQUET_FLD_STRUCT_LIST_PARALLEL(id, m)     \
+  case id:                                          \
+    if (t != ST_FLD_LIST) return false;             \
+    {                                               \
+      int n;                                        \
+      c = getb();                                   \
+      if ((c & 0xf) != ST_FLD_STRUCT) return false; \
+      n = c >> 4;                                   \
+      if (n == 0xf) n = get_u32();                  \
+      if (!read_struct_list(s->m, n)) return false; \
+      break;                                        \
+    }
+
 #define PARQUET_FLD_ENUM_LIST(id, m, mt)                       \
   case id:                                                     \
     if (t != ST_FLD_LIST) return false;                        \
@@ -180,6 +246,34 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth) {
       break;                                        \
     }
 
+#define PARQUET_FLD_BOOL_LIST(id, m)                                           \
+  case id:                                                                     \
+    if (t != ST_FLD_LIST) return false;                                        \
+    {                                                                          \
+      int n;                                                                   \
+      c = getb();                                                              \
+      if ((c & 0xf) != ST_FLD_TRUE && (c & 0xf) != ST_FLD_FALSE) return false; \
+      n = c >> 4;                                                              \
+      if (n == 0xf) n = get_u32();                                             \
+      s->m.resize(n);                                                          \
+      for (int32_t i = 0; i < n; i++) s->m[i] = (getb() == ST_FLD_TRUE);       \
+      break;                                                                   \
+    }
+
+#define PARQUET_FLD_INT64_LIST(id, m)                                     \
+  case id:                                                                \
+    if (t != ST_FLD_LIST) return false;                                   \
+    {                                                                     \
+      int n;                                                              \
+      c = getb();                                                         \
+      if ((c & 0xf) < ST_FLD_I16 || (c & 0xf) > ST_FLD_I64) return false; \
+      n = c >> 4;                                                         \
+      if (n == 0xf) n = get_u32();                                        \
+      s->m.resize(n);                                                     \
+      for (int32_t i = 0; i < n; i++) s->m[i] = get_i64();                \
+      break;                                                              \
+    }
+
 #define PARQUET_FLD_STRUCT(id, m)                         \
   case id:                                                \
     if (t != ST_FLD_STRUCT || !read(&s->m)) return false; \
@@ -195,6 +289,20 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth) {
       break;                                            \
     }
 
+// Thrift unions are encoded as a struct with a single field: only keep the id
+// of the selected member and skip over its contents
+#define PARQUET_FLD_UNION_ID(id, m)                  \
+  case id:                                           \
+    if (t != ST_FLD_STRUCT) return false;            \
+    {                                                \
+      int u = getb();                                \
+      if (!u) return false;                          \
+      s->m = (u >> 4) ? (u >> 4) : get_i16();        \
+      if (!skip_struct_field(u & 0xf)) return false; \
+      if (getb() != 0) return false;                 \
+    }                                                \
+    break;
+
 #define PARQUET_END_STRUCT()                                                        \
   default: /*printf("unknown fld %d of type %d\n", fld, t);*/ skip_struct_field(t); \
     }                                                                               \
@@ -206,7 +314,7 @@ PARQUET_BEGIN_STRUCT(FileMetaData)
 PARQUET_FLD_INT32(1, version)
 PARQUET_FLD_STRUCT_LIST(2, schema)
 PARQUET_FLD_INT64(3, num_rows)
-PARQUET_FLD_STRUCT_LIST(4, row_groups)
+PARQUET_FLD_STRUCT_LIST_PARALLEL(4, row_groups)
 PARQUET_FLD_STRUCT_LIST(5, key_value_metadata)
 PARQUET_FLD_STRING(6, created_by)
 PARQUET_END_STRUCT()
@@ -223,7 +331,7 @@ PARQUET_FLD_INT32(8, decimal_precision)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(RowGroup)
-PARQUET_FLD_STRUCT_LIST(1, columns)
+PARQUET_FLD_STRUCT_LIST_PARALLEL(1, columns)
 PARQUET_FLD_INT64(2, total_byte_size)
 PARQUET_FLD_INT64(3, num_rows)
 PARQUET_END_STRUCT()
@@ -250,6 +358,8 @@ PARQUET_FLD_INT64(9, data_page_offset)
 PARQUET_FLD_INT64(10, index_page_offset)
 PARQUET_FLD_INT64(11, dictionary_page_offset)
 PARQUET_FLD_STRUCT_BLOB(12, statistics_blob)
+PARQUET_FLD_INT64(14, bloom_filter_offset)
+PARQUET_FLD_INT32(15, bloom_filter_length)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(PageHeader)
@@ -265,6 +375,7 @@ PARQUET_FLD_INT32(1, num_values)
 PARQUET_FLD_ENUM(2, encoding, Encoding);
 PARQUET_FLD_ENUM(3, definition_level_encoding, Encoding);
 PARQUET_FLD_ENUM(4, repetition_level_encoding, Encoding);
+PARQUET_FLD_STRUCT(5, statistics)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(DictionaryPageHeader)
@@ -277,6 +388,40 @@ PARQUET_FLD_STRING(1, key)
 PARQUET_FLD_STRING(2, value)
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(Statistics)
+PARQUET_FLD_STRING(1, max)
+PARQUET_FLD_STRING(2, min)
+PARQUET_FLD_INT64(3, null_count)
+PARQUET_FLD_INT64(4, distinct_count)
+PARQUET_FLD_STRING(5, max_value)
+PARQUET_FLD_STRING(6, min_value)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(PageLocation)
+PARQUET_FLD_INT64(1, offset)
+PARQUET_FLD_INT32(2, compressed_page_size)
+PARQUET_FLD_INT64(3, first_row_index)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(OffsetIndex)
+PARQUET_FLD_STRUCT_LIST(1, page_locations)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(ColumnIndex)
+PARQUET_FLD_BOOL_LIST(1, null_pages)
+PARQUET_FLD_STRING_LIST(2, min_values)
+PARQUET_FLD_STRING_LIST(3, max_values)
+PARQUET_FLD_ENUM(4, boundary_order, BoundaryOrder)
+PARQUET_FLD_INT64_LIST(5, null_counts)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(BloomFilterHeader)
+PARQUET_FLD_INT32(1, num_bytes)
+PARQUET_FLD_UNION_ID(2, algorithm)
+PARQUET_FLD_UNION_ID(3, hash)
+PARQUET_FLD_UNION_ID(4, compression)
+PARQUET_END_STRUCT()
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -393,6 +538,21 @@ int CompactProtocolReader::WalkSchema(std::vector<SchemaElement> &schema,
   for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
   cur_fld = id;
 
+#define CPW_FLD_INT64_LIST(id, m)                                           \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                       \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_I64)); \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                            \
+  for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
+  cur_fld = id;
+
+// List elements of type bool are encoded as a byte each (ST_FLD_TRUE or ST_FLD_FALSE)
+#define CPW_FLD_BOOL_LIST(id, m)                                                         \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                                    \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));             \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                                         \
+  for (auto i = 0; i < s->m.size(); i++) { putb(s->m[i] ? ST_FLD_TRUE : ST_FLD_FALSE); } \
+  cur_fld = id;
+
 #define CPW_FLD_STRING_LIST(id, m)                                                     \
   put_fldh(id, cur_fld, ST_FLD_LIST);                                                  \
   putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));         \
@@ -422,6 +582,14 @@ int CompactProtocolReader::WalkSchema(std::vector<SchemaElement> &schema,
   putb(reinterpret_cast<const uint8_t *>(s->m.data()), (uint32_t)s->m.size()); \
   cur_fld = id;
 
+// Writes a union whose selected member is an empty struct
+#define CPW_FLD_UNION_ID(id, m)         \
+  put_fldh(id, cur_fld, ST_FLD_STRUCT); \
+  put_fldh(s->m, 0, ST_FLD_STRUCT);     \
+  putb(0);                              \
+  putb(0);                              \
+  cur_fld = id;
+
 #define CPW_END_STRUCT()                   \
   putb(0);                                 \
   return m_buf->size() - struct_start_pos; \
@@ -502,6 +670,35 @@ CPW_FLD_INT64(9, data_page_offset)
 if (s->index_page_offset != 0) { CPW_FLD_INT64(10, index_page_offset) }
 if (s->dictionary_page_offset != 0) { CPW_FLD_INT64(11, dictionary_page_offset) }
 if (s->statistics_blob.size() != 0) { CPW_FLD_STRUCT_BLOB(12, statistics_blob); }
+if (s->bloom_filter_offset != 0) {
+  CPW_FLD_INT64(14, bloom_filter_offset)
+  CPW_FLD_INT32(15, bloom_filter_length)
+}
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(BloomFilterHeader)
+CPW_FLD_INT32(1, num_bytes)
+CPW_FLD_UNION_ID(2, algorithm)
+CPW_FLD_UNION_ID(3, hash)
+CPW_FLD_UNION_ID(4, compression)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(PageLocation)
+CPW_FLD_INT64(1, offset)
+CPW_FLD_INT32(2, compressed_page_size)
+CPW_FLD_INT64(3, first_row_index)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(OffsetIndex)
+CPW_FLD_STRUCT_LIST(1, page_locations)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(ColumnIndex)
+CPW_FLD_BOOL_LIST(1, null_pages)
+CPW_FLD_STRING_LIST(2, min_values)
+CPW_FLD_STRING_LIST(3, max_values)
+CPW_FLD_INT32(4, boundary_order)
+if (s->null_counts.size() != 0) { CPW_FLD_INT64_LIST(5, null_counts) }
 CPW_END_STRUCT()
 
 }  // namespace parquet
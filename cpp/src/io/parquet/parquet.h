@@ -87,6 +87,25 @@ struct ColumnMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;  // Byte offset from beginning of file to the Bloom filter
+  int32_t bloom_filter_length = 0;  // Size of the Bloom filter, including its header
+};
+
+/**
+ * @brief Thrift-derived struct describing column chunk or page statistics
+ *
+ * The min/max values are stored in plain (little-endian, unpadded) encoding of
+ * the column's physical type. The deprecated `min`/`max` fields use signed
+ * comparison for all types, so the newer `min_value`/`max_value` fields are
+ * preferred whenever they are present.
+ **/
+struct Statistics {
+  std::string max;              // deprecated max value in signed comparison order
+  std::string min;              // deprecated min value in signed comparison order
+  int64_t null_count     = -1;  // count of null values in the column (-1 if not set)
+  int64_t distinct_count = -1;  // count of distinct values occurring (-1 if not set)
+  std::string max_value;        // max value for the column, determined by its ColumnOrder
+  std::string min_value;        // min value for the column, determined by its ColumnOrder
 };
 
 /**
@@ -155,6 +174,7 @@ struct DataPageHeader {
   Encoding encoding                  = PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;  // Optional statistics of the values in the page
 };
 
 /**
@@ -182,6 +202,53 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page in the file
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within its row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of each data page of a
+ * column chunk (page index)
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column
+ * chunk (page index)
+ *
+ * Each list contains one entry per data page, in the same order as the pages
+ * in the corresponding OffsetIndex.
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;              // Whether each page only contains null values
+  std::vector<std::string> min_values;       // Plain-encoded min value of each page
+  std::vector<std::string> max_values;       // Plain-encoded max value of each page
+  BoundaryOrder boundary_order = UNORDERED;  // Whether min/max values are ordered across pages
+  std::vector<int64_t> null_counts;          // Optional count of null values in each page
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a split block Bloom
+ * filter, which is followed by `num_bytes` bytes of filter blocks
+ *
+ * The algorithm, hash and compression fields are unions; only the id of the
+ * selected union member is kept (1 = BLOCK, XXHASH and UNCOMPRESSED, the only
+ * members currently defined by the format).
+ **/
+struct BloomFilterHeader {
+  int32_t num_bytes   = 0;  // Size of the filter bitset in bytes
+  int32_t algorithm   = 0;  // Bloom filter algorithm (1 = split block)
+  int32_t hash        = 0;  // Hash function applied to the values (1 = xxHash64)
+  int32_t compression = 0;  // Compression of the bitset (1 = uncompressed)
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  **/
@@ -221,6 +288,11 @@ class CompactProtocolReader {
 
  public:
   explicit CompactProtocolReader(const uint8_t *base = nullptr, size_t len = 0) { init(base, len); }
+  /**
+   * @brief Sets the number of host threads that large lists of row groups and column chunks
+   * are parsed with
+   **/
+  void set_num_workers(int num_workers) noexcept { m_num_workers = std::max(num_workers, 1); }
   void init(const uint8_t *base, size_t len) {
     m_base = m_cur = base;
     m_end          = base + len;
@@ -266,6 +338,8 @@ class CompactProtocolReader {
     return sz;
   }
   bool skip_struct_field(int t, int depth = 0);
+  template <typename T>
+  bool read_struct_list(std::vector<T> &v, int n);
 
  public:
   // Generate Thrift structure parsing routines
@@ -279,6 +353,11 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
+  DECL_PARQUET_STRUCT(BloomFilterHeader);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -298,6 +377,7 @@ class CompactProtocolReader {
   const uint8_t *m_base = nullptr;
   const uint8_t *m_cur  = nullptr;
   const uint8_t *m_end  = nullptr;
+  int m_num_workers     = 1;
 };
 
 /**
@@ -345,6 +425,10 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnMetaData);
+  DECL_CPW_STRUCT(BloomFilterHeader);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
 #undef DECL_CPW_STRUCT
 
  protected:
@@ -32,6 +32,7 @@ namespace gpu {
  **/
 enum {
   PAGEINFO_FLAGS_DICTIONARY = 0x01,  // Indicates a dictionary page
+  PAGEINFO_FLAGS_SKIP       = 0x02,  // Indicates a data page without any rows to output
 };
 
 /**
@@ -102,7 +103,11 @@ struct ColumnChunkDesc {
       codec(codec_),
       converted_type(converted_type_),
       decimal_scale(decimal_scale_),
-      ts_clock_rate(ts_clock_rate_) {}
+      ts_clock_rate(ts_clock_rate_),
+      dict_key_offset(-1),
+      str_data(nullptr),
+      direct_strings(0),
+      levels_base(nullptr) {}
 
   uint8_t *compressed_data;     // pointer to compressed column chunk data
   size_t compressed_size;       // total compressed data size for this chunk
@@ -127,10 +132,17 @@ struct ColumnChunkDesc {
   int8_t converted_type;        // converted type enum
   int8_t decimal_scale;         // decimal scale pow(10, -decimal_scale)
   int32_t ts_clock_rate;  // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
+  int32_t dict_key_offset;  // if non-negative, output dictionary indices offset by this value
+  uint8_t *str_data;        // chars that strings are copied into, at their output offsets
+  int8_t direct_strings;    // nonzero if strings are output as lengths/offsets, not descriptors
+  uint8_t *levels_base;     // if non-null, definition and repetition level pairs are output here
 };
 
 /**
  * @brief Struct describing an encoder column
+ *
+ * The rows of the leaf of a nested column are its values, one per pair of levels, and
+ * `level_offsets` maps the rows of the table to them
  **/
 struct EncColumnDesc : stats_column_desc {
   uint32_t *dict_index;    //!< Dictionary index [row]
@@ -139,7 +151,10 @@ struct EncColumnDesc : stats_column_desc {
   uint8_t converted_type;  //!< logical data type
   uint8_t
     level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble) levels
-  uint8_t pad;
+  uint8_t use_delta;  //!< nonzero to use DELTA encodings instead of PLAIN for non-dictionary pages
+  const uint32_t *level_offsets;  //!< First value of each row [row + 1] if nested, or null
+  const uint8_t *def_levels;      //!< Definition level of each value if nested, or null
+  const uint8_t *rep_levels;      //!< Repetition level of each value if nested, or null
 };
 
 #define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
@@ -150,7 +165,7 @@ struct EncColumnDesc : stats_column_desc {
 struct PageFragment {
   uint32_t fragment_data_size;  //!< Size of fragment data in bytes
   uint32_t dict_data_size;      //!< Size of dictionary for this fragment
-  uint16_t num_rows;            //!< Number of rows in fragment
+  uint16_t num_rows;            //!< Number of rows in fragment (values if nested)
   uint16_t non_nulls;           //!< Number of non-null values
   uint16_t num_dict_vals;       //!< Number of unique dictionary entries
   uint16_t pad;
@@ -169,8 +184,8 @@ struct EncPage {
   uint32_t hdr_size;         //!< Size of page header
   uint32_t max_hdr_size;     //!< Maximum size of page header
   uint32_t max_data_size;    //!< Maximum size of coded page data (excluding header)
-  uint32_t start_row;        //!< First row of page
-  uint32_t num_rows;         //!< Rows in page
+  uint32_t start_row;        //!< First row of page (value if nested)
+  uint32_t num_rows;         //!< Rows in page (values if nested)
 };
 
 /// Size of hash used for building dictionaries
@@ -196,8 +211,8 @@ struct EncColumnChunk {
   const statistics_chunk *stats;  //!< Fragment statistics
   uint32_t bfr_size;              //!< Uncompressed buffer size
   uint32_t compressed_size;       //!< Compressed buffer size
-  uint32_t start_row;             //!< First row of chunk
-  uint32_t num_rows;              //!< Number of rows in chunk
+  uint32_t start_row;             //!< First row of chunk (value if nested)
+  uint32_t num_rows;              //!< Number of rows in chunk (values if nested)
   uint32_t first_fragment;        //!< First fragment of chunk
   uint32_t first_page;            //!< First page of chunk
   uint32_t num_pages;             //!< Number of pages in chunk
@@ -210,6 +225,17 @@ struct EncColumnChunk {
   uint32_t ck_stat_size;          //!< Size of chunk-level statistics (included in 1st page header)
 };
 
+/**
+ * @brief Struct describing the split block Bloom filter of an encoder column chunk
+ **/
+struct BloomFilterChunk {
+  const EncColumnDesc *col_desc;  //!< Column description
+  uint32_t *bitset;               //!< Filter blocks (BLOOM_FILTER_BLOCK_WORDS words per block)
+  uint32_t num_blocks;            //!< Number of blocks in the filter
+  uint32_t start_row;             //!< First row of chunk
+  uint32_t num_rows;              //!< Number of rows in chunk
+};
+
 /**
  * @brief Launches kernel for parsing the page headers in the column chunks
  *
@@ -261,6 +287,58 @@ cudaError_t DecodePageData(PageInfo *pages,
                            size_t min_row      = 0,
                            cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for outputting the definition and repetition levels of the pages of the
+ * column chunks with a `levels_base`
+ *
+ * Each value is output as a pair of bytes, its definition level followed by its repetition
+ * level. Chunks of repeated columns are output by value: all their values are output, at their
+ * position from `start_row`. The values of the other chunks are their rows, and only those in
+ * the row range are output.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] num_rows Total number of rows to read
+ * @param[in] min_row Minimum number of rows to read, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodePageLevels(PageInfo *pages,
+                             int32_t num_pages,
+                             ColumnChunkDesc *chunks,
+                             int32_t num_chunks,
+                             size_t num_rows,
+                             size_t min_row      = 0,
+                             cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for copying the strings of the column chunks with `direct_strings` set
+ * into their chars
+ *
+ * The strings are copied at the offsets held in place of their lengths in the column data, which
+ * are first output by DecodePageData and then exclusive-scanned
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] num_rows Total number of rows to read
+ * @param[in] min_row Minimum number of rows to read, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodePageStrings(PageInfo *pages,
+                              int32_t num_pages,
+                              ColumnChunkDesc *chunks,
+                              int32_t num_chunks,
+                              size_t num_rows,
+                              size_t min_row      = 0,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -313,6 +391,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] num_columns Number of columns
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
+ * @param[in] max_page_size Target uncompressed size of a page in bytes
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -324,6 +403,7 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              int32_t num_columns,
                              statistics_merge_group *page_grstats  = nullptr,
                              statistics_merge_group *chunk_grstats = nullptr,
+                             uint32_t max_page_size                = 512 * 1024,
                              cudaStream_t stream                   = (cudaStream_t)0);
 
 /**
@@ -406,12 +486,17 @@ cudaError_t GatherPages(EncColumnChunk *chunks,
                         cudaStream_t stream = (cudaStream_t)0);
 
 /**
- * @brief Launches kernel for building chunk dictionaries
+ * @brief Launches kernels for building chunk dictionaries
  *
- * @param[in] chunks Column chunks
+ * Chunks whose dictionary would not be smaller than their plain encoding are
+ * reverted to plain encoding (`has_dictionary` is cleared).
+ *
+ * @param[in,out] chunks Column chunks
  * @param[in] dev_scratch Device scratch data (kDictScratchSize bytes per dictionary)
  * @param[in] scratch_size size of scratch data in bytes
  * @param[in] num_chunks Number of column chunks
+ * @param[in] fragment_size Number of rows per fragment
+ * @param[in] max_fragments Maximum number of fragments in a chunk
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -420,8 +505,26 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t *dev_scratch,
                                    size_t scratch_size,
                                    uint32_t num_chunks,
+                                   uint32_t fragment_size,
+                                   uint32_t max_fragments,
                                    cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for inserting the non-null values of column chunks
+ * into their Bloom filters
+ *
+ * The filter bitsets must be zero-initialized by the caller.
+ *
+ * @param[in,out] filters Bloom filter of each column chunk
+ * @param[in] num_filters Number of Bloom filters
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk *filters,
+                              uint32_t num_filters,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file partitioned_writer.cu
+ * @brief cuDF-IO writer of Hive-style partitioned Parquet datasets
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <sys/stat.h>
+#include <cerrno>
+#include <list>
+#include <map>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+namespace {
+
+constexpr char const* default_partition_name = "__HIVE_DEFAULT_PARTITION__";
+
+/**
+ * @brief Escapes the characters of a partition directory name that Hive escapes
+ */
+std::string escape_path_name(std::string const& name) {
+  static std::string const special = "\"#%'*/:=?\\\x7f{[]^";
+  static char const hex[]          = "0123456789ABCDEF";
+  std::string escaped;
+  for (char c : name) {
+    auto const u = static_cast<uint8_t>(c);
+    if (u < 0x20 || special.find(c) != std::string::npos) {
+      escaped += '%';
+      escaped += hex[u >> 4];
+      escaped += hex[u & 0xf];
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Converts partition keys to the strings of their directory names
+ */
+std::unique_ptr<column> keys_to_strings(column_view const& keys) {
+  switch (keys.type().id()) {
+    case BOOL8: return strings::from_booleans(keys);
+    case INT8:
+    case INT16:
+    case INT32:
+    case INT64: return strings::from_integers(keys);
+    case FLOAT32:
+    case FLOAT64: return strings::from_floats(keys);
+    case TIMESTAMP_DAYS: return strings::from_timestamps(keys, "%Y-%m-%d");
+    case STRING: return std::make_unique<column>(keys);
+    default: CUDF_FAIL("Unsupported partition column type");
+  }
+}
+
+/**
+ * @brief Returns the escaped directory names of the values of a partition column
+ */
+std::vector<std::string> partition_values(column_view const& keys, cudaStream_t stream) {
+  auto const strings = keys_to_strings(keys);
+  strings_column_view const scv(strings->view());
+  size_type const num_values = scv.size();
+  std::vector<size_type> offsets(num_values + 1);
+  CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                           scv.offsets().data<size_type>() + scv.offset(),
+                           offsets.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  std::vector<char> chars(offsets.back() - offsets.front());
+  CUDA_TRY(cudaMemcpyAsync(chars.data(),
+                           scv.chars().data<char>() + offsets.front(),
+                           chars.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  std::vector<bitmask_type> null_mask(scv.has_nulls() ? num_bitmask_words(num_values) : 0);
+  if (scv.has_nulls()) {
+    auto const mask = copy_bitmask(strings->view(), stream);
+    CUDA_TRY(cudaMemcpyAsync(null_mask.data(),
+                             mask.data(),
+                             null_mask.size() * sizeof(bitmask_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDF_STREAM_SYNC(stream);
+
+  std::vector<std::string> values(num_values);
+  for (size_type i = 0; i < num_values; ++i) {
+    if (!null_mask.empty() && !bit_is_set(null_mask.data(), i)) {
+      values[i] = default_partition_name;
+    } else {
+      values[i] = escape_path_name(std::string(chars.data() + offsets[i] - offsets.front(),
+                                               offsets[i + 1] - offsets[i]));
+    }
+  }
+  return values;
+}
+
+/**
+ * @brief Creates a directory and its missing parents
+ */
+void create_directories(std::string const& path) {
+  for (size_t pos = path.find('/', 1); pos != std::string::npos; pos = path.find('/', pos + 1)) {
+    auto const parent = path.substr(0, pos);
+    CUDF_EXPECTS(mkdir(parent.c_str(), 0755) == 0 || errno == EEXIST,
+                 "Cannot create directory " + parent);
+  }
+  CUDF_EXPECTS(mkdir(path.c_str(), 0755) == 0 || errno == EEXIST,
+               "Cannot create directory " + path);
+}
+
+}  // namespace
+
+struct partitioned_parquet_writer::impl {
+  /// The chunked writer of the open file of a partition
+  struct open_file {
+    std::unique_ptr<cudf::io::data_sink> sink;
+    std::shared_ptr<detail::parquet::pq_chunked_state> state;
+    std::list<std::string>::iterator lru_pos;
+  };
+
+  write_partitioned_parquet_args args;
+  rmm::mr::device_memory_resource* mr;
+  size_type num_columns = -1;
+  std::vector<size_type> data_columns;  ///< Columns written to the files
+  std::vector<std::string> key_names;   ///< Names of the partition columns
+  table_metadata_with_nullability user_metadata;
+  table_metadata_with_nullability data_metadata;  ///< Metadata of the columns written to the files
+  std::map<std::string, open_file> open_files;  ///< Open files by partition directory
+  std::list<std::string> lru;                   ///< Open partitions, most recently written first
+  std::map<std::string, int> num_files;         ///< Number of files of each partition
+  std::vector<std::string> files;
+
+  impl(write_partitioned_parquet_args const& args_, rmm::mr::device_memory_resource* mr_)
+    : args(args_), mr(mr_) {
+    CUDF_EXPECTS(not args.partition_columns.empty(), "No partition columns");
+    CUDF_EXPECTS(args.max_open_files > 0, "Invalid number of open files");
+    // have to make a copy of the metadata here since we can't really
+    // guarantee the lifetime of the incoming pointer
+    if (args.metadata != nullptr) { user_metadata = *args.metadata; }
+  }
+
+  void setup_columns(table_view const& table) {
+    num_columns = table.num_columns();
+    std::vector<bool> is_key(num_columns, false);
+    for (auto c : args.partition_columns) {
+      CUDF_EXPECTS(c >= 0 && c < num_columns, "Invalid partition column index");
+      is_key[c] = true;
+    }
+    CUDF_EXPECTS(user_metadata.column_nullable.empty() ||
+                   user_metadata.column_nullable.size() == static_cast<size_t>(num_columns),
+                 "When passing values in user_metadata_with_nullability, data for all columns must "
+                 "be specified");
+    auto const column_name = [this](size_type c) {
+      return (static_cast<size_t>(c) < user_metadata.column_names.size())
+               ? user_metadata.column_names[c]
+               : "_col" + std::to_string(c);
+    };
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (is_key[c]) { continue; }
+      data_columns.push_back(c);
+      data_metadata.column_names.push_back(column_name(c));
+      if (!user_metadata.column_nullable.empty()) {
+        data_metadata.column_nullable.push_back(user_metadata.column_nullable[c]);
+      }
+    }
+    CUDF_EXPECTS(not data_columns.empty(), "No columns to write besides the partition columns");
+    for (auto c : args.partition_columns) { key_names.push_back(escape_path_name(column_name(c))); }
+    data_metadata.user_data = user_metadata.user_data;
+  }
+
+  void close_file(std::string const& partition) {
+    auto it = open_files.find(partition);
+    write_parquet_chunked_end(it->second.state);
+    lru.erase(it->second.lru_pos);
+    open_files.erase(it);
+  }
+
+  open_file& get_file(std::string const& partition) {
+    auto it = open_files.find(partition);
+    if (it != open_files.end()) {
+      lru.splice(lru.begin(), lru, it->second.lru_pos);
+      return it->second;
+    }
+    if (open_files.size() >= args.max_open_files) { close_file(lru.back()); }
+
+    auto const path =
+      partition + "/part-" + std::to_string(num_files[partition]++) + ".parquet";
+    files.push_back(path);
+    open_file file;
+    sink_info sink;
+    if (args.sink_factory) {
+      file.sink = args.sink_factory(path);
+      sink      = sink_info{file.sink.get()};
+    } else {
+      create_directories(args.base_path + "/" + partition);
+      sink = sink_info{args.base_path + "/" + path};
+    }
+    write_parquet_chunked_args chunked_args{
+      sink, &data_metadata, args.compression, args.stats_level};
+    chunked_args.compression_level = args.compression_level;
+    file.state                     = write_parquet_chunked_begin(chunked_args, mr);
+    lru.push_front(partition);
+    file.lru_pos = lru.begin();
+    return open_files.emplace(partition, std::move(file)).first->second;
+  }
+
+  void write(table_view const& table, cudaStream_t stream = 0) {
+    if (num_columns < 0) { setup_columns(table); }
+    CUDF_EXPECTS(table.num_columns() == num_columns,
+                 "Mismatch in table structure between multiple calls to write");
+    if (table.num_rows() == 0) { return; }
+
+    // Sorting the rows by partition makes each partition a contiguous slice
+    groupby::detail::sort::sort_groupby_helper helper(table.select(args.partition_columns),
+                                                      include_nulls::YES);
+    auto const sorted = experimental::gather(
+      table.select(data_columns), helper.key_sort_order(stream), false, mr, stream);
+    thrust::host_vector<size_type> const offsets(helper.group_offsets(stream));
+    auto const keys = helper.unique_keys(mr, stream);
+
+    std::vector<std::vector<std::string>> values;
+    for (auto const& key : keys->view()) { values.push_back(partition_values(key, stream)); }
+    std::vector<size_type> ranges;
+    for (size_t g = 0; g + 1 < offsets.size(); ++g) {
+      ranges.push_back(offsets[g]);
+      ranges.push_back(offsets[g + 1]);
+    }
+    auto const slices = experimental::slice(sorted->view(), ranges);
+    for (size_t g = 0; g + 1 < offsets.size(); ++g) {
+      std::string partition;
+      for (size_t k = 0; k < key_names.size(); ++k) {
+        if (k > 0) { partition += '/'; }
+        partition += key_names[k] + "=" + values[k][g];
+      }
+      write_parquet_chunked(slices[g], get_file(partition).state);
+    }
+  }
+
+  std::vector<std::string> close() {
+    while (not lru.empty()) { close_file(lru.back()); }
+    return files;
+  }
+};
+
+partitioned_parquet_writer::partitioned_parquet_writer(
+  write_partitioned_parquet_args const& args, rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(args, mr)) {}
+
+partitioned_parquet_writer::~partitioned_parquet_writer() {
+  try {
+    _impl->close();
+  } catch (...) {
+  }
+}
+
+void partitioned_parquet_writer::write(table_view const& table) {
+  CUDF_FUNC_RANGE();
+  _impl->write(table);
+}
+
+std::vector<std::string> partitioned_parquet_writer::close() {
+  CUDF_FUNC_RANGE();
+  return _impl->close();
+}
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
@@ -20,9 +20,20 @@
  */
 
 #include "reader_impl.hpp"
+#include "bloom_filter.h"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/file_metadata_cache.hpp>
+#include <io/utilities/predicate_utils.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -30,9 +41,21 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <limits>
 #include <regex>
+#include <thread>
 
 namespace cudf {
 namespace experimental {
@@ -53,7 +76,8 @@ constexpr type_id to_type_id(parquet::Type physical,
                              parquet::ConvertedType logical,
                              bool strings_to_categorical,
                              type_id timestamp_type_id,
-                             int32_t decimal_scale) {
+                             int32_t decimal_scale,
+                             bool decimals_as_float) {
   // Logical type used for actual data interpretation; the legacy converted type
   // is superceded by 'logical' type whenever available.
   switch (logical) {
@@ -69,6 +93,8 @@ constexpr type_id to_type_id(parquet::Type physical,
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_MILLISECONDS;
     case parquet::DECIMAL:
+      if (!decimals_as_float && physical == parquet::INT32) { return type_id::DECIMAL32; }
+      if (!decimals_as_float && physical == parquet::INT64) { return type_id::DECIMAL64; }
       if (decimal_scale != 0 || (physical != parquet::INT32 && physical != parquet::INT64)) {
         return type_id::FLOAT64;
       }
@@ -143,31 +169,694 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Decodes a plain-encoded statistics value of physical type `T`
+ *
+ * @return True if the value could be decoded, false if it is missing
+ */
+template <typename T>
+bool decode_statistics_value(std::string const &blob, T &value) {
+  if (blob.size() < sizeof(T)) { return false; }
+  memcpy(&value, blob.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * @brief Returns whether the column chunk described by its statistics may
+ * contain rows that satisfy the predicate
+ *
+ * Returns true whenever the statistics are missing or cannot be interpreted.
+ *
+ * @param stats Column chunk statistics
+ * @param schema Schema element of the column
+ * @param num_rows Number of rows in the row group
+ * @param pred Predicate to evaluate
+ */
+bool statistics_may_match(Statistics const &stats,
+                          SchemaElement const &schema,
+                          int64_t num_rows,
+                          column_predicate const &pred) {
+  using value_kind = column_predicate::value_kind;
+
+  // Comparisons never match nulls, so all-null chunks can be skipped
+  if (stats.null_count >= 0 && num_rows > 0 && stats.null_count >= num_rows) { return false; }
+
+  // Only the `min_value/max_value` fields have a well-defined order for binary data
+  const bool has_ordered_minmax = (stats.max_value.size() != 0);
+  auto const &min_blob          = has_ordered_minmax ? stats.min_value : stats.min;
+  auto const &max_blob          = has_ordered_minmax ? stats.max_value : stats.max;
+  const bool is_unsigned        = (schema.converted_type == parquet::UINT_8 ||
+                            schema.converted_type == parquet::UINT_16 ||
+                            schema.converted_type == parquet::UINT_32 ||
+                            schema.converted_type == parquet::UINT_64);
+
+  auto match_integers = [&](int64_t min, int64_t max) {
+    if (pred.kind == value_kind::INTEGER) {
+      return range_may_match(min, max, pred.op, pred.int_value);
+    } else if (pred.kind == value_kind::FLOAT && !std::isnan(pred.float_value)) {
+      return range_may_match<double>(min, max, pred.op, pred.float_value);
+    }
+    return true;
+  };
+  auto match_floats = [&](double min, double max) {
+    if (std::isnan(min) || std::isnan(max)) { return true; }
+    if (pred.kind == value_kind::INTEGER) {
+      return range_may_match<double>(min, max, pred.op, pred.int_value);
+    } else if (pred.kind == value_kind::FLOAT && !std::isnan(pred.float_value)) {
+      return range_may_match(min, max, pred.op, pred.float_value);
+    }
+    return true;
+  };
+
+  switch (schema.type) {
+    case parquet::BOOLEAN: {
+      uint8_t min, max;
+      if (!decode_statistics_value(min_blob, min) || !decode_statistics_value(max_blob, max)) {
+        return true;
+      }
+      return match_integers(min != 0, max != 0);
+    }
+    case parquet::INT32: {
+      int32_t min, max;
+      if (!decode_statistics_value(min_blob, min) || !decode_statistics_value(max_blob, max)) {
+        return true;
+      }
+      if (is_unsigned) {
+        if (!has_ordered_minmax) { return true; }
+        return match_integers(static_cast<uint32_t>(min), static_cast<uint32_t>(max));
+      }
+      return match_integers(min, max);
+    }
+    case parquet::INT64: {
+      int64_t min, max;
+      if (!decode_statistics_value(min_blob, min) || !decode_statistics_value(max_blob, max)) {
+        return true;
+      }
+      if (is_unsigned) {
+        // Values beyond the signed range can't be compared against int64 literals
+        if (!has_ordered_minmax || min < 0 || max < 0) { return true; }
+      }
+      return match_integers(min, max);
+    }
+    case parquet::FLOAT: {
+      float min, max;
+      if (!decode_statistics_value(min_blob, min) || !decode_statistics_value(max_blob, max)) {
+        return true;
+      }
+      return match_floats(min, max);
+    }
+    case parquet::DOUBLE: {
+      double min, max;
+      if (!decode_statistics_value(min_blob, min) || !decode_statistics_value(max_blob, max)) {
+        return true;
+      }
+      return match_floats(min, max);
+    }
+    case parquet::BYTE_ARRAY:
+      // std::string comparison is bytewise unsigned, matching the parquet UTF8 ordering
+      if (!has_ordered_minmax || pred.kind != value_kind::STRING) { return true; }
+      return range_may_match(stats.min_value, stats.max_value, pred.op, pred.string_value);
+    default: return true;
+  }
+}
+
+/**
+ * @brief Reads and parses a page index structure stored at the given location
+ *
+ * @param source Dataset source
+ * @param offset File offset of the structure
+ * @param length Size of the structure in bytes
+ * @param index Output page index structure
+ *
+ * @return True if the structure is present and was parsed successfully
+ */
+template <typename T>
+bool read_page_index(datasource *source, int64_t offset, int32_t length, T *index) {
+  if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source->size()) {
+    return false;
+  }
+  const auto buffer = source->get_buffer(offset, length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  return cp.read(index);
+}
+
+/**
+ * @brief Returns whether any page described by the column index may contain
+ * rows that satisfy the predicate
+ */
+bool column_index_may_match(ColumnIndex const &column_index,
+                            SchemaElement const &schema,
+                            column_predicate const &pred) {
+  const auto num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages || column_index.max_values.size() != num_pages) {
+    return true;
+  }
+  for (size_t p = 0; p < num_pages; ++p) {
+    if (column_index.null_pages[p]) { continue; }
+    Statistics page_stats;
+    page_stats.min_value = column_index.min_values[p];
+    page_stats.max_value = column_index.max_values[p];
+    if (statistics_may_match(page_stats, schema, 0, pred)) { return true; }
+  }
+  return num_pages == 0;
+}
+
+/**
+ * @brief Computes the Bloom filter hash of a predicate value in the physical
+ * type of a column
+ *
+ * @return True if the value has an exact representation in the physical type
+ * whose plain encoding is unique, false otherwise
+ */
+bool hash_predicate_value(SchemaElement const &schema,
+                          column_predicate const &pred,
+                          uint64_t &hash) {
+  using value_kind = column_predicate::value_kind;
+
+  switch (schema.type) {
+    case parquet::INT32: {
+      if (pred.kind != value_kind::INTEGER) { return false; }
+      const bool is_unsigned = (schema.converted_type == parquet::UINT_8 ||
+                                schema.converted_type == parquet::UINT_16 ||
+                                schema.converted_type == parquet::UINT_32);
+      const int64_t min_value =
+        is_unsigned ? 0 : static_cast<int64_t>(std::numeric_limits<int32_t>::min());
+      const int64_t max_value = is_unsigned
+                                  ? static_cast<int64_t>(std::numeric_limits<uint32_t>::max())
+                                  : static_cast<int64_t>(std::numeric_limits<int32_t>::max());
+      if (pred.int_value < min_value || pred.int_value > max_value) { return false; }
+      hash = xxhash64_value(static_cast<uint32_t>(pred.int_value));
+      return true;
+    }
+    case parquet::INT64:
+      if (pred.kind != value_kind::INTEGER) { return false; }
+      hash = xxhash64_value(pred.int_value);
+      return true;
+    case parquet::FLOAT:
+    case parquet::DOUBLE: {
+      double value;
+      if (pred.kind == value_kind::FLOAT) {
+        value = pred.float_value;
+      } else if (pred.kind == value_kind::INTEGER) {
+        value = static_cast<double>(pred.int_value);
+        if (static_cast<int64_t>(value) != pred.int_value) { return false; }
+      } else {
+        return false;
+      }
+      // Signed zeros and NaNs compare equal to (or unordered with) values of a different encoding
+      if (value == 0 || std::isnan(value)) { return false; }
+      if (schema.type == parquet::FLOAT) {
+        const float f = static_cast<float>(value);
+        if (static_cast<double>(f) != value) { return false; }
+        hash = xxhash64_value(f);
+      } else {
+        hash = xxhash64_value(value);
+      }
+      return true;
+    }
+    case parquet::BYTE_ARRAY:
+      if (pred.kind != value_kind::STRING) { return false; }
+      hash = xxhash64(reinterpret_cast<uint8_t const *>(pred.string_value.data()),
+                      pred.string_value.size());
+      return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns whether the Bloom filter of a column chunk may contain the
+ * value of an equality predicate
+ *
+ * Returns true whenever the chunk has no Bloom filter, the filter cannot be
+ * interpreted, or the predicate is not an equality with a hashable value.
+ *
+ * @param source Dataset source
+ * @param meta_data Metadata of the column chunk
+ * @param schema Schema element of the column
+ * @param pred Predicate to evaluate
+ */
+bool bloom_filter_may_match(datasource *source,
+                            ColumnMetaData const &meta_data,
+                            SchemaElement const &schema,
+                            column_predicate const &pred) {
+  uint64_t hash;
+  if (pred.op != predicate_op::EQUAL || meta_data.bloom_filter_offset <= 0 ||
+      static_cast<size_t>(meta_data.bloom_filter_offset) >= source->size() ||
+      !hash_predicate_value(schema, pred, hash)) {
+    return true;
+  }
+
+  // Older writers do not record the filter length, in which case only the header is read first
+  constexpr size_t max_header_size = 64;
+  const size_t offset              = meta_data.bloom_filter_offset;
+  const size_t filter_length       = (meta_data.bloom_filter_length > 0)
+                                 ? static_cast<size_t>(meta_data.bloom_filter_length)
+                                 : max_header_size;
+  const size_t length = std::min(source->size() - offset, filter_length);
+  const auto buffer = source->get_buffer(offset, length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  BloomFilterHeader header;
+  if (!cp.read(&header) || header.algorithm != 1 || header.hash != 1 || header.compression != 1 ||
+      header.num_bytes < static_cast<int32_t>(BLOOM_FILTER_MIN_BYTES) ||
+      header.num_bytes > static_cast<int32_t>(BLOOM_FILTER_MAX_BYTES) ||
+      header.num_bytes % BLOOM_FILTER_BLOCK_BYTES != 0) {
+    return true;
+  }
+  const size_t header_size = cp.bytecount();
+  if (offset + header_size + header.num_bytes > source->size()) { return true; }
+
+  std::vector<uint32_t> bitset(header.num_bytes / sizeof(uint32_t));
+  if (header_size + header.num_bytes <= buffer->size()) {
+    memcpy(bitset.data(), buffer->data() + header_size, header.num_bytes);
+  } else {
+    const auto bitset_buffer = source->get_buffer(offset + header_size, header.num_bytes);
+    memcpy(bitset.data(), bitset_buffer->data(), header.num_bytes);
+  }
+  return bloom_filter_may_contain(bitset.data(), header.num_bytes / BLOOM_FILTER_BLOCK_BYTES, hash);
+}
+
+/**
+ * @brief Parses the file footer of a source
+ *
+ * @param source Dataset source
+ * @param md Output file metadata
+ * @param num_workers Number of host threads parsing the row groups of the footer
+ *
+ * @return Size in bytes of the serialized footer
+ */
+size_t parse_file_metadata(datasource *source, FileMetaData *md, int num_workers) {
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len           = source->size();
+  const auto header_buffer = source->get_buffer(0, header_len);
+  const auto header        = (const file_header_s *)header_buffer->data();
+  const auto ender_buffer  = source->get_buffer(len - ender_len, ender_len);
+  const auto ender         = (const file_ender_s *)ender_buffer->data();
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  CUDF_EXPECTS(header->magic == PARQUET_MAGIC && ender->magic == PARQUET_MAGIC,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  const auto buffer = source->get_buffer(len - ender->footer_len - ender_len, ender->footer_len);
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  cp.set_num_workers(num_workers);
+  CUDF_EXPECTS(cp.read(md), "Cannot parse metadata");
+  CUDF_EXPECTS(cp.InitSchema(md), "Cannot initialize schema");
+  return ender->footer_len;
+}
+
+/**
+ * @brief Returns the parsed file footer of a source, using the metadata
+ * cache for sources that are files
+ *
+ * @param source Dataset source
+ * @param path Path of the source file; empty if the source is not a file
+ * @param num_workers Number of host threads parsing the row groups of the footer
+ */
+std::shared_ptr<const FileMetaData> load_file_metadata(datasource *source,
+                                                       std::string const &path,
+                                                       int num_workers) {
+  return cudf::io::file_metadata_cache<FileMetaData>::instance().get_or_load(path, [&]() {
+    auto md               = std::make_shared<FileMetaData>();
+    const auto footer_len = parse_file_metadata(source, md.get(), num_workers);
+    return std::make_pair(std::shared_ptr<const FileMetaData>(std::move(md)), footer_len);
+  });
+}
+
+/**
+ * @brief Returns whether two schemas describe the same columns
+ */
+bool is_same_schema(std::vector<SchemaElement> const &lhs, std::vector<SchemaElement> const &rhs) {
+  return std::equal(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto &a, const auto &b) {
+      return a.name == b.name && a.type == b.type && a.converted_type == b.converted_type &&
+             a.type_length == b.type_length && a.repetition_type == b.repetition_type &&
+             a.num_children == b.num_children && a.decimal_scale == b.decimal_scale;
+    });
+}
+
+/**
+ * @brief Returns whether a schema node is below another one, or is that node
+ */
+bool is_descendant(std::vector<SchemaElement> const &schema, int node, int ancestor) {
+  while (node > ancestor) { node = schema[node].parent_idx; }
+  return node == ancestor;
+}
+
+/**
+ * @brief Decoded leaf column that nested columns are assembled from
+ */
+struct nested_leaf {
+  int schema_idx = 0;                 // Schema node of the leaf
+  std::unique_ptr<column> values;     // Values, or rows if not below a repeated field
+  const uint8_t *levels = nullptr;    // Definition and repetition level pair of each value
+  rmm::device_vector<bool> in_range;  // Whether each value is in a row to read, if repeated
+  int num_uses = 0;                   // Number of output columns still to assemble from it
+};
+
+/**
+ * @brief Returns the repeated node of a list and the node of its elements,
+ * or -1 if the node is not a list
+ *
+ * Lists are either a repeated field, whose values are the elements, or a
+ * LIST/MAP annotated group with a single repeated child. The elements are the
+ * child of the repeated group in the standard 3-level layout, and the repeated
+ * field itself in the legacy 2-level layouts.
+ */
+std::pair<int, int> list_nodes(std::vector<SchemaElement> const &schema,
+                               int node,
+                               bool is_element) {
+  const auto &list = schema[node];
+  if (list.repetition_type == parquet::REPEATED) {
+    return is_element ? std::make_pair(-1, -1) : std::make_pair(node, node);
+  }
+  const bool is_annotated = (list.converted_type == parquet::LIST ||
+                             list.converted_type == parquet::MAP ||
+                             list.converted_type == parquet::MAP_KEY_VALUE);
+  if (!is_annotated || list.num_children != 1 ||
+      schema[node + 1].repetition_type != parquet::REPEATED) {
+    return {-1, -1};
+  }
+  const auto &repeated = schema[node + 1];
+  const bool is_two_level = repeated.num_children != 1 || repeated.name == "array" ||
+                            repeated.name == list.name + "_tuple";
+  return {node + 1, is_two_level ? node + 1 : node + 2};
+}
+
+/**
+ * @brief Returns the positions of the values selected by a mask, or of all
+ * the values if the mask is empty
+ */
+rmm::device_vector<size_type> selected_positions(rmm::device_vector<bool> const &mask,
+                                                 size_type num_values,
+                                                 cudaStream_t stream) {
+  auto counting = thrust::make_counting_iterator<size_type>(0);
+  rmm::device_vector<size_type> positions(num_values);
+  if (mask.empty()) {
+    thrust::copy(
+      rmm::exec_policy(stream)->on(stream), counting, counting + num_values, positions.begin());
+  } else {
+    auto end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                               counting,
+                               counting + num_values,
+                               mask.begin(),
+                               positions.begin(),
+                               thrust::identity<bool>());
+    positions.resize(thrust::distance(positions.begin(), end));
+  }
+  return positions;
+}
+
+/**
+ * @brief Returns the null mask of the values at the given positions, that are
+ * valid if their definition level is at least the given level
+ */
+std::pair<rmm::device_buffer, size_type> defined_mask(
+  rmm::device_vector<size_type> const &positions,
+  const uint8_t *levels,
+  int32_t def_level,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource *mr) {
+  auto d_positions = positions.data().get();
+  return cudf::experimental::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(positions.size()),
+    [d_positions, levels, def_level] __device__(size_type i) {
+      return levels[d_positions[i] * 2] >= def_level;
+    },
+    stream,
+    mr);
+}
+
+/**
+ * @brief Returns whether each value of a repeated leaf is in a row of a range
+ *
+ * @param levels Definition and repetition level pair of each value
+ * @param num_values Number of values
+ * @param first_row Starting row of the range, in the rows of the values
+ * @param num_rows Number of rows of the range
+ * @param stream Stream to use for memory allocation and kernels
+ */
+rmm::device_vector<bool> values_in_range(const uint8_t *levels,
+                                         size_type num_values,
+                                         int64_t first_row,
+                                         size_type num_rows,
+                                         cudaStream_t stream) {
+  // Rows are counted from the values that start them, with a repetition level of 0
+  rmm::device_vector<size_type> row_ends(num_values);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_values),
+    row_ends.begin(),
+    [levels] __device__(size_type i) { return (levels[i * 2 + 1] == 0) ? 1 : 0; },
+    thrust::plus<size_type>());
+  rmm::device_vector<bool> in_range(num_values);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    row_ends.begin(),
+                    row_ends.end(),
+                    in_range.begin(),
+                    [first_row, num_rows] __device__(size_type row_end) {
+                      return row_end > first_row && row_end <= first_row + num_rows;
+                    });
+  return in_range;
+}
+
+/**
+ * @brief Returns the mask of the values of a leaf that start the rows to read,
+ * or an empty mask if the values of the leaf are its rows
+ */
+rmm::device_vector<bool> row_start_mask(nested_leaf const &leaf, cudaStream_t stream) {
+  rmm::device_vector<bool> mask;
+  if (leaf.in_range.empty()) { return mask; }
+  mask.resize(leaf.in_range.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(mask.size()),
+                    mask.begin(),
+                    [levels = leaf.levels, in_range = leaf.in_range.data().get()] __device__(
+                      size_type i) { return in_range[i] && levels[i * 2 + 1] == 0; });
+  return mask;
+}
+
+/**
+ * @brief Assembles a column from the decoded leaves below its schema node
+ *
+ * @param schema Schema of the dataset
+ * @param node Schema node of the column
+ * @param is_element Whether the column holds the elements of a list
+ * @param leaves Leaves below the node, in schema order
+ * @param masks Values of each leaf that are the rows of the column, or empty
+ * if all the values are
+ * @param stream Stream to use for memory allocation and kernels
+ * @param mr Resource to use for device memory allocation of the column
+ *
+ * @return The assembled column
+ */
+std::unique_ptr<column> assemble_column(std::vector<SchemaElement> const &schema,
+                                        int node,
+                                        bool is_element,
+                                        std::vector<nested_leaf *> const &leaves,
+                                        std::vector<rmm::device_vector<bool>> const &masks,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource *mr) {
+  CUDF_EXPECTS(!leaves.empty(), "Nested column without leaves");
+  const auto &node_schema = schema[node];
+  auto leaf               = leaves[0];
+  const auto num_values   = leaf->values->size();
+  auto counting           = thrust::make_counting_iterator<size_type>(0);
+
+  if (leaf->schema_idx == node) {
+    const bool is_last_use = (--leaf->num_uses == 0);
+    if (!masks[0].empty()) {
+      column_view mask(data_type{BOOL8}, num_values, masks[0].data().get());
+      auto masked = apply_boolean_mask(table_view{{leaf->values->view()}}, mask, mr)->release();
+      return std::move(masked[0]);
+    }
+    return is_last_use ? std::move(leaf->values)
+                       : std::make_unique<column>(leaf->values->view(), stream, mr);
+  }
+
+  const auto positions = selected_positions(masks[0], num_values, stream);
+  const auto num_rows  = static_cast<size_type>(positions.size());
+  std::pair<rmm::device_buffer, size_type> null_mask{rmm::device_buffer{}, 0};
+  if (node_schema.repetition_type == parquet::OPTIONAL) {
+    null_mask =
+      defined_mask(positions, leaf->levels, node_schema.max_definition_level, stream, mr);
+  }
+
+  const auto list = list_nodes(schema, node, is_element);
+  if (list.first >= 0) {
+    // The elements are the values in range that are defined up to the repeated field
+    const auto element_level = schema[list.first].max_definition_level;
+    std::vector<rmm::device_vector<bool>> element_masks;
+    for (const auto &l : leaves) {
+      element_masks.emplace_back(l->values->size());
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        counting,
+                        counting + l->values->size(),
+                        element_masks.back().begin(),
+                        [levels   = l->levels,
+                         in_range = l->in_range.data().get(),
+                         element_level] __device__(size_type i) {
+                          return in_range[i] && levels[i * 2] >= element_level;
+                        });
+    }
+    // Each list starts at the number of elements before its first value
+    rmm::device_vector<size_type> element_counts(num_values + 1, 0);
+    thrust::transform_inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                                     element_masks[0].begin(),
+                                     element_masks[0].end(),
+                                     element_counts.begin() + 1,
+                                     [] __device__(bool is_element) { return is_element ? 1 : 0; },
+                                     thrust::plus<size_type>());
+    auto offsets = make_numeric_column(
+      data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_rows + 1,
+                      offsets->mutable_view().data<size_type>(),
+                      [counts    = element_counts.data().get(),
+                       positions = positions.data().get(),
+                       num_rows,
+                       num_values] __device__(size_type i) {
+                        return counts[(i < num_rows) ? positions[i] : num_values];
+                      });
+    auto child = assemble_column(schema, list.second, true, leaves, element_masks, stream, mr);
+    return make_lists_column(num_rows,
+                             std::move(offsets),
+                             std::move(child),
+                             null_mask.second,
+                             std::move(null_mask.first),
+                             stream,
+                             mr);
+  }
+
+  // The fields of structs are the children of the group, with the same rows
+  std::vector<std::unique_ptr<column>> children;
+  for (int child = node + 1;
+       child < static_cast<int>(schema.size()) && is_descendant(schema, child, node);
+       ++child) {
+    if (schema[child].parent_idx != node) { continue; }
+    std::vector<nested_leaf *> child_leaves;
+    std::vector<rmm::device_vector<bool>> child_masks;
+    for (size_t i = 0; i < leaves.size(); ++i) {
+      if (is_descendant(schema, leaves[i]->schema_idx, child)) {
+        child_leaves.push_back(leaves[i]);
+        child_masks.push_back(masks[i]);
+      }
+    }
+    if (!child_leaves.empty()) {
+      children.emplace_back(
+        assemble_column(schema, child, false, child_leaves, child_masks, stream, mr));
+    }
+  }
+  return make_structs_column(num_rows,
+                             std::move(children),
+                             null_mask.second,
+                             std::move(null_mask.first),
+                             stream,
+                             mr);
+}
+
+/**
+ * @brief Evaluates a predicate on every row of a decoded column
+ *
+ * @param input Decoded filter column
+ * @param pred Predicate to evaluate
+ * @param stream Stream to use for memory allocation and kernels
+ *
+ * @return BOOL8 column that is true for the rows satisfying the predicate, and
+ * null for the null rows
+ */
+std::unique_ptr<column> evaluate_predicate(column_view const &input,
+                                           column_predicate const &pred,
+                                           cudaStream_t stream) {
+  using value_kind = column_predicate::value_kind;
+
+  if (input.type().id() == DICTIONARY32) {
+    auto decoded = dictionary::decode(dictionary_column_view(input));
+    return evaluate_predicate(decoded->view(), pred, stream);
+  }
+
+  binary_operator op = binary_operator::EQUAL;
+  switch (pred.op) {
+    case predicate_op::EQUAL: op = binary_operator::EQUAL; break;
+    case predicate_op::LESS: op = binary_operator::LESS; break;
+    case predicate_op::LESS_EQUAL: op = binary_operator::LESS_EQUAL; break;
+    case predicate_op::GREATER: op = binary_operator::GREATER; break;
+    case predicate_op::GREATER_EQUAL: op = binary_operator::GREATER_EQUAL; break;
+  }
+  const data_type output_type{BOOL8};
+  if (pred.kind == value_kind::STRING) {
+    CUDF_EXPECTS(input.type().id() == STRING, "String filters require a string column");
+    string_scalar value(pred.string_value, true, stream);
+    return binary_operation(input, value, op, output_type);
+  }
+  CUDF_EXPECTS(is_numeric(input.type()), "Numeric filters require a numeric column");
+  if (pred.kind == value_kind::FLOAT) {
+    numeric_scalar<double> value(pred.float_value, true, stream);
+    return binary_operation(input, value, op, output_type);
+  }
+  numeric_scalar<int64_t> value(pred.int_value, true, stream);
+  return binary_operation(input, value, op, output_type);
+}
+
 }  // namespace
 
 /**
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource *source) {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->get_buffer(0, header_len);
-    const auto header        = (const file_header_s *)header_buffer->data();
-    const auto ender_buffer  = source->get_buffer(len - ender_len, ender_len);
-    const auto ender         = (const file_ender_s *)ender_buffer->data();
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == PARQUET_MAGIC && ender->magic == PARQUET_MAGIC,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->get_buffer(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+  /**
+   * @brief Combines the file footers of all the sources of a dataset
+   *
+   * The row groups of the sources are concatenated in order, so a dataset
+   * made of several files is read the same way as a single file. All sources
+   * must have the same schema.
+   *
+   * @param file_metadata Parsed footer of each source
+   */
+  explicit metadata(std::vector<std::shared_ptr<const FileMetaData>> const &file_metadata) {
+    CUDF_EXPECTS(!file_metadata.empty(), "No data sources");
+    static_cast<FileMetaData &>(*this) = *file_metadata[0];
+    row_group_source.assign(row_groups.size(), 0);
+    source_first_row_group.assign(1, 0);
+    for (size_t i = 1; i < file_metadata.size(); ++i) {
+      const auto &md = *file_metadata[i];
+      CUDF_EXPECTS(is_same_schema(schema, md.schema), "Mismatched schema across dataset sources");
+      source_first_row_group.push_back(row_groups.size());
+      row_groups.insert(row_groups.end(), md.row_groups.begin(), md.row_groups.end());
+      row_group_source.resize(row_groups.size(), i);
+      num_rows += md.num_rows;
+    }
+  }
+
+  std::vector<size_t> row_group_source;         // Index of the source containing each row group
+  std::vector<size_type> source_first_row_group;  // Index of the first row group of each source
+
+  /**
+   * @brief Returns the index of the source of a row group, and of the row
+   * group within that source
+   */
+  std::pair<size_type, size_type> get_source_row_group(size_type row_group_idx) const {
+    const auto source = row_group_source[row_group_idx];
+    return {static_cast<size_type>(source), row_group_idx - source_first_row_group[source]};
+  }
+
+  /**
+   * @brief Returns the index in the dataset of a row group of a source
+   */
+  size_type get_row_group_index(size_type source, size_type row_group) const {
+    const auto num_sources = static_cast<size_type>(source_first_row_group.size());
+    CUDF_EXPECTS(source >= 0 && source < num_sources, "Invalid source index");
+    const auto first = source_first_row_group[source];
+    const auto last =
+      (source + 1 < num_sources) ? source_first_row_group[source + 1] : get_num_row_groups();
+    CUDF_EXPECTS(row_group >= 0 && row_group < last - first, "Invalid rowgroup index");
+    return first + row_group;
   }
 
   inline int64_t get_total_rows() const { return num_rows; }
@@ -305,74 +994,276 @@ struct metadata : public FileMetaData {
   }
 
   /**
-   * @brief Filters and reduces down to a selection of columns
+   * @brief Removes the row groups whose statistics show that they cannot
+   * contain any rows satisfying all of the predicates
+   *
+   * The remaining row groups are assigned consecutive starting rows from 0,
+   * so a row range can then be applied to their rows with `trim_row_groups()`.
+   *
+   * @param sources Dataset sources, used to read the page index if present
+   * @param selection List of row group indexes and their starting row
+   * @param filters List of predicates, evaluated as a conjunction
+   */
+  void filter_row_groups(std::vector<std::unique_ptr<datasource>> const &sources,
+                         std::vector<std::pair<size_type, size_t>> &selection,
+                         std::vector<column_predicate> const &filters) {
+    if (filters.empty() || selection.empty()) { return; }
+
+    // Resolve the column chunk index of each filtered column
+    const auto names = get_column_names();
+    std::vector<size_t> filter_columns;
+    for (const auto &filter : filters) {
+      auto it = std::find(names.begin(), names.end(), filter.column);
+      CUDF_EXPECTS(it != names.end(), "Filter column not found");
+      filter_columns.emplace_back(std::distance(names.begin(), it));
+    }
+
+    auto row_group_may_match = [&](size_type row_group_idx) {
+      const auto &row_group = row_groups[row_group_idx];
+      const auto source     = sources[row_group_source[row_group_idx]].get();
+      for (size_t i = 0; i < filters.size(); ++i) {
+        const auto &chunk      = row_group.columns[filter_columns[i]];
+        const auto &col_schema = schema[chunk.schema_idx];
+        if (!chunk.meta_data.statistics_blob.empty()) {
+          // The blob excludes the struct's terminating field, so add it back
+          std::vector<uint8_t> blob(chunk.meta_data.statistics_blob);
+          blob.push_back(0);
+          Statistics stats;
+          CompactProtocolReader cp(blob.data(), blob.size());
+          if (cp.read(&stats) &&
+              !statistics_may_match(stats, col_schema, row_group.num_rows, filters[i])) {
+            return false;
+          }
+        }
+        // Per-page statistics can rule out chunks with gaps between the page value ranges
+        ColumnIndex column_index;
+        if (read_page_index(
+              source, chunk.column_index_offset, chunk.column_index_length, &column_index) &&
+            !column_index_may_match(column_index, col_schema, filters[i])) {
+          return false;
+        }
+        // Bloom filters can rule out equality matches within the chunk's value range
+        if (!bloom_filter_may_match(source, chunk.meta_data, col_schema, filters[i])) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    std::vector<std::pair<size_type, size_t>> filtered;
+    size_t next_start_row = 0;
+    for (const auto &rg : selection) {
+      if (!row_group_may_match(rg.first)) { continue; }
+      filtered.emplace_back(rg.first, next_start_row);
+      next_start_row += row_groups[rg.first].num_rows;
+    }
+    selection = std::move(filtered);
+  }
+
+  /**
+   * @brief Reduces a selection of row groups with consecutive starting rows
+   * from 0 down to the row groups overlapping a range of their rows
+   *
+   * @param selection List of row group indexes and their starting row
+   * @param row_start Starting row of the range, in the rows of the selection
+   * @param row_count Number of rows of the range, or negative for all the
+   * remaining rows; set to the number of rows selected
+   */
+  void trim_row_groups(std::vector<std::pair<size_type, size_t>> &selection,
+                       size_type &row_start,
+                       size_type &row_count) {
+    size_t total_rows = 0;
+    for (const auto &rg : selection) { total_rows += row_groups[rg.first].num_rows; }
+    row_start = std::max(row_start, 0);
+    CUDF_EXPECTS(static_cast<size_t>(row_start) <= total_rows, "Invalid row start");
+    const size_t range_begin = row_start;
+    const size_t range_end =
+      (row_count < 0) ? total_rows : std::min(total_rows, range_begin + row_count);
+
+    std::vector<std::pair<size_type, size_t>> trimmed;
+    for (const auto &rg : selection) {
+      if (rg.second < range_end && rg.second + row_groups[rg.first].num_rows > range_begin) {
+        trimmed.emplace_back(rg);
+      }
+    }
+    selection = std::move(trimmed);
+    row_count = static_cast<size_type>(range_end - range_begin);
+  }
+
+  /**
+   * @brief Returns the maximum repetition level of the leaves below a schema node
+   */
+  int32_t max_subtree_repetition(int node) const {
+    int32_t max_level = 0;
+    for (size_t i = node; i < schema.size() && is_descendant(schema, i, node); ++i) {
+      max_level = std::max(max_level, schema[i].max_repetition_level);
+    }
+    return max_level;
+  }
+
+  /**
+   * @brief Filters and reduces down to a selection of output columns
+   *
+   * Top-level groups are output as STRUCT and LIST columns; a leaf of a group
+   * can also be selected by its path, and is then output as a flat column.
+   * Only a single level of lists is supported.
    *
    * @param use_names List of column names to select
    * @param include_index Whether to always include the PANDAS index column(s)
    *
-   * @return List of column names
+   * @return List of schema node indexes and output column names
    */
   auto select_columns(std::vector<std::string> use_names, bool include_index) {
     std::vector<std::pair<int, std::string>> selection;
+    if (row_groups.empty()) { return selection; }
 
     const auto names = get_column_names();
     if (use_names.empty()) {
-      // No columns specified; include all in the dataset
-      for (const auto &name : names) { selection.emplace_back(selection.size(), name); }
+      // No columns specified; include all the top-level columns without nested lists
+      for (size_t i = 1; i < schema.size(); ++i) {
+        if (schema[i].parent_idx == 0 && max_subtree_repetition(i) <= 1) {
+          selection.emplace_back(i, schema[i].name);
+        }
+      }
     } else {
       // Load subset of columns; include PANDAS index unless excluded
       if (include_index) { add_pandas_index_names(use_names); }
       for (const auto &use_name : use_names) {
-        for (size_t i = 0; i < names.size(); ++i) {
-          if (names[i] == use_name) {
-            selection.emplace_back(i, names[i]);
-            break;
-          }
+        auto node = std::find_if(schema.begin() + 1, schema.end(), [&](const auto &s) {
+          return s.parent_idx == 0 && s.name == use_name;
+        });
+        if (node != schema.end()) {
+          const int idx = std::distance(schema.begin(), node);
+          CUDF_EXPECTS(max_subtree_repetition(idx) <= 1, "Nested lists are not supported");
+          selection.emplace_back(idx, use_name);
+          continue;
+        }
+        auto leaf = std::find(names.begin(), names.end(), use_name);
+        if (leaf != names.end()) {
+          const auto &chunk = row_groups[0].columns[std::distance(names.begin(), leaf)];
+          CUDF_EXPECTS(schema[chunk.schema_idx].max_repetition_level == 0,
+                       "Repeated (LIST) columns are not supported");
+          selection.emplace_back(chunk.schema_idx, use_name);
         }
       }
     }
 
     return selection;
   }
+
+  /**
+   * @brief Returns the leaf columns to decode for a selection of output columns
+   *
+   * @param output_columns Schema node indexes and names of the output columns
+   *
+   * @return List of column chunk indexes and leaf paths, in file order
+   */
+  auto select_leaves(std::vector<std::pair<int, std::string>> const &output_columns) {
+    std::vector<std::pair<int, std::string>> selection;
+    if (row_groups.empty()) { return selection; }
+
+    const auto names = get_column_names();
+    for (size_t i = 0; i < names.size(); ++i) {
+      const auto leaf = row_groups[0].columns[i].schema_idx;
+      if (std::any_of(output_columns.begin(), output_columns.end(), [&](const auto &col) {
+            return is_descendant(schema, leaf, col.first);
+          })) {
+        selection.emplace_back(i, names[i]);
+      }
+    }
+
+    return selection;
+  }
 };
 
-void reader::impl::read_column_chunks(std::vector<rmm::device_buffer> &page_data,
-                                      hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                      size_t begin_chunk,
-                                      size_t end_chunk,
-                                      const std::vector<size_t> &column_chunk_offsets,
-                                      cudaStream_t stream) {
-  // Transfer chunk data, coalescing adjacent chunks
+void reader::impl::read_column_chunks(
+  datasource *source,
+  std::vector<rmm::device_buffer> &page_data,
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  size_t begin_chunk,
+  size_t end_chunk,
+  const std::vector<size_t> &column_chunk_offsets,
+  const std::vector<std::pair<size_t, size_t>> &column_chunk_gaps,
+  std::vector<std::shared_ptr<arrow::Buffer>> &host_buffers,
+  cudaStream_t stream) {
+  // Plan the transfers, coalescing adjacent chunks; chunks with skipped pages
+  // are read on their own, as two ranges: the dictionary pages and the
+  // remaining data pages
+  std::vector<std::pair<size_t, size_t>> reads;   // First and last+1 chunk of each transfer
+  std::vector<std::pair<size_t, size_t>> ranges;  // Offset and size of each range read
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
-      const bool is_next_compressed =
-        (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
-        // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
-        // freed earlier (immediately after decompression stage) to limit peak memory requirements
-        break;
-      }
-      io_size += chunks[next_chunk].compressed_size;
-      next_chunk++;
+    const auto &gap          = column_chunk_gaps[chunk];
+    if (gap.second != 0) {
+      ranges.emplace_back(io_offset, gap.first);
+      ranges.emplace_back(io_offset + gap.first + gap.second, io_size - gap.first);
+    } else {
+      while (next_chunk < end_chunk) {
+        const size_t next_offset = column_chunk_offsets[next_chunk];
+        const bool is_next_compressed =
+          (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
+        if (column_chunk_gaps[next_chunk].second != 0) {
+          // Chunks with skipped pages are read on their own
+          break;
+        }
+        if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+          // Can't merge if not contiguous or mixing compressed and uncompressed
+          // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
+          // freed earlier (immediately after decompression stage) to limit peak memory requirements
+          break;
+        }
+        io_size += chunks[next_chunk].compressed_size;
+        next_chunk++;
+      }
+      ranges.emplace_back(io_offset, io_size);
+    }
+    reads.emplace_back(chunk, next_chunk);
+    chunk = next_chunk;
+  }
+
+  // Request all the ranges at once, so that the source can schedule the I/O as a whole
+  const bool use_device_read = source->supports_device_read();
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  if (!use_device_read) { buffers = source->get_buffers(ranges); }
+
+  // Transfer chunk data
+  size_t range = 0;
+  for (const auto &read : reads) {
+    const size_t num_ranges = (column_chunk_gaps[read.first].second != 0) ? 2 : 1;
+    size_t io_size          = 0;
+    for (size_t i = range; i < range + num_ranges; ++i) {
+      io_size += use_device_read ? ranges[i].second : buffers[i]->size();
     }
     if (io_size != 0) {
-      auto buffer         = _source->get_buffer(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
-      uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
-      do {
+      page_data[read.first] = rmm::device_buffer(io_size, stream);
+      auto d_compdata       = static_cast<uint8_t *>(page_data[read.first].data());
+      size_t pos            = 0;
+      for (size_t i = range; i < range + num_ranges; ++i) {
+        if (use_device_read) {
+          // Transfer directly from the source into device memory, skipping the host copy
+          source->device_read(ranges[i].first, ranges[i].second, d_compdata + pos, stream);
+          pos += ranges[i].second;
+        } else {
+          CUDA_TRY(cudaMemcpyAsync(d_compdata + pos,
+                                   buffers[i]->data(),
+                                   buffers[i]->size(),
+                                   cudaMemcpyHostToDevice,
+                                   stream));
+          pos += buffers[i]->size();
+        }
+      }
+      for (size_t chunk = read.first; chunk < read.second; ++chunk) {
         chunks[chunk].compressed_data = d_compdata;
         d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
+      }
     }
+    range += num_ranges;
   }
+  // The host buffers must outlive the copies, which the caller waits for once all chunks are read
+  host_buffers.insert(host_buffers.end(), buffers.begin(), buffers.end());
 }
 
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -384,7 +1275,7 @@ size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>
   CUDA_TRY(gpu::DecodePageHeaders(chunks.device_ptr(), chunks.size(), stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   for (size_t c = 0; c < chunks.size(); c++) {
     total_pages += chunks[c].num_data_pages + chunks[c].num_dict_pages;
@@ -407,7 +1298,7 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &
   CUDA_TRY(gpu::DecodePageHeaders(chunks.device_ptr(), chunks.size(), stream));
   CUDA_TRY(cudaMemcpyAsync(
     pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 rmm::device_buffer reader::impl::decompress_page_data(
@@ -418,7 +1309,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
     for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
       const auto page_stride = chunks[c].max_num_pages;
       if (chunks[c].codec == codec) {
-        for (int k = 0; k < page_stride; k++) { f(page_count + k); }
+        for (int k = 0; k < page_stride; k++) {
+          // Skipped pages are not decoded either, so they don't need to be decompressed
+          if (!(pages[page_count + k].flags & gpu::PAGEINFO_FLAGS_SKIP)) { f(page_count + k); }
+        }
       }
       page_count += page_stride;
     }
@@ -430,9 +1324,11 @@ rmm::device_buffer reader::impl::decompress_page_data(
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 5> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0),
+                                                                std::make_pair(parquet::LZ4, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -504,6 +1400,20 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos,
+                              stream));
+          break;
+        case parquet::LZ4:
+          // Either Hadoop-framed (parquet-mr) or raw blocks (older parquet-cpp)
+          CUDA_TRY(gpu_unlz4(inflate_in.device_ptr(start_pos),
+                             inflate_out.device_ptr(start_pos),
+                             argc - start_pos,
+                             1,
+                             stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -513,7 +1423,7 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                stream));
     }
   }
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   // Update the page information in device memory with the updated value of
   // page_data; it now points to the uncompressed data buffer
@@ -529,6 +1439,7 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
                                     size_t total_rows,
                                     const std::vector<int> &chunk_map,
                                     std::vector<column_buffer> &out_buffers,
+                                    std::vector<rmm::device_buffer> &out_levels,
                                     cudaStream_t stream) {
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
@@ -555,6 +1466,9 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
     }
     chunks[c].column_data_base = out_buffers[chunk_map[c]].data();
     chunks[c].valid_map_base   = out_buffers[chunk_map[c]].null_mask();
+    chunks[c].direct_strings   = out_buffers[chunk_map[c]]._direct_strings;
+    chunks[c].str_data         = nullptr;
+    chunks[c].levels_base      = static_cast<uint8_t *>(out_levels[chunk_map[c]].data());
     page_count += chunks[c].max_num_pages;
   }
 
@@ -563,6 +1477,21 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   if (total_str_dict_indexes > 0) {
     CUDA_TRY(gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), stream));
   }
+
+  // Dictionary columns keep the dictionary entries of all their chunks as keys
+  static_assert(sizeof(gpu::nvstrdesc_s) == sizeof(column_buffer::str_pair),
+                "String descriptors should match the column buffer string pairs");
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    if (chunks[c].dict_key_offset >= 0) {
+      auto &keys = out_buffers[chunk_map[c]]._keys;
+      CUDA_TRY(cudaMemcpyAsync(keys.data().get() + chunks[c].dict_key_offset,
+                               chunks[c].str_dict_index,
+                               pages[page_count].num_values * sizeof(gpu::nvstrdesc_s),
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+    }
+    page_count += chunks[c].max_num_pages;
+  }
   CUDA_TRY(gpu::DecodePageData(pages.device_ptr(),
                                pages.size(),
                                chunks.device_ptr(),
@@ -570,9 +1499,60 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
                                total_rows,
                                min_row,
                                stream));
+  if (std::any_of(out_levels.begin(), out_levels.end(), [](auto const &l) { return l.size(); })) {
+    CUDA_TRY(gpu::DecodePageLevels(pages.device_ptr(),
+                                   pages.size(),
+                                   chunks.device_ptr(),
+                                   chunks.size(),
+                                   total_rows,
+                                   min_row,
+                                   stream));
+  }
+
+  // The lengths output for the direct strings are scanned into their offsets, and the strings
+  // are then copied into chars of the total size
+  std::vector<size_type> num_chars(out_buffers.size(), 0);
+  for (size_t i = 0; i < out_buffers.size(); i++) {
+    if (!out_buffers[i]._direct_strings) { continue; }
+    // Columns below a repeated field have an offset per value rather than per row
+    const size_t num_strings = out_buffers[i]._data.size() / sizeof(size_type) - 1;
+    auto offsets             = static_cast<size_type *>(out_buffers[i]._data.data());
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream)->on(stream), offsets, offsets + num_strings + 1, offsets);
+    CUDA_TRY(cudaMemcpyAsync(
+      &num_chars[i], offsets + num_strings, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  }
   CUDA_TRY(cudaMemcpyAsync(
     pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
+
+  if (std::any_of(num_chars.begin(), num_chars.end(), [](size_type n) { return n != 0; })) {
+    for (size_t i = 0; i < out_buffers.size(); i++) {
+      if (num_chars[i] == 0) { continue; }
+      out_buffers[i]._chars = rmm::device_buffer(num_chars[i], stream, _mr);
+    }
+    // Chunks of columns without any chars are already complete
+    for (size_t c = 0; c < chunks.size(); c++) {
+      if (num_chars[chunk_map[c]] != 0) {
+        chunks[c].str_data = static_cast<uint8_t *>(out_buffers[chunk_map[c]]._chars.data());
+      } else {
+        chunks[c].direct_strings = 0;
+      }
+    }
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                             chunks.host_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu::DecodePageStrings(pages.device_ptr(),
+                                    pages.size(),
+                                    chunks.device_ptr(),
+                                    chunks.size(),
+                                    total_rows,
+                                    min_row,
+                                    stream));
+    CUDF_STREAM_SYNC(stream);
+  }
 
   for (size_t i = 0; i < pages.size(); i++) {
     if (pages[i].num_rows > 0) {
@@ -584,55 +1564,305 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   }
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &paths,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : _source(std::move(source)), _mr(mr) {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  : _sources(std::move(sources)), _mr(mr) {
+  CUDF_EXPECTS(paths.size() == _sources.size(), "Mismatched number of sources and paths");
+
+  // Open and parse the metadata of all sources, spreading the footers of
+  // multi-file datasets across host threads, and the row groups of large
+  // footers across the remaining threads
+  std::vector<std::shared_ptr<const FileMetaData>> file_metadata(_sources.size());
+  const size_t num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  const size_t num_workers = std::min<size_t>(_sources.size(), num_threads);
+  const int footer_workers = static_cast<int>(num_threads / std::max<size_t>(num_workers, 1));
+  auto parse_footers       = [&](size_t first) {
+    for (size_t i = first; i < _sources.size(); i += num_workers) {
+      file_metadata[i] = load_file_metadata(_sources[i].get(), paths[i], footer_workers);
+    }
+  };
+  if (num_workers > 1) {
+    std::vector<std::future<void>> workers;
+    for (size_t w = 0; w < num_workers; ++w) {
+      workers.emplace_back(std::async(std::launch::async, parse_footers, w));
+    }
+    for (auto &worker : workers) { worker.get(); }
+  } else {
+    parse_footers(0);
+  }
+  _metadata = std::make_unique<metadata>(file_metadata);
 
-  // Select only columns required by the options
-  _selected_columns = _metadata->select_columns(options.columns, options.use_pandas_metadata);
+  // Select only columns required by the options, and the leaves they are assembled from
+  _output_columns   = _metadata->select_columns(options.columns, options.use_pandas_metadata);
+  _selected_columns = _metadata->select_leaves(_output_columns);
 
   // Override output timestamp resolution if requested
   if (options.timestamp_type.id() != EMPTY) { _timestamp_type = options.timestamp_type; }
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.strings_to_categorical;
+  _strings_to_dictionary  = options.strings_to_dictionary;
+
+  // Decimals may be returned as either float64 or fixed-point columns
+  _decimals_as_float = options.decimals_as_float;
+
+  // Predicates used to skip row groups, and optionally rows
+  _filters     = options.filters;
+  _filter_rows = options.filter_rows;
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       size_type row_group,
-                                       size_type max_rowgroup_count,
-                                       const size_type *row_group_indices,
-                                       cudaStream_t stream) {
+std::vector<row_group_chunk> reader::impl::compute_row_chunks(size_t chunk_read_limit) {
+  std::vector<row_group_chunk> row_chunks;
+
+  size_type skip_rows = 0;
+  size_type num_rows  = -1;
+  auto selected_row_groups =
+    _metadata->select_row_groups(-1, -1, nullptr, skip_rows, num_rows);
+  // The chunks list their row groups, so they are read without being filtered again
+  _metadata->filter_row_groups(_sources, selected_row_groups, _filters);
+
+  // Fixed-width output size of a row across all selected columns
+  size_t fixed_row_size = 0;
+  std::vector<bool> is_fixed_width_column;
+  if (_metadata->row_groups.size() != 0) {
+    for (const auto &col : _selected_columns) {
+      auto &col_schema = _metadata->schema[_metadata->row_groups[0].columns[col.first].schema_idx];
+      auto col_type    = data_type{to_type_id(col_schema.type,
+                                           col_schema.converted_type,
+                                           _strings_to_categorical,
+                                           _timestamp_type.id(),
+                                           col_schema.decimal_scale,
+                                           _decimals_as_float)};
+      CUDF_EXPECTS(col_type.id() != type_id::EMPTY, "Unknown type");
+      is_fixed_width_column.push_back(is_fixed_width(col_type));
+      // Strings keep a 4-byte offset per row in addition to their character data
+      fixed_row_size += is_fixed_width_column.back() ? size_of(col_type) : sizeof(size_type);
+    }
+  }
+
+  row_group_chunk chunk;
+  size_t chunk_size = 0;
+  for (const auto &rg : selected_row_groups) {
+    const auto &row_group = _metadata->row_groups[rg.first];
+    if (row_group.num_rows == 0) { continue; }
+
+    // Estimate the decoded size of the row group; the uncompressed size of the
+    // chunk data is an upper bound of the decoded string characters
+    size_t group_size = fixed_row_size * row_group.num_rows;
+    for (size_t i = 0; i < _selected_columns.size(); ++i) {
+      if (!is_fixed_width_column[i]) {
+        group_size +=
+          row_group.columns[_selected_columns[i].first].meta_data.total_uncompressed_size;
+      }
+    }
+    const size_t row_size = std::max<size_t>(1, group_size / row_group.num_rows);
+
+    // Split the row group if it would not fit into a single chunk
+    const auto source_row_group = _metadata->get_source_row_group(rg.first);
+    size_t group_row            = 0;
+    while (group_row < static_cast<size_t>(row_group.num_rows)) {
+      const size_t remaining = (chunk_size < chunk_read_limit) ? chunk_read_limit - chunk_size : 0;
+      size_t rows = std::min<size_t>(row_group.num_rows - group_row, remaining / row_size);
+      if (rows == 0) {
+        if (chunk.num_rows != 0) {
+          row_chunks.push_back(std::move(chunk));
+          chunk      = row_group_chunk{};
+          chunk_size = 0;
+          continue;
+        }
+        rows = 1;  // Always make progress, even if a single row is above the limit
+      }
+      if (chunk.num_rows == 0) { chunk.skip_rows = static_cast<size_type>(group_row); }
+      if (chunk.row_groups.empty() || chunk.row_groups.back() != source_row_group) {
+        chunk.row_groups.push_back(source_row_group);
+      }
+      chunk.num_rows += static_cast<size_type>(rows);
+      chunk_size += rows * row_size;
+      group_row += rows;
+    }
+  }
+  if (chunk.num_rows != 0) { row_chunks.push_back(std::move(chunk)); }
+
+  return row_chunks;
+}
+
+void reader::impl::select_pages(hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+                                hostdevice_vector<gpu::PageInfo> &pages,
+                                size_t min_row,
+                                size_t total_rows,
+                                std::vector<size_type> const &row_counts,
+                                std::vector<int> const &chunk_map,
+                                std::vector<size_t> &skipped_rows) {
+  const size_t max_row = min_row + total_rows;
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    // Pages of repeated columns are not mapped to rows until their lists are assembled
+    if (chunks[c].max_rep_level > 0) {
+      page_count += chunks[c].max_num_pages;
+      continue;
+    }
+    for (int k = 0; k < chunks[c].max_num_pages; k++) {
+      auto &page = pages[page_count + k];
+      if (page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) { continue; }
+      // Output rows covered by the page, if any
+      const size_t page_begin = chunks[c].start_row + page.chunk_row;
+      const size_t page_end   = page_begin + page.num_rows;
+      const size_t out_begin  = std::min(std::max(page_begin, min_row), max_row) - min_row;
+      const size_t out_end    = std::min(std::max(page_end, min_row), max_row) - min_row;
+      if (row_counts[out_end] == row_counts[out_begin]) {
+        page.flags |= gpu::PAGEINFO_FLAGS_SKIP;
+        skipped_rows[chunk_map[c]] += out_end - out_begin;
+      }
+    }
+    page_count += chunks[c].max_num_pages;
+  }
+}
+
+std::vector<std::unique_ptr<column>> reader::impl::read_filtered_columns(
+  std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<rmm::device_buffer> &levels,
+  std::unique_ptr<column> &row_mask,
+  cudaStream_t stream) {
+  // Resolve the columns referenced by the filters, each of them only decoded once
+  const auto names = _metadata->get_column_names();
+  std::vector<std::pair<int, std::string>> filter_columns;
+  std::vector<size_t> filter_column_idx;
+  for (const auto &filter : _filters) {
+    auto it = std::find(names.begin(), names.end(), filter.column);
+    CUDF_EXPECTS(it != names.end(), "Filter column not found");
+    const int col = std::distance(names.begin(), it);
+    CUDF_EXPECTS(
+      _metadata->schema[_metadata->row_groups[0].columns[col].schema_idx].max_repetition_level == 0,
+      "Repeated (LIST) columns are not supported");
+    auto fc = std::find_if(filter_columns.begin(), filter_columns.end(), [&](const auto &c) {
+      return c.first == col;
+    });
+    filter_column_idx.emplace_back(std::distance(filter_columns.begin(), fc));
+    if (fc == filter_columns.end()) { filter_columns.emplace_back(col, filter.column); }
+  }
+
+  // First pass: decode the filter columns and evaluate the predicates on device
+  std::vector<rmm::device_buffer> filter_levels;
+  auto filter_data = read_columns(
+    filter_columns, selected_row_groups, skip_rows, num_rows, nullptr, filter_levels, stream);
+  if (filter_data.empty() || filter_data[0]->size() == 0) {
+    return read_columns(
+      _selected_columns, selected_row_groups, skip_rows, num_rows, nullptr, levels, stream);
+  }
+  std::unique_ptr<column> mask;
+  for (size_t i = 0; i < _filters.size(); ++i) {
+    auto filter_col = filter_data[filter_column_idx[i]]->view();
+    auto result     = evaluate_predicate(filter_col, _filters[i], stream);
+    if (mask != nullptr) {
+      result = binary_operation(
+        mask->view(), result->view(), binary_operator::LOGICAL_AND, data_type{BOOL8});
+    }
+    mask = std::move(result);
+  }
+
+  // Count the matching rows before each row, to find the pages without any of them
+  const size_type mask_size = mask->size();
+  auto d_mask               = column_device_view::create(mask->view(), stream);
+  rmm::device_vector<size_type> d_row_counts(mask_size + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(mask_size),
+    d_row_counts.begin() + 1,
+    [d_mask = *d_mask] __device__(size_type idx) {
+      return (d_mask.is_valid(idx) && d_mask.element<bool>(idx)) ? 1 : 0;
+    },
+    thrust::plus<size_type>());
+  std::vector<size_type> row_counts(mask_size + 1);
+  CUDA_TRY(cudaMemcpyAsync(row_counts.data(),
+                           d_row_counts.data().get(),
+                           row_counts.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+
+  // Second pass: decode the remaining columns, skipping the pages without matching rows
+  std::vector<std::pair<int, std::string>> payload_columns;
+  for (const auto &col : _selected_columns) {
+    if (std::find(filter_columns.begin(), filter_columns.end(), col) == filter_columns.end()) {
+      payload_columns.emplace_back(col);
+    }
+  }
+  std::vector<rmm::device_buffer> payload_levels;
+  auto payload_data = read_columns(payload_columns,
+                                   selected_row_groups,
+                                   skip_rows,
+                                   num_rows,
+                                   &row_counts,
+                                   payload_levels,
+                                   stream);
+
+  // Gather the selected columns; the rows that don't match are dropped once they are assembled
+  std::vector<std::unique_ptr<column>> selected_data;
+  levels.clear();
+  for (size_t i = 0, payload_idx = 0; i < _selected_columns.size(); ++i) {
+    auto fc = std::find(filter_columns.begin(), filter_columns.end(), _selected_columns[i]);
+    if (fc != filter_columns.end()) {
+      const auto filter_idx = std::distance(filter_columns.begin(), fc);
+      selected_data.emplace_back(std::move(filter_data[filter_idx]));
+      levels.emplace_back(std::move(filter_levels[filter_idx]));
+    } else {
+      selected_data.emplace_back(std::move(payload_data[payload_idx]));
+      levels.emplace_back(std::move(payload_levels[payload_idx++]));
+    }
+  }
+  row_mask = std::move(mask);
+  return selected_data;
+}
+
+std::vector<std::unique_ptr<column>> reader::impl::read_columns(
+  std::vector<std::pair<int, std::string>> const &columns,
+  std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<size_type> const *row_counts,
+  std::vector<rmm::device_buffer> &levels,
+  cudaStream_t stream) {
   std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata out_metadata;
+  levels.clear();
+  levels.resize(columns.size());
 
-  // Select only row groups required
-  const auto selected_row_groups = _metadata->select_row_groups(
-    row_group, max_rowgroup_count, row_group_indices, skip_rows, num_rows);
+  // Leaves of groups and lists output their levels, for their columns to be assembled
+  auto has_levels = [&](SchemaElement const &col_schema) {
+    return col_schema.parent_idx != 0 || col_schema.max_repetition_level > 0;
+  };
 
   // Get a list of column data types
   std::vector<data_type> column_types;
   if (_metadata->row_groups.size() != 0) {
-    for (const auto &col : _selected_columns) {
+    for (const auto &col : columns) {
       auto &col_schema = _metadata->schema[_metadata->row_groups[0].columns[col.first].schema_idx];
       auto col_type    = to_type_id(col_schema.type,
                                  col_schema.converted_type,
                                  _strings_to_categorical,
                                  _timestamp_type.id(),
-                                 col_schema.decimal_scale);
+                                 col_schema.decimal_scale,
+                                 _decimals_as_float);
       CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+      if (_strings_to_dictionary && col_type == type_id::STRING && !has_levels(col_schema)) {
+        col_type = type_id::DICTIONARY32;
+      }
+      if (col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64) {
+        // The stored integers are the decimals scaled by 10^decimal_scale
+        column_types.emplace_back(col_type, -col_schema.decimal_scale);
+      } else {
+        column_types.emplace_back(col_type);
+      }
     }
   }
   out_columns.reserve(column_types.size());
 
   if (selected_row_groups.size() != 0 && column_types.size() != 0) {
     // Descriptors for all the chunks that make up the selected columns
-    const auto num_columns = _selected_columns.size();
+    const auto num_columns = columns.size();
     const auto num_chunks  = selected_row_groups.size() * num_columns;
     hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, stream);
 
@@ -645,17 +1875,33 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
 
+    // Size of the dictionary pages and of the skipped data pages that follow them
+    std::vector<std::pair<size_t, size_t>> column_chunk_gaps(num_chunks);
+
+    // Host data of the chunk copies, kept until all of them are complete
+    std::vector<std::shared_ptr<arrow::Buffer>> host_buffers;
+
+    // Number of values of each column, where columns below a repeated field
+    // read all the values of the selected row groups
+    std::vector<size_t> column_sizes(num_columns, 0);
+
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
     auto remaining_rows            = num_rows;
     for (const auto &rg : selected_row_groups) {
       const auto &row_group = _metadata->row_groups[rg.first];
+      const auto source     = _sources[_metadata->row_group_source[rg.first]].get();
       auto row_group_start  = rg.second;
       auto row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
       auto io_chunk_idx     = chunks.size();
 
+      // Only some of the pages are needed if the row range partially covers the row group
+      const bool is_partial_row_group =
+        (static_cast<size_t>(skip_rows) > row_group_start) ||
+        (static_cast<size_t>(skip_rows) + num_rows < row_group_start + row_group.num_rows);
+
       for (size_t i = 0; i < num_columns; ++i) {
-        auto col         = _selected_columns[i];
+        auto col         = columns[i];
         auto &col_meta   = row_group.columns[col.first].meta_data;
         auto &col_schema = _metadata->schema[row_group.columns[col.first].schema_idx];
 
@@ -680,18 +1926,71 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           col_schema.converted_type,
                           col_schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        size_t chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        size_t chunk_size      = col_meta.total_compressed_size;
+        size_t chunk_values    = col_meta.num_values;
+        size_t chunk_start_row = row_group_start;
+        size_t chunk_rows      = row_group_rows;
+        auto &chunk_gap        = column_chunk_gaps[chunks.size()];
+        chunk_gap              = {0, 0};
+        if (col_schema.max_repetition_level > 0) {
+          // The rows of repeated columns are their values, all of them being decoded
+          chunk_start_row = column_sizes[i];
+          chunk_rows      = col_meta.num_values;
+          column_sizes[i] += col_meta.num_values;
+        }
+
+        // Use the page locations to skip the data pages outside of the row range
+        OffsetIndex offset_index;
+        if (is_partial_row_group && col_schema.max_repetition_level == 0 &&
+            read_page_index(source,
+                            row_group.columns[col.first].offset_index_offset,
+                            row_group.columns[col.first].offset_index_length,
+                            &offset_index) &&
+            !offset_index.page_locations.empty()) {
+          const auto &locs       = offset_index.page_locations;
+          const auto range_begin = static_cast<size_t>(skip_rows);
+          const auto range_end   = range_begin + num_rows;
+          auto page_end_row      = [&](size_t p) {
+            return row_group_start + ((p + 1 < locs.size()) ? locs[p + 1].first_row_index
+                                                             : row_group.num_rows);
+          };
+          size_t first = 0;
+          size_t last  = locs.size();
+          while (first < last && page_end_row(first) <= range_begin) { first++; }
+          while (last > first && row_group_start + locs[last - 1].first_row_index >= range_end) {
+            last--;
+          }
+          const size_t data_begin = locs[0].offset;
+          const size_t span_begin = (first < last) ? locs[first].offset : 0;
+          const size_t span_end =
+            (first < last) ? locs[last - 1].offset + locs[last - 1].compressed_page_size : 0;
+          if (first < last && data_begin >= chunk_offset && span_begin >= data_begin &&
+              span_end <= chunk_offset + chunk_size && (first > 0 || last < locs.size())) {
+            const size_t prefix_size = data_begin - chunk_offset;
+            if (prefix_size == 0) {
+              chunk_offset = span_begin;
+            } else if (span_begin > data_begin) {
+              chunk_gap = {prefix_size, span_begin - data_begin};
+            }
+            chunk_size      = prefix_size + (span_end - span_begin);
+            chunk_start_row = row_group_start + locs[first].first_row_index;
+            // Each row is a single value in non-repeated columns
+            chunk_values = page_end_row(last - 1) - chunk_start_row;
+          }
+        }
+        column_chunk_offsets[chunks.size()] = chunk_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           chunk_values,
                                            col_schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_rows,
                                            col_schema.max_definition_level,
                                            col_schema.max_repetition_level,
                                            required_bits(col_schema.max_definition_level),
@@ -709,12 +2008,23 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         }
       }
       // Read compressed chunk data to device memory
-      read_column_chunks(
-        page_data, chunks, io_chunk_idx, chunks.size(), column_chunk_offsets, stream);
+      read_column_chunks(source,
+                         page_data,
+                         chunks,
+                         io_chunk_idx,
+                         chunks.size(),
+                         column_chunk_offsets,
+                         column_chunk_gaps,
+                         host_buffers,
+                         stream);
 
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
+    if (!host_buffers.empty()) {
+      CUDF_STREAM_SYNC(stream);
+      host_buffers.clear();
+    }
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
@@ -723,6 +2033,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       rmm::device_buffer decomp_page_data;
 
       decode_page_headers(chunks, pages, stream);
+      std::vector<size_t> skipped_rows(columns.size(), 0);
+      if (row_counts != nullptr) {
+        select_pages(chunks, pages, skip_rows, num_rows, *row_counts, chunk_map, skipped_rows);
+        CUDA_TRY(cudaMemcpyAsync(pages.device_ptr(),
+                                 pages.host_ptr(),
+                                 pages.memory_size(),
+                                 cudaMemcpyHostToDevice,
+                                 stream));
+      }
       if (total_decompressed_size > 0) {
         decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
@@ -734,35 +2053,198 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         }
       }
 
+      // Dictionary columns are decoded as indices into the dictionary pages if
+      // all their data pages are dictionary-encoded, and as strings otherwise
+      std::vector<data_type> buffer_types(column_types);
+      std::vector<size_type> num_keys(num_columns, 0);
+      for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+        bool is_dict_encoded =
+          (chunks[c].data_type & 7) == BYTE_ARRAY && chunks[c].num_dict_pages > 0;
+        for (int k = chunks[c].num_dict_pages; k < chunks[c].max_num_pages; k++) {
+          const auto encoding = pages[page_count + k].encoding;
+          is_dict_encoded &= (encoding == PLAIN_DICTIONARY || encoding == RLE_DICTIONARY);
+        }
+        if (buffer_types[chunk_map[c]].id() == type_id::DICTIONARY32 && !is_dict_encoded) {
+          buffer_types[chunk_map[c]] = data_type{type_id::STRING};
+        }
+        page_count += chunks[c].max_num_pages;
+      }
+      for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+        if (buffer_types[chunk_map[c]].id() == type_id::DICTIONARY32) {
+          chunks[c].dict_key_offset = num_keys[chunk_map[c]];
+          num_keys[chunk_map[c]] += pages[page_count].num_values;
+        }
+        page_count += chunks[c].max_num_pages;
+      }
+
       std::vector<column_buffer> out_buffers;
       out_buffers.reserve(column_types.size());
       for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col = _selected_columns[i];
+        auto col = columns[i];
         auto &col_schema =
           _metadata->schema
             [_metadata->row_groups[selected_row_groups[0].first].columns[col.first].schema_idx];
         bool is_nullable = (col_schema.max_definition_level != 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        // Strings are decoded straight into the chars of the output column
+        bool direct_strings = (col_schema.type == BYTE_ARRAY);
+        if (col_schema.max_repetition_level == 0) { column_sizes[i] = num_rows; }
+        out_buffers.emplace_back(
+          buffer_types[i], column_sizes[i], is_nullable, stream, _mr, direct_strings);
+        out_buffers.back()._keys.resize(num_keys[i]);
+        // Each value has a definition level byte followed by a repetition level byte
+        if (has_levels(col_schema)) {
+          levels[i] = rmm::device_buffer(column_sizes[i] * 2, stream, _mr);
+          CUDA_TRY(cudaMemsetAsync(levels[i].data(), 0, levels[i].size(), stream));
+        }
       }
 
-      decode_page_data(chunks, pages, skip_rows, num_rows, chunk_map, out_buffers, stream);
+      decode_page_data(
+        chunks, pages, skip_rows, num_rows, chunk_map, out_buffers, levels, stream);
+
+      // Rows of skipped pages are left null
+      for (size_t i = 0; i < out_buffers.size(); ++i) {
+        if (out_buffers[i].null_mask() != nullptr) {
+          out_buffers[i].null_count() += skipped_rows[i];
+        }
+      }
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        auto out_column =
+          make_column(buffer_types[i], column_sizes[i], out_buffers[i], stream, _mr);
+        if (column_types[i].id() != buffer_types[i].id()) {
+          out_column = dictionary::encode(out_column->view(), data_type{type_id::INT32}, _mr);
+        }
+        out_columns.emplace_back(std::move(out_column));
       }
     }
   }
 
   // Create empty columns as needed
   for (size_t i = out_columns.size(); i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_empty_column(column_types[i]));
+    if (column_types[i].id() == type_id::DICTIONARY32) {
+      out_columns.emplace_back(make_dictionary_column(make_empty_column(data_type{STRING}),
+                                                      make_empty_column(data_type{INT32}),
+                                                      rmm::device_buffer{},
+                                                      0));
+    } else {
+      out_columns.emplace_back(make_empty_column(column_types[i]));
+    }
+  }
+
+  return out_columns;
+}
+
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       size_type row_group,
+                                       size_type max_rowgroup_count,
+                                       const size_type *row_group_indices,
+                                       cudaStream_t stream) {
+  // With filters, a row range applies to the rows of the row groups that pass them, so all
+  // the row groups are selected and filtered before the range is applied
+  const bool filter_by_rows = !_filters.empty() && row_group == -1 && !row_group_indices;
+  size_type selected_start  = filter_by_rows ? 0 : skip_rows;
+  size_type selected_count  = filter_by_rows ? -1 : num_rows;
+
+  // Select only row groups required
+  auto selected_row_groups = _metadata->select_row_groups(
+    row_group, max_rowgroup_count, row_group_indices, selected_start, selected_count);
+
+  if (_filters.empty()) {
+    skip_rows = selected_start;
+    num_rows  = selected_count;
+  } else {
+    // Skip row groups whose statistics rule out any matching rows
+    _metadata->filter_row_groups(_sources, selected_row_groups, _filters);
+    if (!filter_by_rows) {
+      skip_rows = 0;
+      num_rows  = -1;
+    }
+    _metadata->trim_row_groups(selected_row_groups, skip_rows, num_rows);
+  }
+
+  return read_selected_row_groups(selected_row_groups, skip_rows, num_rows, stream);
+}
+
+table_with_metadata reader::impl::read_chunk(row_group_chunk const &chunk, cudaStream_t stream) {
+  // The row groups of the chunk have already passed the filters
+  std::vector<std::pair<size_type, size_t>> selected_row_groups;
+  size_t row_group_start = 0;
+  for (const auto &rg : chunk.row_groups) {
+    const auto row_group_idx = _metadata->get_row_group_index(rg.first, rg.second);
+    selected_row_groups.emplace_back(row_group_idx, row_group_start);
+    row_group_start += _metadata->row_groups[row_group_idx].num_rows;
+  }
+  CUDF_EXPECTS(chunk.skip_rows >= 0 && chunk.num_rows >= 0 &&
+                 static_cast<size_t>(chunk.skip_rows) + chunk.num_rows <= row_group_start,
+               "Invalid row range of row group chunk");
+
+  return read_selected_row_groups(selected_row_groups, chunk.skip_rows, chunk.num_rows, stream);
+}
+
+table_with_metadata reader::impl::read_selected_row_groups(
+  std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  cudaStream_t stream) {
+  std::vector<std::unique_ptr<column>> leaf_columns;
+  std::vector<rmm::device_buffer> leaf_levels;
+  std::unique_ptr<column> row_mask;
+  table_metadata out_metadata;
+
+  if (_filter_rows && !_filters.empty()) {
+    leaf_columns = read_filtered_columns(
+      selected_row_groups, skip_rows, num_rows, leaf_levels, row_mask, stream);
+  } else {
+    leaf_columns = read_columns(
+      _selected_columns, selected_row_groups, skip_rows, num_rows, nullptr, leaf_levels, stream);
+  }
+
+  // Values of repeated leaves are kept if they are in a row of the range, which is counted
+  // from the first selected row group
+  const auto &schema      = _metadata->schema;
+  const int64_t first_row =
+    selected_row_groups.empty() ? 0 : skip_rows - int64_t(selected_row_groups[0].second);
+  std::vector<nested_leaf> leaves(leaf_columns.size());
+  for (size_t i = 0; i < leaves.size(); ++i) {
+    auto &leaf      = leaves[i];
+    leaf.schema_idx = _metadata->row_groups[0].columns[_selected_columns[i].first].schema_idx;
+    leaf.values     = std::move(leaf_columns[i]);
+    leaf.levels     = static_cast<const uint8_t *>(leaf_levels[i].data());
+    leaf.num_uses   = std::count_if(
+      _output_columns.begin(), _output_columns.end(), [&](const auto &col) {
+        return is_descendant(schema, leaf.schema_idx, col.first);
+      });
+    if (schema[leaf.schema_idx].max_repetition_level > 0) {
+      leaf.in_range =
+        values_in_range(leaf.levels, leaf.values->size(), first_row, num_rows, stream);
+    }
+  }
+
+  // Assemble the output columns from their leaves
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (const auto &col : _output_columns) {
+    std::vector<nested_leaf *> col_leaves;
+    std::vector<rmm::device_vector<bool>> row_masks;
+    for (auto &leaf : leaves) {
+      if (is_descendant(schema, leaf.schema_idx, col.first)) {
+        col_leaves.push_back(&leaf);
+        row_masks.emplace_back(row_start_mask(leaf, stream));
+      }
+    }
+    out_columns.emplace_back(
+      assemble_column(schema, col.first, false, col_leaves, row_masks, stream, _mr));
+  }
+  if (row_mask != nullptr) {
+    std::vector<column_view> out_views;
+    for (const auto &col : out_columns) { out_views.emplace_back(col->view()); }
+    out_columns = apply_boolean_mask(table_view(out_views), row_mask->view(), _mr)->release();
   }
 
   // Return column names (must match order of returned columns)
-  out_metadata.column_names.resize(_selected_columns.size());
-  for (size_t i = 0; i < _selected_columns.size(); i++) {
-    out_metadata.column_names[i] = _selected_columns[i].second;
+  out_metadata.column_names.resize(_output_columns.size());
+  for (size_t i = 0; i < _output_columns.size(); i++) {
+    out_metadata.column_names[i] = _output_columns[i].second;
   }
   // Return user metadata
   for (const auto &kv : _metadata->key_value_metadata) {
@@ -772,24 +2254,64 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+namespace {
+
+std::vector<std::unique_ptr<datasource>> make_source_list(std::unique_ptr<datasource> source) {
+  std::vector<std::unique_ptr<datasource>> sources;
+  sources.emplace_back(std::move(source));
+  return sources;
+}
+
+}  // namespace
+
 // Forward to implementation
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr)) {}
+  : _impl(std::make_unique<impl>(make_source_list(datasource::create(filepath)),
+                                 std::vector<std::string>{filepath},
+                                 options,
+                                 mr)) {}
 
 // Forward to implementation
 reader::reader(const char *buffer,
                size_t length,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(buffer, length), options, mr)) {}
+  : _impl(std::make_unique<impl>(make_source_list(datasource::create(buffer, length)),
+                                 std::vector<std::string>(1),
+                                 options,
+                                 mr)) {}
 
 // Forward to implementation
 reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(file), options, mr)) {}
+  : _impl(std::make_unique<impl>(
+      make_source_list(datasource::create(file)), std::vector<std::string>(1), options, mr)) {}
+
+// Forward to implementation
+reader::reader(std::vector<source_info> const &sources,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr) {
+  std::vector<std::unique_ptr<datasource>> datasources;
+  std::vector<std::string> paths;
+  for (const auto &src : sources) {
+    if (src.type == io_type::FILEPATH) {
+      datasources.emplace_back(datasource::create(src.filepath));
+      paths.emplace_back(src.filepath);
+    } else if (src.type == io_type::HOST_BUFFER) {
+      datasources.emplace_back(datasource::create(src.buffer.first, src.buffer.second));
+      paths.emplace_back();
+    } else if (src.type == io_type::ARROW_RANDOM_ACCESS_FILE) {
+      datasources.emplace_back(datasource::create(src.file));
+      paths.emplace_back();
+    } else {
+      CUDF_FAIL("Unsupported source type");
+    }
+  }
+  _impl = std::make_unique<impl>(std::move(datasources), paths, options, mr);
+}
 
 // Destructor within this translation unit
 reader::~reader() = default;
@@ -813,6 +2335,17 @@ table_with_metadata reader::read_row_groups(const std::vector<size_type> &row_gr
     0, -1, -1, static_cast<size_type>(row_group_list.size()), row_group_list.data(), stream);
 }
 
+// Forward to implementation
+std::vector<row_group_chunk> reader::get_row_chunks(size_t chunk_read_limit) {
+  return _impl->compute_row_chunks(chunk_read_limit);
+}
+
+// Forward to implementation
+table_with_metadata reader::read_row_group_chunk(row_group_chunk const &chunk,
+                                                 cudaStream_t stream) {
+  return _impl->read_chunk(chunk, stream);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type skip_rows,
                                       size_type num_rows,
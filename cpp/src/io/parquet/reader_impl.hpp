@@ -53,13 +53,18 @@ class metadata;
 class reader::impl {
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from a list of dataset sources with reader options.
    *
-   * @param source Dataset source
+   * The row groups of all the sources are read as a single dataset, in order.
+   *
+   * @param sources Dataset sources
+   * @param paths File path of each source, used to cache the parsed file
+   * metadata; empty for sources that are not files
    * @param options Settings for controlling reading behavior
    * @param mr Resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &paths,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -82,23 +87,67 @@ class reader::impl {
                            const size_type *row_group_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Splits the row groups that pass the filters into chunks whose
+   * estimated decoded size is at most the given number of bytes
+   *
+   * @param chunk_read_limit Limit on the decoded output size of each chunk
+   *
+   * @return List of chunks, each listing its row groups
+   */
+  std::vector<row_group_chunk> compute_row_chunks(size_t chunk_read_limit);
+
+  /**
+   * @brief Reads the rows of a chunk returned by `compute_row_chunks()`
+   *
+   * @param chunk Row groups and range of their rows to read
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(row_group_chunk const &chunk, cudaStream_t stream);
+
  private:
+  /**
+   * @brief Reads a range of the rows of the selected row groups
+   *
+   * @param selected_row_groups List of row group indexes and their starting row
+   * @param skip_rows Starting row of the range, in the rows of the selection
+   * @param num_rows Number of rows of the range
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_selected_row_groups(
+    std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    cudaStream_t stream);
+
   /**
    * @brief Reads compressed page data to device memory
    *
+   * @param source Dataset source containing the chunks
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_gaps Size of the leading dictionary pages and of the
+   * skipped data pages that follow them, for chunks that are partially read
+   * @param host_buffers Host buffers the copies are made from; they must be
+   * kept until `stream` is synchronized
    * @param stream Stream to use for memory allocation and kernels
    *
    */
-  void read_column_chunks(std::vector<rmm::device_buffer> &page_data,
+  void read_column_chunks(datasource *source,
+                          std::vector<rmm::device_buffer> &page_data,
                           hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          const std::vector<std::pair<size_t, size_t>> &column_chunk_gaps,
+                          std::vector<std::shared_ptr<arrow::Buffer>> &host_buffers,
                           cudaStream_t stream);
 
   /**
@@ -144,6 +193,8 @@ class reader::impl {
    * @param total_rows Number of rows to output
    * @param chunk_map Mapping between chunk and column
    * @param out_buffers Output columns' device buffers
+   * @param out_levels Output buffers for the definition and repetition level
+   * pairs of each column, left empty for columns without nesting
    * @param stream Stream to use for memory allocation and kernels
    */
   void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -152,16 +203,92 @@ class reader::impl {
                         size_t total_rows,
                         const std::vector<int> &chunk_map,
                         std::vector<column_buffer> &out_buffers,
+                        std::vector<rmm::device_buffer> &out_levels,
                         cudaStream_t stream);
 
+  /**
+   * @brief Flags the data pages that don't contain any row to output, so that
+   * they are neither decompressed nor decoded.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param min_row Minimum number of rows from start
+   * @param total_rows Number of rows to output
+   * @param row_counts Number of output rows kept before each row [total_rows + 1]
+   * @param chunk_map Mapping between chunk and column
+   * @param skipped_rows Number of rows skipped in each column
+   */
+  void select_pages(hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+                    hostdevice_vector<gpu::PageInfo> &pages,
+                    size_t min_row,
+                    size_t total_rows,
+                    std::vector<size_type> const &row_counts,
+                    std::vector<int> const &chunk_map,
+                    std::vector<size_t> &skipped_rows);
+
+  /**
+   * @brief Reads and decodes a set of columns from the selected row groups.
+   *
+   * @param columns Columns to read
+   * @param selected_row_groups Selected row groups (source index, row group index)
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_counts If non-null, number of rows kept before each row; the
+   * pages without any kept row are skipped
+   * @param levels Set to the definition and repetition level pairs of the
+   * values of each column nested in a group or list, empty for the others
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The decoded columns; columns below a repeated field hold all the
+   * values of the selected row groups, the others hold the rows to read
+   */
+  std::vector<std::unique_ptr<column>> read_columns(
+    std::vector<std::pair<int, std::string>> const &columns,
+    std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    std::vector<size_type> const *row_counts,
+    std::vector<rmm::device_buffer> &levels,
+    cudaStream_t stream);
+
+  /**
+   * @brief Reads the selected columns along with the mask of the rows that
+   * satisfy all the filters.
+   *
+   * The filter columns are decoded first; the other columns then skip the
+   * pages that don't contain any matching row.
+   *
+   * @param selected_row_groups Selected row groups (source index, row group index)
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param levels Set to the level pairs of the columns, as in `read_columns()`
+   * @param row_mask Set to the BOOL8 mask of the matching rows, or null if all
+   * the rows are kept
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The decoded columns, as in `read_columns()`
+   */
+  std::vector<std::unique_ptr<column>> read_filtered_columns(
+    std::vector<std::pair<size_type, size_t>> const &selected_row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    std::vector<rmm::device_buffer> &levels,
+    std::unique_ptr<column> &row_mask,
+    cudaStream_t stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
-  std::unique_ptr<datasource> _source;
+  std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<metadata> _metadata;
 
-  std::vector<std::pair<int, std::string>> _selected_columns;
+  std::vector<std::pair<int, std::string>> _output_columns;    // Schema node and name
+  std::vector<std::pair<int, std::string>> _selected_columns;  // Column chunk and leaf path
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+  bool _decimals_as_float      = true;
   data_type _timestamp_type{type_id::EMPTY};
+  std::vector<column_predicate> _filters;
+  bool _filter_rows = false;
 };
 
 }  // namespace parquet
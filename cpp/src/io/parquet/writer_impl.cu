@@ -20,12 +20,20 @@
  */
 
 #include "writer_impl.hpp"
+#include "bloom_filter.h"
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -43,10 +51,17 @@ using namespace cudf::io;
 namespace {
 
 /**
- * @brief Helper for pinned host memory
+ * @brief Returns the size in bytes of a split block Bloom filter for the given
+ * number of distinct values and false positive probability
+ *
+ * The size is rounded up to a power of two and clamped to `max_bytes`.
  **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+uint32_t bloom_filter_size(size_t num_values, double fpp, uint32_t max_bytes) {
+  const double num_bits = -8.0 * num_values / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  uint32_t num_bytes    = BLOOM_FILTER_MIN_BYTES;
+  while (num_bytes < max_bytes && num_bytes * 8.0 < num_bits) { num_bytes <<= 1; }
+  return num_bytes;
+}
 
 /**
  * @brief Function that translates GDF compression to parquet compression
@@ -55,6 +70,7 @@ parquet::Compression to_parquet_compression(compression_type compression) {
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::LZ4: return parquet::Compression::LZ4;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -104,7 +120,7 @@ class parquet_column_view {
    **/
   explicit parquet_column_view(size_t id,
                                column_view const &col,
-                               const table_metadata *metadata,
+                               std::string name,
                                cudaStream_t stream)
     : _id(id),
       _string_type(col.type().id() == type_id::STRING),
@@ -114,7 +130,8 @@ class parquet_column_view {
       _data_count(col.size()),
       _null_count(col.null_count()),
       _data(col.head<uint8_t>() + col.offset() * _type_width),
-      _nulls(col.nullable() ? col.null_mask() : nullptr) {
+      _nulls(col.nullable() ? col.null_mask() : nullptr),
+      _name(std::move(name)) {
     switch (col.type().id()) {
       case cudf::type_id::INT8:
         _physical_type  = Type::INT32;
@@ -193,13 +210,7 @@ class parquet_column_view {
         _nulls,
         _data_count);
       _data = _indexes.data();
-      CUDA_TRY(cudaStreamSynchronize(stream));
-    }
-    // Generating default name if name isn't present in metadata
-    if (metadata && _id < metadata->column_names.size()) {
-      _name = metadata->column_names[_id];
-    } else {
-      _name = "_col" + std::to_string(_id);
+      CUDF_STREAM_SYNC(stream);
     }
   }
 
@@ -262,6 +273,224 @@ class parquet_column_view {
   rmm::device_buffer _indexes;
 };
 
+namespace {
+
+/**
+ * @brief Columns on the path from a column of the table down to a leaf of the schema
+ **/
+struct schema_leaf {
+  std::vector<column_view> path;            //!< Column of each node, top-level column first
+  std::vector<size_t> node_schema_idx;      //!< Schema node of each column of the path
+  std::vector<std::string> path_in_schema;  //!< Names of the schema nodes down to the leaf
+  size_t schema_idx = 0;                    //!< Schema node of the leaf
+  int max_def_level = 0;
+  int max_rep_level = 0;
+
+  bool is_nested() const noexcept { return path.size() > 1; }
+  std::string dotted_path() const {
+    std::string dotted = path_in_schema[0];
+    for (size_t k = 1; k < path_in_schema.size(); k++) { dotted += "." + path_in_schema[k]; }
+    return dotted;
+  }
+};
+
+/**
+ * @brief Appends the schema nodes of a column and of its children, and the leaves below them
+ *
+ * Lists use the 3-level LIST layout `<repetition> group <name> (LIST) { repeated group list
+ * { <repetition> element } }`, and the fields of structs are named `_col<field index>`. The
+ * children are OPTIONAL unless the table is known to be the only one written and they have no
+ * null mask. The types of the leaves are set by the caller.
+ **/
+void add_schema_nodes(column_view const &col,
+                      std::string const &name,
+                      FieldRepetitionType repetition_type,
+                      bool single_write_mode,
+                      schema_leaf path,
+                      std::vector<SchemaElement> &schema,
+                      std::vector<schema_leaf> &leaves) {
+  auto child_repetition = [&](column_view const &child) {
+    return (!single_write_mode || child.nullable()) ? OPTIONAL : REQUIRED;
+  };
+  path.path.push_back(col);
+  path.node_schema_idx.push_back(schema.size());
+  path.path_in_schema.push_back(name);
+  if (repetition_type == OPTIONAL) { path.max_def_level++; }
+
+  SchemaElement node;
+  node.name            = name;
+  node.repetition_type = repetition_type;
+  if (col.type().id() == type_id::LIST) {
+    CUDF_EXPECTS(path.max_rep_level == 0, "Nested lists are not supported");
+    node.converted_type = ConvertedType::LIST;
+    node.num_children   = 1;
+    schema.push_back(node);
+    SchemaElement list;
+    list.name            = "list";
+    list.repetition_type = REPEATED;
+    list.num_children    = 1;
+    schema.push_back(list);
+    path.path_in_schema.push_back(list.name);
+    path.max_def_level++;
+    path.max_rep_level++;
+    auto const child = lists_column_view(col).child();
+    add_schema_nodes(child,
+                     "element",
+                     child_repetition(child),
+                     single_write_mode,
+                     std::move(path),
+                     schema,
+                     leaves);
+  } else if (col.type().id() == type_id::STRUCT) {
+    CUDF_EXPECTS(col.num_children() > 0, "Structs without fields are not supported");
+    node.num_children = col.num_children();
+    schema.push_back(node);
+    for (size_type j = 0; j < col.num_children(); j++) {
+      auto const child = col.child(j);
+      add_schema_nodes(child,
+                       "_col" + std::to_string(j),
+                       child_repetition(child),
+                       single_write_mode,
+                       path,
+                       schema,
+                       leaves);
+    }
+  } else {
+    path.schema_idx = schema.size();
+    schema.push_back(node);
+    leaves.push_back(std::move(path));
+  }
+}
+
+/**
+ * @brief Levels of the values of a nested leaf, one value per leaf element, null list or
+ * empty list
+ **/
+struct nested_levels {
+  std::vector<uint32_t> level_offsets;  //!< First value of each row [row + 1]
+  std::vector<uint8_t> def_levels;      //!< Definition level of each value
+  std::vector<uint8_t> rep_levels;      //!< Repetition level of each value (lists only)
+  std::unique_ptr<column> values;       //!< Leaf element of each value, null if not defined
+};
+
+/**
+ * @brief Returns the number of bits required to encode levels up to `max_level`
+ **/
+uint8_t level_bit_width(int max_level) {
+  uint8_t bits = 0;
+  while ((max_level >> bits) != 0) { bits++; }
+  return bits;
+}
+
+/**
+ * @brief Computes the levels of the values of a nested leaf and gathers its elements
+ *
+ * The columns of the path are walked from the top-level column down to the leaf on the host,
+ * expanding the rows of the list into their elements.
+ **/
+nested_levels flatten_nested_leaf(schema_leaf const &leaf,
+                                  std::vector<SchemaElement> const &schema,
+                                  cudaStream_t stream) {
+  struct value_entry {
+    int64_t idx;  // Element of the current column, including its offset, or -1 if not defined
+    uint8_t def;
+    uint8_t rep;
+  };
+  auto const &top = leaf.path[0];
+  std::vector<value_entry> entries(top.size());
+  for (size_type r = 0; r < top.size(); r++) { entries[r] = {top.offset() + r, 0, 0}; }
+
+  for (size_t d = 0; d < leaf.path.size(); d++) {
+    auto const &col = leaf.path[d];
+    if (schema[leaf.node_schema_idx[d]].repetition_type == OPTIONAL) {
+      std::vector<bitmask_type> mask;
+      if (col.nullable()) {
+        mask.resize(num_bitmask_words(col.offset() + col.size()));
+        CUDA_TRY(cudaMemcpyAsync(mask.data(),
+                                 col.null_mask(),
+                                 mask.size() * sizeof(bitmask_type),
+                                 cudaMemcpyDeviceToHost,
+                                 stream));
+        CUDF_STREAM_SYNC(stream);
+      }
+      for (auto &e : entries) {
+        if (e.idx < 0) { continue; }
+        if (!mask.empty() && !bit_is_set(mask.data(), static_cast<size_type>(e.idx))) {
+          e.idx = -1;
+        } else {
+          e.def++;
+        }
+      }
+    }
+    if (d + 1 == leaf.path.size()) { break; }
+    auto const &child = leaf.path[d + 1];
+    if (col.type().id() == type_id::LIST) {
+      // Every element is a value of the repeated group, empty and null lists being one value
+      std::vector<size_type> offsets(col.offset() + col.size() + 1);
+      CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                               lists_column_view(col).offsets().data<size_type>(),
+                               offsets.size() * sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDF_STREAM_SYNC(stream);
+      std::vector<value_entry> elements;
+      elements.reserve(entries.size());
+      for (auto const &e : entries) {
+        size_type const count = (e.idx >= 0) ? offsets[e.idx + 1] - offsets[e.idx] : 0;
+        if (count == 0) {
+          elements.push_back({-1, e.def, e.rep});
+          continue;
+        }
+        for (size_type k = 0; k < count; k++) {
+          elements.push_back({child.offset() + offsets[e.idx] + k,
+                              static_cast<uint8_t>(e.def + 1),
+                              static_cast<uint8_t>((k > 0) ? 1 : e.rep)});
+        }
+      }
+      entries = std::move(elements);
+    } else {
+      // The fields of a struct share its rows
+      for (auto &e : entries) {
+        if (e.idx >= 0) { e.idx += child.offset(); }
+      }
+    }
+  }
+
+  auto const &values = leaf.path.back();
+  nested_levels levels;
+  std::vector<size_type> gather_map(entries.size());
+  levels.def_levels.resize(entries.size());
+  if (leaf.max_rep_level > 0) { levels.rep_levels.resize(entries.size()); }
+  levels.level_offsets.reserve(top.size() + 1);
+  for (size_t v = 0; v < entries.size(); v++) {
+    auto const &e = entries[v];
+    if (e.rep == 0) { levels.level_offsets.push_back(static_cast<uint32_t>(v)); }
+    levels.def_levels[v] = e.def;
+    if (leaf.max_rep_level > 0) { levels.rep_levels[v] = e.rep; }
+    // Values that are not defined are gathered out of bounds, as nulls
+    gather_map[v] = (e.def == leaf.max_def_level)
+                      ? static_cast<size_type>(e.idx - values.offset())
+                      : values.size();
+  }
+  levels.level_offsets.push_back(static_cast<uint32_t>(entries.size()));
+
+  rmm::device_vector<size_type> d_gather_map(gather_map);
+  column_view map_view(data_type(type_id::INT32),
+                       static_cast<size_type>(gather_map.size()),
+                       d_gather_map.data().get());
+  auto gathered = cudf::experimental::detail::gather(table_view{std::vector<column_view>{values}},
+                                                     map_view,
+                                                     false,
+                                                     true,
+                                                     false,
+                                                     rmm::mr::get_default_resource(),
+                                                     stream);
+  levels.values = std::move(gathered->release()[0]);
+  return levels;
+}
+
+}  // namespace
+
 void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &frag,
                                        hostdevice_vector<gpu::EncColumnDesc> &col_desc,
                                        uint32_t num_columns,
@@ -283,7 +512,7 @@ void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &fra
                                   stream));
   CUDA_TRY(cudaMemcpyAsync(
     frag.host_ptr(), frag.device_ptr(), frag.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk,
@@ -304,7 +533,7 @@ void writer::impl::gather_fragment_statistics(statistics_chunk *frag_stats_chunk
                                        stream));
   CUDA_TRY(GatherColumnStatistics(
     frag_stats_chunk, frag_stats_group.data().get(), num_fragments * num_columns, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk> &chunks,
@@ -312,15 +541,23 @@ void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChun
                                             uint32_t num_rowgroups,
                                             uint32_t num_columns,
                                             uint32_t num_dictionaries,
+                                            uint32_t fragment_size,
                                             cudaStream_t stream) {
   size_t dict_scratch_size = (size_t)num_dictionaries * gpu::kDictScratchSize;
   rmm::device_vector<uint32_t> dict_scratch(dict_scratch_size / sizeof(uint32_t));
+  uint32_t max_fragments = 0;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    max_fragments =
+      std::max(max_fragments, (chunks[i].num_rows + fragment_size - 1) / fragment_size);
+  }
   CUDA_TRY(cudaMemcpyAsync(
     chunks.device_ptr(), chunks.host_ptr(), chunks.memory_size(), cudaMemcpyHostToDevice, stream));
   CUDA_TRY(gpu::BuildChunkDictionaries(chunks.device_ptr(),
                                        dict_scratch.data().get(),
                                        dict_scratch_size,
                                        num_rowgroups * num_columns,
+                                       fragment_size,
+                                       max_fragments,
                                        stream));
   CUDA_TRY(gpu::InitEncoderPages(chunks.device_ptr(),
                                  nullptr,
@@ -329,10 +566,11 @@ void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChun
                                  num_columns,
                                  nullptr,
                                  nullptr,
+                                 static_cast<uint32_t>(target_page_size_),
                                  stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
@@ -356,6 +594,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
     num_columns,
     (num_stats_bfr) ? page_stats_mrg.data().get() : nullptr,
     (num_stats_bfr > num_pages) ? page_stats_mrg.data().get() + num_pages : nullptr,
+    static_cast<uint32_t>(target_page_size_),
     stream));
   if (num_stats_bfr > 0) {
     CUDA_TRY(MergeColumnStatistics(
@@ -368,7 +607,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
                                      stream));
     }
   }
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 }
 
 void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
@@ -387,7 +626,11 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
     pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream));
   switch (compression_) {
     case parquet::Compression::SNAPPY:
-      CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
+      CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, compression_level_, stream));
+      break;
+    case parquet::Compression::LZ4:
+      // Hadoop-framed blocks, as written by parquet-mr
+      CUDA_TRY(gpu_lz4(comp_in, comp_out, pages_in_batch, 1, stream));
       break;
     default: break;
   }
@@ -415,16 +658,26 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                            rowgroups_in_batch * num_columns * sizeof(gpu::EncColumnChunk),
                            cudaMemcpyDeviceToHost,
                            stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr),
+    max_rowgroup_size_(options.row_group_size_bytes != 0 ? options.row_group_size_bytes
+                                                         : DEFAULT_ROWGROUP_MAXSIZE),
+    max_rowgroup_rows_(options.row_group_size_rows != 0 ? options.row_group_size_rows
+                                                        : DEFAULT_ROWGROUP_MAXROWS),
+    target_page_size_(options.max_page_size_bytes != 0 ? options.max_page_size_bytes
+                                                       : DEFAULT_TARGET_PAGE_SIZE),
     compression_(to_parquet_compression(options.compression)),
+    compression_level_(options.compression_level),
     stats_granularity_(options.stats_granularity),
-    out_sink_(std::move(sink)) {}
+    enable_delta_encoding_(options.enable_delta_encoding),
+    bloom_filter_columns_(options.bloom_filter_columns),
+    out_sink_(std::move(sink)) {
+  CUDF_EXPECTS(target_page_size_ <= std::numeric_limits<int32_t>::max(), "Invalid page size");
+}
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &table,
                                                           const table_metadata *metadata,
@@ -451,40 +704,85 @@ void writer::impl::write_chunked_begin(pq_chunked_state &state) {
 }
 
 void writer::impl::write_chunked(table_view const &table, pq_chunked_state &state) {
-  size_type num_columns = table.num_columns();
-  size_type num_rows    = 0;
-
-  // Wrapper around cudf columns to attach parquet-specific type info.
-  // Note : I wish we could do this in the begin() function but since the
-  // metadata is optional we would have no way of knowing how many columns
-  // we actually have.
-  std::vector<parquet_column_view> parquet_columns;
-  parquet_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
-  for (auto it = table.begin(); it < table.end(); ++it) {
-    const auto col        = *it;
-    const auto current_id = parquet_columns.size();
-
-    num_rows = std::max<uint32_t>(num_rows, col.size());
-    parquet_columns.emplace_back(current_id, col, state.user_metadata, state.stream);
-  }
+  size_type num_top_columns = table.num_columns();
+  size_type num_rows        = 0;
+  for (auto const &col : table) { num_rows = std::max<uint32_t>(num_rows, col.size()); }
 
   if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
     CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() ==
-                   static_cast<size_t>(num_columns),
+                   static_cast<size_t>(num_top_columns),
                  "When passing values in user_metadata_with_nullability, data for all columns must "
                  "be specified");
   }
 
+  // Schema of this table, the leaves of LIST and STRUCT columns being its columns of data
+  std::vector<SchemaElement> schema(1);
+  schema[0].type            = UNDEFINED_TYPE;
+  schema[0].repetition_type = NO_REPETITION_TYPE;
+  schema[0].name            = "schema";
+  schema[0].num_children    = num_top_columns;
+  std::vector<schema_leaf> leaves;
+  for (auto i = 0; i < num_top_columns; i++) {
+    const auto col = table.column(i);
+    // Generating default name if name isn't present in metadata
+    const std::string name = (state.user_metadata && static_cast<size_t>(i) <
+                                                       state.user_metadata->column_names.size())
+                               ? state.user_metadata->column_names[i]
+                               : "_col" + std::to_string(i);
+    // because the repetition type is global (in the sense of, not per-rowgroup or per write_chunked() call)
+    // we cannot know up front if the user is going to end up passing tables with nulls/no nulls in the
+    // multiple write_chunked() case.  so we'll do some special handling.
+    //
+    // if the user is explictly saying "I am only calling this once", fall back to the original behavior and assume
+    // the columns in this one table tell us everything we need to know.
+    FieldRepetitionType repetition_type;
+    if (state.single_write_mode) {
+      repetition_type = (col.nullable() || col.size() < num_rows) ? OPTIONAL : REQUIRED;
+    }
+    // otherwise, if the user is explicitly telling us global information about all the tables that will ever get passed in
+    else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
+      repetition_type =
+        state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
+    }
+    // otherwise assume the worst case.
+    else {
+      repetition_type = OPTIONAL;
+    }
+    add_schema_nodes(
+      col, name, repetition_type, state.single_write_mode, schema_leaf{}, schema, leaves);
+  }
+  size_type num_columns = static_cast<size_type>(leaves.size());
+
+  // Values and levels of the nested leaves, their rows being their values on the device
+  std::vector<nested_levels> nested(num_columns);
+  std::vector<rmm::device_vector<uint32_t>> level_offsets(num_columns);
+  std::vector<rmm::device_vector<uint8_t>> def_levels(num_columns);
+  std::vector<rmm::device_vector<uint8_t>> rep_levels(num_columns);
+  for (auto i = 0; i < num_columns; i++) {
+    if (!leaves[i].is_nested()) { continue; }
+    nested[i]        = flatten_nested_leaf(leaves[i], schema, state.stream);
+    level_offsets[i] = nested[i].level_offsets;
+    def_levels[i]    = nested[i].def_levels;
+    rep_levels[i]    = nested[i].rep_levels;
+  }
+
+  // Wrapper around cudf columns to attach parquet-specific type info.
+  std::vector<parquet_column_view> parquet_columns;
+  parquet_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
+  for (auto i = 0; i < num_columns; i++) {
+    auto &node     = schema[leaves[i].schema_idx];
+    const auto col = (leaves[i].is_nested()) ? nested[i].values->view() : leaves[i].path[0];
+    parquet_columns.emplace_back(i, col, node.name, state.stream);
+    node.type           = parquet_columns[i].physical_type();
+    node.converted_type = parquet_columns[i].converted_type();
+  }
+
   // first call. setup metadata. num_rows will get incremented as write_chunked is
   // called multiple times.
   if (state.md.version == 0) {
     state.md.version  = 1;
     state.md.num_rows = num_rows;
-    state.md.schema.resize(1 + num_columns);
-    state.md.schema[0].type            = UNDEFINED_TYPE;
-    state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
-    state.md.schema[0].name            = "schema";
-    state.md.schema[0].num_children    = num_columns;
+    state.md.schema   = std::move(schema);
     state.md.column_order_listsize =
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
     if (state.user_metadata != nullptr) {
@@ -494,40 +792,15 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         state.md.key_value_metadata.push_back({it->first, it->second});
       }
     }
-    for (auto i = 0; i < num_columns; i++) {
-      auto &col = parquet_columns[i];
-      // Column metadata
-      state.md.schema[1 + i].type           = col.physical_type();
-      state.md.schema[1 + i].converted_type = col.converted_type();
-      // because the repetition type is global (in the sense of, not per-rowgroup or per write_chunked() call)
-      // we cannot know up front if the user is going to end up passing tables with nulls/no nulls in the
-      // multiple write_chunked() case.  so we'll do some special handling.
-      //
-      // if the user is explictly saying "I am only calling this once", fall back to the original behavior and assume
-      // the columns in this one table tell us everything we need to know.
-      if (state.single_write_mode) {
-        state.md.schema[1 + i].repetition_type =
-          (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
-      }
-      // otherwise, if the user is explicitly telling us global information about all the tables that will ever get passed in
-      else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
-        state.md.schema[1 + i].repetition_type =
-          state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
-      }
-      // otherwise assume the worst case.
-      else {
-        state.md.schema[1 + i].repetition_type = OPTIONAL;
-      }
-      state.md.schema[1 + i].name         = col.name();
-      state.md.schema[1 + i].num_children = 0;  // Leaf node
-    }
   } else {
     // verify the user isn't passing mismatched tables
-    CUDF_EXPECTS(state.md.schema[0].num_children == num_columns,
+    CUDF_EXPECTS(state.md.schema[0].num_children == num_top_columns &&
+                   state.md.schema.size() == schema.size(),
                  "Mismatch in table structure between multiple calls to write_chunked");
-    for (auto i = 0; i < num_columns; i++) {
-      auto &col = parquet_columns[i];
-      CUDF_EXPECTS(state.md.schema[1 + i].type == col.physical_type(),
+    for (size_t k = 1; k < schema.size(); k++) {
+      CUDF_EXPECTS(state.md.schema[k].num_children == schema[k].num_children,
+                   "Mismatch in table structure between multiple calls to write_chunked");
+      CUDF_EXPECTS(state.md.schema[k].type == schema[k].type,
                    "Mismatch in column types between multiple calls to write_chunked");
     }
 
@@ -535,20 +808,37 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     state.md.num_rows += num_rows;
   }
 
+  // Resolve the columns to build Bloom filters for, nested leaves being named by their path
+  std::vector<bool> bloom_filter_enable(num_columns, false);
+  for (const auto &name : bloom_filter_columns_) {
+    auto it = std::find_if(leaves.begin(), leaves.end(), [&](schema_leaf const &leaf) {
+      return leaf.dotted_path() == name;
+    });
+    CUDF_EXPECTS(it != leaves.end(), "Bloom filter column not found");
+    const auto type = state.md.schema[it->schema_idx].type;
+    CUDF_EXPECTS(type == INT32 || type == INT64 || type == FLOAT || type == DOUBLE ||
+                   type == BYTE_ARRAY,
+                 "Bloom filters are only supported for integer, floating-point and string columns");
+    bloom_filter_enable[std::distance(leaves.begin(), it)] = true;
+  }
+
   // Initialize column description
-  hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns);
+  hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns, state.stream);
 
   // setup gpu column description.
   // applicable to only this _write_chunked() call
   for (auto i = 0; i < num_columns; i++) {
-    auto &col = parquet_columns[i];
+    auto &col          = parquet_columns[i];
+    const auto &leaf   = leaves[i];
+    const auto &node   = state.md.schema[leaf.schema_idx];
     // GPU column description
     auto *desc             = &col_desc[i];
     desc->column_data_base = col.data();
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
+    // Dictionaries are not built for nested leaves, whose rows are values
+    if (node.type != BOOLEAN && node.type != UNDEFINED_TYPE && !leaf.is_nested()) {
       col.alloc_dictionary(num_rows);
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
@@ -557,9 +847,23 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       desc->dict_index = nullptr;
     }
     desc->num_rows       = col.data_count();
-    desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
-    desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
-    desc->level_bits     = (state.md.schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->physical_type  = static_cast<uint8_t>(node.type);
+    desc->converted_type = static_cast<uint8_t>(node.converted_type);
+    desc->use_delta      = enable_delta_encoding_ && (desc->physical_type == INT32 ||
+                                                 desc->physical_type == INT64 ||
+                                                 desc->physical_type == BYTE_ARRAY);
+    if (leaf.is_nested()) {
+      desc->level_bits =
+        level_bit_width(leaf.max_def_level) | (level_bit_width(leaf.max_rep_level) << 4);
+      desc->level_offsets = level_offsets[i].data().get();
+      desc->def_levels    = def_levels[i].data().get();
+      desc->rep_levels    = (leaf.max_rep_level > 0) ? rep_levels[i].data().get() : nullptr;
+    } else {
+      desc->level_bits    = (node.repetition_type == OPTIONAL) ? 1 : 0;
+      desc->level_offsets = nullptr;
+      desc->def_levels    = nullptr;
+      desc->rep_levels    = nullptr;
+    }
   }
 
   // Init page fragments
@@ -567,9 +871,32 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // desired page size -> TODO: keep track of the max fragment size, and iteratively reduce this value if the largest
   // fragment exceeds the max page size limit (we ideally want the page size to be below 1MB so as to have enough pages
   // to get good compression/decompression performance).
+  // Row groups hold a whole number of fragments, so smaller row groups use smaller fragments
   uint32_t fragment_size = 5000;
+  if (max_rowgroup_rows_ % fragment_size != 0) {
+    const size_t fragments_per_rowgroup = (max_rowgroup_rows_ + fragment_size - 1) / fragment_size;
+    fragment_size = static_cast<uint32_t>(max_rowgroup_rows_ / fragments_per_rowgroup);
+  }
+  // The fragments of nested leaves hold their values, so they are shrunk until none exceeds the
+  // fragment size
+  auto max_fragment_values = [&](uint32_t fragment_size) {
+    uint32_t max_values = 0;
+    for (auto const &levels : nested) {
+      const auto &lo = levels.level_offsets;
+      for (uint32_t row = 0; row + 1 < lo.size(); row += fragment_size) {
+        const uint32_t end_row = std::min<uint32_t>(row + fragment_size, lo.size() - 1);
+        max_values             = std::max(max_values, lo[end_row] - lo[row]);
+      }
+    }
+    return max_values;
+  };
+  while (fragment_size > 1 && max_fragment_values(fragment_size) > MAX_PAGE_FRAGMENT_SIZE) {
+    fragment_size = (fragment_size + 1) / 2;
+  }
+  CUDF_EXPECTS(max_fragment_values(fragment_size) <= std::numeric_limits<uint16_t>::max(),
+               "Too many list elements in a row");
   uint32_t num_fragments = (uint32_t)((num_rows + fragment_size - 1) / fragment_size);
-  hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments);
+  hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments, state.stream);
   if (fragments.size() != 0) {
     init_page_fragments(
       fragments, col_desc, num_columns, num_fragments, num_rows, fragment_size, state.stream);
@@ -621,7 +948,7 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
 
   // Initialize row groups and column chunks
   uint32_t num_chunks = num_rowgroups * num_columns;
-  hostdevice_vector<gpu::EncColumnChunk> chunks(num_chunks);
+  hostdevice_vector<gpu::EncColumnChunk> chunks(num_chunks, state.stream);
   uint32_t num_dictionaries = 0;
   for (uint32_t r = 0, global_r = global_rowgroup_base, f = 0, start_row = 0; r < num_rowgroups;
        r++, global_r++) {
@@ -643,6 +970,12 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         (frag_stats.size() != 0) ? frag_stats.data().get() + i * num_fragments + f : nullptr;
       ck->start_row      = start_row;
       ck->num_rows       = (uint32_t)state.md.row_groups[global_r].num_rows;
+      if (leaves[i].is_nested()) {
+        // Nested chunks hold the values of their rows
+        const auto &lo = nested[i].level_offsets;
+        ck->start_row  = lo[start_row];
+        ck->num_rows   = lo[start_row + state.md.row_groups[global_r].num_rows] - lo[start_row];
+      }
       ck->first_fragment = i * num_fragments + f;
       ck->first_page     = 0;
       ck->num_pages      = 0;
@@ -667,16 +1000,16 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         }
       }
       ck->has_dictionary                                           = dict_enable;
-      state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
+      state.md.row_groups[global_r].columns[i].meta_data.type =
+        state.md.schema[leaves[i].schema_idx].type;
       state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
       if (dict_enable) {
         state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
       }
-      state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
-        state.md.schema[1 + i].name};
-      state.md.row_groups[global_r].columns[i].meta_data.codec = UNCOMPRESSED;
-      state.md.row_groups[global_r].columns[i].meta_data.num_values =
-        state.md.row_groups[global_r].num_rows;
+      state.md.row_groups[global_r].columns[i].meta_data.path_in_schema =
+        leaves[i].path_in_schema;
+      state.md.row_groups[global_r].columns[i].meta_data.codec      = UNCOMPRESSED;
+      state.md.row_groups[global_r].columns[i].meta_data.num_values = ck->num_rows;
     }
     f += fragments_in_chunk;
     start_row += (uint32_t)state.md.row_groups[global_r].num_rows;
@@ -688,43 +1021,121 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // Build chunk dictionaries and count pages
   if (num_chunks != 0) {
     build_chunk_dictionaries(
-      chunks, col_desc, num_rowgroups, num_columns, num_dictionaries, state.stream);
+      chunks, col_desc, num_rowgroups, num_columns, num_dictionaries, fragment_size, state.stream);
+    // Chunks whose dictionary didn't pay off were reverted to plain encoding, and the pages
+    // past the dictionary fragments of a chunk use DELTA encoding when enabled
+    for (uint32_t r = 0, global_r = global_rowgroup_base; r < num_rowgroups; r++, global_r++) {
+      for (int i = 0; i < num_columns; i++) {
+        auto const &ck  = chunks[r * num_columns + i];
+        auto &encodings = state.md.row_groups[global_r].columns[i].meta_data.encodings;
+        if (!ck.has_dictionary) { encodings = {PLAIN, RLE}; }
+        if (col_desc[i].use_delta &&
+            (!ck.has_dictionary || ck.num_dict_fragments * fragment_size < ck.num_rows)) {
+          encodings.push_back((col_desc[i].physical_type == BYTE_ARRAY) ? DELTA_LENGTH_BYTE_ARRAY
+                                                                        : DELTA_BINARY_PACKED);
+        }
+      }
+    }
+  }
+
+  // Build Bloom filters, sized for the number of distinct values of each chunk: the dictionary
+  // size when the whole chunk is dictionary-encoded, the number of non-null values otherwise
+  hostdevice_vector<gpu::BloomFilterChunk> bloom_filters(0, num_chunks, state.stream);
+  std::vector<int32_t> chunk_bloom_filter(num_chunks, -1);
+  std::vector<size_t> bloom_filter_offsets;
+  size_t bloom_filter_words = 0;
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    for (int i = 0; i < num_columns; i++) {
+      if (!bloom_filter_enable[i]) { continue; }
+      const auto &ck    = chunks[r * num_columns + i];
+      size_t num_values = 0;
+      if (ck.has_dictionary && ck.num_dict_fragments * fragment_size >= ck.num_rows) {
+        num_values = ck.total_dict_entries;
+      } else {
+        const uint32_t fragments_in_chunk =
+          (state.md.row_groups[global_rowgroup_base + r].num_rows + fragment_size - 1) /
+          fragment_size;
+        for (uint32_t j = 0; j < fragments_in_chunk; j++) {
+          num_values += fragments[ck.first_fragment + j].non_nulls;
+        }
+      }
+      const uint32_t num_bytes =
+        bloom_filter_size(num_values, BLOOM_FILTER_FPP, BLOOM_FILTER_MAX_CHUNK_BYTES);
+      chunk_bloom_filter[r * num_columns + i] = static_cast<int32_t>(bloom_filters.size());
+
+      gpu::BloomFilterChunk bf;
+      bf.col_desc   = col_desc.device_ptr() + i;
+      bf.bitset     = nullptr;
+      bf.num_blocks = num_bytes / BLOOM_FILTER_BLOCK_BYTES;
+      bf.start_row  = ck.start_row;
+      bf.num_rows   = ck.num_rows;
+      bloom_filters.insert(bf);
+      bloom_filter_offsets.push_back(bloom_filter_words);
+      bloom_filter_words += bf.num_blocks * BLOOM_FILTER_BLOCK_WORDS;
+    }
+  }
+  rmm::device_vector<uint32_t> bloom_bitsets(bloom_filter_words, 0);
+  std::vector<uint32_t> bloom_bitsets_host(bloom_filter_words);
+  if (bloom_filters.size() != 0) {
+    for (size_t b = 0; b < bloom_filters.size(); b++) {
+      bloom_filters[b].bitset = bloom_bitsets.data().get() + bloom_filter_offsets[b];
+    }
+    CUDA_TRY(cudaMemcpyAsync(bloom_filters.device_ptr(),
+                             bloom_filters.host_ptr(),
+                             bloom_filters.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             state.stream));
+    CUDA_TRY(gpu::BuildBloomFilters(
+      bloom_filters.device_ptr(), static_cast<uint32_t>(bloom_filters.size()), state.stream));
+    CUDA_TRY(cudaMemcpyAsync(bloom_bitsets_host.data(),
+                             bloom_bitsets.data().get(),
+                             bloom_filter_words * sizeof(uint32_t),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    CUDF_STREAM_SYNC(state.stream);
   }
 
-  // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
+  // Initialize batches of rowgroups to encode (mainly to limit peak memory usage). Batches are
+  // kept small enough for the output of one batch to be written while the next one is encoded
   std::vector<uint32_t> batch_list;
   uint32_t num_pages          = 0;
-  size_t max_bytes_in_batch   = 1024 * 1024 * 1024;  // 1GB - TBD: Tune this
+  size_t max_bytes_in_batch   = 256 * 1024 * 1024;  // 256MB - TBD: Tune this
   size_t max_uncomp_bfr_size  = 0;
-  size_t max_chunk_bfr_size   = 0;
+  size_t max_batch_bfr_size   = 0;
   uint32_t max_pages_in_batch = 0;
   size_t bytes_in_batch       = 0;
+  size_t batch_bfr_size       = 0;
   for (uint32_t r = 0, groups_in_batch = 0, pages_in_batch = 0; r <= num_rowgroups; r++) {
-    size_t rowgroup_size = 0;
+    size_t rowgroup_size       = 0;
+    size_t rowgroup_bfr_size   = 0;
+    uint32_t pages_in_rowgroup = 0;
     if (r < num_rowgroups) {
       for (int i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
         ck->first_page          = num_pages;
         num_pages += ck->num_pages;
-        pages_in_batch += ck->num_pages;
+        pages_in_rowgroup += ck->num_pages;
         rowgroup_size += ck->bfr_size;
-        max_chunk_bfr_size =
-          std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
+        rowgroup_bfr_size += std::max(ck->bfr_size, ck->compressed_size);
       }
     }
     // TBD: We may want to also shorten the batch if we have enough pages (not just based on size)
     if ((r == num_rowgroups) ||
         (groups_in_batch != 0 && bytes_in_batch + rowgroup_size > max_bytes_in_batch)) {
       max_uncomp_bfr_size = std::max(max_uncomp_bfr_size, bytes_in_batch);
+      max_batch_bfr_size  = std::max(max_batch_bfr_size, batch_bfr_size);
       max_pages_in_batch  = std::max(max_pages_in_batch, pages_in_batch);
       if (groups_in_batch != 0) {
         batch_list.push_back(groups_in_batch);
         groups_in_batch = 0;
       }
       bytes_in_batch = 0;
+      batch_bfr_size = 0;
       pages_in_batch = 0;
     }
     bytes_in_batch += rowgroup_size;
+    batch_bfr_size += rowgroup_bfr_size;
+    pages_in_batch += pages_in_rowgroup;
     groups_in_batch++;
   }
 
@@ -770,23 +1181,161 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                        state.stream);
   }
 
-  auto host_bfr = [&]() {
-    // if the writer supports device_write(), we don't need this scratch space
-    if (out_sink_->supports_device_write()) {
-      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
+  // Sinks without device writes get the pages of a whole batch in a single pinned buffer,
+  // which is written while the next batch is being encoded
+  const bool host_write = !out_sink_->supports_device_write();
+  auto host_bfr         = (host_write)
+                    ? make_pinned_buffer<uint8_t>(max_batch_bfr_size, state.stream)
+                    : pinned_buffer<uint8_t>{};
+
+  // Host copy of the encoded pages, for the page locations and header sizes of the page indexes
+  std::vector<gpu::EncPage> host_pages(num_pages);
+
+  // Builds the page indexes of a column chunk written at `chunk_offset`. The column index takes
+  // the page-level statistics from the headers of the data pages, so it is only built along with
+  // page statistics
+  auto build_page_indexes = [&](const gpu::EncColumnChunk *ck,
+                                int i,
+                                size_t chunk_offset,
+                                const uint8_t *host_data) {
+    // The pages of nested leaves start at values, not rows, so they are not indexed
+    if (leaves[i].is_nested()) {
+      state.column_indexes.emplace_back();
+      state.offset_indexes.emplace_back();
+      return;
+    }
+    const gpu::EncPage *ck_pages = host_pages.data() + ck->first_page;
+    OffsetIndex offset_index;
+    std::vector<size_t> hdr_offsets;
+    size_t page_offset = 0;
+    for (uint32_t p = 0; p < ck->num_pages; p++) {
+      if (ck_pages[p].page_type == DATA_PAGE) {
+        PageLocation location;
+        location.offset               = chunk_offset + page_offset;
+        location.compressed_page_size = ck_pages[p].hdr_size + ck_pages[p].max_data_size;
+        location.first_row_index      = ck_pages[p].start_row - ck->start_row;
+        offset_index.page_locations.push_back(location);
+        hdr_offsets.push_back(page_offset);
+      }
+      page_offset += ck_pages[p].hdr_size + ck_pages[p].max_data_size;
+    }
+
+    ColumnIndex column_index;
+    if (stats_granularity_ == statistics_freq::STATISTICS_PAGE && !hdr_offsets.empty()) {
+      // Gather the headers of the data pages, from the device if the chunk is not on the host
+      std::vector<std::vector<uint8_t>> headers(hdr_offsets.size());
+      const uint8_t *dev_bfr = (ck->is_compressed) ? ck->compressed_bfr : ck->uncompressed_bfr;
+      for (size_t p = 0, d = 0; p < ck->num_pages; p++) {
+        if (ck_pages[p].page_type != DATA_PAGE) { continue; }
+        headers[d].resize(ck_pages[p].hdr_size);
+        if (host_data != nullptr) {
+          memcpy(
+            headers[d].data(), host_data + ck->ck_stat_size + hdr_offsets[d], headers[d].size());
+        } else {
+          CUDA_TRY(cudaMemcpyAsync(headers[d].data(),
+                                   dev_bfr + ck->ck_stat_size + hdr_offsets[d],
+                                   headers[d].size(),
+                                   cudaMemcpyDeviceToHost,
+                                   state.stream));
+        }
+        d++;
+      }
+      if (host_data == nullptr) { CUDF_STREAM_SYNC(state.stream); }
+
+      bool has_minmax = true;
+      for (size_t d = 0; d < headers.size() && has_minmax; d++) {
+        PageHeader header;
+        CompactProtocolReader cp(headers[d].data(), headers[d].size());
+        has_minmax = cp.read(&header);
+        const auto &stats       = header.data_page_header.statistics;
+        const bool is_null_page = (stats.null_count == header.data_page_header.num_values);
+        // Only strings have valid empty min/max values
+        if (!is_null_page && stats.min_value.empty() && stats.max_value.empty() &&
+            state.md.schema[leaves[i].schema_idx].type != BYTE_ARRAY) {
+          has_minmax = false;
+        }
+        column_index.null_pages.push_back(is_null_page);
+        column_index.min_values.push_back((is_null_page) ? std::string() : stats.min_value);
+        column_index.max_values.push_back((is_null_page) ? std::string() : stats.max_value);
+        column_index.null_counts.push_back(stats.null_count);
+      }
+      if (!has_minmax) { column_index = ColumnIndex{}; }
+    }
+    state.column_indexes.push_back(std::move(column_index));
+    state.offset_indexes.push_back(std::move(offset_index));
+  };
+
+  // Writes a column chunk from the host copy of its statistics and pages, or from the device if
+  // `host_data` is null, followed by its Bloom filter
+  auto write_chunk = [&](uint32_t r, int i, const uint8_t *host_data) {
+    gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
+    auto &row_group         = state.md.row_groups[global_rowgroup_base + r];
+    auto &meta_data         = row_group.columns[i].meta_data;
+    if (ck->is_compressed) { meta_data.codec = compression_; }
+    build_page_indexes(ck, i, state.current_chunk_offset, host_data);
+    if (host_data == nullptr) {
+      const uint8_t *dev_bfr = (ck->is_compressed) ? ck->compressed_bfr : ck->uncompressed_bfr;
+      // let the writer do what it wants to retrieve the data from the gpu.
+      out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
+      // we still need to do a (much smaller) memcpy for the statistics.
+      if (ck->ck_stat_size != 0) {
+        meta_data.statistics_blob.resize(ck->ck_stat_size);
+        CUDA_TRY(cudaMemcpyAsync(meta_data.statistics_blob.data(),
+                                 dev_bfr,
+                                 ck->ck_stat_size,
+                                 cudaMemcpyDeviceToHost,
+                                 state.stream));
+        CUDF_STREAM_SYNC(state.stream);
+      }
     } else {
-      return pinned_buffer<uint8_t>{[](size_t size) {
-                                      uint8_t *ptr = nullptr;
-                                      CUDA_TRY(cudaMallocHost(&ptr, size));
-                                      return ptr;
-                                    }(max_chunk_bfr_size),
-                                    cudaFreeHost};
+      out_sink_->host_write(host_data + ck->ck_stat_size, ck->compressed_size);
+      if (ck->ck_stat_size != 0) {
+        meta_data.statistics_blob.resize(ck->ck_stat_size);
+        memcpy(meta_data.statistics_blob.data(), host_data, ck->ck_stat_size);
+      }
+    }
+    row_group.total_byte_size += ck->compressed_size;
+    meta_data.data_page_offset =
+      state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
+    meta_data.dictionary_page_offset  = (ck->has_dictionary) ? state.current_chunk_offset : 0;
+    meta_data.total_uncompressed_size = ck->bfr_size;
+    meta_data.total_compressed_size   = ck->compressed_size;
+    state.current_chunk_offset += ck->compressed_size;
+
+    // The Bloom filter of the chunk immediately follows its pages
+    const int32_t bf_idx = chunk_bloom_filter[r * num_columns + i];
+    if (bf_idx >= 0) {
+      BloomFilterHeader header;
+      header.num_bytes   = bloom_filters[bf_idx].num_blocks * BLOOM_FILTER_BLOCK_BYTES;
+      header.algorithm   = 1;  // SPLIT_BLOCK
+      header.hash        = 1;  // XXHASH
+      header.compression = 1;  // UNCOMPRESSED
+      buffer_.resize(0);
+      CompactProtocolWriter cpw(&buffer_);
+      cpw.write(&header);
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      out_sink_->host_write(bloom_bitsets_host.data() + bloom_filter_offsets[bf_idx],
+                            header.num_bytes);
+      meta_data.bloom_filter_offset = state.current_chunk_offset;
+      meta_data.bloom_filter_length = static_cast<int32_t>(buffer_.size() + header.num_bytes);
+      state.current_chunk_offset += meta_data.bloom_filter_length;
+    }
+  };
+
+  // Writes the column chunks of rowgroups [first_r, last_r), packed in host_bfr if host_write
+  auto write_batch = [&](uint32_t first_r, uint32_t last_r) {
+    size_t host_offset = 0;
+    for (uint32_t r = first_r; r < last_r; r++) {
+      for (auto i = 0; i < num_columns; i++) {
+        const gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
+        write_chunk(r, i, (host_write) ? host_bfr.get() + host_offset : nullptr);
+        host_offset += ck->ck_stat_size + ck->compressed_size;
+      }
     }
-  }();
+  };
 
   // Encode row groups in batches
-  for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
-       b++) {
+  for (uint32_t b = 0, r = 0, prev_r = 0; b < (uint32_t)batch_list.size(); b++) {
     // Count pages in this batch
     uint32_t rnext               = r + batch_list[b];
     uint32_t first_page_in_batch = chunks[r * num_columns].first_page;
@@ -807,60 +1356,37 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
       state.stream);
-    for (; r < rnext; r++, global_r++) {
-      for (auto i = 0; i < num_columns; i++) {
-        gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
-        uint8_t *dev_bfr;
-        if (ck->is_compressed) {
-          state.md.row_groups[global_r].columns[i].meta_data.codec = compression_;
-          dev_bfr                                                  = ck->compressed_bfr;
-        } else {
-          dev_bfr = ck->uncompressed_bfr;
-        }
-
-        if (out_sink_->supports_device_write()) {
-          // let the writer do what it wants to retrieve the data from the gpu.
-          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, state.stream);
-          // we still need to do a (much smaller) memcpy for the statistics.
-          if (ck->ck_stat_size != 0) {
-            state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
-              ck->ck_stat_size);
-            CUDA_TRY(cudaMemcpyAsync(
-              state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-              dev_bfr,
-              ck->ck_stat_size,
-              cudaMemcpyDeviceToHost,
-              state.stream));
-            CUDA_TRY(cudaStreamSynchronize(state.stream));
-          }
-        } else {
-          // copy the full data
-          CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
+    CUDA_TRY(cudaMemcpyAsync(host_pages.data() + first_page_in_batch,
+                             pages.data().get() + first_page_in_batch,
+                             pages_in_batch * sizeof(gpu::EncPage),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    // The previous batch is already in host_bfr, and is written while this one is encoded
+    if (host_write && b > 0) { write_batch(prev_r, r); }
+    CUDF_STREAM_SYNC(state.stream);
+    if (host_write) {
+      size_t host_offset = 0;
+      for (uint32_t j = r; j < rnext; j++) {
+        for (auto i = 0; i < num_columns; i++) {
+          const gpu::EncColumnChunk *ck = &chunks[j * num_columns + i];
+          const uint8_t *dev_bfr = (ck->is_compressed) ? ck->compressed_bfr : ck->uncompressed_bfr;
+          CUDA_TRY(cudaMemcpyAsync(host_bfr.get() + host_offset,
                                    dev_bfr,
                                    ck->ck_stat_size + ck->compressed_size,
                                    cudaMemcpyDeviceToHost,
                                    state.stream));
-          CUDA_TRY(cudaStreamSynchronize(state.stream));
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
-          if (ck->ck_stat_size != 0) {
-            state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
-              ck->ck_stat_size);
-            memcpy(state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                   host_bfr.get(),
-                   ck->ck_stat_size);
-          }
+          host_offset += ck->ck_stat_size + ck->compressed_size;
         }
-        state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
-        state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
-          state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
-        state.md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
-          (ck->has_dictionary) ? state.current_chunk_offset : 0;
-        state.md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
-        state.md.row_groups[global_r].columns[i].meta_data.total_compressed_size =
-          ck->compressed_size;
-        state.current_chunk_offset += ck->compressed_size;
       }
+      CUDF_STREAM_SYNC(state.stream);
+    } else {
+      write_batch(r, rnext);
     }
+    prev_r = r;
+    r      = rnext;
+  }
+  if (host_write && !batch_list.empty()) {
+    write_batch(num_rowgroups - batch_list.back(), num_rowgroups);
   }
 }
 
@@ -868,6 +1394,34 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
   pq_chunked_state &state, bool return_filemetadata, const std::string &metadata_out_file_path) {
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // The page indexes follow the row groups: the column indexes of all the column chunks, then
+  // their offset indexes
+  size_t chunk_idx = 0;
+  for (auto &rowgroup : state.md.row_groups) {
+    for (auto &col : rowgroup.columns) {
+      const auto &column_index = state.column_indexes[chunk_idx++];
+      if (column_index.null_pages.empty()) { continue; }
+      buffer_.resize(0);
+      col.column_index_length = static_cast<int32_t>(cpw.write(&column_index));
+      col.column_index_offset = state.current_chunk_offset;
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      state.current_chunk_offset += buffer_.size();
+    }
+  }
+  chunk_idx = 0;
+  for (auto &rowgroup : state.md.row_groups) {
+    for (auto &col : rowgroup.columns) {
+      const auto &offset_index = state.offset_indexes[chunk_idx++];
+      if (offset_index.page_locations.empty()) { continue; }
+      buffer_.resize(0);
+      col.offset_index_length = static_cast<int32_t>(cpw.write(&offset_index));
+      col.offset_index_offset = state.current_chunk_offset;
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      state.current_chunk_offset += buffer_.size();
+    }
+  }
+
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
   fendr.magic      = PARQUET_MAGIC;
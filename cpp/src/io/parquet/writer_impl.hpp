@@ -61,6 +61,10 @@ class writer::impl {
   // rowgroups are divided into pages
   static constexpr uint32_t DEFAULT_TARGET_PAGE_SIZE = 512 * 1024;
 
+  // Bloom filters are sized for a 1% false positive probability, up to a maximum size per chunk
+  static constexpr double BLOOM_FILTER_FPP               = 0.01;
+  static constexpr uint32_t BLOOM_FILTER_MAX_CHUNK_BYTES = 1024 * 1024;
+
  public:
   /**
    * @brief Constructor with writer options.
@@ -162,6 +166,7 @@ class writer::impl {
    * @param num_rowgroups Total number of rowgroups
    * @param num_columns Total number of columns
    * @param num_dictionaries Total number of dictionaries
+   * @param fragment_size Number of rows per fragment
    * @param stream Stream to use for memory allocation and kernels
    **/
   void build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChunk>& chunks,
@@ -169,6 +174,7 @@ class writer::impl {
                                 uint32_t num_rowgroups,
                                 uint32_t num_columns,
                                 uint32_t num_dictionaries,
+                                uint32_t fragment_size,
                                 cudaStream_t stream);
   /**
    * @brief Initialize encoder pages
@@ -207,6 +213,9 @@ class writer::impl {
    * @param page_stats optional page-level statistics (nullptr if none)
    * @param chunk_stats optional chunk-level statistics (nullptr if none)
    * @param stream Stream to use for memory allocation and kernels
+   *
+   * The chunks of the batch are copied back to the host asynchronously; the
+   * stream must be synchronized before reading them.
    **/
   void encode_pages(hostdevice_vector<gpu::EncColumnChunk>& chunks,
                     gpu::EncPage* pages,
@@ -229,7 +238,10 @@ class writer::impl {
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
+  int compression_level_             = 0;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  bool enable_delta_encoding_        = false;
+  std::vector<std::string> bloom_filter_columns_;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
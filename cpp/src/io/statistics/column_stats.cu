@@ -346,12 +346,6 @@ void __device__ gatherFloatColumnStats(stats_state_s *s, statistics_dtype dtype,
   }
 }
 
-// FIXME: Use native libcudf string type
-struct nvstrdesc_s {
-  const char *ptr;
-  size_t count;
-};
-
 /**
  * @brief Gather statistics for string columns
  *
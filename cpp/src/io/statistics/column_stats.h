@@ -43,6 +43,12 @@ struct stats_column_desc {
   int32_t ts_scale;  //!< timestamp scale (>0: multiply by scale, <0: divide by -scale)
 };
 
+// FIXME: Use native libcudf string type
+struct nvstrdesc_s {
+  const char *ptr;
+  size_t count;
+};
+
 struct string_stats {
   const char *ptr;  //!< ptr to character data
   uint32_t length;  //!< length of string
@@ -22,7 +22,12 @@
 #pragma once
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/managed_memory.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -61,6 +66,13 @@ inline rmm::device_buffer create_data(
 /**
  * @brief Class for holding device memory buffers to column data that will be
  * eventually used create to create a column.
+ *
+ * Dictionary columns hold the INT32 index of each row into `_keys`, whose
+ * entries need not be unique nor ordered.
+ *
+ * String columns hold a (pointer, length) pair per row in `_strings`, or with
+ * `direct_strings`, the `size + 1` offsets of the rows in `_data` and their
+ * characters in `_chars`, which readers decode into directly.
  */
 struct column_buffer {
   using str_pair = thrust::pair<const char*, size_type>;
@@ -69,12 +81,20 @@ struct column_buffer {
                 size_type size,
                 bool is_nullable                    = true,
                 cudaStream_t stream                 = 0,
-                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) {
-    if (type.id() == type_id::STRING) {
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                bool direct_strings                 = false) {
+    if (type.id() == type_id::STRING && direct_strings) {
+      _data           = create_data(data_type{type_id::INT32}, size + 1, stream, mr);
+      _direct_strings = true;
+    } else if (type.id() == type_id::STRING) {
       _strings.resize(size);
+    } else if (type.id() == type_id::DICTIONARY32) {
+      _data = create_data(data_type{type_id::INT32}, size, stream, mr);
     } else {
       _data = create_data(type, size, stream, mr);
     }
+    // Managed memory is prefetched, so that the decoding kernels do not fault on it
+    cudf::detail::prefetch_to_device(_data.data(), _data.size(), stream);
     if (is_nullable) { _null_mask = create_null_mask(size, mask_state::ALL_NULL, stream, mr); }
     _null_count = 0;
   }
@@ -91,9 +111,12 @@ struct column_buffer {
   auto& null_count() { return _null_count; }
 
   rmm::device_vector<str_pair> _strings;
+  rmm::device_vector<str_pair> _keys;
   rmm::device_buffer _data{};
+  rmm::device_buffer _chars{};
   rmm::device_buffer _null_mask{};
   size_type _null_count{0};
+  bool _direct_strings{false};
 };
 
 namespace {
@@ -117,8 +140,36 @@ std::unique_ptr<column> make_column(
   column_buffer& buffer,
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) {
-  if (type.id() == type_id::STRING) {
+  if (type.id() == type_id::STRING && buffer._direct_strings) {
+    auto offsets =
+      std::make_unique<column>(data_type{type_id::INT32}, size + 1, std::move(buffer._data));
+    auto chars = std::make_unique<column>(data_type{type_id::INT8},
+                                          static_cast<size_type>(buffer._chars.size()),
+                                          std::move(buffer._chars));
+    return make_strings_column(size,
+                               std::move(offsets),
+                               std::move(chars),
+                               buffer._null_count,
+                               std::move(buffer._null_mask),
+                               stream,
+                               mr);
+  } else if (type.id() == type_id::STRING) {
     return make_strings_column(buffer._strings, stream, mr);
+  } else if (type.id() == type_id::DICTIONARY32) {
+    auto indices =
+      std::make_unique<column>(data_type{type_id::INT32}, size, std::move(buffer._data));
+    auto keys = make_strings_column(buffer._keys, stream, mr);
+    if (keys->size() != 0) {
+      // Sort and deduplicate the keys, then remap the row indices to them
+      auto encoded_keys = dictionary::encode(keys->view(), data_type{type_id::INT32}, mr);
+      auto contents     = encoded_keys->release();
+      auto remapped =
+        gather(table_view{{contents.children[0]->view()}}, indices->view(), false, mr);
+      indices = std::move(remapped->release()[0]);
+      keys    = std::move(contents.children[1]);
+    }
+    return make_dictionary_column(
+      std::move(keys), std::move(indices), std::move(buffer._null_mask), buffer._null_count);
   } else {
     return std::make_unique<column>(
       type, size, std::move(buffer._data), std::move(buffer._null_mask), buffer._null_count);
@@ -15,6 +15,7 @@
  */
 
 #include "datasource.hpp"
+#include "ranged_source.hpp"
 
 #include <fcntl.h>
 #include <sys/mman.h>
@@ -25,6 +26,17 @@
 #include <cudf/cudf.h>
 #include <cudf/utilities/error.hpp>
 
+#ifdef CUFILE_FOUND
+#include <cufile.h>
+#endif
+
+#ifdef CURL_FOUND
+#include <curl/curl.h>
+#endif
+
+#include <cstring>
+#include <mutex>
+
 namespace cudf {
 namespace io {
 
@@ -85,11 +97,24 @@ class memory_mapped_source : public datasource {
   const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset, size_t size) override {
     // Clamp length to available data in the mapped region
     CUDF_EXPECTS(offset >= map_offset_, "Requested offset is outside mapping");
+    if (offset - map_offset_ >= map_size_) { return std::make_shared<arrow::Buffer>(nullptr, 0); }
     size = std::min(size, map_size_ - (offset - map_offset_));
 
     return arrow::Buffer::Wrap(static_cast<uint8_t *>(map_addr_) + (offset - map_offset_), size);
   }
 
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override {
+    // Let the kernel read the pages ahead instead of faulting them in one by one
+    const size_t page_mask = sysconf(_SC_PAGESIZE) - 1;
+    for (auto const &range : ranges) {
+      if (range.first < map_offset_ || range.first - map_offset_ >= map_size_) { continue; }
+      const size_t begin = (range.first - map_offset_) & ~page_mask;
+      const size_t end   = std::min(range.first - map_offset_ + range.second, map_size_);
+      // Only a hint, so failures are ignored
+      madvise(static_cast<uint8_t *>(map_addr_) + begin, end - begin, MADV_WILLNEED);
+    }
+  }
+
   size_t size() const override { return file_size_; }
 
  private:
@@ -122,9 +147,197 @@ class memory_mapped_source : public datasource {
   size_t map_offset_ = 0;
 };
 
+#ifdef CUFILE_FOUND
+/**
+ * @brief Implementation class for reading from a file using memory mapped
+ * access for host reads, and cuFile (GPUDirect Storage) for device reads.
+ *
+ * Device reads bypass the host bounce buffer, transferring file data directly
+ * from storage into GPU memory where the platform supports it.
+ **/
+class cufile_source : public memory_mapped_source {
+  /**
+   * @brief Opens the cuFile driver on first use and closes it on exit
+   **/
+  struct cufile_driver {
+    bool is_open = false;
+    cufile_driver() : is_open(cuFileDriverOpen().err == CU_FILE_SUCCESS) {}
+    ~cufile_driver() {
+      if (is_open) { cuFileDriverClose(); }
+    }
+  };
+
+ public:
+  /**
+   * @brief Returns whether the cuFile driver could be opened on this system
+   **/
+  static bool is_available() {
+    static cufile_driver driver;
+    return driver.is_open;
+  }
+
+  explicit cufile_source(const char *filepath, size_t offset, size_t size)
+    : memory_mapped_source(filepath, offset, size), range_offset_(offset) {
+    // Same byte range as the host mapping, so host and device reads agree
+    range_end_ = (size == 0) ? this->size() : std::min(offset + size, this->size());
+
+    fd_ = open(filepath, O_RDONLY | O_DIRECT);
+    CUDF_EXPECTS(fd_ != -1, "Cannot open file for direct access");
+
+    CUfileDescr_t descr{};
+    descr.handle.fd = fd_;
+    descr.type      = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&handle_, &descr).err != CU_FILE_SUCCESS) {
+      close(fd_);
+      CUDF_FAIL("Cannot register file handle with cuFile");
+    }
+  }
+
+  virtual ~cufile_source() {
+    cuFileHandleDeregister(handle_);
+    close(fd_);
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst, cudaStream_t stream) override {
+    // Offsets are from the start of the file, as with `get_buffer()`; reads are
+    // clamped to the byte range this source was created with
+    CUDF_EXPECTS(offset >= range_offset_, "Requested offset is outside mapping");
+    CUDF_EXPECTS(offset <= range_end_, "Offset is past end of file");
+    size = std::min(size, range_end_ - offset);
+
+    // cuFile reads are not stream-ordered, so wait for any pending use of `dst`
+    CUDF_STREAM_SYNC(stream);
+
+    size_t bytes_read = 0;
+    while (bytes_read < size) {
+      const auto ret = cuFileRead(handle_, dst, size - bytes_read, offset + bytes_read, bytes_read);
+      CUDF_EXPECTS(ret > 0, "Cannot read file data with cuFile");
+      bytes_read += ret;
+    }
+    return bytes_read;
+  }
+
+ private:
+  int fd_ = -1;
+  CUfileHandle_t handle_;
+  size_t range_offset_ = 0;
+  size_t range_end_    = 0;
+};
+#endif
+
+#ifdef CURL_FOUND
+/**
+ * @brief Implementation class for reading from an HTTP(S) endpoint using
+ * ranged GET requests
+ **/
+class http_source : public ranged_source {
+  using curl_handle = std::unique_ptr<CURL, decltype(&curl_easy_cleanup)>;
+
+ public:
+  explicit http_source(std::string const &url, remote_source_options const &options)
+    : ranged_source(options), _url(url) {
+    static std::once_flag curl_initialized;
+    std::call_once(curl_initialized, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+    auto curl = make_handle();
+    curl_easy_setopt(curl.get(), CURLOPT_NOBODY, 1L);
+    CUDF_EXPECTS(curl_easy_perform(curl.get()) == CURLE_OK, "Cannot access remote object");
+    curl_off_t length = -1;
+    curl_easy_getinfo(curl.get(), CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+    CUDF_EXPECTS(length >= 0, "Cannot get remote object size");
+    _size = static_cast<size_t>(length);
+  }
+
+  size_t size() const override { return _size; }
+
+ protected:
+  std::shared_ptr<arrow::Buffer> fetch_range(size_t offset, size_t size) override {
+    std::string data;
+    data.reserve(size);
+    const auto range = std::to_string(offset) + "-" + std::to_string(offset + size - 1);
+
+    auto curl = make_handle();
+    curl_easy_setopt(curl.get(), CURLOPT_RANGE, range.c_str());
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, append_data);
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &data);
+    CUDF_EXPECTS(curl_easy_perform(curl.get()) == CURLE_OK, "Remote object request failed");
+    long status = 0;
+    curl_easy_getinfo(curl.get(), CURLINFO_RESPONSE_CODE, &status);
+    if (status == 200) {
+      // The whole object was returned, the server not supporting ranges; it is
+      // kept by the base class to serve the following reads
+      CUDF_EXPECTS(data.size() == _size, "Short read from remote object");
+    } else {
+      CUDF_EXPECTS(data.size() == size, "Short read from remote object");
+    }
+    return arrow::Buffer::FromString(std::move(data));
+  }
+
+ private:
+  curl_handle make_handle() const {
+    curl_handle curl{curl_easy_init(), curl_easy_cleanup};
+    CUDF_EXPECTS(curl != nullptr, "Cannot create HTTP request");
+    curl_easy_setopt(curl.get(), CURLOPT_URL, _url.c_str());
+    curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl.get(), CURLOPT_FAILONERROR, 1L);
+    curl_easy_setopt(curl.get(), CURLOPT_NOSIGNAL, 1L);
+    return curl;
+  }
+
+  static size_t append_data(char *ptr, size_t size, size_t nmemb, void *userdata) {
+    static_cast<std::string *>(userdata)->append(ptr, size * nmemb);
+    return size * nmemb;
+  }
+
+  std::string _url;
+  size_t _size = 0;
+};
+#endif
+
+bool datasource::is_remote_path(std::string const &path) {
+  for (const auto prefix : {"http://", "https://", "s3://", "gs://"}) {
+    if (path.compare(0, strlen(prefix), prefix) == 0) { return true; }
+  }
+  return false;
+}
+
+std::unique_ptr<datasource> datasource::create_remote(std::string const &url,
+                                                      remote_source_options const &options) {
+  CUDF_EXPECTS(is_remote_path(url), "Unsupported remote path");
+  // Object store paths map to the public endpoints of the stores
+  std::string http_url = url;
+  if (url.compare(0, 5, "s3://") == 0) {
+    const auto bucket_end = url.find('/', 5);
+    CUDF_EXPECTS(bucket_end != std::string::npos, "Invalid object path");
+    http_url = "https://" + url.substr(5, bucket_end - 5) + ".s3.amazonaws.com" +
+               url.substr(bucket_end);
+  } else if (url.compare(0, 5, "gs://") == 0) {
+    http_url = "https://storage.googleapis.com/" + url.substr(5);
+  }
+#ifdef CURL_FOUND
+  return std::make_unique<http_source>(http_url, options);
+#else
+  CUDF_FAIL("Remote sources require libcurl");
+#endif
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string filepath,
                                                size_t offset,
                                                size_t size) {
+  // Reads use absolute offsets, so remote sources don't need the byte range
+  if (is_remote_path(filepath)) { return create_remote(filepath); }
+#ifdef CUFILE_FOUND
+  // Prefer direct-to-device reads; not all filesystems support them, so fall
+  // back to memory mapping if the file cannot be registered with cuFile
+  if (cufile_source::is_available()) {
+    try {
+      return std::make_unique<cufile_source>(filepath.c_str(), offset, size);
+    } catch (const cudf::logic_error &) {
+    }
+  }
+#endif
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
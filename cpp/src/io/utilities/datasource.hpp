@@ -21,13 +21,38 @@
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <cudf/utilities/error.hpp>
+
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace io {
 
+/**
+ * @brief Settings for sources reading from remote (object store) endpoints
+ **/
+struct remote_source_options {
+  /// Minimum size of a request; smaller reads also fetch the data that follows
+  size_t readahead_size = 4 * 1024 * 1024;
+  /// Largest gap between prefetched ranges that are merged into one request
+  size_t coalesce_gap = 1024 * 1024;
+  /// Largest size of a merged request
+  size_t max_request_size = 64 * 1024 * 1024;
+  /// Maximum number of concurrent requests
+  int max_concurrency = 16;
+  /// Number of times a failed request is retried
+  int max_retries = 3;
+  /// Delay before the first retry of a request, doubled for each following one
+  std::chrono::milliseconds retry_delay{100};
+  /// Maximum bytes of fetched data kept for later reads
+  size_t cache_size = 256 * 1024 * 1024;
+};
+
 /**
  * @brief Class for reading from a file or memory source
  **/
@@ -36,6 +61,9 @@ class datasource {
   /**
    * @brief Create a source from a file path
    *
+   * `http://` and `https://` URLs, as well as `s3://` and `gs://` paths of
+   * publicly readable objects, are read with ranged requests.
+   *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file
    * @param[in] size Bytes from the offset; use zero for entire file
@@ -58,6 +86,21 @@ class datasource {
    **/
   static std::unique_ptr<datasource> create(std::shared_ptr<arrow::io::RandomAccessFile> file);
 
+  /**
+   * @brief Create a source reading from a remote endpoint with ranged requests
+   *
+   * @param[in] url URL of the object; `s3://` and `gs://` paths are mapped to
+   * the public HTTPS endpoints of the stores, without request signing
+   * @param[in] options Settings for request coalescing, concurrency and caching
+   **/
+  static std::unique_ptr<datasource> create_remote(
+    std::string const &url, remote_source_options const &options = remote_source_options{});
+
+  /**
+   * @brief Returns whether a path designates a remote object
+   **/
+  static bool is_remote_path(std::string const &path);
+
   /**
    * @brief Base class destructor
    **/
@@ -73,6 +116,68 @@ class datasource {
    **/
   virtual const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset, size_t size) = 0;
 
+  /**
+   * @brief Hints that a set of ranges is about to be read with `get_buffer()`
+   *
+   * Sources with a high per-request latency fetch the ranges concurrently and
+   * serve the following reads from memory; the default does nothing.
+   *
+   * @param[in] ranges Offset and size of each range
+   **/
+  virtual void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) {}
+
+  /**
+   * @brief Returns a buffer for each of a set of ranges
+   *
+   * Readers that know all the ranges they need up front request them in one
+   * call, letting the source schedule the I/O as a whole. The default
+   * prefetches the ranges, then reads each one with `get_buffer()`.
+   *
+   * @param[in] ranges Offset and size of each range
+   *
+   * @return std::vector<std::shared_ptr<arrow::Buffer>> The data buffers, in
+   * the order of `ranges`
+   **/
+  virtual std::vector<std::shared_ptr<arrow::Buffer>> get_buffers(
+    std::vector<std::pair<size_t, size_t>> const &ranges) {
+    prefetch(ranges);
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    buffers.reserve(ranges.size());
+    for (auto const &range : ranges) { buffers.push_back(get_buffer(range.first, range.second)); }
+    return buffers;
+  }
+
+  /**
+   * @brief Returns whether the source supports reading directly into device memory
+   *
+   * Readers normally fetch a host buffer with `get_buffer()` and copy it to the
+   * GPU themselves. Sources that can transfer file data straight into device
+   * memory (for example, using GPUDirect Storage) return true here, in which
+   * case readers may call `device_read()` instead and skip the host staging copy.
+   *
+   * @return bool Whether this source supports device_read() calls
+   **/
+  virtual bool supports_device_read() const { return false; }
+
+  /**
+   * @brief Reads a subset of data from the source directly into device memory
+   *
+   * The call is synchronous with respect to the host; on return, `dst` holds
+   * the data and work previously enqueued on `stream` has completed. As with
+   * `get_buffer()`, the offset is from the start of the file, and reads are
+   * limited to the byte range the source was created with.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Device memory address to write the data to
+   * @param[in] stream CUDA stream that `dst` is used on
+   *
+   * @return size_t The number of bytes read (can be smaller than size)
+   **/
+  virtual size_t device_read(size_t offset, size_t size, uint8_t *dst, cudaStream_t stream) {
+    CUDF_FAIL("datasource classes that support device_read must override this function.");
+  }
+
   /**
    * @brief Returns the size of the data in the source
    *
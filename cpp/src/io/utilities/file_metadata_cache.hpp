@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Process-wide, byte-bounded cache of parsed file metadata
+ *
+ * Entries are keyed by file path and are only returned while the file's size
+ * and modification time are unchanged. Each entry is charged the size of the
+ * serialized metadata it was parsed from; once the total exceeds the capacity,
+ * the least recently used entries are evicted.
+ *
+ * @tparam T Type of the parsed metadata
+ **/
+template <typename T>
+class file_metadata_cache {
+ public:
+  static constexpr size_t default_capacity = 64 * 1024 * 1024;
+
+  static file_metadata_cache &instance() {
+    static file_metadata_cache cache(default_capacity);
+    return cache;
+  }
+
+  explicit file_metadata_cache(size_t capacity) : _capacity(capacity) {}
+
+  /**
+   * @brief Returns the cached metadata of a file, parsing and caching it on a miss
+   *
+   * Paths that are empty or that cannot be stat'ed are never cached.
+   *
+   * @param path Path of the file; empty if the source is not a file
+   * @param load Callable returning a pair of the parsed metadata and the size
+   * in bytes of the serialized metadata it was parsed from
+   *
+   * @return The parsed metadata
+   **/
+  template <typename Loader>
+  std::shared_ptr<const T> get_or_load(std::string const &path, Loader &&load) {
+    struct stat st {};
+    if (path.empty() || stat(path.c_str(), &st) != 0) { return load().first; }
+    const int64_t mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    const auto size     = static_cast<size_t>(st.st_size);
+
+    if (auto cached = get(path, mtime, size)) { return cached; }
+    auto loaded = load();
+    put(path, mtime, size, loaded.first, loaded.second);
+    return loaded.first;
+  }
+
+  /**
+   * @brief Total size of the serialized metadata of all cached entries
+   **/
+  size_t cached_bytes() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _bytes;
+  }
+
+ private:
+  struct entry {
+    std::string path;
+    int64_t mtime;
+    size_t size;
+    size_t bytes;
+    std::shared_ptr<const T> md;
+  };
+  using entry_list  = std::list<entry>;
+  using entry_index = std::unordered_map<std::string, typename entry_list::iterator>;
+
+  std::shared_ptr<const T> get(std::string const &path, int64_t mtime, size_t size) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(path);
+    if (it == _index.end()) { return nullptr; }
+    if (it->second->mtime != mtime || it->second->size != size) {
+      erase(it);
+      return nullptr;
+    }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->md;
+  }
+
+  void put(std::string const &path,
+           int64_t mtime,
+           size_t size,
+           std::shared_ptr<const T> md,
+           size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(path);
+    if (it != _index.end()) { erase(it); }
+    if (bytes > _capacity) { return; }
+    while (_bytes + bytes > _capacity) { erase(_index.find(_entries.back().path)); }
+    _entries.push_front({path, mtime, size, bytes, std::move(md)});
+    _index.emplace(path, _entries.begin());
+    _bytes += bytes;
+  }
+
+  void erase(typename entry_index::iterator it) {
+    _bytes -= it->second->bytes;
+    _entries.erase(it->second);
+    _index.erase(it);
+  }
+
+  const size_t _capacity;
+  size_t _bytes = 0;
+  std::mutex _mutex;
+  entry_list _entries;
+  entry_index _index;
+};
+
+}  // namespace io
+}  // namespace cudf
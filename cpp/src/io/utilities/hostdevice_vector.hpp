@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_memory_pool.hpp"
+
 #include <rmm/device_buffer.hpp>
 
 #include <cudf/utilities/error.hpp>
@@ -27,7 +29,10 @@
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
- * after operating on the same data on the GPU.
+ * after operating on the same data on the GPU. It is taken from the pinned
+ * memory pool, as readers and writers create many short-lived instances, and
+ * is reused once the work queued on `stream` when the vector is destroyed has
+ * completed; copies to and from the host memory should be queued on it.
  **/
 template <typename T>
 class hostdevice_vector {
@@ -38,17 +43,15 @@ class hostdevice_vector {
     : hostdevice_vector(max_size, max_size, stream) {}
 
   explicit hostdevice_vector(size_t initial_size, size_t max_size, cudaStream_t stream = 0)
-    : num_elements(initial_size), max_elements(max_size) {
+    : stream(stream), max_elements(max_size), num_elements(initial_size) {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T *>(
+        cudf::io::pinned_memory_pool::instance().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
-  ~hostdevice_vector() {
-    auto const free_result = cudaFreeHost(h_data);
-    assert(free_result == cudaSuccess);
-  }
+  ~hostdevice_vector() { cudf::io::pinned_memory_pool::instance().deallocate(h_data, stream); }
 
   bool insert(const T &data) {
     if (num_elements < max_elements) {
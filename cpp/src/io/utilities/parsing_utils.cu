@@ -10,6 +10,7 @@
 #include <cudf/io/types.hpp>
 
 #include <algorithm>
+#include <random>
 
 namespace cudf {
 namespace experimental {
@@ -230,6 +231,33 @@ std::string infer_compression_type(
   return "none";
 }
 
+std::vector<std::pair<size_t, size_t>> select_sample_rows(size_t num_rows, size_t num_sample_rows) {
+  if (num_sample_rows == 0 || num_sample_rows >= num_rows) { return {{0, num_rows}}; }
+
+  // Runs long enough to keep the detection kernels busy, without clustering the sample
+  constexpr size_t sample_run_rows = 64;
+
+  const size_t num_head_rows = (num_sample_rows + 1) / 2;
+  std::vector<std::pair<size_t, size_t>> runs{{0, num_head_rows}};
+
+  const size_t num_tail_rows   = num_sample_rows - num_head_rows;
+  const size_t num_runs        = (num_tail_rows + sample_run_rows - 1) / sample_run_rows;
+  const size_t num_other_rows  = num_rows - num_head_rows;
+  const size_t part_rows       = num_other_rows / std::max<size_t>(num_runs, 1);
+  size_t num_remaining_samples = num_tail_rows;
+
+  std::mt19937 engine{0};
+  for (size_t run = 0; run < num_runs && num_remaining_samples != 0; ++run) {
+    const size_t part_begin = num_head_rows + run * part_rows;
+    const size_t run_rows   = std::min({sample_run_rows, num_remaining_samples, part_rows});
+    if (run_rows == 0) { break; }
+    std::uniform_int_distribution<size_t> offset(0, part_rows - run_rows);
+    runs.emplace_back(part_begin + offset(engine), run_rows);
+    num_remaining_samples -= run_rows;
+  }
+  return runs;
+}
+
 }  // namespace io
 }  // namespace experimental
 }  // namespace cudf
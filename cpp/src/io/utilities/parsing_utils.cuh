@@ -18,6 +18,7 @@
 
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/io/types.hpp>
+#include <strings/convert/float_conversion.cuh>
 
 namespace cudf {
 namespace experimental {
@@ -137,7 +138,7 @@ __device__ __forceinline__ uint8_t decode_digit(char c, bool* valid_flag) {
  *
  * @return The parsed and converted value
  */
-template <typename T>
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value>* = nullptr>
 __inline__ __device__ T
 parse_numeric(const char* data, long start, long end, ParseOptions const& opts, int base = 10) {
   T value               = 0;
@@ -163,35 +164,68 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts,
     }
     ++index;
   }
+  if (!all_digits_valid) { return std::numeric_limits<T>::quiet_NaN(); }
 
-  if (std::is_floating_point<T>::value) {
-    // Handle fractional part of the number if necessary
-    double divisor = 1;
-    while (index <= end) {
-      if (data[index] == 'e' || data[index] == 'E') {
-        ++index;
-        break;
-      } else if (data[index] != opts.thousands && data[index] != '+') {
-        divisor /= base;
-        value += decode_digit<T>(data[index], &all_digits_valid) * divisor;
-      }
+  return value * sign;
+}
+
+/**
+ * @brief Parses a character string and returns the nearest floating-point
+ * value.
+ *
+ * The digits are accumulated as a decimal significand and exponent, which are
+ * converted with a single correctly rounded step instead of scaling each
+ * fractional digit.
+ *
+ * @param data The character string for parse
+ * @param start The index within data to start parsing from
+ * @param end The end index within data to end parsing
+ * @param opts The global parsing behavior options
+ *
+ * @return The parsed and converted value
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__inline__ __device__ T
+parse_numeric(const char* data, long start, long end, ParseOptions const& opts, int = 10) {
+  cudf::strings::detail::decimal_number number;
+  bool all_digits_valid = true;
+
+  // Handle negative values if necessary
+  if (data[start] == '-') {
+    number.negative = true;
+    start++;
+  }
+
+  // Handle the whole and the fractional parts of the number
+  long index      = start;
+  bool fractional = false;
+  while (index <= end) {
+    if (data[index] == opts.decimal && !fractional) {
+      fractional = true;
+    } else if (data[index] == 'e' || data[index] == 'E') {
       ++index;
+      break;
+    } else if (data[index] != opts.thousands && data[index] != '+') {
+      number.append_digit(decode_digit<T>(data[index], &all_digits_valid), fractional);
     }
+    ++index;
+  }
 
-    // Handle exponential part of the number if necessary
-    if (index <= end) {
-      const int32_t exponent_sign = data[index] == '-' ? -1 : 1;
-      if (data[index] == '-' || data[index] == '+') { ++index; }
-      int32_t exponent = 0;
-      while (index <= end) {
-        exponent = (exponent * 10) + decode_digit<T>(data[index++], &all_digits_valid);
-      }
-      if (exponent != 0) { value *= exp10(double(exponent * exponent_sign)); }
+  // Handle exponential part of the number if necessary
+  if (index <= end) {
+    const int32_t exponent_sign = data[index] == '-' ? -1 : 1;
+    if (data[index] == '-' || data[index] == '+') { ++index; }
+    int32_t exponent = 0;
+    while (index <= end) {
+      auto const digit = decode_digit<T>(data[index++], &all_digits_valid);
+      // any larger exponent converts to zero or infinity
+      if (exponent < 100000) { exponent = (exponent * 10) + digit; }
     }
+    number.add_exponent(exponent * exponent_sign);
   }
   if (!all_digits_valid) { return std::numeric_limits<T>::quiet_NaN(); }
 
-  return value * sign;
+  return number.to_float<T>();
 }
 
 }  // namespace gpu
@@ -283,6 +317,21 @@ std::string infer_compression_type(
   const std::string& filename,
   const std::vector<std::pair<std::string, std::string>>& ext_to_comp_map);
 
+/**
+ * @brief Selects the rows to infer the column types from.
+ *
+ * The first half of the sample rows are the first rows of the data. The rest
+ * are split into runs of consecutive rows, one at a random position in each
+ * of equal parts of the remaining rows. The positions are drawn with a fixed
+ * seed so the same data always infers the same types.
+ *
+ * @param[in] num_rows Number of rows of the data
+ * @param[in] num_sample_rows Number of rows to sample; 0 samples all the rows
+ *
+ * @return The first row and the number of rows of each run, in order
+ **/
+std::vector<std::pair<size_t, size_t>> select_sample_rows(size_t num_rows, size_t num_sample_rows);
+
 }  // namespace io
 }  // namespace experimental
 }  // namespace cudf
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cassert>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+/**
+ * @brief Returns the smallest size class whose blocks fit `size` bytes
+ **/
+int size_class(size_t size) {
+  int cls = 0;
+  while ((size_t{1} << cls) < size) { cls++; }
+  return cls;
+}
+
+}  // namespace
+
+pinned_memory_pool &pinned_memory_pool::instance() {
+  // Never destroyed, so buffers released during static destruction stay valid
+  static pinned_memory_pool *pool = new pinned_memory_pool();
+  return *pool;
+}
+
+pinned_memory_pool::~pinned_memory_pool() { release(); }
+
+void *pinned_memory_pool::allocate(size_t size) {
+  if (size == 0) { return nullptr; }
+
+  const int cls = (size > min_block_size) ? size_class(size) : min_size_class;
+  if (cls <= max_size_class) {
+    block blk{nullptr, nullptr};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto &free_blocks = _free_blocks[cls - min_size_class];
+      if (!free_blocks.empty()) {
+        blk = free_blocks.back();
+        free_blocks.pop_back();
+        _cached_size -= size_t{1} << cls;
+        _allocated_blocks[blk.ptr] = {size_t{1} << cls, blk.released};
+      }
+    }
+    if (blk.ptr != nullptr) {
+      // Wait for the copies that were pending when the block was released
+      CUDA_TRY(cudaEventSynchronize(blk.released));
+      return blk.ptr;
+    }
+  }
+
+  // Allocate outside the lock, as pinning the memory may take milliseconds
+  const size_t alloc_size = (cls <= max_size_class) ? size_t{1} << cls : size;
+  void *ptr               = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, alloc_size));
+  std::lock_guard<std::mutex> lock(_mutex);
+  _allocated_blocks[ptr] = {alloc_size, nullptr};
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void *ptr, cudaStream_t stream) {
+  if (ptr == nullptr) { return; }
+
+  cudaEvent_t released = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _allocated_blocks.find(ptr);
+    assert(it != _allocated_blocks.end());
+    const size_t size = it->second.first;
+    released          = it->second.second;
+    _allocated_blocks.erase(it);
+
+    const int cls = size_class(size);
+    if ((size_t{1} << cls) == size && cls >= min_size_class && cls <= max_size_class &&
+        _cached_size + size <= _max_cached_size) {
+      // Called from destructors, so errors fall back to freeing the block
+      if (released == nullptr) { cudaEventCreateWithFlags(&released, cudaEventDisableTiming); }
+      if (released != nullptr && cudaEventRecord(released, stream) == cudaSuccess) {
+        _free_blocks[cls - min_size_class].push_back({ptr, released});
+        _cached_size += size;
+        return;
+      }
+    }
+  }
+  if (released != nullptr) { cudaEventDestroy(released); }
+  auto const free_result = cudaFreeHost(ptr);
+  assert(free_result == cudaSuccess);
+}
+
+void pinned_memory_pool::release() {
+  std::vector<block> blocks;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto &free_blocks : _free_blocks) {
+      blocks.insert(blocks.end(), free_blocks.begin(), free_blocks.end());
+      free_blocks.clear();
+    }
+    _cached_size = 0;
+  }
+  for (auto &blk : blocks) {
+    cudaEventDestroy(blk.released);
+    auto const free_result = cudaFreeHost(blk.ptr);
+    assert(free_result == cudaSuccess);
+  }
+}
+
+size_t pinned_memory_pool::cached_size() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cached_size;
+}
+
+}  // namespace io
+}  // namespace cudf
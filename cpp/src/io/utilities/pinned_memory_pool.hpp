@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Process-wide cache of pinned host memory blocks
+ *
+ * Pinned allocations are expensive and serialize with the device, so the
+ * blocks are kept for reuse once released. Requests are rounded up to a
+ * power-of-two size class, from `min_block_size` to `max_block_size`; larger
+ * requests are allocated and freed directly. Released blocks beyond the
+ * byte cap of the cache are freed.
+ *
+ * Unlike `cudaFreeHost()`, releasing a block does not wait for the device: an
+ * event recorded on the stream that last used the block is waited on before
+ * the block is handed out again, so that pending asynchronous copies from or
+ * to the block complete first. The default stream does not order the work of
+ * non-blocking or per-thread default streams, so that stream must be the one
+ * the copies were queued on.
+ *
+ * All the member functions are thread-safe.
+ **/
+class pinned_memory_pool {
+ public:
+  static constexpr size_t min_block_size  = 4 * 1024;
+  static constexpr size_t max_block_size  = 64 * 1024 * 1024;
+  static constexpr size_t default_max_cached_size = 256 * 1024 * 1024;
+
+  /**
+   * @brief Returns the pool shared by all the readers and writers
+   **/
+  static pinned_memory_pool &instance();
+
+  /**
+   * @brief Creates an empty pool
+   *
+   * @param max_cached_size Maximum number of bytes held in cached blocks
+   **/
+  explicit pinned_memory_pool(size_t max_cached_size = default_max_cached_size)
+    : _max_cached_size(max_cached_size) {}
+  pinned_memory_pool(pinned_memory_pool const &) = delete;
+  pinned_memory_pool &operator=(pinned_memory_pool const &) = delete;
+  ~pinned_memory_pool();
+
+  /**
+   * @brief Allocates at least `size` bytes of pinned host memory
+   *
+   * @param size Number of bytes
+   *
+   * @return Pointer to the allocation; nullptr if `size` is zero
+   **/
+  void *allocate(size_t size);
+
+  /**
+   * @brief Returns an allocation to the pool
+   *
+   * @param ptr Pointer returned by `allocate()`, or nullptr
+   * @param stream Stream of the last copy from or to the allocation
+   **/
+  void deallocate(void *ptr, cudaStream_t stream = 0);
+
+  /**
+   * @brief Frees all the cached blocks
+   **/
+  void release();
+
+  /**
+   * @brief Returns the number of bytes held in cached blocks
+   **/
+  size_t cached_size();
+
+ private:
+  static constexpr int min_size_class = 12;  // log2(min_block_size)
+  static constexpr int max_size_class = 26;  // log2(max_block_size)
+
+  struct block {
+    void *ptr;
+    cudaEvent_t released;  // Recorded when the block is returned to the pool
+  };
+
+  const size_t _max_cached_size;
+  std::mutex _mutex;
+  std::vector<block> _free_blocks[max_size_class - min_size_class + 1];
+  std::unordered_map<void *, std::pair<size_t, cudaEvent_t>> _allocated_blocks;
+  size_t _cached_size = 0;
+};
+
+/**
+ * @brief Returns true if `ptr` points into page-locked host memory
+ *
+ * The device copies such memory directly, so it need not be staged in a pinned
+ * buffer first. This is the case of the buffers of the Java pinned pool.
+ **/
+inline bool is_host_pinned(void const *ptr) {
+  cudaPointerAttributes attributes{};
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError();  // Pageable memory is reported as an error before CUDA 11
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeHost;
+}
+
+/**
+ * @brief Deleter returning pinned memory to the pool
+ *
+ * Holds the stream the memory is copied on, which orders its reuse.
+ **/
+struct pinned_deleter {
+  cudaStream_t stream = 0;
+  void operator()(void *ptr) const { pinned_memory_pool::instance().deallocate(ptr, stream); }
+};
+
+/**
+ * @brief Helper for pinned host memory
+ **/
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, pinned_deleter>;
+
+/**
+ * @brief Allocates a pinned host buffer of `count` elements from the pool
+ *
+ * @param count Number of elements
+ * @param stream Stream the buffer is copied from or to
+ **/
+template <typename T>
+pinned_buffer<T> make_pinned_buffer(size_t count, cudaStream_t stream = 0) {
+  void *ptr = pinned_memory_pool::instance().allocate(count * sizeof(T));
+  return pinned_buffer<T>{static_cast<T *>(ptr), pinned_deleter{stream}};
+}
+
+}  // namespace io
+}  // namespace cudf
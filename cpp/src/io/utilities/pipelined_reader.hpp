@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "datasource.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Double-buffered reader of source data into device memory
+ *
+ * Data is read from the source into one of two pinned staging buffers and
+ * copied to the device asynchronously, so that reading the next piece from the
+ * source overlaps with the host-to-device transfer of the previous piece and
+ * with any work already queued on the stream.
+ * Ranges larger than the staging buffers are split into multiple pieces.
+ * Sources that support direct device reads, and source buffers already in
+ * pinned host memory, bypass the staging buffers.
+ **/
+class pipelined_reader {
+ public:
+  static constexpr size_t default_staging_size = 8 * 1024 * 1024;
+
+  pipelined_reader(datasource *source, cudaStream_t stream)
+    : _source(source), _stream(stream) {
+    for (auto &event : _events) {
+      CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+  }
+
+  ~pipelined_reader() {
+    cudaStreamSynchronize(_stream);
+    for (auto &event : _events) { cudaEventDestroy(event); }
+  }
+
+  /**
+   * @brief Enqueues the read of a range of the source into device memory
+   *
+   * @param offset Bytes from the start of the source
+   * @param size Number of bytes to read
+   * @param dst Device destination
+   **/
+  void read(size_t offset, size_t size, uint8_t *dst) {
+    if (_source->supports_device_read()) {
+      // No staging needed when the source can write straight into device memory
+      _source->device_read(offset, size, dst, _stream);
+      return;
+    }
+    while (size > 0) {
+      const size_t len  = std::min(size, default_staging_size);
+      stage(_source->get_buffer(offset, len), dst);
+      offset += len;
+      size -= len;
+      dst += len;
+    }
+  }
+
+  /**
+   * @brief Enqueues the reads of a set of ranges of the source into device memory
+   *
+   * The ranges are requested from the source in a single `get_buffers()` call.
+   *
+   * @param ranges Offset and size of each range
+   * @param dsts Device destination of each range
+   **/
+  void read(std::vector<std::pair<size_t, size_t>> const &ranges,
+            std::vector<uint8_t *> const &dsts) {
+    if (_source->supports_device_read()) {
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        _source->device_read(ranges[i].first, ranges[i].second, dsts[i], _stream);
+      }
+      return;
+    }
+    const auto buffers = _source->get_buffers(ranges);
+    for (size_t i = 0; i < ranges.size(); ++i) { stage(buffers[i], dsts[i]); }
+  }
+
+ private:
+  /**
+   * @brief Copies a source buffer to the device, through the staging buffers
+   * unless it is in pinned memory
+   **/
+  void stage(std::shared_ptr<arrow::Buffer> const &buffer, uint8_t *dst) {
+    const uint8_t *src = buffer->data();
+    size_t size        = buffer->size();
+    if (size == 0) { return; }
+    if (is_host_pinned(src)) {
+      // The buffer is kept until the copy completes, when the reader is destroyed
+      CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyHostToDevice, _stream));
+      _pinned_sources.push_back(buffer);
+      return;
+    }
+    while (size > 0) {
+      const size_t len = std::min(size, default_staging_size);
+      auto &staging    = _staging[_slot];
+      // Wait until the previous transfer out of this staging buffer completes
+      CUDA_TRY(cudaEventSynchronize(_events[_slot]));
+      if (staging == nullptr) { staging = make_pinned_buffer<uint8_t>(default_staging_size, _stream); }
+      memcpy(staging.get(), src, len);
+      CUDA_TRY(cudaMemcpyAsync(dst, staging.get(), len, cudaMemcpyHostToDevice, _stream));
+      CUDA_TRY(cudaEventRecord(_events[_slot], _stream));
+      _slot = _slot ^ 1;
+      src += len;
+      size -= len;
+      dst += len;
+    }
+  }
+
+ private:
+  datasource *_source;
+  cudaStream_t _stream;
+  std::array<pinned_buffer<uint8_t>, 2> _staging;
+  std::array<cudaEvent_t, 2> _events{};
+  int _slot = 0;
+  std::vector<std::shared_ptr<arrow::Buffer>> _pinned_sources;  // Copied without staging
+};
+
+}  // namespace io
+}  // namespace cudf
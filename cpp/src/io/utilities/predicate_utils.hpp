@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+namespace cudf {
+namespace experimental {
+namespace io {
+
+/**
+ * @brief Returns whether a `[min, max]` value range may contain a value that
+ * satisfies the comparison against `value`
+ */
+template <typename T>
+bool range_may_match(T const &min, T const &max, predicate_op op, T const &value) {
+  switch (op) {
+    case predicate_op::EQUAL: return !(value < min) && !(max < value);
+    case predicate_op::LESS: return min < value;
+    case predicate_op::LESS_EQUAL: return !(value < min);
+    case predicate_op::GREATER: return value < max;
+    case predicate_op::GREATER_EQUAL: return !(max < value);
+    default: return true;
+  }
+}
+
+}  // namespace io
+}  // namespace experimental
+}  // namespace cudf
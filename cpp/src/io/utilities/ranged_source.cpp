@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ranged_source.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+namespace cudf {
+namespace io {
+
+const std::shared_ptr<arrow::Buffer> ranged_source::get_buffer(size_t offset, size_t size) {
+  offset = std::min(offset, this->size());
+  size   = std::min(size, this->size() - offset);
+  if (size == 0) { return std::make_shared<arrow::Buffer>(nullptr, 0); }
+  auto cached = find_cached(offset, size);
+  if (cached != nullptr) { return cached; }
+
+  const size_t fetch_size =
+    std::min(std::max(size, _options.readahead_size), this->size() - offset);
+  auto buffer = fetch(offset, fetch_size);
+  insert_cached(offset, buffer);
+  return arrow::SliceBuffer(buffer, 0, size);
+}
+
+void ranged_source::prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) {
+  std::vector<std::pair<size_t, size_t>> missing;
+  for (auto range : ranges) {
+    range.first  = std::min(range.first, this->size());
+    range.second = std::min(range.second, this->size() - range.first);
+    if (range.second != 0 && find_cached(range.first, range.second) == nullptr) {
+      missing.push_back(range);
+    }
+  }
+  std::sort(missing.begin(), missing.end());
+
+  // Merge the ranges separated by small gaps, up to what the cache can hold
+  std::vector<std::pair<size_t, size_t>> requests;
+  size_t total_size = 0;
+  for (const auto &range : missing) {
+    if (!requests.empty()) {
+      auto &last            = requests.back();
+      const size_t last_end = last.first + last.second;
+      const size_t new_end  = std::max(last_end, range.first + range.second);
+      if (range.first <= last_end + _options.coalesce_gap &&
+          new_end - last.first <= _options.max_request_size &&
+          total_size + (new_end - last_end) <= _options.cache_size) {
+        total_size += new_end - last_end;
+        last.second = new_end - last.first;
+        continue;
+      }
+    }
+    if (total_size + range.second > _options.cache_size) { break; }
+    total_size += range.second;
+    requests.push_back(range);
+  }
+
+  // Fetch the requests concurrently
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(requests.size());
+  std::atomic<size_t> next_request{0};
+  auto fetch_requests = [&]() {
+    for (size_t i = next_request++; i < requests.size(); i = next_request++) {
+      buffers[i] = fetch(requests[i].first, requests[i].second);
+    }
+  };
+  const auto num_workers =
+    std::min<size_t>(requests.size(), std::max(_options.max_concurrency, 1));
+  std::vector<std::future<void>> workers;
+  for (size_t w = 0; w < num_workers; ++w) {
+    workers.emplace_back(std::async(std::launch::async, fetch_requests));
+  }
+  for (auto &worker : workers) { worker.get(); }
+
+  for (size_t i = 0; i < requests.size(); ++i) { insert_cached(requests[i].first, buffers[i]); }
+}
+
+std::shared_ptr<arrow::Buffer> ranged_source::fetch(size_t offset, size_t size) {
+  {
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    if (_object != nullptr) { return arrow::SliceBuffer(_object, offset, size); }
+  }
+  auto buffer = fetch_with_retries(offset, size);
+  if (buffer->size() != size && buffer->size() == this->size()) {
+    // The endpoint ignored the range; keep the object rather than download it for every range
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    _object = buffer;
+    _cache.clear();
+    _insertion_order.clear();
+    _cached_size = 0;
+    return arrow::SliceBuffer(buffer, offset, size);
+  }
+  CUDF_EXPECTS(buffer->size() == size, "Short read from remote object");
+  return buffer;
+}
+
+std::shared_ptr<arrow::Buffer> ranged_source::fetch_with_retries(size_t offset, size_t size) {
+  auto delay = _options.retry_delay;
+  for (int attempt = 0;; ++attempt) {
+    try {
+      return fetch_range(offset, size);
+    } catch (const cudf::logic_error &) {
+      if (attempt >= _options.max_retries) { throw; }
+    }
+    // Back off, as failures are often due to the endpoint throttling requests
+    std::this_thread::sleep_for(delay);
+    delay *= 2;
+  }
+}
+
+std::shared_ptr<arrow::Buffer> ranged_source::find_cached(size_t offset, size_t size) {
+  std::lock_guard<std::mutex> lock(_cache_mutex);
+  if (_object != nullptr) { return arrow::SliceBuffer(_object, offset, size); }
+
+  // Take the data from the consecutive ranges covering it, in order of offset
+  const size_t end = offset + size;
+  size_t pos       = offset;
+  std::vector<std::shared_ptr<arrow::Buffer>> pieces;
+  for (auto it = _cache.begin(); it != _cache.end() && it->first <= pos && pos < end; ++it) {
+    const size_t range_end = it->first + it->second->size();
+    if (range_end <= pos) { continue; }
+    const size_t piece_end = std::min(range_end, end);
+    pieces.push_back(arrow::SliceBuffer(it->second, pos - it->first, piece_end - pos));
+    pos = piece_end;
+  }
+  if (pos < end) { return nullptr; }
+  if (pieces.size() == 1) { return pieces.front(); }
+
+  std::string data;
+  data.reserve(size);
+  for (const auto &piece : pieces) {
+    data.append(reinterpret_cast<const char *>(piece->data()), piece->size());
+  }
+  return arrow::Buffer::FromString(std::move(data));
+}
+
+void ranged_source::insert_cached(size_t offset, std::shared_ptr<arrow::Buffer> const &buffer) {
+  std::lock_guard<std::mutex> lock(_cache_mutex);
+  if (_object != nullptr) { return; }
+  auto it = _cache.find(offset);
+  if (it != _cache.end()) {
+    if (it->second->size() >= buffer->size()) { return; }
+    _cached_size -= it->second->size();
+    it->second = buffer;
+  } else {
+    _cache.emplace(offset, buffer);
+    _insertion_order.push_back(offset);
+  }
+  _cached_size += buffer->size();
+
+  // Evict the oldest ranges; buffers already returned remain valid
+  while (_cached_size > _options.cache_size && _insertion_order.size() > 1) {
+    auto evicted = _cache.find(_insertion_order.front());
+    _insertion_order.pop_front();
+    _cached_size -= evicted->second->size();
+    _cache.erase(evicted);
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
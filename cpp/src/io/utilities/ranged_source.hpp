@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "datasource.hpp"
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Base class for sources with a high per-request latency, such as
+ * object stores
+ *
+ * Reads are served from a cache of fetched ranges. The ranges hinted with
+ * `prefetch()` are merged when close to each other and fetched concurrently;
+ * reads smaller than the readahead size also fetch the data that follows, as
+ * the readers parse metadata with many small reads. A read spanning several
+ * adjacent cached ranges is served from them. Once the endpoint returns the
+ * whole object instead of a range, all the reads are served from it.
+ *
+ * Failed requests are retried after an exponentially increasing delay.
+ **/
+class ranged_source : public datasource {
+ public:
+  explicit ranged_source(remote_source_options const &options) : _options(options) {}
+
+  const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset, size_t size) override;
+
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override;
+
+ protected:
+  /**
+   * @brief Fetches a range of the source from the remote endpoint
+   *
+   * Called concurrently from multiple threads. Throws `cudf::logic_error` on
+   * failure, for the request to be retried.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read, within the source
+   *
+   * @return The `size` bytes at `offset`, or the whole object if the endpoint
+   * does not serve ranges
+   **/
+  virtual std::shared_ptr<arrow::Buffer> fetch_range(size_t offset, size_t size) = 0;
+
+  remote_source_options _options;
+
+ private:
+  std::shared_ptr<arrow::Buffer> fetch(size_t offset, size_t size);
+
+  std::shared_ptr<arrow::Buffer> fetch_with_retries(size_t offset, size_t size);
+
+  std::shared_ptr<arrow::Buffer> find_cached(size_t offset, size_t size);
+
+  void insert_cached(size_t offset, std::shared_ptr<arrow::Buffer> const &buffer);
+
+  std::mutex _cache_mutex;
+  std::map<size_t, std::shared_ptr<arrow::Buffer>> _cache;
+  std::deque<size_t> _insertion_order;
+  size_t _cached_size = 0;
+  std::shared_ptr<arrow::Buffer> _object;  ///< Whole object, if the endpoint returned it
+};
+
+}  // namespace io
+}  // namespace cudf
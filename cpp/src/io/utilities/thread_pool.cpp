@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.hpp"
+
+namespace cudf {
+namespace io {
+
+thread_pool &thread_pool::instance() {
+  // Never destroyed, so the workers never run during static destruction
+  static thread_pool *pool = new thread_pool(default_num_threads);
+  return *pool;
+}
+
+thread_pool::thread_pool(size_t num_threads) {
+  for (size_t i = 0; i < num_threads; ++i) { _threads.emplace_back(&thread_pool::run, this); }
+}
+
+thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopped = true;
+  }
+  _condition.notify_all();
+  for (auto &thread : _threads) { thread.join(); }
+}
+
+void thread_pool::enqueue(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.push_back(std::move(task));
+  }
+  _condition.notify_one();
+}
+
+void thread_pool::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this] { return _stopped || !_tasks.empty(); });
+      if (_tasks.empty()) { return; }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Fixed set of worker threads running the asynchronous reads
+ *
+ * Tasks run in submission order, on the device that was current on the
+ * submitting thread.
+ **/
+class thread_pool {
+ public:
+  static constexpr size_t default_num_threads = 4;
+
+  /**
+   * @brief Returns the pool shared by all the asynchronous readers
+   **/
+  static thread_pool &instance();
+
+  explicit thread_pool(size_t num_threads);
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+  ~thread_pool();
+
+  /**
+   * @brief Queues `task` and returns the future of its result
+   *
+   * Exceptions thrown by the task are rethrown by `get()` on the future.
+   **/
+  template <typename F>
+  auto submit(F &&task) -> std::future<decltype(task())> {
+    using result_type = decltype(task());
+    int device        = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    auto packaged = std::make_shared<std::packaged_task<result_type()>>(
+      [device, task = std::forward<F>(task)]() mutable {
+        CUDA_TRY(cudaSetDevice(device));
+        return task();
+      });
+    auto result = packaged->get_future();
+    enqueue([packaged]() { (*packaged)(); });
+    return result;
+  }
+
+ private:
+  void enqueue(std::function<void()> task);
+  void run();
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<std::function<void()>> _tasks;
+  bool _stopped = false;
+  std::vector<std::thread> _threads;
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -21,7 +21,10 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <boost/filesystem.hpp>
+#include <cudf/jit_cache.hpp>
 #include <cudf/utilities/error.hpp>
+#include <fstream>
+#include <sstream>
 
 namespace cudf {
 namespace jit {
@@ -72,7 +75,10 @@ boost::filesystem::path getCacheDir() {
   return kernel_cache_path;
 }
 
-cudfJitCache::cudfJitCache() {}
+cudfJitCache::cudfJitCache() {
+  auto bundle_path = std::getenv("LIBCUDF_KERNEL_CACHE_BUNDLE");
+  if (bundle_path != nullptr) { loadBundle(bundle_path); }
+}
 
 cudfJitCache::~cudfJitCache() {}
 
@@ -108,11 +114,131 @@ named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelIns
   std::string kern_inst_name = prog_name + '.' + kern_name;
   for (auto&& arg : arguments) kern_inst_name += '_' + arg;
 
+  if (kernel_inst_map.find(kern_inst_name) == kernel_inst_map.end()) {
+    kernel_manifest.push_back(manifest_entry{prog_name, kern_name, arguments});
+  }
+
   return getCached(kern_inst_name, kernel_inst_map, [&]() {
     return program.kernel(kern_name).instantiate(arguments);
   });
 }
 
+namespace {
+
+// The first word of a bundle file
+const std::string bundle_magic = "cudf_jit_bundle";
+
+}  // namespace
+
+// A bundle is a header line `cudf_jit_bundle <version> <count>`, followed by
+// `<count>` entries. Each entry is a line `<name size> <content size>` followed
+// by the name and the serialized content of a program or kernel.
+void cudfJitCache::loadBundle(std::string const& bundle_path) {
+  std::ifstream file(bundle_path, std::ios::binary);
+  CUDF_EXPECTS(file.is_open(), "Cannot open kernel cache bundle " + bundle_path);
+
+  std::string magic, version;
+  size_t count = 0;
+  file >> magic >> version >> count;
+  CUDF_EXPECTS(file.good() and magic == bundle_magic, "Not a kernel cache bundle " + bundle_path);
+  CUDF_EXPECTS(version == std::string{CUDF_STRINGIFY(CUDF_VERSION)},
+               "Kernel cache bundle of another cudf version " + version);
+  file.get();
+
+  std::unordered_map<std::string, std::string> entries;
+  for (size_t i = 0; i < count; ++i) {
+    size_t name_size = 0, content_size = 0;
+    file >> name_size >> content_size;
+    file.get();
+    std::string name(name_size, '\0');
+    std::string content(content_size, '\0');
+    file.read(&name[0], name_size);
+    file.read(&content[0], content_size);
+    CUDF_EXPECTS(file.good(), "Truncated kernel cache bundle " + bundle_path);
+    entries.emplace(std::move(name), std::move(content));
+  }
+
+  std::lock_guard<std::mutex> lock(_bundle_mutex);
+  for (auto& entry : entries) { bundle_map[entry.first] = std::move(entry.second); }
+}
+
+void cudfJitCache::writeBundle(std::string const& bundle_path) {
+  std::unordered_map<std::string, std::string> entries;
+  {
+    std::lock_guard<std::mutex> lock(_bundle_mutex);
+    entries = bundle_map;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_program_cache_mutex);
+    for (auto const& program : program_map) {
+      entries[program.first] = program.second->serialize();
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+    for (auto const& kernel : kernel_inst_map) {
+      entries[kernel.first] = kernel.second->serialize();
+    }
+  }
+
+  std::ofstream file(bundle_path, std::ios::binary | std::ios::trunc);
+  CUDF_EXPECTS(file.is_open(), "Cannot open kernel cache bundle " + bundle_path);
+  file << bundle_magic << ' ' << CUDF_STRINGIFY(CUDF_VERSION) << ' ' << entries.size() << '\n';
+  for (auto const& entry : entries) {
+    file << entry.first.size() << ' ' << entry.second.size() << '\n';
+    file << entry.first << entry.second;
+  }
+  CUDF_EXPECTS(file.good(), "Failed to write kernel cache bundle " + bundle_path);
+}
+
+void cudfJitCache::writeManifest(std::string const& manifest_path) {
+  std::ofstream file(manifest_path, std::ios::trunc);
+  CUDF_EXPECTS(file.is_open(), "Cannot open kernel cache manifest " + manifest_path);
+
+  std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
+  for (auto const& entry : kernel_manifest) {
+    file << entry.program_name << '\t' << entry.kernel_name;
+    for (auto const& arg : entry.arguments) { file << '\t' << arg; }
+    file << '\n';
+  }
+  CUDF_EXPECTS(file.good(), "Failed to write kernel cache manifest " + manifest_path);
+}
+
+void cudfJitCache::warmUpFromManifest(std::string const& manifest_path) {
+  std::ifstream file(manifest_path);
+  CUDF_EXPECTS(file.is_open(), "Cannot open kernel cache manifest " + manifest_path);
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty()) { continue; }
+    std::vector<std::string> fields;
+    std::istringstream line_stream(line);
+    std::string field;
+    while (std::getline(line_stream, field, '\t')) { fields.push_back(field); }
+    CUDF_EXPECTS(fields.size() >= 2, "Invalid kernel cache manifest line: " + line);
+
+    auto program = getProgram(fields[0]);
+    getKernelInstantiation(
+      fields[1], program, std::vector<std::string>(fields.begin() + 2, fields.end()));
+  }
+}
+
+void load_kernel_cache_bundle(std::string const& bundle_path) {
+  cudfJitCache::Instance().loadBundle(bundle_path);
+}
+
+void write_kernel_cache_bundle(std::string const& bundle_path) {
+  cudfJitCache::Instance().writeBundle(bundle_path);
+}
+
+void write_kernel_cache_manifest(std::string const& manifest_path) {
+  cudfJitCache::Instance().writeManifest(manifest_path);
+}
+
+void warm_up_kernel_cache(std::string const& manifest_path) {
+  cudfJitCache::Instance().warmUpFromManifest(manifest_path);
+}
+
 // Another overload for getKernelInstantiation which might be useful to get
 // kernel instantiations in one step
 // ------------------------------------------------------------------------
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -99,6 +100,51 @@ class cudfJitCache {
     std::vector<std::string> const& given_options          = {},
     jitify::experimental::file_callback_type file_callback = nullptr);
 
+  /**---------------------------------------------------------------------------*
+     * @brief Load the programs and kernels of a bundle written by `writeBundle()`
+     * 
+     * The bundle is read-only: its entries are found before the file cache is
+     * searched, and are never written back to it. A bundle is also loaded when
+     * the cache is constructed if the environment variable
+     * `LIBCUDF_KERNEL_CACHE_BUNDLE` names its path.
+     * 
+     * @param bundle_path [in] path of the bundle file
+     * @throws cudf::logic_error if the file is not a bundle of this cudf version
+     *---------------------------------------------------------------------------**/
+  void loadBundle(std::string const& bundle_path);
+
+  /**---------------------------------------------------------------------------*
+     * @brief Write the programs and kernels of this cache to a bundle file
+     * 
+     * The bundle holds the compiled kernels, so it can be shipped to other
+     * machines running the same cudf version and loaded with `loadBundle()`.
+     * 
+     * @param bundle_path [in] path of the bundle file to write
+     *---------------------------------------------------------------------------**/
+  void writeBundle(std::string const& bundle_path);
+
+  /**---------------------------------------------------------------------------*
+     * @brief Write the kernel instantiations requested from this cache to a
+     * manifest file
+     * 
+     * Each line of the manifest holds the tab separated program name, kernel
+     * name and template arguments of one kernel instantiation.
+     * 
+     * @param manifest_path [in] path of the manifest file to write
+     *---------------------------------------------------------------------------**/
+  void writeManifest(std::string const& manifest_path);
+
+  /**---------------------------------------------------------------------------*
+     * @brief Instantiate all the kernels of a manifest written by `writeManifest()`
+     * 
+     * The programs of the kernels must be cached already, in memory, in a
+     * loaded bundle or in the file cache.
+     * 
+     * @param manifest_path [in] path of the manifest file
+     * @throws cudf::logic_error if a program of the manifest is not cached
+     *---------------------------------------------------------------------------**/
+  void warmUpFromManifest(std::string const& manifest_path);
+
  private:
   template <typename Tv>
   using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
@@ -106,6 +152,19 @@ class cudfJitCache {
   umap_str_shptr<jitify::experimental::KernelInstantiation> kernel_inst_map;
   umap_str_shptr<jitify::experimental::Program> program_map;
 
+  /**
+   * @brief A kernel instantiation requested from the cache
+   */
+  struct manifest_entry {
+    std::string program_name;
+    std::string kernel_name;
+    std::vector<std::string> arguments;
+  };
+
+  std::vector<manifest_entry> kernel_manifest;  ///< In the order of instantiation
+  std::unordered_map<std::string, std::string> bundle_map;  ///< Serialized bundle entries
+  std::mutex _bundle_mutex;
+
   /*
     Even though this class can be used as a non-singleton, the file cache
     access should remain limited to one thread per process. The lockf locks can
@@ -168,12 +227,20 @@ class cudfJitCache {
     auto it = map.find(name);
     if (it != map.end()) {
       return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
+    } else {  // Find bundled or file cached T object
       bool successful_read = false;
       std::string serialized;
+      {
+        std::lock_guard<std::mutex> lock(_bundle_mutex);
+        auto bundled = bundle_map.find(name);
+        if (bundled != bundle_map.end()) {
+          serialized      = bundled->second;
+          successful_read = true;
+        }
+      }
 #if defined(JITIFY_USE_CACHE)
       boost::filesystem::path cache_dir = getCacheDir();
-      if (not cache_dir.empty()) {
+      if (not successful_read and not cache_dir.empty()) {
         boost::filesystem::path file_name = cache_dir / name;
         cacheFile file{file_name.string()};
         serialized      = file.read();
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/join_common_utils.hpp>
+
+#include <thrust/scan.h>
+
+namespace cudf {
+
+namespace experimental {
+
+namespace detail {
+
+namespace {
+
+/**
+ * @brief  Returns whether `op` holds for two elements with the given ordering
+ */
+__device__ inline bool satisfies(binary_operator op, weak_ordering ordering) {
+  switch (op) {
+    case binary_operator::EQUAL: return ordering == weak_ordering::EQUIVALENT;
+    case binary_operator::NOT_EQUAL: return ordering != weak_ordering::EQUIVALENT;
+    case binary_operator::LESS: return ordering == weak_ordering::LESS;
+    case binary_operator::GREATER: return ordering == weak_ordering::GREATER;
+    case binary_operator::LESS_EQUAL: return ordering != weak_ordering::GREATER;
+    case binary_operator::GREATER_EQUAL: return ordering != weak_ordering::LESS;
+    default: return false;
+  }
+}
+
+/**
+ * @brief  Evaluates the conjunction of the join conditions on a pair of rows
+ *
+ * A condition involving a null element does not hold.
+ *
+ * @tparam has_nulls Indicates the potential for null values in either table
+ */
+template <bool has_nulls>
+struct pair_predicate {
+  table_device_view left;
+  table_device_view right;
+  join_condition const* conditions;
+  size_type num_conditions;
+
+  __device__ bool operator()(size_type left_row, size_type right_row) const {
+    for (size_type c = 0; c < num_conditions; ++c) {
+      auto const& condition = conditions[c];
+      auto const lhs        = left.column(condition.left_column);
+      auto const rhs        = right.column(condition.right_column);
+      if (has_nulls && (lhs.is_null(left_row) || rhs.is_null(right_row))) { return false; }
+      element_relational_comparator<false> comparator{lhs, rhs, null_order::BEFORE};
+      auto const ordering = type_dispatcher(lhs.type(), comparator, left_row, right_row);
+      if (not satisfies(condition.op, ordering)) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief  Computes the output indices of a nested loop join, counting the
+ * matches of every left row first so that the output is sized exactly
+ */
+template <join_kind JoinKind, typename Predicate>
+VectorPair get_conditional_join_indices(Predicate predicate,
+                                        size_type left_num_rows,
+                                        size_type right_num_rows,
+                                        cudaStream_t stream) {
+  // Left joins output unmatched left rows once
+  rmm::device_vector<size_type> output_counts(left_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    output_counts.begin(),
+                    [predicate, right_num_rows] __device__(size_type i) {
+                      size_type matches = 0;
+                      for (size_type j = 0; j < right_num_rows; ++j) {
+                        if (predicate(i, j)) { ++matches; }
+                      }
+                      return (JoinKind == join_kind::LEFT_JOIN) ? max(matches, 1) : matches;
+                    });
+
+  rmm::device_vector<size_type> output_offsets(left_num_rows);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_counts.begin(),
+                         output_counts.end(),
+                         output_offsets.begin());
+  size_type const join_size =
+    (left_num_rows == 0) ? 0 : output_offsets.back() + output_counts.back();
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  auto d_offsets = output_offsets.data().get();
+  auto d_left    = left_indices.data().get();
+  auto d_right   = right_indices.data().get();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     left_num_rows,
+                     [predicate, right_num_rows, d_offsets, d_left, d_right] __device__(
+                       size_type i) {
+                       auto pos = d_offsets[i];
+                       for (size_type j = 0; j < right_num_rows; ++j) {
+                         if (predicate(i, j)) {
+                           d_left[pos]  = i;
+                           d_right[pos] = j;
+                           ++pos;
+                         }
+                       }
+                       if ((JoinKind == join_kind::LEFT_JOIN) && (pos == d_offsets[i])) {
+                         d_left[pos]  = i;
+                         d_right[pos] = JoinNoneValue;
+                       }
+                     });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+/**
+ * @brief  Performs a join of two tables (left, right) on a conjunction of
+ * comparisons between their columns, by evaluating the conditions on every
+ * pair of rows
+ *
+ * @throws cudf::logic_error if `conditions` is empty, refers to columns
+ * outside of the tables, compares columns of different types or uses an
+ * unsupported operator
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param conditions Comparisons that must all hold for a pair of rows to match
+ * @param mr Device memory resource to use for device memory allocation
+ * @param stream Cuda stream
+ * @tparam JoinKind INNER_JOIN or LEFT_JOIN
+ *
+ * @returns The matching rows, with the columns of `left` followed by those
+ * of `right`
+ */
+template <join_kind JoinKind>
+std::unique_ptr<experimental::table> conditional_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(not conditions.empty(), "No join conditions");
+  for (auto const& condition : conditions) {
+    CUDF_EXPECTS(condition.left_column >= 0 && condition.left_column < left.num_columns() &&
+                   condition.right_column >= 0 && condition.right_column < right.num_columns(),
+                 "Join condition column index out of range");
+    auto const type = left.column(condition.left_column).type();
+    CUDF_EXPECTS(type == right.column(condition.right_column).type(),
+                 "Mismatch in join condition column data types");
+    CUDF_EXPECTS(type.id() != DICTIONARY32, "Dictionary columns are not supported");
+    CUDF_EXPECTS(condition.op == binary_operator::EQUAL ||
+                   condition.op == binary_operator::NOT_EQUAL ||
+                   condition.op == binary_operator::LESS ||
+                   condition.op == binary_operator::GREATER ||
+                   condition.op == binary_operator::LESS_EQUAL ||
+                   condition.op == binary_operator::GREATER_EQUAL,
+                 "Unsupported join condition operator");
+  }
+
+  auto left_d  = table_device_view::create(left, stream);
+  auto right_d = table_device_view::create(right, stream);
+  rmm::device_vector<join_condition> d_conditions(conditions);
+  size_type const num_conditions = conditions.size();
+
+  auto joined_indices =
+    (has_nulls(left) || has_nulls(right))
+      ? get_conditional_join_indices<JoinKind>(
+          pair_predicate<true>{*left_d, *right_d, d_conditions.data().get(), num_conditions},
+          left.num_rows(),
+          right.num_rows(),
+          stream)
+      : get_conditional_join_indices<JoinKind>(
+          pair_predicate<false>{*left_d, *right_d, d_conditions.data().get(), num_conditions},
+          left.num_rows(),
+          right.num_rows(),
+          stream);
+
+  auto left_result  = experimental::detail::gather(
+    left, joined_indices.first.begin(), joined_indices.first.end(), false, mr);
+  auto right_result = experimental::detail::gather(right,
+                                                   joined_indices.second.begin(),
+                                                   joined_indices.second.end(),
+                                                   JoinKind == join_kind::LEFT_JOIN,
+                                                   mr);
+
+  auto columns       = left_result->release();
+  auto right_columns = right_result->release();
+  columns.insert(columns.end(),
+                 std::make_move_iterator(right_columns.begin()),
+                 std::make_move_iterator(right_columns.end()));
+  return std::make_unique<experimental::table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<experimental::table> conditional_inner_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::conditional_join<detail::join_kind::INNER_JOIN>(left, right, conditions, mr);
+}
+
+std::unique_ptr<experimental::table> conditional_left_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<join_condition> const& conditions,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::conditional_join<detail::join_kind::LEFT_JOIN>(left, right, conditions, mr);
+}
+
+}  // namespace experimental
+
+}  // namespace cudf
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+
+namespace experimental {
+
+namespace detail {
+
+namespace {
+
+/**
+ * @brief  Maps a row of the cross product, counted from `first_row`, to the
+ * row of the left table it holds
+ */
+struct left_row_functor {
+  int64_t first_row;
+  size_type right_num_rows;
+  __device__ size_type operator()(size_type i) const {
+    return static_cast<size_type>((first_row + i) / right_num_rows);
+  }
+};
+
+/**
+ * @brief  Maps a row of the cross product, counted from `first_row`, to the
+ * row of the right table it holds
+ */
+struct right_row_functor {
+  int64_t first_row;
+  size_type right_num_rows;
+  __device__ size_type operator()(size_type i) const {
+    return static_cast<size_type>((first_row + i) % right_num_rows);
+  }
+};
+
+/**
+ * @brief  Gathers `num_rows` rows of the cross product of `left` and `right`,
+ * starting at row `first_row`
+ */
+std::unique_ptr<experimental::table> cross_join_rows(table_view const& left,
+                                                     table_view const& right,
+                                                     int64_t first_row,
+                                                     size_type num_rows,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream) {
+  auto counting_it = thrust::make_counting_iterator<size_type>(0);
+  auto left_it =
+    thrust::make_transform_iterator(counting_it, left_row_functor{first_row, right.num_rows()});
+  auto right_it =
+    thrust::make_transform_iterator(counting_it, right_row_functor{first_row, right.num_rows()});
+
+  auto left_result  = detail::gather(left, left_it, left_it + num_rows, false, mr, stream);
+  auto right_result = detail::gather(right, right_it, right_it + num_rows, false, mr, stream);
+
+  auto columns       = left_result->release();
+  auto right_columns = right_result->release();
+  columns.insert(columns.end(),
+                 std::make_move_iterator(right_columns.begin()),
+                 std::make_move_iterator(right_columns.end()));
+  return std::make_unique<experimental::table>(std::move(columns));
+}
+
+/**
+ * @brief  Returns an empty table with the columns of `left` followed by those
+ * of `right`
+ */
+std::unique_ptr<experimental::table> empty_cross_join(table_view const& left,
+                                                      table_view const& right) {
+  auto columns       = empty_like(left)->release();
+  auto right_columns = empty_like(right)->release();
+  columns.insert(columns.end(),
+                 std::make_move_iterator(right_columns.begin()),
+                 std::make_move_iterator(right_columns.end()));
+  return std::make_unique<experimental::table>(std::move(columns));
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::experimental::cross_join(table_view const&, table_view const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream Cuda stream
+ */
+std::unique_ptr<experimental::table> cross_join(
+  table_view const& left,
+  table_view const& right,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+
+  int64_t const num_rows = static_cast<int64_t>(left.num_rows()) * right.num_rows();
+  CUDF_EXPECTS(num_rows <= std::numeric_limits<size_type>::max(),
+               "Cross join output exceeds the column size limit");
+  if (num_rows == 0) { return empty_cross_join(left, right); }
+
+  return cross_join_rows(left, right, 0, static_cast<size_type>(num_rows), mr, stream);
+}
+
+/**
+ * @copydoc cudf::experimental::cross_join(table_view const&, table_view const&,
+ * size_type, rmm::mr::device_memory_resource*)
+ *
+ * @param stream Cuda stream
+ */
+std::vector<std::unique_ptr<experimental::table>> cross_join(
+  table_view const& left,
+  table_view const& right,
+  size_type max_chunk_rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(max_chunk_rows > 0, "Chunk size must be positive");
+
+  // The whole product may exceed `size_type`; only each chunk must fit
+  int64_t const num_rows = static_cast<int64_t>(left.num_rows()) * right.num_rows();
+
+  std::vector<std::unique_ptr<experimental::table>> chunks;
+  for (int64_t first_row = 0; first_row < num_rows; first_row += max_chunk_rows) {
+    auto const chunk_rows =
+      static_cast<size_type>(std::min<int64_t>(max_chunk_rows, num_rows - first_row));
+    chunks.push_back(cross_join_rows(left, right, first_row, chunk_rows, mr, stream));
+  }
+  return chunks;
+}
+
+}  // namespace detail
+
+std::unique_ptr<experimental::table> cross_join(table_view const& left,
+                                                table_view const& right,
+                                                rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::cross_join(left, right, mr);
+}
+
+std::vector<std::unique_ptr<experimental::table>> cross_join(table_view const& left,
+                                                             table_view const& right,
+                                                             size_type max_chunk_rows,
+                                                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::cross_join(left, right, max_chunk_rows, mr);
+}
+
+}  // namespace experimental
+
+}  // namespace cudf
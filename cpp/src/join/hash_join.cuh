@@ -15,13 +15,16 @@
  */
 #pragma once
 
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/structs/detail/utilities.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 
+#include <hash/bloom_filter.cuh>
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
 
@@ -45,16 +48,20 @@ namespace detail {
  *
  * @param build_table The right hand table
  * @param probe_table The left hand table
+ * @param hash_probe Row hasher for the probe table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param filter Bloom filter of the hash values of the build table rows
  *
  * @returns An estimate of the size of the output of the join operation
  */
 /* ----------------------------------------------------------------------------*/
-template <join_kind JoinKind, typename multimap_type>
+template <join_kind JoinKind, typename multimap_type, typename row_hasher_t>
 size_type estimate_join_output_size(table_device_view build_table,
                                     table_device_view probe_table,
+                                    row_hasher_t const& hash_probe,
                                     multimap_type const& hash_table,
+                                    bloom_filter_view filter,
                                     cudaStream_t stream) {
   const size_type build_table_num_rows{build_table.num_rows()};
   const size_type probe_table_num_rows{probe_table.num_rows()};
@@ -95,7 +102,10 @@ size_type estimate_join_output_size(table_device_view build_table,
   int numBlocks{-1};
 
   CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
+    &numBlocks,
+    compute_join_output_size<JoinKind, multimap_type, block_size, row_hasher_t>,
+    block_size,
+    0));
 
   int dev_id{-1};
   CUDA_TRY(cudaGetDevice(&dev_id));
@@ -111,16 +121,16 @@ size_type estimate_join_output_size(table_device_view build_table,
 
     size_estimate.set_value(0);
 
-    row_hash hash_probe{probe_table};
     row_equality equality{probe_table, build_table};
     // Probe the hash table without actually building the output to simply
     // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
+    compute_join_output_size<JoinKind, multimap_type, block_size, row_hasher_t>
       <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
                                                        build_table,
                                                        probe_table,
                                                        hash_probe,
                                                        equality,
+                                                       filter,
                                                        sample_probe_num_rows,
                                                        size_estimate.data());
     CHECK_CUDA(stream);
@@ -128,10 +138,11 @@ size_type estimate_join_output_size(table_device_view build_table,
     // Only in case subset of probe table is chosen,
     // increase the estimated output size by a factor of the ratio between the
     // probe and build tables
+    CUDF_SYNC_POINT();
     if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
+      h_size_estimate = size_estimate.value(stream) * probe_to_build_ratio;
     } else {
-      h_size_estimate = size_estimate.value();
+      h_size_estimate = size_estimate.value(stream);
     }
 
     // If the size estimate is non-zero, then we have a valid estimate and can break
@@ -154,6 +165,80 @@ size_type estimate_join_output_size(table_device_view build_table,
   return h_size_estimate;
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the exact size of the join output produced when joining
+ * two tables together, by counting the matches of every probe table row.
+ *
+ * @throws cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_probe Row hasher for the probe table
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param filter Bloom filter of the hash values of the build table rows
+ *
+ * @returns The size of the output of the join operation
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind, typename multimap_type, typename row_hasher_t>
+size_type compute_exact_join_output_size(table_device_view build_table,
+                                         table_device_view probe_table,
+                                         row_hasher_t const& hash_probe,
+                                         multimap_type const& hash_table,
+                                         bloom_filter_view filter,
+                                         cudaStream_t stream) {
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+
+  // If the build table is empty, we know exactly how large the output
+  // will be for the different types of joins and can return immediately
+  if (build_table.num_rows() == 0) {
+    switch (JoinKind) {
+      // Inner join with an empty table will have no output
+      case join_kind::INNER_JOIN: return 0;
+
+      // Left join with an empty table will have an output of NULL rows
+      // equal to the number of rows in the probe table
+      case join_kind::LEFT_JOIN: return probe_table_num_rows;
+
+      default: CUDF_FAIL("Unsupported join type");
+    }
+  }
+
+  rmm::device_scalar<size_type> size(0, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  int numBlocks{-1};
+
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &numBlocks,
+    compute_join_output_size<JoinKind, multimap_type, block_size, row_hasher_t>,
+    block_size,
+    0));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  row_equality equality{probe_table, build_table};
+  compute_join_output_size<JoinKind, multimap_type, block_size, row_hasher_t>
+    <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
+                                                     build_table,
+                                                     probe_table,
+                                                     hash_probe,
+                                                     equality,
+                                                     filter,
+                                                     probe_table_num_rows,
+                                                     size.data());
+  CHECK_CUDA(stream);
+
+  CUDF_SYNC_POINT();
+  return size.value(stream);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  Computes the trivial left join operation for the case when the
@@ -183,43 +268,49 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream) {
 
 /* --------------------------------------------------------------------------*/
 /**
- * @brief  Computes the join operation between two tables and returns the
- * output indices of left and right table as a combined table
+ * @brief  Creates the Bloom filter used to skip the hash table lookups of
+ * probe rows that have no match.
  *
- * @param left  Table of left columns to join
- * @param right Table of right  columns to join
- * @param flip_join_indices Flag that indicates whether the left and right
- * tables have been flipped, meaning the output indices should also be flipped.
+ * Small hash tables stay cached, so their lookups cost about as much as the
+ * filter's; the filter is only enabled for build tables of at least
+ * `BLOOM_FILTER_MIN_BUILD_ROWS` rows.
+ *
+ * @param build_table_num_rows The number of rows in the build table
  * @param stream stream on which all memory allocations and copies
  * will be performed
- * @tparam join_kind The type of join to be performed
  *
- * @returns Join output indices vector pair
+ * @returns A cleared filter, disabled for small build tables
  */
 /* ----------------------------------------------------------------------------*/
-template <join_kind JoinKind>
-std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
-                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
-get_base_hash_join_indices(table_view const& left,
-                           table_view const& right,
-                           bool flip_join_indices,
-                           cudaStream_t stream) {
-  // The `right` table is always used for building the hash map. We want to build the hash map
-  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
-  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
-    return get_base_hash_join_indices<JoinKind>(right, left, true, stream);
-  }
-  //Trivial left join case - exit early
-  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
-    return get_trivial_left_join_indices(left, stream);
-  }
-
-  auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
-
-  // Probe with the left table
-  auto probe_table = table_device_view::create(left, stream);
+inline bloom_filter make_join_bloom_filter(size_type build_table_num_rows, cudaStream_t stream) {
+  return bloom_filter(
+    (build_table_num_rows >= BLOOM_FILTER_MIN_BUILD_ROWS) ? build_table_num_rows : 0, stream);
+}
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Builds the hash table mapping the hash value of every row of the
+ * build table to the index of that row.
+ *
+ * @throws cudf::logic_error if a row cannot be inserted into the hash table
+ *
+ * @param build_table Table of build side columns to join on
+ * @param hash_build Row hasher for the build table
+ * @param filter Bloom filter the hash values of the rows are also inserted
+ * into, usually created by `make_join_bloom_filter()`
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Hash table of the rows of `build_table`
+ */
+/* ----------------------------------------------------------------------------*/
+template <typename row_hasher_t>
+std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> build_join_hash_table(
+  table_device_view build_table,
+  row_hasher_t const& hash_build,
+  bloom_filter_view filter,
+  cudaStream_t stream) {
+  const size_type build_table_num_rows{build_table.num_rows()};
   size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
 
   auto hash_table = multimap_type::create(hash_table_size,
@@ -231,18 +322,71 @@ get_base_hash_join_indices(table_view const& left,
 
   // build the hash table
   if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
     rmm::device_scalar<int> failure(0, stream);
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
     experimental::detail::grid_1d config(build_table_num_rows, block_size);
     build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      *hash_table, hash_build, build_table_num_rows, failure.data());
+      *hash_table, hash_build, filter, build_table_num_rows, failure.data());
     // Check error code from the kernel
     if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
   }
 
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    *build_table, *probe_table, *hash_table, stream);
+  return hash_table;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Builds the hash table of the build table, hashing its rows.
+ *
+ * @copydetails build_join_hash_table(table_device_view, row_hasher_t const&,
+ * bloom_filter_view, cudaStream_t)
+ */
+/* ----------------------------------------------------------------------------*/
+inline std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> build_join_hash_table(
+  table_device_view build_table, bloom_filter_view filter, cudaStream_t stream) {
+  return build_join_hash_table(build_table, row_hash{build_table}, filter, stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes the hash table of the build table with the rows of the probe
+ * table and returns the output indices of the probe and build tables.
+ *
+ * @param build_table Table of build side columns to join on
+ * @param probe_table Table of probe side columns to join on
+ * @param hash_probe Row hasher for the probe table, computing the same hash
+ * values as the one the hash table was built with
+ * @param hash_table Hash table built on `build_table` by `build_join_hash_table()`
+ * @param filter Bloom filter built along with `hash_table`
+ * @param flip_join_indices Flag that indicates whether the output indices of
+ * the probe and build tables should be swapped.
+ * @param size_mode Whether the output is sized exactly or from an estimate
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair, probe indices first unless
+ * `flip_join_indices` is set
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind, typename row_hasher_t>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      row_hasher_t const& hash_probe,
+                      multimap_type const& hash_table,
+                      bloom_filter_view filter,
+                      bool flip_join_indices,
+                      join_size_mode size_mode,
+                      cudaStream_t stream) {
+  // In EXACT mode, the probe below runs exactly once
+  size_type estimated_size =
+    (size_mode == join_size_mode::EXACT)
+      ? compute_exact_join_output_size<JoinKind, multimap_type>(
+          build_table, probe_table, hash_probe, hash_table, filter, stream)
+      : estimate_join_output_size<JoinKind, multimap_type>(
+          build_table, probe_table, hash_probe, hash_table, filter, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -264,18 +408,23 @@ get_base_hash_join_indices(table_view const& left,
     right_indices.resize(estimated_size);
 
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    experimental::detail::grid_1d config(probe_table->num_rows(), block_size);
+    experimental::detail::grid_1d config(probe_table.num_rows(), block_size);
     write_index.set_value(0);
 
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table};
-    probe_hash_table<JoinKind, multimap_type, hash_value_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(*hash_table,
-                                                                       *build_table,
-                                                                       *probe_table,
+    row_equality equality{probe_table, build_table};
+    probe_hash_table<JoinKind,
+                     multimap_type,
+                     hash_value_type,
+                     block_size,
+                     DEFAULT_JOIN_CACHE_SIZE,
+                     row_hasher_t>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(hash_table,
+                                                                       build_table,
+                                                                       probe_table,
                                                                        hash_probe,
                                                                        equality,
-                                                                       probe_table->num_rows(),
+                                                                       filter,
+                                                                       probe_table.num_rows(),
                                                                        left_indices.data().get(),
                                                                        right_indices.data().get(),
                                                                        write_index.data(),
@@ -284,7 +433,8 @@ get_base_hash_join_indices(table_view const& left,
 
     CHECK_CUDA(stream);
 
-    join_size              = write_index.value();
+    CUDF_SYNC_POINT();
+    join_size              = write_index.value(stream);
     current_estimated_size = estimated_size;
     estimated_size *= 2;
   } while ((current_estimated_size < join_size));
@@ -294,6 +444,131 @@ get_base_hash_join_indices(table_view const& left,
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes the hash table of the build table with the rows of the probe
+ * table, hashing the probe rows.
+ *
+ * @copydetails probe_join_hash_table(table_device_view, table_device_view,
+ * row_hasher_t const&, multimap_type const&, bloom_filter_view, bool,
+ * join_size_mode, cudaStream_t)
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      multimap_type const& hash_table,
+                      bloom_filter_view filter,
+                      bool flip_join_indices,
+                      join_size_mode size_mode,
+                      cudaStream_t stream) {
+  return probe_join_hash_table<JoinKind>(build_table,
+                                         probe_table,
+                                         row_hash{probe_table},
+                                         hash_table,
+                                         filter,
+                                         flip_join_indices,
+                                         size_mode,
+                                         stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the join operation between two tables and returns the
+ * output indices of left and right table as a combined table
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right  columns to join
+ * @param flip_join_indices Flag that indicates whether the left and right
+ * tables have been flipped, meaning the output indices should also be flipped.
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @param size_mode Whether the output is sized exactly or from an estimate
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+get_base_hash_join_indices(table_view const& left,
+                           table_view const& right,
+                           bool flip_join_indices,
+                           cudaStream_t stream,
+                           join_size_mode size_mode = join_size_mode::EXACT) {
+  // The `right` table is always used for building the hash map. We want to build the hash map
+  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
+  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
+    return get_base_hash_join_indices<JoinKind>(right, left, true, stream, size_mode);
+  }
+  //Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream);
+  }
+
+  // Struct keys are hashed and compared by the columns of their fields
+  auto const flattened_right = structs::detail::flatten_nested_columns(right, {}, {}, stream);
+  auto const flattened_left  = structs::detail::flatten_nested_columns(left, {}, {}, stream);
+
+  auto build_table = table_device_view::create(flattened_right.flattened_columns, stream);
+
+  // Probe with the left table
+  auto probe_table = table_device_view::create(flattened_left.flattened_columns, stream);
+
+  auto filter     = make_join_bloom_filter(build_table->num_rows(), stream);
+  auto hash_table = [&] {
+    CUDF_PHASE_RANGE("hash_join_build");
+    return build_join_hash_table(*build_table, filter.view(), stream);
+  }();
+
+  CUDF_PHASE_RANGE("hash_join_probe");
+  return probe_join_hash_table<JoinKind>(*build_table,
+                                         *probe_table,
+                                         *hash_table,
+                                         filter.view(),
+                                         flip_join_indices,
+                                         size_mode,
+                                         stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the number of rows of the join of two tables, without
+ * allocating the output indices
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right  columns to join
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns The number of rows of the join output
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN), size_type> get_base_hash_join_size(
+  table_view const& left, table_view const& right, cudaStream_t stream) {
+  // The hash map is built on the smaller table, as in `get_base_hash_join_indices`
+  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
+    return get_base_hash_join_size<JoinKind>(right, left, stream);
+  }
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) { return left.num_rows(); }
+
+  auto const flattened_right = structs::detail::flatten_nested_columns(right, {}, {}, stream);
+  auto const flattened_left  = structs::detail::flatten_nested_columns(left, {}, {}, stream);
+
+  auto build_table = table_device_view::create(flattened_right.flattened_columns, stream);
+  auto probe_table = table_device_view::create(flattened_left.flattened_columns, stream);
+
+  auto filter     = make_join_bloom_filter(build_table->num_rows(), stream);
+  auto hash_table = build_join_hash_table(*build_table, filter.view(), stream);
+  return compute_exact_join_output_size<JoinKind, multimap_type>(
+    *build_table, *probe_table, row_hash{*probe_table}, *hash_table, filter.view(), stream);
+}
+
 }  //namespace detail
 
 }  //namespace experimental
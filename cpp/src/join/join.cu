@@ -15,10 +15,19 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spill.hpp>
+#include <cudf/detail/utilities/memory_budget.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -78,7 +87,7 @@ std::unique_ptr<experimental::table> get_empty_joined_table(
   return std::make_unique<experimental::table>(tmp_table);
 }
 
-VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b) {
+VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b, cudaStream_t stream) {
   CUDF_EXPECTS((a.first.size() == a.second.size()),
                "Mismatch between sizes of vectors in vector pair");
   CUDF_EXPECTS((b.first.size() == b.second.size()),
@@ -89,10 +98,18 @@ VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b) {
     return a;
   }
   auto original_size = a.first.size();
+  // The vectors are resized on the default stream
+  CUDF_STREAM_SYNC(stream);
   a.first.resize(a.first.size() + b.first.size());
   a.second.resize(a.second.size() + b.second.size());
-  thrust::copy(b.first.begin(), b.first.end(), a.first.begin() + original_size);
-  thrust::copy(b.second.begin(), b.second.end(), a.second.begin() + original_size);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               b.first.begin(),
+               b.first.end(),
+               a.first.begin() + original_size);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               b.second.begin(),
+               b.second.end(),
+               a.second.begin() + original_size);
   return a;
 }
 
@@ -179,13 +196,13 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
 
 /* --------------------------------------------------------------------------*/
 /**
- * @brief  Computes the base join operation between two tables and returns the
- * output indices of left and right table as a combined table, i.e. if full
- * join is specified as the join type then left join is called.
+ * @brief  Computes the join operation between two tables by searching the
+ * rows of the left table in the right table sorted on the join columns, and
+ * returns the output indices of left and right table.
  *
- * @throws cudf::logic_error
- * If `left`/`right` table is empty
- * If type mismatch between joining columns
+ * The right table is sorted first unless it already is. Unlike the hash join,
+ * the memory used besides the output is linear in the sizes of the tables,
+ * and the right table is accessed in order.
  *
  * @param left  Table of left columns to join
  * @param right Table of right  columns to join
@@ -197,8 +214,75 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
  */
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind>
-std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN), VectorPair> get_sort_merge_join_indices(
   table_view const& left, table_view const& right, cudaStream_t stream) {
+  // Sort the right table unless it is already, e.g. when read from a sorted file
+  std::unique_ptr<column> right_order;
+  std::unique_ptr<experimental::table> sorted_right_table;
+  table_view sorted_right = right;
+  if (not experimental::is_sorted(right, {}, {})) {
+    right_order        = experimental::sorted_order(right);
+    sorted_right_table = experimental::gather(right, *right_order);
+    sorted_right       = *sorted_right_table;
+  }
+
+  // Range of the matching right rows of every left row
+  auto const lower = experimental::lower_bound(sorted_right, left, {}, {});
+  auto const upper = experimental::upper_bound(sorted_right, left, {}, {});
+  auto d_lower     = lower->view().data<size_type>();
+  auto d_upper     = upper->view().data<size_type>();
+
+  // End of the output rows of every left row; left joins output unmatched left rows once
+  rmm::device_vector<size_type> output_ends(left.num_rows());
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(left.num_rows()),
+    output_ends.begin(),
+    [d_lower, d_upper] __device__(size_type i) {
+      auto const matches = d_upper[i] - d_lower[i];
+      return (JoinKind == join_kind::LEFT_JOIN) ? max(matches, 1) : matches;
+    },
+    thrust::plus<size_type>());
+  size_type const join_size = output_ends.empty() ? 0 : output_ends.back();
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      output_ends.begin(),
+                      output_ends.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(join_size),
+                      left_indices.begin());
+
+  auto d_output_ends = output_ends.data().get();
+  auto d_left        = left_indices.data().get();
+  auto d_right_order = right_order ? right_order->view().data<size_type>() : nullptr;
+  auto right_index   = [d_lower, d_upper, d_output_ends, d_left, d_right_order] __device__(
+                       size_type k) {
+    auto const i = d_left[k];
+    if (d_lower[i] == d_upper[i]) { return JoinNoneValue; }
+    auto const first = (i == 0) ? 0 : d_output_ends[i - 1];
+    auto const row   = d_lower[i] + (k - first);
+    return (d_right_order != nullptr) ? d_right_order[row] : row;
+  };
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(join_size),
+                    right_indices.begin(),
+                    right_index);
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief  Checks that the join columns `left` and `right` can be compared
+ *
+ * @throws cudf::logic_error
+ * If `left`/`right` table is empty
+ * If type mismatch between joining columns
+ */
+void validate_base_join_columns(table_view const& left, table_view const& right) {
   CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
   CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
   CUDF_EXPECTS(std::equal(std::cbegin(left),
@@ -207,9 +291,41 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base
                           std::cend(right),
                           [](const auto& l, const auto& r) { return l.type() == r.type(); }),
                "Mismatch in joining column data types");
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the base join operation between two tables and returns the
+ * output indices of left and right table as a combined table, i.e. if full
+ * join is specified as the join type then left join is called.
+ *
+ * @throws cudf::logic_error
+ * If `left`/`right` table is empty
+ * If type mismatch between joining columns
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right  columns to join
+ * @param algorithm Algorithm used to find the matching rows
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
+  table_view const& left,
+  table_view const& right,
+  join_algorithm algorithm,
+  cudaStream_t stream) {
+  validate_base_join_columns(left, right);
 
   constexpr join_kind BaseJoinKind =
     (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  if (algorithm == join_algorithm::SORT_MERGE) {
+    return get_sort_merge_join_indices<BaseJoinKind>(left, right, stream);
+  }
   return get_base_hash_join_indices<BaseJoinKind>(left, right, false, stream);
 }
 
@@ -308,21 +424,27 @@ std::unique_ptr<experimental::table> construct_join_output_df(
       auto common_from_right = experimental::detail::gather(right.select(right_common_col),
                                                             complement_indices.second.begin(),
                                                             complement_indices.second.end(),
-                                                            nullify_out_of_bounds);
+                                                            nullify_out_of_bounds,
+                                                            rmm::mr::get_default_resource(),
+                                                            stream);
       auto common_from_left  = experimental::detail::gather(left.select(left_common_col),
                                                            joined_indices.first.begin(),
                                                            joined_indices.first.end(),
-                                                           nullify_out_of_bounds);
-      common_table =
-        experimental::concatenate({common_from_right->view(), common_from_left->view()});
+                                                           nullify_out_of_bounds,
+                                                           rmm::mr::get_default_resource(),
+                                                           stream);
+      common_table = experimental::detail::concatenate(
+        {common_from_right->view(), common_from_left->view()}, mr, stream);
     }
-    joined_indices = concatenate_vector_pairs(complement_indices, joined_indices);
+    joined_indices = concatenate_vector_pairs(complement_indices, joined_indices, stream);
   } else {
     if (not columns_in_common.empty()) {
       common_table = experimental::detail::gather(left.select(left_common_col),
                                                   joined_indices.first.begin(),
                                                   joined_indices.first.end(),
-                                                  nullify_out_of_bounds);
+                                                  nullify_out_of_bounds,
+                                                  mr,
+                                                  stream);
     }
   }
 
@@ -331,13 +453,17 @@ std::unique_ptr<experimental::table> construct_join_output_df(
     experimental::detail::gather(left.select(left_noncommon_col),
                                  joined_indices.first.begin(),
                                  joined_indices.first.end(),
-                                 nullify_out_of_bounds);
+                                 nullify_out_of_bounds,
+                                 mr,
+                                 stream);
 
   std::unique_ptr<experimental::table> right_table =
     experimental::detail::gather(right.select(right_noncommon_col),
                                  joined_indices.second.begin(),
                                  joined_indices.second.end(),
-                                 nullify_out_of_bounds);
+                                 nullify_out_of_bounds,
+                                 mr,
+                                 stream);
 
   return std::make_unique<experimental::table>(combine_join_columns(left_table->release(),
                                                                     left_noncommon_col,
@@ -346,6 +472,282 @@ std::unique_ptr<experimental::table> construct_join_output_df(
                                                                     right_table->release()));
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Checks that the columns to join on and the columns in common of a
+ * join are consistent.
+ *
+ * @throws cudf::logic_error
+ * If number of elements in `left_on` or `right_on` mismatch.
+ * If `columns_in_common` contains a pair of indices (L, R) if L does not exist
+ * in `left_on` or R does not exist in `right_on`, or such that the location of
+ * `L` within `left_on` is not equal to location of R within `right_on`
+ *
+ * @param left_on The column's indices from `left` to join on.
+ * @param right_on The column's indices from `right` to join on.
+ * @param columns_in_common is a vector of pairs of column indices into
+ * `left_on` and `right_on`, respectively, that are "in common".
+ */
+/* ----------------------------------------------------------------------------*/
+void validate_join_columns(std::vector<size_type> const& left_on,
+                           std::vector<size_type> const& right_on,
+                           std::vector<std::pair<size_type, size_type>> const& columns_in_common) {
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS(std::all_of(columns_in_common.begin(),
+                           columns_in_common.end(),
+                           [&left_on, &right_on](auto p) {
+                             size_t lind =
+                               std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
+                             size_t rind = std::find(right_on.begin(), right_on.end(), p.second) -
+                                           right_on.begin();
+                             return (lind != left_on.size()) && (rind != right_on.size()) &&
+                                    (lind == rind);
+                           }),
+               "Invalid values passed to columns_in_common");
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Validates a column of precomputed row hash values.
+ *
+ * @throws cudf::logic_error if `hashes` is not a non-nullable INT32 column of
+ * `num_rows` elements
+ *
+ * @param hashes The hash value of every row of a table
+ * @param num_rows The number of rows of the table
+ */
+/* ----------------------------------------------------------------------------*/
+void validate_row_hashes(column_view const& hashes, size_type num_rows) {
+  CUDF_EXPECTS(hashes.type().id() == INT32, "Row hashes must be an INT32 column");
+  CUDF_EXPECTS(not hashes.has_nulls(), "Row hashes must not have nulls");
+  CUDF_EXPECTS(hashes.size() == num_rows, "Number of row hashes must match the number of rows");
+}
+
+/**
+ * @brief  Returns the number of bytes of device memory used by a column
+ */
+size_t column_device_size(column_view const& col) {
+  size_t size = is_fixed_width(col.type()) ? size_of(col.type()) * col.size() : 0;
+  if (col.nullable()) { size += bitmask_allocation_size_bytes(col.size()); }
+  for (size_type i = 0; i < col.num_children(); ++i) { size += column_device_size(col.child(i)); }
+  return size;
+}
+
+namespace {
+
+bool is_same_view(column_view const& lhs, column_view const& rhs) {
+  if ((lhs.type() != rhs.type()) || (lhs.size() != rhs.size()) ||
+      (lhs.offset() != rhs.offset()) || (lhs.head() != rhs.head()) ||
+      (lhs.num_children() != rhs.num_children())) {
+    return false;
+  }
+  for (size_type idx = 0; idx < lhs.num_children(); ++idx) {
+    if (!is_same_view(lhs.child(idx), rhs.child(idx))) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+matched_join_columns match_dictionary_keys(table_view const& left,
+                                           table_view const& right,
+                                           cudaStream_t stream) {
+  matched_join_columns result{left, right, {}};
+  if (left.num_columns() != right.num_columns()) return result;
+  std::vector<column_view> left_columns(left.begin(), left.end());
+  std::vector<column_view> right_columns(right.begin(), right.end());
+  for (size_type idx = 0; idx < left.num_columns(); ++idx) {
+    auto const& l = left.column(idx);
+    auto const& r = right.column(idx);
+    if ((l.type().id() != DICTIONARY32) || (r.type().id() != DICTIONARY32)) continue;
+    dictionary_column_view const l_dictionary(l);
+    dictionary_column_view const r_dictionary(r);
+    if (is_same_view(l_dictionary.keys(), r_dictionary.keys())) continue;
+    // compare the values of both columns as positions in the keys of the left column
+    auto const keys = l_dictionary.keys();
+    result.ordinals.push_back(dictionary::detail::keys_ordinals(
+      l_dictionary, keys, rmm::mr::get_default_resource(), stream));
+    left_columns[idx] = result.ordinals.back()->view();
+    result.ordinals.push_back(dictionary::detail::keys_ordinals(
+      r_dictionary, keys, rmm::mr::get_default_resource(), stream));
+    right_columns[idx] = result.ordinals.back()->view();
+  }
+  if (!result.ordinals.empty()) {
+    result.left  = table_view{left_columns};
+    result.right = table_view{right_columns};
+  }
+  return result;
+}
+
+/**
+ * @brief  Returns the number of bytes of device memory used by a hash join of
+ * `left` and `right`, besides its output
+ */
+size_t join_working_set(table_view const& left, table_view const& right) {
+  size_t working_set{0};
+  for (auto const& col : left) { working_set += column_device_size(col); }
+  // The hash table takes about as much memory again as the right table
+  for (auto const& col : right) { working_set += 2 * column_device_size(col); }
+  return working_set;
+}
+
+/**
+ * @brief  Returns the average number of bytes of device memory of a row of `t`
+ */
+size_t table_row_size(table_view const& t) {
+  if (t.num_rows() == 0) { return 0; }
+  size_t size{0};
+  for (auto const& col : t) { size += column_device_size(col); }
+  return size / t.num_rows();
+}
+
+/**
+ * @brief  Returns the number of partitions for a partitioned hash join, so
+ * that a partition of each table, the hash table and the output of their join
+ * fit in the free device memory
+ */
+int compute_num_join_partitions(table_view const& left, table_view const& right) {
+  auto const free_memory = cudf::detail::available_device_memory();
+  auto const working_set = join_working_set(left, right);
+
+  // Leave room for the output and the partitioned copy of the tables
+  size_t const partition_size = std::max<size_t>(free_memory / 4, 1);
+  size_t const num_partitions = (working_set + partition_size - 1) / partition_size;
+  return static_cast<int>(std::min<size_t>(std::max<size_t>(num_partitions, 1), 1024));
+}
+
+/**
+ * @brief  Returns the number of partitions of a join whose output of
+ * `output_size` bytes does not fit in the memory budget
+ */
+int compute_num_join_output_partitions(size_t output_size) {
+  auto const available      = std::max<size_t>(cudf::detail::available_device_memory(), 1);
+  auto const num_partitions = (output_size + available - 1) / available;
+  return static_cast<int>(std::min<size_t>(std::max<size_t>(num_partitions, 2), 1024));
+}
+
+/**
+ * @brief  Returns an upper bound of the number of rows of the join of
+ * `left_columns` and `right_columns`, without allocating the output
+ */
+template <join_kind JoinKind>
+size_t join_output_rows_bound(table_view const& left_columns,
+                              table_view const& right_columns,
+                              cudaStream_t stream) {
+  constexpr join_kind BaseJoinKind =
+    (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  // The number of matches does not depend on the algorithm, so they are always counted by hashing
+  size_t rows = get_base_hash_join_size<BaseJoinKind>(left_columns, right_columns, stream);
+  // Full joins add the right rows without a match, at most all of them
+  if (JoinKind == join_kind::FULL_JOIN) { rows += right_columns.num_rows(); }
+  return rows;
+}
+
+// Partitioning again hashes with a new seed, so that the rows of a partition are split
+constexpr uint32_t max_join_partition_seed{8};
+
+template <join_kind JoinKind>
+std::unique_ptr<experimental::table> partitioned_join_call_compute_df(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  int num_partitions,
+  uint32_t seed,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream);
+
+/**
+ * @brief  Finds the matching rows of `left_columns` and `right_columns`, the
+ * join columns of `left` and `right`, and gathers the joined table
+ *
+ * When a memory budget is installed, the output is counted before the join
+ * indices are allocated. If it does not fit in the budget after spilling,
+ * inner and left joins are computed for halves of the left rows, and full
+ * joins are partitioned again.
+ *
+ * @throws cudf::logic_error if the output of a single left row, or of a full
+ * join partition that can not be split further, does not fit in the memory
+ * budget
+ *
+ * @param left_on The columns of `left` that `left_columns` are selected from
+ * @param right_on The columns of `right` that `right_columns` are selected from
+ * @param can_partition Whether the rows can be hash partitioned on `left_on`
+ * and `right_on`, i.e., `left_columns` and `right_columns` are comparable
+ * without matching their dictionary keys
+ * @param partition_seed The hash seed `left` and `right` were partitioned with
+ */
+template <join_kind JoinKind>
+std::unique_ptr<experimental::table> compute_joined_table(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  table_view const& left_columns,
+  table_view const& right_columns,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  bool can_partition,
+  uint32_t partition_seed,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  // Without a budget every output fits, and the output is sized while computing the join indices
+  if (get_memory_budget() != nullptr) {
+    validate_base_join_columns(left_columns, right_columns);
+    auto const output_rows = join_output_rows_bound<JoinKind>(left_columns, right_columns, stream);
+    auto const output_size =
+      output_rows * (2 * sizeof(size_type) + table_row_size(left) + table_row_size(right));
+    if (not cudf::detail::fits_memory_budget(output_size)) {
+      if ((JoinKind != join_kind::FULL_JOIN) && (left.num_rows() > 1)) {
+        // The joins of parts of the left rows are parts of the output
+        auto const half = left.num_rows() / 2;
+        std::vector<size_type> const splits{0, half, half, left.num_rows()};
+        auto const left_parts        = experimental::slice(left, splits);
+        auto const left_column_parts = experimental::slice(left_columns, splits);
+        std::vector<std::unique_ptr<experimental::table>> results;
+        for (size_t i = 0; i < left_parts.size(); ++i) {
+          results.push_back(compute_joined_table<JoinKind>(left_parts[i],
+                                                           right,
+                                                           left_on,
+                                                           right_on,
+                                                           left_column_parts[i],
+                                                           right_columns,
+                                                           columns_in_common,
+                                                           algorithm,
+                                                           can_partition,
+                                                           partition_seed,
+                                                           mr,
+                                                           stream));
+        }
+        return experimental::detail::concatenate(
+          {results[0]->view(), results[1]->view()}, mr, stream);
+      }
+      // The unmatched right rows of a full join depend on all the left rows, so
+      // full joins are split by partitioning both tables instead
+      CUDF_EXPECTS((JoinKind == join_kind::FULL_JOIN) && can_partition &&
+                     (partition_seed < max_join_partition_seed),
+                   "Join output exceeds the memory budget");
+      return partitioned_join_call_compute_df<JoinKind>(
+        left,
+        right,
+        left_on,
+        right_on,
+        columns_in_common,
+        compute_num_join_output_partitions(output_size),
+        partition_seed + 1,
+        mr,
+        stream);
+    }
+  }
+
+  auto joined_indices =
+    get_base_join_indices<JoinKind>(left_columns, right_columns, algorithm, stream);
+  return construct_join_output_df<JoinKind>(
+    left, right, joined_indices, columns_in_common, mr, stream);
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  Performs join on the columns provided in `left` and `right` as per
@@ -379,6 +781,7 @@ std::unique_ptr<experimental::table> construct_join_output_df(
  * full join.
  * Else, for every column in `left_on` and `right_on`, an output column will
  * be produced.
+ * @param algorithm Algorithm used to find the matching rows
  * @param mr The memory resource that will be used for allocating
  * the device memory for the new table
  * @param stream Optional, stream on which all memory allocations and copies
@@ -398,6 +801,7 @@ std::unique_ptr<experimental::table> join_call_compute_df(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_algorithm algorithm,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0) {
   CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
@@ -405,43 +809,418 @@ std::unique_ptr<experimental::table> join_call_compute_df(
   CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
   CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
 
-  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
-
-  CUDF_EXPECTS(std::all_of(columns_in_common.begin(),
-                           columns_in_common.end(),
-                           [&left_on, &right_on](auto p) {
-                             size_t lind =
-                               std::find(left_on.begin(), left_on.end(), p.first) - left_on.begin();
-                             size_t rind = std::find(right_on.begin(), right_on.end(), p.second) -
-                                           right_on.begin();
-                             return (lind != left_on.size()) && (rind != right_on.size()) &&
-                                    (lind == rind);
-                           }),
-               "Invalid values passed to columns_in_common");
+  validate_join_columns(left_on, right_on, columns_in_common);
 
   if (is_trivial_join(left, right, left_on, right_on, JoinKind)) {
     return get_empty_joined_table(left, right, columns_in_common);
   }
 
-  auto joined_indices =
-    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), stream);
+  auto const join_columns =
+    match_dictionary_keys(left.select(left_on), right.select(right_on), stream);
 
-  return construct_join_output_df<JoinKind>(
-    left, right, joined_indices, columns_in_common, mr, stream);
+  // the partitions of dictionary columns with different keys are not comparable
+  bool const can_partition = join_columns.ordinals.empty();
+  // degrade to keeping the partitions in host memory when a hash join does not fit in the
+  // memory budget
+  if ((algorithm == join_algorithm::HASH) && can_partition &&
+      !cudf::detail::fits_memory_budget(join_working_set(left, right))) {
+    algorithm = join_algorithm::PARTITIONED_HASH;
+  }
+  if ((algorithm == join_algorithm::PARTITIONED_HASH) && can_partition) {
+    auto const num_partitions = compute_num_join_partitions(left, right);
+    if (num_partitions > 1) {
+      return partitioned_join_call_compute_df<JoinKind>(
+        left, right, left_on, right_on, columns_in_common, num_partitions, 0, mr, stream);
+    }
+  }
+
+  return compute_joined_table<JoinKind>(left,
+                                        right,
+                                        left_on,
+                                        right_on,
+                                        join_columns.left,
+                                        join_columns.right,
+                                        columns_in_common,
+                                        algorithm,
+                                        can_partition,
+                                        0,
+                                        mr,
+                                        stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Performs a grace hash join: both tables are hash partitioned on
+ * the join columns and the partitions are kept in pinned host memory, then
+ * each pair of partitions with the same index is copied back and joined on
+ * its own.
+ *
+ * Rows with equal join columns land in partitions with the same index, so
+ * the joins of the partition pairs together form the join of the tables.
+ *
+ * @param num_partitions The number of partitions of each table
+ * @param seed The seed of the hash the rows are partitioned with
+ *
+ * @copydetails join_call_compute_df
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::unique_ptr<experimental::table> partitioned_join_call_compute_df(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  int num_partitions,
+  uint32_t seed,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  auto spill_partitions = [num_partitions, seed, stream](table_view const& t,
+                                                         std::vector<size_type> const& on) {
+    auto const partitioned =
+      experimental::hash_partition(t, on, num_partitions, hash_id::HASH_MURMUR3, seed);
+    auto const& offsets    = partitioned.second;
+    std::vector<spilled_table> partitions;
+    for (int p = 0; p < num_partitions; ++p) {
+      auto const end = (p + 1 < num_partitions) ? offsets[p + 1] : partitioned.first->num_rows();
+      auto const partition = experimental::slice(partitioned.first->view(), {offsets[p], end});
+      partitions.push_back(spill_to_host(partition.front(), stream));
+    }
+    return partitions;
+  };
+  // Only one of the partitioned tables is in device memory at a time
+  auto const right_partitions = spill_partitions(right, right_on);
+  auto const left_partitions  = spill_partitions(left, left_on);
+
+  std::vector<std::unique_ptr<experimental::table>> results;
+  for (int p = 0; p < num_partitions; ++p) {
+    auto const right_partition = restore_to_device(right_partitions[p], stream);
+    auto const left_partition  = restore_to_device(left_partitions[p], stream);
+    auto const& l              = left_partition.second;
+    auto const& r              = right_partition.second;
+    // the partitions whose output exceeds the memory budget are split again
+    results.push_back(is_trivial_join(l, r, left_on, right_on, JoinKind)
+                        ? get_empty_joined_table(l, r, columns_in_common)
+                        : compute_joined_table<JoinKind>(l,
+                                                         r,
+                                                         left_on,
+                                                         right_on,
+                                                         l.select(left_on),
+                                                         r.select(right_on),
+                                                         columns_in_common,
+                                                         join_algorithm::HASH,
+                                                         true,
+                                                         seed,
+                                                         mr,
+                                                         stream));
+  }
+
+  std::vector<table_view> result_views;
+  for (auto const& result : results) { result_views.push_back(result->view()); }
+  return experimental::detail::concatenate(result_views, mr, stream);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Creates an INT32 column from join output indices, with nulls for
+ * the rows without a match if `nullable` is set.
+ *
+ * @param indices Join output indices of one of the tables
+ * @param nullable Whether `indices` may contain JoinNoneValue entries
+ * @param mr The memory resource that will be used for allocating
+ * the device memory for the new column
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Column of the indices
+ */
+/* ----------------------------------------------------------------------------*/
+std::unique_ptr<column> make_join_indices_column(rmm::device_vector<size_type> const& indices,
+                                                 bool nullable,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream) {
+  auto const size = static_cast<size_type>(indices.size());
+  rmm::device_buffer data(indices.data().get(), size * sizeof(size_type), stream, mr);
+  if (not nullable) { return std::make_unique<column>(data_type{INT32}, size, std::move(data)); }
+  auto null_mask = experimental::detail::valid_if(
+    indices.begin(),
+    indices.end(),
+    [] __device__(size_type index) { return index != JoinNoneValue; },
+    stream,
+    mr,
+    experimental::detail::null_count_policy::DEFER);
+  return std::make_unique<column>(
+    data_type{INT32}, size, std::move(data), std::move(null_mask.first), null_mask.second);
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of the join of the columns provided in
+ * `left` and `right` as per the joining indices given in `left_on` and
+ * `right_on`, without gathering the rows.
+ *
+ * @throws cudf::logic_error
+ * If number of elements in `left_on` or `right_on` mismatch.
+ * If number of columns in either `left` or `right` table is 0 or exceeds
+ * MAX_JOIN_SIZE
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column's indices from `left` to join on.
+ * @param right_on The column's indices from `right` to join on.
+ * @param mr The memory resource that will be used for allocating
+ * the device memory for the new columns
+ * @param stream Optional, stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Columns of the row indices of `left` and `right`; rows without a
+ * match in the other table are null.
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> join_call_compute_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0) {
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+  validate_join_columns(left_on, right_on, {});
+
+  VectorPair joined_indices;
+  if (not is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    joined_indices = get_base_join_indices<JoinKind>(
+      left.select(left_on), right.select(right_on), join_algorithm::HASH, stream);
+    if (join_kind::FULL_JOIN == JoinKind) {
+      auto complement_indices = get_left_join_indices_complement(
+        joined_indices.second, left.num_rows(), right.num_rows(), stream);
+      joined_indices = concatenate_vector_pairs(complement_indices, joined_indices, stream);
+    }
+  }
+
+  return std::make_pair(
+    make_join_indices_column(joined_indices.first, JoinKind == join_kind::FULL_JOIN, mr, stream),
+    make_join_indices_column(joined_indices.second, JoinKind != join_kind::INNER_JOIN, mr, stream));
 }
 
 }  // namespace detail
 
+/**
+ * @brief Holds the build table and its hash table for `hash_join`
+ **/
+class hash_join::impl {
+ public:
+  impl(table_view const& build,
+       std::vector<size_type> const& build_on,
+       join_size_mode size_mode,
+       hash_value_type const* build_hashes = nullptr,
+       cudaStream_t stream                 = 0)
+    : _build(build),
+      _build_on(build_on),
+      _size_mode(size_mode),
+      _build_selected(build.select(build_on)),
+      _build_flattened(structs::detail::flatten_nested_columns(_build_selected, {}, {}, stream)),
+      _build_table(table_device_view::create(_build_flattened.flattened_columns, stream)),
+      _filter(detail::make_join_bloom_filter(build.num_rows(), stream)),
+      _hash_table((build_hashes == nullptr)
+                    ? detail::build_join_hash_table(*_build_table, _filter.view(), stream)
+                    : detail::build_join_hash_table(*_build_table,
+                                                    detail::precomputed_row_hash{build_hashes},
+                                                    _filter.view(),
+                                                    stream)) {}
+
+  /**
+   * @brief  Joins `probe` with the build table; see `detail::join_call_compute_df`
+   *
+   * The probe rows are hashed unless `probe_hashes` is given.
+   **/
+  template <detail::join_kind JoinKind>
+  std::unique_ptr<experimental::table> compute_join(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+    rmm::mr::device_memory_resource* mr,
+    hash_value_type const* probe_hashes = nullptr,
+    cudaStream_t stream                 = 0) const {
+    CUDF_EXPECTS(0 != probe.num_columns(), "Left table is empty");
+    CUDF_EXPECTS(probe.num_rows() < detail::MAX_JOIN_SIZE, "Left column size is too big");
+    detail::validate_join_columns(probe_on, _build_on, columns_in_common);
+
+    if (detail::is_trivial_join(probe, _build, probe_on, _build_on, JoinKind)) {
+      return detail::get_empty_joined_table(probe, _build, columns_in_common);
+    }
+
+    auto const probe_selected = probe.select(probe_on);
+    CUDF_EXPECTS(std::equal(std::cbegin(probe_selected),
+                            std::cend(probe_selected),
+                            std::cbegin(_build_selected),
+                            std::cend(_build_selected),
+                            [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+                 "Mismatch in joining column data types");
+
+    // The full join is computed from the left join indices, as in `get_base_join_indices`
+    constexpr detail::join_kind BaseJoinKind =
+      (JoinKind == detail::join_kind::FULL_JOIN) ? detail::join_kind::LEFT_JOIN : JoinKind;
+    detail::VectorPair joined_indices;
+    if ((BaseJoinKind == detail::join_kind::LEFT_JOIN) && (_build.num_rows() == 0)) {
+      joined_indices = detail::get_trivial_left_join_indices(probe_selected, stream);
+    } else {
+      auto const probe_flattened =
+        structs::detail::flatten_nested_columns(probe_selected, {}, {}, stream);
+      auto probe_table = table_device_view::create(probe_flattened.flattened_columns, stream);
+      if (probe_hashes == nullptr) {
+        joined_indices = detail::probe_join_hash_table<BaseJoinKind>(*_build_table,
+                                                                     *probe_table,
+                                                                     *_hash_table,
+                                                                     _filter.view(),
+                                                                     false,
+                                                                     _size_mode,
+                                                                     stream);
+      } else {
+        joined_indices =
+          detail::probe_join_hash_table<BaseJoinKind>(*_build_table,
+                                                      *probe_table,
+                                                      detail::precomputed_row_hash{probe_hashes},
+                                                      *_hash_table,
+                                                      _filter.view(),
+                                                      false,
+                                                      _size_mode,
+                                                      stream);
+      }
+    }
+
+    return detail::construct_join_output_df<JoinKind>(
+      probe, _build, joined_indices, columns_in_common, mr, stream);
+  }
+
+ private:
+  table_view _build;
+  std::vector<size_type> _build_on;
+  join_size_mode _size_mode;
+  table_view _build_selected;
+  structs::detail::flattened_table _build_flattened;
+  decltype(table_device_view::create(std::declval<table_view>())) _build_table;
+  bloom_filter _filter;
+  std::unique_ptr<detail::multimap_type, std::function<void(detail::multimap_type*)>> _hash_table;
+};
+
+hash_join::hash_join(table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     join_size_mode size_mode) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(build.num_rows() < detail::MAX_JOIN_SIZE, "Right column size is too big");
+  _impl = std::make_unique<const impl>(build, build_on, size_mode);
+}
+
+hash_join::hash_join(table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     column_view const& build_hashes,
+                     join_size_mode size_mode) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(build.num_rows() < detail::MAX_JOIN_SIZE, "Right column size is too big");
+  detail::validate_row_hashes(build_hashes, build.num_rows());
+  _impl = std::make_unique<const impl>(
+    build, build_on, size_mode, build_hashes.data<hash_value_type>());
+}
+
+hash_join::~hash_join() = default;
+
+std::unique_ptr<experimental::table> hash_join::inner_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::INNER_JOIN>(probe, probe_on, columns_in_common, mr);
+}
+
+std::unique_ptr<experimental::table> hash_join::inner_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  column_view const& probe_hashes,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  detail::validate_row_hashes(probe_hashes, probe.num_rows());
+  return _impl->compute_join<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, columns_in_common, mr, probe_hashes.data<hash_value_type>());
+}
+
+std::unique_ptr<experimental::table> hash_join::left_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::LEFT_JOIN>(probe, probe_on, columns_in_common, mr);
+}
+
+std::unique_ptr<experimental::table> hash_join::left_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  column_view const& probe_hashes,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  detail::validate_row_hashes(probe_hashes, probe.num_rows());
+  return _impl->compute_join<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, columns_in_common, mr, probe_hashes.data<hash_value_type>());
+}
+
+std::unique_ptr<experimental::table> hash_join::full_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  return _impl->compute_join<detail::join_kind::FULL_JOIN>(probe, probe_on, columns_in_common, mr);
+}
+
+std::unique_ptr<experimental::table> hash_join::full_join(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  column_view const& probe_hashes,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  detail::validate_row_hashes(probe_hashes, probe.num_rows());
+  return _impl->compute_join<detail::join_kind::FULL_JOIN>(
+    probe, probe_on, columns_in_common, mr, probe_hashes.data<hash_value_type>());
+}
+
 std::unique_ptr<experimental::table> inner_join(
   table_view const& left,
   table_view const& right,
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr) {
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::INNER_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, join_algorithm::HASH, mr, stream);
+}
+
+std::unique_ptr<experimental::table> inner_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::INNER_JOIN>(
+    left, right, left_on, right_on, columns_in_common, algorithm, mr, stream);
 }
 
 std::unique_ptr<experimental::table> left_join(
@@ -450,10 +1229,25 @@ std::unique_ptr<experimental::table> left_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr) {
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
+    left, right, left_on, right_on, columns_in_common, join_algorithm::HASH, mr, stream);
+}
+
+std::unique_ptr<experimental::table> left_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, algorithm, mr, stream);
 }
 
 std::unique_ptr<experimental::table> full_join(
@@ -462,10 +1256,58 @@ std::unique_ptr<experimental::table> full_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
-  rmm::mr::device_memory_resource* mr) {
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::FULL_JOIN>(
+    left, right, left_on, right_on, columns_in_common, join_algorithm::HASH, mr, stream);
+}
+
+std::unique_ptr<experimental::table> full_join(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_algorithm algorithm,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::experimental::detail::join_kind::FULL_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, algorithm, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::experimental::detail::join_kind::INNER_JOIN>(
+    left, right, left_on, right_on, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::experimental::detail::join_kind::LEFT_JOIN>(
+    left, right, left_on, right_on, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::join_call_compute_indices<::cudf::experimental::detail::join_kind::FULL_JOIN>(
+    left, right, left_on, right_on, mr);
 }
 
 }  //namespace experimental
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/join.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
@@ -38,6 +39,9 @@ constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
 constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
 constexpr size_type JoinNoneValue     = -1;
 
+// Build tables smaller than this are probed without a Bloom filter
+constexpr size_type BLOOM_FILTER_MIN_BUILD_ROWS = 1 << 16;
+
 using VectorPair = std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>;
 
 using multimap_type =
@@ -54,6 +58,15 @@ using row_hash = cudf::experimental::row_hasher<default_hash>;
 
 using row_equality = cudf::experimental::row_equality_comparator<true>;
 
+/**
+ * @brief  Row hasher returning hash values computed beforehand, such as those
+ * returned by `hash_partition_with_hashes`, instead of hashing the row
+ */
+struct precomputed_row_hash {
+  hash_value_type const* hashes;
+  __device__ hash_value_type operator()(size_type row_index) const { return hashes[row_index]; }
+};
+
 enum class join_kind { INNER_JOIN, LEFT_JOIN, FULL_JOIN, LEFT_SEMI_JOIN, LEFT_ANTI_JOIN };
 
 inline bool is_trivial_join(table_view const& left,
@@ -79,6 +92,33 @@ inline bool is_trivial_join(table_view const& left,
   return false;
 }
 
+/**
+ * @brief  The join columns of two tables, where each pair of dictionary
+ * columns with different keys is replaced with the ordinals of their values
+ * in the keys of the left column, so that their rows compare like their values.
+ */
+struct matched_join_columns {
+  table_view left;                                ///< The left join columns
+  table_view right;                               ///< The right join columns
+  std::vector<std::unique_ptr<column>> ordinals;  ///< The replacement columns
+};
+
+/**
+ * @brief  Returns the join columns of `left` and `right` with the pairs of
+ * dictionary columns with different keys replaced by comparable columns.
+ *
+ * The dictionary columns sharing the same keys, like those of the same
+ * dictionary, are left as they are: their indices already compare like their values.
+ *
+ * @param left The left join columns
+ * @param right The right join columns
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ */
+matched_join_columns match_dictionary_keys(table_view const& left,
+                                           table_view const& right,
+                                           cudaStream_t stream);
+
 }  //namespace detail
 
 }  //namespace experimental
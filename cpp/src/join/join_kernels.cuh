@@ -19,6 +19,7 @@
 #include <cub/cub.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <hash/bloom_filter.cuh>
 
 #include "join_common_utils.hpp"
 
@@ -62,14 +63,17 @@ __inline__ __device__ void add_pair_to_cache(const size_type first,
 *
 * @param[in,out] multi_map The hash table to be built to insert rows into
 * @param[in] hash_build Row hasher for the build table
+* @param[in,out] filter Bloom filter the row hash values are also inserted into
 * @param[in] build_table_num_rows The number of rows in the build table
 * @tparam multimap_type The type of the hash table
+* @tparam row_hasher_t The type of the row hasher
 *
 */
 /* ----------------------------------------------------------------------------*/
-template <typename multimap_type>
+template <typename multimap_type, typename row_hasher_t = row_hash>
 __global__ void build_hash_table(multimap_type multi_map,
-                                 row_hash hash_build,
+                                 row_hasher_t hash_build,
+                                 bloom_filter_view filter,
                                  const cudf::size_type build_table_num_rows,
                                  int* error) {
   cudf::size_type i = threadIdx.x + blockIdx.x * blockDim.x;
@@ -77,6 +81,7 @@ __global__ void build_hash_table(multimap_type multi_map,
   while (i < build_table_num_rows) {
     // Compute the hash value of this row
     const hash_value_type row_hash_value{hash_build(i)};
+    filter.insert(row_hash_value);
 
     // Insert the (row hash value, row index) into the map
     // using the row hash value to determine the location in the
@@ -98,19 +103,26 @@ __global__ void build_hash_table(multimap_type multi_map,
 * @param[in] multi_map The hash table built on the build table
 * @param[in] build_table The build table
 * @param[in] probe_table The probe table
+* @param[in] filter Bloom filter of the build row hash values; probe rows it
+  rejects are not looked up in the hash table
 * @param[in] probe_table_num_rows The number of rows in the probe table
 * @param[out] output_size The resulting output size
   @tparam JoinKind The type of join to be performed
   @tparam multimap_type The datatype of the hash table
+  @tparam row_hasher_t The type of the probe row hasher
 *
 */
 /* ----------------------------------------------------------------------------*/
-template <join_kind JoinKind, typename multimap_type, int block_size>
+template <join_kind JoinKind,
+          typename multimap_type,
+          int block_size,
+          typename row_hasher_t = row_hash>
 __global__ void compute_join_output_size(multimap_type multi_map,
                                          table_device_view build_table,
                                          table_device_view probe_table,
-                                         row_hash hash_probe,
+                                         row_hasher_t hash_probe,
                                          row_equality check_row_equality,
+                                         bloom_filter_view filter,
                                          const cudf::size_type probe_table_num_rows,
                                          size_type* output_size) {
   // This kernel probes multiple elements in the probe_table and store the number of matches found inside a register.
@@ -134,7 +146,9 @@ __global__ void compute_join_output_size(multimap_type multi_map,
     hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
-    found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    if (filter.might_contain(probe_row_hash_value)) {
+      found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    }
 
     // for left-joins we always need to add an output
     bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
@@ -223,6 +237,8 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * @param[in] multi_map The hash table built from the build table
  * @param[in] build_table The build table
  * @param[in] probe_table The probe table
+ * @param[in] filter Bloom filter of the build row hash values; probe rows it
+ rejects are not looked up in the hash table
  * @param[in] probe_table_num_rows The length of the columns in the probe table
  * @param[out] join_output_l The left result of the join operation
  * @param[out] join_output_r The right result of the join operation
@@ -233,6 +249,7 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * @tparam multimap_type The type of the hash table
  * @tparam block_size The number of threads per block for this kernel
  * @tparam output_cache_size The side of the shared memory buffer to cache join output results
+ * @tparam row_hasher_t The type of the probe row hasher
  *
  */
 /* ----------------------------------------------------------------------------*/
@@ -240,12 +257,14 @@ template <join_kind JoinKind,
           typename multimap_type,
           typename key_type,
           cudf::size_type block_size,
-          cudf::size_type output_cache_size>
+          cudf::size_type output_cache_size,
+          typename row_hasher_t = row_hash>
 __global__ void probe_hash_table(multimap_type multi_map,
                                  table_device_view build_table,
                                  table_device_view probe_table,
-                                 row_hash hash_probe,
+                                 row_hasher_t hash_probe,
                                  row_equality check_row_equality,
+                                 bloom_filter_view filter,
                                  const cudf::size_type probe_table_num_rows,
                                  size_type* join_output_l,
                                  size_type* join_output_r,
@@ -286,7 +305,9 @@ __global__ void probe_hash_table(multimap_type multi_map,
     hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
-    found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    if (filter.might_contain(probe_row_hash_value)) {
+      found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    }
 
     bool running = (JoinKind == join_kind::LEFT_JOIN) ||
                    (end != found);  // for left-joins we always need to add an output
@@ -6,19 +6,137 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <hash/cooperative_unordered_set.cuh>
 
 #include <join/join_common_utils.hpp>
 
 #include <cudf/detail/gather.cuh>
 #include <join/hash_join.cuh>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 
 namespace experimental {
 
 namespace detail {
 
+/**
+ * @brief  Computes the indices of the rows of `left` that exist (semi join) or
+ * do not exist (anti join) in `right`
+ *
+ * The rows of `right` are inserted into a hash set of row indices, and the
+ * row hashes into a Bloom filter when `right` is large enough for the filter
+ * to save hash table probes; every row of `left` is then looked up in the
+ * filter and the set.
+ *
+ * @throws cudf::logic_error if number of columns in either `left` or `right` table is 0
+ * @throws cudf::logic_error if number of elements in `right_on` and `left_on` are not equal
+ *
+ * @param[in] left             The left table
+ * @param[in] right            The right table
+ * @param[in] left_on          The column indices from `left` to join on.
+ * @param[in] right_on         The column indices from `right` to join on.
+ * @param[in] mr               Device memory resource to use for the returned column
+ * @param[in] stream           Cuda stream
+ * @tparam    join_kind        Indicates whether to do LEFT_SEMI_JOIN or LEFT_ANTI_JOIN
+ *
+ * @returns                    INT32 column of the indices of the selected rows of `left`,
+ *                             in ascending order
+ */
+template <join_kind JoinKind>
+std::unique_ptr<column> left_semi_anti_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  if (is_trivial_join(left, right, left_on, right_on, JoinKind)) {
+    return make_empty_column(data_type{INT32});
+  }
+
+  auto const all_rows = thrust::make_counting_iterator<size_type>(0);
+
+  if ((join_kind::LEFT_ANTI_JOIN == JoinKind) && (0 == right.num_rows())) {
+    // Every row of the left table is selected
+    auto indices = make_numeric_column(
+      data_type{INT32}, left.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 all_rows,
+                 all_rows + left.num_rows(),
+                 indices->mutable_view().begin<size_type>());
+    return indices;
+  }
+
+  // Only care about existence, so the hash table only holds the indices of the right rows. The
+  // cooperative set probes a whole bucket per step, which keeps builds fast at high occupancy
+  using hash_set_type =
+    cooperative_unordered_set<cudf::size_type, row_hash, row_equality, default_allocator<size_type>>;
+
+  // Dictionary columns with different keys are compared by the ordinals of their values
+  auto const join_columns =
+    match_dictionary_keys(left.select(left_on), right.select(right_on), stream);
+
+  // Create hash set containing all keys found in right table
+  auto right_rows_d            = table_device_view::create(join_columns.right, stream);
+  size_t const hash_table_size = compute_hash_table_size(right.num_rows());
+  row_hash hash_build{*right_rows_d};
+  row_equality equality_build{*right_rows_d, *right_rows_d};
+
+  // Going to join it with left table
+  auto left_rows_d = table_device_view::create(join_columns.left, stream);
+  row_hash hash_probe{*left_rows_d};
+  row_equality equality_probe{*left_rows_d, *right_rows_d};
+
+  auto hash_set = hash_set_type::create(hash_table_size,
+                                        std::numeric_limits<cudf::size_type>::max(),
+                                        hash_build,
+                                        equality_build,
+                                        hash_set_type::allocator_type{},
+                                        stream);
+
+  // Rows of the left table rejected by the filter are not looked up in the hash set
+  auto filter = make_join_bloom_filter(right.num_rows(), stream);
+  hash_set->insert(all_rows, all_rows + right.num_rows(), filter.view(), stream);
+
+  //
+  // Now we have a hash set, we need to iterate over the rows of the left table
+  // and check to see if they are contained in the hash set
+  //
+
+  rmm::device_vector<bool> contained(left.num_rows());
+  hash_set->contains(all_rows,
+                     all_rows + left.num_rows(),
+                     contained.data().get(),
+                     hash_probe,
+                     equality_probe,
+                     filter.view(),
+                     stream);
+
+  // For semi join we want contains to be true, for anti join we want contains to be false
+  bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
+
+  auto const num_selected = static_cast<size_type>(thrust::count(
+    rmm::exec_policy(stream)->on(stream), contained.begin(), contained.end(), join_type_boolean));
+
+  auto indices = make_numeric_column(
+    data_type{INT32}, num_selected, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  all_rows,
+                  all_rows + left.num_rows(),
+                  contained.begin(),
+                  indices->mutable_view().begin<size_type>(),
+                  [join_type_boolean] __device__(bool c) { return c == join_type_boolean; });
+  return indices;
+}
+
 /** 
    * @brief  Performs a left semi or anti join on the specified columns of two 
    * tables (left, right)
@@ -27,9 +145,8 @@ namespace detail {
    * returns rows that exist in the right table, a left anti join returns rows
    * that do not exist in the right table.
    *
-   * The basic approach is to create a hash table containing the contents of the right
-   * table and then select only rows that exist (or don't exist) to be included in
-   * the return set.
+   * The rows to return are selected by `left_semi_anti_join_indices` and gathered
+   * from the `return_columns` of the left table.
    *
    * @throws cudf::logic_error if number of columns in either `left` or `right` table is 0
    * @throws cudf::logic_error if number of returned columns is 0
@@ -79,57 +196,15 @@ std::unique_ptr<cudf::experimental::table> left_semi_anti_join(
     return std::make_unique<experimental::table>(left.select(return_columns), stream, mr);
   }
 
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
-
-  // Create hash table containing all keys found in right table
-  auto right_rows_d            = table_device_view::create(right.select(right_on), stream);
-  size_t const hash_table_size = compute_hash_table_size(right.num_rows());
-  row_hash hash_build{*right_rows_d};
-  row_equality equality_build{*right_rows_d, *right_rows_d};
+  auto const gather_map = left_semi_anti_join_indices<JoinKind>(
+    left, right, left_on, right_on, rmm::mr::get_default_resource(), stream);
 
-  // Going to join it with left table
-  auto left_rows_d = table_device_view::create(left.select(left_on), stream);
-  row_hash hash_probe{*left_rows_d};
-  row_equality equality_probe{*left_rows_d, *right_rows_d};
-
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table     = *hash_table_ptr;
-
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     right.num_rows(),
-                     [hash_table] __device__(size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
-                     });
-
-  //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
-  //
-
-  // For semi join we want contains to be true, for anti join we want contains to be false
-  bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
-
-  rmm::device_vector<size_type> gather_map(left.num_rows());
-
-  // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(left.num_rows()),
-    gather_map.begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
-      auto pos = hash_table.find(idx, hash_probe, equality_probe);
-      return (pos != hash_table.end()) == join_type_boolean;
-    });
-
-  return cudf::experimental::detail::gather(
-    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr);
+  return cudf::experimental::detail::gather(left.select(return_columns),
+                                            gather_map->view().begin<size_type>(),
+                                            gather_map->view().end<size_type>(),
+                                            false,
+                                            mr,
+                                            stream);
 }
 }  // namespace detail
 
@@ -157,6 +232,26 @@ std::unique_ptr<cudf::experimental::table> left_anti_join(
     left, right, left_on, right_on, return_columns, mr, 0);
 }
 
+std::unique_ptr<cudf::column> left_semi_join_indices(cudf::table_view const& left,
+                                                     cudf::table_view const& right,
+                                                     std::vector<cudf::size_type> const& left_on,
+                                                     std::vector<cudf::size_type> const& right_on,
+                                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join_indices<detail::join_kind::LEFT_SEMI_JOIN>(
+    left, right, left_on, right_on, mr, 0);
+}
+
+std::unique_ptr<cudf::column> left_anti_join_indices(cudf::table_view const& left,
+                                                     cudf::table_view const& right,
+                                                     std::vector<cudf::size_type> const& left_on,
+                                                     std::vector<cudf::size_type> const& right_on,
+                                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join_indices<detail::join_kind::LEFT_ANTI_JOIN>(
+    left, right, left_on, right_on, mr, 0);
+}
+
 }  // namespace experimental
 
 }  // namespace cudf
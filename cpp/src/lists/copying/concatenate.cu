@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+
+std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream) {
+  auto execpol = rmm::exec_policy(stream);
+
+  // the range of child elements of each column
+  std::vector<column_view> children;
+  std::vector<std::pair<size_type, size_type>> ranges;
+  size_type rows_count = 0;
+  size_type null_count = 0;
+  for (auto const& view : columns) {
+    rows_count += view.size();
+    null_count += view.null_count();
+    if (view.is_empty()) {
+      ranges.emplace_back(0, 0);
+      continue;
+    }
+    lists_column_view lists(view);
+    auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+    size_type first = 0, last = 0;
+    CUDA_TRY(cudaMemcpyAsync(
+      &first, d_offsets, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaMemcpyAsync(
+      &last, d_offsets + lists.size(), sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+    CUDF_STREAM_SYNC(stream);
+    ranges.emplace_back(first, last);
+    children.push_back(experimental::slice(lists.child(), {first, last}).front());
+  }
+  if (rows_count == 0) return make_empty_column(data_type{LIST});
+
+  // each column's offsets are shifted to the position of its elements in the output child
+  auto offsets_column = make_numeric_column(
+    data_type{INT32}, rows_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_out_offsets = offsets_column->mutable_view().data<size_type>();
+  size_type row      = 0;
+  size_type shift    = 0;
+  for (size_t idx = 0; idx < columns.size(); ++idx) {
+    auto const& view = columns[idx];
+    if (view.is_empty()) continue;
+    auto const d_offsets = view.child(lists_column_view::offsets_column_index).data<size_type>() +
+                           view.offset();
+    auto const delta = shift - ranges[idx].first;
+    thrust::transform(execpol->on(stream),
+                      d_offsets,
+                      d_offsets + view.size(),
+                      d_out_offsets + row,
+                      [delta] __device__(size_type offset) { return offset + delta; });
+    row += view.size();
+    shift += ranges[idx].second - ranges[idx].first;
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    d_out_offsets + rows_count, &shift, sizeof(size_type), cudaMemcpyHostToDevice, stream));
+
+  auto child_column = cudf::detail::concatenate(children, mr, stream);
+
+  rmm::device_buffer null_mask{0, stream, mr};
+  if (null_count > 0) {
+    null_mask = create_null_mask(rows_count, mask_state::UNINITIALIZED, stream, mr);
+    cudf::detail::concatenate_masks(
+      columns, static_cast<bitmask_type*>(null_mask.data()), stream);
+  }
+
+  auto result = make_lists_column(rows_count,
+                                  std::move(offsets_column),
+                                  std::move(child_column),
+                                  null_count,
+                                  std::move(null_mask),
+                                  stream,
+                                  mr);
+  // the host values of the offsets copy must live until the copy completes
+  CUDF_STREAM_SYNC(stream);
+  return result;
+}
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
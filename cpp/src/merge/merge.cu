@@ -14,20 +14,33 @@
  * limitations under the License.
  */
 #include <rmm/thrust_rmm_allocator.h>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/string_prefix_key.cuh>
+#include <cudf/merge.hpp>
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/merge.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
-#include <queue>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
 namespace {  // anonym.
@@ -134,9 +147,99 @@ void materialize_bitmask(column_view const& left_col,
   CHECK_CUDA(stream);
 }
 
+/**
+ * @brief Computes the string prefix keys of column `col`, the leading key column of a merge
+ */
+rmm::device_vector<uint64_t> string_prefix_keys(column_view const& col,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                cudaStream_t stream) {
+  auto const d_col      = column_device_view::create(col, stream);
+  bool const descending = not column_order.empty() and column_order[0] == order::DESCENDING;
+  bool const nulls_before = null_precedence.empty() or null_precedence[0] == null_order::BEFORE;
+  rmm::device_vector<uint64_t> keys(col.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(col.size()),
+                    keys.begin(),
+                    experimental::detail::string_prefix_key_fn{*d_col, descending, nulls_before});
+  return keys;
+}
+
+/**
+ * @brief Orders tagged indices by the prefix keys of the leading strings key
+ * column, comparing the full rows with `comparator` only when the keys are equal
+ */
+template <typename Comparator>
+struct tagged_prefix_comparator {
+  uint64_t const* left_keys;
+  uint64_t const* right_keys;
+  Comparator comparator;
+
+  __device__ bool operator()(index_type lhs, index_type rhs) const {
+    auto const lhs_key = key(lhs);
+    auto const rhs_key = key(rhs);
+    if (lhs_key != rhs_key) { return lhs_key < rhs_key; }
+    return comparator(lhs, rhs);
+  }
+
+ private:
+  __device__ uint64_t key(index_type index) const {
+    auto const keys = thrust::get<0>(index) == side::LEFT ? left_keys : right_keys;
+    return keys[thrust::get<1>(index)];
+  }
+};
+
+/**
+ * @brief The equivalent of `tagged_prefix_comparator` for row indices
+ */
+template <typename Comparator>
+struct row_prefix_comparator {
+  uint64_t const* keys;
+  Comparator comparator;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const {
+    if (keys[lhs] != keys[rhs]) { return keys[lhs] < keys[rhs]; }
+    return comparator(lhs, rhs);
+  }
+};
+
+template <typename Comparator>
+void merge_tagged_indices(size_type left_size,
+                          size_type right_size,
+                          Comparator comparator,
+                          rmm::device_vector<index_type>& merged_indices,
+                          cudaStream_t stream) {
+  thrust::constant_iterator<side> left_side(side::LEFT);
+  thrust::constant_iterator<side> right_side(side::RIGHT);
+
+  auto left_indices  = thrust::make_counting_iterator(static_cast<size_type>(0));
+  auto right_indices = thrust::make_counting_iterator(static_cast<size_type>(0));
+
+  auto left_begin_zip_iterator =
+    thrust::make_zip_iterator(thrust::make_tuple(left_side, left_indices));
+  auto right_begin_zip_iterator =
+    thrust::make_zip_iterator(thrust::make_tuple(right_side, right_indices));
+
+  auto left_end_zip_iterator =
+    thrust::make_zip_iterator(thrust::make_tuple(left_side + left_size, left_indices + left_size));
+  auto right_end_zip_iterator = thrust::make_zip_iterator(
+    thrust::make_tuple(right_side + right_size, right_indices + right_size));
+
+  thrust::merge(rmm::exec_policy(stream)->on(stream),
+                left_begin_zip_iterator,
+                left_end_zip_iterator,
+                right_begin_zip_iterator,
+                right_end_zip_iterator,
+                merged_indices.begin(),
+                comparator);
+}
+
 /**
  * @brief Generates the row indices and source side (left or right) in accordance with the index columns.
  *
+ * If the leading index column is a strings column, the rows are ordered by the first 8 bytes of
+ * its strings, packed in a 64-bit key, and only rows with equal keys are compared in full.
  *
  * @tparam index_type Indicates the type to be used to collect index and side information;
  * @param[in] left_table The left table_view to be merged
@@ -157,57 +260,144 @@ rmm::device_vector<index_type> generate_merged_indices(
   cudaStream_t stream = nullptr) {
   const size_type left_size  = left_table.num_rows();
   const size_type right_size = right_table.num_rows();
-  const size_type total_size = left_size + right_size;
-
-  thrust::constant_iterator<side> left_side(side::LEFT);
-  thrust::constant_iterator<side> right_side(side::RIGHT);
-
-  auto left_indices  = thrust::make_counting_iterator(static_cast<size_type>(0));
-  auto right_indices = thrust::make_counting_iterator(static_cast<size_type>(0));
-
-  auto left_begin_zip_iterator =
-    thrust::make_zip_iterator(thrust::make_tuple(left_side, left_indices));
-  auto right_begin_zip_iterator =
-    thrust::make_zip_iterator(thrust::make_tuple(right_side, right_indices));
 
-  auto left_end_zip_iterator =
-    thrust::make_zip_iterator(thrust::make_tuple(left_side + left_size, left_indices + left_size));
-  auto right_end_zip_iterator = thrust::make_zip_iterator(
-    thrust::make_tuple(right_side + right_size, right_indices + right_size));
-
-  rmm::device_vector<index_type> merged_indices(total_size);
+  rmm::device_vector<index_type> merged_indices(left_size + right_size);
 
   auto lhs_device_view = table_device_view::create(left_table, stream);
   auto rhs_device_view = table_device_view::create(right_table, stream);
 
   rmm::device_vector<order> d_column_order(column_order);
-
-  auto exec_pol = rmm::exec_policy(stream);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+
+  auto merge_with = [&](auto comparator) {
+    if (left_table.column(0).type().id() == STRING) {
+      auto const left_keys =
+        string_prefix_keys(left_table.column(0), column_order, null_precedence, stream);
+      auto const right_keys =
+        string_prefix_keys(right_table.column(0), column_order, null_precedence, stream);
+      merge_tagged_indices(
+        left_size,
+        right_size,
+        tagged_prefix_comparator<decltype(comparator)>{
+          left_keys.data().get(), right_keys.data().get(), comparator},
+        merged_indices,
+        stream);
+    } else {
+      merge_tagged_indices(left_size, right_size, comparator, merged_indices, stream);
+    }
+  };
   if (nullable) {
-    rmm::device_vector<null_order> d_null_precedence(null_precedence);
-
-    auto ineq_op = experimental::detail::row_lexicographic_tagged_comparator<true>(
+    merge_with(experimental::detail::row_lexicographic_tagged_comparator<true>(
       *lhs_device_view,
       *rhs_device_view,
       d_column_order.data().get(),
-      d_null_precedence.data().get());
-    thrust::merge(exec_pol->on(stream),
-                  left_begin_zip_iterator,
-                  left_end_zip_iterator,
-                  right_begin_zip_iterator,
-                  right_end_zip_iterator,
-                  merged_indices.begin(),
-                  ineq_op);
+      d_null_precedence.data().get()));
+  } else {
+    merge_with(experimental::detail::row_lexicographic_tagged_comparator<false>(
+      *lhs_device_view, *rhs_device_view, d_column_order.data().get()));
+  }
+
+  CHECK_CUDA(stream);
+
+  return merged_indices;
+}
+
+/**
+ * @brief Writes each of the `num_rows` concatenated rows to its merged position in `output`
+ *
+ * @see generate_kway_merged_indices
+ */
+template <typename Comparator>
+void scatter_kway_merged_rows(size_type num_rows,
+                              size_type const* offsets,
+                              size_type num_tables,
+                              Comparator comparator,
+                              size_type* output,
+                              cudaStream_t stream) {
+  thrust::for_each(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [comparator, offsets, num_tables, output] __device__(size_type row) {
+      size_type const table =
+        thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row) - offsets - 1;
+      size_type position = row - offsets[table];
+      for (size_type other = 0; other < num_tables; ++other) {
+        if (other == table) { continue; }
+        size_type begin = offsets[other];
+        size_type end   = offsets[other + 1];
+        while (begin < end) {
+          size_type const mid = begin + (end - begin) / 2;
+          bool const before   = other < table ? not comparator(row, mid) : comparator(mid, row);
+          if (before) {
+            begin = mid + 1;
+          } else {
+            end = mid;
+          }
+        }
+        position += begin - offsets[other];
+      }
+      output[position] = row;
+    });
+}
+
+/**
+ * @brief Generates the gather map that merges the sorted tables concatenated in `keys`.
+ *
+ * Table `t` is made of the rows `[table_offsets[t], table_offsets[t + 1])` of `keys`. Every row
+ * finds its output position on its own: its index within its table, plus the number of rows of
+ * each other table that sort before it, found by binary search. Rows of a preceding table that
+ * are equivalent to it count as sorting before it, so equivalent rows are output in the order of
+ * their tables, as in a merge of the tables two at a time. As in `generate_merged_indices`, a
+ * leading strings key column is compared by its prefix keys first.
+ *
+ * @tparam nullable Indicates whether any of the key columns has nulls
+ * @param[in] keys The key columns of the concatenated tables
+ * @param[in] table_offsets The index of the first row of each table in `keys`, followed by the
+ * number of rows of `keys`
+ * @param[in] column_order Sort order types of the key columns
+ * @param[in] null_precedence Array indicating the order of nulls with respect to non-nulls for
+ * the key columns
+ * @param[in] stream CUDA stream
+ *
+ * @return The gather map of the merged rows of `keys`
+ */
+template <bool nullable>
+rmm::device_vector<size_type> generate_kway_merged_indices(
+  table_view const& keys,
+  std::vector<size_type> const& table_offsets,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  cudaStream_t stream) {
+  auto d_keys = table_device_view::create(keys, stream);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+  rmm::device_vector<size_type> d_table_offsets(table_offsets);
+  auto const comparator = experimental::row_lexicographic_comparator<nullable>(
+    *d_keys,
+    *d_keys,
+    d_column_order.data().get(),
+    null_precedence.empty() ? nullptr : d_null_precedence.data().get());
+
+  rmm::device_vector<size_type> merged_indices(keys.num_rows());
+  auto const num_tables = static_cast<size_type>(table_offsets.size()) - 1;
+  if (keys.column(0).type().id() == STRING) {
+    auto const prefix_keys =
+      string_prefix_keys(keys.column(0), column_order, null_precedence, stream);
+    using prefix_comparator = row_prefix_comparator<std::decay_t<decltype(comparator)>>;
+    scatter_kway_merged_rows(keys.num_rows(),
+                             d_table_offsets.data().get(),
+                             num_tables,
+                             prefix_comparator{prefix_keys.data().get(), comparator},
+                             merged_indices.data().get(),
+                             stream);
   } else {
-    auto ineq_op = experimental::detail::row_lexicographic_tagged_comparator<false>(
-      *lhs_device_view, *rhs_device_view, d_column_order.data().get());
-    thrust::merge(exec_pol->on(stream),
-                  left_begin_zip_iterator,
-                  left_end_zip_iterator,
-                  right_begin_zip_iterator,
-                  right_end_zip_iterator,
-                  merged_indices.begin(),
-                  ineq_op);
+    scatter_kway_merged_rows(keys.num_rows(),
+                             d_table_offsets.data().get(),
+                             num_tables,
+                             comparator,
+                             merged_indices.data().get(),
+                             stream);
   }
 
   CHECK_CUDA(stream);
@@ -215,6 +405,32 @@ rmm::device_vector<index_type> generate_merged_indices(
   return merged_indices;
 }
 
+/**
+ * @brief Splits a tagged index into the index of its table, 0 for the left table and 1 for the
+ * right table, and its row index
+ */
+struct split_tagged_index {
+  __device__ thrust::tuple<size_type, size_type> operator()(index_type index) const {
+    return thrust::make_tuple(thrust::get<0>(index) == side::LEFT ? 0 : 1, thrust::get<1>(index));
+  }
+};
+
+/**
+ * @brief Splits a row index of concatenated tables into the index of its table and its row
+ * index within the table
+ */
+struct split_concatenated_row {
+  size_type const* offsets;
+  size_type num_tables;
+
+  __device__ thrust::tuple<size_type, size_type> operator()(size_type row) const {
+    // Empty tables share their offset with the next table, which holds the row
+    size_type const table =
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_tables + 1, row) - offsets - 1;
+    return thrust::make_tuple(table, row - offsets[table]);
+  }
+};
+
 }  // namespace
 
 namespace cudf {
@@ -331,6 +547,20 @@ std::unique_ptr<column> column_merger::operator()<cudf::dictionary32>(
   CUDF_FAIL("dictionary not supported yet");
 }
 
+// specialization for list
+template <>
+std::unique_ptr<column> column_merger::operator()<cudf::list_view>(
+  column_view const& lcol, column_view const& rcol) const {
+  CUDF_FAIL("list not supported yet");
+}
+
+// specialization for struct
+template <>
+std::unique_ptr<column> column_merger::operator()<cudf::struct_view>(
+  column_view const& lcol, column_view const& rcol) const {
+  CUDF_FAIL("struct not supported yet");
+}
+
 using table_ptr_type = std::unique_ptr<cudf::experimental::table>;
 
 namespace {
@@ -351,7 +581,7 @@ table_ptr_type merge(cudf::table_view const& left_table,
   //extract merged row order according to indices:
   //
   rmm::device_vector<index_type> merged_indices = generate_merged_indices(
-    index_left_view, index_right_view, column_order, null_precedence, nullable);
+    index_left_view, index_right_view, column_order, null_precedence, nullable, stream);
 
   //create merged table:
   //
@@ -372,27 +602,6 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::experimental::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
-
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()} {}
-
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
-};
-
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q) {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
-}
-
 }  // namespace
 
 table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
@@ -422,38 +631,146 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   CUDF_EXPECTS(key_cols.size() == column_order.size(),
                "Mismatched size between key_cols and column_order");
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(tables_to_merge.begin(), tables_to_merge.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(tables_to_merge.begin(),
+               tables_to_merge.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& table) { return table.num_rows() > 0; });
 
+  // No inputs have rows, return a table with same columns as the first one
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
   // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) {
-    return std::make_unique<cudf::experimental::table>(merge_queue.top().view);
+  if (non_empty_tables.size() == 1) {
+    return std::make_unique<cudf::experimental::table>(non_empty_tables.front());
   }
-  // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-    auto merged_table =
-      merge(left_table.view, right_table.view, key_cols, column_order, null_precedence, mr, stream);
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables[0],
+                 non_empty_tables[1],
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 mr,
+                 stream);
+  }
+
+  // Merging more tables two at a time would copy every row about log2(number of tables) times;
+  // instead the rows are concatenated, and gathered in merged order
+  std::vector<size_type> table_offsets{0};
+  for (auto const& table : non_empty_tables) {
+    table_offsets.push_back(table_offsets.back() + table.num_rows());
+  }
+  auto const concatenated = cudf::experimental::concatenate(non_empty_tables);
+  auto const keys         = concatenated->view().select(key_cols);
+  auto const merged_indices =
+    cudf::has_nulls(keys)
+      ? generate_kway_merged_indices<true>(
+          keys, table_offsets, column_order, null_precedence, stream)
+      : generate_kway_merged_indices<false>(
+          keys, table_offsets, column_order, null_precedence, stream);
+
+  return gather(
+    concatenated->view(),
+    column_view(data_type(INT32), concatenated->num_rows(), merged_indices.data().get()),
+    false,
+    false,
+    false,
+    mr,
+    stream);
+}
+
+table_ptr_type merge_indices(std::vector<table_view> const& keys_to_merge,
+                             std::vector<cudf::order> const& column_order,
+                             std::vector<cudf::null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream = 0) {
+  std::vector<std::unique_ptr<column>> indices;
+  auto const num_rows = std::accumulate(
+    keys_to_merge.begin(), keys_to_merge.end(), size_type{0}, [](size_type rows, auto const& t) {
+      return rows + t.num_rows();
+    });
+  for (int i = 0; i < 2; ++i) {
+    indices.push_back(make_numeric_column(
+      data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr));
   }
+  auto output = thrust::make_zip_iterator(
+    thrust::make_tuple(indices[0]->mutable_view().begin<size_type>(),
+                       indices[1]->mutable_view().begin<size_type>()));
+  if (keys_to_merge.empty()) { return std::make_unique<experimental::table>(std::move(indices)); }
 
-  return std::move(top_and_pop(merge_queue).table);
+  auto const& first_table = keys_to_merge.front();
+  CUDF_EXPECTS(first_table.num_columns() > 0, "Empty keys_to_merge");
+  CUDF_EXPECTS(
+    std::all_of(keys_to_merge.cbegin(),
+                keys_to_merge.cend(),
+                [&](auto const& tbl) { return cudf::have_same_types(first_table, tbl); }),
+    "Mismatched column types");
+  CUDF_EXPECTS(static_cast<size_t>(first_table.num_columns()) == column_order.size(),
+               "Mismatched size between keys_to_merge columns and column_order");
+
+  auto const keys_have_nulls =
+    std::any_of(keys_to_merge.cbegin(), keys_to_merge.cend(), [](auto const& tbl) {
+      return cudf::has_nulls(tbl);
+    });
+
+  if (keys_to_merge.size() == 1) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 indices[0]->mutable_view().begin<size_type>(),
+                 indices[0]->mutable_view().end<size_type>(),
+                 0);
+    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                     indices[1]->mutable_view().begin<size_type>(),
+                     indices[1]->mutable_view().end<size_type>());
+  } else if (keys_to_merge.size() == 2) {
+    auto const merged_indices = generate_merged_indices(keys_to_merge[0],
+                                                        keys_to_merge[1],
+                                                        column_order,
+                                                        null_precedence,
+                                                        keys_have_nulls,
+                                                        stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      merged_indices.begin(),
+                      merged_indices.end(),
+                      output,
+                      split_tagged_index{});
+  } else {
+    std::vector<size_type> table_offsets{0};
+    for (auto const& table : keys_to_merge) {
+      table_offsets.push_back(table_offsets.back() + table.num_rows());
+    }
+    auto const concatenated = cudf::experimental::concatenate(keys_to_merge);
+    auto const keys = concatenated->view();
+    auto const merged_rows =
+      keys_have_nulls
+        ? generate_kway_merged_indices<true>(
+            keys, table_offsets, column_order, null_precedence, stream)
+        : generate_kway_merged_indices<false>(
+            keys, table_offsets, column_order, null_precedence, stream);
+    rmm::device_vector<size_type> d_table_offsets(table_offsets);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      merged_rows.begin(),
+      merged_rows.end(),
+      output,
+      split_concatenated_row{d_table_offsets.data().get(),
+                             static_cast<size_type>(keys_to_merge.size())});
+  }
+
+  CHECK_CUDA(stream);
+
+  return std::make_unique<experimental::table>(std::move(indices));
 }
 
 }  // namespace detail
 
+std::unique_ptr<cudf::experimental::table> merge_indices(
+  std::vector<table_view> const& keys_to_merge,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::merge_indices(keys_to_merge, column_order, null_precedence, mr);
+}
+
 std::unique_ptr<cudf::experimental::table> merge(
   std::vector<table_view> const& tables_to_merge,
   std::vector<cudf::size_type> const& key_cols,
@@ -16,15 +16,34 @@
 
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
 
 namespace cudf {
 namespace experimental {
@@ -36,10 +55,6 @@ constexpr size_type OPTIMIZED_ROWS_PER_THREAD                = 8;
 constexpr size_type ELEMENTS_PER_THREAD                      = 2;
 constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 
-// Launch configuration for fallback hash partition
-constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
-constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
-
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -165,70 +180,38 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   }
 }
 
-/* --------------------------------------------------------------------------*/
 /**
- * @brief  Given an array of partition numbers, computes the final output
- location for each element in the output such that all rows with the same
- partition are contiguous in memory.
- *
- * @param row_partition_numbers The array that records the partition number for
- each row
- * @param num_rows The number of rows
- * @param num_partitions THe number of partitions
- * @param[out] block_partition_offsets Array that holds the offset of each
- partition for each thread block,
- * i.e., { {block0 partition0 offset, block1 partition0 offset, ...},
-         {block0 partition1 offset, block1 partition1 offset, ...},
-         ...
-         {block0 partition(num_partitions-1) offset, block1
- partition(num_partitions -1) offset, ...} }
+ * @brief Output of `copy_block_partitions` into a single buffer holding all the
+ * partitions one after the other
  */
-/* ----------------------------------------------------------------------------*/
-__global__ void compute_row_output_locations(size_type* __restrict__ row_partition_numbers,
-                                             const size_type num_rows,
-                                             const size_type num_partitions,
-                                             size_type* __restrict__ block_partition_offsets) {
-  // Shared array that holds the offset of this blocks partitions in
-  // global memory
-  extern __shared__ size_type shared_partition_offsets[];
-
-  // Initialize array of this blocks offsets from global array
-  size_type partition_number = threadIdx.x;
-  while (partition_number < num_partitions) {
-    shared_partition_offsets[partition_number] =
-      block_partition_offsets[partition_number * gridDim.x + blockIdx.x];
-    partition_number += blockDim.x;
-  }
-  __syncthreads();
-
-  size_type row_number = threadIdx.x + blockIdx.x * blockDim.x;
-
-  // Get each row's partition number, and get it's output location by
-  // incrementing block's offset counter for that partition number
-  // and store the row's output location in-place
-  while (row_number < num_rows) {
-    // Get partition number of this row
-    const size_type partition_number = row_partition_numbers[row_number];
-
-    // Get output location based on partition number by incrementing the
-    // corresponding partition offset for this block
-    const size_type row_output_location =
-      atomicAdd(&(shared_partition_offsets[partition_number]), size_type(1));
-
-    // Store the row's output location in-place
-    row_partition_numbers[row_number] = row_output_location;
+template <typename T>
+struct contiguous_output {
+  using value_type = T;
+  T* data;
+  __device__ T& operator()(size_type partition, size_type row) const { return data[row]; }
+};
 
-    row_number += blockDim.x * gridDim.x;
+/**
+ * @brief Output of `copy_block_partitions` into a separate buffer for each
+ * partition
+ */
+template <typename T>
+struct partitioned_output {
+  using value_type = T;
+  T* const* partition_data;            ///< Buffer of each partition
+  size_type const* partition_offsets;  ///< Output row of the start of each partition
+  __device__ T& operator()(size_type partition, size_type row) const {
+    return partition_data[partition][row - partition_offsets[partition]];
   }
-}
+};
 
 /* --------------------------------------------------------------------------*/
 /**
  * @brief Move one column from the input table to the hashed table.
  *
  * @param[in] input_buf Data buffer of the column in the input table
- * @param[out] output_buf Preallocated data buffer of the column in the output
- * table
+ * @param[out] output Functor returning the location of an output row of a
+ * partition, e.g. `contiguous_output` or `partitioned_output`
  * @param[in] num_rows The number of rows in each column
  * @param[in] num_partitions The number of partitions to divide the rows into
  * @param[in] row_partition_numbers Array that holds which partition each row
@@ -240,15 +223,16 @@ __global__ void compute_row_output_locations(size_type* __restrict__ row_partiti
  * @param[in] scanned_block_partition_sizes The scan of block_partition_sizes
  */
 /* ----------------------------------------------------------------------------*/
-template <typename InputIter, typename DataType>
+template <typename InputIter, typename Output>
 __global__ void copy_block_partitions(InputIter input_iter,
-                                      DataType* __restrict__ output_buf,
+                                      Output output,
                                       const size_type num_rows,
                                       const size_type num_partitions,
                                       size_type const* __restrict__ row_partition_numbers,
                                       size_type const* __restrict__ row_partition_offset,
                                       size_type const* __restrict__ block_partition_sizes,
                                       size_type const* __restrict__ scanned_block_partition_sizes) {
+  using DataType = typename Output::value_type;
   extern __shared__ char shared_memory[];
   auto block_output = reinterpret_cast<DataType*>(shared_memory);
   auto partition_offset_shared =
@@ -319,15 +303,15 @@ __global__ void copy_block_partitions(InputIter input_iter,
 
     for (size_type row_offset = threadIdx.x % nthreads_partition; row_offset < nelements_partition;
          row_offset += nthreads_partition) {
-      output_buf[partition_offset_global[ipartition] + row_offset] =
+      output(ipartition, partition_offset_global[ipartition] + row_offset) =
         block_output[partition_offset_shared[ipartition] + row_offset];
     }
   }
 }
 
-template <typename InputIter, typename OutputIter>
+template <typename InputIter, typename Output>
 void copy_block_partitions_impl(InputIter const input,
-                                OutputIter output,
+                                Output output,
                                 size_type num_rows,
                                 size_type num_partitions,
                                 size_type const* row_partition_numbers,
@@ -340,8 +324,9 @@ void copy_block_partitions_impl(InputIter const input,
   // 1. BLOCK_SIZE * ROWS_PER_THREAD elements of size_type for copying to output
   // 2. num_partitions + 1 elements of size_type for per-block partition offsets
   // 3. num_partitions + 1 elements of size_type for global partition offsets
-  int const smem = OPTIMIZED_BLOCK_SIZE * OPTIMIZED_ROWS_PER_THREAD * sizeof(*output) +
-                   (num_partitions + 1) * sizeof(size_type) * 2;
+  int const smem =
+    OPTIMIZED_BLOCK_SIZE * OPTIMIZED_ROWS_PER_THREAD * sizeof(typename Output::value_type) +
+    (num_partitions + 1) * sizeof(size_type) * 2;
 
   copy_block_partitions<<<grid_size, OPTIMIZED_BLOCK_SIZE, smem, stream>>>(
     input,
@@ -366,7 +351,7 @@ rmm::device_vector<size_type> compute_gather_map(size_type num_rows,
   rmm::device_vector<size_type> gather_map(num_rows);
 
   copy_block_partitions_impl(sequence,
-                             gather_map.data().get(),
+                             contiguous_output<size_type>{gather_map.data().get()},
                              num_rows,
                              num_partitions,
                              row_partition_numbers,
@@ -393,7 +378,7 @@ struct copy_block_partitions_dispatcher {
     rmm::device_buffer output(input.size() * sizeof(DataType), stream, mr);
 
     copy_block_partitions_impl(input.data<DataType>(),
-                               static_cast<DataType*>(output.data()),
+                               contiguous_output<DataType>{static_cast<DataType*>(output.data())},
                                input.size(),
                                num_partitions,
                                row_partition_numbers,
@@ -438,46 +423,57 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
-// NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <bool hash_has_nulls>
-std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  rmm::mr::device_memory_resource* mr,
-  cudaStream_t stream) {
-  auto const num_rows = table_to_hash.num_rows();
-
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
-
-  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
-  auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
-
-  // Allocate array to hold which partition each row belongs to
-  auto row_partition_numbers = rmm::device_vector<size_type>(num_rows);
-
-  // Array to hold the size of each partition computed by each block
+/**
+ * @brief The partition of each row of a table and the sizes of the partitions
+ * in each thread block, from which `copy_block_partitions` moves the rows
+ */
+struct row_partitions {
+  size_type grid_size;
+  // Which partition each row belongs to
+  rmm::device_vector<size_type> row_partition_numbers;
+  // The offset of each row in its partition of the thread block
+  rmm::device_vector<size_type> row_partition_offset;
+  // The size of each partition computed by each block
   //  i.e., { {block0 partition0 size, block1 partition0 size, ...},
   //          {block0 partition1 size, block1 partition1 size, ...},
   //          ...
   //          {block0 partition(num_partitions-1) size, block1
   //          partition(num_partitions -1) size, ...} }
-  auto block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+  rmm::device_vector<size_type> block_partition_sizes;
+  rmm::device_vector<size_type> scanned_block_partition_sizes;
+  // The output row of the start of each partition
+  rmm::device_vector<size_type> global_partition_offsets;
+  std::vector<size_type> partition_offsets;
+};
 
-  auto scanned_block_partition_sizes = rmm::device_vector<size_type>(grid_size * num_partitions);
+/**
+ * @brief Computes the partition of each row given the hash values computed by
+ * `hasher`
+ *
+ * @param num_rows The number of rows to partition
+ * @param hasher Functor returning the hash value of a row
+ * @param num_partitions The number of partitions to use, at most
+ * `THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL`
+ */
+template <typename row_hasher_t>
+row_partitions compute_row_partitions(size_type num_rows,
+                                      row_hasher_t const& hasher,
+                                      size_type num_partitions,
+                                      cudaStream_t stream) {
+  row_partitions partitions;
+  auto const block_size     = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_block = block_size * OPTIMIZED_ROWS_PER_THREAD;
+  auto const grid_size      = util::div_rounding_up_safe(num_rows, rows_per_block);
+  partitions.grid_size      = grid_size;
+
+  partitions.row_partition_numbers.resize(num_rows);
+  partitions.row_partition_offset.resize(num_rows);
+  partitions.block_partition_sizes.resize(grid_size * num_partitions);
+  partitions.scanned_block_partition_sizes.resize(grid_size * num_partitions);
 
   // Holds the total number of rows in each partition
   auto global_partition_sizes = rmm::device_vector<size_type>(num_partitions, size_type{0});
 
-  auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
-
-  auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = experimental::row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
-
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
@@ -496,9 +492,9 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
                                               num_rows,
                                               num_partitions,
                                               partitioner_type(num_partitions),
-                                              row_partition_numbers.data().get(),
-                                              row_partition_offset.data().get(),
-                                              block_partition_sizes.data().get(),
+                                              partitions.row_partition_numbers.data().get(),
+                                              partitions.row_partition_offset.data().get(),
+                                              partitions.block_partition_sizes.data().get(),
                                               global_partition_sizes.data().get());
   } else {
     // Determines how the mapping between hash value and partition number is
@@ -516,104 +512,477 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
                                               num_rows,
                                               num_partitions,
                                               partitioner_type(num_partitions),
-                                              row_partition_numbers.data().get(),
-                                              row_partition_offset.data().get(),
-                                              block_partition_sizes.data().get(),
+                                              partitions.row_partition_numbers.data().get(),
+                                              partitions.row_partition_offset.data().get(),
+                                              partitions.block_partition_sizes.data().get(),
                                               global_partition_sizes.data().get());
   }
 
   // Compute exclusive scan of all blocks' partition sizes in-place to determine
   // the starting point for each blocks portion of each partition in the output
   thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
-                         block_partition_sizes.begin(),
-                         block_partition_sizes.end(),
-                         scanned_block_partition_sizes.data().get());
+                         partitions.block_partition_sizes.begin(),
+                         partitions.block_partition_sizes.end(),
+                         partitions.scanned_block_partition_sizes.data().get());
 
   // Compute exclusive scan of size of each partition to determine offset
   // location of each partition in final output.
   // TODO This can be done independently on a separate stream
-  size_type* scanned_global_partition_sizes{global_partition_sizes.data().get()};
   thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
                          global_partition_sizes.begin(),
                          global_partition_sizes.end(),
-                         scanned_global_partition_sizes);
+                         global_partition_sizes.begin());
+  partitions.global_partition_offsets = std::move(global_partition_sizes);
 
   // Copy the result of the exlusive scan to the output offsets array
   // to indicate the starting point for each partition in the output
+  partitions.partition_offsets.resize(num_partitions);
+  CUDA_TRY(cudaMemcpyAsync(partitions.partition_offsets.data(),
+                           partitions.global_partition_offsets.data().get(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  return partitions;
+}
+
+/**
+ * @brief Returns the partition of a row, the hash value of the row modulo the
+ * number of partitions as in `compute_row_partition_numbers`
+ */
+template <typename row_hasher_t>
+struct row_partition_number_fn {
+  row_hasher_t hasher;
+  modulo_partitioner<hash_value_type> partitioner;
+
+  __device__ size_type operator()(size_type row_index) const {
+    return partitioner(hasher(row_index));
+  }
+};
+
+/**
+ * @brief Partitions the rows of `input` on the hash values computed by `hasher`
+ * with a radix sort of the partition numbers, for more partitions than
+ * `THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL`
+ *
+ * The per-block histograms of `compute_row_partition_numbers` grow with the
+ * number of partitions until they no longer fit in shared memory. The radix
+ * sort instead partitions the rows by successive digits of the partition
+ * number, coarse to fine over at most `ceil(log2(num_partitions))` bits, with
+ * a histogram of fixed size per digit. Each digit pass is stable and scatters
+ * rows ranked within a block, so the writes of a partition are coalesced.
+ *
+ * @param input The table to partition
+ * @param hasher Functor returning the hash value of a row of `input`
+ * @param num_partitions The number of partitions to use
+ */
+template <typename row_hasher_t>
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>>
+partition_table_by_radix_sort(table_view const& input,
+                              row_hasher_t const& hasher,
+                              size_type num_partitions,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream) {
+  auto const num_rows = input.num_rows();
+
+  rmm::device_vector<size_type> row_partition_numbers(num_rows);
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   row_partition_numbers.begin(),
+                   row_partition_numbers.end(),
+                   row_partition_number_fn<row_hasher_t>{
+                     hasher, modulo_partitioner<hash_value_type>(num_partitions)});
+  rmm::device_vector<size_type> row_indices(num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), row_indices.begin(), row_indices.end());
+
+  // Only the bits that can be set in a partition number are sorted on
+  int end_bit = 0;
+  while ((size_type{1} << end_bit) < num_partitions) { ++end_bit; }
+
+  rmm::device_vector<size_type> sorted_partition_numbers(num_rows);
+  rmm::device_vector<size_type> gather_map(num_rows);
+  std::size_t temp_storage_bytes = 0;
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(nullptr,
+                                           temp_storage_bytes,
+                                           row_partition_numbers.data().get(),
+                                           sorted_partition_numbers.data().get(),
+                                           row_indices.data().get(),
+                                           gather_map.data().get(),
+                                           num_rows,
+                                           0,
+                                           end_bit,
+                                           stream));
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  CUDA_TRY(cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                           temp_storage_bytes,
+                                           row_partition_numbers.data().get(),
+                                           sorted_partition_numbers.data().get(),
+                                           row_indices.data().get(),
+                                           gather_map.data().get(),
+                                           num_rows,
+                                           0,
+                                           end_bit,
+                                           stream));
+
+  // The start of each partition is the first sorted row not in an earlier one
+  rmm::device_vector<size_type> global_partition_offsets(num_partitions);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      global_partition_offsets.begin());
   std::vector<size_type> partition_offsets(num_partitions);
   CUDA_TRY(cudaMemcpyAsync(partition_offsets.data(),
-                           scanned_global_partition_sizes,
+                           global_partition_offsets.data().get(),
                            num_partitions * sizeof(size_type),
                            cudaMemcpyDeviceToHost,
                            stream));
+  CUDF_STREAM_SYNC(stream);
 
+  auto output =
+    experimental::detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
+/**
+ * @brief Partitions the rows of `input` on the hash values computed by `hasher`
+ *
+ * @param input The table to partition
+ * @param hasher Functor returning the hash value of a row of `input`
+ * @param num_partitions The number of partitions to use
+ */
+template <typename row_hasher_t>
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> partition_table_by_hash(
+  table_view const& input,
+  row_hasher_t const& hasher,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
   // When the number of partitions is less than a threshold, we can apply an
   // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // NOTE these pointers are non-const to workaround lambda capture bug in
-    // gcc 5.4
-    auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
-    auto row_partition_offset_ptr{row_partition_offset.data().get()};
-    auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
-      return cudf::experimental::type_dispatcher(col.type(),
-                                                 copy_block_partitions_dispatcher{},
-                                                 col,
-                                                 num_partitions,
-                                                 row_partition_numbers_ptr,
-                                                 row_partition_offset_ptr,
-                                                 block_partition_sizes_ptr,
-                                                 scanned_block_partition_sizes_ptr,
-                                                 grid_size,
-                                                 mr,
-                                                 stream);
-    });
-
-    if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers_ptr,
-                                           row_partition_offset_ptr,
-                                           block_partition_sizes_ptr,
-                                           scanned_block_partition_sizes_ptr,
-                                           grid_size,
-                                           stream);
-
-      // Handle bitmask using gather to take advantage of ballot_sync
-      experimental::detail::gather_bitmask(input,
-                                           gather_map.begin(),
-                                           output_cols,
-                                           experimental::detail::gather_bitmask_op::DONT_CHECK,
-                                           mr,
-                                           stream);
+  // Otherwise, fallback to a radix sort of the partition numbers.
+  if (num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return partition_table_by_radix_sort(input, hasher, num_partitions, mr, stream);
+  }
+
+  auto const num_rows = input.num_rows();
+  auto partitions     = compute_row_partitions(num_rows, hasher, num_partitions, stream);
+  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
+  auto grid_size = partitions.grid_size;
+
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // NOTE these pointers are non-const to workaround lambda capture bug in
+  // gcc 5.4
+  auto row_partition_numbers_ptr{partitions.row_partition_numbers.data().get()};
+  auto row_partition_offset_ptr{partitions.row_partition_offset.data().get()};
+  auto block_partition_sizes_ptr{partitions.block_partition_sizes.data().get()};
+  auto scanned_block_partition_sizes_ptr{partitions.scanned_block_partition_sizes.data().get()};
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
+    return cudf::experimental::type_dispatcher(col.type(),
+                                               copy_block_partitions_dispatcher{},
+                                               col,
+                                               num_partitions,
+                                               row_partition_numbers_ptr,
+                                               row_partition_offset_ptr,
+                                               block_partition_sizes_ptr,
+                                               scanned_block_partition_sizes_ptr,
+                                               grid_size,
+                                               mr,
+                                               stream);
+  });
+
+  if (has_nulls(input)) {
+    // Use copy_block_partitions to compute a gather map
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         row_partition_numbers_ptr,
+                                         row_partition_offset_ptr,
+                                         block_partition_sizes_ptr,
+                                         scanned_block_partition_sizes_ptr,
+                                         grid_size,
+                                         stream);
+
+    // Handle bitmask using gather to take advantage of ballot_sync
+    experimental::detail::gather_bitmask(input,
+                                         gather_map.begin(),
+                                         output_cols,
+                                         experimental::detail::gather_bitmask_op::DONT_CHECK,
+                                         mr,
+                                         stream);
+  }
+
+  auto output{std::make_unique<experimental::table>(std::move(output_cols))};
+  return std::make_pair(std::move(output), std::move(partitions.partition_offsets));
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <bool hash_has_nulls>
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  hash_value_type seed,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher =
+    experimental::row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input, seed);
+  return partition_table_by_hash(input, hasher, num_partitions, mr, stream);
+}
+
+/**
+ * @brief Returns the partition of a row as Spark's hash partitioning selects
+ * it: the non-negative remainder of the signed hash value of the row divided
+ * by the number of partitions
+ *
+ * The partitioners map the returned values to themselves.
+ */
+template <typename row_hasher_t>
+struct pmod_row_hasher {
+  row_hasher_t hasher;
+  size_type num_partitions;
+
+  __device__ hash_value_type operator()(size_type row_index) const {
+    using signed_type = std::make_signed_t<typename row_hasher_t::result_type>;
+    auto const remainder = static_cast<signed_type>(hasher(row_index)) % num_partitions;
+    return static_cast<hash_value_type>(remainder < 0 ? remainder + num_partitions : remainder);
+  }
+};
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>>
+seeded_hash_partition_table(table_view const& input,
+                            table_view const& table_to_hash,
+                            size_type num_partitions,
+                            hash_value_type seed,
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream) {
+  using row_hasher_t      = experimental::seeded_row_hasher<hash_function, hash_has_nulls>;
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  pmod_row_hasher<row_hasher_t> const hasher{row_hasher_t(*device_input, seed), num_partitions};
+  return partition_table_by_hash(input, hasher, num_partitions, mr, stream);
+}
+
+/**
+ * @brief Returns the hash values stored in a column, as a row hasher
+ */
+struct precomputed_row_hasher {
+  hash_value_type const* hashes;
+  __device__ hash_value_type operator()(size_type row_index) const { return hashes[row_index]; }
+};
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <bool hash_has_nulls>
+std::unique_ptr<column> compute_row_hashes(table_view const& table_to_hash,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream) {
+  auto hashes = make_numeric_column(
+    data_type(INT32), table_to_hash.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = experimental::row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+  auto output             = hashes->mutable_view();
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   output.begin<int32_t>(),
+                   output.end<int32_t>(),
+                   hasher);
+  return hashes;
+}
+
+// Alignment of the buffers of the columns in a partition, as in `contiguous_split`
+constexpr size_t packed_align = 64;
+
+/**
+ * @brief Moves the rows of a fixed-width column into the buffers of the
+ * partitions
+ */
+struct copy_packed_partitions_dispatcher {
+  template <typename DataType, std::enable_if_t<is_fixed_width<DataType>()>* = nullptr>
+  void operator()(column_view const& input,
+                  void* const* partition_data,
+                  row_partitions const& partitions,
+                  size_type num_partitions,
+                  cudaStream_t stream) {
+    partitioned_output<DataType> const output{
+      reinterpret_cast<DataType* const*>(partition_data),
+      partitions.global_partition_offsets.data().get()};
+    copy_block_partitions_impl(input.data<DataType>(),
+                               output,
+                               input.size(),
+                               num_partitions,
+                               partitions.row_partition_numbers.data().get(),
+                               partitions.row_partition_offset.data().get(),
+                               partitions.block_partition_sizes.data().get(),
+                               partitions.scanned_block_partition_sizes.data().get(),
+                               partitions.grid_size,
+                               stream);
+  }
+
+  template <typename DataType, std::enable_if_t<not is_fixed_width<DataType>()>* = nullptr>
+  void operator()(column_view const& input,
+                  void* const* partition_data,
+                  row_partitions const& partitions,
+                  size_type num_partitions,
+                  cudaStream_t stream) {
+    CUDF_FAIL("Only fixed-width columns are moved into the partition buffers");
+  }
+};
+
+/**
+ * @brief Gathers the validity of the rows of each partition into the null mask
+ * of the partition
+ *
+ * Each thread computes one word of a null mask. The words of the masks of all
+ * the partitions are numbered one after the other, partition `i` starting at
+ * word `partition_word_offsets[i]`.
+ *
+ * @param input The column whose null mask is partitioned
+ * @param gather_map The input row of each output row
+ * @param partition_offsets The output row of the start of each partition, and
+ * the number of rows
+ * @param partition_word_offsets The first word of each partition, and the
+ * number of words
+ * @param[out] partition_masks The null mask of each partition
+ * @param num_partitions The number of partitions
+ */
+__global__ void copy_partitioned_bitmask(column_device_view input,
+                                         size_type const* __restrict__ gather_map,
+                                         size_type const* __restrict__ partition_offsets,
+                                         size_type const* __restrict__ partition_word_offsets,
+                                         bitmask_type* const* __restrict__ partition_masks,
+                                         size_type num_partitions) {
+  constexpr size_type word_size{cudf::detail::size_in_bits<bitmask_type>()};
+  size_type const num_words = partition_word_offsets[num_partitions];
+
+  for (size_type word = threadIdx.x + blockIdx.x * blockDim.x; word < num_words;
+       word += blockDim.x * gridDim.x) {
+    // Empty partitions share their first word with the next partition
+    size_type const partition = thrust::upper_bound(thrust::seq,
+                                                    partition_word_offsets,
+                                                    partition_word_offsets + num_partitions + 1,
+                                                    word) -
+                                partition_word_offsets - 1;
+    size_type const partition_word = word - partition_word_offsets[partition];
+    size_type const begin          = partition_offsets[partition] + partition_word * word_size;
+    size_type const end            = min(begin + word_size, partition_offsets[partition + 1]);
+
+    bitmask_type bits = 0;
+    for (size_type row = begin; row < end; ++row) {
+      if (input.is_valid_nocheck(gather_map[row])) { bits |= bitmask_type{1} << (row - begin); }
     }
+    partition_masks[partition][partition_word] = bits;
+  }
+}
 
-    auto output{std::make_unique<experimental::table>(std::move(output_cols))};
-    return std::make_pair(std::move(output), std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = experimental::detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, mr, stream);
-
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+/**
+ * @brief Partitions the rows of a fixed-width `input` on the hash values
+ * computed by `hasher`, directly into a contiguous buffer for each partition
+ *
+ * @param input The table to partition, of fixed-width columns
+ * @param hasher Functor returning the hash value of a row of `input`
+ * @param num_partitions The number of partitions to use, at most
+ * `THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL`
+ */
+template <typename row_hasher_t>
+std::vector<contiguous_split_result> partition_contiguous_by_hash(
+  table_view const& input,
+  row_hasher_t const& hasher,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  auto const partitions  = compute_row_partitions(num_rows, hasher, num_partitions, stream);
+
+  auto partition_offsets = partitions.partition_offsets;
+  partition_offsets.push_back(num_rows);
+
+  // Lay out the null mask and the data of each column in the buffer of each partition
+  std::vector<contiguous_split_result> result;
+  std::vector<void*> partition_data(num_columns * num_partitions);
+  std::vector<bitmask_type*> partition_masks(num_columns * num_partitions);
+  std::vector<size_type> partition_word_offsets{0};
+  for (size_type ipartition = 0; ipartition < num_partitions; ++ipartition) {
+    auto const partition_size = partition_offsets[ipartition + 1] - partition_offsets[ipartition];
+    partition_word_offsets.push_back(partition_word_offsets.back() +
+                                     num_bitmask_words(partition_size));
+
+    size_t buffer_size = 0;
+    for (auto const& col : input) {
+      if (col.has_nulls()) {
+        buffer_size += bitmask_allocation_size_bytes(partition_size, packed_align);
+      }
+      buffer_size += util::round_up_safe(partition_size * size_of(col.type()), packed_align);
+    }
+    auto buffer = std::make_unique<rmm::device_buffer>(buffer_size, stream, mr);
+
+    auto dst = static_cast<char*>(buffer->data());
+    std::vector<column_view> columns;
+    for (size_type icolumn = 0; icolumn < num_columns; ++icolumn) {
+      auto const& col         = input.column(icolumn);
+      bitmask_type* null_mask = nullptr;
+      if (col.has_nulls()) {
+        null_mask = reinterpret_cast<bitmask_type*>(dst);
+        dst += bitmask_allocation_size_bytes(partition_size, packed_align);
+      }
+      void* data = partition_size > 0 ? dst : nullptr;
+      dst += util::round_up_safe(partition_size * size_of(col.type()), packed_align);
+
+      columns.emplace_back(col.type(),
+                           partition_size,
+                           data,
+                           null_mask,
+                           null_mask == nullptr ? 0 : UNKNOWN_NULL_COUNT);
+      partition_data[icolumn * num_partitions + ipartition]  = data;
+      partition_masks[icolumn * num_partitions + ipartition] = null_mask;
+    }
+    result.push_back(contiguous_split_result{table_view{columns}, std::move(buffer)});
   }
+
+  // Copy input to the partitions per column
+  rmm::device_vector<void*> device_partition_data(partition_data);
+  for (size_type icolumn = 0; icolumn < num_columns; ++icolumn) {
+    auto const column_partition_data =
+      device_partition_data.data().get() + icolumn * num_partitions;
+    cudf::experimental::type_dispatcher(input.column(icolumn).type(),
+                                        copy_packed_partitions_dispatcher{},
+                                        input.column(icolumn),
+                                        column_partition_data,
+                                        partitions,
+                                        num_partitions,
+                                        stream);
+  }
+
+  if (has_nulls(input)) {
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         partitions.row_partition_numbers.data().get(),
+                                         partitions.row_partition_offset.data().get(),
+                                         partitions.block_partition_sizes.data().get(),
+                                         partitions.scanned_block_partition_sizes.data().get(),
+                                         partitions.grid_size,
+                                         stream);
+    rmm::device_vector<size_type> device_partition_offsets(partition_offsets);
+    rmm::device_vector<size_type> device_word_offsets(partition_word_offsets);
+    rmm::device_vector<bitmask_type*> device_partition_masks(partition_masks);
+
+    cudf::experimental::detail::grid_1d grid{partition_word_offsets.back(), 256};
+    for (size_type icolumn = 0; icolumn < num_columns; ++icolumn) {
+      if (not input.column(icolumn).has_nulls()) { continue; }
+      auto const device_input = column_device_view::create(input.column(icolumn), stream);
+      copy_partitioned_bitmask<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+        *device_input,
+        gather_map.data().get(),
+        device_partition_offsets.data().get(),
+        device_word_offsets.data().get(),
+        device_partition_masks.data().get() + icolumn * num_partitions,
+        num_partitions);
+    }
+  }
+  return result;
 }
 
 struct dispatch_map_type {
@@ -660,7 +1029,8 @@ struct dispatch_map_type {
                                         partition_map.size(),
                                         stream);
 
-    rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+    detail::scratch_scope scratch(stream);
+    rmm::device_buffer temp_storage(temp_storage_bytes, stream, scratch.resource());
 
     cub::DeviceHistogram::HistogramEven(temp_storage.data(),
                                         temp_storage_bytes,
@@ -679,6 +1049,7 @@ struct dispatch_map_type {
 
     // Copy offsets to host
     std::vector<size_type> partition_offsets(histogram.size());
+    CUDF_SYNC_POINT();
     thrust::copy(histogram.begin(), histogram.end(), partition_offsets.begin());
 
     // Unfortunately need to materialize the scatter map because
@@ -713,6 +1084,33 @@ struct dispatch_map_type {
     CUDF_FAIL("Unexpected, non-integral partition map.");
   }
 };
+
+constexpr size_type range_partition_samples = 64;  ///< Samples of the keys per partition
+
+/**
+ * @brief Picks the row of each sample of a table, pseudo-randomly
+ */
+struct sample_row {
+  size_type num_rows;
+  __device__ size_type operator()(size_type i) const {
+    return static_cast<size_type>(MurmurHash3_32<size_type>{}(i) % num_rows);
+  }
+};
+
+/**
+ * @brief Maps each splitter to the row of a sample in the sorted order of the
+ * samples, splitting the samples into ranges of equal sizes
+ */
+struct splitter_row {
+  size_type const* sample_rows;
+  size_type const* sorted_samples;
+  size_type num_samples;
+  size_type num_partitions;
+  __device__ size_type operator()(size_type i) const {
+    auto const sample = static_cast<int64_t>(i + 1) * num_samples / num_partitions;
+    return sample_rows[sorted_samples[sample]];
+  }
+};
 }  // namespace
 
 namespace detail {
@@ -720,6 +1118,8 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
+  uint32_t seed,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0) {
   auto table_to_hash = input.select(columns_to_hash);
@@ -729,11 +1129,206 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
     return std::make_pair(experimental::empty_like(input), std::vector<size_type>{});
   }
 
-  if (has_nulls(table_to_hash)) {
-    return hash_partition_table<true>(input, table_to_hash, num_partitions, mr, stream);
-  } else {
-    return hash_partition_table<false>(input, table_to_hash, num_partitions, mr, stream);
+  bool const nullable = has_nulls(table_to_hash);
+  switch (hash_function) {
+    case hash_id::HASH_MURMUR3:
+      return nullable ? hash_partition_table<true>(
+                          input, table_to_hash, num_partitions, seed, mr, stream)
+                      : hash_partition_table<false>(
+                          input, table_to_hash, num_partitions, seed, mr, stream);
+    case hash_id::HASH_SPARK_MURMUR3:
+      return nullable ? seeded_hash_partition_table<SparkMurmurHash3_32, true>(
+                          input, table_to_hash, num_partitions, seed, mr, stream)
+                      : seeded_hash_partition_table<SparkMurmurHash3_32, false>(
+                          input, table_to_hash, num_partitions, seed, mr, stream);
+    case hash_id::HASH_XXHASH64:
+      return nullable ? seeded_hash_partition_table<XXHash_64, true>(
+                          input, table_to_hash, num_partitions, seed, mr, stream)
+                      : seeded_hash_partition_table<XXHash_64, false>(
+                          input, table_to_hash, num_partitions, seed, mr, stream);
+    default: CUDF_FAIL("Unsupported hash function");
+  }
+}
+
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition(
+  chunked_table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  uint32_t seed,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0) {
+  if (input.num_chunks() == 1) {
+    return hash_partition(
+      input.chunk(0), columns_to_hash, num_partitions, hash_function, seed, mr, stream);
+  }
+  CUDF_EXPECTS(input.num_rows() <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "The chunks have more rows than a column");
+  auto const num_rows = static_cast<size_type>(input.num_rows());
+  if (num_partitions <= 0 || num_rows == 0 || columns_to_hash.empty()) {
+    return std::make_pair(experimental::empty_like(input.chunk(0)), std::vector<size_type>{});
+  }
+
+  // The partition sizes of each chunk are computed by partitioning its keys
+  std::vector<table_view> chunks;
+  std::vector<std::vector<size_type>> chunk_offsets;
+  std::vector<size_type> key_columns(columns_to_hash.size());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  std::vector<size_type> partition_sizes(num_partitions, 0);
+  for (auto const& chunk : input) {
+    if (chunk.num_rows() == 0) { continue; }
+    auto offsets = hash_partition(chunk.select(columns_to_hash),
+                                  key_columns,
+                                  num_partitions,
+                                  hash_function,
+                                  seed,
+                                  rmm::mr::get_default_resource(),
+                                  stream)
+                     .second;
+    offsets.push_back(chunk.num_rows());
+    for (int p = 0; p < num_partitions; ++p) { partition_sizes[p] += offsets[p + 1] - offsets[p]; }
+    chunks.push_back(chunk);
+    chunk_offsets.push_back(std::move(offsets));
+  }
+  std::vector<size_type> partition_offsets(num_partitions, 0);
+  std::partial_sum(
+    partition_sizes.begin(), partition_sizes.end() - 1, partition_offsets.begin() + 1);
+
+  // Fixed-width columns are preallocated, the others are concatenated at the end
+  auto const num_columns = input.num_columns();
+  std::vector<std::unique_ptr<column>> out_columns(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const col = input.column(c);
+    if (not is_fixed_width(col.type())) { continue; }
+    auto const state = col.nullable() ? mask_state::ALL_VALID : mask_state::UNALLOCATED;
+    out_columns[c]   = make_fixed_width_column(col.type(), num_rows, state, stream, mr);
+  }
+
+  // The rows of each partition of a chunk follow those of the preceding chunks
+  std::vector<std::vector<std::unique_ptr<column>>> partitioned_chunks(num_columns);
+  auto write_offsets = partition_offsets;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto const& offsets = chunk_offsets[i];
+    auto const result   = hash_partition(chunks[i],
+                                       columns_to_hash,
+                                       num_partitions,
+                                       hash_function,
+                                       seed,
+                                       rmm::mr::get_default_resource(),
+                                       stream);
+    auto partitioned    = result.first->release();
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (out_columns[c] == nullptr) {
+        partitioned_chunks[c].push_back(std::move(partitioned[c]));
+        continue;
+      }
+      auto target = out_columns[c]->mutable_view();
+      for (int p = 0; p < num_partitions; ++p) {
+        if (offsets[p + 1] == offsets[p]) { continue; }
+        experimental::detail::copy_range_in_place(
+          partitioned[c]->view(), target, offsets[p], offsets[p + 1], write_offsets[p], stream);
+      }
+    }
+    for (int p = 0; p < num_partitions; ++p) { write_offsets[p] += offsets[p + 1] - offsets[p]; }
+  }
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    if (out_columns[c] != nullptr) { continue; }
+    std::vector<std::vector<column_view>> chunk_slices;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      std::vector<size_type> indices;
+      for (int p = 0; p < num_partitions; ++p) {
+        indices.push_back(chunk_offsets[i][p]);
+        indices.push_back(chunk_offsets[i][p + 1]);
+      }
+      chunk_slices.push_back(experimental::slice(partitioned_chunks[c][i]->view(), indices));
+    }
+    std::vector<column_view> slices;
+    for (int p = 0; p < num_partitions; ++p) {
+      for (auto const& s : chunk_slices) { slices.push_back(s[p]); }
+    }
+    out_columns[c] = cudf::concatenate(slices, mr);
+    partitioned_chunks[c].clear();
+  }
+
+  return std::make_pair(std::make_unique<experimental::table>(std::move(out_columns)),
+                        std::move(partition_offsets));
+}
+
+std::tuple<std::unique_ptr<experimental::table>, std::vector<size_type>, std::unique_ptr<column>>
+hash_partition_with_hashes(table_view const& input,
+                           std::vector<size_type> const& columns_to_hash,
+                           int num_partitions,
+                           rmm::mr::device_memory_resource* mr,
+                           cudaStream_t stream = 0) {
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return std::make_tuple(experimental::empty_like(input),
+                           std::vector<size_type>{},
+                           make_numeric_column(data_type(INT32), 0));
   }
+
+  // Hash once; the same values pick the partitions and are returned in partition order
+  scratch_scope scratch(stream);
+  auto const temp_mr = scratch.resource();
+  auto const hashes  = has_nulls(table_to_hash)
+                         ? compute_row_hashes<true>(table_to_hash, temp_mr, stream)
+                         : compute_row_hashes<false>(table_to_hash, temp_mr, stream);
+
+  precomputed_row_hasher const hasher{hashes->view().data<hash_value_type>()};
+  auto result = partition_table_by_hash(
+    table_view{{input, table_view{{hashes->view()}}}}, hasher, num_partitions, mr, stream);
+
+  auto columns            = result.first->release();
+  auto partitioned_hashes = std::move(columns.back());
+  columns.pop_back();
+  return std::make_tuple(std::make_unique<experimental::table>(std::move(columns)),
+                         std::move(result.second),
+                         std::move(partitioned_hashes));
+}
+
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0) {
+  if (num_partitions <= 0) { return {}; }
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty partitions if there is nothing to hash
+  if (input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    auto const empty = experimental::empty_like(input);
+    std::vector<size_type> const splits(num_partitions - 1, 0);
+    return contiguous_split(empty->view(), splits, mr, stream);
+  }
+
+  bool const fixed_width = std::all_of(
+    input.begin(), input.end(), [](column_view const& col) { return is_fixed_width(col.type()); });
+  if (fixed_width and num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    auto const device_input = table_device_view::create(table_to_hash, stream);
+    if (has_nulls(table_to_hash)) {
+      auto const hasher = experimental::row_hasher<MurmurHash3_32, true>(*device_input);
+      return partition_contiguous_by_hash(input, hasher, num_partitions, mr, stream);
+    } else {
+      auto const hasher = experimental::row_hasher<MurmurHash3_32, false>(*device_input);
+      return partition_contiguous_by_hash(input, hasher, num_partitions, mr, stream);
+    }
+  }
+
+  // Columns of variable width are partitioned into a temporary table first
+  auto const partitioned =
+    hash_partition(input,
+                   columns_to_hash,
+                   num_partitions,
+                   hash_id::HASH_MURMUR3,
+                   0,
+                   rmm::mr::get_default_resource(),
+                   stream);
+  std::vector<size_type> const splits(partitioned.second.begin() + 1, partitioned.second.end());
+  return contiguous_split(partitioned.first->view(), splits, mr, stream);
 }
 
 std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> partition(
@@ -753,6 +1348,64 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> partitio
   return cudf::experimental::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, mr, stream);
 }
+
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  int num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0) {
+  auto const keys = input.select(sort_keys);
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == sort_keys.size(),
+               "Mismatch between number of sort keys and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == sort_keys.size(),
+               "Mismatch between number of sort keys and null precedence.");
+
+  // Return empty result if there are no partitions or nothing to sort
+  if (num_partitions <= 0 || input.num_rows() == 0 || keys.num_columns() == 0) {
+    return std::make_pair(experimental::empty_like(input), std::vector<size_type>{});
+  }
+
+  scratch_scope scratch(stream);
+  auto const temp_mr = scratch.resource();
+  auto exec          = rmm::exec_policy(stream);
+
+  // Sort a sample of the keys, and select the splitters evenly from it
+  auto const num_samples =
+    std::min<int64_t>(input.num_rows(), int64_t{num_partitions} * range_partition_samples);
+  auto sample_rows =
+    make_numeric_column(data_type{INT32}, num_samples, mask_state::UNALLOCATED, stream, temp_mr);
+  thrust::tabulate(exec->on(stream),
+                   sample_rows->mutable_view().begin<size_type>(),
+                   sample_rows->mutable_view().end<size_type>(),
+                   sample_row{input.num_rows()});
+  auto const samples =
+    experimental::detail::gather(keys, sample_rows->view(), false, false, false, temp_mr, stream);
+  auto const sorted_samples = experimental::detail::sorted_order(
+    samples->view(), column_order, null_precedence, temp_mr, stream);
+
+  auto splitter_rows = make_numeric_column(
+    data_type{INT32}, num_partitions - 1, mask_state::UNALLOCATED, stream, temp_mr);
+  thrust::tabulate(exec->on(stream),
+                   splitter_rows->mutable_view().begin<size_type>(),
+                   splitter_rows->mutable_view().end<size_type>(),
+                   splitter_row{sample_rows->view().data<size_type>(),
+                                sorted_samples->view().data<size_type>(),
+                                static_cast<size_type>(num_samples),
+                                num_partitions});
+  auto const splitters =
+    experimental::detail::gather(keys, splitter_rows->view(), false, false, false, temp_mr, stream);
+
+  // The partition of a row is the number of splitters not greater than it, so
+  // that equivalent rows are in the same partition
+  auto const partition_map = experimental::detail::upper_bound(
+    splitters->view(), keys, column_order, null_precedence, temp_mr, stream);
+  auto result = partition(input, partition_map->view(), num_partitions, mr, stream);
+  result.second.pop_back();
+  return result;
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -760,9 +1413,56 @@ std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_par
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
+  uint32_t seed,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition(input, columns_to_hash, num_partitions, hash_function, seed, mr);
+}
+
+// Partition based on hash values, chunk by chunk
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> hash_partition(
+  chunked_table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function,
+  uint32_t seed,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition(input, columns_to_hash, num_partitions, hash_function, seed, mr);
+}
+
+// Partition based on hash values, returning the hash values
+std::tuple<std::unique_ptr<experimental::table>, std::vector<size_type>, std::unique_ptr<column>>
+hash_partition_with_hashes(table_view const& input,
+                           std::vector<size_type> const& columns_to_hash,
+                           int num_partitions,
+                           rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_with_hashes(input, columns_to_hash, num_partitions, mr);
+}
+
+// Partition based on hash values, into a contiguous buffer for each partition
+std::vector<contiguous_split_result> contiguous_hash_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::contiguous_hash_partition(input, columns_to_hash, num_partitions, mr);
+}
+
+// Partition based on ranges of the sorted order of sampled keys
+std::pair<std::unique_ptr<experimental::table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& sort_keys,
+  int num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
   rmm::mr::device_memory_resource* mr) {
   CUDF_FUNC_RANGE();
-  return detail::hash_partition(input, columns_to_hash, num_partitions, mr);
+  return detail::range_partition(
+    input, sort_keys, num_partitions, column_order, null_precedence, mr);
 }
 
 // Partition based on an explicit partition map
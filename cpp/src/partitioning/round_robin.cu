@@ -109,7 +109,7 @@ degenerate_partitions(cudf::table_view const& input,
                              cudaMemcpyDeviceToHost,
                              stream));
 
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_STREAM_SYNC(stream);
 
     return ret_pair;
   } else {  //( num_partitions > nrows )
@@ -160,7 +160,7 @@ degenerate_partitions(cudf::table_view const& input,
                              cudaMemcpyDeviceToHost,
                              stream));
 
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_STREAM_SYNC(stream);
 
     return ret_pair;
   }
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+
+namespace cudf {
+namespace experimental {
+namespace {
+
+/**
+ * @brief The state shared by the peer communicators of a group
+ */
+struct peer_group {
+  explicit peer_group(std::vector<int> const& devices)
+    : devices{devices}, buffers(devices.size()), sends(devices.size()) {}
+
+  /**
+   * @brief Waits until all the ranks have called `barrier()`
+   */
+  void barrier() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto const current = generation;
+    if (++arrived == devices.size()) {
+      arrived = 0;
+      ++generation;
+      condition.notify_all();
+    } else {
+      condition.wait(lock, [this, current] { return generation != current; });
+    }
+  }
+
+  std::vector<int> const devices;
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::size_t arrived{};
+  std::uint64_t generation{};
+  std::vector<void const*> buffers;                     ///< Posted by each rank
+  std::vector<std::vector<packed_table> const*> sends;  ///< Posted by each rank
+};
+
+class peer_communicator : public communicator {
+ public:
+  /**
+   * @brief Construct the communicator of `rank`, whose device must be the
+   * current device
+   */
+  peer_communicator(std::shared_ptr<peer_group> group, int rank)
+    : _group{std::move(group)}, _rank{rank}, _streams(_group->devices.size()) {
+    for (auto& s : _streams) { CUDA_TRY(cudaStreamCreateWithFlags(&s, cudaStreamNonBlocking)); }
+  }
+
+  ~peer_communicator() override {
+    for (auto s : _streams) {
+      if (s != nullptr) { cudaStreamDestroy(s); }
+    }
+  }
+
+  int size() const override { return _group->devices.size(); }
+
+  int rank() const override { return _rank; }
+
+  std::vector<received_partition> all_to_all(void const* buffer,
+                                             std::vector<packed_table> const& sends,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream) override {
+    CUDF_EXPECTS(static_cast<int>(sends.size()) == size(), "One partition per rank is required");
+    auto const device = _group->devices[_rank];
+    int current       = 0;
+    CUDA_TRY(cudaGetDevice(&current));
+    CUDF_EXPECTS(current == device, "The current device must be the device of the rank");
+
+    // The partitions must be written before the other ranks copy them
+    CUDF_STREAM_SYNC(stream);
+    {
+      std::lock_guard<std::mutex> lock(_group->mutex);
+      _group->buffers[_rank] = buffer;
+      _group->sends[_rank]   = &sends;
+    }
+    _group->barrier();
+
+    // Each rank copies the partitions it receives, on one stream per sender
+    std::vector<received_partition> received;
+    received.reserve(size());
+    for (int sender = 0; sender < size(); ++sender) {
+      auto const& partition = (*_group->sends[sender])[_rank];
+      received.push_back(
+        received_partition{partition.metadata, rmm::device_buffer(partition.size, stream, mr)});
+    }
+    // The received buffers are allocated on `stream`, and copied to on others
+    CUDF_STREAM_SYNC(stream);
+    for (int sender = 0; sender < size(); ++sender) {
+      auto const& partition = (*_group->sends[sender])[_rank];
+      if (partition.size == 0) { continue; }
+      CUDA_TRY(cudaMemcpyPeerAsync(
+        received[sender].data.data(),
+        device,
+        static_cast<uint8_t const*>(_group->buffers[sender]) + partition.offset,
+        _group->devices[sender],
+        partition.size,
+        _streams[sender]));
+    }
+    for (auto s : _streams) { CUDF_STREAM_SYNC(s); }
+
+    // The senders keep their buffers until all the ranks have copied them
+    _group->barrier();
+    return received;
+  }
+
+ private:
+  std::shared_ptr<peer_group> _group;
+  int _rank;
+  std::vector<cudaStream_t> _streams;  ///< To copy from each sender
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<communicator>> make_peer_communicators(
+  std::vector<int> const& devices) {
+  CUDF_EXPECTS(not devices.empty(), "A communicator needs at least one rank");
+  int previous = 0;
+  CUDA_TRY(cudaGetDevice(&previous));
+
+  auto group = std::make_shared<peer_group>(devices);
+  std::vector<std::unique_ptr<communicator>> communicators;
+  for (std::size_t rank = 0; rank < devices.size(); ++rank) {
+    CUDA_TRY(cudaSetDevice(devices[rank]));
+    for (auto peer : devices) {
+      if (peer == devices[rank]) { continue; }
+      int can_access = 0;
+      CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, devices[rank], peer));
+      if (can_access == 0) { continue; }
+      auto const result = cudaDeviceEnablePeerAccess(peer, 0);
+      if (result == cudaErrorPeerAccessAlreadyEnabled) {
+        cudaGetLastError();  // Clears the error
+      } else {
+        CUDA_TRY(result);
+      }
+    }
+    communicators.push_back(std::make_unique<peer_communicator>(group, static_cast<int>(rank)));
+  }
+
+  CUDA_TRY(cudaSetDevice(previous));
+  return communicators;
+}
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               communicator& comm,
+                               hash_id hash_function,
+                               uint32_t seed,
+                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  auto const num_ranks = comm.size();
+
+  // Pack the partitions into one buffer, which is all that is kept while they
+  // are transferred
+  rmm::device_buffer buffer;
+  std::vector<packed_table> sends;
+  {
+    auto const partitioned = hash_partition(input, columns_to_hash, num_ranks, hash_function, seed);
+    auto const& offsets    = partitioned.second;
+    std::vector<size_type> const splits(offsets.begin() + 1, offsets.begin() + num_ranks);
+    auto const sizes = contiguous_split_sizes(partitioned.first->view(), splits);
+    buffer = rmm::device_buffer(std::accumulate(sizes.begin(), sizes.end(), std::size_t{0}));
+    sends  = contiguous_split(partitioned.first->view(), splits, buffer.data(), buffer.size());
+  }
+
+  auto const received = comm.all_to_all(buffer.data(), sends, rmm::mr::get_default_resource(), 0);
+  buffer              = rmm::device_buffer{};
+
+  std::vector<table_view> views;
+  for (auto const& partition : received) {
+    views.push_back(unpack(partition.metadata, partition.data.data()));
+  }
+  return concatenate(views, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/pipeline.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+namespace cudf {
+namespace experimental {
+namespace {
+
+class parquet_source : public pipeline_source {
+ public:
+  parquet_source(io::read_parquet_args const& args,
+                 size_t chunk_read_limit,
+                 rmm::mr::device_memory_resource* mr)
+    : _reader(args, chunk_read_limit, mr) {}
+
+  bool has_next() override { return _reader.has_next(); }
+
+  std::unique_ptr<table> next(cudaStream_t stream) override {
+    return _reader.read_chunk(stream).tbl;
+  }
+
+ private:
+  io::chunked_parquet_reader _reader;
+};
+
+class csv_source : public pipeline_source {
+ public:
+  csv_source(io::read_csv_args const& args, size_t chunk_size, rmm::mr::device_memory_resource* mr)
+    : _reader(args, chunk_size, mr) {}
+
+  bool has_next() override { return _reader.has_next(); }
+
+  std::unique_ptr<table> next(cudaStream_t stream) override {
+    return _reader.read_chunk(stream).tbl;
+  }
+
+ private:
+  io::chunked_csv_reader _reader;
+};
+
+/**
+ * @brief The chunks read ahead by the reader thread, waiting to be consumed
+ */
+struct chunk_queue {
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::unique_ptr<table>> chunks;
+  bool done      = false;  ///< The reader thread has stopped
+  bool cancelled = false;  ///< The reader thread must stop
+  std::exception_ptr error;
+};
+
+/**
+ * @brief Reads the chunks of `source` into `queue` until the source is
+ * exhausted or the queue is cancelled
+ */
+void read_chunks(pipeline_source& source,
+                 chunk_queue& queue,
+                 size_type max_chunks_in_flight,
+                 int device,
+                 cudaStream_t stream) {
+  try {
+    CUDA_TRY(cudaSetDevice(device));
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.condition.wait(lock, [&] {
+          return queue.cancelled or
+                 queue.chunks.size() < static_cast<size_t>(max_chunks_in_flight);
+        });
+        if (queue.cancelled) { break; }
+      }
+      if (not source.has_next()) { break; }
+      auto chunk = source.next(stream);
+      // Only this thread waits for the read, so the consumer never blocks on it
+      CUDF_STREAM_SYNC(stream);
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.chunks.push_back(std::move(chunk));
+      queue.condition.notify_all();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.error = std::current_exception();
+  }
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.done = true;
+  queue.condition.notify_all();
+}
+
+/**
+ * @brief Owns the stream of the reader thread
+ *
+ * The chunks were allocated on the stream, so it outlives them.
+ */
+struct reader_stream {
+  cudaStream_t stream{};
+  cudaEvent_t consumed{};  ///< Recorded on the default stream once a chunk is consumed
+  reader_stream() {
+    CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    CUDA_TRY(cudaEventCreateWithFlags(&consumed, cudaEventDisableTiming));
+  }
+  ~reader_stream() {
+    cudaEventDestroy(consumed);
+    cudaStreamDestroy(stream);
+  }
+};
+
+/**
+ * @brief Destroys a consumed chunk, also when the sink throws
+ *
+ * The memory of the chunk is freed on the reader stream, where a pool
+ * resource can hand it to the next chunk right away. The reader stream first
+ * waits for the kernels still reading the chunk on the default stream.
+ */
+struct chunk_releaser {
+  std::unique_ptr<table> chunk;
+  reader_stream const& stream;
+  void release() {
+    if (chunk == nullptr) { return; }
+    // Errors are left to the following CUDA calls, as this runs while unwinding
+    cudaEventRecord(stream.consumed, 0);
+    cudaStreamWaitEvent(stream.stream, stream.consumed, 0);
+    chunk.reset();
+  }
+  ~chunk_releaser() { release(); }
+};
+
+/**
+ * @brief Cancels and joins the reader thread, also when the sink throws
+ */
+struct reader_thread {
+  chunk_queue& queue;
+  std::thread thread;
+  ~reader_thread() {
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.cancelled = true;
+      queue.condition.notify_all();
+    }
+    thread.join();
+  }
+};
+
+/**
+ * @brief Passes the kept rows and columns of `chunk`, followed by the
+ * projections, to `sink`
+ */
+void consume_chunk(std::unique_ptr<table>&& chunk,
+                   pipeline_sink& sink,
+                   pipeline_options const& options,
+                   reader_stream const& stream,
+                   rmm::mr::device_memory_resource* mr) {
+  chunk_releaser releaser{std::move(chunk), stream};
+  table_view kept = releaser.chunk->view();
+  std::unique_ptr<table> filtered;
+  if (options.filter != nullptr) {
+    auto columns = options.columns;
+    if (columns.empty()) {
+      columns.resize(kept.num_columns());
+      std::iota(columns.begin(), columns.end(), 0);
+    }
+    filtered = filter_and_select(kept, *options.filter, columns, mr);
+    releaser.release();
+    kept = filtered->view();
+  } else if (not options.columns.empty()) {
+    kept = kept.select(options.columns);
+  }
+
+  if (options.projections.empty()) {
+    sink.consume(kept);
+  } else {
+    std::vector<std::unique_ptr<column>> projected;
+    std::vector<column_view> views(kept.begin(), kept.end());
+    for (auto projection : options.projections) {
+      projected.push_back(compute_column(kept, *projection, mr));
+      views.push_back(projected.back()->view());
+    }
+    sink.consume(table_view(views));
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<pipeline_source> make_parquet_source(io::read_parquet_args const& args,
+                                                     size_t chunk_read_limit,
+                                                     rmm::mr::device_memory_resource* mr) {
+  return std::make_unique<parquet_source>(args, chunk_read_limit, mr);
+}
+
+std::unique_ptr<pipeline_source> make_csv_source(io::read_csv_args const& args,
+                                                 size_t chunk_size,
+                                                 rmm::mr::device_memory_resource* mr) {
+  return std::make_unique<csv_source>(args, chunk_size, mr);
+}
+
+void groupby_sink::consume(table_view const& chunk) {
+  _groupby.aggregate(chunk.select(_key_indices), chunk.select(_value_indices), _mr);
+}
+
+void join_probe_sink::consume(table_view const& chunk) {
+  _results.push_back(_join.inner_join(chunk, _probe_on, _columns_in_common, _mr));
+}
+
+void run_pipeline(pipeline_source& source,
+                  pipeline_sink& sink,
+                  pipeline_options const& options,
+                  rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(options.max_chunks_in_flight > 0, "max_chunks_in_flight must be positive");
+
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  reader_stream stream;
+  chunk_queue queue;
+  {
+    reader_thread reader{queue,
+                         std::thread(read_chunks,
+                                     std::ref(source),
+                                     std::ref(queue),
+                                     options.max_chunks_in_flight,
+                                     device,
+                                     stream.stream)};
+    while (true) {
+      std::unique_ptr<table> chunk;
+      {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.condition.wait(lock, [&] { return queue.done or not queue.chunks.empty(); });
+        if (queue.chunks.empty()) { break; }
+        chunk = std::move(queue.chunks.front());
+        queue.chunks.pop_front();
+        queue.condition.notify_all();
+      }
+      consume_chunk(std::move(chunk), sink, options, stream, mr);
+    }
+  }
+  if (queue.error) { std::rethrow_exception(queue.error); }
+}
+
+}  // namespace experimental
+}  // namespace cudf
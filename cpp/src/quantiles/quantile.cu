@@ -92,7 +92,8 @@ struct quantile_functor {
           return select_quantile_validity(sorted_validity, size, q, interp);
         },
         stream,
-        mr);
+        mr,
+        null_count_policy::DEFER);
 
       output->set_null_mask(std::move(mask), null_count);
     }
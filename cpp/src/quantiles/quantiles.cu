@@ -22,7 +22,9 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <quantiles/quantiles_util.hpp>
+#include <quantiles/radix_select.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -49,6 +51,25 @@ std::unique_ptr<table> quantiles(table_view const& input,
   return detail::gather(input, quantile_idx_iter, quantile_idx_iter + q.size(), false, mr);
 }
 
+/**
+ * @brief Computes the quantile rows of a single column by selecting the rows of
+ * their ranks, which takes a few passes over the column instead of a sort.
+ */
+std::unique_ptr<table> select_quantiles(table_view const& input,
+                                        std::vector<double> const& q,
+                                        interpolation interp,
+                                        order column_order,
+                                        null_order null_precedence,
+                                        rmm::mr::device_memory_resource* mr) {
+  std::vector<size_type> ranks(q.size());
+  std::transform(q.begin(), q.end(), ranks.begin(), [interp, size = input.num_rows()](double q) {
+    return detail::select_quantile<size_type>([](size_type idx) { return idx; }, size, q, interp);
+  });
+
+  auto const rows = detail::radix_select(input.column(0), ranks, column_order, null_precedence);
+  return detail::gather(input, rows.begin(), rows.end(), false, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> quantiles(table_view const& input,
@@ -69,6 +90,17 @@ std::unique_ptr<table> quantiles(table_view const& input,
 
   if (is_input_sorted == sorted::YES) {
     return detail::quantiles(input, thrust::make_counting_iterator<size_type>(0), q, interp, mr);
+  } else if (input.num_columns() == 1 and column_order.size() <= 1 and
+             null_precedence.size() <= 1 and
+             q.size() <= static_cast<size_t>(detail::max_radix_select_ranks) and
+             detail::is_radix_selectable(input.column(0).type())) {
+    return detail::select_quantiles(input,
+                                    q,
+                                    interp,
+                                    column_order.empty() ? order::ASCENDING : column_order[0],
+                                    null_precedence.empty() ? null_order::BEFORE
+                                                            : null_precedence[0],
+                                    mr);
   } else {
     auto sorted_idx = detail::sorted_order(input, column_order, null_precedence);
     return detail::quantiles(input, sorted_idx->view().data<size_type>(), q, interp, mr);
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <quantiles/radix_select.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <thrust/fill.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+constexpr int radix_bits                    = 8;
+constexpr int radix_size                    = 1 << radix_bits;
+constexpr size_type select_block_size       = 256;
+constexpr size_type select_items_per_thread = 16;
+
+/**
+ * @brief The digits of a rank found so far: the keys of the candidate elements
+ * are `prefix` on the bits set in `mask`.
+ */
+struct radix_target {
+  uint64_t prefix;
+  uint64_t mask;
+};
+
+__device__ inline uint64_t signed_key(int64_t value, int bits) {
+  return static_cast<uint64_t>(value) ^ (uint64_t{1} << (bits - 1));
+}
+
+__device__ inline uint64_t float_key(uint64_t bits, uint64_t sign) {
+  return (bits & sign) ? ~bits : bits | sign;
+}
+
+/**
+ * @brief Order-preserving unsigned key of a value, in the most significant
+ * `8 * sizeof(T)` bits of a 64-bit key
+ */
+template <typename T, typename Enable = void>
+struct radix_key;
+
+template <typename T>
+struct radix_key<T, std::enable_if_t<std::is_integral<T>::value>> {
+  __device__ uint64_t operator()(T value) const {
+    constexpr int bits = 8 * sizeof(T);
+    auto const key     = std::is_signed<T>::value
+                       ? signed_key(static_cast<int64_t>(value), bits)
+                       : static_cast<uint64_t>(value);
+    return (bits == 64) ? key : (key & ((uint64_t{1} << bits) - 1)) << (64 - bits);
+  }
+};
+
+template <>
+struct radix_key<float> {
+  __device__ uint64_t operator()(float value) const {
+    // NaNs are greater than all the other values, -0.0 is equivalent to 0.0
+    if (isnan(value)) { return std::numeric_limits<uint64_t>::max(); }
+    if (value == 0) { value = 0; }
+    auto const bits = static_cast<uint64_t>(__float_as_uint(value));
+    return float_key(bits, uint64_t{1} << 31) << 32;
+  }
+};
+
+template <>
+struct radix_key<double> {
+  __device__ uint64_t operator()(double value) const {
+    if (isnan(value)) { return std::numeric_limits<uint64_t>::max(); }
+    if (value == 0) { value = 0; }
+    auto const bits = static_cast<uint64_t>(__double_as_longlong(value));
+    return float_key(bits, uint64_t{1} << 63);
+  }
+};
+
+template <typename T>
+struct radix_key<T, std::enable_if_t<is_timestamp<T>()>> {
+  __device__ uint64_t operator()(T value) const {
+    return radix_key<typename T::rep>{}(value.time_since_epoch().count());
+  }
+};
+
+/**
+ * @brief Key of the element `i` of `input` in the requested order
+ */
+template <typename T>
+__device__ inline uint64_t element_key(column_device_view const& input,
+                                       size_type i,
+                                       bool descending) {
+  auto const key = radix_key<T>{}(input.element<T>(i));
+  return descending ? ~key : key;
+}
+
+/**
+ * @brief Counts the digits at `shift` of the valid elements that are
+ * candidates of each target
+ */
+template <typename T>
+__global__ void count_digits(column_device_view input,
+                             bool descending,
+                             radix_target const* targets,
+                             int num_targets,
+                             int shift,
+                             size_type* histograms) {
+  __shared__ size_type block_histograms[max_radix_select_ranks * radix_size];
+  __shared__ radix_target block_targets[max_radix_select_ranks];
+  for (int i = threadIdx.x; i < num_targets * radix_size; i += blockDim.x) {
+    block_histograms[i] = 0;
+  }
+  if (threadIdx.x < num_targets) { block_targets[threadIdx.x] = targets[threadIdx.x]; }
+  __syncthreads();
+
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < input.size();
+       i += blockDim.x * gridDim.x) {
+    if (input.is_null(i)) { continue; }
+    auto const key   = element_key<T>(input, i, descending);
+    auto const digit = static_cast<int>((key >> shift) & (radix_size - 1));
+    for (int t = 0; t < num_targets; ++t) {
+      if ((key & block_targets[t].mask) == block_targets[t].prefix) {
+        atomicAdd(&block_histograms[t * radix_size + digit], 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < num_targets * radix_size; i += blockDim.x) {
+    if (block_histograms[i] != 0) { atomicAdd(&histograms[i], block_histograms[i]); }
+  }
+}
+
+/**
+ * @brief Finds the first valid row of the key of each target, and the first
+ * null row
+ */
+template <typename T>
+__global__ void find_rows(column_device_view input,
+                          bool descending,
+                          radix_target const* targets,
+                          int num_targets,
+                          size_type* rows,
+                          size_type* null_row) {
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < input.size();
+       i += blockDim.x * gridDim.x) {
+    if (input.is_null(i)) {
+      atomicMin(null_row, i);
+      continue;
+    }
+    auto const key = element_key<T>(input, i, descending);
+    for (int t = 0; t < num_targets; ++t) {
+      if (key == targets[t].prefix) { atomicMin(&rows[t], i); }
+    }
+  }
+}
+
+struct is_radix_selectable_impl {
+  template <typename T>
+  bool operator()() {
+    return is_numeric<T>() or is_timestamp<T>();
+  }
+};
+
+struct radix_select_dispatch {
+  template <typename T>
+  std::enable_if_t<not(is_numeric<T>() or is_timestamp<T>()), void> operator()(
+    column_view const&, std::vector<size_type> const&, bool, size_type*, size_type*, cudaStream_t) {
+    CUDF_FAIL("Radix select supports only numeric and timestamp types");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_numeric<T>() or is_timestamp<T>(), void> operator()(
+    column_view const& input,
+    std::vector<size_type> const& valid_ranks,
+    bool descending,
+    size_type* rows,
+    size_type* null_row,
+    cudaStream_t stream) {
+    auto const d_input    = column_device_view::create(input, stream);
+    auto const grid       = grid_1d{input.size(), select_block_size, select_items_per_thread};
+    int const num_targets = valid_ranks.size();
+
+    std::vector<radix_target> h_targets(num_targets, radix_target{0, 0});
+    std::vector<size_type> remaining(valid_ranks);
+    rmm::device_vector<radix_target> targets(h_targets);
+    if (num_targets > 0) {
+      rmm::device_vector<size_type> histograms(num_targets * radix_size);
+      std::vector<size_type> h_histograms(histograms.size());
+      auto exec = rmm::exec_policy(stream);
+      for (int shift = 64 - radix_bits; shift >= 64 - 8 * static_cast<int>(sizeof(T));
+           shift -= radix_bits) {
+        thrust::fill(exec->on(stream), histograms.begin(), histograms.end(), 0);
+        count_digits<T><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+          *d_input, descending, targets.data().get(), num_targets, shift, histograms.data().get());
+        CUDA_TRY(cudaMemcpyAsync(h_histograms.data(),
+                                 histograms.data().get(),
+                                 h_histograms.size() * sizeof(size_type),
+                                 cudaMemcpyDeviceToHost,
+                                 stream));
+        CUDF_STREAM_SYNC(stream);
+
+        // The digit of each target is the one whose elements hold its rank
+        for (int t = 0; t < num_targets; ++t) {
+          auto const* histogram = h_histograms.data() + t * radix_size;
+          int digit             = 0;
+          while (digit < radix_size - 1 and remaining[t] >= histogram[digit]) {
+            remaining[t] -= histogram[digit++];
+          }
+          h_targets[t].prefix |= static_cast<uint64_t>(digit) << shift;
+          h_targets[t].mask |= static_cast<uint64_t>(radix_size - 1) << shift;
+        }
+        CUDA_TRY(cudaMemcpyAsync(targets.data().get(),
+                                 h_targets.data(),
+                                 h_targets.size() * sizeof(radix_target),
+                                 cudaMemcpyHostToDevice,
+                                 stream));
+      }
+    }
+
+    find_rows<T><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      *d_input, descending, targets.data().get(), num_targets, rows, null_row);
+  }
+};
+
+}  // namespace
+
+bool is_radix_selectable(data_type type) {
+  return experimental::type_dispatcher(type, is_radix_selectable_impl{});
+}
+
+rmm::device_vector<size_type> radix_select(column_view const& input,
+                                           std::vector<size_type> const& ranks,
+                                           order column_order,
+                                           null_order null_precedence,
+                                           cudaStream_t stream) {
+  CUDF_EXPECTS(ranks.size() <= static_cast<size_t>(max_radix_select_ranks),
+               "Too many ranks to select at once");
+  CUDF_EXPECTS(std::all_of(ranks.begin(),
+                           ranks.end(),
+                           [size = input.size()](size_type r) { return r >= 0 && r < size; }),
+               "Ranks must be in [0, input.size())");
+  if (ranks.empty()) { return rmm::device_vector<size_type>{}; }
+
+  // Nulls are ordered before the other elements when they compare less in
+  // ascending order, or greater in descending order
+  auto const descending  = column_order == order::DESCENDING;
+  auto const nulls_first = (null_precedence == null_order::BEFORE) != descending;
+  auto const null_count  = input.null_count();
+  auto const num_valid   = input.size() - null_count;
+
+  // The ranks of valid elements are ranks among the valid elements; the other
+  // ranks are the ones of nulls, all found at the first null row
+  std::vector<size_type> valid_ranks;
+  std::vector<int> targets(ranks.size());
+  for (size_t i = 0; i < ranks.size(); ++i) {
+    auto const valid_rank = nulls_first ? ranks[i] - null_count : ranks[i];
+    if (valid_rank >= 0 and valid_rank < num_valid) {
+      targets[i] = valid_ranks.size();
+      valid_ranks.push_back(valid_rank);
+    } else {
+      targets[i] = -1;
+    }
+  }
+
+  rmm::device_vector<size_type> rows(valid_ranks.size() + 1, input.size());
+  type_dispatcher(input.type(),
+                  radix_select_dispatch{},
+                  input,
+                  valid_ranks,
+                  descending,
+                  rows.data().get(),
+                  rows.data().get() + valid_ranks.size(),
+                  stream);
+
+  std::vector<size_type> h_rows(rows.size());
+  CUDA_TRY(cudaMemcpyAsync(h_rows.data(),
+                           rows.data().get(),
+                           rows.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  std::vector<size_type> h_result(ranks.size());
+  std::transform(targets.begin(), targets.end(), h_result.begin(), [&](int t) {
+    return t < 0 ? h_rows.back() : h_rows[t];
+  });
+  return rmm::device_vector<size_type>(h_result);
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
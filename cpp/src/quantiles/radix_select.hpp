@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief The largest number of ranks `radix_select` finds in one set of passes
+ */
+constexpr size_type max_radix_select_ranks = 8;
+
+/**
+ * @brief Indicates whether `radix_select` supports the type `type`
+ *
+ * The numeric and timestamp types are supported.
+ */
+bool is_radix_selectable(data_type type);
+
+/**
+ * @brief Finds the rows at the given ranks of the sorted order of `input`
+ * without sorting it.
+ *
+ * The element of each rank is found digit by digit, from the most significant
+ * byte of an order-preserving key of the elements: each pass over `input`
+ * counts the elements of each digit among the ones that match the digits found
+ * so far. A rank is found in as many passes as the key has bytes, plus one
+ * pass finding a row of the element.
+ *
+ * The order is the one of `sorted_order` with `column_order` and
+ * `null_precedence`: NaNs are greater than the other floating-point values and
+ * `-0.0` is equivalent to `0.0`. The row found for equivalent elements is the
+ * first one.
+ *
+ * @throws cudf::logic_error if `input` is not of a radix selectable type
+ * @throws cudf::logic_error if there are more than `max_radix_select_ranks`
+ * ranks or a rank is not in `[0, input.size())`
+ *
+ * @param input The column to select the rows of
+ * @param ranks The ranks in the sorted order of `input` of the rows to find
+ * @param column_order The order of the elements
+ * @param null_precedence The order of the nulls compared to the other elements
+ * @param stream CUDA stream on which to execute kernels
+ * @return The index of the row of each rank
+ */
+rmm::device_vector<size_type> radix_select(column_view const& input,
+                                           std::vector<size_type> const& ranks,
+                                           order column_order,
+                                           null_order null_precedence,
+                                           cudaStream_t stream = 0);
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
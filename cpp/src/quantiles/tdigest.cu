@@ -0,0 +1,906 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/tdigest.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <cub/block/block_radix_sort.cuh>
+#include <cub/block/block_reduce.cuh>
+#include <cub/block/block_scan.cuh>
+
+#include <math_constants.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+// Children of a column of t-digests, and of its centroids
+constexpr size_type centroids_column_index{0};
+constexpr size_type min_column_index{1};
+constexpr size_type max_column_index{2};
+constexpr size_type mean_column_index{0};
+constexpr size_type weight_column_index{1};
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+constexpr int digest_block_size{256};
+constexpr int items_per_thread{8};
+constexpr size_type tile_size{digest_block_size * items_per_thread};
+
+/**
+ * @brief Returns the centroid of a digest of `max_centroids` holding the
+ * quantile `q`
+ *
+ * The scale function `max_centroids * (asin(2q - 1) / pi + 1 / 2)` makes the
+ * centroids smaller towards the tails, where the quantiles need the most
+ * precision, e.g., P99 latencies.
+ */
+__device__ inline int centroid_index(double q, int max_centroids) {
+  auto const k = max_centroids * (asin(2 * q - 1) / CUDART_PI + 0.5);
+  return min(static_cast<int>(k), max_centroids - 1);
+}
+
+/**
+ * @brief The device pointers to the children of a column of t-digests
+ */
+struct tdigest_view {
+  size_type num_digests;
+  size_type const* offsets;  ///< Offsets of the centroids of each digest
+  double const* means;
+  double const* weights;
+  double const* mins;
+  double const* maxs;
+};
+
+tdigest_view view_of(column_view const& digests) {
+  CUDF_EXPECTS(digests.type().id() == STRUCT && digests.num_children() == 3,
+               "Expected a column of t-digests");
+  structs_column_view const structs(digests);
+  auto const centroids_view = structs.sliced_child(centroids_column_index);
+  CUDF_EXPECTS(centroids_view.type().id() == LIST, "Expected a column of t-digests");
+  lists_column_view const centroids(centroids_view);
+  auto const centroid_fields = centroids.child();
+  CUDF_EXPECTS(centroid_fields.type().id() == STRUCT && centroid_fields.num_children() == 2,
+               "Expected a column of t-digests");
+  auto const means   = centroid_fields.child(mean_column_index);
+  auto const weights = centroid_fields.child(weight_column_index);
+  auto const mins    = structs.sliced_child(min_column_index);
+  auto const maxs    = structs.sliced_child(max_column_index);
+  CUDF_EXPECTS(means.type().id() == FLOAT64 && weights.type().id() == FLOAT64 &&
+                 mins.type().id() == FLOAT64 && maxs.type().id() == FLOAT64,
+               "Expected a column of t-digests");
+  return {digests.size(),
+          centroids.offsets().data<size_type>() + centroids.offset(),
+          means.data<double>() + centroid_fields.offset(),
+          weights.data<double>() + centroid_fields.offset(),
+          mins.data<double>(),
+          maxs.data<double>()};
+}
+
+/**
+ * @brief Copies the element at index 0 of `data` to the host
+ */
+template <typename T>
+T element_to_host(T const* data, cudaStream_t stream) {
+  T value{};
+  CUDA_TRY(cudaMemcpyAsync(&value, data, sizeof(T), cudaMemcpyDeviceToHost, stream));
+  CUDF_STREAM_SYNC(stream);
+  return value;
+}
+
+/**
+ * @brief Makes a column of t-digests from its children
+ */
+std::unique_ptr<column> make_tdigest_column(size_type num_digests,
+                                            std::unique_ptr<column>&& offsets,
+                                            std::unique_ptr<column>&& means,
+                                            std::unique_ptr<column>&& weights,
+                                            std::unique_ptr<column>&& mins,
+                                            std::unique_ptr<column>&& maxs,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream) {
+  auto const num_centroids = means->size();
+  std::vector<std::unique_ptr<column>> centroid_fields;
+  centroid_fields.push_back(std::move(means));
+  centroid_fields.push_back(std::move(weights));
+  auto centroids = make_lists_column(
+    num_digests,
+    std::move(offsets),
+    make_structs_column(
+      num_centroids, std::move(centroid_fields), 0, rmm::device_buffer{0, stream, mr}, stream, mr),
+    0,
+    rmm::device_buffer{0, stream, mr},
+    stream,
+    mr);
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(std::move(centroids));
+  children.push_back(std::move(mins));
+  children.push_back(std::move(maxs));
+  return make_structs_column(
+    num_digests, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
+std::unique_ptr<column> make_empty_tdigest_column(rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream) {
+  auto offsets = make_numeric_column(data_type{INT32}, 1, mask_state::UNALLOCATED, stream, mr);
+  CUDA_TRY(
+    cudaMemsetAsync(offsets->mutable_view().data<size_type>(), 0, sizeof(size_type), stream));
+  auto make_empty = [&]() {
+    return make_numeric_column(data_type{FLOAT64}, 0, mask_state::UNALLOCATED, stream, mr);
+  };
+  return make_tdigest_column(
+    0, std::move(offsets), make_empty(), make_empty(), make_empty(), make_empty(), mr, stream);
+}
+
+/**
+ * @brief Digests each tile of `tile_size` values of a segment of `values`
+ *
+ * The block sorts the finite, non-null values of its tile in shared memory
+ * and compresses them into at most `max_centroids` centroids, written from
+ * `tile * max_tile_centroids` in `means` and `weights`. It also writes the
+ * number of centroids, the segment, and the smallest and largest value of the
+ * tile, or infinities for a tile without values.
+ */
+template <typename T, bool has_nulls>
+__global__ void __launch_bounds__(digest_block_size)
+  digest_tiles(column_device_view values,
+               size_type const* offsets,
+               size_type const* tile_offsets,
+               size_type num_segments,
+               int max_centroids,
+               size_type max_tile_centroids,
+               double* means,
+               double* weights,
+               size_type* centroid_counts,
+               size_type* tile_labels,
+               double* mins,
+               double* maxs) {
+  using block_sort     = cub::BlockRadixSort<double, digest_block_size, items_per_thread>;
+  using block_reduce   = cub::BlockReduce<size_type, digest_block_size>;
+  using block_sum_scan = cub::BlockScan<double, digest_block_size>;
+  using block_int_scan = cub::BlockScan<size_type, digest_block_size>;
+  __shared__ union {
+    typename block_sort::TempStorage sort;
+    typename block_reduce::TempStorage reduce;
+    typename block_sum_scan::TempStorage sum_scan;
+    typename block_int_scan::TempStorage int_scan;
+  } temp_storage;
+  __shared__ double prefix_sums[tile_size];
+  __shared__ size_type tile_count;
+
+  size_type const tile = blockIdx.x;
+  size_type const segment =
+    thrust::upper_bound(thrust::seq, tile_offsets, tile_offsets + num_segments + 1, tile) -
+    tile_offsets - 1;
+  size_type const begin = offsets[segment] + (tile - tile_offsets[segment]) * tile_size;
+  size_type const end   = min(begin + tile_size, offsets[segment + 1]);
+
+  // The padding and the skipped values sort after the values of the tile
+  double keys[items_per_thread];
+  size_type thread_count = 0;
+  for (int i = 0; i < items_per_thread; ++i) {
+    size_type const row = begin + i * digest_block_size + threadIdx.x;
+    keys[i]             = infinity;
+    if (row < end && (not has_nulls || values.is_valid_nocheck(row))) {
+      auto const value = static_cast<double>(values.element<T>(row));
+      if (isfinite(value)) {
+        keys[i] = value;
+        ++thread_count;
+      }
+    }
+  }
+  auto const count = block_reduce(temp_storage.reduce).Sum(thread_count);
+  if (threadIdx.x == 0) { tile_count = count; }
+  __syncthreads();
+  block_sort(temp_storage.sort).Sort(keys);
+  __syncthreads();
+  size_type const n = tile_count;
+
+  // The sum of the values of a range of ranks is a difference of prefix sums
+  double sums[items_per_thread];
+  block_sum_scan(temp_storage.sum_scan).InclusiveSum(keys, sums);
+  for (int i = 0; i < items_per_thread; ++i) {
+    prefix_sums[threadIdx.x * items_per_thread + i] = sums[i];
+  }
+  __syncthreads();
+
+  // The centroids are the runs of ranks of the same centroid index
+  size_type first_ranks[items_per_thread];
+  size_type centroid_ordinals[items_per_thread];
+  bool is_last[items_per_thread];
+  for (int i = 0; i < items_per_thread; ++i) {
+    size_type const rank = threadIdx.x * items_per_thread + i;
+    auto const index_of  = [n, max_centroids](size_type r) {
+      return centroid_index((r + 0.5) / n, max_centroids);
+    };
+    bool const in_tile  = rank < n;
+    bool const is_first = in_tile && (rank == 0 || index_of(rank - 1) != index_of(rank));
+    is_last[i]          = in_tile && (rank == n - 1 || index_of(rank + 1) != index_of(rank));
+    first_ranks[i]       = is_first ? rank : 0;
+    centroid_ordinals[i] = is_first ? 1 : 0;
+  }
+  block_int_scan(temp_storage.int_scan).InclusiveScan(first_ranks, first_ranks, cub::Max());
+  __syncthreads();
+  block_int_scan(temp_storage.int_scan).InclusiveSum(centroid_ordinals, centroid_ordinals);
+
+  auto const out = static_cast<size_t>(tile) * max_tile_centroids;
+  for (int i = 0; i < items_per_thread; ++i) {
+    size_type const rank = threadIdx.x * items_per_thread + i;
+    if (not is_last[i]) { continue; }
+    auto const first  = first_ranks[i];
+    auto const sum    = prefix_sums[rank] - (first > 0 ? prefix_sums[first - 1] : 0);
+    auto const weight = rank - first + 1;
+    auto const j      = centroid_ordinals[i] - 1;
+    means[out + j]    = sum / weight;
+    weights[out + j]  = weight;
+    if (rank == n - 1) {
+      centroid_counts[tile] = centroid_ordinals[i];
+      maxs[tile]            = keys[i];
+    }
+  }
+  if (threadIdx.x == 0) {
+    tile_labels[tile] = segment;
+    mins[tile]        = (n > 0) ? keys[0] : infinity;
+    if (n == 0) {
+      centroid_counts[tile] = 0;
+      maxs[tile]            = -infinity;
+    }
+  }
+}
+
+/**
+ * @brief Segment of the tile of each slot of the tile centroids
+ */
+struct slot_label {
+  size_type const* tile_labels;
+  size_type max_tile_centroids;
+
+  __device__ size_type operator()(size_type slot) const {
+    return tile_labels[slot / max_tile_centroids];
+  }
+};
+
+/**
+ * @brief Whether a slot of the tile centroids holds a centroid
+ */
+struct is_centroid_slot {
+  size_type const* centroid_counts;
+  size_type max_tile_centroids;
+
+  __device__ bool operator()(size_type slot) const {
+    return slot % max_tile_centroids < centroid_counts[slot / max_tile_centroids];
+  }
+};
+
+/**
+ * @brief Centroid index in the merged digest of its segment of each centroid
+ */
+struct merged_centroid_index {
+  size_type const* labels;
+  double const* weights;
+  double const* preceding_weights;
+  double const* total_weights;
+  int max_centroids;
+
+  __device__ int operator()(size_type i) const {
+    auto const q = (preceding_weights[i] + weights[i] / 2) / total_weights[labels[i]];
+    return centroid_index(q, max_centroids);
+  }
+};
+
+using double_pair = thrust::tuple<double, double>;
+
+struct weighted_mean_terms {
+  __device__ double_pair operator()(double_pair mean_and_weight) const {
+    auto const weight = thrust::get<1>(mean_and_weight);
+    return {thrust::get<0>(mean_and_weight) * weight, weight};
+  }
+};
+
+struct add_pairs {
+  __device__ double_pair operator()(double_pair lhs, double_pair rhs) const {
+    return {thrust::get<0>(lhs) + thrust::get<0>(rhs), thrust::get<1>(lhs) + thrust::get<1>(rhs)};
+  }
+};
+
+struct min_and_max {
+  __device__ double_pair operator()(double_pair lhs, double_pair rhs) const {
+    return {fmin(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+            fmax(thrust::get<1>(lhs), thrust::get<1>(rhs))};
+  }
+};
+
+struct divide {
+  __device__ double operator()(double sum, double weight) const { return sum / weight; }
+};
+
+/**
+ * @brief Replaces the bounds of the segments without values by 0
+ */
+struct bound_or_zero {
+  double const* total_weights;
+
+  __device__ double operator()(size_type segment, double bound) const {
+    return total_weights[segment] > 0 ? bound : 0;
+  }
+};
+
+/**
+ * @brief Merges the centroids of each segment into the digest of the segment
+ *
+ * @param labels The segment of each centroid
+ * @param means The mean of each centroid
+ * @param weights The weight of each centroid
+ * @param part_labels The non-decreasing segments of the parts of the
+ * centroids, i.e., the tiles or the digests they come from
+ * @param part_bounds The smallest and largest value of each part, or
+ * `(inf, -inf)` if it has no value
+ */
+std::unique_ptr<column> merge_centroids(rmm::device_vector<size_type>& labels,
+                                        rmm::device_vector<double>& means,
+                                        rmm::device_vector<double>& weights,
+                                        rmm::device_vector<size_type> const& part_labels,
+                                        rmm::device_vector<double> const& part_mins,
+                                        rmm::device_vector<double> const& part_maxs,
+                                        size_type num_segments,
+                                        int max_centroids,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream) {
+  auto exec                = rmm::exec_policy(stream);
+  auto const num_centroids = static_cast<size_type>(labels.size());
+
+  // Sort the centroids by mean within each segment
+  thrust::sort_by_key(
+    exec->on(stream),
+    means.begin(),
+    means.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), weights.begin())));
+  thrust::stable_sort_by_key(
+    exec->on(stream),
+    labels.begin(),
+    labels.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(means.begin(), weights.begin())));
+
+  rmm::device_vector<double> total_weights(num_segments, 0);
+  rmm::device_vector<size_type> segments(num_segments);
+  {
+    rmm::device_vector<double> sums(num_segments);
+    auto const ends = thrust::reduce_by_key(exec->on(stream),
+                                            labels.begin(),
+                                            labels.end(),
+                                            weights.begin(),
+                                            segments.begin(),
+                                            sums.begin());
+    thrust::scatter(
+      exec->on(stream), sums.begin(), ends.second, segments.begin(), total_weights.begin());
+  }
+  rmm::device_vector<double> preceding_weights(num_centroids);
+  thrust::exclusive_scan_by_key(exec->on(stream),
+                                labels.begin(),
+                                labels.end(),
+                                weights.begin(),
+                                preceding_weights.begin());
+  rmm::device_vector<int> indices(num_centroids);
+  thrust::transform(exec->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_centroids),
+                    indices.begin(),
+                    merged_centroid_index{labels.data().get(),
+                                          weights.data().get(),
+                                          preceding_weights.data().get(),
+                                          total_weights.data().get(),
+                                          max_centroids});
+
+  // The centroids of the same index are merged into their weighted mean
+  rmm::device_vector<size_type> merged_labels(num_centroids);
+  rmm::device_vector<double> merged_sums(num_centroids);
+  rmm::device_vector<double> merged_weights(num_centroids);
+  auto const keys = thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), indices.begin()));
+  auto const terms = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(means.begin(), weights.begin())),
+    weighted_mean_terms{});
+  auto const merged_ends = thrust::reduce_by_key(
+    exec->on(stream),
+    keys,
+    keys + num_centroids,
+    terms,
+    thrust::make_zip_iterator(
+      thrust::make_tuple(merged_labels.begin(), thrust::make_discard_iterator())),
+    thrust::make_zip_iterator(thrust::make_tuple(merged_sums.begin(), merged_weights.begin())),
+    thrust::equal_to<thrust::tuple<size_type, int>>{},
+    add_pairs{});
+  auto const merged_labels_end = thrust::get<0>(merged_ends.first.get_iterator_tuple());
+  auto const num_merged =
+    static_cast<size_type>(thrust::distance(merged_labels.begin(), merged_labels_end));
+
+  auto merged_means =
+    make_numeric_column(data_type{FLOAT64}, num_merged, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(exec->on(stream),
+                    merged_sums.begin(),
+                    merged_sums.begin() + num_merged,
+                    merged_weights.begin(),
+                    merged_means->mutable_view().data<double>(),
+                    divide{});
+  auto merged_weights_column =
+    make_numeric_column(data_type{FLOAT64}, num_merged, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(exec->on(stream),
+               merged_weights.begin(),
+               merged_weights.begin() + num_merged,
+               merged_weights_column->mutable_view().data<double>());
+
+  rmm::device_vector<size_type> centroid_counts(num_segments, 0);
+  {
+    rmm::device_vector<size_type> counts(num_segments);
+    auto const ends = thrust::reduce_by_key(exec->on(stream),
+                                            merged_labels.begin(),
+                                            merged_labels.begin() + num_merged,
+                                            thrust::make_constant_iterator<size_type>(1),
+                                            segments.begin(),
+                                            counts.begin());
+    thrust::scatter(
+      exec->on(stream), counts.begin(), ends.second, segments.begin(), centroid_counts.begin());
+  }
+  auto offsets = cudf::strings::detail::make_offsets_child_column(
+    centroid_counts.begin(), centroid_counts.end(), mr, stream);
+
+  // The bounds of the segments, 0 for the segments without values
+  rmm::device_vector<double> segment_mins(num_segments, infinity);
+  rmm::device_vector<double> segment_maxs(num_segments, -infinity);
+  {
+    rmm::device_vector<double> reduced_mins(num_segments);
+    rmm::device_vector<double> reduced_maxs(num_segments);
+    auto const ends = thrust::reduce_by_key(
+      exec->on(stream),
+      part_labels.begin(),
+      part_labels.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(part_mins.begin(), part_maxs.begin())),
+      segments.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(reduced_mins.begin(), reduced_maxs.begin())),
+      thrust::equal_to<size_type>{},
+      min_and_max{});
+    auto const num_reduced = thrust::distance(segments.begin(), ends.first);
+    thrust::scatter(exec->on(stream),
+                    thrust::make_zip_iterator(
+                      thrust::make_tuple(reduced_mins.begin(), reduced_maxs.begin())),
+                    thrust::make_zip_iterator(thrust::make_tuple(
+                      reduced_mins.begin() + num_reduced, reduced_maxs.begin() + num_reduced)),
+                    segments.begin(),
+                    thrust::make_zip_iterator(
+                      thrust::make_tuple(segment_mins.begin(), segment_maxs.begin())));
+  }
+  auto make_bounds = [&](rmm::device_vector<double> const& bounds) {
+    auto column =
+      make_numeric_column(data_type{FLOAT64}, num_segments, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(exec->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_segments),
+                      bounds.begin(),
+                      column->mutable_view().data<double>(),
+                      bound_or_zero{total_weights.data().get()});
+    return column;
+  };
+
+  return make_tdigest_column(num_segments,
+                             std::move(offsets),
+                             std::move(merged_means),
+                             std::move(merged_weights_column),
+                             make_bounds(segment_mins),
+                             make_bounds(segment_maxs),
+                             mr,
+                             stream);
+}
+
+/**
+ * @brief Number of tiles of each segment
+ */
+struct tiles_of_segment {
+  size_type const* offsets;
+
+  __device__ size_type operator()(size_type segment) const {
+    return (offsets[segment + 1] - offsets[segment] + tile_size - 1) / tile_size;
+  }
+};
+
+struct make_tdigest_dispatch {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& offsets,
+                                     int max_centroids,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+    auto exec               = rmm::exec_policy(stream);
+    auto const num_segments = offsets.size() - 1;
+    auto const d_offsets    = offsets.data<size_type>();
+
+    rmm::device_vector<size_type> tile_offsets(num_segments + 1, 0);
+    auto const tile_counts =
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      tiles_of_segment{d_offsets});
+    thrust::inclusive_scan(
+      exec->on(stream), tile_counts, tile_counts + num_segments, tile_offsets.begin() + 1);
+    size_type const num_tiles = element_to_host(tile_offsets.data().get() + num_segments, stream);
+
+    // Digest each tile
+    auto const max_tile_centroids = std::min(static_cast<size_type>(max_centroids), tile_size);
+    auto const num_slots          = static_cast<size_t>(num_tiles) * max_tile_centroids;
+    rmm::device_vector<double> tile_means(num_slots);
+    rmm::device_vector<double> tile_weights(num_slots);
+    rmm::device_vector<size_type> centroid_counts(num_tiles);
+    rmm::device_vector<size_type> tile_labels(num_tiles);
+    rmm::device_vector<double> tile_mins(num_tiles);
+    rmm::device_vector<double> tile_maxs(num_tiles);
+    if (num_tiles > 0) {
+      auto const d_values = column_device_view::create(values, stream);
+      auto kernel =
+        values.has_nulls() ? digest_tiles<T, true> : digest_tiles<T, false>;
+      kernel<<<num_tiles, digest_block_size, 0, stream>>>(*d_values,
+                                                          d_offsets,
+                                                          tile_offsets.data().get(),
+                                                          num_segments,
+                                                          max_centroids,
+                                                          max_tile_centroids,
+                                                          tile_means.data().get(),
+                                                          tile_weights.data().get(),
+                                                          centroid_counts.data().get(),
+                                                          tile_labels.data().get(),
+                                                          tile_mins.data().get(),
+                                                          tile_maxs.data().get());
+      CHECK_CUDA(stream);
+    }
+
+    // Gather the centroids of the tiles
+    auto const num_centroids = thrust::reduce(
+      exec->on(stream), centroid_counts.begin(), centroid_counts.end(), size_type{0});
+    rmm::device_vector<size_type> labels(num_centroids);
+    rmm::device_vector<double> means(num_centroids);
+    rmm::device_vector<double> weights(num_centroids);
+    auto const slots = thrust::make_zip_iterator(thrust::make_tuple(
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      slot_label{tile_labels.data().get(), max_tile_centroids}),
+      tile_means.begin(),
+      tile_weights.begin()));
+    thrust::copy_if(
+      exec->on(stream),
+      slots,
+      slots + num_slots,
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), means.begin(), weights.begin())),
+      is_centroid_slot{centroid_counts.data().get(), max_tile_centroids});
+
+    return merge_centroids(labels,
+                           means,
+                           weights,
+                           tile_labels,
+                           tile_mins,
+                           tile_maxs,
+                           num_segments,
+                           max_centroids,
+                           mr,
+                           stream);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& offsets,
+                                     int max_centroids,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+    CUDF_FAIL("t-digests can only be built from arithmetic values");
+  }
+};
+
+void expect_valid_offsets(column_view const& offsets) {
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>(), "Offsets must be INT32");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets cannot have nulls");
+  CUDF_EXPECTS(offsets.size() > 0, "Offsets must hold at least one offset");
+}
+
+/**
+ * @brief Digest, among the `num_digests` of `offsets`, of each centroid or row
+ */
+struct row_of {
+  size_type const* offsets;
+  size_type num_rows;
+
+  __device__ size_type operator()(size_type index) const {
+    return thrust::upper_bound(thrust::seq, offsets, offsets + num_rows + 1, index) - offsets - 1;
+  }
+};
+
+/**
+ * @brief Segment of the digest of each centroid
+ */
+struct segment_of_centroid {
+  row_of digest_of_centroid;
+  row_of segment_of_digest;
+
+  __device__ size_type operator()(size_type centroid) const {
+    return segment_of_digest(digest_of_centroid(centroid));
+  }
+};
+
+/**
+ * @brief Bounds of the values of each digest, infinities for an empty digest
+ */
+struct digest_bound {
+  tdigest_view digests;
+  bool is_min;
+
+  __device__ double operator()(size_type row) const {
+    if (digests.offsets[row] == digests.offsets[row + 1]) {
+      return is_min ? infinity : -infinity;
+    }
+    return is_min ? digests.mins[row] : digests.maxs[row];
+  }
+};
+
+/**
+ * @brief Interpolates quantile `i % num_quantiles` of digest `i / num_quantiles`
+ *
+ * The quantile is computed as a linear interpolation of the sorted values,
+ * with every centroid standing for its weight of values at its mean, so the
+ * quantiles of a digest holding every value are exact.
+ */
+struct interpolate_quantile {
+  tdigest_view digests;
+  double const* cumulative_weights;  ///< From the first centroid of the digests
+  double const* quantiles;
+  size_type num_quantiles;
+
+  __device__ double center(size_type centroid) const {
+    return cumulative_weights[centroid - digests.offsets[0]] - digests.weights[centroid] / 2;
+  }
+
+  __device__ double operator()(size_type i) const {
+    auto const row   = i / num_quantiles;
+    auto const begin = digests.offsets[row];
+    auto const end   = digests.offsets[row + 1];
+    if (begin == end) { return 0; }
+    auto const total    = cumulative_weights[end - 1 - digests.offsets[0]];
+    auto const position = quantiles[i % num_quantiles] * (total - 1) + 0.5;
+
+    auto const first_center = center(begin);
+    if (position <= first_center) {
+      if (first_center <= 0.5) { return digests.means[begin]; }
+      auto const t = (position - 0.5) / (first_center - 0.5);
+      return digests.mins[row] + t * (digests.means[begin] - digests.mins[row]);
+    }
+    auto const last_center = center(end - 1);
+    if (position >= last_center) {
+      if (total - 0.5 <= last_center) { return digests.means[end - 1]; }
+      auto const t = (position - last_center) / (total - 0.5 - last_center);
+      return digests.means[end - 1] + t * (digests.maxs[row] - digests.means[end - 1]);
+    }
+    // center(lo) <= position < center(hi)
+    auto lo = begin;
+    auto hi = end - 1;
+    while (hi - lo > 1) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (center(mid) <= position) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    auto const t = (position - center(lo)) / (center(hi) - center(lo));
+    return digests.means[lo] + t * (digests.means[hi] - digests.means[lo]);
+  }
+};
+
+struct is_nonempty_digest {
+  size_type const* offsets;
+  size_type num_quantiles;
+
+  __device__ bool operator()(size_type i) const {
+    auto const row = i / num_quantiles;
+    return offsets[row] != offsets[row + 1];
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> make_tdigest(column_view const& values,
+                                     column_view const& offsets,
+                                     int max_centroids,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+  expect_valid_offsets(offsets);
+  CUDF_EXPECTS(max_centroids > 0, "A t-digest needs at least one centroid");
+  if (offsets.size() == 1) { return make_empty_tdigest_column(mr, stream); }
+  return experimental::type_dispatcher(
+    values.type(), make_tdigest_dispatch{}, values, offsets, max_centroids, mr, stream);
+}
+
+std::unique_ptr<column> merge_tdigests(column_view const& digests,
+                                       column_view const& offsets,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream) {
+  expect_valid_offsets(offsets);
+  CUDF_EXPECTS(max_centroids > 0, "A t-digest needs at least one centroid");
+  auto const digest = view_of(digests);
+  if (offsets.size() == 1) { return make_empty_tdigest_column(mr, stream); }
+  auto exec               = rmm::exec_policy(stream);
+  auto const num_segments = offsets.size() - 1;
+
+  size_type first_centroid = 0;
+  size_type end_centroid   = 0;
+  if (digest.num_digests > 0) {
+    first_centroid = element_to_host(digest.offsets, stream);
+    end_centroid   = element_to_host(digest.offsets + digest.num_digests, stream);
+  }
+  auto const num_centroids = end_centroid - first_centroid;
+  row_of const segment_of_digest{offsets.data<size_type>(), num_segments};
+
+  rmm::device_vector<size_type> labels(num_centroids);
+  thrust::transform(exec->on(stream),
+                    thrust::make_counting_iterator<size_type>(first_centroid),
+                    thrust::make_counting_iterator<size_type>(end_centroid),
+                    labels.begin(),
+                    segment_of_centroid{row_of{digest.offsets, digest.num_digests},
+                                        segment_of_digest});
+  rmm::device_vector<double> means(num_centroids);
+  rmm::device_vector<double> weights(num_centroids);
+  thrust::copy(exec->on(stream),
+               digest.means + first_centroid,
+               digest.means + end_centroid,
+               means.begin());
+  thrust::copy(exec->on(stream),
+               digest.weights + first_centroid,
+               digest.weights + end_centroid,
+               weights.begin());
+
+  rmm::device_vector<size_type> part_labels(digest.num_digests);
+  rmm::device_vector<double> part_mins(digest.num_digests);
+  rmm::device_vector<double> part_maxs(digest.num_digests);
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+  thrust::transform(
+    exec->on(stream), rows, rows + digest.num_digests, part_labels.begin(), segment_of_digest);
+  thrust::transform(exec->on(stream),
+                    rows,
+                    rows + digest.num_digests,
+                    part_mins.begin(),
+                    digest_bound{digest, true});
+  thrust::transform(exec->on(stream),
+                    rows,
+                    rows + digest.num_digests,
+                    part_maxs.begin(),
+                    digest_bound{digest, false});
+
+  return merge_centroids(labels,
+                         means,
+                         weights,
+                         part_labels,
+                         part_mins,
+                         part_maxs,
+                         num_segments,
+                         max_centroids,
+                         mr,
+                         stream);
+}
+
+std::unique_ptr<column> approx_quantiles(column_view const& digests,
+                                         std::vector<double> const& q,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  CUDF_EXPECTS(std::all_of(q.begin(), q.end(), [](double p) { return p >= 0 && p <= 1; }),
+               "Quantiles must be in [0, 1]");
+  auto const digest      = view_of(digests);
+  auto const num_results = digest.num_digests * static_cast<size_type>(q.size());
+  if (num_results == 0) { return make_numeric_column(data_type{FLOAT64}, 0); }
+  auto exec = rmm::exec_policy(stream);
+
+  // The cumulative weights of the centroids of each digest
+  auto const first_centroid = element_to_host(digest.offsets, stream);
+  auto const end_centroid   = element_to_host(digest.offsets + digest.num_digests, stream);
+  rmm::device_vector<size_type> labels(end_centroid - first_centroid);
+  thrust::transform(exec->on(stream),
+                    thrust::make_counting_iterator<size_type>(first_centroid),
+                    thrust::make_counting_iterator<size_type>(end_centroid),
+                    labels.begin(),
+                    row_of{digest.offsets, digest.num_digests});
+  rmm::device_vector<double> cumulative_weights(labels.size());
+  thrust::inclusive_scan_by_key(exec->on(stream),
+                                labels.begin(),
+                                labels.end(),
+                                digest.weights + first_centroid,
+                                cumulative_weights.begin());
+
+  rmm::device_vector<double> d_quantiles(q);
+  auto result =
+    make_numeric_column(data_type{FLOAT64}, num_results, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(exec->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_results),
+                    result->mutable_view().data<double>(),
+                    interpolate_quantile{digest,
+                                         cumulative_weights.data().get(),
+                                         d_quantiles.data().get(),
+                                         static_cast<size_type>(q.size())});
+
+  // The quantiles of empty digests are null
+  auto null_mask = valid_if(thrust::make_counting_iterator<size_type>(0),
+                            thrust::make_counting_iterator<size_type>(num_results),
+                            is_nonempty_digest{digest.offsets, static_cast<size_type>(q.size())},
+                            stream,
+                            mr);
+  if (null_mask.second > 0) { result->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> make_tdigest(column_view const& values,
+                                     int max_centroids,
+                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  rmm::device_vector<size_type> offsets(std::vector<size_type>{0, values.size()});
+  return detail::make_tdigest(
+    values,
+    column_view(data_type{INT32}, 2, offsets.data().get()),
+    max_centroids,
+    mr);
+}
+
+std::unique_ptr<column> merge_tdigests(column_view const& digests,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  rmm::device_vector<size_type> offsets(std::vector<size_type>{0, digests.size()});
+  return detail::merge_tdigests(
+    digests,
+    column_view(data_type{INT32}, 2, offsets.data().get()),
+    max_centroids,
+    mr);
+}
+
+std::unique_ptr<column> approx_quantiles(column_view const& digests,
+                                         std::vector<double> const& q,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::approx_quantiles(digests, q, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
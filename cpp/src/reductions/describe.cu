@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <io/statistics/column_stats.h>
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+io::statistics_dtype to_statistics_dtype(type_id id) {
+  switch (id) {
+    case BOOL8: return io::dtype_bool;
+    case INT8: return io::dtype_int8;
+    case INT16: return io::dtype_int16;
+    case INT32:
+    case TIMESTAMP_DAYS: return io::dtype_int32;
+    case INT64: return io::dtype_int64;
+    case TIMESTAMP_SECONDS:
+    case TIMESTAMP_MILLISECONDS:
+    case TIMESTAMP_MICROSECONDS:
+    case TIMESTAMP_NANOSECONDS: return io::dtype_timestamp64;
+    case FLOAT32: return io::dtype_float32;
+    case FLOAT64: return io::dtype_float64;
+    case STRING: return io::dtype_string;
+    default: CUDF_FAIL("Unsupported column type for describe");
+  }
+}
+
+/**
+ * @brief The device data of a column in the layout read by the statistics
+ * kernels, which index the column and its null mask from row 0
+ */
+struct statistics_source {
+  rmm::device_buffer null_mask;  ///< Copy of a null mask that is not at a word boundary
+  rmm::device_buffer strings;    ///< Pointer and length of each string
+  io::stats_column_desc desc{};
+
+  statistics_source(column_view const& col, cudaStream_t stream) {
+    desc.stats_dtype = to_statistics_dtype(col.type().id());
+    desc.num_rows    = col.size();
+    desc.ts_scale    = 0;
+    if (col.nullable()) {
+      if (col.offset() == 0) {
+        desc.valid_map_base = col.null_mask();
+      } else {
+        null_mask           = copy_bitmask(col, stream);
+        desc.valid_map_base = static_cast<bitmask_type const*>(null_mask.data());
+      }
+    }
+    if (desc.stats_dtype != io::dtype_string) {
+      desc.column_data_base = col.head<int8_t>() + col.offset() * size_of(col.type());
+    } else if (col.size() > 0) {
+      strings       = rmm::device_buffer(col.size() * sizeof(io::nvstrdesc_s), stream);
+      auto d_column = column_device_view::create(col, stream);
+      auto d_col    = *d_column;
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(col.size()),
+                        static_cast<io::nvstrdesc_s*>(strings.data()),
+                        [d_col] __device__(size_type idx) {
+                          if (d_col.is_null(idx)) { return io::nvstrdesc_s{nullptr, 0}; }
+                          auto const d_str = d_col.element<string_view>(idx);
+                          return io::nvstrdesc_s{d_str.data(),
+                                                 static_cast<size_t>(d_str.size_bytes())};
+                        });
+      desc.column_data_base = strings.data();
+    }
+  }
+};
+
+enum class statistic { NULL_COUNT, MIN, MAX, SUM };
+
+/**
+ * @brief Reads a statistic of the chunk of each output row of a column
+ *
+ * Rows `[0, num_chunks)` are the chunks of the column, which are followed by
+ * those of the other columns, and row `num_chunks` is the whole column, which
+ * is after the chunks of all the columns.
+ */
+template <typename T>
+struct chunk_statistic_fn {
+  io::statistics_chunk const* chunks;
+  size_type column;
+  size_type num_columns;
+  size_type num_chunks;
+  statistic stat;
+
+  __device__ io::statistics_chunk const& chunk(size_type row) const {
+    return chunks[row < num_chunks ? column * num_chunks + row : num_columns * num_chunks + column];
+  }
+
+  __device__ bool is_valid(size_type row) const {
+    auto const& ck = chunk(row);
+    return stat == statistic::NULL_COUNT ? true
+                                         : stat == statistic::SUM ? ck.has_sum != 0
+                                                                  : ck.has_minmax != 0;
+  }
+
+  __device__ T operator()(size_type row) const {
+    constexpr bool is_float = std::is_floating_point<T>::value;
+    auto const& ck          = chunk(row);
+    if (stat == statistic::NULL_COUNT) { return static_cast<T>(ck.null_count); }
+    if (stat == statistic::SUM) {
+      return is_float ? static_cast<T>(ck.sum.fp_val) : static_cast<T>(ck.sum.i_val);
+    }
+    auto const& value = stat == statistic::MIN ? ck.min_value : ck.max_value;
+    return is_float ? static_cast<T>(value.fp_val) : static_cast<T>(value.i_val);
+  }
+};
+
+template <typename T>
+std::unique_ptr<column> make_statistic_column(chunk_statistic_fn<T> fn,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream) {
+  size_type const num_rows = fn.num_chunks + 1;
+  auto valid               = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [fn] __device__(size_type row) { return fn.is_valid(row); },
+    stream,
+    mr);
+  auto result = make_numeric_column(data_type{experimental::type_to_id<T>()},
+                                    num_rows,
+                                    std::move(valid.first),
+                                    valid.second,
+                                    stream,
+                                    mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    result->mutable_view().data<T>(),
+                    fn);
+  return result;
+}
+
+/**
+ * @brief Returns the minimum or the maximum strings of each output row of a
+ * column
+ */
+std::unique_ptr<column> make_string_statistic_column(chunk_statistic_fn<int64_t> fn,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream) {
+  rmm::device_vector<thrust::pair<const char*, size_type>> strings(fn.num_chunks + 1);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(fn.num_chunks + 1),
+                    strings.begin(),
+                    [fn] __device__(size_type row) {
+                      using string_pair = thrust::pair<const char*, size_type>;
+                      if (!fn.is_valid(row)) { return string_pair{nullptr, 0}; }
+                      auto const& ck    = fn.chunk(row);
+                      auto const& value = fn.stat == statistic::MIN ? ck.min_value.str_val
+                                                                    : ck.max_value.str_val;
+                      return string_pair{value.ptr, static_cast<size_type>(value.length)};
+                    });
+  return make_strings_column(strings, stream, mr);
+}
+
+}  // namespace
+
+std::vector<column_description> describe(table_view const& input,
+                                         size_type chunk_size,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  CUDF_EXPECTS(chunk_size >= 0, "Invalid chunk size");
+  size_type const num_columns = input.num_columns();
+  size_type const num_rows    = input.num_rows();
+  if (num_columns == 0) { return {}; }
+  if (chunk_size == 0) { chunk_size = std::max(num_rows, 1); }
+  size_type const num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+
+  std::vector<statistics_source> sources;
+  sources.reserve(num_columns);
+  hostdevice_vector<io::stats_column_desc> descs(num_columns, stream);
+  hostdevice_vector<io::statistics_group> groups(std::max(num_columns * num_chunks, 1), stream);
+  hostdevice_vector<io::statistics_merge_group> merges(num_columns, stream);
+  for (size_type c = 0; c < num_columns; ++c) {
+    sources.emplace_back(input.column(c), stream);
+    descs[c] = sources.back().desc;
+    for (size_type k = 0; k < num_chunks; ++k) {
+      auto& group     = groups[c * num_chunks + k];
+      group.col       = descs.device_ptr(c);
+      group.start_row = k * chunk_size;
+      group.num_rows  = std::min(chunk_size, num_rows - k * chunk_size);
+    }
+    merges[c].col         = descs.device_ptr(c);
+    merges[c].start_chunk = c * num_chunks;
+    merges[c].num_chunks  = num_chunks;
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    descs.device_ptr(), descs.host_ptr(), descs.memory_size(), cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    groups.device_ptr(), groups.host_ptr(), groups.memory_size(), cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    merges.device_ptr(), merges.host_ptr(), merges.memory_size(), cudaMemcpyHostToDevice, stream));
+
+  // The chunks of each column, then the whole columns
+  rmm::device_vector<io::statistics_chunk> stat_chunks(num_columns * (num_chunks + 1));
+  auto const d_chunks = stat_chunks.data().get();
+  if (num_chunks > 0) {
+    CUDA_TRY(io::GatherColumnStatistics(
+      d_chunks, groups.device_ptr(), num_columns * num_chunks, stream));
+  }
+  CUDA_TRY(io::MergeColumnStatistics(
+    d_chunks + num_columns * num_chunks, d_chunks, merges.device_ptr(), num_columns, stream));
+
+  std::vector<column_description> results(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto& result     = results[c];
+    auto const dtype = descs[c].stats_dtype;
+    result.null_count = make_statistic_column(
+      chunk_statistic_fn<int32_t>{d_chunks, c, num_columns, num_chunks, statistic::NULL_COUNT},
+      mr,
+      stream);
+    if (dtype == io::dtype_float32 || dtype == io::dtype_float64) {
+      chunk_statistic_fn<double> fn{d_chunks, c, num_columns, num_chunks, statistic::MIN};
+      result.min = make_statistic_column(fn, mr, stream);
+      fn.stat    = statistic::MAX;
+      result.max = make_statistic_column(fn, mr, stream);
+      fn.stat    = statistic::SUM;
+      result.sum = make_statistic_column(fn, mr, stream);
+    } else {
+      chunk_statistic_fn<int64_t> fn{d_chunks, c, num_columns, num_chunks, statistic::MIN};
+      bool const is_string = (dtype == io::dtype_string);
+      result.min = is_string ? make_string_statistic_column(fn, mr, stream)
+                             : make_statistic_column(fn, mr, stream);
+      fn.stat    = statistic::MAX;
+      result.max = is_string ? make_string_statistic_column(fn, mr, stream)
+                             : make_statistic_column(fn, mr, stream);
+      fn.stat    = statistic::SUM;
+      result.sum = make_statistic_column(fn, mr, stream);
+    }
+  }
+  // The sources must outlive the kernels reading them
+  CUDF_STREAM_SYNC(stream);
+  return results;
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <cub/device/device_reduce.cuh>
+
+#include <algorithm>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief The simple reductions of a column computed together in one pass
+ *
+ * The compound reductions `mean`, `var` and `std` are computed from `sum` and
+ * `sum_of_squares`, and `any` and `all` are the `max` and `min` of a Boolean
+ * output.
+ */
+template <typename ResultType>
+struct fused_reductions {
+  ResultType sum;
+  ResultType product;
+  ResultType sum_of_squares;
+  ResultType min;
+  ResultType max;
+
+  CUDA_HOST_DEVICE_CALLABLE static fused_reductions identity() {
+    return fused_reductions{ResultType{0},
+                            ResultType{1},
+                            ResultType{0},
+                            DeviceMin::identity<ResultType>(),
+                            DeviceMax::identity<ResultType>()};
+  }
+};
+
+/**
+ * @brief Combines the partial results of two ranges of a column
+ */
+struct combine_fused_reductions {
+  template <typename ResultType>
+  CUDA_HOST_DEVICE_CALLABLE fused_reductions<ResultType> operator()(
+    fused_reductions<ResultType> const& lhs, fused_reductions<ResultType> const& rhs) const {
+    return fused_reductions<ResultType>{DeviceSum{}(lhs.sum, rhs.sum),
+                                        DeviceProduct{}(lhs.product, rhs.product),
+                                        DeviceSum{}(lhs.sum_of_squares, rhs.sum_of_squares),
+                                        DeviceMin{}(lhs.min, rhs.min),
+                                        DeviceMax{}(lhs.max, rhs.max)};
+  }
+};
+
+/**
+ * @brief Transforms the element at a row into the results of its reductions;
+ * null elements are the identity of all of them
+ */
+template <typename ElementType, typename ResultType, bool has_nulls>
+struct element_to_fused_reductions {
+  column_device_view col;
+
+  __device__ fused_reductions<ResultType> operator()(size_type i) const {
+    if (has_nulls and col.is_null(i)) { return fused_reductions<ResultType>::identity(); }
+    auto const value = static_cast<ResultType>(col.element<ElementType>(i));
+    return fused_reductions<ResultType>{
+      value, value, static_cast<ResultType>(value * value), value, value};
+  }
+};
+
+/**
+ * @brief Returns whether `reduce` of `col` with `kind` into `output_dtype` may
+ * be computed by a fused pass
+ */
+bool is_fused(column_view const& col, aggregation::Kind kind, data_type output_dtype) {
+  if (not is_numeric(col.type()) or is_fixed_point(col.type())) { return false; }
+  if (not is_numeric(output_dtype) or is_fixed_point(output_dtype)) { return false; }
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MIN:
+    case aggregation::MAX: return true;
+    case aggregation::ANY:
+    case aggregation::ALL: return output_dtype.id() == BOOL8;
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+#if !defined(__CUDACC_DEBUG__)
+      return output_dtype.id() == FLOAT32 or output_dtype.id() == FLOAT64;
+#else
+      return false;
+#endif
+    default: return false;
+  }
+}
+
+/**
+ * @brief Size in bytes of the partial results of a fused pass, padded so that
+ * those of the next pass are aligned
+ */
+struct fused_reductions_size {
+  template <typename ResultType>
+  std::size_t operator()() const {
+    constexpr std::size_t alignment = alignof(fused_reductions<double>);
+    return (sizeof(fused_reductions<ResultType>) + alignment - 1) / alignment * alignment;
+  }
+};
+
+/**
+ * @brief Launches the fused pass of `col` into `output_dtype`, writing its
+ * result to `d_result`
+ */
+template <typename ElementType>
+struct launch_fused_reductions {
+  template <typename ResultType,
+            std::enable_if_t<std::is_arithmetic<ResultType>::value>* = nullptr>
+  void operator()(column_view const& col,
+                  void* d_result,
+                  rmm::mr::device_memory_resource* scratch,
+                  cudaStream_t stream) const {
+    auto const dcol = column_device_view::create(col, stream);
+    if (col.has_nulls()) {
+      reduce_transformed(element_to_fused_reductions<ElementType, ResultType, true>{*dcol},
+                         col.size(),
+                         d_result,
+                         scratch,
+                         stream);
+    } else {
+      reduce_transformed(element_to_fused_reductions<ElementType, ResultType, false>{*dcol},
+                         col.size(),
+                         d_result,
+                         scratch,
+                         stream);
+    }
+  }
+
+  template <typename ResultType,
+            std::enable_if_t<not std::is_arithmetic<ResultType>::value>* = nullptr>
+  void operator()(column_view const&, void*, rmm::mr::device_memory_resource*, cudaStream_t) const {
+    CUDF_FAIL("Unsupported output data type");
+  }
+
+ private:
+  template <typename Transformer>
+  static void reduce_transformed(Transformer transformer,
+                                 size_type num_rows,
+                                 void* d_result,
+                                 rmm::mr::device_memory_resource* scratch,
+                                 cudaStream_t stream) {
+    using ResultType = decltype(transformer(0));
+    auto d_in     = thrust::make_transform_iterator(thrust::make_counting_iterator(0), transformer);
+    auto d_out    = static_cast<ResultType*>(d_result);
+    auto identity = ResultType::identity();
+    size_t temp_storage_bytes{0};
+    CUDA_TRY(cub::DeviceReduce::Reduce(nullptr,
+                                       temp_storage_bytes,
+                                       d_in,
+                                       d_out,
+                                       num_rows,
+                                       combine_fused_reductions{},
+                                       identity,
+                                       stream));
+    rmm::device_buffer d_temp_storage{temp_storage_bytes, stream, scratch};
+    CUDA_TRY(cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                                       temp_storage_bytes,
+                                       d_in,
+                                       d_out,
+                                       num_rows,
+                                       combine_fused_reductions{},
+                                       identity,
+                                       stream));
+  }
+};
+
+struct launch_fused_reductions_dispatcher {
+  template <typename ElementType,
+            std::enable_if_t<std::is_arithmetic<ElementType>::value>* = nullptr>
+  void operator()(column_view const& col,
+                  data_type output_dtype,
+                  void* d_result,
+                  rmm::mr::device_memory_resource* scratch,
+                  cudaStream_t stream) const {
+    type_dispatcher(
+      output_dtype, launch_fused_reductions<ElementType>{}, col, d_result, scratch, stream);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic<ElementType>::value>* = nullptr>
+  void operator()(column_view const&,
+                  data_type,
+                  void*,
+                  rmm::mr::device_memory_resource*,
+                  cudaStream_t) const {
+    CUDF_FAIL("Unsupported input data type");
+  }
+};
+
+/**
+ * @brief Makes the scalar result of an aggregation from the results of its
+ * fused pass
+ */
+struct make_fused_scalar {
+  template <typename ResultType,
+            std::enable_if_t<std::is_arithmetic<ResultType>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(void const* h_result,
+                                     aggregation const& agg,
+                                     size_type valid_count,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const {
+    namespace op  = cudf::experimental::reduction::op;
+    auto const& r = *static_cast<fused_reductions<ResultType> const*>(h_result);
+    auto const ddof =
+      (agg.kind == aggregation::VARIANCE or agg.kind == aggregation::STD)
+        ? static_cast<std_var_aggregation const&>(agg)._ddof
+        : size_type{1};
+    auto const moments =
+      cudf::experimental::reduction::var_std<ResultType>{r.sum, r.sum_of_squares};
+    ResultType value{};
+    switch (agg.kind) {
+      case aggregation::SUM: value = r.sum; break;
+      case aggregation::PRODUCT: value = r.product; break;
+      case aggregation::SUM_OF_SQUARES: value = r.sum_of_squares; break;
+      case aggregation::MIN:
+      case aggregation::ALL: value = r.min; break;
+      case aggregation::MAX:
+      case aggregation::ANY: value = r.max; break;
+      case aggregation::MEAN:
+        value = op::mean::intermediate<ResultType>::compute_result(r.sum, valid_count, ddof);
+        break;
+      case aggregation::VARIANCE:
+        value = op::variance::intermediate<ResultType>::compute_result(moments, valid_count, ddof);
+        break;
+      case aggregation::STD:
+        value = op::standard_deviation::intermediate<ResultType>::compute_result(
+          moments, valid_count, ddof);
+        break;
+      default: CUDF_FAIL("Unsupported reduction operator");
+    }
+    return std::make_unique<numeric_scalar<ResultType>>(value, true, stream, mr);
+  }
+
+  template <typename ResultType,
+            std::enable_if_t<not std::is_arithmetic<ResultType>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(void const*,
+                                     aggregation const&,
+                                     size_type,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) const {
+    CUDF_FAIL("Unsupported output data type");
+  }
+};
+
+/**
+ * @brief The reductions of a request that go into one fused pass
+ */
+struct fused_pass {
+  size_t request;                    ///< Index of the request
+  data_type output_dtype;            ///< Output type of all the reductions
+  std::vector<size_t> aggregations;  ///< Indices of the reductions in the request
+  std::size_t offset;                ///< Offset of the partial results in the result buffer
+};
+
+/**
+ * @brief The reductions of a column, without owning the aggregations
+ */
+struct request_view {
+  column_view values;
+  std::vector<std::unique_ptr<aggregation>> const* aggregations;
+  std::vector<data_type> const* output_dtypes;
+};
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce_requests(
+  std::vector<request_view> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  std::vector<std::vector<std::unique_ptr<scalar>>> results(requests.size());
+  std::vector<fused_pass> passes;
+  std::size_t results_size{0};
+
+  // Group the fused reductions of each column by output type, and compute the others alone
+  for (size_t r = 0; r < requests.size(); ++r) {
+    auto const& col           = requests[r].values;
+    auto const& aggs          = *requests[r].aggregations;
+    auto const& output_dtypes = *requests[r].output_dtypes;
+    CUDF_EXPECTS(aggs.size() == output_dtypes.size(), "Each reduction needs an output type");
+    results[r].resize(aggs.size());
+    auto const first_pass = passes.size();
+    for (size_t i = 0; i < aggs.size(); ++i) {
+      if (col.size() <= col.null_count() or not is_fused(col, aggs[i]->kind, output_dtypes[i])) {
+        results[r][i] = reduce(col, aggs[i], output_dtypes[i], mr, stream);
+        continue;
+      }
+      auto pass = std::find_if(passes.begin() + first_pass, passes.end(), [&](auto const& p) {
+        return p.output_dtype == output_dtypes[i];
+      });
+      if (pass == passes.end()) {
+        passes.push_back(fused_pass{r, output_dtypes[i], {}, results_size});
+        results_size += type_dispatcher(output_dtypes[i], fused_reductions_size{});
+        pass = passes.end() - 1;
+      }
+      pass->aggregations.push_back(i);
+    }
+  }
+  if (passes.empty()) { return results; }
+
+  // Launch all the passes before waiting for their results
+  std::vector<uint8_t> h_results(results_size);
+  {
+    scratch_scope scratch(stream);
+    rmm::device_buffer d_results{results_size, stream, scratch.resource()};
+    for (auto const& pass : passes) {
+      type_dispatcher(requests[pass.request].values.type(),
+                      launch_fused_reductions_dispatcher{},
+                      requests[pass.request].values,
+                      pass.output_dtype,
+                      static_cast<uint8_t*>(d_results.data()) + pass.offset,
+                      scratch.resource(),
+                      stream);
+    }
+    CUDA_TRY(cudaMemcpyAsync(
+      h_results.data(), d_results.data(), results_size, cudaMemcpyDeviceToHost, stream));
+    CUDF_STREAM_SYNC(stream);
+  }
+
+  for (auto const& pass : passes) {
+    auto const& request    = requests[pass.request];
+    auto const valid_count = request.values.size() - request.values.null_count();
+    for (auto i : pass.aggregations) {
+      results[pass.request][i] = type_dispatcher(pass.output_dtype,
+                                                 make_fused_scalar{},
+                                                 h_results.data() + pass.offset,
+                                                 *(*request.aggregations)[i],
+                                                 valid_count,
+                                                 mr,
+                                                 stream);
+    }
+  }
+  return results;
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce(column_view const& col,
+                                            std::vector<std::unique_ptr<aggregation>> const& aggs,
+                                            std::vector<data_type> const& output_dtypes,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream) {
+  return std::move(reduce_requests({request_view{col, &aggs, &output_dtypes}}, mr, stream).front());
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  std::vector<reduction_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  std::vector<request_view> views;
+  views.reserve(requests.size());
+  for (auto const& request : requests) {
+    views.push_back(request_view{request.values, &request.aggregations, &request.output_dtypes});
+  }
+  return reduce_requests(views, mr, stream);
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -14,15 +14,58 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
 #include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/tdigest.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <cmath>
 
 namespace cudf {
 namespace experimental {
 namespace detail {
+namespace {
+
+/**
+ * @brief Computes the approximate quantile of `col` from its t-digest.
+ */
+std::unique_ptr<scalar> approx_quantile(column_view const &col,
+                                        data_type output_dtype,
+                                        approx_quantile_aggregation const &agg,
+                                        rmm::mr::device_memory_resource *mr,
+                                        cudaStream_t stream) {
+  CUDF_EXPECTS(agg._quantiles.size() == 1, "A quantile reduction computes exactly one quantile");
+  CUDF_EXPECTS(output_dtype.id() == FLOAT64, "Approximate quantiles are FLOAT64");
+
+  size_type const h_offsets[] = {0, col.size()};
+  auto offsets = make_numeric_column(data_type{INT32}, 2, mask_state::UNALLOCATED, stream);
+  CUDA_TRY(cudaMemcpyAsync(offsets->mutable_view().data<size_type>(),
+                           h_offsets,
+                           sizeof(h_offsets),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  auto const digest =
+    make_tdigest(col, offsets->view(), agg._max_centroids, rmm::mr::get_default_resource(), stream);
+  auto const quantiles =
+    approx_quantiles(digest->view(), agg._quantiles, rmm::mr::get_default_resource(), stream);
+
+  double value{};
+  CUDA_TRY(cudaMemcpyAsync(&value,
+                           quantiles->view().data<double>(),
+                           sizeof(double),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  return std::make_unique<numeric_scalar<double>>(value, true, stream, mr);
+}
+
+}  // namespace
 
 struct reduce_dispatch_functor {
   column_view const col;
@@ -57,27 +100,167 @@ struct reduce_dispatch_functor {
         auto var_agg = static_cast<std_var_aggregation const *>(agg.get());
         return reduction::standard_deviation(col, output_dtype, var_agg->_ddof, mr, stream);
       } break;
+      case aggregation::APPROX_QUANTILE: {
+        auto quantile_agg = static_cast<approx_quantile_aggregation const *>(agg.get());
+        return approx_quantile(col, output_dtype, *quantile_agg, mr, stream);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
 };
 
-std::unique_ptr<scalar> reduce(
-  column_view const &col,
-  std::unique_ptr<aggregation> const &agg,
-  data_type output_dtype,
-  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0) {
+namespace {
+
+/**
+ * @brief Computes a SUM, MIN or MAX of a fixed-point column on its representation.
+ *
+ * The result has the scale of `col`: a sum of representations is the
+ * representation of the sum.
+ */
+std::unique_ptr<scalar> reduce_fixed_point(column_view const &col,
+                                           std::unique_ptr<aggregation> const &agg,
+                                           data_type output_dtype,
+                                           rmm::mr::device_memory_resource *mr,
+                                           cudaStream_t stream) {
+  CUDF_EXPECTS(agg->kind == aggregation::SUM || agg->kind == aggregation::MIN ||
+                 agg->kind == aggregation::MAX,
+               "Unsupported reduction operator for fixed-point columns");
+  CUDF_EXPECTS(is_fixed_point(output_dtype) && output_dtype.scale() == col.type().scale(),
+               "Fixed-point reductions must have a fixed-point output of the same scale");
+
+  auto const rep_dtype = data_type{output_dtype.id() == DECIMAL32 ? INT32 : INT64};
+  auto const rep_result =
+    aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, rep_dtype, mr, stream}, agg);
+  auto const is_valid = rep_result->is_valid(stream);
+  if (rep_dtype.id() == INT32) {
+    auto const rep = static_cast<numeric_scalar<int32_t> const *>(rep_result.get())->value(stream);
+    return std::make_unique<fixed_point_scalar<int32_t>>(
+      rep, output_dtype.scale(), is_valid, stream, mr);
+  }
+  auto const rep = static_cast<numeric_scalar<int64_t> const *>(rep_result.get())->value(stream);
+  return std::make_unique<fixed_point_scalar<int64_t>>(
+    rep, output_dtype.scale(), is_valid, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr,
+                               cudaStream_t stream) {
   std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype);
   result->set_valid(false, stream);
 
   // check if input column is empty
   if (col.size() <= col.null_count()) return result;
 
+  if (is_fixed_point(col.type())) {
+    return reduce_fixed_point(col, agg, output_dtype, mr, stream);
+  }
+
   result =
     aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, mr, stream}, agg);
   return result;
 }
+
+namespace {
+
+/**
+ * @brief Returns the aggregation that combines the partial results of the
+ * chunks of a chunked column reduced by an aggregation of `kind`
+ */
+std::unique_ptr<aggregation> make_combine_aggregation(aggregation::Kind kind) {
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES: return make_sum_aggregation();
+    case aggregation::PRODUCT: return make_product_aggregation();
+    case aggregation::MIN: return make_min_aggregation();
+    case aggregation::MAX: return make_max_aggregation();
+    case aggregation::ANY: return make_any_aggregation();
+    case aggregation::ALL: return make_all_aggregation();
+    default: CUDF_FAIL("Unsupported reduction operator for chunked columns");
+  }
+}
+
+/**
+ * @brief Computes the MEAN, VARIANCE or STD of a chunked column.
+ *
+ * The count, mean and sum of squared deviations from the mean of the chunks
+ * are merged in double precision as in the parallel algorithm of Chan et al.
+ */
+std::unique_ptr<scalar> reduce_moments(chunked_column_view const &col,
+                                       std::unique_ptr<aggregation> const &agg,
+                                       data_type output_dtype,
+                                       rmm::mr::device_memory_resource *mr,
+                                       cudaStream_t stream) {
+  CUDF_EXPECTS(output_dtype.id() == FLOAT32 || output_dtype.id() == FLOAT64,
+               "Chunked moments require a floating point output type");
+  auto const chunk_value = [stream](column_view const &chunk,
+                                    std::unique_ptr<aggregation> const &chunk_agg) {
+    auto const result =
+      reduce(chunk, chunk_agg, data_type{FLOAT64}, rmm::mr::get_default_resource(), stream);
+    return static_cast<numeric_scalar<double> const *>(result.get())->value(stream);
+  };
+
+  double count = 0;
+  double mean  = 0;
+  double m2    = 0;
+  for (auto const &chunk : col) {
+    double const n = chunk.size() - chunk.null_count();
+    if (n == 0) { continue; }
+    auto const chunk_mean = chunk_value(chunk, make_mean_aggregation());
+    auto const chunk_m2 =
+      agg->kind == aggregation::MEAN ? 0 : chunk_value(chunk, make_variance_aggregation(0)) * n;
+    auto const delta = chunk_mean - mean;
+    auto const total = count + n;
+    mean += delta * n / total;
+    m2 += chunk_m2 + delta * delta * count * n / total;
+    count = total;
+  }
+
+  bool is_valid = count > 0;
+  double value  = mean;
+  if (agg->kind != aggregation::MEAN) {
+    auto const ddof = static_cast<std_var_aggregation const *>(agg.get())->_ddof;
+    is_valid        = count > ddof;
+    value           = is_valid ? m2 / (count - ddof) : 0;
+    if (agg->kind == aggregation::STD) { value = std::sqrt(value); }
+  }
+  if (output_dtype.id() == FLOAT32) {
+    return std::make_unique<numeric_scalar<float>>(
+      static_cast<float>(value), is_valid, stream, mr);
+  }
+  return std::make_unique<numeric_scalar<double>>(value, is_valid, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<scalar> reduce(chunked_column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr,
+                               cudaStream_t stream) {
+  if (agg->kind == aggregation::MEAN || agg->kind == aggregation::VARIANCE ||
+      agg->kind == aggregation::STD) {
+    return reduce_moments(col, agg, output_dtype, mr, stream);
+  }
+  auto const combine = make_combine_aggregation(agg->kind);
+  if (col.num_chunks() == 1) { return reduce(col.chunk(0), agg, output_dtype, mr, stream); }
+
+  // The partial results of the chunks are the rows of a column reduced by the
+  // combining aggregation; the partial results of empty chunks are null rows
+  std::vector<std::unique_ptr<column>> partials;
+  std::vector<column_view> partial_views;
+  for (auto const &chunk : col) {
+    auto const partial = reduce(chunk, agg, output_dtype, rmm::mr::get_default_resource(), stream);
+    partials.push_back(
+      make_column_from_scalar(*partial, 1, rmm::mr::get_default_resource(), stream));
+    partial_views.push_back(partials.back()->view());
+  }
+  auto const combined = cudf::concatenate(partial_views);
+  return reduce(combined->view(), combine, output_dtype, mr, stream);
+}
 }  // namespace detail
 
 std::unique_ptr<scalar> reduce(column_view const &col,
@@ -88,5 +271,34 @@ std::unique_ptr<scalar> reduce(column_view const &col,
   return detail::reduce(col, agg, output_dtype, mr);
 }
 
+std::unique_ptr<scalar> reduce(chunked_column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, agg, output_dtype, mr);
+}
+
+std::vector<std::unique_ptr<scalar>> reduce(column_view const &col,
+                                            std::vector<std::unique_ptr<aggregation>> const &aggs,
+                                            std::vector<data_type> const &output_dtypes,
+                                            rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, aggs, output_dtypes, mr);
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  std::vector<reduction_request> const &requests, rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::reduce(requests, mr);
+}
+
+std::vector<column_description> describe(table_view const &input,
+                                         size_type chunk_size,
+                                         rmm::mr::device_memory_resource *mr) {
+  CUDF_FUNC_RANGE();
+  return detail::describe(input, chunk_size, mr);
+}
+
 }  // namespace experimental
 }  // namespace cudf
@@ -6,19 +6,192 @@
 
 #include <rmm/rmm.h>
 #include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/reduction.hpp>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/scratch_arena.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <cub/device/device_scan.cuh>
+
+#include <iterator>
+
 namespace cudf {
 namespace experimental {
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Runs the single-pass scan of `d_in` into `d_out`, exclusive if
+ * `exclusive` is true
+ *
+ * `cub::DeviceScan` propagates the prefix of each tile to the next one with
+ * decoupled look-back, so the input is read and the output written once.
+ */
+template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOp>
+void single_pass_scan(InputIterator d_in,
+                      OutputIterator d_out,
+                      size_type size,
+                      BinaryOp binary_op,
+                      bool exclusive,
+                      T identity,
+                      cudaStream_t stream) {
+  if (size == 0) { return; }
+  scratch_scope scratch(stream);
+  size_t temp_storage_bytes{0};
+  auto scan = [&](void* d_temp_storage) {
+    if (exclusive) {
+      return cub::DeviceScan::ExclusiveScan(
+        d_temp_storage, temp_storage_bytes, d_in, d_out, binary_op, identity, size, stream);
+    }
+    return cub::DeviceScan::InclusiveScan(
+      d_temp_storage, temp_storage_bytes, d_in, d_out, binary_op, size, stream);
+  };
+  CUDA_TRY(scan(nullptr));
+  rmm::device_buffer d_temp_storage{temp_storage_bytes, stream, scratch.resource()};
+  CUDA_TRY(scan(d_temp_storage.data()));
+}
+
+/**
+ * @brief The partial scan of the rows of a segment, with the validity of
+ * these rows
+ */
+template <typename T>
+struct scan_element {
+  T value;
+  bool valid;  ///< false if one of the rows is null
+  bool head;   ///< true if the first row starts a segment
+};
+
+/**
+ * @brief Combines the scans of two consecutive ranges of rows, restarting at
+ * the head of a segment
+ *
+ * This is the usual associative operator of a segmented scan, so the segments
+ * and the validity are scanned in the same pass as the values.
+ */
+template <typename T, typename Op>
+struct segmented_scan_op {
+  __device__ scan_element<T> operator()(scan_element<T> const& lhs,
+                                        scan_element<T> const& rhs) const {
+    if (rhs.head) { return rhs; }
+    return {Op{}(lhs.value, rhs.value), lhs.valid && rhs.valid, lhs.head};
+  }
+};
+
+/**
+ * @brief Makes the `scan_element` of each row of the input column
+ *
+ * Null rows hold the identity of `Op`. For an exclusive scan, row `i` holds
+ * the value of row `i - 1`, and the head of a segment the identity, so the
+ * inclusive scan of these elements is the exclusive scan of the column.
+ */
+template <typename T, typename Op, bool has_nulls>
+struct make_scan_element {
+  column_device_view input;
+  bool const* heads;  ///< Heads of the segments, nullptr for a single segment
+  bool exclusive;
+
+  __device__ scan_element<T> operator()(size_type row) const {
+    bool const head = (row == 0) || (heads != nullptr && heads[row]);
+    if (exclusive) {
+      if (head) { return {Op::template identity<T>(), true, true}; }
+      --row;
+    }
+    if (has_nulls && input.is_null_nocheck(row)) {
+      return {Op::template identity<T>(), false, head};
+    }
+    return {input.element<T>(row), true, head};
+  }
+};
+
+/**
+ * @brief Output iterator writing the value of a `scan_element` to the output
+ * column, and clearing the bit of the null results in its null mask
+ *
+ * Its `value_type` is `void`, so `cub::DeviceScan` scans `scan_element`s.
+ */
+template <typename T>
+class scan_element_writer {
+ public:
+  struct reference {
+    T* values;
+    bitmask_type* null_mask;
+    size_type row;
+
+    __device__ reference const& operator=(scan_element<T> const& element) const {
+      values[row] = element.value;
+      if (null_mask != nullptr && not element.valid) {
+        atomicAnd(null_mask + word_index(row), ~(bitmask_type{1} << intra_word_index(row)));
+      }
+      return *this;
+    }
+  };
+
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = void;
+  using difference_type   = size_type;
+  using pointer           = void;
+
+  CUDA_HOST_DEVICE_CALLABLE scan_element_writer(T* values, bitmask_type* null_mask, size_type row)
+    : _values{values}, _null_mask{null_mask}, _row{row} {}
+
+  CUDA_HOST_DEVICE_CALLABLE scan_element_writer operator+(difference_type offset) const {
+    return {_values, _null_mask, _row + offset};
+  }
+  __device__ reference operator[](difference_type offset) const {
+    return {_values, _null_mask, _row + offset};
+  }
+  __device__ reference operator*() const { return {_values, _null_mask, _row}; }
+
+ private:
+  T* _values;
+  bitmask_type* _null_mask;  ///< nullptr if the validity is not scanned
+  size_type _row;
+};
+
+/**
+ * @brief Marks the row at each offset as the head of its segment
+ */
+struct mark_segment_head {
+  bool* heads;
+  size_type size;
+
+  __device__ void operator()(size_type offset) const {
+    // Trailing empty segments start at `size`
+    if (offset < size) { heads[offset] = true; }
+  }
+};
+
+/**
+ * @brief Returns the flags of the rows starting the non-empty segments of
+ * `offsets`
+ */
+rmm::device_buffer segment_heads(column_view const& offsets,
+                                 size_type size,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  rmm::device_buffer heads{size * sizeof(bool), stream, mr};
+  auto d_heads = static_cast<bool*>(heads.data());
+  CUDA_TRY(cudaMemsetAsync(d_heads, 0, heads.size(), stream));
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   offsets.begin<size_type>(),
+                   offsets.end<size_type>(),
+                   mark_segment_head{d_heads, size});
+  return heads;
+}
+
+}  // namespace
 
 /**
    * @brief Dispatcher for running Scan operation on input column
@@ -42,35 +215,56 @@ struct ScanDispatcher {
 
   //for arithmetic types
   template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, T>* = nullptr>
-  auto exclusive_scan(const column_view& input_view,
-                      include_nulls include_nulls_flag,
-                      rmm::mr::device_memory_resource* mr,
-                      cudaStream_t stream) {
+  std::unique_ptr<column> scan(const column_view& input_view,
+                               bool const* heads,
+                               scan_type inclusive,
+                               include_nulls include_nulls_flag,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream) {
     const size_type size = input_view.size();
     auto output_column   = experimental::detail::allocate_like(
       input_view, size, experimental::mask_allocation_policy::NEVER, mr, stream);
+    bool const scan_nulls = include_nulls_flag == include_nulls::YES && input_view.nullable();
     if (include_nulls_flag == include_nulls::NO) {
       output_column->set_null_mask(copy_bitmask(input_view, stream, mr), input_view.null_count());
+    } else if (scan_nulls) {
+      output_column->set_null_mask(create_null_mask(size, mask_state::ALL_VALID, stream, mr),
+                                   cudf::UNKNOWN_NULL_COUNT);
     }
     mutable_column_view output = output_column->mutable_view();
     auto d_input               = column_device_view::create(input_view, stream);
+    bool const exclusive       = inclusive == scan_type::EXCLUSIVE;
 
-    if (input_view.has_nulls()) {
-      auto input = make_null_replacement_iterator(*d_input, Op::template identity<T>());
-      thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
-                             input,
-                             input + size,
-                             output.data<T>(),
-                             Op::template identity<T>(),
-                             Op{});
+    if (heads == nullptr && not(scan_nulls && input_view.has_nulls())) {
+      // Only the values are scanned
+      if (input_view.has_nulls()) {
+        auto input = make_null_replacement_iterator(*d_input, Op::template identity<T>());
+        single_pass_scan(
+          input, output.data<T>(), size, Op{}, exclusive, Op::template identity<T>(), stream);
+      } else {
+        auto input = d_input->begin<T>();
+        single_pass_scan(
+          input, output.data<T>(), size, Op{}, exclusive, Op::template identity<T>(), stream);
+      }
     } else {
-      auto input = d_input->begin<T>();
-      thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
-                             input,
-                             input + size,
-                             output.data<T>(),
-                             Op::template identity<T>(),
-                             Op{});
+      auto output_iterator =
+        scan_element_writer<T>{output.data<T>(), scan_nulls ? output.null_mask() : nullptr, 0};
+      auto scan_elements = [&](auto element_fn) {
+        auto input = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                     element_fn);
+        single_pass_scan(input,
+                         output_iterator,
+                         size,
+                         segmented_scan_op<T, Op>{},
+                         false,
+                         scan_element<T>{Op::template identity<T>(), true, true},
+                         stream);
+      };
+      if (input_view.has_nulls()) {
+        scan_elements(make_scan_element<T, Op, true>{*d_input, heads, exclusive});
+      } else {
+        scan_elements(make_scan_element<T, Op, false>{*d_input, heads, exclusive});
+      }
     }
 
     CHECK_CUDA(stream);
@@ -79,11 +273,17 @@ struct ScanDispatcher {
 
   //for string type
   template <typename T, std::enable_if_t<is_string_supported<T>(), T>* = nullptr>
-  std::unique_ptr<column> exclusive_scan(const column_view& input_view,
-                                         include_nulls include_nulls_flag,
-                                         rmm::mr::device_memory_resource* mr,
-                                         cudaStream_t stream) {
-    CUDF_FAIL("String types supports only inclusive min/max for `cudf::scan`");
+  std::unique_ptr<column> scan(const column_view& input_view,
+                               bool const* heads,
+                               scan_type inclusive,
+                               include_nulls include_nulls_flag,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream) {
+    CUDF_EXPECTS(heads == nullptr, "Segmented scan supports only arithmetic types");
+    if (inclusive == scan_type::EXCLUSIVE) {
+      CUDF_FAIL("String types supports only inclusive min/max for `cudf::scan`");
+    }
+    return inclusive_string_scan<T>(input_view, include_nulls_flag, mr, stream);
   }
 
   rmm::device_buffer mask_inclusive_scan(const column_view& input_view,
@@ -104,47 +304,12 @@ struct ScanDispatcher {
     return mask;
   }
 
-  //for arithmetic types
-  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, T>* = nullptr>
-  auto inclusive_scan(const column_view& input_view,
-                      include_nulls include_nulls_flag,
-                      rmm::mr::device_memory_resource* mr,
-                      cudaStream_t stream) {
-    const size_type size = input_view.size();
-    auto output_column   = experimental::detail::allocate_like(
-      input_view, size, experimental::mask_allocation_policy::NEVER, mr, stream);
-    if (include_nulls_flag == include_nulls::NO) {
-      output_column->set_null_mask(copy_bitmask(input_view, stream, mr), input_view.null_count());
-    } else {
-      if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, mr, stream),
-                                     cudf::UNKNOWN_NULL_COUNT);
-      }
-    }
-
-    auto d_input               = column_device_view::create(input_view, stream);
-    mutable_column_view output = output_column->mutable_view();
-
-    if (input_view.has_nulls()) {
-      auto input = make_null_replacement_iterator(*d_input, Op::template identity<T>());
-      thrust::inclusive_scan(
-        rmm::exec_policy(stream)->on(stream), input, input + size, output.data<T>(), Op{});
-    } else {
-      auto input = d_input->begin<T>();
-      thrust::inclusive_scan(
-        rmm::exec_policy(stream)->on(stream), input, input + size, output.data<T>(), Op{});
-    }
-
-    CHECK_CUDA(stream);
-    return output_column;
-  }
-
   //for string type
   template <typename T, std::enable_if_t<is_string_supported<T>(), T>* = nullptr>
-  std::unique_ptr<column> inclusive_scan(const column_view& input_view,
-                                         include_nulls include_nulls_flag,
-                                         rmm::mr::device_memory_resource* mr,
-                                         cudaStream_t stream) {
+  std::unique_ptr<column> inclusive_string_scan(const column_view& input_view,
+                                                include_nulls include_nulls_flag,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream) {
     const size_type size = input_view.size();
     rmm::device_vector<T> result(size);
 
@@ -178,6 +343,8 @@ struct ScanDispatcher {
    * @brief creates new column from input column by applying scan operation
    *
    * @param input     input column view
+   * @param heads     The first rows of the segments of a segmented scan, or
+   *                  nullptr to scan the whole column
    * @param inclusive inclusive or exclusive scan
    * @param mr The resource to use for all allocations
    * @param stream The stream on which to execute all allocations and copies
@@ -187,15 +354,12 @@ struct ScanDispatcher {
    */
   template <typename T, typename std::enable_if_t<is_supported<T>(), T>* = nullptr>
   std::unique_ptr<column> operator()(const column_view& input,
+                                     bool const* heads,
                                      scan_type inclusive,
                                      include_nulls include_nulls_flag,
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream) {
-    std::unique_ptr<column> output;
-    if (inclusive == scan_type::INCLUSIVE)
-      output = inclusive_scan<T>(input, include_nulls_flag, mr, stream);
-    else
-      output = exclusive_scan<T>(input, include_nulls_flag, mr, stream);
+    auto output = scan<T>(input, heads, inclusive, include_nulls_flag, mr, stream);
     if (include_nulls_flag == include_nulls::NO) {
       CUDF_EXPECTS(input.null_count() == output->null_count(),
                    "Input / output column null count mismatch");
@@ -205,6 +369,7 @@ struct ScanDispatcher {
 
   template <typename T, typename std::enable_if_t<!is_supported<T>(), T>* = nullptr>
   std::unique_ptr<column> operator()(const column_view& input,
+                                     bool const* heads,
                                      scan_type inclusive,
                                      include_nulls include_nulls_flag,
                                      rmm::mr::device_memory_resource* mr,
@@ -213,12 +378,19 @@ struct ScanDispatcher {
   }
 };
 
-std::unique_ptr<column> scan(const column_view& input,
-                             std::unique_ptr<aggregation> const& agg,
-                             scan_type inclusive,
-                             include_nulls include_nulls_flag,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-                             cudaStream_t stream                 = 0) {
+namespace {
+
+/**
+ * @brief Scans `input` with the operator of `agg`, restarting at the rows of
+ * `heads` unless it is nullptr
+ */
+std::unique_ptr<column> scan_segments(const column_view& input,
+                                      bool const* heads,
+                                      std::unique_ptr<aggregation> const& agg,
+                                      scan_type inclusive,
+                                      include_nulls include_nulls_flag,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream) {
   CUDF_EXPECTS(is_numeric(input.type()) || is_compound(input.type()),
                "Unexpected non-numeric or non-string type.");
 
@@ -227,6 +399,7 @@ std::unique_ptr<column> scan(const column_view& input,
       return cudf::experimental::type_dispatcher(input.type(),
                                                  ScanDispatcher<cudf::DeviceSum>(),
                                                  input,
+                                                 heads,
                                                  inclusive,
                                                  include_nulls_flag,
                                                  mr,
@@ -235,6 +408,7 @@ std::unique_ptr<column> scan(const column_view& input,
       return cudf::experimental::type_dispatcher(input.type(),
                                                  ScanDispatcher<cudf::DeviceMin>(),
                                                  input,
+                                                 heads,
                                                  inclusive,
                                                  include_nulls_flag,
                                                  mr,
@@ -243,6 +417,7 @@ std::unique_ptr<column> scan(const column_view& input,
       return cudf::experimental::type_dispatcher(input.type(),
                                                  ScanDispatcher<cudf::DeviceMax>(),
                                                  input,
+                                                 heads,
                                                  inclusive,
                                                  include_nulls_flag,
                                                  mr,
@@ -251,6 +426,7 @@ std::unique_ptr<column> scan(const column_view& input,
       return cudf::experimental::type_dispatcher(input.type(),
                                                  ScanDispatcher<cudf::DeviceProduct>(),
                                                  input,
+                                                 heads,
                                                  inclusive,
                                                  include_nulls_flag,
                                                  mr,
@@ -258,6 +434,38 @@ std::unique_ptr<column> scan(const column_view& input,
     default: CUDF_FAIL("Unsupported aggregation operator for scan");
   }
 }
+
+}  // namespace
+
+std::unique_ptr<column> scan(const column_view& input,
+                             std::unique_ptr<aggregation> const& agg,
+                             scan_type inclusive,
+                             include_nulls include_nulls_flag,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream) {
+  return scan_segments(input, nullptr, agg, inclusive, include_nulls_flag, mr, stream);
+}
+
+std::unique_ptr<column> segmented_scan(const column_view& input,
+                                       const column_view& offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       scan_type inclusive,
+                                       include_nulls include_nulls_flag,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream) {
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>(), "Offsets must be INT32");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets cannot have nulls");
+  scratch_scope scratch(stream);
+  auto heads = segment_heads(offsets, input.size(), scratch.resource(), stream);
+  return scan_segments(input,
+                       static_cast<bool const*>(heads.data()),
+                       agg,
+                       inclusive,
+                       include_nulls_flag,
+                       mr,
+                       stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> scan(const column_view& input,
@@ -269,5 +477,15 @@ std::unique_ptr<column> scan(const column_view& input,
   return detail::scan(input, agg, inclusive, include_nulls_flag, mr);
 }
 
+std::unique_ptr<column> segmented_scan(const column_view& input,
+                                       const column_view& offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       scan_type inclusive,
+                                       include_nulls include_nulls_flag,
+                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(input, offsets, agg, inclusive, include_nulls_flag, mr);
+}
+
 }  // namespace experimental
 }  // namespace cudf
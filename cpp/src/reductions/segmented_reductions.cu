@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <cub/device/device_segmented_reduce.cuh>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief Reduces each segment `[d_offsets[i], d_offsets[i + 1])` of `d_in`
+ * into `d_out[i]` with `binary_op`
+ */
+template <typename InputIterator, typename OutputType, typename BinaryOp>
+void reduce_segments(InputIterator d_in,
+                     size_type const* d_offsets,
+                     size_type num_segments,
+                     OutputType* d_out,
+                     BinaryOp binary_op,
+                     OutputType identity,
+                     cudaStream_t stream) {
+  size_t temp_storage_bytes{0};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream));
+  rmm::device_buffer d_temp_storage{temp_storage_bytes, stream};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                              temp_storage_bytes,
+                                              d_in,
+                                              d_out,
+                                              num_segments,
+                                              d_offsets,
+                                              d_offsets + 1,
+                                              binary_op,
+                                              identity,
+                                              stream));
+}
+
+/**
+ * @brief Segmented reduction for 'sum', 'product', 'min', 'max' and
+ * 'sum of squares', with a single segmented reduction call
+ *
+ * A segment whose elements are all null, or that is empty, is null.
+ *
+ * @tparam ElementType  the input column cudf dtype
+ * @tparam ResultType   the output cudf dtype
+ * @tparam Op           the operator of cudf::experimental::reduction::op::
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> simple_segmented_reduction(column_view const& col,
+                                                   size_type const* d_offsets,
+                                                   size_type num_segments,
+                                                   data_type output_dtype,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream) {
+  Op simple_op{};
+  auto const identity = simple_op.template get_identity<ResultType>();
+  auto result =
+    make_fixed_width_column(output_dtype, num_segments, mask_state::UNALLOCATED, stream, mr);
+  if (num_segments == 0) { return result; }
+  auto d_out = result->mutable_view().template data<ResultType>();
+  auto dcol  = column_device_view::create(col, stream);
+
+  if (col.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      make_null_replacement_iterator(*dcol, simple_op.template get_identity<ElementType>()),
+      simple_op.template get_element_transformer<ResultType>());
+    reduce_segments(
+      it, d_offsets, num_segments, d_out, simple_op.get_binary_op(), identity, stream);
+
+    // A segment is valid if it has a valid element
+    rmm::device_vector<size_type> valid_counts(num_segments);
+    auto is_valid = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(0), [d_col = *dcol] __device__(size_type i) {
+        return static_cast<size_type>(d_col.is_valid(i));
+      });
+    reduce_segments(is_valid,
+                    d_offsets,
+                    num_segments,
+                    valid_counts.data().get(),
+                    cub::Sum{},
+                    size_type{0},
+                    stream);
+    auto valid = valid_if(
+      thrust::make_counting_iterator(0),
+      thrust::make_counting_iterator(num_segments),
+      [d_valid_counts = valid_counts.data().get()] __device__(size_type i) {
+        return d_valid_counts[i] > 0;
+      },
+      stream,
+      mr);
+    result->set_null_mask(std::move(valid.first), valid.second);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dcol->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
+    reduce_segments(
+      it, d_offsets, num_segments, d_out, simple_op.get_binary_op(), identity, stream);
+
+    // Only the empty segments are null
+    auto valid = valid_if(
+      thrust::make_counting_iterator(0),
+      thrust::make_counting_iterator(num_segments),
+      [d_offsets] __device__(size_type i) { return d_offsets[i + 1] > d_offsets[i]; },
+      stream,
+      mr);
+    if (valid.second > 0) { result->set_null_mask(std::move(valid.first), valid.second); }
+  }
+  return result;
+}
+
+// @brief result type dispatcher for simple segmented reduction (a.k.a. sum, prod, min...)
+template <typename ElementType, typename Op>
+struct result_type_dispatcher {
+ private:
+  template <typename ResultType>
+  static constexpr bool is_supported_v() {
+    // the same combinations of input and output dtypes as `reduce`
+    return is_fixed_width<ResultType>() && std::is_convertible<ElementType, ResultType>::value &&
+           (std::is_arithmetic<ResultType>::value ||
+            std::is_same<Op, cudf::experimental::reduction::op::min>::value ||
+            std::is_same<Op, cudf::experimental::reduction::op::max>::value);
+  }
+
+ public:
+  template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     size_type const* d_offsets,
+                                     size_type num_segments,
+                                     data_type output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+    return simple_segmented_reduction<ElementType, ResultType, Op>(
+      col, d_offsets, num_segments, output_dtype, mr, stream);
+  }
+
+  template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const*,
+                                     size_type,
+                                     data_type,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) {
+    CUDF_FAIL("input data type is not convertible to output data type");
+  }
+};
+
+// @brief input column element dispatcher for simple segmented reduction
+template <typename Op>
+struct element_type_dispatcher {
+ private:
+  template <typename ElementType>
+  static constexpr bool is_supported_v() {
+    return is_fixed_width<ElementType>() &&
+           (std::is_arithmetic<ElementType>::value ||
+            std::is_same<Op, cudf::experimental::reduction::op::min>::value ||
+            std::is_same<Op, cudf::experimental::reduction::op::max>::value);
+  }
+
+ public:
+  template <typename ElementType, std::enable_if_t<is_supported_v<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     size_type const* d_offsets,
+                                     size_type num_segments,
+                                     data_type output_dtype,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
+    return type_dispatcher(output_dtype,
+                           result_type_dispatcher<ElementType, Op>(),
+                           col,
+                           d_offsets,
+                           num_segments,
+                           output_dtype,
+                           mr,
+                           stream);
+  }
+
+  template <typename ElementType, std::enable_if_t<not is_supported_v<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type const*,
+                                     size_type,
+                                     data_type,
+                                     rmm::mr::device_memory_resource*,
+                                     cudaStream_t) {
+    CUDF_FAIL(
+      "Segmented reduction operators other than `min` and `max`"
+      " are only supported for arithmetic types");
+  }
+};
+
+template <typename Op>
+std::unique_ptr<column> simple_segmented_reduce(column_view const& col,
+                                                column_view const& offsets,
+                                                data_type output_dtype,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream) {
+  auto const num_segments = std::max(offsets.size(), 1) - 1;
+  return type_dispatcher(col.type(),
+                         element_type_dispatcher<Op>{},
+                         col,
+                         offsets.data<size_type>(),
+                         num_segments,
+                         output_dtype,
+                         mr,
+                         stream);
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(column_view const& col,
+                                         column_view const& offsets,
+                                         aggregation::Kind kind,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>(), "Offsets must be INT32");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets cannot have nulls");
+  if (is_fixed_point(col.type())) {
+    CUDF_EXPECTS(kind == aggregation::SUM || kind == aggregation::MIN || kind == aggregation::MAX,
+                 "Unsupported reduction operator for fixed-point columns");
+    CUDF_EXPECTS(is_fixed_point(output_dtype) && output_dtype.scale() == col.type().scale(),
+                 "Fixed-point reductions must have a fixed-point output of the same scale");
+  }
+
+  namespace op = cudf::experimental::reduction::op;
+  switch (kind) {
+    case aggregation::SUM:
+      return simple_segmented_reduce<op::sum>(col, offsets, output_dtype, mr, stream);
+    case aggregation::PRODUCT:
+      return simple_segmented_reduce<op::product>(col, offsets, output_dtype, mr, stream);
+    case aggregation::SUM_OF_SQUARES:
+      return simple_segmented_reduce<op::sum_of_squares>(col, offsets, output_dtype, mr, stream);
+    case aggregation::MIN:
+      return simple_segmented_reduce<op::min>(col, offsets, output_dtype, mr, stream);
+    case aggregation::MAX:
+      return simple_segmented_reduce<op::max>(col, offsets, output_dtype, mr, stream);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype == data_type(BOOL8),
+                   "any() operation can be applied with output type `bool8` only");
+      return simple_segmented_reduce<op::max>(col, offsets, output_dtype, mr, stream);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype == data_type(BOOL8),
+                   "all() operation can be applied with output type `bool8` only");
+      return simple_segmented_reduce<op::min>(col, offsets, output_dtype, mr, stream);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& col,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(col, offsets, agg->kind, output_dtype, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
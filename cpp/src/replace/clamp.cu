@@ -256,6 +256,30 @@ struct dispatch_clamp {
   }
 };
 
+template <>
+std::unique_ptr<column> dispatch_clamp::operator()<cudf::list_view>(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& lo_replace,
+  scalar const& hi,
+  scalar const& hi_replace,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  CUDF_FAIL("list type not supported");
+}
+
+template <>
+std::unique_ptr<column> dispatch_clamp::operator()<cudf::struct_view>(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& lo_replace,
+  scalar const& hi,
+  scalar const& hi_replace,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  CUDF_FAIL("struct type not supported");
+}
+
 /**
  * @copydoc cudf::experimental::clamp(column_view const& input,
                                       scalar const& lo,
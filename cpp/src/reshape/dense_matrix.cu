@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/reshape.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+constexpr int matrix_tile_dim      = 32;
+constexpr int matrix_block_rows    = 8;
+constexpr int max_matrix_col_tiles = 65535;
+
+/**
+ * @brief Returns the element `row` of a numeric column cast to `Out`.
+ */
+template <typename Out>
+struct element_as_fn {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  __device__ Out operator()(column_device_view const& column, size_type row) const {
+    return static_cast<Out>(column.element<T>(row));
+  }
+
+  template <typename T, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  __device__ Out operator()(column_device_view const&, size_type) const {
+    release_assert(false && "Dense matrix columns must be numeric");
+    return Out{};
+  }
+};
+
+template <typename Out>
+__device__ inline Out matrix_element(column_device_view const& column,
+                                     size_type row,
+                                     Out null_fill) {
+  if (column.nullable() and column.is_null_nocheck(row)) { return null_fill; }
+  return type_dispatcher(column.type(), element_as_fn<Out>{}, column, row);
+}
+
+/**
+ * @brief Writes `tile_dim x tile_dim` tiles of the input into the matrix.
+ *
+ * Blocks are `tile_dim x block_rows` threads: `blockIdx.x` is the tile of
+ * input rows and `blockIdx.y` strides over the tiles of input columns. A warp
+ * reads consecutive rows of an input column. The column-major matrix is written
+ * directly, while the row-major matrix is transposed through shared memory so
+ * that a warp writes consecutive columns of a matrix row.
+ */
+template <typename Out, matrix_order order>
+__global__ void dense_matrix_tiles(table_device_view input, Out* output, Out null_fill) {
+  // The padding column spreads the tile columns over all the banks
+  __shared__ Out tile[matrix_tile_dim][matrix_tile_dim + 1];
+
+  auto const num_columns      = input.num_columns();
+  auto const num_rows         = input.num_rows();
+  auto const row0             = static_cast<size_type>(blockIdx.x) * matrix_tile_dim;
+  auto const num_column_tiles = (num_columns + matrix_tile_dim - 1) / matrix_tile_dim;
+
+  for (size_type column_tile = blockIdx.y; column_tile < num_column_tiles;
+       column_tile += gridDim.y) {
+    auto const col0 = column_tile * matrix_tile_dim;
+
+    auto const row = row0 + static_cast<size_type>(threadIdx.x);
+    for (int j = threadIdx.y; j < matrix_tile_dim; j += matrix_block_rows) {
+      auto const col = col0 + j;
+      if (row < num_rows and col < num_columns) {
+        auto const value = matrix_element(input.column(col), row, null_fill);
+        if (order == matrix_order::COLUMN_MAJOR) {
+          output[static_cast<int64_t>(col) * num_rows + row] = value;
+        } else {
+          tile[j][threadIdx.x] = value;
+        }
+      }
+    }
+    if (order == matrix_order::COLUMN_MAJOR) { continue; }
+    __syncthreads();
+
+    auto const col = col0 + static_cast<size_type>(threadIdx.x);
+    if (col < num_columns) {
+      for (int i = threadIdx.y; i < matrix_tile_dim; i += matrix_block_rows) {
+        auto const out_row = row0 + i;
+        if (out_row >= num_rows) { break; }
+        output[static_cast<int64_t>(out_row) * num_columns + col] = tile[threadIdx.x][i];
+      }
+    }
+    __syncthreads();
+  }
+}
+
+struct dense_matrix_functor {
+  template <typename Out, std::enable_if_t<is_numeric<Out>()>* = nullptr>
+  void operator()(table_view const& input,
+                  scalar const& null_fill,
+                  matrix_order order,
+                  void* output,
+                  cudaStream_t stream) {
+    auto const& fill = static_cast<numeric_scalar<Out> const&>(null_fill);
+    Out const fill_value{fill.is_valid(stream) ? fill.value(stream) : Out{}};
+
+    auto const device_input = table_device_view::create(input, stream);
+    auto const num_column_tiles =
+      util::div_rounding_up_safe<size_type>(input.num_columns(), matrix_tile_dim);
+    dim3 const grid(util::div_rounding_up_safe<size_type>(input.num_rows(), matrix_tile_dim),
+                    std::min(num_column_tiles, max_matrix_col_tiles));
+    dim3 const block(matrix_tile_dim, matrix_block_rows);
+
+    auto* const data = static_cast<Out*>(output);
+    if (order == matrix_order::ROW_MAJOR) {
+      dense_matrix_tiles<Out, matrix_order::ROW_MAJOR>
+        <<<grid, block, 0, stream>>>(*device_input, data, fill_value);
+    } else {
+      dense_matrix_tiles<Out, matrix_order::COLUMN_MAJOR>
+        <<<grid, block, 0, stream>>>(*device_input, data, fill_value);
+    }
+    CHECK_CUDA(stream);
+  }
+
+  template <typename Out, std::enable_if_t<not is_numeric<Out>()>* = nullptr>
+  void operator()(table_view const&, scalar const&, matrix_order, void*, cudaStream_t) {
+    CUDF_FAIL("Dense matrix type must be numeric");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<rmm::device_buffer> to_dense_matrix(table_view const& input,
+                                                    data_type type,
+                                                    scalar const& null_fill,
+                                                    matrix_order order,
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    cudaStream_t stream = 0) {
+  CUDF_EXPECTS(is_numeric(type), "Dense matrix type must be numeric");
+  CUDF_EXPECTS(null_fill.type() == type, "null_fill must be of the dense matrix type");
+  CUDF_EXPECTS(
+    std::all_of(input.begin(), input.end(), [](auto const& col) { return is_numeric(col.type()); }),
+    "Dense matrix columns must be numeric");
+  if (std::any_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); })) {
+    CUDF_EXPECTS(null_fill.is_valid(stream), "null_fill must be valid if the input has nulls");
+  }
+
+  auto const size = static_cast<std::size_t>(input.num_rows()) * input.num_columns();
+  auto output     = std::make_unique<rmm::device_buffer>(size * size_of(type), stream, mr);
+  if (size == 0) { return output; }
+
+  type_dispatcher(type, dense_matrix_functor{}, input, null_fill, order, output->data(), stream);
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_buffer> to_dense_matrix(table_view const& input,
+                                                    data_type type,
+                                                    scalar const& null_fill,
+                                                    matrix_order order,
+                                                    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::to_dense_matrix(input, type, null_fill, order, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
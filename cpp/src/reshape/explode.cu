@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the row of the list holding each element `first + i` of the
+ * child, found in the `num_rows + 1` offsets of the lists
+ */
+struct element_row_functor {
+  size_type const* offsets;
+  size_type num_rows;
+  size_type first;
+
+  __device__ size_type operator()(size_type i) const {
+    auto const it =
+      thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_rows + 1, first + i);
+    return static_cast<size_type>(it - (offsets + 1));
+  }
+};
+
+/**
+ * @brief Returns whether the list holding an element of the child is valid
+ */
+struct valid_element_functor {
+  column_device_view lists;
+  element_row_functor row_of;
+
+  __device__ bool operator()(size_type element) const { return lists.is_valid(row_of(element)); }
+};
+
+}  // namespace
+
+std::unique_ptr<table> explode(table_view const& input,
+                               size_type explode_column_idx,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream = 0) {
+  CUDF_EXPECTS(explode_column_idx >= 0 and explode_column_idx < input.num_columns(),
+               "Invalid explode column index");
+  column_view const explode_column = input.column(explode_column_idx);
+  CUDF_EXPECTS(explode_column.type().id() == LIST, "Only LIST columns can be exploded");
+  lists_column_view lists(explode_column);
+  size_type const num_rows = lists.size();
+  if (num_rows == 0) { return empty_like(input); }
+
+  // The elements of the rows of the view are contiguous in the child
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  size_type bounds[2];
+  CUDA_TRY(
+    cudaMemcpyAsync(&bounds[0], d_offsets, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &bounds[1], d_offsets + num_rows, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDF_STREAM_SYNC(stream);
+  size_type const first_element = bounds[0];
+  size_type const num_elements  = bounds[1] - bounds[0];
+
+  std::vector<column_view> other_columns;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    if (c != explode_column_idx) { other_columns.push_back(input.column(c)); }
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::unique_ptr<column> exploded;
+  if (not lists.has_nulls()) {
+    // Every element is exploded by a single gather of the rows of the lists
+    auto const element_rows = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      element_row_functor{d_offsets, num_rows, first_element});
+    columns = detail::gather(table_view{other_columns},
+                             element_rows,
+                             element_rows + num_elements,
+                             false,
+                             mr,
+                             stream)
+                ->release();
+    exploded = std::make_unique<column>(
+      cudf::experimental::slice(lists.child(), {first_element, first_element + num_elements})
+        .front(),
+      stream,
+      mr);
+  } else {
+    // The elements of null lists, if any, are dropped with their rows
+    auto d_lists = column_device_view::create(explode_column, stream);
+    rmm::device_vector<size_type> elements(num_elements);
+    auto const row_of = element_row_functor{d_offsets, num_rows, 0};
+    auto const end    = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                     thrust::make_counting_iterator<size_type>(first_element),
+                                     thrust::make_counting_iterator<size_type>(bounds[1]),
+                                     elements.begin(),
+                                     valid_element_functor{*d_lists, row_of});
+    auto const num_exploded = static_cast<size_type>(end - elements.begin());
+    auto const element_rows = thrust::make_transform_iterator(elements.begin(), row_of);
+    columns = detail::gather(table_view{other_columns},
+                             element_rows,
+                             element_rows + num_exploded,
+                             false,
+                             mr,
+                             stream)
+                ->release();
+    exploded = std::move(detail::gather(table_view{{lists.child()}},
+                                        elements.begin(),
+                                        elements.begin() + num_exploded,
+                                        false,
+                                        mr,
+                                        stream)
+                           ->release()
+                           .front());
+  }
+  columns.insert(columns.begin() + explode_column_idx, std::move(exploded));
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> explode(table_view const& input,
+                               size_type explode_column_idx,
+                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::explode(input, explode_column_idx, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
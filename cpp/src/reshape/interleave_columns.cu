@@ -42,7 +42,7 @@ struct interleave_columns_functor {
     auto output_size = input.num_columns() * input.num_rows();
     auto output =
       allocate_like(arch_column, output_size, mask_allocation_policy::NEVER, mr, stream);
-    auto device_input  = table_device_view::create(input);
+    auto device_input  = table_device_view::create(input, stream);
     auto device_output = mutable_column_device_view::create(*output);
     auto index_begin   = thrust::make_counting_iterator<size_type>(0);
     auto index_end     = thrust::make_counting_iterator<size_type>(output_size);
@@ -77,7 +77,8 @@ struct interleave_columns_functor {
     rmm::device_buffer mask;
     size_type null_count;
 
-    std::tie(mask, null_count) = valid_if(index_begin, index_end, func_validity, stream, mr);
+    std::tie(mask, null_count) =
+      valid_if(index_begin, index_end, func_validity, stream, mr, null_count_policy::DEFER);
 
     output->set_null_mask(std::move(mask), null_count);
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+struct tile_functor {
+  size_type count;
+  size_type __device__ operator()(size_type i) const { return i % count; }
+};
+
+struct block_functor {
+  size_type block_size;
+  size_type __device__ operator()(size_type i) const { return i / block_size; }
+};
+
+/**
+ * @brief Stores the index of each value at the position of its element in the
+ * column-major gather map of the output, ignoring out-of-bounds indices
+ */
+struct pivot_scatter_functor {
+  size_type const* row_indices;
+  size_type const* column_indices;
+  size_type num_rows;
+  size_type num_columns;
+  size_type* gather_map;
+
+  __device__ void operator()(size_type i) const {
+    auto const row    = row_indices[i];
+    auto const column = column_indices[i];
+    if (row < 0 or row >= num_rows or column < 0 or column >= num_columns) { return; }
+    gather_map[static_cast<int64_t>(column) * num_rows + row] = i;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> melt(table_view const& input,
+                            std::vector<size_type> const& id_columns,
+                            std::vector<size_type> const& value_columns,
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream = 0) {
+  CUDF_EXPECTS(not value_columns.empty(), "No value columns to melt");
+  std::vector<column_view> values;
+  for (auto c : value_columns) { values.push_back(input.column(c)); }
+  CUDF_EXPECTS(std::all_of(values.begin(),
+                           values.end(),
+                           [&values](column_view const& col) {
+                             return col.type() == values.front().type();
+                           }),
+               "Value columns must be of the same type");
+
+  size_type const num_rows   = input.num_rows();
+  size_type const num_melted = num_rows * static_cast<size_type>(values.size());
+  auto const counting_it     = thrust::make_counting_iterator<size_type>(0);
+
+  // The id columns of each value column's block of rows are a tile of the rows
+  std::vector<std::unique_ptr<column>> columns;
+  if (not id_columns.empty() and num_rows > 0) {
+    auto const tiled_it = thrust::make_transform_iterator(counting_it, tile_functor{num_rows});
+    columns =
+      detail::gather(
+        input.select(id_columns), tiled_it, tiled_it + num_melted, false, mr, stream)
+        ->release();
+  } else {
+    for (auto c : id_columns) { columns.push_back(empty_like(input.column(c))); }
+  }
+
+  auto variable = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_melted, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows > 0) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting_it,
+                      counting_it + num_melted,
+                      variable->mutable_view().begin<size_type>(),
+                      block_functor{num_rows});
+  }
+  columns.push_back(std::move(variable));
+  columns.push_back(cudf::detail::concatenate(values, mr, stream));
+  return std::make_unique<table>(std::move(columns));
+}
+
+std::unique_ptr<table> pivot(column_view const& values,
+                             column_view const& row_indices,
+                             column_view const& column_indices,
+                             size_type num_rows,
+                             size_type num_columns,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream = 0) {
+  CUDF_EXPECTS(num_rows >= 0 and num_columns >= 0, "Invalid pivot dimensions");
+  for (auto const& indices : {row_indices, column_indices}) {
+    CUDF_EXPECTS(indices.type().id() == type_to_id<size_type>(), "Indices must be INT32");
+    CUDF_EXPECTS(not indices.has_nulls(), "Indices must not have nulls");
+    CUDF_EXPECTS(indices.size() == values.size(), "Size mismatch between indices and values");
+  }
+
+  // Elements without a value gather out of bounds, i.e. null
+  rmm::device_vector<size_type> gather_map(static_cast<size_t>(num_rows) * num_columns,
+                                           values.size());
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     values.size(),
+                     pivot_scatter_functor{row_indices.data<size_type>(),
+                                           column_indices.data<size_type>(),
+                                           num_rows,
+                                           num_columns,
+                                           gather_map.data().get()});
+
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const begin = gather_map.begin() + static_cast<int64_t>(c) * num_rows;
+    columns.push_back(std::move(
+      detail::gather(table_view{{values}}, begin, begin + num_rows, true, mr, stream)
+        ->release()
+        .front()));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> melt(table_view const& input,
+                            std::vector<size_type> const& id_columns,
+                            std::vector<size_type> const& value_columns,
+                            rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::melt(input, id_columns, value_columns, mr);
+}
+
+std::unique_ptr<table> pivot(column_view const& values,
+                             column_view const& row_indices,
+                             column_view const& column_indices,
+                             size_type num_rows,
+                             size_type num_columns,
+                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::pivot(values, row_indices, column_indices, num_rows, num_columns, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
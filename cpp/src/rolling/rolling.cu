@@ -24,12 +24,18 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
 #include <cudf/rolling.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/nvtx_utils.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <rolling/rolling_detail.hpp>
+#include <rolling/sliding_window.cuh>
 
 #include <jit/launcher.h>
 #include <jit/parser.h>
@@ -50,6 +56,46 @@ namespace experimental {
 namespace detail {
 
 namespace {  // anonymous
+/**
+ * @brief The parameters of the rolling aggregations that are not described by
+ *        their kind alone
+ */
+struct window_agg_params {
+  size_type ddof{1};             ///< Delta degrees of freedom of VARIANCE and STD
+  size_type n{0};                ///< Index of NTH_ELEMENT in each window
+  bool nth_include_nulls{true};  ///< Whether NTH_ELEMENT counts the null elements
+};
+
+window_agg_params make_window_agg_params(aggregation const& agg) {
+  window_agg_params params;
+  if (agg.kind == aggregation::VARIANCE || agg.kind == aggregation::STD) {
+    params.ddof = static_cast<std_var_aggregation const&>(agg)._ddof;
+  } else if (agg.kind == aggregation::NTH_ELEMENT) {
+    auto const& nth          = static_cast<nth_element_aggregation const&>(agg);
+    params.n                 = nth.n;
+    params.nth_include_nulls = nth._include_nulls == include_nulls::YES;
+  }
+  return params;
+}
+
+/**
+ * @brief A range of input rows staged in shared memory, accessed like the
+ *        `column_device_view` it was copied from
+ */
+template <typename T>
+struct shared_window_tile {
+  T const* values;     ///< The elements of rows `[begin, begin + size)`
+  bool const* valids;  ///< The validity of rows `[begin, begin + size)`
+  size_type begin;     ///< The first staged row
+
+  __device__ bool is_valid(size_type i) const { return valids[i - begin]; }
+
+  template <typename U>
+  __device__ U element(size_type i) const {
+    return values[i - begin];
+  }
+};
+
 /**
  * @brief Only count operation is executed and count is updated
  *        depending on `min_periods` and returns true if it was
@@ -59,15 +105,17 @@ template <typename InputType,
           typename OutputType,
           typename agg_op,
           aggregation::Kind op,
-          bool has_nulls>
+          bool has_nulls,
+          typename Input>
 std::enable_if_t<op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL, bool> __device__
-process_rolling_window(column_device_view input,
+process_rolling_window(Input input,
                        mutable_column_device_view output,
                        size_type start_index,
                        size_type end_index,
                        size_type current_index,
                        size_type min_periods,
-                       InputType identity) {
+                       InputType identity,
+                       window_agg_params params) {
   // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
   // for CUDA 10.0 and below (fixed in CUDA 10.1)
   volatile cudf::size_type count = 0;
@@ -91,17 +139,19 @@ template <typename InputType,
           typename OutputType,
           typename agg_op,
           aggregation::Kind op,
-          bool has_nulls>
+          bool has_nulls,
+          typename Input>
 std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
                    std::is_same<InputType, cudf::string_view>::value,
                  bool>
-  __device__ process_rolling_window(column_device_view input,
+  __device__ process_rolling_window(Input input,
                                     mutable_column_device_view output,
                                     size_type start_index,
                                     size_type end_index,
                                     size_type current_index,
                                     size_type min_periods,
-                                    InputType identity) {
+                                    InputType identity,
+                                    window_agg_params params) {
   // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
   // for CUDA 10.0 and below (fixed in CUDA 10.1)
   volatile cudf::size_type count = 0;
@@ -110,7 +160,7 @@ std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
 
   for (size_type j = start_index; j < end_index; j++) {
     if (!has_nulls || input.is_valid(j)) {
-      InputType element = input.element<InputType>(j);
+      InputType element = input.template element<InputType>(j);
       val               = agg_op{}(element, val);
       if (val == element) { val_index = j; }
       count++;
@@ -127,6 +177,107 @@ std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
   return true;
 }
 
+/**
+ * @brief Computes VARIANCE and STD of fixed-width types in two passes over
+ *        the window, and returns true if the operation was valid, else false.
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          bool has_nulls,
+          typename Input>
+std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
+                   (op == aggregation::VARIANCE || op == aggregation::STD),
+                 bool>
+  __device__ process_rolling_window(Input input,
+                                    mutable_column_device_view output,
+                                    size_type start_index,
+                                    size_type end_index,
+                                    size_type current_index,
+                                    size_type min_periods,
+                                    InputType identity,
+                                    window_agg_params params) {
+  size_type count{0};
+  double sum{0};
+  for (size_type j = start_index; j < end_index; j++) {
+    if (!has_nulls || input.is_valid(j)) {
+      sum += static_cast<double>(input.template element<InputType>(j));
+      count++;
+    }
+  }
+
+  bool output_is_valid = (count >= min_periods) && (count > params.ddof);
+  if (!output_is_valid) { return false; }
+
+  double const mean = sum / count;
+  double sum_of_squares{0};
+  for (size_type j = start_index; j < end_index; j++) {
+    if (!has_nulls || input.is_valid(j)) {
+      double const delta = static_cast<double>(input.template element<InputType>(j)) - mean;
+      sum_of_squares += delta * delta;
+    }
+  }
+
+  double const variance = sum_of_squares / (count - params.ddof);
+  output.element<OutputType>(current_index) =
+    (op == aggregation::STD) ? sqrt(variance) : variance;
+
+  return output_is_valid;
+}
+
+/**
+ * @brief Selects the NTH_ELEMENT of the window of fixed-width types, and
+ *        returns true if it exists and is valid, else false.
+ *
+ * Negative `n` counts from the end of the window. If nulls are excluded, `n`
+ * is an index into the valid elements of the window only.
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          bool has_nulls,
+          typename Input>
+std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
+                   op == aggregation::NTH_ELEMENT,
+                 bool>
+  __device__ process_rolling_window(Input input,
+                                    mutable_column_device_view output,
+                                    size_type start_index,
+                                    size_type end_index,
+                                    size_type current_index,
+                                    size_type min_periods,
+                                    InputType identity,
+                                    window_agg_params params) {
+  size_type count{0};
+  for (size_type j = start_index; j < end_index; j++) {
+    if (!has_nulls || input.is_valid(j)) { count++; }
+  }
+  if (count < min_periods) { return false; }
+
+  if (params.nth_include_nulls || !has_nulls) {
+    size_type const size  = end_index - start_index;
+    size_type const index = (params.n < 0) ? size + params.n : params.n;
+    if (index < 0 || index >= size) { return false; }
+    auto const j = start_index + index;
+    if (has_nulls && !input.is_valid(j)) { return false; }
+    output.element<OutputType>(current_index) = input.template element<InputType>(j);
+    return true;
+  }
+
+  size_type const index = (params.n < 0) ? count + params.n : params.n;
+  if (index < 0 || index >= count) { return false; }
+  size_type valid_index{0};
+  for (size_type j = start_index; j < end_index; j++) {
+    if (input.is_valid(j) && valid_index++ == index) {
+      output.element<OutputType>(current_index) = input.template element<InputType>(j);
+      break;
+    }
+  }
+  return true;
+}
+
 /**
  * @brief Operates on only fixed-width types and returns true if the
  *        operation was valid, else false.
@@ -135,17 +286,21 @@ template <typename InputType,
           typename OutputType,
           typename agg_op,
           aggregation::Kind op,
-          bool has_nulls>
+          bool has_nulls,
+          typename Input>
 std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
-                   !(op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL),
+                   !(op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL ||
+                     op == aggregation::VARIANCE || op == aggregation::STD ||
+                     op == aggregation::NTH_ELEMENT),
                  bool>
-  __device__ process_rolling_window(column_device_view input,
+  __device__ process_rolling_window(Input input,
                                     mutable_column_device_view output,
                                     size_type start_index,
                                     size_type end_index,
                                     size_type current_index,
                                     size_type min_periods,
-                                    InputType identity) {
+                                    InputType identity,
+                                    window_agg_params params) {
   // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
   // for CUDA 10.0 and below (fixed in CUDA 10.1)
   volatile cudf::size_type count = 0;
@@ -153,7 +308,7 @@ std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
 
   for (size_type j = start_index; j < end_index; j++) {
     if (!has_nulls || input.is_valid(j)) {
-      OutputType element = input.element<InputType>(j);
+      OutputType element = input.template element<InputType>(j);
       val                = agg_op{}(element, val);
       count++;
     }
@@ -168,9 +323,21 @@ std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
   return output_is_valid;
 }
 
+/**
+ * @brief The maximum number of rows staged in shared memory by a block of
+ *        `gpu_rolling`
+ */
+constexpr size_type rolling_tile_size{2048};
+
 /**
  * @brief Computes the rolling window function
  *
+ * Each block computes the windows of `block_size` consecutive rows at a time.
+ * If the windows of these rows overlap, so that their union of at most
+ * `tile_size` rows is smaller than the total size of the windows, the union
+ * is first staged in shared memory, and every window is aggregated from it.
+ * Otherwise the windows are aggregated from global memory.
+ *
  * @tparam InputType  Datatype of `input`
  * @tparam OutputType  Datatype of `output`
  * @tparam agg_op  A functor that defines the aggregation operation
@@ -189,6 +356,9 @@ std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
  * @param min_periods[in]  Minimum number of observations in window required to
  *                have a value, otherwise 0 is stored in the valid bit mask
  * @param identity identity value of `InputType`
+ * @param params The parameters of the aggregation
+ * @param tile_size The number of rows that fit in the dynamic shared memory,
+ *                which holds `tile_size` elements followed by their validity
  */
 template <typename InputType,
           typename OutputType,
@@ -205,44 +375,84 @@ __launch_bounds__(block_size) __global__
                    PrecedingWindowIterator preceding_window_begin,
                    FollowingWindowIterator following_window_begin,
                    size_type min_periods,
-                   InputType identity) {
-  size_type i      = blockIdx.x * block_size + threadIdx.x;
-  size_type stride = block_size * gridDim.x;
+                   InputType identity,
+                   window_agg_params params,
+                   size_type tile_size) {
+  extern __shared__ __align__(sizeof(double)) uint8_t rolling_tile[];
+  __shared__ size_type tile_begin;
+  __shared__ size_type tile_end;
+  __shared__ size_type total_window_size;
+
+  auto const tile_values = reinterpret_cast<InputType*>(rolling_tile);
+  auto const tile_valids = reinterpret_cast<bool*>(tile_values + tile_size);
+  size_type const size   = input.size();
+  size_type const stride = block_size * gridDim.x;
 
   size_type warp_valid_count{0};
 
-  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
-  while (i < input.size()) {
-    size_type preceding_window = preceding_window_begin[i];
-    size_type following_window = following_window_begin[i];
+  // Every thread of the block runs the same iterations, so that they can share the tile
+  for (size_type base = blockIdx.x * block_size; base < size; base += stride) {
+    size_type const i = base + threadIdx.x;
 
     // compute bounds
-    size_type start       = min(input.size(), max(0, i - preceding_window + 1));
-    size_type end         = min(input.size(), max(0, i + following_window + 1));
-    size_type start_index = min(start, end);
-    size_type end_index   = max(start, end);
+    size_type start_index{0};
+    size_type end_index{0};
+    if (i < size) {
+      auto const bounds = window_bounds(i, size, preceding_window_begin, following_window_begin);
+      start_index = bounds.first;
+      end_index   = bounds.second;
+    }
 
-    // aggregate
-    // TODO: We should explore using shared memory to avoid redundant loads.
-    //       This might require separating the kernel into a special version
-    //       for dynamic and static sizes.
+    if (threadIdx.x == 0) {
+      tile_begin        = size;
+      tile_end          = 0;
+      total_window_size = 0;
+    }
+    __syncthreads();
+    if (i < size && start_index < end_index) {
+      atomicMin(&tile_begin, start_index);
+      atomicMax(&tile_end, end_index);
+      atomicAdd(&total_window_size, end_index - start_index);
+    }
+    __syncthreads();
+    size_type const begin = tile_begin;
+    size_type const end   = tile_end;
 
+    // aggregate
     volatile bool output_is_valid = false;
-    output_is_valid = process_rolling_window<InputType, OutputType, agg_op, op, has_nulls>(
-      input, output, start_index, end_index, i, min_periods, identity);
+    if (end - begin <= tile_size && end - begin < total_window_size) {
+      for (size_type j = begin + threadIdx.x; j < end; j += block_size) {
+        tile_values[j - begin] = input.element<InputType>(j);
+        tile_valids[j - begin] = !has_nulls || input.is_valid(j);
+      }
+      __syncthreads();
+      if (i < size) {
+        output_is_valid = process_rolling_window<InputType, OutputType, agg_op, op, has_nulls>(
+          shared_window_tile<InputType>{tile_values, tile_valids, begin},
+          output,
+          start_index,
+          end_index,
+          i,
+          min_periods,
+          identity,
+          params);
+      }
+    } else if (i < size) {
+      output_is_valid = process_rolling_window<InputType, OutputType, agg_op, op, has_nulls>(
+        input, output, start_index, end_index, i, min_periods, identity, params);
+    }
 
     // set the mask
-    cudf::bitmask_type result_mask{__ballot_sync(active_threads, output_is_valid)};
+    cudf::bitmask_type result_mask{__ballot_sync(0xffffffff, output_is_valid)};
 
     // only one thread writes the mask
-    if (0 == threadIdx.x % cudf::experimental::detail::warp_size) {
+    if (0 == threadIdx.x % cudf::experimental::detail::warp_size && i < size) {
       output.set_mask_word(cudf::word_index(i), result_mask);
       warp_valid_count += __popc(result_mask);
     }
 
-    // process next element
-    i += stride;
-    active_threads = __ballot_sync(active_threads, i < input.size());
+    // the tile and its bounds are reused by the next rows
+    __syncthreads();
   }
 
   // sum the valid counts across the whole block
@@ -277,24 +487,33 @@ struct rolling_window_launcher {
 
     rmm::device_scalar<size_type> device_valid_count{0, stream};
 
+    auto const params = make_window_agg_params(*agg);
+    // Staging strings would only save the loads of their offsets
+    size_type const tile_size = std::is_same<T, cudf::string_view>::value ? 0 : rolling_tile_size;
+    size_t const shared_size  = tile_size * (sizeof(T) + sizeof(bool));
+
     if (input.has_nulls()) {
       gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size, true>
-        <<<grid.num_blocks, block_size, 0, stream>>>(*input_device_view,
-                                                     *output_device_view,
-                                                     device_valid_count.data(),
-                                                     preceding_window_begin,
-                                                     following_window_begin,
-                                                     min_periods,
-                                                     identity);
+        <<<grid.num_blocks, block_size, shared_size, stream>>>(*input_device_view,
+                                                               *output_device_view,
+                                                               device_valid_count.data(),
+                                                               preceding_window_begin,
+                                                               following_window_begin,
+                                                               min_periods,
+                                                               identity,
+                                                               params,
+                                                               tile_size);
     } else {
       gpu_rolling<T, target_type_t<InputType, op>, agg_op, op, block_size, false>
-        <<<grid.num_blocks, block_size, 0, stream>>>(*input_device_view,
-                                                     *output_device_view,
-                                                     device_valid_count.data(),
-                                                     preceding_window_begin,
-                                                     following_window_begin,
-                                                     min_periods,
-                                                     identity);
+        <<<grid.num_blocks, block_size, shared_size, stream>>>(*input_device_view,
+                                                               *output_device_view,
+                                                               device_valid_count.data(),
+                                                               preceding_window_begin,
+                                                               following_window_begin,
+                                                               min_periods,
+                                                               identity,
+                                                               params,
+                                                               tile_size);
     }
 
     size_type valid_count = device_valid_count.value(stream);
@@ -327,6 +546,23 @@ struct rolling_window_launcher {
          cudaStream_t stream) {
     if (input.is_empty()) return empty_like(input);
 
+    // Large windows are aggregated in time independent of their size
+    if (is_sliding_window_supported<T, op>()) {
+      auto const max_window =
+        max_window_size(input.size(), preceding_window_begin, following_window_begin, stream);
+      if (max_window >= sliding_window_min_size) {
+        return sliding_rolling_window<T, target_type_t<InputType, op>, agg_op, op>(
+          input,
+          preceding_window_begin,
+          following_window_begin,
+          min_periods,
+          max_window,
+          target_type(input.type(), op),
+          mr,
+          stream);
+      }
+    }
+
     auto output = make_fixed_width_column(
       target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
 
@@ -470,7 +706,10 @@ struct rolling_window_launcher {
   template <aggregation::Kind op,
             typename PrecedingWindowIterator,
             typename FollowingWindowIterator>
-  std::enable_if_t<!(op == aggregation::MEAN), std::unique_ptr<column>> operator()(
+  std::enable_if_t<!(op == aggregation::MEAN || op == aggregation::VARIANCE ||
+                     op == aggregation::STD || op == aggregation::NTH_ELEMENT),
+                   std::unique_ptr<column>>
+  operator()(
     column_view const& input,
     PrecedingWindowIterator preceding_window_begin,
     FollowingWindowIterator following_window_begin,
@@ -486,11 +725,15 @@ struct rolling_window_launcher {
       input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
   }
 
-  // This variant is just to handle mean
+  // This variant is just to handle mean, and the aggregations without a
+  // corresponding operator, for which DeviceSum only provides the identity
   template <aggregation::Kind op,
             typename PrecedingWindowIterator,
             typename FollowingWindowIterator>
-  std::enable_if_t<(op == aggregation::MEAN), std::unique_ptr<column>> operator()(
+  std::enable_if_t<(op == aggregation::MEAN || op == aggregation::VARIANCE ||
+                    op == aggregation::STD || op == aggregation::NTH_ELEMENT),
+                   std::unique_ptr<column>>
+  operator()(
     column_view const& input,
     PrecedingWindowIterator preceding_window_begin,
     FollowingWindowIterator following_window_begin,
@@ -712,28 +955,207 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
-std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
-                                               column_view const& input,
-                                               size_type preceding_window,
-                                               size_type following_window,
-                                               size_type min_periods,
-                                               std::unique_ptr<aggregation> const& aggr,
-                                               rmm::mr::device_memory_resource* mr) {
-  if (input.size() == 0) return empty_like(input);
+namespace {
 
-  CUDF_EXPECTS(group_keys.num_columns() > 0,
-               "Cannot calculate grouped_rolling_window without grouping-key columns.");
+/**
+ * @brief Returns the number of each row in its group, from 1
+ */
+std::unique_ptr<column> grouped_row_number(
+  column_view const& input,
+  rmm::device_vector<cudf::size_type> const& group_offsets,
+  rmm::device_vector<cudf::size_type> const& group_labels,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    result->mutable_view().begin<size_type>(),
+                    [d_group_offsets = group_offsets.data().get(),
+                     d_group_labels  = group_labels.data().get()] __device__(size_type idx) {
+                      return idx - d_group_offsets[d_group_labels[idx]] + 1;
+                    });
+  return result;
+}
 
-  CUDF_EXPECTS((group_keys.num_rows() == input.size()),
-               "Size mismatch between group_keys and input vector.");
+/**
+ * @brief Returns the value of the row `row_offset` rows after each row in its
+ * group, or `default_outputs` (or null if it is `nullptr`) where there is no
+ * such row
+ *
+ * The rows are gathered, so any type is supported.
+ */
+std::unique_ptr<column> grouped_lead_lag(
+  column_view const& input,
+  column_view const* default_outputs,
+  rmm::device_vector<cudf::size_type> const& group_offsets,
+  rmm::device_vector<cudf::size_type> const& group_labels,
+  size_type row_offset,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  if (default_outputs != nullptr) {
+    CUDF_EXPECTS(default_outputs->type() == input.type(),
+                 "Defaults must be of the type of the input column.");
+    CUDF_EXPECTS(default_outputs->size() == input.size(),
+                 "Size mismatch between defaults and input vector.");
+  }
+  // The rows without a row at the offset gather past the end, i.e. null
+  size_type const num_rows = input.size();
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    gather_map.begin(),
+                    [d_group_offsets = group_offsets.data().get(),
+                     d_group_labels  = group_labels.data().get(),
+                     row_offset,
+                     num_rows] __device__(size_type idx) {
+                      auto const group_label = d_group_labels[idx];
+                      auto const target      = static_cast<int64_t>(idx) + row_offset;
+                      bool const in_group    = target >= d_group_offsets[group_label] &&
+                                            target < d_group_offsets[group_label + 1];
+                      return in_group ? static_cast<size_type>(target) : num_rows;
+                    });
+  column_view map_view{data_type{type_to_id<size_type>()}, num_rows, gather_map.data().get()};
+  if (default_outputs == nullptr) {
+    return std::move(detail::gather(table_view{{input}}, map_view, false, true, false, mr, stream)
+                       ->release()
+                       .front());
+  }
+  auto gathered = detail::gather(
+    table_view{{input}}, map_view, false, true, false, rmm::mr::get_default_resource(), stream);
+  auto outside = make_numeric_column(
+    data_type{BOOL8}, num_rows, mask_state::UNALLOCATED, stream, rmm::mr::get_default_resource());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    gather_map.begin(),
+                    gather_map.end(),
+                    outside->mutable_view().begin<experimental::bool8>(),
+                    [num_rows] __device__(size_type target) {
+                      return experimental::bool8{target == num_rows};
+                    });
+  return detail::copy_if_else(*default_outputs, gathered->get_column(0), *outside, mr, stream);
+}
 
-  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+/**
+ * @brief Returns whether the running aggregate of each group for `kind` is
+ * computed by a segmented scan
+ */
+bool is_running_aggregation(aggregation::Kind kind, data_type type) {
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX: return is_numeric(type) and type.id() != BOOL8;
+    default: return false;
+  }
+}
 
-  using sort_groupby_helper = cudf::experimental::groupby::detail::sort::sort_groupby_helper;
-  sort_groupby_helper helper{group_keys, cudf::include_nulls::YES, cudf::sorted::YES};
+/**
+ * @brief Returns the aggregate of the rows of each group up to each row
+ *
+ * The values and the number of rows counted for `min_periods` are both
+ * computed by segmented scans, in time independent of the size of the groups.
+ */
+std::unique_ptr<column> grouped_running_window(
+  column_view const& input,
+  rmm::device_vector<cudf::size_type> const& group_offsets,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  size_type const num_rows = input.size();
+  column_view offsets{data_type{type_to_id<size_type>()},
+                      static_cast<size_type>(group_offsets.size()),
+                      group_offsets.data().get()};
+  bool const is_count =
+    aggr->kind == aggregation::COUNT_VALID || aggr->kind == aggregation::COUNT_ALL;
+
+  // Whether each row is counted for `min_periods`
+  auto counted = make_numeric_column(data_type{type_to_id<size_type>()},
+                                     num_rows,
+                                     mask_state::UNALLOCATED,
+                                     stream,
+                                     rmm::mr::get_default_resource());
+  auto d_input = column_device_view::create(input, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    counted->mutable_view().begin<size_type>(),
+                    [d_input   = *d_input,
+                     count_all = aggr->kind == aggregation::COUNT_ALL] __device__(size_type idx) {
+                      return (count_all || d_input.is_valid(idx)) ? 1 : 0;
+                    });
+  auto counts = detail::segmented_scan(*counted,
+                                       offsets,
+                                       make_sum_aggregation(),
+                                       scan_type::INCLUSIVE,
+                                       include_nulls::NO,
+                                       is_count ? mr : rmm::mr::get_default_resource(),
+                                       stream);
+  std::unique_ptr<column> result;
+  if (is_count) {
+    result = std::move(counts);
+  } else {
+    // The scan keeps the type of its input, which is cast to the type of the
+    // windowed aggregation, e.g. INT64 for the sum of INT32
+    auto const output_type = detail::target_type(input.type(), aggr->kind);
+    std::unique_ptr<column> cast_input;
+    if (not(output_type == input.type())) {
+      cast_input = detail::cast(input, output_type, rmm::mr::get_default_resource(), stream);
+    }
+    result = detail::segmented_scan(cast_input ? cast_input->view() : input,
+                                    offsets,
+                                    aggr,
+                                    scan_type::INCLUSIVE,
+                                    include_nulls::NO,
+                                    mr,
+                                    stream);
+  }
 
-  auto group_offsets{helper.group_offsets()};
-  auto const& group_labels{helper.group_labels()};
+  auto const d_counts = (is_count ? result : counts)->view().data<size_type>();
+  auto valid          = detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [d_counts, min_periods] __device__(size_type idx) { return d_counts[idx] >= min_periods; },
+    stream,
+    mr);
+  result->set_null_mask(std::move(valid.first), valid.second);
+  return result;
+}
+
+std::unique_ptr<column> grouped_rolling_window_impl(
+  column_view const& input,
+  column_view const* default_outputs,
+  rmm::device_vector<cudf::size_type> const& group_offsets,
+  rmm::device_vector<cudf::size_type> const& group_labels,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr) {
+  switch (aggr->kind) {
+    case aggregation::ROW_NUMBER:
+      return grouped_row_number(input, group_offsets, group_labels, mr, 0);
+    case aggregation::LEAD:
+    case aggregation::LAG: {
+      auto const offset = static_cast<detail::lead_lag_aggregation const&>(*aggr).row_offset;
+      return grouped_lead_lag(input,
+                              default_outputs,
+                              group_offsets,
+                              group_labels,
+                              aggr->kind == aggregation::LEAD ? offset : -offset,
+                              mr,
+                              0);
+    }
+    default: break;
+  }
+  if (preceding_window == UNBOUNDED_WINDOW && following_window == 0 &&
+      is_running_aggregation(aggr->kind, input.type())) {
+    return grouped_running_window(input, group_offsets, min_periods, aggr, mr, 0);
+  }
 
   // `group_offsets` are interpreted in adjacent pairs, each pair representing the offsets
   // of the first, and one past the last elements in a group.
@@ -782,6 +1204,117 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
     mr);
 }
 
+}  // namespace
+
+namespace {
+
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               column_view const* default_outputs,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  if (input.size() == 0) return empty_like(input);
+
+  CUDF_EXPECTS(group_keys.num_columns() > 0,
+               "Cannot calculate grouped_rolling_window without grouping-key columns.");
+
+  CUDF_EXPECTS((group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  using sort_groupby_helper = cudf::experimental::groupby::detail::sort::sort_groupby_helper;
+  sort_groupby_helper helper{group_keys, cudf::include_nulls::YES, cudf::sorted::YES};
+
+  return grouped_rolling_window_impl(input,
+                                     default_outputs,
+                                     helper.group_offsets(),
+                                     helper.group_labels(),
+                                     preceding_window,
+                                     following_window,
+                                     min_periods,
+                                     aggr,
+                                     mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(groupby::groupby& grouping,
+                                               column_view const& input,
+                                               column_view const* default_outputs,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  if (input.size() == 0) return empty_like(input);
+
+  auto& helper = grouping.helper();
+  CUDF_EXPECTS((helper.num_keys() == input.size()),
+               "Size mismatch between grouped keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  return grouped_rolling_window_impl(input,
+                                     default_outputs,
+                                     helper.group_offsets(),
+                                     helper.group_labels(),
+                                     preceding_window,
+                                     following_window,
+                                     min_periods,
+                                     aggr,
+                                     mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  return grouped_rolling_window(
+    group_keys, input, nullptr, preceding_window, following_window, min_periods, aggr, mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               column_view const& default_outputs,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  return grouped_rolling_window(
+    group_keys, input, &default_outputs, preceding_window, following_window, min_periods, aggr, mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(groupby::groupby& grouping,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  return grouped_rolling_window(
+    grouping, input, nullptr, preceding_window, following_window, min_periods, aggr, mr);
+}
+
+std::unique_ptr<column> grouped_rolling_window(groupby::groupby& grouping,
+                                               column_view const& input,
+                                               column_view const& default_outputs,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               std::unique_ptr<aggregation> const& aggr,
+                                               rmm::mr::device_memory_resource* mr) {
+  return grouped_rolling_window(
+    grouping, input, &default_outputs, preceding_window, following_window, min_periods, aggr, mr);
+}
+
 namespace {
 bool is_supported_range_frame_unit(cudf::data_type const& data_type) {
   auto id = data_type.id();
@@ -862,31 +1395,16 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
     mr);
 }
 
-}  // namespace
-
-std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
-                                                          column_view const& timestamp_column,
-                                                          column_view const& input,
-                                                          size_type preceding_window_in_days,
-                                                          size_type following_window_in_days,
-                                                          size_type min_periods,
-                                                          std::unique_ptr<aggregation> const& aggr,
-                                                          rmm::mr::device_memory_resource* mr) {
-  if (input.size() == 0) return empty_like(input);
-
-  CUDF_EXPECTS((group_keys.num_columns() > 0), "Expected at least one grouping key.");
-
-  CUDF_EXPECTS((group_keys.num_rows() == input.size()),
-               "Size mismatch between group_keys and input vector.");
-
-  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
-
-  using sort_groupby_helper = cudf::experimental::groupby::detail::sort::sort_groupby_helper;
-  sort_groupby_helper helper{group_keys, cudf::include_nulls::YES, cudf::sorted::YES};
-
-  auto group_offsets{helper.group_offsets()};
-  auto const& group_labels{helper.group_labels()};
-
+std::unique_ptr<column> dispatch_grouped_time_range_rolling_window(
+  column_view const& input,
+  column_view const& timestamp_column,
+  rmm::device_vector<cudf::size_type> const& group_offsets,
+  rmm::device_vector<cudf::size_type> const& group_labels,
+  size_type preceding_window_in_days,
+  size_type following_window_in_days,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& aggr,
+  rmm::mr::device_memory_resource* mr) {
   // Assumes that `group_offsets` starts with `0`, ends with `input.size`
   assert(group_offsets.size() >= 2 && group_offsets[0] == 0 &&
          group_offsets[group_offsets.size() - 1] == input.size() &&
@@ -917,5 +1435,68 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
                                                              mr);
 }
 
+}  // namespace
+
+std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
+                                                          column_view const& timestamp_column,
+                                                          column_view const& input,
+                                                          size_type preceding_window_in_days,
+                                                          size_type following_window_in_days,
+                                                          size_type min_periods,
+                                                          std::unique_ptr<aggregation> const& aggr,
+                                                          rmm::mr::device_memory_resource* mr) {
+  if (input.size() == 0) return empty_like(input);
+
+  CUDF_EXPECTS((group_keys.num_columns() > 0), "Expected at least one grouping key.");
+
+  CUDF_EXPECTS((group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  using sort_groupby_helper = cudf::experimental::groupby::detail::sort::sort_groupby_helper;
+  sort_groupby_helper helper{group_keys, cudf::include_nulls::YES, cudf::sorted::YES};
+
+  return dispatch_grouped_time_range_rolling_window(input,
+                                                    timestamp_column,
+                                                    helper.group_offsets(),
+                                                    helper.group_labels(),
+                                                    preceding_window_in_days,
+                                                    following_window_in_days,
+                                                    min_periods,
+                                                    aggr,
+                                                    mr);
+}
+
+std::unique_ptr<column> grouped_time_range_rolling_window(groupby::groupby& grouping,
+                                                          column_view const& timestamp_column,
+                                                          column_view const& input,
+                                                          size_type preceding_window_in_days,
+                                                          size_type following_window_in_days,
+                                                          size_type min_periods,
+                                                          std::unique_ptr<aggregation> const& aggr,
+                                                          rmm::mr::device_memory_resource* mr) {
+  if (input.size() == 0) return empty_like(input);
+
+  auto& helper = grouping.helper();
+  CUDF_EXPECTS((helper.num_keys() == input.size()),
+               "Size mismatch between grouped keys and input vector.");
+
+  CUDF_EXPECTS((timestamp_column.size() == input.size()),
+               "Size mismatch between timestamp_column and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  return dispatch_grouped_time_range_rolling_window(input,
+                                                    timestamp_column,
+                                                    helper.group_offsets(),
+                                                    helper.group_labels(),
+                                                    preceding_window_in_days,
+                                                    following_window_in_days,
+                                                    min_periods,
+                                                    aggr,
+                                                    mr);
+}
+
 }  // namespace experimental
 }  // namespace cudf
@@ -36,13 +36,15 @@ static constexpr bool is_supported() {
   constexpr bool is_operation_supported =
     (op == experimental::aggregation::SUM) or (op == experimental::aggregation::MIN) or
     (op == experimental::aggregation::MAX) or (op == experimental::aggregation::COUNT_VALID) or
-    (op == experimental::aggregation::COUNT_ALL) or (op == experimental::aggregation::MEAN);
+    (op == experimental::aggregation::COUNT_ALL) or (op == experimental::aggregation::MEAN) or
+    (op == experimental::aggregation::VARIANCE) or (op == experimental::aggregation::STD) or
+    (op == experimental::aggregation::NTH_ELEMENT);
 
   constexpr bool is_valid_timestamp_agg =
     cudf::is_timestamp<ColumnType>() and
     (op == experimental::aggregation::MIN or op == experimental::aggregation::MAX or
      op == experimental::aggregation::COUNT_VALID or op == experimental::aggregation::COUNT_ALL or
-     op == experimental::aggregation::MEAN);
+     op == experimental::aggregation::MEAN or op == experimental::aggregation::NTH_ELEMENT);
 
   constexpr bool is_valid_numeric_agg =
     (cudf::is_numeric<ColumnType>() or is_comparable_countable_op) and is_operation_supported;
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Windows of at least this many rows are aggregated with the sliding
+ * window algorithms rather than one row at a time
+ */
+constexpr size_type sliding_window_min_size{64};
+
+/**
+ * @brief Number of rows of the blocks whose MIN or MAX are tabulated by the
+ * sliding window MIN and MAX
+ */
+constexpr size_type sliding_window_block_size{16};
+
+/**
+ * @brief Returns the bounds `[begin, end)` of the window of row `i` of a
+ * column of `size` rows
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+__device__ inline thrust::pair<size_type, size_type> window_bounds(
+  size_type i,
+  size_type size,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin) {
+  size_type preceding_window = preceding_window_begin[i];
+  size_type following_window = following_window_begin[i];
+
+  size_type start = min(size, max(0, i - preceding_window + 1));
+  size_type end   = min(size, max(0, i + following_window + 1));
+  return thrust::make_pair(min(start, end), max(start, end));
+}
+
+/**
+ * @brief Returns the number of rows of the largest window of a column of
+ * `size` rows
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+size_type max_window_size(size_type size,
+                          PrecedingWindowIterator preceding_window_begin,
+                          FollowingWindowIterator following_window_begin,
+                          cudaStream_t stream) {
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [size, preceding_window_begin, following_window_begin] __device__(size_type i) {
+      auto const bounds = window_bounds(i, size, preceding_window_begin, following_window_begin);
+      return bounds.second - bounds.first;
+    },
+    size_type{0},
+    thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Returns whether the aggregation `op` of `InputType` elements has a
+ * sliding window implementation
+ *
+ * SUM and MEAN are computed from prefix sums, so only integral inputs, whose
+ * prefix sums are exact, qualify. MEAN also requires sums that cannot
+ * overflow, as the windows' MEAN is computed in floating point.
+ */
+template <typename InputType, aggregation::Kind op>
+constexpr bool is_sliding_window_supported() {
+  return op == aggregation::COUNT_VALID or op == aggregation::COUNT_ALL or
+         op == aggregation::MIN or op == aggregation::MAX or
+         (op == aggregation::SUM and std::is_integral<InputType>::value) or
+         (op == aggregation::MEAN and std::is_integral<InputType>::value and
+          sizeof(InputType) <= sizeof(int32_t));
+}
+
+/**
+ * @brief Computes COUNT_VALID and COUNT_ALL from the number of valid rows
+ * before each row
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<op == aggregation::COUNT_VALID or op == aggregation::COUNT_ALL>
+sliding_window_values(column_device_view const& input,
+                      size_type const* valid_prefix,
+                      PrecedingWindowIterator preceding_window_begin,
+                      FollowingWindowIterator following_window_begin,
+                      size_type max_window,
+                      OutputType* output,
+                      cudaStream_t stream) {
+  auto const size = input.size();
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(size),
+                   [=] __device__(size_type i) {
+                     auto const bounds =
+                       window_bounds(i, size, preceding_window_begin, following_window_begin);
+                     output[i] = op == aggregation::COUNT_ALL
+                                   ? bounds.second - bounds.first
+                                   : valid_prefix[bounds.second] - valid_prefix[bounds.first];
+                   });
+}
+
+/**
+ * @brief Computes SUM and MEAN of integral elements from the sums of the
+ * elements before each row
+ *
+ * The prefix sums wrap around in unsigned arithmetic, so the difference of
+ * two of them is the sum of the window whenever the sum is representable.
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<(op == aggregation::SUM or op == aggregation::MEAN) and
+                 is_sliding_window_supported<InputType, op>()>
+sliding_window_values(column_device_view const& input,
+                      size_type const* valid_prefix,
+                      PrecedingWindowIterator preceding_window_begin,
+                      FollowingWindowIterator following_window_begin,
+                      size_type max_window,
+                      OutputType* output,
+                      cudaStream_t stream) {
+  auto const size = input.size();
+  rmm::device_vector<uint64_t> sum_prefix(size + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    sum_prefix.begin() + 1,
+    [input] __device__(size_type i) {
+      return input.is_valid(i) ? static_cast<uint64_t>(input.element<InputType>(i)) : uint64_t{0};
+    },
+    thrust::plus<uint64_t>{});
+
+  auto const d_sum_prefix = sum_prefix.data().get();
+  thrust::for_each(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [=] __device__(size_type i) {
+      auto const bounds = window_bounds(i, size, preceding_window_begin, following_window_begin);
+      auto const sum =
+        static_cast<int64_t>(d_sum_prefix[bounds.second] - d_sum_prefix[bounds.first]);
+      auto const count = valid_prefix[bounds.second] - valid_prefix[bounds.first];
+      if (op == aggregation::MEAN) {
+        output[i] = count > 0 ? static_cast<OutputType>(sum) / count : OutputType{0};
+      } else {
+        output[i] = static_cast<OutputType>(sum);
+      }
+    });
+}
+
+/**
+ * @brief Computes MIN and MAX from a sparse table of the MIN or MAX of the
+ * blocks of `sliding_window_block_size` rows
+ *
+ * Level `k` of the table holds the aggregate of the `2^k` blocks starting at
+ * each block. The window of a row is split into the rows before its first
+ * full block, which are aggregated one by one as are those after its last
+ * full block, and its full blocks, which are covered by two overlapping
+ * entries of a level of the table.
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<op == aggregation::MIN or op == aggregation::MAX> sliding_window_values(
+  column_device_view const& input,
+  size_type const* valid_prefix,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type max_window,
+  OutputType* output,
+  cudaStream_t stream) {
+  constexpr size_type block_size = sliding_window_block_size;
+  auto const size                = input.size();
+  auto const num_blocks          = size / block_size;
+  auto const max_blocks          = std::max(max_window / block_size, 1);
+  size_type num_levels{1};
+  while ((size_type{1} << num_levels) <= max_blocks) { ++num_levels; }
+
+  rmm::device_vector<OutputType> table(static_cast<size_t>(num_levels) * num_blocks);
+  auto const d_table = table.data().get();
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(num_blocks),
+                   [input, d_table] __device__(size_type block) {
+                     OutputType val = agg_op::template identity<OutputType>();
+                     for (size_type j = block * block_size; j < (block + 1) * block_size; ++j) {
+                       if (input.is_valid(j)) { val = agg_op{}(input.element<InputType>(j), val); }
+                     }
+                     d_table[block] = val;
+                   });
+  for (size_type level = 1; level < num_levels; ++level) {
+    auto const half       = size_type{1} << (level - 1);
+    auto const level_size = std::max(num_blocks - 2 * half + 1, 0);
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(level_size),
+                     [d_table, num_blocks, level, half] __device__(size_type block) {
+                       auto const previous = d_table + (level - 1) * num_blocks;
+                       d_table[level * num_blocks + block] =
+                         agg_op{}(previous[block], previous[block + half]);
+                     });
+  }
+
+  thrust::for_each(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [=] __device__(size_type i) {
+      auto const bounds = window_bounds(i, size, preceding_window_begin, following_window_begin);
+      OutputType val    = agg_op::template identity<OutputType>();
+      auto aggregate_rows = [&](size_type begin, size_type end) {
+        for (size_type j = begin; j < end; ++j) {
+          if (input.is_valid(j)) { val = agg_op{}(input.element<InputType>(j), val); }
+        }
+      };
+      if (bounds.second - bounds.first <= 2 * block_size) {
+        aggregate_rows(bounds.first, bounds.second);
+      } else {
+        auto const first_block = (bounds.first + block_size - 1) / block_size;
+        auto const last_block  = bounds.second / block_size;
+        aggregate_rows(bounds.first, first_block * block_size);
+        aggregate_rows(last_block * block_size, bounds.second);
+        auto const level = 31 - __clz(last_block - first_block);
+        auto const row   = d_table + level * num_blocks;
+        val = agg_op{}(val, agg_op{}(row[first_block], row[last_block - (1 << level)]));
+      }
+      output[i] = val;
+    });
+}
+
+/**
+ * @brief Fails for the aggregations without a sliding window implementation
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<not is_sliding_window_supported<InputType, op>()> sliding_window_values(
+  column_device_view const& input,
+  size_type const* valid_prefix,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type max_window,
+  OutputType* output,
+  cudaStream_t stream) {
+  CUDF_FAIL("Aggregation has no sliding window implementation");
+}
+
+/**
+ * @brief Computes the rolling window aggregation `op` of `input` in time
+ * independent of the window sizes, for windows much larger than a few rows
+ *
+ * The results are computed from the number of valid rows before each row,
+ * and from prefix sums for SUM and MEAN or a sparse table for MIN and MAX.
+ *
+ * @param input The column to aggregate
+ * @param preceding_window_begin Rolling window size iterator, as for `gpu_rolling`
+ * @param following_window_begin Rolling window size iterator in the forward
+ * direction, as for `gpu_rolling`
+ * @param min_periods Minimum number of observations in a window required to
+ * have a value
+ * @param max_window The number of rows of the largest window
+ * @param output_type The type of the results
+ * @param mr Memory resource used to allocate the returned column
+ * @param stream CUDA stream
+ * @return The column of results
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::unique_ptr<column> sliding_rolling_window(column_view const& input,
+                                               PrecedingWindowIterator preceding_window_begin,
+                                               FollowingWindowIterator following_window_begin,
+                                               size_type min_periods,
+                                               size_type max_window,
+                                               data_type output_type,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream) {
+  auto const size         = input.size();
+  auto const input_device = column_device_view::create(input, stream);
+
+  rmm::device_vector<size_type> valid_prefix(size + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    valid_prefix.begin() + 1,
+    [input = *input_device] __device__(size_type i) { return input.is_valid(i) ? 1 : 0; },
+    thrust::plus<size_type>{});
+
+  auto output = make_fixed_width_column(output_type, size, mask_state::UNALLOCATED, stream, mr);
+  sliding_window_values<InputType, OutputType, agg_op, op>(
+    *input_device,
+    valid_prefix.data().get(),
+    preceding_window_begin,
+    following_window_begin,
+    max_window,
+    output->mutable_view().data<OutputType>(),
+    stream);
+
+  auto const d_valid_prefix = valid_prefix.data().get();
+  auto valid_mask           = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(size),
+    [=] __device__(size_type i) {
+      auto const bounds = window_bounds(i, size, preceding_window_begin, following_window_begin);
+      auto const count  = op == aggregation::COUNT_ALL
+                           ? bounds.second - bounds.first
+                           : d_valid_prefix[bounds.second] - d_valid_prefix[bounds.first];
+      return count >= min_periods;
+    },
+    stream,
+    mr);
+  output->set_null_mask(std::move(valid_mask.first), valid_mask.second);
+
+  return output;
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+constexpr size_type row_block_size  = 256;
+constexpr size_type tile_bytes      = 16 * 1024;  ///< Target shared memory of a tile of rows
+constexpr size_type max_row_bytes   = 48 * 1024;  ///< Shared memory of a block
+constexpr size_type row_alignment   = 8;
+constexpr size_type warp_size       = 32;
+
+/**
+ * @brief The layout of the records of a table
+ */
+struct row_layout {
+  std::vector<size_type> column_sizes;
+  std::vector<size_type> column_starts;
+  size_type validity_offset;
+  size_type row_size;
+};
+
+row_layout make_row_layout(std::vector<data_type> const& schema) {
+  // Records of no columns would have no size
+  CUDF_EXPECTS(not schema.empty(), "Row conversion requires at least one column");
+  row_layout layout;
+  size_type offset = 0;
+  for (auto const& type : schema) {
+    CUDF_EXPECTS(is_fixed_width(type), "Row conversion supports only fixed-width types");
+    auto const size = static_cast<size_type>(size_of(type));
+    offset          = util::round_up_safe(offset, size);
+    layout.column_sizes.push_back(size);
+    layout.column_starts.push_back(offset);
+    offset += size;
+  }
+  layout.validity_offset = offset;
+  offset += util::div_rounding_up_safe(static_cast<size_type>(schema.size()), size_type{8});
+  layout.row_size = util::round_up_safe(offset, row_alignment);
+  CUDF_EXPECTS(layout.row_size <= max_row_bytes, "Row conversion records are limited to 48KB");
+  return layout;
+}
+
+size_type rows_per_tile(size_type row_size) { return std::max(tile_bytes / row_size, 1); }
+
+template <typename T>
+__device__ inline void copy_element(void* dst, void const* src) {
+  *static_cast<T*>(dst) = *static_cast<T const*>(src);
+}
+
+__device__ inline void copy_element(void* dst, void const* src, size_type size) {
+  switch (size) {
+    case 1: copy_element<int8_t>(dst, src); break;
+    case 2: copy_element<int16_t>(dst, src); break;
+    case 4: copy_element<int32_t>(dst, src); break;
+    case 8: copy_element<int64_t>(dst, src); break;
+  }
+}
+
+/**
+ * @brief Packs a tile of rows into records in shared memory, then copies the
+ * tile of records to the output
+ *
+ * The elements are loaded a column at a time, so that a warp reads consecutive
+ * elements of a column, and the records are stored as 8-byte words.
+ */
+__global__ void copy_to_rows(table_device_view input,
+                             size_type const* column_sizes,
+                             size_type const* column_starts,
+                             size_type validity_offset,
+                             size_type row_size,
+                             size_type tile_rows,
+                             size_type first_row,
+                             size_type num_rows,
+                             int8_t* output) {
+  extern __shared__ int64_t shared_words[];
+  auto shared = reinterpret_cast<int8_t*>(shared_words);
+
+  auto const tile_first   = static_cast<size_type>(blockIdx.x) * tile_rows;
+  auto const rows         = min(tile_rows, num_rows - tile_first);
+  auto const num_columns  = input.num_columns();
+  auto const num_words    = rows * row_size / row_alignment;
+  auto const num_validity = (num_columns + 7) / 8;
+
+  // The padding of the records is zeros
+  for (size_type i = threadIdx.x; i < num_words; i += blockDim.x) { shared_words[i] = 0; }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x; i < rows * num_columns; i += blockDim.x) {
+    auto const col     = i / rows;
+    auto const r       = i % rows;
+    auto const& column = input.column(col);
+    auto const size    = column_sizes[col];
+    copy_element(shared + r * row_size + column_starts[col],
+                 column.head<int8_t>() +
+                   static_cast<int64_t>(column.offset() + first_row + tile_first + r) * size,
+                 size);
+  }
+  for (size_type i = threadIdx.x; i < rows * num_validity; i += blockDim.x) {
+    auto const r   = i / num_validity;
+    auto const b   = i % num_validity;
+    auto const row = first_row + tile_first + r;
+    uint8_t byte   = 0;
+    for (size_type col = b * 8; col < min(b * 8 + 8, num_columns); ++col) {
+      if (input.column(col).is_valid(row)) { byte |= 1 << (col - b * 8); }
+    }
+    shared[r * row_size + validity_offset + b] = byte;
+  }
+  __syncthreads();
+
+  auto out_words = reinterpret_cast<int64_t*>(output + static_cast<int64_t>(tile_first) * row_size);
+  for (size_type i = threadIdx.x; i < num_words; i += blockDim.x) {
+    out_words[i] = shared_words[i];
+  }
+}
+
+/**
+ * @brief Loads a tile of records into shared memory, then unpacks their
+ * elements into the output columns
+ *
+ * The validity of 32 consecutive rows of a column is gathered with a warp
+ * ballot and OR-ed into the output mask, which is initially all null.
+ */
+__global__ void copy_from_rows(int8_t const* input,
+                               size_type const* column_sizes,
+                               size_type const* column_starts,
+                               size_type validity_offset,
+                               size_type row_size,
+                               size_type tile_rows,
+                               size_type num_rows,
+                               mutable_table_device_view output) {
+  extern __shared__ int64_t shared_words[];
+  auto shared = reinterpret_cast<int8_t*>(shared_words);
+
+  auto const tile_first  = static_cast<size_type>(blockIdx.x) * tile_rows;
+  auto const rows        = min(tile_rows, num_rows - tile_first);
+  auto const num_columns = output.num_columns();
+  auto const num_words   = rows * row_size / row_alignment;
+
+  auto in_words =
+    reinterpret_cast<int64_t const*>(input + static_cast<int64_t>(tile_first) * row_size);
+  for (size_type i = threadIdx.x; i < num_words; i += blockDim.x) { shared_words[i] = in_words[i]; }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x; i < rows * num_columns; i += blockDim.x) {
+    auto const col  = i / rows;
+    auto const r    = i % rows;
+    auto& column    = output.column(col);
+    auto const size = column_sizes[col];
+    copy_element(column.head<int8_t>() + static_cast<int64_t>(tile_first + r) * size,
+                 shared + r * row_size + column_starts[col],
+                 size);
+  }
+
+  auto const lane       = static_cast<size_type>(threadIdx.x) % warp_size;
+  auto const num_groups = (rows + warp_size - 1) / warp_size;
+  for (size_type g = threadIdx.x / warp_size; g < num_columns * num_groups;
+       g += blockDim.x / warp_size) {
+    auto const col   = g / num_groups;
+    auto const r     = (g % num_groups) * warp_size + lane;
+    bool const valid = r < rows and
+                       (shared[r * row_size + validity_offset + col / 8] >> (col % 8)) & 1;
+    auto const bits  = __ballot_sync(0xffffffff, valid);
+    if (lane == 0 and bits != 0) {
+      auto const first = tile_first + r;
+      auto* mask       = output.column(col).null_mask();
+      auto const shift = intra_word_index(first);
+      atomicOr(&mask[word_index(first)], bits << shift);
+      if (shift != 0 and (bits >> (warp_size - shift)) != 0) {
+        atomicOr(&mask[word_index(first) + 1], bits >> (warp_size - shift));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Functor of the offsets of fixed-size records
+ */
+struct record_offset {
+  size_type row_size;
+  __device__ size_type operator()(size_type i) const { return i * row_size; }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream) {
+  std::vector<data_type> schema;
+  std::transform(input.begin(), input.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  auto const layout = make_row_layout(schema);
+
+  rmm::device_vector<size_type> column_sizes(layout.column_sizes);
+  rmm::device_vector<size_type> column_starts(layout.column_starts);
+  auto const device_input = table_device_view::create(input, stream);
+  auto const tile_rows    = rows_per_tile(layout.row_size);
+  auto exec               = rmm::exec_policy(stream);
+
+  // Each list column holds as many records as fit under the column size limit
+  auto const rows_per_batch = std::numeric_limits<size_type>::max() / layout.row_size;
+  std::vector<std::unique_ptr<column>> batches;
+  size_type first_row = 0;
+  do {
+    auto const num_rows = std::min(rows_per_batch, input.num_rows() - first_row);
+    auto offsets =
+      make_numeric_column(data_type{INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(exec->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows + 1),
+                      offsets->mutable_view().data<size_type>(),
+                      record_offset{layout.row_size});
+    auto records = make_numeric_column(
+      data_type{INT8}, num_rows * layout.row_size, mask_state::UNALLOCATED, stream, mr);
+    if (num_rows > 0) {
+      auto const num_tiles = util::div_rounding_up_safe(num_rows, tile_rows);
+      copy_to_rows<<<num_tiles, row_block_size, tile_rows * layout.row_size, stream>>>(
+        *device_input,
+        column_sizes.data().get(),
+        column_starts.data().get(),
+        layout.validity_offset,
+        layout.row_size,
+        tile_rows,
+        first_row,
+        num_rows,
+        records->mutable_view().data<int8_t>());
+    }
+    batches.push_back(make_lists_column(
+      num_rows, std::move(offsets), std::move(records), 0, rmm::device_buffer{}, stream, mr));
+    first_row += num_rows;
+  } while (first_row < input.num_rows());
+
+  CHECK_CUDA(stream);
+  return batches;
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  CUDF_EXPECTS(input.child().type().id() == INT8, "Records must be a LIST of INT8");
+  CUDF_EXPECTS(not input.has_nulls(), "Records must not be null");
+  auto const layout   = make_row_layout(schema);
+  auto const num_rows = input.size();
+
+  // The records are consecutive from the offset of the first one
+  size_type offsets[2] = {0, 0};
+  if (num_rows > 0) {
+    auto const d_offsets = input.offsets().data<size_type>() + input.offset();
+    CUDA_TRY(cudaMemcpyAsync(
+      &offsets[0], d_offsets, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaMemcpyAsync(
+      &offsets[1], d_offsets + num_rows, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+    CUDF_STREAM_SYNC(stream);
+  }
+  CUDF_EXPECTS(offsets[1] - offsets[0] == static_cast<int64_t>(num_rows) * layout.row_size,
+               "Records do not have the size of the schema");
+
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const& type : schema) {
+    columns.push_back(
+      make_fixed_width_column(type, num_rows, mask_state::ALL_NULL, stream, mr));
+  }
+  auto output = std::make_unique<table>(std::move(columns));
+  if (num_rows == 0) { return output; }
+
+  rmm::device_vector<size_type> column_sizes(layout.column_sizes);
+  rmm::device_vector<size_type> column_starts(layout.column_starts);
+  auto const device_output = mutable_table_device_view::create(output->mutable_view(), stream);
+  auto const tile_rows     = rows_per_tile(layout.row_size);
+  auto const num_tiles     = util::div_rounding_up_safe(num_rows, tile_rows);
+  copy_from_rows<<<num_tiles, row_block_size, tile_rows * layout.row_size, stream>>>(
+    input.child().data<int8_t>() + offsets[0],
+    column_sizes.data().get(),
+    column_starts.data().get(),
+    layout.validity_offset,
+    layout.row_size,
+    tile_rows,
+    num_rows,
+    *device_output);
+  CHECK_CUDA(stream);
+
+  // The null counts are computed on demand
+  for (size_type i = 0; i < output->num_columns(); ++i) {
+    output->get_column(i).set_null_count(UNKNOWN_NULL_COUNT);
+  }
+  return output;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
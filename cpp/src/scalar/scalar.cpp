@@ -26,7 +26,7 @@ std::string string_scalar::to_string(cudaStream_t stream) const {
   std::string result;
   result.resize(_data.size());
   CUDA_TRY(cudaMemcpyAsync(&result[0], _data.data(), _data.size(), cudaMemcpyDeviceToHost, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
   return result;
 }
 
@@ -44,6 +44,7 @@ std::unique_ptr<scalar> make_numeric_scalar(data_type type,
                                             cudaStream_t stream,
                                             rmm::mr::device_memory_resource* mr) {
   CUDF_EXPECTS(is_numeric(type), "Invalid, non-numeric type.");
+  if (is_fixed_point(type)) { return make_fixed_point_scalar(type, stream, mr); }
 
   return experimental::type_dispatcher(type, scalar_construction_helper{}, stream, mr);
 }
@@ -57,6 +58,18 @@ std::unique_ptr<scalar> make_timestamp_scalar(data_type type,
   return experimental::type_dispatcher(type, scalar_construction_helper{}, stream, mr);
 }
 
+// Allocate storage for a single fixed-point element
+std::unique_ptr<scalar> make_fixed_point_scalar(data_type type,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr) {
+  CUDF_EXPECTS(is_fixed_point(type), "Invalid, non-fixed-point type.");
+
+  if (type.id() == DECIMAL32) {
+    return std::make_unique<fixed_point_scalar<int32_t>>(0, type.scale(), false, stream, mr);
+  }
+  return std::make_unique<fixed_point_scalar<int64_t>>(0, type.scale(), false, stream, mr);
+}
+
 namespace {
 struct default_scalar_functor {
   template <typename T>
@@ -72,9 +85,22 @@ std::unique_ptr<cudf::scalar> default_scalar_functor::operator()<dictionary32>()
   return nullptr;
 }
 
+template <>
+std::unique_ptr<cudf::scalar> default_scalar_functor::operator()<list_view>() {
+  CUDF_FAIL("list type not supported");
+  return nullptr;
+}
+
+template <>
+std::unique_ptr<cudf::scalar> default_scalar_functor::operator()<struct_view>() {
+  CUDF_FAIL("struct type not supported");
+  return nullptr;
+}
+
 }  // namespace
 
 std::unique_ptr<scalar> make_default_constructed_scalar(data_type type) {
+  if (is_fixed_point(type)) { return make_fixed_point_scalar(type); }
   return experimental::type_dispatcher(type, default_scalar_functor{});
 }
 
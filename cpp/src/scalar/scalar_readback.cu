@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/scalar/scalar_readback.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace {
+
+constexpr std::size_t readback_alignment = 8;
+constexpr int readback_block_size        = 32;
+
+std::size_t align_readback(std::size_t size) {
+  return (size + readback_alignment - 1) / readback_alignment * readback_alignment;
+}
+
+/**
+ * @brief A range of device memory copied to `offset` in the gathered buffer
+ */
+struct readback_copy {
+  void const* source;
+  std::size_t offset;
+  size_type size;
+};
+
+/**
+ * @brief Gathers the ranges of `copies` into `output`, one block per range
+ */
+__global__ void gather_readback_copies(readback_copy const* copies, char* output) {
+  auto const copy   = copies[blockIdx.x];
+  auto const source = static_cast<char const*>(copy.source);
+  for (size_type i = threadIdx.x; i < copy.size; i += blockDim.x) {
+    output[copy.offset + i] = source[i];
+  }
+}
+
+struct scalar_value_range {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  std::pair<void const*, size_type> operator()(scalar const& s) {
+    return {static_cast<detail::fixed_width_scalar<T> const&>(s).data(), sizeof(T)};
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  std::pair<void const*, size_type> operator()(scalar const& s) {
+    auto const& string = static_cast<string_scalar const&>(s);
+    return {string.data(), string.size()};
+  }
+
+  template <typename T,
+            std::enable_if_t<not is_fixed_width<T>() and
+                             not std::is_same<T, string_view>::value>* = nullptr>
+  std::pair<void const*, size_type> operator()(scalar const&) {
+    CUDF_FAIL("Only fixed-width and string scalars can be read back");
+  }
+};
+
+struct dispatched_type_id {
+  template <typename T>
+  type_id operator()() {
+    return experimental::type_to_id<T>();
+  }
+};
+
+std::vector<scalar const*> scalar_pointers(std::vector<std::unique_ptr<scalar>> const& scalars) {
+  std::vector<scalar const*> pointers(scalars.size());
+  std::transform(
+    scalars.begin(), scalars.end(), pointers.begin(), [](auto const& s) { return s.get(); });
+  return pointers;
+}
+
+}  // namespace
+
+scalar_readback::scalar_readback(std::vector<scalar const*> const& scalars, cudaStream_t stream) {
+  CUDF_EXPECTS(std::none_of(scalars.begin(), scalars.end(), [](auto s) { return s == nullptr; }),
+               "Scalars to read back must not be null");
+
+  // The validities come first, then the values, each aligned
+  std::vector<readback_copy> copies;
+  copies.reserve(2 * scalars.size());
+  std::size_t offset = align_readback(scalars.size());
+  for (std::size_t i = 0; i < scalars.size(); ++i) {
+    auto const& s = *scalars[i];
+    auto range    = experimental::type_dispatcher(s.type(), scalar_value_range{}, s);
+    _types.push_back(s.type());
+    _offsets.push_back(offset);
+    _sizes.push_back(range.second);
+    copies.push_back({s.validity_data(), i, 1});
+    if (range.second > 0) { copies.push_back({range.first, offset, range.second}); }
+    offset += align_readback(range.second);
+  }
+  if (copies.empty()) { return; }
+
+  // The descriptors of the copies follow the gathered data in both buffers
+  auto const results_size     = offset;
+  auto const descriptors_size = copies.size() * sizeof(readback_copy);
+  _host = static_cast<char*>(
+    io::pinned_memory_pool::instance().allocate(results_size + descriptors_size));
+  _device = rmm::device_buffer(results_size + descriptors_size, stream);
+  std::memcpy(_host + results_size, copies.data(), descriptors_size);
+
+  auto const device_data = static_cast<char*>(_device.data());
+  auto const descriptors = reinterpret_cast<readback_copy*>(device_data + results_size);
+  CUDA_TRY(cudaMemcpyAsync(
+    descriptors, _host + results_size, descriptors_size, cudaMemcpyHostToDevice, stream));
+  gather_readback_copies<<<copies.size(), readback_block_size, 0, stream>>>(descriptors,
+                                                                           device_data);
+  CHECK_CUDA(stream);
+  CUDA_TRY(cudaMemcpyAsync(_host, device_data, results_size, cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaEventCreateWithFlags(&_copied, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(_copied, stream));
+}
+
+scalar_readback::scalar_readback(std::vector<std::unique_ptr<scalar>> const& scalars,
+                                 cudaStream_t stream)
+  : scalar_readback(scalar_pointers(scalars), stream) {}
+
+scalar_readback::~scalar_readback() {
+  // The pending copy must not write into a block the pool has handed out again
+  if (_copied != nullptr) {
+    cudaEventSynchronize(_copied);
+    cudaEventDestroy(_copied);
+  }
+  io::pinned_memory_pool::instance().deallocate(_host);
+}
+
+bool scalar_readback::ready() const {
+  if (_copied == nullptr) { return true; }
+  auto const status = cudaEventQuery(_copied);
+  if (status == cudaErrorNotReady) { return false; }
+  CUDA_TRY(status);
+  return true;
+}
+
+void scalar_readback::wait() const {
+  if (_copied != nullptr) { CUDA_TRY(cudaEventSynchronize(_copied)); }
+}
+
+bool scalar_readback::is_valid(size_type i) const {
+  CUDF_EXPECTS(i >= 0 and i < size(), "Scalar index out of bounds");
+  wait();
+  return _host[i] != 0;
+}
+
+std::string scalar_readback::to_string(size_type i) const {
+  CUDF_EXPECTS(i >= 0 and i < size(), "Scalar index out of bounds");
+  CUDF_EXPECTS(_types[i].id() == STRING, "Scalar is not a string");
+  wait();
+  return std::string(_host + _offsets[i], _sizes[i]);
+}
+
+void const* scalar_readback::value_data(size_type i, type_id id) const {
+  CUDF_EXPECTS(i >= 0 and i < size(), "Scalar index out of bounds");
+  CUDF_EXPECTS(_types[i].id() != STRING and
+                 experimental::type_dispatcher(_types[i], dispatched_type_id{}) == id,
+               "Value type does not match the scalar type");
+  wait();
+  return _host + _offsets[i];
+}
+
+}  // namespace cudf
@@ -25,13 +25,24 @@
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <hash/unordered_multiset.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/transform.h>
+
+#include <functional>
+#include <memory>
 
 namespace cudf {
 namespace experimental {
@@ -69,6 +80,140 @@ void launch_search(DataIterator it_data,
   }
 }
 
+constexpr size_type num_cached_splitters      = 1024;
+constexpr size_type splitter_block_size       = 256;
+constexpr size_type splitter_items_per_thread = 32;
+constexpr size_type sort_needles_threshold    = 1 << 20;
+
+/**
+ * @brief Maps the index of a search to the row of its needle, in the sorted
+ * order of the needles if there is one
+ */
+struct needle_index {
+  size_type const* needle_order;
+  __device__ size_type operator()(size_type i) const {
+    return needle_order == nullptr ? i : needle_order[i];
+  }
+};
+
+/**
+ * @brief Compares elements with the ordering of `row_lexicographic_comparator`
+ */
+template <typename T>
+struct element_less {
+  bool ascending;
+  bool nulls_before;
+
+  __device__ bool operator()(T lhs, bool lhs_valid, T rhs, bool rhs_valid) const {
+    weak_ordering state{weak_ordering::EQUIVALENT};
+    if (lhs_valid and rhs_valid) {
+      state = relational_compare(lhs, rhs);
+    } else if (lhs_valid != rhs_valid) {
+      state = (lhs_valid != nulls_before) ? weak_ordering::LESS : weak_ordering::GREATER;
+    }
+    return state == (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+  }
+};
+
+/**
+ * @brief Row of the haystack of the splitter `k`, splitting `size` rows into
+ * `num_cached_splitters + 1` ranges of equal sizes
+ */
+__device__ inline size_type splitter_row(size_type k, size_type size) {
+  return static_cast<size_type>((static_cast<int64_t>(k) + 1) * size / (num_cached_splitters + 1));
+}
+
+/**
+ * @brief Searches a sorted column for needles, from splitters of the column
+ * cached in shared memory
+ *
+ * The top levels of each binary search are done on the splitters, which find
+ * the range between two splitters holding the result; only the levels within
+ * that range read the haystack in global memory.
+ */
+template <typename T>
+__global__ void search_cached_splitters(column_device_view haystack,
+                                        column_device_view needles,
+                                        size_type const* needle_order,
+                                        element_less<T> less,
+                                        bool find_first,
+                                        size_type* output) {
+  __shared__ T splitters[num_cached_splitters];
+  __shared__ bool splitters_valid[num_cached_splitters];
+  auto const size = haystack.size();
+  for (size_type k = threadIdx.x; k < num_cached_splitters; k += blockDim.x) {
+    auto const row     = splitter_row(k, size);
+    splitters[k]       = haystack.element<T>(row);
+    splitters_valid[k] = haystack.is_valid(row);
+  }
+  __syncthreads();
+
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < needles.size();
+       i += blockDim.x * gridDim.x) {
+    auto const needle = needle_index{needle_order}(i);
+    auto const value  = needles.element<T>(needle);
+    auto const valid  = needles.is_valid(needle);
+    // The result is the first row that is not ordered before the needle
+    auto const before = [&](T element, bool element_valid) {
+      return find_first ? less(element, element_valid, value, valid)
+                        : not less(value, valid, element, element_valid);
+    };
+
+    size_type lo = 0;
+    size_type hi = num_cached_splitters;
+    while (lo < hi) {
+      auto const mid = (lo + hi) / 2;
+      if (before(splitters[mid], splitters_valid[mid])) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    auto first = (lo == 0) ? 0 : splitter_row(lo - 1, size) + 1;
+    auto last  = (lo == num_cached_splitters) ? size : splitter_row(lo, size);
+    while (first < last) {
+      auto const mid = first + (last - first) / 2;
+      if (before(haystack.element<T>(mid), haystack.is_valid(mid))) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+    output[needle] = first;
+  }
+}
+
+struct search_cached_splitters_dispatch {
+  template <typename T>
+  std::enable_if_t<not(is_numeric<T>() or is_timestamp<T>()), void> operator()(
+    column_view const&, column_view const&, size_type const*, bool, order, null_order,
+    size_type*, cudaStream_t) {
+    CUDF_FAIL("Cached splitters search supports only numeric and timestamp types");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_numeric<T>() or is_timestamp<T>(), void> operator()(
+    column_view const& haystack,
+    column_view const& needles,
+    size_type const* needle_order,
+    bool find_first,
+    order column_order,
+    null_order null_precedence,
+    size_type* output,
+    cudaStream_t stream) {
+    auto d_haystack = column_device_view::create(haystack, stream);
+    auto d_needles  = column_device_view::create(needles, stream);
+    element_less<T> less{column_order == order::ASCENDING,
+                         null_precedence == null_order::BEFORE};
+    // Each block loads the splitters once for many needles
+    auto const grid = grid_1d{needles.size(), splitter_block_size, splitter_items_per_thread};
+    search_cached_splitters<T><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      *d_haystack, *d_needles, needle_order, less, find_first, output);
+    CHECK_CUDA(stream);
+  }
+};
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -102,9 +247,40 @@ std::unique_ptr<column> search_ordered(table_view const& t,
                  "Mismatch between number of columns and null precedence.");
   }
 
-  auto d_t      = table_device_view::create(t, stream);
-  auto d_values = table_device_view::create(values, stream);
-  auto count_it = thrust::make_counting_iterator<size_type>(0);
+  if (values.num_rows() == 0) { return result; }
+
+  // Searching large sets of needles in sorted order makes neighboring threads
+  // traverse the same rows of the haystack
+  std::unique_ptr<column> needle_order;
+  if (values.num_rows() >= sort_needles_threshold and t.num_rows() > num_cached_splitters) {
+    needle_order = detail::sorted_order(
+      values, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  }
+  auto const d_needle_order =
+    needle_order == nullptr ? nullptr : needle_order->view().data<size_type>();
+
+  if (t.num_columns() == 1 and t.column(0).type() == values.column(0).type() and
+      (is_numeric(t.column(0).type()) or is_timestamp(t.column(0).type())) and
+      t.num_rows() > 2 * num_cached_splitters) {
+    experimental::type_dispatcher(
+      t.column(0).type(),
+      search_cached_splitters_dispatch{},
+      t.column(0),
+      values.column(0),
+      d_needle_order,
+      find_first,
+      column_order.empty() ? order::ASCENDING : column_order.front(),
+      null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+      result_view.data<size_type>(),
+      stream);
+    return result;
+  }
+
+  auto d_t       = table_device_view::create(t, stream);
+  auto d_values  = table_device_view::create(values, stream);
+  auto count_it  = thrust::make_counting_iterator<size_type>(0);
+  auto values_it = thrust::make_transform_iterator(count_it, needle_index{d_needle_order});
+  auto output_it = thrust::make_permutation_iterator(result_view.data<size_type>(), values_it);
 
   rmm::device_vector<order> d_column_order(column_order.begin(), column_order.end());
   rmm::device_vector<null_order> d_null_precedence(null_precedence.begin(), null_precedence.end());
@@ -118,10 +294,10 @@ std::unique_ptr<column> search_ordered(table_view const& t,
             *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
 
     launch_search(count_it,
-                  count_it,
+                  values_it,
                   t.num_rows(),
                   values.num_rows(),
-                  result_view.data<size_type>(),
+                  output_it,
                   ineq_op,
                   find_first,
                   stream);
@@ -134,10 +310,10 @@ std::unique_ptr<column> search_ordered(table_view const& t,
             *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
 
     launch_search(count_it,
-                  count_it,
+                  values_it,
                   t.num_rows(),
                   values.num_rows(),
-                  result_view.data<size_type>(),
+                  output_it,
                   ineq_op,
                   find_first,
                   stream);
@@ -181,6 +357,22 @@ bool contains_scalar_dispatch::operator()<cudf::dictionary32>(column_view const&
                                                               rmm::mr::device_memory_resource* mr) {
   CUDF_FAIL("dictionary type not supported yet");
 }
+
+template <>
+bool contains_scalar_dispatch::operator()<cudf::list_view>(column_view const& col,
+                                                           scalar const& value,
+                                                           cudaStream_t stream,
+                                                           rmm::mr::device_memory_resource* mr) {
+  CUDF_FAIL("list type not supported yet");
+}
+
+template <>
+bool contains_scalar_dispatch::operator()<cudf::struct_view>(column_view const& col,
+                                                             scalar const& value,
+                                                             cudaStream_t stream,
+                                                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FAIL("struct type not supported yet");
+}
 }  // namespace
 
 namespace detail {
@@ -199,78 +391,189 @@ bool contains(column_view const& col,
     col.type(), contains_scalar_dispatch{}, col, value, stream, mr);
 }
 
-struct multi_contains_dispatch {
-  template <typename Element>
-  std::unique_ptr<column> operator()(column_view const& haystack,
-                                     column_view const& needles,
-                                     rmm::mr::device_memory_resource* mr,
-                                     cudaStream_t stream) {
-    std::unique_ptr<column> result =
-      make_numeric_column(data_type{experimental::type_to_id<bool>()},
-                          haystack.size(),
-                          copy_bitmask(haystack),
-                          haystack.null_count(),
-                          stream,
-                          mr);
-
-    if (haystack.size() == 0) { return result; }
-
-    mutable_column_view result_view = result.get()->mutable_view();
-
-    if (needles.size() == 0) {
-      thrust::fill(rmm::exec_policy(stream)->on(stream),
-                   result_view.begin<bool>(),
-                   result_view.end<bool>(),
-                   false);
-      return result;
-    }
+/**
+ * @brief Indicates whether each element of a column is in a set of values, using
+ * a device view `Lookup` of the set
+ */
+template <typename Element, typename Lookup>
+struct contains_element_fn {
+  column_device_view haystack;
+  Lookup lookup;
 
-    auto hash_set        = cudf::detail::unordered_multiset<Element>::create(needles, stream);
-    auto device_hash_set = hash_set.to_device();
-
-    auto d_haystack_ptr = column_device_view::create(haystack, stream);
-    auto d_haystack     = *d_haystack_ptr;
-
-    if (haystack.has_nulls()) {
-      thrust::transform(rmm::exec_policy(stream)->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return d_haystack.is_null_nocheck(index) ||
-                                 device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
-    } else {
-      thrust::transform(rmm::exec_policy(stream)->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
+  __device__ bool operator()(size_type index) const {
+    return haystack.is_null(index) || lookup.contains(haystack.element<Element>(index));
+  }
+};
+
+/**
+ * @brief Device view of sorted values, looked up with a binary search
+ */
+template <typename Element>
+struct sorted_values_view {
+  column_device_view values;
+
+  __device__ bool contains(Element e) const {
+    return thrust::binary_search(thrust::seq, values.begin<Element>(), values.end<Element>(), e);
+  }
+};
+
+/**
+ * @brief The lookup structure of a set of values of one type
+ */
+class value_lookup {
+ public:
+  virtual ~value_lookup() = default;
+
+  /**
+   * @brief Writes to `output[i]` whether element `i` of `haystack` is in the set,
+   * or `true` if it is null
+   */
+  virtual void contains(column_view const& haystack, bool* output, cudaStream_t stream) const = 0;
+};
+
+template <typename Element, typename Lookup>
+void transform_contains(column_view const& haystack,
+                        Lookup lookup,
+                        bool* output,
+                        cudaStream_t stream) {
+  auto d_haystack = column_device_view::create(haystack, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(haystack.size()),
+                    output,
+                    contains_element_fn<Element, Lookup>{*d_haystack, lookup});
+}
+
+/**
+ * @brief Hash set of the values, as built by `contains(haystack, needles)`
+ */
+template <typename Element>
+class hash_value_lookup : public value_lookup {
+ public:
+  hash_value_lookup(column_view const& needles, cudaStream_t stream)
+    : _set{cudf::detail::unordered_multiset<Element>::create(needles, stream)} {}
+
+  void contains(column_view const& haystack, bool* output, cudaStream_t stream) const override {
+    transform_contains<Element>(haystack, _set.to_device(), output, stream);
+  }
+
+ private:
+  cudf::detail::unordered_multiset<Element> _set;
+};
+
+/**
+ * @brief Sorted copy of the non-null values
+ */
+template <typename Element>
+class sorted_value_lookup : public value_lookup {
+ public:
+  sorted_value_lookup(column_view const& needles, cudaStream_t stream) {
+    auto const valid = detail::drop_nulls(
+      table_view{{needles}}, {0}, 1, rmm::mr::get_default_resource(), stream);
+    _values = std::move(
+      detail::sort_by_key(valid->view(), valid->view(), {}, {}, rmm::mr::get_default_resource(),
+                          stream)
+        ->release()
+        .front());
+    _d_values = column_device_view::create(_values->view(), stream);
+  }
+
+  void contains(column_view const& haystack, bool* output, cudaStream_t stream) const override {
+    if (_values->size() == 0) {
+      thrust::fill_n(rmm::exec_policy(stream)->on(stream), output, haystack.size(), false);
+      return;
     }
+    transform_contains<Element>(haystack, sorted_values_view<Element>{*_d_values}, output, stream);
+  }
 
-    return result;
+ private:
+  std::unique_ptr<column> _values;
+  std::unique_ptr<column_device_view, std::function<void(column_device_view*)>> _d_values;
+};
+
+struct make_value_lookup_dispatch {
+  template <typename Element>
+  std::unique_ptr<value_lookup> operator()(column_view const& needles,
+                                           membership_method method,
+                                           cudaStream_t stream) {
+    if (method == membership_method::BINARY_SEARCH) {
+      return std::make_unique<sorted_value_lookup<Element>>(needles, stream);
+    }
+    return std::make_unique<hash_value_lookup<Element>>(needles, stream);
   }
 };
 
 template <>
-std::unique_ptr<column> multi_contains_dispatch::operator()<dictionary32>(
-  column_view const& haystack,
-  column_view const& needles,
-  rmm::mr::device_memory_resource* mr,
-  cudaStream_t stream) {
+std::unique_ptr<value_lookup> make_value_lookup_dispatch::operator()<dictionary32>(
+  column_view const& needles, membership_method method, cudaStream_t stream) {
   CUDF_FAIL("dictionary type not supported");
 }
 
+template <>
+std::unique_ptr<value_lookup> make_value_lookup_dispatch::operator()<list_view>(
+  column_view const& needles, membership_method method, cudaStream_t stream) {
+  CUDF_FAIL("list type not supported");
+}
+
+template <>
+std::unique_ptr<value_lookup> make_value_lookup_dispatch::operator()<struct_view>(
+  column_view const& needles, membership_method method, cudaStream_t stream) {
+  CUDF_FAIL("struct type not supported");
+}
+
+/**
+ * @brief Creates the lookup structure of the values of `needles`, or `nullptr`
+ * if `needles` is empty
+ */
+std::unique_ptr<value_lookup> make_value_lookup(column_view const& needles,
+                                                membership_method method,
+                                                cudaStream_t stream) {
+  auto lookup = cudf::experimental::type_dispatcher(
+    needles.type(), make_value_lookup_dispatch{}, needles, method, stream);
+  if (needles.size() == 0) { return nullptr; }
+  return lookup;
+}
+
+/**
+ * @brief Returns the bool column of whether each element of `haystack` is in
+ * the set of `lookup`, an empty set if `lookup` is `nullptr`
+ */
+std::unique_ptr<column> contains(column_view const& haystack,
+                                 value_lookup const* lookup,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  std::unique_ptr<column> result =
+    make_numeric_column(data_type{experimental::type_to_id<bool>()},
+                        haystack.size(),
+                        copy_bitmask(haystack),
+                        haystack.null_count(),
+                        stream,
+                        mr);
+
+  if (haystack.size() == 0) { return result; }
+
+  mutable_column_view result_view = result.get()->mutable_view();
+
+  if (lookup == nullptr) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 result_view.begin<bool>(),
+                 result_view.end<bool>(),
+                 false);
+    return result;
+  }
+
+  lookup->contains(haystack, result_view.begin<bool>(), stream);
+  return result;
+}
+
 std::unique_ptr<column> contains(column_view const& haystack,
                                  column_view const& needles,
                                  rmm::mr::device_memory_resource* mr,
                                  cudaStream_t stream) {
   CUDF_EXPECTS(haystack.type() == needles.type(), "DTYPE mismatch");
 
-  return cudf::experimental::type_dispatcher(
-    haystack.type(), multi_contains_dispatch{}, haystack, needles, mr, stream);
+  auto const lookup = make_value_lookup(needles, membership_method::HASH, stream);
+  return contains(haystack, lookup.get(), mr, stream);
 }
 
 std::unique_ptr<column> lower_bound(table_view const& t,
@@ -293,6 +596,23 @@ std::unique_ptr<column> upper_bound(table_view const& t,
 
 }  // namespace detail
 
+class value_set::impl {
+ public:
+  impl(column_view const& needles, membership_method method, cudaStream_t stream)
+    : _type{needles.type()}, _lookup{detail::make_value_lookup(needles, method, stream)} {}
+
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream) const {
+    CUDF_EXPECTS(haystack.type() == _type, "DTYPE mismatch");
+    return detail::contains(haystack, _lookup.get(), mr, stream);
+  }
+
+ private:
+  data_type _type;
+  std::unique_ptr<detail::value_lookup> _lookup;
+};
+
 // external APIs
 
 std::unique_ptr<column> lower_bound(table_view const& t,
@@ -325,5 +645,18 @@ std::unique_ptr<column> contains(column_view const& haystack,
   return detail::contains(haystack, needles, mr);
 }
 
+value_set::value_set(column_view const& needles, membership_method method) {
+  CUDF_FUNC_RANGE();
+  _impl = std::make_unique<const impl>(needles, method, 0);
+}
+
+value_set::~value_set() = default;
+
+std::unique_ptr<column> value_set::contains(column_view const& haystack,
+                                            rmm::mr::device_memory_resource* mr) const {
+  CUDF_FUNC_RANGE();
+  return _impl->contains(haystack, mr, 0);
+}
+
 }  // namespace experimental
 }  // namespace cudf
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/spill.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+namespace cudf {
+namespace experimental {
+
+/**
+ * @brief Holds the sorted runs of an `external_sorter`
+ **/
+class external_sorter::impl {
+ public:
+  impl(std::vector<size_type> const& key_cols,
+       std::vector<order> const& column_order,
+       std::vector<null_order> const& null_precedence,
+       size_type block_rows)
+    : _key_cols{key_cols},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _block_rows{block_rows} {
+    CUDF_EXPECTS(!key_cols.empty(), "Empty key_cols");
+    CUDF_EXPECTS(key_cols.size() == column_order.size(),
+                 "Mismatched size between key_cols and column_order");
+    CUDF_EXPECTS(null_precedence.empty() || key_cols.size() == null_precedence.size(),
+                 "Mismatched size between key_cols and null_precedence");
+    CUDF_EXPECTS(block_rows > 0, "block_rows must be positive");
+  }
+
+  void push(table_view const& run) {
+    CUDF_EXPECTS(!_merging, "Cannot push runs after the sorted rows are read");
+    if (_types.empty()) {
+      CUDF_EXPECTS(*std::max_element(_key_cols.begin(), _key_cols.end()) < run.num_columns(),
+                   "Too many values in key_cols");
+      std::transform(run.begin(), run.end(), std::back_inserter(_types), [](auto const& col) {
+        return col.type();
+      });
+    }
+    CUDF_EXPECTS(static_cast<size_t>(run.num_columns()) == _types.size(),
+                 "Mismatched number of columns");
+    CUDF_EXPECTS(std::equal(_types.begin(),
+                            _types.end(),
+                            run.begin(),
+                            [](auto const& type, auto const& col) { return type == col.type(); }),
+                 "Mismatched column types");
+    if (run.num_rows() == 0) { return; }
+
+    auto const sorted = sort_by_key(run, run.select(_key_cols), _column_order, _null_precedence);
+    sorted_run spilled;
+    for (size_type begin = 0; begin < sorted->num_rows(); begin += _block_rows) {
+      auto const end   = std::min(begin + _block_rows, sorted->num_rows());
+      auto const block = slice(sorted->view(), {begin, end}).front();
+      spilled.blocks.push_back(detail::spill_to_host(block));
+    }
+    _runs.push_back(std::move(spilled));
+  }
+
+  bool has_next() const {
+    return std::any_of(_runs.begin(), _runs.end(), [](auto const& run) {
+      return !run.blocks.empty() || run.consumed < run.current.num_rows();
+    });
+  }
+
+  std::unique_ptr<table> next(rmm::mr::device_memory_resource* mr) {
+    CUDF_EXPECTS(has_next(), "No sorted rows left");
+    _merging = true;
+
+    std::vector<sorted_run*> heads;
+    for (auto& run : _runs) {
+      if (run.consumed == run.current.num_rows() && !run.blocks.empty()) {
+        run.data     = rmm::device_buffer{};
+        auto block   = detail::restore_to_device(run.blocks.front());
+        run.data     = std::move(block.first);
+        run.current  = block.second;
+        run.consumed = 0;
+        run.blocks.pop_front();
+      }
+      if (run.consumed < run.current.num_rows()) { heads.push_back(&run); }
+    }
+
+    // The rows of a run that are still in host memory do not sort before the
+    // last row of its current block. So all the rows not sorting after the
+    // smallest such last row are in device memory, and can be merged now.
+    std::vector<size_type> counts;
+    std::transform(heads.begin(), heads.end(), std::back_inserter(counts), [](auto run) {
+      return run->current.num_rows() - run->consumed;
+    });
+    std::vector<table_view> last_rows;
+    for (auto const run : heads) {
+      if (run->blocks.empty()) { continue; }
+      auto const size = run->current.num_rows();
+      last_rows.push_back(slice(run->current.select(_key_cols), {size - 1, size}).front());
+    }
+    if (!last_rows.empty()) {
+      auto const last_keys = concatenate(last_rows);
+      auto const sorted    = sorted_order(last_keys->view(), _column_order, _null_precedence);
+      size_type smallest{};
+      CUDA_TRY(cudaMemcpy(&smallest,
+                          sorted->view().data<size_type>(),
+                          sizeof(size_type),
+                          cudaMemcpyDeviceToHost));
+      auto const bound = slice(last_keys->view(), {smallest, smallest + 1}).front();
+      for (size_t i = 0; i < heads.size(); ++i) {
+        auto const keys = heads[i]->remaining().select(_key_cols);
+        auto const end  = upper_bound(keys, bound, _column_order, _null_precedence);
+        CUDA_TRY(cudaMemcpy(
+          &counts[i], end->view().data<size_type>(), sizeof(size_type), cudaMemcpyDeviceToHost));
+      }
+    }
+
+    std::vector<table_view> prefixes;
+    for (size_t i = 0; i < heads.size(); ++i) {
+      prefixes.push_back(slice(heads[i]->remaining(), {0, counts[i]}).front());
+    }
+    auto merged = merge(prefixes, _key_cols, _column_order, _null_precedence, mr);
+    for (size_t i = 0; i < heads.size(); ++i) { heads[i]->consumed += counts[i]; }
+    return merged;
+  }
+
+ private:
+  /**
+   * @brief A sorted run, whose blocks are copied to device memory one at a
+   * time as they are merged
+   */
+  struct sorted_run {
+    std::deque<detail::spilled_table> blocks;  ///< Blocks still in host memory
+    rmm::device_buffer data;                   ///< Device data of the current block
+    table_view current;                        ///< The current block
+    size_type consumed{0};                     ///< Rows of `current` already merged
+
+    table_view remaining() const {
+      return slice(current, {consumed, current.num_rows()}).front();
+    }
+  };
+
+  std::vector<size_type> _key_cols;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  size_type _block_rows;
+  std::vector<data_type> _types;  ///< Column types of the runs
+  std::vector<sorted_run> _runs;
+  bool _merging{false};  ///< Whether `next()` was called
+};
+
+external_sorter::external_sorter(std::vector<size_type> const& key_cols,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 size_type block_rows)
+  : _impl{std::make_unique<impl>(key_cols, column_order, null_precedence, block_rows)} {}
+
+external_sorter::~external_sorter() = default;
+
+void external_sorter::push(table_view const& run) {
+  CUDF_FUNC_RANGE();
+  _impl->push(run);
+}
+
+bool external_sorter::has_next() const { return _impl->has_next(); }
+
+std::unique_ptr<table> external_sorter::next(rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return _impl->next(mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,8 @@
  */
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -23,57 +25,213 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+
 namespace cudf {
 
 namespace experimental {
 
 namespace detail {
 
-template <bool has_nulls>
-auto is_sorted(cudf::table_view const& in,
-               std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence) {
-  cudaStream_t stream = 0;
-  auto in_d           = table_device_view::create(in);
-  rmm::device_vector<order> d_column_order(column_order);
-  rmm::device_vector<null_order> const d_null_precedence =
-    (has_nulls) ? rmm::device_vector<null_order>{null_precedence}
-                : rmm::device_vector<null_order>{};
-  auto ineq_op = row_lexicographic_comparator<has_nulls>(
-    *in_d, *in_d, d_column_order.data().get(), d_null_precedence.data().get());
-
-  auto sorted = thrust::is_sorted(rmm::exec_policy(stream)->on(stream),
-                                  thrust::make_counting_iterator(0),
-                                  thrust::make_counting_iterator(in.num_rows()),
-                                  ineq_op);
-
-  return sorted;
-}
-
-}  // namespace detail
+namespace {
 
-bool is_sorted(cudf::table_view const& in,
-               std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence) {
-  CUDF_FUNC_RANGE();
-  if (in.num_columns() == 0 || in.num_rows() == 0) { return true; }
+// Rows compared by the first block; each following block is twice as large,
+// so unsorted rows are found after little work and sorted rows take few passes
+constexpr size_type first_sorted_block_rows = 1 << 16;
+constexpr size_type max_sorted_block_rows   = 1 << 24;
 
+void expect_orders(table_view const& table,
+                   std::vector<order> const& column_order,
+                   std::vector<null_order> const& null_precedence) {
   if (not column_order.empty()) {
-    CUDF_EXPECTS(static_cast<unsigned int>(in.num_columns()) == column_order.size(),
+    CUDF_EXPECTS(static_cast<unsigned int>(table.num_columns()) == column_order.size(),
                  "Number of columns in the table doesn't match the vector column_order's size .\n");
   }
 
   if (not null_precedence.empty()) {
     CUDF_EXPECTS(
-      static_cast<unsigned int>(in.num_columns()) == null_precedence.size(),
+      static_cast<unsigned int>(table.num_columns()) == null_precedence.size(),
       "Number of columns in the table doesn't match the vector null_precedence's size .\n");
   }
+}
+
+/**
+ * @brief Compares rows in the opposite order of `comparator`
+ */
+template <typename Comparator>
+struct reversed_comparator {
+  Comparator comparator;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const { return comparator(rhs, lhs); }
+};
+
+/**
+ * @brief Whether row `i + 1` is less than, and greater than, row `i`
+ */
+struct adjacent_order {
+  size_type descents;  ///< Number of rows less than the row before them
+  size_type ascents;   ///< Number of rows greater than the row before them
+};
+
+struct add_adjacent_orders {
+  __device__ adjacent_order operator()(adjacent_order const& lhs, adjacent_order const& rhs) const {
+    return {lhs.descents + rhs.descents, lhs.ascents + rhs.ascents};
+  }
+};
+
+template <typename Comparator>
+struct compare_adjacent_rows {
+  Comparator comparator;
+
+  __device__ adjacent_order operator()(size_type i) const {
+    return {comparator(i + 1, i) ? 1 : 0, comparator(i, i + 1) ? 1 : 0};
+  }
+};
 
-  if (has_nulls(in)) {
-    return detail::is_sorted<true>(in, column_order, null_precedence);
-  } else {
-    return detail::is_sorted<false>(in, column_order, null_precedence);
+/**
+ * @brief Calls `f` with the row comparator of `table`
+ */
+template <typename F>
+auto with_row_comparator(table_view const& table,
+                         std::vector<order> const& column_order,
+                         std::vector<null_order> const& null_precedence,
+                         cudaStream_t stream,
+                         F&& f) {
+  auto device_table = table_device_view::create(table, stream);
+  rmm::device_vector<order> const d_column_order(column_order);
+  if (has_nulls(table)) {
+    rmm::device_vector<null_order> const d_null_precedence(null_precedence);
+    return f(row_lexicographic_comparator<true>(*device_table,
+                                                *device_table,
+                                                d_column_order.data().get(),
+                                                d_null_precedence.data().get()));
   }
+  return f(row_lexicographic_comparator<false>(
+    *device_table, *device_table, d_column_order.data().get()));
+}
+
+/**
+ * @brief Checks the rows in blocks of increasing size, stopping at the first
+ * block with rows out of order
+ */
+template <typename Comparator>
+bool is_sorted_in_blocks(size_type num_rows, Comparator comparator, cudaStream_t stream) {
+  size_type block_rows = first_sorted_block_rows;
+  // Consecutive blocks share a row, so every pair of adjacent rows is compared
+  for (size_type begin = 0; begin < num_rows - 1; begin += block_rows - 1) {
+    block_rows     = std::min(block_rows, num_rows - begin);
+    auto const end = begin + block_rows;
+    if (not thrust::is_sorted(rmm::exec_policy(stream)->on(stream),
+                              thrust::make_counting_iterator(begin),
+                              thrust::make_counting_iterator(end),
+                              comparator)) {
+      return false;
+    }
+    block_rows = std::min(2 * block_rows, max_sorted_block_rows);
+  }
+  return true;
+}
+
+/**
+ * @brief Forwards the comparator of a table to `is_sorted_in_blocks`
+ */
+struct sorted_in_blocks_fn {
+  size_type num_rows;
+  bool reversed;
+  cudaStream_t stream;
+
+  template <typename Comparator>
+  bool operator()(Comparator comparator) const {
+    return reversed ? is_sorted_in_blocks(
+                        num_rows, reversed_comparator<Comparator>{comparator}, stream)
+                    : is_sorted_in_blocks(num_rows, comparator, stream);
+  }
+};
+
+struct count_adjacent_orders_fn {
+  size_type num_rows;
+  cudaStream_t stream;
+
+  template <typename Comparator>
+  adjacent_order operator()(Comparator comparator) const {
+    return thrust::transform_reduce(rmm::exec_policy(stream)->on(stream),
+                                    thrust::make_counting_iterator<size_type>(0),
+                                    thrust::make_counting_iterator<size_type>(num_rows - 1),
+                                    compare_adjacent_rows<Comparator>{comparator},
+                                    adjacent_order{0, 0},
+                                    add_adjacent_orders{});
+  }
+};
+
+}  // namespace
+
+bool is_sorted(table_view const& table,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream) {
+  if (table.num_columns() == 0 || table.num_rows() == 0) { return true; }
+  expect_orders(table, column_order, null_precedence);
+  return with_row_comparator(table,
+                             column_order,
+                             null_precedence,
+                             stream,
+                             sorted_in_blocks_fn{table.num_rows(), false, stream});
+}
+
+bool is_reverse_sorted(table_view const& table,
+                       std::vector<order> const& column_order,
+                       std::vector<null_order> const& null_precedence,
+                       cudaStream_t stream) {
+  if (table.num_columns() == 0 || table.num_rows() == 0) { return true; }
+  expect_orders(table, column_order, null_precedence);
+  return with_row_comparator(table,
+                             column_order,
+                             null_precedence,
+                             stream,
+                             sorted_in_blocks_fn{table.num_rows(), true, stream});
+}
+
+sortedness probe_sortedness(table_view const& table,
+                            std::vector<order> const& column_order,
+                            std::vector<null_order> const& null_precedence,
+                            double max_unsorted_fraction,
+                            cudaStream_t stream) {
+  expect_orders(table, column_order, null_precedence);
+  if (table.num_columns() == 0 || table.num_rows() < 2) { return sortedness::SORTED; }
+
+  auto const counts = with_row_comparator(table,
+                                          column_order,
+                                          null_precedence,
+                                          stream,
+                                          count_adjacent_orders_fn{table.num_rows(), stream});
+  if (counts.descents == 0) { return sortedness::SORTED; }
+  if (counts.ascents == 0) { return sortedness::REVERSE_SORTED; }
+  if (counts.descents <= max_unsorted_fraction * (table.num_rows() - 1)) {
+    return sortedness::NEARLY_SORTED;
+  }
+  return sortedness::UNSORTED;
+}
+
+}  // namespace detail
+
+bool is_sorted(cudf::table_view const& in,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence) {
+  CUDF_FUNC_RANGE();
+  return detail::is_sorted(in, column_order, null_precedence);
+}
+
+sortedness probe_sortedness(table_view const& table,
+                            std::vector<order> const& column_order,
+                            std::vector<null_order> const& null_precedence,
+                            double max_unsorted_fraction) {
+  CUDF_FUNC_RANGE();
+  return detail::probe_sortedness(table, column_order, null_precedence, max_unsorted_fraction);
 }
 
 }  // namespace experimental
@@ -19,6 +19,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/scratch_arena.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -44,7 +45,9 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
   CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
                "Mismatch in number of rows for values and keys");
 
-  auto sorted_order = detail::sorted_order(keys, column_order, null_precedence, mr, stream);
+  scratch_scope scratch(stream);
+  auto sorted_order =
+    detail::sorted_order(keys, column_order, null_precedence, scratch.resource(), stream);
 
   return detail::gather(values, sorted_order->view(), false, false, false, mr, stream);
 }
@@ -54,26 +57,29 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
-                                     rmm::mr::device_memory_resource* mr) {
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, mr);
+  return detail::sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
-                            rmm::mr::device_memory_resource* mr) {
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  return detail::sort_by_key(input, input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
-                                   rmm::mr::device_memory_resource* mr) {
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream) {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(values, keys, column_order, null_precedence, mr);
+  return detail::sort_by_key(values, keys, column_order, null_precedence, mr, stream);
 }
 
 }  // namespace experimental
@@ -18,17 +18,333 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/managed_memory.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/detail/utilities/string_prefix_key.cuh>
+#include <cudf/structs/detail/utilities.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reverse.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 
 namespace cudf {
 namespace experimental {
 namespace detail {
 
+/**
+ * @brief Returns the number of bits of the order-preserving radix sort encoding
+ * of the values of type `T`, or 0 if `T` cannot be radix sorted
+ */
+struct radix_value_bits_fn {
+  template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  size_type operator()() {
+    return 1;
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_same<T, bool>::value and cudf::is_fixed_width<T>()>* =
+              nullptr>
+  size_type operator()() {
+    return sizeof(T) * 8;
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  size_type operator()() {
+    return 0;
+  }
+};
+
+/**
+ * @brief Encodes an element into unsigned bits whose unsigned order is the
+ * order of `relational_compare`
+ *
+ * Signed integers and timestamps have their sign bit flipped. Floating point
+ * values have all their bits flipped when negative and only their sign bit
+ * otherwise, after mapping `-0` to `0` and every NaN to one quiet NaN, which
+ * orders them as `[-Inf, -ve, 0, +ve, +Inf, NaN]` with `-0 == 0` and all NaNs
+ * equivalent.
+ */
+struct radix_value_encoder {
+  template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) {
+    return col.element<T>(row) ? 1 : 0;
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value>* =
+              nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) {
+    return encode_signed(col.element<T>(row));
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) {
+    return encode_signed(col.element<T>(row).time_since_epoch().count());
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) {
+    using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    T value = col.element<T>(row);
+    if (isnan(value)) { value = std::numeric_limits<T>::quiet_NaN(); }
+    if (value == 0) { value = 0; }
+    U bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    U const sign_bit = U{1} << (sizeof(T) * 8 - 1);
+    return (bits & sign_bit) ? static_cast<U>(~bits) : static_cast<U>(bits | sign_bit);
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) {
+    release_assert(false && "Radix sort is only supported on fixed-width types.");
+    return 0;
+  }
+
+ private:
+  template <typename T>
+  __device__ static uint64_t encode_signed(T value) {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(T) * 8 - 1)));
+  }
+};
+
+/**
+ * @brief The field of a column in the radix sort keys
+ */
+struct radix_field {
+  size_type value_bits;  ///< Number of bits of the encoded values
+  bool has_nulls;        ///< Whether the field has a bit ordering nulls
+};
+
+/**
+ * @brief Returns the radix sort key field of `col`, whose `value_bits` is 0 if
+ * `col` cannot be radix sorted
+ */
+inline radix_field make_radix_field(column_view const& col) {
+  return radix_field{cudf::experimental::type_dispatcher(col.type(), radix_value_bits_fn{}),
+                     col.has_nulls()};
+}
+
+/**
+ * @brief Packs the elements of a row into a radix sort key whose unsigned order
+ * is the order of `row_lexicographic_comparator`
+ *
+ * The columns are packed from the most significant bits in column order. The
+ * field of a column with nulls has one more bit above the encoded value, which
+ * is what orders its nulls before or after the valid elements. The field of a
+ * descending column is inverted.
+ */
+template <typename Key>
+struct radix_key_fn {
+  table_device_view input;
+  radix_field const* fields;
+  order const* column_order;
+  null_order const* null_precedence;
+
+  __device__ Key operator()(size_type row) {
+    Key key{0};
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const col    = input.column(i);
+      auto const bits   = fields[i].value_bits;
+      auto const nulls  = fields[i].has_nulls;
+      auto const width  = bits + nulls;
+      auto const before = null_precedence == nullptr or null_precedence[i] == null_order::BEFORE;
+
+      Key field{0};
+      if (nulls and col.is_null(row)) {
+        field = before ? Key{0} : Key{1} << bits;
+      } else {
+        field = static_cast<Key>(
+          cudf::experimental::type_dispatcher(col.type(), radix_value_encoder{}, col, row));
+        if (nulls and before) { field |= Key{1} << bits; }
+      }
+
+      auto const mask = width == sizeof(Key) * 8 ? ~Key{0} : (Key{1} << width) - 1;
+      if (column_order != nullptr and column_order[i] == order::DESCENDING) {
+        field = ~field & mask;
+      }
+      key = width == sizeof(Key) * 8 ? field : (key << width) | field;
+    }
+    return key;
+  }
+};
+
+/**
+ * @brief Returns the number of bits of the radix sort keys of the rows of
+ * `input`, or a value greater than 64 if they cannot be radix sorted
+ */
+inline size_type radix_key_bits(std::vector<radix_field> const& fields) {
+  return std::accumulate(fields.begin(), fields.end(), size_type{0}, [](auto bits, auto field) {
+    return field.value_bits == 0 ? std::numeric_limits<size_type>::max() / 2
+                                 : bits + field.value_bits + field.has_nulls;
+  });
+}
+
+/**
+ * @brief Sorts `indices` by the radix sort keys of the rows of `input`
+ *
+ * Radix sort is stable, so this serves both stable and unstable sorts.
+ */
+template <typename Key>
+void radix_sort_indices(table_view const& input,
+                        std::vector<radix_field> const& fields,
+                        std::vector<order> const& column_order,
+                        std::vector<null_order> const& null_precedence,
+                        mutable_column_view& indices,
+                        cudaStream_t stream) {
+  rmm::device_vector<radix_field> d_fields(fields);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+
+  auto device_table = table_device_view::create(input, stream);
+  rmm::device_vector<Key> keys(input.num_rows());
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.num_rows()),
+    keys.begin(),
+    radix_key_fn<Key>{*device_table,
+                      d_fields.data().get(),
+                      column_order.empty() ? nullptr : d_column_order.data().get(),
+                      null_precedence.empty() ? nullptr : d_null_precedence.data().get()});
+
+  // Sorting primitive keys with the default comparator dispatches to a radix sort
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             keys.begin(),
+                             keys.end(),
+                             indices.begin<size_type>());
+}
+
+/**
+ * @brief Sorts the runs of `indices` with equal `keys` by the full rows of
+ * `input`
+ *
+ * `indices` must be sorted by `keys`. Only the rows whose key is not unique
+ * are copied out, sorted by key then row, and scattered back.
+ */
+template <bool has_nulls, bool stable>
+void sort_tied_rows(table_device_view const& input,
+                    order const* column_order,
+                    null_order const* null_precedence,
+                    rmm::device_vector<uint64_t> const& keys,
+                    mutable_column_view& indices,
+                    cudaStream_t stream) {
+  auto const num_rows = indices.size();
+  auto const d_keys   = keys.data().get();
+  rmm::device_vector<size_type> tied_positions(num_rows);
+  auto const tied_end = thrust::copy_if(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    tied_positions.begin(),
+    [d_keys, num_rows] __device__(size_type i) {
+      return (i > 0 and d_keys[i - 1] == d_keys[i]) or
+             (i + 1 < num_rows and d_keys[i + 1] == d_keys[i]);
+    });
+  auto const num_tied = thrust::distance(tied_positions.begin(), tied_end);
+  if (num_tied == 0) { return; }
+
+  rmm::device_vector<uint64_t> tied_keys(num_tied);
+  rmm::device_vector<size_type> tied_indices(num_tied);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 tied_positions.begin(),
+                 tied_end,
+                 keys.begin(),
+                 tied_keys.begin());
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 tied_positions.begin(),
+                 tied_end,
+                 indices.begin<size_type>(),
+                 tied_indices.begin());
+
+  // Rows with different keys keep their order, so the tied rows are sorted
+  // within their runs and land back on the positions of their runs
+  auto comparator =
+    row_lexicographic_comparator<has_nulls>(input, input, column_order, null_precedence);
+  auto const tie_comparator = [comparator] __device__(thrust::tuple<uint64_t, size_type> lhs,
+                                                      thrust::tuple<uint64_t, size_type> rhs) {
+    auto const lhs_key = thrust::get<0>(lhs);
+    auto const rhs_key = thrust::get<0>(rhs);
+    if (lhs_key != rhs_key) { return lhs_key < rhs_key; }
+    return comparator(thrust::get<1>(lhs), thrust::get<1>(rhs));
+  };
+  auto tied =
+    thrust::make_zip_iterator(thrust::make_tuple(tied_keys.begin(), tied_indices.begin()));
+  if (stable) {
+    thrust::stable_sort(
+      rmm::exec_policy(stream)->on(stream), tied, tied + num_tied, tie_comparator);
+  } else {
+    thrust::sort(rmm::exec_policy(stream)->on(stream), tied, tied + num_tied, tie_comparator);
+  }
+
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  tied_indices.begin(),
+                  tied_indices.end(),
+                  tied_positions.begin(),
+                  indices.begin<size_type>());
+}
+
+/**
+ * @brief Sorts `indices` by the rows of `input`, whose first column is a
+ * strings column
+ *
+ * The rows are radix sorted by the prefix keys of the strings of the first
+ * column, so that only the rows with equal keys need to be compared in full.
+ */
+template <bool stable>
+void string_prefix_sort_indices(table_view const& input,
+                                std::vector<order> const& column_order,
+                                std::vector<null_order> const& null_precedence,
+                                mutable_column_view& indices,
+                                cudaStream_t stream) {
+  auto const leading    = column_device_view::create(input.column(0), stream);
+  bool const descending = not column_order.empty() and column_order[0] == order::DESCENDING;
+  bool const nulls_before = null_precedence.empty() or null_precedence[0] == null_order::BEFORE;
+
+  rmm::device_vector<uint64_t> keys(input.num_rows());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.num_rows()),
+                    keys.begin(),
+                    string_prefix_key_fn{*leading, descending, nulls_before});
+  // Radix sort is stable, so rows with equal keys remain in input order
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             keys.begin(),
+                             keys.end(),
+                             indices.begin<size_type>());
+
+  auto device_table = table_device_view::create(input, stream);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+  auto const d_order      = column_order.empty() ? nullptr : d_column_order.data().get();
+  auto const d_precedence = null_precedence.empty() ? nullptr : d_null_precedence.data().get();
+  if (has_nulls(input)) {
+    sort_tied_rows<true, stable>(*device_table, d_order, d_precedence, keys, indices, stream);
+  } else {
+    sort_tied_rows<false, stable>(*device_table, d_order, d_precedence, keys, indices, stream);
+  }
+}
+
 // Create permuted row indices that would materialize sorted order
 template <bool stable = false>
 std::unique_ptr<column> sorted_order(table_view input,
@@ -50,6 +366,16 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  cudf::detail::prefetch_to_device(input, stream);
+
+  // Struct columns are sorted by the columns of their fields
+  if (cudf::structs::detail::has_nested_columns(input)) {
+    auto const flattened = cudf::structs::detail::flatten_nested_columns(
+      input, column_order, null_precedence, stream);
+    return sorted_order<stable>(
+      flattened.flattened_columns, flattened.orders, flattened.null_orders, mr, stream);
+  }
+
   std::unique_ptr<column> sorted_indices =
     cudf::make_numeric_column(data_type(experimental::type_to_id<size_type>()),
                               input.num_rows(),
@@ -59,13 +385,43 @@ std::unique_ptr<column> sorted_order(table_view input,
 
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
 
-  auto device_table = table_device_view::create(input, stream);
-
   thrust::sequence(rmm::exec_policy(stream)->on(stream),
                    mutable_indices_view.begin<size_type>(),
                    mutable_indices_view.end<size_type>(),
                    0);
 
+  // Sorted rows are found without sorting, and reversed rows by reversing them
+  // unless ties must keep their input order
+  if (detail::is_sorted(input, column_order, null_precedence, stream)) { return sorted_indices; }
+  if (not stable and detail::is_reverse_sorted(input, column_order, null_precedence, stream)) {
+    thrust::reverse(rmm::exec_policy(stream)->on(stream),
+                    mutable_indices_view.begin<size_type>(),
+                    mutable_indices_view.end<size_type>());
+    return sorted_indices;
+  }
+
+  // Rows of fixed-width columns that fit a 32 or 64-bit key after packing are
+  // radix sorted instead of merge sorted with the row comparator
+  std::vector<radix_field> fields(input.num_columns());
+  std::transform(input.begin(), input.end(), fields.begin(), make_radix_field);
+  auto const key_bits = radix_key_bits(fields);
+  if (key_bits <= 32) {
+    radix_sort_indices<uint32_t>(
+      input, fields, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  } else if (key_bits <= 64) {
+    radix_sort_indices<uint64_t>(
+      input, fields, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+  if (input.column(0).type().id() == STRING) {
+    string_prefix_sort_indices<stable>(
+      input, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+
+  auto device_table = table_device_view::create(input, stream);
+
   rmm::device_vector<order> d_column_order(column_order);
 
   if (has_nulls(input)) {
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_impl.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+
+#include <cmath>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+namespace {
+
+/**
+ * @brief Copies the indices of the rows of `input` that do not sort after row
+ * `pivot` into `candidates` and returns the number of such rows
+ */
+template <bool has_nulls>
+size_type copy_candidates(table_device_view const& input,
+                          size_type pivot,
+                          order const* column_order,
+                          null_order const* null_precedence,
+                          rmm::device_vector<size_type>& candidates,
+                          cudaStream_t stream) {
+  auto comparator =
+    row_lexicographic_comparator<has_nulls>(input, input, column_order, null_precedence);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(input.num_rows()),
+                                   candidates.begin(),
+                                   [comparator, pivot] __device__(size_type row) {
+                                     return not comparator(pivot, row);
+                                   });
+  return thrust::distance(candidates.begin(), end);
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(table_view input,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream) {
+  CUDF_EXPECTS(k >= 0, "k must be non-negative.");
+  auto const num_rows = input.num_rows();
+  k                   = std::min(k, num_rows);
+
+  if (k == 0 or input.num_columns() == 0) {
+    return make_numeric_column(data_type(INT32), 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  // Sorting a sample of `sqrt(k * num_rows)` rows places the pivot, the k-th
+  // smallest sample, above about as many rows as there are samples
+  auto const num_samples = static_cast<size_type>(std::sqrt(static_cast<double>(k) * num_rows));
+  if (2 * num_samples >= num_rows) {
+    auto sorted_indices = sorted_order<true>(input, column_order, null_precedence, mr, stream);
+    if (k == num_rows) { return sorted_indices; }
+    return std::make_unique<column>(slice(sorted_indices->view(), 0, k), stream, mr);
+  }
+
+  rmm::device_vector<size_type> samples(num_samples);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   samples.begin(),
+                   samples.end(),
+                   0,
+                   num_rows / num_samples);
+  auto const sampled_rows = gather(input,
+                                   column_view(data_type(INT32), num_samples, samples.data().get()),
+                                   false,
+                                   false,
+                                   false,
+                                   rmm::mr::get_default_resource(),
+                                   stream);
+  auto const sample_order = sorted_order<false>(sampled_rows->view(),
+                                                column_order,
+                                                null_precedence,
+                                                rmm::mr::get_default_resource(),
+                                                stream);
+
+  // The k-th smallest sample does not sort before any of the k smallest
+  // samples, so at least k rows are candidates
+  size_type pivot_sample{};
+  CUDA_TRY(cudaMemcpyAsync(&pivot_sample,
+                           sample_order->view().data<size_type>() + k - 1,
+                           sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  size_type const pivot = samples[pivot_sample];
+
+  auto device_table = table_device_view::create(input, stream);
+  rmm::device_vector<order> d_column_order(column_order);
+  rmm::device_vector<null_order> d_null_precedence(null_precedence);
+  auto const d_order      = column_order.empty() ? nullptr : d_column_order.data().get();
+  auto const d_precedence = null_precedence.empty() ? nullptr : d_null_precedence.data().get();
+
+  rmm::device_vector<size_type> candidates(num_rows);
+  auto const num_candidates =
+    has_nulls(input)
+      ? copy_candidates<true>(*device_table, pivot, d_order, d_precedence, candidates, stream)
+      : copy_candidates<false>(*device_table, pivot, d_order, d_precedence, candidates, stream);
+
+  // The candidates are in input order, so a stable sort of them orders
+  // equivalent rows as a stable sort of all rows does
+  auto const candidate_rows =
+    gather(input,
+           column_view(data_type(INT32), num_candidates, candidates.data().get()),
+           false,
+           false,
+           false,
+           rmm::mr::get_default_resource(),
+           stream);
+  auto const candidate_order = sorted_order<true>(candidate_rows->view(),
+                                                  column_order,
+                                                  null_precedence,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+
+  auto result = make_numeric_column(data_type(INT32), k, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 candidate_order->view().begin<size_type>(),
+                 candidate_order->view().begin<size_type>() + k,
+                 candidates.begin(),
+                 result->mutable_view().begin<size_type>());
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(table_view input,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(input, k, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> top_k(table_view input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  auto const indices = detail::top_k_order(
+    input, k, column_order, null_precedence, rmm::mr::get_default_resource());
+  return detail::gather(input, indices->view(), false, false, false, mr);
+}
+
+}  // namespace experimental
+}  // namespace cudf
@@ -14,18 +14,26 @@
  * limitations under the License.
  */
 
+#include <cudf/binaryop.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <algorithm>
+#include <vector>
 
 namespace {
 
@@ -50,6 +58,216 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+/**
+ * @brief A value of a predicate, in the representation of its category
+ */
+struct predicate_value {
+  int64_t integer;
+  double floating;
+  bool is_floating;
+
+  __device__ inline double as_double() const {
+    return is_floating ? floating : static_cast<double>(integer);
+  }
+  __device__ inline bool as_bool() const { return is_floating ? floating != 0 : integer != 0; }
+};
+
+__device__ inline predicate_value make_value(bool is_floating, double value) {
+  return is_floating ? predicate_value{0, value, true}
+                     : predicate_value{static_cast<int64_t>(value), 0, false};
+}
+
+__device__ inline predicate_value make_value(bool is_floating, int64_t value) {
+  return is_floating ? predicate_value{0, static_cast<double>(value), true}
+                     : predicate_value{value, 0, false};
+}
+
+/**
+ * @brief A node of a predicate, flattened in postfix order
+ */
+struct predicate_node {
+  cudf::experimental::expression::kind kind;
+  cudf::experimental::binary_operator op;
+  cudf::size_type column_index;  ///< Column of a COLUMN_REFERENCE
+  predicate_value value;         ///< Value of a LITERAL
+  bool is_floating;              ///< Whether the value of an OPERATION is floating point
+};
+
+// Bounds the evaluation stack of a thread, which must fit in registers
+constexpr int max_predicate_depth = 16;
+
+struct read_predicate_value {
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ predicate_value operator()(cudf::column_device_view const& col, cudf::size_type i) {
+    return predicate_value{0, static_cast<double>(col.element<T>(i)), true};
+  }
+
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  __device__ predicate_value operator()(cudf::column_device_view const& col, cudf::size_type i) {
+    return predicate_value{static_cast<int64_t>(col.element<T>(i)), 0, false};
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  __device__ predicate_value operator()(cudf::column_device_view const&, cudf::size_type) {
+    release_assert(false && "Unsupported predicate column type");
+    return predicate_value{};
+  }
+};
+
+__device__ predicate_value apply_predicate_operator(cudf::experimental::binary_operator op,
+                                                    predicate_value x,
+                                                    predicate_value y,
+                                                    bool is_floating) {
+  using cudf::experimental::binary_operator;
+  // Comparisons promote as the built-in operators do; arithmetic operators
+  // first cast their operands to the output category, as the JIT operators do
+  bool const compare_floating = x.is_floating or y.is_floating;
+  auto const compare          = [&](auto cmp) {
+    return make_value(is_floating,
+                      static_cast<int64_t>(compare_floating ? cmp(x.as_double(), y.as_double())
+                                                            : cmp(x.integer, y.integer)));
+  };
+  auto const arithmetic = [&](auto fn) {
+    return is_floating ? make_value(true, fn(x.as_double(), y.as_double()))
+                       : make_value(false, fn(x.is_floating ? static_cast<int64_t>(x.floating)
+                                                            : x.integer,
+                                              y.is_floating ? static_cast<int64_t>(y.floating)
+                                                            : y.integer));
+  };
+  switch (op) {
+    case binary_operator::EQUAL: return compare([](auto a, auto b) { return a == b; });
+    case binary_operator::NOT_EQUAL: return compare([](auto a, auto b) { return a != b; });
+    case binary_operator::LESS: return compare([](auto a, auto b) { return a < b; });
+    case binary_operator::GREATER: return compare([](auto a, auto b) { return a > b; });
+    case binary_operator::LESS_EQUAL: return compare([](auto a, auto b) { return a <= b; });
+    case binary_operator::GREATER_EQUAL: return compare([](auto a, auto b) { return a >= b; });
+    case binary_operator::LOGICAL_AND:
+      return make_value(is_floating, static_cast<int64_t>(x.as_bool() && y.as_bool()));
+    case binary_operator::LOGICAL_OR:
+      return make_value(is_floating, static_cast<int64_t>(x.as_bool() || y.as_bool()));
+    case binary_operator::ADD: return arithmetic([](auto a, auto b) { return a + b; });
+    case binary_operator::SUB: return arithmetic([](auto a, auto b) { return a - b; });
+    case binary_operator::MUL: return arithmetic([](auto a, auto b) { return a * b; });
+    case binary_operator::DIV: return arithmetic([](auto a, auto b) { return a / b; });
+    case binary_operator::TRUE_DIV: return make_value(is_floating, x.as_double() / y.as_double());
+    default: release_assert(false && "Unsupported predicate operator"); return predicate_value{};
+  }
+}
+
+// Returns true if the predicate is true and valid (non-null) for index i
+// This is the filter functor for filter_and_select
+struct predicate_filter {
+  cudf::table_device_view table;
+  predicate_node const* nodes;
+  cudf::size_type num_nodes;
+
+  __device__ inline bool operator()(cudf::size_type i) {
+    predicate_value stack[max_predicate_depth];
+    int top = 0;
+    for (cudf::size_type n = 0; n < num_nodes; ++n) {
+      auto const& node = nodes[n];
+      switch (node.kind) {
+        case cudf::experimental::expression::kind::COLUMN_REFERENCE: {
+          auto const& col = table.column(node.column_index);
+          if (col.is_null(i)) { return false; }
+          stack[top++] = cudf::experimental::type_dispatcher(
+            col.type(), read_predicate_value{}, col, i);
+          break;
+        }
+        case cudf::experimental::expression::kind::LITERAL: stack[top++] = node.value; break;
+        default:
+          --top;
+          stack[top - 1] =
+            apply_predicate_operator(node.op, stack[top - 1], stack[top], node.is_floating);
+      }
+    }
+    return stack[0].as_bool();
+  }
+};
+
+struct literal_predicate_value {
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  predicate_value operator()(cudf::scalar const& s, cudaStream_t stream) {
+    auto const value =
+      static_cast<cudf::experimental::scalar_type_t<T> const&>(s).value(stream);
+    return predicate_value{0, static_cast<double>(value), true};
+  }
+
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  predicate_value operator()(cudf::scalar const& s, cudaStream_t stream) {
+    auto const value =
+      static_cast<cudf::experimental::scalar_type_t<T> const&>(s).value(stream);
+    return predicate_value{static_cast<int64_t>(value), 0, false};
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  predicate_value operator()(cudf::scalar const&, cudaStream_t) {
+    CUDF_FAIL("Invalid/Unsupported literal datatype");
+  }
+};
+
+bool is_supported_predicate_operator(cudf::experimental::binary_operator op) {
+  using cudf::experimental::binary_operator;
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL:
+    case binary_operator::LOGICAL_AND:
+    case binary_operator::LOGICAL_OR:
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV:
+    case binary_operator::TRUE_DIV: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Appends the nodes of `expr` to `nodes` in postfix order
+ *
+ * @return The depth of the evaluation stack of `expr`, or -1 if a literal of
+ * `expr` is invalid, which makes the predicate null for all rows
+ */
+int flatten_predicate(cudf::experimental::expression const& expr,
+                      cudf::table_view const& input,
+                      std::vector<predicate_node>& nodes,
+                      cudaStream_t stream) {
+  using cudf::experimental::expression;
+  predicate_node node{expr.get_kind(), expr.op(), 0, predicate_value{}, false};
+  int depth = 1;
+  switch (expr.get_kind()) {
+    case expression::kind::COLUMN_REFERENCE:
+      CUDF_EXPECTS(expr.column_index() >= 0 && expr.column_index() < input.num_columns(),
+                   "Expression refers to a column out of range");
+      CUDF_EXPECTS(cudf::is_numeric(input.column(expr.column_index()).type()),
+                   "Invalid/Unsupported column datatype");
+      node.column_index = expr.column_index();
+      break;
+    case expression::kind::LITERAL:
+      if (not expr.literal_value().is_valid(stream)) { return -1; }
+      node.value = cudf::experimental::type_dispatcher(
+        expr.literal_value().type(), literal_predicate_value{}, expr.literal_value(), stream);
+      break;
+    default: {
+      CUDF_EXPECTS(is_supported_predicate_operator(expr.op()),
+                   "Unsupported operator in predicate expression");
+      CUDF_EXPECTS(cudf::is_numeric(expr.output_type()), "Invalid/Unsupported output datatype");
+      auto const lhs_depth = flatten_predicate(expr.lhs(), input, nodes, stream);
+      auto const rhs_depth = flatten_predicate(expr.rhs(), input, nodes, stream);
+      if (lhs_depth < 0 || rhs_depth < 0) { return -1; }
+      node.is_floating = expr.output_type().id() == cudf::FLOAT32 ||
+                         expr.output_type().id() == cudf::FLOAT64;
+      depth = std::max(lhs_depth, rhs_depth + 1);
+    }
+  }
+  nodes.push_back(node);
+  return depth;
+}
+
 }  // namespace
 
 namespace cudf {
@@ -81,6 +299,41 @@ std::unique_ptr<experimental::table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Filters a table_view using a predicate expression, and selects columns.
+ *
+ * calls copy_if() with the `predicate_filter` functor.
+ */
+std::unique_ptr<experimental::table> filter_and_select(table_view const& input,
+                                                       expression const& predicate,
+                                                       std::vector<size_type> const& column_indices,
+                                                       rmm::mr::device_memory_resource* mr,
+                                                       cudaStream_t stream) {
+  CUDF_EXPECTS(predicate.get_kind() == expression::kind::OPERATION &&
+                 predicate.output_type().id() == BOOL8,
+               "Predicate must be an operation of Boolean type");
+  CUDF_EXPECTS(std::all_of(column_indices.begin(),
+                           column_indices.end(),
+                           [&input](auto index) {
+                             return index >= 0 && index < input.num_columns();
+                           }),
+               "Selected column out of range");
+
+  auto const selected = input.select(column_indices);
+  std::vector<predicate_node> nodes;
+  auto const depth = flatten_predicate(predicate, input, nodes, stream);
+  CUDF_EXPECTS(depth <= max_predicate_depth, "Predicate expression is too deep");
+  if (depth < 0 || input.num_rows() == 0) { return experimental::empty_like(selected); }
+
+  rmm::device_vector<predicate_node> d_nodes(nodes);
+  auto device_input = table_device_view::create(input, stream);
+  return detail::copy_if(
+    selected,
+    predicate_filter{*device_input, d_nodes.data().get(), static_cast<size_type>(nodes.size())},
+    mr,
+    stream);
+}
+
 }  // namespace detail
 
 /*
@@ -92,5 +345,16 @@ std::unique_ptr<experimental::table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, mr);
 }
+
+/*
+ * Filters a table_view using a predicate expression, and selects columns.
+ */
+std::unique_ptr<experimental::table> filter_and_select(table_view const& input,
+                                                       expression const& predicate,
+                                                       std::vector<size_type> const& column_indices,
+                                                       rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::filter_and_select(input, predicate, column_indices, mr);
+}
 }  // namespace experimental
 }  // namespace cudf
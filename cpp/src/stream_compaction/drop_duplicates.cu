@@ -28,12 +28,16 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
 
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/logical.h>
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 namespace cudf {
 namespace experimental {
@@ -144,36 +148,190 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
   }
 }
 
+template <typename Map>
+struct insert_row_index {
+  Map map;
+  __device__ void operator()(size_type i) { map.insert(thrust::make_pair(i, i)); }
+};
+
+/**
+ * @brief Inserts the index of every row of `d_keys` in a hash map using the
+ * row hasher and row comparator on `d_keys`, so that the map holds the index
+ * of one arbitrary row of each set of duplicate rows
+ */
+template <bool has_nulls>
+auto build_unique_rows_map(table_device_view const& d_keys,
+                           bool nulls_are_equal,
+                           cudaStream_t stream) {
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+
+  using map_type = concurrent_unordered_map<size_type,
+                                            size_type,
+                                            row_hasher<default_hash, has_nulls>,
+                                            row_equality_comparator<has_nulls>>;
+
+  auto map = map_type::create(compute_hash_table_size(d_keys.num_rows()),
+                              unused_key,
+                              unused_value,
+                              row_hasher<default_hash, has_nulls>{d_keys},
+                              row_equality_comparator<has_nulls>{d_keys, d_keys, nulls_are_equal},
+                              typename map_type::allocator_type(),
+                              stream);
+
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     d_keys.num_rows(),
+                     insert_row_index<map_type>{*map});
+  return map;
+}
+
+/**
+ * @brief Create a column_view of index values which represent the row values
+ * without duplicates, in unspecified order, for `KEEP_ANY`
+ *
+ * @param[in] keys            table_view to identify duplicate rows
+ * @param[out] unique_indices Column to store the index with unique rows
+ * @param[in] nulls_are_equal flag to denote nulls are equal if true,
+ * nulls are not equal if false
+ * @param[in] stream Optional CUDA stream on which to execute kernels
+ *
+ * @return column_view column_view of unique row index, this is actually slice of `unique_indices`.
+ */
+template <bool has_nulls>
+column_view get_unique_unordered_indices(cudf::table_view const& keys,
+                                         cudf::mutable_column_view& unique_indices,
+                                         bool nulls_are_equal,
+                                         cudaStream_t stream) {
+  auto device_input_table = cudf::table_device_view::create(keys, stream);
+  auto map = build_unique_rows_map<has_nulls>(*device_input_table, nulls_are_equal, stream);
+
+  auto get_key = [] __device__(auto const& element) { return element.first; };
+  auto result_end =
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_transform_iterator(map->data(), get_key),
+                    thrust::make_transform_iterator(map->data() + map->capacity(), get_key),
+                    unique_indices.begin<cudf::size_type>(),
+                    [unused_key = map->get_unused_key()] __device__(size_type key) {
+                      return key != unused_key;
+                    });
+
+  return cudf::experimental::detail::slice(
+    column_view(unique_indices),
+    0,
+    thrust::distance(unique_indices.begin<cudf::size_type>(), result_end));
+}
+
+/*
+ * Counts the distinct rows of `keys` as the number of rows of a hash map of
+ * the rows, which avoids sorting the keys.
+ */
+template <bool has_nulls>
+cudf::size_type unique_count(table_view const& keys,
+                             bool const& nulls_are_equal,
+                             cudaStream_t stream) {
+  auto device_input_table = cudf::table_device_view::create(keys, stream);
+  auto map = build_unique_rows_map<has_nulls>(*device_input_table, nulls_are_equal, stream);
+  return thrust::count_if(
+    rmm::exec_policy(stream)->on(stream),
+    map->data(),
+    map->data() + map->capacity(),
+    [unused_key = map->get_unused_key()] __device__(auto const& element) {
+      return element.first != unused_key;
+    });
+}
+
 cudf::size_type unique_count(table_view const& keys,
                              bool const& nulls_are_equal = true,
                              cudaStream_t stream         = 0) {
-  // sort only indices
-  auto sorted_indices = sorted_order(
-    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
+  return cudf::has_nulls(keys) ? unique_count<true>(keys, nulls_are_equal, stream)
+                               : unique_count<false>(keys, nulls_are_equal, stream);
+}
 
-  // count unique elements
-  auto sorted_row_index   = sorted_indices->view().data<cudf::size_type>();
-  auto device_input_table = cudf::table_device_view::create(keys, stream);
+/**
+ * @brief Returns the register index and rank of the 32-bit hash of a row in
+ * a HyperLogLog sketch of `2^precision` registers
+ *
+ * The hash of a row is finalized as in MurmurHash3, because combining the
+ * hashes of several columns does not spread their bits across the whole word.
+ */
+__device__ inline thrust::pair<uint32_t, int32_t> hyperloglog_register(hash_value_type hash,
+                                                                        int precision) {
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6b;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35;
+  hash ^= hash >> 16;
+  auto const remaining = hash << precision;
+  auto const rank      = remaining == 0 ? 32 - precision + 1 : __clz(remaining) + 1;
+  return thrust::make_pair(hash >> (32 - precision), rank);
+}
 
-  if (cudf::has_nulls(keys)) {
-    row_equality_comparator<true> comp(*device_input_table, *device_input_table, nulls_are_equal);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
+/**
+ * @brief Returns the HyperLogLog estimate of the number of distinct values
+ * hashed into `registers`, with the small and large range corrections of
+ * Flajolet et al.
+ */
+double hyperloglog_estimate(std::vector<int32_t> const& registers) {
+  double const m = registers.size();
+  double const alpha =
+    m == 16 ? 0.673 : m == 32 ? 0.697 : m == 64 ? 0.709 : 0.7213 / (1 + 1.079 / m);
+  double sum{0};
+  size_type zeros{0};
+  for (auto const r : registers) {
+    sum += std::ldexp(1.0, -r);
+    if (r == 0) { ++zeros; }
+  }
+  double estimate = alpha * m * m / sum;
+  double const two_to_32 = 4294967296.0;
+  if (estimate <= 2.5 * m && zeros > 0) {
+    estimate = m * std::log(m / zeros);
+  } else if (estimate > two_to_32 / 30) {
+    estimate = -two_to_32 * std::log(1 - estimate / two_to_32);
+  }
+  return estimate;
+}
+
+template <bool has_nulls>
+void hyperloglog_registers(table_view const& input,
+                           int precision,
+                           rmm::device_vector<int32_t>& registers,
+                           cudaStream_t stream) {
+  auto device_input_table = cudf::table_device_view::create(input, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.num_rows(),
+                     [hasher    = row_hasher<default_hash, has_nulls>{*device_input_table},
+                      registers = registers.data().get(),
+                      precision] __device__(size_type i) {
+                       auto const reg = hyperloglog_register(hasher(i), precision);
+                       atomicMax(registers + reg.first, reg.second);
+                     });
+}
+
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int precision,
+                                      cudaStream_t stream) {
+  CUDF_EXPECTS(precision >= 4 && precision <= 18, "precision must be in [4, 18]");
+  if (0 == input.num_rows() || 0 == input.num_columns()) { return 0; }
+
+  rmm::device_vector<int32_t> registers(size_t{1} << precision, 0);
+  if (cudf::has_nulls(input)) {
+    hyperloglog_registers<true>(input, precision, registers, stream);
   } else {
-    row_equality_comparator<false> comp(*device_input_table, *device_input_table, nulls_are_equal);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
+    hyperloglog_registers<false>(input, precision, registers, stream);
   }
+  std::vector<int32_t> h_registers(registers.size());
+  CUDA_TRY(cudaMemcpyAsync(h_registers.data(),
+                           registers.data().get(),
+                           registers.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+
+  auto const estimate = std::llround(hyperloglog_estimate(h_registers));
+  return static_cast<size_type>(
+    std::min<long long>(estimate, std::numeric_limits<size_type>::max()));
 }
 
 std::unique_ptr<experimental::table> drop_duplicates(table_view const& input,
@@ -194,8 +352,17 @@ std::unique_ptr<experimental::table> drop_duplicates(table_view const& input,
   auto mutable_unique_indices_view = unique_indices->mutable_view();
   // This is just slice of `unique_indices` but with different size as per the
   // keys_view has been processed in `get_unique_ordered_indices`
-  auto unique_indices_view = detail::get_unique_ordered_indices(
-    keys_view, mutable_unique_indices_view, keep, nulls_are_equal, stream);
+  column_view unique_indices_view;
+  if (keep != duplicate_keep_option::KEEP_ANY) {
+    unique_indices_view = detail::get_unique_ordered_indices(
+      keys_view, mutable_unique_indices_view, keep, nulls_are_equal, stream);
+  } else if (cudf::has_nulls(keys_view)) {
+    unique_indices_view = detail::get_unique_unordered_indices<true>(
+      keys_view, mutable_unique_indices_view, nulls_are_equal, stream);
+  } else {
+    unique_indices_view = detail::get_unique_unordered_indices<false>(
+      keys_view, mutable_unique_indices_view, nulls_are_equal, stream);
+  }
 
   // run gather operation to establish new order
   return detail::gather(input, unique_indices_view, false, false, false, mr, stream);
@@ -249,5 +416,12 @@ cudf::size_type unique_count(column_view const& input,
   return detail::unique_count(input, ignore_nulls, nan_as_null);
 }
 
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int precision,
+                                      rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, precision);
+}
+
 }  // namespace experimental
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/attributes.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -82,19 +83,21 @@ std::unique_ptr<column> counts_fn(strings_column_view const& strings,
 
 }  // namespace
 
-std::unique_ptr<column> count_characters(
+std::unique_ptr<column> count_bytes(
   strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0) {
-  auto ufn = [] __device__(const string_view& d_str) { return d_str.length(); };
+  auto ufn = [] __device__(const string_view& d_str) { return d_str.size_bytes(); };
   return counts_fn(strings, ufn, mr, stream);
 }
 
-std::unique_ptr<column> count_bytes(
+std::unique_ptr<column> count_characters(
   strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0) {
-  auto ufn = [] __device__(const string_view& d_str) { return d_str.size_bytes(); };
+  // the characters of ASCII strings are their bytes, which need not be decoded
+  if (is_ascii(strings, stream)) return count_bytes(strings, mr, stream);
+  auto ufn = [] __device__(const string_view& d_str) { return d_str.length(); };
   return counts_fn(strings, ufn, mr, stream);
 }
 
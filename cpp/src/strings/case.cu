@@ -28,6 +28,8 @@
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -47,6 +49,10 @@ enum TwoPass {
 /**
  * @brief Per string logic for case conversion functions.
  *
+ * The lanes processing a string convert the characters beginning at consecutive
+ * bytes, so a long string is converted by a whole warp. The output position of
+ * each character is given by the sum of the output sizes of the characters before it.
+ *
  * @tparam Pass Determines if size calculation or output write is begin performed.
  */
 template <TwoPass Pass = SizeOnly>
@@ -58,64 +64,141 @@ struct upper_lower_fn {
   const special_case_mapping* d_special_case_mapping;
   const int32_t* d_offsets{};
   char* d_chars{};
+  int32_t* d_sizes{};  // output size of each string for the SizeOnly pass
 
-  __device__ special_case_mapping get_special_case_mapping(uint32_t code_point) {
+  __device__ special_case_mapping get_special_case_mapping(uint32_t code_point) const {
     return d_special_case_mapping[get_special_case_hash_index(code_point)];
   }
 
   // compute-size / copy the bytes representing the special case mapping for this codepoint
   __device__ int32_t handle_special_case_bytes(uint32_t code_point,
-                                               char*& d_buffer,
-                                               detail::character_flags_table_type flag) {
+                                               char* d_buffer,
+                                               detail::character_flags_table_type flag) const {
     special_case_mapping m = get_special_case_mapping(code_point);
     size_type bytes        = 0;
 
     auto const count  = IS_LOWER(flag) ? m.num_upper_chars : m.num_lower_chars;
     auto const* chars = IS_LOWER(flag) ? m.upper : m.lower;
     for (uint16_t idx = 0; idx < count; idx++) {
-      if (Pass == SizeOnly) {
+      if (d_buffer == nullptr) {
         bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(chars[idx]));
       } else {
         bytes += detail::from_char_utf8(detail::codepoint_to_utf8(chars[idx]), d_buffer + bytes);
       }
     }
-    if (d_buffer != nullptr) { d_buffer += bytes; }
     return bytes;
   }
 
-  __device__ int32_t operator()(size_type idx) {
-    if (d_column.is_null(idx)) return 0;  // null string
+  // compute-size / write the conversion of a single character; only the size if d_buffer is null
+  __device__ int32_t convert_char(char_utf8 chr, char* d_buffer) const {
+    uint32_t code_point                     = detail::utf8_to_codepoint(chr);
+    detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+
+    // we apply special mapping in two cases:
+    // - uncased characters with the special mapping flag, always
+    // - cased characters with the special mapping flag, when matching the input case_flag
+    //
+    if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag)))
+      return handle_special_case_bytes(code_point, d_buffer, case_flag);
+    if (flag & case_flag) chr = detail::codepoint_to_utf8(d_case_table[code_point]);
+    return d_buffer == nullptr ? detail::bytes_in_char_utf8(chr)
+                               : detail::from_char_utf8(chr, d_buffer);
+  }
+
+  __device__ void operator()(size_type idx, string_lanes const& lanes) const {
+    if (d_column.is_null(idx)) {  // null string
+      if (Pass == SizeOnly && lanes.lane == 0) d_sizes[idx] = 0;
+      return;
+    }
     string_view d_str = d_column.template element<string_view>(idx);
+    auto const data   = d_str.data();
+    auto const size   = d_str.size_bytes();
     int32_t bytes     = 0;
-    char* d_buffer    = nullptr;
-    if (Pass == ExecuteOp) d_buffer = d_chars + d_offsets[idx];
-    for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
-      uint32_t code_point                     = detail::utf8_to_codepoint(*itr);
-      detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
-
-      // we apply special mapping in two cases:
-      // - uncased characters with the special mapping flag, always
-      // - cased characters with the special mapping flag, when matching the input case_flag
-      //
-      if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag))) {
-        bytes += handle_special_case_bytes(code_point, d_buffer, case_flag);
-      } else if (flag & case_flag) {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]));
-        else
-          d_buffer +=
-            detail::from_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]), d_buffer);
-      } else {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(*itr);
-        else
-          d_buffer += detail::from_char_utf8(*itr, d_buffer);
+    for (size_type begin = 0; begin < size; begin += lanes.lanes) {
+      auto const pos = begin + lanes.lane;
+      // only the first byte of a character is converted
+      bool const is_first = (pos < size) && ((static_cast<uint8_t>(data[pos]) & 0xC0) != 0x80);
+      char_utf8 chr       = 0;
+      int32_t char_bytes  = 0;
+      if (is_first) {
+        detail::to_char_utf8(data + pos, chr);
+        char_bytes = convert_char(chr, nullptr);
       }
+      if (Pass == SizeOnly) {
+        bytes += char_bytes;
+        continue;
+      }
+      auto const offset = lanes.inclusive_scan(char_bytes);
+      if (is_first) convert_char(chr, d_chars + d_offsets[idx] + bytes + offset - char_bytes);
+      bytes += lanes.last(offset);
     }
-    return bytes;
+    if (Pass == SizeOnly) {
+      bytes = lanes.sum(bytes);
+      if (lanes.lane == 0) d_sizes[idx] = bytes;
+    }
+  }
+};
+
+/**
+ * @brief Converts the case of an ASCII character.
+ *
+ * The ASCII letters have no special case mappings and their upper and lower
+ * cases differ by a single bit.
+ */
+struct ascii_case_fn {
+  character_flags_table_type case_flag;  // flag to check with on each character
+
+  __device__ char operator()(char chr) const {
+    bool const is_upper = static_cast<uint8_t>(chr - 'A') < 26;
+    bool const is_lower = static_cast<uint8_t>(chr - 'a') < 26;
+    bool const convert  = (is_upper && IS_UPPER(case_flag)) || (is_lower && IS_LOWER(case_flag));
+    return chr ^ (static_cast<char>(convert) << 5);
   }
 };
 
+/**
+ * @brief Converts the case of a strings column with only ASCII characters.
+ *
+ * Each output string has the size of its input string, so the offsets are
+ * those of the input and the characters are converted byte by byte.
+ */
+std::unique_ptr<column> convert_ascii_case(strings_column_view const& strings,
+                                           character_flags_table_type case_flag,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream) {
+  auto strings_count = strings.size();
+  auto execpol       = rmm::exec_policy(stream);
+
+  // the offsets are rebased to the first string of a sliced column
+  auto d_offsets        = strings.offsets().data<int32_t>() + strings.offset();
+  int32_t const first   = thrust::device_pointer_cast(d_offsets)[0];
+  size_type const bytes = thrust::device_pointer_cast(d_offsets)[strings_count] - first;
+  auto offsets_column   = make_numeric_column(
+    data_type{INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(execpol->on(stream),
+                    d_offsets,
+                    d_offsets + strings_count + 1,
+                    offsets_column->mutable_view().data<int32_t>(),
+                    [first] __device__(int32_t offset) { return offset - first; });
+
+  auto chars_column = strings::detail::create_chars_child_column(
+    strings_count, strings.null_count(), bytes, mr, stream);
+  auto d_chars = strings.chars().data<char>() + first;
+  thrust::transform(execpol->on(stream),
+                    d_chars,
+                    d_chars + bytes,
+                    chars_column->mutable_view().data<char>(),
+                    ascii_case_fn{case_flag});
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             copy_bitmask(strings.parent(), stream, mr),
+                             stream,
+                             mr);
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -132,8 +215,8 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
                                      cudaStream_t stream) {
   auto strings_count = strings.size();
   if (strings_count == 0) return detail::make_empty_strings_column(mr, stream);
+  if (is_ascii(strings, stream)) return convert_ascii_case(strings, case_flag, mr, stream);
 
-  auto execpol         = rmm::exec_policy(stream);
   auto strings_column  = column_device_view::create(strings.parent(), stream);
   auto d_column        = *strings_column;
   size_type null_count = strings.null_count();
@@ -147,13 +230,14 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
   auto d_special_case_mapping = get_special_case_mapping_table();
 
   // build offsets column -- calculate the size of each output string
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0),
-    upper_lower_fn<SizeOnly>{d_column, case_flag, d_flags, d_case_table, d_special_case_mapping});
-  auto offsets_column = detail::make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto offsets_view  = offsets_column->view();
-  auto d_new_offsets = offsets_view.data<int32_t>();
+  rmm::device_vector<int32_t> sizes(strings_count);
+  upper_lower_fn<SizeOnly> size_fn{
+    d_column, case_flag, d_flags, d_case_table, d_special_case_mapping};
+  size_fn.d_sizes = sizes.data().get();
+  for_each_string(strings, size_fn, stream);
+  auto offsets_column = detail::make_offsets_child_column(sizes.begin(), sizes.end(), mr, stream);
+  auto offsets_view   = offsets_column->view();
+  auto d_new_offsets  = offsets_view.data<int32_t>();
 
   // build the chars column -- convert characters based on case_flag parameter
   size_type bytes = thrust::device_pointer_cast(d_new_offsets)[strings_count];
@@ -162,12 +246,11 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
   auto chars_view = chars_column->mutable_view();
   auto d_chars    = chars_view.data<char>();
 
-  thrust::for_each_n(
-    execpol->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
+  for_each_string(
+    strings,
     upper_lower_fn<ExecuteOp>{
-      d_column, case_flag, d_flags, d_case_table, d_special_case_mapping, d_new_offsets, d_chars});
+      d_column, case_flag, d_flags, d_case_table, d_special_case_mapping, d_new_offsets, d_chars},
+    stream);
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
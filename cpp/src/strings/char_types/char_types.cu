@@ -32,6 +32,50 @@
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns true if the characters of each string are of the given types.
+ */
+struct character_types_fn {
+  column_device_view const d_column;
+  character_flags_table_type const* d_flags;
+  string_character_types types;
+  string_character_types verify_types;
+  bool ascii;  // every character is a single byte
+
+  // returns true if this character should be verified, and sets check to its result
+  __device__ bool check_character(uint32_t code_point, bool& check) const {
+    // lookup flags in table by code-point
+    auto flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+    if ((verify_types & flag) ||                   // should flag be verified
+        (flag == 0 && verify_types == ALL_TYPES))  // special edge case
+    {
+      check = (types & flag) > 0;
+      return true;
+    }
+    return false;
+  }
+
+  __device__ bool operator()(size_type idx) const {
+    if (d_column.is_null(idx)) return false;
+    auto d_str            = d_column.element<string_view>(idx);
+    bool check            = !d_str.empty();  // require at least one character
+    size_type check_count = 0;
+    if (ascii) {
+      auto const data = reinterpret_cast<uint8_t const*>(d_str.data());
+      for (size_type pos = 0; check && (pos < d_str.size_bytes()); ++pos)
+        check_count += check_character(data[pos], check);
+    } else {
+      for (auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr)
+        check_count += check_character(detail::utf8_to_codepoint(*itr), check);
+    }
+    return check && (check_count > 0);
+  }
+};
+
+}  // namespace
+
 //
 std::unique_ptr<column> all_characters_of_type(
   strings_column_view const& strings,
@@ -54,29 +98,14 @@ std::unique_ptr<column> all_characters_of_type(
   auto d_results    = results_view.data<bool>();
   // get the static character types table
   auto d_flags = detail::get_character_flags_table();
+  // ASCII characters are looked up by their byte without decoding them
+  bool const ascii = is_ascii(strings, stream);
   // set the output values by checking the character types for each string
   thrust::transform(rmm::exec_policy(stream)->on(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    [d_column, d_flags, types, verify_types, d_results] __device__(size_type idx) {
-                      if (d_column.is_null(idx)) return false;
-                      auto d_str            = d_column.element<string_view>(idx);
-                      bool check            = !d_str.empty();  // require at least one character
-                      size_type check_count = 0;
-                      for (auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr) {
-                        auto code_point = detail::utf8_to_codepoint(*itr);
-                        // lookup flags in table by code-point
-                        auto flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
-                        if ((verify_types & flag) ||                   // should flag be verified
-                            (flag == 0 && verify_types == ALL_TYPES))  // special edge case
-                        {
-                          check = (types & flag) > 0;
-                          ++check_count;
-                        }
-                      }
-                      return check && (check_count > 0);
-                    });
+                    character_types_fn{d_column, d_flags, types, verify_types, ascii});
   //
   results->set_null_count(strings.null_count());
   return results;
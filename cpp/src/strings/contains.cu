@@ -18,19 +18,69 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
 
+/**
+ * @brief Evaluates each string with the deterministic automaton of the regex pattern.
+ *
+ * Each block copies the automaton into shared memory first.
+ * The result for each string is 1 if it matches, 0 if it does not, and -1 if it
+ * has to be evaluated with the regex instructions.
+ */
+__global__ void dfa_find_kernel(reprog_device prog,
+                                column_device_view d_strings,
+                                bool anchored,
+                                int8_t* d_found) {
+  extern __shared__ uint8_t shared_dfa[];
+  for (int32_t i = threadIdx.x; i < prog.dfa_size(); i += blockDim.x)
+    shared_dfa[i] = prog.dfa_data()[i];
+  __syncthreads();
+  prog.set_dfa_data(shared_dfa);
+
+  size_type const idx = threadIdx.x + blockIdx.x * blockDim.x;
+  if (idx >= d_strings.size()) return;
+  d_found[idx] =
+    d_strings.is_null(idx) ? 0 : prog.dfa_find(d_strings.element<string_view>(idx), anchored);
+}
+
+/**
+ * @brief Returns the result of the deterministic automaton of `d_prog` for each string,
+ * or an empty vector if the pattern has no automaton.
+ */
+rmm::device_vector<int8_t> dfa_find(reprog_device const& d_prog,
+                                    column_device_view const& d_strings,
+                                    bool anchored,
+                                    cudaStream_t stream) {
+  if (d_prog.dfa_size() == 0 || d_strings.size() == 0) return rmm::device_vector<int8_t>{};
+  rmm::device_vector<int8_t> found(d_strings.size());
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d grid{d_strings.size(), block_size};
+  dfa_find_kernel<<<grid.num_blocks, grid.num_threads_per_block, d_prog.dfa_size(), stream>>>(
+    d_prog, d_strings, anchored, found.data().get());
+  CHECK_CUDA(stream);
+  return found;
+}
+
 /**
  * @brief This functor handles both contains_re and match_re to minimize the number
  * of regex calls to find() to be inlined greatly reducing compile time.
@@ -42,15 +92,18 @@ namespace {
  * Small to medium instruction lengths can use the stack effectively though smaller executes faster.
  * Longer patterns require global memory.
  *
+ * Strings already evaluated by the deterministic automaton are not evaluated again.
  */
 template <size_t stack_size>
 struct contains_fn {
   reprog_device prog;
   column_device_view d_strings;
   bool bmatch{false};  // do not make this a template parameter to keep compile times down
+  int8_t const* d_found{};  // results of the automaton, if the pattern has one
 
   __device__ bool operator()(size_type idx) {
     if (d_strings.is_null(idx)) return 0;
+    if (d_found && d_found[idx] >= 0) return d_found[idx] > 0;
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
     string_view d_str = d_strings.element<string_view>(idx);
@@ -85,6 +138,10 @@ std::unique_ptr<column> contains_util(
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
 
+  // evaluate the strings with the automaton first, if the pattern has one
+  auto const found   = dfa_find(d_prog, d_column, beginning_only, stream);
+  auto const d_found = found.empty() ? nullptr : found.data().get();
+
   // fill the output column
   auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
@@ -93,19 +150,19 @@ std::unique_ptr<column> contains_util(
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only});
+                      contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only, d_found});
   else if (regex_insts <= RX_MEDIUM_INSTS)
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only});
+                      contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only, d_found});
   else
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only});
+                      contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only, d_found});
 
   results->set_null_count(strings.null_count());
   return results;
@@ -154,16 +211,19 @@ namespace {
 /**
  * @brief This counts the number of times the regex pattern matches in each string.
  *
+ * Strings the deterministic automaton found no match in are not evaluated again.
  */
 template <size_t stack_size>
 struct count_fn {
   reprog_device prog;
   column_device_view d_strings;
+  int8_t const* d_found{};  // results of the automaton, if the pattern has one
 
   __device__ int32_t operator()(unsigned int idx) {
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
     if (d_strings.is_null(idx)) return 0;
+    if (d_found && d_found[idx] == 0) return 0;
     string_view d_str  = d_strings.element<string_view>(idx);
     int32_t find_count = 0;
     size_type nchars   = d_str.length();
@@ -202,6 +262,10 @@ std::unique_ptr<column> count_re(
                                      mr);
   auto d_results = results->mutable_view().data<int32_t>();
 
+  // skip the strings without a match, if the pattern has an automaton
+  auto const found   = dfa_find(d_prog, d_column, false, stream);
+  auto const d_found = found.empty() ? nullptr : found.data().get();
+
   // fill the output column
   auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
@@ -210,19 +274,19 @@ std::unique_ptr<column> count_re(
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_SMALL>{d_prog, d_column});
+                      count_fn<RX_STACK_SMALL>{d_prog, d_column, d_found});
   else if (regex_insts <= RX_MEDIUM_INSTS)
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column});
+                      count_fn<RX_STACK_MEDIUM>{d_prog, d_column, d_found});
   else
     thrust::transform(execpol->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_count),
                       d_results,
-                      count_fn<RX_STACK_LARGE>{d_prog, d_column});
+                      count_fn<RX_STACK_LARGE>{d_prog, d_column, d_found});
 
   results->set_null_count(strings.null_count());
   return results;
@@ -239,5 +303,247 @@ std::unique_ptr<column> count_re(strings_column_view const& strings,
   return detail::count_re(strings, pattern, mr);
 }
 
+namespace detail {
+
+namespace {
+
+/**
+ * @brief The device programs of several regex patterns.
+ */
+struct regex_programs {
+  std::vector<std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>> h_progs;
+  rmm::device_vector<reprog_device> progs;
+  int32_t max_insts{};  // the largest number of instructions of the patterns
+};
+
+regex_programs create_programs(std::vector<std::string> const& patterns,
+                               size_type strings_count,
+                               cudaStream_t stream) {
+  regex_programs result;
+  std::vector<reprog_device> progs;
+  for (auto const& pattern : patterns) {
+    auto prog = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+    result.max_insts = std::max(result.max_insts, prog->insts_counts());
+    progs.push_back(*prog);
+    result.h_progs.emplace_back(std::move(prog));
+  }
+  result.progs = progs;
+  return result;
+}
+
+/**
+ * @brief Evaluates all the regex patterns on each string for contains_re and matches_re.
+ *
+ * Each string is read once for all the patterns. The deterministic automaton of a
+ * pattern is used first, if it has one.
+ */
+template <size_t stack_size>
+struct contains_multi_fn {
+  reprog_device const* progs;
+  size_type number_of_patterns;
+  column_device_view d_strings;
+  bool bmatch;
+  bool* const* d_results;  // one output array per pattern
+
+  __device__ void operator()(size_type idx) {
+    if (d_strings.is_null(idx)) return;
+    u_char data1[stack_size], data2[stack_size];
+    string_view d_str = d_strings.element<string_view>(idx);
+    for (size_type ptn_idx = 0; ptn_idx < number_of_patterns; ++ptn_idx) {
+      reprog_device prog = progs[ptn_idx];
+      int32_t found      = prog.dfa_size() > 0 ? prog.dfa_find(d_str, bmatch) : -1;
+      if (found < 0) {
+        prog.set_stack_mem(data1, data2);
+        int32_t begin = 0;
+        int32_t end   = bmatch ? 1 : -1;
+        found         = static_cast<bool>(prog.find(idx, d_str, begin, end));
+      }
+      d_results[ptn_idx][idx] = found > 0;
+    }
+  }
+};
+
+/**
+ * @brief Counts the matches of all the regex patterns in each string.
+ *
+ * Each string is read once for all the patterns.
+ */
+template <size_t stack_size>
+struct count_multi_fn {
+  reprog_device const* progs;
+  size_type number_of_patterns;
+  column_device_view d_strings;
+  int32_t* const* d_results;  // one output array per pattern
+
+  __device__ void operator()(size_type idx) {
+    if (d_strings.is_null(idx)) return;
+    u_char data1[stack_size], data2[stack_size];
+    string_view d_str = d_strings.element<string_view>(idx);
+    size_type nchars  = d_str.length();
+    for (size_type ptn_idx = 0; ptn_idx < number_of_patterns; ++ptn_idx) {
+      reprog_device prog = progs[ptn_idx];
+      int32_t find_count = 0;
+      if (prog.dfa_size() == 0 || prog.dfa_find(d_str, false) != 0) {
+        prog.set_stack_mem(data1, data2);
+        size_type begin = 0;
+        while (begin <= nchars) {
+          auto end = nchars;
+          if (prog.find(idx, d_str, begin, end) <= 0) break;
+          ++find_count;
+          begin = end > begin ? end : begin + 1;
+        }
+      }
+      d_results[ptn_idx][idx] = find_count;
+    }
+  }
+};
+
+/**
+ * @brief Creates one output column per pattern, with the null mask of the strings.
+ */
+template <typename T>
+std::vector<std::unique_ptr<column>> make_pattern_results(strings_column_view const& strings,
+                                                          size_type number_of_patterns,
+                                                          rmm::device_vector<T*>& d_results,
+                                                          rmm::mr::device_memory_resource* mr,
+                                                          cudaStream_t stream) {
+  std::vector<std::unique_ptr<column>> results;
+  thrust::host_vector<T*> h_results;
+  for (size_type ptn_idx = 0; ptn_idx < number_of_patterns; ++ptn_idx) {
+    results.emplace_back(make_numeric_column(data_type{experimental::type_to_id<T>()},
+                                             strings.size(),
+                                             copy_bitmask(strings.parent(), stream, mr),
+                                             strings.null_count(),
+                                             stream,
+                                             mr));
+    h_results.push_back(results.back()->mutable_view().data<T>());
+  }
+  d_results = h_results;
+  return results;
+}
+
+std::unique_ptr<experimental::table> contains_multi_util(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  bool beginning_only,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) {
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_column       = *strings_column;
+  auto programs       = create_programs(patterns, strings_count, stream);
+  auto d_progs        = programs.progs.data().get();
+  auto const count    = static_cast<size_type>(patterns.size());
+
+  rmm::device_vector<bool*> d_results;
+  auto results = make_pattern_results<bool>(strings, count, d_results, mr, stream);
+  if (strings_count == 0 || count == 0)
+    return std::make_unique<experimental::table>(std::move(results));
+  auto d_outputs = d_results.data().get();
+
+  auto execpol    = rmm::exec_policy(stream);
+  auto begin      = thrust::make_counting_iterator<size_type>(0);
+  int regex_insts = programs.max_insts;
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    thrust::for_each_n(
+      execpol->on(stream),
+      begin,
+      strings_count,
+      contains_multi_fn<RX_STACK_SMALL>{d_progs, count, d_column, beginning_only, d_outputs});
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(
+      execpol->on(stream),
+      begin,
+      strings_count,
+      contains_multi_fn<RX_STACK_MEDIUM>{d_progs, count, d_column, beginning_only, d_outputs});
+  else
+    thrust::for_each_n(
+      execpol->on(stream),
+      begin,
+      strings_count,
+      contains_multi_fn<RX_STACK_LARGE>{d_progs, count, d_column, beginning_only, d_outputs});
+  return std::make_unique<experimental::table>(std::move(results));
+}
+
+}  // namespace
+
+std::unique_ptr<experimental::table> contains_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  return contains_multi_util(strings, patterns, false, mr, stream);
+}
+
+std::unique_ptr<experimental::table> matches_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  return contains_multi_util(strings, patterns, true, mr, stream);
+}
+
+std::unique_ptr<experimental::table> count_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_column       = *strings_column;
+  auto programs       = create_programs(patterns, strings_count, stream);
+  auto d_progs        = programs.progs.data().get();
+  auto const count    = static_cast<size_type>(patterns.size());
+
+  rmm::device_vector<int32_t*> d_results;
+  auto results = make_pattern_results<int32_t>(strings, count, d_results, mr, stream);
+  if (strings_count == 0 || count == 0)
+    return std::make_unique<experimental::table>(std::move(results));
+  auto d_outputs = d_results.data().get();
+
+  auto execpol    = rmm::exec_policy(stream);
+  auto begin      = thrust::make_counting_iterator<size_type>(0);
+  int regex_insts = programs.max_insts;
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    thrust::for_each_n(execpol->on(stream),
+                       begin,
+                       strings_count,
+                       count_multi_fn<RX_STACK_SMALL>{d_progs, count, d_column, d_outputs});
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(execpol->on(stream),
+                       begin,
+                       strings_count,
+                       count_multi_fn<RX_STACK_MEDIUM>{d_progs, count, d_column, d_outputs});
+  else
+    thrust::for_each_n(execpol->on(stream),
+                       begin,
+                       strings_count,
+                       count_multi_fn<RX_STACK_LARGE>{d_progs, count, d_column, d_outputs});
+  return std::make_unique<experimental::table>(std::move(results));
+}
+
+}  // namespace detail
+
+std::unique_ptr<experimental::table> contains_re(strings_column_view const& strings,
+                                                 std::vector<std::string> const& patterns,
+                                                 rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, patterns, mr);
+}
+
+std::unique_ptr<experimental::table> matches_re(strings_column_view const& strings,
+                                                std::vector<std::string> const& patterns,
+                                                rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, patterns, mr);
+}
+
+std::unique_ptr<experimental::table> count_re(strings_column_view const& strings,
+                                              std::vector<std::string> const& patterns,
+                                              rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, patterns, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
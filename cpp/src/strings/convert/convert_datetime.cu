@@ -25,10 +25,12 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/timestamps.hpp>
+#include <strings/convert/iso8601.cuh>
 #include <strings/utilities.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace cudf {
@@ -89,6 +91,62 @@ struct alignas(4) format_item {
   }
 };
 
+// Returns whether the items from `pos` on are the specifiers and literals of
+// `pattern`, in which a '%' precedes each specifier, and moves `pos` past them
+bool match_items(std::vector<format_item> const& items, size_t& pos, char const* pattern) {
+  auto idx = pos;
+  for (; *pattern; ++pattern, ++idx) {
+    bool const specifier = *pattern == '%';
+    if (specifier) ++pattern;
+    if (idx >= items.size() || (items[idx].item_type == format_char_type::specifier) != specifier ||
+        items[idx].value != *pattern)
+      return false;
+  }
+  pos = idx;
+  return true;
+}
+
+// Returns the fixed ISO-8601 layout of the format items, if they have one
+iso8601_layout find_iso8601_layout(std::vector<format_item> const& items) {
+  size_t pos = 0;
+  if (!match_items(items, pos, "%Y-%m-%d")) return iso8601_layout::NONE;
+  if (pos == items.size()) return iso8601_layout::DATE;
+  if (!match_items(items, pos, "T") && !match_items(items, pos, " ")) return iso8601_layout::NONE;
+  if (!match_items(items, pos, "%H:%M:%S")) return iso8601_layout::NONE;
+  bool const subsecond = match_items(items, pos, ".%f");
+  bool const utc       = match_items(items, pos, "Z");
+  if (pos != items.size()) return iso8601_layout::NONE;
+  if (subsecond)
+    return utc ? iso8601_layout::DATETIME_SUBSECOND_Z : iso8601_layout::DATETIME_SUBSECOND;
+  return utc ? iso8601_layout::DATETIME_Z : iso8601_layout::DATETIME;
+}
+
+/**
+ * @brief Calls `fn` with a `std::integral_constant` of `layout`, so that `fn`
+ * can be specialized for each layout at compile time.
+ */
+template <typename Functor>
+void dispatch_iso8601_layout(iso8601_layout layout, Functor fn) {
+  switch (layout) {
+    case iso8601_layout::DATE:
+      fn(std::integral_constant<iso8601_layout, iso8601_layout::DATE>{});
+      break;
+    case iso8601_layout::DATETIME:
+      fn(std::integral_constant<iso8601_layout, iso8601_layout::DATETIME>{});
+      break;
+    case iso8601_layout::DATETIME_Z:
+      fn(std::integral_constant<iso8601_layout, iso8601_layout::DATETIME_Z>{});
+      break;
+    case iso8601_layout::DATETIME_SUBSECOND:
+      fn(std::integral_constant<iso8601_layout, iso8601_layout::DATETIME_SUBSECOND>{});
+      break;
+    case iso8601_layout::DATETIME_SUBSECOND_Z:
+      fn(std::integral_constant<iso8601_layout, iso8601_layout::DATETIME_SUBSECOND_Z>{});
+      break;
+    default: fn(std::integral_constant<iso8601_layout, iso8601_layout::NONE>{});
+  }
+}
+
 /**
  * @brief The format_compiler parses a timestamp format string into a vector of
  * format_items.
@@ -101,6 +159,8 @@ struct format_compiler {
   std::string template_string;
   timestamp_units units;
   rmm::device_vector<format_item> d_items;
+  iso8601_layout layout = iso8601_layout::NONE;
+  char separator        = 'T';  // between the date and the time of an ISO-8601 layout
 
   std::map<char, int8_t> specifier_lengths = {{'Y', 4},
                                               {'y', 2},
@@ -153,6 +213,8 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, spec_length));
       template_string.append((size_t)spec_length, ch);
     }
+    layout = find_iso8601_layout(items);
+    if (has_time(layout)) separator = items[5].value;
     // create program in device memory
     d_items.resize(items.size());
     CUDA_TRY(cudaMemcpyAsync(
@@ -166,8 +228,10 @@ struct format_compiler {
   int8_t subsecond_precision() const { return specifier_lengths.at('f'); }
 };
 
-// this parses date/time characters into a timestamp integer
-template <typename T>  // timestamp type
+// this parses date/time characters into a timestamp integer;
+// formats with a fixed ISO-8601 layout are parsed without walking the format_items
+template <typename T,  // timestamp type
+          iso8601_layout layout = iso8601_layout::NONE>
 struct parse_datetime {
   column_device_view const d_strings;
   format_item const* d_format_items;
@@ -242,6 +306,21 @@ struct parse_datetime {
     return 0;
   }
 
+  // Read the fields of the fixed layout at their offsets.
+  // Returns 0 if all ok.
+  __device__ int parse_iso8601_into_parts(string_view const& d_string, int32_t* timeparts) {
+    if (d_string.size_bytes() < iso8601_bytes(layout, subsecond_precision)) return 1;
+    auto const fields = parse_iso8601<layout>(d_string.data(), subsecond_precision);
+    timeparts[TP_YEAR]      = fields.year;
+    timeparts[TP_MONTH]     = fields.month;
+    timeparts[TP_DAY]       = fields.day;
+    timeparts[TP_HOUR]      = fields.hour;
+    timeparts[TP_MINUTE]    = fields.minute;
+    timeparts[TP_SECOND]    = fields.second;
+    timeparts[TP_SUBSECOND] = fields.subsecond;
+    return 0;
+  }
+
   __device__ int64_t timestamp_from_parts(int32_t const* timeparts, timestamp_units units) {
     auto year = timeparts[TP_YEAR];
     if (units == timestamp_units::years) return year - 1970;
@@ -297,8 +376,10 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return 0;
     //
-    int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};       // month and day are 1-based
-    if (parse_into_parts(d_str, timeparts)) return 0;  // unexpected parse case
+    int32_t timeparts[TP_ARRAYSIZE] = {0, 1, 1};  // month and day are 1-based
+    auto const error = layout == iso8601_layout::NONE ? parse_into_parts(d_str, timeparts)
+                                                      : parse_iso8601_into_parts(d_str, timeparts);
+    if (error) return 0;  // unexpected parse case
     //
     return static_cast<T>(timestamp_from_parts(timeparts, units));
   }
@@ -344,13 +425,16 @@ struct dispatch_to_timestamps_fn {
     format_compiler compiler(format.c_str(), units);
     auto d_items   = compiler.compile_to_device();
     auto d_results = results_view.data<T>();
-    parse_datetime<T> pfn{
-      d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
-    thrust::transform(rmm::exec_policy(stream)->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(results_view.size()),
-                      d_results,
-                      pfn);
+    auto size      = results_view.size();
+    dispatch_iso8601_layout(compiler.layout, [&](auto layout) {
+      parse_datetime<T, decltype(layout)::value> pfn{
+        d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(size),
+                        d_results,
+                        pfn);
+    });
   }
   template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const&,
@@ -408,8 +492,9 @@ std::unique_ptr<cudf::column> to_timestamps(strings_column_view const& strings,
 
 namespace detail {
 namespace {
-// converts a timestamp into date-time string
-template <typename T>
+// converts a timestamp into date-time string;
+// formats with a fixed ISO-8601 layout are written without walking the format_items
+template <typename T, iso8601_layout layout = iso8601_layout::NONE>
 struct datetime_formatter {
   const column_device_view d_timestamps;
   const format_item* d_format_items;
@@ -417,6 +502,8 @@ struct datetime_formatter {
   timestamp_units units;
   const int32_t* d_offsets;
   char* d_chars;
+  char separator;              // between the date and the time of the layout
+  int8_t subsecond_precision;  // digits of the subsecond field of the layout
 
   // divide timestamp integer into time components (year, month, day, etc)
   // TODO call the simt::std::chrono methods here instead when the are ready
@@ -571,6 +658,41 @@ struct datetime_formatter {
     return str;
   }
 
+  __device__ char* format_subsecond(char* ptr, int8_t length, int32_t subsecond) {
+    char subsecond_digits[] = "000000000";  // 9 max digits
+    const int digits        = [units = units] {
+      if (units == timestamp_units::ms) return 3;
+      if (units == timestamp_units::us) return 6;
+      if (units == timestamp_units::ns) return 9;
+      return 0;
+    }();
+    int2str(subsecond_digits, digits, subsecond);
+    return copy_and_increment(ptr, subsecond_digits, length);
+  }
+
+  // write the fields of the fixed layout in order
+  __device__ char* format_iso8601(int32_t const* timeparts, char* ptr) {
+    ptr    = int2str(ptr, 4, timeparts[TP_YEAR]);
+    *ptr++ = '-';
+    ptr    = int2str(ptr, 2, timeparts[TP_MONTH]);
+    *ptr++ = '-';
+    ptr    = int2str(ptr, 2, timeparts[TP_DAY]);
+    if (has_time(layout)) {
+      *ptr++ = separator;
+      ptr    = int2str(ptr, 2, timeparts[TP_HOUR]);
+      *ptr++ = ':';
+      ptr    = int2str(ptr, 2, timeparts[TP_MINUTE]);
+      *ptr++ = ':';
+      ptr    = int2str(ptr, 2, timeparts[TP_SECOND]);
+    }
+    if (has_subsecond(layout)) {
+      *ptr++ = '.';
+      ptr    = format_subsecond(ptr, subsecond_precision, timeparts[TP_SUBSECOND]);
+    }
+    if (has_utc_designator(layout)) *ptr++ = 'Z';
+    return ptr;
+  }
+
   __device__ char* format_from_parts(int32_t const* timeparts, char* ptr) {
     for (size_t idx = 0; idx < items_count; ++idx) {
       auto item = d_format_items[idx];
@@ -614,18 +736,8 @@ struct datetime_formatter {
           ptr = int2str(ptr, item.length, timeparts[TP_SECOND]);
           break;
         case 'f':  // sub-second
-        {
-          char subsecond_digits[] = "000000000";  // 9 max digits
-          const int digits        = [units = units] {
-            if (units == timestamp_units::ms) return 3;
-            if (units == timestamp_units::us) return 6;
-            if (units == timestamp_units::ns) return 9;
-            return 0;
-          }();
-          int2str(subsecond_digits, digits, timeparts[TP_SUBSECOND]);
-          ptr = copy_and_increment(ptr, subsecond_digits, item.length);
+          ptr = format_subsecond(ptr, item.length, timeparts[TP_SUBSECOND]);
           break;
-        }
         case 'p':  // am or pm
           // 0 = 12am, 12 = 12pm
           if (timeparts[TP_HOUR] < 12)
@@ -655,7 +767,10 @@ struct datetime_formatter {
     int32_t timeparts[TP_ARRAYSIZE] = {0};
     dissect_timestamp(timestamp.time_since_epoch().count(), timeparts);
     // convert to characters
-    format_from_parts(timeparts, d_chars + d_offsets[idx]);
+    if (layout == iso8601_layout::NONE)
+      format_from_parts(timeparts, d_chars + d_offsets[idx]);
+    else
+      format_iso8601(timeparts, d_chars + d_offsets[idx]);
   }
 };
 
@@ -663,22 +778,31 @@ struct datetime_formatter {
 struct dispatch_from_timestamps_fn {
   template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const& d_timestamps,
+                  format_compiler const& compiler,
                   format_item const* d_format_items,
-                  size_type items_count,
                   timestamp_units units,
                   const int32_t* d_offsets,
                   char* d_chars,
                   cudaStream_t stream) const {
-    datetime_formatter<T> pfn{d_timestamps, d_format_items, items_count, units, d_offsets, d_chars};
-    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                       thrust::make_counting_iterator<cudf::size_type>(0),
-                       d_timestamps.size(),
-                       pfn);
+    dispatch_iso8601_layout(compiler.layout, [&](auto layout) {
+      datetime_formatter<T, decltype(layout)::value> pfn{d_timestamps,
+                                                          d_format_items,
+                                                          compiler.items_count(),
+                                                          units,
+                                                          d_offsets,
+                                                          d_chars,
+                                                          compiler.separator,
+                                                          compiler.subsecond_precision()};
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<cudf::size_type>(0),
+                         d_timestamps.size(),
+                         pfn);
+    });
   }
   template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const&,
+                  format_compiler const&,
                   format_item const*,
-                  size_type,
                   timestamp_units,
                   const int32_t*,
                   char* d_chars,
@@ -735,8 +859,8 @@ std::unique_ptr<column> from_timestamps(
   cudf::experimental::type_dispatcher(timestamps.type(),
                                       dispatch_from_timestamps_fn(),
                                       d_column,
+                                      compiler,
                                       d_format_items,
-                                      compiler.items_count(),
                                       units,
                                       d_new_offsets,
                                       d_chars,
@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <strings/convert/float_conversion_tables.cuh>
+
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @file float_conversion.cuh
+ * @brief Correctly rounded conversions between decimal numbers and floats
+ *
+ * Decimal numbers are converted to the nearest float with the Eisel-Lemire
+ * algorithm, and floats to their shortest decimal representation that reads
+ * back to the same float with the Schubfach algorithm. Both only use 64-bit
+ * integer arithmetic and the 128-bit tables of float_conversion_tables.cuh.
+ */
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Parameters of the IEEE-754 binary formats of `float` and `double`
+ */
+template <typename T>
+struct binary_format;
+
+template <>
+struct binary_format<double> {
+  using bits_type                           = uint64_t;
+  static constexpr int32_t mantissa_bits    = 52;
+  static constexpr int32_t minimum_exponent = -1023;
+  static constexpr int32_t infinite_power   = 0x7FF;
+  static constexpr int32_t exponent_bias    = 1023 + 52;  // of the integer significand
+  // Range of the decimal exponents for which a product can be exactly halfway
+  static constexpr int32_t min_round_to_even = -4;
+  static constexpr int32_t max_round_to_even = 23;
+  // Decimal exponents beyond which every significand rounds to 0 or infinity
+  static constexpr int32_t smallest_power = -342;
+  static constexpr int32_t largest_power  = 308;
+};
+
+template <>
+struct binary_format<float> {
+  using bits_type                            = uint32_t;
+  static constexpr int32_t mantissa_bits     = 23;
+  static constexpr int32_t minimum_exponent  = -127;
+  static constexpr int32_t infinite_power    = 0xFF;
+  static constexpr int32_t exponent_bias     = 127 + 23;
+  static constexpr int32_t min_round_to_even = -17;
+  static constexpr int32_t max_round_to_even = 10;
+  static constexpr int32_t smallest_power    = -65;
+  static constexpr int32_t largest_power     = 38;
+};
+
+struct uint128_parts {
+  uint64_t high;
+  uint64_t low;
+};
+
+CUDA_HOST_DEVICE_CALLABLE uint128_parts multiply_64x64(uint64_t a, uint64_t b) {
+#ifdef __CUDA_ARCH__
+  return {__umul64hi(a, b), a * b};
+#else
+  auto const product = static_cast<unsigned __int128>(a) * b;
+  return {static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product)};
+#endif
+}
+
+CUDA_HOST_DEVICE_CALLABLE int32_t count_leading_zeros(uint64_t value) {
+#ifdef __CUDA_ARCH__
+  return __clzll(value);
+#else
+  return __builtin_clzll(value);
+#endif
+}
+
+template <typename T>
+CUDA_HOST_DEVICE_CALLABLE T float_from_bits(typename binary_format<T>::bits_type bits) {
+  T value;
+  memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
+template <typename T>
+CUDA_HOST_DEVICE_CALLABLE typename binary_format<T>::bits_type float_to_bits(T value) {
+  typename binary_format<T>::bits_type bits;
+  memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+/**
+ * @brief Computes the float nearest to `w * 10^q` with the Eisel-Lemire
+ * algorithm
+ *
+ * @param w Decimal significand
+ * @param q Decimal exponent
+ * @param[out] value The nearest float, ties to even
+ * @return false if the 128-bit approximation of `5^q` cannot decide the
+ * rounding, in which case `value` is not set
+ */
+template <typename T>
+CUDA_DEVICE_CALLABLE bool eisel_lemire(uint64_t w, int32_t q, T& value) {
+  using format = binary_format<T>;
+  if (w == 0 || q < format::smallest_power) {
+    value = T{0};
+    return true;
+  }
+  if (q > format::largest_power) {
+    value = std::numeric_limits<T>::infinity();
+    return true;
+  }
+  int32_t const lz = count_leading_zeros(w);
+  w <<= lz;
+
+  // The low word of 5^q is only needed when the bits below the rounding bit are
+  // all ones, where a carry from the lower bits would change the result
+  int32_t const index = 2 * (q - smallest_power_of_five);
+  auto product        = multiply_64x64(w, powers_of_five_128[index]);
+  constexpr uint64_t precision_mask = ~uint64_t{0} >> (format::mantissa_bits + 3);
+  if ((product.high & precision_mask) == precision_mask) {
+    auto const second = multiply_64x64(w, powers_of_five_128[index + 1]);
+    product.low += second.high;
+    if (second.high > product.low) ++product.high;
+  }
+  // 5^q is exact in the table for q in [-27, 55]; elsewhere the truncated low
+  // bits could still carry
+  if (product.low == ~uint64_t{0} && (q < -27 || q > 55)) return false;
+
+  int32_t const upperbit = static_cast<int32_t>(product.high >> 63);
+  int32_t const shift    = upperbit + 64 - format::mantissa_bits - 3;
+  uint64_t mantissa      = product.high >> shift;
+  // floor(log2(10^q)) + 63 + the normalization of the product
+  int32_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz - format::minimum_exponent;
+
+  if (power2 <= 0) {  // subnormal
+    if (-power2 + 1 >= 64) {
+      value = T{0};
+      return true;
+    }
+    mantissa >>= -power2 + 1;
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    // rounding up may reach the smallest normal float
+    power2 = (mantissa < (uint64_t{1} << format::mantissa_bits)) ? 0 : 1;
+  } else {
+    // round up, unless the product is exactly halfway and the mantissa is even
+    if (product.low <= 1 && q >= format::min_round_to_even && q <= format::max_round_to_even &&
+        (mantissa & 3) == 1 && (mantissa << shift) == product.high) {
+      mantissa &= ~uint64_t{1};
+    }
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= (uint64_t{2} << format::mantissa_bits)) {
+      mantissa = uint64_t{1} << format::mantissa_bits;
+      ++power2;
+    }
+    mantissa &= ~(uint64_t{1} << format::mantissa_bits);
+    if (power2 >= format::infinite_power) {
+      value = std::numeric_limits<T>::infinity();
+      return true;
+    }
+  }
+  using bits_type = typename format::bits_type;
+  value           = float_from_bits<T>(static_cast<bits_type>(mantissa) |
+                             (static_cast<bits_type>(power2) << format::mantissa_bits));
+  return true;
+}
+
+/**
+ * @brief A decimal number being read digit by digit, holding up to 19
+ * significant digits
+ */
+struct decimal_number {
+  uint64_t significand = 0;  ///< The significant digits
+  int32_t exponent     = 0;  ///< The number is `significand * 10^exponent`
+  int32_t digits       = 0;  ///< Number of digits of `significand`
+  bool negative        = false;
+  bool truncated       = false;  ///< Whether nonzero digits were dropped from `significand`
+
+  static constexpr int32_t max_digits = 19;
+
+  /**
+   * @brief Appends a digit of the integer or of the fractional part
+   */
+  CUDA_HOST_DEVICE_CALLABLE void append_digit(uint32_t digit, bool fractional) {
+    if (digits < max_digits) {
+      significand = significand * 10 + digit;
+      digits += (significand != 0);  // leading zeros are not significant
+      exponent -= fractional;
+    } else {
+      truncated |= (digit != 0);
+      exponent += !fractional;
+    }
+  }
+
+  /**
+   * @brief Adds the exponent of a scientific notation number
+   */
+  CUDA_HOST_DEVICE_CALLABLE void add_exponent(int32_t exp10) { exponent += exp10; }
+
+  /**
+   * @brief Returns the float nearest to the number
+   *
+   * The rounding is correct unless the number was truncated and is too close
+   * to halfway between two floats, or the Eisel-Lemire algorithm cannot decide
+   * it, which are both rare; the number is then scaled by a power of ten in
+   * double precision.
+   */
+  template <typename T>
+  CUDA_DEVICE_CALLABLE T to_float() const {
+    T value{0};
+    bool exact = eisel_lemire(significand, exponent, value);
+    if (exact && truncated) {
+      // the dropped digits may only round up to the next significand
+      T upper{0};
+      exact = eisel_lemire(significand + 1, exponent, upper) && upper == value;
+    }
+    if (!exact) {
+      double scaled = static_cast<double>(significand);
+      scaled = exponent < 0 ? scaled / exp10(static_cast<double>(-exponent))
+                            : scaled * exp10(static_cast<double>(exponent));
+      value  = static_cast<T>(scaled);
+    }
+    return negative ? -value : value;
+  }
+};
+
+/**
+ * @brief The shortest decimal representation of a float,
+ * `digits * 10^exponent`
+ */
+struct shortest_decimal {
+  uint64_t digits;   ///< Significant digits, without trailing zeros
+  int32_t exponent;  ///< Decimal exponent of the last digit
+};
+
+CUDA_HOST_DEVICE_CALLABLE int32_t floor_log2_pow10(int32_t e) { return (e * 1741647) >> 19; }
+
+CUDA_HOST_DEVICE_CALLABLE int32_t floor_log10_pow2(int32_t e) { return (e * 1262611) >> 22; }
+
+CUDA_HOST_DEVICE_CALLABLE int32_t floor_log10_three_quarters_pow2(int32_t e) {
+  return (e * 1262611 - 524031) >> 22;
+}
+
+// Returns the high 64 bits of the 192-bit product, rounded to odd
+CUDA_HOST_DEVICE_CALLABLE uint64_t round_to_odd(uint64_t g_high, uint64_t g_low, uint64_t cp) {
+  auto const x = multiply_64x64(g_low, cp);
+  auto y       = multiply_64x64(g_high, cp);
+  y.low += x.high;
+  y.high += (y.low < x.high);
+  return y.high | (y.low > 1);
+}
+
+// Returns the high 32 bits of the 96-bit product, rounded to odd
+CUDA_HOST_DEVICE_CALLABLE uint32_t round_to_odd(uint64_t g, uint32_t cp) {
+  uint64_t const b01  = uint64_t{cp} * (g & 0xFFFFFFFF);
+  uint64_t const b11  = uint64_t{cp} * (g >> 32);
+  uint64_t const high = b11 + (b01 >> 32);
+  return static_cast<uint32_t>(high >> 32) | (static_cast<uint32_t>(high) > 1);
+}
+
+/**
+ * @brief Computes the shortest decimal representation that converts back to a
+ * float with the Schubfach algorithm
+ *
+ * Of the shortest representations, the one nearest to the float is returned.
+ *
+ * @param value A finite float greater than 0
+ */
+template <typename T>
+CUDA_DEVICE_CALLABLE shortest_decimal to_shortest_decimal(T value) {
+  using format                    = binary_format<T>;
+  auto const bits                 = float_to_bits(value);
+  uint64_t const ieee_significand = bits & ((uint64_t{1} << format::mantissa_bits) - 1);
+  int32_t const ieee_exponent =
+    static_cast<int32_t>(bits >> format::mantissa_bits) & format::infinite_power;
+
+  // value = c * 2^q
+  uint64_t c;
+  int32_t q;
+  shortest_decimal result{0, 0};
+  if (ieee_exponent != 0) {
+    c = (uint64_t{1} << format::mantissa_bits) | ieee_significand;
+    q = ieee_exponent - format::exponent_bias;
+    // small integers are their own shortest representation
+    if (0 <= -q && -q <= format::mantissa_bits && ((c >> -q) << -q) == c) {
+      result = {c >> -q, 0};
+    }
+  } else {
+    c = ieee_significand;
+    q = 1 - format::exponent_bias;
+  }
+
+  if (result.digits == 0) {
+    // The rounding interval of the float is [cbl, cbr] * 2^(q-2), narrower
+    // below at the powers of two, and open if c is odd
+    bool const is_even                  = (c % 2 == 0);
+    bool const lower_boundary_is_closer = (ieee_significand == 0 && ieee_exponent > 1);
+    uint64_t const cbl                  = 4 * c - 2 + lower_boundary_is_closer;
+    uint64_t const cb                   = 4 * c;
+    uint64_t const cbr                  = 4 * c + 2;
+
+    // 10^k is the largest power of ten in the interval, scaled by 10^-k
+    int32_t const k = lower_boundary_is_closer ? floor_log10_three_quarters_pow2(q)
+                                               : floor_log10_pow2(q);
+    int32_t const h = q + floor_log2_pow10(-k) + 1;
+
+    int32_t const index   = 2 * (-k - smallest_power_of_ten);
+    uint64_t const g_high = powers_of_ten_128[index];
+    uint64_t const g_low  = powers_of_ten_128[index + 1];
+    auto scale            = [g_high, g_low](uint64_t cp) -> uint64_t {
+      return std::is_same<T, double>::value
+               ? round_to_odd(g_high, g_low, cp)
+               : round_to_odd(g_high + (g_low != 0), static_cast<uint32_t>(cp));
+    };
+    uint64_t const vbl   = scale(cbl << h);
+    uint64_t const vb    = scale(cb << h);
+    uint64_t const vbr   = scale(cbr << h);
+    uint64_t const lower = vbl + !is_even;
+    uint64_t const upper = vbr - !is_even;
+
+    // One of the two candidates with one digit fewer than s may be inside
+    uint64_t const s = vb / 4;
+    bool found       = false;
+    if (s >= 10) {
+      uint64_t const sp    = s / 10;
+      bool const up_inside = lower <= 40 * sp;
+      bool const wp_inside = 40 * sp + 40 <= upper;
+      if (up_inside != wp_inside) {
+        result = {sp + wp_inside, k + 1};
+        found  = true;
+      }
+    }
+    if (!found) {
+      bool const u_inside = lower <= 4 * s;
+      bool const w_inside = 4 * s + 4 <= upper;
+      if (u_inside != w_inside) {
+        result = {s + w_inside, k};
+      } else {
+        // both are inside: the nearest to the float, ties to even
+        uint64_t const mid  = 4 * s + 2;
+        bool const round_up = vb > mid || (vb == mid && (s & 1) != 0);
+        result              = {s + round_up, k};
+      }
+    }
+  }
+
+  while (result.digits % 10 == 0) {
+    result.digits /= 10;
+    ++result.exponent;
+  }
+  return result;
+}
+
+/**
+ * @brief Code logic for converting float value into a string.
+ *
+ * The shortest decimal digits that convert back to the same float are used
+ * to fill an existing output char array.
+ */
+struct ftos_converter {
+  // Range of numbers here is for choosing the notation.
+  // If the value is above or below the following limits, the output is converted to
+  // scientific notation.
+  static constexpr double upper_limit = 1000000000;  // max is 1x10^9
+  static constexpr double lower_limit = 0.0001;      // printf uses scientific notation below this
+  // Output need not be more than 17 digits + 7 bytes:
+  // 7 = 1 sign, 1 decimal point, 1 exponent ('e'), 1 exponent-sign, 3 digits for exponent
+  // or the sign, the leading "0.000" and the decimal point of the fixed notation
+  static constexpr int max_bytes = 32;
+
+  // utility for quickly converting known integer range to character array
+  __device__ char* int2str(uint64_t value, char* output) {
+    if (value == 0) {
+      *output++ = '0';
+      return output;
+    }
+    char buffer[20];  // big-enough for any 64-bit value
+    char* ptr = buffer;
+    while (value > 0) {
+      *ptr++ = (char)('0' + (value % 10));
+      value /= 10;
+    }
+    while (ptr != buffer) *output++ = *--ptr;  // 54321 -> 12345
+    return output;
+  }
+
+  /**
+   * @brief Main kernel method for converting float value to char output array.
+   *
+   * Output need not be more than `max_bytes` bytes.
+   *
+   * @param value Float value to convert.
+   * @param output Memory to write output characters.
+   * @return Number of bytes written.
+   */
+  template <typename FloatType>
+  __device__ int float_to_string(FloatType value, char* output) {
+    // check for valid value
+    if (std::isnan(value)) {
+      memcpy(output, "NaN", 3);
+      return 3;
+    }
+    bool bneg = false;
+    if (value < 0) {
+      value = -value;
+      bneg  = true;
+    }
+    if (std::isinf(value)) {
+      if (bneg)
+        memcpy(output, "-Inf", 4);
+      else
+        memcpy(output, "Inf", 3);
+      return bneg ? 4 : 3;
+    }
+    char* ptr = output;
+    if (bneg) *ptr++ = '-';
+    if (value == 0) {
+      memcpy(ptr, "0.0", 3);
+      return (int)(ptr - output) + 3;
+    }
+
+    // the value is `digits * 10^exponent`
+    auto const decimal = to_shortest_decimal(value);
+    char digits[20];
+    int const num_digits = (int)(int2str(decimal.digits, digits) - digits);
+    // exponent of the first digit
+    int exp10 = decimal.exponent + num_digits - 1;
+
+    if ((static_cast<double>(value) >= lower_limit) &&
+        (static_cast<double>(value) <= upper_limit)) {
+      // fixed notation: always include at least .0
+      if (exp10 < 0) {
+        memcpy(ptr, "0.", 2);
+        ptr += 2;
+        for (int idx = exp10 + 1; idx < 0; ++idx) *ptr++ = '0';
+        memcpy(ptr, digits, num_digits);
+        return (int)(ptr - output) + num_digits;
+      }
+      int const integer_digits = exp10 + 1;
+      for (int idx = 0; idx < integer_digits; ++idx)
+        *ptr++ = idx < num_digits ? digits[idx] : '0';
+      *ptr++ = '.';
+      if (integer_digits >= num_digits) {
+        *ptr++ = '0';
+      } else {
+        memcpy(ptr, digits + integer_digits, num_digits - integer_digits);
+        ptr += num_digits - integer_digits;
+      }
+      return (int)(ptr - output);
+    }
+
+    // scientific notation: d.ddde±xx
+    *ptr++ = digits[0];
+    *ptr++ = '.';
+    if (num_digits > 1) {
+      memcpy(ptr, digits + 1, num_digits - 1);
+      ptr += num_digits - 1;
+    } else
+      *ptr++ = '0';  // always include at least .0
+    *ptr++ = 'e';
+    if (exp10 < 0) {
+      *ptr++ = '-';
+      exp10  = -exp10;
+    } else
+      *ptr++ = '+';
+    if (exp10 < 10) *ptr++ = '0';  // extra zero-pad
+    ptr = int2str(exp10, ptr);
+    // done
+    return (int)(ptr - output);  // number of bytes written
+  }
+
+  /**
+   * @brief Compute how man bytes are needed to hold the output string.
+   *
+   * @param value Float value to convert.
+   * @return Number of bytes required.
+   */
+  template <typename FloatType>
+  __device__ int compute_ftos_size(FloatType value) {
+    char buffer[max_bytes];
+    return float_to_string(value, buffer);
+  }
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
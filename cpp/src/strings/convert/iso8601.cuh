@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief The ISO-8601 layouts whose fields are at fixed offsets, which are
+ * parsed and formatted without interpreting a format
+ *
+ * The date and the time are separated by a 'T' or by a space.
+ */
+enum class iso8601_layout : int8_t {
+  NONE,                  ///< None of the layouts below
+  DATE,                  ///< "%Y-%m-%d"
+  DATETIME,              ///< "%Y-%m-%dT%H:%M:%S"
+  DATETIME_Z,            ///< "%Y-%m-%dT%H:%M:%SZ"
+  DATETIME_SUBSECOND,    ///< "%Y-%m-%dT%H:%M:%S.%f"
+  DATETIME_SUBSECOND_Z,  ///< "%Y-%m-%dT%H:%M:%S.%fZ"
+};
+
+constexpr bool has_time(iso8601_layout layout) {
+  return layout != iso8601_layout::NONE and layout != iso8601_layout::DATE;
+}
+
+constexpr bool has_subsecond(iso8601_layout layout) {
+  return layout == iso8601_layout::DATETIME_SUBSECOND or
+         layout == iso8601_layout::DATETIME_SUBSECOND_Z;
+}
+
+constexpr bool has_utc_designator(iso8601_layout layout) {
+  return layout == iso8601_layout::DATETIME_Z or layout == iso8601_layout::DATETIME_SUBSECOND_Z;
+}
+
+/**
+ * @brief Returns the number of bytes of the timestamps of a layout
+ *
+ * @param subsecond_digits Number of digits of the subsecond field
+ */
+constexpr size_type iso8601_bytes(iso8601_layout layout, size_type subsecond_digits) {
+  return has_time(layout) ? 19 + (has_subsecond(layout) ? 1 + subsecond_digits : 0) +
+                              (has_utc_designator(layout) ? 1 : 0)
+                          : 10;
+}
+
+/**
+ * @brief Fields of an ISO-8601 timestamp
+ */
+struct iso8601_fields {
+  int32_t year      = 0;
+  int32_t month     = 1;
+  int32_t day       = 1;
+  int32_t hour      = 0;
+  int32_t minute    = 0;
+  int32_t second    = 0;
+  int32_t subsecond = 0;
+};
+
+/**
+ * @brief Returns the value of the decimal digits of `str`, ending at the first
+ * non-digit or after `bytes` characters
+ */
+CUDA_DEVICE_CALLABLE int32_t parse_iso8601_digits(char const* str, size_type bytes) {
+  int32_t value = 0;
+  for (size_type idx = 0; idx < bytes; ++idx) {
+    char const chr = str[idx];
+    if (chr < '0' || chr > '9') break;
+    value = (value * 10) + static_cast<int32_t>(chr - '0');
+  }
+  return value;
+}
+
+/**
+ * @brief Parses the fields of a timestamp of `layout`, which must be at least
+ * `iso8601_bytes(layout, subsecond_digits)` long
+ *
+ * The separators are not checked; as when the format is interpreted, each
+ * field ends at its first non-digit.
+ *
+ * @param str The timestamp
+ * @param subsecond_digits Number of digits of the subsecond field
+ */
+template <iso8601_layout layout>
+CUDA_DEVICE_CALLABLE iso8601_fields parse_iso8601(char const* str, size_type subsecond_digits) {
+  iso8601_fields fields;
+  fields.year  = parse_iso8601_digits(str, 4);
+  fields.month = parse_iso8601_digits(str + 5, 2);
+  fields.day   = parse_iso8601_digits(str + 8, 2);
+  if (has_time(layout)) {
+    fields.hour   = parse_iso8601_digits(str + 11, 2);
+    fields.minute = parse_iso8601_digits(str + 14, 2);
+    fields.second = parse_iso8601_digits(str + 17, 2);
+  }
+  if (has_subsecond(layout)) {
+    fields.subsecond = parse_iso8601_digits(str + 20, subsecond_digits);
+  }
+  return fields;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -23,7 +23,9 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/utilities.cuh>
 
+#include <thrust/equal.h>
 #include <thrust/transform.h>
 
 namespace cudf {
@@ -152,6 +154,18 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
 namespace detail {
 namespace {
 
+/**
+ * @brief Returns the results for an empty target: true for each non-null string.
+ */
+std::unique_ptr<column> empty_target_results(strings_column_view const& strings,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream) {
+  auto true_scalar = make_fixed_width_scalar<bool>(true, stream, mr);
+  auto results     = make_column_from_scalar(*true_scalar, strings.size(), mr, stream);
+  results->set_null_mask(copy_bitmask(strings.parent(), stream, mr), strings.null_count());
+  return results;
+}
+
 /**
  * @brief Utility to return a bool column indicating the presence of
  * a given target string in a strings column.
@@ -178,12 +192,7 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
 
   CUDF_EXPECTS(target.is_valid(), "Parameter target must be valid.");
   if (target.size() == 0)  // empty target string returns true
-  {
-    auto true_scalar = make_fixed_width_scalar<bool>(true, stream, mr);
-    auto results     = make_column_from_scalar(*true_scalar, strings.size(), mr, stream);
-    results->set_null_mask(copy_bitmask(strings.parent(), stream, mr), strings.null_count());
-    return results;
-  }
+    return empty_target_results(strings, mr, stream);
 
   auto d_target       = string_view(target.data(), target.size());
   auto strings_column = column_device_view::create(strings.parent(), stream);
@@ -212,6 +221,35 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
   return results;
 }
 
+/**
+ * @brief Sets whether the target is found in each string.
+ *
+ * The lanes processing a string check consecutive byte positions, so a long
+ * string is searched by a whole warp. UTF-8 is self-synchronizing, so matching
+ * the bytes of the target matches its characters.
+ */
+struct contains_target_fn {
+  column_device_view const d_strings;
+  string_view const d_target;
+  bool* d_results;
+
+  __device__ void operator()(size_type idx, string_lanes const& lanes) const {
+    bool found = false;
+    if (!d_strings.is_null(idx)) {
+      string_view d_str = d_strings.element<string_view>(idx);
+      auto const bytes  = d_target.size_bytes();
+      auto const last   = d_str.size_bytes() - bytes;  // last position the target fits at
+      for (size_type begin = 0; !found && (begin <= last); begin += lanes.lanes) {
+        auto const pos = begin + lanes.lane;
+        found          = lanes.any(
+          (pos <= last) &&
+          thrust::equal(thrust::seq, d_target.data(), d_target.data() + bytes, d_str.data() + pos));
+      }
+    }
+    if (lanes.lane == 0) d_results[idx] = found;
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> contains(
@@ -219,10 +257,25 @@ std::unique_ptr<column> contains(
   string_scalar const& target,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0) {
-  auto pfn = [] __device__(string_view d_string, string_view d_target) {
-    return d_string.find(d_target) >= 0;
-  };
-  return contains_fn(strings, target, pfn, mr, stream);
+  auto strings_count = strings.size();
+  if (strings_count == 0) return make_numeric_column(data_type{BOOL8}, 0);
+  CUDF_EXPECTS(target.is_valid(), "Parameter target must be valid.");
+  if (target.size() == 0) return empty_target_results(strings, mr, stream);
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto results        = make_numeric_column(data_type{BOOL8},
+                                     strings_count,
+                                     copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  for_each_string(strings,
+                  contains_target_fn{*strings_column,
+                                     string_view(target.data(), target.size()),
+                                     results->mutable_view().data<bool>()},
+                  stream);
+  results->set_null_count(strings.null_count());
+  return results;
 }
 
 std::unique_ptr<column> starts_with(
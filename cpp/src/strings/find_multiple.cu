@@ -17,13 +17,20 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <queue>
+#include <type_traits>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -66,6 +73,201 @@ std::unique_ptr<column> find_multiple(
   return results;
 }
 
+namespace {
+
+/**
+ * @brief Aho-Corasick automaton finding all the occurrences of a set of
+ * target strings in a single pass over a string.
+ *
+ * The bytes of a string are mapped to symbols: each byte found in the targets
+ * has its own symbol and all the other bytes map to symbol 0. The transitions
+ * of each state already follow the failure links, so each byte of a string
+ * is evaluated with a single table lookup.
+ */
+struct aho_corasick {
+  std::vector<int32_t> byte_symbols;   // symbol of each byte value
+  int32_t symbols_count{1};            // includes the symbol of bytes not in any target
+  std::vector<int32_t> transitions;    // next state for each state and symbol
+  std::vector<int32_t> match_lengths;  // longest target ending in each state; -1 for none
+  int32_t max_length{0};               // longest target in bytes
+
+  /**
+   * @brief Builds the automaton of the targets given by their host chars and offsets.
+   */
+  aho_corasick(std::vector<char> const& chars, std::vector<int32_t> const& offsets)
+    : byte_symbols(256, 0) {
+    for (auto const ch : chars) {
+      auto& symbol = byte_symbols[static_cast<uint8_t>(ch)];
+      if (symbol == 0) symbol = symbols_count++;
+    }
+    // build the trie; missing transitions are -1
+    auto const add_state = [this] {
+      transitions.insert(transitions.end(), symbols_count, -1);
+      match_lengths.push_back(-1);
+      return static_cast<int32_t>(match_lengths.size() - 1);
+    };
+    add_state();
+    for (size_t idx = 0; idx + 1 < offsets.size(); ++idx) {
+      int32_t state = 0;
+      for (auto pos = offsets[idx]; pos < offsets[idx + 1]; ++pos) {
+        auto const symbol = byte_symbols[static_cast<uint8_t>(chars[pos - offsets.front()])];
+        auto next         = transitions[state * symbols_count + symbol];
+        if (next < 0) {
+          next                                        = add_state();
+          transitions[state * symbols_count + symbol] = next;
+        }
+        state = next;
+      }
+      auto const length    = offsets[idx + 1] - offsets[idx];
+      match_lengths[state] = std::max(match_lengths[state], length);
+      max_length           = std::max(max_length, length);
+    }
+    // resolve the failure links in breadth-first order
+    std::vector<int32_t> failures(match_lengths.size(), 0);
+    std::queue<int32_t> states;
+    states.push(0);
+    while (!states.empty()) {
+      auto const state = states.front();
+      states.pop();
+      for (int32_t symbol = 0; symbol < symbols_count; ++symbol) {
+        auto& next = transitions[state * symbols_count + symbol];
+        auto const fallback =
+          state == 0 ? 0 : transitions[failures[state] * symbols_count + symbol];
+        if (next < 0) {
+          next = fallback;
+        } else {
+          failures[next]      = fallback;
+          match_lengths[next] = std::max(match_lengths[next], match_lengths[fallback]);
+          states.push(next);
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Finds the first byte position of any target in each string
+ * using the device copy of an `aho_corasick` automaton.
+ */
+struct find_any_fn {
+  column_device_view d_strings;
+  int32_t const* byte_symbols;
+  int32_t const* transitions;
+  int32_t const* match_lengths;
+  int32_t symbols_count;
+  int32_t max_length;
+  bool first_match;  // stop at the first match found instead of the leftmost one
+
+  /**
+   * @brief Returns the byte position of the leftmost occurrence of any target, or -1.
+   */
+  __device__ size_type find(string_view const& d_str) const {
+    if (match_lengths[0] >= 0) return 0;  // an empty target
+    auto const data = d_str.data();
+    int32_t state   = 0;
+    size_type found = -1;
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      if ((found >= 0) && (pos >= found + max_length)) break;  // later matches start after
+      state = transitions[state * symbols_count + byte_symbols[static_cast<uint8_t>(data[pos])]];
+      auto const length = match_lengths[state];
+      if (length < 0) continue;
+      auto const begin = pos + 1 - length;
+      if ((found < 0) || (begin < found)) found = begin;
+      if (first_match) break;
+    }
+    return found;
+  }
+
+  __device__ size_type operator()(size_type idx) const {
+    if (d_strings.is_null(idx)) return -1;
+    string_view d_str = d_strings.element<string_view>(idx);
+    auto const found  = find(d_str);
+    return found <= 0 ? found : characters_in_string(d_str.data(), found);
+  }
+};
+
+/**
+ * @brief Utility evaluating the automaton of the targets on each string.
+ *
+ * @tparam T Output type; a BOOL8 output identifies the strings with any match.
+ */
+template <typename T>
+std::unique_ptr<column> find_any_fn_util(strings_column_view const& strings,
+                                         strings_column_view const& targets,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  auto const targets_count = targets.size();
+  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+  constexpr bool is_contains = std::is_same<T, bool>::value;
+  auto const output_type     = data_type{is_contains ? BOOL8 : INT32};
+  auto const strings_count   = strings.size();
+  if (strings_count == 0) return make_empty_column(output_type);
+
+  // copy the targets to the host to build the automaton
+  std::vector<int32_t> h_offsets(targets_count + 1);
+  CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                           targets.offsets().data<int32_t>() + targets.offset(),
+                           h_offsets.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  std::vector<char> h_chars(h_offsets.back() - h_offsets.front());
+  CUDA_TRY(cudaMemcpyAsync(h_chars.data(),
+                           targets.chars().data<char>() + h_offsets.front(),
+                           h_chars.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDF_STREAM_SYNC(stream);
+  aho_corasick const automaton(h_chars, h_offsets);
+  rmm::device_vector<int32_t> byte_symbols(automaton.byte_symbols);
+  rmm::device_vector<int32_t> transitions(automaton.transitions);
+  rmm::device_vector<int32_t> match_lengths(automaton.match_lengths);
+
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto results        = make_numeric_column(output_type,
+                                     strings_count,
+                                     copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  find_any_fn fn{*strings_column,
+                 byte_symbols.data().get(),
+                 transitions.data().get(),
+                 match_lengths.data().get(),
+                 automaton.symbols_count,
+                 automaton.max_length,
+                 is_contains};
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    results->mutable_view().data<T>(),
+                    [fn] __device__(size_type idx) {
+                      auto const position = fn(idx);
+                      return static_cast<T>(is_contains ? position >= 0 : position);
+                    });
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
+}  // namespace
+
+std::unique_ptr<column> contains_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  return find_any_fn_util<bool>(strings, targets, mr, stream);
+}
+
+std::unique_ptr<column> find_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  return find_any_fn_util<int32_t>(strings, targets, mr, stream);
+}
+
 }  // namespace detail
 
 // external API
@@ -76,5 +278,19 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, mr);
 }
 
+std::unique_ptr<column> contains_any(strings_column_view const& strings,
+                                     strings_column_view const& targets,
+                                     rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::contains_any(strings, targets, mr);
+}
+
+std::unique_ptr<column> find_any(strings_column_view const& strings,
+                                 strings_column_view const& targets,
+                                 rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::find_any(strings, targets, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
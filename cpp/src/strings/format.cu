@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/format.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <strings/convert/float_conversion.cuh>
+#include <strings/utilities.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief A run of literal characters of the pattern, followed by the value of
+ * a column, or by nothing if `column` is negative
+ */
+struct format_segment {
+  size_type literal_offset;  ///< Offset of the literal in the unescaped literals
+  size_type literal_size;    ///< Bytes of the literal
+  size_type column;          ///< Column whose value follows the literal
+};
+
+/**
+ * @brief Splits `pattern` into segments, appending their unescaped literals to
+ * `literals`
+ */
+std::vector<format_segment> parse_format_pattern(std::string const& pattern,
+                                                 size_type num_columns,
+                                                 std::string& literals) {
+  std::vector<format_segment> segments;
+  size_type literal_offset = 0;
+  size_type next_column    = 0;
+  bool automatic           = false;
+  bool explicit_index      = false;
+  for (std::size_t i = 0; i < pattern.size(); ++i) {
+    auto const ch = pattern[i];
+    if ((ch == '{' or ch == '}') and i + 1 < pattern.size() and pattern[i + 1] == ch) {
+      literals.push_back(ch);
+      ++i;
+      continue;
+    }
+    CUDF_EXPECTS(ch != '}', "Unmatched '}' in format pattern");
+    if (ch != '{') {
+      literals.push_back(ch);
+      continue;
+    }
+    auto const close = pattern.find('}', i + 1);
+    CUDF_EXPECTS(close != std::string::npos, "Unmatched '{' in format pattern");
+    auto const index = pattern.substr(i + 1, close - i - 1);
+    size_type column = 0;
+    if (index.empty()) {
+      automatic = true;
+      column    = next_column++;
+    } else {
+      CUDF_EXPECTS(index.size() <= 9 and std::all_of(index.begin(),
+                                                     index.end(),
+                                                     [](char c) { return std::isdigit(c) != 0; }),
+                   "Format placeholders must be {} or {N}");
+      explicit_index = true;
+      column         = std::stoi(index);
+    }
+    CUDF_EXPECTS(not(automatic and explicit_index),
+                 "Format pattern cannot mix {} and {N} placeholders");
+    CUDF_EXPECTS(column < num_columns, "Format placeholder refers to a column out of range");
+    auto const literal_end = static_cast<size_type>(literals.size());
+    segments.push_back({literal_offset, literal_end - literal_offset, column});
+    literal_offset = literal_end;
+    i              = close;
+  }
+  auto const literal_end = static_cast<size_type>(literals.size());
+  if (literal_end > literal_offset) {
+    segments.push_back({literal_offset, literal_end - literal_offset, -1});
+  }
+  return segments;
+}
+
+struct is_formattable_fn {
+  template <typename T>
+  bool operator()() const {
+    return std::is_arithmetic<T>::value or std::is_same<T, string_view>::value;
+  }
+};
+
+/**
+ * @brief Writes the value of a row of a column as a string, returning its
+ * size in bytes
+ *
+ * Nothing is written if `output` is null, so the same code sizes and writes
+ * the values.
+ */
+struct format_value_fn {
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  __device__ size_type operator()(column_device_view const& col, size_type row, char* output) {
+    auto const str = col.element<string_view>(row);
+    if (output != nullptr) { copy_string(output, str); }
+    return str.size_bytes();
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  __device__ size_type operator()(column_device_view const& col, size_type row, char* output) {
+    bool const value = col.element<bool>(row);
+    if (output != nullptr) { memcpy(output, value ? "true" : "false", value ? 4 : 5); }
+    return value ? 4 : 5;
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_integral<T>::value and
+                             not std::is_same<T, bool>::value>* = nullptr>
+  __device__ size_type operator()(column_device_view const& col, size_type row, char* output) {
+    int64_t const value = col.element<T>(row);
+    // The magnitude of the smallest value does not fit the signed type
+    uint64_t magnitude =
+      value < 0 ? uint64_t{0} - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    char digits[20];  // largest 64-bit integer is 20 digits
+    size_type num_digits = 0;
+    do {
+      digits[num_digits++] = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+
+    // The value of a fixed-point element is its integer representation * 10^scale
+    auto const id = col.type().id();
+    int32_t const scale =
+      (id == type_id::DECIMAL32 or id == type_id::DECIMAL64) ? col.type().scale() : 0;
+    size_type const zeros      = (scale > 0 and value != 0) ? scale : 0;
+    size_type const fraction   = (scale < 0) ? -scale : 0;
+    size_type const int_digits = (fraction > 0) ? max(num_digits - fraction, 1) : num_digits;
+    size_type const size = (value < 0) + int_digits + zeros + ((fraction > 0) ? fraction + 1 : 0);
+    if (output != nullptr) {
+      if (value < 0) { *output++ = '-'; }
+      // digits are backwards, reverse the string into the output; the digits
+      // past the most significant one are leading zeros
+      auto const digit = [&](size_type i) { return i < num_digits ? digits[i] : '0'; };
+      for (size_type i = int_digits + fraction - 1; i >= fraction; --i) { *output++ = digit(i); }
+      for (size_type i = 0; i < zeros; ++i) { *output++ = '0'; }
+      if (fraction > 0) {
+        *output++ = '.';
+        for (size_type i = fraction - 1; i >= 0; --i) { *output++ = digit(i); }
+      }
+    }
+    return size;
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ size_type operator()(column_device_view const& col, size_type row, char* output) {
+    ftos_converter fts;
+    char buffer[ftos_converter::max_bytes];
+    auto const size = fts.float_to_string(col.element<T>(row), buffer);
+    if (output != nullptr) { memcpy(output, buffer, size); }
+    return size;
+  }
+
+  template <typename T,
+            std::enable_if_t<not std::is_arithmetic<T>::value and
+                             not std::is_same<T, string_view>::value>* = nullptr>
+  __device__ size_type operator()(column_device_view const&, size_type, char*) {
+    release_assert(false && "Only strings, integers, floats and booleans can be formatted");
+    return 0;
+  }
+};
+
+/**
+ * @brief Sizes the formatted string of a row, or writes it to `d_chars` at
+ * the offset of the row if `d_chars` is not null
+ */
+struct format_fn {
+  table_device_view d_table;
+  format_segment const* d_segments;
+  size_type num_segments;
+  char const* d_literals;
+  string_scalar_device_view d_narep;
+  int32_t const* d_offsets{};
+  char* d_chars{};
+
+  __device__ bool is_null_row(size_type row) const {
+    for (size_type i = 0; i < num_segments; ++i) {
+      auto const column = d_segments[i].column;
+      if (column >= 0 and d_table.column(column).is_null(row)) { return true; }
+    }
+    return false;
+  }
+
+  __device__ size_type operator()(size_type row) const {
+    if (not d_narep.is_valid() and is_null_row(row)) { return 0; }
+    char* output   = d_chars == nullptr ? nullptr : d_chars + d_offsets[row];
+    size_type size = 0;
+    for (size_type i = 0; i < num_segments; ++i) {
+      auto const segment = d_segments[i];
+      if (output != nullptr) {
+        output = copy_and_increment(
+          output, d_literals + segment.literal_offset, segment.literal_size);
+      }
+      size += segment.literal_size;
+      if (segment.column < 0) { continue; }
+
+      auto const col = d_table.column(segment.column);
+      size_type value_size = 0;
+      if (col.is_null(row)) {
+        value_size = d_narep.size();
+        if (output != nullptr) { copy_string(output, d_narep.value()); }
+      } else {
+        value_size =
+          cudf::experimental::type_dispatcher(col.type(), format_value_fn{}, col, row, output);
+      }
+      if (output != nullptr) { output += value_size; }
+      size += value_size;
+    }
+    return size;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> format(
+  table_view const& columns,
+  std::string const& pattern,
+  string_scalar const& narep          = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  std::string literals;
+  auto const segments = parse_format_pattern(pattern, columns.num_columns(), literals);
+  for (auto const& segment : segments) {
+    CUDF_EXPECTS(segment.column < 0 or
+                   cudf::experimental::type_dispatcher(columns.column(segment.column).type(),
+                                                       is_formattable_fn{}),
+                 "Only strings, integer, fixed-point, floating-point and boolean columns can be "
+                 "formatted");
+  }
+  auto const strings_count = columns.num_rows();
+  if (strings_count == 0) { return detail::make_empty_strings_column(mr, stream); }
+
+  rmm::device_vector<format_segment> d_segments(segments);
+  rmm::device_vector<char> d_literals(literals.begin(), literals.end());
+  auto d_narep = get_scalar_device_view(const_cast<string_scalar&>(narep));
+  auto table   = table_device_view::create(columns, stream);
+  format_fn formatter{*table,
+                      d_segments.data().get(),
+                      static_cast<size_type>(segments.size()),
+                      d_literals.data().get(),
+                      d_narep};
+
+  // create resulting null mask
+  auto valid_mask = cudf::experimental::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [formatter] __device__(size_type row) {
+      return formatter.d_narep.is_valid() or not formatter.is_null_row(row);
+    },
+    stream,
+    mr);
+  rmm::device_buffer null_mask = valid_mask.first;
+  auto null_count              = valid_mask.second;
+
+  // build offsets column by sizing each formatted string, without writing it
+  auto offsets_transformer_itr =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), formatter);
+  auto offsets_column = detail::make_offsets_child_column(
+    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
+  auto d_results_offsets = offsets_column->view().data<int32_t>();
+
+  // create the chars column
+  size_type bytes = thrust::device_pointer_cast(d_results_offsets)[strings_count];
+  auto chars_column =
+    strings::detail::create_chars_child_column(strings_count, null_count, bytes, mr, stream);
+  // fill the chars column
+  formatter.d_offsets = d_results_offsets;
+  formatter.d_chars   = chars_column->mutable_view().data<char>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     formatter);
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             null_count,
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
+}  // namespace detail
+
+// APIs
+
+std::unique_ptr<column> format(table_view const& columns,
+                               std::string const& pattern,
+                               string_scalar const& narep,
+                               rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::format(columns, pattern, narep, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/strings/detail/inline_string_view.cuh>
+
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+rmm::device_vector<inline_string_view> create_inline_string_views(
+  strings_column_view const& strings, cudaStream_t stream) {
+  auto const strings_count = strings.size();
+  rmm::device_vector<inline_string_view> views(strings_count);
+  if (strings_count == 0) return views;
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  auto d_offsets      = strings.offsets().data<int32_t>() + strings.offset();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    views.begin(),
+                    [d_strings, d_offsets] __device__(size_type idx) {
+                      if (d_strings.is_null(idx)) return inline_string_view{};
+                      return inline_string_view{d_strings.element<string_view>(idx),
+                                                d_offsets[idx]};
+                    });
+  return views;
+}
+
+std::unique_ptr<column> make_strings_column(rmm::device_vector<inline_string_view> const& views,
+                                            strings_column_view const& strings,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr) {
+  using string_index_pair = thrust::pair<const char*, size_type>;
+  rmm::device_vector<string_index_pair> pairs(views.size());
+  auto d_chars = strings.size() == 0 ? nullptr : strings.chars().data<char>();
+  auto d_views = views.data().get();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(views.size()),
+                    pairs.begin(),
+                    [d_views, d_chars] __device__(size_type idx) {
+                      auto const& view = d_views[idx];  // inline strings point into the views
+                      if (view.is_null()) return string_index_pair{nullptr, 0};
+                      return string_index_pair{view.data(d_chars), view.size_bytes()};
+                    });
+  return cudf::make_strings_column(pairs, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -14,12 +14,14 @@
 * limitations under the License.
 */
 
+#include <strings/char_types/is_flags.h>
 #include <strings/regex/regcomp.h>
 #include <cudf/utilities/error.hpp>
 
 #include <string.h>
 #include <algorithm>
 #include <array>
+#include <map>
 
 namespace cudf {
 namespace strings {
@@ -884,6 +886,168 @@ void reprog::optimize2() {
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+// convert to a deterministic automaton with the subset construction
+bool reprog::build_dfa(const uint8_t* ascii_flags, redfa& dfa) const {
+  if (_insts.empty() || _insts[_startinst_id].type == END) return false;
+  for (auto const& inst : _insts) {
+    switch (inst.type) {
+      case CHAR:
+      case ANY:
+      case ANYNL:
+      case CCLASS:
+      case NCCLASS:
+      case OR:
+      case LBRA:
+      case RBRA:
+      case END: break;
+      default: return false;  // BOL, EOL, BOW and NBOW look at the neighbouring characters
+    }
+  }
+  auto const is_consuming = [](int32_t type) {
+    return type == CHAR || type == ANY || type == ANYNL || type == CCLASS || type == NCCLASS;
+  };
+
+  // same logic as reclass_device::is_match() for an ASCII character
+  auto const class_matches = [ascii_flags](reclass const& cls, char32_t ch) {
+    for (size_t i = 0; i + 1 < cls.literals.size(); i += 2)
+      if ((ch >= cls.literals[i]) && (ch <= cls.literals[i + 1])) return true;
+    auto const builtins = cls.builtins;
+    auto const fl       = ascii_flags[ch];
+    return ((builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) ||                 // \w
+           ((builtins & 2) && IS_SPACE(fl)) ||                                     // \s
+           ((builtins & 4) && IS_DIGIT(fl)) ||                                     // \d
+           ((builtins & 8) && (ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl)) ||  // \W
+           ((builtins & 16) && !IS_SPACE(fl)) ||                                   // \S
+           ((builtins & 32) && (ch != '\n') && !IS_DIGIT(fl));                     // \D
+  };
+  auto const matches = [&](reinst const& inst, char32_t ch) {
+    switch (inst.type) {
+      case CHAR: return inst.u1.c == ch;
+      case ANY: return ch != '\n';
+      case ANYNL: return true;
+      case CCLASS: return class_matches(_classes[inst.u1.cls_id], ch);
+      case NCCLASS: return !class_matches(_classes[inst.u1.cls_id], ch);
+    }
+    return false;
+  };
+  // returns whether all the non-ASCII characters match the instruction, or -1 if only some do
+  auto const non_ascii_matches = [&](reinst const& inst) -> int32_t {
+    switch (inst.type) {
+      case CHAR: return inst.u1.c < 0x80 ? 0 : -1;
+      case ANY:
+      case ANYNL: return 1;
+      case CCLASS:
+      case NCCLASS: {
+        auto const& cls = _classes[inst.u1.cls_id];
+        if (cls.builtins) return -1;
+        for (size_t i = 1; i < cls.literals.size(); i += 2)
+          if (cls.literals[i] >= 0x80) return -1;
+        return inst.type == NCCLASS;
+      }
+    }
+    return 0;
+  };
+
+  // a symbol is identified by the instructions matching its characters
+  auto const insts_count = static_cast<int32_t>(_insts.size());
+  std::map<std::vector<bool>, int32_t> symbol_ids;
+  std::vector<std::vector<bool>> symbols;
+  auto const add_symbol = [&](std::vector<bool> const& matched) {
+    auto const result = symbol_ids.emplace(matched, static_cast<int32_t>(symbols.size()));
+    if (result.second) symbols.push_back(matched);
+    return result.first->second;
+  };
+  dfa.ascii_symbols.resize(128);
+  for (char32_t ch = 0; ch < 128; ++ch) {
+    std::vector<bool> matched(insts_count);
+    for (int32_t id = 0; id < insts_count; ++id)
+      matched[id] = is_consuming(_insts[id].type) && matches(_insts[id], ch);
+    dfa.ascii_symbols[ch] = static_cast<uint8_t>(add_symbol(matched));
+  }
+  {
+    std::vector<bool> matched(insts_count);
+    bool uniform = true;
+    for (int32_t id = 0; uniform && (id < insts_count); ++id) {
+      if (!is_consuming(_insts[id].type)) continue;
+      auto const result = non_ascii_matches(_insts[id]);
+      uniform           = result >= 0;
+      matched[id]       = result > 0;
+    }
+    dfa.non_ascii_symbol = uniform ? add_symbol(matched) : -1;
+  }
+  dfa.symbols_count = static_cast<int32_t>(symbols.size());
+
+  // adds the consuming and END instructions reachable from `id` to `state`
+  auto const add_closure = [&](int32_t id,
+                               std::vector<bool>& visited,
+                               std::vector<int32_t>& state) {
+    std::vector<int32_t> stack{id};
+    while (!stack.empty()) {
+      auto const inst_id = stack.back();
+      stack.pop_back();
+      if (visited[inst_id]) continue;
+      visited[inst_id]   = true;
+      reinst const& inst = _insts[inst_id];
+      if (inst.type == OR) {
+        stack.push_back(inst.u1.right_id);
+        stack.push_back(inst.u2.left_id);
+      } else if (inst.type == LBRA || inst.type == RBRA) {
+        stack.push_back(inst.u2.next_id);
+      } else {
+        state.push_back(inst_id);
+      }
+    }
+  };
+
+  for (int32_t anchored = 0; anchored < 2; ++anchored) {
+    auto& table = dfa.tables[anchored];
+    std::map<std::vector<int32_t>, int32_t> state_ids;
+    std::vector<std::vector<int32_t>> states;
+    auto const add_state = [&](std::vector<int32_t>& state) {
+      std::sort(state.begin(), state.end());
+      auto const result = state_ids.emplace(state, static_cast<int32_t>(states.size()));
+      if (result.second) states.push_back(state);
+      return result.first->second;
+    };
+    auto const has_end = [&](std::vector<int32_t> const& state) {
+      return std::any_of(
+        state.begin(), state.end(), [&](int32_t id) { return _insts[id].type == END; });
+    };
+    {
+      std::vector<bool> visited(insts_count);
+      std::vector<int32_t> start;
+      add_closure(_startinst_id, visited, start);
+      add_state(start);
+    }
+    table.transitions.clear();
+    for (size_t idx = 0; idx < states.size(); ++idx) {
+      if ((states.size() > static_cast<size_t>(DFA_MAX_STATES)) ||
+          ((idx + 1) * dfa.symbols_count > static_cast<size_t>(DFA_MAX_TRANSITIONS)))
+        return false;
+      auto const current = states[idx];
+      for (int32_t symbol = 0; symbol < dfa.symbols_count; ++symbol) {
+        if (has_end(current)) {  // the search stops at a match
+          table.transitions.push_back(static_cast<uint8_t>(idx));
+          continue;
+        }
+        std::vector<bool> visited(insts_count);
+        std::vector<int32_t> next;
+        if (!anchored) add_closure(_startinst_id, visited, next);  // a match may begin here
+        for (auto const id : current)
+          if (symbols[symbol][id]) add_closure(_insts[id].u2.next_id, visited, next);
+        table.transitions.push_back(static_cast<uint8_t>(add_state(next)));
+      }
+    }
+    if (states.size() > static_cast<size_t>(DFA_MAX_STATES)) return false;
+    table.states_count = static_cast<int32_t>(states.size());
+    table.status.resize(states.size());
+    std::transform(states.begin(), states.end(), table.status.begin(), [&](auto const& state) {
+      return has_end(state) ? 1 : (state.empty() ? 2 : 0);
+    });
+  }
+  return true;
+}
+
 void reprog::print() {
   printf("Instructions:\n");
   for (int i = 0; i < _insts.size(); i++) {
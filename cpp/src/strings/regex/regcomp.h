@@ -73,6 +73,44 @@ struct reinst {
   int32_t reserved4;
 };
 
+/**
+ * @brief Most states of a deterministic automaton; state ids are stored in one byte.
+ */
+constexpr int32_t DFA_MAX_STATES = 256;
+
+/**
+ * @brief Most transitions, one byte each, in the table of a deterministic automaton.
+ */
+constexpr int32_t DFA_MAX_TRANSITIONS = 8192;
+
+/**
+ * @brief Deterministic automaton matching the same strings as a regex program.
+ *
+ * Characters are first mapped to symbols: the characters matched by the same
+ * instructions of the program share a symbol. Every ASCII character has an entry
+ * in `ascii_symbols` and all the other characters map to `non_ascii_symbol`,
+ * or to no symbol (-1) if the program does not match them alike.
+ *
+ * A table is built for finding a match anywhere in a string and another one for
+ * finding a match at the beginning of a string. State 0 is the start state of both.
+ */
+struct redfa {
+  /**
+   * @brief States of a deterministic automaton: the status of each state is
+   * 0 while searching, 1 if a match is found and 2 if no match is possible.
+   */
+  struct table {
+    int32_t states_count{};
+    std::vector<uint8_t> status;       // one per state
+    std::vector<uint8_t> transitions;  // next state for each state and symbol
+  };
+
+  int32_t symbols_count{};
+  int32_t non_ascii_symbol{-1};
+  std::vector<uint8_t> ascii_symbols;  // symbol of each ASCII character
+  table tables[2];                     // unanchored and anchored tables
+};
+
 /**
  * @brief Regex program handles parsing a pattern in to individual set
  * of chained instructions.
@@ -114,6 +152,19 @@ class reprog {
 
   void optimize1();
   void optimize2();
+
+  /**
+   * @brief Builds the deterministic automaton of this program.
+   *
+   * Only programs without anchors or word boundaries are converted, since their
+   * matches depend on the characters around them. Capturing groups are ignored.
+   *
+   * @param ascii_flags Character type flags of the ASCII characters.
+   * @param[out] dfa The automaton.
+   * @return false if this program cannot be converted, or has too many states.
+   */
+  bool build_dfa(const uint8_t* ascii_flags, redfa& dfa) const;
+
   void print();  // for debugging
 
  private:
@@ -64,6 +64,8 @@ class reprog_device {
      * @brief Create device program instance from a regex pattern.
      *
      * The number of strings is needed to compute the state data size required when evaluating the regex.
+     * The compiled program is cached by pattern, so later calls with the same pattern
+     * only allocate their state data.
      *
      * @param pattern The regex pattern to compile.
      * @param cp_flags The code-point lookup table for character types.
@@ -148,6 +150,36 @@ class reprog_device {
   __device__ inline int32_t extract(
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t column);
 
+  /**
+     * @brief Returns the size in bytes of the deterministic automaton data.
+     *
+     * This is 0 if the pattern could not be converted into an automaton.
+     */
+  __host__ __device__ int32_t dfa_size() const { return _dfa_size; }
+
+  /**
+     * @brief Returns the deterministic automaton data.
+     */
+  __device__ const uint8_t* dfa_data() const { return _dfa_data; }
+
+  /**
+     * @brief Sets the deterministic automaton data to a copy, e.g. in shared memory.
+     */
+  __device__ void set_dfa_data(const uint8_t* data) { _dfa_data = data; }
+
+  /**
+     * @brief Does a find evaluation of the given string using the deterministic automaton.
+     *
+     * The string is evaluated in a single pass and does not need the state memory.
+     * Call this only if dfa_size() is not 0.
+     *
+     * @param d_str The string to search.
+     * @param anchored Only match the beginning of the string.
+     * @return Returns 1 if a match is found, 0 if no match is found, and -1 if the string
+     *         has characters the automaton cannot evaluate; find() must be used then.
+     */
+  __device__ inline int32_t dfa_find(string_view const& d_str, bool anchored) const;
+
  private:
   int32_t _startinst_id, _num_capturing_groups;
   int32_t _insts_count, _starts_count, _classes_count;
@@ -158,6 +190,11 @@ class reprog_device {
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
+  int32_t _dfa_size{};                // bytes of automaton data; 0 if there is no automaton
+  int32_t _dfa_symbols_count{};       // number of automaton symbols
+  int32_t _dfa_non_ascii_symbol{-1};  // symbol of non-ASCII characters; -1 if there is none
+  int32_t _dfa_states_count[2]{};     // states of the unanchored and anchored automata
+  const uint8_t* _dfa_data{};         // ASCII symbols, states status and transitions
 
   /**
      * @brief Executes the regex pattern on the given string.
@@ -172,6 +209,16 @@ class reprog_device {
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t groupid = 0);
 
   reprog_device(reprog&);  // must use create()
+
+  /**
+     * @brief Compiles the pattern and copies the program into device memory.
+     *
+     * The returned program owns its device memory but no execute memory so
+     * create() can share it across calls.
+     */
+  static std::shared_ptr<reprog_device> compile(std::string const& pattern,
+                                                const uint8_t* cp_flags,
+                                                cudaStream_t stream);
 };
 
 // 10128 ≈ 1000 instructions
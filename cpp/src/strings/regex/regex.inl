@@ -456,6 +456,50 @@ __device__ inline int32_t reprog_device::call_regexec( int32_t idx, string_view
     return regexec(dstr,jnk,begin,end,group_id);
 }
 
+/**
+ * @brief Evaluate a string with the deterministic automaton of the regex pattern.
+ *
+ * The automaton data is laid out as: the symbols of the 128 ASCII characters,
+ * the status of each unanchored state, the status of each anchored state, the
+ * unanchored transitions and the anchored transitions.
+ * UTF-8 continuation bytes are skipped since a non-ASCII character is a single symbol.
+ * An embedded null character ends the evaluation of the regex instructions, so
+ * `find()` is used for such strings too.
+ */
+__device__ inline int32_t reprog_device::dfa_find( string_view const& d_str, bool anchored ) const
+{
+    const uint8_t* ascii_symbols = _dfa_data;
+    const uint8_t* status = ascii_symbols + 128 + (anchored ? _dfa_states_count[0] : 0);
+    const uint8_t* transitions = ascii_symbols + 128 + _dfa_states_count[0] + _dfa_states_count[1]
+                                 + (anchored ? _dfa_states_count[0] * _dfa_symbols_count : 0);
+    int32_t state = 0;
+    if( status[state] )
+        return status[state] == 1;
+    const char* ptr = d_str.data();
+    const char* end = ptr + d_str.size_bytes();
+    while( ptr < end )
+    {
+        auto const byte = static_cast<uint8_t>(*ptr++);
+        int32_t symbol = 0;
+        if( byte == 0 )
+            return -1;
+        if( byte < 0x80 )
+            symbol = ascii_symbols[byte];
+        else
+        {
+            if( _dfa_non_ascii_symbol < 0 )
+                return -1;
+            symbol = _dfa_non_ascii_symbol;
+            while( (ptr < end) && ((static_cast<uint8_t>(*ptr) & 0xC0) == 0x80) )
+                ++ptr;
+        }
+        state = transitions[state * _dfa_symbols_count + symbol];
+        if( status[state] )
+            return status[state] == 1;
+    }
+    return 0;
+}
+
 } // namespace detail
 } // namespace strings
 } // namespace cudf
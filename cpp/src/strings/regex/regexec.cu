@@ -22,6 +22,11 @@
 #include <rmm/rmm_api.h>
 #include <rmm/rmm.hpp>
 
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -55,6 +60,62 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern) {
   return result;
 }
 
+/**
+ * @brief The number of compiled programs kept by the program cache.
+ */
+constexpr std::size_t REGEX_PROGRAM_CACHE_SIZE = 128;
+
+/**
+ * @brief Least-recently-used cache of the compiled programs.
+ *
+ * The cached programs do not own any execute memory, which depends on the
+ * number of strings of each call. A program is keyed by its pattern, the character flags table it was built
+ * with and the device its memory is on. Reusing a program saves compiling the
+ * pattern and copying it to the device for every call.
+ */
+class program_cache {
+ public:
+  using key_type     = std::tuple<std::string, const uint8_t*, int>;
+  using program_type = std::shared_ptr<reprog_device>;
+
+  program_type find(key_type const& key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const itr = _index.find(key);
+    if (itr == _index.end()) return nullptr;
+    _entries.splice(_entries.begin(), _entries, itr->second);  // most recently used first
+    return itr->second->second;
+  }
+
+  void insert(key_type const& key, program_type const& program) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_index.find(key) != _index.end()) return;  // another thread compiled it first
+    _entries.emplace_front(key, program);
+    _index.emplace(key, _entries.begin());
+    if (_entries.size() > REGEX_PROGRAM_CACHE_SIZE) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+  }
+
+ private:
+  std::mutex _mutex;
+  std::list<std::pair<key_type, program_type>> _entries;
+  std::map<key_type, std::list<std::pair<key_type, program_type>>::iterator> _index;
+};
+
+/**
+ * @brief Returns the process-wide program cache.
+ *
+ * The cache is never destroyed so its device memory is not freed after the
+ * CUDA runtime has shut down. The programs are allocated with `cudaMalloc`
+ * rather than from the default memory resource, which may be destroyed while
+ * they are cached.
+ */
+program_cache& get_program_cache() {
+  static program_cache* cache = new program_cache{};
+  return *cache;
+}
+
 }  // namespace
 
 // Copy reprog primitive values
@@ -74,6 +135,52 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   const uint8_t* codepoint_flags,
   size_type strings_count,
   cudaStream_t stream) {
+  int device = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  auto const key = program_cache::key_type{pattern, codepoint_flags, device};
+  auto program   = get_program_cache().find(key);
+  if (program == nullptr) {
+    program = compile(pattern, codepoint_flags, stream);
+    get_program_cache().insert(key, program);
+  }
+
+  auto insts_count = program->_insts_count;
+  size_t rlm_size  = 0;
+  // check memory size needed for executing regex
+  if (insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(insts_count);
+    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+    size_t freeSize        = 0;
+    size_t totalSize       = 0;
+    rmmGetInfo(&freeSize, &totalSize, stream);
+    if (rlm_size > freeSize)  // do not allocate more than we have
+    {                         // otherwise, this is unrecoverable
+      std::ostringstream message;
+      message << "cuDF failure at: " __FILE__ ":" << __LINE__ << ": ";
+      message << "number of instructions (" << insts_count << ") ";
+      message << "and number of strings (" << strings_count << ") ";
+      message << "exceeds available memory";
+      throw cudf::logic_error(message.str());
+    }
+  }
+  // allocate execute memory if needed
+  std::unique_ptr<rmm::device_buffer> d_relists;
+  if (rlm_size > 0) d_relists = std::make_unique<rmm::device_buffer>(rlm_size, stream);
+  // each call has its own copy of the program to hold its execute memory
+  reprog_device* d_prog = new reprog_device(*program);
+  if (d_relists) d_prog->_relists_mem = d_relists->data();
+  // the program memory is released once no call or cache entry refers to it
+  auto deleter = [program, d_relists = d_relists.release()](reprog_device* t) {
+    t->destroy();
+    delete d_relists;
+  };
+  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+}
+
+// Compile the pattern and copy the program to device memory
+std::shared_ptr<reprog_device> reprog_device::compile(std::string const& pattern,
+                                                      const uint8_t* codepoint_flags,
+                                                      cudaStream_t stream) {
   std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
   // compile pattern into host object
   reprog h_prog = reprog::create_from(pattern32.data());
@@ -90,33 +197,33 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
-  size_t rlm_size = 0;
-  // check memory size needed for executing regex
-  if (insts_count > MAX_STACK_INSTS) {
-    auto relist_alloc_size = relist::alloc_size(insts_count);
-    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
-    size_t freeSize        = 0;
-    size_t totalSize       = 0;
-    rmmGetInfo(&freeSize, &totalSize, stream);
-    if (rlm_size + memsize > freeSize)  // do not allocate more than we have
-    {                                   // otherwise, this is unrecoverable
-      std::ostringstream message;
-      message << "cuDF failure at: " __FILE__ ":" << __LINE__ << ": ";
-      message << "number of instructions (" << insts_count << ") ";
-      message << "and number of strings (" << strings_count << ") ";
-      message << "exceeds available memory";
-      throw cudf::logic_error(message.str());
-    }
+  // build the deterministic automaton if the pattern can be converted into one
+  std::vector<uint8_t> ascii_flags(128);
+  CUDA_TRY(cudaMemcpyAsync(
+    ascii_flags.data(), codepoint_flags, ascii_flags.size(), cudaMemcpyDeviceToHost, stream));
+  CUDF_STREAM_SYNC(stream);
+  redfa h_dfa;
+  size_t dfa_size = 0;
+  if (h_prog.build_dfa(ascii_flags.data(), h_dfa)) {
+    dfa_size = h_dfa.ascii_symbols.size();
+    for (auto const& table : h_dfa.tables)
+      dfa_size += table.status.size() + table.transitions.size();
   }
+  size_t memsize = insts_size + startids_size + classes_size + dfa_size;
 
   // allocate memory to store prog data
   std::vector<u_char> h_buffer(memsize);
-  u_char* h_ptr  = h_buffer.data();  // running pointer
-  auto* d_buffer = new rmm::device_buffer(memsize, stream);
-  u_char* d_ptr  = reinterpret_cast<u_char*>(d_buffer->data());  // running device pointer
-  // put everything into a flat host buffer first
-  reprog_device* d_prog = new reprog_device(h_prog);
+  u_char* h_ptr = h_buffer.data();  // running pointer
+  // the cached program may outlive the default memory resource, which the caller
+  // can replace or destroy, so its memory is allocated from the CUDA runtime
+  void* d_buffer = nullptr;
+  CUDA_TRY(cudaMalloc(&d_buffer, memsize));
+  u_char* d_ptr = reinterpret_cast<u_char*>(d_buffer);  // running device pointer
+  // put everything into a flat host buffer first; the program owns the device memory
+  std::shared_ptr<reprog_device> d_prog(new reprog_device(h_prog), [d_buffer](reprog_device* t) {
+    t->destroy();
+    cudaFree(d_buffer);  // waits for the kernels that may still be using the program
+  });
   // copy the instructions array first (fixed-size structs)
   reinst* insts = reinterpret_cast<reinst*>(h_ptr);
   memcpy(insts, h_prog.insts_data(), insts_size);
@@ -147,27 +254,31 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     h_end += h_class.literals.size() * sizeof(char32_t);
     d_end += h_class.literals.size() * sizeof(char32_t);
   }
+  // append the automaton: [ascii symbols][status arrays][transition tables]
+  if (dfa_size > 0) {
+    auto append = [&h_end](std::vector<uint8_t> const& data) {
+      memcpy(h_end, data.data(), data.size());
+      h_end += data.size();
+    };
+    append(h_dfa.ascii_symbols);
+    for (auto const& table : h_dfa.tables) append(table.status);
+    for (auto const& table : h_dfa.tables) append(table.transitions);
+    d_prog->_dfa_data             = d_end;
+    d_prog->_dfa_size             = static_cast<int32_t>(dfa_size);
+    d_prog->_dfa_symbols_count    = h_dfa.symbols_count;
+    d_prog->_dfa_non_ascii_symbol = h_dfa.non_ascii_symbol;
+    for (int32_t idx = 0; idx < 2; ++idx)
+      d_prog->_dfa_states_count[idx] = h_dfa.tables[idx].states_count;
+  }
   // initialize the rest of the elements
   d_prog->_insts_count     = insts_count;
   d_prog->_starts_count    = starts_count;
   d_prog->_classes_count   = classes_count;
   d_prog->_codepoint_flags = codepoint_flags;
-  // allocate execute memory if needed
-  rmm::device_buffer* d_relists{};
-  if (rlm_size > 0) {
-    d_relists            = new rmm::device_buffer(rlm_size, stream);
-    d_prog->_relists_mem = d_relists->data();
-  }
 
   // copy flat prog to device memory
-  CUDA_TRY(cudaMemcpy(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice));
-  //
-  auto deleter = [d_buffer, d_relists](reprog_device* t) {
-    t->destroy();
-    delete d_buffer;
-    delete d_relists;
-  };
-  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+  CUDA_TRY(cudaMemcpy(d_buffer, h_buffer.data(), memsize, cudaMemcpyHostToDevice));
+  return d_prog;
 }
 
 void reprog_device::destroy() { delete this; }
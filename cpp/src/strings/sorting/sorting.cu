@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/strings/detail/inline_string_view.cuh>
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -43,21 +44,39 @@ std::unique_ptr<cudf::column> sort(strings_column_view strings,
   size_type num_strings = strings.size();
   rmm::device_vector<size_type> indices(num_strings);
   thrust::sequence(execpol->on(stream), indices.begin(), indices.end());
-  thrust::sort(execpol->on(stream),
-               indices.begin(),
-               indices.end(),
-               [d_column, stype, order, null_order] __device__(size_type lhs, size_type rhs) {
-                 bool lhs_null{d_column.is_null(lhs)};
-                 bool rhs_null{d_column.is_null(rhs)};
-                 if (lhs_null || rhs_null)
-                   return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
-                 string_view lhs_str = d_column.element<string_view>(lhs);
-                 string_view rhs_str = d_column.element<string_view>(rhs);
-                 int cmp             = 0;
-                 if (stype & sort_type::length) cmp = lhs_str.length() - rhs_str.length();
-                 if (stype & sort_type::name) cmp = lhs_str.compare(rhs_str);
-                 return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
-               });
+  if (stype == sort_type::name && num_strings > 0) {
+    // most comparisons are decided by the prefixes of the inline views
+    auto views   = create_inline_string_views(strings, stream);
+    auto d_views = views.data().get();
+    auto d_chars = strings.chars().data<char>();
+    thrust::sort(execpol->on(stream),
+                 indices.begin(),
+                 indices.end(),
+                 [d_views, d_chars, order, null_order] __device__(size_type lhs, size_type rhs) {
+                   bool lhs_null{d_views[lhs].is_null()};
+                   bool rhs_null{d_views[rhs].is_null()};
+                   if (lhs_null || rhs_null)
+                     return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
+                   int cmp = d_views[lhs].compare(d_views[rhs], d_chars);
+                   return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
+                 });
+  } else {
+    thrust::sort(execpol->on(stream),
+                 indices.begin(),
+                 indices.end(),
+                 [d_column, stype, order, null_order] __device__(size_type lhs, size_type rhs) {
+                   bool lhs_null{d_column.is_null(lhs)};
+                   bool rhs_null{d_column.is_null(rhs)};
+                   if (lhs_null || rhs_null)
+                     return (null_order == cudf::null_order::BEFORE ? !rhs_null : !lhs_null);
+                   string_view lhs_str = d_column.element<string_view>(lhs);
+                   string_view rhs_str = d_column.element<string_view>(rhs);
+                   int cmp             = 0;
+                   if (stype & sort_type::length) cmp = lhs_str.length() - rhs_str.length();
+                   if (stype & sort_type::name) cmp = lhs_str.compare(rhs_str);
+                   return (order == cudf::order::ASCENDING ? (cmp < 0) : (cmp > 0));
+                 });
+  }
 
   // create a column_view as a wrapper of these indices
   column_view indices_view(data_type{INT32}, num_strings, indices.data().get(), nullptr, 0);
@@ -20,12 +20,15 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/equal.h>
+#include <thrust/for_each.h>
 #include <thrust/transform.h>
 #include <vector>
 
@@ -838,7 +841,7 @@ contiguous_split_record_result contiguous_split_record_fn(strings_column_view co
     }
   }
 
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   return contiguous_split_record_result{std::move(column_views), std::move(all_data_ptr)};
 }
@@ -933,6 +936,122 @@ contiguous_split_record_result contiguous_split_record(
   }
 }
 
+namespace {
+
+/**
+ * @brief Counts the tokens of each string, and writes their positions in the
+ * chars column once `d_token_offsets` is set.
+ *
+ * The delimiter is matched byte by byte, which matches its characters since
+ * UTF-8 is self-synchronizing.
+ */
+struct split_offsets_fn {
+  column_device_view const d_strings;
+  string_view const d_delimiter;      // empty for whitespace
+  size_type const max_tokens;         // 0 for no maximum
+  int32_t const* d_offsets;           // offsets of the strings in the chars column
+  int32_t const* d_token_offsets{};   // offsets of the tokens of each string
+  int32_t* d_begins{};
+  int32_t* d_ends{};
+
+  __device__ size_type operator()(size_type idx) const {
+    if (d_strings.is_null(idx)) return 0;
+    string_view d_str  = d_strings.element<string_view>(idx);
+    auto const data    = d_str.data();
+    auto const bytes   = d_str.size_bytes();
+    auto const base    = d_offsets[idx];
+    auto const d_first = d_token_offsets ? d_token_offsets[idx] : 0;
+    size_type count    = 0;
+    auto add_token     = [&](size_type begin, size_type end) {
+      if (d_begins) {
+        d_begins[d_first + count] = base + begin;
+        d_ends[d_first + count]   = base + end;
+      }
+      ++count;
+    };
+    auto const is_last = [&] { return (max_tokens > 0) && (count + 1 == max_tokens); };
+
+    if (!d_delimiter.empty()) {
+      auto const delim = d_delimiter.size_bytes();
+      size_type begin  = 0;
+      for (size_type pos = 0; (pos + delim <= bytes) && !is_last();) {
+        if (thrust::equal(
+              thrust::seq, d_delimiter.data(), d_delimiter.data() + delim, data + pos)) {
+          add_token(begin, pos);
+          pos += delim;
+          begin = pos;
+        } else {
+          ++pos;
+        }
+      }
+      add_token(begin, bytes);
+      return count;
+    }
+    // a run of whitespace is a single delimiter and leading whitespace is ignored
+    auto const is_space = [data](size_type pos) { return static_cast<uint8_t>(data[pos]) <= ' '; };
+    size_type pos = 0;
+    while (pos < bytes) {
+      while ((pos < bytes) && is_space(pos)) ++pos;
+      if (pos == bytes) break;
+      auto const begin = pos;
+      if (is_last()) {  // the last token is the rest of the string
+        add_token(begin, bytes);
+        break;
+      }
+      while ((pos < bytes) && !is_space(pos)) ++pos;
+      add_token(begin, pos);
+    }
+    return count;
+  }
+};
+
+}  // namespace
+
+split_offsets_result split_offsets(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0) {
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  auto const strings_count = strings.size();
+  auto const make_positions = [&](size_type count) {
+    return make_numeric_column(data_type{INT32}, count, mask_state::UNALLOCATED, stream, mr);
+  };
+  if (strings_count == 0)
+    return split_offsets_result{make_positions(0), make_positions(0), make_positions(0)};
+
+  auto execpol        = rmm::exec_policy(stream);
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  split_offsets_fn fn{*strings_column,
+                      string_view(delimiter.data(), delimiter.size()),
+                      maxsplit > 0 ? maxsplit + 1 : 0,  // makes consistent with Pandas
+                      strings.offsets().data<int32_t>() + strings.offset()};
+
+  // count the tokens of each string
+  rmm::device_vector<size_type> token_counts(strings_count);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    token_counts.begin(),
+                    fn);
+  auto row_offsets =
+    make_offsets_child_column(token_counts.begin(), token_counts.end(), mr, stream);
+  auto const d_token_offsets = row_offsets->view().data<int32_t>();
+  size_type const total_tokens = thrust::device_pointer_cast(d_token_offsets)[strings_count];
+
+  // write the positions of the tokens
+  auto token_begins  = make_positions(total_tokens);
+  auto token_ends    = make_positions(total_tokens);
+  fn.d_token_offsets = d_token_offsets;
+  fn.d_begins        = token_begins->mutable_view().data<int32_t>();
+  fn.d_ends          = token_ends->mutable_view().data<int32_t>();
+  thrust::for_each_n(
+    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), strings_count, fn);
+  return split_offsets_result{
+    std::move(row_offsets), std::move(token_begins), std::move(token_ends)};
+}
+
 }  // namespace detail
 
 // external APIs
@@ -970,5 +1089,13 @@ contiguous_split_record_result contiguous_rsplit_record(strings_column_view cons
     strings, delimiter, maxsplit, mr, 0);
 }
 
+split_offsets_result split_offsets(strings_column_view const& strings,
+                                   string_scalar const& delimiter,
+                                   size_type maxsplit,
+                                   rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::split_offsets(strings, delimiter, maxsplit, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -55,12 +55,43 @@ namespace {
 struct substring_fn {
   const column_device_view d_column;
   numeric_scalar_device_view<size_type> d_start, d_stop, d_step;
+  bool ascii;  // character positions are byte positions
   const int32_t* d_offsets{};
   char* d_chars{};
 
+  // the substring logic below, with the byte positions of an ASCII string
+  __device__ cudf::size_type ascii_substring(string_view const& d_str, char* d_buffer) const {
+    auto const length = d_str.size_bytes();
+    if (length == 0) return 0;  // empty string
+    size_type const step = d_step.is_valid() ? d_step.value() : 1;
+    auto const begin     = [&] {  // always inclusive
+      if (!d_start.is_valid()) return (step > 0) ? 0 : (length - 1);
+      auto start = d_start.value();
+      if (start >= 0) return (start < length) ? start : (length + (step < 0 ? -1 : 0));
+      auto adjust = length + start;
+      if (adjust >= 0) return adjust;
+      return (step < 0 ? -1 : 0);
+    }();
+    auto const end = [&] {  // always exclusive
+      if (!d_stop.is_valid()) return step > 0 ? length : -1;
+      auto stop = d_stop.value();
+      if (stop >= 0) return (stop < length) ? stop : length;
+      auto adjust = length + stop;
+      return (adjust >= 0 ? adjust : -1);
+    }();
+
+    size_type bytes = 0;
+    for (auto pos = begin; step > 0 ? pos < end : end < pos; pos += step) {
+      if (d_buffer) d_buffer[bytes] = d_str.data()[pos];
+      ++bytes;
+    }
+    return bytes;
+  }
+
   __device__ cudf::size_type operator()(size_type idx) {
     if (d_column.is_null(idx)) return 0;  // null string
     string_view d_str = d_column.template element<string_view>(idx);
+    if (ascii) return ascii_substring(d_str, d_chars ? d_chars + d_offsets[idx] : nullptr);
     auto const length = d_str.length();
     if (length == 0) return 0;  // empty string
     size_type const step = d_step.is_valid() ? d_step.value() : 1;
@@ -121,13 +152,15 @@ std::unique_ptr<column> slice_strings(
   auto d_start        = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(start));
   auto d_stop         = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(stop));
   auto d_step         = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(step));
+  bool const ascii    = is_ascii(strings, stream);
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
 
   // build offsets column
   auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<int32_t>(0), substring_fn{d_column, d_start, d_stop, d_step});
+    thrust::make_counting_iterator<int32_t>(0),
+    substring_fn{d_column, d_start, d_stop, d_step, ascii});
   auto offsets_column = make_offsets_child_column(
     offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
   auto d_new_offsets = offsets_column->view().data<int32_t>();
@@ -137,10 +170,11 @@ std::unique_ptr<column> slice_strings(
   auto chars_column = strings::detail::create_chars_child_column(
     strings_count, strings.null_count(), bytes, mr, stream);
   auto d_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     strings_count,
-                     substring_fn{d_column, d_start, d_stop, d_step, d_new_offsets, d_chars});
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    substring_fn{d_column, d_start, d_stop, d_step, ascii, d_new_offsets, d_chars});
   //
   return make_strings_column(strings_count,
                              std::move(offsets_column),
@@ -172,6 +206,7 @@ struct substring_from_fn {
   const column_device_view d_column;
   const PositionType* starts;
   const PositionType* stops;
+  bool ascii;  // character positions are byte positions
   const int32_t* d_offsets{};
   char* d_chars{};
 
@@ -182,12 +217,13 @@ struct substring_from_fn {
   __device__ size_type operator()(size_type idx) {
     if (d_column.is_null(idx)) return 0;  // null string
     string_view d_str = d_column.template element<string_view>(idx);
-    size_type length  = d_str.length();
+    size_type length  = ascii ? d_str.size_bytes() : d_str.length();
     size_type start   = static_cast<size_type>(starts[idx]);
     if (start >= length) return 0;  // empty string
     size_type stop       = static_cast<size_type>(stops[idx]);
     size_type end        = (((stop < 0) || (stop > length)) ? length : stop);
-    string_view d_substr = d_str.substr(start, end - start);
+    string_view d_substr = ascii ? string_view(d_str.data() + start, end - start)
+                                 : d_str.substr(start, end - start);
     if (Pass == SizeOnly)
       return d_substr.size_bytes();
     else {
@@ -219,6 +255,7 @@ struct dispatch_substring_from_fn {
     auto strings_count  = strings.size();
     auto strings_column = column_device_view::create(strings.parent(), stream);
     auto d_column       = *strings_column;
+    bool const ascii    = is_ascii(strings, stream);
 
     // copy the null mask
     rmm::device_buffer null_mask;
@@ -227,9 +264,9 @@ struct dispatch_substring_from_fn {
       null_mask = rmm::device_buffer(
         d_column.null_mask(), cudf::bitmask_allocation_size_bytes(strings_count), stream, mr);
     // build offsets column
-    auto offsets_transformer_itr =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<PositionType>(0),
-                                      substring_from_fn<PositionType>{d_column, starts, stops});
+    auto offsets_transformer_itr = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<PositionType>(0),
+      substring_from_fn<PositionType>{d_column, starts, stops, ascii});
     auto offsets_column = cudf::strings::detail::make_offsets_child_column(
       offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
     auto offsets_view  = offsets_column->view();
@@ -245,7 +282,8 @@ struct dispatch_substring_from_fn {
       rmm::exec_policy(stream)->on(stream),
       thrust::make_counting_iterator<cudf::size_type>(0),
       strings_count,
-      substring_from_fn<PositionType, ExecuteOp>{d_column, starts, stops, d_new_offsets, d_chars});
+      substring_from_fn<PositionType, ExecuteOp>{
+        d_column, starts, stops, ascii, d_new_offsets, d_chars});
     //
     return make_strings_column(strings_count,
                                std::move(offsets_column),
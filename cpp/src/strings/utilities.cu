@@ -26,6 +26,7 @@
 #include <rmm/rmm.h>
 #include <rmm/rmm_api.h>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/logical.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 #include <mutex>
@@ -42,7 +43,7 @@ std::unique_ptr<string_view, std::function<void(string_view*)>> string_from_host
 
   auto* d_str = new rmm::device_buffer(length, stream);
   CUDA_TRY(cudaMemcpyAsync(d_str->data(), str, length, cudaMemcpyHostToDevice, stream));
-  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_STREAM_SYNC(stream);
 
   auto deleter = [d_str](string_view* sv) { delete d_str; };
   return std::unique_ptr<string_view, decltype(deleter)>{
@@ -90,21 +91,19 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   cudaStream_t stream) {
   size_type count = strings.size();
   auto d_strings  = strings.data().get();
-  auto execpol    = rmm::exec_policy(stream);
   size_type bytes = thrust::device_pointer_cast(d_offsets)[count];
 
   // create column
   auto chars_column =
     make_numeric_column(data_type{INT8}, bytes, mask_state::UNALLOCATED, stream, mr);
   // get it's view
-  auto d_chars = chars_column->mutable_view().data<int8_t>();
-  thrust::for_each_n(execpol->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     count,
-                     [d_strings, d_offsets, d_chars] __device__(size_type idx) {
-                       string_view const d_str = d_strings[idx];
-                       memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
-                     });
+  auto d_chars = chars_column->mutable_view().data<char>();
+  copy_chars([d_strings] __device__(size_type idx) { return d_strings[idx].data(); },
+             d_offsets,
+             count,
+             d_chars,
+             bytes,
+             stream);
 
   return chars_column;
 }
@@ -119,6 +118,19 @@ std::unique_ptr<column> create_chars_child_column(cudf::size_type strings_count,
   return make_numeric_column(data_type{INT8}, total_bytes, mask_state::UNALLOCATED, stream, mr);
 }
 
+//
+bool is_ascii(strings_column_view const& strings, cudaStream_t stream) {
+  if (strings.size() == 0) return true;
+  auto const d_offsets  = thrust::device_pointer_cast(strings.offsets().data<int32_t>());
+  size_type const begin = d_offsets[strings.offset()];
+  size_type const end   = d_offsets[strings.offset() + strings.size()];
+  auto const d_chars    = strings.chars().data<char>();
+  return thrust::none_of(
+    rmm::exec_policy(stream)->on(stream), d_chars + begin, d_chars + end, [] __device__(char chr) {
+      return (static_cast<uint8_t>(chr) & 0x80) != 0;
+    });
+}
+
 //
 std::unique_ptr<column> make_empty_strings_column(rmm::mr::device_memory_resource* mr,
                                                   cudaStream_t stream) {
@@ -16,10 +16,17 @@
 #pragma once
 
 //#include <bitmask/legacy/valid_if.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/partition.h>
 
 #include <cstring>
 
@@ -152,6 +159,131 @@ __host__ __device__ inline cudf::char_utf8 codepoint_to_utf8(uint32_t unchr) {
   return utf8;
 }
 
+/**
+ * @brief Strings of at least this many bytes are processed by a whole warp
+ * in `for_each_string()`.
+ */
+constexpr size_type LONG_STRING_BYTES = 512;
+
+/**
+ * @brief The threads processing a single string in `for_each_string()`.
+ *
+ * A short string is processed by a single thread and a long string by all the
+ * threads of a warp. Each thread has a `lane` in [0, `lanes`). The collective
+ * functions must be called by all the lanes of a string.
+ */
+struct string_lanes {
+  int32_t lane;
+  int32_t lanes;
+
+  /**
+   * @brief Returns true if `value` is true in any lane.
+   */
+  __device__ bool any(bool value) const {
+    return lanes == 1 ? value : __any_sync(0xffffffff, value);
+  }
+
+  /**
+   * @brief Returns the minimum `value` of all the lanes.
+   */
+  __device__ int32_t min(int32_t value) const {
+    for (int32_t delta = lanes / 2; delta > 0; delta /= 2)
+      value = ::min(value, __shfl_xor_sync(0xffffffff, value, delta));
+    return value;
+  }
+
+  /**
+   * @brief Returns the sum of `value` over all the lanes.
+   */
+  __device__ int32_t sum(int32_t value) const {
+    for (int32_t delta = lanes / 2; delta > 0; delta /= 2)
+      value += __shfl_xor_sync(0xffffffff, value, delta);
+    return value;
+  }
+
+  /**
+   * @brief Returns the sum of `value` over the lanes up to and including this one.
+   */
+  __device__ int32_t inclusive_scan(int32_t value) const {
+    for (int32_t delta = 1; delta < lanes; delta *= 2) {
+      auto const other = __shfl_up_sync(0xffffffff, value, delta);
+      if (lane >= delta) value += other;
+    }
+    return value;
+  }
+
+  /**
+   * @brief Returns the `value` of the last lane.
+   */
+  __device__ int32_t last(int32_t value) const {
+    return lanes == 1 ? value : __shfl_sync(0xffffffff, value, lanes - 1);
+  }
+};
+
+/**
+ * @brief Kernel calling `fn` with all the lanes of a warp for each row in `rows`.
+ */
+template <typename Function>
+__global__ void for_each_long_string_kernel(size_type const* rows, size_type count, Function fn) {
+  using cudf::experimental::detail::warp_size;
+  auto const warp_idx = static_cast<size_type>((threadIdx.x + blockIdx.x * blockDim.x) / warp_size);
+  if (warp_idx >= count) return;  // the same for all the lanes of a warp
+  fn(rows[warp_idx], string_lanes{static_cast<int32_t>(threadIdx.x % warp_size), warp_size});
+}
+
+/**
+ * @brief Calls `fn(idx, lanes)` for each string of a strings column, with a
+ * single thread for the strings shorter than `LONG_STRING_BYTES` and with all
+ * the threads of a warp for the longer ones.
+ *
+ * One thread per string is wildly imbalanced when the string sizes vary a lot,
+ * so the long strings are processed separately, as given by the offsets column.
+ *
+ * @tparam Function Functor storing its own results, with a
+ *         `__device__ void operator()(size_type, string_lanes const&) const`.
+ *
+ * @param strings Strings column to process.
+ * @param fn Function called for each string.
+ * @param stream Stream to use for any kernel calls.
+ */
+template <typename Function>
+void for_each_string(strings_column_view const& strings, Function fn, cudaStream_t stream = 0) {
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return;
+  auto const d_offsets = strings.offsets().data<int32_t>() + strings.offset();
+  auto execpol         = rmm::exec_policy(stream);
+  auto const is_long   = [d_offsets] __device__(size_type idx) {
+    return d_offsets[idx + 1] - d_offsets[idx] >= LONG_STRING_BYTES;
+  };
+  auto const short_fn = [fn] __device__(size_type idx) { fn(idx, string_lanes{0, 1}); };
+  auto const long_count = static_cast<size_type>(
+    thrust::count_if(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(strings_count),
+                     is_long));
+  if (long_count == 0) {
+    thrust::for_each_n(
+      execpol->on(stream), thrust::make_counting_iterator<size_type>(0), strings_count, short_fn);
+    return;
+  }
+
+  // long rows first, followed by the short ones
+  rmm::device_vector<size_type> rows(strings_count);
+  thrust::partition_copy(execpol->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         thrust::make_counting_iterator<size_type>(strings_count),
+                         rows.begin(),
+                         rows.begin() + long_count,
+                         is_long);
+  thrust::for_each(execpol->on(stream), rows.begin() + long_count, rows.end(), short_fn);
+  constexpr size_type block_size = 256;
+  cudf::experimental::detail::grid_1d grid{
+    long_count * cudf::experimental::detail::warp_size, block_size};
+  for_each_long_string_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+    rows.data().get(), long_count, fn);
+  CHECK_CUDA(stream);
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
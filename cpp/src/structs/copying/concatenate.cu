@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/structs/detail/concatenate.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+
+std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream) {
+  // empty columns may have no children and are skipped
+  std::vector<structs_column_view> structs;
+  size_type rows_count = 0;
+  size_type null_count = 0;
+  for (auto const& view : columns) {
+    rows_count += view.size();
+    null_count += view.null_count();
+    if (not view.is_empty()) structs.emplace_back(view);
+  }
+  if (rows_count == 0) return make_empty_column(data_type{STRUCT});
+
+  auto const fields_count = structs.front().num_children();
+  CUDF_EXPECTS(std::all_of(structs.begin(),
+                           structs.end(),
+                           [fields_count](auto const& s) {
+                             return s.num_children() == fields_count;
+                           }),
+               "Structs columns must have the same number of fields to concatenate");
+
+  // each field is concatenated from the rows of its structs columns
+  std::vector<std::unique_ptr<column>> child_columns;
+  for (size_type field = 0; field < fields_count; ++field) {
+    std::vector<column_view> children;
+    std::transform(structs.begin(),
+                   structs.end(),
+                   std::back_inserter(children),
+                   [field](auto const& s) { return s.sliced_child(field); });
+    child_columns.push_back(cudf::detail::concatenate(children, mr, stream));
+  }
+
+  rmm::device_buffer null_mask{0, stream, mr};
+  if (null_count > 0) {
+    null_mask = create_null_mask(rows_count, mask_state::UNINITIALIZED, stream, mr);
+    cudf::detail::concatenate_masks(
+      columns, static_cast<bitmask_type*>(null_mask.data()), stream);
+  }
+
+  return make_structs_column(
+    rows_count, std::move(child_columns), null_count, std::move(null_mask), stream, mr);
+}
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
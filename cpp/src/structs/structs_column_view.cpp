@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+
+structs_column_view::structs_column_view(column_view structs_column)
+  : column_view(structs_column) {
+  CUDF_EXPECTS(type().id() == STRUCT, "structs_column_view only supports structs");
+}
+
+column_view structs_column_view::parent() const { return static_cast<column_view>(*this); }
+
+column_view structs_column_view::sliced_child(size_type index) const {
+  CUDF_EXPECTS(index >= 0 && index < num_children(), "Invalid structs child index");
+  auto const child = column_view::child(index);
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < child.num_children(); ++idx) children.push_back(child.child(idx));
+  return column_view(child.type(),
+                     size(),
+                     child.head(),
+                     child.null_mask(),
+                     child.nullable() ? UNKNOWN_NULL_COUNT : 0,
+                     child.offset() + offset(),
+                     children);
+}
+
+}  // namespace cudf
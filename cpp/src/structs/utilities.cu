@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/structs/detail/utilities.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+namespace {
+
+/**
+ * @brief Flattens the columns of a table one at a time into `result`.
+ */
+struct table_flattener {
+  flattened_table& result;
+  std::vector<column_view> columns;
+  bool const with_orders;
+  bool const with_null_orders;
+  cudaStream_t stream;
+
+  /**
+   * @brief Returns `child` with the null rows of its struct column `parent`
+   * also null.
+   *
+   * The new mask has the bits of the rows before `child.offset()` as well,
+   * so that the view keeps the offset of `child` and its children.
+   */
+  column_view superimpose_nulls(column_view const& parent, column_view const& child) {
+    auto const parent_mask   = parent.null_mask();
+    auto const parent_offset = parent.offset();
+    auto const child_mask    = child.null_mask();
+    auto const child_offset  = child.offset();
+    auto mask                = experimental::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(child_offset + child.size()),
+      [parent_mask, parent_offset, child_mask, child_offset] __device__(size_type idx) {
+        if (idx < child_offset) { return true; }
+        return bit_is_set(parent_mask, parent_offset + idx - child_offset) and
+               (child_mask == nullptr or bit_is_set(child_mask, idx));
+      },
+      stream,
+      rmm::mr::get_default_resource(),
+      experimental::detail::null_count_policy::DEFER);
+    std::vector<column_view> children;
+    for (size_type idx = 0; idx < child.num_children(); ++idx) {
+      children.push_back(child.child(idx));
+    }
+    result.null_masks.emplace_back(std::move(mask.first));
+    return column_view(child.type(),
+                       child.size(),
+                       child.head(),
+                       static_cast<bitmask_type const*>(result.null_masks.back().data()),
+                       mask.second,
+                       child_offset,
+                       children);
+  }
+
+  void append(column_view const& col, order column_order, null_order null_precedence) {
+    columns.push_back(col);
+    if (with_orders) { result.orders.push_back(column_order); }
+    if (with_null_orders) { result.null_orders.push_back(null_precedence); }
+  }
+
+  void flatten(column_view const& col, order column_order, null_order null_precedence) {
+    if (col.type().id() != STRUCT) {
+      append(col, column_order, null_precedence);
+      return;
+    }
+    if (col.nullable() or col.num_children() == 0) {
+      auto const validity = column_view(
+        col.type(), col.size(), nullptr, col.null_mask(), col.null_count(), col.offset());
+      append(validity, column_order, null_precedence);
+    }
+    structs_column_view structs(col);
+    for (size_type idx = 0; idx < structs.num_children(); ++idx) {
+      auto child = structs.sliced_child(idx);
+      if (col.nullable()) { child = superimpose_nulls(col, child); }
+      flatten(child, column_order, null_precedence);
+    }
+  }
+};
+
+}  // namespace
+
+bool has_nested_columns(table_view const& input) {
+  return std::any_of(input.begin(), input.end(), [](auto const& col) {
+    return col.type().id() == STRUCT and col.num_children() > 0;
+  });
+}
+
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       cudaStream_t stream) {
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == size_t(input.num_columns()),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == size_t(input.num_columns()),
+               "Mismatch between number of columns and null_precedence size.");
+
+  flattened_table result;
+  table_flattener flattener{
+    result, {}, not column_order.empty(), not null_precedence.empty(), stream};
+  for (size_type idx = 0; idx < input.num_columns(); ++idx) {
+    flattener.flatten(input.column(idx),
+                      column_order.empty() ? order::ASCENDING : column_order[idx],
+                      null_precedence.empty() ? null_order::BEFORE : null_precedence[idx]);
+  }
+  result.flattened_columns = table_view{flattener.columns};
+  return result;
+}
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+
+chunked_column_view::chunked_column_view(std::vector<column_view> const& chunks)
+  : _chunks{chunks} {
+  CUDF_EXPECTS(not _chunks.empty(), "A chunked column needs at least one chunk");
+  for (auto const& chunk : _chunks) {
+    CUDF_EXPECTS(chunk.type() == _chunks.front().type(), "Chunk type mismatch.");
+    _size += chunk.size();
+  }
+}
+
+std::size_t chunked_column_view::null_count() const {
+  std::size_t count = 0;
+  for (auto const& chunk : _chunks) { count += chunk.null_count(); }
+  return count;
+}
+
+bool chunked_column_view::nullable() const {
+  return std::any_of(
+    _chunks.begin(), _chunks.end(), [](column_view const& chunk) { return chunk.nullable(); });
+}
+
+chunked_table_view::chunked_table_view(std::vector<table_view> const& chunks) : _chunks{chunks} {
+  CUDF_EXPECTS(not _chunks.empty(), "A chunked table needs at least one chunk");
+  auto const& first = _chunks.front();
+  for (auto const& chunk : _chunks) {
+    CUDF_EXPECTS(chunk.num_columns() == first.num_columns(), "Chunk column count mismatch.");
+    for (size_type i = 0; i < first.num_columns(); ++i) {
+      CUDF_EXPECTS(chunk.column(i).type() == first.column(i).type(), "Chunk type mismatch.");
+    }
+    _num_rows += chunk.num_rows();
+  }
+}
+
+chunked_column_view chunked_table_view::column(size_type column_index) const {
+  std::vector<column_view> columns(_chunks.size());
+  std::transform(_chunks.begin(), _chunks.end(), columns.begin(), [column_index](auto const& t) {
+    return t.column(column_index);
+  });
+  return chunked_column_view{columns};
+}
+
+chunked_table_view chunked_table_view::select(std::vector<size_type> const& column_indices) const {
+  std::vector<table_view> tables(_chunks.size());
+  std::transform(_chunks.begin(), _chunks.end(), tables.begin(), [&column_indices](auto const& t) {
+    return t.select(column_indices);
+  });
+  return chunked_table_view{tables};
+}
+
+}  // namespace cudf
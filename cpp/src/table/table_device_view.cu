@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/descriptor_pool.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +31,10 @@ namespace detail {
 
 template <typename ColumnDeviceView, typename HostTableView>
 void table_device_view_base<ColumnDeviceView, HostTableView>::destroy() {
+  if (_descriptor_block != nullptr) {
+    descriptor_pool::instance().release(_descriptor_block, _stream);
+  }
+  delete _descendant_storage;
   delete this;
 }
 
@@ -49,20 +54,29 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
       std::accumulate(source_view.begin(), source_view.end(), 0, [](std::size_t init, auto col) {
         return init + ColumnDeviceView::extent(col);
       });
-    // A buffer of CPU memory is allocated to hold the ColumnDeviceView
-    // objects. Once filled, the CPU memory is then copied to device memory
-    // and the pointer is set in the _columns member.
-    std::vector<int8_t> h_buffer(views_size_bytes);
-    ColumnDeviceView* h_column = reinterpret_cast<ColumnDeviceView*>(h_buffer.data());
+    // The ColumnDeviceView objects are created in CPU memory, then copied to
+    // device memory and the pointer is set in the _columns member. Narrow
+    // tables use a pooled pair of pinned and device blocks, so the copy needs
+    // neither an allocation nor a synchronization; wider tables allocate a
+    // device buffer and synchronize before the pageable CPU buffer is freed.
     // Each ColumnDeviceView instance may have child objects which may
     // require setting some internal device pointers before being copied
-    // from CPU to device.
-    // Allocate the device memory to be used in the result.
-    // We need this pointer in order to pass it down when creating the
-    // ColumnDeviceViews so the column can set the pointer(s) for any
-    // of its child objects.
-    _descendant_storage = new rmm::device_buffer(views_size_bytes, stream);
-    _columns            = reinterpret_cast<ColumnDeviceView*>(_descendant_storage->data());
+    // from CPU to device. We need the device pointer in order to pass it
+    // down when creating the ColumnDeviceViews so the column can set the
+    // pointer(s) for any of its child objects.
+    std::vector<int8_t> h_buffer;
+    int8_t* h_ptr     = nullptr;
+    _descriptor_block = descriptor_pool::instance().acquire(views_size_bytes);
+    if (_descriptor_block != nullptr) {
+      h_ptr    = static_cast<int8_t*>(_descriptor_block->host);
+      _columns = static_cast<ColumnDeviceView*>(_descriptor_block->device);
+    } else {
+      h_buffer.resize(views_size_bytes);
+      h_ptr               = h_buffer.data();
+      _descendant_storage = new rmm::device_buffer(views_size_bytes, stream);
+      _columns            = reinterpret_cast<ColumnDeviceView*>(_descendant_storage->data());
+    }
+    ColumnDeviceView* h_column = reinterpret_cast<ColumnDeviceView*>(h_ptr);
     // The beginning of the memory must be the fixed-sized ColumnDeviceView
     // objects in order for _columns to be used as an array. Therefore,
     // any child data is assigned to the end of this array (h_end/d_end).
@@ -82,9 +96,8 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
       d_end += col_child_data_size;
     }
 
-    CUDA_TRY(
-      cudaMemcpyAsync(_columns, h_buffer.data(), views_size_bytes, cudaMemcpyDefault, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDA_TRY(cudaMemcpyAsync(_columns, h_ptr, views_size_bytes, cudaMemcpyDefault, stream));
+    if (_descriptor_block == nullptr) { CUDF_STREAM_SYNC(stream); }
   }
 }
 
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/edit_distance.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+// strings of up to this many characters are matched with bit-parallel vectors
+constexpr cudf::size_type max_bit_parallel_chars = 64;
+
+/**
+ * @brief Computes the distance with Myers' bit-parallel algorithm as
+ * extended by Hyyrö to the edit distance of two whole strings.
+ *
+ * Each bit of the vectors is a character of `d_pattern`, which must have
+ * between 1 and 64 characters, and each iteration processes one character
+ * of `d_text`.
+ */
+__device__ int32_t bit_parallel_distance(cudf::string_view const& d_pattern,
+                                         cudf::string_view const& d_text) {
+  // the bits of the characters of the pattern, sorted by character
+  cudf::char_utf8 chars[max_bit_parallel_chars];
+  uint64_t masks[max_bit_parallel_chars];
+  cudf::size_type distinct = 0;
+  auto find = [&](cudf::char_utf8 chr) {
+    cudf::size_type lower = 0, upper = distinct;
+    while (lower < upper) {
+      auto const mid = (lower + upper) / 2;
+      if (chars[mid] < chr)
+        lower = mid + 1;
+      else
+        upper = mid;
+    }
+    return lower;
+  };
+  cudf::size_type length = 0;
+  for (auto const chr : d_pattern) {
+    auto const pos = find(chr);
+    if ((pos == distinct) || (chars[pos] != chr)) {
+      for (auto idx = distinct++; idx > pos; --idx) {
+        chars[idx] = chars[idx - 1];
+        masks[idx] = masks[idx - 1];
+      }
+      chars[pos] = chr;
+      masks[pos] = 0;
+    }
+    masks[pos] |= uint64_t{1} << length++;
+  }
+
+  uint64_t const last = uint64_t{1} << (length - 1);
+  uint64_t pv         = ~uint64_t{0};
+  uint64_t mv         = 0;
+  int32_t score       = length;
+  for (auto const chr : d_text) {
+    auto const pos    = find(chr);
+    uint64_t const eq = ((pos < distinct) && (chars[pos] == chr)) ? masks[pos] : 0;
+    uint64_t const xv = eq | mv;
+    uint64_t const xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph       = mv | ~(xh | pv);
+    uint64_t mh       = pv & xh;
+    if (ph & last)
+      ++score;
+    else if (mh & last)
+      --score;
+    ph = (ph << 1) | 1;  // the first row of the matrix increases by 1 in each column
+    mh <<= 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+  }
+  return score;
+}
+
+/**
+ * @brief Computes the distance with the classic dynamic programming
+ * algorithm using one row of `d_pattern.length() + 1` values.
+ */
+__device__ int32_t dynamic_distance(cudf::string_view const& d_pattern,
+                                    cudf::string_view const& d_text,
+                                    int32_t* d_row) {
+  auto const length = d_pattern.length();
+  for (cudf::size_type col = 0; col <= length; ++col) d_row[col] = col;
+  int32_t row = 0;
+  for (auto const text_chr : d_text) {
+    auto diagonal = d_row[0];
+    d_row[0]      = ++row;
+    auto col      = 1;
+    for (auto const pattern_chr : d_pattern) {
+      auto const above = d_row[col];
+      auto const value = min(above, d_row[col - 1]) + 1;
+      d_row[col]       = min(value, diagonal + (pattern_chr != text_chr));
+      diagonal         = above;
+      ++col;
+    }
+  }
+  return d_row[length];
+}
+
+/**
+ * @brief Computes the edit distances of pairs of strings.
+ *
+ * For the matrix of a column, pair `idx` is the strings `idx / size` and
+ * `idx % size` and only the pairs above the diagonal are computed, writing
+ * both symmetric results. Otherwise, pair `idx` is string `idx` and target
+ * `idx` (or the only target).
+ *
+ * The pairs with both strings longer than `max_bit_parallel_chars` need
+ * `scratch_size()` values of scratch memory at `d_scratch_offsets[idx]`.
+ */
+struct edit_distance_fn {
+  cudf::column_device_view const d_strings;
+  cudf::column_device_view const d_targets;
+  bool const matrix;
+  size_t const* d_scratch_offsets{};
+  int32_t* d_scratch{};
+  int32_t* d_results{};
+
+  __device__ cudf::string_view element(cudf::column_device_view const& d_column,
+                                       cudf::size_type idx) const {
+    return d_column.is_null(idx) ? cudf::string_view{}
+                                 : d_column.element<cudf::string_view>(idx);
+  }
+
+  __device__ thrust::pair<cudf::size_type, cudf::size_type> pair_rows(cudf::size_type idx) const {
+    if (matrix) return {idx / d_strings.size(), idx % d_strings.size()};
+    return {idx, d_targets.size() == 1 ? 0 : idx};
+  }
+
+  __device__ size_t scratch_size(cudf::size_type idx) const {
+    auto const rows = pair_rows(idx);
+    if (matrix && (rows.first >= rows.second)) return 0;
+    auto const length = min(element(d_strings, rows.first).length(),
+                            element(d_targets, rows.second).length());
+    return length > max_bit_parallel_chars ? length + 1 : 0;
+  }
+
+  __device__ void operator()(cudf::size_type idx) const {
+    auto const rows = pair_rows(idx);
+    if (matrix && (rows.first >= rows.second)) {
+      if (rows.first == rows.second) d_results[idx] = 0;
+      return;
+    }
+    auto d_pattern = element(d_strings, rows.first);
+    auto d_text    = element(d_targets, rows.second);
+    if (d_pattern.length() > d_text.length()) thrust::swap(d_pattern, d_text);
+    auto const length = d_pattern.length();
+    int32_t const distance =
+      length == 0 ? d_text.length()
+                  : length <= max_bit_parallel_chars
+                      ? bit_parallel_distance(d_pattern, d_text)
+                      : dynamic_distance(d_pattern, d_text, d_scratch + d_scratch_offsets[idx]);
+    d_results[idx] = distance;
+    if (matrix) d_results[rows.second * d_strings.size() + rows.first] = distance;
+  }
+};
+
+std::unique_ptr<cudf::column> compute_distances(cudf::column_view const& strings,
+                                                cudf::column_view const& targets,
+                                                bool matrix,
+                                                cudf::size_type pairs_count,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream) {
+  auto results = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, pairs_count, cudf::mask_state::UNALLOCATED, stream, mr);
+  if (pairs_count == 0) return results;
+
+  auto execpol        = rmm::exec_policy(stream);
+  auto strings_column = cudf::column_device_view::create(strings, stream);
+  auto targets_column = cudf::column_device_view::create(targets, stream);
+  edit_distance_fn fn{*strings_column, *targets_column, matrix};
+
+  // only the pairs of long strings need scratch memory
+  rmm::device_vector<size_t> scratch_offsets(pairs_count + 1, 0);
+  thrust::transform_inclusive_scan(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(pairs_count),
+    scratch_offsets.begin() + 1,
+    [fn] __device__(cudf::size_type idx) { return fn.scratch_size(idx); },
+    thrust::plus<size_t>());
+  rmm::device_vector<int32_t> scratch(scratch_offsets.back());
+
+  fn.d_scratch_offsets = scratch_offsets.data().get();
+  fn.d_scratch         = scratch.data().get();
+  fn.d_results         = results->mutable_view().data<int32_t>();
+  thrust::for_each_n(
+    execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0), pairs_count, fn);
+  return results;
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream = 0) {
+  CUDF_EXPECTS((targets.size() == 1) || (targets.size() == strings.size()),
+               "targets must have a single string or the same number of strings as strings");
+  auto const strings_count = targets.size() == 0 ? 0 : strings.size();
+  return compute_distances(strings.parent(), targets.parent(), false, strings_count, mr, stream);
+}
+
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream = 0) {
+  auto const strings_count = static_cast<int64_t>(strings.size());
+  CUDF_EXPECTS(strings_count * strings_count <= std::numeric_limits<cudf::size_type>::max(),
+               "too many strings to compute all the edit distances");
+  return compute_distances(strings.parent(),
+                           strings.parent(),
+                           true,
+                           static_cast<cudf::size_type>(strings_count * strings_count),
+                           mr,
+                           stream);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, targets, mr);
+}
+
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_matrix(strings, mr);
+}
+
+}  // namespace nvtext
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes the minimum hash of the character ngrams of a string for a seed.
+ *
+ * Row `idx` of the output is string `idx / seeds_count` and seed `idx % seeds_count`.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  int32_t const* d_seeds;
+  cudf::size_type const seeds_count;
+  cudf::size_type const width;
+
+  __device__ int32_t operator()(cudf::size_type idx) const {
+    auto const row = idx / seeds_count;
+    if (d_strings.is_null(row)) return 0;
+    auto const d_str = d_strings.element<cudf::string_view>(row);
+    auto const data  = d_str.data();
+    auto const bytes = d_str.size_bytes();
+    MurmurHash3_32<cudf::string_view> const hasher(
+      static_cast<uint32_t>(d_seeds[idx % seeds_count]));
+    // the ngram of the characters [begin, end) slides by one character at a time
+    auto next_character = [data, bytes](cudf::size_type pos) {
+      do { ++pos; } while ((pos < bytes) && ((static_cast<uint8_t>(data[pos]) & 0xC0) == 0x80));
+      return pos;
+    };
+    cudf::size_type begin = 0;
+    cudf::size_type end   = 0;
+    for (cudf::size_type n = 0; (n < width) && (end < bytes); ++n) end = next_character(end);
+    uint32_t result = std::numeric_limits<uint32_t>::max();
+    while (true) {
+      auto const hash = hasher(cudf::string_view(data + begin, end - begin));
+      result          = min(result, hash);
+      if (end >= bytes) break;
+      begin = next_character(begin);
+      end   = next_character(end);
+    }
+    return static_cast<int32_t>(result);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream = 0) {
+  CUDF_EXPECTS(seeds.type().id() == cudf::INT32, "seeds must be an INT32 column");
+  CUDF_EXPECTS(!seeds.has_nulls(), "seeds must not have nulls");
+  CUDF_EXPECTS(width >= 1, "Parameter width should be an integer value of 1 or greater");
+  auto const output_size = static_cast<int64_t>(strings.size()) * seeds.size();
+  CUDF_EXPECTS(output_size <= std::numeric_limits<cudf::size_type>::max(),
+               "too many strings and seeds for the size of the output column");
+  auto const rows_count  = static_cast<cudf::size_type>(output_size);
+  auto const seeds_count = seeds.size();
+
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  // the rows of a null string are null
+  auto null_mask = cudf::experimental::detail::valid_if(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(rows_count),
+    [d_strings, seeds_count] __device__(cudf::size_type idx) {
+      return d_strings.is_valid(idx / seeds_count);
+    },
+    stream,
+    mr,
+    cudf::experimental::detail::null_count_policy::DEFER);
+  auto results = cudf::make_numeric_column(cudf::data_type{cudf::INT32},
+                                           rows_count,
+                                           std::move(null_mask.first),
+                                           null_mask.second,
+                                           stream,
+                                           mr);
+  if (rows_count == 0) return results;
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(rows_count),
+                    results->mutable_view().data<int32_t>(),
+                    minhash_fn{d_strings, seeds.data<int32_t>(), seeds_count, width});
+  return results;
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, mr);
+}
+
+}  // namespace nvtext
@@ -18,6 +18,8 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -120,6 +122,123 @@ struct ngram_builder_fn {
   }
 };
 
+/**
+ * @brief MurmurHash3_32 computed over bytes added one at a time.
+ *
+ * The result is the same as `MurmurHash3_32<string_view>` of the
+ * concatenation of the added bytes.
+ */
+struct murmur_hash_stream {
+  MurmurHash3_32<cudf::string_view> const hasher{};
+  uint32_t h1{0};
+  uint32_t block{0};
+  cudf::size_type length{0};
+
+  __device__ uint32_t mix_block(uint32_t k1) const {
+    k1 *= 0xcc9e2d51;
+    k1 = hasher.rotl32(k1, 15);
+    return k1 * 0x1b873593;
+  }
+
+  __device__ void add(const char* data, cudf::size_type bytes) {
+    for (cudf::size_type idx = 0; idx < bytes; ++idx) {
+      block |= static_cast<uint32_t>(static_cast<uint8_t>(data[idx])) << (8 * (length & 3));
+      if ((++length & 3) == 0) {
+        h1 ^= mix_block(block);
+        h1    = hasher.rotl32(h1, 13) * 5 + 0xe6546b64;
+        block = 0;
+      }
+    }
+  }
+
+  __device__ uint32_t hash() const {
+    auto result = h1;
+    if (length & 3) result ^= mix_block(block);
+    return hasher.fmix32(result ^ length);
+  }
+};
+
+/**
+ * @brief Computes the number of ngrams of each string, and writes their
+ * hashes once `d_offsets` is set.
+ */
+struct hash_ngrams_fn {
+  cudf::column_device_view const d_strings;  // strings to generate ngrams from
+  cudf::string_view const d_delimiter;       // delimiter to tokenize around
+  cudf::string_view const d_separator;       // hashed between the tokens of an ngram
+  cudf::size_type const ngrams;              // number of tokens or characters of an ngram
+  ngram_type const type;
+  int32_t const* d_offsets{};  // offsets of the hashes of each string
+  int32_t* d_hashes{};         // write the hashes to here
+
+  __device__ cudf::size_type token_ngrams(cudf::string_view const& d_str,
+                                          int32_t* d_output) const {
+    characters_tokenizer first(d_str, d_delimiter);  // first token of the window
+    characters_tokenizer last(d_str, d_delimiter);   // last token of the window
+    for (cudf::size_type n = 1; n < ngrams; ++n) {
+      if (!last.next_token()) return 0;
+    }
+    cudf::size_type count = 0;
+    while (last.next_token()) {
+      first.next_token();
+      if (d_output) {
+        murmur_hash_stream stream;
+        auto window = first;
+        for (cudf::size_type n = 0; n < ngrams; ++n) {
+          if (n > 0) {
+            window.next_token();
+            stream.add(d_separator.data(), d_separator.size_bytes());
+          }
+          auto const position = window.token_byte_positions();
+          stream.add(d_str.data() + position.first, position.second - position.first);
+        }
+        d_output[count] = static_cast<int32_t>(stream.hash());
+      }
+      ++count;
+    }
+    return count;
+  }
+
+  __device__ cudf::size_type character_ngrams(cudf::string_view const& d_str,
+                                              int32_t* d_output) const {
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    cudf::size_type count = 0;
+    while (tokenizer.next_token()) {
+      auto const position = tokenizer.token_byte_positions();
+      auto const data     = d_str.data() + position.first;
+      auto const bytes    = position.second - position.first;
+      auto next_character = [data, bytes](cudf::size_type pos) {
+        do { ++pos; } while ((pos < bytes) && ((static_cast<uint8_t>(data[pos]) & 0xC0) == 0x80));
+        return pos;
+      };
+      cudf::size_type begin = 0;
+      cudf::size_type end   = 0;
+      cudf::size_type n     = 0;
+      for (; (n < ngrams) && (end < bytes); ++n) end = next_character(end);
+      if (n < ngrams) continue;
+      while (true) {
+        if (d_output) {
+          d_output[count] = static_cast<int32_t>(
+            MurmurHash3_32<cudf::string_view>{}(cudf::string_view(data + begin, end - begin)));
+        }
+        ++count;
+        if (end == bytes) break;
+        begin = next_character(begin);
+        end   = next_character(end);
+      }
+    }
+    return count;
+  }
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const {
+    if (d_strings.is_null(idx)) return 0;
+    cudf::string_view d_str = d_strings.element<cudf::string_view>(idx);
+    auto d_output           = d_hashes ? d_hashes + d_offsets[idx] : nullptr;
+    return type == ngram_type::CHARACTERS ? character_ngrams(d_str, d_output)
+                                          : token_ngrams(d_str, d_output);
+  }
+};
+
 }  // namespace
 
 // detail APIs
@@ -246,6 +365,48 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
                              mr);
 }
 
+hashed_ngrams hash_ngrams_tokenize(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 2,
+  ngram_type type                      = ngram_type::TOKENS,
+  cudf::string_scalar const& delimiter = cudf::string_scalar(""),
+  cudf::string_scalar const& separator = cudf::string_scalar{" "},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource(),
+  cudaStream_t stream                  = 0) {
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  CUDF_EXPECTS(separator.is_valid(), "Parameter separator must be valid");
+  cudf::string_view d_separator(separator.data(), separator.size());
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+
+  auto strings_count  = strings.size();
+  auto execpol        = rmm::exec_policy(stream);
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  hash_ngrams_fn fn{*strings_column, d_delimiter, d_separator, ngrams, type};
+
+  // get the number of ngrams of each string
+  rmm::device_vector<int32_t> ngram_counts(strings_count);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    ngram_counts.begin(),
+                    fn);
+  auto row_offsets = cudf::strings::detail::make_offsets_child_column(
+    ngram_counts.begin(), ngram_counts.end(), mr, stream);
+  auto const d_row_offsets = row_offsets->view().data<int32_t>();
+  cudf::size_type const total_ngrams =
+    thrust::device_pointer_cast(d_row_offsets)[strings_count];
+
+  // hash the ngrams of each string
+  auto hashes = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, total_ngrams, cudf::mask_state::UNALLOCATED, stream, mr);
+  fn.d_offsets = d_row_offsets;
+  fn.d_hashes  = hashes->mutable_view().data<int32_t>();
+  thrust::for_each_n(
+    execpol->on(stream), thrust::make_counting_iterator<cudf::size_type>(0), strings_count, fn);
+  return hashed_ngrams{std::move(row_offsets), std::move(hashes)};
+}
+
 }  // namespace detail
 
 // external APIs
@@ -259,4 +420,14 @@ std::unique_ptr<cudf::column> ngrams_tokenize(cudf::strings_column_view const& s
   return detail::ngrams_tokenize(strings, ngrams, delimiter, separator, mr);
 }
 
+hashed_ngrams hash_ngrams_tokenize(cudf::strings_column_view const& strings,
+                                   cudf::size_type ngrams,
+                                   ngram_type type,
+                                   cudf::string_scalar const& delimiter,
+                                   cudf::string_scalar const& separator,
+                                   rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::hash_ngrams_tokenize(strings, ngrams, type, delimiter, separator, mr);
+}
+
 }  // namespace nvtext
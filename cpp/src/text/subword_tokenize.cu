@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/subword_tokenize.hpp>
+
+#include <thrust/device_ptr.h>
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/find.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+using string_index_pair = thrust::pair<const char*, cudf::size_type>;
+
+// the prefix of the tokens continuing a word
+constexpr cudf::size_type continuation_prefix_bytes = 2;
+
+__device__ bool is_continuation_token(cudf::string_view const& d_token) {
+  return d_token.size_bytes() > continuation_prefix_bytes && d_token.data()[0] == '#' &&
+         d_token.data()[1] == '#';
+}
+
+__device__ bool is_utf8_continuation_byte(char chr) {
+  return (static_cast<uint8_t>(chr) & 0xC0) == 0x80;
+}
+
+__device__ bool is_space(char chr) { return static_cast<uint8_t>(chr) <= ' '; }
+
+__device__ bool is_punctuation(char chr) {
+  auto const c = static_cast<uint8_t>(chr);
+  return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') ||
+         (c >= '{' && c <= '~');
+}
+
+/**
+ * @brief Open addressing hash table of the rows of a vocabulary.
+ *
+ * The tokens starting a word are in the first `table_size` slots, and the
+ * tokens continuing a word are in the next `table_size` slots, hashed
+ * without their "##" prefix.
+ */
+struct vocabulary_table {
+  cudf::column_device_view const d_vocabulary;
+  int32_t* d_table;
+  cudf::size_type const table_size;  // power of 2
+
+  __device__ cudf::size_type first_slot(cudf::string_view const& d_key) const {
+    return MurmurHash3_32<cudf::string_view>{}(d_key) & (table_size - 1);
+  }
+
+  // insert the row of a token
+  __device__ void operator()(cudf::size_type idx) const {
+    auto d_token            = d_vocabulary.element<cudf::string_view>(idx);
+    bool const continuation = is_continuation_token(d_token);
+    if (continuation) {
+      d_token = cudf::string_view(d_token.data() + continuation_prefix_bytes,
+                                  d_token.size_bytes() - continuation_prefix_bytes);
+    }
+    auto const table = d_table + (continuation ? table_size : 0);
+    auto slot        = first_slot(d_token);
+    while (atomicCAS(table + slot, -1, idx) != -1) { slot = (slot + 1) & (table_size - 1); }
+  }
+
+  /**
+   * @brief Returns the row of the token matching the bytes, or -1 if there is none.
+   */
+  __device__ int32_t find(const char* data, cudf::size_type bytes, bool continuation) const {
+    cudf::string_view const d_key(data, bytes);
+    auto const table  = d_table + (continuation ? table_size : 0);
+    auto const prefix = continuation ? continuation_prefix_bytes : 0;
+    for (auto slot = first_slot(d_key);; slot = (slot + 1) & (table_size - 1)) {
+      auto const idx = table[slot];
+      if (idx < 0) return -1;
+      auto const d_token = d_vocabulary.element<cudf::string_view>(idx);
+      if ((d_token.size_bytes() == bytes + prefix) &&
+          thrust::equal(thrust::seq, data, data + bytes, d_token.data() + prefix))
+        return idx;
+    }
+  }
+};
+
+/**
+ * @brief Computes the number of token ids of each string, and writes them
+ * once `d_offsets` is set.
+ */
+struct wordpiece_tokenizer_fn {
+  cudf::column_device_view const d_strings;
+  vocabulary_table const vocabulary;
+  int32_t const unknown_token_id;
+  cudf::size_type const max_word_length;
+  cudf::size_type const max_tokens;  // std::numeric_limits<size_type>::max() for no maximum
+  int32_t const* d_offsets{};
+  int32_t* d_token_ids{};
+
+  /**
+   * @brief Splits a word into the longest tokens from left to right.
+   *
+   * Writes at most `limit` token ids to `d_output` if it is not null.
+   *
+   * @return The number of tokens of the word, or 0 if it cannot be split.
+   */
+  __device__ cudf::size_type tokenize_word(const char* word,
+                                           cudf::size_type bytes,
+                                           int32_t* d_output,
+                                           cudf::size_type limit) const {
+    cudf::size_type count = 0;
+    cudf::size_type begin = 0;
+    while (begin < bytes) {
+      auto end   = bytes;
+      int32_t id = -1;
+      while (end > begin) {
+        id = vocabulary.find(word + begin, end - begin, begin > 0);
+        if (id >= 0) break;
+        // the longest shorter piece ending at a character boundary
+        do { --end; } while ((end > begin) && is_utf8_continuation_byte(word[end]));
+      }
+      if (id < 0) return 0;
+      if (d_output && (count < limit)) d_output[count] = id;
+      ++count;
+      begin = end;
+    }
+    return count;
+  }
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const {
+    if (d_strings.is_null(idx)) return 0;
+    auto const d_str    = d_strings.element<cudf::string_view>(idx);
+    auto const data     = d_str.data();
+    auto const bytes    = d_str.size_bytes();
+    auto const d_output = d_token_ids ? d_token_ids + d_offsets[idx] : nullptr;
+    cudf::size_type count = 0;
+    cudf::size_type pos   = 0;
+    while ((pos < bytes) && (count < max_tokens)) {
+      while ((pos < bytes) && is_space(data[pos])) ++pos;
+      if (pos == bytes) break;
+      auto const begin      = pos;
+      cudf::size_type chars = 1;
+      if (is_punctuation(data[pos++])) {
+        // a punctuation character is a word
+      } else {
+        for (; (pos < bytes) && !is_space(data[pos]) && !is_punctuation(data[pos]); ++pos) {
+          if (!is_utf8_continuation_byte(data[pos])) ++chars;
+        }
+      }
+      auto const word   = data + begin;
+      auto const length = pos - begin;
+      auto const pieces = chars <= max_word_length ? tokenize_word(word, length, nullptr, 0) : 0;
+      if (pieces == 0) {
+        if (d_output) d_output[count] = unknown_token_id;
+        ++count;
+      } else {
+        if (d_output) tokenize_word(word, length, d_output + count, max_tokens - count);
+        count += pieces;
+      }
+    }
+    return count < max_tokens ? count : max_tokens;
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief The members of a `wordpiece_vocabulary`
+ */
+struct vocabulary_parts {
+  std::unique_ptr<cudf::column> vocabulary;
+  std::unique_ptr<cudf::column> table;
+  int32_t unknown_token_id;
+};
+
+vocabulary_parts build_vocabulary(cudf::strings_column_view const& vocabulary,
+                                  std::string const& unknown_token,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream = 0) {
+  CUDF_EXPECTS(vocabulary.size() > 0, "Parameter vocabulary must not be empty");
+  CUDF_EXPECTS(!vocabulary.has_nulls(), "Parameter vocabulary must not have nulls");
+  auto const tokens_count = vocabulary.size();
+  auto execpol            = rmm::exec_policy(stream);
+  vocabulary_parts result;
+
+  // own a copy of the tokens so the table rows stay valid
+  auto input_column = cudf::column_device_view::create(vocabulary.parent(), stream);
+  auto d_input      = *input_column;
+  rmm::device_vector<string_index_pair> tokens(tokens_count);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(tokens_count),
+                    tokens.begin(),
+                    [d_input] __device__(cudf::size_type idx) {
+                      auto const d_token = d_input.element<cudf::string_view>(idx);
+                      return string_index_pair{d_token.data(), d_token.size_bytes()};
+                    });
+  result.vocabulary = cudf::make_strings_column(tokens, stream, mr);
+
+  // each half of the table is at most half full
+  cudf::size_type table_size = 1;
+  while (table_size < 2 * tokens_count) table_size *= 2;
+  result.table = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, 2 * table_size, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const d_table = result.table->mutable_view().data<int32_t>();
+  thrust::fill_n(execpol->on(stream), d_table, 2 * table_size, -1);
+  auto vocabulary_column = cudf::column_device_view::create(result.vocabulary->view(), stream);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     tokens_count,
+                     vocabulary_table{*vocabulary_column, d_table, table_size});
+
+  cudf::string_scalar const unknown(unknown_token);
+  cudf::string_view const d_unknown(unknown.data(), unknown.size());
+  auto const d_vocabulary = *vocabulary_column;
+  auto const found =
+    thrust::find_if(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(tokens_count),
+                    [d_vocabulary, d_unknown] __device__(cudf::size_type idx) {
+                      return d_vocabulary.element<cudf::string_view>(idx) == d_unknown;
+                    });
+  result.unknown_token_id = *found;
+  CUDF_EXPECTS(result.unknown_token_id < tokens_count,
+               "The unknown token must be in the vocabulary");
+  return result;
+}
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(std::string const& filename,
+                                                           std::string const& unknown_token,
+                                                           rmm::mr::device_memory_resource* mr,
+                                                           cudaStream_t stream = 0) {
+  std::ifstream input(filename);
+  CUDF_EXPECTS(input.is_open(), "Could not open vocabulary file " + filename);
+  std::vector<char> chars;
+  std::vector<cudf::size_type> offsets{0};
+  std::string line;
+  while (std::getline(input, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    chars.insert(chars.end(), line.begin(), line.end());
+    offsets.push_back(static_cast<cudf::size_type>(chars.size()));
+  }
+  auto const tokens = cudf::make_strings_column(chars, offsets, {}, 0, stream);
+  return std::make_unique<wordpiece_vocabulary>(tokens->view(), unknown_token, mr);
+}
+
+subword_tokenize_result subword_tokenize(cudf::strings_column_view const& strings,
+                                         wordpiece_vocabulary const& vocabulary,
+                                         cudf::size_type max_sequence_length,
+                                         int32_t padding_id,
+                                         cudf::size_type max_word_length,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream = 0) {
+  CUDF_EXPECTS(max_sequence_length >= 0, "Parameter max_sequence_length must not be negative");
+  CUDF_EXPECTS(max_word_length >= 0, "Parameter max_word_length must not be negative");
+  auto const strings_count = strings.size();
+  auto const padded        = max_sequence_length > 0;
+  auto execpol             = rmm::exec_policy(stream);
+
+  auto strings_column    = cudf::column_device_view::create(strings.parent(), stream);
+  auto vocabulary_column =
+    cudf::column_device_view::create(vocabulary.vocabulary().parent(), stream);
+  auto const table       = vocabulary.hash_table();
+  wordpiece_tokenizer_fn tokenizer{
+    *strings_column,
+    vocabulary_table{*vocabulary_column,
+                     const_cast<int32_t*>(table.data<int32_t>()),
+                     table.size() / 2},
+    vocabulary.unknown_token_id(),
+    max_word_length,
+    padded ? max_sequence_length : std::numeric_limits<cudf::size_type>::max()};
+
+  // get the number of tokens of each string
+  rmm::device_vector<cudf::size_type> token_counts(strings_count);
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    token_counts.begin(),
+                    tokenizer);
+
+  // the rows of each string are consecutive
+  std::unique_ptr<cudf::column> row_offsets;
+  if (padded) {
+    row_offsets = cudf::make_numeric_column(
+      cudf::data_type{cudf::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<int32_t>(0),
+                      thrust::make_counting_iterator<int32_t>(strings_count + 1),
+                      row_offsets->mutable_view().data<int32_t>(),
+                      [max_sequence_length] __device__(int32_t idx) {
+                        return idx * max_sequence_length;
+                      });
+  } else {
+    row_offsets = cudf::strings::detail::make_offsets_child_column(
+      token_counts.begin(), token_counts.end(), mr, stream);
+  }
+  auto const d_row_offsets = row_offsets->view().data<int32_t>();
+  cudf::size_type const total_rows =
+    padded ? strings_count * max_sequence_length
+           : thrust::device_pointer_cast(d_row_offsets)[strings_count];
+
+  // write the token ids of each string over the padding
+  auto token_ids = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, total_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const d_token_ids = token_ids->mutable_view().data<int32_t>();
+  if (padded) thrust::fill_n(execpol->on(stream), d_token_ids, total_rows, padding_id);
+  tokenizer.d_offsets   = d_row_offsets;
+  tokenizer.d_token_ids = d_token_ids;
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     tokenizer);
+
+  // only the padding rows are masked
+  auto attention_mask = cudf::make_numeric_column(
+    cudf::data_type{cudf::INT32}, total_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const d_attention_mask = attention_mask->mutable_view().data<int32_t>();
+  if (padded) {
+    auto const d_token_counts = token_counts.data().get();
+    thrust::transform(execpol->on(stream),
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(total_rows),
+                      d_attention_mask,
+                      [d_token_counts, max_sequence_length] __device__(cudf::size_type idx) {
+                        return static_cast<int32_t>((idx % max_sequence_length) <
+                                                    d_token_counts[idx / max_sequence_length]);
+                      });
+  } else {
+    thrust::fill_n(execpol->on(stream), d_attention_mask, total_rows, 1);
+  }
+  return subword_tokenize_result{
+    std::move(row_offsets), std::move(token_ids), std::move(attention_mask)};
+}
+
+}  // namespace detail
+
+wordpiece_vocabulary::wordpiece_vocabulary(cudf::strings_column_view const& vocabulary,
+                                           std::string const& unknown_token,
+                                           rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  auto parts        = detail::build_vocabulary(vocabulary, unknown_token, mr);
+  _vocabulary       = std::move(parts.vocabulary);
+  _table            = std::move(parts.table);
+  _unknown_token_id = parts.unknown_token_id;
+}
+
+// external APIs
+
+std::unique_ptr<wordpiece_vocabulary> load_vocabulary_file(std::string const& filename,
+                                                           std::string const& unknown_token,
+                                                           rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::load_vocabulary_file(filename, unknown_token, mr);
+}
+
+subword_tokenize_result subword_tokenize(cudf::strings_column_view const& strings,
+                                         wordpiece_vocabulary const& vocabulary,
+                                         cudf::size_type max_sequence_length,
+                                         int32_t padding_id,
+                                         cudf::size_type max_word_length,
+                                         rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(
+    strings, vocabulary, max_sequence_length, padding_id, max_word_length, mr);
+}
+
+}  // namespace nvtext
@@ -24,6 +24,7 @@ namespace jit {
 namespace code {
 
 extern const char* kernel;
+extern const char* multi_kernel;
 extern const char* traits;
 extern const char* operation;
 
@@ -42,6 +42,26 @@ const char* kernel =
     }
 )***";
 
+// Follows the code of `apply_transform`, generated for the types of each transform
+const char* multi_kernel =
+  R"***(
+    __global__
+    void multi_kernel(cudf::size_type size,
+                      void* const* outputs, void const* const* inputs) {
+        int tid = threadIdx.x;
+        int blkid = blockIdx.x;
+        int blksz = blockDim.x;
+        int gridsz = gridDim.x;
+
+        int start = tid + blkid * blksz;
+        int step = blksz * gridsz;
+
+        for (cudf::size_type i=start; i<size; i+=step) {
+          apply_transform(i, outputs, inputs);
+        }
+    }
+)***";
+
 }  // namespace code
 }  // namespace jit
 }  // namespace transformation
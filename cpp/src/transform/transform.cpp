@@ -19,6 +19,8 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -27,8 +29,13 @@
 #include <jit/type.h>
 #include "jit/code/code.h"
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <types.hpp.jit>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace experimental {
 namespace transformation {
@@ -68,6 +75,55 @@ void unary_operation(mutable_column_view output,
     .launch(output.size(), cudf::jit::get_data_ptr(output), cudf::jit::get_data_ptr(input));
 }
 
+void multi_input_operation(std::vector<mutable_column_view> const& outputs,
+                           table_view const& inputs,
+                           const std::string& udf,
+                           bool is_ptx,
+                           cudaStream_t stream) {
+  std::string cuda_source = "\n#include <cudf/types.hpp>\n";
+  if (is_ptx) {
+    cuda_source += cudf::jit::parse_single_function_ptx(
+      udf, "GENERIC_TRANSFORM_OP", cudf::jit::get_type_name(outputs.front().type()), {0});
+  } else {
+    cuda_source += "\n" + cudf::jit::parse_single_function_cuda(udf, "GENERIC_TRANSFORM_OP");
+  }
+
+  // The UDF takes a pointer to the row of each output, then the row of each input
+  std::vector<void*> output_ptrs;
+  std::vector<void const*> input_ptrs;
+  std::string arguments;
+  for (auto const& output : outputs) {
+    arguments += (arguments.empty() ? "" : ", ") + std::string{"&static_cast<"} +
+                 cudf::jit::get_type_name(output.type()) + "*>(outputs[" +
+                 std::to_string(output_ptrs.size()) + "])[i]";
+    output_ptrs.push_back(cudf::jit::get_data_ptr(output));
+  }
+  for (auto const& input : inputs) {
+    arguments += ", static_cast<" + cudf::jit::get_type_name(input.type()) +
+                 " const*>(inputs[" + std::to_string(input_ptrs.size()) + "])[i]";
+    input_ptrs.push_back(cudf::jit::get_data_ptr(input));
+  }
+  cuda_source +=
+    "\n__device__ void apply_transform(cudf::size_type i, void* const* outputs, "
+    "void const* const* inputs) {\n  GENERIC_TRANSFORM_OP(" +
+    arguments + ");\n}\n" + code::multi_kernel;
+
+  std::string hash = "prog_transform.experimental.multi." +
+                     std::to_string(std::hash<std::string>{}(cuda_source));
+
+  const std::vector<std::string> compiler_flags{"-std=c++14",
+                                                // Have jitify prune unused global variables
+                                                "-remove-unused-globals",
+                                                // suppress all NVRTC warnings
+                                                "-w"};
+
+  rmm::device_vector<void*> d_outputs(output_ptrs);
+  rmm::device_vector<void const*> d_inputs(input_ptrs);
+  cudf::jit::launcher(hash, cuda_source, {cudf_types_hpp}, compiler_flags, nullptr, stream)
+    .set_kernel_inst("multi_kernel", {})  // the types are in the generated apply_transform
+    .launch(inputs.num_rows(), d_outputs.data().get(), d_inputs.data().get());
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -94,6 +150,45 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<table> transform(table_view const& inputs,
+                                 std::string const& udf,
+                                 std::vector<data_type> const& output_types,
+                                 bool is_ptx,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) {
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column");
+  CUDF_EXPECTS(!output_types.empty(), "Transform requires at least one output type");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](auto const& input) { return is_numeric(input.type()); }),
+               "Unexpected non-numeric type.");
+  CUDF_EXPECTS(std::all_of(output_types.begin(),
+                           output_types.end(),
+                           [](auto const& type) { return is_numeric(type); }),
+               "Unexpected non-numeric output type.");
+  // The PTX parser only types the first pointer parameter of the UDF
+  CUDF_EXPECTS(!is_ptx || output_types.size() == 1, "PTX transforms have a single output");
+
+  auto const null_mask = bitmask_and(inputs, mr, stream);
+  std::vector<std::unique_ptr<column>> outputs;
+  std::vector<mutable_column_view> output_views;
+  for (auto const& type : output_types) {
+    outputs.push_back(make_numeric_column(type,
+                                          inputs.num_rows(),
+                                          rmm::device_buffer{null_mask, stream, mr},
+                                          cudf::UNKNOWN_NULL_COUNT,
+                                          stream,
+                                          mr));
+    output_views.push_back(*outputs.back());
+  }
+
+  if (inputs.num_rows() > 0) {
+    transformation::jit::multi_input_operation(output_views, inputs, udf, is_ptx, stream);
+  }
+
+  return std::make_unique<table>(std::move(outputs));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -105,5 +200,14 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<table> transform(table_view const& inputs,
+                                 std::string const& udf,
+                                 std::vector<data_type> const& output_types,
+                                 bool is_ptx,
+                                 rmm::mr::device_memory_resource* mr) {
+  CUDF_FUNC_RANGE();
+  return detail::transform(inputs, udf, output_types, is_ptx, mr);
+}
+
 }  // namespace experimental
 }  // namespace cudf
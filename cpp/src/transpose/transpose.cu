@@ -13,11 +13,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
@@ -25,8 +27,129 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+constexpr int transpose_tile_dim   = 32;
+constexpr int transpose_block_rows = 8;
+constexpr int max_column_tiles     = 65535;
+
+/**
+ * @brief Transposes `tile_dim x tile_dim` tiles of the input through shared
+ * memory, so that both the reads of the input columns and the writes of the
+ * interleaved output are coalesced.
+ *
+ * Blocks are `tile_dim x block_rows` threads: `blockIdx.x` is the tile of
+ * input rows and `blockIdx.y` strides over the tiles of input columns. The
+ * validity of the output row of a tile is gathered with a warp ballot and
+ * merged into the output mask, which is initially all null, a word at a time.
+ *
+ * @tparam T An unsigned type of the size of the elements, since only their
+ * bits are moved
+ */
+template <typename T, bool has_nulls>
+__global__ void transpose_tiles(table_device_view input, T* output, bitmask_type* output_mask) {
+  // The padding column spreads the tile columns over all the banks
+  __shared__ T tile[transpose_tile_dim][transpose_tile_dim + 1];
+  __shared__ bool valid[transpose_tile_dim][transpose_tile_dim + 1];
+
+  auto const num_columns      = input.num_columns();
+  auto const num_rows         = input.num_rows();
+  auto const row0             = static_cast<size_type>(blockIdx.x) * transpose_tile_dim;
+  auto const num_column_tiles = (num_columns + transpose_tile_dim - 1) / transpose_tile_dim;
+
+  for (size_type column_tile = blockIdx.y; column_tile < num_column_tiles;
+       column_tile += gridDim.y) {
+    auto const col0 = column_tile * transpose_tile_dim;
+
+    // A warp reads consecutive rows of an input column
+    auto const row = row0 + static_cast<size_type>(threadIdx.x);
+    for (int j = threadIdx.y; j < transpose_tile_dim; j += transpose_block_rows) {
+      auto const col = col0 + j;
+      if (row < num_rows and col < num_columns) {
+        auto const& column   = input.column(col);
+        tile[j][threadIdx.x] = column.element<T>(row);
+        if (has_nulls) { valid[j][threadIdx.x] = column.is_valid(row); }
+      }
+    }
+    __syncthreads();
+
+    // A warp writes consecutive columns of an output row
+    auto const col       = col0 + static_cast<size_type>(threadIdx.x);
+    bool const in_bounds = col < num_columns;
+    for (int i = threadIdx.y; i < transpose_tile_dim; i += transpose_block_rows) {
+      auto const out_row = row0 + i;
+      if (out_row >= num_rows) { break; }  // uniform across the warp
+      auto const first = out_row * num_columns + col0;
+      if (in_bounds) { output[first + threadIdx.x] = tile[threadIdx.x][i]; }
+      if (has_nulls) {
+        auto const bits = __ballot_sync(0xffffffff, in_bounds and valid[threadIdx.x][i]);
+        if (threadIdx.x == 0 and bits != 0) {
+          auto const word  = word_index(first);
+          auto const shift = intra_word_index(first);
+          atomicOr(&output_mask[word], bits << shift);
+          if (shift != 0 and (bits >> (detail::size_in_bits<bitmask_type>() - shift)) != 0) {
+            atomicOr(&output_mask[word + 1],
+                     bits >> (detail::size_in_bits<bitmask_type>() - shift));
+          }
+        }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Interleaves the rows of `input` into one column of its fixed-width
+ * elements, moving the elements as `T`s of the same size
+ */
+template <typename T>
+std::unique_ptr<column> interleave_tiles(table_view const& input,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream) {
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+  auto const output_size = static_cast<int64_t>(num_columns) * num_rows;
+  CUDF_EXPECTS(output_size <= std::numeric_limits<size_type>::max(),
+               "Transposed table exceeds the column size limit");
+
+  auto const has_nulls =
+    std::any_of(input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
+  auto output = make_fixed_width_column(input.column(0).type(),
+                                        output_size,
+                                        has_nulls ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto* const output_data = reinterpret_cast<T*>(output->mutable_view().head());
+  auto const num_column_tiles =
+    util::div_rounding_up_safe<size_type>(num_columns, transpose_tile_dim);
+  dim3 const grid(util::div_rounding_up_safe<size_type>(num_rows, transpose_tile_dim),
+                  std::min(num_column_tiles, max_column_tiles));
+  dim3 const block(transpose_tile_dim, transpose_block_rows);
+
+  if (has_nulls) {
+    transpose_tiles<T, true><<<grid, block, 0, stream>>>(
+      *device_input, output_data, output->mutable_view().null_mask());
+    auto const null_count = std::accumulate(
+      input.begin(), input.end(), size_type{0}, [](size_type count, column_view const& col) {
+        return count + col.null_count();
+      });
+    output->set_null_count(null_count);
+  } else {
+    transpose_tiles<T, false><<<grid, block, 0, stream>>>(*device_input, output_data, nullptr);
+  }
+  CHECK_CUDA(stream);
+  return output;
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::mr::device_memory_resource* mr,
@@ -42,17 +165,28 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
     std::all_of(
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
+  CUDF_EXPECTS(is_fixed_width(dtype), "Transpose supports only fixed-width types");
 
   nvtx::range_push("CUDF_TRANSPOSE", nvtx::color::GREEN);
 
-  auto output_column = cudf::experimental::interleave_columns(input);
-  auto one_iter      = thrust::make_counting_iterator<size_type>(1);
-  auto splits_iter   = thrust::make_transform_iterator(
+  std::unique_ptr<column> output_column;
+  switch (size_of(dtype)) {
+    case 1: output_column = interleave_tiles<uint8_t>(input, mr, stream); break;
+    case 2: output_column = interleave_tiles<uint16_t>(input, mr, stream); break;
+    case 4: output_column = interleave_tiles<uint32_t>(input, mr, stream); break;
+    case 8: output_column = interleave_tiles<uint64_t>(input, mr, stream); break;
+    default: CUDF_FAIL("Unsupported element size for transpose");
+  }
+
+  auto one_iter    = thrust::make_counting_iterator<size_type>(1);
+  auto splits_iter = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
   auto splits = std::vector<size_type>(splits_iter, splits_iter + input.num_rows() - 1);
   auto output_column_views = cudf::experimental::split(output_column->view(), splits);
   auto output_table_view   = table_view(output_column_views);
 
+  nvtx::range_pop();
+
   return std::make_pair(std::move(output_column), output_table_view);
 }
 }  // namespace detail
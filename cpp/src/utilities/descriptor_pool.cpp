@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/descriptor_pool.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Returns the smallest size class whose blocks fit `size` bytes
+ */
+int size_class(std::size_t size) {
+  int cls = 0;
+  while ((std::size_t{1} << cls) < size) { cls++; }
+  return cls;
+}
+
+}  // namespace
+
+descriptor_pool& descriptor_pool::instance() {
+  // Never destroyed, so views destroyed during static destruction stay valid
+  static descriptor_pool* pool = new descriptor_pool();
+  return *pool;
+}
+
+descriptor_pool::~descriptor_pool() {
+  for (auto& free_blocks : _free_blocks) {
+    for (auto block : free_blocks) { free_block(block); }
+  }
+}
+
+descriptor_block* descriptor_pool::acquire(std::size_t size) {
+  if (size == 0 || size > max_block_size) { return nullptr; }
+  int const cls = std::max(size_class(size), min_size_class);
+
+  {
+    // The first block whose last use has completed is reused
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& free_blocks = _free_blocks[cls - min_size_class];
+    auto const it     = std::find_if(free_blocks.begin(), free_blocks.end(), [](auto block) {
+      return cudaEventQuery(block->released) == cudaSuccess;
+    });
+    if (it != free_blocks.end()) {
+      auto const block = *it;
+      free_blocks.erase(it);
+      return block;
+    }
+  }
+
+  // Allocate outside the lock, as pinning the memory may take milliseconds
+  auto block  = new descriptor_block{nullptr, nullptr, std::size_t{1} << cls, nullptr};
+  auto result = cudaMallocHost(&block->host, block->size);
+  if (result == cudaSuccess) { result = cudaMalloc(&block->device, block->size); }
+  if (result == cudaSuccess) {
+    result = cudaEventCreateWithFlags(&block->released, cudaEventDisableTiming);
+  }
+  if (result != cudaSuccess) {
+    free_block(block);
+    CUDA_TRY(result);
+  }
+  return block;
+}
+
+void descriptor_pool::release(descriptor_block* block, cudaStream_t stream) {
+  // Called from destructors, so errors fall back to freeing the block
+  if (cudaEventRecord(block->released, stream) == cudaSuccess) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& free_blocks = _free_blocks[size_class(block->size) - min_size_class];
+    if (free_blocks.size() < max_free_blocks) {
+      free_blocks.push_back(block);
+      return;
+    }
+  }
+  cudaEventSynchronize(block->released);
+  free_block(block);
+}
+
+void descriptor_pool::free_block(descriptor_block* block) {
+  if (block->released != nullptr) { cudaEventDestroy(block->released); }
+  if (block->device != nullptr) { cudaFree(block->device); }
+  if (block->host != nullptr) { cudaFreeHost(block->host); }
+  delete block;
+}
+
+}  // namespace detail
+}  // namespace cudf
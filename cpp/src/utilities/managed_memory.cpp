@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/managed_memory.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace cudf {
+
+namespace {
+
+std::atomic<bool>& prefetch_enabled() {
+  static std::atomic<bool> enabled{[] {
+    auto const env = std::getenv("LIBCUDF_MANAGED_PREFETCH");
+    return env != nullptr && std::strcmp(env, "0") != 0;
+  }()};
+  return enabled;
+}
+
+}  // namespace
+
+bool set_managed_memory_prefetch(bool enable) noexcept {
+  return prefetch_enabled().exchange(enable);
+}
+
+bool is_managed_memory_prefetch_enabled() noexcept { return prefetch_enabled().load(); }
+
+namespace detail {
+
+namespace {
+
+bool is_managed(void const* ptr) {
+  cudaPointerAttributes attributes;
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError();  // Host memory unknown to CUDA is reported as an error before CUDA 11
+    return false;
+  }
+#if CUDART_VERSION >= 10000
+  return attributes.type == cudaMemoryTypeManaged;
+#else
+  return attributes.isManaged;
+#endif
+}
+
+}  // namespace
+
+void prefetch_to_device(void const* ptr, std::size_t size, cudaStream_t stream) {
+  if (ptr == nullptr || size == 0 || not is_managed_memory_prefetch_enabled()) { return; }
+  // The errors of the calls below are cleared, so a pending error of an earlier
+  // call is left for its caller to report rather than cleared with them
+  if (cudaPeekAtLastError() != cudaSuccess) { return; }
+  if (not is_managed(ptr)) { return; }
+  int device             = 0;
+  int concurrent_managed = 0;
+  if (cudaGetDevice(&device) != cudaSuccess ||
+      cudaDeviceGetAttribute(&concurrent_managed, cudaDevAttrConcurrentManagedAccess, device) !=
+        cudaSuccess ||
+      concurrent_managed == 0 || cudaMemPrefetchAsync(ptr, size, device, stream) != cudaSuccess) {
+    cudaGetLastError();
+  }
+}
+
+void prefetch_to_device(column_view const& col, cudaStream_t stream) {
+  if (not is_managed_memory_prefetch_enabled()) { return; }
+  if (is_fixed_width(col.type())) {
+    auto const element_size = size_of(col.type());
+    prefetch_to_device(
+      col.head<uint8_t>() + col.offset() * element_size, col.size() * element_size, stream);
+  }
+  if (col.nullable()) {
+    prefetch_to_device(
+      col.null_mask(), num_bitmask_words(col.offset() + col.size()) * sizeof(bitmask_type), stream);
+  }
+  for (size_type i = 0; i < col.num_children(); ++i) { prefetch_to_device(col.child(i), stream); }
+}
+
+void prefetch_to_device(table_view const& table, cudaStream_t stream) {
+  for (auto const& col : table) { prefetch_to_device(col, stream); }
+}
+
+void prefetch_to_device(std::vector<column_view> const& columns, cudaStream_t stream) {
+  for (auto const& col : columns) { prefetch_to_device(col, stream); }
+}
+
+}  // namespace detail
+}  // namespace cudf
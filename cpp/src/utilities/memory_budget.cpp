@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/memory_budget.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <atomic>
+
+namespace cudf {
+
+namespace {
+
+std::atomic<memory_budget*>& installed_budget() {
+  static std::atomic<memory_budget*> budget{nullptr};
+  return budget;
+}
+
+}  // namespace
+
+memory_budget* get_memory_budget() noexcept { return installed_budget().load(); }
+
+memory_budget* set_memory_budget(memory_budget* budget) noexcept {
+  return installed_budget().exchange(budget);
+}
+
+namespace detail {
+
+std::size_t available_device_memory() {
+  auto const budget = get_memory_budget();
+  if (budget != nullptr) { return budget->available_bytes(); }
+  size_t free_memory{0}, total_memory{0};
+  CUDA_TRY(cudaMemGetInfo(&free_memory, &total_memory));
+  return free_memory;
+}
+
+bool fits_memory_budget(std::size_t bytes) {
+  auto const budget = get_memory_budget();
+  if (budget == nullptr) { return true; }
+  auto available = budget->available_bytes();
+  while (available < bytes) {
+    if (not budget->spill(bytes - available)) { return false; }
+    auto const previous = available;
+    available           = budget->available_bytes();
+    // Stop asking once spilling no longer frees anything
+    if (available <= previous) { break; }
+  }
+  return available >= bytes;
+}
+
+}  // namespace detail
+}  // namespace cudf
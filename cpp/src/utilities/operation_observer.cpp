@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/operation_observer.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+
+namespace {
+
+/**
+ * @brief The allocations of a host thread, and its number of active scopes
+ */
+struct thread_counters {
+  std::size_t allocated_bytes = 0;
+  std::size_t allocations     = 0;
+  int64_t current_bytes       = 0;  ///< Allocated and not freed; negative if the thread
+                                    ///< frees memory of other threads
+  int64_t peak_bytes          = 0;  ///< Largest `current_bytes` in the innermost scope
+  int depth                   = 0;
+};
+
+thread_counters& get_thread_counters() {
+  thread_local thread_counters counters;
+  return counters;
+}
+
+/**
+ * @brief Adaptor of the default resource counting the allocations of each
+ * thread
+ */
+class counting_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit counting_resource(rmm::mr::device_memory_resource* upstream) : _upstream{upstream} {}
+
+  rmm::mr::device_memory_resource* upstream() const noexcept { return _upstream; }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override {
+    auto p         = _upstream->allocate(bytes, stream);
+    auto& counters = get_thread_counters();
+    counters.allocated_bytes += bytes;
+    ++counters.allocations;
+    counters.current_bytes += bytes;
+    counters.peak_bytes = std::max(counters.peak_bytes, counters.current_bytes);
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override {
+    _upstream->deallocate(p, bytes, stream);
+    get_thread_counters().current_bytes -= bytes;
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+};
+
+std::atomic<operation_observer*>& installed_observer() {
+  static std::atomic<operation_observer*> observer{nullptr};
+  return observer;
+}
+
+std::mutex& observer_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+/**
+ * @brief The adaptor installed with the observer. It is never freed while it
+ * may still be the default resource
+ */
+std::unique_ptr<counting_resource>& installed_adaptor() {
+  static std::unique_ptr<counting_resource> adaptor;
+  return adaptor;
+}
+
+}  // namespace
+
+operation_observer* get_operation_observer() noexcept { return installed_observer().load(); }
+
+operation_observer* set_operation_observer(operation_observer* observer) {
+  std::lock_guard<std::mutex> lock(observer_mutex());
+  auto& adaptor = installed_adaptor();
+  if (observer != nullptr and adaptor == nullptr) {
+    adaptor = std::make_unique<counting_resource>(rmm::mr::get_default_resource());
+    rmm::mr::set_default_resource(adaptor.get());
+  } else if (observer == nullptr and adaptor != nullptr and
+             rmm::mr::get_default_resource() == adaptor.get()) {
+    rmm::mr::set_default_resource(adaptor->upstream());
+    adaptor.reset();
+  }
+  return installed_observer().exchange(observer);
+}
+
+namespace detail {
+
+void operation_scope::begin(char const* name, operation_kind kind) {
+  auto& counters      = get_thread_counters();
+  _name               = name;
+  _kind               = kind;
+  _depth              = counters.depth++;
+  _start_bytes        = counters.allocated_bytes;
+  _start_allocations  = counters.allocations;
+  _start_current      = counters.current_bytes;
+  _outer_peak         = counters.peak_bytes;
+  counters.peak_bytes = counters.current_bytes;
+  if (cudaEventCreate(&_start_event) != cudaSuccess or
+      cudaEventRecord(_start_event, 0) != cudaSuccess) {
+    _start_event = nullptr;
+  }
+  _start_time = std::chrono::steady_clock::now();
+}
+
+void operation_scope::end() noexcept {
+  auto& counters = get_thread_counters();
+  // The peak of this scope is also reached in the enclosing one
+  auto const peak     = counters.peak_bytes - _start_current;
+  counters.peak_bytes = std::max(_outer_peak, counters.peak_bytes);
+  --counters.depth;
+
+  // The GPU time is 0 if the events fail, e.g., after a kernel error
+  float gpu_time_ms = 0;
+  cudaEvent_t stop_event{};
+  if (_start_event != nullptr and cudaEventCreate(&stop_event) == cudaSuccess) {
+    if (cudaEventRecord(stop_event, 0) != cudaSuccess or
+        cudaEventSynchronize(stop_event) != cudaSuccess or
+        cudaEventElapsedTime(&gpu_time_ms, _start_event, stop_event) != cudaSuccess) {
+      gpu_time_ms = 0;
+    }
+    cudaEventDestroy(stop_event);
+  }
+  std::chrono::duration<double, std::milli> const wall_time =
+    std::chrono::steady_clock::now() - _start_time;
+  if (_start_event != nullptr) { cudaEventDestroy(_start_event); }
+
+  if (std::uncaught_exception()) { return; }
+  _observer->record(operation_record{_name,
+                                     _kind,
+                                     _depth,
+                                     wall_time.count(),
+                                     gpu_time_ms,
+                                     counters.allocated_bytes - _start_bytes,
+                                     counters.allocations - _start_allocations,
+                                     static_cast<std::size_t>(std::max<int64_t>(peak, 0))});
+}
+
+}  // namespace detail
+
+void operation_summary::record(operation_record const& op) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& e = _entries[op.name];
+  ++e.calls;
+  e.wall_time_ms += op.wall_time_ms;
+  e.gpu_time_ms += op.gpu_time_ms;
+  e.total_bytes += op.allocated_bytes;
+  e.peak_bytes = std::max(e.peak_bytes, op.peak_bytes);
+}
+
+std::map<std::string, operation_summary::entry> operation_summary::statistics() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries;
+}
+
+void operation_summary::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+}
+
+}  // namespace cudf
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace experimental {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief The arena of a host thread and the stream its memory was last used on
+ *
+ * The arena only exists while a scope is active, so its blocks are never
+ * deallocated into a resource that was replaced or destroyed in the meantime.
+ */
+struct thread_scratch {
+  std::unique_ptr<scratch_arena> arena;
+  cudaStream_t stream = 0;
+  int depth           = 0;  // Number of active scopes
+};
+
+thread_scratch& get_thread_scratch() {
+  thread_local thread_scratch scratch;
+  return scratch;
+}
+
+}  // namespace
+
+scratch_arena::~scratch_arena() { free_blocks(_stream); }
+
+void* scratch_arena::do_allocate(std::size_t bytes, cudaStream_t stream) {
+  if (bytes == 0) { return nullptr; }
+  bytes = (bytes + alignment - 1) / alignment * alignment;
+
+  while (_current < _blocks.size()) {
+    auto& block = _blocks[_current];
+    if (_offset + bytes <= block.second) {
+      void* ptr = static_cast<char*>(block.first) + _offset;
+      _offset += bytes;
+      return ptr;
+    }
+    // The rest of the block is skipped until the scope using it exits
+    if (_current + 1 == _blocks.size()) { break; }
+    ++_current;
+    _offset = 0;
+  }
+
+  auto const grown_size =
+    _blocks.empty() ? _merged_size : std::min(2 * _blocks.back().second, max_retained_bytes);
+  auto const block_size = std::max({bytes, grown_size, min_block_size});
+  _blocks.emplace_back(_upstream->allocate(block_size, stream), block_size);
+  _merged_size = 0;
+  _current     = _blocks.size() - 1;
+  _offset      = bytes;
+  return _blocks.back().first;
+}
+
+void scratch_arena::release(marker position, cudaStream_t stream) {
+  _stream  = stream;
+  _current = position.block;
+  _offset  = position.offset;
+  if (_current != 0 or _offset != 0) { return; }
+
+  size_t total_size = 0;
+  for (auto const& block : _blocks) { total_size += block.second; }
+  if (_blocks.size() > 1 or total_size > max_retained_bytes) {
+    free_blocks(stream);
+    _merged_size = (total_size <= max_retained_bytes) ? total_size : 0;
+  }
+}
+
+void scratch_arena::free_blocks(cudaStream_t stream) {
+  for (auto const& block : _blocks) { _upstream->deallocate(block.first, block.second, stream); }
+  _blocks.clear();
+  _current = 0;
+  _offset  = 0;
+}
+
+scratch_scope::scratch_scope(cudaStream_t stream) : _stream{stream} {
+  auto& scratch = get_thread_scratch();
+  if (scratch.depth == 0) {
+    scratch.arena = std::make_unique<scratch_arena>(rmm::mr::get_default_resource());
+  } else if (stream != scratch.stream) {
+    // The memory handed out again may still be in use on the enclosing scope's stream
+    CUDF_STREAM_SYNC(scratch.stream);
+  }
+  _arena           = scratch.arena.get();
+  _position        = _arena->mark();
+  _previous_stream = scratch.stream;
+  scratch.stream   = stream;
+  ++scratch.depth;
+}
+
+scratch_scope::~scratch_scope() {
+  auto& scratch = get_thread_scratch();
+  _arena->release(_position, _stream);
+  if (--scratch.depth == 0) {
+    // The default resource may be replaced or destroyed before the next scope,
+    // so the blocks are returned to it now
+    scratch.arena.reset();
+    scratch.stream = 0;
+    return;
+  }
+  // The enclosing scope allocates on its own stream without waiting for this one.
+  // Called from a destructor, so errors are left for the next CUDA call to report.
+  if (_stream != _previous_stream) { cudaStreamSynchronize(_stream); }
+  scratch.stream = _previous_stream;
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cudf
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/arrow_device.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <string>
+
+using namespace cudf::test;
+
+struct ArrowDeviceTest : public BaseFixture {};
+
+TEST_F(ArrowDeviceTest, RoundTripSharesBuffers)
+{
+  fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<double> col2({1.5, 2.5, 3.5, 4.5}, {1, 0, 1, 0});
+  strings_column_wrapper col3({"a", "", "bcd", "ef"}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<cudf::timestamp_ms> col4({10, 20, 30, 40});
+  cudf::table_view expected{{col1, col2, col3, col4}};
+
+  auto input       = std::make_unique<cudf::experimental::table>(expected);
+  auto const data1 = input->view().column(0).head<void>();
+
+  ArrowSchema schema;
+  ArrowArray array;
+  cudf::to_arrow_device(std::move(input), &schema, &array);
+
+  EXPECT_EQ(std::string(schema.format), "+s");
+  ASSERT_EQ(schema.n_children, 4);
+  EXPECT_EQ(std::string(schema.children[0]->format), "i");
+  EXPECT_EQ(std::string(schema.children[1]->format), "g");
+  EXPECT_EQ(schema.children[1]->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_EQ(std::string(schema.children[2]->format), "u");
+  EXPECT_EQ(std::string(schema.children[3]->format), "tsm:");
+  EXPECT_EQ(array.length, 4);
+  EXPECT_EQ(array.children[1]->null_count, 2);
+  EXPECT_EQ(array.children[0]->buffers[1], data1);
+
+  auto result = cudf::from_arrow_device(&schema, &array);
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(result.first.column(0).head<void>(), data1);
+  expect_tables_equal(expected, result.first);
+
+  schema.release(&schema);
+}
+
+TEST_F(ArrowDeviceTest, ChildOutlivesParent)
+{
+  fixed_width_column_wrapper<int64_t> col1({5, 6, 7}, {1, 0, 1});
+  cudf::table_view expected{{col1}};
+
+  ArrowSchema schema;
+  ArrowArray array;
+  cudf::to_arrow_device(std::make_unique<cudf::experimental::table>(expected), &schema, &array);
+
+  // Moving a child out keeps its buffers alive after the parent is released
+  ArrowArray child = *array.children[0];
+  array.children[0]->release = nullptr;
+  array.release(&array);
+  EXPECT_EQ(array.release, nullptr);
+
+  cudf::column_view imported(cudf::data_type{cudf::INT64},
+                             child.length,
+                             child.buffers[1],
+                             static_cast<cudf::bitmask_type const*>(child.buffers[0]),
+                             child.null_count);
+  expect_columns_equal(col1, imported);
+
+  child.release(&child);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowDeviceTest, SlicedStruct)
+{
+  fixed_width_column_wrapper<int16_t> col1({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<int16_t> expected({2, 3, 4});
+
+  ArrowSchema schema;
+  ArrowArray array;
+  cudf::to_arrow_device(
+    std::make_unique<cudf::experimental::table>(cudf::table_view{{col1}}), &schema, &array);
+  array.offset = 1;
+  array.length = 3;
+
+  auto result = cudf::from_arrow_device(&schema, &array);
+  expect_columns_equal(expected, result.first.column(0));
+
+  schema.release(&schema);
+}
+
+TEST_F(ArrowDeviceTest, UnsupportedTypes)
+{
+  fixed_width_column_wrapper<bool> col1({1, 0, 1});
+
+  ArrowSchema schema;
+  ArrowArray array;
+  EXPECT_THROW(cudf::to_arrow_device(
+                 std::make_unique<cudf::experimental::table>(cudf::table_view{{col1}}),
+                 &schema,
+                 &array),
+               cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> col2({1, 2, 3});
+  cudf::to_arrow_device(
+    std::make_unique<cudf::experimental::table>(cudf::table_view{{col2}}), &schema, &array);
+  schema.children[0]->format = "b";
+  EXPECT_THROW(cudf::from_arrow_device(&schema, &array), cudf::logic_error);
+  EXPECT_NE(array.release, nullptr);
+  schema.children[0]->format = "i";
+
+  array.release(&array);
+  schema.release(&schema);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+namespace cudf {
+namespace test {
+namespace binop {
+
+using experimental::binary_operator;
+using experimental::expression;
+
+struct BinaryOperationExpressionTest : public BaseFixture {};
+
+// The result of the expression must match the chained binary operations
+TEST_F(BinaryOperationExpressionTest, FilterPredicate) {
+  fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5, 6}, {1, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<double> b({0.5, 1.5, 2.5, -1.0, 3.0, 4.0});
+  fixed_width_column_wrapper<int64_t> c({10, 20, 30, 40, 50, 60}, {1, 0, 1, 1, 1, 1});
+  numeric_scalar<double> one(1.0);
+  numeric_scalar<int64_t> ten(10);
+  numeric_scalar<int64_t> limit(45);
+  table_view table({a, b, c});
+
+  auto const bool_type   = data_type(BOOL8);
+  auto const double_type = data_type(FLOAT64);
+
+  // (a * b + 1.0 > c / 10) && (c < 45)
+  auto const product = expression::operation(binary_operator::MUL,
+                                             expression::column_reference(0),
+                                             expression::column_reference(1),
+                                             double_type);
+  auto const sum =
+    expression::operation(binary_operator::ADD, product, expression::literal(one), double_type);
+  auto const scaled = expression::operation(binary_operator::TRUE_DIV,
+                                            expression::column_reference(2),
+                                            expression::literal(ten),
+                                            double_type);
+  auto const greater = expression::operation(binary_operator::GREATER, sum, scaled, bool_type);
+  auto const less    = expression::operation(
+    binary_operator::LESS, expression::column_reference(2), expression::literal(limit), bool_type);
+  auto const predicate =
+    expression::operation(binary_operator::LOGICAL_AND, greater, less, bool_type);
+
+  auto const got = experimental::compute_column(table, predicate);
+
+  auto const ref_product = experimental::binary_operation(a, b, binary_operator::MUL, double_type);
+  auto const ref_sum =
+    experimental::binary_operation(ref_product->view(), one, binary_operator::ADD, double_type);
+  auto const ref_scaled =
+    experimental::binary_operation(c, ten, binary_operator::TRUE_DIV, double_type);
+  auto const ref_greater = experimental::binary_operation(
+    ref_sum->view(), ref_scaled->view(), binary_operator::GREATER, bool_type);
+  auto const ref_less = experimental::binary_operation(c, limit, binary_operator::LESS, bool_type);
+  auto const expected = experimental::binary_operation(
+    ref_greater->view(), ref_less->view(), binary_operator::LOGICAL_AND, bool_type);
+
+  expect_columns_equal(expected->view(), got->view());
+}
+
+TEST_F(BinaryOperationExpressionTest, NullLiteral) {
+  fixed_width_column_wrapper<int32_t> a({1, 2, 3});
+  numeric_scalar<int32_t> null_literal(0, false);
+  table_view table({a});
+
+  auto const expr = expression::operation(binary_operator::ADD,
+                                          expression::column_reference(0),
+                                          expression::literal(null_literal),
+                                          data_type(INT32));
+  auto const got = experimental::compute_column(table, expr);
+
+  EXPECT_EQ(3, got->null_count());
+}
+
+TEST_F(BinaryOperationExpressionTest, InvalidExpressions) {
+  fixed_width_column_wrapper<int32_t> a({1, 2, 3});
+  strings_column_wrapper s({"a", "b", "c"});
+  table_view table({a, s});
+
+  auto const out_of_range = expression::operation(binary_operator::ADD,
+                                                  expression::column_reference(0),
+                                                  expression::column_reference(2),
+                                                  data_type(INT32));
+  EXPECT_THROW(experimental::compute_column(table, out_of_range), logic_error);
+
+  auto const strings = expression::operation(binary_operator::ADD,
+                                             expression::column_reference(0),
+                                             expression::column_reference(1),
+                                             data_type(INT32));
+  EXPECT_THROW(experimental::compute_column(table, strings), logic_error);
+
+  EXPECT_THROW(experimental::compute_column(table, expression::column_reference(0)), logic_error);
+  EXPECT_THROW(expression::operation(binary_operator::COALESCE,
+                                     expression::column_reference(0),
+                                     expression::column_reference(0),
+                                     data_type(INT32)),
+               logic_error);
+}
+
+}  // namespace binop
+}  // namespace test
+}  // namespace cudf
@@ -19,6 +19,7 @@
 
 #include <tests/binaryop/assert-binops.h>
 #include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
 #include <tests/binaryop/binop-fixture.hpp>
 
 namespace cudf {
@@ -804,6 +805,119 @@ TEST_F(BinaryOperationIntegrationTest, LogBase_Vector_Vector_double_SI64_SI32) {
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, LOG_BASE());
 }
 
+TEST_F(BinaryOperationIntegrationTest, PyMod_Vector_Vector_FP64_SI32_SI64) {
+  using TypeOut = double;
+  using TypeLhs = int32_t;
+  using TypeRhs = int64_t;
+
+  using PYMOD = cudf::library::operation::PyMod<TypeOut, TypeLhs, TypeRhs>;
+
+  fixed_width_column_wrapper<TypeLhs> lhs{{-7, 7, -7, 7, 0, 9}, {1, 1, 1, 1, 1, 0}};
+  fixed_width_column_wrapper<TypeRhs> rhs{{3, 3, -3, -3, 5, 2}, {1, 1, 1, 1, 0, 1}};
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::PYMOD,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, PYMOD());
+}
+
+TEST_F(BinaryOperationIntegrationTest, FloorDiv_Scalar_Vector_SI16_FP32_SI08) {
+  using TypeOut = int16_t;
+  using TypeLhs = float;
+  using TypeRhs = int8_t;
+
+  using FLOORDIV = cudf::library::operation::FloorDiv<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_scalar<TypeLhs>();
+  auto rhs = make_random_wrapped_column<TypeRhs>(1000);
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::FLOOR_DIV,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, FLOORDIV());
+}
+
+TEST_F(BinaryOperationIntegrationTest, GreaterEqual_Vector_Scalar_B8_FP64_SI32) {
+  using TypeOut = bool;
+  using TypeLhs = double;
+  using TypeRhs = int32_t;
+
+  using GREATER_EQUAL = cudf::library::operation::GreaterEqual<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(1000);
+  auto rhs = make_random_wrapped_scalar<TypeRhs>();
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::GREATER_EQUAL,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, GREATER_EQUAL());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Greater_Vector_Scalar_B8_SI32_SI32) {
+  using TypeOut = bool;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  using GREATER = cudf::library::operation::Greater<TypeOut, TypeLhs, TypeRhs>;
+
+  // Not a multiple of the elements compared by each thread
+  auto lhs = make_random_wrapped_column<TypeLhs>(1001);
+  auto rhs = make_random_wrapped_scalar<TypeRhs>();
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::GREATER,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, GREATER());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Less_Scalar_Vector_B8_FP32_FP32) {
+  using TypeOut = bool;
+  using TypeLhs = float;
+  using TypeRhs = float;
+
+  using LESS = cudf::library::operation::Less<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_scalar<TypeLhs>();
+  auto rhs = make_random_wrapped_column<TypeRhs>(1003);
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::LESS,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, LESS());
+}
+
+TEST_F(BinaryOperationIntegrationTest, LessEqual_SlicedVector_Scalar_B8_SI64_SI64) {
+  using TypeOut = bool;
+  using TypeLhs = int64_t;
+  using TypeRhs = int64_t;
+
+  using LESS_EQUAL = cudf::library::operation::LessEqual<TypeOut, TypeLhs, TypeRhs>;
+
+  // The elements of a sliced column are not aligned for the loads of a thread
+  auto column = make_random_wrapped_column<TypeLhs>(1000);
+  auto lhs    = cudf::experimental::slice(column, {1, 998})[0];
+  auto rhs    = make_random_wrapped_scalar<TypeRhs>();
+  auto out    = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::LESS_EQUAL,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, LESS_EQUAL());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Equal_Vector_InvalidScalar_B8_SI32_SI32) {
+  using TypeOut = bool;
+  using TypeLhs = int32_t;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = cudf::numeric_scalar<int32_t>(1, false);
+  auto out = cudf::experimental::binary_operation(
+      lhs, rhs, cudf::experimental::binary_operator::EQUAL,
+      data_type(experimental::type_to_id<TypeOut>()));
+
+  EXPECT_EQ(out->size(), 100);
+  EXPECT_EQ(out->null_count(), 100);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
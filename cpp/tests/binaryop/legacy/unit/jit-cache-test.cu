@@ -17,6 +17,9 @@
 
 #include "jit-cache-test.hpp"
 
+#include <fstream>
+#include <string>
+
 namespace cudf {
 namespace test {
 
@@ -80,6 +83,62 @@ TEST_F(JitCacheTest, MemoryCacheProgramTest) {
                                   << "  Actual col: " << column.to_str();
 }
 
+// Test the bundling of the in memory cache
+TEST_F(JitCacheTest, BundleTest) {
+    auto bundle_path = (boost::filesystem::temp_directory_path() / "JitCacheTestBundle").string();
+    writeBundle(bundle_path);
+
+    // remove any file cache so below program can only be obtained from the bundle
+    purgeFileCache();
+
+    // Brand new cache object that has nothing in in-memory cache
+    cudf::jit::cudfJitCache cache;
+    EXPECT_ANY_THROW(cache.getProgram("MemoryCacheTestProg"));
+    cache.loadBundle(bundle_path);
+
+    // Single value column
+    auto column = cudf::test::column_wrapper<int>{{4,0}};
+    auto expect = cudf::test::column_wrapper<int>{{64,0}};
+
+    auto program = cache.getProgram("MemoryCacheTestProg");
+    auto kernel = cache.getKernelInstantiation("my_kernel",
+                                               program,
+                                               {"3", "int"});
+    (*std::get<1>(kernel)).configure(grid, block)
+                .launch(column.get()->data);
+
+    ASSERT_TRUE(expect == column) << "Expected col: " << expect.to_str()
+                                  << "  Actual col: " << column.to_str();
+
+    // a file that is not a bundle is rejected
+    std::ofstream(bundle_path, std::ios::trunc) << "not a bundle";
+    EXPECT_THROW(cache.loadBundle(bundle_path), cudf::logic_error);
+    boost::filesystem::remove(bundle_path);
+}
+
+// Test the warm up from a manifest of kernels
+TEST_F(JitCacheTest, ManifestTest) {
+    auto manifest_path =
+        (boost::filesystem::temp_directory_path() / "JitCacheTestManifest").string();
+    writeManifest(manifest_path);
+
+    std::ifstream manifest(manifest_path);
+    std::string line;
+    std::getline(manifest, line);
+    EXPECT_EQ("MemoryCacheTestProg\tmy_kernel\t3\tint", line);
+
+    // remove any file cache so the program of the manifest is not cached
+    purgeFileCache();
+
+    // Brand new cache object that has nothing in in-memory cache
+    cudf::jit::cudfJitCache cache;
+    EXPECT_THROW(cache.warmUpFromManifest(manifest_path), cudf::logic_error);
+
+    auto program = cache.getProgram("MemoryCacheTestProg", program_source);
+    EXPECT_NO_THROW(cache.warmUpFromManifest(manifest_path));
+    boost::filesystem::remove(manifest_path);
+}
+
 // Test the file caching ability
 #if defined(JITIFY_USE_CACHE)
 TEST_F(JitCacheTest, FileCacheProgramTest) {
@@ -112,6 +112,15 @@ namespace operation {
         }
     };
 
+    template <typename TypeOut, typename TypeLhs, typename TypeRhs>
+    struct PyMod {
+        TypeOut operator()(TypeLhs x, TypeRhs y) {
+            double x1 = static_cast<double>(x);
+            double y1 = static_cast<double>(y);
+            return (TypeOut)fmod(fmod(x1, y1) + y1, y1);
+        }
+    };
+
     template <typename TypeOut, typename TypeLhs, typename TypeRhs>
     struct Pow {
         TypeOut operator()(TypeLhs lhs, TypeRhs rhs) {
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/copying.hpp>
@@ -27,6 +28,7 @@
 
 #include <thrust/device_vector.h>
 #include <thrust/device_ptr.h>
+#include <thrust/iterator/counting_iterator.h>
 
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {};
 
@@ -218,6 +220,26 @@ TEST_F(CountBitmaskTest, MultipleWordsSingleBit) {
   EXPECT_THAT(counts, testing::ContainerEq(std::vector<cudf::size_type>{1, 1, 1}));
 }
 
+TEST_F(CountBitmaskTest, BatchedSegmentedCount) {
+  thrust::device_vector<cudf::bitmask_type> all_set(10, ~cudf::bitmask_type{0});
+  thrust::device_vector<cudf::bitmask_type> alternating(10, 0x55555555);
+  std::vector<cudf::bitmask_type const *> masks{
+    all_set.data().get(), nullptr, alternating.data().get()};
+
+  std::vector<cudf::size_type> indices = {0, 320, 67, 293, 31, 32, 100, 100, 1, 2};
+  auto counts = cudf::detail::segmented_count_set_bits(masks, indices);
+  ASSERT_EQ(3u, counts.size());
+  EXPECT_THAT(counts[0], ::testing::ContainerEq(std::vector<cudf::size_type>{320, 226, 1, 0, 1}));
+  EXPECT_THAT(counts[1], ::testing::ContainerEq(std::vector<cudf::size_type>{320, 226, 1, 0, 1}));
+  EXPECT_THAT(counts[2], ::testing::ContainerEq(std::vector<cudf::size_type>{160, 113, 0, 0, 0}));
+
+  auto unset_counts = cudf::detail::segmented_count_unset_bits(masks, indices);
+  ASSERT_EQ(3u, unset_counts.size());
+  EXPECT_THAT(unset_counts[1], ::testing::ContainerEq(std::vector<cudf::size_type>{0, 0, 0, 0, 0}));
+  EXPECT_THAT(unset_counts[2],
+              ::testing::ContainerEq(std::vector<cudf::size_type>{160, 113, 1, 0, 1}));
+}
+
 using CountUnsetBitsTest = CountBitmaskTest;
 
 TEST_F(CountUnsetBitsTest, SingleBitAllSet) {
@@ -417,6 +439,29 @@ TEST_F(CopyBitmaskTest, TestNonZeroOffset) {
                                    number_of_bits / CHAR_BIT);
 }
 
+TEST_F(CopyBitmaskTest, TestOffsetInFirstWord) {
+  thrust::host_vector<int> validity_bit(1000);
+  for (auto &m : validity_bit) {
+    m = this->generate();
+  }
+  auto input_mask = cudf::test::detail::make_null_mask(validity_bit.begin(),
+                                                       validity_bit.end());
+
+  int begin_bit = 7;
+  int end_bit = 999;
+  auto gold_splice_mask = cudf::test::detail::make_null_mask(
+      validity_bit.begin() + begin_bit, validity_bit.begin() + end_bit);
+
+  auto splice_mask = cudf::copy_bitmask(
+      static_cast<const cudf::bitmask_type *>(input_mask.data()), begin_bit,
+      end_bit);
+
+  cleanEndWord(splice_mask, begin_bit, end_bit);
+  auto number_of_bits = end_bit - begin_bit;
+  cudf::test::expect_equal_buffers(gold_splice_mask.data(), splice_mask.data(),
+                                   number_of_bits / CHAR_BIT);
+}
+
 TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorContiguous) {
   cudf::data_type t{cudf::type_id::INT32};
   cudf::size_type num_elements = 1001;
@@ -484,4 +529,81 @@ TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorDiscontiguous) {
                                    num_elements / CHAR_BIT);
 }
 
+struct BitmaskBinopTest : public cudf::test::BaseFixture {};
+
+TEST_F(BitmaskBinopTest, AndOr) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                       {1, 0, 1, 0, 1, 0, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                       {1, 1, 0, 0, 1, 1, 0, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_and({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                               {1, 0, 0, 0, 1, 0, 0, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_or({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                              {1, 1, 1, 0, 1, 1, 1, 0, 1, 1});
+  cudf::table_view input({col1, col2});
+  auto data = static_cast<cudf::column_view>(col1).head();
+
+  auto and_mask = cudf::bitmask_and(input);
+  cudf::column_view and_result(cudf::data_type{cudf::INT32},
+                               10,
+                               data,
+                               static_cast<cudf::bitmask_type const *>(and_mask.data()));
+  cudf::test::expect_columns_equal(expected_and, and_result);
+
+  auto or_mask = cudf::bitmask_or(input);
+  cudf::column_view or_result(cudf::data_type{cudf::INT32},
+                              10,
+                              data,
+                              static_cast<cudf::bitmask_type const *>(or_mask.data()));
+  cudf::test::expect_columns_equal(expected_or, or_result);
+}
+
+TEST_F(BitmaskBinopTest, AndOrSliced) {
+  thrust::host_vector<int> validity1(1000), validity2(1000);
+  for (size_t i = 0; i < validity1.size(); ++i) {
+    validity1[i] = (i % 3) != 0;
+    validity2[i] = (i % 5) != 0;
+  }
+  auto const values = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(
+    values, values + 1000, validity1.begin());
+  cudf::test::fixed_width_column_wrapper<int32_t> col2(
+    values, values + 1000, validity2.begin());
+  auto sliced1 = cudf::experimental::slice(col1, {3, 1000})[0];
+  auto sliced2 = cudf::experimental::slice(col2, {40, 1000})[0];
+  auto sliced_values = cudf::experimental::slice(col1, {0, 960})[0];
+
+  thrust::host_vector<int> expected_and(960), expected_or(960);
+  for (size_t i = 0; i < expected_and.size(); ++i) {
+    expected_and[i] = validity1[i + 3] and validity2[i + 40];
+    expected_or[i]  = validity1[i + 3] or validity2[i + 40];
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_and_col(
+    values, values + 960, expected_and.begin());
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_or_col(
+    values, values + 960, expected_or.begin());
+
+  cudf::table_view input({cudf::experimental::slice(sliced1, {0, 960})[0], sliced2});
+  auto and_mask = cudf::bitmask_and(input);
+  cudf::column_view and_result(cudf::data_type{cudf::INT32},
+                               960,
+                               sliced_values.head(),
+                               static_cast<cudf::bitmask_type const *>(and_mask.data()));
+  cudf::test::expect_columns_equal(expected_and_col, and_result);
+
+  auto or_mask = cudf::bitmask_or(input);
+  cudf::column_view or_result(cudf::data_type{cudf::INT32},
+                              960,
+                              sliced_values.head(),
+                              static_cast<cudf::bitmask_type const *>(or_mask.data()));
+  cudf::test::expect_columns_equal(expected_or_col, or_result);
+}
+
+TEST_F(BitmaskBinopTest, OrWithNonNullable) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({0, 1, 2}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({0, 1, 2});
+  auto or_mask = cudf::bitmask_or(cudf::table_view({col1, col2}));
+  EXPECT_EQ(0u, or_mask.size());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -83,3 +83,18 @@ TEST_F(ValidIfTest, AllNull) {
                                    expected.size());
   EXPECT_EQ(10000, actual.second);
 }
+
+TEST_F(ValidIfTest, DeferredNullCount) {
+  auto iter = cudf::test::make_counting_transform_iterator(0, odds_valid{});
+  auto expected = cudf::test::detail::make_null_mask(iter, iter + 10000);
+  auto actual = cudf::experimental::detail::valid_if(
+      thrust::make_counting_iterator(0), thrust::make_counting_iterator(10000),
+      odds_valid{}, 0, rmm::mr::get_default_resource(),
+      cudf::experimental::detail::null_count_policy::DEFER);
+  cudf::test::expect_equal_buffers(expected.data(), actual.first.data(),
+                                   expected.size());
+  EXPECT_EQ(cudf::UNKNOWN_NULL_COUNT, actual.second);
+  EXPECT_EQ(5000, cudf::count_unset_bits(
+                      static_cast<cudf::bitmask_type const*>(actual.first.data()),
+                      0, 10000));
+}
@@ -290,6 +290,85 @@ TYPED_TEST(TypedColumnTest, CopyConstructorWithMask) {
   EXPECT_NE(original_view.null_mask(), copy_view.null_mask());
 }
 
+TYPED_TEST(TypedColumnTest, ShareColumn) {
+  std::shared_ptr<cudf::column const> owner = std::make_unique<cudf::column>(
+    this->type(), this->num_elements(), this->data, this->all_valid_mask);
+  auto const owner_view = owner->view();
+  auto shared = cudf::column::share(owner);
+  EXPECT_TRUE(shared->is_shared());
+  EXPECT_FALSE(owner->is_shared());
+  EXPECT_EQ(owner_view.head(), shared->view().head());
+  EXPECT_EQ(owner_view.null_mask(), shared->view().null_mask());
+  EXPECT_EQ(owner->null_count(), shared->null_count());
+  EXPECT_TRUE(shared->nullable());
+
+  // A shared column is read-only
+  EXPECT_THROW(shared->mutable_view(), cudf::logic_error);
+  EXPECT_THROW(shared->set_null_mask(rmm::device_buffer{}, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::column::share(nullptr), cudf::logic_error);
+
+  // The memory outlives the last reference to the owner
+  owner.reset();
+  cudf::test::expect_columns_equal(owner_view, *shared);
+
+  // Copies own a deep copy of the shared memory
+  cudf::column copy{*shared};
+  EXPECT_FALSE(copy.is_shared());
+  EXPECT_NE(owner_view.head(), copy.view().head());
+  cudf::test::expect_columns_equal(owner_view, copy);
+  verify_column_views(copy);
+
+  // Releasing a shared column releases a deep copy of the shared memory
+  auto const size = shared->size();
+  auto contents   = shared->release();
+  EXPECT_FALSE(shared->is_shared());
+  EXPECT_EQ(0, shared->size());
+  EXPECT_NE(owner_view.head(), contents.data->data());
+  cudf::column released{
+    this->type(), size, std::move(*contents.data), std::move(*contents.null_mask)};
+  cudf::test::expect_columns_equal(copy, released);
+}
+
+struct SharedColumnTest : public cudf::test::BaseFixture {};
+
+TEST_F(SharedColumnTest, ShareChildren) {
+  std::shared_ptr<cudf::column const> owner =
+    cudf::test::strings_column_wrapper({"a", "bb", "", "ccc"}, {1, 1, 0, 1}).release();
+  auto const owner_view = owner->view();
+  auto shared = cudf::column::share(owner);
+  owner.reset();
+
+  ASSERT_EQ(owner_view.num_children(), shared->num_children());
+  for (cudf::size_type i = 0; i < shared->num_children(); ++i) {
+    EXPECT_TRUE(shared->child(i).is_shared());
+    EXPECT_EQ(owner_view.child(i).head(), shared->child(i).view().head());
+    EXPECT_THROW(shared->child(i).mutable_view(), cudf::logic_error);
+  }
+  cudf::test::expect_columns_equal(owner_view, *shared);
+}
+
+TEST_F(SharedColumnTest, ReleaseSharedChildren) {
+  auto const expected =
+    cudf::test::strings_column_wrapper({"a", "bb", "", "ccc"}, {1, 1, 0, 1}).release();
+  std::shared_ptr<cudf::column const> owner = std::make_unique<cudf::column>(*expected);
+  auto shared = cudf::column::share(owner);
+  owner.reset();
+
+  // The released children own their memory, which outlives the shared column
+  auto const null_count = shared->null_count();
+  auto contents         = shared->release();
+  shared.reset();
+  ASSERT_EQ(expected->num_children(), static_cast<cudf::size_type>(contents.children.size()));
+  for (auto const& child : contents.children) { EXPECT_FALSE(child->is_shared()); }
+  cudf::column released{expected->type(),
+                        expected->size(),
+                        std::move(*contents.data),
+                        std::move(*contents.null_mask),
+                        null_count,
+                        std::move(contents.children)};
+  cudf::test::expect_columns_equal(*expected, released);
+}
+
 TYPED_TEST(TypedColumnTest, MoveConstructorNoMask) {
   cudf::column original{this->type(), this->num_elements(), this->data};
 
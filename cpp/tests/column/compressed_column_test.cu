@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/compressed_column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace cudf::test;
+using cudf::experimental::column_encoding;
+
+struct CompressedColumnTest : public BaseFixture {};
+
+template <typename T>
+struct CompressedIntegerTest : public BaseFixture {};
+
+using IntegerTypes =
+  cudf::test::Types<int8_t, int16_t, int32_t, int64_t, timestamp_D, timestamp_ms, timestamp_ns>;
+
+TYPED_TEST_CASE(CompressedIntegerTest, IntegerTypes);
+
+namespace {
+
+void expect_round_trip(cudf::column_view const& input, column_encoding encoding) {
+  auto const compressed = cudf::experimental::compress(input);
+  EXPECT_EQ(compressed->type(), input.type());
+  EXPECT_EQ(compressed->size(), input.size());
+  EXPECT_EQ(compressed->null_count(), input.null_count());
+  EXPECT_EQ(compressed->encoding(), encoding);
+  expect_columns_equal(input, cudf::experimental::decompress(*compressed)->view());
+}
+
+}  // namespace
+
+TYPED_TEST(CompressedIntegerTest, Runs) {
+  auto const values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return TypeParam(i / 100); });
+  fixed_width_column_wrapper<TypeParam> input(values, values + 5000);
+  expect_round_trip(input, column_encoding::CASCADED);
+}
+
+TYPED_TEST(CompressedIntegerTest, Sorted) {
+  auto const values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return TypeParam(i / 3); });
+  fixed_width_column_wrapper<TypeParam> input(values, values + 3000);
+  expect_round_trip(input, column_encoding::CASCADED);
+}
+
+TYPED_TEST(CompressedIntegerTest, Random) {
+  std::mt19937 engine;
+  std::uniform_int_distribution<int> distribution(-128, 127);
+  std::vector<TypeParam> values(2500);
+  for (auto& v : values) { v = TypeParam(distribution(engine)); }
+  fixed_width_column_wrapper<TypeParam> input(values.begin(), values.end());
+  expect_round_trip(input, column_encoding::CASCADED);
+}
+
+TYPED_TEST(CompressedIntegerTest, Nulls) {
+  auto const values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return TypeParam(i % 7); });
+  auto const valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return i % 5 != 0; });
+  fixed_width_column_wrapper<TypeParam> input(values, values + 2100, valids);
+  expect_round_trip(input, column_encoding::CASCADED);
+}
+
+TEST_F(CompressedColumnTest, ExtremeValues) {
+  fixed_width_column_wrapper<int64_t> input{std::numeric_limits<int64_t>::min(),
+                                            std::numeric_limits<int64_t>::max(),
+                                            0,
+                                            -1,
+                                            std::numeric_limits<int64_t>::max(),
+                                            1};
+  expect_round_trip(input, column_encoding::CASCADED);
+}
+
+TEST_F(CompressedColumnTest, Slice) {
+  auto const values = thrust::make_counting_iterator(0);
+  auto const valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return i % 3 != 0; });
+  fixed_width_column_wrapper<int32_t> input(values, values + 3000, valids);
+  auto const sliced = cudf::experimental::slice(input, {1001, 2500}).front();
+  expect_round_trip(sliced, column_encoding::CASCADED);
+}
+
+TEST_F(CompressedColumnTest, Strings) {
+  std::vector<char const*> h_strings{"aa", "bbb", nullptr, "aa", "", "c", "bbb", nullptr, "aa"};
+  strings_column_wrapper input(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  expect_round_trip(input, column_encoding::DICTIONARY);
+}
+
+TEST_F(CompressedColumnTest, AllNullStrings) {
+  strings_column_wrapper input({"", "", ""}, {0, 0, 0});
+  expect_round_trip(input, column_encoding::DICTIONARY);
+}
+
+TEST_F(CompressedColumnTest, Floats) {
+  fixed_width_column_wrapper<double> input({1.5, 2.5, -3.0, 4.25}, {1, 0, 1, 1});
+  expect_round_trip(input, column_encoding::NONE);
+}
+
+TEST_F(CompressedColumnTest, Empty) {
+  fixed_width_column_wrapper<int32_t> input{};
+  expect_round_trip(input, column_encoding::NONE);
+}
+
+TEST_F(CompressedColumnTest, CompressedSize) {
+  auto const runs   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                    [](auto i) { return int64_t{i / 1000}; });
+  auto const sorted = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return int64_t{i} * 7; });
+  fixed_width_column_wrapper<int64_t> runs_column(runs, runs + 100000);
+  fixed_width_column_wrapper<int64_t> sorted_column(sorted, sorted + 100000);
+  auto const uncompressed_size = 100000 * sizeof(int64_t);
+  EXPECT_LT(cudf::experimental::compress(runs_column)->compressed_size(), uncompressed_size / 100);
+  EXPECT_LT(cudf::experimental::compress(sorted_column)->compressed_size(),
+            uncompressed_size / 100);
+}
+
+TEST_F(CompressedColumnTest, Table) {
+  fixed_width_column_wrapper<int32_t> col0{1, 1, 1, 2, 2, 3};
+  strings_column_wrapper col1({"x", "y", "x", "z", "", "y"}, {1, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<float> col2{0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f};
+  cudf::table_view input{{col0, col1, col2}};
+
+  auto const compressed = cudf::experimental::compress(input);
+  EXPECT_EQ(compressed->num_columns(), 3);
+  EXPECT_EQ(compressed->num_rows(), 6);
+  expect_tables_equal(input, cudf::experimental::decompress(*compressed)->view());
+  expect_tables_equal(input.select({2, 0}),
+                      cudf::experimental::decompress(*compressed, {2, 0})->view());
+  EXPECT_THROW(cudf::experimental::decompress(*compressed, {3}), std::out_of_range);
+}
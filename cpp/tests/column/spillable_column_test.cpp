@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/spillable_column.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <vector>
+
+using namespace cudf::test;
+using cudf::spill_location;
+
+TempDirTestEnvironment* const temp_env = static_cast<TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new TempDirTestEnvironment));
+
+struct SpillableColumnTest : public BaseFixture {};
+
+namespace {
+
+constexpr cudf::size_type num_rows = 1000;
+constexpr std::size_t column_size  = num_rows * sizeof(int32_t);
+
+fixed_width_column_wrapper<int32_t> make_column(int32_t first) {
+  auto const values = thrust::make_counting_iterator(first);
+  return fixed_width_column_wrapper<int32_t>(values, values + num_rows);
+}
+
+std::unique_ptr<cudf::column> to_column(cudf::column_view const& view) {
+  return std::make_unique<cudf::column>(view);
+}
+
+}  // namespace
+
+TEST_F(SpillableColumnTest, SpillsLeastRecentlyUsed) {
+  auto const expected_a = make_column(0);
+  auto const expected_b = make_column(num_rows);
+  cudf::spill_manager manager(column_size + column_size / 2);
+
+  auto a = manager.make_spillable(to_column(expected_a));
+  EXPECT_EQ(a->location(), spill_location::DEVICE);
+  EXPECT_EQ(a->size_bytes(), column_size);
+
+  auto b = manager.make_spillable(to_column(expected_b));
+  EXPECT_EQ(a->location(), spill_location::HOST);
+  EXPECT_EQ(b->location(), spill_location::DEVICE);
+  EXPECT_EQ(manager.device_bytes(), column_size);
+  EXPECT_EQ(manager.host_bytes(), column_size);
+
+  expect_columns_equal(expected_a, a->get()->view());
+  EXPECT_EQ(a->location(), spill_location::DEVICE);
+  EXPECT_EQ(b->location(), spill_location::HOST);
+
+  expect_columns_equal(expected_b, b->get()->view());
+  EXPECT_EQ(a->location(), spill_location::HOST);
+  EXPECT_EQ(b->location(), spill_location::DEVICE);
+}
+
+TEST_F(SpillableColumnTest, ColumnsInUseAreNotSpilled) {
+  auto const expected_a = make_column(0);
+  auto const expected_b = make_column(num_rows);
+  cudf::spill_manager manager(column_size);
+
+  auto a = manager.make_spillable(to_column(expected_a));
+  {
+    auto const in_use = a->get();
+    auto b            = manager.make_spillable(to_column(expected_b));
+    EXPECT_EQ(a->location(), spill_location::DEVICE);
+    EXPECT_EQ(b->location(), spill_location::DEVICE);
+    EXPECT_EQ(manager.device_bytes(), 2 * column_size);
+    EXPECT_EQ(manager.available_bytes(), 0u);
+
+    EXPECT_TRUE(manager.spill(2 * column_size));
+    EXPECT_EQ(a->location(), spill_location::DEVICE);
+    EXPECT_EQ(b->location(), spill_location::HOST);
+    expect_columns_equal(expected_a, in_use->view());
+  }
+  EXPECT_EQ(manager.device_bytes(), column_size);
+  EXPECT_TRUE(manager.spill(column_size));
+  EXPECT_EQ(a->location(), spill_location::HOST);
+  EXPECT_EQ(manager.available_bytes(), column_size);
+}
+
+TEST_F(SpillableColumnTest, SpillToDisk) {
+  std::vector<char const*> h_strings{"eee", "bb", nullptr, "", "aa", "bbb", "ééé"};
+  strings_column_wrapper expected_a(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto const expected_b = make_column(0);
+  cudf::spill_manager manager(column_size, 0, temp_env->tmpdir);
+
+  auto a = manager.make_spillable(to_column(expected_a));
+  auto b = manager.make_spillable(to_column(expected_b));
+  EXPECT_EQ(a->location(), spill_location::DISK);
+  EXPECT_EQ(manager.host_bytes(), 0u);
+  EXPECT_EQ(manager.disk_bytes(), a->size_bytes());
+
+  expect_columns_equal(expected_a, a->get()->view());
+  EXPECT_EQ(a->location(), spill_location::DEVICE);
+  EXPECT_EQ(b->location(), spill_location::DISK);
+  expect_columns_equal(expected_b, b->get()->view());
+}
+
+TEST_F(SpillableColumnTest, LargerThanStaging) {
+  auto const values = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int64_t> expected(values, values + 3000000);
+  cudf::spill_manager manager(0);
+
+  auto col = manager.make_spillable(to_column(expected));
+  EXPECT_TRUE(manager.spill(1));
+  EXPECT_EQ(col->location(), spill_location::HOST);
+  expect_columns_equal(expected, col->get()->view());
+}
+
+TEST_F(SpillableColumnTest, ProducerStream) {
+  // The copies to host are ordered after the producer's non-blocking stream
+  auto const values = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int64_t> expected(values, values + 3000000);
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  cudf::spill_manager manager(0);
+
+  auto col = manager.make_spillable(std::make_unique<cudf::column>(expected, stream), stream);
+  EXPECT_TRUE(manager.spill(1));
+  EXPECT_EQ(col->location(), spill_location::HOST);
+  {
+    auto const in_use = col->get(stream);
+    auto copy         = std::make_unique<cudf::column>(in_use->view(), stream);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    expect_columns_equal(expected, copy->view());
+  }
+  EXPECT_TRUE(manager.spill(1));
+  EXPECT_EQ(col->location(), spill_location::HOST);
+  expect_columns_equal(expected, col->get()->view());
+  CUDA_TRY(cudaStreamDestroy(stream));
+}
+
+TEST_F(SpillableColumnTest, Destroy) {
+  auto const expected = make_column(0);
+  cudf::spill_manager manager(0, 0, temp_env->tmpdir);
+  {
+    auto col = manager.make_spillable(to_column(expected));
+    EXPECT_TRUE(manager.spill(column_size));
+    EXPECT_EQ(col->location(), spill_location::DISK);
+  }
+  EXPECT_EQ(manager.device_bytes(), 0u);
+  EXPECT_EQ(manager.host_bytes(), 0u);
+  EXPECT_EQ(manager.disk_bytes(), 0u);
+}
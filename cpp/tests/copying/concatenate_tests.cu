@@ -263,3 +263,30 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
     cudf::test::expect_tables_equal( concatenated_tables->view(), table_view_exp1);
   }
 }
+
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  auto iter   = thrust::make_counting_iterator(0);
+  auto valids = thrust::make_transform_iterator(iter, [](auto i) { return i % 7 != 0; });
+  std::vector<std::string> strings(200);
+  std::transform(iter, iter + 200, strings.begin(), [](auto i) {
+    return std::string(i % 5, 'a' + i % 26);
+  });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(iter, iter + 200, valids);
+  cudf::test::fixed_width_column_wrapper<double> doubles(iter, iter + 200);
+  cudf::test::strings_column_wrapper names(strings.begin(), strings.end(), valids);
+  cudf::test::fixed_width_column_wrapper<int8_t> bytes(iter, iter + 200, valids);
+  cudf::table_view input{{ints, doubles, names, bytes}};
+
+  // Slices of a few rows, some empty, each with a different offset
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type row = 3; row < 200; row += 1 + row % 6) {
+    splits.push_back(row);
+    if (row % 5 == 0) { splits.push_back(row); }
+  }
+  auto const tables_to_concat = cudf::experimental::split(input, splits);
+  ASSERT_GT(tables_to_concat.size(), 8u);
+
+  auto const concatenated_tables = cudf::experimental::concatenate(tables_to_concat);
+  cudf::test::expect_tables_equal(concatenated_tables->view(), input);
+}
@@ -331,6 +331,31 @@ TYPED_TEST(GatherTest, MultiColNulls) {
 
 }
 
+// Gathers the fixed-width columns of a table together, and must match gathering each column alone
+TYPED_TEST(GatherTest, GatherMixedWidthTable) {
+  constexpr cudf::size_type source_size{1000};
+
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i){return i;});
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i){return i % 3 != 0;});
+  cudf::test::fixed_width_column_wrapper<TypeParam> typed(data, data+source_size, valids);
+  cudf::test::fixed_width_column_wrapper<int8_t> bytes(data, data+source_size);
+  cudf::test::fixed_width_column_wrapper<double> doubles(data, data+source_size, valids);
+  std::vector<std::string> strings(source_size, "abc");
+  cudf::test::strings_column_wrapper names(strings.begin(), strings.end());
+  cudf::table_view full_table ({typed, names, bytes, doubles});
+  auto source_table = cudf::experimental::slice(full_table, {10, source_size})[0];
+
+  auto gather_data = cudf::test::make_counting_transform_iterator(0, [](auto i){return (i * 7) % 990;});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(gather_data, gather_data + 500);
+
+  auto result = cudf::experimental::gather(source_table, gather_map);
+
+  for (auto i=0; i<source_table.num_columns(); ++i) {
+    auto expected = cudf::experimental::gather(cudf::table_view{{source_table.column(i)}}, gather_map);
+    cudf::test::expect_columns_equal(expected->view().column(0), result->view().column(i));
+  }
+}
+
 class GatherTestStr : public cudf::test::BaseFixture {};
 
 TEST_F(GatherTestStr, StringColumn) {
@@ -681,6 +681,29 @@ TYPED_TEST(BooleanMaskScatter, WithNull)
     cudf::test::expect_tables_equal(expected_table, got->view());
 }
 
+TYPED_TEST(BooleanMaskScatter, WithNullInManyColumns)
+{
+    using T = TypeParam;
+    cudf::test::fixed_width_column_wrapper<T> source_col1({1, 5, 6, 8, 9}, {1, 0, 1, 0, 1});
+    cudf::test::fixed_width_column_wrapper<int64_t> source_col2({-1, -5, -6, -8, -9});
+    cudf::test::fixed_width_column_wrapper<int8_t> source_col3({1, 5, 6, 8, 9}, {0, 1, 1, 1, 0});
+    cudf::test::fixed_width_column_wrapper<T> target_col1({ 2, 2, 3, 4, 11, 12, 7, 7, 10, 10}, {1, 1, 0, 1, 1, 1, 1, 1, 1, 0});
+    cudf::test::fixed_width_column_wrapper<int64_t> target_col2({-2, -2, -3, -4, -11, -12, -7, -7, -10, -10});
+    cudf::test::fixed_width_column_wrapper<int8_t> target_col3({ 2, 2, 3, 4, 11, 12, 7, 7, 10, 10});
+    cudf::test::fixed_width_column_wrapper<bool> mask({true,  false, false, false, true, true, false, true, true, false});
+
+    cudf::test::fixed_width_column_wrapper<T> expected_col1 ({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, {1, 1, 0, 1, 0, 1, 1, 0, 1, 0});
+    cudf::test::fixed_width_column_wrapper<int64_t> expected_col2 ({-1, -2, -3, -4, -5, -6, -7, -8, -9, -10});
+    cudf::test::fixed_width_column_wrapper<int8_t> expected_col3 ({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, {0, 1, 1, 1, 1, 1, 1, 1, 0, 1});
+    auto source_table = cudf::table_view({source_col1, source_col2, source_col3});
+    auto target_table = cudf::table_view({target_col1, target_col2, target_col3});
+    auto expected_table = cudf::table_view({expected_col1, expected_col2, expected_col3});
+
+    auto got = cudf::experimental::boolean_mask_scatter(source_table, target_table, mask);
+
+    cudf::test::expect_tables_equal(expected_table, got->view());
+}
+
 class BooleanMaskScatterString : public cudf::test::BaseFixture {};
 
 TEST_F(BooleanMaskScatterString, NoNUll)
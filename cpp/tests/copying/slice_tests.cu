@@ -180,6 +180,31 @@ TEST_F(SliceCornerCases, NegativeOffset) {
 }
 
 
+TEST_F(SliceCornerCases, NullCountsOfSlicedSlices) {
+    cudf::test::fixed_width_column_wrapper<int32_t> col({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                        {1, 0, 0, 1, 1, 0, 1, 1, 1, 0});
+    std::vector<cudf::size_type> indices{0, 4, 2, 8, 8, 10, 5, 5};
+    auto const slices = cudf::experimental::slice(col, indices);
+    ASSERT_EQ(4u, slices.size());
+    // The first null count queried counts those of all the slices
+    EXPECT_EQ(0, slices[3].null_count());
+    EXPECT_EQ(2, slices[0].null_count());
+    EXPECT_EQ(2, slices[1].null_count());
+    EXPECT_EQ(1, slices[2].null_count());
+
+    // The indices are relative to the offset of a sliced column
+    auto const nested = cudf::experimental::slice(slices[1], {0, 1, 1, 6});
+    EXPECT_EQ(1, nested[0].null_count());
+    EXPECT_EQ(1, nested[1].null_count());
+
+    cudf::table_view const table({slices[1], slices[1]});
+    auto const tables = cudf::experimental::slice(table, {0, 3, 3, 6});
+    for (auto const& t : tables) {
+        EXPECT_EQ(1, t.column(0).null_count());
+        EXPECT_EQ(1, t.column(1).null_count());
+    }
+}
+
 template <typename T>
 struct SliceTableTest : public cudf::test::BaseFixture {};
 
@@ -25,6 +25,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <cudf/legacy/interop.hpp>
 #include <tests/utilities/legacy/cudf_test_utils.cuh>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -613,3 +614,43 @@ TEST_F(ContiguousSplitTableCornerCases, MixedColumnTypes) {
     cudf::test::expect_tables_equivalent(expected[index], result[index].table);
   }
 }
+
+TEST_F(ContiguousSplitTableCornerCases, PackIntoBuffer) {
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto iter = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  cudf::test::fixed_width_column_wrapper<int> c0(iter, iter + 10, valids);
+  std::vector<std::string> strings{
+    "", "this", "is", "a", "column", "of", "strings", "with", "in", "valid"};
+  cudf::test::strings_column_wrapper c1(strings.begin(), strings.end(), valids);
+  cudf::table_view tbl{{c0, c1}};
+
+  std::vector<cudf::size_type> splits{3, 3, 7};
+  auto sizes = cudf::experimental::contiguous_split_sizes(tbl, splits);
+  ASSERT_EQ(splits.size() + 1, sizes.size());
+  auto total_size = std::accumulate(sizes.begin(), sizes.end(), size_t{0});
+  rmm::device_buffer buffer(total_size);
+
+  auto packed = cudf::experimental::contiguous_split(tbl, splits, buffer.data(), buffer.size());
+  auto expected = cudf::experimental::split(tbl, splits);
+  ASSERT_EQ(expected.size(), packed.size());
+
+  for (size_t index = 0; index < expected.size(); index++) {
+    EXPECT_EQ(sizes[index], packed[index].size);
+    // The partition is viewed again after being moved elsewhere
+    rmm::device_buffer moved(static_cast<char*>(buffer.data()) + packed[index].offset,
+                             packed[index].size);
+    auto unpacked = cudf::experimental::unpack(packed[index].metadata, moved.data());
+    cudf::test::expect_tables_equal(expected[index], unpacked);
+  }
+}
+
+TEST_F(ContiguousSplitTableCornerCases, PackIntoSmallBuffer) {
+  cudf::test::fixed_width_column_wrapper<int> c0{1, 2, 3, 4, 5};
+  cudf::table_view tbl{{c0}};
+  std::vector<cudf::size_type> splits{2};
+  auto sizes = cudf::experimental::contiguous_split_sizes(tbl, splits);
+  rmm::device_buffer buffer(sizes[0]);
+
+  EXPECT_THROW(cudf::experimental::contiguous_split(tbl, splits, buffer.data(), buffer.size()),
+               cudf::logic_error);
+}
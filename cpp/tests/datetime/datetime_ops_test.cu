@@ -17,6 +17,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -57,6 +58,8 @@ TYPED_TEST(NonTimestampTest, TestThrowsOnNonTimestamp) {
   EXPECT_THROW(extract_minute(col), cudf::logic_error);
   EXPECT_THROW(extract_second(col), cudf::logic_error);
   EXPECT_THROW(last_day_of_month(col), cudf::logic_error);
+  EXPECT_THROW(extract_components(col, {datetime_component::YEAR}), cudf::logic_error);
+  EXPECT_THROW(ceil_datetimes(col, rounding_frequency::DAY), cudf::logic_error);
 }
 
 struct BasicDatetimeOpsTest : public cudf::test::BaseFixture {};
@@ -145,6 +148,43 @@ struct TypedDatetimeOpsTest : public cudf::test::BaseFixture {
 
 TYPED_TEST_CASE(TypedDatetimeOpsTest, cudf::test::TimestampTypes);
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingSeveralDatetimeComponents) {
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace simt::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop_ = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps = generate_timestamps<T>(this->size(), time_point_ms(start),
+                                           time_point_ms(stop_));
+
+  auto const components = extract_components(
+      timestamps,
+      {datetime_component::SECOND, datetime_component::YEAR, datetime_component::WEEKDAY,
+       datetime_component::HOUR, datetime_component::DAY, datetime_component::MINUTE,
+       datetime_component::MONTH, datetime_component::YEAR});
+  ASSERT_EQ(components->num_columns(), 8);
+  expect_columns_equal(components->get_column(0), *extract_second(timestamps));
+  expect_columns_equal(components->get_column(1), *extract_year(timestamps));
+  expect_columns_equal(components->get_column(2), *extract_weekday(timestamps));
+  expect_columns_equal(components->get_column(3), *extract_hour(timestamps));
+  expect_columns_equal(components->get_column(4), *extract_day(timestamps));
+  expect_columns_equal(components->get_column(5), *extract_minute(timestamps));
+  expect_columns_equal(components->get_column(6), *extract_month(timestamps));
+  expect_columns_equal(components->get_column(7), *extract_year(timestamps));
+
+  // Only the time of day is extracted
+  auto const times = extract_components(
+      timestamps, {datetime_component::HOUR, datetime_component::MINUTE});
+  expect_columns_equal(times->get_column(0), *extract_hour(timestamps));
+  expect_columns_equal(times->get_column(1), *extract_minute(timestamps));
+
+  EXPECT_EQ(extract_components(timestamps, {})->num_columns(), 0);
+  EXPECT_THROW(extract_components(timestamps, {datetime_component::INVALID}),
+               cudf::logic_error);
+}
+
 TYPED_TEST(TypedDatetimeOpsTest, TestEmptyColumns) {
   using T = TypeParam;
   using namespace cudf::test;
@@ -345,4 +385,122 @@ TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithDate) {
                        true);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestRoundingDatetimes) {
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+      {
+          -131968728,  // 1965-10-26 14:01:12 GMT
+          1530705600,  // 2018-07-04 12:00:00 GMT
+          1674631932,  // 2023-01-25 07:32:12 GMT
+          1576368000,  // 2019-12-15 00:00:00 GMT
+          1593561600,  // 2020-07-01 00:00:00 GMT
+          0,
+      },
+      {1, 1, 1, 1, 1, 0}};
+
+  expect_columns_equal(
+      *floor_datetimes(timestamps_s, rounding_frequency::HOUR),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-131968800, 1530705600, 1674630000, 1576368000, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+      *ceil_datetimes(timestamps_s, rounding_frequency::HOUR),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-131965200, 1530705600, 1674633600, 1576368000, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+      *floor_datetimes(timestamps_s, rounding_frequency::DAY),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-132019200, 1530662400, 1674604800, 1576368000, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+      *ceil_datetimes(timestamps_s, rounding_frequency::DAY),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-131932800, 1530748800, 1674691200, 1576368000, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+      *floor_datetimes(timestamps_s, rounding_frequency::MONTH),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-134179200, 1530403200, 1672531200, 1575158400, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+  expect_columns_equal(
+      *ceil_datetimes(timestamps_s, rounding_frequency::MONTH),
+      fixed_width_column_wrapper<cudf::timestamp_s>{
+          {-131500800, 1533081600, 1675209600, 1577836800, 1593561600, 0},
+          {1, 1, 1, 1, 1, 0}});
+
+  // Units finer than the resolution leave the values unchanged
+  auto timestamps_D = fixed_width_column_wrapper<cudf::timestamp_D>{-1528, 17716, 19382};
+  expect_columns_equal(*floor_datetimes(timestamps_D, rounding_frequency::HOUR), timestamps_D);
+  expect_columns_equal(*ceil_datetimes(timestamps_D, rounding_frequency::SECOND), timestamps_D);
+  expect_columns_equal(*ceil_datetimes(timestamps_D, rounding_frequency::MONTH),
+                       fixed_width_column_wrapper<cudf::timestamp_D>{-1522, 17744, 19389});
+
+  EXPECT_THROW(floor_datetimes(fixed_width_column_wrapper<int64_t>{1}, rounding_frequency::DAY),
+               cudf::logic_error);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone) {
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto utc = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {
+      1583649000,  // 2020-03-08 06:30:00 GMT, before the DST transition
+      1583652600,  // 2020-03-08 07:30:00 GMT, after the DST transition
+      1593864000,  // 2020-07-04 12:00:00 GMT
+      0,           // null
+      4118083200,  // 2100-07-01 00:00:00 GMT, after the transitions of the database
+      -131968728,  // 1965-10-26 14:01:12 GMT
+    },
+    {true, true, true, false, true, true}};
+  auto new_york = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {1583631000, 1583638200, 1593849600, 0, 4118068800, -131983128},
+    {true, true, true, false, true, true}};
+
+  expect_columns_equal(*convert_timezone(utc, "UTC", "America/New_York"), new_york);
+  expect_columns_equal(*convert_timezone(new_york, "America/New_York", "UTC"), utc);
+  expect_columns_equal(*convert_timezone(utc, "UTC", ""), utc);
+
+  auto local_ms = fixed_width_column_wrapper<cudf::timestamp_ms>{
+    1583634600000,  // 2020-03-08 02:30:00, skipped by the DST transition
+    1604194200000,  // 2020-11-01 01:30:00, repeated by the DST transition
+  };
+  expect_columns_equal(*convert_timezone(local_ms, "America/New_York", "UTC"),
+                       fixed_width_column_wrapper<cudf::timestamp_ms>{
+                         1583652600000,  // 2020-03-08 07:30:00 GMT
+                         1604208600000,  // 2020-11-01 05:30:00 GMT
+                       });
+
+  EXPECT_THROW(convert_timezone(utc, "UTC", "Not/A_Zone"), cudf::logic_error);
+  EXPECT_THROW(convert_timezone(fixed_width_column_wrapper<int64_t>{1}, "UTC", "UTC"),
+               cudf::logic_error);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestExtractingLocalDatetimeComponents) {
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_s = fixed_width_column_wrapper<cudf::timestamp_s>{
+    1593864000,  // 2020-07-04 12:00:00 GMT
+    1593906300,  // 2020-07-04 23:45:00 GMT
+  };
+
+  expect_columns_equal(*extract_hour(timestamps_s, "America/New_York"),
+                       fixed_width_column_wrapper<int16_t>{8, 19});
+  expect_columns_equal(*extract_day(timestamps_s, "Asia/Kolkata"),
+                       fixed_width_column_wrapper<int16_t>{4, 5});
+  expect_columns_equal(*extract_weekday(timestamps_s, "Asia/Kolkata"),
+                       fixed_width_column_wrapper<int16_t>{6, 7});
+  expect_columns_equal(*extract_hour(timestamps_s, "Asia/Kolkata"),
+                       fixed_width_column_wrapper<int16_t>{17, 5});
+  expect_columns_equal(*extract_minute(timestamps_s, "Asia/Kolkata"),
+                       fixed_width_column_wrapper<int16_t>{30, 15});
+  expect_columns_equal(*extract_year(timestamps_s, "UTC"), *extract_year(timestamps_s));
+
+  EXPECT_THROW(extract_hour(timestamps_s, "Not/A_Zone"), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -69,6 +69,27 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
     cudf::test::expect_columns_equal(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeManyDuplicates)
+{
+    std::vector<int32_t> h_input(10000);
+    std::vector<int32_t> h_expected(h_input.size());
+    for( size_t idx=0; idx < h_input.size(); ++idx )
+    {
+        h_input[idx] = static_cast<int32_t>((idx * 7) % 13) * 10 - 50;
+        h_expected[idx] = static_cast<int32_t>((idx * 7) % 13);
+    }
+    cudf::test::fixed_width_column_wrapper<int32_t> input( h_input.begin(), h_input.end() );
+
+    auto dictionary = cudf::dictionary::encode( input );
+    cudf::dictionary_column_view view(dictionary->view());
+
+    cudf::test::fixed_width_column_wrapper<int32_t> keys_expected{ -50,-40,-30,-20,-10,0,10,20,30,40,50,60,70 };
+    cudf::test::expect_columns_equal(view.keys(), keys_expected);
+
+    cudf::test::fixed_width_column_wrapper<int32_t> expected( h_expected.begin(), h_expected.end() );
+    cudf::test::expect_columns_equal(view.indices(), expected);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
     cudf::test::fixed_width_column_wrapper<int16_t> input{ 0,1,2,3,-1,-2,-3 };
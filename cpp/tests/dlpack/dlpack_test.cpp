@@ -102,6 +102,23 @@ TEST_F(DLPackUntypedTests, InvalidNullsToDlpack)
   EXPECT_THROW(cudf::to_dlpack(input), cudf::logic_error);
 }
 
+TEST_F(DLPackUntypedTests, EmptyOwnedColumnToDlpack)
+{
+  EXPECT_EQ(nullptr, cudf::to_dlpack(fixed_width_column_wrapper<int32_t>({}).release()));
+}
+
+TEST_F(DLPackUntypedTests, RowStrideFromDlpackView)
+{
+  fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<int32_t> col2({5, 6, 7, 8});
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  // Spoof a row-major layout
+  tensor->dl_tensor.strides[0] = 2;
+  EXPECT_THROW(cudf::from_dlpack_view(tensor.get()), cudf::logic_error);
+}
+
 TEST_F(DLPackUntypedTests, StringTypeToDlpack)
 {
   strings_column_wrapper col({"foo", "bar", "baz"});
@@ -357,6 +374,81 @@ TYPED_TEST(DLPackNumericTests, FromDlpackCpu)
   expect_tables_equal(expected, result->view());
 }
 
+TYPED_TEST(DLPackNumericTests, OwnedColumnToDlpack)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto owned       = col.release();
+  auto const input = owned->view();
+  unique_managed_tensor mask(cudf::mask_to_dlpack(input));
+  auto const data = input.data<TypeParam>();
+  unique_managed_tensor result(cudf::to_dlpack(std::move(owned)));
+
+  // The tensor takes over the column buffer
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLGPU, tensor.ctx.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(nullptr, tensor.strides);
+  EXPECT_EQ(data, tensor.data);
+
+  // The mask tensor has a byte per row
+  auto const& mask_tensor = mask->dl_tensor;
+  validate_dtype<uint8_t>(mask_tensor.dtype);
+  EXPECT_EQ(1, mask_tensor.ndim);
+  EXPECT_EQ(4, mask_tensor.shape[0]);
+  fixed_width_column_wrapper<bool> expected_mask({1, 0, 1, 1});
+  cudf::column_view const mask_view(cudf::data_type{cudf::BOOL8}, 4, mask_tensor.data);
+  expect_columns_equal(expected_mask, mask_view);
+}
+
+TYPED_TEST(DLPackNumericTests, SharedColumnToDlpack)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  std::shared_ptr<cudf::column const> owner = col.release();
+  unique_managed_tensor result(cudf::to_dlpack(cudf::column::share(owner)));
+
+  // The tensor owns a copy of the shared memory
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(4, tensor.shape[0]);
+  ASSERT_NE(nullptr, tensor.data);
+  EXPECT_NE(owner->view().head(), tensor.data);
+  cudf::column_view const tensor_view(cudf::data_type{cudf::experimental::type_to_id<TypeParam>()},
+                                      4,
+                                      tensor.data);
+  expect_columns_equal(owner->view(), tensor_view);
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackView2D)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  // The view points into the tensor
+  auto const result = cudf::from_dlpack_view(tensor.get());
+  expect_tables_equal(input, result);
+  EXPECT_EQ(tensor->dl_tensor.data, result.column(0).head());
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackCpuView)
+{
+  auto const data = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4});
+  thrust::host_vector<TypeParam> host_vector(data.begin(), data.end());
+  int64_t shape[1] = {4};
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.ctx.device_type = kDLCPU;
+  tensor.dl_tensor.dtype           = get_dtype<TypeParam>();
+  tensor.dl_tensor.ndim            = 1;
+  tensor.dl_tensor.shape           = shape;
+  tensor.dl_tensor.data            = host_vector.data();
+
+  // Host memory still needs a copy
+  EXPECT_THROW(cudf::from_dlpack_view(&tensor), cudf::logic_error);
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
 {
   // Use to_dlpack to generate an input tensor
@@ -14,10 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/binaryop.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 #include <type_traits>
 #include <vector>
@@ -451,4 +456,77 @@ TEST_F(FixedPointTest, DecimalXXThrustOnDevice) {
 
 }
 
+struct FixedPointColumnTest : public cudf::test::BaseFixture {};
+
+// Views the representations of `reps` as fixed-point decimals of `scale`
+cudf::column_view decimal_view(cudf::column_view const& reps, cudf::type_id id, int32_t scale) {
+    return cudf::column_view{cudf::data_type{id, scale},
+                             reps.size(),
+                             reps.head(),
+                             reps.null_mask(),
+                             reps.null_count()};
+}
+
+TEST_F(FixedPointColumnTest, BinaryOperations) {
+
+    using namespace cudf::experimental;
+
+    // 1.00, 2.50, -0.75 and 0.5, 3.0, -1.0
+    cudf::test::fixed_width_column_wrapper<int32_t> lhs_reps{100, 250, -75};
+    cudf::test::fixed_width_column_wrapper<int32_t> rhs_reps{5, 30, -10};
+    auto const lhs = decimal_view(lhs_reps, cudf::DECIMAL32, -2);
+    auto const rhs = decimal_view(rhs_reps, cudf::DECIMAL32, -1);
+
+    auto const sum = binary_operation(
+        lhs, rhs, binary_operator::ADD, cudf::data_type{cudf::DECIMAL32, -2});
+    cudf::test::fixed_width_column_wrapper<int32_t> sum_reps{150, 550, -175};
+    cudf::test::expect_columns_equal(*sum, decimal_view(sum_reps, cudf::DECIMAL32, -2));
+
+    auto const product = binary_operation(
+        lhs, rhs, binary_operator::MUL, cudf::data_type{cudf::DECIMAL64, -3});
+    cudf::test::fixed_width_column_wrapper<int64_t> product_reps{500, 7500, 750};
+    cudf::test::expect_columns_equal(*product, decimal_view(product_reps, cudf::DECIMAL64, -3));
+
+    auto const quotient = binary_operation(
+        lhs, rhs, binary_operator::DIV, cudf::data_type{cudf::DECIMAL32, -2});
+    cudf::test::fixed_width_column_wrapper<int32_t> quotient_reps{200, 83, 75};
+    cudf::test::expect_columns_equal(*quotient, decimal_view(quotient_reps, cudf::DECIMAL32, -2));
+
+    auto const less = binary_operation(
+        lhs, rhs, binary_operator::LESS, cudf::data_type{cudf::BOOL8});
+    cudf::test::fixed_width_column_wrapper<bool> expected_less{false, true, false};
+    cudf::test::expect_columns_equal(*less, expected_less);
+
+    cudf::fixed_point_scalar<int32_t> const one{10, -1};
+    auto const plus_one = binary_operation(
+        lhs, one, binary_operator::ADD, cudf::data_type{cudf::DECIMAL32, -2});
+    cudf::test::fixed_width_column_wrapper<int32_t> plus_one_reps{200, 350, 25};
+    cudf::test::expect_columns_equal(*plus_one, decimal_view(plus_one_reps, cudf::DECIMAL32, -2));
+
+    EXPECT_THROW(binary_operation(lhs, rhs, binary_operator::POW,
+                                  cudf::data_type{cudf::DECIMAL32, -2}),
+                 cudf::logic_error);
+}
+
+TEST_F(FixedPointColumnTest, Reductions) {
+
+    using namespace cudf::experimental;
+
+    cudf::test::fixed_width_column_wrapper<int32_t> reps{{100, 250, -75, 999}, {1, 1, 1, 0}};
+    auto const col = decimal_view(reps, cudf::DECIMAL32, -2);
+
+    auto const sum = reduce(col, make_sum_aggregation(), cudf::data_type{cudf::DECIMAL64, -2});
+    EXPECT_EQ(sum->type(), (cudf::data_type{cudf::DECIMAL64, -2}));
+    EXPECT_EQ(static_cast<cudf::fixed_point_scalar<int64_t>*>(sum.get())->value(), 275);
+
+    auto const max = reduce(col, make_max_aggregation(), col.type());
+    EXPECT_EQ(max->type(), col.type());
+    EXPECT_EQ(static_cast<cudf::fixed_point_scalar<int32_t>*>(max.get())->value(), 250);
+
+    EXPECT_THROW(reduce(col, make_mean_aggregation(), cudf::data_type{cudf::FLOAT64}),
+                 cudf::logic_error);
+    EXPECT_THROW(reduce(col, make_sum_aggregation(), cudf::data_type{cudf::DECIMAL64, -1}),
+                 cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+
+template <typename V>
+struct groupby_approx_quantile_test : public cudf::test::BaseFixture {};
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_approx_quantile_test, supported_types);
+
+// Groups smaller than the number of centroids are digested exactly, so their
+// approximate quantiles are the LINEAR quantiles
+
+TYPED_TEST(groupby_approx_quantile_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  { 0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({   3.,        4.5,      7.   }, all_valid());
+
+    auto agg = cudf::experimental::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, empty_cols)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { };
+    fixed_width_column_wrapper<V> vals        { };
+
+    fixed_width_column_wrapper<K> expect_keys { };
+    fixed_width_column_wrapper<R> expect_vals { };
+
+    auto agg = cudf::experimental::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, zero_valid_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 1, 1};
+    fixed_width_column_wrapper<V> vals      ( { 3, 4, 5}, all_null() );
+
+    fixed_width_column_wrapper<K> expect_keys { 1 };
+    fixed_width_column_wrapper<R> expect_vals({ 0 }, all_null());
+
+    auto agg = cudf::experimental::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                              { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals(       { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                              { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+                                          //  { 1, 1,     2, 2, 2,   3, 3,    4}
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,         3,       4}, all_valid());
+                                          //  { 3, 6,     1, 4, 9,   2, 8,    -}
+    fixed_width_column_wrapper<R> expect_vals({  4.5,       4.,       5.,    0.},
+                                              {   1,         1,        1,     0});
+
+    auto agg = cudf::experimental::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, multiple_quantile)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  { 0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({  1.5,4.5, 3.25, 6.,  4.5,7.5}, all_valid());
+
+    auto agg = cudf::experimental::make_approx_quantile_aggregation({0.25, 0.75});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::YES);
+}
+
+
+} // namespace test
+} // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace test {
+
+// Compares the lists of the groups in the order of their keys
+void test_collect(column_view const& keys,
+                  column_view const& values,
+                  column_view const& expect_keys,
+                  column_view const& expect_offsets,
+                  column_view const& expect_child,
+                  force_use_sort_impl use_sort = force_use_sort_impl::NO,
+                  sorted keys_are_sorted       = sorted::NO)
+{
+  std::vector<experimental::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(experimental::make_collect_aggregation());
+  if (use_sort == force_use_sort_impl::YES) {
+    // WAR to force groupby to use sort implementation
+    requests[0].aggregations.push_back(experimental::make_nth_element_aggregation(0));
+  }
+
+  experimental::groupby::groupby gb_obj(table_view({keys}), include_nulls::NO, keys_are_sorted);
+  auto result = gb_obj.aggregate(requests);
+
+  auto const sort_order =
+    experimental::sorted_order(result.first->view(), {}, {null_order::AFTER});
+  auto const sorted_keys = experimental::gather(result.first->view(), *sort_order);
+  auto const sorted_lists =
+    experimental::gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+
+  expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+  EXPECT_EQ(sorted_lists->get_column(0).type().id(), type_id::LIST);
+  lists_column_view lists(sorted_lists->get_column(0));
+  expect_columns_equal(expect_offsets, lists.offsets());
+  expect_columns_equal(expect_child, lists.child(), true);
+}
+
+template <typename V>
+struct groupby_collect_test : public cudf::test::BaseFixture {};
+
+TYPED_TEST_CASE(groupby_collect_test, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(groupby_collect_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 1, 3, 2, 1};
+    fixed_width_column_wrapper<V> vals { 0, 3, 1, 5, 4, 2};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<size_type> expect_offsets { 0, 3, 5, 6 };
+    fixed_width_column_wrapper<V> expect_child { 0, 1, 2, 3, 4, 5 };
+
+    test_collect(keys, vals, expect_keys, expect_offsets, expect_child);
+}
+
+TYPED_TEST(groupby_collect_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys({ 1, 2, 1, 3, 2, 1, 3},
+                                       { 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals({ 0, 2, 1, 5, 3, 1, 4},
+                                       { 1, 1, 1, 1, 0, 0, 1});
+
+    fixed_width_column_wrapper<K> expect_keys({ 1, 2, 3 }, all_valid());
+    fixed_width_column_wrapper<size_type> expect_offsets { 0, 3, 5, 6 };
+    fixed_width_column_wrapper<V> expect_child({ 0, 1, 1, 2, 3, 4 },
+                                               { 1, 1, 0, 1, 0, 1 });
+
+    test_collect(keys, vals, expect_keys, expect_offsets, expect_child);
+}
+
+TYPED_TEST(groupby_collect_test, sort_presorted_keys)
+{
+    using K = int32_t;
+    using V = TypeParam;
+
+    fixed_width_column_wrapper<K> keys { 1, 1, 1, 2, 2, 3};
+    fixed_width_column_wrapper<V> vals { 0, 1, 2, 3, 4, 5};
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<size_type> expect_offsets { 0, 3, 5, 6 };
+    fixed_width_column_wrapper<V> expect_child { 0, 1, 2, 3, 4, 5 };
+
+    test_collect(keys, vals, expect_keys, expect_offsets, expect_child,
+                 force_use_sort_impl::YES, sorted::YES);
+}
+
+struct groupby_collect_string_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_collect_string_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 2, 1, 2, 1};
+    strings_column_wrapper vals { "a", "b", "c", "d"};
+
+    fixed_width_column_wrapper<int32_t> expect_keys { 1, 2 };
+    fixed_width_column_wrapper<size_type> expect_offsets { 0, 2, 4 };
+    strings_column_wrapper expect_child { "b", "d", "a", "c"};
+
+    test_collect(keys, vals, expect_keys, expect_offsets, expect_child);
+}
+
+} // namespace test
+} // namespace cudf
@@ -49,6 +49,23 @@ TYPED_TEST(groupby_mean_test, basic)
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_mean_test, basic_sort_impl)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::MEAN>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    fixed_width_column_wrapper<K> expect_keys { 1,  2,     3    };
+    fixed_width_column_wrapper<R> expect_vals { 3., 19./4, 17./3};
+
+    auto agg = cudf::experimental::make_mean_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+                    force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_mean_test, empty_cols)
 {
     using K = int32_t;
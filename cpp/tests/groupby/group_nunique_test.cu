@@ -197,6 +197,30 @@ TYPED_TEST(groupby_nunique_test, include_nulls)
         test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_nunique_test, null_keys_and_values_sort)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys({ 1, 2, 3, 3, 1, 2, 2, 1, 3, 3, 2, 4, 4, 2},
+                                       { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals({ 0, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 4, 4, 2},
+                                       { 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0});
+
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,          3,       4}, all_valid());
+    fixed_width_column_wrapper<R> expect_vals { 2,        3,          2,       0};
+    fixed_width_column_wrapper<R> expect_bool_vals { 1, 1, 1, 0};
+
+    // The hash-based and the sort-based groupby count the same values
+    auto agg = cudf::experimental::make_nunique_aggregation();
+    if(std::is_same<V, bool>())
+        test_single_agg(keys, vals, expect_keys, expect_bool_vals, std::move(agg),
+                        force_use_sort_impl::YES);
+    else
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+                        force_use_sort_impl::YES);
+}
 
 } // namespace test
 } // namespace cudf
@@ -134,5 +134,125 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
 }
 
 
+TYPED_TEST(groupby_sum_test, many_rows)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::SUM>;
+
+    size_type const num_rows = 100000;
+
+    // Few keys are aggregated in shared memory, many keys overflow it
+    for (size_type num_keys : {100, 50000}) {
+        auto key_it = make_counting_transform_iterator(0, [num_keys](auto i) {
+            return i % num_keys; });
+        auto val_it = make_counting_transform_iterator(0, [](auto i) { return V{1}; });
+        fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+        fixed_width_column_wrapper<V> vals(val_it, val_it + num_rows);
+
+        auto expect_key_it = make_counting_transform_iterator(0, [](auto i) { return i; });
+        auto expect_val_it = make_counting_transform_iterator(0, [num_rows, num_keys](auto i) {
+            return R(num_rows / num_keys); });
+        fixed_width_column_wrapper<K> expect_keys(expect_key_it, expect_key_it + num_keys);
+        fixed_width_column_wrapper<R> expect_vals(expect_val_it, expect_val_it + num_keys);
+
+        auto agg = cudf::experimental::make_sum_aggregation();
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+    }
+}
+
+TYPED_TEST(groupby_sum_test, many_rows_sized_from_estimate)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::SUM>;
+
+    // Enough rows for the hash map to be sized from the estimated number of groups
+    size_type const num_rows = (1 << 20) + 1000;
+
+    for (size_type num_keys : {1000, 300000}) {
+        auto key_it = make_counting_transform_iterator(0, [num_keys](auto i) {
+            return i % num_keys; });
+        auto valid_it = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+        auto val_it = make_counting_transform_iterator(0, [](auto i) { return V{1}; });
+        fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows, valid_it);
+        fixed_width_column_wrapper<V> vals(val_it, val_it + num_rows);
+
+        std::vector<R> counts(num_keys, R{0});
+        for (size_type i = 0; i < num_rows; ++i) {
+            if (i % 7 != 0) { counts[i % num_keys] += R{1}; }
+        }
+        auto expect_key_it = make_counting_transform_iterator(0, [](auto i) { return i; });
+        fixed_width_column_wrapper<K> expect_keys(expect_key_it, expect_key_it + num_keys);
+        fixed_width_column_wrapper<R> expect_vals(counts.begin(), counts.end());
+
+        auto agg = cudf::experimental::make_sum_aggregation();
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+    }
+}
+
+TYPED_TEST(groupby_sum_test, many_rows_detected_sorted)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::SUM>;
+
+    // Enough rows for the planner to check the order of the keys
+    size_type const num_rows = 1 << 17;
+    size_type const group_size = 8;
+    size_type const num_keys = num_rows / group_size;
+
+    // The keys are sorted in `column_order`, but are not declared sorted
+    for (auto column_order : {order::ASCENDING, order::DESCENDING}) {
+        auto key_it = make_counting_transform_iterator(0,
+            [column_order, num_rows, group_size](auto i) {
+                return column_order == order::ASCENDING ? i / group_size
+                                                        : (num_rows - 1 - i) / group_size; });
+        auto val_it = make_counting_transform_iterator(0, [](auto i) { return V{1}; });
+        fixed_width_column_wrapper<K> keys(key_it, key_it + num_rows);
+        fixed_width_column_wrapper<V> vals(val_it, val_it + num_rows);
+
+        auto expect_key_it = make_counting_transform_iterator(0, [](auto i) { return i; });
+        auto expect_val_it = make_counting_transform_iterator(0, [group_size](auto i) {
+            return R(group_size); });
+        fixed_width_column_wrapper<K> expect_keys(expect_key_it, expect_key_it + num_keys);
+        fixed_width_column_wrapper<R> expect_vals(expect_val_it, expect_val_it + num_keys);
+
+        auto agg = cudf::experimental::make_sum_aggregation();
+        test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+                        force_use_sort_impl::NO, include_nulls::NO, sorted::NO,
+                        {column_order});
+    }
+}
+
+struct groupby_sum_decimal_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_sum_decimal_test, sum_keeps_scale)
+{
+    using K = int32_t;
+
+    // 1.00, 2.50, -0.75, 0.05, 0.01
+    fixed_width_column_wrapper<K>       keys        { 1,   2,   1,  2, 3};
+    fixed_width_column_wrapper<int32_t> reps        { 100, 250, -75, 5, 1};
+    column_view const reps_view = reps;
+    column_view const vals{data_type{DECIMAL32, -2}, reps_view.size(), reps_view.head()};
+
+    fixed_width_column_wrapper<K>       expect_keys { 1,  2,   3};
+    fixed_width_column_wrapper<int64_t> expect_reps { 25, 255, 1};
+    column_view const expect_reps_view = expect_reps;
+    column_view const expect_vals{
+        data_type{DECIMAL64, -2}, expect_reps_view.size(), expect_reps_view.head()};
+
+    auto agg = cudf::experimental::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::experimental::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+
+    auto agg3 = cudf::experimental::make_mean_aggregation();
+    EXPECT_THROW(test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg3)),
+                 cudf::logic_error);
+}
+
 } // namespace test
 } // namespace cudf
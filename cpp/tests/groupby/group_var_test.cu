@@ -51,6 +51,25 @@ TYPED_TEST(groupby_var_test, basic)
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_var_test, basic_sort_impl)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::VARIANCE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1,  2, 2, 2, 2,  3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,        2,           3      };
+                                          //  { 0, 3, 6,  1, 4, 5, 9,  2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({   9.,      131./12,     31./3 }, all_valid());
+
+    auto agg = cudf::experimental::make_variance_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+                    force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_var_test, empty_cols)
 {
     using K = int32_t;
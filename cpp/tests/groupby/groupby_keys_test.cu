@@ -22,6 +22,11 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace test {
 
@@ -122,6 +127,23 @@ TYPED_TEST(groupby_keys_test, pre_sorted_keys)
         force_use_sort_impl::YES, include_nulls::NO, sorted::YES);
 }
 
+TYPED_TEST(groupby_keys_test, pre_sorted_keys_median)
+{
+    using K = TypeParam;
+    using V = int32_t;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::MEDIAN>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4};
+    fixed_width_column_wrapper<V> vals        { 2, 0, 1, 6, 3, 5, 4, 9, 7, 8, 4};
+
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3,       4};
+    fixed_width_column_wrapper<R> expect_vals { 1.,      4.5,        8.,      4.};
+
+    auto agg = cudf::experimental::make_median_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::YES, include_nulls::NO, sorted::YES);
+}
+
 TYPED_TEST(groupby_keys_test, pre_sorted_keys_descending)
 {
     using K = TypeParam;
@@ -194,5 +216,48 @@ TEST_F(groupby_string_keys_test, basic)
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TEST_F(groupby_string_keys_test, many_keys_with_nulls)
+{
+    using V = int32_t;
+    using R = experimental::detail::target_type_t<V, experimental::aggregation::SUM>;
+
+    // Keys sharing long prefixes, so that unequal keys differ only in their last characters
+    size_type const num_rows = 10000;
+    size_type const num_keys = 1000;
+    std::vector<std::string> key_strings(num_rows);
+    std::vector<bool> key_valids(num_rows);
+    std::vector<V> values(num_rows);
+    std::vector<std::string> expect_key_strings(num_keys);
+    std::vector<R> expect_sums(num_keys, R{0});
+    for (size_type i = 0; i < num_rows; ++i) {
+        key_strings[i] = "https://example.com/path/" + std::to_string(i % num_keys);
+        key_valids[i]  = i % 11 != 0;
+        values[i]      = i;
+        if (key_valids[i]) {
+            expect_key_strings[i % num_keys] = key_strings[i];
+            expect_sums[i % num_keys] += R(i);
+        }
+    }
+    std::vector<size_type> expect_order(num_keys);
+    std::iota(expect_order.begin(), expect_order.end(), 0);
+    std::sort(expect_order.begin(), expect_order.end(), [&](auto lhs, auto rhs) {
+        return expect_key_strings[lhs] < expect_key_strings[rhs]; });
+    std::vector<std::string> sorted_key_strings;
+    std::vector<R> sorted_sums;
+    for (auto i : expect_order) {
+        sorted_key_strings.push_back(expect_key_strings[i]);
+        sorted_sums.push_back(expect_sums[i]);
+    }
+
+    strings_column_wrapper        keys(key_strings.begin(), key_strings.end(), key_valids.begin());
+    fixed_width_column_wrapper<V> vals(values.begin(), values.end());
+
+    strings_column_wrapper        expect_keys(sorted_key_strings.begin(), sorted_key_strings.end());
+    fixed_width_column_wrapper<R> expect_vals(sorted_sums.begin(), sorted_sums.end());
+
+    auto agg = cudf::experimental::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
 } // namespace test
 } // namespace cudf
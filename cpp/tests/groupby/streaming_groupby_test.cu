@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace test {
+
+struct streaming_groupby_test : public BaseFixture {};
+
+namespace {
+
+std::vector<std::vector<std::unique_ptr<experimental::aggregation>>> make_aggregations() {
+  std::vector<std::vector<std::unique_ptr<experimental::aggregation>>> aggregations(1);
+  aggregations[0].push_back(experimental::make_sum_aggregation());
+  aggregations[0].push_back(experimental::make_count_aggregation());
+  aggregations[0].push_back(experimental::make_min_aggregation());
+  aggregations[0].push_back(experimental::make_max_aggregation());
+  aggregations[0].push_back(experimental::make_mean_aggregation());
+  aggregations[0].push_back(experimental::make_variance_aggregation());
+  return aggregations;
+}
+
+// Returns the keys followed by the results, sorted by the keys
+std::unique_ptr<experimental::table> sorted_results(
+  experimental::groupby::streaming_groupby const& gb) {
+  auto result = gb.finalize();
+  std::vector<column_view> columns{result.first->get_column(0)};
+  for (auto const& agg_result : result.second[0].results) { columns.push_back(*agg_result); }
+  return experimental::sort_by_key(table_view(columns), result.first->view());
+}
+
+}  // namespace
+
+TEST_F(streaming_groupby_test, chunks)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys0{1, 2, 3, 1, 2};
+  fixed_width_column_wrapper<V> vals0{0, 1, 2, 3, 4};
+  fixed_width_column_wrapper<K> keys1{2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals1({5, 6, 7, 8, 9, 10}, {1, 1, 1, 1, 1, 0});
+
+  experimental::groupby::streaming_groupby gb(make_aggregations());
+  gb.aggregate(table_view({keys0}), table_view({vals0}));
+  gb.aggregate(table_view({keys1}), table_view({vals1}));
+
+  //                                      { 0, 3, 6,  1, 4, 5, 9,  2, 7, 8,  -}
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3, 4};
+  fixed_width_column_wrapper<int64_t> expect_sums({9, 19, 17, 0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<int64_t> expect_counts{3, 4, 3, 0};
+  fixed_width_column_wrapper<V> expect_mins({0, 1, 2, 0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<V> expect_maxs({6, 9, 8, 0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<double> expect_means({3., 19. / 4, 17. / 3, 0.}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<double> expect_vars({9., 131. / 12, 31. / 3, 0.}, {1, 1, 1, 0});
+
+  auto const result = sorted_results(gb);
+  expect_columns_equal(result->get_column(0), expect_keys);
+  expect_columns_equal(result->get_column(1), expect_sums);
+  expect_columns_equal(result->get_column(2), expect_counts);
+  expect_columns_equal(result->get_column(3), expect_mins);
+  expect_columns_equal(result->get_column(4), expect_maxs);
+  expect_columns_equivalent(result->get_column(5), expect_means);
+  expect_columns_equivalent(result->get_column(6), expect_vars);
+}
+
+TEST_F(streaming_groupby_test, merge)
+{
+  using K = int32_t;
+  using V = int32_t;
+
+  fixed_width_column_wrapper<K> keys0{1, 2, 3, 1, 2};
+  fixed_width_column_wrapper<V> vals0{0, 1, 2, 3, 4};
+  fixed_width_column_wrapper<K> keys1{2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals1{5, 6, 7, 8, 9};
+
+  experimental::groupby::streaming_groupby gb0(make_aggregations());
+  experimental::groupby::streaming_groupby gb1(make_aggregations());
+  gb0.aggregate(table_view({keys0}), table_view({vals0}));
+  gb1.aggregate(table_view({keys1}), table_view({vals1}));
+  gb0.merge(gb1);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_sums{9, 19, 17};
+  fixed_width_column_wrapper<int64_t> expect_counts{3, 4, 3};
+  fixed_width_column_wrapper<double> expect_vars({9., 131. / 12, 31. / 3}, all_valid());
+
+  auto const result = sorted_results(gb0);
+  expect_columns_equal(result->get_column(0), expect_keys);
+  expect_columns_equal(result->get_column(1), expect_sums);
+  expect_columns_equal(result->get_column(2), expect_counts);
+  expect_columns_equivalent(result->get_column(6), expect_vars);
+}
+
+TEST_F(streaming_groupby_test, unsupported_aggregation)
+{
+  std::vector<std::vector<std::unique_ptr<experimental::aggregation>>> aggregations(1);
+  aggregations[0].push_back(experimental::make_median_aggregation());
+  EXPECT_THROW(experimental::groupby::streaming_groupby(std::move(aggregations)),
+               cudf::logic_error);
+}
+
+TEST_F(streaming_groupby_test, finalize_without_chunks)
+{
+  experimental::groupby::streaming_groupby gb(make_aggregations());
+  EXPECT_THROW(gb.finalize(), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
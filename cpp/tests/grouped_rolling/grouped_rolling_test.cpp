@@ -419,6 +419,101 @@ TEST_F(GroupedRollingTestStrings, StringsUnsupportedOperators)
                cudf::logic_error);
 }
 
+// ------------- window functions and running aggregates --------------------
+
+class GroupedRollingWindowFunctionTest : public cudf::test::BaseFixture {};
+
+TEST_F(GroupedRollingWindowFunctionTest, RowNumber)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 1, 1};
+  fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+
+  auto output = cudf::experimental::grouped_rolling_window(
+    cudf::table_view{{keys}}, input, 1, 0, 1, cudf::experimental::make_row_number_aggregation());
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<size_type>{1, 2, 3, 1, 2},
+                                   output->view());
+}
+
+TEST_F(GroupedRollingWindowFunctionTest, LeadLag)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 1, 1};
+  fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  cudf::table_view grouping_keys{{keys}};
+
+  auto lead = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, 1, 0, 1, cudf::experimental::make_lead_aggregation(1));
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{{0, 3, 0, 5, 0}, {0, 1, 0, 1, 0}}, lead->view());
+
+  auto lag = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, 1, 0, 1, cudf::experimental::make_lag_aggregation(1));
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{{0, 1, 0, 0, 4}, {0, 1, 0, 0, 1}}, lag->view());
+
+  fixed_width_column_wrapper<int32_t> defaults{10, 20, 30, 40, 50};
+  auto lag_defaults = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, defaults, 1, 0, 1, cudf::experimental::make_lag_aggregation(1));
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{{10, 1, 0, 40, 4}, {1, 1, 0, 1, 1}}, lag_defaults->view());
+
+  fixed_width_column_wrapper<int32_t> short_defaults{10, 20};
+  EXPECT_THROW(cudf::experimental::grouped_rolling_window(
+                 grouping_keys, input, short_defaults, 1, 0, 1,
+                 cudf::experimental::make_lag_aggregation(1)),
+               cudf::logic_error);
+}
+
+TEST_F(GroupedRollingWindowFunctionTest, LeadStringsWithDefaults)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 1};
+  cudf::test::strings_column_wrapper input{"a", "b", "c", "d", "e"};
+  cudf::test::strings_column_wrapper defaults{"v", "w", "x", "y", "z"};
+
+  auto output = cudf::experimental::grouped_rolling_window(
+    cudf::table_view{{keys}}, input, defaults, 1, 0, 1,
+    cudf::experimental::make_lead_aggregation(2));
+  cudf::test::expect_columns_equivalent(
+    cudf::test::strings_column_wrapper{"c", "d", "x", "y", "z"}, output->view());
+}
+
+TEST_F(GroupedRollingWindowFunctionTest, RunningAggregates)
+{
+  using cudf::experimental::UNBOUNDED_WINDOW;
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 1, 1};
+  fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  cudf::table_view grouping_keys{{keys}};
+
+  auto sum = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, UNBOUNDED_WINDOW, 0, 1, cudf::experimental::make_sum_aggregation());
+  cudf::test::expect_columns_equivalent(fixed_width_column_wrapper<int64_t>{1, 1, 4, 4, 9},
+                                        sum->view());
+
+  auto sum_periods = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, UNBOUNDED_WINDOW, 0, 2, cudf::experimental::make_sum_aggregation());
+  cudf::test::expect_columns_equivalent(
+    fixed_width_column_wrapper<int64_t>{{0, 0, 4, 0, 9}, {0, 0, 1, 0, 1}}, sum_periods->view());
+
+  auto max = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, UNBOUNDED_WINDOW, 0, 1, cudf::experimental::make_max_aggregation());
+  cudf::test::expect_columns_equivalent(fixed_width_column_wrapper<int32_t>{1, 1, 3, 4, 5},
+                                        max->view());
+
+  auto count_valid = cudf::experimental::grouped_rolling_window(
+    grouping_keys, input, UNBOUNDED_WINDOW, 0, 1, cudf::experimental::make_count_aggregation());
+  cudf::test::expect_columns_equivalent(fixed_width_column_wrapper<size_type>{1, 1, 2, 1, 2},
+                                        count_valid->view());
+
+  auto count_all = cudf::experimental::grouped_rolling_window(
+    grouping_keys,
+    input,
+    UNBOUNDED_WINDOW,
+    0,
+    1,
+    cudf::experimental::make_count_aggregation(cudf::include_nulls::YES));
+  cudf::test::expect_columns_equivalent(fixed_width_column_wrapper<size_type>{1, 2, 3, 1, 2},
+                                        count_all->view());
+}
+
 template <typename T>
 class GroupedTimeRangeRollingTest : public cudf::test::BaseFixture {
 protected:
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/cudf.h>
+#include <hash/cooperative_unordered_map.cuh>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <gtest/gtest.h>
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/tabulate.h>
+
+template <typename K, typename V, uint32_t TileSize>
+struct map_types {
+  using key_type  = K;
+  using pair_type = thrust::pair<K, V>;
+  using map_type  = cooperative_unordered_map<K,
+                                             V,
+                                             default_hash<K>,
+                                             equal_to<K>,
+                                             default_allocator<pair_type>,
+                                             TileSize>;
+};
+
+template <typename T>
+struct CooperativeMapTest : public cudf::test::BaseFixture {
+  using key_type  = typename T::key_type;
+  using pair_type = typename T::pair_type;
+  using map_type  = typename T::map_type;
+
+  // Far above the occupancy the other maps are used at
+  const cudf::size_type size{10000};
+  const size_t capacity{compute_hash_table_size(size, 90)};
+};
+
+using TestTypes = ::testing::Types<map_types<int32_t, int32_t, 4>,
+                                   map_types<int64_t, int64_t, 4>,
+                                   map_types<int32_t, int32_t, 8>,
+                                   map_types<int64_t, double, 32>>;
+
+TYPED_TEST_CASE(CooperativeMapTest, TestTypes);
+
+template <typename pair_type>
+struct pair_generator {
+  cudf::size_type num_unique_keys;
+  __device__ pair_type operator()(cudf::size_type i) {
+    using key_type   = typename pair_type::first_type;
+    using value_type = typename pair_type::second_type;
+    return thrust::make_pair(key_type(i % num_unique_keys), value_type(i));
+  }
+};
+
+template <typename pair_type>
+struct is_used_slot {
+  typename pair_type::first_type unused_key;
+  __device__ bool operator()(pair_type const& slot) { return slot.first != unused_key; }
+};
+
+TYPED_TEST(CooperativeMapTest, UniqueKeys) {
+  using map_type  = typename TestFixture::map_type;
+  using pair_type = typename TestFixture::pair_type;
+  using key_type  = typename TestFixture::key_type;
+
+  rmm::device_vector<pair_type> pairs(this->size);
+  thrust::tabulate(pairs.begin(), pairs.end(), pair_generator<pair_type>{this->size});
+
+  auto map = map_type::create(this->capacity);
+  map->insert(pairs.begin(), pairs.end());
+
+  // Every inserted key is found, and none of the following keys are
+  rmm::device_vector<bool> contained(2 * this->size);
+  map->contains(thrust::make_counting_iterator<key_type>(0),
+                thrust::make_counting_iterator<key_type>(2 * this->size),
+                contained.data().get(),
+                default_hash<key_type>{},
+                equal_to<key_type>{});
+  EXPECT_TRUE(thrust::all_of(
+    contained.begin(), contained.begin() + this->size, thrust::identity<bool>{}));
+  EXPECT_TRUE(
+    thrust::none_of(contained.begin() + this->size, contained.end(), thrust::identity<bool>{}));
+}
+
+TYPED_TEST(CooperativeMapTest, DuplicateKeys) {
+  using map_type  = typename TestFixture::map_type;
+  using pair_type = typename TestFixture::pair_type;
+
+  cudf::size_type const num_unique_keys = 100;
+  rmm::device_vector<pair_type> pairs(this->size);
+  thrust::tabulate(pairs.begin(), pairs.end(), pair_generator<pair_type>{num_unique_keys});
+
+  auto map = map_type::create(this->capacity);
+  map->insert(pairs.begin(), pairs.end());
+
+  // Each key occupies a single slot
+  auto const num_used = thrust::count_if(thrust::device,
+                                         map->data(),
+                                         map->data() + map->capacity(),
+                                         is_used_slot<pair_type>{map->get_unused_key()});
+  EXPECT_EQ(num_used, num_unique_keys);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -19,6 +19,9 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <string>
+#include <vector>
+
 using cudf::test::fixed_width_column_wrapper;
 using cudf::test::strings_column_wrapper;
 using cudf::test::expect_columns_equal;
@@ -185,4 +188,156 @@ TYPED_TEST(HashTestFloatTyped, TestExtremes)
   expect_columns_equal(output1->view(), output2->view(), true);
 }
 
+TEST_F(HashTest, LongStrings)
+{
+  // Repeats of an alphabet of 36 letters, cut to the lengths of the strings
+  std::string alphabet;
+  for (int i = 0; i < 40; ++i) { alphabet += "abcdefghijklmnopqrstuvwxyz0123456789"; }
+  std::vector<std::string> strings;
+  for (auto length : {600, 1, 301, 0, 513}) { strings.push_back(alphabet.substr(0, length)); }
+
+  // Most strings do not start on a 4-byte boundary
+  std::vector<bool> const validity({1, 1, 1, 0, 1});
+  strings_column_wrapper const strings_col(strings.begin(), strings.end(), validity.begin());
+
+  // Long strings of a single column are hashed with a warp per row
+  auto const output1 = cudf::hash(cudf::table_view({strings_col}));
+  fixed_width_column_wrapper<int32_t> const expected1(
+    {271875169, -631446677, 2117406864, -1640531528, -898836740});
+  expect_columns_equal(expected1, output1->view());
+  auto const seeded = cudf::hash(cudf::table_view({strings_col}), cudf::hash_id::HASH_MURMUR3);
+  expect_columns_equal(expected1, seeded->view());
+
+  // and with a thread per row otherwise
+  auto const output2 = cudf::hash(cudf::table_view({strings_col, strings_col}));
+  fixed_width_column_wrapper<int32_t> const expected2(
+    {827641816, 1919947886, 1429432356, -845889634, 1381047623});
+  expect_columns_equal(expected2, output2->view());
+}
+
+class SeededHashTest : public cudf::test::BaseFixture {};
+
+// Expected values are those of Spark's `hash` and `xxhash64` expressions
+constexpr uint64_t spark_seed = 42;
+
+TEST_F(SeededHashTest, Murmur3MatchesUnseeded)
+{
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, 7, 8}, {1, 1, 0, 1, 1});
+  strings_column_wrapper const strings_col({"a", "bb", "ccc", "", "eeeee"});
+  auto const input = cudf::table_view({ints_col, strings_col});
+
+  auto const output = cudf::hash(input, cudf::hash_id::HASH_MURMUR3);
+  expect_columns_equal(cudf::hash(input)->view(), output->view());
+
+  auto const seeded = cudf::hash(input, cudf::hash_id::HASH_MURMUR3, spark_seed);
+  EXPECT_EQ(cudf::INT32, seeded->type().id());
+  EXPECT_EQ(input.num_rows(), seeded->size());
+}
+
+TEST_F(SeededHashTest, SparkMurmur3)
+{
+  strings_column_wrapper const strings_col(
+    {"",
+    "The quick brown fox",
+    "jumps over the lazy dog.",
+    "All work and no play makes Jack a dull boy",
+    "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"});
+  strings_column_wrapper const nullable_strings_col(
+    {"",
+    "The quick brown fox",
+    "jumps over the lazy dog.",
+    "All work and no play makes Jack a dull boy",
+    "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"},
+    {1, 1, 1, 0, 1});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col(
+    {0, 100, -100, limits::min(), limits::max()});
+
+  auto const hash_ints = cudf::hash(
+    cudf::table_view({ints_col}), cudf::hash_id::HASH_SPARK_MURMUR3, spark_seed);
+  fixed_width_column_wrapper<int32_t> const expected_ints(
+    {933211791, 751823303, -1080202046, 723455942, 133916647});
+  expect_columns_equal(expected_ints, hash_ints->view());
+
+  auto const hash_strings = cudf::hash(
+    cudf::table_view({strings_col}), cudf::hash_id::HASH_SPARK_MURMUR3, spark_seed);
+  fixed_width_column_wrapper<int32_t> const expected_strings(
+    {142593372, 1217302703, -715697185, -2061143941, 260367885});
+  expect_columns_equal(expected_strings, hash_strings->view());
+
+  // Each column is hashed with the hash of the previous ones; nulls are skipped
+  auto const hash_rows = cudf::hash(cudf::table_view({nullable_strings_col, ints_col}),
+                                    cudf::hash_id::HASH_SPARK_MURMUR3,
+                                    spark_seed);
+  fixed_width_column_wrapper<int32_t> const expected_rows(
+    {1143746540, -1193257546, -1306037126, 723455942, -1635627592});
+  expect_columns_equal(expected_rows, hash_rows->view());
+}
+
+TEST_F(SeededHashTest, SparkMurmur3Types)
+{
+  // 8 and 16-bit integers hash as 32-bit integers
+  fixed_width_column_wrapper<int16_t> const shorts_col({-1, 7});
+  fixed_width_column_wrapper<int8_t> const bytes_col({-1, 7});
+  fixed_width_column_wrapper<int64_t> const longs_col({-1, 7});
+  fixed_width_column_wrapper<double> const doubles_col(
+    {1.5, std::numeric_limits<double>::quiet_NaN(), -0.0, 0.0});
+
+  auto const spark_hash = [](cudf::column_view const& col) {
+    return cudf::hash(cudf::table_view({col}), cudf::hash_id::HASH_SPARK_MURMUR3, spark_seed);
+  };
+  fixed_width_column_wrapper<int32_t> const expected_ints({-1604776387, 1079293707});
+  expect_columns_equal(expected_ints, spark_hash(shorts_col)->view());
+  expect_columns_equal(expected_ints, spark_hash(bytes_col)->view());
+  fixed_width_column_wrapper<int32_t> const expected_longs({-939490007, 1293116811});
+  expect_columns_equal(expected_longs, spark_hash(longs_col)->view());
+  fixed_width_column_wrapper<int32_t> const expected_doubles(
+    {1290763749, -1281358385, -853646085, -1670924195});
+  expect_columns_equal(expected_doubles, spark_hash(doubles_col)->view());
+}
+
+TEST_F(SeededHashTest, XXHash64)
+{
+  strings_column_wrapper const strings_col(
+    {"",
+    "The quick brown fox",
+    "jumps over the lazy dog.",
+    "All work and no play makes Jack a dull boy",
+    "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"},
+    {1, 1, 1, 0, 1});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col(
+    {0, 100, -100, limits::min(), limits::max()});
+
+  auto const hash_ints =
+    cudf::hash(cudf::table_view({ints_col}), cudf::hash_id::HASH_XXHASH64, spark_seed);
+  fixed_width_column_wrapper<int64_t> const expected_ints({3614696996920510707,
+                                                           -7987742665087449293,
+                                                           8990748234399402673,
+                                                           2073849959933241805,
+                                                           1508894993788531228});
+  expect_columns_equal(expected_ints, hash_ints->view());
+
+  auto const hash_rows = cudf::hash(
+    cudf::table_view({strings_col, ints_col}), cudf::hash_id::HASH_XXHASH64, spark_seed);
+  fixed_width_column_wrapper<int64_t> const expected_rows({5333022629466737987,
+                                                           6923444916845418808,
+                                                           7316197137724241447,
+                                                           2073849959933241805,
+                                                           2349198184878574161});
+  expect_columns_equal(expected_rows, hash_rows->view());
+}
+
+TEST_F(SeededHashTest, SeedOutOfRange)
+{
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 1});
+  auto const input    = cudf::table_view({ints_col});
+  uint64_t const seed = uint64_t{1} << 32;
+
+  EXPECT_THROW(cudf::hash(input, cudf::hash_id::HASH_SPARK_MURMUR3, seed), cudf::logic_error);
+  EXPECT_EQ(cudf::INT64, cudf::hash(input, cudf::hash_id::HASH_XXHASH64, seed)->type().id());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <arrow/api.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/api.h>
+
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::experimental::io;
+
+using namespace cudf::test;
+
+struct ArrowIpcTest : public BaseFixture {};
+
+TEST_F(ArrowIpcTest, RoundTrip) {
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                           {1, 0, 1, 1, 0, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<double> col1({1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5, 8.5, 9.5, 10.5});
+  fixed_width_column_wrapper<bool> col2(
+    {true, false, true, true, false, false, true, false, true, true},
+    {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  strings_column_wrapper col3({"a", "", "bcd", "ef", "ghij", "k", "", "lmn", "o", "pq"},
+                              {1, 1, 0, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<cudf::timestamp_D> col4({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  fixed_width_column_wrapper<cudf::timestamp_us> col5({-1, 2, -3, 4, -5, 6, -7, 8, -9, 10});
+  cudf::table_view expected{{col0, col1, col2, col3, col4, col5}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b", "c", "d", "e", "f"};
+  metadata.user_data    = {{"key", "value"}};
+
+  for (bool file_format : {false, true}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_arrow_ipc_args out_args{cudf_io::sink_info(&out_buffer), expected, &metadata};
+    out_args.batch_size_rows = 3;
+    out_args.file_format     = file_format;
+    cudf_io::write_arrow_ipc(out_args);
+
+    cudf_io::read_arrow_ipc_args in_args{
+      cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    auto const result = cudf_io::read_arrow_ipc(in_args);
+    expect_tables_equal(expected, result.tbl->view());
+    EXPECT_EQ(metadata.column_names, result.metadata.column_names);
+    EXPECT_EQ(metadata.user_data, result.metadata.user_data);
+
+    // Sliced columns are written from their first row
+    auto const sliced = cudf::experimental::slice(expected, {3, 9}).front();
+    out_buffer.clear();
+    out_args.table = sliced;
+    cudf_io::write_arrow_ipc(out_args);
+    in_args.source           = cudf_io::source_info(out_buffer.data(), out_buffer.size());
+    auto const sliced_result = cudf_io::read_arrow_ipc(in_args);
+    expect_tables_equal(sliced, sliced_result.tbl->view());
+
+    // Only the selected columns are read, in the order of the selection
+    in_args.columns             = {"d", "a"};
+    auto const selected_result  = cudf_io::read_arrow_ipc(in_args);
+    auto const selected_columns = sliced.select({3, 0});
+    expect_tables_equal(selected_columns, selected_result.tbl->view());
+  }
+}
+
+TEST_F(ArrowIpcTest, EmptyTable) {
+  fixed_width_column_wrapper<int64_t> col0{};
+  strings_column_wrapper col1{};
+  cudf::table_view expected{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_arrow_ipc_args out_args{cudf_io::sink_info(&out_buffer), expected};
+  cudf_io::write_arrow_ipc(out_args);
+
+  cudf_io::read_arrow_ipc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto const result = cudf_io::read_arrow_ipc(in_args);
+  expect_tables_equal(expected, result.tbl->view());
+  EXPECT_EQ(std::vector<std::string>({"_col0", "_col1"}), result.metadata.column_names);
+}
+
+TEST_F(ArrowIpcTest, ReadArrowStream) {
+  // A stream written by the Arrow library, with sliced arrays
+  arrow::Int64Builder int_builder;
+  arrow::StringBuilder string_builder;
+  for (int i = 0; i < 20; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_TRUE(int_builder.AppendNull().ok());
+      ASSERT_TRUE(string_builder.AppendNull().ok());
+    } else {
+      ASSERT_TRUE(int_builder.Append(i).ok());
+      ASSERT_TRUE(string_builder.Append(std::to_string(i)).ok());
+    }
+  }
+  std::shared_ptr<arrow::Array> ints;
+  std::shared_ptr<arrow::Array> strings;
+  ASSERT_TRUE(int_builder.Finish(&ints).ok());
+  ASSERT_TRUE(string_builder.Finish(&strings).ok());
+  auto const schema =
+    arrow::schema({arrow::field("ints", arrow::int64()), arrow::field("strings", arrow::utf8())});
+  auto const batch = arrow::RecordBatch::Make(schema, 20, {ints, strings});
+
+  std::shared_ptr<arrow::io::BufferOutputStream> sink;
+  ASSERT_TRUE(
+    arrow::io::BufferOutputStream::Create(1024, arrow::default_memory_pool(), &sink).ok());
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+  ASSERT_TRUE(arrow::ipc::RecordBatchStreamWriter::Open(sink.get(), schema, &writer).ok());
+  ASSERT_TRUE(writer->WriteRecordBatch(*batch->Slice(0, 5)).ok());
+  ASSERT_TRUE(writer->WriteRecordBatch(*batch->Slice(5)).ok());
+  ASSERT_TRUE(writer->Close().ok());
+  std::shared_ptr<arrow::Buffer> buffer;
+  ASSERT_TRUE(sink->Finish(&buffer).ok());
+
+  std::vector<int64_t> expected_ints;
+  std::vector<std::string> expected_strings;
+  std::vector<bool> validity;
+  for (int i = 0; i < 20; ++i) {
+    expected_ints.push_back(i);
+    expected_strings.push_back(std::to_string(i));
+    validity.push_back(i % 3 != 0);
+  }
+  fixed_width_column_wrapper<int64_t> col0(
+    expected_ints.begin(), expected_ints.end(), validity.begin());
+  strings_column_wrapper col1(expected_strings.begin(), expected_strings.end(), validity.begin());
+
+  cudf_io::read_arrow_ipc_args in_args{cudf_io::source_info(
+    reinterpret_cast<const char*>(buffer->data()), static_cast<size_t>(buffer->size()))};
+  auto const result = cudf_io::read_arrow_ipc(in_args);
+  expect_tables_equal(cudf::table_view{{col0, col1}}, result.tbl->view());
+}
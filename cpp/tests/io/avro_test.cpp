@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::experimental::io;
+
+namespace {
+
+const std::string sync_marker(16, '\x5a');
+
+void put_long(std::string &out, int64_t value) {
+  auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  for (; zigzag > 0x7f; zigzag >>= 7) { out.push_back(static_cast<char>((zigzag & 0x7f) | 0x80)); }
+  out.push_back(static_cast<char>(zigzag));
+}
+
+void put_string(std::string &out, std::string const &str) {
+  put_long(out, str.size());
+  out.append(str);
+}
+
+void put_le32(std::string &out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) { out.push_back(static_cast<char>(value >> (i * 8))); }
+}
+
+/**
+ * @brief Returns the uncompressed data of a block of rows with a single long column
+ */
+std::string encode_rows(std::vector<int64_t> const &values) {
+  std::string data;
+  for (auto value : values) { put_long(data, value); }
+  return data;
+}
+
+/**
+ * @brief Returns an Avro file with a single long column "a" and the given
+ * blocks, as (row count, compressed data) pairs
+ */
+std::string make_avro_file(std::string const &codec,
+                           std::vector<std::pair<size_t, std::string>> const &blocks) {
+  std::string file = "Obj\x01";
+  put_long(file, 2);
+  put_string(file, "avro.schema");
+  put_string(file,
+             R"({"type":"record","name":"test","fields":[{"name":"a","type":"long"}]})");
+  put_string(file, "avro.codec");
+  put_string(file, codec);
+  put_long(file, 0);
+  file.append(sync_marker);
+  for (auto const &block : blocks) {
+    put_long(file, block.first);
+    put_long(file, block.second.size());
+    file.append(block.second);
+    file.append(sync_marker);
+  }
+  return file;
+}
+
+std::string deflate_raw(std::string const &data) {
+  z_stream strm{};
+  EXPECT_EQ(deflateInit2(&strm, Z_BEST_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::string out(deflateBound(&strm, data.size()), '\0');
+  strm.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+  strm.avail_in  = data.size();
+  strm.next_out  = reinterpret_cast<Bytef *>(&out[0]);
+  strm.avail_out = out.size();
+  EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  out.resize(strm.total_out);
+  deflateEnd(&strm);
+  return out;
+}
+
+/**
+ * @brief Returns an Avro snappy block: a snappy stream made of literals,
+ * followed by the big-endian CRC32 of the data
+ */
+std::string snappy_block(std::string const &data, bool corrupt_crc = false) {
+  std::string out;
+  size_t len = data.size();
+  for (; len > 0x7f; len >>= 7) { out.push_back(static_cast<char>((len & 0x7f) | 0x80)); }
+  out.push_back(static_cast<char>(len));
+  for (size_t pos = 0; pos < data.size(); pos += 0x10000) {
+    const size_t lit_len = std::min<size_t>(data.size() - pos, 0x10000);
+    out.push_back(static_cast<char>(61 << 2));  // Literal with a 2-byte length
+    out.push_back(static_cast<char>((lit_len - 1) & 0xff));
+    out.push_back(static_cast<char>((lit_len - 1) >> 8));
+    out.append(data, pos, lit_len);
+  }
+  auto crc = crc32(0, reinterpret_cast<const Bytef *>(data.data()), data.size());
+  if (corrupt_crc) { crc ^= 1; }
+  for (int i = 3; i >= 0; --i) { out.push_back(static_cast<char>(crc >> (i * 8))); }
+  return out;
+}
+
+uint64_t xxh64(std::string const &data) {
+  constexpr uint64_t p1 = 0x9E3779B185EBCA87ull, p2 = 0xC2B2AE3D27D4EB4Full,
+                     p3 = 0x165667B19E3779F9ull, p4 = 0x85EBCA77C2B2AE63ull,
+                     p5 = 0x27D4EB2F165667C5ull;
+  auto rotl  = [](uint64_t v, int r) { return (v << r) | (v >> (64 - r)); };
+  auto read  = [](const uint8_t *p, int n) {
+    uint64_t v = 0;
+    for (int i = 0; i < n; ++i) { v |= static_cast<uint64_t>(p[i]) << (i * 8); }
+    return v;
+  };
+  auto round = [&](uint64_t acc, uint64_t input) { return rotl(acc + input * p2, 31) * p1; };
+
+  auto p         = reinterpret_cast<const uint8_t *>(data.data());
+  const auto end = p + data.size();
+  uint64_t h     = p5;
+  if (data.size() >= 32) {
+    uint64_t v[4] = {p1 + p2, p2, 0, 0 - p1};
+    for (; end - p >= 32; p += 32) {
+      for (int i = 0; i < 4; ++i) { v[i] = round(v[i], read(p + i * 8, 8)); }
+    }
+    h = rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18);
+    for (int i = 0; i < 4; ++i) { h = (h ^ round(0, v[i])) * p1 + p4; }
+  }
+  h += data.size();
+  for (; end - p >= 8; p += 8) { h = rotl(h ^ round(0, read(p, 8)), 27) * p1 + p4; }
+  if (end - p >= 4) {
+    h = rotl(h ^ (read(p, 4) * p1), 23) * p2 + p3;
+    p += 4;
+  }
+  for (; p < end; ++p) { h = rotl(h ^ (*p * p5), 11) * p1; }
+  h = (h ^ (h >> 33)) * p2;
+  h = (h ^ (h >> 29)) * p3;
+  return h ^ (h >> 32);
+}
+
+enum class checksum { none, valid, corrupt };
+
+/**
+ * @brief Returns a zstd frame holding the data in raw blocks, or in RLE blocks
+ * if all the bytes are the same
+ */
+std::string zstd_frame(std::string const &data, bool with_size, checksum crc) {
+  const bool rle = std::all_of(data.begin(), data.end(), [&](char c) { return c == data[0]; });
+  std::string out;
+  put_le32(out, 0xfd2fb528u);
+  const uint8_t has_checksum = (crc != checksum::none) ? 0x04 : 0;
+  if (with_size) {
+    out.push_back(static_cast<char>(0x80 | 0x20 | has_checksum));  // 4-byte size, single segment
+    put_le32(out, data.size());
+  } else {
+    out.push_back(static_cast<char>(has_checksum));
+    out.push_back(static_cast<char>(0x58));  // Window descriptor
+  }
+  for (size_t pos = 0; pos < data.size(); pos += 0x20000) {
+    const uint32_t block_size = std::min<size_t>(data.size() - pos, 0x20000);
+    const bool last           = pos + block_size == data.size();
+    const uint32_t header     = (last ? 1 : 0) | ((rle ? 1 : 0) << 1) | (block_size << 3);
+    for (int i = 0; i < 3; ++i) { out.push_back(static_cast<char>(header >> (i * 8))); }
+    out.append(data, pos, rle ? 1 : block_size);
+  }
+  if (crc != checksum::none) {
+    auto hash = static_cast<uint32_t>(xxh64(data));
+    if (crc == checksum::corrupt) { hash ^= 1; }
+    put_le32(out, hash);
+  }
+  return out;
+}
+
+cudf_io::table_with_metadata read_avro_buffer(std::string const &file) {
+  cudf_io::read_avro_args args{cudf_io::source_info{file.data(), file.size()}};
+  return cudf_io::read_avro(args);
+}
+
+void expect_values(cudf_io::table_with_metadata const &result,
+                   std::vector<int64_t> const &expected) {
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_col(expected.begin(), expected.end());
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), expected_col);
+}
+
+std::vector<int64_t> repeating_values(size_t count) {
+  std::vector<int64_t> values(count);
+  for (size_t i = 0; i < count; ++i) { values[i] = i % 50; }
+  return values;
+}
+
+std::vector<int64_t> random_values(size_t count) {
+  std::mt19937_64 engine{1};
+  std::vector<int64_t> values(count);
+  for (auto &value : values) { value = static_cast<int64_t>(engine()); }
+  return values;
+}
+
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {};
+
+TEST_F(AvroReaderTest, DeflateOutputOverflow) {
+  // The first block compresses well enough to overflow the initial output
+  // estimate, which is based on the largest compressed block
+  const auto compressible = repeating_values(200000);
+  const auto random       = random_values(1000);
+  const auto file         = make_avro_file(
+    "deflate",
+    {{compressible.size(), deflate_raw(encode_rows(compressible))},
+     {random.size(), deflate_raw(encode_rows(random))}});
+
+  std::vector<int64_t> expected(compressible);
+  expected.insert(expected.end(), random.begin(), random.end());
+  expect_values(read_avro_buffer(file), expected);
+}
+
+TEST_F(AvroReaderTest, SnappyCRC) {
+  const auto values = repeating_values(100000);
+  const auto data   = encode_rows(values);
+  const auto random = random_values(1000);
+
+  const auto file = make_avro_file(
+    "snappy",
+    {{values.size(), snappy_block(data)}, {random.size(), snappy_block(encode_rows(random))}});
+  std::vector<int64_t> expected(values);
+  expected.insert(expected.end(), random.begin(), random.end());
+  expect_values(read_avro_buffer(file), expected);
+
+  // The second block decompresses fine, but its CRC doesn't match
+  const auto corrupt_block = snappy_block(encode_rows(random), true);
+  const auto corrupt_file  = make_avro_file(
+    "snappy", {{values.size(), snappy_block(data)}, {random.size(), corrupt_block}});
+  EXPECT_THROW(read_avro_buffer(corrupt_file), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, ZstdChecksum) {
+  const auto values = random_values(50000);
+  const auto data   = encode_rows(values);
+
+  expect_values(read_avro_buffer(make_avro_file(
+                  "zstandard", {{values.size(), zstd_frame(data, true, checksum::none)}})),
+                values);
+  expect_values(read_avro_buffer(make_avro_file(
+                  "zstandard", {{values.size(), zstd_frame(data, true, checksum::valid)}})),
+                values);
+  EXPECT_THROW(read_avro_buffer(make_avro_file(
+                 "zstandard", {{values.size(), zstd_frame(data, true, checksum::corrupt)}})),
+               cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, ZstdWithoutContentSize) {
+  // Without the content size, the output buffer grows until the block fits
+  const std::vector<int64_t> values(40000, 0);
+  const auto file = make_avro_file(
+    "zstandard", {{values.size(), zstd_frame(encode_rows(values), false, checksum::valid)}});
+  expect_values(read_avro_buffer(file), values);
+}
@@ -14,14 +14,20 @@
  * limitations under the License.
  */
 
+#include <cudf/io/decompression.hpp>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/cudf_gmock.hpp>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <rmm/device_buffer.hpp>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/host_vector.h>
+#include <zlib.h>
 
 /**
  * @brief Base test fixture for decompression
@@ -116,6 +122,24 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for Zstandard decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch() {
+    return cudf::io::gpu_unzstd(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
+/**
+ * @brief Derived fixture for LZ4 decompression, with Hadoop framing detection
+ **/
+struct Lz4DecompressTest : public DecompressTest<Lz4DecompressTest> {
+  cudaError_t dispatch() {
+    return cudf::io::gpu_unlz4(d_inf_args.data().get(), d_inf_stat.data().get(), 1, 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld) {
   constexpr char uncompressed[] = "hello world";
   constexpr uint8_t compressed[] = {
@@ -162,4 +186,447 @@ TEST_F(BrotliDecompressTest, HelloWorld) {
   EXPECT_EQ(output, input);
 }
 
+TEST_F(BrotliDecompressTest, StaticDictionaryMetaBlocks) {
+  // Three meta-blocks of dictionary words, with the identity, space suffix, " and " suffix and
+  // uppercase-first transforms, and copies from the previous meta-blocks
+  constexpr char uncompressed[]  = " time world arld  common and ATime.comm";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x00, 0x00, 0x00, 0x04, 0x48, 0x29, 0xb2, 0x48, 0x41, 0x20, 0x6f, 0x00, 0x08,
+    0x00, 0x00, 0xa0, 0x40, 0xc2, 0x4a, 0x11, 0x46, 0x4a, 0x42, 0x45, 0x31, 0x60, 0x24,
+    0x00, 0x00, 0x80, 0x72, 0x09, 0x0a, 0x45, 0x8a, 0x32, 0x17, 0x21, 0x08};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+namespace {
+
+/**
+ * @brief Writes the bits of a Brotli stream, least significant bit first
+ **/
+struct brotli_bit_writer {
+  std::vector<uint8_t> bytes;
+  size_t num_bits = 0;
+
+  void put(uint32_t value, int count) {
+    for (int i = 0; i < count; ++i, ++num_bits) {
+      if (num_bits % 8 == 0) { bytes.push_back(0); }
+      bytes.back() |= ((value >> i) & 1) << (num_bits % 8);
+    }
+  }
+
+  /// Block type and tree counts, as 0 for 1 or as 1, k, and the offset from 2^k + 1
+  void put_count(uint32_t value) {
+    if (value == 1) { return put(0, 1); }
+    int k = 0;
+    while ((2u << k) + 1 <= value) { ++k; }
+    put(1, 1);
+    put(k, 3);
+    put(value - (1u << k) - 1, k);
+  }
+
+  /// A simple prefix code of a single symbol, whose code takes no bits
+  void put_single_symbol_code(uint32_t symbol, int alphabet_bits) {
+    put(1, 2);
+    put(0, 2);
+    put(symbol, alphabet_bits);
+  }
+
+  /**
+   * @brief Appends a meta-block of 8 copies of `literal`, with `num_trees` literal prefix codes
+   * that only differ by their symbol, so their tables need `num_trees` times the memory of one
+   **/
+  void put_meta_block(uint32_t num_trees, uint8_t literal, bool is_last) {
+    put(is_last, 1);
+    if (is_last) { put(0, 1); }  // ISLASTEMPTY
+    put(0, 2);                   // MNIBBLES = 4
+    put(8 - 1, 16);              // MLEN - 1
+    if (!is_last) { put(0, 1); }  // ISUNCOMPRESSED
+    for (int i = 0; i < 3; ++i) { put_count(1); }  // NBLTYPESL, NBLTYPESI, NBLTYPESD
+    put(0, 6);  // NPOSTFIX, NDIRECT
+    put(0, 2);  // Literal context mode
+    put_count(num_trees);
+    // All the contexts map to the first tree
+    int tree_bits = 0;
+    while ((1u << tree_bits) < num_trees) { ++tree_bits; }
+    put(0, 1);  // RLEMAX
+    put_single_symbol_code(0, tree_bits);
+    put(0, 1);     // IMTF
+    put_count(1);  // NTREESD
+    for (uint32_t i = 0; i < num_trees; ++i) { put_single_symbol_code(i == 0 ? literal : i, 8); }
+    // A single command that inserts 8 literals, ending the meta-block before its copy
+    put_single_symbol_code(7 << 3, 10);
+    put_single_symbol_code(0, 6);
+    put(0, 1);  // Insert length extra bit
+  }
+};
+
+}  // namespace
+
+TEST_F(BrotliDecompressTest, GrowingTreeGroups) {
+  // The literal tables of 30 trees don't fit in the local heap. The second meta-block needs more
+  // than the memory kept from the first one, and the third fits in what is kept from the second
+  brotli_bit_writer writer;
+  writer.put(0, 1);  // WBITS = 16
+  writer.put_meta_block(30, 'a', false);
+  writer.put_meta_block(60, 'b', false);
+  writer.put_meta_block(40, 'c', true);
+
+  std::vector<uint8_t> input = vector_from_string("aaaaaaaabbbbbbbbcccccccc");
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, writer.bytes.data(), writer.bytes.size());
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(inf_stat->status, 0u);
+}
+
+TEST_F(ZstdDecompressTest, HelloWorld) {
+  constexpr char uncompressed[] = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x58, 0x59,
+                                    0x00, 0x00, 0x68, 0x65, 0x6c, 0x6c, 0x6f,
+                                    0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedSentence) {
+  std::string uncompressed;
+  for (int i = 0; i < 8; ++i) { uncompressed += "The quick brown fox jumps over the lazy dog. "; }
+  // Compressed block with raw literals and a single long match
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x68, 0x00, 0xb5, 0x01, 0x00, 0xd4, 0x02, 0x54,
+    0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77,
+    0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20,
+    0x64, 0x6f, 0x67, 0x2e, 0x20, 0x01, 0x00, 0xc5, 0x81, 0xaa, 0x2a, 0x03};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed.c_str());
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, HuffmanLiteralsSingleStream) {
+  constexpr char uncompressed[] =
+    "Huffman coded literals: etaoin shrdlu cmfwyp vbgkqj xz, repeated letters eeee tttt aaaa oooo";
+  // Under 256 literals, coded as a single Huffman stream
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x5c, 0x85, 0x02, 0x00, 0x52, 0x45, 0x11, 0x11,
+    0x90, 0x7d, 0x50, 0xfa, 0x43, 0xe9, 0x0f, 0xad, 0x74, 0xbb, 0xe4, 0x1a, 0xc3,
+    0x4d, 0xee, 0x90, 0x03, 0x10, 0x42, 0xe8, 0x63, 0x8c, 0xe1, 0xd5, 0xff, 0xff,
+    0x9d, 0xce, 0xaf, 0xf5, 0xeb, 0xf8, 0xf8, 0xd3, 0xc1, 0xce, 0xbe, 0x24, 0x43,
+    0xe4, 0x7a, 0xd4, 0xf8, 0xb8, 0xe2, 0xb6, 0x99, 0x99, 0xa8, 0x3f, 0x05, 0x47,
+    0x7d, 0x0f, 0xb4, 0x8d, 0xf9, 0x55, 0x35, 0x37, 0x6f, 0x60, 0xf1, 0x37, 0xdc,
+    0x39, 0x56, 0x04, 0x02, 0x00, 0x2e, 0x7c, 0xb7, 0x81, 0x82, 0x02};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, HuffmanLiteralsFourStreams) {
+  // Letters with a skewed distribution, coded as four Huffman streams
+  const std::string alphabet = "eeeeeeeeeettttttaaaaaooooiiinnnsshhrrdlu  ";
+  std::string uncompressed;
+  uint32_t seed = 1;
+  while (uncompressed.size() < 300) {
+    seed = seed * 1103515245 + 12345;
+    uncompressed += alphabet[(seed >> 16) % alphabet.size()];
+  }
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x2c, 0x00, 0xbd, 0x04, 0x00, 0xc6, 0xd2, 0x24,
+    0x0e, 0xc0, 0x25, 0x1d, 0x72, 0xad, 0x12, 0xad, 0x85, 0x88, 0xfc, 0xff, 0xf7,
+    0x75, 0xe2, 0x22, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x9c, 0x77, 0xe6, 0x54, 0x61,
+    0xc0, 0x28, 0x79, 0x19, 0x83, 0x57, 0xa7, 0x35, 0x00, 0x0a, 0x88, 0x8f, 0x38,
+    0xd0, 0x02, 0x22, 0xbb, 0x8a, 0x4a, 0xd8, 0xc0, 0x2a, 0xa0, 0xad, 0xac, 0x8b,
+    0xaf, 0xa7, 0x21, 0xec, 0x62, 0x58, 0x9a, 0xae, 0xb4, 0x61, 0xb2, 0x26, 0xd5,
+    0xea, 0xc7, 0x96, 0x95, 0xd7, 0xd5, 0xd4, 0x77, 0xab, 0x0a, 0x0a, 0x82, 0xd4,
+    0xc5, 0x20, 0x79, 0x3a, 0x35, 0x7a, 0x61, 0x8c, 0x0d, 0xa3, 0x2b, 0x49, 0xc3,
+    0x7e, 0x75, 0xa2, 0xdd, 0x80, 0xdd, 0x6c, 0xca, 0x63, 0x31, 0x27, 0xd2, 0x79,
+    0x69, 0x1b, 0xd2, 0xce, 0x41, 0x65, 0xdf, 0x4a, 0x12, 0xa4, 0x69, 0xb0, 0x17,
+    0x68, 0xf3, 0xab, 0xa3, 0xab, 0x6b, 0x5d, 0xfa, 0x1b, 0xb6, 0xa6, 0x5c, 0xfe,
+    0xf6, 0x48, 0xf9, 0x48, 0x2f, 0x7d, 0xf8, 0x5d, 0x4f, 0x41, 0x45, 0xb5, 0xc7,
+    0x67, 0x98, 0x6b, 0x54, 0x00};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed.c_str());
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, CompressedAndRepeatSequences) {
+  std::string uncompressed;
+  uint32_t seed = 1;
+  while (uncompressed.size() < 1000) {
+    seed = seed * 1103515245 + 12345;
+    uncompressed += "id=" + std::to_string(seed % 1000) + ";name=user" +
+                    std::to_string((seed >> 10) % 50) + ";score=" +
+                    std::to_string((seed >> 20) % 100) + "\n";
+  }
+  // Three blocks: the first with FSE_Compressed sequence tables and Huffman
+  // literals, the others reusing them with Repeat modes and treeless literals;
+  // the repeated fields make the matches use all three repeated offsets
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x68, 0xd4, 0x03, 0x00, 0x82, 0xc6, 0x12, 0x11,
+    0xb0, 0x3b, 0x20, 0x0b, 0x47, 0xe2, 0x4b, 0x25, 0x82, 0x4c, 0x76, 0x66, 0x46,
+    0x4a, 0xac, 0x3b, 0x01, 0xaa, 0xac, 0x21, 0x44, 0xff, 0x63, 0x3a, 0xb6, 0xaf,
+    0x07, 0x65, 0xee, 0x75, 0xd1, 0xb8, 0xca, 0x88, 0x88, 0xaa, 0x2e, 0xbc, 0x35,
+    0x04, 0xf1, 0xff, 0xbd, 0xec, 0x8e, 0x99, 0x89, 0x1b, 0x3e, 0x37, 0xf5, 0x75,
+    0xbd, 0x5d, 0x33, 0xc9, 0x49, 0x20, 0x99, 0xa0, 0xc6, 0x8c, 0x1b, 0x8a, 0x0d,
+    0xb9, 0x47, 0x90, 0x2a, 0x6b, 0x84, 0x67, 0x72, 0x52, 0x21, 0xa8, 0x31, 0x3c,
+    0x5d, 0xef, 0x7f, 0x07, 0x50, 0x35, 0x1d, 0x10, 0x48, 0x13, 0x2c, 0x09, 0x3e,
+    0xcb, 0x90, 0x4d, 0x8a, 0xf3, 0x40, 0x3c, 0x7e, 0x82, 0xa4, 0xda, 0x3f, 0xbe,
+    0x6b, 0x6e, 0x7e, 0xc4, 0xf3, 0x90, 0x89, 0x93, 0x8d, 0xf8, 0x10, 0xbd, 0x6e,
+    0x55, 0xa4, 0x02, 0x00, 0x63, 0x44, 0x09, 0xfe, 0xba, 0x8b, 0x8b, 0xc9, 0xc1,
+    0x1f, 0xb3, 0x9f, 0x55, 0xb4, 0xaa, 0x08, 0xad, 0xbc, 0x9d, 0xdd, 0xe2, 0xd1,
+    0x43, 0x68, 0xec, 0x6d, 0x21, 0x50, 0x17, 0x37, 0xf1, 0xc5, 0x2f, 0xba, 0x27,
+    0xe6, 0xff, 0x8a, 0x55, 0x14, 0x23, 0xe8, 0x60, 0x2f, 0xd5, 0x18, 0x11, 0x10,
+    0xa1, 0x00, 0x8d, 0x72, 0x6e, 0x75, 0xc3, 0xf2, 0x23, 0xd2, 0xfa, 0xe2, 0x68,
+    0x52, 0x18, 0x84, 0x7e, 0xbf, 0x7d, 0x2e, 0xdc, 0x43, 0x30, 0x90, 0x0b, 0x0f,
+    0x53, 0x11, 0xa8, 0xb8, 0x2a, 0xee, 0xb4, 0x0c, 0xca, 0x06, 0x75, 0x02, 0x00,
+    0x03, 0x85, 0x0a, 0xa0, 0x1f, 0x31, 0x13, 0x5f, 0x55, 0x15, 0x51, 0xdd, 0x15,
+    0x1d, 0x93, 0x71, 0x33, 0x85, 0x76, 0x7e, 0xfa, 0x27, 0x73, 0x6f, 0x08, 0x2e,
+    0xf8, 0x55, 0x7c, 0xee, 0xa2, 0x08, 0x2f, 0x54, 0x7f, 0x7b, 0x05, 0xe3, 0x8a,
+    0xf7, 0x6e, 0x64, 0x14, 0x48, 0x50, 0x23, 0xf8, 0x11, 0x10, 0x99, 0x80, 0x15,
+    0xed, 0xf5, 0x0c, 0xf1, 0x17, 0x9c, 0x12, 0x19, 0xcd, 0x1a, 0xa1, 0x38, 0xf2,
+    0x4c, 0x25, 0x06, 0x05, 0x17, 0xf3, 0xe0, 0x6f, 0x08, 0xc1, 0x88, 0x87, 0x19};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed.c_str());
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+
+  // Metadata is decompressed on the host with the same decoder
+  std::unique_ptr<cudf::io::HostDecompressor> host_decompressor(
+    cudf::io::HostDecompressor::Create(cudf::io::IO_UNCOMP_STREAM_TYPE_ZSTD));
+  std::vector<uint8_t> host_output(input.size());
+  EXPECT_EQ(host_decompressor->Decompress(
+              host_output.data(), host_output.size(), compressed, sizeof(compressed)),
+            input.size());
+  EXPECT_EQ(host_output, input);
+}
+
+TEST_F(Lz4DecompressTest, RawBlock) {
+  constexpr char uncompressed[] = "hello hello hello hello world";
+  constexpr uint8_t compressed[] = {0x6e, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x06,
+                                    0x00, 0x50, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, HadoopFramed) {
+  constexpr char uncompressed[] = "hello hello hello hello world";
+  constexpr uint8_t compressed[] = {0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f,
+                                    0x6e, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x06,
+                                    0x00, 0x50, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+struct GzipSplitDecompressTest : public cudf::test::BaseFixture {};
+
+TEST_F(GzipSplitDecompressTest, LargeStream) {
+  // Rows of pseudo-random numbers, which compress to several parts of raw DEFLATE data
+  std::string uncompressed;
+  uint32_t seed = 1;
+  while (uncompressed.size() < (12 << 20)) {
+    seed = seed * 1103515245 + 12345;
+    uncompressed += std::to_string(seed >> 8) + "," + std::to_string(seed % 1000) + "\n";
+  }
+  z_stream strm{};
+  ASSERT_EQ(deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY), Z_OK);
+  std::vector<uint8_t> compressed(deflateBound(&strm, uncompressed.size()));
+  strm.next_in   = reinterpret_cast<Bytef *>(&uncompressed[0]);
+  strm.avail_in  = uncompressed.size();
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  ASSERT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+
+  rmm::device_buffer src(compressed.data(), compressed.size());
+  rmm::device_buffer dst(uncompressed.size());
+  rmm::device_buffer scratch(
+    cudf::io::get_gpuinflate_split_scratch_size(src.size(), dst.size()));
+  rmm::device_vector<cudf::io::gpu_inflate_status_s> d_status(1);
+  cudf::io::gpu_inflate_input_s input{src.data(), src.size(), dst.data(), dst.size()};
+  ASSERT_CUDA_SUCCEEDED(cudf::io::gpuinflate_split(
+    input, d_status.data().get(), scratch.data(), scratch.size()));
+
+  thrust::host_vector<cudf::io::gpu_inflate_status_s> status(d_status);
+  EXPECT_EQ(status[0].status, 0u);
+  EXPECT_EQ(status[0].bytes_written, uncompressed.size());
+  std::string output(uncompressed.size(), '\0');
+  ASSERT_CUDA_SUCCEEDED(
+    cudaMemcpy(&output[0], dst.data(), output.size(), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(output, uncompressed);
+}
+
+struct SnappyCompressTest : public cudf::test::BaseFixture {};
+
+TEST_F(SnappyCompressTest, LevelsRoundTrip) {
+  // Repeated rows, with long matches at distances over 32KB
+  std::string uncompressed;
+  uint32_t seed = 1;
+  std::vector<std::string> rows;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    auto const fill = static_cast<char>('a' + (seed >> 16) % 26);
+    rows.push_back(std::string(80, fill) + std::to_string(seed) + "\n");
+  }
+  while (uncompressed.size() < (256 << 10)) {
+    seed = seed * 1103515245 + 12345;
+    uncompressed += rows[(seed >> 8) % rows.size()];
+  }
+  rmm::device_buffer src(uncompressed.data(), uncompressed.size());
+  rmm::device_buffer dst(uncompressed.size());
+
+  std::vector<size_t> compressed_sizes;
+  for (int level = 0; level <= 2; ++level) {
+    rmm::device_buffer compressed(uncompressed.size() * 2);
+    rmm::device_vector<cudf::io::gpu_inflate_input_s> d_input(
+      1, {src.data(), src.size(), compressed.data(), compressed.size()});
+    rmm::device_vector<cudf::io::gpu_inflate_status_s> d_status(1);
+    ASSERT_CUDA_SUCCEEDED(
+      cudf::io::gpu_snap(d_input.data().get(), d_status.data().get(), 1, level));
+    thrust::host_vector<cudf::io::gpu_inflate_status_s> status(d_status);
+    ASSERT_EQ(status[0].status, 0u);
+    compressed_sizes.push_back(status[0].bytes_written);
+
+    d_input[0] = cudf::io::gpu_inflate_input_s{
+      compressed.data(), status[0].bytes_written, dst.data(), dst.size()};
+    ASSERT_CUDA_SUCCEEDED(cudf::io::gpu_unsnap(d_input.data().get(), d_status.data().get(), 1));
+    status = d_status;
+    EXPECT_EQ(status[0].status, 0u);
+    EXPECT_EQ(status[0].bytes_written, uncompressed.size());
+    std::string output(uncompressed.size(), '\0');
+    ASSERT_CUDA_SUCCEEDED(
+      cudaMemcpy(&output[0], dst.data(), output.size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(output, uncompressed);
+  }
+  EXPECT_LT(compressed_sizes[2], compressed_sizes[0]);
+}
+
+struct DeflateCompressTest : public cudf::test::BaseFixture {
+  // Compresses on the GPU and decompresses the raw DEFLATE stream with zlib
+  std::string round_trip(std::string const &uncompressed, size_t *compressed_size) {
+    rmm::device_buffer src(uncompressed.data(), uncompressed.size());
+    rmm::device_buffer compressed(uncompressed.size() + 1024);
+    rmm::device_vector<cudf::io::gpu_inflate_input_s> d_input(
+      1, {src.data(), src.size(), compressed.data(), compressed.size()});
+    rmm::device_vector<cudf::io::gpu_inflate_status_s> d_status(1);
+    EXPECT_CUDA_SUCCEEDED(
+      cudf::io::gpu_deflate(d_input.data().get(), d_status.data().get(), 1));
+    thrust::host_vector<cudf::io::gpu_inflate_status_s> status(d_status);
+    EXPECT_EQ(status[0].status, 0u);
+    *compressed_size = status[0].bytes_written;
+
+    std::vector<uint8_t> h_compressed(*compressed_size);
+    EXPECT_CUDA_SUCCEEDED(cudaMemcpy(
+      h_compressed.data(), compressed.data(), h_compressed.size(), cudaMemcpyDeviceToHost));
+    std::string output(uncompressed.size() + 1, '\0');
+    z_stream strm{};
+    EXPECT_EQ(inflateInit2(&strm, -15), Z_OK);
+    strm.next_in   = h_compressed.data();
+    strm.avail_in  = h_compressed.size();
+    strm.next_out  = reinterpret_cast<Bytef *>(&output[0]);
+    strm.avail_out = output.size();
+    EXPECT_EQ(inflate(&strm, Z_FINISH), Z_STREAM_END);
+    output.resize(strm.total_out);
+    inflateEnd(&strm);
+    return output;
+  }
+};
+
+TEST_F(DeflateCompressTest, Text) {
+  std::string uncompressed;
+  uint32_t seed = 1;
+  while (uncompressed.size() < (256 << 10)) {
+    seed = seed * 1103515245 + 12345;
+    uncompressed += "row " + std::to_string(seed % 1000) + ", value " +
+                    std::to_string(seed >> 20) + "\n";
+  }
+  size_t compressed_size = 0;
+  EXPECT_EQ(round_trip(uncompressed, &compressed_size), uncompressed);
+  EXPECT_LT(compressed_size, uncompressed.size() / 2);
+}
+
+TEST_F(DeflateCompressTest, RandomBytes) {
+  std::string uncompressed(100000, '\0');
+  uint32_t seed = 1;
+  for (auto &c : uncompressed) {
+    seed = seed * 1103515245 + 12345;
+    c    = static_cast<char>(seed >> 24);
+  }
+  size_t compressed_size = 0;
+  EXPECT_EQ(round_trip(uncompressed, &compressed_size), uncompressed);
+  // Incompressible data is written as stored blocks
+  EXPECT_LE(compressed_size, uncompressed.size() + 5 * (uncompressed.size() / 16384 + 1));
+}
+
+TEST_F(DeflateCompressTest, Empty) {
+  size_t compressed_size = 0;
+  EXPECT_EQ(round_trip(std::string(), &compressed_size), std::string());
+  EXPECT_EQ(compressed_size, 2u);
+}
+
+struct BatchedDecompressTest : public cudf::test::BaseFixture {};
+
+TEST_F(BatchedDecompressTest, Snappy) {
+  namespace cudf_io = cudf::experimental::io;
+
+  // "hello world" and "Aaaaaaaaaaaah!"
+  const std::vector<std::vector<uint8_t>> compressed{
+    {0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64},
+    {14, 0x0, 'A', 0x0, 'a', (10 - 4) * 4 + 1, 1, 0x4, 'h', '!'}};
+  const std::vector<std::string> expected{"hello world", "Aaaaaaaaaaaah!"};
+
+  std::vector<rmm::device_buffer> src;
+  std::vector<rmm::device_buffer> dst;
+  std::vector<cudf_io::device_decompress_input> inputs;
+  for (size_t i = 0; i < compressed.size(); ++i) {
+    src.emplace_back(compressed[i].data(), compressed[i].size());
+    dst.emplace_back(expected[i].size());
+    inputs.push_back({src.back().data(), src.back().size(), dst.back().data(), dst.back().size()});
+  }
+  rmm::device_vector<cudf_io::device_decompress_input> d_inputs(inputs);
+  rmm::device_vector<cudf_io::device_decompress_status> d_statuses(inputs.size());
+
+  const auto scratch_size =
+    cudf_io::batched_decompress_scratch_size(cudf_io::compression_type::SNAPPY, inputs.size());
+  rmm::device_buffer scratch(scratch_size);
+  cudf_io::batched_decompress(cudf_io::compression_type::SNAPPY,
+                              d_inputs.data().get(),
+                              d_statuses.data().get(),
+                              inputs.size(),
+                              scratch.data(),
+                              scratch.size());
+
+  thrust::host_vector<cudf_io::device_decompress_status> statuses(d_statuses);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(statuses[i].status, 0u);
+    EXPECT_EQ(statuses[i].bytes_written, expected[i].size());
+    std::string output(expected[i].size(), '\0');
+    ASSERT_CUDA_SUCCEEDED(
+      cudaMemcpy(&output[0], dst[i].data(), output.size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(output, expected[i]);
+  }
+
+  EXPECT_THROW(cudf_io::batched_decompress(
+                 cudf_io::compression_type::BZIP2, d_inputs.data().get(), d_statuses.data().get(),
+                 inputs.size(), nullptr, 0),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
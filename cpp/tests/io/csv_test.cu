@@ -18,6 +18,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/io/functions.hpp>
@@ -57,6 +58,9 @@ auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
 // Base test fixture for tests
 struct CsvReaderTest : public cudf::test::BaseFixture {};
 
+// Base test fixture for writer tests
+struct CsvWriterTest : public cudf::test::BaseFixture {};
+
 // Typed test fixture for timestamp type tests
 template <typename T>
 struct CsvReaderNumericTypeTest : public CsvReaderTest {
@@ -472,6 +476,31 @@ TEST_F(CsvReaderTest, StringsQuotesIgnored) {
       view.column(1));
 }
 
+TEST_F(CsvReaderTest, QuotedMultilineFields) {
+  // Spans many row detection blocks, with rows ending on both sides of the
+  // block boundaries inside and outside the quoted fields
+  constexpr int num_rows = 2000;
+  std::string input;
+  std::vector<int32_t> expected_numbers;
+  for (int i = 0; i < num_rows; ++i) {
+    auto const text = "line " + std::to_string(i) + "\n\"\"next,\"\" line";
+    input += std::to_string(i) + ",\"" + text + "\"\n";
+    expected_numbers.push_back(i);
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{input.c_str(), input.size()}};
+  in_args.names = {"number", "text"};
+  in_args.dtype = {"int32", "str"};
+  in_args.header = -1;
+  in_args.doublequote = false;
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  ASSERT_EQ(num_rows, view.num_rows());
+  expect_column_data_equal(expected_numbers, view.column(0));
+}
+
 TEST_F(CsvReaderTest, SkiprowsNrows) {
   auto filepath = temp_env->get_temp_dir() + "SkiprowsNrows.csv";
   {
@@ -585,6 +614,101 @@ TEST_F(CsvReaderTest, NoDataFile) {
   EXPECT_EQ(0, view.num_columns());
 }
 
+TEST_F(CsvReaderTest, GzipConcatenatedMembers) {
+  // Two gzip members, holding "1\n2\n3\n" and "4\n5\n"
+  const std::vector<uint8_t> data{
+      0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x33, 0xe4,
+      0x32, 0xe2, 0x32, 0xe6, 0x02, 0x00, 0xd8, 0x54, 0x5f, 0x77, 0x06, 0x00,
+      0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+      0x33, 0xe1, 0x32, 0xe5, 0x02, 0x00, 0x94, 0x1e, 0x7e, 0x11, 0x04, 0x00,
+      0x00, 0x00};
+  auto filepath = temp_env->get_temp_dir() + "GzipConcatenatedMembers.csv.gz";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+    outfile.write(reinterpret_cast<const char*>(data.data()), data.size());
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names = {"A"};
+  in_args.dtype = {"int32"};
+  in_args.header = -1;
+  in_args.compression = cudf_io::compression_type::GZIP;
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  EXPECT_EQ(1, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3, 4, 5}, view.column(0));
+}
+
+TEST_F(CsvReaderTest, Bzip2ConcatenatedStreams) {
+  // Two bz2 streams, holding "1\n2\n3\n" and "4\n5\n"
+  const std::vector<uint8_t> data{
+      0x42, 0x5a, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x12, 0x5d,
+      0x9f, 0x8a, 0x00, 0x00, 0x01, 0xc8, 0x00, 0x00, 0x10, 0x38, 0x00, 0x20,
+      0x00, 0x21, 0x9a, 0x68, 0x33, 0x4d, 0x1c, 0xb7, 0x8b, 0xb9, 0x22, 0x9c,
+      0x28, 0x48, 0x09, 0x2e, 0xcf, 0xc5, 0x00, 0x42, 0x5a, 0x68, 0x39, 0x31,
+      0x41, 0x59, 0x26, 0x53, 0x59, 0xdc, 0xc2, 0xa3, 0x73, 0x00, 0x00, 0x01,
+      0x48, 0x00, 0x00, 0x10, 0x06, 0x00, 0x20, 0x00, 0x30, 0xcc, 0x0c, 0x7a,
+      0x82, 0x71, 0x77, 0x24, 0x53, 0x85, 0x09, 0x0d, 0xcc, 0x2a, 0x37, 0x30};
+  auto filepath = temp_env->get_temp_dir() + "Bzip2ConcatenatedStreams.csv.bz2";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+    outfile.write(reinterpret_cast<const char*>(data.data()), data.size());
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names = {"A"};
+  in_args.dtype = {"int32"};
+  in_args.header = -1;
+  in_args.compression = cudf_io::compression_type::BZIP2;
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  EXPECT_EQ(1, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3, 4, 5}, view.column(0));
+}
+
+TEST_F(CsvReaderTest, ChunkedRead) {
+  constexpr auto num_rows = 1000;
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "A,B\n";
+    for (int i = 0; i < num_rows; ++i) {
+      outfile << i << "," << i * 0.5 << "\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  cudf_io::chunked_csv_reader reader(in_args, 1000);
+
+  std::vector<int64_t> a_values;
+  std::vector<double> b_values;
+  int num_chunks = 0;
+  while (reader.has_next()) {
+    auto result = reader.read_chunk();
+    const auto view = result.tbl->view();
+    ASSERT_EQ(2, view.num_columns());
+    ASSERT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+    ASSERT_EQ(cudf::type_id::FLOAT64, view.column(1).type().id());
+    EXPECT_EQ(result.metadata.column_names[0], "A");
+    EXPECT_EQ(result.metadata.column_names[1], "B");
+    const auto a = cudf::test::to_host<int64_t>(view.column(0)).first;
+    const auto b = cudf::test::to_host<double>(view.column(1)).first;
+    a_values.insert(a_values.end(), a.begin(), a.end());
+    b_values.insert(b_values.end(), b.begin(), b.end());
+    num_chunks++;
+  }
+  EXPECT_GT(num_chunks, 1);
+
+  // Every row is returned exactly once, in order
+  ASSERT_EQ(num_rows, static_cast<int>(a_values.size()));
+  for (int i = 0; i < num_rows; ++i) {
+    EXPECT_EQ(i, a_values[i]);
+    EXPECT_EQ(i * 0.5, b_values[i]);
+  }
+}
+
 TEST_F(CsvReaderTest, ArrowFileSource) {
   auto filepath = temp_env->get_temp_dir() + "ArrowFileSource.csv";
   {
@@ -607,6 +731,54 @@ TEST_F(CsvReaderTest, ArrowFileSource) {
                            view.column(0));
 }
 
+TEST_F(CsvReaderTest, InferSampleRows) {
+  std::string input;
+  std::vector<int64_t> expected;
+  for (int i = 0; i < 1000; ++i) {
+    input += std::to_string(i) + "," + std::to_string(i) + (i == 1 ? ".5\n" : "\n");
+    expected.push_back(i);
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{input.c_str(), input.size()}};
+  in_args.names = {"A", "B"};
+  in_args.header = -1;
+  in_args.infer_sample_rows = 100;
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  ASSERT_EQ(1000, view.num_rows());
+  ASSERT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+  ASSERT_EQ(cudf::type_id::FLOAT64, view.column(1).type().id());
+  expect_column_data_equal(expected, view.column(0));
+}
+
+TEST_F(CsvReaderTest, ReadAsync) {
+  std::string const first = "1,2\n3,4\n";
+  std::string const second = "5,6\n7,8\n9,10\n";
+  cudf_io::read_csv_args first_args{cudf_io::source_info{first.c_str(), first.size()}};
+  first_args.names = {"A", "B"};
+  first_args.header = -1;
+  auto second_args = first_args;
+  second_args.source = cudf_io::source_info{second.c_str(), second.size()};
+
+  auto first_result = cudf_io::read_csv_async(first_args);
+  auto second_result = cudf_io::read_csv_async(second_args);
+  auto const second_table = second_result.get();
+  auto const first_table = first_result.get();
+
+  cudf::test::expect_tables_equal(cudf_io::read_csv(first_args).tbl->view(),
+                                  first_table.tbl->view());
+  cudf::test::expect_tables_equal(cudf_io::read_csv(second_args).tbl->view(),
+                                  second_table.tbl->view());
+
+  // The errors of the read are rethrown by the future
+  cudf_io::read_csv_args missing{
+      cudf_io::source_info{temp_env->get_temp_dir() + "ReadAsyncMissing.csv"}};
+  auto missing_result = cudf_io::read_csv_async(missing);
+  EXPECT_ANY_THROW(missing_result.get());
+}
+
 TEST_F(CsvReaderTest, InvalidFloatingPoint) {
   const auto filepath = temp_env->get_temp_dir() + "InvalidFloatingPoint.csv";
   {
@@ -642,4 +814,56 @@ TEST_F(CsvReaderTest, StringInference) {
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::STRING);  
 }
 
+TEST_F(CsvWriterTest, MultiColumn) {
+  column_wrapper<int32_t> col0{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 1}};
+  column_wrapper<cudf::string_view> col1{
+      {"a", "b,c", "", "d\"e", "f"}, {1, 1, 0, 1, 1}};
+  column_wrapper<bool> col2{{true, false, true, false, true}};
+  table_view input{{col0, col1, col2}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"A", "B", "C"};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_csv_args out_args{cudf_io::sink_info{&out_buffer}, input,
+                                   &metadata};
+  out_args.na_rep = "NA";
+  out_args.rows_per_chunk = 2;
+  cudf_io::write_csv(out_args);
+
+  const std::string expected =
+      "A,B,C\n"
+      "1,a,true\n"
+      "NA,\"b,c\",false\n"
+      "3,NA,true\n"
+      "4,\"d\"\"e\",false\n"
+      "5,f,true\n";
+  EXPECT_EQ(expected, std::string(out_buffer.begin(), out_buffer.end()));
+}
+
+TEST_F(CsvWriterTest, RoundTrip) {
+  constexpr auto num_rows = 100;
+  auto filepath = temp_env->get_temp_dir() + "CsvWriterRoundTrip.csv";
+
+  auto values = random_values<int64_t>(num_rows);
+  column_wrapper<int64_t> col0(values.begin(), values.end());
+  table_view input{{col0}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"A"};
+  cudf_io::write_csv_args out_args{cudf_io::sink_info{filepath}, input,
+                                   &metadata};
+  out_args.rows_per_chunk = 16;
+  cudf_io::write_csv(out_args);
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.dtype = {"int64"};
+  const auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(1, view.num_columns());
+  EXPECT_EQ(result.metadata.column_names[0], "A");
+  expect_column_data_equal(values, view.column(0));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
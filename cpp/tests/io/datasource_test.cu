@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/datasource.hpp>
+#include <io/utilities/file_metadata_cache.hpp>
+#include <io/utilities/ranged_source.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct DatasourceTest : public cudf::test::BaseFixture {};
+
+/**
+ * @brief Remote source over host data, recording the ranges requested from it
+ */
+class fake_remote_source : public cudf::io::ranged_source {
+ public:
+  fake_remote_source(std::string data, cudf::io::remote_source_options const& options)
+    : ranged_source(options), _data(std::move(data)) {}
+
+  size_t size() const override { return _data.size(); }
+
+  std::vector<std::pair<size_t, size_t>> requests() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto result = _requests;
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  int failures        = 0;      ///< Number of requests to fail before succeeding
+  bool ignores_ranges = false;  ///< Whether the whole object is returned for every request
+
+ protected:
+  std::shared_ptr<arrow::Buffer> fetch_range(size_t offset, size_t size) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.emplace_back(offset, size);
+    if (failures > 0) {
+      --failures;
+      CUDF_FAIL("Remote object request failed");
+    }
+    if (ignores_ranges) { return arrow::Buffer::FromString(std::string(_data)); }
+    return arrow::Buffer::FromString(_data.substr(offset, size));
+  }
+
+ private:
+  std::string _data;
+  std::mutex _mutex;
+  std::vector<std::pair<size_t, size_t>> _requests;
+};
+
+std::string make_remote_data(size_t size) {
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) { data[i] = static_cast<char>(i * 7 + i / 251); }
+  return data;
+}
+
+std::string to_string(std::shared_ptr<arrow::Buffer> const& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer->data()), buffer->size());
+}
+
+cudf::io::remote_source_options test_remote_options() {
+  cudf::io::remote_source_options options;
+  options.readahead_size   = 100;
+  options.coalesce_gap     = 50;
+  options.max_request_size = 1000;
+  options.max_concurrency  = 4;
+  options.cache_size       = 10000;
+  options.retry_delay      = std::chrono::milliseconds{1};
+  return options;
+}
+
+TEST_F(DatasourceTest, DeviceReadByteRange) {
+  // Larger than a page, so the byte range does not start on a page boundary
+  std::vector<char> data(3 * 4096 + 123);
+  for (size_t i = 0; i < data.size(); ++i) { data[i] = static_cast<char>(i * 7 + i / 251); }
+
+  auto filepath = temp_env->get_temp_filepath("DeviceReadByteRange.bin");
+  std::ofstream(filepath, std::ios::binary).write(data.data(), data.size());
+
+  const size_t range_offset = 4096 + 100;
+  const size_t range_size   = 4096;
+  auto source              = cudf::io::datasource::create(filepath, range_offset, range_size);
+  // Only cuFile-backed sources read to device; nothing to check without them
+  if (!source->supports_device_read()) { return; }
+
+  // Starts inside the range and runs past its end, so the read is clamped
+  const size_t read_offset = range_offset + 50;
+  const size_t read_size   = range_size;
+  const auto host_buffer   = source->get_buffer(read_offset, read_size);
+
+  rmm::device_buffer dev_buffer(read_size);
+  const auto bytes_read =
+    source->device_read(read_offset, read_size, static_cast<uint8_t*>(dev_buffer.data()), 0);
+  EXPECT_EQ(bytes_read, range_size - 50);
+  ASSERT_EQ(bytes_read, host_buffer->size());
+
+  std::vector<char> dev_data(bytes_read);
+  CUDA_TRY(cudaMemcpy(dev_data.data(), dev_buffer.data(), bytes_read, cudaMemcpyDeviceToHost));
+  EXPECT_EQ(dev_data, std::vector<char>(data.begin() + read_offset,
+                                        data.begin() + read_offset + bytes_read));
+  EXPECT_EQ(dev_data, std::vector<char>(host_buffer->data(), host_buffer->data() + bytes_read));
+
+  EXPECT_THROW(
+    source->device_read(range_offset - 1, 1, static_cast<uint8_t*>(dev_buffer.data()), 0),
+    cudf::logic_error);
+}
+
+TEST_F(DatasourceTest, FileMetadataCacheEviction) {
+  std::vector<std::string> paths;
+  for (const auto name : {"CacheA.bin", "CacheB.bin", "CacheC.bin"}) {
+    paths.push_back(temp_env->get_temp_filepath(name));
+    std::ofstream(paths.back(), std::ios::binary).put('x');
+  }
+
+  cudf::io::file_metadata_cache<int> cache(100);
+  int num_loads = 0;
+  auto load     = [&](int value, size_t bytes) {
+    return cache.get_or_load(paths[value], [&]() {
+      ++num_loads;
+      return std::make_pair(std::make_shared<const int>(value), bytes);
+    });
+  };
+
+  EXPECT_EQ(*load(0, 40), 0);
+  EXPECT_EQ(*load(1, 40), 1);
+  EXPECT_EQ(*load(0, 40), 0);
+  EXPECT_EQ(num_loads, 2);
+
+  // The least recently used entry is evicted to stay within the capacity
+  EXPECT_EQ(*load(2, 40), 2);
+  EXPECT_EQ(cache.cached_bytes(), 80u);
+  load(0, 40);
+  EXPECT_EQ(num_loads, 3);
+  load(1, 40);
+  EXPECT_EQ(num_loads, 4);
+
+  // Entries larger than the capacity are returned but not cached
+  cudf::io::file_metadata_cache<int> small_cache(10);
+  small_cache.get_or_load(paths[0],
+                          [] { return std::make_pair(std::make_shared<const int>(0), 20); });
+  EXPECT_EQ(small_cache.cached_bytes(), 0u);
+}
+
+TEST_F(DatasourceTest, RemoteCoalescedPrefetch) {
+  auto const data = make_remote_data(10000);
+  fake_remote_source source(data, test_remote_options());
+
+  // Ranges separated by small gaps are merged, up to the largest request size
+  source.prefetch({{500, 100}, {0, 100}, {130, 100}, {2000, 100}, {2150, 900}});
+  using ranges = std::vector<std::pair<size_t, size_t>>;
+  EXPECT_EQ(source.requests(), (ranges{{0, 230}, {500, 100}, {2000, 100}, {2150, 900}}));
+
+  // The prefetched ranges are served from the cache
+  EXPECT_EQ(to_string(source.get_buffer(130, 100)), data.substr(130, 100));
+  EXPECT_EQ(to_string(source.get_buffer(2160, 50)), data.substr(2160, 50));
+  EXPECT_EQ(source.requests().size(), 4u);
+}
+
+TEST_F(DatasourceTest, RemoteCacheHits) {
+  auto const data = make_remote_data(10000);
+  fake_remote_source source(data, test_remote_options());
+
+  // Small reads fetch the data that follows
+  EXPECT_EQ(to_string(source.get_buffer(10, 20)), data.substr(10, 20));
+  EXPECT_EQ(to_string(source.get_buffer(50, 60)), data.substr(50, 60));
+  EXPECT_EQ(source.requests().size(), 1u);
+
+  // A read spanning adjacent cached ranges is served from both
+  EXPECT_EQ(to_string(source.get_buffer(110, 10)), data.substr(110, 10));
+  EXPECT_EQ(source.requests().size(), 2u);
+  EXPECT_EQ(to_string(source.get_buffer(90, 100)), data.substr(90, 100));
+  EXPECT_EQ(source.requests().size(), 2u);
+
+  // Reads are clamped to the end of the source
+  EXPECT_EQ(to_string(source.get_buffer(9990, 100)), data.substr(9990));
+  EXPECT_EQ(source.get_buffer(20000, 10)->size(), 0u);
+}
+
+TEST_F(DatasourceTest, RemoteCacheEviction) {
+  auto const data    = make_remote_data(10000);
+  auto options       = test_remote_options();
+  options.cache_size = 250;
+  fake_remote_source source(data, options);
+
+  source.get_buffer(0, 10);
+  source.get_buffer(1000, 10);
+  EXPECT_EQ(source.requests().size(), 2u);
+
+  // The oldest range is evicted to stay within the cache size
+  source.get_buffer(2000, 10);
+  source.get_buffer(1000, 10);
+  EXPECT_EQ(source.requests().size(), 3u);
+  EXPECT_EQ(to_string(source.get_buffer(0, 10)), data.substr(0, 10));
+  EXPECT_EQ(source.requests().size(), 4u);
+}
+
+TEST_F(DatasourceTest, RemoteRetries) {
+  auto const data     = make_remote_data(1000);
+  auto options        = test_remote_options();
+  options.max_retries = 2;
+  fake_remote_source source(data, options);
+
+  // Failed requests are retried after a growing delay
+  source.failures  = 2;
+  auto const start = std::chrono::steady_clock::now();
+  EXPECT_EQ(to_string(source.get_buffer(0, 10)), data.substr(0, 10));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 3 * options.retry_delay);
+  EXPECT_EQ(source.requests().size(), 3u);
+
+  // Until they fail more times than allowed
+  source.failures = 3;
+  EXPECT_THROW(source.get_buffer(500, 10), cudf::logic_error);
+  EXPECT_EQ(source.requests().size(), 6u);
+}
+
+TEST_F(DatasourceTest, RemoteWholeObjectResponses) {
+  auto const data = make_remote_data(1000);
+  fake_remote_source source(data, test_remote_options());
+  source.ignores_ranges = true;
+
+  // The object is fetched once, then serves all the reads
+  EXPECT_EQ(to_string(source.get_buffer(100, 10)), data.substr(100, 10));
+  EXPECT_EQ(to_string(source.get_buffer(900, 50)), data.substr(900, 50));
+  source.prefetch({{300, 100}, {600, 100}});
+  EXPECT_EQ(to_string(source.get_buffer(600, 100)), data.substr(600, 100));
+  EXPECT_EQ(source.requests().size(), 1u);
+}
+
+TEST_F(DatasourceTest, FileGetBuffers) {
+  auto const data = make_remote_data(3 * 4096 + 123);
+  auto filepath   = temp_env->get_temp_filepath("FileGetBuffers.bin");
+  std::ofstream(filepath, std::ios::binary).write(data.data(), data.size());
+  auto source = cudf::io::datasource::create(filepath);
+
+  // The ranges are hinted to the kernel before they are read
+  std::vector<std::pair<size_t, size_t>> const ranges{{100, 5000},
+                                                      {4000, 2000},  // Overlapping
+                                                      {8000, 100},
+                                                      {8100, 300},  // Adjacent
+                                                      {data.size() - 50, 100},
+                                                      {data.size() + 10, 10}};
+  auto const buffers = source->get_buffers(ranges);
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(to_string(buffers[i]), data.substr(ranges[i].first, ranges[i].second));
+  }
+  // Reads past the end are truncated
+  EXPECT_EQ(to_string(buffers[4]), data.substr(data.size() - 50));
+  EXPECT_EQ(buffers[5]->size(), 0u);
+}
+
+TEST_F(DatasourceTest, RemoteGetBuffers) {
+  auto const data = make_remote_data(5000);
+  fake_remote_source source(data, test_remote_options());
+
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {100, 300}, {250, 200}, {1000, 100}, {1100, 100}, {4950, 100}, {6000, 10}};
+  auto const buffers = source.get_buffers(ranges);
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(to_string(buffers[i]), data.substr(ranges[i].first, ranges[i].second));
+  }
+  EXPECT_EQ(to_string(buffers[4]), data.substr(4950));
+  EXPECT_EQ(buffers[5]->size(), 0u);
+
+  // Overlapping and adjacent ranges are fetched together, out-of-range ones not at all
+  std::vector<std::pair<size_t, size_t>> const expected{{100, 350}, {1000, 200}, {4950, 50}};
+  EXPECT_EQ(source.requests(), expected);
+}
@@ -305,6 +305,29 @@ TEST_F(JsonReaderTest, JsonLinesDtypeInference) {
   cudf::test::expect_columns_equal(result.tbl->get_column(2), cudf::test::strings_column_wrapper({"aa ", "  bbb"}));
 }
 
+TEST_F(JsonReaderTest, JsonLinesInferSampleRows) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += "[" + std::to_string(i) + ", " + std::to_string(i) + (i == 1 ? ".5]\n" : "]\n");
+  }
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines = true;
+  in_args.infer_sample_rows = 100;
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 1000);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::FLOAT64);
+
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   int64_wrapper(values, values + 1000, validity));
+}
+
 TEST_F(JsonReaderTest, JsonLinesFileInput) {
   const std::string fname = temp_env->get_temp_dir() + "JsonLinesFileTest.json";
   std::ofstream outfile(fname, std::ofstream::out);
@@ -411,6 +434,65 @@ TEST_F(JsonReaderTest, JsonLinesObjectsStrings) {
   cudf::test::expect_columns_equal(result.tbl->get_column(2), cudf::test::strings_column_wrapper({"aaa", "bbb"}));
 }
 
+TEST_F(JsonReaderTest, JsonLinesObjectsSelectColumns) {
+  std::string data =
+      "{\"col1\":100, \"col2\":1.1, \"col3\":\"aaa\", \"col4\":true}\n"
+      "{\"col1\":200, \"col2\":2.2, \"col3\":\"bbb\", \"col4\":false}\n";
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines = true;
+  in_args.columns = {"col3", "col1"};
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::STRING);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::INT64);
+
+  EXPECT_EQ(std::string(result.metadata.column_names[0]), "col3");
+  EXPECT_EQ(std::string(result.metadata.column_names[1]), "col1");
+
+  auto validity = cudf::test::make_counting_transform_iterator(
+      0, [](auto i) { return true; });
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), cudf::test::strings_column_wrapper({"aaa", "bbb"}));
+  cudf::test::expect_columns_equal(result.tbl->get_column(1), int64_wrapper{{100, 200}, validity});
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedObjects) {
+  std::string data =
+      "{\"a\":1, \"b\":{\"c\":2.5, \"d\":\"x\"}, \"e\":[1,2]}\n"
+      "{\"a\":2, \"b\":{\"c\":3.5, \"d\":\"y\"}, \"e\":[3]}\n";
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines = true;
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.tbl->num_columns(), 4);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::STRING);
+  EXPECT_EQ(result.tbl->get_column(3).type().id(), cudf::STRING);
+
+  EXPECT_EQ(std::string(result.metadata.column_names[0]), "a");
+  EXPECT_EQ(std::string(result.metadata.column_names[1]), "b.c");
+  EXPECT_EQ(std::string(result.metadata.column_names[2]), "b.d");
+  EXPECT_EQ(std::string(result.metadata.column_names[3]), "e");
+
+  auto validity = cudf::test::make_counting_transform_iterator(
+      0, [](auto i) { return true; });
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), int64_wrapper{{1, 2}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1), float64_wrapper{{2.5, 3.5}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(2), cudf::test::strings_column_wrapper({"x", "y"}));
+  cudf::test::expect_columns_equal(result.tbl->get_column(3), cudf::test::strings_column_wrapper({"[1,2]", "[3]"}));
+}
+
 /*
 // currently, the json reader is strict about having non-empty input.
 TEST_F(JsonReaderTest, EmptyFile) {
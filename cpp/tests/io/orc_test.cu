@@ -20,13 +20,21 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 
+#include <arrow/io/api.h>
+
+#include <algorithm>
+#include <fstream>
 #include <type_traits>
 
 namespace cudf_io = cudf::experimental::io;
@@ -404,6 +412,30 @@ TEST_F(OrcWriterTest, Strings) {
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, RewrittenFile) {
+  auto filepath = temp_env->get_temp_filepath("OrcRewrittenFile.orc");
+  for (const size_t num_rows : {100, 300}) {
+    auto sequence = random_values<int>(num_rows);
+    auto validity = cudf::test::make_counting_transform_iterator(
+        0, [](auto i) { return true; });
+    column_wrapper<int> col{sequence.begin(), sequence.end(), validity};
+
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col.release());
+    auto expected = std::make_unique<table>(std::move(cols));
+
+    cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+    cudf_io::write_orc(out_args);
+
+    // Reading a file again after rewriting it must not use its cached footer
+    cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+    in_args.use_index = false;
+    auto result = cudf_io::read_orc(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+
 TEST_F(OrcWriterTest, HostBuffer) {
   constexpr auto num_rows = 100 << 10;
   const auto seq_col = random_values<int>(num_rows);
@@ -433,6 +465,325 @@ TEST_F(OrcWriterTest, HostBuffer) {
 }
 
 
+// custom data sink that supports device writes. uses plain file io.
+class custom_test_data_sink : public cudf::io::data_sink {
+public:
+  explicit custom_test_data_sink(std::string const& filepath){
+    outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+    CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+  }
+
+  virtual ~custom_test_data_sink() {
+    flush();
+  }
+
+  void host_write(void const* data, size_t size) override {
+    outfile_.write(reinterpret_cast<char const*>(data), size);
+  }
+
+  bool supports_device_write() const override {
+    return true;
+  }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override {
+    std::vector<char> host_data(size);
+    CUDA_TRY(cudaMemcpyAsync(host_data.data(), gpu_data, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    outfile_.write(host_data.data(), size);
+  }
+
+  void flush() override {
+    outfile_.flush();
+  }
+
+  size_t bytes_written() override {
+    return outfile_.tellp();
+  }
+
+private:
+  std::ofstream outfile_;
+};
+
+TEST_F(OrcWriterTest, CustomDataSink) {
+  auto filepath = temp_env->get_temp_filepath("OrcCustomDataSink.orc");
+
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(5, 10000, true);
+
+  for (auto comp : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    {
+      custom_test_data_sink custom_sink(filepath);
+      cudf_io::write_orc_args out_args{cudf_io::sink_info(&custom_sink), expected->view()};
+      out_args.compression = comp;
+      cudf_io::write_orc(out_args);
+    }
+
+    cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+    auto result = cudf_io::read_orc(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+TEST_F(OrcWriterTest, PinnedHostBuffer) {
+  constexpr auto num_rows = 100 << 10;
+  const auto random_col   = random_values<int64_t>(num_rows);
+  column_wrapper<int64_t> col{random_col.begin(), random_col.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  cudf_io::write_orc(out_args);
+
+  // The stripes are copied straight from the pinned buffer, without staging
+  char* pinned = nullptr;
+  ASSERT_EQ(cudaSuccess, cudaMallocHost(&pinned, out_buffer.size()));
+  std::copy(out_buffer.begin(), out_buffer.end(), pinned);
+  cudf_io::read_orc_args in_args{cudf_io::source_info(pinned, out_buffer.size())};
+  const auto result = cudf_io::read_orc(in_args);
+  EXPECT_EQ(cudaSuccess, cudaFreeHost(pinned));
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, Lz4Compression) {
+  constexpr auto num_rows = 100 << 10;
+  auto repeated = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  const auto random_col = random_values<int64_t>(num_rows);
+  column_wrapper<int> col0{repeated, repeated + num_rows, validity};
+  column_wrapper<int64_t> col1{random_col.begin(), random_col.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  out_args.compression = cudf_io::compression_type::LZ4;
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  const auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, StripeSize) {
+  constexpr auto num_rows = 100 << 10;
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 11; });
+  const auto random_col = random_values<double>(num_rows);
+  column_wrapper<int> col0{sequence, sequence + num_rows, validity};
+  column_wrapper<double> col1{random_col.begin(), random_col.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto comp : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+    out_args.compression      = comp;
+    out_args.stripe_size_rows = 20000;
+    out_args.row_index_stride = 5000;
+    cudf_io::write_orc(out_args);
+
+    cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_orc(in_args);
+    expect_tables_equal(expected->view(), result.tbl->view());
+
+    // Each stripe holds at most the requested number of rows
+    in_args.stripe = 1;
+    const auto stripe = cudf_io::read_orc(in_args);
+    EXPECT_EQ(20000, stripe.tbl->num_rows());
+
+    // Seeking uses the finer-grained row index
+    in_args.stripe    = -1;
+    in_args.skip_rows = 45000;
+    in_args.num_rows  = 100;
+    const auto sliced   = cudf_io::read_orc(in_args);
+    auto expected_slice = cudf::experimental::slice(expected->view(), {45000, 45100}).front();
+    expect_tables_equal(expected_slice, sliced.tbl->view());
+  }
+}
+
+TEST_F(OrcWriterTest, StripePipeline) {
+  constexpr auto num_rows    = 100000;
+  constexpr auto stripe_rows = 20000;
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 13; });
+  const auto random_col = random_values<int64_t>(num_rows);
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) { strings[i] = "str" + std::to_string(i % 1777); }
+  column_wrapper<int> col0{sequence, sequence + num_rows, validity};
+  column_wrapper<int64_t> col1{random_col.begin(), random_col.end()};
+  cudf::test::strings_column_wrapper col2(strings.begin(), strings.end(), validity);
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto comp : {cudf_io::compression_type::SNAPPY, cudf_io::compression_type::LZ4}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+    out_args.compression      = comp;
+    out_args.stripe_size_rows = stripe_rows;
+    cudf_io::write_orc(out_args);
+
+    // The stripes are decompressed while the next ones are read
+    cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    const auto result = cudf_io::read_orc(in_args);
+    expect_tables_equal(expected->view(), result.tbl->view());
+
+    // Reading the stripes one at a time goes through a single pipeline stage
+    std::vector<std::unique_ptr<table>> stripes;
+    std::vector<table_view> stripe_views;
+    for (int i = 0; i < num_rows / stripe_rows; ++i) {
+      in_args.stripe = i;
+      stripes.push_back(cudf_io::read_orc(in_args).tbl);
+      stripe_views.push_back(stripes.back()->view());
+    }
+    const auto unpipelined = cudf::experimental::concatenate(stripe_views);
+    expect_tables_equal(unpipelined->view(), result.tbl->view());
+  }
+}
+
+TEST_F(OrcWriterTest, SelectedColumns) {
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(40, 50000, true);
+
+  for (auto comp : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    std::vector<char> out_buffer;
+    cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+    out_args.compression      = comp;
+    out_args.stripe_size_rows = 20000;
+    out_args.row_index_stride = 5000;
+    cudf_io::write_orc(out_args);
+
+    // Only the streams of the selected columns are read, with and without the row index
+    for (bool use_index : {false, true}) {
+      cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+      in_args.columns   = {"_col3", "_col17", "_col39"};
+      in_args.use_index = use_index;
+      const auto result = cudf_io::read_orc(in_args);
+      expect_tables_equal(expected->select({3, 17, 39}), result.tbl->view());
+    }
+  }
+}
+
+// Arrow file over a host buffer, counting the bytes read from it
+class recording_file : public arrow::io::RandomAccessFile {
+ public:
+  explicit recording_file(std::vector<char> const& data)
+    : reader_(std::make_shared<arrow::io::BufferReader>(
+        reinterpret_cast<const uint8_t*>(data.data()), data.size())) {}
+
+  using arrow::io::RandomAccessFile::ReadAt;
+
+  arrow::Status ReadAt(int64_t position,
+                       int64_t nbytes,
+                       std::shared_ptr<arrow::Buffer>* out) override {
+    bytes_read += nbytes;
+    return reader_->ReadAt(position, nbytes, out);
+  }
+
+  arrow::Status Close() override { return reader_->Close(); }
+  arrow::Status Tell(int64_t* position) const override { return reader_->Tell(position); }
+  bool closed() const override { return reader_->closed(); }
+  arrow::Status Seek(int64_t position) override { return reader_->Seek(position); }
+  arrow::Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return reader_->Read(nbytes, bytes_read, out);
+  }
+  arrow::Status Read(int64_t nbytes, std::shared_ptr<arrow::Buffer>* out) override {
+    return reader_->Read(nbytes, out);
+  }
+  arrow::Status GetSize(int64_t* size) override { return reader_->GetSize(size); }
+
+  size_t bytes_read = 0;
+
+ private:
+  std::shared_ptr<arrow::io::BufferReader> reader_;
+};
+
+TEST_F(OrcWriterTest, VectoredStripeReads) {
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(40, 50000, true);
+
+  auto filepath = temp_env->get_temp_filepath("OrcVectoredStripeReads.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.compression      = cudf_io::compression_type::SNAPPY;
+  out_args.stripe_size_rows = 20000;
+  cudf_io::write_orc(out_args);
+
+  std::ifstream infile(filepath, std::ios::binary);
+  std::vector<char> file_data((std::istreambuf_iterator<char>(infile)),
+                              std::istreambuf_iterator<char>());
+
+  // The streams of the selected columns in each stripe are requested in one
+  // call, from a memory-mapped file (that prefetches them) and an Arrow file
+  auto file = std::make_shared<recording_file>(file_data);
+  for (auto const& source : {cudf_io::source_info{filepath}, cudf_io::source_info{file}}) {
+    cudf_io::read_orc_args in_args{source};
+    in_args.columns   = {"_col1", "_col2", "_col20", "_col38"};
+    const auto result = cudf_io::read_orc(in_args);
+    expect_tables_equal(expected->select({1, 2, 20, 38}), result.tbl->view());
+  }
+
+  // Only the ranges of the selected streams were read
+  EXPECT_GT(file->bytes_read, 0u);
+  EXPECT_LT(file->bytes_read, file_data.size() / 4);
+}
+
+TEST_F(OrcWriterTest, InvalidRowIndexStride) {
+  auto expected = create_random_fixed_table<int>(1, 100, false);
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected->view()};
+  out_args.row_index_stride = 1001;
+  EXPECT_THROW(cudf_io::write_orc(out_args), cudf::logic_error);
+}
+
+TEST_F(OrcWriterTest, ReadAsync) {
+  srand(31337);
+  auto first  = create_random_fixed_table<int>(4, 20000, true);
+  auto second = create_random_fixed_table<int>(2, 30000, false);
+
+  auto filepath = temp_env->get_temp_filepath("OrcReadAsync.orc");
+  cudf_io::write_orc_args first_out_args{cudf_io::sink_info{filepath}, first->view()};
+  first_out_args.stripe_size_rows = 5000;
+  cudf_io::write_orc(first_out_args);
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args second_out_args{cudf_io::sink_info(&out_buffer), second->view()};
+  cudf_io::write_orc(second_out_args);
+
+  cudf_io::read_orc_args first_args{cudf_io::source_info{filepath}};
+  first_args.columns = {"_col0", "_col3"};
+  cudf_io::read_orc_args second_args{cudf_io::source_info{out_buffer.data(), out_buffer.size()}};
+
+  auto first_result       = cudf_io::read_orc_async(first_args);
+  auto second_result      = cudf_io::read_orc_async(second_args);
+  auto const second_table = second_result.get();
+  auto const first_table  = first_result.get();
+
+  expect_tables_equal(cudf_io::read_orc(first_args).tbl->view(), first_table.tbl->view());
+  expect_tables_equal(cudf_io::read_orc(second_args).tbl->view(), second_table.tbl->view());
+  EXPECT_EQ(first_table.metadata.column_names,
+            std::vector<std::string>({"_col0", "_col3"}));
+
+  // The errors of the read are rethrown by the future
+  cudf_io::read_orc_args missing{
+    cudf_io::source_info{temp_env->get_temp_dir() + "OrcReadAsyncMissing.orc"}};
+  auto missing_result = cudf_io::read_orc_async(missing);
+  EXPECT_ANY_THROW(missing_result.get());
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -551,6 +902,39 @@ TEST_F(OrcChunkedWriterTest, Strings)
   expect_tables_equal(*result.tbl, *expected);      
 }
 
+TEST_F(OrcChunkedWriterTest, StringsToDictionary)
+{
+  // Each stripe has its own dictionary, with some keys in common
+  std::vector<const char*> strings1{"Monday", "Friday", "Monday", "Sunday", "Friday", "Monday"};
+  std::vector<const char*> strings2{"Sunday", "Tuesday", "Sunday", "Tuesday", "Friday", "Sunday"};
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 3; });
+  column_wrapper<cudf::string_view> col1{strings1.begin(), strings1.end(), validity};
+  column_wrapper<cudf::string_view> col2{strings2.begin(), strings2.end(), validity};
+  table_view tbl1({col1});
+  table_view tbl2({col2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStringsToDictionary.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(tbl1, state);
+  cudf_io::write_orc_chunked(tbl2, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.strings_to_dictionary = true;
+  auto result                     = cudf_io::read_orc(read_args);
+  ASSERT_EQ(result.tbl->view().column(0).type().id(), cudf::type_id::DICTIONARY32);
+
+  cudf::dictionary_column_view dictionary(result.tbl->view().column(0));
+  column_wrapper<cudf::string_view> expected_keys{"Friday", "Monday", "Sunday", "Tuesday"};
+  cudf::test::expect_columns_equal(dictionary.keys(), expected_keys);
+
+  auto expected = cudf::experimental::concatenate({tbl1, tbl2});
+  auto decoded  = cudf::dictionary::decode(dictionary);
+  cudf::test::expect_columns_equal(decoded->view(), expected->view().column(0));
+}
+
 TEST_F(OrcChunkedWriterTest, MismatchedTypes)
 {         
   srand(31337);
@@ -601,6 +985,96 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
   expect_tables_equal(*result.tbl, *full_table);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadStripesFiltered)
+{
+  // Each chunk becomes a stripe with a disjoint [min, max] range
+  auto low_values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  column_wrapper<int> low_col(low_values, low_values + 10);
+  column_wrapper<int> high_col(high_values, high_values + 10);
+  table_view low_table({low_col});
+  table_view high_table({high_col});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesFiltered.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  cudf_io::write_orc_chunked(low_table, state);
+  cudf_io::write_orc_chunked(high_table, state);
+  cudf_io::write_orc_chunked(low_table, state);
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.filters = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 100}};
+  auto result       = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, high_table);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::LESS, 5}};
+  result            = cudf_io::read_orc(read_args);
+  auto expected     = cudf::experimental::concatenate({low_table, low_table});
+  expect_tables_equal(*result.tbl, *expected);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 50}};
+  result            = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filters = {{"missing", cudf_io::predicate_op::EQUAL, 0}};
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcWriterTest, ReadRowsFilteredStripes)
+{
+  // Sorted values in stripes of 10000 rows, each with two row groups of the row index
+  constexpr auto num_rows = 50000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int> col(values, values + num_rows);
+  table_view expected({col});
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), expected};
+  out_args.stripe_size_rows = 10000;
+  out_args.row_index_stride = 5000;
+  cudf_io::write_orc(out_args);
+
+  for (bool use_index : {false, true}) {
+    cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+    in_args.use_index = use_index;
+    in_args.filters   = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 20000}};
+
+    // The range starts in the middle of the second remaining stripe and ends in the third
+    in_args.skip_rows = 17500;
+    in_args.num_rows  = 5000;
+    auto result       = cudf_io::read_orc(in_args);
+    auto sliced       = cudf::experimental::slice(expected, {37500, 42500});
+    expect_tables_equal(*result.tbl, sliced[0]);
+
+    // A range aligned with a stripe of the file can seek with the row index
+    in_args.skip_rows = 10000;
+    in_args.num_rows  = 12000;
+    result            = cudf_io::read_orc(in_args);
+    sliced            = cudf::experimental::slice(expected, {30000, 42000});
+    expect_tables_equal(*result.tbl, sliced[0]);
+
+    // Only the stripes in the middle of the file remain
+    in_args.filters   = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 15000},
+                       {"_col0", cudf_io::predicate_op::LESS, 25000}};
+    in_args.skip_rows = 15000;
+    in_args.num_rows  = -1;
+    result            = cudf_io::read_orc(in_args);
+    sliced            = cudf::experimental::slice(expected, {25000, 30000});
+    expect_tables_equal(*result.tbl, sliced[0]);
+
+    in_args.skip_rows = 20001;
+    EXPECT_THROW(cudf_io::read_orc(in_args), cudf::logic_error);
+
+    // Stripe selections are filtered, without applying a row range
+    in_args.skip_rows   = -1;
+    in_args.stripe_list = {0, 2, 4};
+    result              = cudf_io::read_orc(in_args);
+    sliced              = cudf::experimental::slice(expected, {20000, 30000});
+    expect_tables_equal(*result.tbl, sliced[0]);
+  }
+}
+
 TEST_F(OrcChunkedWriterTest, ReadStripesError)
 {
   srand(31337);
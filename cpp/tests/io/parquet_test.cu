@@ -20,15 +20,25 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/data_sink.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <map>
 #include <type_traits>
 
 namespace cudf_io = cudf::experimental::io;
@@ -86,6 +96,70 @@ std::unique_ptr<cudf::experimental::table> create_compressible_fixed_table(cudf:
   return create_fixed_table<T>(num_columns, num_rows, include_validity, compressible_elements);
 }
 
+// Null mask of a nested column built from the validity of each row
+std::pair<rmm::device_buffer, cudf::size_type> make_validity(std::vector<bool> const& validity)
+{
+  if (validity.empty()) { return {rmm::device_buffer{}, 0}; }
+  std::vector<int32_t> zeros(validity.size(), 0);
+  auto mask_column =
+    cudf::test::fixed_width_column_wrapper<int32_t>(zeros.begin(), zeros.end(), validity.begin())
+      .release();
+  auto null_count = mask_column->null_count();
+  return {std::move(*(mask_column->release().null_mask)), null_count};
+}
+
+// Builds a lists column from its offsets and child
+std::unique_ptr<cudf::column> make_lists(std::vector<int32_t> const& offsets,
+                                         std::unique_ptr<cudf::column> child,
+                                         std::vector<bool> const& validity = {})
+{
+  auto mask = make_validity(validity);
+  return cudf::make_lists_column(
+    static_cast<cudf::size_type>(offsets.size() - 1),
+    cudf::test::fixed_width_column_wrapper<int32_t>(offsets.begin(), offsets.end()).release(),
+    std::move(child),
+    mask.second,
+    std::move(mask.first));
+}
+
+// Builds a structs column from its fields
+std::unique_ptr<cudf::column> make_structs(std::vector<std::unique_ptr<cudf::column>>&& children,
+                                           std::vector<bool> const& validity = {})
+{
+  auto const rows = children.front()->size();
+  auto mask       = make_validity(validity);
+  return cudf::make_structs_column(
+    rows, std::move(children), mask.second, std::move(mask.first));
+}
+
+// Compares columns that may be nested, which expect_columns_equal does not support
+void expect_nested_equal(cudf::column_view const& lhs, cudf::column_view const& rhs)
+{
+  ASSERT_EQ(lhs.type().id(), rhs.type().id());
+  ASSERT_EQ(lhs.size(), rhs.size());
+  EXPECT_EQ(lhs.null_count(), rhs.null_count());
+  if (lhs.size() == 0) { return; }
+  if (lhs.type().id() == cudf::LIST) {
+    cudf::test::expect_columns_equal(*cudf::experimental::is_valid(lhs),
+                                     *cudf::experimental::is_valid(rhs));
+    cudf::lists_column_view lhs_lists(lhs);
+    cudf::lists_column_view rhs_lists(rhs);
+    cudf::test::expect_columns_equal(lhs_lists.offsets(), rhs_lists.offsets());
+    expect_nested_equal(lhs_lists.child(), rhs_lists.child());
+  } else if (lhs.type().id() == cudf::STRUCT) {
+    cudf::test::expect_columns_equal(*cudf::experimental::is_valid(lhs),
+                                     *cudf::experimental::is_valid(rhs));
+    cudf::structs_column_view lhs_structs(lhs);
+    cudf::structs_column_view rhs_structs(rhs);
+    ASSERT_EQ(lhs_structs.num_children(), rhs_structs.num_children());
+    for (cudf::size_type i = 0; i < lhs_structs.num_children(); ++i) {
+      expect_nested_equal(lhs_structs.sliced_child(i), rhs_structs.sliced_child(i));
+    }
+  } else {
+    cudf::test::expect_columns_equal(lhs, rhs);
+  }
+}
+
 // Base test fixture for tests
 struct ParquetWriterTest : public cudf::test::BaseFixture {};
 
@@ -412,6 +486,66 @@ TEST_F(ParquetWriterTest, Strings) {
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, StringsWithNullsAndEmptyStrings)
+{
+  constexpr auto num_rows = 1000;
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    strings[i] = (i % 7 == 0) ? "" : "string_" + std::to_string(i * 31 % 97);
+  }
+  std::vector<std::string> empty_strings(num_rows);
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  column_wrapper<cudf::string_view> col0{strings.begin(), strings.end(), validity};
+  column_wrapper<cudf::string_view> col1{empty_strings.begin(), empty_strings.end()};
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("StringsWithNullsAndEmptyStrings.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected, result.tbl->view());
+
+  in_args.skip_rows = 123;
+  in_args.num_rows  = 456;
+  result            = cudf_io::read_parquet(in_args);
+  expect_tables_equal(cudf::experimental::slice(expected, {123, 579})[0], result.tbl->view());
+}
+
+TEST_F(ParquetChunkedWriterTest, StringsToDictionary)
+{
+  // Each row group has its own dictionary, with some keys in common
+  std::vector<const char*> strings1{"Monday", "Friday", "Monday", "Sunday", "Friday", "Monday"};
+  std::vector<const char*> strings2{"Sunday", "Tuesday", "Sunday", "Tuesday", "Friday", "Sunday"};
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 3; });
+  column_wrapper<cudf::string_view> col1{strings1.begin(), strings1.end(), validity};
+  column_wrapper<cudf::string_view> col2{strings2.begin(), strings2.end(), validity};
+  table_view tbl1({col1});
+  table_view tbl2({col2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStringsToDictionary.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(tbl1, state);
+  cudf_io::write_parquet_chunked(tbl2, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.strings_to_dictionary = true;
+  auto result                     = cudf_io::read_parquet(read_args);
+  ASSERT_EQ(result.tbl->view().column(0).type().id(), cudf::type_id::DICTIONARY32);
+
+  cudf::dictionary_column_view dictionary(result.tbl->view().column(0));
+  column_wrapper<cudf::string_view> expected_keys{"Friday", "Monday", "Sunday", "Tuesday"};
+  cudf::test::expect_columns_equal(dictionary.keys(), expected_keys);
+
+  auto expected = cudf::experimental::concatenate({tbl1, tbl2});
+  auto decoded  = cudf::dictionary::decode(dictionary);
+  cudf::test::expect_columns_equal(decoded->view(), expected->view().column(0));
+}
+
 TEST_F(ParquetWriterTest, MultiIndex) {
   constexpr auto num_rows = 100;
 
@@ -487,6 +621,120 @@ TEST_F(ParquetWriterTest, HostBuffer) {
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, Lz4Compression) {
+  constexpr auto num_rows = 100 << 10;
+  auto repeated = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  const auto random_col = random_values<int64_t>(num_rows);
+  column_wrapper<int> col0{repeated, repeated + num_rows, validity};
+  column_wrapper<int64_t> col1{random_col.begin(), random_col.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       nullptr,
+                                       cudf_io::compression_type::LZ4};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  const auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, DictionaryCardinality) {
+  constexpr auto num_rows = 50000;
+  std::vector<std::string> low_card(num_rows);
+  std::vector<std::string> high_card(num_rows);
+  std::vector<std::string> mixed_card(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    low_card[i]   = "day_" + std::to_string(i % 7);
+    high_card[i]  = "id_" + std::to_string(i * 7919);
+    mixed_card[i] = (i < num_rows / 2) ? low_card[i] : high_card[i];
+  }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto repeated = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 300; });
+  column_wrapper<cudf::string_view> col0{low_card.begin(), low_card.end(), validity};
+  column_wrapper<cudf::string_view> col1{high_card.begin(), high_card.end()};
+  column_wrapper<cudf::string_view> col2{mixed_card.begin(), mixed_card.end()};
+  column_wrapper<int64_t> col3{repeated, repeated + num_rows, validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info(&out_buffer), expected->view(), nullptr};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  const auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, DeltaEncoding) {
+  constexpr auto num_rows = 60000;
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) { strings[i] = "key_" + std::to_string(i * 7919); }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto sorted   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return int64_t{1577836800000} + i * 1000 + (i % 3); });
+  auto random32 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(std::rand() - RAND_MAX / 2); });
+  auto random16 = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int16_t>(std::rand()); });
+  column_wrapper<int64_t> col0{sorted, sorted + num_rows};
+  column_wrapper<int32_t> col1{random32, random32 + num_rows, validity};
+  column_wrapper<int16_t> col2{random16, random16 + num_rows};
+  column_wrapper<cudf::string_view> col3{strings.begin(), strings.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       nullptr,
+                                       cudf_io::compression_type::NONE};
+  out_args.enable_delta_encoding = true;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  const auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+
+  // The sorted column shrinks with DELTA_BINARY_PACKED
+  std::vector<char> plain_buffer, delta_buffer;
+  table_view sorted_table({expected->get_column(0).view()});
+  cudf_io::write_parquet_args plain_args{cudf_io::sink_info(&plain_buffer),
+                                         sorted_table,
+                                         nullptr,
+                                         cudf_io::compression_type::NONE};
+  cudf_io::write_parquet(plain_args);
+  cudf_io::write_parquet_args delta_args{cudf_io::sink_info(&delta_buffer),
+                                         sorted_table,
+                                         nullptr,
+                                         cudf_io::compression_type::NONE};
+  delta_args.enable_delta_encoding = true;
+  cudf_io::write_parquet(delta_args);
+  EXPECT_LT(delta_buffer.size() * 3, plain_buffer.size());
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -781,6 +1029,653 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, WideFooter)
+{
+  // Enough column chunks for the row groups of the footer to be parsed by several threads
+  srand(31337);
+  constexpr auto num_row_groups = 40;
+  auto table1                   = create_random_fixed_table<int>(100, 10, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedWideFooter.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (int i = 0; i < num_row_groups; ++i) { cudf_io::write_parquet_chunked(*table1, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  std::vector<table_view> tables(num_row_groups, *table1);
+  auto expected = cudf::experimental::concatenate(tables);
+  expect_tables_equal(*result.tbl, *expected);
+
+  read_args.row_group_list = {num_row_groups - 1};
+  result                   = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *table1);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsFiltered)
+{
+  // Each chunk becomes a row group with a disjoint [min, max] range
+  auto low_values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  column_wrapper<int> low_col(low_values, low_values + 10);
+  column_wrapper<int> high_col(high_values, high_values + 10);
+  table_view low_table({low_col});
+  table_view high_table({high_col});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupsFiltered.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(low_table, state);
+  cudf_io::write_parquet_chunked(high_table, state);
+  cudf_io::write_parquet_chunked(low_table, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filters = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 100}};
+  auto result       = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, high_table);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::LESS, 5}};
+  result            = cudf_io::read_parquet(read_args);
+  auto expected     = cudf::experimental::concatenate({low_table, low_table});
+  expect_tables_equal(*result.tbl, *expected);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 50}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // Row ranges are applied to the rows of the remaining row groups, not of the file
+  read_args.filters   = {{"_col0", cudf_io::predicate_op::LESS_EQUAL, 9.5}};
+  read_args.skip_rows = 5;
+  read_args.num_rows  = 10;
+  result              = cudf_io::read_parquet(read_args);
+  auto sliced         = cudf::experimental::slice(*expected, {5, 15});
+  expect_tables_equal(*result.tbl, sliced[0]);
+
+  read_args.skip_rows = 12;
+  read_args.num_rows  = -1;
+  result              = cudf_io::read_parquet(read_args);
+  sliced              = cudf::experimental::slice(*expected, {12, 20});
+  expect_tables_equal(*result.tbl, sliced[0]);
+
+  // The first row group of the file is skipped, so the range starts in the second one
+  read_args.filters   = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 100}};
+  read_args.skip_rows = 3;
+  read_args.num_rows  = 4;
+  result              = cudf_io::read_parquet(read_args);
+  sliced              = cudf::experimental::slice(high_table, {3, 7});
+  expect_tables_equal(*result.tbl, sliced[0]);
+
+  read_args.skip_rows = 11;
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+  read_args.skip_rows = -1;
+  read_args.num_rows  = -1;
+
+  read_args.filters = {{"missing", cudf_io::predicate_op::EQUAL, 0}};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsBloomFiltered)
+{
+  // Both row groups span the same [min, max] range, so only Bloom filters can tell them apart
+  constexpr auto num_rows = 100;
+  std::vector<std::string> even_strings(num_rows), odd_strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    even_strings[i] = "key_" + std::to_string(2 * i);
+    odd_strings[i]  = "key_" + std::to_string(2 * i + 1);
+  }
+  auto even_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t{2} * i; });
+  auto odd_values =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return int64_t{2} * i + 1; });
+  column_wrapper<int64_t> even_col0(even_values, even_values + num_rows);
+  column_wrapper<int64_t> odd_col0(odd_values, odd_values + num_rows);
+  column_wrapper<cudf::string_view> even_col1(even_strings.begin(), even_strings.end());
+  column_wrapper<cudf::string_view> odd_col1(odd_strings.begin(), odd_strings.end());
+  table_view even_table({even_col0, even_col1});
+  table_view odd_table({odd_col0, odd_col1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupsBloomFiltered.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  args.bloom_filter_columns = {"_col0", "_col1"};
+  auto state                = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(even_table, state);
+  cudf_io::write_parquet_chunked(odd_table, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  auto full   = cudf::experimental::concatenate({even_table, odd_table});
+  expect_tables_equal(*result.tbl, *full);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 51}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, odd_table);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 150}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, even_table);
+
+  read_args.filters = {{"_col1", cudf_io::predicate_op::EQUAL, std::string("key_1000")}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // Range predicates are not affected by Bloom filters
+  read_args.filters = {{"_col0", cudf_io::predicate_op::GREATER, 51}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *full);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadRowsFiltered)
+{
+  constexpr auto num_rows = 30;
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) { strings[i] = "str_" + std::to_string(i); }
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int> col0(values, values + num_rows);
+  column_wrapper<cudf::string_view> col1(strings.begin(), strings.end());
+  table_view full_table({col0, col1});
+  auto tables = cudf::experimental::slice(full_table, {0, 10, 10, 20, 20, 30});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowsFiltered.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (const auto& tbl : tables) { cudf_io::write_parquet_chunked(tbl, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  // Only the matching rows of the row groups that may contain them are returned
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filters     = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 15},
+                           {"_col0", cudf_io::predicate_op::LESS, 25}};
+  read_args.filter_rows = true;
+  auto result           = cudf_io::read_parquet(read_args);
+  auto expected         = cudf::experimental::slice(full_table, {15, 25});
+  expect_tables_equal(*result.tbl, expected[0]);
+
+  read_args.filters = {{"_col1", cudf_io::predicate_op::EQUAL, std::string("str_12")}};
+  result            = cudf_io::read_parquet(read_args);
+  expected          = cudf::experimental::slice(full_table, {12, 13});
+  expect_tables_equal(*result.tbl, expected[0]);
+
+  // Filter columns need not be selected
+  read_args.columns = {"_col1"};
+  read_args.filters = {{"_col0", cudf_io::predicate_op::LESS, 3}};
+  result            = cudf_io::read_parquet(read_args);
+  auto expected_col = cudf::experimental::slice(col1, {0, 3});
+  expect_tables_equal(*result.tbl, table_view({expected_col[0]}));
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 100}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filters = {{"_col1", cudf_io::predicate_op::EQUAL, 1}};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, BloomFilterColumnNotFound)
+{
+  column_wrapper<int> col{1, 2, 3};
+  table_view tbl({col});
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), tbl};
+  out_args.bloom_filter_columns = {"missing"};
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, ReadAsync)
+{
+  srand(31337);
+  auto first  = create_random_fixed_table<int>(4, 20000, true);
+  auto second = create_random_fixed_table<int>(2, 30000, false);
+
+  auto filepath = temp_env->get_temp_filepath("ParquetReadAsync.parquet");
+  cudf_io::write_parquet_args first_out_args{cudf_io::sink_info{filepath}, first->view()};
+  cudf_io::write_parquet(first_out_args);
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args second_out_args{cudf_io::sink_info(&out_buffer), second->view()};
+  cudf_io::write_parquet(second_out_args);
+
+  cudf_io::read_parquet_args first_args{cudf_io::source_info{filepath}};
+  first_args.skip_rows = 5000;
+  first_args.num_rows  = 10000;
+  cudf_io::read_parquet_args second_args{
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()}};
+
+  auto first_result       = cudf_io::read_parquet_async(first_args);
+  auto second_result      = cudf_io::read_parquet_async(second_args);
+  auto const second_table = second_result.get();
+  auto const first_table  = first_result.get();
+
+  EXPECT_EQ(first_table.tbl->num_rows(), 10000);
+  expect_tables_equal(cudf_io::read_parquet(first_args).tbl->view(), first_table.tbl->view());
+  expect_tables_equal(cudf_io::read_parquet(second_args).tbl->view(), second_table.tbl->view());
+
+  // The errors of the read are rethrown by the future
+  cudf_io::read_parquet_args missing{
+    cudf_io::source_info{temp_env->get_temp_dir() + "ParquetReadAsyncMissing.parquet"}};
+  auto missing_result = cudf_io::read_parquet_async(missing);
+  EXPECT_ANY_THROW(missing_result.get());
+}
+
+TEST_F(ParquetChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 1000, true);
+  auto table2 = create_random_fixed_table<int>(4, 3000, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*table1, state);
+  cudf_io::write_parquet_chunked(*table2, state);
+  cudf_io::write_parquet_chunked_end(state);
+  auto full_table = cudf::experimental::concatenate({*table1, *table2});
+
+  // Each chunk holds at most ~1000 rows of four int32 columns
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  cudf_io::chunked_parquet_reader reader(read_args, 1000 * 4 * sizeof(int));
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    EXPECT_LE(chunks.back()->num_rows(), 1000);
+  }
+  EXPECT_EQ(chunks.size(), 4u);
+  EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  auto result = cudf::experimental::concatenate(views);
+  expect_tables_equal(*result, *full_table);
+}
+
+TEST_F(ParquetChunkedWriterTest, ChunkedReadFiltered)
+{
+  // Each chunk becomes a row group with a disjoint [min, max] range
+  auto low_values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto high_values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i + 100; });
+  column_wrapper<int> low_col(low_values, low_values + 10);
+  column_wrapper<int> high_col(high_values, high_values + 10);
+  table_view low_table({low_col});
+  table_view high_table({high_col});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadFiltered.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(low_table, state);
+  cudf_io::write_parquet_chunked(high_table, state);
+  cudf_io::write_parquet_chunked(low_table, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_chunks = [&](cudf_io::read_parquet_args const& read_args) {
+    // Each chunk holds at most 8 rows of an int32 column
+    cudf_io::chunked_parquet_reader reader(read_args, 8 * sizeof(int));
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+      EXPECT_LE(chunks.back()->num_rows(), 8);
+    }
+    return chunks;
+  };
+  auto concatenate_chunks = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+    return cudf::experimental::concatenate(views);
+  };
+
+  // The first row group of the file is skipped
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filters = {{"_col0", cudf_io::predicate_op::GREATER_EQUAL, 100}};
+  auto chunks       = read_chunks(read_args);
+  EXPECT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*concatenate_chunks(chunks), high_table);
+
+  // The second chunk spans the end of the first row group and the start of the last one
+  read_args.filters = {{"_col0", cudf_io::predicate_op::LESS, 5}};
+  chunks            = read_chunks(read_args);
+  EXPECT_EQ(chunks.size(), 3u);
+  auto expected = cudf::experimental::concatenate({low_table, low_table});
+  expect_tables_equal(*concatenate_chunks(chunks), *expected);
+
+  read_args.filter_rows = true;
+  chunks                = read_chunks(read_args);
+  EXPECT_EQ(chunks.size(), 3u);
+  auto low_rows = cudf::experimental::slice(low_table, {0, 5});
+  expected      = cudf::experimental::concatenate({low_rows[0], low_rows[0]});
+  expect_tables_equal(*concatenate_chunks(chunks), *expected);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 50}};
+  chunks            = read_chunks(read_args);
+  EXPECT_EQ(chunks.size(), 0u);
+}
+
+TEST_F(ParquetWriterTest, MultiFileDataset)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 1000, true);
+  auto table2 = create_random_fixed_table<int>(5, 3000, true);
+
+  auto filepath1 = temp_env->get_temp_filepath("MultiFileDataset1.parquet");
+  auto filepath2 = temp_env->get_temp_filepath("MultiFileDataset2.parquet");
+  std::vector<char> buffer;
+  cudf_io::write_parquet(cudf_io::write_parquet_args{cudf_io::sink_info{filepath1}, *table1});
+  cudf_io::write_parquet(cudf_io::write_parquet_args{cudf_io::sink_info{filepath2}, *table2});
+  cudf_io::write_parquet(cudf_io::write_parquet_args{cudf_io::sink_info{&buffer}, *table1});
+
+  std::vector<cudf_io::source_info> sources{cudf_io::source_info{filepath1},
+                                            cudf_io::source_info{buffer.data(), buffer.size()},
+                                            cudf_io::source_info{filepath2}};
+  cudf_io::read_parquet_args read_args{sources};
+  auto result   = cudf_io::read_parquet(read_args);
+  auto expected = cudf::experimental::concatenate({*table1, *table1, *table2});
+  expect_tables_equal(*result.tbl, *expected);
+
+  // Row groups are numbered across all sources; file footers are now cached
+  read_args.row_group_list = {2, 0};
+  result                   = cudf_io::read_parquet(read_args);
+  expected                 = cudf::experimental::concatenate({*table2, *table1});
+  expect_tables_equal(*result.tbl, *expected);
+
+  // Rewriting a file invalidates its cached footer
+  cudf_io::write_parquet(cudf_io::write_parquet_args{cudf_io::sink_info{filepath1}, *table2});
+  read_args.row_group_list = {0};
+  result                   = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *table2);
+
+  // All sources must have the same schema
+  auto float_table = create_random_fixed_table<float>(5, 1000, true);
+  auto float_file  = temp_env->get_temp_filepath("MultiFileDatasetFloat.parquet");
+  cudf_io::write_parquet(cudf_io::write_parquet_args{cudf_io::sink_info{float_file}, *float_table});
+  std::vector<cudf_io::source_info> mismatched_sources{cudf_io::source_info{filepath2},
+                                                       cudf_io::source_info{float_file}};
+  cudf_io::read_parquet_args mismatched_args{mismatched_sources};
+  EXPECT_THROW(cudf_io::read_parquet(mismatched_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, RowGroupAndPageSizes)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 10000, true);
+
+  // Row groups of 3000 rows, each with many small pages
+  auto filepath = temp_env->get_temp_filepath("RowGroupAndPageSizes.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *table1};
+  args.row_group_size_rows = 3000;
+  args.max_page_size_bytes = 4096;
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *table1);
+
+  read_args.row_group_list = {3};
+  result                   = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, cudf::experimental::slice(*table1, {9000, 10000})[0]);
+  read_args.row_group_list = {4};
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, PageIndexes)
+{
+  // Sorted even values in two pages of a single row group, leaving a gap between the page ranges
+  constexpr auto num_rows = 10000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  column_wrapper<int> col(values, values + num_rows);
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexes.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, expected};
+  args.stats_level         = cudf_io::statistics_freq::STATISTICS_PAGE;
+  args.max_page_size_bytes = 4096;
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, expected);
+
+  // Only the column index can rule out the row group
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 9999}};
+  result            = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filters = {{"_col0", cudf_io::predicate_op::EQUAL, 10000}};
+  result            = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, expected);
+
+  // The offset index locates the pages of a row range
+  read_args.filters   = {};
+  read_args.skip_rows = 6000;
+  read_args.num_rows  = 1000;
+  result              = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, cudf::experimental::slice(expected, {6000, 7000})[0]);
+}
+
+TEST_F(ParquetWriterTest, PageIndexSkipsPages)
+{
+  constexpr auto num_rows = 10000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 3 * i; });
+  column_wrapper<int> col(values, values + num_rows);
+  table_view expected({col});
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args args{cudf_io::sink_info{&out_buffer}, expected};
+  args.compression         = cudf_io::compression_type::NONE;
+  args.max_page_size_bytes = 4096;
+  cudf_io::write_parquet(args);
+
+  // Locate the data pages from the footer and the offset index
+  namespace parquet = cudf::io::parquet;
+  auto const data   = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  uint32_t footer_len;
+  std::memcpy(&footer_len, data + out_buffer.size() - 8, sizeof(footer_len));
+  parquet::FileMetaData file_meta;
+  parquet::CompactProtocolReader footer(data + out_buffer.size() - 8 - footer_len, footer_len);
+  ASSERT_TRUE(footer.read(&file_meta));
+  ASSERT_EQ(file_meta.row_groups.size(), 1u);
+  auto const& chunk = file_meta.row_groups[0].columns[0];
+  parquet::OffsetIndex offset_index;
+  parquet::CompactProtocolReader index(data + chunk.offset_index_offset, chunk.offset_index_length);
+  ASSERT_TRUE(index.read(&offset_index));
+  auto const& locs = offset_index.page_locations;
+  ASSERT_GT(locs.size(), 3u);
+
+  // Overwrite the pages outside of the row range, headers included, so that
+  // reading any of them fails or returns wrong values
+  const int64_t skip_rows = locs[1].first_row_index + 1;
+  const int64_t read_rows = locs[2].first_row_index - skip_rows + 1;
+  for (size_t p = 0; p < locs.size(); ++p) {
+    const int64_t page_end = (p + 1 < locs.size()) ? locs[p + 1].first_row_index : num_rows;
+    if (page_end <= skip_rows || locs[p].first_row_index >= skip_rows + read_rows) {
+      std::fill_n(out_buffer.begin() + locs[p].offset, locs[p].compressed_page_size, '\xff');
+    }
+  }
+
+  cudf_io::read_parquet_args read_args{
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()}};
+  read_args.skip_rows = skip_rows;
+  read_args.num_rows  = read_rows;
+  auto result         = cudf_io::read_parquet(read_args);
+  auto const begin    = static_cast<cudf::size_type>(skip_rows);
+  auto const end      = static_cast<cudf::size_type>(skip_rows + read_rows);
+  expect_tables_equal(*result.tbl, cudf::experimental::slice(expected, {begin, end})[0]);
+}
+
+TEST_F(ParquetWriterTest, ListColumns)
+{
+  // [[1, 2], null, [], [3, null, 4], [5]]
+  auto ints = make_lists(
+    {0, 2, 2, 2, 5, 6},
+    cudf::test::fixed_width_column_wrapper<int>({1, 2, 3, 0, 4, 5}, {1, 1, 1, 0, 1, 1}).release(),
+    {1, 0, 1, 1, 1});
+  // [["a"], [], ["bc", "d"], null, [""]]
+  auto strs = make_lists({0, 1, 1, 3, 3, 4},
+                         cudf::test::strings_column_wrapper{"a", "bc", "d", ""}.release(),
+                         {1, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int> flat{10, 11, 12, 13, 14};
+  table_view expected({ints->view(), strs->view(), flat});
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"ints", "strs", "flat"};
+
+  // Row groups of two rows
+  auto filepath = temp_env->get_temp_filepath("ListColumns.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, expected, &metadata};
+  args.row_group_size_rows = 2;
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.metadata.column_names, metadata.column_names);
+  for (cudf::size_type i = 0; i < expected.num_columns(); ++i) {
+    expect_nested_equal(result.tbl->get_column(i), expected.column(i));
+  }
+
+  // A row range across row groups
+  read_args.skip_rows = 1;
+  read_args.num_rows  = 3;
+  result              = cudf_io::read_parquet(read_args);
+  auto expected_ints  = make_lists(
+    {0, 0, 0, 3},
+    cudf::test::fixed_width_column_wrapper<int>({3, 0, 4}, {1, 0, 1}).release(),
+    {0, 1, 1});
+  auto expected_strs =
+    make_lists({0, 0, 2, 2}, cudf::test::strings_column_wrapper{"bc", "d"}.release(), {1, 1, 0});
+  expect_nested_equal(result.tbl->get_column(0), *expected_ints);
+  expect_nested_equal(result.tbl->get_column(1), *expected_strs);
+  cudf::test::expect_columns_equal(result.tbl->get_column(2),
+                                   cudf::test::fixed_width_column_wrapper<int>{11, 12, 13});
+
+  // Leaves below a list have no flat representation
+  cudf_io::read_parquet_args leaf_args{cudf_io::source_info{filepath}};
+  leaf_args.columns = {"ints.list.element"};
+  EXPECT_THROW(cudf_io::read_parquet(leaf_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, StructColumns)
+{
+  // [{1, [1, 2]}, null, {null, []}, {4, null}, {5, [3]}]
+  std::vector<std::unique_ptr<cudf::column>> fields;
+  fields.push_back(
+    cudf::test::fixed_width_column_wrapper<int>({1, 0, 0, 4, 5}, {1, 0, 0, 1, 1}).release());
+  fields.push_back(make_lists({0, 2, 2, 2, 2, 3},
+                              cudf::test::fixed_width_column_wrapper<int>{1, 2, 3}.release(),
+                              {1, 0, 1, 0, 1}));
+  auto structs = make_structs(std::move(fields), {1, 0, 1, 1, 1});
+  table_view expected({structs->view()});
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"s"};
+
+  auto filepath = temp_env->get_temp_filepath("StructColumns.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, expected, &metadata};
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  EXPECT_EQ(result.metadata.column_names[0], "s");
+  expect_nested_equal(result.tbl->get_column(0), expected.column(0));
+
+  // A leaf of the struct can still be read as a flat column by its path
+  read_args.columns = {"s._col0"};
+  result            = cudf_io::read_parquet(read_args);
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  EXPECT_EQ(result.metadata.column_names[0], "s._col0");
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(0),
+    cudf::test::fixed_width_column_wrapper<int>({1, 0, 0, 4, 5}, {1, 0, 0, 1, 1}));
+}
+
+TEST_F(ParquetWriterTest, ListOfStructColumns)
+{
+  // [[{1, "a"}, {2, null}], [], null, [{null, "c"}]]
+  std::vector<std::unique_ptr<cudf::column>> fields;
+  fields.push_back(cudf::test::fixed_width_column_wrapper<int>({1, 2, 0}, {1, 1, 0}).release());
+  fields.push_back(cudf::test::strings_column_wrapper({"a", "", "c"}, {1, 0, 1}).release());
+  auto lists = make_lists({0, 2, 2, 2, 3}, make_structs(std::move(fields)), {1, 1, 0, 1});
+  table_view expected({lists->view()});
+
+  auto filepath = temp_env->get_temp_filepath("ListOfStructColumns.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(args);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  expect_nested_equal(result.tbl->get_column(0), expected.column(0));
+}
+
+TEST_F(ParquetWriterTest, PartitionedDataset)
+{
+  cudf::test::fixed_width_column_wrapper<int> keys{1, 2, 1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int> values{10, 20, 11, 21, 30};
+  cudf::table_view input{{keys, values}};
+  cudf_io::table_metadata_with_nullability metadata;
+  metadata.column_names    = {"a", "v"};
+  metadata.column_nullable = {false, false};
+
+  // Each table writes three partitions through at most two open files
+  auto base_path = temp_env->get_temp_dir() + "PartitionedDataset";
+  cudf_io::write_partitioned_parquet_args args{base_path, {0}, &metadata};
+  args.max_open_files = 2;
+  cudf_io::partitioned_parquet_writer writer(args);
+  writer.write(input);
+  writer.write(input);
+  auto files = writer.close();
+  std::vector<std::string> expected_files{"a=1/part-0.parquet",
+                                          "a=2/part-0.parquet",
+                                          "a=3/part-0.parquet",
+                                          "a=1/part-1.parquet",
+                                          "a=2/part-1.parquet",
+                                          "a=3/part-1.parquet"};
+  EXPECT_EQ(files, expected_files);
+
+  std::vector<std::vector<int>> expected_values{{10, 11}, {20, 21}, {30}};
+  for (size_t i = 0; i < files.size(); ++i) {
+    cudf_io::read_parquet_args read_args{cudf_io::source_info{base_path + "/" + files[i]}};
+    auto result = cudf_io::read_parquet(read_args);
+    ASSERT_EQ(result.tbl->num_columns(), 1);
+    EXPECT_EQ(result.metadata.column_names[0], "v");
+    auto const& expected = expected_values[i % 3];
+    cudf::test::expect_columns_equal(
+      result.tbl->get_column(0),
+      cudf::test::fixed_width_column_wrapper<int>(expected.begin(), expected.end()));
+  }
+}
+
+TEST_F(ParquetWriterTest, PartitionedDatasetNullAndEscapedKeys)
+{
+  cudf::test::strings_column_wrapper keys({"x/y", "", "x/y"}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int> values{1, 2, 3};
+  cudf::table_view input{{values, keys}};
+  cudf_io::table_metadata_with_nullability metadata;
+  metadata.column_names = {"v", "s"};
+
+  std::map<std::string, std::vector<char>> buffers;
+  cudf_io::write_partitioned_parquet_args args{"", {1}, &metadata};
+  args.sink_factory = [&buffers](std::string const& path) {
+    return cudf::io::data_sink::create(&buffers[path]);
+  };
+  cudf_io::partitioned_parquet_writer writer(args);
+  writer.write(input);
+  auto files = writer.close();
+  std::sort(files.begin(), files.end());
+  std::vector<std::string> expected_files{"s=__HIVE_DEFAULT_PARTITION__/part-0.parquet",
+                                          "s=x%2Fy/part-0.parquet"};
+  EXPECT_EQ(files, expected_files);
+
+  auto const& buffer = buffers["s=x%2Fy/part-0.parquet"];
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{buffer.data(), buffer.size()}};
+  auto result = cudf_io::read_parquet(read_args);
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(0), cudf::test::fixed_width_column_wrapper<int>({1, 3}, {1, 1}));
+
+  cudf::test::fixed_width_column_wrapper<int> numbers{1, 2};
+  cudf_io::write_partitioned_parquet_args invalid_args{"", {0}};
+  cudf_io::partitioned_parquet_writer invalid_writer(invalid_args);
+  EXPECT_THROW(invalid_writer.write(cudf::table_view{{numbers}}), cudf::logic_error);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
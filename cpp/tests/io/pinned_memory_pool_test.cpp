@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <vector>
+
+using cudf::io::pinned_memory_pool;
+
+struct PinnedMemoryPoolTest : public cudf::test::BaseFixture {};
+
+TEST_F(PinnedMemoryPoolTest, SizeClassRounding) {
+  pinned_memory_pool pool;
+
+  // Small requests take a block of the smallest size class
+  auto small = pool.allocate(1);
+  ASSERT_NE(small, nullptr);
+  pool.deallocate(small);
+  EXPECT_EQ(pool.cached_size(), pinned_memory_pool::min_block_size);
+
+  // Other requests are rounded up to the next power of two
+  auto medium = pool.allocate(pinned_memory_pool::min_block_size + 1);
+  pool.deallocate(medium);
+  EXPECT_EQ(pool.cached_size(), 3 * pinned_memory_pool::min_block_size);
+
+  // Requests larger than the largest size class are not cached
+  auto large = pool.allocate(pinned_memory_pool::max_block_size + 1);
+  pool.deallocate(large);
+  EXPECT_EQ(pool.cached_size(), 3 * pinned_memory_pool::min_block_size);
+
+  EXPECT_EQ(pool.allocate(0), nullptr);
+  pool.release();
+  EXPECT_EQ(pool.cached_size(), 0u);
+}
+
+TEST_F(PinnedMemoryPoolTest, BlockReuse) {
+  pinned_memory_pool pool;
+
+  auto first = pool.allocate(10000);
+  pool.deallocate(first);
+
+  // A request of the same size class gets the cached block back
+  auto second = pool.allocate(9000);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(pool.cached_size(), 0u);
+
+  // A request of another size class does not
+  auto third = pool.allocate(100);
+  EXPECT_NE(third, first);
+  pool.deallocate(second);
+  pool.deallocate(third);
+}
+
+TEST_F(PinnedMemoryPoolTest, ReuseWaitsForStream) {
+  pinned_memory_pool pool;
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  const size_t size = 1 << 20;
+  std::vector<char> expected(size);
+  for (size_t i = 0; i < size; ++i) { expected[i] = static_cast<char>(i * 13 + i / 255); }
+  rmm::device_buffer data(expected.data(), size, stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // The copy into the block is still pending on the stream when the block is released
+  auto block = static_cast<char *>(pool.allocate(size));
+  CUDA_TRY(cudaMemcpyAsync(block, data.data(), size, cudaMemcpyDeviceToHost, stream));
+  pool.deallocate(block, stream);
+
+  auto reused = static_cast<char *>(pool.allocate(size));
+  ASSERT_EQ(reused, block);
+  EXPECT_EQ(cudaStreamQuery(stream), cudaSuccess);
+  EXPECT_EQ(std::vector<char>(reused, reused + size), expected);
+  pool.deallocate(reused, stream);
+
+  pool.release();
+  CUDA_TRY(cudaStreamDestroy(stream));
+}
+
+TEST_F(PinnedMemoryPoolTest, CacheByteCap) {
+  pinned_memory_pool pool(2 * pinned_memory_pool::min_block_size);
+
+  std::vector<void *> blocks;
+  for (int i = 0; i < 3; ++i) { blocks.push_back(pool.allocate(1)); }
+  for (auto block : blocks) { pool.deallocate(block); }
+
+  // The third block would exceed the cap, so it is freed
+  EXPECT_EQ(pool.cached_size(), 2 * pinned_memory_pool::min_block_size);
+
+  // A block larger than the cap is never cached
+  auto large = pool.allocate(4 * pinned_memory_pool::min_block_size);
+  pool.deallocate(large);
+  EXPECT_EQ(pool.cached_size(), 2 * pinned_memory_pool::min_block_size);
+
+  pool.release();
+  EXPECT_EQ(pool.cached_size(), 0u);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using cudf::experimental::binary_operator;
+
+struct ConditionalJoinTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+std::unique_ptr<cudf::experimental::table> sorted(cudf::table_view const& table) {
+  return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+}
+
+}  // namespace
+
+TEST_F(ConditionalJoinTest, RangeInnerJoin) {
+  column_wrapper<int32_t> ts{1, 5, 9, 4};
+  column_wrapper<int32_t> start{0, 4};
+  column_wrapper<int32_t> end{6, 8};
+  cudf::table_view left{{ts}};
+  cudf::table_view right{{start, end}};
+
+  auto result = cudf::experimental::conditional_inner_join(
+    left,
+    right,
+    {{0, binary_operator::GREATER_EQUAL, 0}, {0, binary_operator::LESS_EQUAL, 1}});
+
+  column_wrapper<int32_t> expect_ts{1, 4, 4, 5, 5};
+  column_wrapper<int32_t> expect_start{0, 0, 4, 0, 4};
+  column_wrapper<int32_t> expect_end{6, 6, 8, 6, 8};
+  cudf::test::expect_tables_equal(cudf::table_view{{expect_ts, expect_start, expect_end}},
+                                  *sorted(*result));
+}
+
+TEST_F(ConditionalJoinTest, LeftJoinWithNulls) {
+  column_wrapper<int32_t> a{{1, 5, 9, 7}, {1, 1, 1, 0}};
+  cudf::test::strings_column_wrapper s({"x", "y", "z", "w"});
+  column_wrapper<int32_t> b{{3, 6, 2}, {1, 1, 0}};
+  cudf::table_view left{{a, s}};
+  cudf::table_view right{{b}};
+
+  auto result =
+    cudf::experimental::conditional_left_join(left, right, {{0, binary_operator::GREATER, 0}});
+
+  // Nulls never match: 7 has no match, and the null right row matches nothing
+  column_wrapper<int32_t> expect_a{{7, 1, 5, 9, 9}, {0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper expect_s({"w", "x", "y", "z", "z"});
+  column_wrapper<int32_t> expect_b{{0, 0, 3, 3, 6}, {0, 0, 1, 1, 1}};
+  cudf::test::expect_tables_equal(cudf::table_view{{expect_a, expect_s, expect_b}},
+                                  *sorted(*result));
+}
+
+TEST_F(ConditionalJoinTest, InvalidConditions) {
+  column_wrapper<int32_t> a{1, 2};
+  column_wrapper<int64_t> b{1, 2};
+  cudf::table_view left{{a}};
+  cudf::table_view right{{b}};
+
+  EXPECT_THROW(cudf::experimental::conditional_inner_join(left, right, {}), cudf::logic_error);
+  EXPECT_THROW(
+    cudf::experimental::conditional_inner_join(left, right, {{0, binary_operator::LESS, 0}}),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::experimental::conditional_inner_join(left, left, {{0, binary_operator::ADD, 0}}),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::experimental::conditional_inner_join(left, left, {{0, binary_operator::LESS, 1}}),
+    cudf::logic_error);
+}
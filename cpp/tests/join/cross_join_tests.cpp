@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct CrossJoinTest : public cudf::test::BaseFixture {};
+
+TEST_F(CrossJoinTest, CrossJoin) {
+  column_wrapper<int32_t> a{{0, 1}, {1, 0}};
+  column_wrapper<int32_t> b{3, 4, 5};
+  cudf::test::strings_column_wrapper s({"x", "y", "z"});
+  cudf::table_view left{{a}};
+  cudf::table_view right{{b, s}};
+
+  auto result = cudf::experimental::cross_join(left, right);
+
+  column_wrapper<int32_t> expect_a{{0, 0, 0, 1, 1, 1}, {1, 1, 1, 0, 0, 0}};
+  column_wrapper<int32_t> expect_b{3, 4, 5, 3, 4, 5};
+  cudf::test::strings_column_wrapper expect_s({"x", "y", "z", "x", "y", "z"});
+  cudf::test::expect_tables_equal(cudf::table_view{{expect_a, expect_b, expect_s}}, *result);
+}
+
+TEST_F(CrossJoinTest, ChunkedOutput) {
+  column_wrapper<int32_t> a{0, 1, 2};
+  column_wrapper<int32_t> b{3, 4, 5};
+  cudf::table_view left{{a}};
+  cudf::table_view right{{b}};
+
+  auto expect = cudf::experimental::cross_join(left, right);
+  auto chunks = cudf::experimental::cross_join(left, right, 4);
+
+  ASSERT_EQ(chunks.size(), 3u);
+  EXPECT_EQ(chunks[0]->num_rows(), 4);
+  EXPECT_EQ(chunks[2]->num_rows(), 1);
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  cudf::test::expect_tables_equal(expect->view(), *cudf::experimental::concatenate(views));
+}
+
+TEST_F(CrossJoinTest, EmptyInput) {
+  column_wrapper<int32_t> a{0, 1};
+  column_wrapper<int32_t> b{};
+  cudf::table_view left{{a}};
+  cudf::table_view right{{b}};
+
+  auto result = cudf::experimental::cross_join(left, right);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 2);
+  EXPECT_TRUE(cudf::experimental::cross_join(left, right, 4).empty());
+  EXPECT_THROW(cudf::experimental::cross_join(left, right, 0), cudf::logic_error);
+}
@@ -21,6 +21,10 @@
 #include <cudf/join.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/utilities/memory_budget.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -28,6 +32,8 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <limits>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 using strcol_wrapper = cudf::test::strings_column_wrapper;
@@ -684,4 +690,381 @@ TEST_F(JoinTest, InnerJoinCornerCase)
   cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, HashJoinReusedBuildTable)
+{
+  column_wrapper <int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper           col0_1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper <int32_t> col1_0{{2, 4, 4, 0, 3, 1}};
+  strcol_wrapper           col1_1({"s0", "s4", "s2", "s0", "s1", "s1"});
+
+  column_wrapper <int32_t> col2_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper           col2_1({"s1", "s0", "s1", "s2", "s1"});
+  column_wrapper <int32_t> col2_2{{1, 0, 1, 2, 1}};
+
+  CVector cols0, cols1, cols2;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  cols2.push_back(col2_0.release());
+  cols2.push_back(col2_1.release());
+  cols2.push_back(col2_2.release());
+
+  Table probe0(std::move(cols0));
+  Table probe1(std::move(cols1));
+  Table build(std::move(cols2));
+
+  cudf::experimental::hash_join hash_join(build, {0, 1});
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> common{{0, 0}, {1, 1}};
+
+  auto sorted = [](cudf::table_view const& table) {
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+
+  for (auto const* probe : {&probe0, &probe1}) {
+    auto inner_result = hash_join.inner_join(*probe, {0, 1}, common);
+    auto inner_gold   = cudf::experimental::inner_join(*probe, build, {0, 1}, {0, 1}, common);
+    cudf::test::expect_tables_equal(*sorted(*inner_gold), *sorted(*inner_result));
+
+    auto left_result = hash_join.left_join(*probe, {0, 1}, common);
+    auto left_gold   = cudf::experimental::left_join(*probe, build, {0, 1}, {0, 1}, common);
+    cudf::test::expect_tables_equal(*sorted(*left_gold), *sorted(*left_result));
+
+    auto full_result = hash_join.full_join(*probe, {0, 1}, {});
+    auto full_gold   = cudf::experimental::full_join(*probe, build, {0, 1}, {0, 1}, {});
+    cudf::test::expect_tables_equal(*sorted(*full_gold), *sorted(*full_result));
+  }
+}
+
+TEST_F(JoinTest, JoinIndices)
+{
+  column_wrapper <int32_t> col0_0{{0, 1, 2}};
+  column_wrapper <int32_t> col1_0{{1, 2, 3}};
+  column_wrapper <int32_t> col1_1{{1, 2, 5}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto sorted = [](auto const& indices) {
+    cudf::table_view table{{indices.first->view(), indices.second->view()}};
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+
+  column_wrapper <int32_t> inner_gold_0{{1, 2}};
+  column_wrapper <int32_t> inner_gold_1{{0, 1}};
+  auto inner_result = cudf::experimental::inner_join_indices(t0, t1, {0}, {1});
+  cudf::test::expect_tables_equal(cudf::table_view{{inner_gold_0, inner_gold_1}},
+                                  *sorted(inner_result));
+
+  column_wrapper <int32_t> left_gold_0{{0, 1, 2}};
+  column_wrapper <int32_t> left_gold_1{{-1, 0, 1}, {0, 1, 1}};
+  auto left_result = cudf::experimental::left_join_indices(t0, t1, {0}, {1});
+  cudf::test::expect_tables_equal(cudf::table_view{{left_gold_0, left_gold_1}},
+                                  *sorted(left_result));
+
+  column_wrapper <int32_t> full_gold_0{{-1, 0, 1, 2}, {0, 1, 1, 1}};
+  column_wrapper <int32_t> full_gold_1{{2, -1, 0, 1}, {1, 0, 1, 1}};
+  auto full_result = cudf::experimental::full_join_indices(t0, t1, {0}, {1});
+  cudf::test::expect_tables_equal(cudf::table_view{{full_gold_0, full_gold_1}},
+                                  *sorted(full_result));
+}
+
+TEST_F(JoinTest, HashJoinSizeModes)
+{
+  // Skewed keys, so that sampling the probe rows underestimates the output size
+  column_wrapper <int32_t> col0_0{{4, 1, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2}};
+  column_wrapper <int32_t> col1_0{{2, 2, 2, 5}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols1.push_back(col1_0.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto sorted = [](cudf::table_view const& table) {
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+
+  using cudf::experimental::join_size_mode;
+  cudf::experimental::hash_join exact_join(t1, {0}, join_size_mode::EXACT);
+  cudf::experimental::hash_join estimate_join(t1, {0}, join_size_mode::ESTIMATE);
+
+  auto exact_result    = exact_join.left_join(t0, {0}, {});
+  auto estimate_result = estimate_join.left_join(t0, {0}, {});
+  EXPECT_EQ(exact_result->num_rows(), 3 + 9 * 3);
+  cudf::test::expect_tables_equal(*sorted(*exact_result), *sorted(*estimate_result));
+}
+
+TEST_F(JoinTest, HashJoinLargeBuildTable)
+{
+  // Enough build rows for the probe to be prefiltered with a Bloom filter
+  auto build_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  column_wrapper <int32_t> col1_0(build_keys, build_keys + 100000);
+  auto probe_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper <int32_t> col0_0(probe_keys, probe_keys + 1000);
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols1.push_back(col1_0.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  cudf::experimental::hash_join hash_join(t1, {0});
+  auto inner_result = hash_join.inner_join(t0, {0}, {{0, 0}});
+  auto left_result  = hash_join.left_join(t0, {0}, {});
+
+  // Only the even probe keys match
+  EXPECT_EQ(inner_result->num_rows(), 500);
+  EXPECT_EQ(left_result->num_rows(), 1000);
+  EXPECT_EQ(left_result->get_column(1).null_count(), 500);
+
+  auto sorted = cudf::experimental::gather(inner_result->view(),
+                                           *cudf::experimental::sorted_order(inner_result->view()));
+  auto expect_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  column_wrapper <int32_t> expect(expect_keys, expect_keys + 500);
+  cudf::test::expect_columns_equal(sorted->get_column(0), expect);
+}
+
+TEST_F(JoinTest, HashJoinPrecomputedHashes)
+{
+  column_wrapper <int32_t> col0_0{{3, 1, 2, 0, 2}};
+  strcol_wrapper           col0_1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper <int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper           col1_1({"s1", "s0", "s1", "s2", "s1"});
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  // Hashes of the join columns, as returned by hash_partition_with_hashes
+  auto build_hashes = cudf::hash(t1.select({0, 1}));
+  auto probe_hashes = cudf::hash(t0.select({0, 1}));
+
+  cudf::experimental::hash_join hash_join(t1, {0, 1});
+  cudf::experimental::hash_join prehashed_join(t1, {0, 1}, *build_hashes);
+
+  auto gold   = hash_join.left_join(t0, {0, 1}, {});
+  auto result = prehashed_join.left_join(t0, {0, 1}, *probe_hashes, {});
+
+  auto result_sort_order = cudf::experimental::sorted_order(result->view());
+  auto sorted_result     = cudf::experimental::gather(result->view(), *result_sort_order);
+  auto gold_sort_order   = cudf::experimental::sorted_order(gold->view());
+  auto sorted_gold       = cudf::experimental::gather(gold->view(), *gold_sort_order);
+  cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
+
+  // One hash value is required per probe row
+  column_wrapper<int32_t> short_hashes{{1, 2, 3}};
+  EXPECT_THROW(prehashed_join.left_join(t0, {0, 1}, short_hashes, {}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, JoinAlgorithms)
+{
+  column_wrapper <int32_t> col0_0{{3, 1, 2, 0, 2, 5}, {1, 1, 1, 1, 1, 0}};
+  strcol_wrapper           col0_1({"s1", "s1", "s0", "s4", "s0", "s2"});
+  column_wrapper <int32_t> col0_2{{0, 1, 2, 4, 1, 7}};
+
+  // Unsorted right table, and the same rows sorted on the join columns
+  column_wrapper <int32_t> col1_0{{2, 2, 0, 4, 3, 2}, {1, 1, 1, 1, 1, 0}};
+  strcol_wrapper           col1_1({"s1", "s0", "s1", "s2", "s1", "s2"});
+  column_wrapper <int32_t> col1_2{{1, 0, 1, 2, 1, 5}};
+  column_wrapper <int32_t> col2_0{{2, 0, 2, 2, 3, 4}, {0, 1, 1, 1, 1, 1}};
+  strcol_wrapper           col2_1({"s2", "s1", "s0", "s1", "s1", "s2"});
+  column_wrapper <int32_t> col2_2{{5, 1, 0, 1, 1, 2}};
+
+  CVector cols0, cols1, cols2;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols0.push_back(col0_2.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+  cols1.push_back(col1_2.release());
+  cols2.push_back(col2_0.release());
+  cols2.push_back(col2_1.release());
+  cols2.push_back(col2_2.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+  Table t2(std::move(cols2));
+
+  auto sorted = [](cudf::table_view const& table) {
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+
+  using cudf::experimental::join_algorithm;
+  for (auto const* right : {&t1, &t2}) {
+    auto inner_gold   = cudf::experimental::inner_join(t0, *right, {0, 1}, {0, 1}, {{0, 0}});
+    auto inner_result = cudf::experimental::inner_join(
+      t0, *right, {0, 1}, {0, 1}, {{0, 0}}, join_algorithm::SORT_MERGE);
+    cudf::test::expect_tables_equal(*sorted(*inner_gold), *sorted(*inner_result));
+
+    auto left_gold   = cudf::experimental::left_join(t0, *right, {0, 1}, {0, 1}, {{0, 0}});
+    auto left_result = cudf::experimental::left_join(
+      t0, *right, {0, 1}, {0, 1}, {{0, 0}}, join_algorithm::SORT_MERGE);
+    cudf::test::expect_tables_equal(*sorted(*left_gold), *sorted(*left_result));
+
+    auto full_gold   = cudf::experimental::full_join(t0, *right, {0}, {0}, {});
+    auto full_result =
+      cudf::experimental::full_join(t0, *right, {0}, {0}, {}, join_algorithm::SORT_MERGE);
+    cudf::test::expect_tables_equal(*sorted(*full_gold), *sorted(*full_result));
+  }
+
+  auto partitioned_result = cudf::experimental::left_join(
+    t0, t1, {0, 1}, {0, 1}, {{0, 0}}, join_algorithm::PARTITIONED_HASH);
+  auto partitioned_gold = cudf::experimental::left_join(t0, t1, {0, 1}, {0, 1}, {{0, 0}});
+  cudf::test::expect_tables_equal(*sorted(*partitioned_gold), *sorted(*partitioned_result));
+}
+
+struct test_memory_budget : public cudf::memory_budget {
+  std::size_t available{0};
+  std::size_t spilled{0};
+  std::size_t spill_limit{0};
+
+  std::size_t available_bytes() override { return available; }
+
+  bool spill(std::size_t bytes) override {
+    if (spilled >= spill_limit) { return false; }
+    spilled += bytes;
+    available += bytes;
+    return true;
+  }
+};
+
+TEST_F(JoinTest, MemoryBudget)
+{
+  column_wrapper <int32_t> col0_0{{3, 1, 2, 0, 2}};
+  column_wrapper <int32_t> col0_1{{0, 1, 2, 4, 1}};
+  column_wrapper <int32_t> col1_0{{2, 2, 0, 4, 3}};
+  column_wrapper <int32_t> col1_1{{1, 0, 1, 2, 1}};
+
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(col0_1.release());
+  cols1.push_back(col1_0.release());
+  cols1.push_back(col1_1.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto sorted = [](cudf::table_view const& table) {
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+  auto gold = cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+
+  // the budget is met by spilling
+  test_memory_budget spilling_budget;
+  spilling_budget.spill_limit = std::numeric_limits<std::size_t>::max();
+  auto previous = cudf::set_memory_budget(&spilling_budget);
+  auto spilled_result = cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  cudf::test::expect_tables_equal(*sorted(*gold), *sorted(*spilled_result));
+  EXPECT_GT(spilling_budget.spilled, 0u);
+
+  // the join is partitioned, then the output of a single left row does not fit in the budget
+  test_memory_budget empty_budget;
+  cudf::set_memory_budget(&empty_budget);
+  EXPECT_THROW(cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}}), cudf::logic_error);
+  cudf::set_memory_budget(previous);
+}
+
+TEST_F(JoinTest, MemoryBudgetOutput)
+{
+  // Every left row matches every right row, so the output is much larger than the tables
+  auto ones = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 1; });
+  column_wrapper <int32_t> col0_0(ones, ones + 100);
+  column_wrapper <int32_t> col1_0(ones, ones + 100);
+  cudf::table_view t0({col0_0});
+  cudf::table_view t1({col1_0});
+
+  auto sorted = [](cudf::table_view const& table) {
+    return cudf::experimental::gather(table, *cudf::experimental::sorted_order(table));
+  };
+  auto gold = cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  ASSERT_EQ(gold->num_rows(), 100 * 100);
+
+  // the tables fit in the budget but the output only does after spilling
+  test_memory_budget spilling_budget;
+  spilling_budget.available   = 64 << 10;
+  spilling_budget.spill_limit = std::numeric_limits<std::size_t>::max();
+  auto previous = cudf::set_memory_budget(&spilling_budget);
+  auto spilled_result = cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  cudf::test::expect_tables_equal(*sorted(*gold), *sorted(*spilled_result));
+  EXPECT_GT(spilling_budget.spilled, 0u);
+
+  // without spilling, the output is computed for parts of the left rows
+  test_memory_budget small_budget;
+  small_budget.available = 64 << 10;
+  cudf::set_memory_budget(&small_budget);
+  auto chunked_result = cudf::experimental::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  cudf::test::expect_tables_equal(*sorted(*gold), *sorted(*chunked_result));
+  auto chunked_left_result = cudf::experimental::left_join(t0, t1, {0}, {0}, {{0, 0}});
+  cudf::test::expect_tables_equal(*sorted(*gold), *sorted(*chunked_left_result));
+  EXPECT_EQ(small_budget.spilled, 0u);
+  cudf::set_memory_budget(previous);
+
+  // full joins are partitioned again, which splits the rows with different keys
+  auto keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  column_wrapper <int32_t> col2_0(keys, keys + 100);
+  column_wrapper <int32_t> col3_0(keys + 5, keys + 105);
+  cudf::table_view t2({col2_0});
+  cudf::table_view t3({col3_0});
+  auto full_gold = cudf::experimental::full_join(t2, t3, {0}, {0}, {{0, 0}});
+  test_memory_budget full_budget;
+  full_budget.available = 8 << 10;
+  cudf::set_memory_budget(&full_budget);
+  auto full_result = cudf::experimental::full_join(t2, t3, {0}, {0}, {{0, 0}});
+  cudf::set_memory_budget(previous);
+  cudf::test::expect_tables_equal(*sorted(*full_gold), *sorted(*full_result));
+}
+
+TEST_F(JoinTest, DictionaryKeysMismatch)
+{
+  column_wrapper <int32_t> col0_0{{0, 1, 2, 3}};
+  strcol_wrapper           col0_1({"a", "c", "b", "d"});
+  strcol_wrapper           col1_0({"e", "d", "c"});
+  column_wrapper <int32_t> col1_1{{10, 11, 12}};
+
+  // the dictionaries have different keys, so equal values have different indices
+  CVector cols0, cols1;
+  cols0.push_back(col0_0.release());
+  cols0.push_back(cudf::dictionary::encode(col0_1));
+  cols1.push_back(cudf::dictionary::encode(col1_0));
+  cols1.push_back(col1_1.release());
+
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  using cudf::experimental::join_algorithm;
+  for (auto algorithm : {join_algorithm::HASH, join_algorithm::SORT_MERGE}) {
+    auto result = cudf::experimental::inner_join(t0, t1, {1}, {0}, {}, algorithm);
+    auto sorted_result = cudf::experimental::gather(
+      result->view(), *cudf::experimental::sorted_order(result->view().select({0})));
+
+    column_wrapper <int32_t> col_gold_0{{1, 3}};
+    strcol_wrapper           col_gold_1({"c", "d"});
+    column_wrapper <int32_t> col_gold_3{{12, 11}};
+    cudf::test::expect_columns_equal(sorted_result->get_column(0), col_gold_0);
+    cudf::test::expect_columns_equal(
+      *cudf::dictionary::decode(sorted_result->get_column(1).view()), col_gold_1);
+    cudf::test::expect_columns_equal(
+      *cudf::dictionary::decode(sorted_result->get_column(2).view()), col_gold_1);
+    cudf::test::expect_columns_equal(sorted_result->get_column(3), col_gold_3);
+  }
+
+  auto semi_result = cudf::experimental::left_semi_join(t0, t1, {1}, {0}, {0});
+  column_wrapper <int32_t> semi_gold{{1, 3}};
+  cudf::test::expect_columns_equal(
+    *cudf::experimental::sort(semi_result->view())->view().column(0), semi_gold);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
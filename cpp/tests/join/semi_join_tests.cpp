@@ -717,3 +717,53 @@ TEST_F(JoinTest, LeftAntiJoin_empty_right_table) {
   expect_columns_equal(join_table->get_column(2), expect_2);
   expect_columns_equal(join_table->get_column(3), expect_3);
 }
+
+TEST_F(JoinTest, LeftSemiAntiJoinIndices) {
+  column_wrapper<int32_t> a_0 {  10,  20,  30,  20,  40 };
+  column_wrapper<int32_t> b_0 {  20,  50,  10,  20 };
+
+  cudf::table_view table_a({a_0});
+  cudf::table_view table_b({b_0});
+
+  auto semi = cudf::experimental::left_semi_join_indices(table_a, table_b, {0}, {0});
+  auto anti = cudf::experimental::left_anti_join_indices(table_a, table_b, {0}, {0});
+
+  expect_columns_equal(*semi, column_wrapper<int32_t>{0, 1, 3});
+  expect_columns_equal(*anti, column_wrapper<int32_t>{2, 4});
+}
+
+TEST_F(JoinTest, LeftSemiAntiJoinIndices_empty_right) {
+  column_wrapper<int32_t> a_0 {  10,  20,  30 };
+  column_wrapper<int32_t> b_0 {};
+
+  cudf::table_view table_a({a_0});
+  cudf::table_view table_b({b_0});
+
+  auto semi = cudf::experimental::left_semi_join_indices(table_a, table_b, {0}, {0});
+  auto anti = cudf::experimental::left_anti_join_indices(table_a, table_b, {0}, {0});
+
+  EXPECT_EQ(semi->size(), 0);
+  expect_columns_equal(*anti, column_wrapper<int32_t>{0, 1, 2});
+}
+
+TEST_F(JoinTest, LeftSemiAntiJoin_large_right_table) {
+  // Large enough for the joins to use a Bloom filter of the right table
+  constexpr cudf::size_type num_right = 1 << 17;
+  auto const evens = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                     [](int32_t i) { return 2 * i; });
+  column_wrapper<int32_t> b_0(evens, evens + num_right);
+
+  auto const values = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> a_0(values, values + 1000);
+
+  cudf::table_view table_a({a_0});
+  cudf::table_view table_b({b_0});
+
+  auto semi = cudf::experimental::left_semi_join(table_a, table_b, {0}, {0}, {0});
+  auto anti = cudf::experimental::left_anti_join(table_a, table_b, {0}, {0}, {0});
+
+  auto const odds = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                    [](int32_t i) { return 2 * i + 1; });
+  expect_columns_equal(semi->get_column(0), column_wrapper<int32_t>(evens, evens + 500));
+  expect_columns_equal(anti->get_column(0), column_wrapper<int32_t>(odds, odds + 500));
+}
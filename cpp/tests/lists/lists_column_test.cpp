@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+namespace {
+
+using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+// builds a lists column from its offsets and child
+std::unique_ptr<cudf::column> make_lists(std::vector<int32_t> const& offsets,
+                                         std::unique_ptr<cudf::column> child,
+                                         std::vector<bool> const& validity = {}) {
+  auto const rows = static_cast<cudf::size_type>(offsets.size() - 1);
+  rmm::device_buffer null_mask{};
+  cudf::size_type null_count = 0;
+  if (!validity.empty()) {
+    auto mask_column =
+      int32_wrapper(offsets.begin(), offsets.end() - 1, validity.begin()).release();
+    null_count       = mask_column->null_count();
+    null_mask        = std::move(*(mask_column->release().null_mask));
+  }
+  return cudf::make_lists_column(rows,
+                                 int32_wrapper(offsets.begin(), offsets.end()).release(),
+                                 std::move(child),
+                                 null_count,
+                                 std::move(null_mask));
+}
+
+std::unique_ptr<cudf::column> make_lists(std::vector<int32_t> const& offsets,
+                                         std::vector<int32_t> const& values,
+                                         std::vector<bool> const& validity = {}) {
+  return make_lists(offsets, int32_wrapper(values.begin(), values.end()).release(), validity);
+}
+
+void expect_lists_equal(cudf::column_view const& lhs, cudf::column_view const& rhs) {
+  cudf::lists_column_view lhs_lists(lhs);
+  cudf::lists_column_view rhs_lists(rhs);
+  EXPECT_EQ(lhs_lists.size(), rhs_lists.size());
+  EXPECT_EQ(lhs_lists.null_count(), rhs_lists.null_count());
+  if (lhs_lists.size() == 0) return;
+  cudf::test::expect_columns_equal(lhs_lists.offsets(), rhs_lists.offsets());
+  if (lhs_lists.child().type().id() == cudf::LIST) {
+    expect_lists_equal(lhs_lists.child(), rhs_lists.child());
+  } else {
+    cudf::test::expect_columns_equal(lhs_lists.child(), rhs_lists.child());
+  }
+}
+
+}  // namespace
+
+struct ListsColumnTest : public cudf::test::BaseFixture {};
+
+TEST_F(ListsColumnTest, Factory) {
+  auto lists = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+  cudf::lists_column_view view(lists->view());
+  EXPECT_EQ(view.size(), 4);
+  EXPECT_EQ(view.parent().type().id(), cudf::LIST);
+  cudf::test::expect_columns_equal(view.child(), int32_wrapper{1, 2, 3, 4, 5, 6});
+
+  EXPECT_THROW(cudf::lists_column_view(int32_wrapper{1, 2}), cudf::logic_error);
+  EXPECT_THROW(cudf::make_lists_column(
+                 3, int32_wrapper{0, 1}.release(), int32_wrapper{1}.release(), 0, {}),
+               cudf::logic_error);
+}
+
+TEST_F(ListsColumnTest, Gather) {
+  // [[1, 2], [3], [], [4, 5, 6]]
+  auto lists = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+  int32_wrapper gather_map{3, 0, 2, 0};
+  auto results = cudf::experimental::gather(cudf::table_view{{lists->view()}}, gather_map);
+
+  auto expected = make_lists({0, 3, 5, 5, 7}, {4, 5, 6, 1, 2, 1, 2});
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, GatherWithNulls) {
+  // [[1, 2], null, [3], [4, 5]] with a null element in the child
+  auto child = int32_wrapper({1, 2, 3, 4, 5}, {1, 1, 1, 0, 1}).release();
+  auto lists = make_lists({0, 2, 2, 3, 5}, std::move(child), {1, 0, 1, 1});
+  int32_wrapper gather_map{1, 3, 0};
+  auto results = cudf::experimental::gather(cudf::table_view{{lists->view()}}, gather_map);
+
+  auto expected_child = int32_wrapper({4, 5, 1, 2}, {0, 1, 1, 1}).release();
+  auto expected       = make_lists({0, 0, 2, 4}, std::move(expected_child), {0, 1, 1});
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, GatherNested) {
+  // [[[1], [2, 3]], [[4, 5, 6]], []]
+  auto inner = make_lists({0, 1, 3, 6}, {1, 2, 3, 4, 5, 6});
+  auto lists = make_lists({0, 2, 3, 3}, std::move(inner));
+  int32_wrapper gather_map{1, 2, 0};
+  auto results = cudf::experimental::gather(cudf::table_view{{lists->view()}}, gather_map);
+
+  auto expected_inner = make_lists({0, 3, 4, 6}, {4, 5, 6, 1, 2, 3});
+  auto expected       = make_lists({0, 1, 1, 3}, std::move(expected_inner));
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, Concatenate) {
+  auto lists1 = make_lists({0, 2, 3}, {1, 2, 3}, {1, 1});
+  auto lists2 = make_lists({0, 0, 3, 4}, {4, 5, 6, 7}, {0, 1, 1});
+  // the second column is sliced to [[4, 5, 6], [7]]
+  auto sliced = cudf::experimental::slice(lists2->view(), {1, 3}).front();
+  auto results = cudf::concatenate({lists1->view(), lists2->view(), sliced});
+
+  auto expected = make_lists(
+    {0, 2, 3, 3, 6, 7, 10, 11}, {1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7}, {1, 1, 0, 1, 1, 1, 1});
+  expect_lists_equal(results->view(), expected->view());
+}
+
+TEST_F(ListsColumnTest, Scatter) {
+  // [[1, 2], [3], null, [4, 5, 6]]
+  auto target = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6}, {1, 1, 0, 1});
+  // [null, [8, 9], [10]]
+  auto source = make_lists({0, 1, 3, 4}, {7, 8, 9, 10}, {0, 1, 1});
+  int32_wrapper scatter_map{2, -4};
+  auto results = cudf::experimental::scatter(
+    cudf::table_view{{source->view()}}, scatter_map, cudf::table_view{{target->view()}});
+
+  auto expected = make_lists({0, 2, 3, 4, 7}, {8, 9, 3, 7, 4, 5, 6}, {1, 1, 0, 1});
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, ScatterNested) {
+  // [[[1], [2, 3]], [[4, 5, 6]], []]
+  auto target = make_lists({0, 2, 3, 3}, make_lists({0, 1, 3, 6}, {1, 2, 3, 4, 5, 6}));
+  // [[[7, 8]]]
+  auto source = make_lists({0, 1}, make_lists({0, 2}, {7, 8}));
+  int32_wrapper scatter_map{1};
+  auto results = cudf::experimental::scatter(
+    cudf::table_view{{source->view()}}, scatter_map, cudf::table_view{{target->view()}});
+
+  auto expected = make_lists({0, 2, 3, 3}, make_lists({0, 1, 3, 5}, {1, 2, 3, 7, 8}));
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, ApplyBooleanMask) {
+  auto lists = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+  cudf::test::fixed_width_column_wrapper<bool> mask{true, false, true, true};
+  auto results = cudf::experimental::apply_boolean_mask(cudf::table_view{{lists->view()}}, mask);
+
+  auto expected = make_lists({0, 2, 2, 5}, {1, 2, 4, 5, 6});
+  expect_lists_equal(results->view().column(0), expected->view());
+}
+
+TEST_F(ListsColumnTest, ContiguousSplit) {
+  auto lists = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6}, {1, 1, 0, 1});
+  auto results =
+    cudf::experimental::contiguous_split(cudf::table_view{{lists->view()}}, {1, 3});
+  EXPECT_EQ(results.size(), 3u);
+
+  auto expected0 = make_lists({0, 2}, {1, 2}, {1});
+  auto expected1 = make_lists({0, 1, 1}, {3}, {1, 0});
+  auto expected2 = make_lists({0, 3}, {4, 5, 6}, {1});
+  expect_lists_equal(results[0].table.column(0), expected0->view());
+  expect_lists_equal(results[1].table.column(0), expected1->view());
+  expect_lists_equal(results[2].table.column(0), expected2->view());
+}
+
+TEST_F(ListsColumnTest, CopySlice) {
+  auto lists  = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+  auto sliced = cudf::experimental::slice(lists->view(), {1, 4}).front();
+  cudf::column copy(sliced);
+
+  auto expected = make_lists({0, 1, 1, 4}, {3, 4, 5, 6});
+  expect_lists_equal(copy.view(), expected->view());
+}
@@ -314,3 +314,59 @@ TYPED_TEST(MergeStringTest, Merge2StringKeyNullColumns) {
   cudf::test::expect_columns_equal(expected_column_view2, output_column_view2);
   cudf::test::expect_columns_equal(expected_column_view3, output_column_view3);
 }
+
+class MergeStringPrefixTest : public cudf::test::BaseFixture {};
+
+// Keys sharing their first 8 bytes are merged by their full strings
+TEST_F(MergeStringPrefixTest, SharedPrefixesAndNulls) {
+  strings_column_wrapper left_keys({"apple", "applesauce_a", "applesauce_b", "banana", ""},
+                                   {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> left_values{0, 1, 2, 3, 4};
+  strings_column_wrapper right_keys({"", "applesauce_a", "applesauce_c", "bananas", ""},
+                                    {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> right_values{10, 11, 12, 13, 14};
+
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::AFTER};
+  auto const merged = cudf::experimental::merge(
+    {cudf::table_view{{left_keys, left_values}}, cudf::table_view{{right_keys, right_values}}},
+    {0},
+    column_order,
+    null_precedence);
+
+  strings_column_wrapper expected_keys({"",
+                                        "apple",
+                                        "applesauce_a",
+                                        "applesauce_a",
+                                        "applesauce_b",
+                                        "applesauce_c",
+                                        "banana",
+                                        "bananas",
+                                        "",
+                                        ""},
+                                       {1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+  fixed_width_column_wrapper<int32_t> expected_values{10, 0, 1, 11, 2, 12, 3, 13, 4, 14};
+  cudf::test::expect_columns_equal(expected_keys, merged->get_column(0));
+  cudf::test::expect_columns_equal(expected_values, merged->get_column(1));
+
+  auto const indices = cudf::experimental::merge_indices(
+    {cudf::table_view{{left_keys}}, cudf::table_view{{right_keys}}}, column_order, null_precedence);
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{1, 0, 0, 1, 0, 1, 0, 1, 0, 1}, indices->get_column(0));
+  cudf::test::expect_columns_equal(
+    fixed_width_column_wrapper<int32_t>{0, 0, 1, 1, 2, 2, 3, 3, 4, 4}, indices->get_column(1));
+}
+
+TEST_F(MergeStringPrefixTest, KWayDescending) {
+  strings_column_wrapper keys0{"zebra_crossing_2", "zebra_crossing_1", "a"};
+  strings_column_wrapper keys1{"zebra_crossing_3", "zebra_crossing_1", "b"};
+  strings_column_wrapper keys2{"zebra", "c"};
+
+  auto const indices = cudf::experimental::merge_indices(
+    {cudf::table_view{{keys0}}, cudf::table_view{{keys1}}, cudf::table_view{{keys2}}},
+    {cudf::order::DESCENDING});
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{1, 0, 0, 1, 2, 2, 1, 0},
+                                   indices->get_column(0));
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 0, 1, 1, 0, 1, 2, 2},
+                                   indices->get_column(1));
+}
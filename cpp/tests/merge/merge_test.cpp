@@ -747,4 +747,74 @@ TYPED_TEST(MergeTest_, NMerge1KeyColumns) {
   cudf::test::expect_columns_equal(expected_column_view2, output_column_view2);
 }
 
+class MergeTest : public cudf::test::BaseFixture {};
+
+TEST_F(MergeTest, KWayMergeNullsAndTies) {
+  using cudf::test::fixed_width_column_wrapper;
+  using cudf::test::strings_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> keys0({1, 2, 2, 5, 0}, {1, 1, 1, 1, 0});
+  strings_column_wrapper names0{"a0", "b0", "c0", "d0", "e0"};
+  fixed_width_column_wrapper<int32_t> keys1({2, 3, 5}, {1, 1, 1});
+  strings_column_wrapper names1{"a1", "b1", "c1"};
+  fixed_width_column_wrapper<int32_t> keys2({0, 1, 2}, {0, 1, 1});
+  strings_column_wrapper names2{"a2", "b2", "c2"};
+  fixed_width_column_wrapper<int32_t> keys3{};
+  strings_column_wrapper names3{};
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{keys0, names0}},
+                                       cudf::table_view{{keys1, names1}},
+                                       cudf::table_view{{keys3, names3}},
+                                       cudf::table_view{{keys2, names2}}};
+  auto const result = cudf::experimental::merge(
+    tables, {0}, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+
+  fixed_width_column_wrapper<int32_t> expected_keys({1, 1, 2, 2, 2, 2, 3, 5, 5, 0, 0},
+                                                    {1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+  strings_column_wrapper expected_names{
+    "a0", "b2", "b0", "c0", "a1", "c2", "b1", "d0", "c1", "e0", "a2"};
+  cudf::test::expect_columns_equal(expected_keys, result->get_column(0));
+  cudf::test::expect_columns_equal(expected_names, result->get_column(1));
+}
+
+TEST_F(MergeTest, MergeIndices) {
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 3, 5};
+  fixed_width_column_wrapper<int32_t> keys1{};
+  fixed_width_column_wrapper<int32_t> keys2{2, 3};
+  fixed_width_column_wrapper<int32_t> keys3{0};
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING};
+
+  auto const single = cudf::experimental::merge_indices({cudf::table_view{{keys0}}}, column_order);
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 0, 0},
+                                   single->get_column(0));
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 1, 2},
+                                   single->get_column(1));
+
+  auto const two = cudf::experimental::merge_indices(
+    {cudf::table_view{{keys0}}, cudf::table_view{{keys2}}}, column_order);
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 1, 0, 1, 0},
+                                   two->get_column(0));
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 0, 1, 1, 2},
+                                   two->get_column(1));
+
+  auto const kway = cudf::experimental::merge_indices({cudf::table_view{{keys0}},
+                                                       cudf::table_view{{keys1}},
+                                                       cudf::table_view{{keys2}},
+                                                       cudf::table_view{{keys3}}},
+                                                      column_order);
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{3, 0, 2, 0, 2, 0},
+                                   kway->get_column(0));
+  cudf::test::expect_columns_equal(fixed_width_column_wrapper<int32_t>{0, 0, 0, 1, 1, 2},
+                                   kway->get_column(1));
+
+  auto const none = cudf::experimental::merge_indices({}, {});
+  EXPECT_EQ(2, none->num_columns());
+  EXPECT_EQ(0, none->num_rows());
+
+  EXPECT_THROW(cudf::experimental::merge_indices({cudf::table_view{{keys0}}}, {}),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
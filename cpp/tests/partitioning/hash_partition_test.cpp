@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/sorting.hpp>
@@ -188,6 +189,84 @@ TEST_F(HashPartition, ColumnsToHash) {
                        second_result->get_column(0).view());
 }
 
+TEST_F(HashPartition, ReturnsHashes) {
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff"});
+  fixed_width_column_wrapper<float> payload({1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  auto input = cudf::table_view({keys, strings, payload});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({1, 0});
+
+  cudf::size_type const num_partitions = 3;
+  std::unique_ptr<cudf::experimental::table> expected, result;
+  std::vector<cudf::size_type> expected_offsets, offsets;
+  std::unique_ptr<cudf::column> hashes;
+  std::tie(expected, expected_offsets) =
+      cudf::experimental::hash_partition(input, columns_to_hash, num_partitions);
+  std::tie(result, offsets, hashes) = cudf::experimental::hash_partition_with_hashes(
+      input, columns_to_hash, num_partitions);
+
+  // Same partitions as hash_partition
+  EXPECT_EQ(expected_offsets, offsets);
+  expect_table_properties_equal(expected->view(), result->view());
+
+  // The hashes are those of the hashed columns of each output row
+  auto const expected_hashes = cudf::hash(result->select(columns_to_hash));
+  expect_columns_equal(*expected_hashes, *hashes);
+}
+
+// Expects the partitions of contiguous_hash_partition to equal those of hash_partition
+void expect_contiguous_partitions_equal(cudf::table_view const& input,
+                                        std::vector<cudf::size_type> const& columns_to_hash,
+                                        cudf::size_type num_partitions) {
+  std::unique_ptr<cudf::experimental::table> expected;
+  std::vector<cudf::size_type> offsets;
+  std::tie(expected, offsets) =
+      cudf::experimental::hash_partition(input, columns_to_hash, num_partitions);
+  auto const result =
+      cudf::experimental::contiguous_hash_partition(input, columns_to_hash, num_partitions);
+
+  ASSERT_EQ(static_cast<size_t>(num_partitions), result.size());
+  std::vector<cudf::size_type> const splits(offsets.begin() + 1, offsets.end());
+  auto const expected_partitions = cudf::experimental::split(expected->view(), splits);
+  for (size_t i = 0; i < result.size(); ++i) {
+    expect_tables_equal(expected_partitions[i], result[i].table);
+  }
+}
+
+TEST_F(HashPartition, ContiguousFixedWidth) {
+  auto iter = thrust::make_counting_iterator(0);
+  auto valids = thrust::make_transform_iterator(iter, [](auto i) { return i % 5 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(iter, iter + 1000);
+  fixed_width_column_wrapper<double> values(iter, iter + 1000, valids);
+  fixed_width_column_wrapper<int8_t> flags(iter, iter + 1000, valids);
+  auto input = cudf::table_view({keys, values, flags});
+
+  expect_contiguous_partitions_equal(input, {0}, 7);
+  expect_contiguous_partitions_equal(input, {0, 1}, 16);
+}
+
+TEST_F(HashPartition, ContiguousMixedColumnTypes) {
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"},
+                                 {1, 1, 0, 1, 1, 0, 1, 1});
+  auto input = cudf::table_view({floats, strings});
+
+  expect_contiguous_partitions_equal(input, {0, 1}, 3);
+}
+
+TEST_F(HashPartition, ContiguousZeroRows) {
+  fixed_width_column_wrapper<float> floats({});
+  auto input = cudf::table_view({floats});
+
+  auto const result = cudf::experimental::contiguous_hash_partition(input, {0}, 3);
+  ASSERT_EQ(3u, result.size());
+  for (auto const& partition : result) {
+    expect_table_properties_equal(input, partition.table);
+  }
+  EXPECT_TRUE(cudf::experimental::contiguous_hash_partition(input, {0}, 0).empty());
+}
+
 template <typename T>
 class HashPartitionFixedWidth : public cudf::test::BaseFixture {};
 
@@ -295,4 +374,129 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls) {
   run_fixed_width_test<TypeParam>(10, 1000, 10, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitions) {
+  run_fixed_width_test<TypeParam>(3, 20000, 5000);
+  run_fixed_width_test<TypeParam>(3, 20000, 4096, true);
+}
+
+// Checks that every output row is in the non-negative remainder of its hash
+// value divided by the number of partitions, as Spark partitions rows
+template <typename hash_type>
+void expect_pmod_partitions(cudf::table_view const& input,
+                            cudf::hash_id hash_function,
+                            cudf::size_type num_partitions) {
+  constexpr uint32_t seed = 42;
+  std::unique_ptr<cudf::experimental::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::experimental::hash_partition(
+      input, {0, 1}, num_partitions, hash_function, seed);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+
+  auto const hashes      = cudf::hash(output->view(), hash_function, seed);
+  auto const host_hashes = cudf::test::to_host<hash_type>(hashes->view()).first;
+  offsets.push_back(output->num_rows());
+  for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+    for (auto row = offsets[partition]; row < offsets[partition + 1]; ++row) {
+      auto const remainder = host_hashes[row] % num_partitions;
+      EXPECT_EQ(partition, remainder < 0 ? remainder + num_partitions : remainder);
+    }
+  }
+}
+
+TEST_F(HashPartition, SparkMurmur3) {
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> integers(
+      {0, 100, -100, limits::min(), limits::max(), 7, 8, 9},
+      {1, 1, 1, 1, 1, 0, 1, 1});
+  strings_column_wrapper strings(
+      {"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto input = cudf::table_view({integers, strings});
+
+  expect_pmod_partitions<int32_t>(input, cudf::hash_id::HASH_SPARK_MURMUR3, 7);
+  expect_pmod_partitions<int32_t>(input, cudf::hash_id::HASH_SPARK_MURMUR3, 4);
+}
+
+TEST_F(HashPartition, XXHash64) {
+  fixed_width_column_wrapper<int64_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings(
+      {"a", "bb", "ccc", "d", "ee", "fff", "gg",
+       "a string longer than the 32 bytes of a stripe"},
+      {1, 1, 0, 1, 1, 1, 1, 1});
+  auto input = cudf::table_view({integers, strings});
+
+  expect_pmod_partitions<int64_t>(input, cudf::hash_id::HASH_XXHASH64, 5);
+  expect_pmod_partitions<int64_t>(input, cudf::hash_id::HASH_XXHASH64, 8);
+}
+
+TEST_F(HashPartition, ChunkedTable) {
+  fixed_width_column_wrapper<int32_t> integers(
+      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 1, 2, 3},
+      {1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<double> floats(
+      {1., 2., 3., 4., 5., 6., 7., 8., 9., 10., 11., 12., 13., 14., 15.});
+  strings_column_wrapper strings(
+      {"a", "bb", "ccc", "d", "ee", "fff", "gg", "h", "i", "jj", "kkk", "l", "a", "bb", "ccc"},
+      {1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  auto input = cudf::table_view({integers, floats, strings});
+  auto const chunks = cudf::experimental::slice(input, {0, 4, 4, 4, 4, 11, 11, 15});
+  cudf::chunked_table_view const chunked(chunks);
+
+  std::vector<cudf::size_type> const columns_to_hash({0, 2});
+  cudf::size_type const num_partitions = 4;
+  std::unique_ptr<cudf::experimental::table> expected, result;
+  std::vector<cudf::size_type> expected_offsets, offsets;
+  std::tie(expected, expected_offsets) = cudf::experimental::hash_partition(
+      input, columns_to_hash, num_partitions);
+  std::tie(result, offsets) = cudf::experimental::hash_partition(
+      chunked, columns_to_hash, num_partitions);
+
+  // The partitions have the rows of the partitions of the whole table
+  ASSERT_EQ(expected_offsets, offsets);
+  expect_table_properties_equal(input, result->view());
+  offsets.push_back(input.num_rows());
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const expected_partition = cudf::experimental::slice(
+        expected->view(), {offsets[p], offsets[p + 1]}).front();
+    auto const partition = cudf::experimental::slice(
+        result->view(), {offsets[p], offsets[p + 1]}).front();
+    expect_tables_equal(cudf::experimental::sort(expected_partition)->view(),
+                        cudf::experimental::sort(partition)->view());
+  }
+}
+
+TEST_F(HashPartition, ManyPartitions) {
+  // More partitions than the shared memory histograms of a block can count
+  constexpr cudf::size_type num_rows       = 50000;
+  constexpr cudf::size_type num_partitions = 20000;
+  auto iter = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int64_t> integers(iter, iter + num_rows);
+  auto strings_iter = thrust::make_transform_iterator(
+      iter, [](auto i) { return std::to_string(i % 1000); });
+  strings_column_wrapper strings(strings_iter, strings_iter + num_rows);
+  auto input = cudf::table_view({integers, strings});
+
+  std::unique_ptr<cudf::experimental::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) =
+      cudf::experimental::hash_partition(input, {0, 1}, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+  EXPECT_EQ(0, offsets[0]);
+  EXPECT_TRUE(std::is_sorted(offsets.begin(), offsets.end()));
+
+  // Every output row is in the partition of its hash value
+  auto const hashes = cudf::hash(output->view());
+  auto const host_hashes = cudf::test::to_host<int32_t>(hashes->view()).first;
+  offsets.push_back(num_rows);
+  for (cudf::size_type partition = 0; partition < num_partitions; ++partition) {
+    for (auto row = offsets[partition]; row < offsets[partition + 1]; ++row) {
+      EXPECT_EQ(static_cast<uint32_t>(partition),
+                static_cast<uint32_t>(host_hashes[row]) % num_partitions);
+    }
+  }
+
+  // The output has the rows of the input
+  expect_tables_equal(cudf::experimental::sort(input)->view(),
+                      cudf::experimental::sort(output->view())->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using cudf::test::expect_table_properties_equal;
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+class RangePartition : public cudf::test::BaseFixture {};
+
+TEST_F(RangePartition, InvalidSortKeys) {
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d"});
+  auto input = cudf::table_view({integers, strings});
+
+  EXPECT_THROW(cudf::experimental::range_partition(input, {2}, 3), std::out_of_range);
+  EXPECT_THROW(cudf::experimental::range_partition(
+                 input, {0}, 3, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+               cudf::logic_error);
+}
+
+TEST_F(RangePartition, ZeroPartitions) {
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4});
+  auto input = cudf::table_view({integers});
+
+  auto result = cudf::experimental::range_partition(input, {0}, 0);
+
+  EXPECT_EQ(0, result.first->num_rows());
+  EXPECT_TRUE(result.second.empty());
+  expect_table_properties_equal(input, result.first->view());
+}
+
+TEST_F(RangePartition, PartitionsAreOrdered) {
+  auto const num_rows = 10000;
+  std::vector<int32_t> h_keys(num_rows);
+  std::vector<int64_t> h_payload(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    h_keys[i]    = (i * 7919) % num_rows;
+    h_payload[i] = 2 * h_keys[i];
+  }
+  fixed_width_column_wrapper<int64_t> payload(h_payload.begin(), h_payload.end());
+  fixed_width_column_wrapper<int32_t> keys(h_keys.begin(), h_keys.end());
+  auto input = cudf::table_view({payload, keys});
+
+  auto const num_partitions = 8;
+  auto result = cudf::experimental::range_partition(input, {1}, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), result.second.size());
+  EXPECT_EQ(0, result.second.front());
+  ASSERT_EQ(num_rows, result.first->num_rows());
+
+  auto const out_payload = cudf::test::to_host<int64_t>(result.first->get_column(0)).first;
+  auto const out_keys    = cudf::test::to_host<int32_t>(result.first->get_column(1)).first;
+  auto offsets           = result.second;
+  offsets.push_back(num_rows);
+  int32_t previous_max = -1;
+  for (int p = 0; p < num_partitions; ++p) {
+    auto const begin = out_keys.begin() + offsets[p];
+    auto const end   = out_keys.begin() + offsets[p + 1];
+    // The splitters are selected from a sample, so the sizes are only roughly equal
+    EXPECT_GT(offsets[p + 1] - offsets[p], num_rows / num_partitions / 2);
+    EXPECT_LT(offsets[p + 1] - offsets[p], num_rows / num_partitions * 2);
+    EXPECT_LT(previous_max, *std::min_element(begin, end));
+    previous_max = *std::max_element(begin, end);
+  }
+  for (int i = 0; i < num_rows; ++i) { EXPECT_EQ(out_payload[i], 2 * out_keys[i]); }
+}
+
+TEST_F(RangePartition, EquivalentKeysInSamePartition) {
+  auto const num_rows = 3000;
+  std::vector<int16_t> h_keys(num_rows);
+  for (int i = 0; i < num_rows; ++i) { h_keys[i] = i % 3; }
+  fixed_width_column_wrapper<int16_t> keys(h_keys.begin(), h_keys.end());
+  auto input = cudf::table_view({keys});
+
+  auto const num_partitions = 10;
+  auto result = cudf::experimental::range_partition(input, {0}, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), result.second.size());
+
+  auto const out_keys = cudf::test::to_host<int16_t>(result.first->get_column(0)).first;
+  auto offsets        = result.second;
+  offsets.push_back(num_rows);
+  std::vector<int> partition_of_key(3, -1);
+  for (int p = 0; p < num_partitions; ++p) {
+    for (auto i = offsets[p]; i < offsets[p + 1]; ++i) {
+      auto const key = out_keys[i];
+      if (partition_of_key[key] < 0) { partition_of_key[key] = p; }
+      EXPECT_EQ(partition_of_key[key], p);
+    }
+  }
+  EXPECT_LT(partition_of_key[0], partition_of_key[1]);
+  EXPECT_LT(partition_of_key[1], partition_of_key[2]);
+}
+
+TEST_F(RangePartition, DescendingNullsAfter) {
+  auto const num_rows = 2000;
+  std::vector<int32_t> h_keys(num_rows);
+  std::vector<bool> h_valid(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    h_keys[i]  = (i * 37) % num_rows;
+    h_valid[i] = i % 10 != 0;
+  }
+  fixed_width_column_wrapper<int32_t> keys(h_keys.begin(), h_keys.end(), h_valid.begin());
+  auto input = cudf::table_view({keys});
+
+  auto const num_partitions = 4;
+  auto result               = cudf::experimental::range_partition(
+    input, {0}, num_partitions, {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+  ASSERT_EQ(static_cast<size_t>(num_partitions), result.second.size());
+
+  // In descending order, nulls ordered after the other elements come first
+  auto const out      = cudf::test::to_host<int32_t>(result.first->get_column(0));
+  auto const is_valid = [&](cudf::size_type i) { return (out.second[i / 32] >> (i % 32)) & 1; };
+  auto offsets        = result.second;
+  offsets.push_back(num_rows);
+  bool nulls_done      = false;
+  int32_t previous_min = num_rows;
+  for (int p = 0; p < num_partitions; ++p) {
+    int32_t partition_max = -1;
+    int32_t partition_min = num_rows;
+    for (auto i = offsets[p]; i < offsets[p + 1]; ++i) {
+      if (not is_valid(i)) {
+        EXPECT_FALSE(nulls_done);
+        continue;
+      }
+      partition_max = std::max(partition_max, out.first[i]);
+      partition_min = std::min(partition_min, out.first[i]);
+    }
+    if (partition_max >= 0) {
+      nulls_done = true;
+      EXPECT_GT(previous_min, partition_max);
+      previous_min = partition_min;
+    }
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/concatenate.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <exception>
+#include <set>
+#include <thread>
+#include <vector>
+
+using cudf::test::expect_tables_equal;
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ShuffleTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+/**
+ * @brief Shuffles the tables with one thread per rank, all on the current device
+ */
+std::vector<std::unique_ptr<cudf::experimental::table>> shuffle_on_threads(
+  std::vector<cudf::table_view> const& inputs) {
+  int device = 0;
+  cudaGetDevice(&device);
+  auto comms = cudf::experimental::make_peer_communicators(std::vector<int>(inputs.size(), device));
+
+  std::vector<std::unique_ptr<cudf::experimental::table>> results(inputs.size());
+  std::vector<std::exception_ptr> errors(inputs.size());
+  std::vector<std::thread> threads;
+  for (std::size_t rank = 0; rank < inputs.size(); ++rank) {
+    threads.emplace_back([&, rank] {
+      try {
+        cudaSetDevice(device);
+        results[rank] = cudf::experimental::shuffle(inputs[rank], {0}, *comms[rank]);
+      } catch (...) {
+        errors[rank] = std::current_exception();
+      }
+    });
+  }
+  for (auto& t : threads) { t.join(); }
+  for (auto const& e : errors) {
+    if (e) { std::rethrow_exception(e); }
+  }
+  return results;
+}
+
+}  // namespace
+
+TEST_F(ShuffleTest, EqualKeysAtSameRank) {
+  fixed_width_column_wrapper<int32_t> keys0({1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 1, 0, 1, 1, 1, 1});
+  strings_column_wrapper values0({"a", "b", "c", "d", "e", "f", "g", "h"});
+  fixed_width_column_wrapper<int32_t> keys1({8, 7, 1, 1, 9});
+  strings_column_wrapper values1({"i", "j", "k", "l", "m"});
+  fixed_width_column_wrapper<int32_t> keys2{};
+  strings_column_wrapper values2{};
+  std::vector<cudf::table_view> inputs{cudf::table_view{{keys0, values0}},
+                                       cudf::table_view{{keys1, values1}},
+                                       cudf::table_view{{keys2, values2}}};
+
+  auto const results = shuffle_on_threads(inputs);
+  ASSERT_EQ(results.size(), inputs.size());
+
+  // Each key is at one rank only
+  std::set<int32_t> seen;
+  for (auto const& result : results) {
+    auto const keys = cudf::test::to_host<int32_t>(result->get_column(0));
+    std::set<int32_t> rank_keys;
+    for (cudf::size_type i = 0; i < result->num_rows(); ++i) {
+      if (keys.second.empty() || cudf::bit_is_set(keys.second.data(), i)) {
+        rank_keys.insert(keys.first[i]);
+      }
+    }
+    for (auto key : rank_keys) { EXPECT_TRUE(seen.insert(key).second); }
+  }
+
+  // The rows are those of the inputs
+  std::vector<cudf::table_view> result_views;
+  for (auto const& result : results) { result_views.push_back(result->view()); }
+  auto const expected = cudf::experimental::concatenate(inputs);
+  auto const actual   = cudf::experimental::concatenate(result_views);
+  expect_tables_equal(cudf::experimental::sort(expected->view())->view(),
+                      cudf::experimental::sort(actual->view())->view());
+}
+
+TEST_F(ShuffleTest, SingleRank) {
+  fixed_width_column_wrapper<int64_t> keys({5, 3, 1, 3});
+  cudf::table_view input{{keys}};
+  auto const results = shuffle_on_threads({input});
+  ASSERT_EQ(results.size(), 1u);
+  expect_tables_equal(cudf::experimental::sort(input)->view(),
+                      cudf::experimental::sort(results.front()->view())->view());
+}
+
+TEST_F(ShuffleTest, PartitionsPerRank) {
+  int device = 0;
+  cudaGetDevice(&device);
+  auto comms = cudf::experimental::make_peer_communicators({device, device});
+  EXPECT_EQ(comms[0]->size(), 2);
+  EXPECT_EQ(comms[1]->rank(), 1);
+  EXPECT_THROW(comms[0]->all_to_all(nullptr, {}, rmm::mr::get_default_resource(), 0),
+               cudf::logic_error);
+}
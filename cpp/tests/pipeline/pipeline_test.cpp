@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/pipeline.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/cnmem_memory_resource.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+namespace {
+
+// Returns copies of the chunks given at construction, counting the reads
+class table_source : public experimental::pipeline_source {
+ public:
+  explicit table_source(std::vector<table_view> chunks, size_type throw_at = -1)
+    : _chunks(std::move(chunks)), _throw_at(throw_at) {}
+
+  bool has_next() override { return _next < static_cast<size_type>(_chunks.size()); }
+
+  std::unique_ptr<experimental::table> next(cudaStream_t stream) override {
+    if (_next == _throw_at) { throw std::runtime_error("source failure"); }
+    return std::make_unique<experimental::table>(_chunks[_next++], stream);
+  }
+
+  size_type num_read() const { return _next; }
+
+ private:
+  std::vector<table_view> _chunks;
+  size_type _throw_at;
+  size_type _next = 0;
+};
+
+class counting_sink : public experimental::pipeline_sink {
+ public:
+  void consume(table_view const&) override { ++num_consumed; }
+  size_type num_consumed = 0;
+};
+
+class throwing_sink : public experimental::pipeline_sink {
+ public:
+  void consume(table_view const&) override { throw std::runtime_error("sink failure"); }
+};
+
+}  // namespace
+
+struct PipelineTest : public BaseFixture {
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1};
+  fixed_width_column_wrapper<int64_t> vals0{1, 3, 5};
+  fixed_width_column_wrapper<int32_t> keys1{2, 2};
+  fixed_width_column_wrapper<int64_t> vals1{4, 0};
+  fixed_width_column_wrapper<int32_t> keys2{3};
+  fixed_width_column_wrapper<int64_t> vals2{7};
+
+  std::vector<table_view> chunks() const {
+    return {table_view{{keys0, vals0}}, table_view{{keys1, vals1}}, table_view{{keys2, vals2}}};
+  }
+};
+
+TEST_F(PipelineTest, FilterProjectAggregate) {
+  // Sums 10 * value by key for the rows whose value is greater than 2
+  numeric_scalar<int64_t> two(2);
+  numeric_scalar<int64_t> ten(10);
+  using experimental::expression;
+  auto const filter    = expression::operation(experimental::binary_operator::GREATER,
+                                               expression::column_reference(1),
+                                               expression::literal(two),
+                                               data_type{BOOL8});
+  auto const times_ten = expression::operation(experimental::binary_operator::MUL,
+                                               expression::column_reference(1),
+                                               expression::literal(ten),
+                                               data_type{INT64});
+  experimental::pipeline_options options;
+  options.filter      = &filter;
+  options.projections = {&times_ten};
+
+  std::vector<std::vector<std::unique_ptr<experimental::aggregation>>> aggregations(1);
+  aggregations[0].push_back(experimental::make_sum_aggregation());
+  experimental::groupby::streaming_groupby gb(std::move(aggregations));
+  experimental::groupby_sink sink(gb, {0}, {2});
+
+  table_source source(chunks());
+  experimental::run_pipeline(source, sink, options);
+  EXPECT_EQ(3, source.num_read());
+
+  auto const result = gb.finalize();
+  auto const sorted = experimental::sort_by_key(
+    table_view({result.first->get_column(0), *result.second[0].results[0]}), result.first->view());
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_sums{50, 70, 70};
+  expect_columns_equal(sorted->get_column(0), expect_keys);
+  expect_columns_equal(sorted->get_column(1), expect_sums);
+}
+
+TEST_F(PipelineTest, PoolResourceManyChunks) {
+  // The chunks are allocated on the reader stream from a pool, which reuses
+  // the memory of the consumed chunks for the next ones
+  auto resource = std::make_unique<rmm::mr::cnmem_memory_resource>();
+  auto previous = rmm::mr::set_default_resource(resource.get());
+  {
+    constexpr size_type num_chunks = 16;
+    constexpr size_type chunk_rows = 100000;
+    std::vector<std::unique_ptr<experimental::table>> tables;
+    std::vector<table_view> views;
+    auto const key_iter = make_counting_transform_iterator(0, [](auto i) { return i % 4; });
+    for (size_type c = 0; c < num_chunks; ++c) {
+      auto const val_iter = make_counting_transform_iterator(
+        0, [c](auto i) { return static_cast<int64_t>(c) * chunk_rows + i; });
+      fixed_width_column_wrapper<int32_t> keys(key_iter, key_iter + chunk_rows);
+      fixed_width_column_wrapper<int64_t> vals(val_iter, val_iter + chunk_rows);
+      std::vector<std::unique_ptr<column>> columns;
+      columns.push_back(keys.release());
+      columns.push_back(vals.release());
+      tables.push_back(std::make_unique<experimental::table>(std::move(columns)));
+      views.push_back(tables.back()->view());
+    }
+
+    // Sums 10 * value by key for the rows whose value is greater than 2
+    numeric_scalar<int64_t> two(2);
+    numeric_scalar<int64_t> ten(10);
+    using experimental::expression;
+    auto const filter    = expression::operation(experimental::binary_operator::GREATER,
+                                                 expression::column_reference(1),
+                                                 expression::literal(two),
+                                                 data_type{BOOL8});
+    auto const times_ten = expression::operation(experimental::binary_operator::MUL,
+                                                 expression::column_reference(1),
+                                                 expression::literal(ten),
+                                                 data_type{INT64});
+    experimental::pipeline_options options;
+    options.filter               = &filter;
+    options.projections          = {&times_ten};
+    options.max_chunks_in_flight = 2;
+
+    std::vector<std::vector<std::unique_ptr<experimental::aggregation>>> aggregations(1);
+    aggregations[0].push_back(experimental::make_sum_aggregation());
+    experimental::groupby::streaming_groupby gb(std::move(aggregations));
+    experimental::groupby_sink sink(gb, {0}, {2});
+
+    table_source source(views);
+    experimental::run_pipeline(source, sink, options);
+    EXPECT_EQ(num_chunks, source.num_read());
+
+    std::vector<int64_t> sums(4, 0);
+    for (int64_t value = 3; value < int64_t{num_chunks} * chunk_rows; ++value) {
+      sums[value % 4] += 10 * value;
+    }
+    auto const result = gb.finalize();
+    auto const sorted = experimental::sort_by_key(
+      table_view({result.first->get_column(0), *result.second[0].results[0]}),
+      result.first->view());
+    fixed_width_column_wrapper<int32_t> expect_keys{0, 1, 2, 3};
+    fixed_width_column_wrapper<int64_t> expect_sums(sums.begin(), sums.end());
+    expect_columns_equal(sorted->get_column(0), expect_keys);
+    expect_columns_equal(sorted->get_column(1), expect_sums);
+  }
+  rmm::mr::set_default_resource(previous);
+}
+
+TEST_F(PipelineTest, ProbeJoin) {
+  fixed_width_column_wrapper<int32_t> build_keys{1, 3};
+  fixed_width_column_wrapper<int32_t> build_payload{100, 300};
+  table_view const build{{build_keys, build_payload}};
+  experimental::hash_join join(build, {0});
+
+  experimental::pipeline_options options;
+  options.columns              = {0};
+  options.max_chunks_in_flight = 1;
+  experimental::join_probe_sink sink(join, {0});
+
+  table_source source(chunks());
+  experimental::run_pipeline(source, sink, options);
+
+  auto const results = sink.release();
+  ASSERT_EQ(3u, results.size());
+  std::vector<size_type> const expect_rows{2, 0, 1};
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(expect_rows[i], results[i]->num_rows());
+    EXPECT_EQ(3, results[i]->num_columns());
+  }
+}
+
+TEST_F(PipelineTest, Errors) {
+  counting_sink sink;
+  experimental::pipeline_options options;
+  options.max_chunks_in_flight = 0;
+  table_source source(chunks());
+  EXPECT_THROW(experimental::run_pipeline(source, sink, options), cudf::logic_error);
+
+  // The chunks read before the source failed are consumed
+  table_source failing_source(chunks(), 1);
+  EXPECT_THROW(experimental::run_pipeline(failing_source, sink), std::runtime_error);
+  EXPECT_EQ(1, sink.num_consumed);
+
+  // The source stops once the sink has failed
+  options.max_chunks_in_flight = 1;
+  throwing_sink failing_sink;
+  table_source stopped_source(chunks());
+  EXPECT_THROW(experimental::run_pipeline(stopped_source, failing_sink, options),
+               std::runtime_error);
+  EXPECT_LE(stopped_source.num_read(), 2);
+}
+
+}  // namespace test
+}  // namespace cudf
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -29,6 +29,8 @@
 #include <cudf/quantiles.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <limits>
+
 using namespace cudf;
 using namespace test;
 
@@ -191,3 +193,99 @@ TYPED_TEST(QuantilesTest, TestMultiColumnAssumedSorted)
 
     expect_tables_equal(expected, actual->view());
 }
+
+template <typename T>
+struct QuantilesSelectTest : public BaseFixture {
+};
+
+using SelectTypes = Concat<IntegralTypes, FloatingPointTypes, TimestampTypes>;
+
+TYPED_TEST_CASE(QuantilesSelectTest, SelectTypes);
+
+TYPED_TEST(QuantilesSelectTest, TestSingleColumnUnsorted)
+{
+    using T = TypeParam;
+
+    auto input_a = fixed_width_column_wrapper<T>(
+        {  5,  -2,   3,   0,   0,  -7,   4,   0,   1,   2 },
+        {  1,   1,   1,   0,   1,   1,   1,   0,   1,   1 });
+
+    auto input = table_view({ input_a });
+
+    // [null, null, -7, -2, 0, 1, 2, 3, 4, 5]
+    auto actual = experimental::quantiles(input,
+                                          { 0.0f, 0.5f, 0.25f, 1.0f },
+                                          experimental::interpolation::HIGHER);
+
+    auto expected_a = fixed_width_column_wrapper<T>(
+        {  0,   1,  -2,   5 },
+        {  0,   1,   1,   1 });
+
+    expect_tables_equal(table_view({ expected_a }), actual->view());
+}
+
+TYPED_TEST(QuantilesSelectTest, TestSingleColumnDescending)
+{
+    using T = TypeParam;
+
+    auto input_a = fixed_width_column_wrapper<T>(
+        {  5,  -2,   3,   0,   0,  -7,   4,   0,   1,   2 },
+        {  1,   1,   1,   0,   1,   1,   1,   0,   1,   1 });
+
+    auto input = table_view({ input_a });
+
+    // [null, null, 5, 4, 3, 2, 1, 0, -2, -7]
+    auto nulls_first = experimental::quantiles(input,
+                                               { 0.0f, 0.5f, 0.25f, 1.0f },
+                                               experimental::interpolation::HIGHER,
+                                               sorted::NO,
+                                               { order::DESCENDING },
+                                               { null_order::AFTER });
+
+    auto expected_first = fixed_width_column_wrapper<T>(
+        {  0,   2,   4,  -7 },
+        {  0,   1,   1,   1 });
+
+    expect_tables_equal(table_view({ expected_first }), nulls_first->view());
+
+    // [5, 4, 3, 2, 1, 0, -2, -7, null, null]
+    auto nulls_last = experimental::quantiles(input,
+                                              { 0.0f, 0.5f, 0.25f, 1.0f },
+                                              experimental::interpolation::HIGHER,
+                                              sorted::NO,
+                                              { order::DESCENDING },
+                                              { null_order::BEFORE });
+
+    auto expected_last = fixed_width_column_wrapper<T>(
+        {  5,   0,   2,   0 },
+        {  1,   1,   1,   0 });
+
+    expect_tables_equal(table_view({ expected_last }), nulls_last->view());
+}
+
+template <typename T>
+struct QuantilesSelectFloatTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(QuantilesSelectFloatTest, FloatingPointTypes);
+
+TYPED_TEST(QuantilesSelectFloatTest, TestSpecialValues)
+{
+    using T = TypeParam;
+
+    auto const nan = std::numeric_limits<T>::quiet_NaN();
+    auto const inf = std::numeric_limits<T>::infinity();
+
+    auto input_a = fixed_width_column_wrapper<T>({ nan, T(2), T(-0.0), T(-1), inf });
+
+    auto input = table_view({ input_a });
+
+    // [-1, -0.0, 2, inf, nan]
+    auto actual = experimental::quantiles(input,
+                                          { 0.0f, 0.25f, 0.75f, 1.0f },
+                                          experimental::interpolation::LOWER);
+
+    auto expected_a = fixed_width_column_wrapper<T>({ T(-1), T(-0.0), inf, nan });
+
+    expect_tables_equal(table_view({ expected_a }), actual->view());
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <cmath>
+
+namespace {
+
+// 0, 1, ..., size - 1 in a scrambled order
+auto scrambled(cudf::size_type size) {
+  return cudf::test::make_counting_transform_iterator(
+    0, [size](auto i) { return static_cast<double>((i * 7919) % size); });
+}
+
+std::vector<double> to_host(cudf::column_view const& col) {
+  thrust::host_vector<double> h_data;
+  std::tie(h_data, std::ignore) = cudf::test::to_host<double>(col);
+  return std::vector<double>(h_data.begin(), h_data.end());
+}
+
+}  // namespace
+
+template <typename T>
+struct TDigestTest : public cudf::test::BaseFixture {};
+
+using TDigestTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(TDigestTest, TDigestTypes);
+
+struct TDigestDoubleTest : public cudf::test::BaseFixture {};
+
+struct TDigestErrorTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST(TDigestTest, ExactForFewValues) {
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> values({4, 0, 3, 1, 2, 9}, {1, 1, 1, 1, 1, 0});
+
+  auto digest = cudf::experimental::make_tdigest(values);
+  auto result = cudf::experimental::approx_quantiles(*digest, {0, 0.1, 0.5, 1});
+
+  cudf::test::fixed_width_column_wrapper<double> expected{0., 0.4, 2., 4.};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(TDigestDoubleTest, Accuracy) {
+  cudf::size_type constexpr size = 10000;
+  cudf::test::fixed_width_column_wrapper<double> values(scrambled(size), scrambled(size) + size);
+
+  auto digest = cudf::experimental::make_tdigest(values, 100);
+  std::vector<double> const q{0.01, 0.25, 0.5, 0.75, 0.99};
+  auto const result = to_host(*cudf::experimental::approx_quantiles(*digest, q));
+
+  ASSERT_EQ(result.size(), q.size());
+  for (size_t i = 0; i < q.size(); ++i) {
+    EXPECT_NEAR(result[i], q[i] * (size - 1), 0.01 * size);
+  }
+}
+
+TEST_F(TDigestDoubleTest, MergeMatchesSingleDigest) {
+  cudf::size_type constexpr size = 10000;
+  cudf::test::fixed_width_column_wrapper<double> values(scrambled(size), scrambled(size) + size);
+  auto keys_begin = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4; });
+  cudf::test::fixed_width_column_wrapper<int32_t> keys(keys_begin, keys_begin + size);
+
+  // One digest of each partition, merged as on the nodes of a distributed query
+  std::vector<cudf::experimental::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::experimental::make_tdigest_aggregation(100));
+  cudf::experimental::groupby::groupby gb(cudf::table_view({keys}));
+  auto partials = gb.aggregate(requests);
+  auto merged   = cudf::experimental::merge_tdigests(*partials.second[0].results[0], 100);
+
+  std::vector<double> const q{0.01, 0.5, 0.99};
+  auto const result = to_host(*cudf::experimental::approx_quantiles(*merged, q));
+  auto const whole  = to_host(
+    *cudf::experimental::approx_quantiles(*cudf::experimental::make_tdigest(values, 100), q));
+
+  ASSERT_EQ(result.size(), q.size());
+  for (size_t i = 0; i < q.size(); ++i) {
+    EXPECT_NEAR(result[i], q[i] * (size - 1), 0.01 * size);
+    EXPECT_NEAR(result[i], whole[i], 0.01 * size);
+  }
+}
+
+TEST_F(TDigestDoubleTest, EmptyDigest) {
+  cudf::test::fixed_width_column_wrapper<double> values({1, 2}, {0, 0});
+
+  auto digest = cudf::experimental::make_tdigest(values);
+  auto result = cudf::experimental::approx_quantiles(*digest, {0.5});
+
+  cudf::test::fixed_width_column_wrapper<double> expected({0}, {0});
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(TDigestDoubleTest, Reduction) {
+  cudf::test::fixed_width_column_wrapper<double> values({5, 1, 3, 2, 4}, {1, 1, 1, 0, 1});
+
+  auto agg    = cudf::experimental::make_approx_quantile_aggregation({0.5});
+  auto result = cudf::experimental::reduce(values, agg, cudf::data_type{cudf::FLOAT64});
+
+  auto const& quantile = static_cast<cudf::numeric_scalar<double> const&>(*result);
+  EXPECT_TRUE(quantile.is_valid());
+  EXPECT_EQ(quantile.value(), 3.5);
+}
+
+TEST_F(TDigestErrorTest, InvalidArguments) {
+  cudf::test::fixed_width_column_wrapper<double> values{1, 2, 3};
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+
+  EXPECT_THROW(cudf::experimental::make_tdigest(values, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::make_tdigest(strings), cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::merge_tdigests(values), cudf::logic_error);
+  auto digest = cudf::experimental::make_tdigest(values);
+  EXPECT_THROW(cudf::experimental::approx_quantiles(*digest, {1.5}), cudf::logic_error);
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+
+struct DescribeTest : public cudf::test::BaseFixture {};
+
+TEST_F(DescribeTest, Chunks) {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({5, 1, 0, 7, 3}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<float> floats({1.5, -2, 3, 4, 0}, {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper strings({"b", "a", "d", "", "c"}, {1, 1, 1, 0, 1});
+  cudf::table_view input{{ints, floats, strings}};
+
+  // 3 chunks, then the whole column
+  auto results = cudf::experimental::describe(input, 2);
+  ASSERT_EQ(3u, results.size());
+
+  using int32_wrapper  = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using int64_wrapper  = cudf::test::fixed_width_column_wrapper<int64_t>;
+  using double_wrapper = cudf::test::fixed_width_column_wrapper<double>;
+  cudf::test::expect_columns_equal(int32_wrapper({0, 1, 0, 1}), *results[0].null_count);
+  cudf::test::expect_columns_equal(int64_wrapper({1, 7, 3, 1}), *results[0].min);
+  cudf::test::expect_columns_equal(int64_wrapper({5, 7, 3, 7}), *results[0].max);
+  cudf::test::expect_columns_equal(int64_wrapper({6, 7, 3, 16}), *results[0].sum);
+
+  cudf::test::expect_columns_equal(int32_wrapper({0, 0, 1, 1}), *results[1].null_count);
+  cudf::test::expect_columns_equal(double_wrapper({-2, 3, 0, -2}, {1, 1, 0, 1}), *results[1].min);
+  cudf::test::expect_columns_equal(double_wrapper({1.5, 4, 0, 4}, {1, 1, 0, 1}), *results[1].max);
+  cudf::test::expect_columns_equal(double_wrapper({-0.5, 7, 0, 6.5}, {1, 1, 0, 1}),
+                                   *results[1].sum);
+
+  cudf::test::expect_columns_equal(int32_wrapper({0, 1, 0, 1}), *results[2].null_count);
+  cudf::test::expect_columns_equal(cudf::test::strings_column_wrapper({"a", "d", "c", "a"}),
+                                   *results[2].min);
+  cudf::test::expect_columns_equal(cudf::test::strings_column_wrapper({"b", "d", "c", "d"}),
+                                   *results[2].max);
+  cudf::test::expect_columns_equal(int64_wrapper({2, 1, 1, 4}), *results[2].sum);
+}
+
+TEST_F(DescribeTest, SlicedColumns) {
+  cudf::test::fixed_width_column_wrapper<int64_t> ints({9, 5, 1, 0, 7, 3}, {1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper strings({"z", "b", "a", "d", "", "c"}, {1, 1, 1, 1, 0, 1});
+  cudf::table_view table{{ints, strings}};
+  auto input = cudf::experimental::slice(table, {1, 6}).front();
+
+  // A single chunk, then the whole column
+  auto results = cudf::experimental::describe(input);
+  ASSERT_EQ(2u, results.size());
+
+  using int64_wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+  cudf::test::expect_columns_equal(cudf::test::fixed_width_column_wrapper<int32_t>({1, 1}),
+                                   *results[0].null_count);
+  cudf::test::expect_columns_equal(int64_wrapper({1, 1}), *results[0].min);
+  cudf::test::expect_columns_equal(int64_wrapper({7, 7}), *results[0].max);
+  cudf::test::expect_columns_equal(int64_wrapper({16, 16}), *results[0].sum);
+  cudf::test::expect_columns_equal(cudf::test::strings_column_wrapper({"a", "a"}),
+                                   *results[1].min);
+  cudf::test::expect_columns_equal(cudf::test::strings_column_wrapper({"d", "d"}),
+                                   *results[1].max);
+}
+
+TEST_F(DescribeTest, Errors) {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  cudf::table_view input{{ints}};
+  EXPECT_THROW(cudf::experimental::describe(input, -1), cudf::logic_error);
+}
@@ -25,6 +25,8 @@
 
 #include <cudf/cudf.h>
 #include <cudf/reduction.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
 #include <thrust/device_vector.h>
@@ -753,4 +755,193 @@ TEST_F(StringReductionTest, AllNull)
   EXPECT_FALSE(maxresult->is_valid());
 }
 
+template <typename T>
+struct MultiReductionTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_CASE(MultiReductionTest, cudf::test::NumericTypes);
+
+template <typename T_out>
+void expect_scalars_equal(cudf::scalar const& expected, cudf::scalar const& got)
+{
+    using ScalarType = cudf::experimental::scalar_type_t<T_out>;
+    ASSERT_EQ(expected.is_valid(), got.is_valid());
+    EXPECT_EQ(static_cast<ScalarType const&>(expected).value(),
+              static_cast<ScalarType const&>(got).value());
+}
+
+// Each fused reduction returns the scalar of the reduction computed alone
+TYPED_TEST(MultiReductionTest, SameAsSingleReductions)
+{
+    using T = TypeParam;
+    std::vector<int> int_values({-3, 2, 1, 0, 5, -3, -2, 28});
+    std::vector<bool> host_bools({1, 1, 0, 1, 1, 1, 0, 1});
+    std::vector<T> v = convert_values<T>(int_values);
+    cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+    cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+
+    auto const dtype = cudf::column_view(col).type();
+    auto const float64 = cudf::data_type(cudf::FLOAT64);
+    auto const int64 = cudf::data_type(cudf::INT64);
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(cudf::experimental::make_min_aggregation());
+    aggs.push_back(cudf::experimental::make_max_aggregation());
+    aggs.push_back(cudf::experimental::make_sum_aggregation());
+    aggs.push_back(cudf::experimental::make_sum_aggregation());
+    aggs.push_back(cudf::experimental::make_product_aggregation());
+    aggs.push_back(cudf::experimental::make_sum_of_squares_aggregation());
+    aggs.push_back(cudf::experimental::make_mean_aggregation());
+    aggs.push_back(cudf::experimental::make_variance_aggregation());
+    aggs.push_back(cudf::experimental::make_std_aggregation(0));
+    std::vector<cudf::data_type> output_dtypes{
+        dtype, dtype, dtype, int64, int64, float64, float64, float64, float64};
+
+    for (cudf::column_view input : {cudf::column_view(col), cudf::column_view(col_nulls)}) {
+        auto results = cudf::experimental::reduce(input, aggs, output_dtypes);
+        ASSERT_EQ(aggs.size(), results.size());
+        for (size_t i = 0; i < aggs.size(); ++i) {
+            auto expected = cudf::experimental::reduce(input, aggs[i], output_dtypes[i]);
+            if (output_dtypes[i] == float64) {
+                expect_scalars_equal<double>(*expected, *results[i]);
+            } else if (output_dtypes[i] == int64) {
+                expect_scalars_equal<int64_t>(*expected, *results[i]);
+            } else {
+                expect_scalars_equal<T>(*expected, *results[i]);
+            }
+        }
+    }
+}
+
+TEST_F(ReductionErrorTest, MultiReductionMismatchedOutputTypes)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(cudf::experimental::make_min_aggregation());
+    aggs.push_back(cudf::experimental::make_max_aggregation());
+    std::vector<cudf::data_type> output_dtypes{cudf::data_type(cudf::INT32)};
+    EXPECT_THROW(cudf::experimental::reduce(col, aggs, output_dtypes), cudf::logic_error);
+}
+
+TEST_F(StringReductionTest, MultiReductionRequests)
+{
+    std::vector<std::string> host_strings({"one", "two", "three", "four", "five"});
+    std::vector<bool> host_bools({1, 0, 1, 1, 1});
+    cudf::test::strings_column_wrapper strings(host_strings.begin(), host_strings.end(),
+                                               host_bools.begin());
+    cudf::test::fixed_width_column_wrapper<int32_t> ints({4, 1, 3, 8, 5}, {1, 1, 0, 1, 1});
+    cudf::test::fixed_width_column_wrapper<int32_t> all_nulls({4, 1}, {0, 0});
+
+    std::vector<cudf::experimental::reduction_request> requests(3);
+    requests[0].values = strings;
+    requests[0].aggregations.push_back(cudf::experimental::make_min_aggregation());
+    requests[0].aggregations.push_back(cudf::experimental::make_max_aggregation());
+    requests[0].output_dtypes.assign(2, cudf::data_type(cudf::STRING));
+    requests[1].values = ints;
+    requests[1].aggregations.push_back(cudf::experimental::make_max_aggregation());
+    requests[1].aggregations.push_back(cudf::experimental::make_mean_aggregation());
+    requests[1].aggregations.push_back(cudf::experimental::make_any_aggregation());
+    requests[1].output_dtypes = {cudf::data_type(cudf::INT32),
+                                 cudf::data_type(cudf::FLOAT64),
+                                 cudf::data_type(cudf::BOOL8)};
+    requests[2].values = all_nulls;
+    requests[2].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+    requests[2].output_dtypes = {cudf::data_type(cudf::INT64)};
+
+    auto results = cudf::experimental::reduce(requests);
+    ASSERT_EQ(3u, results.size());
+
+    using string_scalar = cudf::experimental::scalar_type_t<cudf::string_view>;
+    EXPECT_EQ("five", static_cast<string_scalar *>(results[0][0].get())->to_string());
+    EXPECT_EQ("three", static_cast<string_scalar *>(results[0][1].get())->to_string());
+
+    EXPECT_EQ(8, static_cast<cudf::numeric_scalar<int32_t> *>(
+                   results[1][0].get())->value());
+    EXPECT_EQ(4.5, static_cast<cudf::numeric_scalar<double> *>(
+                     results[1][1].get())->value());
+    EXPECT_TRUE(static_cast<cudf::numeric_scalar<bool> *>(
+                  results[1][2].get())->value());
+
+    EXPECT_FALSE(results[2][0]->is_valid());
+}
+
+struct ChunkedReductionTest : public cudf::test::BaseFixture {};
+
+TEST_F(ChunkedReductionTest, Reductions)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> col({4, 1, 3, 8, 5, 2, 7, 6, 9},
+                                                        {1, 1, 0, 1, 0, 0, 1, 1, 1});
+    // The chunks include an empty chunk and a chunk of nulls
+    auto const chunks = cudf::experimental::slice(col, {0, 3, 3, 3, 3, 6, 4, 6, 6, 9});
+    cudf::chunked_column_view const chunked(chunks);
+    EXPECT_EQ(5, chunked.num_chunks());
+    EXPECT_EQ(11u, chunked.size());
+
+    auto const unchunked = cudf::concatenate(chunks);
+    auto const int64_type = cudf::data_type(cudf::INT64);
+    auto const float64_type = cudf::data_type(cudf::FLOAT64);
+    auto const value = [](std::unique_ptr<cudf::scalar> const &s) {
+        EXPECT_TRUE(s->is_valid());
+        return static_cast<cudf::numeric_scalar<double> *>(s.get())->value();
+    };
+    auto const int_value = [](std::unique_ptr<cudf::scalar> const &s) {
+        EXPECT_TRUE(s->is_valid());
+        return static_cast<cudf::numeric_scalar<int64_t> *>(s.get())->value();
+    };
+
+    for (auto const &make_agg : {cudf::experimental::make_sum_aggregation,
+                                 cudf::experimental::make_min_aggregation,
+                                 cudf::experimental::make_max_aggregation,
+                                 cudf::experimental::make_sum_of_squares_aggregation,
+                                 cudf::experimental::make_product_aggregation}) {
+        EXPECT_EQ(int_value(cudf::experimental::reduce(*unchunked, make_agg(), int64_type)),
+                  int_value(cudf::experimental::reduce(chunked, make_agg(), int64_type)));
+    }
+    EXPECT_DOUBLE_EQ(value(cudf::experimental::reduce(
+                         *unchunked, cudf::experimental::make_mean_aggregation(), float64_type)),
+                     value(cudf::experimental::reduce(
+                         chunked, cudf::experimental::make_mean_aggregation(), float64_type)));
+    for (cudf::size_type ddof : {0, 1}) {
+        EXPECT_NEAR(value(cudf::experimental::reduce(
+                        *unchunked, cudf::experimental::make_variance_aggregation(ddof),
+                        float64_type)),
+                    value(cudf::experimental::reduce(
+                        chunked, cudf::experimental::make_variance_aggregation(ddof),
+                        float64_type)),
+                    1e-12);
+        EXPECT_NEAR(value(cudf::experimental::reduce(
+                        *unchunked, cudf::experimental::make_std_aggregation(ddof),
+                        float64_type)),
+                    value(cudf::experimental::reduce(
+                        chunked, cudf::experimental::make_std_aggregation(ddof), float64_type)),
+                    1e-12);
+    }
+
+    // The reduction of chunks of nulls is not valid
+    cudf::chunked_column_view const nulls(std::vector<cudf::column_view>{chunks[1], chunks[3]});
+    EXPECT_FALSE(cudf::experimental::reduce(
+                     nulls, cudf::experimental::make_sum_aggregation(), int64_type)->is_valid());
+    EXPECT_FALSE(cudf::experimental::reduce(
+                     nulls, cudf::experimental::make_mean_aggregation(), float64_type)->is_valid());
+
+    EXPECT_THROW(cudf::experimental::reduce(
+                     chunked, cudf::experimental::make_median_aggregation(), float64_type),
+                 cudf::logic_error);
+}
+
+TEST_F(ChunkedReductionTest, StringMinMax)
+{
+    cudf::test::strings_column_wrapper strings({"one", "two", "three", "four", "five"},
+                                               {1, 0, 1, 1, 1});
+    auto const chunks = cudf::experimental::slice(strings, {0, 2, 2, 5});
+    cudf::chunked_column_view const chunked(chunks);
+    auto const string_type = cudf::data_type(cudf::STRING);
+
+    using string_scalar = cudf::experimental::scalar_type_t<cudf::string_view>;
+    auto const min = cudf::experimental::reduce(
+        chunked, cudf::experimental::make_min_aggregation(), string_type);
+    auto const max = cudf::experimental::reduce(
+        chunked, cudf::experimental::make_max_aggregation(), string_type);
+    EXPECT_EQ("five", static_cast<string_scalar *>(min.get())->to_string());
+    EXPECT_EQ("three", static_cast<string_scalar *>(max.get())->to_string());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -472,3 +472,90 @@ TYPED_TEST(ScanTest, EmptyColumnskip_nulls)
   cudf::test::expect_column_properties_equal(expected_col_out2, col_out->view());
   cudf::test::expect_columns_equal(expected_col_out2, col_out->view());
 }
+
+TYPED_TEST(ScanTest, ExclusiveSumIncludeNulls)
+{
+  auto const v = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4, 5, 6});
+  auto const b = std::vector<bool>{1, 1, 0, 1, 1, 1};
+  cudf::test::fixed_width_column_wrapper<TypeParam> const col_in(v.begin(), v.end(), b.begin());
+
+  // Row `i` is null once a null is among the rows before it
+  auto const exact = cudf::test::make_type_param_vector<TypeParam>({0, 1, 3, 3, 7, 12});
+  auto const out_b = std::vector<bool>{1, 1, 1, 0, 0, 0};
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected(exact.begin(), exact.end(),
+                                                             out_b.begin());
+
+  std::unique_ptr<cudf::column> col_out;
+  CUDF_EXPECT_NO_THROW(col_out = cudf::experimental::scan(col_in,
+    cudf::experimental::make_sum_aggregation(), scan_type::EXCLUSIVE, include_nulls::YES));
+  cudf::test::expect_columns_equal(expected, col_out->view());
+}
+
+TYPED_TEST(ScanTest, SegmentedSum)
+{
+  auto const v = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4, 5, 6, 7, 1});
+  auto const b = std::vector<bool>{1, 1, 1, 0, 1, 1, 1, 1};
+  // Segments {1, 2, 3}, {}, {4, 5}, {6, 7, 1}
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const offsets{0, 3, 3, 5, 8};
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> const col_in(v.begin(), v.end());
+  auto const inclusive = cudf::test::make_type_param_vector<TypeParam>({1, 3, 6, 4, 9, 6, 13, 14});
+  auto const exclusive = cudf::test::make_type_param_vector<TypeParam>({0, 1, 3, 0, 4, 0, 6, 13});
+  auto result = cudf::experimental::segmented_scan(
+    col_in, offsets, cudf::experimental::make_sum_aggregation(), scan_type::INCLUSIVE);
+  cudf::test::expect_columns_equal(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(inclusive.begin(), inclusive.end()),
+    result->view());
+  result = cudf::experimental::segmented_scan(
+    col_in, offsets, cudf::experimental::make_sum_aggregation(), scan_type::EXCLUSIVE);
+  cudf::test::expect_columns_equal(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(exclusive.begin(), exclusive.end()),
+    result->view());
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> const col_nulls(v.begin(), v.end(), b.begin());
+  // Nulls skipped: the null row stays null
+  auto const skipped = cudf::test::make_type_param_vector<TypeParam>({1, 3, 6, 0, 5, 6, 13, 14});
+  result = cudf::experimental::segmented_scan(col_nulls,
+                                              offsets,
+                                              cudf::experimental::make_sum_aggregation(),
+                                              scan_type::INCLUSIVE,
+                                              include_nulls::NO);
+  cudf::test::expect_columns_equal(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(skipped.begin(), skipped.end(), b.begin()),
+    result->view());
+
+  // Nulls included: the null only spreads to the end of its segment
+  auto const out_b = std::vector<bool>{1, 1, 1, 0, 0, 1, 1, 1};
+  result = cudf::experimental::segmented_scan(col_nulls,
+                                              offsets,
+                                              cudf::experimental::make_sum_aggregation(),
+                                              scan_type::INCLUSIVE,
+                                              include_nulls::YES);
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected(
+    skipped.begin(), skipped.end(), out_b.begin());
+  cudf::test::expect_columns_equal(expected, result->view());
+}
+
+TYPED_TEST(ScanTest, SegmentedMax)
+{
+  auto const v = cudf::test::make_type_param_vector<TypeParam>({3, 1, 4, 1, 5, 9, 2, 6});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const offsets{0, 2, 5, 8};
+  cudf::test::fixed_width_column_wrapper<TypeParam> const col_in(v.begin(), v.end());
+
+  auto const exact = cudf::test::make_type_param_vector<TypeParam>({3, 3, 4, 4, 5, 9, 9, 9});
+  auto result = cudf::experimental::segmented_scan(
+    col_in, offsets, cudf::experimental::make_max_aggregation(), scan_type::INCLUSIVE);
+  cudf::test::expect_columns_equal(
+    cudf::test::fixed_width_column_wrapper<TypeParam>(exact.begin(), exact.end()),
+    result->view());
+}
+
+TEST_F(ScanStringTest, SegmentedScanNotSupported)
+{
+  cudf::test::strings_column_wrapper col_in({"one", "two", "three"});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> const offsets{0, 1, 3};
+  CUDF_EXPECT_THROW_MESSAGE(
+    cudf::experimental::segmented_scan(
+      col_in, offsets, cudf::experimental::make_max_aggregation(), scan_type::INCLUSIVE),
+    "Segmented scan supports only arithmetic types");
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/reduction.hpp>
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {};
+
+using SegmentedReductionTypes =
+  cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+TYPED_TEST(SegmentedReductionTest, SumMinMax) {
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> input({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 3, 4, 4, 10});
+  auto const dtype = cudf::column_view(input).type();
+
+  auto sum = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_sum_aggregation(), cudf::data_type(cudf::INT64));
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sum({6, 4, 0, 45}, {1, 1, 0, 1});
+  cudf::test::expect_columns_equal(expected_sum, *sum);
+
+  auto min = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_min_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_min({1, 4, 0, 5}, {1, 1, 0, 1});
+  cudf::test::expect_columns_equal(expected_min, *min);
+
+  auto max = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_max_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_max({3, 4, 0, 10}, {1, 1, 0, 1});
+  cudf::test::expect_columns_equal(expected_max, *max);
+}
+
+TYPED_TEST(SegmentedReductionTest, WithNulls) {
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> input({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                  {1, 0, 1, 0, 1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 3, 4, 7, 10});
+  auto const dtype = cudf::column_view(input).type();
+
+  auto product = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_product_aggregation(), cudf::data_type(cudf::INT64));
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_product({3, 1, 30, 720}, {1, 0, 1, 1});
+  cudf::test::expect_columns_equal(expected_product, *product);
+
+  auto min = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_min_aggregation(), dtype);
+  cudf::test::fixed_width_column_wrapper<T> expected_min({1, 0, 5, 8}, {1, 0, 1, 1});
+  cudf::test::expect_columns_equal(expected_min, *min);
+}
+
+TYPED_TEST(SegmentedReductionTest, NoSegments) {
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T> input({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0});
+
+  auto sum = cudf::experimental::segmented_reduce(
+    input, offsets, cudf::experimental::make_sum_aggregation(), cudf::data_type(cudf::INT64));
+  EXPECT_EQ(0, sum->size());
+}
+
+struct SegmentedReductionErrorTest : public cudf::test::BaseFixture {};
+
+TEST_F(SegmentedReductionErrorTest, InvalidArguments) {
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int8_t> int8_offsets({0, 3});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 3});
+  auto const dtype = cudf::data_type(cudf::INT32);
+
+  EXPECT_THROW(cudf::experimental::segmented_reduce(
+                 input, int8_offsets, cudf::experimental::make_sum_aggregation(), dtype),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::segmented_reduce(
+                 input, offsets, cudf::experimental::make_mean_aggregation(), dtype),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::segmented_reduce(
+                 input, offsets, cudf::experimental::make_any_aggregation(), dtype),
+               cudf::logic_error);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/reshape.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <memory>
+#include <vector>
+
+using namespace cudf::test;
+
+namespace {
+
+template <typename T>
+cudf::column_view matrix_view(rmm::device_buffer const& matrix)
+{
+  constexpr cudf::data_type type{cudf::experimental::type_to_id<T>()};
+  return cudf::column_view(type, matrix.size() / sizeof(T), matrix.data());
+}
+
+}  // namespace
+
+template <typename T>
+struct DenseMatrixTest : public BaseFixture {};
+
+TYPED_TEST_CASE(DenseMatrixTest, cudf::test::NumericTypes);
+
+TYPED_TEST(DenseMatrixTest, MixedTypes)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<int32_t> a({1, 2, 3}, {1, 0, 1});
+  fixed_width_column_wrapper<double> b{4, 5, 6};
+  fixed_width_column_wrapper<int8_t> c{7, 8, 9};
+  cudf::table_view in{{a, b, c}};
+
+  constexpr cudf::data_type type{cudf::experimental::type_to_id<T>()};
+  cudf::numeric_scalar<T> fill(0);
+
+  auto const rows = cudf::experimental::to_dense_matrix(in, type, fill);
+  fixed_width_column_wrapper<T> expected_rows{1, 4, 7, 0, 5, 8, 3, 6, 9};
+  expect_columns_equal(expected_rows, matrix_view<T>(*rows));
+
+  auto const columns = cudf::experimental::to_dense_matrix(
+    in, type, fill, cudf::experimental::matrix_order::COLUMN_MAJOR);
+  fixed_width_column_wrapper<T> expected_columns{1, 0, 3, 4, 5, 6, 7, 8, 9};
+  expect_columns_equal(expected_columns, matrix_view<T>(*columns));
+}
+
+struct DenseMatrixUntypedTest : public BaseFixture {};
+
+TEST_F(DenseMatrixUntypedTest, ManyTiles)
+{
+  // Spans several tiles of rows and columns, with partial tiles at both ends
+  constexpr cudf::size_type num_rows    = 70;
+  constexpr cudf::size_type num_columns = 45;
+  std::vector<fixed_width_column_wrapper<int32_t>> columns;
+  std::vector<cudf::column_view> views;
+  for (cudf::size_type j = 0; j < num_columns; ++j) {
+    auto values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                  [j](auto i) { return i * num_columns + j; });
+    auto valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                  [j](auto i) { return (i + j) % 7 != 0; });
+    columns.emplace_back(values, values + num_rows, valids);
+  }
+  for (auto const& column : columns) { views.push_back(column); }
+
+  cudf::numeric_scalar<int64_t> fill(-1);
+  cudf::data_type const type{cudf::INT64};
+  auto const matrix = cudf::experimental::to_dense_matrix(cudf::table_view{views}, type, fill);
+
+  std::vector<int64_t> expected(num_rows * num_columns);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    for (cudf::size_type j = 0; j < num_columns; ++j) {
+      expected[i * num_columns + j] = (i + j) % 7 != 0 ? i * num_columns + j : -1;
+    }
+  }
+  fixed_width_column_wrapper<int64_t> expected_matrix(expected.begin(), expected.end());
+  expect_columns_equal(expected_matrix, matrix_view<int64_t>(*matrix));
+}
+
+TEST_F(DenseMatrixUntypedTest, Empty)
+{
+  fixed_width_column_wrapper<float> a{};
+  cudf::numeric_scalar<float> fill(0);
+  cudf::data_type const type{cudf::FLOAT32};
+  auto const matrix = cudf::experimental::to_dense_matrix(cudf::table_view{{a}}, type, fill);
+  EXPECT_EQ(0u, matrix->size());
+}
+
+TEST_F(DenseMatrixUntypedTest, InvalidInput)
+{
+  fixed_width_column_wrapper<int32_t> a({1, 2}, {1, 0});
+  strings_column_wrapper s{"a", "b"};
+  cudf::numeric_scalar<float> fill(0);
+  cudf::numeric_scalar<float> null_fill(0, false);
+  cudf::data_type const type{cudf::FLOAT32};
+
+  EXPECT_THROW(cudf::experimental::to_dense_matrix(cudf::table_view{{a, s}}, type, fill),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::to_dense_matrix(cudf::table_view{{a}}, type, null_fill),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::experimental::to_dense_matrix(cudf::table_view{{a}}, cudf::data_type{cudf::INT32}, fill),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::to_dense_matrix(
+                 cudf::table_view{{a}}, cudf::data_type{cudf::STRING}, fill),
+               cudf::logic_error);
+}
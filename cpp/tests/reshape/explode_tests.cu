@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+using namespace cudf::test;
+
+namespace {
+
+using int32_wrapper = fixed_width_column_wrapper<int32_t>;
+
+// builds a lists column of int32 elements from its offsets
+std::unique_ptr<cudf::column> make_lists(std::vector<int32_t> const& offsets,
+                                         std::vector<int32_t> const& values,
+                                         std::vector<bool> const& validity = {}) {
+  auto const rows = static_cast<cudf::size_type>(offsets.size() - 1);
+  rmm::device_buffer null_mask{};
+  cudf::size_type null_count = 0;
+  if (!validity.empty()) {
+    auto mask_column =
+      int32_wrapper(offsets.begin(), offsets.end() - 1, validity.begin()).release();
+    null_count       = mask_column->null_count();
+    null_mask        = std::move(*(mask_column->release().null_mask));
+  }
+  return cudf::make_lists_column(rows,
+                                 int32_wrapper(offsets.begin(), offsets.end()).release(),
+                                 int32_wrapper(values.begin(), values.end()).release(),
+                                 null_count,
+                                 std::move(null_mask));
+}
+
+}  // namespace
+
+struct ExplodeTest : public BaseFixture {};
+
+TEST_F(ExplodeTest, Basic)
+{
+    // [[1, 2], [3], [], [4, 5, 6]]
+    auto lists = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+    strings_column_wrapper names{"a", "b", "c", "d"};
+    cudf::table_view in{{names, lists->view()}};
+
+    strings_column_wrapper expected_names{"a", "a", "b", "d", "d", "d"};
+    int32_wrapper expected_values{1, 2, 3, 4, 5, 6};
+    cudf::table_view expected{{expected_names, expected_values}};
+
+    auto actual = cudf::experimental::explode(in, 1);
+
+    expect_tables_equal(expected, actual->view());
+}
+
+TEST_F(ExplodeTest, NullLists)
+{
+    // [[1, 2], null, [3], [4, 5]] where the null list still spans an element
+    auto lists = make_lists({0, 2, 3, 4, 6}, {1, 2, 9, 3, 4, 5}, {1, 0, 1, 1});
+    int32_wrapper keys({10, 11, 12, 13}, {1, 1, 0, 1});
+    cudf::table_view in{{lists->view(), keys}};
+
+    int32_wrapper expected_values{1, 2, 3, 4, 5};
+    int32_wrapper expected_keys({10, 10, 12, 13, 13}, {1, 1, 0, 1, 1});
+    cudf::table_view expected{{expected_values, expected_keys}};
+
+    auto actual = cudf::experimental::explode(in, 0);
+
+    expect_tables_equal(expected, actual->view());
+}
+
+TEST_F(ExplodeTest, SlicedLists)
+{
+    auto lists  = make_lists({0, 2, 3, 3, 6}, {1, 2, 3, 4, 5, 6});
+    int32_wrapper keys{10, 11, 12, 13};
+    auto sliced = cudf::experimental::slice(cudf::table_view{{keys, lists->view()}}, {1, 4});
+
+    int32_wrapper expected_keys{11, 13, 13, 13};
+    int32_wrapper expected_values{3, 4, 5, 6};
+    cudf::table_view expected{{expected_keys, expected_values}};
+
+    auto actual = cudf::experimental::explode(sliced.front(), 1);
+
+    expect_tables_equal(expected, actual->view());
+}
+
+TEST_F(ExplodeTest, InvalidColumn)
+{
+    int32_wrapper keys{10, 11};
+    cudf::table_view in{{keys}};
+
+    EXPECT_THROW(cudf::experimental::explode(in, 0), cudf::logic_error);
+    EXPECT_THROW(cudf::experimental::explode(in, 1), cudf::logic_error);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+using namespace cudf::test;
+
+template <typename T>
+struct MeltTest : public BaseFixture {};
+
+TYPED_TEST_CASE(MeltTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(MeltTest, Basic)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<int32_t> id{7, 8, 9};
+    fixed_width_column_wrapper<T> a({1, 2, 3}, {1, 0, 1});
+    fixed_width_column_wrapper<T> b{4, 5, 6};
+    cudf::table_view in{{a, id, b}};
+
+    fixed_width_column_wrapper<int32_t> expected_id{7, 8, 9, 7, 8, 9};
+    fixed_width_column_wrapper<int32_t> expected_variable{0, 0, 0, 1, 1, 1};
+    fixed_width_column_wrapper<T> expected_value({1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1});
+
+    auto actual = cudf::experimental::melt(in, {1}, {0, 2});
+
+    expect_columns_equal(expected_id, actual->get_column(0));
+    expect_columns_equal(expected_variable, actual->get_column(1));
+    expect_columns_equivalent(expected_value, actual->get_column(2));
+}
+
+struct MeltErrorTest : public BaseFixture {};
+
+TEST_F(MeltErrorTest, InvalidValueColumns)
+{
+    fixed_width_column_wrapper<int32_t> a{1, 2};
+    fixed_width_column_wrapper<int64_t> b{3, 4};
+    cudf::table_view in{{a, b}};
+
+    EXPECT_THROW(cudf::experimental::melt(in, {0}, {}), cudf::logic_error);
+    EXPECT_THROW(cudf::experimental::melt(in, {}, {0, 1}), cudf::logic_error);
+}
+
+template <typename T>
+struct PivotTest : public BaseFixture {};
+
+TYPED_TEST_CASE(PivotTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(PivotTest, Basic)
+{
+    using T = TypeParam;
+
+    fixed_width_column_wrapper<T> values{1, 2, 3, 4, 5};
+    fixed_width_column_wrapper<int32_t> rows{0, 1, 2, 0, 5};
+    fixed_width_column_wrapper<int32_t> columns{0, 1, 0, 1, 0};
+
+    fixed_width_column_wrapper<T> expected_0({1, 0, 3}, {1, 0, 1});
+    fixed_width_column_wrapper<T> expected_1({4, 2, 0}, {1, 1, 0});
+    cudf::table_view expected{{expected_0, expected_1}};
+
+    auto actual = cudf::experimental::pivot(values, rows, columns, 3, 2);
+
+    expect_tables_equal(expected, actual->view());
+}
+
+struct PivotErrorTest : public BaseFixture {};
+
+TEST_F(PivotErrorTest, InvalidIndices)
+{
+    fixed_width_column_wrapper<int32_t> values{1, 2};
+    fixed_width_column_wrapper<int32_t> indices{0, 1};
+    fixed_width_column_wrapper<int64_t> wide_indices{0, 1};
+    fixed_width_column_wrapper<int32_t> null_indices({0, 1}, {1, 0});
+
+    EXPECT_THROW(cudf::experimental::pivot(values, wide_indices, indices, 2, 2),
+                 cudf::logic_error);
+    EXPECT_THROW(cudf::experimental::pivot(values, indices, null_indices, 2, 2),
+                 cudf::logic_error);
+    EXPECT_THROW(cudf::experimental::pivot(values, indices, indices, -1, 2), cudf::logic_error);
+}
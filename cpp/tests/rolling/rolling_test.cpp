@@ -24,11 +24,13 @@
 #include <cudf/utilities/bit.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
 #include <cudf/rolling.hpp>
 #include <src/rolling/rolling_detail.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <cmath>
 #include <vector>
 
 using cudf::test::fixed_width_column_wrapper;
@@ -610,6 +612,25 @@ TYPED_TEST(RollingTest, RandomStaticWithInvalid)
   this->run_test_col_agg(input, window, window, periods);
 }
 
+// random input data, static parameters, with nulls, windows many times
+// larger than the blocks of the sliding window MIN and MAX
+TYPED_TEST(RollingTest, RandomStaticLargeWindow)
+{
+  size_type num_rows = 10000;
+
+  // random input
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  this->run_test_col_agg(input, {1000}, {337}, 1);
+  this->run_test_col_agg(input, {3000}, {0}, 100);
+}
+
 // random input data, dynamic parameters, no nulls
 TYPED_TEST(RollingTest, RandomDynamicAllValid)
 {
@@ -663,6 +684,50 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+class RollingVarianceNthTest : public cudf::test::BaseFixture {};
+
+TEST_F(RollingVarianceNthTest, DynamicVarianceStd)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<size_type> preceding_window({1, 2, 3, 2, 3, 1});
+  fixed_width_column_wrapper<size_type> following_window({1, 0, 2, 1, 0, 1});
+
+  // The last window has a single element, which is not enough for ddof = 1
+  fixed_width_column_wrapper<double> expected_var({0.5, 0.5, 8.75 / 3, 2.0, 2.0, 0.0},
+                                                  {1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<double> expected_std(
+    {std::sqrt(0.5), std::sqrt(0.5), std::sqrt(8.75 / 3), std::sqrt(2.0), std::sqrt(2.0), 0.0},
+    {1, 1, 1, 1, 1, 0});
+
+  auto got_var = cudf::experimental::rolling_window(
+    input, preceding_window, following_window, 1, cudf::experimental::make_variance_aggregation());
+  auto got_std = cudf::experimental::rolling_window(
+    input, preceding_window, following_window, 1, cudf::experimental::make_std_aggregation());
+
+  cudf::test::expect_columns_equivalent(expected_var, got_var->view());
+  cudf::test::expect_columns_equivalent(expected_std, got_std->view());
+}
+
+TEST_F(RollingVarianceNthTest, DynamicNthElement)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<size_type> preceding_window({1, 2, 3, 2, 3, 1});
+  fixed_width_column_wrapper<size_type> following_window({1, 0, 2, 1, 0, 1});
+
+  fixed_width_column_wrapper<int32_t> expected_second({2, 2, 2, 0, 0, 0}, {1, 1, 1, 0, 0, 0});
+  fixed_width_column_wrapper<int32_t> expected_last_valid({2, 2, 5, 5, 5, 6});
+
+  auto got_second = cudf::experimental::rolling_window(
+    input, preceding_window, following_window, 1,
+    cudf::experimental::make_nth_element_aggregation(1));
+  auto got_last_valid = cudf::experimental::rolling_window(
+    input, preceding_window, following_window, 1,
+    cudf::experimental::make_nth_element_aggregation(-1, cudf::include_nulls::NO));
+
+  cudf::test::expect_columns_equal(expected_second, got_second->view());
+  cudf::test::expect_columns_equal(expected_last_valid, got_last_valid->view());
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -877,4 +942,38 @@ TEST_F(RollingTestUdf, DynamicWindow)
   cudf::test::expect_columns_equal(*output, expected);
 }
 
+class GroupedRollingTest : public cudf::test::BaseFixture {};
+
+TEST_F(GroupedRollingTest, ReuseGroupby)
+{
+  using namespace cudf::experimental;
+
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 1, 1, 2, 2, 2, 2};
+  fixed_width_column_wrapper<int32_t> input{10, 20, 10, 50, 60, 20, 30, 80, 40};
+  fixed_width_column_wrapper<int32_t> expect_sums({30, 40, 80, 120, 110, 50, 130, 150, 120},
+                                                  {1, 1, 1, 1, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<int64_t> expect_totals{150, 170};
+
+  groupby::groupby grouping(cudf::table_view{{keys}}, cudf::include_nulls::YES, cudf::sorted::YES);
+
+  auto output = grouped_rolling_window(grouping, input, 2, 1, 1, make_sum_aggregation());
+  cudf::test::expect_columns_equal(*output, expect_sums);
+
+  output = grouped_rolling_window(cudf::table_view{{keys}}, input, 2, 1, 1, make_sum_aggregation());
+  cudf::test::expect_columns_equal(*output, expect_sums);
+
+  // The aggregation reuses the grouping of the rolling window
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = input;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  auto result = grouping.aggregate(requests);
+  cudf::test::expect_columns_equal(result.first->get_column(0), expect_keys);
+  cudf::test::expect_columns_equal(*result.second[0].results[0], expect_totals);
+
+  fixed_width_column_wrapper<int32_t> short_input{10, 20};
+  EXPECT_THROW(grouped_rolling_window(grouping, short_input, 2, 1, 1, make_sum_aggregation()),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
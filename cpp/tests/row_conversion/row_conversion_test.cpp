@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cstring>
+
+using namespace cudf::test;
+
+struct RowConversionTest : public BaseFixture {};
+
+TEST_F(RowConversionTest, Layout)
+{
+  fixed_width_column_wrapper<int8_t> col1({1, 2});
+  fixed_width_column_wrapper<int32_t> col2({3, 4}, {1, 0});
+  fixed_width_column_wrapper<int16_t> col3({5, 6});
+  cudf::table_view input{{col1, col2, col3}};
+
+  auto rows = cudf::experimental::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  cudf::lists_column_view records(rows.front()->view());
+  EXPECT_EQ(records.size(), 2);
+
+  // The elements are aligned to their size, followed by a validity byte, and
+  // the records are padded to 8 bytes
+  auto bytes = to_host<int8_t>(records.child()).first;
+  ASSERT_EQ(bytes.size(), 32u);
+  int32_t value32;
+  int16_t value16;
+  std::memcpy(&value32, bytes.data() + 4, sizeof(value32));
+  std::memcpy(&value16, bytes.data() + 8, sizeof(value16));
+  EXPECT_EQ(bytes[0], 1);
+  EXPECT_EQ(value32, 3);
+  EXPECT_EQ(value16, 5);
+  EXPECT_EQ(bytes[10], 0x7);
+  std::memcpy(&value16, bytes.data() + 24, sizeof(value16));
+  EXPECT_EQ(bytes[16], 2);
+  EXPECT_EQ(value16, 6);
+  EXPECT_EQ(bytes[26], 0x5);
+}
+
+TEST_F(RowConversionTest, RoundTrip)
+{
+  auto const size = 1000;
+  auto sequence   = thrust::make_counting_iterator(0);
+  auto odd        = thrust::make_transform_iterator(sequence, [](auto i) { return i % 2; });
+  auto third      = thrust::make_transform_iterator(sequence, [](auto i) { return i % 3 != 0; });
+  fixed_width_column_wrapper<int8_t> col1(sequence, sequence + size, odd);
+  fixed_width_column_wrapper<double> col2(sequence, sequence + size, third);
+  fixed_width_column_wrapper<int16_t> col3(sequence, sequence + size);
+  fixed_width_column_wrapper<bool> col4(odd, odd + size, third);
+  fixed_width_column_wrapper<cudf::timestamp_ms> col5(sequence, sequence + size, odd);
+  std::vector<cudf::column_view> columns{col1, col2, col3, col4, col5};
+  // More than 8 columns have more than one validity byte
+  for (int i = 0; i < 6; ++i) { columns.push_back(i % 2 ? col2 : col3); }
+  cudf::table_view input{columns};
+
+  auto rows = cudf::experimental::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) { schema.push_back(col.type()); }
+  auto result = cudf::experimental::convert_from_rows(rows.front()->view(), schema);
+  expect_tables_equal(input, result->view());
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> col1{};
+  cudf::table_view input{{col1}};
+
+  auto rows = cudf::experimental::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), 0);
+  auto result =
+    cudf::experimental::convert_from_rows(rows.front()->view(), {cudf::data_type{cudf::INT32}});
+  expect_tables_equal(input, result->view());
+}
+
+TEST_F(RowConversionTest, InvalidArguments)
+{
+  strings_column_wrapper strings({"a", "b"});
+  fixed_width_column_wrapper<int32_t> col1({1, 2});
+  EXPECT_THROW(cudf::experimental::convert_to_rows(cudf::table_view{{col1, strings}}),
+               cudf::logic_error);
+
+  auto rows = cudf::experimental::convert_to_rows(cudf::table_view{{col1}});
+  EXPECT_THROW(
+    cudf::experimental::convert_from_rows(rows.front()->view(), {cudf::data_type{cudf::INT64}}),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::experimental::convert_from_rows(rows.front()->view(), {cudf::data_type{cudf::STRING}}),
+    cudf::logic_error);
+}
+
+TEST_F(RowConversionTest, NoColumns)
+{
+  EXPECT_THROW(cudf::experimental::convert_to_rows(cudf::table_view{}), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> col1({1, 2});
+  auto rows = cudf::experimental::convert_to_rows(cudf::table_view{{col1}});
+  EXPECT_THROW(cudf::experimental::convert_from_rows(rows.front()->view(), {}),
+               cudf::logic_error);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_readback.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <memory>
+#include <vector>
+
+template <typename T>
+struct TypedScalarReadbackTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_CASE(TypedScalarReadbackTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(TypedScalarReadbackTest, ValuesAndValidities) {
+  cudf::experimental::scalar_type_t<TypeParam> first(TypeParam{3});
+  cudf::experimental::scalar_type_t<TypeParam> null(TypeParam{5}, false);
+  cudf::experimental::scalar_type_t<TypeParam> last(TypeParam{7});
+
+  cudf::scalar_readback readback({&first, &null, &last});
+  readback.wait();
+  EXPECT_TRUE(readback.ready());
+  ASSERT_EQ(3, readback.size());
+  EXPECT_TRUE(readback.is_valid(0));
+  EXPECT_FALSE(readback.is_valid(1));
+  EXPECT_TRUE(readback.is_valid(2));
+  EXPECT_EQ(first.value(), readback.value<TypeParam>(0));
+  EXPECT_EQ(last.value(), readback.value<TypeParam>(2));
+}
+
+struct ScalarReadbackTest : public cudf::test::BaseFixture {};
+
+TEST_F(ScalarReadbackTest, Reductions) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls({1, 2}, {0, 0});
+  cudf::data_type const dtype{cudf::INT64};
+
+  std::vector<std::unique_ptr<cudf::scalar>> results;
+  results.push_back(
+    cudf::experimental::reduce(col, cudf::experimental::make_sum_aggregation(), dtype));
+  results.push_back(
+    cudf::experimental::reduce(col, cudf::experimental::make_max_aggregation(), dtype));
+  results.push_back(
+    cudf::experimental::reduce(nulls, cudf::experimental::make_sum_aggregation(), dtype));
+
+  cudf::scalar_readback readback(results);
+  EXPECT_TRUE(readback.is_valid(0));
+  EXPECT_EQ(7, readback.value<int64_t>(0));
+  EXPECT_TRUE(readback.is_valid(1));
+  EXPECT_EQ(4, readback.value<int64_t>(1));
+  EXPECT_FALSE(readback.is_valid(2));
+}
+
+TEST_F(ScalarReadbackTest, MixedTypes) {
+  cudf::numeric_scalar<double> number(1.5);
+  cudf::string_scalar string("a string read back with the numbers");
+  cudf::string_scalar empty("");
+  cudf::string_scalar null_string("", false);
+
+  cudf::scalar_readback readback({&number, &string, &empty, &null_string});
+  EXPECT_EQ(1.5, readback.value<double>(0));
+  EXPECT_EQ(string.to_string(), readback.to_string(1));
+  EXPECT_TRUE(readback.is_valid(2));
+  EXPECT_EQ("", readback.to_string(2));
+  EXPECT_FALSE(readback.is_valid(3));
+}
+
+TEST_F(ScalarReadbackTest, Empty) {
+  cudf::scalar_readback readback(std::vector<cudf::scalar const*>{});
+  EXPECT_TRUE(readback.ready());
+  EXPECT_EQ(0, readback.size());
+  EXPECT_THROW(readback.is_valid(0), cudf::logic_error);
+}
+
+TEST_F(ScalarReadbackTest, WrongType) {
+  cudf::numeric_scalar<int32_t> number(1);
+  cudf::string_scalar string("a");
+
+  cudf::scalar_readback readback({&number, &string});
+  EXPECT_THROW(readback.value<int64_t>(0), cudf::logic_error);
+  EXPECT_THROW(readback.to_string(0), cudf::logic_error);
+  EXPECT_THROW(readback.value<int32_t>(1), cudf::logic_error);
+  EXPECT_THROW(readback.value<int32_t>(2), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -20,6 +20,10 @@
 
 #include "cudf/search.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 struct SearchTest : public cudf::test::BaseFixture {};
 
 using cudf::test::fixed_width_column_wrapper;
@@ -1778,4 +1782,194 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   expect_columns_equal(*result, expect);
 }
 
+TEST_F(SearchTest, value_set_contains)
+{
+  using element_type = int64_t;
+
+  fixed_width_column_wrapper<element_type>    needles  {17, 19, 0, 45, 72}, {1, 1, 0, 1, 1};
+  fixed_width_column_wrapper<element_type>    haystack_a {0, 1, 17, 19, 23, 29, 71};
+  fixed_width_column_wrapper<element_type>    haystack_b {72, 45, 0, 16}, {1, 1, 0, 1};
+
+  fixed_width_column_wrapper<bool>           expect_a {0, 0, 1, 1, 0, 0, 0};
+  fixed_width_column_wrapper<bool>           expect_b {1, 1, 1, 0}, {1, 1, 0, 1};
+
+  for (auto method : {cudf::experimental::membership_method::HASH,
+                      cudf::experimental::membership_method::BINARY_SEARCH}) {
+    cudf::experimental::value_set set(needles, method);
+    expect_columns_equal(*set.contains(haystack_a), expect_a);
+    expect_columns_equal(*set.contains(haystack_b), expect_b);
+    expect_columns_equal(*set.contains(haystack_a),
+                         *cudf::experimental::contains(haystack_a, needles));
+  }
+}
+
+TEST_F(SearchTest, value_set_contains_string)
+{
+  std::vector<const char*> h_haystack_strings  { "0", "1", "17", "19", "23", "29", "71"};
+  std::vector<const char*> h_needles_strings   { "72", "19", "45", "17" };
+
+  cudf::test::strings_column_wrapper haystack(h_haystack_strings.begin(),
+                                              h_haystack_strings.end());
+
+  cudf::test::strings_column_wrapper needles(h_needles_strings.begin(),
+                                             h_needles_strings.end());
+
+  fixed_width_column_wrapper<bool>           expect {0, 0, 1, 1, 0, 0, 0};
+
+  for (auto method : {cudf::experimental::membership_method::HASH,
+                      cudf::experimental::membership_method::BINARY_SEARCH}) {
+    cudf::experimental::value_set set(needles, method);
+    expect_columns_equal(*set.contains(haystack), expect);
+  }
+}
+
+TEST_F(SearchTest, value_set_empty)
+{
+  using element_type = int32_t;
+
+  fixed_width_column_wrapper<element_type>    needles  {};
+  fixed_width_column_wrapper<element_type>    haystack {0, 1, 17};
+  fixed_width_column_wrapper<element_type>    empty_haystack {};
+
+  for (auto method : {cudf::experimental::membership_method::HASH,
+                      cudf::experimental::membership_method::BINARY_SEARCH}) {
+    cudf::experimental::value_set set(needles, method);
+    expect_columns_equal(*set.contains(haystack), fixed_width_column_wrapper<bool>{0, 0, 0});
+    EXPECT_EQ(set.contains(empty_haystack)->size(), 0);
+    EXPECT_THROW(set.contains(fixed_width_column_wrapper<int64_t>{1}), cudf::logic_error);
+  }
+}
+
+TEST_F(SearchTest, large_column_with_nulls)
+{
+  using element_type = int32_t;
+
+  // Enough rows to search from cached splitters
+  std::vector<element_type> h_column(9500, 0);
+  std::vector<bool> h_column_valid(h_column.size(), true);
+  for (size_t i = 0; i < 500; ++i) { h_column_valid[i] = false; }
+  for (size_t i = 500; i < h_column.size(); ++i) { h_column[i] = (i - 500) / 3; }
+
+  std::vector<element_type> h_values(2000);
+  std::vector<bool> h_values_valid(h_values.size());
+  std::vector<size_type> h_lower(h_values.size());
+  std::vector<size_type> h_upper(h_values.size());
+  auto const first_valid = h_column.begin() + 500;
+  for (size_t i = 0; i < h_values.size(); ++i) {
+    h_values[i]       = static_cast<element_type>(i * 7 % 3500) - 100;
+    h_values_valid[i] = i % 7 != 3;
+    h_lower[i]        = h_values_valid[i]
+                   ? std::lower_bound(first_valid, h_column.end(), h_values[i]) - h_column.begin()
+                   : 0;
+    h_upper[i] = h_values_valid[i]
+                   ? std::upper_bound(first_valid, h_column.end(), h_values[i]) - h_column.begin()
+                   : 500;
+  }
+
+  fixed_width_column_wrapper<element_type> column(
+    h_column.begin(), h_column.end(), h_column_valid.begin());
+  fixed_width_column_wrapper<element_type> values(
+    h_values.begin(), h_values.end(), h_values_valid.begin());
+  fixed_width_column_wrapper<size_type> expect_lower(h_lower.begin(), h_lower.end());
+  fixed_width_column_wrapper<size_type> expect_upper(h_upper.begin(), h_upper.end());
+
+  auto lower = cudf::experimental::lower_bound({cudf::table_view{{column}}},
+                                               {cudf::table_view{{values}}},
+                                               {cudf::order::ASCENDING},
+                                               {cudf::null_order::BEFORE});
+  auto upper = cudf::experimental::upper_bound({cudf::table_view{{column}}},
+                                               {cudf::table_view{{values}}},
+                                               {cudf::order::ASCENDING},
+                                               {cudf::null_order::BEFORE});
+
+  expect_columns_equal(*lower, expect_lower);
+  expect_columns_equal(*upper, expect_upper);
+}
+
+TEST_F(SearchTest, large_column_descending)
+{
+  using element_type = double;
+
+  std::vector<element_type> h_column(6000);
+  for (size_t i = 0; i < h_column.size(); ++i) { h_column[i] = 3000.0 - (i / 2); }
+
+  std::vector<element_type> h_values(1500);
+  std::vector<size_type> h_lower(h_values.size());
+  std::vector<size_type> h_upper(h_values.size());
+  for (size_t i = 0; i < h_values.size(); ++i) {
+    h_values[i] = static_cast<element_type>(i * 3) - 500.5 * (i % 2);
+    h_lower[i] = std::lower_bound(
+                   h_column.begin(), h_column.end(), h_values[i], std::greater<element_type>()) -
+                 h_column.begin();
+    h_upper[i] = std::upper_bound(
+                   h_column.begin(), h_column.end(), h_values[i], std::greater<element_type>()) -
+                 h_column.begin();
+  }
+
+  fixed_width_column_wrapper<element_type> column(h_column.begin(), h_column.end());
+  fixed_width_column_wrapper<element_type> values(h_values.begin(), h_values.end());
+  fixed_width_column_wrapper<size_type> expect_lower(h_lower.begin(), h_lower.end());
+  fixed_width_column_wrapper<size_type> expect_upper(h_upper.begin(), h_upper.end());
+
+  auto lower = cudf::experimental::lower_bound({cudf::table_view{{column}}},
+                                               {cudf::table_view{{values}}},
+                                               {cudf::order::DESCENDING},
+                                               {cudf::null_order::BEFORE});
+  auto upper = cudf::experimental::upper_bound({cudf::table_view{{column}}},
+                                               {cudf::table_view{{values}}},
+                                               {cudf::order::DESCENDING},
+                                               {cudf::null_order::BEFORE});
+
+  expect_columns_equal(*lower, expect_lower);
+  expect_columns_equal(*upper, expect_upper);
+}
+
+TEST_F(SearchTest, many_needles_searched_in_sorted_order)
+{
+  // Enough needles to be sorted before searching
+  auto const num_rows   = size_type{8000};
+  auto const num_values = size_type{1 << 20};
+  std::vector<int32_t> h_column1(num_rows);
+  std::vector<int16_t> h_column2(num_rows);
+  for (size_type i = 0; i < num_rows; ++i) {
+    h_column1[i] = i / 4;
+    h_column2[i] = i % 4;
+  }
+
+  std::vector<int32_t> h_values1(num_values);
+  std::vector<int16_t> h_values2(num_values);
+  std::vector<size_type> h_single(num_values);
+  std::vector<size_type> h_multi(num_values);
+  for (size_type i = 0; i < num_values; ++i) {
+    h_values1[i] = (i * 37) % 2100 - 50;
+    h_values2[i] = i % 5;
+    h_single[i]  = std::lower_bound(h_column1.begin(), h_column1.end(), h_values1[i]) -
+                  h_column1.begin();
+    h_multi[i] = (h_values1[i] < 0) ? 0
+                 : (h_values1[i] >= num_rows / 4)
+                   ? num_rows
+                   : 4 * h_values1[i] + std::min<size_type>(h_values2[i], 4);
+  }
+
+  fixed_width_column_wrapper<int32_t> column1(h_column1.begin(), h_column1.end());
+  fixed_width_column_wrapper<int16_t> column2(h_column2.begin(), h_column2.end());
+  fixed_width_column_wrapper<int32_t> values1(h_values1.begin(), h_values1.end());
+  fixed_width_column_wrapper<int16_t> values2(h_values2.begin(), h_values2.end());
+  fixed_width_column_wrapper<size_type> expect_single(h_single.begin(), h_single.end());
+  fixed_width_column_wrapper<size_type> expect_multi(h_multi.begin(), h_multi.end());
+
+  auto single = cudf::experimental::lower_bound({cudf::table_view{{column1}}},
+                                                {cudf::table_view{{values1}}},
+                                                {cudf::order::ASCENDING},
+                                                {cudf::null_order::BEFORE});
+  auto multi  = cudf::experimental::lower_bound(
+    {cudf::table_view{{column1, column2}}},
+    {cudf::table_view{{values1, values2}}},
+    {cudf::order::ASCENDING, cudf::order::ASCENDING},
+    {cudf::null_order::BEFORE, cudf::null_order::BEFORE});
+
+  expect_columns_equal(*single, expect_single);
+  expect_columns_equal(*multi, expect_multi);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct ExternalSort : public BaseFixture {};
+
+namespace {
+
+// Returns the concatenation of all the chunks returned by `sorter`
+std::unique_ptr<experimental::table> read_all(experimental::external_sorter& sorter) {
+  std::vector<std::unique_ptr<experimental::table>> chunks;
+  while (sorter.has_next()) { chunks.push_back(sorter.next()); }
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  return experimental::concatenate(views);
+}
+
+}  // namespace
+
+TEST_F(ExternalSort, UniqueKeys)
+{
+  auto keys   = make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 1000; });
+  auto names  = make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  auto valids = make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  fixed_width_column_wrapper<int32_t> col1(keys, keys + 1000);
+  strings_column_wrapper col2(names, names + 1000, valids);
+  table_view input({col1, col2});
+
+  experimental::external_sorter sorter({0}, {order::DESCENDING}, {}, 64);
+  for (auto const& run : experimental::slice(input, {0, 300, 300, 310, 310, 1000})) {
+    sorter.push(run);
+  }
+  auto const got      = read_all(sorter);
+  auto const expected = experimental::sort_by_key(input, table_view({col1}), {order::DESCENDING});
+  expect_tables_equal(expected->view(), got->view());
+}
+
+TEST_F(ExternalSort, DuplicateKeysAndNulls)
+{
+  auto keys   = make_counting_transform_iterator(0, [](auto i) { return i % 17; });
+  auto valids = make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  fixed_width_column_wrapper<int64_t> col1(keys, keys + 500, valids);
+  table_view input({col1});
+
+  experimental::external_sorter sorter({0}, {order::ASCENDING}, {null_order::AFTER}, 10);
+  for (auto const& run : experimental::slice(input, {0, 123, 123, 400, 400, 500})) {
+    sorter.push(run);
+  }
+  auto const got      = read_all(sorter);
+  auto const expected = experimental::sort(input, {order::ASCENDING}, {null_order::AFTER});
+  expect_tables_equal(expected->view(), got->view());
+}
+
+TEST_F(ExternalSort, NoRuns)
+{
+  experimental::external_sorter sorter({0}, {order::ASCENDING});
+  EXPECT_FALSE(sorter.has_next());
+  EXPECT_THROW(sorter.next(), logic_error);
+}
+
+TEST_F(ExternalSort, PushAfterNext)
+{
+  fixed_width_column_wrapper<int32_t> col1{3, 1, 2};
+  experimental::external_sorter sorter({0}, {order::ASCENDING});
+  sorter.push(table_view({col1}));
+  sorter.next();
+  EXPECT_FALSE(sorter.has_next());
+  EXPECT_THROW(sorter.push(table_view({col1})), logic_error);
+}
+
+TEST_F(ExternalSort, MismatchedTypes)
+{
+  fixed_width_column_wrapper<int32_t> col1{3, 1, 2};
+  fixed_width_column_wrapper<float> col2{3, 1, 2};
+  experimental::external_sorter sorter({0}, {order::ASCENDING});
+  sorter.push(table_view({col1}));
+  EXPECT_THROW(sorter.push(table_view({col2})), logic_error);
+  EXPECT_THROW(experimental::external_sorter({0, 1}, {order::ASCENDING}), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
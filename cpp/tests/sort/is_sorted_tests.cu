@@ -25,6 +25,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_list_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
+#include <numeric>
 #include <vector>
 
 using namespace cudf::test;
@@ -366,4 +367,90 @@ struct IsSortedFixedWidthOnly : public cudf::test::BaseFixture {};
 
 TYPED_TEST_CASE(IsSortedFixedWidthOnly, cudf::test::FixedWidthTypes);
 
+struct IsSortedLargeTest : public cudf::test::BaseFixture {};
+
+TEST_F(IsSortedLargeTest, UnsortedAfterFirstBlocks)
+{
+    // Spans several of the blocks compared by is_sorted
+    std::vector<int32_t> values(300000);
+    std::iota(values.begin(), values.end(), 0);
+    fixed_width_column_wrapper<int32_t> sorted(values.begin(), values.end());
+    EXPECT_EQ(true, cudf::experimental::is_sorted(cudf::table_view{{ sorted }}, {}, {}));
+
+    std::swap(values[values.size() - 2], values.back());
+    fixed_width_column_wrapper<int32_t> unsorted(values.begin(), values.end());
+    EXPECT_EQ(false, cudf::experimental::is_sorted(cudf::table_view{{ unsorted }}, {}, {}));
+
+    // The swapped rows are the first pair of a block
+    std::swap(values[values.size() - 2], values.back());
+    std::swap(values[65535], values[65536]);
+    fixed_width_column_wrapper<int32_t> block_edge(values.begin(), values.end());
+    EXPECT_EQ(false, cudf::experimental::is_sorted(cudf::table_view{{ block_edge }}, {}, {}));
+}
+
+struct ProbeSortednessTest : public cudf::test::BaseFixture {};
+
+TEST_F(ProbeSortednessTest, SingleColumn)
+{
+    using cudf::experimental::probe_sortedness;
+    using cudf::experimental::sortedness;
+
+    fixed_width_column_wrapper<int32_t> ascending{ 1, 2, 2, 3, 4, 5, 6, 7, 8, 9 };
+    fixed_width_column_wrapper<int32_t> descending{ 9, 8, 7, 6, 5, 4, 3, 3, 2, 1 };
+    fixed_width_column_wrapper<int32_t> one_run_out{ 1, 2, 3, 4, 5, 0, 6, 7, 8, 9 };
+    fixed_width_column_wrapper<int32_t> unsorted{ 5, 1, 4, 2, 8, 0, 9, 3, 7, 6 };
+    fixed_width_column_wrapper<int32_t> equal{ 4, 4, 4, 4 };
+
+    EXPECT_EQ(sortedness::SORTED, probe_sortedness(cudf::table_view{{ ascending }}));
+    EXPECT_EQ(sortedness::REVERSE_SORTED, probe_sortedness(cudf::table_view{{ descending }}));
+    EXPECT_EQ(sortedness::UNSORTED, probe_sortedness(cudf::table_view{{ one_run_out }}));
+    EXPECT_EQ(sortedness::NEARLY_SORTED,
+              probe_sortedness(cudf::table_view{{ one_run_out }}, {}, {}, 0.2));
+    EXPECT_EQ(sortedness::UNSORTED,
+              probe_sortedness(cudf::table_view{{ unsorted }}, {}, {}, 0.2));
+    EXPECT_EQ(sortedness::SORTED, probe_sortedness(cudf::table_view{{ equal }}));
+    EXPECT_EQ(sortedness::REVERSE_SORTED,
+              probe_sortedness(cudf::table_view{{ ascending }}, { cudf::order::DESCENDING }));
+}
+
+TEST_F(ProbeSortednessTest, MultiColumn)
+{
+    using cudf::experimental::probe_sortedness;
+    using cudf::experimental::sortedness;
+
+    fixed_width_column_wrapper<int32_t> keys{ 1, 1, 1, 2, 2, 3 };
+    fixed_width_column_wrapper<int32_t> ascending{ 1, 2, 3, 1, 2, 1 };
+    fixed_width_column_wrapper<int32_t> descending{ 3, 2, 1, 2, 1, 1 };
+    fixed_width_column_wrapper<int32_t> nulls{ { 0, 1, 2, 1, 2, 1 }, { 0, 1, 1, 1, 1, 1 } };
+
+    std::vector<cudf::order> ascending_order{ cudf::order::ASCENDING, cudf::order::ASCENDING };
+    std::vector<cudf::order> mixed_order{ cudf::order::ASCENDING, cudf::order::DESCENDING };
+    EXPECT_EQ(sortedness::SORTED,
+              probe_sortedness(cudf::table_view{{ keys, ascending }}, ascending_order));
+    EXPECT_EQ(sortedness::UNSORTED,
+              probe_sortedness(cudf::table_view{{ keys, descending }}, ascending_order));
+    EXPECT_EQ(sortedness::SORTED,
+              probe_sortedness(cudf::table_view{{ keys, descending }}, mixed_order));
+
+    std::vector<cudf::null_order> nulls_before{ cudf::null_order::BEFORE,
+                                                cudf::null_order::BEFORE };
+    std::vector<cudf::null_order> nulls_after{ cudf::null_order::AFTER,
+                                               cudf::null_order::AFTER };
+    EXPECT_EQ(sortedness::SORTED,
+              probe_sortedness(cudf::table_view{{ keys, nulls }}, ascending_order, nulls_before));
+    EXPECT_EQ(sortedness::NEARLY_SORTED,
+              probe_sortedness(cudf::table_view{{ keys, nulls }}, ascending_order, nulls_after,
+                               0.2));
+}
+
+TEST_F(ProbeSortednessTest, OrderArgsTooFew)
+{
+    fixed_width_column_wrapper<int32_t> col1{ 1, 2, 3 };
+    fixed_width_column_wrapper<int32_t> col2{ 1, 2, 3 };
+
+    EXPECT_THROW(cudf::experimental::probe_sortedness(cudf::table_view{{ col1, col2 }},
+                                                      { cudf::order::ASCENDING }),
+                 cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -27,6 +27,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/legacy/cudf_test_utils.cuh>
 #include <tests/utilities/table_utilities.hpp>
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -277,6 +278,79 @@ TYPED_TEST(Sort, ZeroSizedColumns)
     run_sort_test(input, expected, column_order);
 }
 
+struct RadixSort : public BaseFixture {};
+
+TEST_F(RadixSort, FloatingPoint)
+{
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    double const inf = std::numeric_limits<double>::infinity();
+
+    fixed_width_column_wrapper<double>  col1    {nan, 1.0, -0.0, -inf, 0.0, -nan, -2.5, inf};
+    fixed_width_column_wrapper<int32_t> expected{  3,   6,    2,    4,   1,    7,    0,   5};
+
+    auto got = experimental::stable_sorted_order(table_view({col1}));
+
+    expect_columns_equal(expected, got->view());
+}
+
+TEST_F(RadixSort, PackedKeys)
+{
+    fixed_width_column_wrapper<int16_t> col1    {{3, 1, 3, 2, 1, 3}, {1, 1, 0, 1, 1, 1}};
+    fixed_width_column_wrapper<int32_t> col2    { 5, 7, 9, 1, 3, 2};
+    fixed_width_column_wrapper<int32_t> expected{ 1, 4, 3, 0, 5, 2};
+
+    table_view input {{col1, col2}};
+    std::vector<order> column_order {order::ASCENDING, order::DESCENDING};
+    std::vector<null_order> null_precedence {null_order::AFTER, null_order::BEFORE};
+
+    auto got = experimental::sorted_order(input, column_order, null_precedence);
+    expect_columns_equal(expected, got->view());
+
+    got = experimental::stable_sorted_order(input, column_order, null_precedence);
+    expect_columns_equal(expected, got->view());
+
+    run_sort_test(input, expected, column_order, null_precedence);
+}
+
+struct StringPrefixSort : public BaseFixture {};
+
+TEST_F(StringPrefixSort, TiedPrefixes)
+{
+    strings_column_wrapper col1({"abcdefghij", "abcdefghia", "abc", "", "x", "abcdefgh", "b",
+                                 "abcdefghij"},
+                                {1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<int32_t> col2{1, 2, 3, 4, 5, 6, 7, 0};
+    table_view input {{col1, col2}};
+
+    fixed_width_column_wrapper<int32_t> expected{4, 3, 2, 5, 1, 7, 0, 6};
+    std::vector<order> column_order {order::ASCENDING, order::ASCENDING};
+    std::vector<null_order> null_precedence {null_order::BEFORE, null_order::BEFORE};
+
+    auto got = experimental::sorted_order(input, column_order, null_precedence);
+    expect_columns_equal(expected, got->view());
+    got = experimental::stable_sorted_order(input, column_order, null_precedence);
+    expect_columns_equal(expected, got->view());
+    run_sort_test(input, expected, column_order, null_precedence);
+
+    fixed_width_column_wrapper<int32_t> expected_descending{4, 6, 0, 7, 1, 5, 2, 3};
+    column_order = {order::DESCENDING, order::DESCENDING};
+    null_precedence = {null_order::AFTER, null_order::AFTER};
+
+    got = experimental::sorted_order(input, column_order, null_precedence);
+    expect_columns_equal(expected_descending, got->view());
+    run_sort_test(input, expected_descending, column_order, null_precedence);
+}
+
+TEST_F(StringPrefixSort, Stable)
+{
+    strings_column_wrapper col1{"same prefix 2", "same prefix 1", "other", "same prefix 2",
+                                "same prefix 1", "same prefix 2"};
+    fixed_width_column_wrapper<int32_t> expected{2, 1, 4, 0, 3, 5};
+
+    auto got = experimental::stable_sorted_order(table_view({col1}));
+    expect_columns_equal(expected, got->view());
+}
+
 struct SortByKey : public BaseFixture {};
 
 TEST_F(SortByKey, ValueKeysSizeMismatch) {
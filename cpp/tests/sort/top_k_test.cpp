@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct TopK : public BaseFixture {};
+
+namespace {
+
+// Verifies top_k_order and top_k against the first `k` rows of a stable sort
+void expect_top_k(table_view input,
+                  size_type k,
+                  std::vector<order> const& column_order         = {},
+                  std::vector<null_order> const& null_precedence = {}) {
+  auto const sorted_indices =
+    experimental::stable_sorted_order(input, column_order, null_precedence);
+  auto const expected_size = std::min(k, input.num_rows());
+  auto const expected = experimental::slice(sorted_indices->view(), {0, expected_size}).front();
+
+  auto const got = experimental::top_k_order(input, k, column_order, null_precedence);
+  expect_columns_equal(expected, got->view());
+
+  auto const expected_rows = experimental::gather(input, expected);
+  auto const got_rows      = experimental::top_k(input, k, column_order, null_precedence);
+  expect_tables_equal(expected_rows->view(), got_rows->view());
+}
+
+}  // namespace
+
+TEST_F(TopK, Basic)
+{
+  fixed_width_column_wrapper<int32_t> col1{5, 1, 4, 1, 3};
+  fixed_width_column_wrapper<int32_t> expected{1, 3, 4};
+
+  auto got = experimental::top_k_order(table_view({col1}), 3);
+  expect_columns_equal(expected, got->view());
+}
+
+TEST_F(TopK, SampledUniqueValues)
+{
+  auto values = make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 5000; });
+  fixed_width_column_wrapper<int64_t> col1(values, values + 5000);
+  table_view input({col1});
+
+  expect_top_k(input, 10);
+  expect_top_k(input, 10, {order::DESCENDING});
+  expect_top_k(input, 100);
+}
+
+TEST_F(TopK, SampledTiesAndNulls)
+{
+  auto keys   = make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto valids = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto names  = make_counting_transform_iterator(0, [](auto i) { return std::to_string(i % 3); });
+  fixed_width_column_wrapper<int32_t> col1(keys, keys + 3000, valids);
+  strings_column_wrapper col2(names, names + 3000);
+  table_view input({col1, col2});
+
+  expect_top_k(input, 20);
+  expect_top_k(
+    input, 20, {order::ASCENDING, order::DESCENDING}, {null_order::AFTER, null_order::AFTER});
+  expect_top_k(
+    input, 20, {order::DESCENDING, order::ASCENDING}, {null_order::AFTER, null_order::BEFORE});
+}
+
+TEST_F(TopK, KLargerThanRows)
+{
+  fixed_width_column_wrapper<int32_t> col1{5, 1, 4, 1, 3};
+  table_view input({col1});
+
+  expect_top_k(input, 5);
+  expect_top_k(input, 10);
+  expect_top_k(input, 0);
+}
+
+TEST_F(TopK, NegativeK)
+{
+  fixed_width_column_wrapper<int32_t> col1{5, 1, 4, 1, 3};
+  EXPECT_THROW(experimental::top_k_order(table_view({col1}), -1), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -15,6 +15,8 @@
  */
 
 #include <cudf/types.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/table/table.hpp>
@@ -134,4 +136,80 @@ TEST_F(ApplyBooleanMask, NoNullInput) {
   cudf::test::expect_tables_equal(expected, got->view());
 }
 
+struct FilterAndSelect : public cudf::test::BaseFixture {};
+
+TEST_F(FilterAndSelect, SelectedColumns) {
+  using cudf::experimental::binary_operator;
+  using cudf::experimental::expression;
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> col2{{1.5, 2.5, 3.5, 4.5, 5.5, 6.5}};
+  cudf::test::strings_column_wrapper col3({"a", "b", "c", "d", "e", "f"}, {1, 0, 1, 1, 1, 1});
+  cudf::table_view input{{col1, col2, col3}};
+
+  // (col1 >= 5) && (col2 * 2 < 12)
+  cudf::numeric_scalar<int32_t> five{5};
+  cudf::numeric_scalar<double> two{2};
+  cudf::numeric_scalar<int64_t> twelve{12};
+  auto const bool8  = cudf::data_type{cudf::BOOL8};
+  auto const lhs    = expression::operation(binary_operator::GREATER_EQUAL,
+                                         expression::column_reference(0),
+                                         expression::literal(five),
+                                         bool8);
+  auto const scaled = expression::operation(binary_operator::MUL,
+                                            expression::column_reference(1),
+                                            expression::literal(two),
+                                            cudf::data_type{cudf::FLOAT64});
+  auto const rhs =
+    expression::operation(binary_operator::LESS, scaled, expression::literal(twelve), bool8);
+  auto const predicate = expression::operation(binary_operator::LOGICAL_AND, lhs, rhs, bool8);
+
+  auto got = cudf::experimental::filter_and_select(input, predicate, {2, 0});
+
+  cudf::test::strings_column_wrapper col3_expected({"a", "b", "d"}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{10, 40, 5};
+  cudf::table_view expected{{col3_expected, col1_expected}};
+  cudf::test::expect_tables_equal(expected, got->view());
+
+  // Same result as materializing the mask
+  auto mask = cudf::experimental::compute_column(input.select({0, 1}), predicate);
+  auto masked = cudf::experimental::apply_boolean_mask(input.select({2, 0}), *mask);
+  cudf::test::expect_tables_equal(masked->view(), got->view());
+}
+
+TEST_F(FilterAndSelect, InvalidLiteral) {
+  using cudf::experimental::binary_operator;
+  using cudf::experimental::expression;
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{10, 40, 70};
+  cudf::table_view input{{col1}};
+  cudf::numeric_scalar<int32_t> null_value{0, false};
+  auto const predicate = expression::operation(binary_operator::EQUAL,
+                                               expression::column_reference(0),
+                                               expression::literal(null_value),
+                                               cudf::data_type{cudf::BOOL8});
+
+  auto got = cudf::experimental::filter_and_select(input, predicate, {0});
+
+  EXPECT_EQ(got->num_rows(), 0);
+  EXPECT_EQ(got->num_columns(), 1);
+}
+
+TEST_F(FilterAndSelect, InvalidArguments) {
+  using cudf::experimental::binary_operator;
+  using cudf::experimental::expression;
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{10, 40, 70};
+  cudf::test::strings_column_wrapper col2({"a", "b", "c"});
+  cudf::table_view input{{col1, col2}};
+  auto const bool8   = cudf::data_type{cudf::BOOL8};
+  auto const col     = expression::column_reference(0);
+  auto const valid   = expression::operation(binary_operator::EQUAL, col, col, bool8);
+
+  EXPECT_THROW(cudf::experimental::filter_and_select(input, valid, {2}), cudf::logic_error);
+  EXPECT_THROW(cudf::experimental::filter_and_select(input, col, {0}), cudf::logic_error);
+  auto const str     = expression::column_reference(1);
+  auto const strings = expression::operation(binary_operator::EQUAL, str, str, bool8);
+  EXPECT_THROW(cudf::experimental::filter_and_select(input, strings, {0}), cudf::logic_error);
+  auto const bitwise = expression::operation(binary_operator::BITWISE_AND, col, col, bool8);
+  EXPECT_THROW(cudf::experimental::filter_and_select(input, bitwise, {0}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
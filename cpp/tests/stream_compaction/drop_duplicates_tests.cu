@@ -21,6 +21,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/sorting.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 #include <tests/utilities/table_utilities.hpp>
@@ -289,7 +290,45 @@ TEST_F(DropDuplicate, EmptyKeys)
     cudf::test::expect_tables_equal(cudf::table_view{{empty_col}}, got->view());
 }
 
+TEST_F(DropDuplicate, KeepAny)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> col1{{5, 4, 3, 5, 8, 5, 4, 1}, {1, 1, 1, 1, 1, 1, 0, 0}};
+    cudf::test::strings_column_wrapper col2{{"a", "b", "c", "a", "d", "a", "e", "f"}};
+    cudf::table_view input {{col1, col2}};
+    std::vector<cudf::size_type> keys{0};
+
+    auto got = drop_duplicates(input, keys, cudf::experimental::duplicate_keep_option::KEEP_ANY);
+    auto got_keys = cudf::experimental::sort(got->view().select({0}));
 
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 3, 4, 5, 8}, {0, 1, 1, 1, 1}};
+    cudf::test::expect_tables_equal(cudf::table_view{{expected}}, got_keys->view());
+
+    auto got_unequal_nulls = drop_duplicates(input, keys, cudf::experimental::duplicate_keep_option::KEEP_ANY, false);
+    EXPECT_EQ(got_unequal_nulls->num_rows(), 6);
+}
 
+struct ApproxDistinctCount : public cudf::test::BaseFixture {};
 
+TEST_F(ApproxDistinctCount, Estimate)
+{
+    auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5000; });
+    auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+    cudf::test::fixed_width_column_wrapper<int64_t> col1(values, values + 100000);
+    cudf::test::fixed_width_column_wrapper<int32_t> col2(values, values + 100000, valids);
+
+    // The relative standard error is 0.8% with 2^14 registers
+    auto const count = cudf::experimental::approx_distinct_count(cudf::table_view{{col1}}, 14);
+    EXPECT_NEAR(count, 5000, 5000 * 0.04);
+
+    auto const expected = cudf::experimental::unique_count(col2, false, false);
+    auto const count_with_nulls = cudf::experimental::approx_distinct_count(cudf::table_view{{col2}}, 14);
+    EXPECT_NEAR(count_with_nulls, expected, expected * 0.04);
+}
 
+TEST_F(ApproxDistinctCount, EmptyAndInvalid)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> col{};
+    EXPECT_EQ(0, cudf::experimental::approx_distinct_count(cudf::table_view{{col}}));
+    EXPECT_THROW(cudf::experimental::approx_distinct_count(cudf::table_view{{col}}, 3), cudf::logic_error);
+    EXPECT_THROW(cudf::experimental::approx_distinct_count(cudf::table_view{{col}}, 19), cudf::logic_error);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <vector>
+
+namespace {
+
+using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+}  // namespace
+
+/**
+ * @brief Runs the algorithms on a non-blocking stream, which does not
+ * synchronize with the default stream, and checks their results once that
+ * stream is synchronized
+ */
+struct NonDefaultStreamTest : public cudf::test::BaseFixture {
+  void SetUp() override {
+    ASSERT_CUDA_SUCCEEDED(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  }
+
+  void TearDown() override { ASSERT_CUDA_SUCCEEDED(cudaStreamDestroy(stream)); }
+
+  // The inputs are copied to the device on the default stream
+  void inputs_ready() { ASSERT_CUDA_SUCCEEDED(cudaStreamSynchronize(0)); }
+
+  void results_ready() { ASSERT_CUDA_SUCCEEDED(cudaStreamSynchronize(stream)); }
+
+  /// Sorts the rows of a join result, whose order is unspecified
+  std::unique_ptr<cudf::experimental::table> sorted(cudf::table_view const& input) {
+    return cudf::experimental::sort(
+      input, {}, std::vector<cudf::null_order>(input.num_columns(), cudf::null_order::AFTER));
+  }
+
+  cudaStream_t stream{};
+};
+
+TEST_F(NonDefaultStreamTest, Sort) {
+  int32_wrapper keys{3, 1, 2, 4, 0};
+  int32_wrapper duplicate_keys{2, 1, 2, 0, 1};
+  int32_wrapper values{30, 10, 20, 40, 0};
+  inputs_ready();
+  auto const mr = rmm::mr::get_default_resource();
+
+  auto order = cudf::experimental::sorted_order(cudf::table_view{{keys}}, {}, {}, mr, stream);
+  auto stable_order = cudf::experimental::stable_sorted_order(
+    cudf::table_view{{duplicate_keys}}, {}, {}, mr, stream);
+  auto sorted = cudf::experimental::sort(
+    cudf::table_view{{keys, values}}, {cudf::order::DESCENDING}, {}, mr, stream);
+  auto sorted_by_key = cudf::experimental::sort_by_key(
+    cudf::table_view{{values}}, cudf::table_view{{keys}}, {}, {}, mr, stream);
+  results_ready();
+
+  cudf::test::expect_columns_equal(*order, int32_wrapper{4, 1, 2, 0, 3});
+  cudf::test::expect_columns_equal(*stable_order, int32_wrapper{3, 1, 4, 0, 2});
+  cudf::test::expect_tables_equal(
+    sorted->view(),
+    cudf::table_view{{int32_wrapper{4, 3, 2, 1, 0}, int32_wrapper{40, 30, 20, 10, 0}}});
+  cudf::test::expect_columns_equal(sorted_by_key->get_column(0),
+                                   int32_wrapper{0, 10, 20, 30, 40});
+}
+
+TEST_F(NonDefaultStreamTest, Gather) {
+  int32_wrapper first{1, 2, 3, 4, 5};
+  cudf::test::strings_column_wrapper second({"a", "b", "", "d", "e"}, {1, 1, 0, 1, 1});
+  int32_wrapper gather_map{4, 2, 0, 2};
+  inputs_ready();
+
+  auto result = cudf::experimental::gather(cudf::table_view{{first, second}},
+                                           gather_map,
+                                           false,
+                                           rmm::mr::get_default_resource(),
+                                           stream);
+  results_ready();
+
+  cudf::test::strings_column_wrapper expected_second({"e", "", "a", ""}, {1, 0, 1, 0});
+  cudf::test::expect_tables_equal(result->view(),
+                                  cudf::table_view{{int32_wrapper{5, 3, 1, 3}, expected_second}});
+}
+
+TEST_F(NonDefaultStreamTest, Join) {
+  int32_wrapper left_keys{0, 1, 2, 3};
+  int32_wrapper left_values{10, 11, 12, 13};
+  int32_wrapper right_keys{3, 1, 4};
+  int32_wrapper right_values{23, 21, 24};
+  inputs_ready();
+  cudf::table_view left{{left_keys, left_values}};
+  cudf::table_view right{{right_keys, right_values}};
+  auto const mr = rmm::mr::get_default_resource();
+
+  auto inner = cudf::experimental::inner_join(left, right, {0}, {0}, {{0, 0}}, mr, stream);
+  auto left_result = cudf::experimental::left_join(left, right, {0}, {0}, {{0, 0}}, mr, stream);
+  auto full = cudf::experimental::full_join(left, right, {0}, {0}, {{0, 0}}, mr, stream);
+  results_ready();
+
+  cudf::test::expect_tables_equal(
+    sorted(inner->view())->view(),
+    cudf::table_view{{int32_wrapper{1, 3}, int32_wrapper{11, 13}, int32_wrapper{21, 23}}});
+  cudf::test::expect_tables_equal(
+    sorted(left_result->view())->view(),
+    cudf::table_view{{int32_wrapper{0, 1, 2, 3},
+                      int32_wrapper{10, 11, 12, 13},
+                      int32_wrapper({0, 21, 0, 23}, {0, 1, 0, 1})}});
+  cudf::test::expect_tables_equal(
+    sorted(full->view())->view(),
+    cudf::table_view{{int32_wrapper{0, 1, 2, 3, 4},
+                      int32_wrapper({10, 11, 12, 13, 0}, {1, 1, 1, 1, 0}),
+                      int32_wrapper({0, 21, 0, 23, 24}, {0, 1, 0, 1, 1})}});
+}
+
+TEST_F(NonDefaultStreamTest, GroupbyAggregate) {
+  int32_wrapper keys{1, 2, 1, 3, 2};
+  int32_wrapper values{1, 2, 3, 4, 5};
+  inputs_ready();
+
+  std::vector<cudf::experimental::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+  cudf::experimental::groupby::groupby gb(cudf::table_view{{keys}});
+  auto result = gb.aggregate(requests, rmm::mr::get_default_resource(), stream);
+  results_ready();
+
+  // the hash groupby keys are in no particular order
+  auto sorted_result = sorted(
+    cudf::table_view{{result.first->get_column(0), result.second[0].results[0]->view()}});
+  cudf::test::expect_tables_equal(
+    sorted_result->view(),
+    cudf::table_view{
+      {int32_wrapper{1, 2, 3}, cudf::test::fixed_width_column_wrapper<int64_t>{4, 7, 4}}});
+}
@@ -21,6 +21,7 @@
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/copying.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/strings/detail/inline_string_view.cuh>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +31,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <string>
 #include <vector>
 #include <gmock/gmock.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -50,6 +52,32 @@ TEST_F(StringsColumnTest, Sort)
     cudf::test::expect_columns_equal(*results, h_expected);
 }
 
+TEST_F(StringsColumnTest, InlineStringViews)
+{
+    cudf::test::strings_column_wrapper h_strings({ "abcdefghijklmnop", "abcd", "<null>", "", "abcdefghijkl",
+                                                   "abcdefghijklmnoa", "ééé" },
+                                                 { 1, 1, 0, 1, 1, 1, 1 });
+    auto strings_view = cudf::strings_column_view(h_strings);
+    {
+        auto views = cudf::strings::detail::create_inline_string_views(strings_view);
+        auto results = cudf::strings::detail::make_strings_column(views, strings_view);
+        cudf::test::expect_columns_equal(*results, h_strings);
+    }
+    {
+        auto sliced = cudf::experimental::slice(h_strings, {3, 7}).front();
+        auto views = cudf::strings::detail::create_inline_string_views(cudf::strings_column_view(sliced));
+        auto results = cudf::strings::detail::make_strings_column(views, cudf::strings_column_view(sliced));
+        cudf::test::expect_columns_equal(*results, sliced);
+    }
+    {   // strings sharing their inline prefixes
+        cudf::test::strings_column_wrapper h_expected({ "<null>", "", "abcd", "abcdefghijkl", "abcdefghijklmnoa",
+                                                        "abcdefghijklmnop", "ééé" },
+                                                      { 0, 1, 1, 1, 1, 1, 1 });
+        auto results = cudf::strings::detail::sort(strings_view, cudf::strings::detail::name);
+        cudf::test::expect_columns_equal(*results, h_expected);
+    }
+}
+
 TEST_F(StringsColumnTest, SortZeroSizeStringsColumn)
 {
     cudf::column_view zero_size_strings_column( cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -156,6 +184,36 @@ TEST_F(StringsColumnTest, GatherZeroSizeStringsColumn)
     cudf::test::expect_strings_empty(results.front()->view());
 }
 
+TEST_F(StringsColumnTest, GatherLongStrings)
+{
+    // Long strings of different lengths are copied in chunks of characters, which span strings
+    cudf::size_type const count = 1000;
+    std::vector<std::string> h_strings(count);
+    std::vector<bool> h_valids(count);
+    for (cudf::size_type i = 0; i < count; ++i) {
+        h_strings[i] = std::string(i % 97, static_cast<char>('a' + i % 26));
+        h_valids[i]  = i % 13 != 0;
+    }
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), h_valids.begin());
+
+    std::vector<int32_t> h_map;
+    std::vector<std::string> h_expected;
+    std::vector<bool> h_expected_valids;
+    for (cudf::size_type i = count - 1; i >= 0; i -= 3) {
+        for (auto index : {i, i / 2}) {
+            h_map.push_back(index);
+            h_expected.push_back(h_valids[index] ? h_strings[index] : std::string{});
+            h_expected_valids.push_back(h_valids[index]);
+        }
+    }
+    cudf::test::fixed_width_column_wrapper<int32_t> gather_map(h_map.begin(), h_map.end());
+    auto results = cudf::experimental::gather(cudf::table_view{{strings}}, gather_map)->release();
+
+    cudf::test::strings_column_wrapper expected(h_expected.begin(), h_expected.end(),
+                                                h_expected_valids.begin());
+    cudf::test::expect_columns_equal(results.front()->view(), expected);
+}
+
 struct column_to_string_view_vector
 {
     cudf::column_device_view const d_strings;
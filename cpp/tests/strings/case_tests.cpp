@@ -18,6 +18,7 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/capitalize.hpp>
+#include <cudf/copying.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_wrapper.hpp>
@@ -77,6 +78,25 @@ TEST_F(StringsCaseTest, Swapcase)
     cudf::test::expect_columns_equal(*results,expected);
 }
 
+TEST_F(StringsCaseTest, LongStrings)
+{
+    // strings longer than LONG_STRING_BYTES are converted by a whole warp
+    std::string h_long, h_long_upper;
+    for( int idx=0; idx < 100; ++idx )
+    {
+        h_long += "Éxamples aBc \ufb05";
+        h_long_upper += "ÉXAMPLES ABC ST";
+    }
+    std::vector<std::string> h_strings{ h_long, "tést strings", h_long + "é", "" };
+    std::vector<std::string> h_expected{ h_long_upper, "TÉST STRINGS", h_long_upper + "É", "" };
+
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end() );
+    auto results = cudf::strings::to_upper(cudf::strings_column_view(strings));
+
+    cudf::test::strings_column_wrapper expected( h_expected.begin(), h_expected.end() );
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
     cudf::column_view zero_size_strings_column( cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -140,3 +160,25 @@ TEST_F(StringsCaseTest, MultiCharLower)
     
     cudf::test::expect_columns_equal(*results,expected);
 }
+
+TEST_F(StringsCaseTest, AsciiSlicedStrings)
+{
+    // ASCII strings are converted byte by byte; the offsets of a slice start at 0
+    std::vector<const char*> h_strings{ "Héllo", "Examples aBc", "123 456", nullptr, "ARE the", "", "z@[`{" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    auto sliced = cudf::experimental::slice(strings, {1, 7}).front();
+    auto strings_view = cudf::strings_column_view(sliced);
+
+    std::vector<const char*> h_upper{ "EXAMPLES ABC", "123 456", nullptr, "ARE THE", "", "Z@[`{" };
+    std::vector<const char*> h_lower{ "examples abc", "123 456", nullptr, "are the", "", "z@[`{" };
+    std::vector<const char*> h_swapped{ "eXAMPLES AbC", "123 456", nullptr, "are THE", "", "Z@[`{" };
+    auto validity = thrust::make_transform_iterator( h_upper.begin(), [] (auto str) { return str!=nullptr; });
+    cudf::test::strings_column_wrapper upper( h_upper.begin(), h_upper.end(), validity);
+    cudf::test::strings_column_wrapper lower( h_lower.begin(), h_lower.end(), validity);
+    cudf::test::strings_column_wrapper swapped( h_swapped.begin(), h_swapped.end(), validity);
+
+    cudf::test::expect_columns_equal(*cudf::strings::to_upper(strings_view), upper);
+    cudf::test::expect_columns_equal(*cudf::strings::to_lower(strings_view), lower);
+    cudf::test::expect_columns_equal(*cudf::strings::swapcase(strings_view), swapped);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -64,6 +65,21 @@ TEST_P(StringsCharsTestTypes, AllTypes)
     cudf::test::expect_columns_equal(*results,expected);
 }
 
+TEST_P(StringsCharsTestTypes, AsciiStrings)
+{
+    // a slice of only ASCII strings is checked byte by byte
+    std::vector<const char*> h_strings{ "Héllo", "1234567890", "de", "\t\r\n\f ", "HERE", nullptr, "a1", "" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    auto is_parm = GetParam();
+
+    auto all_results = cudf::strings::all_characters_of_type(cudf::strings_column_view(strings),is_parm);
+    auto expected = cudf::experimental::slice(all_results->view(), {1, 8}).front();
+    auto sliced = cudf::experimental::slice(strings, {1, 8}).front();
+    auto results = cudf::strings::all_characters_of_type(cudf::strings_column_view(sliced),is_parm);
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
 INSTANTIATE_TEST_CASE_P(StringsCharsTestAllTypes, StringsCharsTestTypes,
     testing::ValuesIn(std::array<cudf::strings::string_character_types,7>
     { cudf::strings::string_character_types::DECIMAL,
@@ -21,6 +21,11 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <rmm/mr/device/cnmem_memory_resource.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <memory>
+#include <string>
 #include <vector>
 
 
@@ -220,6 +225,41 @@ TEST_F(StringsContainsTests, CountTest)
     }
 }
 
+TEST_F(StringsContainsTests, NonAsciiTest)
+{
+    std::vector<const char*> h_strings{
+        "bér", "ber", "béér", "café au lait", "naïve", nullptr, "" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    auto validity = thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; });
+
+    auto strings_view = cudf::strings_column_view(strings);
+    {   // all non-ASCII characters match alike
+        auto results = cudf::strings::contains_re(strings_view,"b.r");
+        bool h_expected[] = {true,true,false,false,false,false,false};
+        cudf::test::fixed_width_column_wrapper<bool> expected( h_expected, h_expected+h_strings.size(), validity);
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+    {   // a non-ASCII literal
+        auto results = cudf::strings::contains_re(strings_view,"é");
+        bool h_expected[] = {true,false,true,true,false,false,false};
+        cudf::test::fixed_width_column_wrapper<bool> expected( h_expected, h_expected+h_strings.size(), validity);
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+    {
+        auto results = cudf::strings::matches_re(strings_view,"[^ ]+ au");
+        bool h_expected[] = {false,false,false,true,false,false,false};
+        cudf::test::fixed_width_column_wrapper<bool> expected( h_expected, h_expected+h_strings.size(), validity);
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+    {
+        auto results = cudf::strings::count_re(strings_view,"a[^a]");
+        int32_t h_expected[] = {0,0,0,3,1,0,0};
+        cudf::test::fixed_width_column_wrapper<int32_t> expected( h_expected, h_expected+h_strings.size(), validity);
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
     // This results in 95 regex instructions and falls in the 'medium' range.
@@ -293,3 +333,94 @@ TEST_F(StringsContainsTests, LargeRegex)
         cudf::test::expect_columns_equal(*results,expected);
     }
 }
+
+TEST_F(StringsContainsTests, RepeatedPatterns)
+{
+    // The compiled programs are reused across calls and columns of different sizes
+    cudf::test::strings_column_wrapper strings1({"abc", "xbc", "", "ab", "bcab"});
+    cudf::test::strings_column_wrapper strings2({"ab", "123abc"});
+    auto strings_view1 = cudf::strings_column_view(strings1);
+    auto strings_view2 = cudf::strings_column_view(strings2);
+    for( int i = 0; i < 3; ++i )
+    {
+        {
+            auto results = cudf::strings::contains_re(strings_view1, "ab");
+            cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 1, 1});
+            cudf::test::expect_columns_equal(*results,expected);
+        }
+        {
+            auto results = cudf::strings::matches_re(strings_view2, "ab");
+            cudf::test::fixed_width_column_wrapper<bool> expected({1, 0});
+            cudf::test::expect_columns_equal(*results,expected);
+        }
+        {
+            auto results = cudf::strings::count_re(strings_view1, "b");
+            cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1, 0, 1, 2});
+            cudf::test::expect_columns_equal(*results,expected);
+        }
+        {
+            auto results = cudf::strings::count_re(strings_view2, "ab");
+            cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1});
+            cudf::test::expect_columns_equal(*results,expected);
+        }
+    }
+}
+
+TEST_F(StringsContainsTests, MultiplePatterns)
+{
+    std::vector<const char*> h_strings{ "abc", "123", nullptr, "def456", "", "a1b2" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    auto strings_view = cudf::strings_column_view(strings);
+    auto validity = thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; });
+    std::vector<std::string> patterns{ "\\d+", "a", "^$", "[b-e]+" };
+
+    // each column is the result of its own pattern
+    {
+        auto results = cudf::strings::contains_re(strings_view, patterns);
+        ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(patterns.size()));
+        for( std::size_t i = 0; i < patterns.size(); ++i )
+        {
+            auto expected = cudf::strings::contains_re(strings_view, patterns[i]);
+            cudf::test::expect_columns_equal(results->get_column(i), *expected);
+        }
+        cudf::test::fixed_width_column_wrapper<bool> expected( {0, 1, 0, 1, 0, 1}, validity);
+        cudf::test::expect_columns_equal(results->get_column(0), expected);
+    }
+    {
+        auto results = cudf::strings::matches_re(strings_view, patterns);
+        for( std::size_t i = 0; i < patterns.size(); ++i )
+        {
+            auto expected = cudf::strings::matches_re(strings_view, patterns[i]);
+            cudf::test::expect_columns_equal(results->get_column(i), *expected);
+        }
+    }
+    {
+        auto results = cudf::strings::count_re(strings_view, patterns);
+        for( std::size_t i = 0; i < patterns.size(); ++i )
+        {
+            auto expected = cudf::strings::count_re(strings_view, patterns[i]);
+            cudf::test::expect_columns_equal(results->get_column(i), *expected);
+        }
+        cudf::test::fixed_width_column_wrapper<int32_t> expected( {0, 1, 0, 1, 0, 2}, validity);
+        cudf::test::expect_columns_equal(results->get_column(0), expected);
+    }
+}
+
+TEST_F(StringsContainsTests, PatternsOutliveMemoryResource)
+{
+    // The cached program must remain valid after the resource active when it
+    // was compiled is destroyed
+    cudf::test::strings_column_wrapper strings({"abc", "xbc", "", "ab", "bcab"});
+    auto strings_view = cudf::strings_column_view(strings);
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0, 0});
+    {
+        auto resource = std::make_unique<rmm::mr::cnmem_memory_resource>();
+        auto previous = rmm::mr::set_default_resource(resource.get());
+        auto results  = cudf::strings::contains_re(strings_view, "xb+c");
+        cudf::test::expect_columns_equal(*results,expected);
+        rmm::mr::set_default_resource(previous);
+    }
+    auto results = cudf::strings::contains_re(strings_view, "xb+c");
+    cudf::test::expect_columns_equal(*results,expected);
+}
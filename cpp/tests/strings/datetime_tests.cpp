@@ -182,6 +182,25 @@ TEST_F(StringsDatetimeTest, FromTimestampDayOfYear)
     cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsDatetimeTest, ISO8601Layouts)
+{
+    cudf::test::strings_column_wrapper dates{ "1974-02-28", "2019-07-17", "2020-02-29", "2020-02" };
+    auto results = cudf::strings::to_timestamps(cudf::strings_column_view(dates), cudf::data_type{cudf::TIMESTAMP_DAYS}, "%Y-%m-%d" );
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_D> expected_days{ 1519, 18094, 18321, 0 };
+    cudf::test::expect_columns_equal(*results, expected_days);
+    results = cudf::strings::from_timestamps(expected_days, "%Y-%m-%d");
+    cudf::test::strings_column_wrapper expected_dates{ "1974-02-28", "2019-07-17", "2020-02-29", "1970-01-01" };
+    cudf::test::expect_columns_equal(*results, expected_dates);
+
+    cudf::test::strings_column_wrapper strings{ "1974-02-28T01:23:45.987Z", "2019-07-17T21:34:37.123Z", "2019-07-17T21:34" };
+    results = cudf::strings::to_timestamps(cudf::strings_column_view(strings), cudf::data_type{cudf::TIMESTAMP_MILLISECONDS}, "%Y-%m-%dT%H:%M:%S.%3fZ" );
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms> expected_ms{ 131246625987, 1563399277123, 0 };
+    cudf::test::expect_columns_equal(*results, expected_ms);
+    results = cudf::strings::from_timestamps(expected_ms, "%Y-%m-%d %H:%M:%S.%3fZ");
+    cudf::test::strings_column_wrapper expected_strings{ "1974-02-28 01:23:45.987Z", "2019-07-17 21:34:37.123Z", "1970-01-01 00:00:00.000Z" };
+    cudf::test::expect_columns_equal(*results, expected_strings);
+}
+
 TEST_F(StringsDatetimeTest, ZeroSizeStringsColumn)
 {
     cudf::column_view zero_size_column( cudf::data_type{cudf::TIMESTAMP_SECONDS}, 0, nullptr, nullptr, 0);
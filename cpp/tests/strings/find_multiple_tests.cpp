@@ -53,6 +53,33 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
     cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, FindAny)
+{
+    std::vector<const char*> h_strings{ "Héllo", "thesé", nullptr, "lease", "test strings", "", "abcd" };
+    auto validity = thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; });
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(), validity );
+    auto strings_view = cudf::strings_column_view(strings);
+
+    cudf::test::strings_column_wrapper targets( {"llo", "sé", "ease", "x", "st", "c", "bcd"} );
+    auto targets_view = cudf::strings_column_view(targets);
+    {
+        auto results = cudf::strings::find_any(strings_view, targets_view);
+        cudf::test::fixed_width_column_wrapper<int32_t> expected( {2, 3, 0, 1, 2, -1, 1}, validity );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+        auto results = cudf::strings::contains_any(strings_view, targets_view);
+        cudf::test::fixed_width_column_wrapper<bool> expected( {1, 1, 0, 1, 1, 0, 1}, validity );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+    {   // an empty target is found at the beginning of every string
+        cudf::test::strings_column_wrapper empty_target( {"x", ""} );
+        auto results = cudf::strings::find_any(strings_view, cudf::strings_column_view(empty_target));
+        cudf::test::fixed_width_column_wrapper<int32_t> expected( {0, 0, 0, 0, 0, 0, 0}, validity );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
     cudf::column_view zero_size_strings_column( cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -77,4 +104,7 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
 
     // targets cannot have nulls
     EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
+
+    EXPECT_THROW(cudf::strings::find_any(strings_view, empty_view), cudf::logic_error);
+    EXPECT_THROW(cudf::strings::contains_any(strings_view, strings_view), cudf::logic_error);
 }
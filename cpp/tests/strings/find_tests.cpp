@@ -93,6 +93,23 @@ TEST_F(StringsFindTest, Find)
     }
 }
 
+TEST_F(StringsFindTest, ContainsLongStrings)
+{
+    // strings longer than LONG_STRING_BYTES are searched by a whole warp
+    std::string h_long(2000, 'a');
+    std::vector<std::string> h_strings{ h_long, h_long + "tést", "", "tést", h_long + "té" + h_long };
+    std::vector<bool> h_validity{ true, true, false, true, true };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(), h_validity.begin() );
+    auto strings_view = cudf::strings_column_view(strings);
+
+    auto results = cudf::strings::contains(strings_view,cudf::string_scalar("tést"));
+    cudf::test::fixed_width_column_wrapper<bool> expected( {0, 1, 0, 1, 0}, {1, 1, 0, 1, 1} );
+    cudf::test::expect_columns_equal(*results,expected);
+    results = cudf::strings::contains(strings_view,cudf::string_scalar("até"));
+    cudf::test::fixed_width_column_wrapper<bool> expected_prefix( {0, 1, 0, 0, 1}, {1, 1, 0, 1, 1} );
+    cudf::test::expect_columns_equal(*results,expected_prefix);
+}
+
 TEST_F(StringsFindTest, ZeroSizeStringsColumn)
 {
     cudf::column_view zero_size_strings_column( cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
@@ -58,7 +58,7 @@ TEST_F(StringsConvertTest, FromFloats32)
     std::vector<float> h_floats{ 100, 654321.25, -12761.125, 0, 5, -4,
                                  std::numeric_limits<float>::quiet_NaN(), 839542223232.79 };
     std::vector<const char*> h_expected{ "100.0", "654321.25", "-12761.125", "0.0", "5.0", "-4.0",
-                                         "NaN", "8.395422433e+11" };
+                                         "NaN", "8.3954224e+11" };
 
     cudf::test::fixed_width_column_wrapper<float> floats( h_floats.begin(), h_floats.end(),
         thrust::make_transform_iterator( h_expected.begin(), [] (auto str) { return str!=nullptr; }));
@@ -100,7 +100,7 @@ TEST_F(StringsConvertTest, FromFloats64)
     std::vector<double> h_floats{ 100, 654321.25, -12761.125, 0, 5, -4,
                                  std::numeric_limits<double>::quiet_NaN(), 839542223232.794248339 };
     std::vector<const char*> h_expected{ "100.0", "654321.25", "-12761.125", "0.0", "5.0", "-4.0",
-                                 "NaN", "8.395422232e+11" };
+                                 "NaN", "8.395422232327942e+11" };
 
     cudf::test::fixed_width_column_wrapper<double> floats( h_floats.begin(), h_floats.end(),
         thrust::make_transform_iterator( h_expected.begin(), [] (auto str) { return str!=nullptr; }));
@@ -113,6 +113,44 @@ TEST_F(StringsConvertTest, FromFloats64)
     cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToFloats64Rounding)
+{
+    // each string is the nearest double, or halfway between two of them
+    std::vector<const char*> h_strings{ "9007199254740993", "2.2250738585072011e-308",
+            "0.30000000000000004", "1.7976931348623157e308", "4.9e-324",
+            "123456789012345678901234567890e-10", "1e-400", "-1e400" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end() );
+
+    std::vector<double> h_expected{ 9007199254740992.0, 2.2250738585072009e-308,
+            0.30000000000000004, 1.7976931348623157e308, 4.9406564584124654e-324,
+            1.2345678901234567e+19, 0.0, -std::numeric_limits<double>::infinity() };
+
+    auto strings_view = cudf::strings_column_view(strings);
+    auto results = cudf::strings::to_floats(strings_view, cudf::data_type{cudf::FLOAT64} );
+
+    cudf::test::fixed_width_column_wrapper<double> expected( h_expected.begin(), h_expected.end() );
+    cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsConvertTest, FromFloatsShortest)
+{
+    std::vector<double> h_floats{ 0.1, 0.30000000000000004, 1e9, 1.5e9, 0.0001, 1e-5,
+                                  4.9406564584124654e-324, 1.7976931348623157e308 };
+    std::vector<const char*> h_expected{ "0.1", "0.30000000000000004", "1000000000.0", "1.5e+09",
+                                         "0.0001", "1.0e-05", "5.0e-324",
+                                         "1.7976931348623157e+308" };
+    cudf::test::fixed_width_column_wrapper<double> floats( h_floats.begin(), h_floats.end() );
+
+    auto results = cudf::strings::from_floats(floats);
+    cudf::test::strings_column_wrapper expected( h_expected.begin(), h_expected.end() );
+    cudf::test::expect_columns_equal(*results, expected);
+
+    // the strings convert back to the same values
+    auto strings_view = cudf::strings_column_view(*results);
+    auto floats_again = cudf::strings::to_floats(strings_view, cudf::data_type{cudf::FLOAT64});
+    cudf::test::expect_columns_equal(*floats_again, floats);
+}
+
 TEST_F(StringsConvertTest, ZeroSizeStringsColumnFloat)
 {
     cudf::column_view zero_size_column( cudf::data_type{cudf::FLOAT32}, 0, nullptr, nullptr, 0);
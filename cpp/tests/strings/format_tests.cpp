@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/format.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/strings/utilities.h>
+
+#include <limits>
+#include <vector>
+
+
+struct StringsFormatTest : public cudf::test::BaseFixture {};
+
+TEST_F(StringsFormatTest, MixedTypes)
+{
+    cudf::test::strings_column_wrapper strings( {"a", "bb", "", "éé"}, {1,1,0,1} );
+    std::vector<int64_t> h_integers{ 1, -22, 3, std::numeric_limits<int64_t>::min() };
+    cudf::test::fixed_width_column_wrapper<int64_t> integers( h_integers.begin(), h_integers.end() );
+    cudf::test::fixed_width_column_wrapper<double> floats( {0.5, 1.0, 2.5, -1.25} );
+    cudf::test::fixed_width_column_wrapper<bool> booleans( {true, false, true, false} );
+    cudf::table_view table( {strings, integers, floats, booleans} );
+
+    {
+        std::vector<const char*> h_expected{ "a-1:0.5 true", "bb--22:1.0 false", nullptr,
+                                             "éé--9223372036854775808:-1.25 false" };
+        cudf::test::strings_column_wrapper expected( h_expected.begin(), h_expected.end(),
+            thrust::make_transform_iterator( h_expected.begin(), [] (auto str) { return str!=nullptr; }));
+
+        auto results = cudf::strings::format(table, "{}-{}:{} {}");
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+    {
+        cudf::test::strings_column_wrapper expected( {"[a|1]", "[bb|-22]", "[_|3]",
+                                                      "[éé|-9223372036854775808]"} );
+        auto results = cudf::strings::format(table, "[{}|{}]", cudf::string_scalar("_"));
+        cudf::test::expect_columns_equal(*results,expected);
+    }
+}
+
+TEST_F(StringsFormatTest, FixedPoint)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> reps32( {1234, -5, 0, 70, -1200}, {1,1,1,1,0} );
+    cudf::test::fixed_width_column_wrapper<int64_t> reps64( {12, -3, 0, 999, 1} );
+    auto const decimals = cudf::column_view{cudf::data_type{cudf::DECIMAL32, -2}, 5,
+        cudf::column_view(reps32).head(), cudf::column_view(reps32).null_mask(), 1};
+    auto const scaled_up = cudf::column_view{cudf::data_type{cudf::DECIMAL64, 2}, 5,
+        cudf::column_view(reps64).head()};
+    auto const thousandths = cudf::column_view{cudf::data_type{cudf::DECIMAL64, -3}, 5,
+        cudf::column_view(reps64).head()};
+    cudf::table_view table( {decimals, scaled_up, thousandths} );
+
+    // 12.34 is stored as 1234 with scale -2
+    cudf::test::strings_column_wrapper expected( {"12.34 1200 0.012", "-0.05 -300 -0.003",
+                                                  "0.00 0 0.000", "0.70 99900 0.999",
+                                                  "_ 100 0.001"} );
+    auto results = cudf::strings::format(table, "{} {} {}", cudf::string_scalar("_"));
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
+TEST_F(StringsFormatTest, ExplicitIndices)
+{
+    cudf::test::strings_column_wrapper strings( {"a", "bb", ""}, {1,1,0} );
+    cudf::test::fixed_width_column_wrapper<int32_t> integers( {1, 22, 3} );
+    cudf::table_view table( {strings, integers} );
+
+    cudf::test::strings_column_wrapper expected( {"1,a,{1}", "22,bb,{22}", "3,_,{3}"} );
+    auto results = cudf::strings::format(table, "{1},{0},{{{1}}}", cudf::string_scalar("_"));
+    cudf::test::expect_columns_equal(*results,expected);
+
+    // the nulls of a column that is not written do not matter
+    cudf::test::strings_column_wrapper expected_integers( {"#1#1", "#22#22", "#3#3"} );
+    results = cudf::strings::format(table, "#{1}#{1}");
+    cudf::test::expect_columns_equal(*results,expected_integers);
+}
+
+TEST_F(StringsFormatTest, LiteralsOnly)
+{
+    cudf::test::fixed_width_column_wrapper<int32_t> integers( {1, 2} );
+    cudf::table_view table( {integers} );
+
+    cudf::test::strings_column_wrapper expected( {"{x}", "{x}"} );
+    auto results = cudf::strings::format(table, "{{x}}");
+    cudf::test::expect_columns_equal(*results,expected);
+
+    cudf::test::strings_column_wrapper expected_empty( {"", ""} );
+    results = cudf::strings::format(table, "");
+    cudf::test::expect_columns_equal(*results,expected_empty);
+}
+
+TEST_F(StringsFormatTest, ZeroSizeColumns)
+{
+    cudf::column_view zero_size_strings_column( cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
+    cudf::table_view table( {zero_size_strings_column} );
+    auto results = cudf::strings::format(table, "<{}>");
+    cudf::test::expect_strings_empty(results->view());
+}
+
+TEST_F(StringsFormatTest, Errors)
+{
+    cudf::test::strings_column_wrapper strings( {"a", "b"} );
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_D> timestamps( {1, 2} );
+    cudf::table_view table( {strings, timestamps} );
+
+    EXPECT_THROW( cudf::strings::format(table, "{"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "}"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "{x}"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "{0}{}"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "{2}"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "{}{}{}"), cudf::logic_error );
+    EXPECT_THROW( cudf::strings::format(table, "{1}"), cudf::logic_error );
+    // columns not in the pattern are not checked
+    EXPECT_NO_THROW( cudf::strings::format(table, "{0}") );
+}
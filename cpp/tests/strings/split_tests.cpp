@@ -463,6 +463,58 @@ TEST_F(StringsSplitTest, ContiguousSplitRecordZeroSizeStringsColumns)
     EXPECT_TRUE(rsplit_record_result.column_views.size() == 0);
 }
 
+TEST_F(StringsSplitTest, SplitOffsets)
+{
+    std::vector<const char*> h_strings{ "a_bc", nullptr, "", "d__e" };
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator(h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    cudf::strings_column_view strings_view(strings);
+
+    auto result = cudf::strings::split_offsets(strings_view, cudf::string_scalar("_"));
+    cudf::test::expect_columns_equal(*result.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 2, 3, 6 });
+    cudf::test::expect_columns_equal(*result.token_begins,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 4, 4, 6, 7 });
+    cudf::test::expect_columns_equal(*result.token_ends,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 4, 4, 5, 6, 8 });
+
+    result = cudf::strings::split_offsets(strings_view, cudf::string_scalar("_"), 1);
+    cudf::test::expect_columns_equal(*result.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 2, 3, 5 });
+    cudf::test::expect_columns_equal(*result.token_begins,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 4, 4, 6 });
+    cudf::test::expect_columns_equal(*result.token_ends,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 4, 4, 5, 8 });
+}
+
+TEST_F(StringsSplitTest, SplitOffsetsWhitespace)
+{
+    cudf::test::strings_column_wrapper strings({ " ab  c d", "x", "  " });
+    cudf::strings_column_view strings_view(strings);
+
+    auto result = cudf::strings::split_offsets(strings_view);
+    cudf::test::expect_columns_equal(*result.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 3, 4, 4 });
+    cudf::test::expect_columns_equal(*result.token_begins,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 5, 7, 8 });
+    cudf::test::expect_columns_equal(*result.token_ends,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 3, 6, 8, 9 });
+
+    result = cudf::strings::split_offsets(strings_view, cudf::string_scalar(""), 1);
+    cudf::test::expect_columns_equal(*result.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 3, 3 });
+    cudf::test::expect_columns_equal(*result.token_begins,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 5, 8 });
+    cudf::test::expect_columns_equal(*result.token_ends,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 3, 8, 9 });
+
+    cudf::column_view zero_size_strings_column(cudf::data_type{cudf::STRING}, 0, nullptr, nullptr, 0);
+    result = cudf::strings::split_offsets(zero_size_strings_column);
+    EXPECT_EQ(result.row_offsets->size(), 0);
+    EXPECT_THROW(cudf::strings::split_offsets(strings_view, cudf::string_scalar("", false)),
+                 cudf::logic_error);
+}
+
 TEST_F(StringsSplitTest, Partition)
 {
     std::vector<const char*> h_strings{   "héllo", nullptr, "a_bc_déf", "a__bc", "_ab_cd", "ab_cd_", "", " a b " };
@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/substring.hpp>
+#include <cudf/strings/attributes.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 #include <tests/utilities/base_fixture.hpp>
@@ -24,6 +25,7 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <thrust/sequence.h>
@@ -256,3 +258,56 @@ TEST_F(StringsSubstringsTest, Error)
     auto strings_column = cudf::strings_column_view(strings);
     EXPECT_THROW( cudf::strings::slice_strings(strings_column,0,0,0), cudf::logic_error );
 }
+
+TEST_F(StringsSubstringsTest, LongMultiByteStrings)
+{
+    // long strings of 1 to 4 byte characters, beginning at different alignments
+    std::vector<std::string> pattern{ "a", "é", "中", "😀" };
+    std::vector<std::vector<std::string>> h_chars;
+    std::vector<std::string> h_strings;
+    for( int idx=0; idx < 8; ++idx )
+    {
+        std::vector<std::string> chars(idx, "x");
+        for( int jdx=0; jdx < 200; ++jdx )
+            chars.push_back(pattern[(jdx * (idx + 1)) % pattern.size()]);
+        std::string str;
+        for( auto const& chr : chars )
+            str += chr;
+        h_chars.push_back(chars);
+        h_strings.push_back(str);
+    }
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end() );
+    auto strings_column = cudf::strings_column_view(strings);
+
+    auto substring = [&h_chars] (int start, int stop, int step) {
+        std::vector<std::string> result;
+        for( auto const& chars : h_chars )
+        {
+            std::string str;
+            for( int pos = start; pos < std::min(stop, static_cast<int>(chars.size())); pos += step )
+                str += chars[pos];
+            result.push_back(str);
+        }
+        return result;
+    };
+    {
+        auto results = cudf::strings::slice_strings(strings_column, 37, 150);
+        auto h_expected = substring(37, 150, 1);
+        cudf::test::strings_column_wrapper expected( h_expected.begin(), h_expected.end() );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+        auto results = cudf::strings::slice_strings(strings_column, 5, 190, 7);
+        auto h_expected = substring(5, 190, 7);
+        cudf::test::strings_column_wrapper expected( h_expected.begin(), h_expected.end() );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+    {
+        auto results = cudf::strings::count_characters(strings_column);
+        std::vector<int32_t> h_expected;
+        for( auto const& chars : h_chars )
+            h_expected.push_back(static_cast<int32_t>(chars.size()));
+        cudf::test::fixed_width_column_wrapper<int32_t> expected( h_expected.begin(), h_expected.end() );
+        cudf::test::expect_columns_equal(*results, expected);
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+namespace {
+
+using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+// builds a structs column of two INT32 fields
+std::unique_ptr<cudf::column> make_structs(int32_wrapper&& first,
+                                           int32_wrapper&& second,
+                                           std::vector<bool> const& validity = {}) {
+  std::vector<std::unique_ptr<cudf::column>> children;
+  children.push_back(first.release());
+  children.push_back(second.release());
+  auto const rows = children.front()->size();
+  rmm::device_buffer null_mask{};
+  cudf::size_type null_count = 0;
+  if (!validity.empty()) {
+    std::vector<int32_t> zeros(rows, 0);
+    auto mask_column = int32_wrapper(zeros.begin(), zeros.end(), validity.begin()).release();
+    null_count       = mask_column->null_count();
+    null_mask        = std::move(*(mask_column->release().null_mask));
+  }
+  return cudf::make_structs_column(rows, std::move(children), null_count, std::move(null_mask));
+}
+
+void expect_structs_equal(cudf::column_view const& lhs, cudf::column_view const& rhs) {
+  cudf::structs_column_view lhs_structs(lhs);
+  cudf::structs_column_view rhs_structs(rhs);
+  EXPECT_EQ(lhs_structs.size(), rhs_structs.size());
+  EXPECT_EQ(lhs_structs.null_count(), rhs_structs.null_count());
+  ASSERT_EQ(lhs_structs.num_children(), rhs_structs.num_children());
+  for (cudf::size_type idx = 0; idx < lhs_structs.num_children(); ++idx) {
+    cudf::test::expect_columns_equal(lhs_structs.sliced_child(idx),
+                                     rhs_structs.sliced_child(idx));
+  }
+}
+
+}  // namespace
+
+struct StructsColumnTest : public cudf::test::BaseFixture {};
+
+TEST_F(StructsColumnTest, Factory) {
+  auto structs = make_structs({1, 2, 3, 4}, {5, 6, 7, 8}, {1, 0, 1, 1});
+  cudf::structs_column_view view(structs->view());
+  EXPECT_EQ(view.size(), 4);
+  EXPECT_EQ(view.null_count(), 1);
+  EXPECT_EQ(view.num_children(), 2);
+  EXPECT_EQ(view.parent().type().id(), cudf::STRUCT);
+
+  auto sliced = cudf::experimental::slice(structs->view(), {1, 3}).front();
+  cudf::structs_column_view sliced_view(sliced);
+  cudf::test::expect_columns_equal(sliced_view.sliced_child(0), int32_wrapper{2, 3});
+  cudf::test::expect_columns_equal(sliced_view.sliced_child(1), int32_wrapper{6, 7});
+
+  std::vector<std::unique_ptr<cudf::column>> children;
+  children.push_back(int32_wrapper{1, 2}.release());
+  EXPECT_THROW(cudf::make_structs_column(3, std::move(children), 0, rmm::device_buffer{}),
+               cudf::logic_error);
+}
+
+TEST_F(StructsColumnTest, SortedOrder) {
+  auto structs = make_structs({3, 1, 3, 1, 2}, {1, 2, 0, 1, 5}, {1, 1, 1, 1, 0});
+  auto result  = cudf::experimental::sorted_order(
+    cudf::table_view{{structs->view()}}, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  cudf::test::expect_columns_equal(*result, int32_wrapper{4, 3, 1, 2, 0});
+
+  result = cudf::experimental::sorted_order(
+    cudf::table_view{{structs->view()}}, {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+  cudf::test::expect_columns_equal(*result, int32_wrapper{4, 0, 2, 1, 3});
+}
+
+TEST_F(StructsColumnTest, SortedOrderNullFields) {
+  // the null fields order before the valid ones within their structs
+  auto structs = make_structs({{2, 2, 1, 1}, {1, 1, 0, 1}}, {{3, 1, 2, 0}, {1, 1, 1, 1}});
+  auto values  = int32_wrapper{0, 1, 2, 3};
+  auto result  = cudf::experimental::sorted_order(cudf::table_view{{structs->view(), values}});
+  cudf::test::expect_columns_equal(*result, int32_wrapper{2, 3, 1, 0});
+}
+
+TEST_F(StructsColumnTest, Gather) {
+  auto structs = make_structs({1, 2, 3, 4}, {{5, 6, 7, 8}, {1, 1, 0, 1}}, {1, 0, 1, 1});
+  auto result  = cudf::experimental::gather(cudf::table_view{{structs->view()}},
+                                           int32_wrapper{3, 2, 0, 1});
+  auto expected = make_structs({4, 3, 1, 2}, {{8, 7, 5, 6}, {1, 0, 1, 1}}, {1, 1, 1, 0});
+  expect_structs_equal(result->get_column(0), *expected);
+}
+
+TEST_F(StructsColumnTest, Scatter) {
+  auto target = make_structs({1, 2, 3, 4}, {{5, 6, 7, 8}, {1, 1, 0, 1}}, {1, 0, 1, 1});
+  auto source = make_structs({10, 20, 30}, {{40, 50, 60}, {0, 1, 1}}, {1, 0, 1});
+  auto result = cudf::experimental::scatter(cudf::table_view{{source->view()}},
+                                            int32_wrapper{1, 2},
+                                            cudf::table_view{{target->view()}});
+  auto expected = make_structs({1, 10, 20, 4}, {{5, 40, 50, 8}, {1, 0, 1, 1}}, {1, 1, 0, 1});
+  expect_structs_equal(result->get_column(0), *expected);
+}
+
+TEST_F(StructsColumnTest, Concatenate) {
+  auto first  = make_structs({1, 2}, {5, 6}, {1, 0});
+  auto second = make_structs({3, 4, 5}, {7, 8, 9});
+  auto result = cudf::concatenate(
+    {first->view(), cudf::experimental::slice(second->view(), {1, 3}).front()});
+  auto expected = make_structs({1, 2, 4, 5}, {5, 6, 8, 9}, {1, 0, 1, 1});
+  expect_structs_equal(*result, *expected);
+}
+
+TEST_F(StructsColumnTest, Groupby) {
+  auto keys   = make_structs({1, 2, 1, 2, 2}, {1, 2, 1, 3, 2});
+  auto values = int32_wrapper{1, 2, 3, 4, 5};
+
+  std::vector<cudf::experimental::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+  cudf::experimental::groupby::groupby hash_groupby(cudf::table_view{{keys->view()}});
+  auto result = hash_groupby.aggregate(requests);
+
+  // the hash groupby keys are in no particular order
+  auto const sort_order = cudf::experimental::sorted_order(result.first->view());
+  auto sorted_keys      = cudf::experimental::gather(result.first->view(), *sort_order);
+  auto sorted_sums      = cudf::experimental::gather(
+    cudf::table_view{{result.second[0].results[0]->view()}}, *sort_order);
+  auto expected_keys = make_structs({1, 2, 2}, {1, 2, 3});
+  expect_structs_equal(sorted_keys->get_column(0), *expected_keys);
+  cudf::test::expect_columns_equal(sorted_sums->get_column(0),
+                                   cudf::test::fixed_width_column_wrapper<int64_t>{4, 7, 4});
+
+  requests[0].aggregations.clear();
+  requests[0].aggregations.push_back(cudf::experimental::make_median_aggregation());
+  cudf::experimental::groupby::groupby sort_groupby(cudf::table_view{{keys->view()}});
+  result = sort_groupby.aggregate(requests);
+  expect_structs_equal(result.first->get_column(0), *expected_keys);
+  cudf::test::expect_columns_equal(*result.second[0].results[0],
+                                   cudf::test::fixed_width_column_wrapper<double>{2, 3.5, 4});
+}
+
+TEST_F(StructsColumnTest, GroupbyNullKeys) {
+  auto keys   = make_structs({1, 1, 1, 2}, {{1, 1, 1, 2}, {0, 0, 1, 1}}, {1, 1, 1, 0});
+  auto values = int32_wrapper{1, 2, 3, 4};
+
+  std::vector<cudf::experimental::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::experimental::make_sum_aggregation());
+  cudf::experimental::groupby::groupby gb(cudf::table_view{{keys->view()}});
+  auto result = gb.aggregate(requests);
+
+  // the structs with null fields are one group and the null struct is skipped
+  auto const sort_order = cudf::experimental::sorted_order(result.first->view());
+  auto sorted_sums      = cudf::experimental::gather(
+    cudf::table_view{{result.second[0].results[0]->view()}}, *sort_order);
+  cudf::test::expect_columns_equal(sorted_sums->get_column(0),
+                                   cudf::test::fixed_width_column_wrapper<int64_t>{3, 3});
+}
+
+TEST_F(StructsColumnTest, InnerJoin) {
+  auto left_keys    = make_structs({1, 2, 3}, {1, 2, 3});
+  auto left_values  = int32_wrapper{10, 20, 30};
+  auto right_keys   = make_structs({2, 3, 1}, {2, 4, 1});
+  auto right_values = int32_wrapper{200, 340, 110};
+
+  auto result = cudf::experimental::inner_join(cudf::table_view{{left_keys->view(), left_values}},
+                                               cudf::table_view{{right_keys->view(), right_values}},
+                                               {0},
+                                               {0},
+                                               {});
+  ASSERT_EQ(result->num_columns(), 4);
+  auto const sort_order =
+    cudf::experimental::sorted_order(cudf::table_view{{result->get_column(1).view()}});
+  auto sorted = cudf::experimental::gather(result->view(), *sort_order);
+  expect_structs_equal(sorted->get_column(0), *make_structs({1, 2}, {1, 2}));
+  cudf::test::expect_columns_equal(sorted->get_column(1), int32_wrapper{10, 20});
+  cudf::test::expect_columns_equal(sorted->get_column(3), int32_wrapper{110, 200});
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/edit_distance.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+
+#include <vector>
+
+
+struct TextEditDistanceTest : public cudf::test::BaseFixture {};
+
+TEST_F(TextEditDistanceTest, EditDistance)
+{
+    std::vector<const char*> h_strings{ "hello", nullptr, "world", "kitten", "mousé" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    cudf::strings_column_view strings_view( strings );
+    cudf::test::strings_column_wrapper targets{ "hallo", "goodbye", "world", "sitting", "house" };
+
+    auto results = nvtext::edit_distance(strings_view, cudf::strings_column_view(targets));
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{ 1, 7, 0, 3, 2 };
+    cudf::test::expect_columns_equal(*results,expected);
+
+    cudf::test::strings_column_wrapper target{ "kitten" };
+    results = nvtext::edit_distance(strings_view, cudf::strings_column_view(target));
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_single{ 6, 6, 6, 0, 6 };
+    cudf::test::expect_columns_equal(*results,expected_single);
+}
+
+TEST_F(TextEditDistanceTest, LongStrings)
+{
+    cudf::test::strings_column_wrapper strings{
+        "the quick brown fox jumps over the lazy dog and keeps running far away", "short" };
+    cudf::test::strings_column_wrapper targets{
+        "the quick brown cat jumps over the lazy dog and keeps running far away!", "" };
+    auto results = nvtext::edit_distance(cudf::strings_column_view(strings),
+                                         cudf::strings_column_view(targets));
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{ 4, 5 };
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
+TEST_F(TextEditDistanceTest, EditDistanceMatrix)
+{
+    cudf::test::strings_column_wrapper strings{ "hello", "hallo", "hell", "" };
+    auto results = nvtext::edit_distance_matrix(cudf::strings_column_view(strings));
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{ 0, 1, 1, 5,
+                                                              1, 0, 2, 5,
+                                                              1, 2, 0, 4,
+                                                              5, 5, 4, 0 };
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
+TEST_F(TextEditDistanceTest, ErrorTest)
+{
+    cudf::test::strings_column_wrapper strings{ "a", "b", "c" };
+    cudf::test::strings_column_wrapper targets{ "a", "b" };
+    EXPECT_THROW( nvtext::edit_distance(cudf::strings_column_view(strings),
+                                        cudf::strings_column_view(targets)), cudf::logic_error );
+}
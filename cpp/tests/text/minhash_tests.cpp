@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+
+struct TextMinHashTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// reference MurmurHash3_x86_32
+uint32_t murmur_hash(std::string const& key, uint32_t seed)
+{
+    auto rotl32 = [] (uint32_t x, int8_t r) { return (x << r) | (x >> (32 - r)); };
+    auto const data = reinterpret_cast<uint8_t const*>(key.data());
+    auto const len = static_cast<int>(key.size());
+    uint32_t h1 = seed;
+    uint32_t k1 = 0;
+    int i = 0;
+    for( ; i + 4 <= len; i += 4 )
+    {
+        k1 = data[i] | (data[i+1] << 8) | (data[i+2] << 16) | (static_cast<uint32_t>(data[i+3]) << 24);
+        k1 *= 0xcc9e2d51; k1 = rotl32(k1,15); k1 *= 0x1b873593;
+        h1 ^= k1; h1 = rotl32(h1,13); h1 = h1 * 5 + 0xe6546b64;
+    }
+    k1 = 0;
+    for( int j = len - 1; j >= i; --j )
+        k1 = (k1 << 8) | data[j];
+    if( len & 3 )
+    {
+        k1 *= 0xcc9e2d51; k1 = rotl32(k1,15); k1 *= 0x1b873593;
+        h1 ^= k1;
+    }
+    h1 ^= len;
+    h1 ^= h1 >> 16; h1 *= 0x85ebca6b; h1 ^= h1 >> 13; h1 *= 0xc2b2ae35; h1 ^= h1 >> 16;
+    return h1;
+}
+
+// minimum hash of the ngrams of an ASCII string
+int32_t min_hash(std::string const& str, uint32_t seed, size_t width)
+{
+    if( str.size() <= width )
+        return static_cast<int32_t>(murmur_hash(str, seed));
+    uint32_t result = std::numeric_limits<uint32_t>::max();
+    for( size_t pos = 0; pos + width <= str.size(); ++pos )
+        result = std::min(result, murmur_hash(str.substr(pos, width), seed));
+    return static_cast<int32_t>(result);
+}
+
+} // namespace
+
+TEST_F(TextMinHashTest, MinHash)
+{
+    std::vector<const char*> h_strings{ "the quick brown fox", nullptr, "ab", "" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    cudf::strings_column_view strings_view( strings );
+    cudf::test::fixed_width_column_wrapper<int32_t> seeds{ 0, 7 };
+
+    auto results = nvtext::minhash(strings_view, seeds, 4);
+    std::vector<int32_t> h_expected;
+    std::vector<bool> h_valids;
+    for( auto str : h_strings )
+    {
+        for( uint32_t seed : { 0, 7 } )
+        {
+            h_expected.push_back(str ? min_hash(str, seed, 4) : 0);
+            h_valids.push_back(str != nullptr);
+        }
+    }
+    cudf::test::fixed_width_column_wrapper<int32_t> expected( h_expected.begin(), h_expected.end(),
+                                                              h_valids.begin() );
+    cudf::test::expect_columns_equal(*results,expected);
+}
+
+TEST_F(TextMinHashTest, ErrorTest)
+{
+    cudf::test::strings_column_wrapper strings{ "this column intentionally left blank" };
+    cudf::strings_column_view strings_view( strings );
+    cudf::test::fixed_width_column_wrapper<int32_t> seeds{ 0 };
+    cudf::test::fixed_width_column_wrapper<int64_t> bad_seeds{ 0 };
+    EXPECT_THROW( nvtext::minhash(strings_view, seeds, 0), cudf::logic_error );
+    EXPECT_THROW( nvtext::minhash(strings_view, bad_seeds), cudf::logic_error );
+}
@@ -23,11 +23,52 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/column_utilities.hpp>
 
+#include <string>
 #include <vector>
 
 
 struct TextNgramsTokenizeTest : public cudf::test::BaseFixture {};
 
+namespace {
+
+// reference MurmurHash3_x86_32 with seed 0
+int32_t murmur_hash(std::string const& key)
+{
+    auto rotl32 = [] (uint32_t x, int8_t r) { return (x << r) | (x >> (32 - r)); };
+    auto const data = reinterpret_cast<uint8_t const*>(key.data());
+    auto const len = static_cast<int>(key.size());
+    uint32_t h1 = 0;
+    uint32_t k1 = 0;
+    int i = 0;
+    for( ; i + 4 <= len; i += 4 )
+    {
+        k1 = data[i] | (data[i+1] << 8) | (data[i+2] << 16) | (static_cast<uint32_t>(data[i+3]) << 24);
+        k1 *= 0xcc9e2d51; k1 = rotl32(k1,15); k1 *= 0x1b873593;
+        h1 ^= k1; h1 = rotl32(h1,13); h1 = h1 * 5 + 0xe6546b64;
+    }
+    k1 = 0;
+    for( int j = len - 1; j >= i; --j )
+        k1 = (k1 << 8) | data[j];
+    if( len & 3 )
+    {
+        k1 *= 0xcc9e2d51; k1 = rotl32(k1,15); k1 *= 0x1b873593;
+        h1 ^= k1;
+    }
+    h1 ^= len;
+    h1 ^= h1 >> 16; h1 *= 0x85ebca6b; h1 ^= h1 >> 13; h1 *= 0xc2b2ae35; h1 ^= h1 >> 16;
+    return static_cast<int32_t>(h1);
+}
+
+cudf::test::fixed_width_column_wrapper<int32_t> expected_hashes(std::vector<std::string> const& ngrams)
+{
+    std::vector<int32_t> hashes;
+    for( auto const& ngram : ngrams )
+        hashes.push_back(murmur_hash(ngram));
+    return cudf::test::fixed_width_column_wrapper<int32_t>(hashes.begin(), hashes.end());
+}
+
+} // namespace
+
 TEST_F(TextNgramsTokenizeTest, Tokenize)
 {
     std::vector<const char*> h_strings{ "the fox jumped over the dog",
@@ -91,3 +132,42 @@ TEST_F(TextNgramsTokenizeTest, TokenizeErrorTest)
     cudf::strings_column_view strings_view( strings );
     EXPECT_THROW( nvtext::ngrams_tokenize(strings_view,0), cudf::logic_error );
 }
+
+TEST_F(TextNgramsTokenizeTest, HashNgrams)
+{
+    std::vector<const char*> h_strings{ "the fox  jumped", nullptr, "", " dog ", "the mousé ate" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    cudf::strings_column_view strings_view( strings );
+
+    auto results = nvtext::hash_ngrams_tokenize(strings_view);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 2, 2, 2, 2, 4 });
+    cudf::test::expect_columns_equal(*results.hashes,
+        expected_hashes({ "the fox", "fox jumped", "the mousé", "mousé ate" }));
+
+    results = nvtext::hash_ngrams_tokenize(strings_view, 1, nvtext::ngram_type::TOKENS,
+                                           cudf::string_scalar(""), cudf::string_scalar("_"));
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 3, 3, 3, 4, 7 });
+    cudf::test::expect_columns_equal(*results.hashes,
+        expected_hashes({ "the", "fox", "jumped", "dog", "the", "mousé", "ate" }));
+
+    results = nvtext::hash_ngrams_tokenize(strings_view, 3, nvtext::ngram_type::TOKENS,
+                                           cudf::string_scalar(""), cudf::string_scalar("_"));
+    cudf::test::expect_columns_equal(*results.hashes,
+        expected_hashes({ "the_fox_jumped", "the_mousé_ate" }));
+}
+
+TEST_F(TextNgramsTokenizeTest, HashCharacterNgrams)
+{
+    cudf::test::strings_column_wrapper strings{ "a bb  ccc", "mousé" };
+    cudf::strings_column_view strings_view( strings );
+    auto results = nvtext::hash_ngrams_tokenize(strings_view, 2, nvtext::ngram_type::CHARACTERS);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 3, 7 });
+    cudf::test::expect_columns_equal(*results.hashes,
+        expected_hashes({ "bb", "cc", "cc", "mo", "ou", "us", "sé" }));
+
+    EXPECT_THROW( nvtext::hash_ngrams_tokenize(strings_view,0), cudf::logic_error );
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/subword_tokenize.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/column_utilities.hpp>
+
+#include <vector>
+
+
+struct TextSubwordTest : public cudf::test::BaseFixture {};
+
+TEST_F(TextSubwordTest, Tokenize)
+{
+    cudf::test::strings_column_wrapper vocabulary{ "[UNK]", "the", "play", "##ing", "!",
+                                                   "##s", "mous", "##é", "[PAD]" };
+    nvtext::wordpiece_vocabulary vocab(cudf::strings_column_view(vocabulary));
+    EXPECT_EQ(vocab.unknown_token_id(), 0);
+
+    std::vector<const char*> h_strings{ "the playing!", nullptr, "plays  mousé", "xyz the" };
+    cudf::test::strings_column_wrapper strings( h_strings.begin(), h_strings.end(),
+        thrust::make_transform_iterator( h_strings.begin(), [] (auto str) { return str!=nullptr; }));
+    cudf::strings_column_view strings_view( strings );
+
+    auto results = nvtext::subword_tokenize(strings_view, vocab);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 4, 4, 8, 10 });
+    cudf::test::expect_columns_equal(*results.token_ids,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 2, 3, 4, 2, 5, 6, 7, 0, 1 });
+    cudf::test::expect_columns_equal(*results.attention_mask,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 });
+
+    results = nvtext::subword_tokenize(strings_view, vocab, 3, 8);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 3, 6, 9, 12 });
+    cudf::test::expect_columns_equal(*results.token_ids,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 2, 3, 8, 8, 8, 2, 5, 6, 0, 1, 8 });
+    cudf::test::expect_columns_equal(*results.attention_mask,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0 });
+
+    results = nvtext::subword_tokenize(strings_view, vocab, 0, 0, 4);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 3, 3, 5, 7 });
+    cudf::test::expect_columns_equal(*results.token_ids,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 1, 0, 4, 0, 0, 0, 1 });
+}
+
+TEST_F(TextSubwordTest, EmptyStrings)
+{
+    cudf::test::strings_column_wrapper vocabulary{ "[UNK]", "a" };
+    nvtext::wordpiece_vocabulary vocab(cudf::strings_column_view(vocabulary));
+    cudf::test::strings_column_wrapper strings{ "", "  " };
+    auto results = nvtext::subword_tokenize(cudf::strings_column_view(strings), vocab);
+    cudf::test::expect_columns_equal(*results.row_offsets,
+        cudf::test::fixed_width_column_wrapper<int32_t>{ 0, 0, 0 });
+    EXPECT_EQ(results.token_ids->size(), 0);
+    EXPECT_EQ(results.attention_mask->size(), 0);
+}
+
+TEST_F(TextSubwordTest, ErrorTest)
+{
+    cudf::test::strings_column_wrapper vocabulary{ "the", "##s" };
+    EXPECT_THROW(nvtext::wordpiece_vocabulary(cudf::strings_column_view(vocabulary)),
+                 cudf::logic_error);
+    EXPECT_THROW(nvtext::load_vocabulary_file("/nonexistent/vocab.txt"), cudf::logic_error);
+
+    nvtext::wordpiece_vocabulary vocab(cudf::strings_column_view(vocabulary), "the");
+    cudf::strings_column_view strings_view(vocabulary);
+    EXPECT_THROW(nvtext::subword_tokenize(strings_view, vocab, -1), cudf::logic_error);
+    EXPECT_THROW(nvtext::subword_tokenize(strings_view, vocab, 0, 0, -1), cudf::logic_error);
+}
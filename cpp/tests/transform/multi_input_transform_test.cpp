@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace test {
+
+struct MultiInputTransformTest : public BaseFixture {};
+
+TEST_F(MultiInputTransformTest, TwoOutputs)
+{
+  const char* cuda =
+    R"***(
+__device__ inline void sum_and_product(double* sum, int64_t* product, float a, int32_t b)
+{
+  *sum     = a + b;
+  *product = static_cast<int64_t>(a) * b;
+}
+)***";
+
+  fixed_width_column_wrapper<float> a{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  fixed_width_column_wrapper<int32_t> b{{10, 20, 30, 40, 50}, {1, 1, 1, 0, 1}};
+
+  auto const out = experimental::transform(
+    table_view({a, b}), cuda, {data_type{FLOAT64}, data_type{INT64}}, false);
+
+  fixed_width_column_wrapper<double> expected_sum{{11, 22, 0, 0, 55}, {1, 1, 0, 0, 1}};
+  fixed_width_column_wrapper<int64_t> expected_product{{10, 40, 0, 0, 250}, {1, 1, 0, 0, 1}};
+  ASSERT_EQ(out->num_columns(), 2);
+  expect_columns_equal(out->get_column(0), expected_sum);
+  expect_columns_equal(out->get_column(1), expected_product);
+}
+
+TEST_F(MultiInputTransformTest, ThreeInputs)
+{
+  const char* cuda =
+    R"***(
+__device__ inline void multiply_add(double* out, double a, double b, double c)
+{
+  *out = a * b + c;
+}
+)***";
+
+  fixed_width_column_wrapper<double> a{1, 2, 3};
+  fixed_width_column_wrapper<double> b{4, 5, 6};
+  fixed_width_column_wrapper<double> c{7, 8, 9};
+
+  auto const out =
+    experimental::transform(table_view({a, b, c}), cuda, {data_type{FLOAT64}}, false);
+
+  fixed_width_column_wrapper<double> expected{11, 18, 27};
+  expect_columns_equal(out->get_column(0), expected);
+}
+
+TEST_F(MultiInputTransformTest, InvalidArguments)
+{
+  const char* cuda =
+    R"***(
+__device__ inline void copy(double* out, double a)
+{
+  *out = a;
+}
+)***";
+
+  fixed_width_column_wrapper<double> a{1, 2, 3};
+  strings_column_wrapper names{"a", "b", "c"};
+
+  EXPECT_THROW(experimental::transform(table_view{}, cuda, {data_type{FLOAT64}}, false),
+               cudf::logic_error);
+  EXPECT_THROW(experimental::transform(table_view({a}), cuda, {}, false), cudf::logic_error);
+  EXPECT_THROW(experimental::transform(table_view({names}), cuda, {data_type{FLOAT64}}, false),
+               cudf::logic_error);
+  EXPECT_THROW(experimental::transform(
+                 table_view({a}), cuda, {data_type{FLOAT64}, data_type{FLOAT64}}, true),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -206,6 +206,11 @@ TYPED_TEST(TransposeTest, FatNulls)
   run_test<TypeParam>(1000, 10, true);
 }
 
+TYPED_TEST(TransposeTest, ManyTilesNulls)
+{
+  run_test<TypeParam>(70, 300, true);
+}
+
 TYPED_TEST(TransposeTest, EmptyTable)
 {
   run_test<TypeParam>(0, 0, false);
@@ -79,8 +79,37 @@ INSTANTIATE_TEST_CASE_P(TestAllIds, IdDispatcherTest,
 
 TEST_P(IdDispatcherTest, IdToType) {
   auto t = GetParam();
+  if (not cudf::experimental::is_dispatched(t)) {
+    EXPECT_THROW(
+      cudf::experimental::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t),
+      cudf::logic_error);
+    return;
+  }
   EXPECT_TRUE(cudf::experimental::type_dispatcher(cudf::data_type{t},
                                          verify_dispatched_type{}, t));
 }
 
+TEST_F(DispatcherTest, IsDispatched) {
+  EXPECT_TRUE(cudf::experimental::is_dispatched(cudf::type_id::BOOL8));
+  EXPECT_TRUE(cudf::experimental::is_dispatched(cudf::type_id::INT32));
+  EXPECT_TRUE(cudf::experimental::is_dispatched(cudf::type_id::STRING));
+  EXPECT_FALSE(cudf::experimental::is_dispatched(cudf::type_id::EMPTY));
+#ifdef CUDF_EXCLUDE_TIMESTAMP_DISPATCH
+  EXPECT_FALSE(cudf::experimental::is_dispatched(cudf::type_id::TIMESTAMP_DAYS));
+#else
+  EXPECT_TRUE(cudf::experimental::is_dispatched(cudf::type_id::TIMESTAMP_DAYS));
+#endif
+}
+
+// The type lists only hold dispatched types, so check the excluded ones directly
+TEST_F(DispatcherTest, ExcludedTypesThrow) {
+  for (int i = 0; i < cudf::type_id::NUM_TYPE_IDS; ++i) {
+    auto const t = static_cast<cudf::type_id>(i);
+    if (t == cudf::type_id::EMPTY || cudf::experimental::is_dispatched(t)) { continue; }
+    EXPECT_THROW(
+      cudf::experimental::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t),
+      cudf::logic_error);
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
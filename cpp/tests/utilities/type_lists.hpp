@@ -89,8 +89,15 @@ using IntegralTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t>;
  * // Invokes all typed fixture tests for all floating point types in libcudf
  * TYPED_TEST_CASE(MyTypedFixture, cudf::test::FloatingPointTypes);
  * ```
+ *
+ * The list is empty in builds that leave the floating point types out of
+ * `type_dispatcher` (`DISPATCH_FLOATING_POINT_TYPES=OFF`).
  */
+#ifdef CUDF_EXCLUDE_FLOATING_POINT_DISPATCH
+using FloatingPointTypes = cudf::test::Types<>;
+#else
 using FloatingPointTypes = cudf::test::Types<float, double>;
+#endif
 
 /**---------------------------------------------------------------------------*
  * @brief Provides a list of all numeric types supported in libcudf for use in a
@@ -101,8 +108,10 @@ using FloatingPointTypes = cudf::test::Types<float, double>;
  * // Invokes all typed fixture tests for all numeric types in libcudf
  * TYPED_TEST_CASE(MyTypedFixture, cudf::test::NumericTypes);
  * ```
+ *
+ * Only the floating point types that are dispatched in this build are listed.
  *---------------------------------------------------------------------------**/
-using NumericTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double, bool> ;
+using NumericTypes = Concat<IntegralTypes, FloatingPointTypes, cudf::test::Types<bool>>;
 
 /**---------------------------------------------------------------------------*
  * @brief Provides a list of all timestamp types supported in libcudf for use
@@ -113,9 +122,16 @@ using NumericTypes = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float,
  * // Invokes all typed fixture tests for all timestamp types in libcudf
  * TYPED_TEST_CASE(MyTypedFixture, cudf::test::TimestampTypes);
  * ```
+ *
+ * The list is empty in builds that leave the timestamp types out of
+ * `type_dispatcher` (`DISPATCH_TIMESTAMP_TYPES=OFF`).
  *---------------------------------------------------------------------------**/
+#ifdef CUDF_EXCLUDE_TIMESTAMP_DISPATCH
+using TimestampTypes = cudf::test::Types<>;
+#else
 using TimestampTypes = cudf::test::Types<timestamp_D, timestamp_s, timestamp_ms,
                                          timestamp_us, timestamp_ns>;
+#endif
 
 /**---------------------------------------------------------------------------*
  * @brief Provides a list of all string types supported in libcudf for use in a
@@ -189,8 +205,7 @@ static constexpr auto numeric_type_ids{detail::types_to_ids<NumericTypes>()};
  * This can be used for iterating over `type_id`s for custom testing, or used in
  * GTest value-parameterized tests.
  *---------------------------------------------------------------------------**/
-static constexpr std::array<cudf::type_id, 5> timestamp_type_ids{
-    detail::types_to_ids<TimestampTypes>()};
+static constexpr auto timestamp_type_ids{detail::types_to_ids<TimestampTypes>()};
 
 /**---------------------------------------------------------------------------*
  * @brief `std::array` of all non-numeric `cudf::type_id`s
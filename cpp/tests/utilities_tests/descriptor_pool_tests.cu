@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/descriptor_pool.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <rmm/device_vector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
+using cudf::detail::descriptor_pool;
+
+struct DescriptorPoolTest : public cudf::test::BaseFixture {};
+
+TEST_F(DescriptorPoolTest, SizeClasses) {
+  auto& pool = descriptor_pool::instance();
+  EXPECT_EQ(nullptr, pool.acquire(0));
+  EXPECT_EQ(nullptr, pool.acquire(descriptor_pool::max_block_size + 1));
+
+  auto const small = pool.acquire(10);
+  ASSERT_NE(nullptr, small);
+  EXPECT_EQ(descriptor_pool::min_block_size, small->size);
+  auto const large = pool.acquire(descriptor_pool::min_block_size + 1);
+  ASSERT_NE(nullptr, large);
+  EXPECT_EQ(2 * descriptor_pool::min_block_size, large->size);
+  pool.release(small, 0);
+  pool.release(large, 0);
+}
+
+TEST_F(DescriptorPoolTest, ReusedAfterRelease) {
+  // The largest size class is not used by the other tests
+  auto& pool       = descriptor_pool::instance();
+  auto const first = pool.acquire(descriptor_pool::max_block_size);
+  ASSERT_NE(nullptr, first);
+  pool.release(first, 0);
+  ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(0));
+  auto const second = pool.acquire(descriptor_pool::max_block_size);
+  EXPECT_EQ(first, second);
+  pool.release(second, 0);
+}
+
+TEST_F(DescriptorPoolTest, TableDeviceViews) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({1, 2, 3});
+  cudf::test::strings_column_wrapper col1({"a", "bb", "ccc"});
+  cudf::table_view const input({col0, col1});
+  for (int i = 0; i < 3; ++i) {
+    auto const d_input = cudf::table_device_view::create(input);
+    EXPECT_EQ(2, d_input->num_columns());
+    EXPECT_EQ(3, d_input->num_rows());
+  }
+}
+
+TEST_F(DescriptorPoolTest, TableDeviceViewsOnNonBlockingStream) {
+  cudaStream_t stream;
+  ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  // Each view is released while the kernel reading it may still be pending,
+  // so a block reused too early would read the columns of another table
+  constexpr int num_tables = 8;
+  constexpr int num_rows   = 1000;
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> columns;
+  for (int t = 0; t < num_tables; ++t) {
+    auto const values = thrust::make_counting_iterator(t * num_rows);
+    columns.emplace_back(values, values + num_rows);
+  }
+  rmm::device_vector<int32_t> results(num_tables * num_rows);
+  for (int t = 0; t < num_tables; ++t) {
+    cudf::table_view const input({columns[t]});
+    auto const d_input = cudf::table_device_view::create(input, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_rows),
+                      results.begin() + t * num_rows,
+                      [d_input = *d_input] __device__(cudf::size_type i) {
+                        return d_input.column(0).element<int32_t>(i);
+                      });
+  }
+  ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+  thrust::host_vector<int32_t> const h_results(results);
+  for (int i = 0; i < num_tables * num_rows; ++i) { EXPECT_EQ(i, h_results[i]); }
+  ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/managed_memory.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/managed_memory_resource.hpp>
+
+#include <vector>
+
+struct ManagedMemoryTest : public cudf::test::BaseFixture {};
+
+TEST_F(ManagedMemoryTest, EnablePrefetch) {
+  auto const enabled = cudf::is_managed_memory_prefetch_enabled();
+  EXPECT_EQ(cudf::set_managed_memory_prefetch(false), enabled);
+  EXPECT_FALSE(cudf::is_managed_memory_prefetch_enabled());
+  EXPECT_FALSE(cudf::set_managed_memory_prefetch(true));
+  EXPECT_TRUE(cudf::is_managed_memory_prefetch_enabled());
+  cudf::set_managed_memory_prefetch(enabled);
+}
+
+TEST_F(ManagedMemoryTest, PrefetchToDevice) {
+  auto const enabled = cudf::set_managed_memory_prefetch(true);
+  rmm::mr::managed_memory_resource managed;
+  rmm::device_buffer buffer(1 << 20, 0, &managed);
+  cudf::detail::prefetch_to_device(buffer.data(), buffer.size(), 0);
+  ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(0));
+
+  int device             = 0;
+  int concurrent_managed = 0;
+  ASSERT_EQ(cudaSuccess, cudaGetDevice(&device));
+  ASSERT_EQ(cudaSuccess,
+            cudaDeviceGetAttribute(&concurrent_managed, cudaDevAttrConcurrentManagedAccess, device));
+  if (concurrent_managed != 0) {
+    int location = cudaCpuDeviceId;
+    ASSERT_EQ(cudaSuccess,
+              cudaMemRangeGetAttribute(&location,
+                                       sizeof(location),
+                                       cudaMemRangeAttributeLastPrefetchLocation,
+                                       buffer.data(),
+                                       buffer.size()));
+    EXPECT_EQ(location, device);
+  }
+  cudf::set_managed_memory_prefetch(enabled);
+}
+
+TEST_F(ManagedMemoryTest, IgnoresOtherMemory) {
+  auto const enabled = cudf::set_managed_memory_prefetch(true);
+  std::vector<char> host(1024);
+  rmm::device_buffer device(1024);
+  cudf::detail::prefetch_to_device(host.data(), host.size(), 0);
+  cudf::detail::prefetch_to_device(device.data(), device.size(), 0);
+  cudf::detail::prefetch_to_device(nullptr, 1024, 0);
+  EXPECT_EQ(cudaSuccess, cudaGetLastError());
+  cudf::set_managed_memory_prefetch(enabled);
+}
+
+TEST_F(ManagedMemoryTest, KeepsPendingErrors) {
+  auto const enabled = cudf::set_managed_memory_prefetch(true);
+  std::vector<char> host(1024);
+  void* ptr = nullptr;
+  ASSERT_EQ(cudaErrorMemoryAllocation, cudaMalloc(&ptr, std::size_t{1} << 62));
+
+  // The error of the failed allocation is still reported after the prefetch
+  cudf::detail::prefetch_to_device(host.data(), host.size(), 0);
+  EXPECT_EQ(cudaErrorMemoryAllocation, cudaGetLastError());
+  EXPECT_EQ(cudaSuccess, cudaGetLastError());
+  cudf::set_managed_memory_prefetch(enabled);
+}
+
+TEST_F(ManagedMemoryTest, GatherManagedColumns) {
+  auto const enabled = cudf::set_managed_memory_prefetch(true);
+  rmm::mr::managed_memory_resource managed;
+  cudf::test::fixed_width_column_wrapper<int32_t> values({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper names({"a", "bb", "ccc", "dddd", "e"});
+  cudf::test::fixed_width_column_wrapper<int32_t> map{4, 0, 2};
+  cudf::column managed_values(values, 0, &managed);
+  cudf::column managed_names(names, 0, &managed);
+  cudf::table_view managed_table{{managed_values, managed_names}};
+
+  auto const expected = cudf::experimental::gather(cudf::table_view{{values, names}}, map);
+  auto const result   = cudf::experimental::gather(managed_table, map);
+  cudf::test::expect_tables_equal(expected->view(), result->view());
+  EXPECT_EQ(cudaSuccess, cudaGetLastError());
+  cudf::set_managed_memory_prefetch(enabled);
+}
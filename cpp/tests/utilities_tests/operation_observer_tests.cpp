@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/operation_observer.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct recording_observer : public cudf::operation_observer {
+  void record(cudf::operation_record const& op) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    records.push_back(op);
+  }
+
+  std::mutex mutex;
+  std::vector<cudf::operation_record> records;
+};
+
+struct OperationObserverTest : public cudf::test::BaseFixture {};
+
+TEST_F(OperationObserverTest, RecordsPublicCalls) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 3, 4, 1, 2}};
+  cudf::table_view input{{col}};
+
+  recording_observer observer;
+  auto const default_resource = rmm::mr::get_default_resource();
+  EXPECT_EQ(nullptr, cudf::set_operation_observer(&observer));
+  EXPECT_EQ(&observer, cudf::get_operation_observer());
+  EXPECT_NE(default_resource, rmm::mr::get_default_resource());
+
+  auto result = cudf::experimental::sorted_order(input);
+  ASSERT_EQ(1u, observer.records.size());
+  auto const& op = observer.records.front();
+  EXPECT_EQ(std::string("sorted_order"), op.name);
+  EXPECT_EQ(cudf::operation_kind::FUNCTION, op.kind);
+  EXPECT_EQ(0, op.depth);
+  EXPECT_GE(op.wall_time_ms, 0.0);
+  EXPECT_GE(op.gpu_time_ms, 0.0);
+  EXPECT_GE(op.allocations, 1u);
+  EXPECT_GE(op.allocated_bytes, input.num_rows() * sizeof(cudf::size_type));
+  EXPECT_GE(op.peak_bytes, input.num_rows() * sizeof(cudf::size_type));
+  EXPECT_LE(op.peak_bytes, op.allocated_bytes);
+
+  EXPECT_EQ(&observer, cudf::set_operation_observer(nullptr));
+  EXPECT_EQ(default_resource, rmm::mr::get_default_resource());
+  result = cudf::experimental::sorted_order(input);
+  EXPECT_EQ(1u, observer.records.size());
+}
+
+TEST_F(OperationObserverTest, CallsThatThrowAreNotRecorded) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 2}};
+  cudf::table_view input{{col}};
+
+  recording_observer observer;
+  cudf::set_operation_observer(&observer);
+  // Too many orders for the number of columns
+  EXPECT_THROW(
+    cudf::experimental::sorted_order(input, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+    cudf::logic_error);
+  cudf::set_operation_observer(nullptr);
+  EXPECT_TRUE(observer.records.empty());
+}
+
+TEST_F(OperationObserverTest, RecordsPhases) {
+  cudf::test::fixed_width_column_wrapper<int32_t> left{{1, 2, 3, 4}};
+  cudf::test::fixed_width_column_wrapper<int32_t> right{{2, 4, 6}};
+  cudf::table_view left_table{{left}};
+  cudf::table_view right_table{{right}};
+
+  recording_observer observer;
+  cudf::set_operation_observer(&observer);
+  auto result = cudf::experimental::inner_join(left_table, right_table, {0}, {0}, {{0, 0}});
+  cudf::set_operation_observer(nullptr);
+
+  std::vector<std::string> phases;
+  for (auto const& op : observer.records) {
+    if (op.kind == cudf::operation_kind::PHASE) {
+      phases.push_back(op.name);
+      EXPECT_GT(op.depth, 0);
+    }
+  }
+  EXPECT_EQ((std::vector<std::string>{"hash_join_build", "hash_join_probe"}), phases);
+  // The enclosing call is recorded last
+  EXPECT_EQ(std::string("inner_join"), observer.records.back().name);
+  EXPECT_EQ(0, observer.records.back().depth);
+}
+
+TEST_F(OperationObserverTest, SummaryAccumulatesNames) {
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+  cudf::table_view input{{col}};
+
+  cudf::operation_summary summary;
+  cudf::set_operation_observer(&summary);
+  cudf::experimental::sorted_order(input);
+  cudf::experimental::sorted_order(input);
+  cudf::set_operation_observer(nullptr);
+
+  auto statistics = summary.statistics();
+  ASSERT_EQ(1u, statistics.count("sorted_order"));
+  auto const& entry = statistics["sorted_order"];
+  EXPECT_EQ(2u, entry.calls);
+  EXPECT_GE(entry.total_bytes, 2 * entry.peak_bytes);
+  EXPECT_GT(entry.peak_bytes, 0u);
+
+  summary.clear();
+  EXPECT_TRUE(summary.statistics().empty());
+}
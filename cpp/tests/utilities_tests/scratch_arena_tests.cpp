@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/scratch_arena.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <cstdint>
+
+using cudf::experimental::detail::scratch_arena;
+using cudf::experimental::detail::scratch_scope;
+
+struct ScratchArenaTest : public cudf::test::BaseFixture {};
+
+/**
+ * @brief Resource counting the bytes allocated from its upstream and not yet freed
+ */
+class counting_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit counting_resource(rmm::mr::device_memory_resource* upstream) : _upstream{upstream} {}
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+  size_t current_bytes = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override {
+    current_bytes += bytes;
+    return _upstream->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override {
+    current_bytes -= bytes;
+    _upstream->deallocate(p, bytes, stream);
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override {
+    return std::make_pair(0, 0);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+};
+
+TEST_F(ScratchArenaTest, AlignedAllocations) {
+  scratch_scope scratch;
+  rmm::device_buffer first(10, 0, scratch.resource());
+  rmm::device_buffer second(10, 0, scratch.resource());
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(first.data()) % scratch_arena::alignment);
+  EXPECT_EQ(static_cast<char*>(first.data()) + scratch_arena::alignment, second.data());
+}
+
+TEST_F(ScratchArenaTest, ReusedAfterScope) {
+  scratch_scope outer;
+  void* first = nullptr;
+  {
+    scratch_scope scratch;
+    rmm::device_buffer buffer(1000, 0, scratch.resource());
+    first = buffer.data();
+  }
+  scratch_scope scratch;
+  rmm::device_buffer buffer(1000, 0, scratch.resource());
+  EXPECT_EQ(first, buffer.data());
+}
+
+TEST_F(ScratchArenaTest, FreedAfterOutermostScope) {
+  counting_resource counting{rmm::mr::get_default_resource()};
+  auto const previous = rmm::mr::set_default_resource(&counting);
+  {
+    scratch_scope scratch;
+    rmm::device_buffer buffer(1000, 0, scratch.resource());
+    EXPECT_GT(counting.current_bytes, 0u);
+  }
+  // Nothing is left to deallocate into the resource once it is replaced
+  EXPECT_EQ(0u, counting.current_bytes);
+  rmm::mr::set_default_resource(previous);
+}
+
+TEST_F(ScratchArenaTest, NestedScopes) {
+  scratch_scope outer;
+  rmm::device_buffer outer_buffer(1000, 0, outer.resource());
+  void* inner_data = nullptr;
+  {
+    scratch_scope inner;
+    rmm::device_buffer inner_buffer(1000, 0, inner.resource());
+    inner_data = inner_buffer.data();
+    EXPECT_NE(outer_buffer.data(), inner_data);
+  }
+  rmm::device_buffer next_buffer(1000, 0, outer.resource());
+  EXPECT_EQ(inner_data, next_buffer.data());
+}
+
+TEST_F(ScratchArenaTest, LargeAllocations) {
+  scratch_scope scratch;
+  rmm::device_buffer small(1000, 0, scratch.resource());
+  rmm::device_buffer large(4 * scratch_arena::min_block_size, 0, scratch.resource());
+  rmm::device_buffer next(1000, 0, scratch.resource());
+  EXPECT_NE(nullptr, large.data());
+  EXPECT_NE(large.data(), next.data());
+  EXPECT_NE(small.data(), next.data());
+}
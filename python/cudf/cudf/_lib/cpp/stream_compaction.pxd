@@ -18,6 +18,7 @@ cdef extern from "cudf/stream_compaction.hpp" namespace "cudf::experimental" \
         KEEP_FIRST 'cudf::experimental::duplicate_keep_option::KEEP_FIRST'
         KEEP_LAST 'cudf::experimental::duplicate_keep_option::KEEP_LAST'
         KEEP_NONE 'cudf::experimental::duplicate_keep_option::KEEP_NONE'
+        KEEP_ANY 'cudf::experimental::duplicate_keep_option::KEEP_ANY'
 
     cdef unique_ptr[table] drop_nulls(table_view source_table,
                                       vector[size_type] keys,
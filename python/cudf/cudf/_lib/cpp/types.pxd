@@ -54,13 +54,19 @@ cdef extern from "cudf/types.hpp" namespace "cudf" nogil:
         TIMESTAMP_NANOSECONDS = 12
         DICTIONARY32 = 13
         STRING = 14
-        NUM_TYPE_IDS = 15
+        DECIMAL32 = 15
+        DECIMAL64 = 16
+        LIST = 17
+        STRUCT = 18
+        NUM_TYPE_IDS = 19
 
     cdef cppclass data_type:
         data_type() except +
         data_type(const data_type&) except +
         data_type(type_id id) except +
+        data_type(type_id id, int32_t scale) except +
         type_id id() except +
+        int32_t scale() except +
 
 cdef extern from "cudf/types.hpp" namespace "cudf::experimental" nogil:
     ctypedef enum interpolation: